@@ -0,0 +1,1143 @@
+// Benchmark harness of the texture compiler. Every case runs the compiler executable as a separate process, like a
+// build system does, so the wall time includes start up and the peak memory usage is the one of the compiler process
+// alone. Inputs are either generated here at several sizes or taken from a corpus directory.
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <clara.hpp>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+struct BenchCommandLine final {
+    BenchCommandLine() = default;
+    BenchCommandLine(const BenchCommandLine& another) = delete;
+    BenchCommandLine(BenchCommandLine&& another) = delete;
+    BenchCommandLine& operator=(const BenchCommandLine& another) = delete;
+    BenchCommandLine& operator=(BenchCommandLine&& another) = delete;
+
+    std::string compiler;
+    std::string work_directory = "texture_compiler_bench";
+    std::string corpus;
+    std::string sizes = "256,1024";
+    std::string filter;
+    std::string extra_arguments;
+    std::string renderers;
+    std::string json;
+    std::string baseline;
+    std::string determinism;
+    double time_tolerance = 0.25;
+    double memory_tolerance = 0.1;
+    size_t runs = 5;
+    size_t warmup = 1;
+    bool is_no_synthetic = false;
+    bool is_report_quality = false;
+    bool is_help = false;
+};
+
+// A single compiler invocation that is timed `runs` times.
+struct BenchCase final {
+    std::string name;
+    std::string arguments;
+
+    // Pixels of the input, zero when they're unknown.
+    uint64_t input_pixels = 0;
+
+    // `--renderer` of cube map cases of `--renderers`, empty for the rest.
+    std::string renderer;
+
+    // Files the case writes, which `--determinism` compares.
+    std::vector<std::string> outputs;
+};
+
+struct BenchResult final {
+    std::string name;
+    uint64_t input_pixels = 0;
+    size_t runs = 0;
+    double median_seconds = 0.0;
+    double p95_seconds = 0.0;
+    size_t peak_memory_usage = 0;
+    bool is_failed = false;
+
+    // Medians of the page faults the compiler reports in its `--metrics` and of the data TLB misses of the compiler
+    // process, negative when the platform can't count them.
+    double page_faults = -1.0;
+    double dtlb_misses = -1.0;
+
+    // Renderer of cube map cases of `--renderers` and the median time of their `readback` phases, negative for the rest.
+    std::string renderer;
+    double readback_seconds = -1.0;
+
+    // Quality of the first mip level of the main output with `--report-quality`, negative when it isn't reported.
+    double psnr = -1.0;
+    double ssim = -1.0;
+    double mean_angular_error = -1.0;
+};
+
+// A case of the `--json` file of an earlier run that `--baseline` compares with.
+struct BaselineCase final {
+    std::string name;
+    double median_seconds = -1.0;
+    double peak_memory_usage = -1.0;
+    bool is_failed = false;
+};
+
+static constexpr const char* COMPRESSIONS[] = { "production", "development", "no-compression" };
+
+// Growth of a median time over the baseline below this many seconds is noise of process start up, whatever the
+// tolerance, which cases of small inputs would otherwise trip.
+static constexpr double BASELINE_TIME_SLACK = 0.05;
+
+// Irradiance and prefilter sizes of cube map cases. Every compression is benchmarked with the first pair, the rest
+// only with development compression, which is the one artists iterate with.
+static constexpr int CUBE_MAP_SIZES[][2] = { { 32, 128 }, { 16, 64 }, { 64, 256 } };
+
+static std::string quote(const std::string& value) {
+    return "\"" + value + "\"";
+}
+
+static uint32_t crc32(const uint8_t* data, size_t size, uint32_t crc = 0) noexcept {
+    static uint32_t table[256] = {};
+    if (table[1] == 0) {
+        for (uint32_t i = 0; i < 256; i++) {
+            uint32_t value = i;
+            for (int bit = 0; bit < 8; bit++) {
+                value = (value & 1) != 0 ? 0xEDB88320U ^ (value >> 1) : value >> 1;
+            }
+            table[i] = value;
+        }
+    }
+
+    crc = ~crc;
+    for (size_t i = 0; i < size; i++) {
+        crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+static void append_u32_be(std::vector<uint8_t>& output, uint32_t value) {
+    output.push_back(static_cast<uint8_t>(value >> 24));
+    output.push_back(static_cast<uint8_t>(value >> 16));
+    output.push_back(static_cast<uint8_t>(value >> 8));
+    output.push_back(static_cast<uint8_t>(value));
+}
+
+static void append_png_chunk(std::vector<uint8_t>& output, const char* type, const std::vector<uint8_t>& data) {
+    append_u32_be(output, static_cast<uint32_t>(data.size()));
+    const size_t type_offset = output.size();
+    output.insert(output.end(), type, type + 4);
+    output.insert(output.end(), data.begin(), data.end());
+    append_u32_be(output, crc32(output.data() + type_offset, output.size() - type_offset));
+}
+
+// Writes an RGBA8 PNG. Deflate blocks are stored, because the harness doesn't depend on zlib. Decoding them still
+// goes through inflate and the unfiltering of rows, only faster than for real PNGs, so corpus inputs are the ones to
+// measure decode time with.
+static bool write_png(const std::string& path, const std::vector<uint8_t>& rgba, uint32_t width, uint32_t height) {
+    std::vector<uint8_t> rows;
+    rows.reserve((static_cast<size_t>(width) * 4 + 1) * height);
+    for (uint32_t y = 0; y < height; y++) {
+        rows.push_back(0);
+        rows.insert(rows.end(), rgba.begin() + static_cast<size_t>(y) * width * 4, rgba.begin() + static_cast<size_t>(y + 1) * width * 4);
+    }
+
+    std::vector<uint8_t> zlib = { 0x78, 0x01 };
+    for (size_t offset = 0; offset < rows.size() || offset == 0; offset += 65535) {
+        const size_t size = std::min<size_t>(rows.size() - offset, 65535);
+        zlib.push_back(offset + size == rows.size() ? 1 : 0);
+        zlib.push_back(static_cast<uint8_t>(size));
+        zlib.push_back(static_cast<uint8_t>(size >> 8));
+        zlib.push_back(static_cast<uint8_t>(~size));
+        zlib.push_back(static_cast<uint8_t>(~size >> 8));
+        zlib.insert(zlib.end(), rows.begin() + offset, rows.begin() + offset + size);
+    }
+
+    uint32_t a = 1;
+    uint32_t b = 0;
+    for (uint8_t value : rows) {
+        a = (a + value) % 65521;
+        b = (b + a) % 65521;
+    }
+    append_u32_be(zlib, (b << 16) | a);
+
+    std::vector<uint8_t> header;
+    append_u32_be(header, width);
+    append_u32_be(header, height);
+    header.insert(header.end(), { 8, 6, 0, 0, 0 });
+
+    std::vector<uint8_t> png = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+    append_png_chunk(png, "IHDR", header);
+    append_png_chunk(png, "IDAT", zlib);
+    append_png_chunk(png, "IEND", {});
+
+    std::ofstream stream(path, std::ios::binary);
+    stream.write(reinterpret_cast<const char*>(png.data()), static_cast<std::streamsize>(png.size()));
+    return static_cast<bool>(stream);
+}
+
+// Writes a Radiance HDR image with flat scanlines, which every reader supports.
+static bool write_hdr(const std::string& path, const std::vector<float>& rgb, uint32_t width, uint32_t height) {
+    std::ofstream stream(path, std::ios::binary);
+    stream << "#?RADIANCE\nFORMAT=32-bit_rle_rgbe\n\n-Y " << height << " +X " << width << "\n";
+
+    std::vector<uint8_t> row(static_cast<size_t>(width) * 4);
+    for (uint32_t y = 0; y < height; y++) {
+        for (uint32_t x = 0; x < width; x++) {
+            const float* const color = rgb.data() + (static_cast<size_t>(y) * width + x) * 3;
+            const float maximum = std::max(color[0], std::max(color[1], color[2]));
+            uint8_t* const rgbe = row.data() + static_cast<size_t>(x) * 4;
+            if (maximum < 1e-32f) {
+                std::memset(rgbe, 0, 4);
+            } else {
+                int exponent;
+                const float scale = std::frexp(maximum, &exponent) * 256.0f / maximum;
+                rgbe[0] = static_cast<uint8_t>(color[0] * scale);
+                rgbe[1] = static_cast<uint8_t>(color[1] * scale);
+                rgbe[2] = static_cast<uint8_t>(color[2] * scale);
+                rgbe[3] = static_cast<uint8_t>(exponent + 128);
+            }
+        }
+
+        // A scanline starting with 2, 2 and a small third byte would be read as run length encoded.
+        if (row[0] == 2 && row[1] == 2 && (row[2] & 0x80) == 0) {
+            row[1] = 3;
+        }
+        stream.write(reinterpret_cast<const char*>(row.data()), static_cast<std::streamsize>(row.size()));
+    }
+    return static_cast<bool>(stream);
+}
+
+// Deterministic noise in [0, 1], so inputs are the same on every machine and every run.
+static float get_noise(uint32_t x, uint32_t y, uint32_t seed) noexcept {
+    uint32_t value = x * 0x8DA6B343U ^ y * 0xD8163841U ^ seed * 0xCB1AB31FU;
+    value ^= value >> 13;
+    value *= 0x5BD1E995U;
+    value ^= value >> 15;
+    return static_cast<float>(value & 0xFFFF) / 65535.0f;
+}
+
+static uint8_t to_unorm8(float value) noexcept {
+    return static_cast<uint8_t>(std::clamp(value, 0.0f, 1.0f) * 255.0f + 0.5f);
+}
+
+// Smooth color gradients with fine noise, the roughness in alpha varies in large blotches.
+static bool write_synthetic_albedo(const std::string& path, uint32_t size) {
+    std::vector<uint8_t> rgba(static_cast<size_t>(size) * size * 4);
+    for (uint32_t y = 0; y < size; y++) {
+        for (uint32_t x = 0; x < size; x++) {
+            const float u = static_cast<float>(x) / static_cast<float>(size);
+            const float v = static_cast<float>(y) / static_cast<float>(size);
+            const float noise = get_noise(x, y, 1) * 0.15f;
+            uint8_t* const pixel = rgba.data() + (static_cast<size_t>(y) * size + x) * 4;
+            pixel[0] = to_unorm8(0.5f + 0.4f * std::sin(u * 9.0f) + noise);
+            pixel[1] = to_unorm8(0.4f + 0.3f * std::cos(v * 7.0f + u * 3.0f) + noise);
+            pixel[2] = to_unorm8(0.3f + 0.2f * std::sin((u + v) * 5.0f) + noise);
+            pixel[3] = to_unorm8(0.5f + 0.4f * std::sin(u * 3.0f) * std::cos(v * 4.0f) + get_noise(x, y, 2) * 0.05f);
+        }
+    }
+    return write_png(path, rgba, size, size);
+}
+
+// Normals of a bumpy height field with a checker of metalness and ambient occlusion in the valleys.
+static bool write_synthetic_normal(const std::string& path, uint32_t size) {
+    std::vector<uint8_t> rgba(static_cast<size_t>(size) * size * 4);
+    const float frequency = 40.0f / static_cast<float>(size);
+    for (uint32_t y = 0; y < size; y++) {
+        for (uint32_t x = 0; x < size; x++) {
+            const float height = std::sin(static_cast<float>(x) * frequency) * std::cos(static_cast<float>(y) * frequency);
+            const float dx = std::cos(static_cast<float>(x) * frequency) * std::cos(static_cast<float>(y) * frequency) + (get_noise(x, y, 3) - 0.5f) * 0.3f;
+            const float dy = -std::sin(static_cast<float>(x) * frequency) * std::sin(static_cast<float>(y) * frequency) + (get_noise(x, y, 4) - 0.5f) * 0.3f;
+            const float length = std::sqrt(dx * dx + dy * dy + 1.0f);
+            uint8_t* const pixel = rgba.data() + (static_cast<size_t>(y) * size + x) * 4;
+            pixel[0] = to_unorm8(0.5f - 0.5f * dx / length);
+            pixel[1] = to_unorm8(0.5f - 0.5f * dy / length);
+            pixel[2] = ((x / 64 + y / 64) & 1) != 0 ? 255 : 0;
+            pixel[3] = to_unorm8(0.75f + 0.25f * height);
+        }
+    }
+    return write_png(path, rgba, size, size);
+}
+
+// Equirectangular sky with a gradient, noisy clouds and a sun much brighter than one, `size * 2` x `size`.
+static bool write_synthetic_hdr(const std::string& path, uint32_t size) {
+    const uint32_t width = size * 2;
+    std::vector<float> rgb(static_cast<size_t>(width) * size * 3);
+    for (uint32_t y = 0; y < size; y++) {
+        for (uint32_t x = 0; x < width; x++) {
+            const float u = static_cast<float>(x) / static_cast<float>(width);
+            const float v = static_cast<float>(y) / static_cast<float>(size);
+            const float sun_distance = std::hypot(u - 0.3f, (v - 0.25f) * 0.5f);
+            const float sun = sun_distance < 0.01f ? 50.0f : 0.0f;
+            const float clouds = v < 0.5f ? get_noise(x / 4, y / 4, 5) * 0.3f : 0.0f;
+            float* const color = rgb.data() + (static_cast<size_t>(y) * width + x) * 3;
+            color[0] = (v < 0.5f ? 0.3f + v : 0.2f) + clouds + sun;
+            color[1] = (v < 0.5f ? 0.5f + v * 0.6f : 0.15f) + clouds + sun;
+            color[2] = (v < 0.5f ? 1.0f - v * 0.4f : 0.1f) + clouds + sun * 0.9f;
+        }
+    }
+    return write_hdr(path, rgb, width, size);
+}
+
+static uint32_t read_u32_be(const uint8_t* data) noexcept {
+    return (static_cast<uint32_t>(data[0]) << 24) | (static_cast<uint32_t>(data[1]) << 16) | (static_cast<uint32_t>(data[2]) << 8) | data[3];
+}
+
+static uint32_t read_u32_le(const uint8_t* data) noexcept {
+    return data[0] | (static_cast<uint32_t>(data[1]) << 8) | (static_cast<uint32_t>(data[2]) << 16) | (static_cast<uint32_t>(data[3]) << 24);
+}
+
+// Size of a corpus image from its header, false when the header isn't understood.
+static bool get_image_size(const std::filesystem::path& path, const std::string& extension, uint64_t& width, uint64_t& height) {
+    std::ifstream stream(path, std::ios::binary);
+    std::vector<uint8_t> header(65536);
+    stream.read(reinterpret_cast<char*>(header.data()), static_cast<std::streamsize>(header.size()));
+    header.resize(static_cast<size_t>(stream.gcount()));
+
+    if (extension == ".png" && header.size() >= 24) {
+        width = read_u32_be(header.data() + 16);
+        height = read_u32_be(header.data() + 20);
+        return true;
+    }
+    if (extension == ".qoi" && header.size() >= 14) {
+        width = read_u32_be(header.data() + 4);
+        height = read_u32_be(header.data() + 8);
+        return true;
+    }
+    if (extension == ".tga" && header.size() >= 16) {
+        width = header[12] | (header[13] << 8);
+        height = header[14] | (header[15] << 8);
+        return true;
+    }
+    if (extension == ".hdr") {
+        std::istringstream lines(std::string(header.begin(), header.end()));
+        std::string line;
+        while (std::getline(lines, line)) {
+            unsigned long long line_width;
+            unsigned long long line_height;
+            char y_sign;
+            char x_sign;
+            if (std::sscanf(line.c_str(), "%cY %llu %cX %llu", &y_sign, &line_height, &x_sign, &line_width) == 4) {
+                width = line_width;
+                height = line_height;
+                return true;
+            }
+        }
+        return false;
+    }
+    if (extension == ".exr" && header.size() >= 8) {
+        // Attributes are a name, a type, a size and a value, the data window is a box of four integers.
+        size_t offset = 8;
+        while (offset < header.size()) {
+            const std::string name(reinterpret_cast<const char*>(header.data() + offset), strnlen(reinterpret_cast<const char*>(header.data() + offset), header.size() - offset));
+            if (name.empty()) {
+                break;
+            }
+            offset += name.size() + 1;
+            offset += strnlen(reinterpret_cast<const char*>(header.data() + std::min(offset, header.size())), header.size() - std::min(offset, header.size())) + 1;
+            if (offset + 4 > header.size()) {
+                break;
+            }
+            const uint32_t size = read_u32_le(header.data() + offset);
+            offset += 4;
+            if (name == "dataWindow" && size == 16 && offset + 16 <= header.size()) {
+                const int32_t min_x = static_cast<int32_t>(read_u32_le(header.data() + offset));
+                const int32_t min_y = static_cast<int32_t>(read_u32_le(header.data() + offset + 4));
+                const int32_t max_x = static_cast<int32_t>(read_u32_le(header.data() + offset + 8));
+                const int32_t max_y = static_cast<int32_t>(read_u32_le(header.data() + offset + 12));
+                if (max_x < min_x || max_y < min_y) {
+                    return false;
+                }
+                width = static_cast<uint64_t>(max_x - min_x + 1);
+                height = static_cast<uint64_t>(max_y - min_y + 1);
+                return true;
+            }
+            offset += size;
+        }
+    }
+    return false;
+}
+
+static void add_texture_cases(std::vector<BenchCase>& cases, const std::string& label, const std::string& input, const std::string& output, uint64_t input_pixels, bool is_normal) {
+    for (const char* compression : COMPRESSIONS) {
+        BenchCase bench_case;
+        bench_case.name = std::string(is_normal ? "normal_metalness_ambient_occlusion/" : "albedo_roughness/") + compression + "/" + label;
+        bench_case.arguments = std::string(is_normal ? "--normal-metalness-ambient-occlusion" : "--albedo-roughness") +
+                               " --input " + quote(input) + " --output " + quote(output) + " --" + compression;
+        bench_case.input_pixels = input_pixels;
+        bench_case.outputs = { output };
+        cases.push_back(std::move(bench_case));
+    }
+}
+
+static void add_cube_map_cases(std::vector<BenchCase>& cases, const std::string& label, const std::string& input, const std::string& output, uint64_t input_pixels, int output_size) {
+    for (size_t i = 0; i < std::size(CUBE_MAP_SIZES); i++) {
+        for (const char* compression : COMPRESSIONS) {
+            if (i > 0 && std::strcmp(compression, "development") != 0) {
+                continue;
+            }
+
+            const int irradiance_size = CUBE_MAP_SIZES[i][0];
+            const int prefilter_size = CUBE_MAP_SIZES[i][1];
+
+            BenchCase bench_case;
+            bench_case.name = std::string("cube_map/") + compression + "/" + label + "/irradiance" + std::to_string(irradiance_size) + "/prefilter" + std::to_string(prefilter_size);
+            bench_case.arguments = "--cube-map --input " + quote(input) + " --output " + quote(output + ".texture") + " --output-size " + std::to_string(output_size) +
+                                   " --irradiance " + quote(output + "_irradiance.texture") + " --irradiance-size " + std::to_string(irradiance_size) +
+                                   " --prefilter " + quote(output + "_prefilter.texture") + " --prefilter-size " + std::to_string(prefilter_size) + " --" + compression;
+            bench_case.input_pixels = input_pixels;
+            bench_case.outputs = { output + ".texture", output + "_irradiance.texture", output + "_prefilter.texture" };
+            cases.push_back(std::move(bench_case));
+        }
+    }
+}
+
+static bool parse_sizes(const std::string& sizes, std::vector<uint32_t>& output) {
+    std::istringstream stream(sizes);
+    std::string size;
+    while (std::getline(stream, size, ',')) {
+        char* end = nullptr;
+        const unsigned long value = std::strtoul(size.c_str(), &end, 10);
+        if (size.empty() || *end != '\0' || value < 16 || value > 16384) {
+            return false;
+        }
+        output.push_back(static_cast<uint32_t>(value));
+    }
+    return !output.empty();
+}
+
+static bool parse_renderers(const std::string& renderers, std::vector<std::string>& output) {
+    std::istringstream stream(renderers);
+    std::string renderer;
+    while (std::getline(stream, renderer, ',')) {
+        if (renderer != "vulkan" && renderer != "d3d11" && renderer != "d3d12" && renderer != "metal" && renderer != "gl") {
+            return false;
+        }
+        output.push_back(renderer);
+    }
+    return !output.empty();
+}
+
+static bool parse_thread_counts(const std::string& thread_counts, std::vector<uint32_t>& output) {
+    std::istringstream stream(thread_counts);
+    std::string thread_count;
+    while (std::getline(stream, thread_count, ',')) {
+        char* end = nullptr;
+        const unsigned long value = std::strtoul(thread_count.c_str(), &end, 10);
+        if (thread_count.empty() || *end != '\0' || value < 1 || value > 1024) {
+            return false;
+        }
+        output.push_back(static_cast<uint32_t>(value));
+    }
+    return !output.empty();
+}
+
+// Replaces every cube map case with one case per renderer, which passes `--renderer` to the compiler.
+static void add_renderer_cases(std::vector<BenchCase>& cases, const std::vector<std::string>& renderers) {
+    std::vector<BenchCase> renderer_cases;
+    for (BenchCase& bench_case : cases) {
+        if (bench_case.name.rfind("cube_map/", 0) != 0) {
+            renderer_cases.push_back(std::move(bench_case));
+            continue;
+        }
+        for (const std::string& renderer : renderers) {
+            BenchCase renderer_case;
+            renderer_case.name = bench_case.name + "/" + renderer;
+            renderer_case.arguments = bench_case.arguments + " --renderer " + renderer;
+            renderer_case.input_pixels = bench_case.input_pixels;
+            renderer_case.renderer = renderer;
+            renderer_case.outputs = bench_case.outputs;
+            renderer_cases.push_back(std::move(renderer_case));
+        }
+    }
+    cases = std::move(renderer_cases);
+}
+
+// Generates synthetic inputs into `directory` and adds their cases.
+static int add_synthetic_cases(const BenchCommandLine& command_line, const std::filesystem::path& directory, std::vector<BenchCase>& cases) {
+    std::vector<uint32_t> sizes;
+    if (!parse_sizes(command_line.sizes, sizes)) {
+        std::cout << "Texture compiler bench error. Command line argument --sizes must be a comma separated list of sizes from 16 to 16384." << std::endl;
+        return 1;
+    }
+
+    for (uint32_t size : sizes) {
+        const std::string label = std::to_string(size);
+        const std::string albedo = (directory / ("albedo_" + label + ".png")).string();
+        const std::string normal = (directory / ("normal_" + label + ".png")).string();
+        const std::string hdr = (directory / ("sky_" + label + ".hdr")).string();
+
+        // Inputs are only generated once, so repeated benchmarks read the same files.
+        if ((!std::filesystem::exists(albedo) && !write_synthetic_albedo(albedo, size)) ||
+            (!std::filesystem::exists(normal) && !write_synthetic_normal(normal, size)) ||
+            (!std::filesystem::exists(hdr) && !write_synthetic_hdr(hdr, size))) {
+            std::cout << "Texture compiler bench error. Failed to write synthetic inputs of size " << size << "." << std::endl;
+            return 1;
+        }
+
+        const uint64_t pixels = static_cast<uint64_t>(size) * size;
+        add_texture_cases(cases, label, albedo, (directory / ("albedo_" + label + ".texture")).string(), pixels, false);
+        add_texture_cases(cases, label, normal, (directory / ("normal_" + label + ".texture")).string(), pixels, true);
+        add_cube_map_cases(cases, label, hdr, (directory / ("sky_" + label)).string(), pixels * 2, static_cast<int>(std::max<uint32_t>(size / 2, 16)));
+    }
+    return 0;
+}
+
+// Adds cases of every image in the corpus directory. Radiance HDR and OpenEXR images are cube maps, images with
+// "normal" in their name are normal metalness ambient occlusion textures and the rest are albedo roughness textures.
+static int add_corpus_cases(const BenchCommandLine& command_line, const std::filesystem::path& directory, std::vector<BenchCase>& cases) {
+    std::error_code error;
+    std::vector<std::filesystem::path> paths;
+    for (const std::filesystem::directory_entry& entry : std::filesystem::directory_iterator(command_line.corpus, error)) {
+        if (entry.is_regular_file()) {
+            paths.push_back(entry.path());
+        }
+    }
+    if (error) {
+        std::cout << "Texture compiler bench error. Failed to read corpus directory \"" << command_line.corpus << "\": " << error.message() << "." << std::endl;
+        return 1;
+    }
+
+    // Directory iteration order is unspecified, cases are always listed in the same order.
+    std::sort(paths.begin(), paths.end());
+
+    for (const std::filesystem::path& path : paths) {
+        std::string extension = path.extension().string();
+        std::transform(extension.begin(), extension.end(), extension.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        const std::string stem = path.stem().string();
+        const std::string output = (directory / ("corpus_" + stem)).string();
+        uint64_t width = 0;
+        uint64_t height = 0;
+        const uint64_t pixels = get_image_size(path, extension, width, height) ? width * height : 0;
+
+        if (extension == ".hdr" || extension == ".exr") {
+            // Faces of crosses must be of the output size, equirectangular images are projected to 512 faces.
+            int output_size = 512;
+            if (width != 0 && width * 3 == height * 4) {
+                output_size = static_cast<int>(width / 4);
+            } else if (width != 0 && width * 4 == height * 3) {
+                output_size = static_cast<int>(width / 3);
+            }
+            add_cube_map_cases(cases, stem, path.string(), output, pixels, output_size);
+        } else if (extension == ".png" || extension == ".qoi" || extension == ".tga" || extension == ".jpg" || extension == ".jpeg" || extension == ".bmp") {
+            const bool is_normal = stem.find("normal") != std::string::npos;
+            add_texture_cases(cases, stem, path.string(), output + ".texture", pixels, is_normal);
+        }
+    }
+    return 0;
+}
+
+// Reads the peak memory usage of the process from the metrics file the compiler has written, zero if it's missing.
+static size_t read_peak_memory_usage(const std::filesystem::path& metrics_path) {
+    std::ifstream stream(metrics_path);
+    const std::string metrics((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+    const size_t offset = metrics.find("\"peak_memory_usage\": ");
+    if (offset == std::string::npos) {
+        return 0;
+    }
+    return static_cast<size_t>(std::strtoull(metrics.c_str() + offset + std::strlen("\"peak_memory_usage\": "), nullptr, 10));
+}
+
+// Reads a number that follows `key` in `text` before `end`, negative if it's missing.
+static double read_number(const std::string& text, const char* key, size_t begin, size_t end) {
+    const size_t offset = text.find(key, begin);
+    if (offset == std::string::npos || offset >= end) {
+        return -1.0;
+    }
+    return std::strtod(text.c_str() + offset + std::strlen(key), nullptr);
+}
+
+// Reads the quality of the first mip level of the main output from the metrics file the compiler has written.
+static void read_quality(const std::filesystem::path& metrics_path, BenchResult& result) {
+    std::ifstream stream(metrics_path);
+    const std::string metrics((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+    const size_t begin = metrics.find("\"quality\": [");
+    if (begin == std::string::npos) {
+        return;
+    }
+    const size_t end = metrics.find('}', begin);
+    result.psnr = read_number(metrics, "\"psnr\": ", begin, end);
+    result.ssim = read_number(metrics, "\"ssim\": ", begin, end);
+    result.mean_angular_error = read_number(metrics, "\"mean_angular_error\": ", begin, end);
+}
+
+// Reads the wall time of every `readback` phase of cube map jobs, `irradiance_readback` and `prefilter_readback`
+// included, from the metrics file the compiler has written, summed over the jobs. Zero if there are none.
+static double read_readback_seconds(const std::filesystem::path& metrics_path) {
+    std::ifstream stream(metrics_path);
+    const std::string metrics((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+    double seconds = 0.0;
+    for (size_t begin = metrics.find("{ \"name\": \""); begin != std::string::npos; begin = metrics.find("{ \"name\": \"", begin + 1)) {
+        const size_t name_begin = begin + std::strlen("{ \"name\": \"");
+        const size_t name_end = metrics.find('"', name_begin);
+        const size_t end = metrics.find('}', begin);
+        if (name_end == std::string::npos || end == std::string::npos) {
+            break;
+        }
+
+        const std::string name = metrics.substr(name_begin, name_end - name_begin);
+        if (name.size() >= std::strlen("readback") && name.compare(name.size() - std::strlen("readback"), std::string::npos, "readback") == 0) {
+            seconds += std::max(read_number(metrics, "\"wall_seconds\": ", begin, end), 0.0);
+        }
+    }
+    return seconds;
+}
+
+// Reads the page faults of the process from the metrics file the compiler has written, negative if it's missing.
+static double read_page_faults(const std::filesystem::path& metrics_path) {
+    std::ifstream stream(metrics_path);
+    const std::string metrics((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+    return read_number(metrics, "\"page_faults\": ", 0, metrics.size());
+}
+
+// Counts the data TLB misses in user space of the processes the harness starts while it's enabled. The counter is
+// inherited by the shell `std::system` runs and by the compiler it starts, and the counts of children are added to it
+// when they exit. Linux only, and only where perf events are allowed, `perf_event_paranoid` 2 and lower count user
+// space of the own processes.
+struct TlbMissCounter final {
+    TlbMissCounter() noexcept {
+#ifdef __linux__
+        perf_event_attr attributes = {};
+        attributes.type = PERF_TYPE_HW_CACHE;
+        attributes.size = sizeof(attributes);
+        attributes.config = PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+        attributes.disabled = 1;
+        attributes.inherit = 1;
+        attributes.exclude_kernel = 1;
+        attributes.exclude_hv = 1;
+        descriptor = static_cast<int>(syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0));
+#endif
+    }
+
+    TlbMissCounter(const TlbMissCounter&) = delete;
+    TlbMissCounter(TlbMissCounter&&) = delete;
+    TlbMissCounter& operator=(const TlbMissCounter&) = delete;
+    TlbMissCounter& operator=(TlbMissCounter&&) = delete;
+
+    ~TlbMissCounter() {
+#ifdef __linux__
+        if (descriptor >= 0) {
+            close(descriptor);
+        }
+#endif
+    }
+
+    void begin() noexcept {
+#ifdef __linux__
+        if (descriptor >= 0) {
+            ioctl(descriptor, PERF_EVENT_IOC_RESET, 0);
+            ioctl(descriptor, PERF_EVENT_IOC_ENABLE, 0);
+        }
+#endif
+    }
+
+    // Misses since `begin`, negative when they can't be counted.
+    double end() noexcept {
+#ifdef __linux__
+        uint64_t count = 0;
+        if (descriptor >= 0 && ioctl(descriptor, PERF_EVENT_IOC_DISABLE, 0) == 0 && read(descriptor, &count, sizeof(count)) == sizeof(count)) {
+            return static_cast<double>(count);
+        }
+#endif
+        return -1.0;
+    }
+
+    int descriptor = -1;
+};
+
+static double get_median(std::vector<double>& values) {
+    std::sort(values.begin(), values.end());
+    return values.size() % 2 != 0 ? values[values.size() / 2] : (values[values.size() / 2 - 1] + values[values.size() / 2]) / 2.0;
+}
+
+// Nearest rank percentile of sorted times.
+static double get_percentile(const std::vector<double>& sorted, double percentile) noexcept {
+    const size_t rank = static_cast<size_t>(std::ceil(percentile * static_cast<double>(sorted.size())));
+    return sorted[std::clamp<size_t>(rank, 1, sorted.size()) - 1];
+}
+
+static BenchResult run_case(const BenchCommandLine& command_line, const std::filesystem::path& directory, const BenchCase& bench_case) {
+    BenchResult result;
+    result.name = bench_case.name;
+    result.input_pixels = bench_case.input_pixels;
+    result.renderer = bench_case.renderer;
+
+    const std::filesystem::path metrics_path = directory / "metrics.json";
+#ifdef _WIN32
+    const char* const null_device = "NUL";
+#else
+    const char* const null_device = "/dev/null";
+#endif
+    std::string command = quote(command_line.compiler) + " " + bench_case.arguments + " --metrics " + quote(metrics_path.string());
+    if (command_line.is_report_quality) {
+        command += " --report-quality";
+    }
+    if (!command_line.extra_arguments.empty()) {
+        command += " " + command_line.extra_arguments;
+    }
+    command += std::string(" > ") + null_device + " 2>&1";
+#ifdef _WIN32
+    // `cmd /c` strips the first and the last quote of the command.
+    command = "\"" + command + "\"";
+#endif
+
+    std::vector<double> times;
+    std::vector<double> readback_times;
+    std::vector<double> page_faults;
+    std::vector<double> dtlb_misses;
+    TlbMissCounter tlb_miss_counter;
+    for (size_t run = 0; run < command_line.warmup + command_line.runs; run++) {
+        std::error_code error;
+        std::filesystem::remove(metrics_path, error);
+
+        tlb_miss_counter.begin();
+        const auto begin = std::chrono::steady_clock::now();
+        const int exit_code = std::system(command.c_str());
+        const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - begin;
+        const double dtlb_miss_count = tlb_miss_counter.end();
+
+        if (exit_code != 0) {
+            result.is_failed = true;
+            return result;
+        }
+        if (run >= command_line.warmup) {
+            times.push_back(duration.count());
+            result.peak_memory_usage = std::max(result.peak_memory_usage, read_peak_memory_usage(metrics_path));
+            if (const double page_fault_count = read_page_faults(metrics_path); page_fault_count >= 0.0) {
+                page_faults.push_back(page_fault_count);
+            }
+            if (dtlb_miss_count >= 0.0) {
+                dtlb_misses.push_back(dtlb_miss_count);
+            }
+            if (!bench_case.renderer.empty()) {
+                readback_times.push_back(read_readback_seconds(metrics_path));
+            }
+        }
+        if (run + 1 == command_line.warmup + command_line.runs && command_line.is_report_quality) {
+            // Compression is deterministic, so the quality of the last run is the quality of every run.
+            read_quality(metrics_path, result);
+        }
+    }
+
+    result.runs = times.size();
+    result.median_seconds = get_median(times);
+    result.p95_seconds = get_percentile(times, 0.95);
+    if (!readback_times.empty()) {
+        result.readback_seconds = get_median(readback_times);
+    }
+    if (!page_faults.empty()) {
+        result.page_faults = get_median(page_faults);
+    }
+    if (!dtlb_misses.empty()) {
+        result.dtlb_misses = get_median(dtlb_misses);
+    }
+    return result;
+}
+
+static bool read_file(const std::string& path, std::string& content) {
+    std::ifstream stream(path, std::ios::binary);
+    content.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+    return !stream.bad() && stream.is_open();
+}
+
+// Runs the case once per `--jobs` count of `--determinism` and once more with the scalar kernels at the first count,
+// and compares the outputs of every run byte for byte with the ones of the first run, printing the runs that differ.
+// Outputs are removed before every run, so a run that writes nothing never passes with the outputs of an earlier one.
+static bool check_determinism(const BenchCommandLine& command_line, const std::vector<uint32_t>& thread_counts, const BenchCase& bench_case) {
+#ifdef _WIN32
+    const char* const null_device = "NUL";
+#else
+    const char* const null_device = "/dev/null";
+#endif
+    std::vector<std::string> variants;
+    for (uint32_t thread_count : thread_counts) {
+        variants.push_back("--jobs " + std::to_string(thread_count));
+    }
+    variants.push_back("--jobs " + std::to_string(thread_counts.front()) + " --cpu-features scalar");
+
+    std::vector<std::string> expected;
+    bool is_deterministic = true;
+    for (const std::string& variant : variants) {
+        for (const std::string& output : bench_case.outputs) {
+            std::error_code error;
+            std::filesystem::remove(output, error);
+        }
+
+        std::string command = quote(command_line.compiler) + " " + bench_case.arguments + " " + variant;
+        if (!command_line.extra_arguments.empty()) {
+            command += " " + command_line.extra_arguments;
+        }
+        command += std::string(" > ") + null_device + " 2>&1";
+#ifdef _WIN32
+        // `cmd /c` strips the first and the last quote of the command.
+        command = "\"" + command + "\"";
+#endif
+        if (std::system(command.c_str()) != 0) {
+            std::cout << "Case " << bench_case.name << " failed with " << variant << "." << std::endl;
+            return false;
+        }
+
+        for (size_t i = 0; i < bench_case.outputs.size(); i++) {
+            std::string content;
+            if (!read_file(bench_case.outputs[i], content)) {
+                std::cout << "Case " << bench_case.name << " didn't write \"" << bench_case.outputs[i] << "\" with " << variant << "." << std::endl;
+                return false;
+            }
+            if (expected.size() < bench_case.outputs.size()) {
+                expected.push_back(std::move(content));
+            } else if (content != expected[i]) {
+                std::cout << "Case " << bench_case.name << " wrote a different \"" << bench_case.outputs[i] << "\" with " << variant << " than with " << variants.front() << "." << std::endl;
+                is_deterministic = false;
+            }
+        }
+    }
+    return is_deterministic;
+}
+
+static double get_megapixels_per_second(const BenchResult& result) noexcept {
+    return result.input_pixels != 0 && result.median_seconds > 0.0 ? static_cast<double>(result.input_pixels) / 1e6 / result.median_seconds : 0.0;
+}
+
+// Readback times are printed for every case of `--renderers`, and a dash for the cases that aren't cube maps.
+static void print_result(const BenchResult& result, bool is_readback_printed) {
+    std::cout << std::left << std::setw(72) << result.name << std::right;
+    if (result.is_failed) {
+        std::cout << "failed" << std::endl;
+        return;
+    }
+    std::cout << std::fixed << std::setprecision(3) << std::setw(10) << result.median_seconds << std::setw(10) << result.p95_seconds;
+    if (result.input_pixels != 0) {
+        std::cout << std::setw(10) << std::setprecision(2) << get_megapixels_per_second(result);
+    } else {
+        std::cout << std::setw(10) << "-";
+    }
+    std::cout << std::setw(10) << std::setprecision(1) << static_cast<double>(result.peak_memory_usage) / (1024.0 * 1024.0);
+
+    // Thousands of page faults and millions of data TLB misses.
+    for (const auto& [count, scale] : { std::pair { result.page_faults, 1e3 }, std::pair { result.dtlb_misses, 1e6 } }) {
+        if (count >= 0.0) {
+            std::cout << std::setw(10) << std::setprecision(1) << count / scale;
+        } else {
+            std::cout << std::setw(10) << "-";
+        }
+    }
+    if (result.readback_seconds >= 0.0) {
+        std::cout << std::setw(12) << std::setprecision(3) << result.readback_seconds;
+    } else if (is_readback_printed) {
+        std::cout << std::setw(12) << "-";
+    }
+    if (result.psnr >= 0.0) {
+        std::cout << std::setw(10) << std::setprecision(2) << result.psnr << std::setw(10) << std::setprecision(4) << result.ssim;
+        if (result.mean_angular_error >= 0.0) {
+            std::cout << std::setw(10) << std::setprecision(2) << result.mean_angular_error;
+        }
+    }
+    std::cout << std::defaultfloat << std::setprecision(6) << std::endl;
+}
+
+static bool write_json(const std::string& path, const std::vector<BenchResult>& results, size_t runs) {
+    std::ofstream stream(path);
+    stream << "{\n  \"runs\": " << runs << ",\n  \"cases\": [";
+    for (size_t i = 0; i < results.size(); i++) {
+        const BenchResult& result = results[i];
+        stream << (i == 0 ? "\n" : ",\n") << "    {\n";
+        stream << "      \"name\": \"" << result.name << "\",\n";
+        stream << "      \"result\": \"" << (result.is_failed ? "failed" : "ok") << "\",\n";
+        stream << "      \"input_pixels\": " << result.input_pixels << ",\n";
+        stream << "      \"median_seconds\": " << result.median_seconds << ",\n";
+        stream << "      \"p95_seconds\": " << result.p95_seconds << ",\n";
+        stream << "      \"megapixels_per_second\": " << get_megapixels_per_second(result) << ",\n";
+        stream << "      \"peak_memory_usage\": " << result.peak_memory_usage << ",\n";
+        stream << "      \"page_faults\": " << result.page_faults << ",\n";
+        stream << "      \"dtlb_misses\": " << result.dtlb_misses;
+        if (!result.renderer.empty()) {
+            stream << ",\n      \"renderer\": \"" << result.renderer << "\",\n      \"readback_seconds\": " << result.readback_seconds;
+        }
+        if (result.psnr >= 0.0) {
+            stream << ",\n      \"psnr\": " << result.psnr << ",\n      \"ssim\": " << result.ssim;
+            if (result.mean_angular_error >= 0.0) {
+                stream << ",\n      \"mean_angular_error\": " << result.mean_angular_error;
+            }
+        }
+        stream << "\n";
+        stream << "    }";
+    }
+    stream << "\n  ]\n}\n";
+    return static_cast<bool>(stream);
+}
+
+// Reads the cases of a file `write_json` has written.
+static bool read_baseline(const std::string& path, std::vector<BaselineCase>& cases) {
+    std::ifstream stream(path);
+    if (!stream) {
+        return false;
+    }
+    const std::string json((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+    for (size_t begin = json.find("\"name\": \""); begin != std::string::npos; begin = json.find("\"name\": \"", begin + 1)) {
+        const size_t name_begin = begin + std::strlen("\"name\": \"");
+        const size_t name_end = json.find('"', name_begin);
+        const size_t end = json.find('}', begin);
+        if (name_end == std::string::npos || end == std::string::npos) {
+            return false;
+        }
+
+        BaselineCase baseline_case;
+        baseline_case.name = json.substr(name_begin, name_end - name_begin);
+        baseline_case.median_seconds = read_number(json, "\"median_seconds\": ", begin, end);
+        baseline_case.peak_memory_usage = read_number(json, "\"peak_memory_usage\": ", begin, end);
+        const size_t failed = json.find("\"result\": \"failed\"", begin);
+        baseline_case.is_failed = failed != std::string::npos && failed < end;
+        cases.push_back(std::move(baseline_case));
+    }
+    return !cases.empty();
+}
+
+// Prints every case whose median time or peak memory usage grew beyond the tolerances over the baseline and returns
+// whether there are any. Cases the baseline lacks or has failed are skipped, and so are peak memory usages of zero,
+// which the compiler didn't report.
+static bool compare_with_baseline(const BenchCommandLine& command_line, const std::vector<BenchResult>& results, const std::vector<BaselineCase>& baseline) {
+    bool is_regressed = false;
+    size_t compared_cases = 0;
+    for (const BenchResult& result : results) {
+        if (result.is_failed) {
+            continue;
+        }
+        const auto baseline_case = std::find_if(baseline.begin(), baseline.end(), [&](const BaselineCase& another) {
+            return another.name == result.name;
+        });
+        if (baseline_case == baseline.end() || baseline_case->is_failed) {
+            std::cout << "Case " << result.name << " is not in the baseline." << std::endl;
+            continue;
+        }
+        compared_cases++;
+
+        std::cout << std::fixed << std::setprecision(1);
+        if (baseline_case->median_seconds > 0.0 && result.median_seconds > baseline_case->median_seconds * (1.0 + command_line.time_tolerance) &&
+            result.median_seconds > baseline_case->median_seconds + BASELINE_TIME_SLACK) {
+            std::cout << "Regression of " << result.name << ": median time is " << (result.median_seconds / baseline_case->median_seconds - 1.0) * 100.0
+                      << "% over the baseline." << std::endl;
+            is_regressed = true;
+        }
+        const auto peak_memory_usage = static_cast<double>(result.peak_memory_usage);
+        if (baseline_case->peak_memory_usage > 0.0 && peak_memory_usage > 0.0 && peak_memory_usage > baseline_case->peak_memory_usage * (1.0 + command_line.memory_tolerance)) {
+            std::cout << "Regression of " << result.name << ": peak memory usage is " << (peak_memory_usage / baseline_case->peak_memory_usage - 1.0) * 100.0
+                      << "% over the baseline." << std::endl;
+            is_regressed = true;
+        }
+        std::cout << std::defaultfloat << std::setprecision(6);
+    }
+    std::cout << "Compared " << compared_cases << " cases with the baseline." << std::endl;
+    return is_regressed;
+}
+
+int main(int argc, char* argv[]) {
+    BenchCommandLine command_line;
+
+    auto cli = clara::Help(command_line.is_help) |
+            clara::Opt(command_line.compiler, "texture_compiler")["--compiler"]("Compiler executable to benchmark, defaults to the texture_compiler next to the benchmark") |
+            clara::Opt(command_line.work_directory, "texture_compiler_bench")["--work-directory"]("Directory of synthetic inputs, outputs and metrics of the compiler") |
+            clara::Opt(command_line.sizes, "256,1024")["--sizes"]("Comma separated sizes of synthetic inputs, HDR inputs are twice as wide") |
+            clara::Opt(command_line.is_no_synthetic)["--no-synthetic"]("Only benchmark the corpus") |
+            clara::Opt(command_line.corpus, "textures")["--corpus"]("Directory of PNG, TGA, JPEG, BMP, Radiance HDR and OpenEXR inputs to benchmark too") |
+            clara::Opt(command_line.runs, "5")["--runs"]("Timed runs of every case") |
+            clara::Opt(command_line.warmup, "1")["--warmup"]("Untimed runs of every case before the timed ones") |
+            clara::Opt(command_line.filter, "cube_map")["--filter"]("Only run cases whose name contains any of the comma separated texts") |
+            clara::Opt(command_line.extra_arguments, "--backend cpu")["--compiler-arguments"]("Extra arguments of every compiler run") |
+            clara::Opt(command_line.renderers, "vulkan,gl")["--renderers"]("Run every cube map case once per comma separated --renderer of the compiler and report the readback time and the fastest renderer") |
+            clara::Opt(command_line.is_report_quality)["--report-quality"]("Also report PSNR, SSIM and the angular error of normal maps of the first mip level of compressed outputs") |
+            clara::Opt(command_line.json, "bench.json")["--json"]("Write the results to a JSON file") |
+            clara::Opt(command_line.baseline, "baseline.json")["--baseline"]("Compare the results with a --json file of an earlier run and fail on regressions") |
+            clara::Opt(command_line.time_tolerance, "0.25")["--time-tolerance"]("Fraction the median time of a case may grow over the --baseline") |
+            clara::Opt(command_line.memory_tolerance, "0.1")["--memory-tolerance"]("Fraction the peak memory usage of a case may grow over the --baseline") |
+            clara::Opt(command_line.determinism, "1,2,8")["--determinism"]("Instead of timing the cases, run every case once per comma separated --jobs count and once with the scalar kernels and fail when their outputs differ");
+
+    if (auto result = cli.parse(clara::Args(argc, argv)); !result) {
+        std::cout << "Texture compiler bench error. Failed to parse command line arguments: " << result.errorMessage() << std::endl;
+        return 1;
+    }
+
+    if (command_line.is_help) {
+        std::cout << cli << std::endl;
+        return 1;
+    }
+
+    if (command_line.runs == 0) {
+        std::cout << "Texture compiler bench error. Command line argument --runs must be at least 1." << std::endl;
+        return 1;
+    }
+
+    if (!(command_line.time_tolerance >= 0.0) || !(command_line.memory_tolerance >= 0.0)) {
+        std::cout << "Texture compiler bench error. Command line arguments --time-tolerance and --memory-tolerance must not be negative." << std::endl;
+        return 1;
+    }
+
+    // The baseline is read before the cases run, so a wrong path doesn't waste a benchmark.
+    std::vector<BaselineCase> baseline;
+    if (!command_line.baseline.empty() && !read_baseline(command_line.baseline, baseline)) {
+        std::cout << "Texture compiler bench error. Failed to read baseline file \"" << command_line.baseline << "\"." << std::endl;
+        return 1;
+    }
+
+    if (command_line.compiler.empty()) {
+#ifdef _WIN32
+        const char* const name = "texture_compiler.exe";
+#else
+        const char* const name = "texture_compiler";
+#endif
+        command_line.compiler = (std::filesystem::path(argv[0]).parent_path() / name).string();
+    }
+
+    std::vector<uint32_t> thread_counts;
+    if (!command_line.determinism.empty() && !parse_thread_counts(command_line.determinism, thread_counts)) {
+        std::cout << "Texture compiler bench error. Command line argument --determinism must be a comma separated list of thread counts from 1 to 1024." << std::endl;
+        return 1;
+    }
+
+    std::vector<std::string> renderers;
+    if (!command_line.renderers.empty() && !parse_renderers(command_line.renderers, renderers)) {
+        std::cout << "Texture compiler bench error. Command line argument --renderers must be a comma separated list of vulkan, d3d11, d3d12, metal and gl." << std::endl;
+        return 1;
+    }
+
+    const std::filesystem::path directory = command_line.work_directory;
+    std::error_code error;
+    std::filesystem::create_directories(directory, error);
+    if (error) {
+        std::cout << "Texture compiler bench error. Failed to create work directory \"" << command_line.work_directory << "\": " << error.message() << "." << std::endl;
+        return 1;
+    }
+
+    std::vector<BenchCase> cases;
+    if (!command_line.is_no_synthetic && add_synthetic_cases(command_line, directory, cases) != 0) {
+        // Error is printed in `add_synthetic_cases`.
+        return 1;
+    }
+    if (!command_line.corpus.empty() && add_corpus_cases(command_line, directory, cases) != 0) {
+        // Error is printed in `add_corpus_cases`.
+        return 1;
+    }
+
+    if (!renderers.empty()) {
+        add_renderer_cases(cases, renderers);
+    }
+
+    // Filters are comma separated and a case runs when its name contains any of them.
+    std::vector<std::string> filters;
+    std::istringstream filter_stream(command_line.filter);
+    for (std::string filter; std::getline(filter_stream, filter, ',');) {
+        filters.push_back(std::move(filter));
+    }
+    if (filters.empty()) {
+        filters.emplace_back();
+    }
+    cases.erase(std::remove_if(cases.begin(), cases.end(), [&](const BenchCase& bench_case) {
+        return std::none_of(filters.begin(), filters.end(), [&](const std::string& filter) {
+            return bench_case.name.find(filter) != std::string::npos;
+        });
+    }), cases.end());
+
+    if (cases.empty()) {
+        std::cout << "Texture compiler bench error. No cases to run." << std::endl;
+        return 1;
+    }
+
+    if (!thread_counts.empty()) {
+        size_t differing_cases = 0;
+        for (const BenchCase& bench_case : cases) {
+            const bool is_deterministic = check_determinism(command_line, thread_counts, bench_case);
+            std::cout << std::left << std::setw(72) << bench_case.name << std::right << (is_deterministic ? "identical" : "different") << std::endl;
+            differing_cases += is_deterministic ? 0 : 1;
+        }
+        if (differing_cases != 0) {
+            std::cout << "Texture compiler bench error. " << differing_cases << " of " << cases.size() << " cases failed or wrote different outputs." << std::endl;
+            return 1;
+        }
+        return 0;
+    }
+
+    std::cout << std::left << std::setw(72) << "case" << std::right << std::setw(10) << "median s" << std::setw(10) << "p95 s" << std::setw(10) << "MPix/s" << std::setw(10) << "peak MiB" << std::setw(10) << "kfaults" << std::setw(10) << "M dTLB";
+    if (!renderers.empty()) {
+        std::cout << std::setw(12) << "readback s";
+    }
+    if (command_line.is_report_quality) {
+        std::cout << std::setw(10) << "PSNR dB" << std::setw(10) << "SSIM" << std::setw(10) << "angle";
+    }
+    std::cout << std::endl;
+
+    std::vector<BenchResult> results;
+    bool is_failed = false;
+    for (const BenchCase& bench_case : cases) {
+        results.push_back(run_case(command_line, directory, bench_case));
+        print_result(results.back(), !renderers.empty());
+        is_failed |= results.back().is_failed;
+    }
+
+    // Renderers are compared over the cube map cases that ran, a renderer that failed any of them is out.
+    const std::string* fastest_renderer = nullptr;
+    double fastest_seconds = 0.0;
+    for (const std::string& renderer : renderers) {
+        double seconds = 0.0;
+        double readback_seconds = 0.0;
+        bool is_renderer_failed = false;
+        size_t case_count = 0;
+        for (const BenchResult& result : results) {
+            if (result.renderer == renderer) {
+                is_renderer_failed |= result.is_failed;
+                seconds += result.median_seconds;
+                readback_seconds += result.readback_seconds;
+                case_count++;
+            }
+        }
+        if (case_count == 0) {
+            continue;
+        }
+
+        if (is_renderer_failed) {
+            std::cout << "Renderer " << renderer << " failed." << std::endl;
+            continue;
+        }
+        std::cout << "Renderer " << renderer << " took " << std::fixed << std::setprecision(3) << seconds << " s, " << readback_seconds << " s of it reading back." << std::defaultfloat
+                  << std::setprecision(6) << std::endl;
+        if (fastest_renderer == nullptr || seconds < fastest_seconds) {
+            fastest_renderer = &renderer;
+            fastest_seconds = seconds;
+        }
+    }
+    if (fastest_renderer != nullptr) {
+        std::cout << "Fastest renderer is " << *fastest_renderer << "." << std::endl;
+    }
+
+    if (!command_line.json.empty() && !write_json(command_line.json, results, command_line.runs)) {
+        std::cout << "Texture compiler bench error. Failed to write JSON file \"" << command_line.json << "\"." << std::endl;
+        return 1;
+    }
+
+    if (is_failed) {
+        std::cout << "Texture compiler bench error. Some cases failed, run them with the same arguments to see why." << std::endl;
+        return 1;
+    }
+
+    if (!baseline.empty() && compare_with_baseline(command_line, results, baseline)) {
+        std::cout << "Texture compiler bench error. Some cases regressed over the baseline." << std::endl;
+        return 1;
+    }
+    return 0;
+}
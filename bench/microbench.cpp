@@ -0,0 +1,451 @@
+// Microbenchmarks of the hot CPU kernels of the texture compiler. Unlike `texture_compiler_bench`, which runs the
+// compiler executable, every case calls a single kernel in-process on synthetic data of a given size, so a kernel can
+// be tuned in isolation. Kernels with a variant per instruction set run on every one the build and the CPU support,
+// the scalar one included, and since every variant must produce bit identical results, their outputs are compared
+// with the scalar ones.
+
+#include "bc6h_encoder.h"
+#include "content_analysis.h"
+#include "cpu_features.h"
+#include "mip_filter.h"
+#include "pixel_kernels.h"
+#include "thread_pool.h"
+
+#include <algorithm>
+#include <chrono>
+#include <clara.hpp>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+struct MicrobenchCommandLine final {
+    MicrobenchCommandLine() = default;
+    MicrobenchCommandLine(const MicrobenchCommandLine& another) = delete;
+    MicrobenchCommandLine(MicrobenchCommandLine&& another) = delete;
+    MicrobenchCommandLine& operator=(const MicrobenchCommandLine& another) = delete;
+    MicrobenchCommandLine& operator=(MicrobenchCommandLine&& another) = delete;
+
+    std::string sizes = "256,1024,2048";
+    std::string filter;
+    std::string json;
+    size_t runs = 10;
+    size_t warmup = 2;
+    bool is_help = false;
+};
+
+// Inputs of every kernel for a square image of `size` pixels, and the buffers they write to.
+struct KernelData final {
+    size_t size = 0;
+    size_t pixel_count = 0;
+
+    std::vector<uint8_t> rgba8;
+    std::vector<uint8_t> flat_rgba8;
+    std::vector<uint8_t> rgbe;
+    std::vector<float> rgba32f;
+    std::vector<uint16_t> rgba16f;
+
+    // Color planes in [0, 1] and a unit normal packed to [0, 1].
+    std::vector<float> planes[4];
+    std::vector<float> normals[3];
+
+    // Kernels working in place get a copy of their input before every run, outside of the timed part.
+    std::vector<float> work[4];
+    std::vector<float> next_planes[4];
+    std::vector<uint8_t> output_rgba8;
+    std::vector<float> output_rgba32f;
+    std::vector<uint16_t> output_rgba16f;
+};
+
+// Runs the kernel once, returns the seconds it took and appends its output to `output`, which isn't timed.
+using KernelFunction = double (*)(KernelData& data, ThreadPool& pool, std::vector<uint8_t>& output);
+
+struct Kernel final {
+    const char* name;
+
+    // Kernels of `pixel_kernels.h` have a variant per instruction set, the rest run once on the baseline.
+    bool is_dispatched;
+
+    KernelFunction run;
+};
+
+struct MicrobenchResult final {
+    std::string kernel;
+    size_t size = 0;
+    std::string instruction_set;
+    double median_seconds = 0.0;
+    double p95_seconds = 0.0;
+
+    // Median of the scalar variant of the same kernel and size over this one, zero when there's none.
+    double speedup = 0.0;
+
+    bool is_mismatch = false;
+};
+
+static std::chrono::steady_clock::time_point now() noexcept {
+    return std::chrono::steady_clock::now();
+}
+
+static double get_seconds(std::chrono::steady_clock::time_point begin) noexcept {
+    return std::chrono::duration<double>(now() - begin).count();
+}
+
+template <typename T>
+static void append_bytes(std::vector<uint8_t>& output, const std::vector<T>& values) {
+    const auto* const bytes = reinterpret_cast<const uint8_t*>(values.data());
+    output.insert(output.end(), bytes, bytes + values.size() * sizeof(T));
+}
+
+// Deterministic inputs, so every run of the microbenchmark measures the same data.
+struct Random final {
+    uint32_t next() noexcept {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        return state;
+    }
+
+    float next_float() noexcept {
+        return static_cast<float>(next() >> 8) / static_cast<float>(1 << 24);
+    }
+
+    uint32_t state = 0x12345678;
+};
+
+static void create_kernel_data(size_t size, KernelData& data) {
+    data.size = size;
+    data.pixel_count = size * size;
+    const size_t pixel_count = data.pixel_count;
+
+    Random random;
+    data.rgba8.resize(pixel_count * 4);
+    for (uint8_t& value : data.rgba8) {
+        value = static_cast<uint8_t>(random.next() >> 24);
+    }
+    data.flat_rgba8.assign(pixel_count * 4, 0);
+    for (size_t i = 0; i < pixel_count; i++) {
+        std::memcpy(data.flat_rgba8.data() + i * 4, data.rgba8.data(), 4);
+    }
+
+    // Mantissas of every magnitude and exponents of a sky, from deep shadows to the sun.
+    data.rgbe.resize(pixel_count * 4);
+    for (size_t i = 0; i < pixel_count; i++) {
+        for (size_t channel = 0; channel < 3; channel++) {
+            data.rgbe[i * 4 + channel] = static_cast<uint8_t>(random.next() >> 24);
+        }
+        data.rgbe[i * 4 + 3] = static_cast<uint8_t>(118 + random.next() % 20);
+    }
+
+    data.rgba32f.resize(pixel_count * 4);
+    for (size_t i = 0; i < pixel_count * 4; i++) {
+        data.rgba32f[i] = i % 4 == 3 ? 1.f : std::ldexp(random.next_float(), static_cast<int>(random.next() % 24) - 12);
+    }
+    data.rgba16f.resize(pixel_count * 4);
+    convert_rgba32f_to_rgba16f(data.rgba32f.data(), pixel_count, data.rgba16f.data());
+
+    for (std::vector<float>& plane : data.planes) {
+        plane.resize(pixel_count);
+        for (float& value : plane) {
+            value = random.next_float();
+        }
+    }
+
+    for (std::vector<float>& plane : data.normals) {
+        plane.resize(pixel_count);
+    }
+    for (size_t i = 0; i < pixel_count; i++) {
+        const float x = random.next_float() * 2.f - 1.f;
+        const float y = (random.next_float() * 2.f - 1.f) * std::sqrt(std::max(1.f - x * x, 0.f));
+        const float z = std::sqrt(std::max(1.f - x * x - y * y, 0.f));
+        data.normals[0][i] = x * 0.5f + 0.5f;
+        data.normals[1][i] = y * 0.5f + 0.5f;
+        data.normals[2][i] = z * 0.5f + 0.5f;
+    }
+
+    const size_t next_pixel_count = std::max<size_t>(size / 2, 1) * std::max<size_t>(size / 2, 1);
+    for (size_t channel = 0; channel < 4; channel++) {
+        data.work[channel].resize(pixel_count);
+        data.next_planes[channel].resize(next_pixel_count);
+    }
+    data.output_rgba8.resize(pixel_count * 4);
+    data.output_rgba32f.resize(pixel_count * 4);
+    data.output_rgba16f.resize(pixel_count * 4);
+}
+
+static double run_swizzle(KernelData& data, ThreadPool& /* pool */, std::vector<uint8_t>& output) {
+    const auto begin = now();
+    swizzle_rgba8(data.rgba8.data(), data.pixel_count, true, false, data.output_rgba8.data());
+    const double seconds = get_seconds(begin);
+    append_bytes(output, data.output_rgba8);
+    return seconds;
+}
+
+static double run_reconstruct_normal_z(KernelData& data, ThreadPool& /* pool */, std::vector<uint8_t>& output) {
+    const auto begin = now();
+    reconstruct_normal_z(data.normals[0].data(), data.normals[1].data(), data.work[2].data(), data.pixel_count);
+    const double seconds = get_seconds(begin);
+    append_bytes(output, data.work[2]);
+    return seconds;
+}
+
+// Filtered normals are shorter than one, like the ones the normal mip filter renormalizes.
+static double run_renormalize_packed_normals(KernelData& data, ThreadPool& /* pool */, std::vector<uint8_t>& output) {
+    for (size_t channel = 0; channel < 3; channel++) {
+        for (size_t i = 0; i < data.pixel_count; i++) {
+            data.work[channel][i] = (data.normals[channel][i] - 0.5f) * 0.8f + 0.5f;
+        }
+    }
+
+    const auto begin = now();
+    renormalize_packed_normals(data.work[0].data(), data.work[1].data(), data.work[2].data(), data.pixel_count);
+    const double seconds = get_seconds(begin);
+    for (size_t channel = 0; channel < 3; channel++) {
+        append_bytes(output, data.work[channel]);
+    }
+    return seconds;
+}
+
+static double run_mip_filter(KernelData& data, ThreadPool& pool, std::vector<uint8_t>& output, MipFilter filter) {
+    MipFilterOptions options;
+    options.filter = filter;
+    options.is_srgb = true;
+
+    const float* const input[4] = { data.planes[0].data(), data.planes[1].data(), data.planes[2].data(), data.planes[3].data() };
+    float* const next[4] = { data.next_planes[0].data(), data.next_planes[1].data(), data.next_planes[2].data(), data.next_planes[3].data() };
+
+    const auto begin = now();
+    build_next_mip_level(input, data.size, data.size, 0, options, pool, next);
+    const double seconds = get_seconds(begin);
+    for (const std::vector<float>& plane : data.next_planes) {
+        append_bytes(output, plane);
+    }
+    return seconds;
+}
+
+static double run_box_mip_filter(KernelData& data, ThreadPool& pool, std::vector<uint8_t>& output) {
+    return run_mip_filter(data, pool, output, MipFilter::BOX);
+}
+
+static double run_kaiser_mip_filter(KernelData& data, ThreadPool& pool, std::vector<uint8_t>& output) {
+    return run_mip_filter(data, pool, output, MipFilter::KAISER);
+}
+
+static double run_rgba32f_to_rgba16f(KernelData& data, ThreadPool& /* pool */, std::vector<uint8_t>& output) {
+    const auto begin = now();
+    convert_rgba32f_to_rgba16f(data.rgba32f.data(), data.pixel_count, data.output_rgba16f.data());
+    const double seconds = get_seconds(begin);
+    append_bytes(output, data.output_rgba16f);
+    return seconds;
+}
+
+static double run_rgba16f_to_rgba32f(KernelData& data, ThreadPool& /* pool */, std::vector<uint8_t>& output) {
+    const auto begin = now();
+    convert_rgba16f_to_rgba32f(data.rgba16f.data(), data.pixel_count, data.output_rgba32f.data());
+    const double seconds = get_seconds(begin);
+    append_bytes(output, data.output_rgba32f);
+    return seconds;
+}
+
+static double run_rgbe_to_rgba32f(KernelData& data, ThreadPool& /* pool */, std::vector<uint8_t>& output) {
+    const auto begin = now();
+    convert_rgbe_to_rgba32f(data.rgbe.data(), data.pixel_count, data.output_rgba32f.data());
+    const double seconds = get_seconds(begin);
+    append_bytes(output, data.output_rgba32f);
+    return seconds;
+}
+
+// A flat image is the worst case of the analysis, which only knows it's flat after the last pixel.
+static double run_analyze_content(KernelData& data, ThreadPool& /* pool */, std::vector<uint8_t>& output) {
+    const auto begin = now();
+    const ContentAnalysis analysis = analyze_content(data.flat_rgba8.data(), data.pixel_count);
+    const double seconds = get_seconds(begin);
+    output.push_back(is_flat(analysis) ? 1 : 0);
+    return seconds;
+}
+
+static const Kernel KERNELS[] = {
+    { "swizzle_rgba8", true, run_swizzle },
+    { "reconstruct_normal_z", true, run_reconstruct_normal_z },
+    { "renormalize_packed_normals", true, run_renormalize_packed_normals },
+    { "box_mip_filter", true, run_box_mip_filter },
+    { "kaiser_mip_filter", true, run_kaiser_mip_filter },
+    { "rgba32f_to_rgba16f", false, run_rgba32f_to_rgba16f },
+    { "rgba16f_to_rgba32f", false, run_rgba16f_to_rgba32f },
+    { "rgbe_to_rgba32f", true, run_rgbe_to_rgba32f },
+    { "analyze_content", false, run_analyze_content },
+};
+
+static bool parse_sizes(const std::string& text, std::vector<size_t>& sizes) {
+    std::istringstream stream(text);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        char* end = nullptr;
+        const unsigned long long size = std::strtoull(item.c_str(), &end, 10);
+        if (item.empty() || *end != '\0' || size == 0 || size > 16384) {
+            return false;
+        }
+        sizes.push_back(static_cast<size_t>(size));
+    }
+    return !sizes.empty();
+}
+
+// Scalar first, so the other variants are compared with it.
+static std::vector<InstructionSet> get_instruction_sets() {
+    const InstructionSet detected = get_instruction_set();
+
+    std::vector<InstructionSet> result;
+    for (const InstructionSet instruction_set : { InstructionSet::SCALAR, InstructionSet::SSE2, InstructionSet::NEON, InstructionSet::AVX2 }) {
+        if (set_instruction_set(instruction_set)) {
+            result.push_back(instruction_set);
+        }
+    }
+    set_instruction_set(detected);
+    return result;
+}
+
+static void run_kernel(const MicrobenchCommandLine& command_line, const Kernel& kernel, KernelData& data, ThreadPool& pool, std::vector<uint8_t>& output,
+                       MicrobenchResult& result) {
+    std::vector<double> seconds;
+    for (size_t run = 0; run < command_line.warmup + command_line.runs; run++) {
+        output.clear();
+        const double run_seconds = kernel.run(data, pool, output);
+        if (run >= command_line.warmup) {
+            seconds.push_back(run_seconds);
+        }
+    }
+
+    std::sort(seconds.begin(), seconds.end());
+    result.median_seconds = seconds[seconds.size() / 2];
+    result.p95_seconds = seconds[std::min(seconds.size() - 1, static_cast<size_t>(std::ceil(0.95 * static_cast<double>(seconds.size()))) - 1)];
+}
+
+static bool write_json(const std::string& path, const std::vector<MicrobenchResult>& results) {
+    std::ofstream stream(path);
+    stream << "{\n  \"results\": [";
+    for (size_t i = 0; i < results.size(); i++) {
+        const MicrobenchResult& result = results[i];
+        stream << (i == 0 ? "\n" : ",\n") << "    { \"kernel\": \"" << result.kernel << "\", \"size\": " << result.size << ", \"instruction_set\": \"" << result.instruction_set
+               << "\", \"median_seconds\": " << result.median_seconds << ", \"p95_seconds\": " << result.p95_seconds << ", \"speedup\": " << result.speedup
+               << ", \"mismatch\": " << (result.is_mismatch ? "true" : "false") << " }";
+    }
+    stream << "\n  ]\n}\n";
+    return static_cast<bool>(stream);
+}
+
+int main(int argc, char* argv[]) {
+    MicrobenchCommandLine command_line;
+
+    auto cli = clara::Help(command_line.is_help) |
+            clara::Opt(command_line.sizes, "256,1024,2048")["--sizes"]("Comma separated sides of the square images every kernel runs on") |
+            clara::Opt(command_line.runs, "10")["--runs"]("Timed runs of every kernel, size and instruction set") |
+            clara::Opt(command_line.warmup, "2")["--warmup"]("Untimed runs before the timed ones") |
+            clara::Opt(command_line.filter, "mip_filter")["--filter"]("Only run kernels whose name contains the text") |
+            clara::Opt(command_line.json, "microbench.json")["--json"]("Write the results to a JSON file");
+
+    if (auto result = cli.parse(clara::Args(argc, argv)); !result) {
+        std::cout << "Texture compiler microbench error. Failed to parse command line arguments: " << result.errorMessage() << std::endl;
+        return 1;
+    }
+
+    if (command_line.is_help) {
+        std::cout << cli << std::endl;
+        return 1;
+    }
+
+    if (command_line.runs == 0) {
+        std::cout << "Texture compiler microbench error. Command line argument --runs must be at least 1." << std::endl;
+        return 1;
+    }
+
+    std::vector<size_t> sizes;
+    if (!parse_sizes(command_line.sizes, sizes)) {
+        std::cout << "Texture compiler microbench error. Command line argument --sizes must be a comma separated list of sizes up to 16384." << std::endl;
+        return 1;
+    }
+
+    const InstructionSet detected = get_instruction_set();
+    const std::vector<InstructionSet> instruction_sets = get_instruction_sets();
+
+    // Kernels run on the calling thread alone, the mip filters included, so timings don't depend on other cores.
+    ThreadPool pool(0);
+
+    std::cout << std::left << std::setw(30) << "kernel" << std::right << std::setw(8) << "size" << std::setw(10) << "isa" << std::setw(12) << "median ms" << std::setw(12) << "p95 ms"
+              << std::setw(10) << "MPix/s" << std::setw(10) << "speedup" << std::endl;
+
+    std::vector<MicrobenchResult> results;
+    bool is_mismatch = false;
+    for (const size_t size : sizes) {
+        KernelData data;
+        create_kernel_data(size, data);
+
+        for (const Kernel& kernel : KERNELS) {
+            if (std::string(kernel.name).find(command_line.filter) == std::string::npos) {
+                continue;
+            }
+
+            std::vector<uint8_t> scalar_output;
+            double scalar_seconds = 0.0;
+            for (const InstructionSet instruction_set : instruction_sets) {
+                if (!kernel.is_dispatched && instruction_set != detected) {
+                    continue;
+                }
+                set_instruction_set(instruction_set);
+
+                MicrobenchResult result;
+                result.kernel = kernel.name;
+                result.size = size;
+                result.instruction_set = kernel.is_dispatched ? get_instruction_set_name(instruction_set) : "baseline";
+
+                std::vector<uint8_t> output;
+                run_kernel(command_line, kernel, data, pool, output, result);
+
+                if (kernel.is_dispatched && instruction_set == InstructionSet::SCALAR) {
+                    scalar_output = std::move(output);
+                    scalar_seconds = result.median_seconds;
+                } else if (kernel.is_dispatched) {
+                    result.is_mismatch = output != scalar_output;
+                }
+                if (scalar_seconds > 0.0 && result.median_seconds > 0.0) {
+                    result.speedup = scalar_seconds / result.median_seconds;
+                }
+                is_mismatch = is_mismatch || result.is_mismatch;
+
+                const double megapixels = static_cast<double>(data.pixel_count) / 1e6;
+                std::cout << std::left << std::setw(30) << result.kernel << std::right << std::setw(8) << size << std::setw(10) << result.instruction_set << std::fixed << std::setprecision(3)
+                          << std::setw(12) << result.median_seconds * 1000.0 << std::setw(12) << result.p95_seconds * 1000.0 << std::setprecision(1) << std::setw(10)
+                          << (result.median_seconds > 0.0 ? megapixels / result.median_seconds : 0.0);
+                if (result.speedup > 0.0) {
+                    std::cout << std::setprecision(2) << std::setw(9) << result.speedup << "x";
+                } else {
+                    std::cout << std::setw(10) << "-";
+                }
+                std::cout << std::defaultfloat << (result.is_mismatch ? "  output differs from scalar" : "") << std::endl;
+
+                results.push_back(std::move(result));
+            }
+            set_instruction_set(detected);
+        }
+    }
+
+    if (results.empty()) {
+        std::cout << "Texture compiler microbench error. No kernels to run." << std::endl;
+        return 1;
+    }
+
+    if (!command_line.json.empty() && !write_json(command_line.json, results)) {
+        std::cout << "Texture compiler microbench error. Failed to write \"" << command_line.json << "\"." << std::endl;
+        return 1;
+    }
+
+    if (is_mismatch) {
+        std::cout << "Texture compiler microbench error. Some variants don't match the scalar kernels." << std::endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,65 @@
+# Profile guided build of the texture compiler, run by the `texture_compiler_pgo` target with `cmake -P`:
+#
+# 1. Configures and builds `BUILD_DIRECTORY` with `TEXTURE_COMPILER_PGO=GENERATE`, writing profiles to `PROFILE_DIRECTORY`.
+# 2. Runs `texture_compiler_bench` of that build once per case on synthetic inputs of `SIZES` and on `CORPUS`.
+# 3. Merges the raw profiles of Clang with `LLVM_PROFDATA`, GCC reads its own as they are.
+# 4. Configures the same directory with `TEXTURE_COMPILER_PGO=USE` and builds it again.
+#
+# Profiles of earlier runs are removed first, so the result only depends on the sources and the training.
+
+function(run_step DESCRIPTION)
+    message(STATUS "${DESCRIPTION}")
+    execute_process(COMMAND ${ARGN} RESULT_VARIABLE result)
+    if(NOT result EQUAL 0)
+        message(FATAL_ERROR "Profile guided build failed to ${DESCRIPTION}.")
+    endif()
+endfunction()
+
+function(configure PGO)
+    run_step("configure the ${PGO} build"
+            "${CMAKE_COMMAND}" -S "${SOURCE_DIRECTORY}" -B "${BUILD_DIRECTORY}" -G "${GENERATOR}"
+            -DCMAKE_BUILD_TYPE=Release
+            "-DCMAKE_CXX_COMPILER=${CXX_COMPILER}"
+            "-DCMAKE_C_COMPILER=${C_COMPILER}"
+            "-DTEXTURE_COMPILER_PGO=${PGO}"
+            "-DTEXTURE_COMPILER_PGO_DIRECTORY=${PROFILE_DIRECTORY}")
+endfunction()
+
+if(NOT CXX_COMPILER_ID MATCHES "^(GNU|Clang|AppleClang)$")
+    message(FATAL_ERROR "Profile guided build is supported with GCC and Clang only.")
+endif()
+if(CXX_COMPILER_ID MATCHES "Clang" AND NOT LLVM_PROFDATA)
+    message(FATAL_ERROR "Profile guided build with Clang needs llvm-profdata, which is not found.")
+endif()
+
+# `--parallel` is new in CMake 3.12, older ones build with the default of the generator.
+set(parallel_arguments)
+if(NOT CMAKE_VERSION VERSION_LESS 3.12)
+    cmake_host_system_information(RESULT processor_count QUERY NUMBER_OF_LOGICAL_CORES)
+    set(parallel_arguments --parallel ${processor_count})
+endif()
+
+file(REMOVE_RECURSE "${PROFILE_DIRECTORY}")
+
+configure(GENERATE)
+run_step("build the instrumented compiler" "${CMAKE_COMMAND}" --build "${BUILD_DIRECTORY}" --config Release ${parallel_arguments} --target texture_compiler_bench)
+
+# BC7 and BC6H of `--production` are mostly nvtt, which isn't instrumented, and take minutes at the larger sizes, so only
+# the first of `SIZES` is trained with them. Development and uncompressed cases run the pixel kernels, mip filters, cube
+# map readback and the output paths at every size.
+string(REGEX REPLACE ",.*" "" first_size "${SIZES}")
+set(filter "development/,no-compression/,production/${first_size}")
+set(bench_arguments --work-directory "${BUILD_DIRECTORY}/training" --sizes "${SIZES}" --runs 1 --warmup 0 --filter "${filter}")
+if(CORPUS)
+    list(APPEND bench_arguments --corpus "${CORPUS}")
+endif()
+run_step("train the instrumented compiler" "${BUILD_DIRECTORY}/texture_compiler_bench" ${bench_arguments})
+
+if(CXX_COMPILER_ID MATCHES "Clang")
+    file(GLOB raw_profiles "${PROFILE_DIRECTORY}/*.profraw")
+    run_step("merge the profiles" "${LLVM_PROFDATA}" merge "-output=${PROFILE_DIRECTORY}/texture_compiler.profdata" ${raw_profiles})
+endif()
+
+configure(USE)
+run_step("build the optimized compiler" "${CMAKE_COMMAND}" --build "${BUILD_DIRECTORY}" --config Release ${parallel_arguments})
+message(STATUS "Profile guided texture compiler is built in ${BUILD_DIRECTORY}.")
@@ -7,10 +7,21 @@ function(build_shaders TYPE GLOB_PATTERN INCLUDE_DIRECTORY)
         set(shader_compiler "${CMAKE_SOURCE_DIR}/tools/${CMAKE_SYSTEM_NAME}/shaderc")
     endif()
 
+    # Compute shaders need GLSL 4.3 and Shader Model 5. Direct3D 9 doesn't support them at all, but embedded shader
+    # tables expect a Direct3D 9 binary on Windows, so the Shader Model 5 one is used there. Renderers without compute
+    # support never create these shaders.
     if("${TYPE}" STREQUAL "vertex")
-        set(t "v")
+        set(glsl_profile "")
+        set(dx9_profile "vs_3_0")
+        set(dx11_profile "vs_4_0")
+    elseif("${TYPE}" STREQUAL "compute")
+        set(glsl_profile "-p" "430")
+        set(dx9_profile "cs_5_0")
+        set(dx11_profile "cs_5_0")
     else()
-        set(t "p")
+        set(glsl_profile "")
+        set(dx9_profile "ps_3_0")
+        set(dx11_profile "ps_4_0")
     endif()
 
     set(target_dependencies "")
@@ -40,16 +51,16 @@ function(build_shaders TYPE GLOB_PATTERN INCLUDE_DIRECTORY)
                     COMMAND type nul > ${output}
                     COMMAND echo \#include ^<cstdint^>>>\"${output}\"
                     COMMAND echo. >> \"${output}\"
-                    COMMAND ${shader_compiler} -i "\"${INCLUDE_DIRECTORY}\"" --type ${TYPE} --platform linux -f "\"${input}\"" -o "\"${output_temp}\"" --bin2c ${variable_name}_glsl
+                    COMMAND ${shader_compiler} -i "\"${INCLUDE_DIRECTORY}\"" --type ${TYPE} --platform linux ${glsl_profile} -f "\"${input}\"" -o "\"${output_temp}\"" --bin2c ${variable_name}_glsl
                     COMMAND copy /b \"${output}\"+\"${output_temp}\" \"${output}\" 1>NUL
                     COMMAND echo. >> \"${output}\"
                     COMMAND ${shader_compiler} -i "\"${INCLUDE_DIRECTORY}\"" --type ${TYPE} --platform linux -p spirv -f "\"${input}\"" -o "\"${output_temp}\"" --bin2c ${variable_name}_spv
                     COMMAND copy /b \"${output}\"+\"${output_temp}\" \"${output}\" 1>NUL
                     COMMAND echo. >> \"${output}\"
-                    COMMAND ${shader_compiler} -i "\"${INCLUDE_DIRECTORY}\"" --type ${TYPE} --platform windows -p ${t}s_3_0 -f "\"${input}\"" -o "\"${output_temp}\"" --bin2c ${variable_name}_dx9
+                    COMMAND ${shader_compiler} -i "\"${INCLUDE_DIRECTORY}\"" --type ${TYPE} --platform windows -p ${dx9_profile} -f "\"${input}\"" -o "\"${output_temp}\"" --bin2c ${variable_name}_dx9
                     COMMAND copy /b \"${output}\"+\"${output_temp}\" \"${output}\" 1>NUL
                     COMMAND echo. >> \"${output}\"
-                    COMMAND ${shader_compiler} -i "\"${INCLUDE_DIRECTORY}\"" --type ${TYPE} --platform windows -p ${t}s_4_0 -f "\"${input}\"" -o "\"${output_temp}\"" --bin2c ${variable_name}_dx11
+                    COMMAND ${shader_compiler} -i "\"${INCLUDE_DIRECTORY}\"" --type ${TYPE} --platform windows -p ${dx11_profile} -f "\"${input}\"" -o "\"${output_temp}\"" --bin2c ${variable_name}_dx11
                     COMMAND copy /b \"${output}\"+\"${output_temp}\" \"${output}\" 1>NUL
                     COMMAND echo. >> \"${output}\"
                     COMMAND ${shader_compiler} -i "\"${INCLUDE_DIRECTORY}\"" --type ${TYPE} --platform osx -p metal -f "\"${input}\"" -o "\"${output_temp}\"" --bin2c ${variable_name}_mtl
@@ -64,7 +75,7 @@ function(build_shaders TYPE GLOB_PATTERN INCLUDE_DIRECTORY)
                     COMMAND cp /dev/null ${output}
                     COMMAND echo \"\#include <cstdint>\" >> \"${output}\"
                     COMMAND echo \"\" >> \"${output}\"
-                    COMMAND ${shader_compiler} -i "\"${INCLUDE_DIRECTORY}\"" --type ${TYPE} --platform linux -f "\"${input}\"" -o "\"${output_temp}\"" --bin2c ${variable_name}_glsl
+                    COMMAND ${shader_compiler} -i "\"${INCLUDE_DIRECTORY}\"" --type ${TYPE} --platform linux ${glsl_profile} -f "\"${input}\"" -o "\"${output_temp}\"" --bin2c ${variable_name}_glsl
                     COMMAND cat \"${output_temp}\" >> \"${output}\"
                     COMMAND echo \"\" >> \"${output}\"
                     COMMAND ${shader_compiler} -i "\"${INCLUDE_DIRECTORY}\"" --type ${TYPE} --platform linux -p spirv -f "\"${input}\"" -o "\"${output_temp}\"" --bin2c ${variable_name}_spv
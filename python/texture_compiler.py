@@ -0,0 +1,233 @@
+"""In-process texture compilation for pipeline scripts, on top of the C interface of `src/texture_compiler_c.h`.
+
+A `Compiler` owns a thread pool, a compressor and a renderer, like a single run of the executable, so a script creates
+one and compiles every texture with it instead of starting a process per texture. Calls release the GIL while the
+texture is compiled, and 2D textures can be compiled by several Python threads at the same time on the shared pool:
+
+    compiler = texture_compiler.Compiler()
+    with concurrent.futures.ThreadPoolExecutor(8) as executor:
+        outputs = list(executor.map(lambda image: compiler.compile(image, "albedo_roughness", "production"), images))
+
+Images are NumPy arrays or any other object of the buffer protocol, and outputs are returned as `bytes` by name,
+`texture`, `irradiance` and `prefilter`, without temporary files. The library is looked up next to this file, where
+the build copies it, or at the path of the `TEXTURE_COMPILER_C_LIBRARY` environment variable.
+"""
+
+import ctypes
+import os
+import sys
+
+KINDS = {"albedo_roughness": 0, "normal_metalness_ambient_occlusion": 1, "parallax": 2, "cube_map": 3}
+COMPRESSIONS = {"production": 0, "development": 1, "no-compression": 2}
+QUALITIES = {"fastest": 0, "normal": 1, "production": 2, "highest": 3}
+ENCODERS = {"nvtt": 0, "fast": 1}
+TARGETS = {"bc": 0, "etc2": 1, "astc": 2}
+CONTAINERS = {"dds": 0, "ktx2": 1}
+
+# Pixel formats by the struct format character of the buffer: 8-bit and 16-bit RGBA and RGBA32F.
+_FORMATS = {"B": 0, "H": 1, "f": 2}
+
+
+class TextureCompilerError(Exception):
+    """A job failed, `log` has the messages the compiler printed for it."""
+
+    def __init__(self, log):
+        super().__init__(log.strip() or "Texture compiler error.")
+        self.log = log
+
+
+class _Job(ctypes.Structure):
+    _fields_ = [
+        ("size", ctypes.c_uint32),
+        ("kind", ctypes.c_int32),
+        ("compression", ctypes.c_int32),
+        ("quality", ctypes.c_int32),
+        ("encoder", ctypes.c_int32),
+        ("target", ctypes.c_int32),
+        ("container", ctypes.c_int32),
+        ("max_size", ctypes.c_uint32),
+        ("mip_count", ctypes.c_uint32),
+        ("is_linear_mip_filtering", ctypes.c_int32),
+        ("output_size", ctypes.c_uint32),
+        ("irradiance_size", ctypes.c_uint32),
+        ("prefilter_size", ctypes.c_uint32),
+        ("prefilter_samples", ctypes.c_uint32),
+    ]
+
+
+def _load_library():
+    path = os.environ.get("TEXTURE_COMPILER_C_LIBRARY")
+    if not path:
+        if sys.platform == "win32":
+            name = "texture_compiler_c.dll"
+        elif sys.platform == "darwin":
+            name = "libtexture_compiler_c.dylib"
+        else:
+            name = "libtexture_compiler_c.so"
+        path = os.path.join(os.path.dirname(os.path.abspath(__file__)), name)
+
+    # Functions of `CDLL` release the GIL while they run.
+    library = ctypes.CDLL(path)
+    result = ctypes.c_void_p
+    library.texture_compiler_job_init.argtypes = [ctypes.POINTER(_Job)]
+    library.texture_compiler_job_init.restype = None
+    library.texture_compiler_create.argtypes = [ctypes.c_uint32]
+    library.texture_compiler_create.restype = ctypes.c_void_p
+    library.texture_compiler_destroy.argtypes = [ctypes.c_void_p]
+    library.texture_compiler_destroy.restype = None
+    library.texture_compiler_compile.argtypes = [ctypes.c_void_p, ctypes.POINTER(_Job), ctypes.c_void_p, ctypes.c_int32, ctypes.c_int32, ctypes.c_int32, ctypes.POINTER(result)]
+    library.texture_compiler_compile.restype = ctypes.c_int
+    library.texture_compiler_compile_encoded.argtypes = [ctypes.c_void_p, ctypes.POINTER(_Job), ctypes.c_void_p, ctypes.c_size_t, ctypes.POINTER(result)]
+    library.texture_compiler_compile_encoded.restype = ctypes.c_int
+    library.texture_compiler_result_output_count.argtypes = [result]
+    library.texture_compiler_result_output_count.restype = ctypes.c_size_t
+    library.texture_compiler_result_output_name.argtypes = [result, ctypes.c_size_t]
+    library.texture_compiler_result_output_name.restype = ctypes.c_char_p
+    library.texture_compiler_result_output_data.argtypes = [result, ctypes.c_size_t, ctypes.POINTER(ctypes.c_size_t)]
+    library.texture_compiler_result_output_data.restype = ctypes.c_void_p
+    library.texture_compiler_result_log.argtypes = [result]
+    library.texture_compiler_result_log.restype = ctypes.c_char_p
+    library.texture_compiler_result_destroy.argtypes = [result]
+    library.texture_compiler_result_destroy.restype = None
+    return library
+
+
+_library = None
+
+
+def _get_library():
+    global _library
+    if _library is None:
+        _library = _load_library()
+    return _library
+
+
+def _pick(values, name, value):
+    if value not in values:
+        raise ValueError("%s must be one of %s, not %r." % (name, ", ".join(values), value))
+    return values[value]
+
+
+def _address(data):
+    """Address of the memory of a buffer without copying it, and the object keeping it alive."""
+    interface = getattr(data, "__array_interface__", None)
+    view = memoryview(data)
+    if not view.c_contiguous:
+        raise ValueError("Image must be contiguous.")
+    if interface is not None:
+        return interface["data"][0], data
+    if view.readonly:
+        # ctypes only takes the address of writable buffers, `bytes` it passes as they are.
+        data = view.tobytes()
+        return ctypes.cast(ctypes.c_char_p(data), ctypes.c_void_p).value, data
+    array = (ctypes.c_char * view.nbytes).from_buffer(view)
+    return ctypes.addressof(array), array
+
+
+class Compiler:
+    """A compiler context shared by every job compiled with it, see the module documentation.
+
+    `threads` is the number of threads compressing blocks, the calling thread included, zero for the number of
+    hardware threads. Cube maps render on the GPU, which only the thread that created the compiler may use.
+    """
+
+    def __init__(self, threads=0):
+        self._context = None
+        self._library = _get_library()
+        self._context = self._library.texture_compiler_create(threads)
+        if not self._context:
+            raise TextureCompilerError("Texture compiler error. Failed to create the compiler context.")
+
+    def close(self):
+        """Destroys the context once no job is compiled with it anymore."""
+        if self._context:
+            self._library.texture_compiler_destroy(self._context)
+            self._context = None
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *exception):
+        self.close()
+
+    def __del__(self):
+        self.close()
+
+    def compile(self, image, kind="albedo_roughness", compression="development", width=None, height=None, format=None, **options):
+        """Compiles an image of interleaved RGBA rows, top to bottom, into a dict of outputs by name.
+
+        A NumPy array of shape (height, width, 4) tells its size and format by itself, uint8 and uint16 for 2D
+        textures and uint16 and float32 for cube maps. Other buffers take `width`, `height` and `format`, `rgba8`,
+        `rgba16` or `rgba32f`. `options` are `quality`, `encoder`, `target`, `container`, `max_size`, `mip_count` and
+        `linear_mip_filtering` for 2D textures, and `output_size`, `irradiance_size`, `prefilter_size` and
+        `prefilter_samples` for cube maps, like the command line options of the same names.
+        """
+        view = memoryview(image)
+        if width is None or height is None:
+            if view.ndim != 3 or view.shape[2] != 4:
+                raise ValueError("Image must have a shape of (height, width, 4), or its width and height must be given.")
+            height, width = view.shape[0], view.shape[1]
+        if format is None:
+            format = view.format.lstrip("@=<")
+        else:
+            format = _pick({"rgba8": "B", "rgba16": "H", "rgba32f": "f"}, "format", format)
+        pixel_format = _pick(_FORMATS, "Image format", format)
+        if view.nbytes < width * height * 4 * {"B": 1, "H": 2, "f": 4}[format]:
+            raise ValueError("Image is smaller than its width and height.")
+
+        address, owner = _address(image)
+        job = self._create_job(kind, compression, options)
+        result = ctypes.c_void_p()
+        status = self._library.texture_compiler_compile(self._context, ctypes.byref(job), address, pixel_format, width, height, ctypes.byref(result))
+        del owner
+        return self._take_outputs(status, result)
+
+    def compile_encoded(self, data, kind="albedo_roughness", compression="development", **options):
+        """Compiles a 2D texture from the bytes of an image file in any 2D input format, otherwise like `compile`."""
+        view = memoryview(data)
+        address, owner = _address(data)
+        job = self._create_job(kind, compression, options)
+        result = ctypes.c_void_p()
+        status = self._library.texture_compiler_compile_encoded(self._context, ctypes.byref(job), address, view.nbytes, ctypes.byref(result))
+        del owner
+        return self._take_outputs(status, result)
+
+    def _create_job(self, kind, compression, options):
+        if not self._context:
+            raise ValueError("Compiler is closed.")
+
+        job = _Job()
+        self._library.texture_compiler_job_init(ctypes.byref(job))
+        job.kind = _pick(KINDS, "kind", kind)
+        job.compression = _pick(COMPRESSIONS, "compression", compression)
+        options = dict(options)
+        if "quality" in options:
+            job.quality = _pick(QUALITIES, "quality", options.pop("quality"))
+        if "encoder" in options:
+            job.encoder = _pick(ENCODERS, "encoder", options.pop("encoder"))
+        if "target" in options:
+            job.target = _pick(TARGETS, "target", options.pop("target"))
+            job.container = CONTAINERS["dds" if job.target == TARGETS["bc"] else "ktx2"]
+        if "container" in options:
+            job.container = _pick(CONTAINERS, "container", options.pop("container"))
+        job.is_linear_mip_filtering = 1 if options.pop("linear_mip_filtering", False) else 0
+        for name in ("max_size", "mip_count", "output_size", "irradiance_size", "prefilter_size", "prefilter_samples"):
+            setattr(job, name, int(options.pop(name, 0)))
+        if options:
+            raise TypeError("Unknown options %s." % ", ".join(sorted(options)))
+        return job
+
+    def _take_outputs(self, status, result):
+        if not result:
+            raise MemoryError("Texture compiler ran out of memory.")
+        try:
+            if status != 0:
+                raise TextureCompilerError(self._library.texture_compiler_result_log(result).decode("utf-8", "replace"))
+            outputs = {}
+            for i in range(self._library.texture_compiler_result_output_count(result)):
+                size = ctypes.c_size_t()
+                data = self._library.texture_compiler_result_output_data(result, i, ctypes.byref(size))
+                outputs[self._library.texture_compiler_result_output_name(result, i).decode("utf-8")] = ctypes.string_at(data, size.value)
+            return outputs
+        finally:
+            self._library.texture_compiler_result_destroy(result)
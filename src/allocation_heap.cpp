@@ -0,0 +1,113 @@
+#include "allocation_heap.h"
+#include "allocation_tracker.h"
+
+#include <bx/platform.h>
+#include <climits>
+#include <cstddef>
+
+// Sanitizers replace the heap with their own, which must see every allocation.
+#if defined(__SANITIZE_ADDRESS__) || defined(__SANITIZE_THREAD__)
+#define IS_HEAP_SANITIZED 1
+#elif defined(__has_feature)
+#if __has_feature(address_sanitizer) || __has_feature(thread_sanitizer) || __has_feature(memory_sanitizer)
+#define IS_HEAP_SANITIZED 1
+#endif
+#endif
+
+// `__GLIBC__` is defined by the C library headers, `climits` includes them.
+#if BX_PLATFORM_LINUX && defined(__GLIBC__) && !defined(IS_HEAP_SANITIZED)
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+
+// The heap of glibc under the functions replaced below, which forward to it.
+extern "C" {
+void* __libc_malloc(size_t size);
+void __libc_free(void* pointer);
+void* __libc_calloc(size_t count, size_t size);
+void* __libc_realloc(void* pointer, size_t size);
+void* __libc_memalign(size_t alignment, size_t size);
+void* __libc_valloc(size_t size);
+void* __libc_pvalloc(size_t size);
+}
+
+// Replacements of the C heap. Functions of glibc calling its heap internally, like `reallocarray`, are replaced too, so
+// no block is allocated or freed behind the records. glibc's `malloc_usable_size` is kept, every block is one of its.
+extern "C" {
+void* malloc(size_t size) noexcept {
+    void* const pointer = __libc_malloc(size);
+    record_allocation(pointer);
+    return pointer;
+}
+
+void free(void* pointer) noexcept {
+    forget_allocation(pointer);
+    __libc_free(pointer);
+}
+
+void* calloc(size_t count, size_t size) noexcept {
+    void* const pointer = __libc_calloc(count, size);
+    record_allocation(pointer);
+    return pointer;
+}
+
+// The old allocation is forgotten first, once it's freed another thread may be given the same address. When the heap
+// fails to grow it, the old allocation stays live but uncounted.
+void* realloc(void* pointer, size_t size) noexcept {
+    forget_allocation(pointer);
+    void* const new_pointer = __libc_realloc(pointer, size);
+    record_allocation(new_pointer);
+    return new_pointer;
+}
+
+void* reallocarray(void* pointer, size_t count, size_t size) noexcept {
+    if (size != 0 && count > SIZE_MAX / size) {
+        errno = ENOMEM;
+        return nullptr;
+    }
+    return realloc(pointer, count * size);
+}
+
+void* memalign(size_t alignment, size_t size) noexcept {
+    void* const pointer = __libc_memalign(alignment, size);
+    record_allocation(pointer);
+    return pointer;
+}
+
+void* aligned_alloc(size_t alignment, size_t size) noexcept {
+    return memalign(alignment, size);
+}
+
+int posix_memalign(void** result, size_t alignment, size_t size) noexcept {
+    if (alignment % sizeof(void*) != 0 || (alignment & (alignment - 1)) != 0) {
+        return EINVAL;
+    }
+    void* const pointer = memalign(alignment, size);
+    if (pointer == nullptr) {
+        return ENOMEM;
+    }
+    *result = pointer;
+    return 0;
+}
+
+void* valloc(size_t size) noexcept {
+    void* const pointer = __libc_valloc(size);
+    record_allocation(pointer);
+    return pointer;
+}
+
+void* pvalloc(size_t size) noexcept {
+    void* const pointer = __libc_pvalloc(size);
+    record_allocation(pointer);
+    return pointer;
+}
+}
+
+bool is_c_heap_replaced() noexcept {
+    return true;
+}
+#else
+bool is_c_heap_replaced() noexcept {
+    return false;
+}
+#endif
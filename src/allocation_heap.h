@@ -0,0 +1,10 @@
+#pragma once
+
+// C heap of the executable built with `TEXTURE_COMPILER_ALLOCATION_TRACKING`, whose `malloc`, `free` and the rest are
+// replaced with functions forwarding to glibc that record allocations for `--track-allocations`. The dynamic linker
+// binds every library of the process to them, so allocations of the C++ runtime, stb_image, nvtt and bgfx are counted
+// too, and allocators preloaded with `LD_PRELOAD` are bypassed. The library and tools linking the core never replace
+// the heap.
+
+// False on platforms other than Linux with glibc and in builds with a sanitizer, which replaces the heap itself.
+bool is_c_heap_replaced() noexcept;
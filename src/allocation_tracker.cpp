@@ -0,0 +1,217 @@
+#include "allocation_tracker.h"
+
+#include <bx/platform.h>
+#include <climits>
+#include <cstddef>
+
+// `__GLIBC__` is defined by the C library headers, `climits` includes them.
+#if BX_PLATFORM_LINUX && defined(__GLIBC__)
+#include <functional>
+#include <malloc.h>
+#include <new>
+#include <unordered_map>
+#include <utility>
+#endif
+
+static std::atomic<bool> is_tracking { false };
+
+// Stage and job of the innermost tag of the thread, null outside tags. Plain pointers, so the replaced heap can read
+// them on any thread without initializing anything.
+static thread_local AllocationCounters* tagged_stage = nullptr;
+static thread_local AllocationCounters* tagged_job = nullptr;
+
+#if BX_PLATFORM_LINUX && defined(__GLIBC__)
+// The heap of glibc under the replaced one, see `allocation_heap.cpp`.
+extern "C" {
+void* __libc_malloc(size_t size);
+void __libc_free(void* pointer);
+}
+
+// Allocates the records from the heap of glibc, so recording an allocation doesn't record another one.
+template <typename T>
+struct UntrackedAllocator final {
+    using value_type = T;
+
+    UntrackedAllocator() noexcept = default;
+
+    template <typename U>
+    UntrackedAllocator(const UntrackedAllocator<U>&) noexcept {
+    }
+
+    T* allocate(size_t count) {
+        void* pointer = __libc_malloc(count * sizeof(T));
+        if (pointer == nullptr) {
+            throw std::bad_alloc();
+        }
+        return static_cast<T*>(pointer);
+    }
+
+    void deallocate(T* pointer, size_t) noexcept {
+        __libc_free(pointer);
+    }
+
+    template <typename U>
+    bool operator==(const UntrackedAllocator<U>&) const noexcept {
+        return true;
+    }
+
+    template <typename U>
+    bool operator!=(const UntrackedAllocator<U>&) const noexcept {
+        return false;
+    }
+};
+
+static void add_allocation(AllocationCounters& counters, size_t size) noexcept {
+    counters.allocations.fetch_add(1, std::memory_order_relaxed);
+    counters.allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+    const int64_t live_bytes = counters.live_bytes.fetch_add(static_cast<int64_t>(size), std::memory_order_relaxed) + static_cast<int64_t>(size);
+    int64_t peak_live_bytes = counters.peak_live_bytes.load(std::memory_order_relaxed);
+    while (live_bytes > peak_live_bytes && !counters.peak_live_bytes.compare_exchange_weak(peak_live_bytes, live_bytes, std::memory_order_relaxed)) {
+    }
+}
+
+struct AllocationRecord final {
+    size_t size;
+    AllocationCounters* stage;
+    AllocationCounters* job;
+};
+
+// Live tagged allocations by address, split into shards so threads allocating at the same time rarely share a lock.
+struct AllocationShard final {
+    std::mutex mutex;
+    std::unordered_map<void*, AllocationRecord, std::hash<void*>, std::equal_to<void*>, UntrackedAllocator<std::pair<void* const, AllocationRecord>>> records;
+};
+
+static constexpr size_t ALLOCATION_SHARD_COUNT = 64;
+
+// Created when tracking is enabled and never destroyed, so memory freed while the process exits still finds it.
+static AllocationShard* allocation_shards = nullptr;
+
+// Untagged allocations are freed without a lookup while nothing is recorded.
+static std::atomic<size_t> record_count { 0 };
+
+static AllocationShard& get_shard(const void* pointer) noexcept {
+    return allocation_shards[(reinterpret_cast<uintptr_t>(pointer) >> 4) * 0x9E3779B97F4A7C15ull >> 58];
+}
+
+void record_allocation(void* pointer) noexcept {
+    AllocationCounters* const stage = tagged_stage;
+    if (pointer == nullptr || stage == nullptr || !is_tracking.load(std::memory_order_relaxed)) {
+        return;
+    }
+
+    // Callers may use the whole block `malloc_usable_size` gives them, so that's what the allocation counts for.
+    const size_t size = malloc_usable_size(pointer);
+    AllocationCounters* const job = tagged_job;
+    AllocationShard& shard = get_shard(pointer);
+    try {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.records[pointer] = AllocationRecord { size, stage, job };
+    } catch (...) {
+        // The allocation is left out of the counts.
+        return;
+    }
+    record_count.fetch_add(1, std::memory_order_relaxed);
+    add_allocation(*stage, size);
+    add_allocation(*job, size);
+}
+
+void forget_allocation(void* pointer) noexcept {
+    if (pointer == nullptr || record_count.load(std::memory_order_relaxed) == 0) {
+        return;
+    }
+
+    // Counters are updated under the lock, so a tracker destroyed at the same time waits for them.
+    AllocationShard& shard = get_shard(pointer);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    const auto it = shard.records.find(pointer);
+    if (it == shard.records.end()) {
+        return;
+    }
+    const AllocationRecord& record = it->second;
+    record.stage->live_bytes.fetch_sub(static_cast<int64_t>(record.size), std::memory_order_relaxed);
+    record.job->live_bytes.fetch_sub(static_cast<int64_t>(record.size), std::memory_order_relaxed);
+    shard.records.erase(it);
+    record_count.fetch_sub(1, std::memory_order_relaxed);
+}
+#endif
+
+AllocationTracker::~AllocationTracker() {
+#if BX_PLATFORM_LINUX && defined(__GLIBC__)
+    if (allocation_shards == nullptr || record_count.load(std::memory_order_relaxed) == 0) {
+        return;
+    }
+    for (size_t i = 0; i < ALLOCATION_SHARD_COUNT; i++) {
+        AllocationShard& shard = allocation_shards[i];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        for (auto it = shard.records.begin(); it != shard.records.end();) {
+            if (it->second.job == &job) {
+                it = shard.records.erase(it);
+                record_count.fetch_sub(1, std::memory_order_relaxed);
+            } else {
+                ++it;
+            }
+        }
+    }
+#endif
+}
+
+AllocationCounters* AllocationTracker::get_stage(const char* name) noexcept {
+    try {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (AllocationStage& stage : stages) {
+            if (stage.name == name) {
+                return &stage.counters;
+            }
+        }
+        stages.emplace_back();
+        stages.back().name = name;
+        return &stages.back().counters;
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+AllocationTag::AllocationTag(AllocationTracker* tracker, const char* stage) noexcept {
+    if (tracker != nullptr && is_tracking.load(std::memory_order_relaxed)) {
+        this->stage = tracker->get_stage(stage);
+        if (this->stage != nullptr) {
+            previous_stage = tagged_stage;
+            previous_job = tagged_job;
+            tagged_stage = this->stage;
+            tagged_job = &tracker->job;
+        }
+    }
+}
+
+AllocationTag::~AllocationTag() {
+    stop();
+}
+
+void AllocationTag::stop() noexcept {
+    // A tag stopped before the ones nested in it leaves them in place.
+    if (stage != nullptr && tagged_stage == stage) {
+        tagged_stage = previous_stage;
+        tagged_job = previous_job;
+    }
+    stage = nullptr;
+}
+
+bool enable_allocation_tracking() noexcept {
+#if BX_PLATFORM_LINUX && defined(__GLIBC__)
+    if (allocation_shards == nullptr) {
+        allocation_shards = new (std::nothrow) AllocationShard[ALLOCATION_SHARD_COUNT];
+        if (allocation_shards == nullptr) {
+            return false;
+        }
+    }
+    is_tracking.store(true, std::memory_order_relaxed);
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool is_allocation_tracking() noexcept {
+    return is_tracking.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+
+// Heap allocations of a stage of a job, or of the whole job, for `--track-allocations`. Live bytes drop when the
+// allocations are freed, whichever thread frees them.
+struct AllocationCounters final {
+    std::atomic<uint64_t> allocations { 0 };
+    std::atomic<uint64_t> allocated_bytes { 0 };
+    std::atomic<int64_t> live_bytes { 0 };
+    std::atomic<int64_t> peak_live_bytes { 0 };
+};
+
+struct AllocationStage final {
+    std::string name;
+    AllocationCounters counters;
+};
+
+// Heap allocations of a job by the stage that made them. Allocations still live when the tracker is destroyed are
+// forgotten, so freeing them later doesn't touch it.
+struct AllocationTracker final {
+    AllocationTracker() noexcept = default;
+
+    AllocationTracker(const AllocationTracker&) = delete;
+    AllocationTracker(AllocationTracker&&) = delete;
+    AllocationTracker& operator=(const AllocationTracker&) = delete;
+    AllocationTracker& operator=(AllocationTracker&&) = delete;
+
+    ~AllocationTracker();
+
+    // Counters of the stage, added on its first use. Null when they can't be added.
+    AllocationCounters* get_stage(const char* name) noexcept;
+
+    AllocationCounters job;
+
+    // Stages never move, so tags keep pointing to their counters while other stages are added.
+    std::mutex mutex;
+    std::deque<AllocationStage> stages;
+};
+
+// Tags allocations of the calling thread with a stage of the job from construction until `stop` or destruction. Nested
+// tags take over until they stop. Null `tracker` tags nothing, and so does every tag unless tracking is enabled.
+struct AllocationTag final {
+    AllocationTag(AllocationTracker* tracker, const char* stage) noexcept;
+
+    AllocationTag(const AllocationTag&) = delete;
+    AllocationTag(AllocationTag&&) = delete;
+    AllocationTag& operator=(const AllocationTag&) = delete;
+    AllocationTag& operator=(AllocationTag&&) = delete;
+
+    ~AllocationTag();
+
+    void stop() noexcept;
+
+private:
+    AllocationCounters* stage = nullptr;
+    AllocationCounters* previous_stage = nullptr;
+    AllocationCounters* previous_job = nullptr;
+};
+
+// Starts recording heap allocations made under an `AllocationTag`. Only the C heap the executable replaces when it's
+// built with `TEXTURE_COMPILER_ALLOCATION_TRACKING` records them, see `allocation_heap.h`, so the caller checks that
+// it's replaced. Returns false on platforms other than Linux with glibc, where nothing is tracked.
+bool enable_allocation_tracking() noexcept;
+
+bool is_allocation_tracking() noexcept;
+
+// Records an allocation of the replaced heap for the innermost tag of the calling thread, and forgets one it frees.
+// Untagged allocations cost a lookup when they're freed. Linux with glibc only.
+void record_allocation(void* pointer) noexcept;
+void forget_allocation(void* pointer) noexcept;
@@ -0,0 +1,373 @@
+#include "archive.h"
+
+#include "mapped_file.h"
+#include "stb_image.h"
+
+#include <algorithm>
+#include <cctype>
+#include <climits>
+#include <exception>
+#include <filesystem>
+#include <map>
+#include <mutex>
+#include <new>
+#include <unordered_map>
+
+#if defined(TEXTURE_COMPILER_ZLIB)
+#include <zlib.h>
+#endif
+
+#if !BX_PLATFORM_WINDOWS
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+static constexpr uint32_t ZIP_LOCAL_HEADER_SIGNATURE = 0x04034b50;
+static constexpr uint32_t ZIP_CENTRAL_HEADER_SIGNATURE = 0x02014b50;
+static constexpr uint32_t ZIP_END_SIGNATURE = 0x06054b50;
+static constexpr uint32_t ZIP64_END_SIGNATURE = 0x06064b50;
+static constexpr uint32_t ZIP64_END_LOCATOR_SIGNATURE = 0x07064b50;
+
+static constexpr size_t ZIP_LOCAL_HEADER_SIZE = 30;
+static constexpr size_t ZIP_CENTRAL_HEADER_SIZE = 46;
+static constexpr size_t ZIP_END_SIZE = 22;
+static constexpr size_t ZIP64_END_SIZE = 56;
+static constexpr size_t ZIP64_END_LOCATOR_SIZE = 20;
+
+// Extra field of the central directory with the 64-bit sizes and offset of a zip64 member.
+static constexpr uint16_t ZIP64_EXTRA_FIELD = 0x0001;
+
+static constexpr uint16_t ZIP_STORED = 0;
+static constexpr uint16_t ZIP_DEFLATED = 8;
+static constexpr uint16_t ZIP_ENCRYPTED_FLAG = 1;
+
+namespace {
+
+struct ZipEntry final {
+    uint64_t local_header_offset = 0;
+    uint64_t compressed_size = 0;
+    uint64_t size = 0;
+    uint16_t method = 0;
+    uint16_t flags = 0;
+};
+
+struct ZipArchive final {
+    // The archive is read at the members the jobs open, so the kernel isn't asked to read all of it ahead.
+    explicit ZipArchive(const std::string& path) noexcept
+            : file(path, false) {
+    }
+
+    MappedFile file;
+    std::unordered_map<std::string, ZipEntry> entries;
+
+    // Tell whether the archive changed on disk since it was opened.
+    uintmax_t file_size = 0;
+    std::filesystem::file_time_type time;
+};
+
+struct ArchiveRegistry final {
+    std::mutex mutex;
+    std::map<std::string, std::shared_ptr<const ZipArchive>> archives;
+};
+
+} // namespace
+
+static uint16_t read_u16(const uint8_t* data) noexcept {
+    return static_cast<uint16_t>(data[0] | (data[1] << 8));
+}
+
+static uint32_t read_u32(const uint8_t* data) noexcept {
+    return static_cast<uint32_t>(data[0]) | (static_cast<uint32_t>(data[1]) << 8) | (static_cast<uint32_t>(data[2]) << 16) |
+           (static_cast<uint32_t>(data[3]) << 24);
+}
+
+static uint64_t read_u64(const uint8_t* data) noexcept {
+    return static_cast<uint64_t>(read_u32(data)) | (static_cast<uint64_t>(read_u32(data + 4)) << 32);
+}
+
+// Position of the colon between the archive and the member, or `npos`.
+static size_t find_member_separator(const std::string& path) noexcept {
+    for (size_t colon = path.find(':'); colon != std::string::npos; colon = path.find(':', colon + 1)) {
+        if (colon < 5 || colon + 1 == path.size()) {
+            continue;
+        }
+
+        std::string extension = path.substr(colon - 4, 4);
+        std::transform(extension.begin(), extension.end(), extension.begin(), [](unsigned char c) {
+            return static_cast<char>(std::tolower(c));
+        });
+        if (extension == ".zip" || extension == ".pak") {
+            return colon;
+        }
+    }
+    return std::string::npos;
+}
+
+bool is_archive_member_path(const std::string& path) noexcept {
+    return find_member_separator(path) != std::string::npos;
+}
+
+std::string get_input_file_path(const std::string& path) {
+    const size_t separator = find_member_separator(path);
+    return separator != std::string::npos ? path.substr(0, separator) : path;
+}
+
+// Reads the sizes and the offset of a zip64 member from its extra field, each one is present only when the central
+// directory header has all bits set in its place.
+static bool read_zip64_extra_field(const uint8_t* extra, size_t extra_size, ZipEntry& entry, uint32_t size, uint32_t compressed_size, uint32_t offset) noexcept {
+    while (extra_size >= 4) {
+        const uint16_t id = read_u16(extra);
+        const size_t field_size = read_u16(extra + 2);
+        if (field_size > extra_size - 4) {
+            return false;
+        }
+
+        if (id == ZIP64_EXTRA_FIELD) {
+            const uint8_t* field = extra + 4;
+            const uint8_t* const field_end = field + field_size;
+            for (auto [value, target] : { std::make_pair(size, &entry.size), std::make_pair(compressed_size, &entry.compressed_size),
+                                          std::make_pair(offset, &entry.local_header_offset) }) {
+                if (value != UINT32_MAX) {
+                    continue;
+                }
+                if (field_end - field < 8) {
+                    return false;
+                }
+                *target = read_u64(field);
+                field += 8;
+            }
+            return true;
+        }
+
+        extra += 4 + field_size;
+        extra_size -= 4 + field_size;
+    }
+    return size != UINT32_MAX && compressed_size != UINT32_MAX && offset != UINT32_MAX;
+}
+
+// Indexes the central directory, which is found from the end of central directory record at the end of the archive,
+// after an archive comment of up to 64 KiB.
+static bool read_central_directory(const uint8_t* data, size_t size, std::unordered_map<std::string, ZipEntry>& entries) {
+    if (size < ZIP_END_SIZE) {
+        return false;
+    }
+
+    size_t end = size - ZIP_END_SIZE;
+    const size_t search_end = end > UINT16_MAX ? end - UINT16_MAX : 0;
+    while (read_u32(data + end) != ZIP_END_SIGNATURE) {
+        if (end == search_end) {
+            return false;
+        }
+        end--;
+    }
+
+    // Archives on several disks are never written by the tools that pack game assets.
+    if (read_u16(data + end + 4) != 0 || read_u16(data + end + 6) != 0) {
+        return false;
+    }
+
+    uint64_t entry_count = read_u16(data + end + 10);
+    uint64_t directory_size = read_u32(data + end + 12);
+    uint64_t directory_offset = read_u32(data + end + 16);
+    if (entry_count == UINT16_MAX || directory_size == UINT32_MAX || directory_offset == UINT32_MAX) {
+        if (end < ZIP64_END_LOCATOR_SIZE || read_u32(data + end - ZIP64_END_LOCATOR_SIZE) != ZIP64_END_LOCATOR_SIGNATURE) {
+            return false;
+        }
+        const uint64_t zip64_end = read_u64(data + end - ZIP64_END_LOCATOR_SIZE + 8);
+        if (size < ZIP64_END_SIZE || zip64_end > size - ZIP64_END_SIZE || read_u32(data + zip64_end) != ZIP64_END_SIGNATURE) {
+            return false;
+        }
+        entry_count = read_u64(data + zip64_end + 32);
+        directory_size = read_u64(data + zip64_end + 40);
+        directory_offset = read_u64(data + zip64_end + 48);
+    }
+
+    if (directory_offset > size || directory_size > size - directory_offset || entry_count > directory_size / ZIP_CENTRAL_HEADER_SIZE) {
+        return false;
+    }
+
+    const uint8_t* header = data + directory_offset;
+    const uint8_t* const directory_end = header + directory_size;
+    entries.reserve(static_cast<size_t>(entry_count));
+    for (uint64_t i = 0; i < entry_count; i++) {
+        if (static_cast<size_t>(directory_end - header) < ZIP_CENTRAL_HEADER_SIZE || read_u32(header) != ZIP_CENTRAL_HEADER_SIGNATURE) {
+            return false;
+        }
+
+        const size_t name_size = read_u16(header + 28);
+        const size_t extra_size = read_u16(header + 30);
+        const size_t comment_size = read_u16(header + 32);
+        if (static_cast<size_t>(directory_end - header) - ZIP_CENTRAL_HEADER_SIZE < name_size + extra_size + comment_size) {
+            return false;
+        }
+
+        ZipEntry entry;
+        entry.flags = read_u16(header + 8);
+        entry.method = read_u16(header + 10);
+        entry.compressed_size = read_u32(header + 20);
+        entry.size = read_u32(header + 24);
+        entry.local_header_offset = read_u32(header + 42);
+        if (!read_zip64_extra_field(header + ZIP_CENTRAL_HEADER_SIZE + name_size, extra_size, entry, read_u32(header + 24), read_u32(header + 20),
+                                    read_u32(header + 42))) {
+            return false;
+        }
+
+        entries.emplace(std::string(reinterpret_cast<const char*>(header) + ZIP_CENTRAL_HEADER_SIZE, name_size), entry);
+        header += ZIP_CENTRAL_HEADER_SIZE + name_size + extra_size + comment_size;
+    }
+    return true;
+}
+
+// Opened archives are kept until the process exits, members of jobs that are still running keep a replaced one alive.
+static std::shared_ptr<const ZipArchive> get_archive(const std::string& path) noexcept {
+    static ArchiveRegistry registry;
+
+    try {
+        std::error_code error;
+        const uintmax_t file_size = std::filesystem::file_size(path, error);
+        if (error) {
+            return nullptr;
+        }
+        const std::filesystem::file_time_type time = std::filesystem::last_write_time(path, error);
+        if (error) {
+            return nullptr;
+        }
+
+        const std::lock_guard<std::mutex> lock(registry.mutex);
+        std::shared_ptr<const ZipArchive>& archive = registry.archives[path];
+        if (archive != nullptr && archive->file_size == file_size && archive->time == time) {
+            return archive;
+        }
+
+        auto opened = std::make_shared<ZipArchive>(path);
+        opened->file_size = file_size;
+        opened->time = time;
+        if (opened->file.data == nullptr || !read_central_directory(opened->file.data, opened->file.size, opened->entries)) {
+            return nullptr;
+        }
+        archive = std::move(opened);
+        return archive;
+    } catch (const std::exception&) {
+        return nullptr;
+    }
+}
+
+// Inflates the raw deflate stream of a member into `output`. The whole member must fill exactly `output_size` bytes and
+// end there, a prefix of it only has to fill them.
+static bool inflate_member(const uint8_t* input, size_t input_size, uint8_t* output, size_t output_size, bool is_whole) noexcept {
+#if defined(TEXTURE_COMPILER_ZLIB)
+    z_stream stream {};
+    if (inflateInit2(&stream, -MAX_WBITS) != Z_OK) {
+        return false;
+    }
+
+    // zlib counts in 32 bits, so members over 4 GiB are fed and drained in parts.
+    size_t input_offset = 0;
+    size_t output_offset = 0;
+    bool result = false;
+    for (;;) {
+        if (stream.avail_in == 0 && input_offset < input_size) {
+            const size_t part = std::min<size_t>(input_size - input_offset, UINT_MAX);
+            stream.next_in = const_cast<Bytef*>(input + input_offset);
+            stream.avail_in = static_cast<uInt>(part);
+            input_offset += part;
+        }
+        if (stream.avail_out == 0) {
+            if (output_offset == output_size && !is_whole) {
+                result = true;
+                break;
+            }
+            const size_t part = std::min<size_t>(output_size - output_offset, UINT_MAX);
+            stream.next_out = output + output_offset;
+            stream.avail_out = static_cast<uInt>(part);
+            output_offset += part;
+        }
+
+        const int status = inflate(&stream, Z_NO_FLUSH);
+        if (status == Z_STREAM_END) {
+            result = stream.avail_out == 0 && output_offset == output_size;
+            break;
+        }
+        if (status != Z_OK) {
+            break;
+        }
+    }
+
+    inflateEnd(&stream);
+    return result;
+#else
+    // stb_image inflates whole streams only, which is enough for the header of a member too.
+    if (input_size > INT_MAX || output_size > INT_MAX || !is_whole) {
+        return false;
+    }
+    return stbi_zlib_decode_noheader_buffer(reinterpret_cast<char*>(output), static_cast<int>(output_size), reinterpret_cast<const char*>(input),
+                                            static_cast<int>(input_size)) == static_cast<int>(output_size);
+#endif
+}
+
+bool open_archive_member(const std::string& path, ArchiveMember& member, size_t max_size) noexcept {
+    const size_t separator = find_member_separator(path);
+    if (separator == std::string::npos) {
+        return false;
+    }
+
+    try {
+        std::shared_ptr<const ZipArchive> archive = get_archive(path.substr(0, separator));
+        if (archive == nullptr) {
+            return false;
+        }
+
+        // Zip names members with forward slashes, which Windows users may write the other way.
+        std::string name = path.substr(separator + 1);
+        std::replace(name.begin(), name.end(), '\\', '/');
+        const auto it = archive->entries.find(name);
+        if (it == archive->entries.end() || (it->second.flags & ZIP_ENCRYPTED_FLAG) != 0) {
+            return false;
+        }
+        const ZipEntry& entry = it->second;
+
+        const uint8_t* const data = archive->file.data;
+        const size_t size = archive->file.size;
+        if (size < ZIP_LOCAL_HEADER_SIZE || entry.local_header_offset > size - ZIP_LOCAL_HEADER_SIZE || read_u32(data + entry.local_header_offset) != ZIP_LOCAL_HEADER_SIGNATURE) {
+            return false;
+        }
+        const uint64_t offset = entry.local_header_offset + ZIP_LOCAL_HEADER_SIZE + read_u16(data + entry.local_header_offset + 26) +
+                                read_u16(data + entry.local_header_offset + 28);
+        if (offset > size || entry.compressed_size > size - offset) {
+            return false;
+        }
+        const uint8_t* const compressed = data + offset;
+        const size_t compressed_size = static_cast<size_t>(entry.compressed_size);
+
+#if !BX_PLATFORM_WINDOWS
+        // The mapping of the archive doesn't read ahead, the member is about to be read from its start to its end.
+        const auto page_size = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+        const uintptr_t begin = reinterpret_cast<uintptr_t>(compressed) & ~(page_size - 1);
+        madvise(reinterpret_cast<void*>(begin), reinterpret_cast<uintptr_t>(compressed) + compressed_size - begin, MADV_WILLNEED);
+#endif
+
+        if (entry.method == ZIP_STORED) {
+            if (entry.size != entry.compressed_size) {
+                return false;
+            }
+            member.data = compressed;
+            member.size = compressed_size;
+        } else if (entry.method == ZIP_DEFLATED) {
+            const bool is_whole = entry.size <= max_size;
+            const size_t inflated_size = static_cast<size_t>(std::min<uint64_t>(entry.size, max_size));
+            member.inflated.reset(new (std::nothrow) uint8_t[std::max<size_t>(inflated_size, 1)]);
+            if (member.inflated == nullptr || !inflate_member(compressed, compressed_size, member.inflated.get(), inflated_size, is_whole)) {
+                return false;
+            }
+            member.data = member.inflated.get();
+            member.size = inflated_size;
+        } else {
+            return false;
+        }
+
+        member.archive = std::move(archive);
+        return true;
+    } catch (const std::exception&) {
+        return false;
+    }
+}
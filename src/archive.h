@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+// Inputs can be members of zip archives, named by the path of the archive, a colon and the path of the member inside
+// it, like `textures.zip:rock/albedo.png`. Archives end with `.zip` or `.pak`, which tells a member apart from a drive
+// letter or a file name with a colon. An archive is memory mapped and its central directory is read by the first member
+// opened, and both are kept for the members of later jobs until the archive changes on disk, so a manifest of members
+// of the same archive opens it once. Stored members are decoded in place from the mapping, deflated ones are inflated
+// into a buffer of their own. Encrypted members, compression methods other than deflate and archives split over several
+// files are not supported.
+
+// True when `path` names a member of an archive.
+bool is_archive_member_path(const std::string& path) noexcept;
+
+// File that holds the input at `path`: the archive of a member, `path` itself otherwise. Incremental builds and `--watch`
+// compare the modification time and the size of this file.
+std::string get_input_file_path(const std::string& path);
+
+// Content of an archive member, which keeps the mapping of its archive alive.
+struct ArchiveMember final {
+    std::shared_ptr<const void> archive;
+
+    // Owns `data` of deflated members.
+    std::unique_ptr<uint8_t[]> inflated;
+
+    const uint8_t* data = nullptr;
+    size_t size = 0;
+};
+
+// Opens the member at `path`. A deflated member is inflated only up to `max_size` bytes, for readers of headers, stored
+// members are always whole. Returns false when the archive can't be read, has no such member or the member is broken.
+bool open_archive_member(const std::string& path, ArchiveMember& member, size_t max_size = SIZE_MAX) noexcept;
@@ -0,0 +1,640 @@
+#include "astc_encoder.h"
+#include "block_delta.h"
+#include "dds_layout.h"
+#include "thread_pool.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+// Number of block rows encoded by one thread pool task.
+static constexpr size_t ASTC_TASK_BLOCK_ROWS = 16;
+
+// Color endpoint data starts after 11 bits of block mode, 2 bits of partition count and 4 bits of endpoint mode.
+static constexpr size_t ASTC_ENDPOINT_OFFSET = 17;
+
+// Integer sequence encoding ranges in increasing order, the number of levels is `(trits ? 3 : quints ? 5 : 1) << bits`.
+struct SequenceRange final {
+    uint32_t levels;
+    bool is_trit;
+    bool is_quint;
+    uint32_t bits;
+};
+
+static const SequenceRange SEQUENCE_RANGES[] = {
+    { 2, false, false, 1 },   { 3, true, false, 0 },    { 4, false, false, 2 },   { 5, false, true, 0 },
+    { 6, true, false, 1 },    { 8, false, false, 3 },   { 10, false, true, 1 },   { 12, true, false, 2 },
+    { 16, false, false, 4 },  { 20, false, true, 2 },   { 24, true, false, 3 },   { 32, false, false, 5 },
+    { 40, false, true, 3 },   { 48, true, false, 4 },   { 64, false, false, 6 },  { 80, false, true, 4 },
+    { 96, true, false, 5 },   { 128, false, false, 7 }, { 160, false, true, 5 },  { 192, true, false, 6 },
+    { 256, false, false, 8 },
+};
+
+static constexpr size_t SEQUENCE_RANGE_COUNT = sizeof(SEQUENCE_RANGES) / sizeof(SEQUENCE_RANGES[0]);
+
+// Endpoints are never quantized to fewer than 6 levels.
+static constexpr size_t MIN_ENDPOINT_RANGE = 4;
+
+// Bit patterns added to color endpoints with trits and quints before the final shift, one character per bit from the
+// top. Letters are bits of the value `b` being bit 1, zeros are zeros.
+static const char* const TRIT_ENDPOINT_PATTERNS[] = { "000000000", "b000b0bb0", "cb000cbcb", "dcb000dcb", "edcb000ed", "fedcb000f" };
+static const uint32_t TRIT_ENDPOINT_SCALES[] = { 204, 93, 44, 22, 11, 5 };
+static const char* const QUINT_ENDPOINT_PATTERNS[] = { "000000000", "b0000bb00", "cb0000cbc", "dcb0000dc", "edcb0000e" };
+static const uint32_t QUINT_ENDPOINT_SCALES[] = { 113, 54, 26, 13, 6 };
+
+// Block layouts tried by the encoder. All of them have a single partition and a single plane of 4x4 weights.
+struct BlockLayout final {
+    uint32_t block_mode;
+    uint32_t weight_bits;
+    uint32_t endpoint_mode;
+    uint32_t channel_count;
+};
+
+// RGBA endpoints with 16 and 8 weight levels.
+static constexpr BlockLayout RGBA_FINE_LAYOUT = { 0x242, 4, 12, 4 };
+static constexpr BlockLayout RGBA_COARSE_LAYOUT = { 0x053, 3, 12, 4 };
+
+// RGB endpoints with 16 and 8 weight levels.
+static constexpr BlockLayout RGB_FINE_LAYOUT = { 0x242, 4, 8, 3 };
+static constexpr BlockLayout RGB_COARSE_LAYOUT = { 0x053, 3, 8, 3 };
+
+// Luminance endpoints with 32 weight levels.
+static constexpr BlockLayout LUMINANCE_LAYOUT = { 0x253, 5, 0, 1 };
+
+// Lookup tables built once from the decoding rules of the specification.
+struct AstcTables final {
+    AstcTables() noexcept {
+        // Every 5 trit and 3 quint combination has at least one encoding, pick the first one.
+        std::fill(std::begin(trit_encodings), std::end(trit_encodings), 0xFF);
+        for (uint32_t t = 0; t < 256; t++) {
+            uint32_t trits[5];
+            decode_trits(t, trits);
+            uint8_t& encoding = trit_encodings[(((trits[4] * 3 + trits[3]) * 3 + trits[2]) * 3 + trits[1]) * 3 + trits[0]];
+            if (encoding == 0xFF) {
+                encoding = static_cast<uint8_t>(t);
+            }
+        }
+        std::fill(std::begin(quint_encodings), std::end(quint_encodings), 0xFF);
+        for (uint32_t q = 0; q < 128; q++) {
+            uint32_t quints[3];
+            decode_quints(q, quints);
+            uint8_t& encoding = quint_encodings[(quints[2] * 5 + quints[1]) * 5 + quints[0]];
+            if (encoding == 0xFF) {
+                encoding = static_cast<uint8_t>(q);
+            }
+        }
+
+        for (size_t range = MIN_ENDPOINT_RANGE; range < SEQUENCE_RANGE_COUNT; range++) {
+            const SequenceRange& sequence_range = SEQUENCE_RANGES[range];
+            for (uint32_t symbol = 0; symbol < sequence_range.levels; symbol++) {
+                endpoint_values[range][symbol] = static_cast<uint8_t>(unquantize_endpoint(sequence_range, symbol));
+            }
+            for (uint32_t value = 0; value < 256; value++) {
+                uint32_t best_symbol = 0;
+                uint32_t best_difference = std::numeric_limits<uint32_t>::max();
+                for (uint32_t symbol = 0; symbol < sequence_range.levels; symbol++) {
+                    const uint32_t difference = static_cast<uint32_t>(std::abs(static_cast<int>(endpoint_values[range][symbol]) - static_cast<int>(value)));
+                    if (difference < best_difference) {
+                        best_difference = difference;
+                        best_symbol = symbol;
+                    }
+                }
+                nearest_endpoints[range][value] = static_cast<uint8_t>(best_symbol);
+            }
+        }
+    }
+
+    static uint32_t get_bit(uint32_t value, uint32_t bit) noexcept {
+        return (value >> bit) & 1;
+    }
+
+    static void decode_trits(uint32_t t, uint32_t (&trits)[5]) noexcept {
+        uint32_t c;
+        if (((t >> 2) & 7) == 7) {
+            c = ((t >> 5) << 2) | (t & 3);
+            trits[4] = 2;
+            trits[3] = 2;
+        } else {
+            c = t & 0x1F;
+            if (((t >> 5) & 3) == 3) {
+                trits[4] = 2;
+                trits[3] = get_bit(t, 7);
+            } else {
+                trits[4] = get_bit(t, 7);
+                trits[3] = (t >> 5) & 3;
+            }
+        }
+        if ((c & 3) == 3) {
+            trits[2] = 2;
+            trits[1] = get_bit(c, 4);
+            trits[0] = (get_bit(c, 3) << 1) | (get_bit(c, 2) & ~get_bit(c, 3) & 1);
+        } else if (((c >> 2) & 3) == 3) {
+            trits[2] = 2;
+            trits[1] = 2;
+            trits[0] = c & 3;
+        } else {
+            trits[2] = get_bit(c, 4);
+            trits[1] = (c >> 2) & 3;
+            trits[0] = (get_bit(c, 1) << 1) | (get_bit(c, 0) & ~get_bit(c, 1) & 1);
+        }
+    }
+
+    static void decode_quints(uint32_t q, uint32_t (&quints)[3]) noexcept {
+        if (((q >> 1) & 3) == 3 && ((q >> 5) & 3) == 0) {
+            const uint32_t q0 = get_bit(q, 0);
+            quints[2] = (q0 << 2) | ((get_bit(q, 4) & ~q0 & 1) << 1) | (get_bit(q, 3) & ~q0 & 1);
+            quints[1] = 4;
+            quints[0] = 4;
+            return;
+        }
+
+        uint32_t c;
+        if (((q >> 1) & 3) == 3) {
+            quints[2] = 4;
+            c = (((q >> 3) & 3) << 3) | ((~(q >> 5) & 3) << 1) | (q & 1);
+        } else {
+            quints[2] = (q >> 5) & 3;
+            c = q & 0x1F;
+        }
+        if ((c & 7) == 5) {
+            quints[1] = 4;
+            quints[0] = (c >> 3) & 3;
+        } else {
+            quints[1] = (c >> 3) & 3;
+            quints[0] = c & 7;
+        }
+    }
+
+    // Symbols are `trit_or_quint << bits | bits`.
+    static uint32_t unquantize_endpoint(const SequenceRange& range, uint32_t symbol) noexcept {
+        const uint32_t low_bits = symbol & ((1U << range.bits) - 1);
+        if (!range.is_trit && !range.is_quint) {
+            // Bit replication to 8 bits.
+            uint32_t result = 0;
+            for (int shift = 8 - static_cast<int>(range.bits); shift > -static_cast<int>(range.bits); shift -= static_cast<int>(range.bits)) {
+                result |= shift >= 0 ? low_bits << shift : low_bits >> -shift;
+            }
+            return result & 0xFF;
+        }
+
+        const char* pattern = range.is_trit ? TRIT_ENDPOINT_PATTERNS[range.bits - 1] : QUINT_ENDPOINT_PATTERNS[range.bits - 1];
+        const uint32_t scale = range.is_trit ? TRIT_ENDPOINT_SCALES[range.bits - 1] : QUINT_ENDPOINT_SCALES[range.bits - 1];
+
+        uint32_t b = 0;
+        for (size_t i = 0; i < 9; i++) {
+            if (pattern[i] != '0') {
+                b |= get_bit(low_bits, static_cast<uint32_t>(pattern[i] - 'a')) << (8 - i);
+            }
+        }
+
+        const uint32_t a = (low_bits & 1) != 0 ? 0x1FF : 0;
+        uint32_t t = (symbol >> range.bits) * scale + b;
+        t ^= a;
+        return (a & 0x80) | (t >> 2);
+    }
+
+    uint8_t trit_encodings[243];
+    uint8_t quint_encodings[125];
+    uint8_t endpoint_values[SEQUENCE_RANGE_COUNT][256] = {};
+    uint8_t nearest_endpoints[SEQUENCE_RANGE_COUNT][256] = {};
+};
+
+static const AstcTables& get_tables() noexcept {
+    static const AstcTables tables;
+    return tables;
+}
+
+static size_t get_sequence_bit_count(const SequenceRange& range, size_t count) noexcept {
+    size_t result = count * range.bits;
+    if (range.is_trit) {
+        result += (count * 8 + 4) / 5;
+    } else if (range.is_quint) {
+        result += (count * 7 + 2) / 3;
+    }
+    return result;
+}
+
+// Decoders pick the largest endpoint range that fits in the bits left after the weights, so must the encoder.
+static size_t get_endpoint_range(const BlockLayout& layout) noexcept {
+    const size_t available_bits = 128 - ASTC_ENDPOINT_OFFSET - 16 * layout.weight_bits;
+    const size_t value_count = std::max<size_t>(layout.channel_count, 1) * 2;
+    for (size_t range = SEQUENCE_RANGE_COUNT - 1; range > MIN_ENDPOINT_RANGE; range--) {
+        if (get_sequence_bit_count(SEQUENCE_RANGES[range], value_count) <= available_bits) {
+            return range;
+        }
+    }
+    return MIN_ENDPOINT_RANGE;
+}
+
+static uint32_t unquantize_weight(uint32_t weight, uint32_t bits) noexcept {
+    uint32_t result = 0;
+    for (int shift = 6 - static_cast<int>(bits); shift > -static_cast<int>(bits); shift -= static_cast<int>(bits)) {
+        result |= shift >= 0 ? weight << shift : weight >> -shift;
+    }
+    result &= 0x3F;
+    return result > 32 ? result + 1 : result;
+}
+
+// Interpolation of the decoder for 8-bit output: endpoints are expanded to 16 bits and the result is truncated.
+static uint32_t interpolate(uint32_t endpoint0, uint32_t endpoint1, uint32_t weight) noexcept {
+    return ((endpoint0 * 257 * (64 - weight) + endpoint1 * 257 * weight + 32) >> 6) >> 8;
+}
+
+static void put_bits(uint8_t* block, size_t& position, uint32_t value, size_t bit_count) noexcept {
+    for (size_t i = 0; i < bit_count; i++) {
+        block[(position + i) / 8] |= static_cast<uint8_t>(((value >> i) & 1) << ((position + i) % 8));
+    }
+    position += bit_count;
+}
+
+static void put_sequence(uint8_t* block, size_t& position, const SequenceRange& range, const uint32_t* symbols, size_t count) noexcept {
+    const AstcTables& tables = get_tables();
+    const size_t end = position + get_sequence_bit_count(range, count);
+    const uint32_t mask = (1U << range.bits) - 1;
+
+    if (range.is_trit) {
+        // Five values share eight bits of trits interleaved with their bits.
+        static const size_t TRIT_BITS[5] = { 2, 2, 1, 2, 1 };
+        for (size_t group = 0; group < count; group += 5) {
+            uint32_t trits[5] = {};
+            for (size_t i = 0; i < 5 && group + i < count; i++) {
+                trits[i] = symbols[group + i] >> range.bits;
+            }
+            uint32_t t = tables.trit_encodings[(((trits[4] * 3 + trits[3]) * 3 + trits[2]) * 3 + trits[1]) * 3 + trits[0]];
+            for (size_t i = 0; i < 5; i++) {
+                put_bits(block, position, group + i < count ? symbols[group + i] & mask : 0, range.bits);
+                put_bits(block, position, t, TRIT_BITS[i]);
+                t >>= TRIT_BITS[i];
+            }
+        }
+    } else if (range.is_quint) {
+        // Three values share seven bits of quints interleaved with their bits.
+        static const size_t QUINT_BITS[3] = { 3, 2, 2 };
+        for (size_t group = 0; group < count; group += 3) {
+            uint32_t quints[3] = {};
+            for (size_t i = 0; i < 3 && group + i < count; i++) {
+                quints[i] = symbols[group + i] >> range.bits;
+            }
+            uint32_t q = tables.quint_encodings[(quints[2] * 5 + quints[1]) * 5 + quints[0]];
+            for (size_t i = 0; i < 3; i++) {
+                put_bits(block, position, group + i < count ? symbols[group + i] & mask : 0, range.bits);
+                put_bits(block, position, q, QUINT_BITS[i]);
+                q >>= QUINT_BITS[i];
+            }
+        }
+    } else {
+        for (size_t i = 0; i < count; i++) {
+            put_bits(block, position, symbols[i], range.bits);
+        }
+    }
+
+    // Padding values are zeros, so the bits past the end of the sequence are zeros too and can be dropped.
+    for (size_t i = end; i < position; i++) {
+        block[i / 8] &= static_cast<uint8_t>(~(1U << (i % 8)));
+    }
+    position = end;
+}
+
+// Void extent block, which stores a single 16-bit color and no extent.
+static void encode_constant_block(const uint8_t* color, uint8_t* block) noexcept {
+    static const uint8_t HEADER[8] = { 0xFC, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF };
+    std::memcpy(block, HEADER, sizeof(HEADER));
+    for (size_t channel = 0; channel < 4; channel++) {
+        block[8 + channel * 2] = color[channel];
+        block[8 + channel * 2 + 1] = color[channel];
+    }
+}
+
+struct BlockCandidate final {
+    uint32_t endpoints[2][4];
+    uint32_t weights[16];
+    float error;
+};
+
+// Picks the best weight of every texel for the endpoints of `candidate` and updates its error.
+static void select_weights(const float (&texels)[16][4], const BlockLayout& layout, const uint32_t (&values)[2][4], BlockCandidate& candidate) noexcept {
+    const uint32_t weight_levels = 1U << layout.weight_bits;
+    candidate.error = 0.f;
+    for (size_t texel = 0; texel < 16; texel++) {
+        float best_error = std::numeric_limits<float>::max();
+        for (uint32_t weight = 0; weight < weight_levels; weight++) {
+            const uint32_t unquantized_weight = unquantize_weight(weight, layout.weight_bits);
+            float error = 0.f;
+            for (size_t channel = 0; channel < layout.channel_count; channel++) {
+                const float difference = static_cast<float>(interpolate(values[0][channel], values[1][channel], unquantized_weight)) - texels[texel][channel];
+                error += difference * difference;
+            }
+            if (error < best_error) {
+                best_error = error;
+                candidate.weights[texel] = weight;
+            }
+        }
+        candidate.error += best_error;
+    }
+}
+
+// Fits endpoints along the principal axis of the texels, then alternates between picking weights and solving for the
+// endpoints with least squares. Channels past `channel_count` aren't stored by the layout.
+static BlockCandidate fit_block(const float (&texels)[16][4], const BlockLayout& layout, EncoderQuality quality) noexcept {
+    const AstcTables& tables = get_tables();
+    const size_t range = get_endpoint_range(layout);
+    const size_t channel_count = layout.channel_count;
+
+    float mean[4] = {};
+    for (size_t texel = 0; texel < 16; texel++) {
+        for (size_t channel = 0; channel < channel_count; channel++) {
+            mean[channel] += texels[texel][channel] / 16.f;
+        }
+    }
+
+    float covariance[4][4] = {};
+    for (size_t texel = 0; texel < 16; texel++) {
+        for (size_t i = 0; i < channel_count; i++) {
+            for (size_t j = 0; j < channel_count; j++) {
+                covariance[i][j] += (texels[texel][i] - mean[i]) * (texels[texel][j] - mean[j]);
+            }
+        }
+    }
+
+    float axis[4] = { 1.f, 1.f, 1.f, 1.f };
+    for (size_t iteration = 0; iteration < 8; iteration++) {
+        float next[4] = {};
+        float length = 0.f;
+        for (size_t i = 0; i < channel_count; i++) {
+            for (size_t j = 0; j < channel_count; j++) {
+                next[i] += covariance[i][j] * axis[j];
+            }
+            length = std::max(length, std::abs(next[i]));
+        }
+        if (length < 1e-6f) {
+            break;
+        }
+        for (size_t i = 0; i < channel_count; i++) {
+            axis[i] = next[i] / length;
+        }
+    }
+
+    float low = std::numeric_limits<float>::max();
+    float high = std::numeric_limits<float>::lowest();
+    for (size_t texel = 0; texel < 16; texel++) {
+        float projection = 0.f;
+        for (size_t channel = 0; channel < channel_count; channel++) {
+            projection += (texels[texel][channel] - mean[channel]) * axis[channel];
+        }
+        low = std::min(low, projection);
+        high = std::max(high, projection);
+    }
+
+    float axis_length = 0.f;
+    for (size_t channel = 0; channel < channel_count; channel++) {
+        axis_length += axis[channel] * axis[channel];
+    }
+    axis_length = std::max(axis_length, 1e-6f);
+
+    float endpoints[2][4];
+    for (size_t channel = 0; channel < channel_count; channel++) {
+        endpoints[0][channel] = mean[channel] + axis[channel] * low / axis_length;
+        endpoints[1][channel] = mean[channel] + axis[channel] * high / axis_length;
+    }
+
+    const size_t iteration_count = static_cast<size_t>(quality) + 2;
+
+    BlockCandidate best;
+    best.error = std::numeric_limits<float>::max();
+
+    for (size_t iteration = 0; iteration < iteration_count; iteration++) {
+        BlockCandidate candidate;
+        uint32_t values[2][4];
+        for (size_t endpoint = 0; endpoint < 2; endpoint++) {
+            for (size_t channel = 0; channel < channel_count; channel++) {
+                const float value = std::min(std::max(endpoints[endpoint][channel], 0.f), 255.f);
+                candidate.endpoints[endpoint][channel] = tables.nearest_endpoints[range][static_cast<uint32_t>(value + 0.5f)];
+                values[endpoint][channel] = tables.endpoint_values[range][candidate.endpoints[endpoint][channel]];
+            }
+        }
+
+        // Decoders swap the RGB endpoints and contract blue when the second endpoint is darker than the first one.
+        if (channel_count >= 3 && values[1][0] + values[1][1] + values[1][2] < values[0][0] + values[0][1] + values[0][2]) {
+            for (size_t channel = 0; channel < channel_count; channel++) {
+                std::swap(candidate.endpoints[0][channel], candidate.endpoints[1][channel]);
+                std::swap(values[0][channel], values[1][channel]);
+            }
+        }
+
+        select_weights(texels, layout, values, candidate);
+        if (candidate.error < best.error) {
+            best = candidate;
+        }
+        if (candidate.error == 0.f || iteration + 1 == iteration_count) {
+            break;
+        }
+
+        float a = 0.f;
+        float b = 0.f;
+        float c = 0.f;
+        float x0[4] = {};
+        float x1[4] = {};
+        for (size_t texel = 0; texel < 16; texel++) {
+            const float factor = static_cast<float>(unquantize_weight(candidate.weights[texel], layout.weight_bits)) / 64.f;
+            a += (1.f - factor) * (1.f - factor);
+            b += factor * (1.f - factor);
+            c += factor * factor;
+            for (size_t channel = 0; channel < channel_count; channel++) {
+                x0[channel] += (1.f - factor) * texels[texel][channel];
+                x1[channel] += factor * texels[texel][channel];
+            }
+        }
+
+        const float determinant = a * c - b * b;
+        if (std::abs(determinant) < 1e-6f) {
+            break;
+        }
+        for (size_t channel = 0; channel < channel_count; channel++) {
+            endpoints[0][channel] = (c * x0[channel] - b * x1[channel]) / determinant;
+            endpoints[1][channel] = (a * x1[channel] - b * x0[channel]) / determinant;
+        }
+    }
+
+    return best;
+}
+
+static void pack_block(const BlockLayout& layout, const BlockCandidate& candidate, uint8_t* block) noexcept {
+    std::memset(block, 0, 16);
+
+    size_t position = 0;
+    put_bits(block, position, layout.block_mode, 11);
+    put_bits(block, position, 0, 2);
+    put_bits(block, position, layout.endpoint_mode, 4);
+
+    // Endpoint values go channel by channel, the first endpoint before the second one.
+    uint32_t symbols[8];
+    for (size_t channel = 0; channel < layout.channel_count; channel++) {
+        symbols[channel * 2] = candidate.endpoints[0][channel];
+        symbols[channel * 2 + 1] = candidate.endpoints[1][channel];
+    }
+    put_sequence(block, position, SEQUENCE_RANGES[get_endpoint_range(layout)], symbols, layout.channel_count * 2);
+
+    // Weights are stored bit reversed from the top of the block.
+    uint8_t weights[16] = {};
+    size_t weight_position = 0;
+    for (size_t texel = 0; texel < 16; texel++) {
+        put_bits(weights, weight_position, candidate.weights[texel], layout.weight_bits);
+    }
+    for (size_t i = 0; i < weight_position; i++) {
+        const uint32_t bit = (weights[i / 8] >> (i % 8)) & 1;
+        block[(127 - i) / 8] |= static_cast<uint8_t>(bit << ((127 - i) % 8));
+    }
+}
+
+void encode_astc_block(const uint8_t* rgba, EncoderQuality quality, uint8_t* block) noexcept {
+    bool is_constant = true;
+    for (size_t i = 4; i < 64; i++) {
+        is_constant &= rgba[i] == rgba[i % 4];
+    }
+    if (is_constant) {
+        encode_constant_block(rgba, block);
+        return;
+    }
+
+    float texels[16][4];
+    bool is_opaque = true;
+    for (size_t texel = 0; texel < 16; texel++) {
+        for (size_t channel = 0; channel < 4; channel++) {
+            texels[texel][channel] = static_cast<float>(rgba[texel * 4 + channel]);
+        }
+        is_opaque &= rgba[texel * 4 + 3] == 255;
+    }
+
+    const BlockLayout& fine_layout = is_opaque ? RGB_FINE_LAYOUT : RGBA_FINE_LAYOUT;
+    const BlockLayout& coarse_layout = is_opaque ? RGB_COARSE_LAYOUT : RGBA_COARSE_LAYOUT;
+
+    const BlockLayout* best_layout = &fine_layout;
+    BlockCandidate best = fit_block(texels, fine_layout, quality);
+    if (quality != EncoderQuality::FASTEST && best.error > 0.f) {
+        const BlockCandidate candidate = fit_block(texels, coarse_layout, quality);
+        if (candidate.error < best.error) {
+            best = candidate;
+            best_layout = &coarse_layout;
+        }
+    }
+
+    pack_block(*best_layout, best, block);
+}
+
+void encode_astc_luminance_block(const uint8_t* luminance, EncoderQuality quality, uint8_t* block) noexcept {
+    if (std::all_of(luminance, luminance + 16, [&](uint8_t value) { return value == luminance[0]; })) {
+        const uint8_t color[4] = { luminance[0], luminance[0], luminance[0], 255 };
+        encode_constant_block(color, block);
+        return;
+    }
+
+    float texels[16][4] = {};
+    for (size_t texel = 0; texel < 16; texel++) {
+        texels[texel][0] = static_cast<float>(luminance[texel]);
+    }
+
+    pack_block(LUMINANCE_LAYOUT, fit_block(texels, LUMINANCE_LAYOUT, quality), block);
+}
+
+static void encode_block_rows(const uint8_t* input, bool is_r8, size_t width, size_t height, size_t row_begin, size_t row_end, EncoderQuality quality, uint8_t* output,
+                              const uint8_t* previous, const uint8_t* is_changed, const BlockReuse* warm_start) noexcept {
+    const size_t blocks_x = (width + 3) / 4;
+
+    for (size_t block_y = row_begin; block_y < row_end; block_y++) {
+        for (size_t block_x = 0; block_x < blocks_x; block_x++) {
+            const size_t index = block_y * blocks_x + block_x;
+            if (is_changed != nullptr && is_changed[index] == 0) {
+                std::memcpy(output + index * 16, previous + index * 16, 16);
+                continue;
+            }
+
+            uint8_t pixels[16 * 4];
+            for (size_t y = 0; y < 4; y++) {
+                for (size_t x = 0; x < 4; x++) {
+                    const size_t pixel_x = std::min(block_x * 4 + x, width - 1);
+                    const size_t pixel_y = std::min(block_y * 4 + y, height - 1);
+                    if (is_r8) {
+                        pixels[y * 4 + x] = input[pixel_y * width + pixel_x];
+                    } else {
+                        const uint8_t* source = input + (pixel_y * width + pixel_x) * 4;
+                        uint8_t* destination = pixels + (y * 4 + x) * 4;
+                        destination[0] = source[2];
+                        destination[1] = source[1];
+                        destination[2] = source[0];
+                        destination[3] = source[3];
+                    }
+                }
+            }
+
+            if (warm_start != nullptr && keep_previous_block(*warm_start, is_r8 ? ReusedBlockFormat::ASTC_4X4_LUMINANCE : ReusedBlockFormat::ASTC_4X4, previous + index * 16, pixels)) {
+                std::memcpy(output + index * 16, previous + index * 16, 16);
+                continue;
+            }
+
+            uint8_t* block = output + (block_y * blocks_x + block_x) * 16;
+            if (is_r8) {
+                encode_astc_luminance_block(pixels, quality, block);
+            } else {
+                encode_astc_block(pixels, quality, block);
+            }
+        }
+    }
+}
+
+bool encode_astc(std::vector<char>& dds, const MipQualities& qualities, ThreadPool& pool, std::ostream& log, const BlockReuse* reuse) {
+    Dds10Header header;
+    if (!read_dds10_header(dds.data(), dds.size(), header) || (header.dxgi_format != DXGI_FORMAT_B8G8R8A8_UNORM && header.dxgi_format != DXGI_FORMAT_R8_UNORM)) {
+        log << "\rTexture compiler error. ASTC encoder requires a B8G8R8A8 or R8 DDS texture with the DX10 header." << std::endl;
+        return false;
+    }
+
+    if (header.dimension != DDS10_DIMENSION_TEXTURE_2D || header.misc_flags != 0) {
+        log << "\rTexture compiler error. ASTC encoder supports only 2D textures and texture arrays." << std::endl;
+        return false;
+    }
+
+    const bool is_r8 = header.dxgi_format == DXGI_FORMAT_R8_UNORM;
+    const TextureFormatSize* format_size = find_texture_format_size(DXGI_FORMAT_UNKNOWN, ASTC_4X4_VK_FORMAT);
+    const EncodedLayout layout = get_encoded_layout(header, is_r8 ? 1 : 4, format_size->block_size);
+    if (layout.input_size != dds.size()) {
+        log << "\rTexture compiler error. DDS texture size doesn't match its mip levels." << std::endl;
+        return false;
+    }
+
+    reuse = match_block_reuse(reuse, layout);
+
+    // Build the tables before the tasks race for them.
+    get_tables();
+
+    std::vector<char> astc(layout.output_size);
+    std::memcpy(astc.data(), dds.data(), DDS10_HEADER_SIZE);
+    std::memcpy(astc.data() + 128, &DXGI_FORMAT_UNKNOWN, sizeof(DXGI_FORMAT_UNKNOWN));
+
+    TaskGroup group;
+
+    for (const EncodedLevel& level : layout.levels) {
+        const size_t level_width = level.input.width;
+        const size_t level_height = level.input.height;
+        const size_t blocks_y = (level_height + 3) / 4;
+
+        const uint8_t* input = reinterpret_cast<const uint8_t*>(dds.data() + level.input.offset);
+        uint8_t* output = reinterpret_cast<uint8_t*>(astc.data() + level.output.offset);
+        const uint8_t* previous = reuse != nullptr ? reinterpret_cast<const uint8_t*>(reuse->previous.data() + level.output.offset) : nullptr;
+        const uint8_t* is_changed = reuse != nullptr ? reuse->is_changed.data() + level.first_block : nullptr;
+        const BlockReuse* warm_start = reuse != nullptr && reuse->max_error > 0.f ? reuse : nullptr;
+        const EncoderQuality quality = get_mip_quality(qualities, level.input.mip_level);
+
+        for (size_t row = 0; row < blocks_y; row += ASTC_TASK_BLOCK_ROWS) {
+            const size_t row_end = std::min(row + ASTC_TASK_BLOCK_ROWS, blocks_y);
+            pool.push(group, [=] {
+                encode_block_rows(input, is_r8, level_width, level_height, row, row_end, quality, output, previous, is_changed, warm_start);
+            });
+        }
+    }
+
+    pool.wait(group);
+
+    dds = std::move(astc);
+    return true;
+}
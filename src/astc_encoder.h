@@ -0,0 +1,29 @@
+#pragma once
+
+#include "encoder_quality.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+struct BlockReuse;
+struct ThreadPool;
+
+// Vulkan format of the blocks, DDS has no formats for ASTC.
+static constexpr uint32_t ASTC_4X4_VK_FORMAT = 157;
+
+// Encodes a single 4x4 block of RGBA8 pixels, rows from the top, into 16 bytes of LDR ASTC 4x4. Blocks have a single
+// partition and a single plane of weights. Opaque blocks store RGB endpoints, which leaves more bits for them, and
+// blocks with alpha try both a finer weight grid with coarser endpoints and the other way around.
+void encode_astc_block(const uint8_t* rgba, EncoderQuality quality, uint8_t* block) noexcept;
+
+// Encodes a single 4x4 block of 8-bit values, rows from the top, into 16 bytes of LDR ASTC 4x4 with luminance
+// endpoints, decoded as gray.
+void encode_astc_luminance_block(const uint8_t* luminance, EncoderQuality quality, uint8_t* block) noexcept;
+
+// Replaces the B8G8R8A8 or R8 mip levels of a 2D DDS texture with the DX10 header with ASTC 4x4 blocks. R8 levels
+// are encoded as luminance. The DXGI format becomes `DXGI_FORMAT_UNKNOWN`, so the texture must be converted to KTX2
+// with `ASTC_4X4_VK_FORMAT`. Block rows are encoded on the thread pool, `qualities` are the search effort of every mip
+// level.
+bool encode_astc(std::vector<char>& dds, const MipQualities& qualities, ThreadPool& pool, std::ostream& log, const BlockReuse* reuse = nullptr);
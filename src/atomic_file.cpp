@@ -0,0 +1,29 @@
+#include "atomic_file.h"
+
+#include <atomic>
+#include <bx/platform.h>
+#include <filesystem>
+#include <system_error>
+
+#if BX_PLATFORM_WINDOWS
+#include <process.h>
+#define getpid _getpid
+#else
+#include <unistd.h>
+#endif
+
+std::string get_temporary_path(const std::string& path) {
+    static std::atomic<size_t> temporary_counter { 0 };
+    return path + "." + std::to_string(getpid()) + "." + std::to_string(temporary_counter++) + ".tmp";
+}
+
+bool replace_file(const std::string& temporary_path, const std::string& path) noexcept {
+    // Unlike `std::rename`, filesystem rename replaces an existing file on every platform.
+    std::error_code error;
+    std::filesystem::rename(temporary_path, path, error);
+    if (error) {
+        std::filesystem::remove(temporary_path, error);
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,12 @@
+#pragma once
+
+#include <string>
+
+// Outputs are written to a temporary file in the same directory and renamed over the destination once complete, so a
+// failed or interrupted job never leaves a truncated file that looks up to date to an incremental build.
+
+// Unique path next to `path`, so that compiler processes and threads writing the same output never share it.
+std::string get_temporary_path(const std::string& path);
+
+// Renames the temporary file over `path`, replacing an existing file. The temporary file is removed on failure.
+bool replace_file(const std::string& temporary_path, const std::string& path) noexcept;
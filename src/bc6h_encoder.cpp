@@ -0,0 +1,279 @@
+#include "bc6h_encoder.h"
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define BC6H_ENCODER_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#define BC6H_ENCODER_NEON
+#include <arm_neon.h>
+#endif
+
+static const uint32_t WEIGHTS[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+static uint16_t float_to_half(float value) noexcept {
+    if (!(value > 0.f)) {
+        return 0;
+    }
+    if (value >= 65520.f) {
+        // Largest half float, larger values would round to infinity.
+        return 0x7BFF;
+    }
+
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+
+    const uint32_t exponent = bits >> 23;
+    if (exponent < 113) {
+        // Subnormal half float, counted in units of 2^-24.
+        const uint32_t shift = 126 - exponent;
+        if (shift > 24) {
+            return 0;
+        }
+        const uint32_t mantissa = (bits & 0x7FFFFF) | 0x800000;
+        uint32_t result = mantissa >> shift;
+        const uint32_t remainder = mantissa & ((1U << shift) - 1);
+        const uint32_t half = 1U << (shift - 1);
+        if (remainder > half || (remainder == half && (result & 1) != 0)) {
+            result++;
+        }
+        return static_cast<uint16_t>(result);
+    }
+
+    uint32_t result = ((exponent - 112) << 10) | ((bits >> 13) & 0x3FF);
+    const uint32_t remainder = bits & 0x1FFF;
+    if (remainder > 0x1000 || (remainder == 0x1000 && (result & 1) != 0)) {
+        result++;
+    }
+    return static_cast<uint16_t>(result);
+}
+
+static float half_to_float(uint16_t value) noexcept {
+    const uint32_t sign = static_cast<uint32_t>(value & 0x8000) << 16;
+    const uint32_t exponent = (value >> 10) & 0x1F;
+    uint32_t mantissa = value & 0x3FF;
+
+    uint32_t bits;
+    if (exponent == 0) {
+        if (mantissa == 0) {
+            bits = sign;
+        } else {
+            uint32_t shifted_exponent = 113;
+            while ((mantissa & 0x400) == 0) {
+                mantissa <<= 1;
+                shifted_exponent--;
+            }
+            bits = sign | (shifted_exponent << 23) | ((mantissa & 0x3FF) << 13);
+        }
+    } else if (exponent == 31) {
+        bits = sign | 0x7F800000 | (mantissa << 13);
+    } else {
+        bits = sign | ((exponent + 112) << 23) | (mantissa << 13);
+    }
+
+    float result;
+    std::memcpy(&result, &bits, sizeof(result));
+    return result;
+}
+
+void convert_rgba32f_to_rgba16f(const float* input, size_t count, uint16_t* output) noexcept {
+    size_t i = 0;
+
+    // Values are clamped to [0, 65504] first, NaN included, so only the rounding of `float_to_half` is left.
+#if defined(BC6H_ENCODER_SSE2)
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 largest = _mm_set1_ps(65504.f);
+
+    // Adding 0.5 to a subnormal half float shifts its mantissa into the integer bits, rounded by the FPU.
+    const __m128 subnormal_magic = _mm_set1_ps(0.5f);
+    const __m128i smallest_normal = _mm_set1_epi32(0x38800000);
+    const __m128i exponent_bias = _mm_set1_epi32(static_cast<int>(0xC8000FFFU));
+    const __m128i one = _mm_set1_epi32(1);
+    const auto convert = [&](__m128 value) {
+        value = _mm_min_ps(_mm_max_ps(value, zero), largest);
+        const __m128i bits = _mm_castps_si128(value);
+        const __m128i odd = _mm_and_si128(_mm_srli_epi32(bits, 13), one);
+        const __m128i normal = _mm_srli_epi32(_mm_add_epi32(_mm_add_epi32(bits, exponent_bias), odd), 13);
+        const __m128i subnormal = _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(value, subnormal_magic)), _mm_castps_si128(subnormal_magic));
+        const __m128i is_subnormal = _mm_cmplt_epi32(bits, smallest_normal);
+        return _mm_or_si128(_mm_and_si128(is_subnormal, subnormal), _mm_andnot_si128(is_subnormal, normal));
+    };
+    for (; i + 8 <= count; i += 8) {
+        const __m128i low = convert(_mm_loadu_ps(input + i));
+        const __m128i high = convert(_mm_loadu_ps(input + i + 4));
+
+        // Results are at most 0x7BFF, so signed saturation never kicks in.
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), _mm_packs_epi32(low, high));
+    }
+#elif defined(BC6H_ENCODER_NEON)
+    const float32x4_t zero = vdupq_n_f32(0.f);
+    const float32x4_t largest = vdupq_n_f32(65504.f);
+    for (; i + 4 <= count; i += 4) {
+        // `vmaxnmq_f32` returns the number when the other operand is NaN.
+        const float32x4_t value = vminq_f32(vmaxnmq_f32(vld1q_f32(input + i), zero), largest);
+        vst1_u16(output + i, vreinterpret_u16_f16(vcvt_f16_f32(value)));
+    }
+#endif
+
+    for (; i < count; i++) {
+        output[i] = float_to_half(input[i]);
+    }
+}
+
+void convert_rgba16f_to_rgba32f(const uint16_t* input, size_t count, float* output) noexcept {
+    for (size_t i = 0; i < count; i++) {
+        output[i] = half_to_float(input[i]);
+    }
+}
+
+void downsample_image_rgba16f(const uint16_t* input, size_t width, size_t height, uint16_t* output) noexcept {
+    const size_t output_width = std::max<size_t>(width / 2, 1);
+    const size_t output_height = std::max<size_t>(height / 2, 1);
+    for (size_t y = 0; y < output_height; y++) {
+        const size_t y0 = std::min(y * 2, height - 1);
+        const size_t y1 = std::min(y * 2 + 1, height - 1);
+        for (size_t x = 0; x < output_width; x++) {
+            const size_t x0 = std::min(x * 2, width - 1);
+            const size_t x1 = std::min(x * 2 + 1, width - 1);
+            for (size_t channel = 0; channel < 4; channel++) {
+                const float sum = half_to_float(input[(y0 * width + x0) * 4 + channel]) + half_to_float(input[(y0 * width + x1) * 4 + channel]) +
+                                  half_to_float(input[(y1 * width + x0) * 4 + channel]) + half_to_float(input[(y1 * width + x1) * 4 + channel]);
+                output[(y * output_width + x) * 4 + channel] = float_to_half(sum * 0.25f);
+            }
+        }
+    }
+}
+
+// Half float bits of the positive part of a value, which is what unsigned BC6H interpolates.
+static uint32_t get_unsigned_half(uint16_t value) noexcept {
+    return (value & 0x8000) != 0 ? 0 : std::min<uint32_t>(value, 0x7BFF);
+}
+
+static uint32_t unquantize(uint32_t endpoint) noexcept {
+    if (endpoint == 0) {
+        return 0;
+    }
+    if (endpoint == 1023) {
+        return 0xFFFF;
+    }
+    return endpoint * 64 + 32;
+}
+
+static void put_bits(uint32_t* block, uint32_t& position, uint32_t value, uint32_t bit_count) noexcept {
+    for (uint32_t i = 0; i < bit_count; i++) {
+        block[(position + i) / 32] |= ((value >> i) & 1) << ((position + i) % 32);
+    }
+    position += bit_count;
+}
+
+// Encodes 16 texels of half float bits in rows from the top, keeps `bc6h_shader` in sync.
+static void encode_block(const uint32_t (&texels)[16][3], uint32_t* block) noexcept {
+    uint32_t low[3] = { 0x7BFF, 0x7BFF, 0x7BFF };
+    uint32_t high[3] = { 0, 0, 0 };
+    for (size_t texel = 0; texel < 16; texel++) {
+        for (size_t channel = 0; channel < 3; channel++) {
+            low[channel] = std::min(low[channel], texels[texel][channel]);
+            high[channel] = std::max(high[channel], texels[texel][channel]);
+        }
+    }
+
+    float best_error = -1.f;
+    uint32_t best_endpoints[2][3] = {};
+    uint32_t best_indices[16] = {};
+
+    // The line through the texels goes along one of the four diagonals of the bounding box.
+    for (uint32_t diagonal = 0; diagonal < 4; diagonal++) {
+        uint32_t endpoints[2][3];
+        for (size_t channel = 0; channel < 3; channel++) {
+            const bool is_swapped = (channel == 1 && (diagonal & 1) != 0) || (channel == 2 && (diagonal & 2) != 0);
+            endpoints[0][channel] = std::min((is_swapped ? high : low)[channel] / 31, 1023U);
+            endpoints[1][channel] = std::min((is_swapped ? low : high)[channel] / 31, 1023U);
+        }
+
+        uint32_t palette[16][3];
+        for (size_t i = 0; i < 16; i++) {
+            for (size_t channel = 0; channel < 3; channel++) {
+                const uint32_t value = ((64 - WEIGHTS[i]) * unquantize(endpoints[0][channel]) + WEIGHTS[i] * unquantize(endpoints[1][channel]) + 32) >> 6;
+                palette[i][channel] = (value * 31) >> 6;
+            }
+        }
+
+        float error = 0.f;
+        uint32_t indices[16];
+        for (size_t texel = 0; texel < 16; texel++) {
+            float best_texel_error = -1.f;
+            for (uint32_t i = 0; i < 16; i++) {
+                float texel_error = 0.f;
+                for (size_t channel = 0; channel < 3; channel++) {
+                    const float difference = static_cast<float>(palette[i][channel]) - static_cast<float>(texels[texel][channel]);
+                    texel_error += difference * difference;
+                }
+                if (best_texel_error < 0.f || texel_error < best_texel_error) {
+                    best_texel_error = texel_error;
+                    indices[texel] = i;
+                }
+            }
+            error += best_texel_error;
+        }
+
+        if (best_error < 0.f || error < best_error) {
+            best_error = error;
+            std::memcpy(best_endpoints, endpoints, sizeof(endpoints));
+            std::memcpy(best_indices, indices, sizeof(indices));
+        }
+    }
+
+    // The first index is stored without its top bit.
+    if (best_indices[0] >= 8) {
+        for (size_t channel = 0; channel < 3; channel++) {
+            std::swap(best_endpoints[0][channel], best_endpoints[1][channel]);
+        }
+        for (size_t texel = 0; texel < 16; texel++) {
+            best_indices[texel] = 15 - best_indices[texel];
+        }
+    }
+
+    block[0] = block[1] = block[2] = block[3] = 0;
+
+    uint32_t position = 0;
+    put_bits(block, position, 0x03, 5);
+    for (size_t endpoint = 0; endpoint < 2; endpoint++) {
+        for (size_t channel = 0; channel < 3; channel++) {
+            put_bits(block, position, best_endpoints[endpoint][channel], 10);
+        }
+    }
+    put_bits(block, position, best_indices[0], 3);
+    for (size_t texel = 1; texel < 16; texel++) {
+        put_bits(block, position, best_indices[texel], 4);
+    }
+}
+
+void encode_bc6h_rows(const uint16_t* input, size_t size, size_t row_begin, size_t row_end, uint8_t* output) noexcept {
+    const size_t blocks = (size + 3) / 4;
+
+    for (size_t block_y = row_begin; block_y < row_end; block_y++) {
+        for (size_t block_x = 0; block_x < blocks; block_x++) {
+            uint32_t texels[16][3];
+            for (size_t y = 0; y < 4; y++) {
+                for (size_t x = 0; x < 4; x++) {
+                    const size_t texel_x = std::min(block_x * 4 + x, size - 1);
+                    const size_t texel_y = std::min(block_y * 4 + y, size - 1);
+                    for (size_t channel = 0; channel < 3; channel++) {
+                        texels[y * 4 + x][channel] = get_unsigned_half(input[(texel_y * size + texel_x) * 4 + channel]);
+                    }
+                }
+            }
+
+            uint32_t block[4];
+            encode_block(texels, block);
+
+            // Blocks are little endian 128-bit numbers.
+            uint8_t* destination = output + (block_y * blocks + block_x) * 16;
+            for (size_t i = 0; i < 16; i++) {
+                destination[i] = static_cast<uint8_t>(block[i / 4] >> (i % 4 * 8));
+            }
+        }
+    }
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Fast unsigned BC6H encoder of cube map faces, the CPU version of `bc6h_shader`. Blocks use
+// mode 11 only, a single subset with 10-bit endpoints and 4-bit indices, fitted to one of the diagonals of the block's
+// bounding box in half float bit space, which is close to logarithmic. That's what real time GPU encoders do: it's
+// orders of magnitude faster than nvtt, but blocks with several unrelated colors lose detail.
+//
+// Images are interleaved RGBA half floats, the alpha channel is ignored.
+
+// DXGI format of the blocks, nvtt writes signed BC6H instead.
+static constexpr uint32_t BC6H_DXGI_FORMAT = 95;
+
+// Converts floats to half floats rounding to the nearest even, negative and NaN values become zero and values above
+// the half float range become the largest half float.
+void convert_rgba32f_to_rgba16f(const float* input, size_t count, uint16_t* output) noexcept;
+
+// Converts half floats to floats, every half float is exactly representable.
+void convert_rgba16f_to_rgba32f(const uint16_t* input, size_t count, float* output) noexcept;
+
+// Next mip level of a `width` x `height` image, half as wide and half as tall. Every texel is the average of a 2x2 quad
+// of the input clamped to its edges, so odd sizes repeat the last row and column.
+void downsample_image_rgba16f(const uint16_t* input, size_t width, size_t height, uint16_t* output) noexcept;
+
+// Encodes block rows [`row_begin`, `row_end`) of a `size` x `size` image, 16 bytes per block. Texels past the edges of
+// images smaller than a block repeat the last row and column.
+void encode_bc6h_rows(const uint16_t* input, size_t size, size_t row_begin, size_t row_end, uint8_t* output) noexcept;
@@ -0,0 +1,1467 @@
+#include <cstdint>
+
+static const uint8_t bc6h_shader_compute_glsl[5314] =
+{
+	0x43, 0x53, 0x48, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x14, // CSH.............
+	0x00, 0x00, 0x23, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x34, 0x33, 0x30, 0x0a, 0x76, // ..#version 430.v
+	0x65, 0x63, 0x33, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x4d, 0x75, 0x6c, 0x28, 0x76, 0x65, 0x63, 0x33, // ec3 instMul(vec3
+	0x20, 0x5f, 0x76, 0x65, 0x63, 0x2c, 0x20, 0x6d, 0x61, 0x74, 0x33, 0x20, 0x5f, 0x6d, 0x74, 0x78, //  _vec, mat3 _mtx
+	0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x28, 0x20, 0x28, 0x5f, 0x76, // ) { return ( (_v
+	0x65, 0x63, 0x29, 0x20, 0x2a, 0x20, 0x28, 0x5f, 0x6d, 0x74, 0x78, 0x29, 0x20, 0x29, 0x3b, 0x20, // ec) * (_mtx) ); 
+	0x7d, 0x0a, 0x76, 0x65, 0x63, 0x33, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x4d, 0x75, 0x6c, 0x28, 0x6d, // }.vec3 instMul(m
+	0x61, 0x74, 0x33, 0x20, 0x5f, 0x6d, 0x74, 0x78, 0x2c, 0x20, 0x76, 0x65, 0x63, 0x33, 0x20, 0x5f, // at3 _mtx, vec3 _
+	0x76, 0x65, 0x63, 0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x28, 0x20, // vec) { return ( 
+	0x28, 0x5f, 0x6d, 0x74, 0x78, 0x29, 0x20, 0x2a, 0x20, 0x28, 0x5f, 0x76, 0x65, 0x63, 0x29, 0x20, // (_mtx) * (_vec) 
+	0x29, 0x3b, 0x20, 0x7d, 0x0a, 0x76, 0x65, 0x63, 0x34, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x4d, 0x75, // ); }.vec4 instMu
+	0x6c, 0x28, 0x76, 0x65, 0x63, 0x34, 0x20, 0x5f, 0x76, 0x65, 0x63, 0x2c, 0x20, 0x6d, 0x61, 0x74, // l(vec4 _vec, mat
+	0x34, 0x20, 0x5f, 0x6d, 0x74, 0x78, 0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, // 4 _mtx) { return
+	0x20, 0x28, 0x20, 0x28, 0x5f, 0x76, 0x65, 0x63, 0x29, 0x20, 0x2a, 0x20, 0x28, 0x5f, 0x6d, 0x74, //  ( (_vec) * (_mt
+	0x78, 0x29, 0x20, 0x29, 0x3b, 0x20, 0x7d, 0x0a, 0x76, 0x65, 0x63, 0x34, 0x20, 0x69, 0x6e, 0x73, // x) ); }.vec4 ins
+	0x74, 0x4d, 0x75, 0x6c, 0x28, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x5f, 0x6d, 0x74, 0x78, 0x2c, 0x20, // tMul(mat4 _mtx, 
+	0x76, 0x65, 0x63, 0x34, 0x20, 0x5f, 0x76, 0x65, 0x63, 0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, // vec4 _vec) { ret
+	0x75, 0x72, 0x6e, 0x20, 0x28, 0x20, 0x28, 0x5f, 0x6d, 0x74, 0x78, 0x29, 0x20, 0x2a, 0x20, 0x28, // urn ( (_mtx) * (
+	0x5f, 0x76, 0x65, 0x63, 0x29, 0x20, 0x29, 0x3b, 0x20, 0x7d, 0x0a, 0x66, 0x6c, 0x6f, 0x61, 0x74, // _vec) ); }.float
+	0x20, 0x72, 0x63, 0x70, 0x28, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x5f, 0x61, 0x29, 0x20, 0x7b, //  rcp(float _a) {
+	0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x31, 0x2e, 0x30, 0x2f, 0x5f, 0x61, 0x3b, 0x20, //  return 1.0/_a; 
+	0x7d, 0x0a, 0x76, 0x65, 0x63, 0x32, 0x20, 0x72, 0x63, 0x70, 0x28, 0x76, 0x65, 0x63, 0x32, 0x20, // }.vec2 rcp(vec2 
+	0x5f, 0x61, 0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x76, 0x65, 0x63, // _a) { return vec
+	0x32, 0x28, 0x31, 0x2e, 0x30, 0x29, 0x2f, 0x5f, 0x61, 0x3b, 0x20, 0x7d, 0x0a, 0x76, 0x65, 0x63, // 2(1.0)/_a; }.vec
+	0x33, 0x20, 0x72, 0x63, 0x70, 0x28, 0x76, 0x65, 0x63, 0x33, 0x20, 0x5f, 0x61, 0x29, 0x20, 0x7b, // 3 rcp(vec3 _a) {
+	0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x76, 0x65, 0x63, 0x33, 0x28, 0x31, 0x2e, 0x30, //  return vec3(1.0
+	0x29, 0x2f, 0x5f, 0x61, 0x3b, 0x20, 0x7d, 0x0a, 0x76, 0x65, 0x63, 0x34, 0x20, 0x72, 0x63, 0x70, // )/_a; }.vec4 rcp
+	0x28, 0x76, 0x65, 0x63, 0x34, 0x20, 0x5f, 0x61, 0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, // (vec4 _a) { retu
+	0x72, 0x6e, 0x20, 0x76, 0x65, 0x63, 0x34, 0x28, 0x31, 0x2e, 0x30, 0x29, 0x2f, 0x5f, 0x61, 0x3b, // rn vec4(1.0)/_a;
+	0x20, 0x7d, 0x0a, 0x76, 0x65, 0x63, 0x32, 0x20, 0x76, 0x65, 0x63, 0x32, 0x5f, 0x73, 0x70, 0x6c, //  }.vec2 vec2_spl
+	0x61, 0x74, 0x28, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x5f, 0x78, 0x29, 0x20, 0x7b, 0x20, 0x72, // at(float _x) { r
+	0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x76, 0x65, 0x63, 0x32, 0x28, 0x5f, 0x78, 0x2c, 0x20, 0x5f, // eturn vec2(_x, _
+	0x78, 0x29, 0x3b, 0x20, 0x7d, 0x0a, 0x76, 0x65, 0x63, 0x33, 0x20, 0x76, 0x65, 0x63, 0x33, 0x5f, // x); }.vec3 vec3_
+	0x73, 0x70, 0x6c, 0x61, 0x74, 0x28, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x5f, 0x78, 0x29, 0x20, // splat(float _x) 
+	0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x76, 0x65, 0x63, 0x33, 0x28, 0x5f, 0x78, // { return vec3(_x
+	0x2c, 0x20, 0x5f, 0x78, 0x2c, 0x20, 0x5f, 0x78, 0x29, 0x3b, 0x20, 0x7d, 0x0a, 0x76, 0x65, 0x63, // , _x, _x); }.vec
+	0x34, 0x20, 0x76, 0x65, 0x63, 0x34, 0x5f, 0x73, 0x70, 0x6c, 0x61, 0x74, 0x28, 0x66, 0x6c, 0x6f, // 4 vec4_splat(flo
+	0x61, 0x74, 0x20, 0x5f, 0x78, 0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, // at _x) { return 
+	0x76, 0x65, 0x63, 0x34, 0x28, 0x5f, 0x78, 0x2c, 0x20, 0x5f, 0x78, 0x2c, 0x20, 0x5f, 0x78, 0x2c, // vec4(_x, _x, _x,
+	0x20, 0x5f, 0x78, 0x29, 0x3b, 0x20, 0x7d, 0x0a, 0x75, 0x76, 0x65, 0x63, 0x32, 0x20, 0x75, 0x76, //  _x); }.uvec2 uv
+	0x65, 0x63, 0x32, 0x5f, 0x73, 0x70, 0x6c, 0x61, 0x74, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, // ec2_splat(uint _
+	0x78, 0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x75, 0x76, 0x65, 0x63, // x) { return uvec
+	0x32, 0x28, 0x5f, 0x78, 0x2c, 0x20, 0x5f, 0x78, 0x29, 0x3b, 0x20, 0x7d, 0x0a, 0x75, 0x76, 0x65, // 2(_x, _x); }.uve
+	0x63, 0x33, 0x20, 0x75, 0x76, 0x65, 0x63, 0x33, 0x5f, 0x73, 0x70, 0x6c, 0x61, 0x74, 0x28, 0x75, // c3 uvec3_splat(u
+	0x69, 0x6e, 0x74, 0x20, 0x5f, 0x78, 0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, // int _x) { return
+	0x20, 0x75, 0x76, 0x65, 0x63, 0x33, 0x28, 0x5f, 0x78, 0x2c, 0x20, 0x5f, 0x78, 0x2c, 0x20, 0x5f, //  uvec3(_x, _x, _
+	0x78, 0x29, 0x3b, 0x20, 0x7d, 0x0a, 0x75, 0x76, 0x65, 0x63, 0x34, 0x20, 0x75, 0x76, 0x65, 0x63, // x); }.uvec4 uvec
+	0x34, 0x5f, 0x73, 0x70, 0x6c, 0x61, 0x74, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x78, 0x29, // 4_splat(uint _x)
+	0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x75, 0x76, 0x65, 0x63, 0x34, 0x28, //  { return uvec4(
+	0x5f, 0x78, 0x2c, 0x20, 0x5f, 0x78, 0x2c, 0x20, 0x5f, 0x78, 0x2c, 0x20, 0x5f, 0x78, 0x29, 0x3b, // _x, _x, _x, _x);
+	0x20, 0x7d, 0x0a, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x6d, 0x74, 0x78, 0x46, 0x72, 0x6f, 0x6d, 0x52, //  }.mat4 mtxFromR
+	0x6f, 0x77, 0x73, 0x28, 0x76, 0x65, 0x63, 0x34, 0x20, 0x5f, 0x30, 0x2c, 0x20, 0x76, 0x65, 0x63, // ows(vec4 _0, vec
+	0x34, 0x20, 0x5f, 0x31, 0x2c, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x5f, 0x32, 0x2c, 0x20, 0x76, // 4 _1, vec4 _2, v
+	0x65, 0x63, 0x34, 0x20, 0x5f, 0x33, 0x29, 0x0a, 0x7b, 0x0a, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, // ec4 _3).{.return
+	0x20, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x70, 0x6f, 0x73, 0x65, 0x28, 0x6d, 0x61, 0x74, 0x34, 0x28, //  transpose(mat4(
+	0x5f, 0x30, 0x2c, 0x20, 0x5f, 0x31, 0x2c, 0x20, 0x5f, 0x32, 0x2c, 0x20, 0x5f, 0x33, 0x29, 0x20, // _0, _1, _2, _3) 
+	0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x6d, 0x74, 0x78, 0x46, 0x72, 0x6f, // );.}.mat4 mtxFro
+	0x6d, 0x43, 0x6f, 0x6c, 0x73, 0x28, 0x76, 0x65, 0x63, 0x34, 0x20, 0x5f, 0x30, 0x2c, 0x20, 0x76, // mCols(vec4 _0, v
+	0x65, 0x63, 0x34, 0x20, 0x5f, 0x31, 0x2c, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x5f, 0x32, 0x2c, // ec4 _1, vec4 _2,
+	0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x5f, 0x33, 0x29, 0x0a, 0x7b, 0x0a, 0x72, 0x65, 0x74, 0x75, //  vec4 _3).{.retu
+	0x72, 0x6e, 0x20, 0x6d, 0x61, 0x74, 0x34, 0x28, 0x5f, 0x30, 0x2c, 0x20, 0x5f, 0x31, 0x2c, 0x20, // rn mat4(_0, _1, 
+	0x5f, 0x32, 0x2c, 0x20, 0x5f, 0x33, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, // _2, _3);.}.unifo
+	0x72, 0x6d, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x75, 0x5f, 0x76, 0x69, 0x65, 0x77, 0x52, 0x65, // rm vec4 u_viewRe
+	0x63, 0x74, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x76, 0x65, 0x63, 0x34, // ct;.uniform vec4
+	0x20, 0x75, 0x5f, 0x76, 0x69, 0x65, 0x77, 0x54, 0x65, 0x78, 0x65, 0x6c, 0x3b, 0x0a, 0x75, 0x6e, //  u_viewTexel;.un
+	0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x75, 0x5f, 0x76, 0x69, 0x65, // iform mat4 u_vie
+	0x77, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x6d, 0x61, 0x74, 0x34, 0x20, // w;.uniform mat4 
+	0x75, 0x5f, 0x69, 0x6e, 0x76, 0x56, 0x69, 0x65, 0x77, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, // u_invView;.unifo
+	0x72, 0x6d, 0x20, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x75, 0x5f, 0x70, 0x72, 0x6f, 0x6a, 0x3b, 0x0a, // rm mat4 u_proj;.
+	0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x75, 0x5f, 0x69, // uniform mat4 u_i
+	0x6e, 0x76, 0x50, 0x72, 0x6f, 0x6a, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, // nvProj;.uniform 
+	0x6d, 0x61, 0x74, 0x34, 0x20, 0x75, 0x5f, 0x76, 0x69, 0x65, 0x77, 0x50, 0x72, 0x6f, 0x6a, 0x3b, // mat4 u_viewProj;
+	0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x75, 0x5f, // .uniform mat4 u_
+	0x69, 0x6e, 0x76, 0x56, 0x69, 0x65, 0x77, 0x50, 0x72, 0x6f, 0x6a, 0x3b, 0x0a, 0x75, 0x6e, 0x69, // invViewProj;.uni
+	0x66, 0x6f, 0x72, 0x6d, 0x20, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x75, 0x5f, 0x6d, 0x6f, 0x64, 0x65, // form mat4 u_mode
+	0x6c, 0x5b, 0x33, 0x32, 0x5d, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x6d, // l[32];.uniform m
+	0x61, 0x74, 0x34, 0x20, 0x75, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x56, 0x69, 0x65, 0x77, 0x3b, // at4 u_modelView;
+	0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x75, 0x5f, // .uniform mat4 u_
+	0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x56, 0x69, 0x65, 0x77, 0x50, 0x72, 0x6f, 0x6a, 0x3b, 0x0a, 0x75, // modelViewProj;.u
+	0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x75, 0x5f, 0x61, 0x6c, // niform vec4 u_al
+	0x70, 0x68, 0x61, 0x52, 0x65, 0x66, 0x34, 0x3b, 0x0a, 0x6c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x28, // phaRef4;.layout(
+	0x72, 0x67, 0x62, 0x61, 0x31, 0x36, 0x66, 0x2c, 0x20, 0x62, 0x69, 0x6e, 0x64, 0x69, 0x6e, 0x67, // rgba16f, binding
+	0x3d, 0x30, 0x29, 0x20, 0x72, 0x65, 0x61, 0x64, 0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x75, 0x6e, 0x69, // =0) readonly uni
+	0x66, 0x6f, 0x72, 0x6d, 0x20, 0x69, 0x6d, 0x61, 0x67, 0x65, 0x32, 0x44, 0x41, 0x72, 0x72, 0x61, // form image2DArra
+	0x79, 0x20, 0x73, 0x5f, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x3b, 0x0a, 0x6c, 0x61, 0x79, 0x6f, 0x75, // y s_input;.layou
+	0x74, 0x28, 0x72, 0x67, 0x62, 0x61, 0x33, 0x32, 0x75, 0x69, 0x2c, 0x20, 0x62, 0x69, 0x6e, 0x64, // t(rgba32ui, bind
+	0x69, 0x6e, 0x67, 0x3d, 0x31, 0x29, 0x20, 0x77, 0x72, 0x69, 0x74, 0x65, 0x6f, 0x6e, 0x6c, 0x79, // ing=1) writeonly
+	0x20, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x75, 0x69, 0x6d, 0x61, 0x67, 0x65, 0x32, //  uniform uimage2
+	0x44, 0x41, 0x72, 0x72, 0x61, 0x79, 0x20, 0x73, 0x5f, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x3b, // DArray s_output;
+	0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x75, 0x5f, // .uniform vec4 u_
+	0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x3b, 0x0a, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x67, // settings;.uint g
+	0x65, 0x74, 0x5f, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x68, 0x61, 0x6c, 0x66, // et_unsigned_half
+	0x28, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x29, 0x20, 0x7b, 0x0a, // (float value) {.
+	0x75, 0x69, 0x6e, 0x74, 0x20, 0x62, 0x69, 0x74, 0x73, 0x20, 0x3d, 0x20, 0x70, 0x61, 0x63, 0x6b, // uint bits = pack
+	0x48, 0x61, 0x6c, 0x66, 0x32, 0x78, 0x31, 0x36, 0x28, 0x76, 0x65, 0x63, 0x32, 0x28, 0x76, 0x61, // Half2x16(vec2(va
+	0x6c, 0x75, 0x65, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x29, 0x29, 0x20, 0x26, 0x20, 0x30, 0x78, 0x46, // lue, 0.0)) & 0xF
+	0x46, 0x46, 0x46, 0x75, 0x3b, 0x0a, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x28, 0x62, 0x69, // FFFu;.return (bi
+	0x74, 0x73, 0x20, 0x26, 0x20, 0x30, 0x78, 0x38, 0x30, 0x30, 0x30, 0x75, 0x29, 0x20, 0x21, 0x3d, // ts & 0x8000u) !=
+	0x20, 0x30, 0x75, 0x20, 0x3f, 0x20, 0x30, 0x75, 0x20, 0x3a, 0x20, 0x6d, 0x69, 0x6e, 0x28, 0x62, //  0u ? 0u : min(b
+	0x69, 0x74, 0x73, 0x2c, 0x20, 0x30, 0x78, 0x37, 0x42, 0x46, 0x46, 0x75, 0x29, 0x3b, 0x0a, 0x7d, // its, 0x7BFFu);.}
+	0x0a, 0x75, 0x76, 0x65, 0x63, 0x33, 0x20, 0x75, 0x6e, 0x71, 0x75, 0x61, 0x6e, 0x74, 0x69, 0x7a, // .uvec3 unquantiz
+	0x65, 0x28, 0x75, 0x76, 0x65, 0x63, 0x33, 0x20, 0x65, 0x6e, 0x64, 0x70, 0x6f, 0x69, 0x6e, 0x74, // e(uvec3 endpoint
+	0x29, 0x20, 0x7b, 0x0a, 0x75, 0x76, 0x65, 0x63, 0x33, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, // ) {.uvec3 result
+	0x20, 0x3d, 0x20, 0x65, 0x6e, 0x64, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x20, 0x2a, 0x20, 0x36, 0x34, //  = endpoint * 64
+	0x75, 0x20, 0x2b, 0x20, 0x33, 0x32, 0x75, 0x3b, 0x0a, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x2e, // u + 32u;.result.
+	0x78, 0x20, 0x3d, 0x20, 0x65, 0x6e, 0x64, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x2e, 0x78, 0x20, 0x3d, // x = endpoint.x =
+	0x3d, 0x20, 0x30, 0x75, 0x20, 0x3f, 0x20, 0x30, 0x75, 0x20, 0x3a, 0x20, 0x28, 0x65, 0x6e, 0x64, // = 0u ? 0u : (end
+	0x70, 0x6f, 0x69, 0x6e, 0x74, 0x2e, 0x78, 0x20, 0x3d, 0x3d, 0x20, 0x31, 0x30, 0x32, 0x33, 0x75, // point.x == 1023u
+	0x20, 0x3f, 0x20, 0x30, 0x78, 0x46, 0x46, 0x46, 0x46, 0x75, 0x20, 0x3a, 0x20, 0x72, 0x65, 0x73, //  ? 0xFFFFu : res
+	0x75, 0x6c, 0x74, 0x2e, 0x78, 0x29, 0x3b, 0x0a, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x2e, 0x79, // ult.x);.result.y
+	0x20, 0x3d, 0x20, 0x65, 0x6e, 0x64, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x2e, 0x79, 0x20, 0x3d, 0x3d, //  = endpoint.y ==
+	0x20, 0x30, 0x75, 0x20, 0x3f, 0x20, 0x30, 0x75, 0x20, 0x3a, 0x20, 0x28, 0x65, 0x6e, 0x64, 0x70, //  0u ? 0u : (endp
+	0x6f, 0x69, 0x6e, 0x74, 0x2e, 0x79, 0x20, 0x3d, 0x3d, 0x20, 0x31, 0x30, 0x32, 0x33, 0x75, 0x20, // oint.y == 1023u 
+	0x3f, 0x20, 0x30, 0x78, 0x46, 0x46, 0x46, 0x46, 0x75, 0x20, 0x3a, 0x20, 0x72, 0x65, 0x73, 0x75, // ? 0xFFFFu : resu
+	0x6c, 0x74, 0x2e, 0x79, 0x29, 0x3b, 0x0a, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x2e, 0x7a, 0x20, // lt.y);.result.z 
+	0x3d, 0x20, 0x65, 0x6e, 0x64, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x2e, 0x7a, 0x20, 0x3d, 0x3d, 0x20, // = endpoint.z == 
+	0x30, 0x75, 0x20, 0x3f, 0x20, 0x30, 0x75, 0x20, 0x3a, 0x20, 0x28, 0x65, 0x6e, 0x64, 0x70, 0x6f, // 0u ? 0u : (endpo
+	0x69, 0x6e, 0x74, 0x2e, 0x7a, 0x20, 0x3d, 0x3d, 0x20, 0x31, 0x30, 0x32, 0x33, 0x75, 0x20, 0x3f, // int.z == 1023u ?
+	0x20, 0x30, 0x78, 0x46, 0x46, 0x46, 0x46, 0x75, 0x20, 0x3a, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6c, //  0xFFFFu : resul
+	0x74, 0x2e, 0x7a, 0x29, 0x3b, 0x0a, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x72, 0x65, 0x73, // t.z);.return res
+	0x75, 0x6c, 0x74, 0x3b, 0x0a, 0x7d, 0x0a, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x67, 0x65, 0x74, 0x5f, // ult;.}.uint get_
+	0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x6e, 0x64, 0x65, // weight(uint inde
+	0x78, 0x29, 0x20, 0x7b, 0x0a, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x28, 0x69, 0x6e, 0x64, // x) {.return (ind
+	0x65, 0x78, 0x20, 0x2a, 0x20, 0x36, 0x34, 0x75, 0x20, 0x2b, 0x20, 0x37, 0x75, 0x29, 0x20, 0x2f, // ex * 64u + 7u) /
+	0x20, 0x31, 0x35, 0x75, 0x3b, 0x0a, 0x7d, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x70, 0x75, 0x74, //  15u;.}.void put
+	0x5f, 0x62, 0x69, 0x74, 0x73, 0x28, 0x69, 0x6e, 0x6f, 0x75, 0x74, 0x20, 0x75, 0x76, 0x65, 0x63, // _bits(inout uvec
+	0x34, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x2c, 0x20, 0x69, 0x6e, 0x6f, 0x75, 0x74, 0x20, 0x75, // 4 block, inout u
+	0x69, 0x6e, 0x74, 0x20, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x2c, 0x20, 0x75, 0x69, // int position, ui
+	0x6e, 0x74, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x62, // nt value, uint b
+	0x69, 0x74, 0x5f, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x29, 0x20, 0x7b, 0x0a, 0x66, 0x6f, 0x72, 0x20, // it_count) {.for 
+	0x28, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x20, 0x3d, 0x20, 0x30, 0x75, 0x3b, 0x20, 0x69, 0x20, // (uint i = 0u; i 
+	0x3c, 0x20, 0x62, 0x69, 0x74, 0x5f, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x3b, 0x20, 0x69, 0x2b, 0x2b, // < bit_count; i++
+	0x29, 0x20, 0x7b, 0x0a, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x62, 0x69, 0x74, 0x20, 0x3d, 0x20, 0x70, // ) {.uint bit = p
+	0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x2b, 0x20, 0x69, 0x3b, 0x0a, 0x62, 0x6c, 0x6f, // osition + i;.blo
+	0x63, 0x6b, 0x5b, 0x62, 0x69, 0x74, 0x20, 0x2f, 0x20, 0x33, 0x32, 0x75, 0x5d, 0x20, 0x7c, 0x3d, // ck[bit / 32u] |=
+	0x20, 0x28, 0x28, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x3e, 0x3e, 0x20, 0x69, 0x29, 0x20, 0x26, //  ((value >> i) &
+	0x20, 0x31, 0x75, 0x29, 0x20, 0x3c, 0x3c, 0x20, 0x28, 0x62, 0x69, 0x74, 0x20, 0x25, 0x20, 0x33, //  1u) << (bit % 3
+	0x32, 0x75, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x20, // 2u);.}.position 
+	0x2b, 0x3d, 0x20, 0x62, 0x69, 0x74, 0x5f, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x3b, 0x0a, 0x7d, 0x0a, // += bit_count;.}.
+	0x6c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x20, 0x28, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x73, 0x69, // layout (local_si
+	0x7a, 0x65, 0x5f, 0x78, 0x20, 0x3d, 0x20, 0x38, 0x2c, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x5f, // ze_x = 8, local_
+	0x73, 0x69, 0x7a, 0x65, 0x5f, 0x79, 0x20, 0x3d, 0x20, 0x38, 0x2c, 0x20, 0x6c, 0x6f, 0x63, 0x61, // size_y = 8, loca
+	0x6c, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x7a, 0x20, 0x3d, 0x20, 0x31, 0x29, 0x20, 0x69, 0x6e, // l_size_z = 1) in
+	0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x6d, 0x61, 0x69, 0x6e, 0x28, 0x29, 0x20, 0x7b, 0x0a, // ;.void main() {.
+	0x69, 0x76, 0x65, 0x63, 0x33, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x74, 0x65, 0x78, 0x65, // ivec3 block_texe
+	0x6c, 0x20, 0x3d, 0x20, 0x69, 0x76, 0x65, 0x63, 0x33, 0x28, 0x67, 0x6c, 0x5f, 0x47, 0x6c, 0x6f, // l = ivec3(gl_Glo
+	0x62, 0x61, 0x6c, 0x49, 0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x49, 0x44, 0x29, // balInvocationID)
+	0x3b, 0x0a, 0x69, 0x6e, 0x74, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x3d, 0x20, 0x69, 0x6e, 0x74, // ;.int size = int
+	0x28, 0x75, 0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x78, 0x29, 0x3b, 0x0a, // (u_settings.x);.
+	0x69, 0x6e, 0x74, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x73, 0x20, 0x3d, 0x20, 0x28, 0x73, 0x69, // int blocks = (si
+	0x7a, 0x65, 0x20, 0x2b, 0x20, 0x33, 0x29, 0x20, 0x2f, 0x20, 0x34, 0x3b, 0x0a, 0x69, 0x66, 0x20, // ze + 3) / 4;.if 
+	0x28, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x2e, 0x78, 0x20, 0x3e, // (block_texel.x >
+	0x3d, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x73, 0x20, 0x7c, 0x7c, 0x20, 0x62, 0x6c, 0x6f, 0x63, // = blocks || bloc
+	0x6b, 0x5f, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x2e, 0x79, 0x20, 0x3e, 0x3d, 0x20, 0x62, 0x6c, 0x6f, // k_texel.y >= blo
+	0x63, 0x6b, 0x73, 0x29, 0x20, 0x7b, 0x0a, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x3b, 0x0a, 0x7d, // cks) {.return;.}
+	0x0a, 0x75, 0x76, 0x65, 0x63, 0x33, 0x20, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x73, 0x5b, 0x31, 0x36, // .uvec3 texels[16
+	0x5d, 0x3b, 0x0a, 0x75, 0x76, 0x65, 0x63, 0x33, 0x20, 0x6c, 0x6f, 0x77, 0x20, 0x3d, 0x20, 0x75, // ];.uvec3 low = u
+	0x76, 0x65, 0x63, 0x33, 0x28, 0x30, 0x78, 0x37, 0x42, 0x46, 0x46, 0x75, 0x2c, 0x20, 0x30, 0x78, // vec3(0x7BFFu, 0x
+	0x37, 0x42, 0x46, 0x46, 0x75, 0x2c, 0x20, 0x30, 0x78, 0x37, 0x42, 0x46, 0x46, 0x75, 0x29, 0x3b, // 7BFFu, 0x7BFFu);
+	0x0a, 0x75, 0x76, 0x65, 0x63, 0x33, 0x20, 0x68, 0x69, 0x67, 0x68, 0x20, 0x3d, 0x20, 0x75, 0x76, // .uvec3 high = uv
+	0x65, 0x63, 0x33, 0x28, 0x30, 0x75, 0x2c, 0x20, 0x30, 0x75, 0x2c, 0x20, 0x30, 0x75, 0x29, 0x3b, // ec3(0u, 0u, 0u);
+	0x0a, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x69, 0x6e, 0x74, 0x20, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x20, // .for (int texel 
+	0x3d, 0x20, 0x30, 0x3b, 0x20, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x20, 0x3c, 0x20, 0x31, 0x36, 0x3b, // = 0; texel < 16;
+	0x20, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x2b, 0x2b, 0x29, 0x20, 0x7b, 0x0a, 0x69, 0x6e, 0x74, 0x20, //  texel++) {.int 
+	0x78, 0x20, 0x3d, 0x20, 0x6d, 0x69, 0x6e, 0x28, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x74, 0x65, // x = min(block_te
+	0x78, 0x65, 0x6c, 0x2e, 0x78, 0x20, 0x2a, 0x20, 0x34, 0x20, 0x2b, 0x20, 0x74, 0x65, 0x78, 0x65, // xel.x * 4 + texe
+	0x6c, 0x20, 0x25, 0x20, 0x34, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x2d, 0x20, 0x31, 0x29, // l % 4, size - 1)
+	0x3b, 0x0a, 0x69, 0x6e, 0x74, 0x20, 0x79, 0x20, 0x3d, 0x20, 0x6d, 0x69, 0x6e, 0x28, 0x62, 0x6c, // ;.int y = min(bl
+	0x6f, 0x63, 0x6b, 0x5f, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x2e, 0x79, 0x20, 0x2a, 0x20, 0x34, 0x20, // ock_texel.y * 4 
+	0x2b, 0x20, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x20, 0x2f, 0x20, 0x34, 0x2c, 0x20, 0x73, 0x69, 0x7a, // + texel / 4, siz
+	0x65, 0x20, 0x2d, 0x20, 0x31, 0x29, 0x3b, 0x0a, 0x76, 0x65, 0x63, 0x34, 0x20, 0x76, 0x61, 0x6c, // e - 1);.vec4 val
+	0x75, 0x65, 0x20, 0x3d, 0x20, 0x69, 0x6d, 0x61, 0x67, 0x65, 0x4c, 0x6f, 0x61, 0x64, 0x28, 0x73, // ue = imageLoad(s
+	0x5f, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x2c, 0x20, 0x69, 0x76, 0x65, 0x63, 0x33, 0x28, 0x78, 0x2c, // _input, ivec3(x,
+	0x20, 0x79, 0x2c, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x2e, //  y, block_texel.
+	0x7a, 0x29, 0x29, 0x3b, 0x0a, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x73, 0x5b, 0x74, 0x65, 0x78, 0x65, // z));.texels[texe
+	0x6c, 0x5d, 0x20, 0x3d, 0x20, 0x75, 0x76, 0x65, 0x63, 0x33, 0x28, 0x67, 0x65, 0x74, 0x5f, 0x75, // l] = uvec3(get_u
+	0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, 0x68, 0x61, 0x6c, 0x66, 0x28, 0x76, 0x61, 0x6c, // nsigned_half(val
+	0x75, 0x65, 0x2e, 0x78, 0x29, 0x2c, 0x20, 0x67, 0x65, 0x74, 0x5f, 0x75, 0x6e, 0x73, 0x69, 0x67, // ue.x), get_unsig
+	0x6e, 0x65, 0x64, 0x5f, 0x68, 0x61, 0x6c, 0x66, 0x28, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2e, 0x79, // ned_half(value.y
+	0x29, 0x2c, 0x20, 0x67, 0x65, 0x74, 0x5f, 0x75, 0x6e, 0x73, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x5f, // ), get_unsigned_
+	0x68, 0x61, 0x6c, 0x66, 0x28, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2e, 0x7a, 0x29, 0x29, 0x3b, 0x0a, // half(value.z));.
+	0x6c, 0x6f, 0x77, 0x20, 0x3d, 0x20, 0x6d, 0x69, 0x6e, 0x28, 0x6c, 0x6f, 0x77, 0x2c, 0x20, 0x74, // low = min(low, t
+	0x65, 0x78, 0x65, 0x6c, 0x73, 0x5b, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x5d, 0x29, 0x3b, 0x0a, 0x68, // exels[texel]);.h
+	0x69, 0x67, 0x68, 0x20, 0x3d, 0x20, 0x6d, 0x61, 0x78, 0x28, 0x68, 0x69, 0x67, 0x68, 0x2c, 0x20, // igh = max(high, 
+	0x74, 0x65, 0x78, 0x65, 0x6c, 0x73, 0x5b, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x5d, 0x29, 0x3b, 0x0a, // texels[texel]);.
+	0x7d, 0x0a, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x62, 0x65, 0x73, 0x74, 0x5f, 0x65, 0x72, 0x72, // }.float best_err
+	0x6f, 0x72, 0x20, 0x3d, 0x20, 0x2d, 0x31, 0x2e, 0x30, 0x3b, 0x0a, 0x75, 0x76, 0x65, 0x63, 0x33, // or = -1.0;.uvec3
+	0x20, 0x62, 0x65, 0x73, 0x74, 0x5f, 0x65, 0x6e, 0x64, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73, 0x5b, //  best_endpoints[
+	0x32, 0x5d, 0x3b, 0x0a, 0x62, 0x65, 0x73, 0x74, 0x5f, 0x65, 0x6e, 0x64, 0x70, 0x6f, 0x69, 0x6e, // 2];.best_endpoin
+	0x74, 0x73, 0x5b, 0x30, 0x5d, 0x20, 0x3d, 0x20, 0x75, 0x76, 0x65, 0x63, 0x33, 0x28, 0x30, 0x75, // ts[0] = uvec3(0u
+	0x2c, 0x20, 0x30, 0x75, 0x2c, 0x20, 0x30, 0x75, 0x29, 0x3b, 0x0a, 0x62, 0x65, 0x73, 0x74, 0x5f, // , 0u, 0u);.best_
+	0x65, 0x6e, 0x64, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73, 0x5b, 0x31, 0x5d, 0x20, 0x3d, 0x20, 0x75, // endpoints[1] = u
+	0x76, 0x65, 0x63, 0x33, 0x28, 0x30, 0x75, 0x2c, 0x20, 0x30, 0x75, 0x2c, 0x20, 0x30, 0x75, 0x29, // vec3(0u, 0u, 0u)
+	0x3b, 0x0a, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x62, 0x65, 0x73, 0x74, 0x5f, 0x69, 0x6e, 0x64, 0x69, // ;.uint best_indi
+	0x63, 0x65, 0x73, 0x5b, 0x31, 0x36, 0x5d, 0x3b, 0x0a, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x69, 0x6e, // ces[16];.for (in
+	0x74, 0x20, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x20, 0x74, 0x65, 0x78, // t texel = 0; tex
+	0x65, 0x6c, 0x20, 0x3c, 0x20, 0x31, 0x36, 0x3b, 0x20, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x2b, 0x2b, // el < 16; texel++
+	0x29, 0x20, 0x7b, 0x0a, 0x62, 0x65, 0x73, 0x74, 0x5f, 0x69, 0x6e, 0x64, 0x69, 0x63, 0x65, 0x73, // ) {.best_indices
+	0x5b, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x5d, 0x20, 0x3d, 0x20, 0x30, 0x75, 0x3b, 0x0a, 0x7d, 0x0a, // [texel] = 0u;.}.
+	0x66, 0x6f, 0x72, 0x20, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x64, 0x69, 0x61, 0x67, 0x6f, 0x6e, // for (uint diagon
+	0x61, 0x6c, 0x20, 0x3d, 0x20, 0x30, 0x75, 0x3b, 0x20, 0x64, 0x69, 0x61, 0x67, 0x6f, 0x6e, 0x61, // al = 0u; diagona
+	0x6c, 0x20, 0x3c, 0x20, 0x34, 0x75, 0x3b, 0x20, 0x64, 0x69, 0x61, 0x67, 0x6f, 0x6e, 0x61, 0x6c, // l < 4u; diagonal
+	0x2b, 0x2b, 0x29, 0x20, 0x7b, 0x0a, 0x62, 0x76, 0x65, 0x63, 0x33, 0x20, 0x69, 0x73, 0x5f, 0x73, // ++) {.bvec3 is_s
+	0x77, 0x61, 0x70, 0x70, 0x65, 0x64, 0x20, 0x3d, 0x20, 0x62, 0x76, 0x65, 0x63, 0x33, 0x28, 0x66, // wapped = bvec3(f
+	0x61, 0x6c, 0x73, 0x65, 0x2c, 0x20, 0x28, 0x64, 0x69, 0x61, 0x67, 0x6f, 0x6e, 0x61, 0x6c, 0x20, // alse, (diagonal 
+	0x26, 0x20, 0x31, 0x75, 0x29, 0x20, 0x21, 0x3d, 0x20, 0x30, 0x75, 0x2c, 0x20, 0x28, 0x64, 0x69, // & 1u) != 0u, (di
+	0x61, 0x67, 0x6f, 0x6e, 0x61, 0x6c, 0x20, 0x26, 0x20, 0x32, 0x75, 0x29, 0x20, 0x21, 0x3d, 0x20, // agonal & 2u) != 
+	0x30, 0x75, 0x29, 0x3b, 0x0a, 0x75, 0x76, 0x65, 0x63, 0x33, 0x20, 0x66, 0x69, 0x72, 0x73, 0x74, // 0u);.uvec3 first
+	0x20, 0x3d, 0x20, 0x75, 0x76, 0x65, 0x63, 0x33, 0x28, 0x69, 0x73, 0x5f, 0x73, 0x77, 0x61, 0x70, //  = uvec3(is_swap
+	0x70, 0x65, 0x64, 0x2e, 0x78, 0x20, 0x3f, 0x20, 0x68, 0x69, 0x67, 0x68, 0x2e, 0x78, 0x20, 0x3a, // ped.x ? high.x :
+	0x20, 0x6c, 0x6f, 0x77, 0x2e, 0x78, 0x2c, 0x20, 0x69, 0x73, 0x5f, 0x73, 0x77, 0x61, 0x70, 0x70, //  low.x, is_swapp
+	0x65, 0x64, 0x2e, 0x79, 0x20, 0x3f, 0x20, 0x68, 0x69, 0x67, 0x68, 0x2e, 0x79, 0x20, 0x3a, 0x20, // ed.y ? high.y : 
+	0x6c, 0x6f, 0x77, 0x2e, 0x79, 0x2c, 0x20, 0x69, 0x73, 0x5f, 0x73, 0x77, 0x61, 0x70, 0x70, 0x65, // low.y, is_swappe
+	0x64, 0x2e, 0x7a, 0x20, 0x3f, 0x20, 0x68, 0x69, 0x67, 0x68, 0x2e, 0x7a, 0x20, 0x3a, 0x20, 0x6c, // d.z ? high.z : l
+	0x6f, 0x77, 0x2e, 0x7a, 0x29, 0x3b, 0x0a, 0x75, 0x76, 0x65, 0x63, 0x33, 0x20, 0x73, 0x65, 0x63, // ow.z);.uvec3 sec
+	0x6f, 0x6e, 0x64, 0x20, 0x3d, 0x20, 0x75, 0x76, 0x65, 0x63, 0x33, 0x28, 0x69, 0x73, 0x5f, 0x73, // ond = uvec3(is_s
+	0x77, 0x61, 0x70, 0x70, 0x65, 0x64, 0x2e, 0x78, 0x20, 0x3f, 0x20, 0x6c, 0x6f, 0x77, 0x2e, 0x78, // wapped.x ? low.x
+	0x20, 0x3a, 0x20, 0x68, 0x69, 0x67, 0x68, 0x2e, 0x78, 0x2c, 0x20, 0x69, 0x73, 0x5f, 0x73, 0x77, //  : high.x, is_sw
+	0x61, 0x70, 0x70, 0x65, 0x64, 0x2e, 0x79, 0x20, 0x3f, 0x20, 0x6c, 0x6f, 0x77, 0x2e, 0x79, 0x20, // apped.y ? low.y 
+	0x3a, 0x20, 0x68, 0x69, 0x67, 0x68, 0x2e, 0x79, 0x2c, 0x20, 0x69, 0x73, 0x5f, 0x73, 0x77, 0x61, // : high.y, is_swa
+	0x70, 0x70, 0x65, 0x64, 0x2e, 0x7a, 0x20, 0x3f, 0x20, 0x6c, 0x6f, 0x77, 0x2e, 0x7a, 0x20, 0x3a, // pped.z ? low.z :
+	0x20, 0x68, 0x69, 0x67, 0x68, 0x2e, 0x7a, 0x29, 0x3b, 0x0a, 0x75, 0x76, 0x65, 0x63, 0x33, 0x20, //  high.z);.uvec3 
+	0x65, 0x6e, 0x64, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73, 0x5b, 0x32, 0x5d, 0x3b, 0x0a, 0x65, 0x6e, // endpoints[2];.en
+	0x64, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73, 0x5b, 0x30, 0x5d, 0x20, 0x3d, 0x20, 0x6d, 0x69, 0x6e, // dpoints[0] = min
+	0x28, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x2f, 0x20, 0x33, 0x31, 0x75, 0x2c, 0x20, 0x75, 0x76, // (first / 31u, uv
+	0x65, 0x63, 0x33, 0x28, 0x31, 0x30, 0x32, 0x33, 0x75, 0x2c, 0x20, 0x31, 0x30, 0x32, 0x33, 0x75, // ec3(1023u, 1023u
+	0x2c, 0x20, 0x31, 0x30, 0x32, 0x33, 0x75, 0x29, 0x29, 0x3b, 0x0a, 0x65, 0x6e, 0x64, 0x70, 0x6f, // , 1023u));.endpo
+	0x69, 0x6e, 0x74, 0x73, 0x5b, 0x31, 0x5d, 0x20, 0x3d, 0x20, 0x6d, 0x69, 0x6e, 0x28, 0x73, 0x65, // ints[1] = min(se
+	0x63, 0x6f, 0x6e, 0x64, 0x20, 0x2f, 0x20, 0x33, 0x31, 0x75, 0x2c, 0x20, 0x75, 0x76, 0x65, 0x63, // cond / 31u, uvec
+	0x33, 0x28, 0x31, 0x30, 0x32, 0x33, 0x75, 0x2c, 0x20, 0x31, 0x30, 0x32, 0x33, 0x75, 0x2c, 0x20, // 3(1023u, 1023u, 
+	0x31, 0x30, 0x32, 0x33, 0x75, 0x29, 0x29, 0x3b, 0x0a, 0x75, 0x76, 0x65, 0x63, 0x33, 0x20, 0x75, // 1023u));.uvec3 u
+	0x6e, 0x71, 0x75, 0x61, 0x6e, 0x74, 0x69, 0x7a, 0x65, 0x64, 0x5f, 0x66, 0x69, 0x72, 0x73, 0x74, // nquantized_first
+	0x20, 0x3d, 0x20, 0x75, 0x6e, 0x71, 0x75, 0x61, 0x6e, 0x74, 0x69, 0x7a, 0x65, 0x28, 0x65, 0x6e, //  = unquantize(en
+	0x64, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73, 0x5b, 0x30, 0x5d, 0x29, 0x3b, 0x0a, 0x75, 0x76, 0x65, // dpoints[0]);.uve
+	0x63, 0x33, 0x20, 0x75, 0x6e, 0x71, 0x75, 0x61, 0x6e, 0x74, 0x69, 0x7a, 0x65, 0x64, 0x5f, 0x73, // c3 unquantized_s
+	0x65, 0x63, 0x6f, 0x6e, 0x64, 0x20, 0x3d, 0x20, 0x75, 0x6e, 0x71, 0x75, 0x61, 0x6e, 0x74, 0x69, // econd = unquanti
+	0x7a, 0x65, 0x28, 0x65, 0x6e, 0x64, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73, 0x5b, 0x31, 0x5d, 0x29, // ze(endpoints[1])
+	0x3b, 0x0a, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x3d, 0x20, // ;.float error = 
+	0x30, 0x2e, 0x30, 0x3b, 0x0a, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x6e, 0x64, 0x69, 0x63, 0x65, // 0.0;.uint indice
+	0x73, 0x5b, 0x31, 0x36, 0x5d, 0x3b, 0x0a, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x69, 0x6e, 0x74, 0x20, // s[16];.for (int 
+	0x74, 0x65, 0x78, 0x65, 0x6c, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x20, 0x74, 0x65, 0x78, 0x65, 0x6c, // texel = 0; texel
+	0x20, 0x3c, 0x20, 0x31, 0x36, 0x3b, 0x20, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x2b, 0x2b, 0x29, 0x20, //  < 16; texel++) 
+	0x7b, 0x0a, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x62, 0x65, 0x73, 0x74, 0x5f, 0x74, 0x65, 0x78, // {.float best_tex
+	0x65, 0x6c, 0x5f, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x3d, 0x20, 0x2d, 0x31, 0x2e, 0x30, 0x3b, // el_error = -1.0;
+	0x0a, 0x69, 0x6e, 0x64, 0x69, 0x63, 0x65, 0x73, 0x5b, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x5d, 0x20, // .indices[texel] 
+	0x3d, 0x20, 0x30, 0x75, 0x3b, 0x0a, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x20, // = 0u;.for (uint 
+	0x69, 0x20, 0x3d, 0x20, 0x30, 0x75, 0x3b, 0x20, 0x69, 0x20, 0x3c, 0x20, 0x31, 0x36, 0x75, 0x3b, // i = 0u; i < 16u;
+	0x20, 0x69, 0x2b, 0x2b, 0x29, 0x20, 0x7b, 0x0a, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x77, 0x65, 0x69, //  i++) {.uint wei
+	0x67, 0x68, 0x74, 0x20, 0x3d, 0x20, 0x67, 0x65, 0x74, 0x5f, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74, // ght = get_weight
+	0x28, 0x69, 0x29, 0x3b, 0x0a, 0x75, 0x76, 0x65, 0x63, 0x33, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, // (i);.uvec3 value
+	0x20, 0x3d, 0x20, 0x28, 0x28, 0x36, 0x34, 0x75, 0x20, 0x2d, 0x20, 0x77, 0x65, 0x69, 0x67, 0x68, //  = ((64u - weigh
+	0x74, 0x29, 0x20, 0x2a, 0x20, 0x75, 0x6e, 0x71, 0x75, 0x61, 0x6e, 0x74, 0x69, 0x7a, 0x65, 0x64, // t) * unquantized
+	0x5f, 0x66, 0x69, 0x72, 0x73, 0x74, 0x20, 0x2b, 0x20, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x20, // _first + weight 
+	0x2a, 0x20, 0x75, 0x6e, 0x71, 0x75, 0x61, 0x6e, 0x74, 0x69, 0x7a, 0x65, 0x64, 0x5f, 0x73, 0x65, // * unquantized_se
+	0x63, 0x6f, 0x6e, 0x64, 0x20, 0x2b, 0x20, 0x33, 0x32, 0x75, 0x29, 0x20, 0x3e, 0x3e, 0x20, 0x36, // cond + 32u) >> 6
+	0x75, 0x3b, 0x0a, 0x76, 0x65, 0x63, 0x33, 0x20, 0x64, 0x69, 0x66, 0x66, 0x65, 0x72, 0x65, 0x6e, // u;.vec3 differen
+	0x63, 0x65, 0x20, 0x3d, 0x20, 0x76, 0x65, 0x63, 0x33, 0x28, 0x28, 0x76, 0x61, 0x6c, 0x75, 0x65, // ce = vec3((value
+	0x20, 0x2a, 0x20, 0x33, 0x31, 0x75, 0x29, 0x20, 0x3e, 0x3e, 0x20, 0x36, 0x75, 0x29, 0x20, 0x2d, //  * 31u) >> 6u) -
+	0x20, 0x76, 0x65, 0x63, 0x33, 0x28, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x73, 0x5b, 0x74, 0x65, 0x78, //  vec3(texels[tex
+	0x65, 0x6c, 0x5d, 0x29, 0x3b, 0x0a, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x74, 0x65, 0x78, 0x65, // el]);.float texe
+	0x6c, 0x5f, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x3d, 0x20, 0x64, 0x6f, 0x74, 0x28, 0x64, 0x69, // l_error = dot(di
+	0x66, 0x66, 0x65, 0x72, 0x65, 0x6e, 0x63, 0x65, 0x2c, 0x20, 0x64, 0x69, 0x66, 0x66, 0x65, 0x72, // fference, differ
+	0x65, 0x6e, 0x63, 0x65, 0x29, 0x3b, 0x0a, 0x69, 0x66, 0x20, 0x28, 0x62, 0x65, 0x73, 0x74, 0x5f, // ence);.if (best_
+	0x74, 0x65, 0x78, 0x65, 0x6c, 0x5f, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x3c, 0x20, 0x30, 0x2e, // texel_error < 0.
+	0x30, 0x20, 0x7c, 0x7c, 0x20, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x5f, 0x65, 0x72, 0x72, 0x6f, 0x72, // 0 || texel_error
+	0x20, 0x3c, 0x20, 0x62, 0x65, 0x73, 0x74, 0x5f, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x5f, 0x65, 0x72, //  < best_texel_er
+	0x72, 0x6f, 0x72, 0x29, 0x20, 0x7b, 0x0a, 0x62, 0x65, 0x73, 0x74, 0x5f, 0x74, 0x65, 0x78, 0x65, // ror) {.best_texe
+	0x6c, 0x5f, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x3d, 0x20, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x5f, // l_error = texel_
+	0x65, 0x72, 0x72, 0x6f, 0x72, 0x3b, 0x0a, 0x69, 0x6e, 0x64, 0x69, 0x63, 0x65, 0x73, 0x5b, 0x74, // error;.indices[t
+	0x65, 0x78, 0x65, 0x6c, 0x5d, 0x20, 0x3d, 0x20, 0x69, 0x3b, 0x0a, 0x7d, 0x0a, 0x7d, 0x0a, 0x65, // exel] = i;.}.}.e
+	0x72, 0x72, 0x6f, 0x72, 0x20, 0x2b, 0x3d, 0x20, 0x62, 0x65, 0x73, 0x74, 0x5f, 0x74, 0x65, 0x78, // rror += best_tex
+	0x65, 0x6c, 0x5f, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x3b, 0x0a, 0x7d, 0x0a, 0x69, 0x66, 0x20, 0x28, // el_error;.}.if (
+	0x62, 0x65, 0x73, 0x74, 0x5f, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x3c, 0x20, 0x30, 0x2e, 0x30, // best_error < 0.0
+	0x20, 0x7c, 0x7c, 0x20, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x20, 0x3c, 0x20, 0x62, 0x65, 0x73, 0x74, //  || error < best
+	0x5f, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x29, 0x20, 0x7b, 0x0a, 0x62, 0x65, 0x73, 0x74, 0x5f, 0x65, // _error) {.best_e
+	0x72, 0x72, 0x6f, 0x72, 0x20, 0x3d, 0x20, 0x65, 0x72, 0x72, 0x6f, 0x72, 0x3b, 0x0a, 0x62, 0x65, // rror = error;.be
+	0x73, 0x74, 0x5f, 0x65, 0x6e, 0x64, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73, 0x5b, 0x30, 0x5d, 0x20, // st_endpoints[0] 
+	0x3d, 0x20, 0x65, 0x6e, 0x64, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73, 0x5b, 0x30, 0x5d, 0x3b, 0x0a, // = endpoints[0];.
+	0x62, 0x65, 0x73, 0x74, 0x5f, 0x65, 0x6e, 0x64, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73, 0x5b, 0x31, // best_endpoints[1
+	0x5d, 0x20, 0x3d, 0x20, 0x65, 0x6e, 0x64, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73, 0x5b, 0x31, 0x5d, // ] = endpoints[1]
+	0x3b, 0x0a, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x69, 0x6e, 0x74, 0x20, 0x74, 0x65, 0x78, 0x65, 0x6c, // ;.for (int texel
+	0x20, 0x3d, 0x20, 0x30, 0x3b, 0x20, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x20, 0x3c, 0x20, 0x31, 0x36, //  = 0; texel < 16
+	0x3b, 0x20, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x2b, 0x2b, 0x29, 0x20, 0x7b, 0x0a, 0x62, 0x65, 0x73, // ; texel++) {.bes
+	0x74, 0x5f, 0x69, 0x6e, 0x64, 0x69, 0x63, 0x65, 0x73, 0x5b, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x5d, // t_indices[texel]
+	0x20, 0x3d, 0x20, 0x69, 0x6e, 0x64, 0x69, 0x63, 0x65, 0x73, 0x5b, 0x74, 0x65, 0x78, 0x65, 0x6c, //  = indices[texel
+	0x5d, 0x3b, 0x0a, 0x7d, 0x0a, 0x7d, 0x0a, 0x7d, 0x0a, 0x69, 0x66, 0x20, 0x28, 0x62, 0x65, 0x73, // ];.}.}.}.if (bes
+	0x74, 0x5f, 0x69, 0x6e, 0x64, 0x69, 0x63, 0x65, 0x73, 0x5b, 0x30, 0x5d, 0x20, 0x3e, 0x3d, 0x20, // t_indices[0] >= 
+	0x38, 0x75, 0x29, 0x20, 0x7b, 0x0a, 0x75, 0x76, 0x65, 0x63, 0x33, 0x20, 0x65, 0x6e, 0x64, 0x70, // 8u) {.uvec3 endp
+	0x6f, 0x69, 0x6e, 0x74, 0x20, 0x3d, 0x20, 0x62, 0x65, 0x73, 0x74, 0x5f, 0x65, 0x6e, 0x64, 0x70, // oint = best_endp
+	0x6f, 0x69, 0x6e, 0x74, 0x73, 0x5b, 0x30, 0x5d, 0x3b, 0x0a, 0x62, 0x65, 0x73, 0x74, 0x5f, 0x65, // oints[0];.best_e
+	0x6e, 0x64, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73, 0x5b, 0x30, 0x5d, 0x20, 0x3d, 0x20, 0x62, 0x65, // ndpoints[0] = be
+	0x73, 0x74, 0x5f, 0x65, 0x6e, 0x64, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73, 0x5b, 0x31, 0x5d, 0x3b, // st_endpoints[1];
+	0x0a, 0x62, 0x65, 0x73, 0x74, 0x5f, 0x65, 0x6e, 0x64, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73, 0x5b, // .best_endpoints[
+	0x31, 0x5d, 0x20, 0x3d, 0x20, 0x65, 0x6e, 0x64, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x3b, 0x0a, 0x66, // 1] = endpoint;.f
+	0x6f, 0x72, 0x20, 0x28, 0x69, 0x6e, 0x74, 0x20, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x20, 0x3d, 0x20, // or (int texel = 
+	0x30, 0x3b, 0x20, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x20, 0x3c, 0x20, 0x31, 0x36, 0x3b, 0x20, 0x74, // 0; texel < 16; t
+	0x65, 0x78, 0x65, 0x6c, 0x2b, 0x2b, 0x29, 0x20, 0x7b, 0x0a, 0x62, 0x65, 0x73, 0x74, 0x5f, 0x69, // exel++) {.best_i
+	0x6e, 0x64, 0x69, 0x63, 0x65, 0x73, 0x5b, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x5d, 0x20, 0x3d, 0x20, // ndices[texel] = 
+	0x31, 0x35, 0x75, 0x20, 0x2d, 0x20, 0x62, 0x65, 0x73, 0x74, 0x5f, 0x69, 0x6e, 0x64, 0x69, 0x63, // 15u - best_indic
+	0x65, 0x73, 0x5b, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x5d, 0x3b, 0x0a, 0x7d, 0x0a, 0x7d, 0x0a, 0x75, // es[texel];.}.}.u
+	0x76, 0x65, 0x63, 0x34, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x20, 0x3d, 0x20, 0x75, 0x76, 0x65, // vec4 block = uve
+	0x63, 0x34, 0x28, 0x30, 0x75, 0x2c, 0x20, 0x30, 0x75, 0x2c, 0x20, 0x30, 0x75, 0x2c, 0x20, 0x30, // c4(0u, 0u, 0u, 0
+	0x75, 0x29, 0x3b, 0x0a, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, // u);.uint positio
+	0x6e, 0x20, 0x3d, 0x20, 0x30, 0x75, 0x3b, 0x0a, 0x70, 0x75, 0x74, 0x5f, 0x62, 0x69, 0x74, 0x73, // n = 0u;.put_bits
+	0x28, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x2c, 0x20, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, // (block, position
+	0x2c, 0x20, 0x33, 0x75, 0x2c, 0x20, 0x35, 0x75, 0x29, 0x3b, 0x0a, 0x66, 0x6f, 0x72, 0x20, 0x28, // , 3u, 5u);.for (
+	0x69, 0x6e, 0x74, 0x20, 0x65, 0x6e, 0x64, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x20, 0x3d, 0x20, 0x30, // int endpoint = 0
+	0x3b, 0x20, 0x65, 0x6e, 0x64, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x20, 0x3c, 0x20, 0x32, 0x3b, 0x20, // ; endpoint < 2; 
+	0x65, 0x6e, 0x64, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x2b, 0x2b, 0x29, 0x20, 0x7b, 0x0a, 0x70, 0x75, // endpoint++) {.pu
+	0x74, 0x5f, 0x62, 0x69, 0x74, 0x73, 0x28, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x2c, 0x20, 0x70, 0x6f, // t_bits(block, po
+	0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x2c, 0x20, 0x62, 0x65, 0x73, 0x74, 0x5f, 0x65, 0x6e, 0x64, // sition, best_end
+	0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73, 0x5b, 0x65, 0x6e, 0x64, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x5d, // points[endpoint]
+	0x2e, 0x78, 0x2c, 0x20, 0x31, 0x30, 0x75, 0x29, 0x3b, 0x0a, 0x70, 0x75, 0x74, 0x5f, 0x62, 0x69, // .x, 10u);.put_bi
+	0x74, 0x73, 0x28, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x2c, 0x20, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, // ts(block, positi
+	0x6f, 0x6e, 0x2c, 0x20, 0x62, 0x65, 0x73, 0x74, 0x5f, 0x65, 0x6e, 0x64, 0x70, 0x6f, 0x69, 0x6e, // on, best_endpoin
+	0x74, 0x73, 0x5b, 0x65, 0x6e, 0x64, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x5d, 0x2e, 0x79, 0x2c, 0x20, // ts[endpoint].y, 
+	0x31, 0x30, 0x75, 0x29, 0x3b, 0x0a, 0x70, 0x75, 0x74, 0x5f, 0x62, 0x69, 0x74, 0x73, 0x28, 0x62, // 10u);.put_bits(b
+	0x6c, 0x6f, 0x63, 0x6b, 0x2c, 0x20, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x2c, 0x20, // lock, position, 
+	0x62, 0x65, 0x73, 0x74, 0x5f, 0x65, 0x6e, 0x64, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x73, 0x5b, 0x65, // best_endpoints[e
+	0x6e, 0x64, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x5d, 0x2e, 0x7a, 0x2c, 0x20, 0x31, 0x30, 0x75, 0x29, // ndpoint].z, 10u)
+	0x3b, 0x0a, 0x7d, 0x0a, 0x70, 0x75, 0x74, 0x5f, 0x62, 0x69, 0x74, 0x73, 0x28, 0x62, 0x6c, 0x6f, // ;.}.put_bits(blo
+	0x63, 0x6b, 0x2c, 0x20, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x2c, 0x20, 0x62, 0x65, // ck, position, be
+	0x73, 0x74, 0x5f, 0x69, 0x6e, 0x64, 0x69, 0x63, 0x65, 0x73, 0x5b, 0x30, 0x5d, 0x2c, 0x20, 0x33, // st_indices[0], 3
+	0x75, 0x29, 0x3b, 0x0a, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x69, 0x6e, 0x74, 0x20, 0x74, 0x65, 0x78, // u);.for (int tex
+	0x65, 0x6c, 0x20, 0x3d, 0x20, 0x31, 0x3b, 0x20, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x20, 0x3c, 0x20, // el = 1; texel < 
+	0x31, 0x36, 0x3b, 0x20, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x2b, 0x2b, 0x29, 0x20, 0x7b, 0x0a, 0x70, // 16; texel++) {.p
+	0x75, 0x74, 0x5f, 0x62, 0x69, 0x74, 0x73, 0x28, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x2c, 0x20, 0x70, // ut_bits(block, p
+	0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x2c, 0x20, 0x62, 0x65, 0x73, 0x74, 0x5f, 0x69, 0x6e, // osition, best_in
+	0x64, 0x69, 0x63, 0x65, 0x73, 0x5b, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x5d, 0x2c, 0x20, 0x34, 0x75, // dices[texel], 4u
+	0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x69, 0x6d, 0x61, 0x67, 0x65, 0x53, 0x74, 0x6f, 0x72, 0x65, 0x28, // );.}.imageStore(
+	0x73, 0x5f, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2c, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x5f, // s_output, block_
+	0x74, 0x65, 0x78, 0x65, 0x6c, 0x2c, 0x20, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x29, 0x3b, 0x0a, 0x7d, // texel, block);.}
+	0x0a, 0x00,                                                                                     // ..
+};
+
+static const uint8_t bc6h_shader_compute_spv[10201] =
+{
+	0x43, 0x53, 0x48, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x0a, 0x75, // CSH............u
+	0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x02, 0x01, 0x00, 0x00, 0x01, 0x00, 0x07, // _settings.......
+	0x73, 0x5f, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x27, 0x00, // s_input.......'.
+	0x00, 0x03, 0x02, 0x23, 0x07, 0x00, 0x00, 0x01, 0x00, 0x07, 0x00, 0x08, 0x00, 0x16, 0x06, 0x00, // ...#............
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x06, // ................
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x47, 0x4c, 0x53, 0x4c, 0x2e, 0x73, 0x74, 0x64, 0x2e, 0x34, 0x35, // .....GLSL.std.45
+	0x30, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, // 0...............
+	0x00, 0x0f, 0x00, 0x06, 0x00, 0x05, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, // .............mai
+	0x6e, 0x00, 0x00, 0x00, 0x00, 0x8b, 0x02, 0x00, 0x00, 0x10, 0x00, 0x06, 0x00, 0x04, 0x00, 0x00, // n...............
+	0x00, 0x11, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, // ................
+	0x00, 0x03, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x00, 0xf4, 0x01, 0x00, 0x00, 0x05, 0x00, 0x04, // ................
+	0x00, 0x04, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x06, // .....main.......
+	0x00, 0x3d, 0x00, 0x00, 0x00, 0x73, 0x5f, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x54, 0x65, 0x78, 0x74, // .=...s_inputText
+	0x75, 0x72, 0x65, 0x00, 0x00, 0x05, 0x00, 0x06, 0x00, 0x43, 0x00, 0x00, 0x00, 0x73, 0x5f, 0x6f, // ure......C...s_o
+	0x75, 0x74, 0x70, 0x75, 0x74, 0x54, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x00, 0x05, 0x00, 0x04, // utputTexture....
+	0x00, 0xc3, 0x00, 0x00, 0x00, 0x24, 0x47, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x00, 0x06, 0x00, 0x06, // .....$Global....
+	0x00, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, // .........u_setti
+	0x6e, 0x67, 0x73, 0x00, 0x00, 0x05, 0x00, 0x03, 0x00, 0xc5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // ngs.............
+	0x00, 0x05, 0x00, 0x08, 0x00, 0x8b, 0x02, 0x00, 0x00, 0x67, 0x6c, 0x5f, 0x47, 0x6c, 0x6f, 0x62, // .........gl_Glob
+	0x61, 0x6c, 0x49, 0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x49, 0x44, 0x00, 0x00, // alInvocationID..
+	0x00, 0x47, 0x00, 0x04, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // .G...=..."......
+	0x00, 0x47, 0x00, 0x04, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // .G...=...!......
+	0x00, 0x47, 0x00, 0x04, 0x00, 0x43, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // .G...C..."......
+	0x00, 0x47, 0x00, 0x04, 0x00, 0x43, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, // .G...C...!......
+	0x00, 0x48, 0x00, 0x05, 0x00, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, // .H...........#..
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00, 0xc3, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, // .....G..........
+	0x00, 0x47, 0x00, 0x04, 0x00, 0xc5, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // .G......."......
+	0x00, 0x47, 0x00, 0x04, 0x00, 0xc5, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // .G.......!......
+	0x00, 0x47, 0x00, 0x04, 0x00, 0x8b, 0x02, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, // .G..............
+	0x00, 0x13, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x21, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, // .........!......
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x16, 0x00, 0x03, 0x00, 0x06, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, // ............. ..
+	0x00, 0x19, 0x00, 0x09, 0x00, 0x07, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, // ................
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, // ................
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, // ............. ..
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, // ................
+	0x00, 0x03, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, // ................
+	0x00, 0x04, 0x00, 0x00, 0x00, 0x15, 0x00, 0x04, 0x00, 0x13, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, // ............. ..
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0x00, 0x09, 0x00, 0x14, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, // ................
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // ................
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00, 0x17, 0x00, 0x00, // ................
+	0x00, 0x13, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x18, 0x00, 0x00, // ......... ......
+	0x00, 0x07, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00, 0x24, 0x00, 0x00, // .............$..
+	0x00, 0x13, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x25, 0x00, 0x00, // ......... ...%..
+	0x00, 0x07, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x2a, 0x00, 0x00, // .....$... ...*..
+	0x00, 0x07, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x3c, 0x00, 0x00, // ......... ...<..
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x3c, 0x00, 0x00, // .........;...<..
+	0x00, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x42, 0x00, 0x00, // .=....... ...B..
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x42, 0x00, 0x00, // .........;...B..
+	0x00, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, // .C.......+......
+	0x00, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, // .F.......+......
+	0x00, 0x57, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00, 0x58, 0x00, 0x00, // .W...........X..
+	0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x13, 0x00, 0x00, // .........+......
+	0x00, 0x5c, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x13, 0x00, 0x00, // .........+......
+	0x00, 0x5e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x02, 0x00, 0x5f, 0x00, 0x00, // .^..........._..
+	0x00, 0x2b, 0x00, 0x04, 0x00, 0x13, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0xff, 0x7b, 0x00, // .+.......b....{.
+	0x00, 0x2b, 0x00, 0x04, 0x00, 0x13, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, // .+.......i...@..
+	0x00, 0x2b, 0x00, 0x04, 0x00, 0x13, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, // .+.......l... ..
+	0x00, 0x2b, 0x00, 0x04, 0x00, 0x13, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, // .+.......t......
+	0x00, 0x2b, 0x00, 0x04, 0x00, 0x13, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, // .+.......v......
+	0x00, 0x2b, 0x00, 0x04, 0x00, 0x13, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, // .+.......|......
+	0x00, 0x2b, 0x00, 0x04, 0x00, 0x13, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, // .+..............
+	0x00, 0x2b, 0x00, 0x04, 0x00, 0x13, 0x00, 0x00, 0x00, 0x99, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, // .+..............
+	0x00, 0x2b, 0x00, 0x04, 0x00, 0x13, 0x00, 0x00, 0x00, 0x9b, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, // .+..............
+	0x00, 0x2b, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00, 0xba, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, // .+..............
+	0x00, 0x1e, 0x00, 0x03, 0x00, 0xc3, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, // ............. ..
+	0x00, 0xc4, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xc3, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, // .............;..
+	0x00, 0xc4, 0x00, 0x00, 0x00, 0xc5, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, // ............. ..
+	0x00, 0xc6, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, // .............+..
+	0x00, 0x0a, 0x00, 0x00, 0x00, 0xcc, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, // .............+..
+	0x00, 0x0a, 0x00, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x06, // .............,..
+	0x00, 0x24, 0x00, 0x00, 0x00, 0xdd, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, // .$.......b...b..
+	0x00, 0x62, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x06, 0x00, 0x24, 0x00, 0x00, 0x00, 0xdf, 0x00, 0x00, // .b...,...$......
+	0x00, 0x5e, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, // .^...^...^...+..
+	0x00, 0x0a, 0x00, 0x00, 0x00, 0xe7, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, // .............+..
+	0x00, 0x13, 0x00, 0x00, 0x00, 0x08, 0x01, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x04, // ................
+	0x00, 0x09, 0x01, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x08, 0x01, 0x00, 0x00, 0x20, 0x00, 0x04, // .....$....... ..
+	0x00, 0x0a, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x09, 0x01, 0x00, 0x00, 0x2b, 0x00, 0x04, // .............+..
+	0x00, 0x06, 0x00, 0x00, 0x00, 0x28, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0xbf, 0x1c, 0x00, 0x04, // .....(..........
+	0x00, 0x29, 0x01, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, // .)...$....... ..
+	0x00, 0x2a, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x29, 0x01, 0x00, 0x00, 0x1c, 0x00, 0x04, // .*.......)......
+	0x00, 0x36, 0x01, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x08, 0x01, 0x00, 0x00, 0x20, 0x00, 0x04, // .6........... ..
+	0x00, 0x37, 0x01, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x36, 0x01, 0x00, 0x00, 0x2b, 0x00, 0x04, // .7.......6...+..
+	0x00, 0x13, 0x00, 0x00, 0x00, 0x44, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, // .....D.......+..
+	0x00, 0x13, 0x00, 0x00, 0x00, 0x82, 0x01, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x06, // .............,..
+	0x00, 0x24, 0x00, 0x00, 0x00, 0x85, 0x01, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, // .$.......t...t..
+	0x00, 0x74, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x13, 0x00, 0x00, 0x00, 0xbd, 0x01, 0x00, // .t...+..........
+	0x00, 0x06, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00, 0xc0, 0x01, 0x00, 0x00, 0x06, 0x00, 0x00, // ................
+	0x00, 0x03, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x13, 0x00, 0x00, 0x00, 0x07, 0x02, 0x00, // .....+..........
+	0x00, 0x08, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x07, 0x00, 0x17, 0x00, 0x00, 0x00, 0x24, 0x02, 0x00, // .....,.......$..
+	0x00, 0x5e, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, // .^...^...^...^..
+	0x00, 0x2b, 0x00, 0x04, 0x00, 0x13, 0x00, 0x00, 0x00, 0x26, 0x02, 0x00, 0x00, 0x03, 0x00, 0x00, // .+.......&......
+	0x00, 0x2b, 0x00, 0x04, 0x00, 0x13, 0x00, 0x00, 0x00, 0x27, 0x02, 0x00, 0x00, 0x05, 0x00, 0x00, // .+.......'......
+	0x00, 0x2b, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x38, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, // .+.......8......
+	0x00, 0x2b, 0x00, 0x04, 0x00, 0x13, 0x00, 0x00, 0x00, 0x3b, 0x02, 0x00, 0x00, 0x0a, 0x00, 0x00, // .+.......;......
+	0x00, 0x20, 0x00, 0x04, 0x00, 0x8a, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, // . ..............
+	0x00, 0x3b, 0x00, 0x04, 0x00, 0x8a, 0x02, 0x00, 0x00, 0x8b, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, // .;..............
+	0x00, 0x2c, 0x00, 0x06, 0x00, 0x24, 0x00, 0x00, 0x00, 0xcd, 0x05, 0x00, 0x00, 0x82, 0x01, 0x00, // .,...$..........
+	0x00, 0x82, 0x01, 0x00, 0x00, 0x82, 0x01, 0x00, 0x00, 0x2c, 0x00, 0x06, 0x00, 0x24, 0x00, 0x00, // .........,...$..
+	0x00, 0xce, 0x05, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, // .....i...i...i..
+	0x00, 0x2c, 0x00, 0x06, 0x00, 0x24, 0x00, 0x00, 0x00, 0xcf, 0x05, 0x00, 0x00, 0x6c, 0x00, 0x00, // .,...$.......l..
+	0x00, 0x6c, 0x00, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x06, 0x00, 0x24, 0x00, 0x00, // .l...l...,...$..
+	0x00, 0xd0, 0x05, 0x00, 0x00, 0xbd, 0x01, 0x00, 0x00, 0xbd, 0x01, 0x00, 0x00, 0xbd, 0x01, 0x00, // ................
+	0x00, 0x2b, 0x00, 0x04, 0x00, 0x13, 0x00, 0x00, 0x00, 0x14, 0x06, 0x00, 0x00, 0x14, 0x00, 0x00, // .+..............
+	0x00, 0x2b, 0x00, 0x04, 0x00, 0x13, 0x00, 0x00, 0x00, 0x15, 0x06, 0x00, 0x00, 0x1e, 0x00, 0x00, // .+..............
+	0x00, 0x36, 0x00, 0x05, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // .6..............
+	0x00, 0x03, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x05, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, // .............;..
+	0x00, 0x0a, 0x01, 0x00, 0x00, 0xb3, 0x02, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, // .............;..
+	0x00, 0x2a, 0x01, 0x00, 0x00, 0xb8, 0x02, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, // .*...........;..
+	0x00, 0x37, 0x01, 0x00, 0x00, 0xba, 0x02, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, // .7...........;..
+	0x00, 0x37, 0x01, 0x00, 0x00, 0xc7, 0x02, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, // .7...........;..
+	0x00, 0x18, 0x00, 0x00, 0x00, 0xd3, 0x02, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, // .............;..
+	0x00, 0x18, 0x00, 0x00, 0x00, 0xd8, 0x02, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, // .............;..
+	0x00, 0x18, 0x00, 0x00, 0x00, 0xdc, 0x02, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, // .............;..
+	0x00, 0x18, 0x00, 0x00, 0x00, 0xe0, 0x02, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, // .............;..
+	0x00, 0x18, 0x00, 0x00, 0x00, 0xe4, 0x02, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, // .............;..
+	0x00, 0x18, 0x00, 0x00, 0x00, 0xe9, 0x02, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, // .............=..
+	0x00, 0x07, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, // .....>...=...=..
+	0x00, 0x14, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, // .....D...C...=..
+	0x00, 0x0b, 0x00, 0x00, 0x00, 0x8c, 0x02, 0x00, 0x00, 0x8b, 0x02, 0x00, 0x00, 0xf9, 0x00, 0x02, // ................
+	0x00, 0xf0, 0x02, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xf0, 0x02, 0x00, 0x00, 0xf6, 0x00, 0x04, // ................
+	0x00, 0xf1, 0x02, 0x00, 0x00, 0xf2, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, // ................
+	0x00, 0xf3, 0x02, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xf3, 0x02, 0x00, 0x00, 0x41, 0x00, 0x06, // .............A..
+	0x00, 0xc6, 0x00, 0x00, 0x00, 0xf5, 0x02, 0x00, 0x00, 0xc5, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, // .............F..
+	0x00, 0x5e, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0xf6, 0x02, 0x00, // .^...=..........
+	0x00, 0xf5, 0x02, 0x00, 0x00, 0x6e, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00, 0xf7, 0x02, 0x00, // .....n..........
+	0x00, 0xf6, 0x02, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, 0x00, 0xf9, 0x02, 0x00, // ................
+	0x00, 0xf7, 0x02, 0x00, 0x00, 0xcc, 0x00, 0x00, 0x00, 0x87, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, // ................
+	0x00, 0xfa, 0x02, 0x00, 0x00, 0xf9, 0x02, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, // .............Q..
+	0x00, 0x0a, 0x00, 0x00, 0x00, 0xfc, 0x02, 0x00, 0x00, 0x8c, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, // ................
+	0x00, 0xaf, 0x00, 0x05, 0x00, 0x5f, 0x00, 0x00, 0x00, 0xfe, 0x02, 0x00, 0x00, 0xfc, 0x02, 0x00, // ....._..........
+	0x00, 0xfa, 0x02, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, // .....Q..........
+	0x00, 0x8c, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xaf, 0x00, 0x05, 0x00, 0x5f, 0x00, 0x00, // ............._..
+	0x00, 0x02, 0x03, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0xfa, 0x02, 0x00, 0x00, 0xa6, 0x00, 0x05, // ................
+	0x00, 0x5f, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0xfe, 0x02, 0x00, 0x00, 0x02, 0x03, 0x00, // ._..............
+	0x00, 0xf7, 0x00, 0x03, 0x00, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, // ................
+	0x00, 0x03, 0x03, 0x00, 0x00, 0x05, 0x03, 0x00, 0x00, 0x04, 0x03, 0x00, 0x00, 0xf8, 0x00, 0x02, // ................
+	0x00, 0x05, 0x03, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0xf1, 0x02, 0x00, 0x00, 0xf8, 0x00, 0x02, // ................
+	0x00, 0x04, 0x03, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x06, 0x03, 0x00, 0x00, 0xf8, 0x00, 0x02, // ................
+	0x00, 0x06, 0x03, 0x00, 0x00, 0xf5, 0x00, 0x07, 0x00, 0x24, 0x00, 0x00, 0x00, 0xf0, 0x05, 0x00, // .........$......
+	0x00, 0xdd, 0x00, 0x00, 0x00, 0x04, 0x03, 0x00, 0x00, 0x36, 0x03, 0x00, 0x00, 0x0c, 0x03, 0x00, // .........6......
+	0x00, 0xf5, 0x00, 0x07, 0x00, 0x24, 0x00, 0x00, 0x00, 0xed, 0x05, 0x00, 0x00, 0xdf, 0x00, 0x00, // .....$..........
+	0x00, 0x04, 0x03, 0x00, 0x00, 0x3b, 0x03, 0x00, 0x00, 0x0c, 0x03, 0x00, 0x00, 0xf5, 0x00, 0x07, // .....;..........
+	0x00, 0x0a, 0x00, 0x00, 0x00, 0xd1, 0x05, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x04, 0x03, 0x00, // .........F......
+	0x00, 0x3d, 0x03, 0x00, 0x00, 0x0c, 0x03, 0x00, 0x00, 0xb1, 0x00, 0x05, 0x00, 0x5f, 0x00, 0x00, // .=..........._..
+	0x00, 0x0b, 0x03, 0x00, 0x00, 0xd1, 0x05, 0x00, 0x00, 0xe7, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x04, // ................
+	0x00, 0x07, 0x03, 0x00, 0x00, 0x0c, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, // ................
+	0x00, 0x0b, 0x03, 0x00, 0x00, 0x0c, 0x03, 0x00, 0x00, 0x07, 0x03, 0x00, 0x00, 0xf8, 0x00, 0x02, // ................
+	0x00, 0x0c, 0x03, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0e, 0x03, 0x00, // .....Q..........
+	0x00, 0x8c, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, // ................
+	0x00, 0x0f, 0x03, 0x00, 0x00, 0x0e, 0x03, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00, 0x8b, 0x00, 0x05, // ................
+	0x00, 0x0a, 0x00, 0x00, 0x00, 0x11, 0x03, 0x00, 0x00, 0xd1, 0x05, 0x00, 0x00, 0xce, 0x00, 0x00, // ................
+	0x00, 0x80, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x12, 0x03, 0x00, 0x00, 0x0f, 0x03, 0x00, // ................
+	0x00, 0x11, 0x03, 0x00, 0x00, 0x82, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x14, 0x03, 0x00, // ................
+	0x00, 0xf7, 0x02, 0x00, 0x00, 0xba, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x07, 0x00, 0x0a, 0x00, 0x00, // ................
+	0x00, 0x15, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x12, 0x03, 0x00, // .........'......
+	0x00, 0x14, 0x03, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x17, 0x03, 0x00, // .....Q..........
+	0x00, 0x8c, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, // ................
+	0x00, 0x18, 0x03, 0x00, 0x00, 0x17, 0x03, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00, 0x87, 0x00, 0x05, // ................
+	0x00, 0x0a, 0x00, 0x00, 0x00, 0x1a, 0x03, 0x00, 0x00, 0xd1, 0x05, 0x00, 0x00, 0xce, 0x00, 0x00, // ................
+	0x00, 0x80, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x1b, 0x03, 0x00, 0x00, 0x18, 0x03, 0x00, // ................
+	0x00, 0x1a, 0x03, 0x00, 0x00, 0x82, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x1d, 0x03, 0x00, // ................
+	0x00, 0xf7, 0x02, 0x00, 0x00, 0xba, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x07, 0x00, 0x0a, 0x00, 0x00, // ................
+	0x00, 0x1e, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x1b, 0x03, 0x00, // .........'......
+	0x00, 0x1d, 0x03, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x22, 0x03, 0x00, // .....Q......."..
+	0x00, 0x8c, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x50, 0x00, 0x06, 0x00, 0x0b, 0x00, 0x00, // .........P......
+	0x00, 0x23, 0x03, 0x00, 0x00, 0x15, 0x03, 0x00, 0x00, 0x1e, 0x03, 0x00, 0x00, 0x22, 0x03, 0x00, // .#..........."..
+	0x00, 0x5f, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x56, 0x04, 0x00, 0x00, 0x3e, 0x00, 0x00, // ._.......V...>..
+	0x00, 0x23, 0x03, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, // .#.......F...Q..
+	0x00, 0x06, 0x00, 0x00, 0x00, 0x28, 0x03, 0x00, 0x00, 0x56, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, // .....(...V......
+	0x00, 0x50, 0x00, 0x05, 0x00, 0x58, 0x00, 0x00, 0x00, 0x5a, 0x04, 0x00, 0x00, 0x28, 0x03, 0x00, // .P...X...Z...(..
+	0x00, 0x57, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x13, 0x00, 0x00, 0x00, 0x5b, 0x04, 0x00, // .W...........[..
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x5a, 0x04, 0x00, 0x00, 0xc7, 0x00, 0x05, // .....:...Z......
+	0x00, 0x13, 0x00, 0x00, 0x00, 0x5d, 0x04, 0x00, 0x00, 0x5b, 0x04, 0x00, 0x00, 0x5c, 0x00, 0x00, // .....]...[......
+	0x00, 0xab, 0x00, 0x05, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x5e, 0x04, 0x00, 0x00, 0x5d, 0x04, 0x00, // ....._...^...]..
+	0x00, 0x5e, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x07, 0x00, 0x13, 0x00, 0x00, 0x00, 0x60, 0x04, 0x00, // .^...........`..
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x5b, 0x04, 0x00, 0x00, 0x62, 0x00, 0x00, // .....&...[...b..
+	0x00, 0xa9, 0x00, 0x06, 0x00, 0x13, 0x00, 0x00, 0x00, 0x61, 0x04, 0x00, 0x00, 0x5e, 0x04, 0x00, // .........a...^..
+	0x00, 0x5e, 0x00, 0x00, 0x00, 0x60, 0x04, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, // .^...`...Q......
+	0x00, 0x2b, 0x03, 0x00, 0x00, 0x56, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05, // .+...V.......P..
+	0x00, 0x58, 0x00, 0x00, 0x00, 0x65, 0x04, 0x00, 0x00, 0x2b, 0x03, 0x00, 0x00, 0x57, 0x00, 0x00, // .X...e...+...W..
+	0x00, 0x0c, 0x00, 0x06, 0x00, 0x13, 0x00, 0x00, 0x00, 0x66, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, // .........f......
+	0x00, 0x3a, 0x00, 0x00, 0x00, 0x65, 0x04, 0x00, 0x00, 0xc7, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, // .:...e..........
+	0x00, 0x68, 0x04, 0x00, 0x00, 0x66, 0x04, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00, 0xab, 0x00, 0x05, // .h...f..........
+	0x00, 0x5f, 0x00, 0x00, 0x00, 0x69, 0x04, 0x00, 0x00, 0x68, 0x04, 0x00, 0x00, 0x5e, 0x00, 0x00, // ._...i...h...^..
+	0x00, 0x0c, 0x00, 0x07, 0x00, 0x13, 0x00, 0x00, 0x00, 0x6b, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, // .........k......
+	0x00, 0x26, 0x00, 0x00, 0x00, 0x66, 0x04, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x06, // .&...f...b......
+	0x00, 0x13, 0x00, 0x00, 0x00, 0x6c, 0x04, 0x00, 0x00, 0x69, 0x04, 0x00, 0x00, 0x5e, 0x00, 0x00, // .....l...i...^..
+	0x00, 0x6b, 0x04, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x2e, 0x03, 0x00, // .k...Q..........
+	0x00, 0x56, 0x04, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x50, 0x00, 0x05, 0x00, 0x58, 0x00, 0x00, // .V.......P...X..
+	0x00, 0x70, 0x04, 0x00, 0x00, 0x2e, 0x03, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x06, // .p.......W......
+	0x00, 0x13, 0x00, 0x00, 0x00, 0x71, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, // .....q.......:..
+	0x00, 0x70, 0x04, 0x00, 0x00, 0xc7, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, 0x00, 0x73, 0x04, 0x00, // .p...........s..
+	0x00, 0x71, 0x04, 0x00, 0x00, 0x5c, 0x00, 0x00, 0x00, 0xab, 0x00, 0x05, 0x00, 0x5f, 0x00, 0x00, // .q..........._..
+	0x00, 0x74, 0x04, 0x00, 0x00, 0x73, 0x04, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x07, // .t...s...^......
+	0x00, 0x13, 0x00, 0x00, 0x00, 0x76, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, // .....v.......&..
+	0x00, 0x71, 0x04, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x06, 0x00, 0x13, 0x00, 0x00, // .q...b..........
+	0x00, 0x77, 0x04, 0x00, 0x00, 0x74, 0x04, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x76, 0x04, 0x00, // .w...t...^...v..
+	0x00, 0x50, 0x00, 0x06, 0x00, 0x24, 0x00, 0x00, 0x00, 0x30, 0x03, 0x00, 0x00, 0x61, 0x04, 0x00, // .P...$...0...a..
+	0x00, 0x6c, 0x04, 0x00, 0x00, 0x77, 0x04, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x25, 0x00, 0x00, // .l...w...A...%..
+	0x00, 0x31, 0x03, 0x00, 0x00, 0xb3, 0x02, 0x00, 0x00, 0xd1, 0x05, 0x00, 0x00, 0x3e, 0x00, 0x03, // .1...........>..
+	0x00, 0x31, 0x03, 0x00, 0x00, 0x30, 0x03, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x25, 0x00, 0x00, // .1...0...A...%..
+	0x00, 0x34, 0x03, 0x00, 0x00, 0xb3, 0x02, 0x00, 0x00, 0xd1, 0x05, 0x00, 0x00, 0x3d, 0x00, 0x04, // .4...........=..
+	0x00, 0x24, 0x00, 0x00, 0x00, 0x35, 0x03, 0x00, 0x00, 0x34, 0x03, 0x00, 0x00, 0x0c, 0x00, 0x07, // .$...5...4......
+	0x00, 0x24, 0x00, 0x00, 0x00, 0x36, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, // .$...6.......&..
+	0x00, 0xf0, 0x05, 0x00, 0x00, 0x35, 0x03, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x25, 0x00, 0x00, // .....5...A...%..
+	0x00, 0x39, 0x03, 0x00, 0x00, 0xb3, 0x02, 0x00, 0x00, 0xd1, 0x05, 0x00, 0x00, 0x3d, 0x00, 0x04, // .9...........=..
+	0x00, 0x24, 0x00, 0x00, 0x00, 0x3a, 0x03, 0x00, 0x00, 0x39, 0x03, 0x00, 0x00, 0x0c, 0x00, 0x07, // .$...:...9......
+	0x00, 0x24, 0x00, 0x00, 0x00, 0x3b, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x29, 0x00, 0x00, // .$...;.......)..
+	0x00, 0xed, 0x05, 0x00, 0x00, 0x3a, 0x03, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, // .....:..........
+	0x00, 0x3d, 0x03, 0x00, 0x00, 0xd1, 0x05, 0x00, 0x00, 0xba, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, // .=..............
+	0x00, 0x06, 0x03, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x07, 0x03, 0x00, 0x00, 0x41, 0x00, 0x05, // .............A..
+	0x00, 0x25, 0x00, 0x00, 0x00, 0x3e, 0x03, 0x00, 0x00, 0xb8, 0x02, 0x00, 0x00, 0x46, 0x00, 0x00, // .%...>.......F..
+	0x00, 0x3e, 0x00, 0x03, 0x00, 0x3e, 0x03, 0x00, 0x00, 0xdf, 0x00, 0x00, 0x00, 0x41, 0x00, 0x05, // .>...>.......A..
+	0x00, 0x25, 0x00, 0x00, 0x00, 0x3f, 0x03, 0x00, 0x00, 0xb8, 0x02, 0x00, 0x00, 0xba, 0x00, 0x00, // .%...?..........
+	0x00, 0x3e, 0x00, 0x03, 0x00, 0x3f, 0x03, 0x00, 0x00, 0xdf, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, // .>...?..........
+	0x00, 0x40, 0x03, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x40, 0x03, 0x00, 0x00, 0xf5, 0x00, 0x07, // .@.......@......
+	0x00, 0x0a, 0x00, 0x00, 0x00, 0xd2, 0x05, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x07, 0x03, 0x00, // .........F......
+	0x00, 0x4a, 0x03, 0x00, 0x00, 0x46, 0x03, 0x00, 0x00, 0xb1, 0x00, 0x05, 0x00, 0x5f, 0x00, 0x00, // .J...F......._..
+	0x00, 0x45, 0x03, 0x00, 0x00, 0xd2, 0x05, 0x00, 0x00, 0xe7, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x04, // .E..............
+	0x00, 0x41, 0x03, 0x00, 0x00, 0x46, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, // .A...F..........
+	0x00, 0x45, 0x03, 0x00, 0x00, 0x46, 0x03, 0x00, 0x00, 0x41, 0x03, 0x00, 0x00, 0xf8, 0x00, 0x02, // .E...F...A......
+	0x00, 0x46, 0x03, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x48, 0x03, 0x00, // .F...A...*...H..
+	0x00, 0xba, 0x02, 0x00, 0x00, 0xd2, 0x05, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x48, 0x03, 0x00, // .........>...H..
+	0x00, 0x5e, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x4a, 0x03, 0x00, // .^...........J..
+	0x00, 0xd2, 0x05, 0x00, 0x00, 0xba, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x40, 0x03, 0x00, // .............@..
+	0x00, 0xf8, 0x00, 0x02, 0x00, 0x41, 0x03, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x4b, 0x03, 0x00, // .....A.......K..
+	0x00, 0xf8, 0x00, 0x02, 0x00, 0x4b, 0x03, 0x00, 0x00, 0xf5, 0x00, 0x07, 0x00, 0x06, 0x00, 0x00, // .....K..........
+	0x00, 0xf3, 0x05, 0x00, 0x00, 0x28, 0x01, 0x00, 0x00, 0x41, 0x03, 0x00, 0x00, 0x13, 0x06, 0x00, // .....(...A......
+	0x00, 0xdc, 0x03, 0x00, 0x00, 0xf5, 0x00, 0x07, 0x00, 0x13, 0x00, 0x00, 0x00, 0xd3, 0x05, 0x00, // ................
+	0x00, 0x5e, 0x00, 0x00, 0x00, 0x41, 0x03, 0x00, 0x00, 0xf4, 0x03, 0x00, 0x00, 0xdc, 0x03, 0x00, // .^...A..........
+	0x00, 0xb0, 0x00, 0x05, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x50, 0x03, 0x00, 0x00, 0xd3, 0x05, 0x00, // ....._...P......
+	0x00, 0x44, 0x01, 0x00, 0x00, 0xf6, 0x00, 0x04, 0x00, 0x4c, 0x03, 0x00, 0x00, 0xdc, 0x03, 0x00, // .D.......L......
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x50, 0x03, 0x00, 0x00, 0x51, 0x03, 0x00, // .........P...Q..
+	0x00, 0x4c, 0x03, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x51, 0x03, 0x00, 0x00, 0xc7, 0x00, 0x05, // .L.......Q......
+	0x00, 0x13, 0x00, 0x00, 0x00, 0x53, 0x03, 0x00, 0x00, 0xd3, 0x05, 0x00, 0x00, 0x7c, 0x00, 0x00, // .....S.......|..
+	0x00, 0xab, 0x00, 0x05, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x54, 0x03, 0x00, 0x00, 0x53, 0x03, 0x00, // ....._...T...S..
+	0x00, 0x5e, 0x00, 0x00, 0x00, 0xc7, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, 0x00, 0x56, 0x03, 0x00, // .^...........V..
+	0x00, 0xd3, 0x05, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0xab, 0x00, 0x05, 0x00, 0x5f, 0x00, 0x00, // ............._..
+	0x00, 0x57, 0x03, 0x00, 0x00, 0x56, 0x03, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, // .W...V...^...Q..
+	0x00, 0x13, 0x00, 0x00, 0x00, 0x5e, 0x03, 0x00, 0x00, 0xf0, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, // .....^..........
+	0x00, 0x51, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, 0x00, 0x63, 0x03, 0x00, 0x00, 0xed, 0x05, 0x00, // .Q.......c......
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, 0x00, 0x65, 0x03, 0x00, // .....Q.......e..
+	0x00, 0xf0, 0x05, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x06, 0x00, 0x13, 0x00, 0x00, // ................
+	0x00, 0x66, 0x03, 0x00, 0x00, 0x54, 0x03, 0x00, 0x00, 0x63, 0x03, 0x00, 0x00, 0x65, 0x03, 0x00, // .f...T...c...e..
+	0x00, 0x51, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, 0x00, 0x6a, 0x03, 0x00, 0x00, 0xed, 0x05, 0x00, // .Q.......j......
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, 0x00, 0x6c, 0x03, 0x00, // .....Q.......l..
+	0x00, 0xf0, 0x05, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x06, 0x00, 0x13, 0x00, 0x00, // ................
+	0x00, 0x6d, 0x03, 0x00, 0x00, 0x57, 0x03, 0x00, 0x00, 0x6a, 0x03, 0x00, 0x00, 0x6c, 0x03, 0x00, // .m...W...j...l..
+	0x00, 0x50, 0x00, 0x06, 0x00, 0x24, 0x00, 0x00, 0x00, 0x6e, 0x03, 0x00, 0x00, 0x5e, 0x03, 0x00, // .P...$...n...^..
+	0x00, 0x66, 0x03, 0x00, 0x00, 0x6d, 0x03, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, // .f...m...Q......
+	0x00, 0x74, 0x03, 0x00, 0x00, 0xed, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, // .t...........Q..
+	0x00, 0x13, 0x00, 0x00, 0x00, 0x79, 0x03, 0x00, 0x00, 0xf0, 0x05, 0x00, 0x00, 0x01, 0x00, 0x00, // .....y..........
+	0x00, 0x51, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, 0x00, 0x7b, 0x03, 0x00, 0x00, 0xed, 0x05, 0x00, // .Q.......{......
+	0x00, 0x01, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x06, 0x00, 0x13, 0x00, 0x00, 0x00, 0x7c, 0x03, 0x00, // .............|..
+	0x00, 0x54, 0x03, 0x00, 0x00, 0x79, 0x03, 0x00, 0x00, 0x7b, 0x03, 0x00, 0x00, 0x51, 0x00, 0x05, // .T...y...{...Q..
+	0x00, 0x13, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0xf0, 0x05, 0x00, 0x00, 0x02, 0x00, 0x00, // ................
+	0x00, 0x51, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, 0x00, 0x82, 0x03, 0x00, 0x00, 0xed, 0x05, 0x00, // .Q..............
+	0x00, 0x02, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x06, 0x00, 0x13, 0x00, 0x00, 0x00, 0x83, 0x03, 0x00, // ................
+	0x00, 0x57, 0x03, 0x00, 0x00, 0x80, 0x03, 0x00, 0x00, 0x82, 0x03, 0x00, 0x00, 0x50, 0x00, 0x06, // .W...........P..
+	0x00, 0x24, 0x00, 0x00, 0x00, 0x84, 0x03, 0x00, 0x00, 0x74, 0x03, 0x00, 0x00, 0x7c, 0x03, 0x00, // .$.......t...|..
+	0x00, 0x83, 0x03, 0x00, 0x00, 0x86, 0x00, 0x05, 0x00, 0x24, 0x00, 0x00, 0x00, 0x87, 0x03, 0x00, // .........$......
+	0x00, 0x6e, 0x03, 0x00, 0x00, 0xcd, 0x05, 0x00, 0x00, 0x0c, 0x00, 0x07, 0x00, 0x24, 0x00, 0x00, // .n...........$..
+	0x00, 0x88, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x87, 0x03, 0x00, // .........&......
+	0x00, 0x85, 0x01, 0x00, 0x00, 0x86, 0x00, 0x05, 0x00, 0x24, 0x00, 0x00, 0x00, 0x8c, 0x03, 0x00, // .........$......
+	0x00, 0x84, 0x03, 0x00, 0x00, 0xcd, 0x05, 0x00, 0x00, 0x0c, 0x00, 0x07, 0x00, 0x24, 0x00, 0x00, // .............$..
+	0x00, 0x8d, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x8c, 0x03, 0x00, // .........&......
+	0x00, 0x85, 0x01, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x24, 0x00, 0x00, 0x00, 0x7c, 0x04, 0x00, // .........$...|..
+	0x00, 0x88, 0x03, 0x00, 0x00, 0xce, 0x05, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x24, 0x00, 0x00, // .............$..
+	0x00, 0x7e, 0x04, 0x00, 0x00, 0x7c, 0x04, 0x00, 0x00, 0xcf, 0x05, 0x00, 0x00, 0x51, 0x00, 0x05, // .~...|.......Q..
+	0x00, 0x13, 0x00, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x88, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, // ................
+	0x00, 0xaa, 0x00, 0x05, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x81, 0x04, 0x00, 0x00, 0x80, 0x04, 0x00, // ....._..........
+	0x00, 0x5e, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, 0x00, 0x83, 0x04, 0x00, // .^...Q..........
+	0x00, 0x88, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x05, 0x00, 0x5f, 0x00, 0x00, // ............._..
+	0x00, 0x84, 0x04, 0x00, 0x00, 0x83, 0x04, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, // .........t...Q..
+	0x00, 0x13, 0x00, 0x00, 0x00, 0x86, 0x04, 0x00, 0x00, 0x7e, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, // .........~......
+	0x00, 0xa9, 0x00, 0x06, 0x00, 0x13, 0x00, 0x00, 0x00, 0x87, 0x04, 0x00, 0x00, 0x84, 0x04, 0x00, // ................
+	0x00, 0x76, 0x00, 0x00, 0x00, 0x86, 0x04, 0x00, 0x00, 0xa9, 0x00, 0x06, 0x00, 0x13, 0x00, 0x00, // .v..............
+	0x00, 0x88, 0x04, 0x00, 0x00, 0x81, 0x04, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x87, 0x04, 0x00, // .........^......
+	0x00, 0x52, 0x00, 0x06, 0x00, 0x24, 0x00, 0x00, 0x00, 0xb3, 0x05, 0x00, 0x00, 0x88, 0x04, 0x00, // .R...$..........
+	0x00, 0x7e, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, // .~.......Q......
+	0x00, 0x8b, 0x04, 0x00, 0x00, 0x88, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x05, // ................
+	0x00, 0x5f, 0x00, 0x00, 0x00, 0x8c, 0x04, 0x00, 0x00, 0x8b, 0x04, 0x00, 0x00, 0x5e, 0x00, 0x00, // ._...........^..
+	0x00, 0x51, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, 0x00, 0x8e, 0x04, 0x00, 0x00, 0x88, 0x03, 0x00, // .Q..............
+	0x00, 0x01, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x05, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x8f, 0x04, 0x00, // ........._......
+	0x00, 0x8e, 0x04, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, // .....t...Q......
+	0x00, 0x91, 0x04, 0x00, 0x00, 0x7e, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x06, // .....~..........
+	0x00, 0x13, 0x00, 0x00, 0x00, 0x92, 0x04, 0x00, 0x00, 0x8f, 0x04, 0x00, 0x00, 0x76, 0x00, 0x00, // .............v..
+	0x00, 0x91, 0x04, 0x00, 0x00, 0xa9, 0x00, 0x06, 0x00, 0x13, 0x00, 0x00, 0x00, 0x93, 0x04, 0x00, // ................
+	0x00, 0x8c, 0x04, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x92, 0x04, 0x00, 0x00, 0x52, 0x00, 0x06, // .....^.......R..
+	0x00, 0x24, 0x00, 0x00, 0x00, 0xb8, 0x05, 0x00, 0x00, 0x93, 0x04, 0x00, 0x00, 0xb3, 0x05, 0x00, // .$..............
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, 0x00, 0x96, 0x04, 0x00, // .....Q..........
+	0x00, 0x88, 0x03, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x05, 0x00, 0x5f, 0x00, 0x00, // ............._..
+	0x00, 0x97, 0x04, 0x00, 0x00, 0x96, 0x04, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, // .........^...Q..
+	0x00, 0x13, 0x00, 0x00, 0x00, 0x99, 0x04, 0x00, 0x00, 0x88, 0x03, 0x00, 0x00, 0x02, 0x00, 0x00, // ................
+	0x00, 0xaa, 0x00, 0x05, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x9a, 0x04, 0x00, 0x00, 0x99, 0x04, 0x00, // ....._..........
+	0x00, 0x74, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, 0x00, 0x9c, 0x04, 0x00, // .t...Q..........
+	0x00, 0x7e, 0x04, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x06, 0x00, 0x13, 0x00, 0x00, // .~..............
+	0x00, 0x9d, 0x04, 0x00, 0x00, 0x9a, 0x04, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x9c, 0x04, 0x00, // .........v......
+	0x00, 0xa9, 0x00, 0x06, 0x00, 0x13, 0x00, 0x00, 0x00, 0x9e, 0x04, 0x00, 0x00, 0x97, 0x04, 0x00, // ................
+	0x00, 0x5e, 0x00, 0x00, 0x00, 0x9d, 0x04, 0x00, 0x00, 0x52, 0x00, 0x06, 0x00, 0x24, 0x00, 0x00, // .^.......R...$..
+	0x00, 0xbd, 0x05, 0x00, 0x00, 0x9e, 0x04, 0x00, 0x00, 0xb8, 0x05, 0x00, 0x00, 0x02, 0x00, 0x00, // ................
+	0x00, 0x84, 0x00, 0x05, 0x00, 0x24, 0x00, 0x00, 0x00, 0xa5, 0x04, 0x00, 0x00, 0x8d, 0x03, 0x00, // .....$..........
+	0x00, 0xce, 0x05, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x24, 0x00, 0x00, 0x00, 0xa7, 0x04, 0x00, // .........$......
+	0x00, 0xa5, 0x04, 0x00, 0x00, 0xcf, 0x05, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, // .........Q......
+	0x00, 0xa9, 0x04, 0x00, 0x00, 0x8d, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x05, // ................
+	0x00, 0x5f, 0x00, 0x00, 0x00, 0xaa, 0x04, 0x00, 0x00, 0xa9, 0x04, 0x00, 0x00, 0x5e, 0x00, 0x00, // ._...........^..
+	0x00, 0x51, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, 0x00, 0xac, 0x04, 0x00, 0x00, 0x8d, 0x03, 0x00, // .Q..............
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x05, 0x00, 0x5f, 0x00, 0x00, 0x00, 0xad, 0x04, 0x00, // ........._......
+	0x00, 0xac, 0x04, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, // .....t...Q......
+	0x00, 0xaf, 0x04, 0x00, 0x00, 0xa7, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x06, // ................
+	0x00, 0x13, 0x00, 0x00, 0x00, 0xb0, 0x04, 0x00, 0x00, 0xad, 0x04, 0x00, 0x00, 0x76, 0x00, 0x00, // .............v..
+	0x00, 0xaf, 0x04, 0x00, 0x00, 0xa9, 0x00, 0x06, 0x00, 0x13, 0x00, 0x00, 0x00, 0xb1, 0x04, 0x00, // ................
+	0x00, 0xaa, 0x04, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0xb0, 0x04, 0x00, 0x00, 0x52, 0x00, 0x06, // .....^.......R..
+	0x00, 0x24, 0x00, 0x00, 0x00, 0xc2, 0x05, 0x00, 0x00, 0xb1, 0x04, 0x00, 0x00, 0xa7, 0x04, 0x00, // .$..............
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, 0x00, 0xb4, 0x04, 0x00, // .....Q..........
+	0x00, 0x8d, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x05, 0x00, 0x5f, 0x00, 0x00, // ............._..
+	0x00, 0xb5, 0x04, 0x00, 0x00, 0xb4, 0x04, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, // .........^...Q..
+	0x00, 0x13, 0x00, 0x00, 0x00, 0xb7, 0x04, 0x00, 0x00, 0x8d, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, // ................
+	0x00, 0xaa, 0x00, 0x05, 0x00, 0x5f, 0x00, 0x00, 0x00, 0xb8, 0x04, 0x00, 0x00, 0xb7, 0x04, 0x00, // ....._..........
+	0x00, 0x74, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, 0x00, 0xba, 0x04, 0x00, // .t...Q..........
+	0x00, 0xa7, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x06, 0x00, 0x13, 0x00, 0x00, // ................
+	0x00, 0xbb, 0x04, 0x00, 0x00, 0xb8, 0x04, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0xba, 0x04, 0x00, // .........v......
+	0x00, 0xa9, 0x00, 0x06, 0x00, 0x13, 0x00, 0x00, 0x00, 0xbc, 0x04, 0x00, 0x00, 0xb5, 0x04, 0x00, // ................
+	0x00, 0x5e, 0x00, 0x00, 0x00, 0xbb, 0x04, 0x00, 0x00, 0x52, 0x00, 0x06, 0x00, 0x24, 0x00, 0x00, // .^.......R...$..
+	0x00, 0xc7, 0x05, 0x00, 0x00, 0xbc, 0x04, 0x00, 0x00, 0xc2, 0x05, 0x00, 0x00, 0x01, 0x00, 0x00, // ................
+	0x00, 0x51, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, 0x00, 0xbf, 0x04, 0x00, 0x00, 0x8d, 0x03, 0x00, // .Q..............
+	0x00, 0x02, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x05, 0x00, 0x5f, 0x00, 0x00, 0x00, 0xc0, 0x04, 0x00, // ........._......
+	0x00, 0xbf, 0x04, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, // .....^...Q......
+	0x00, 0xc2, 0x04, 0x00, 0x00, 0x8d, 0x03, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x05, // ................
+	0x00, 0x5f, 0x00, 0x00, 0x00, 0xc3, 0x04, 0x00, 0x00, 0xc2, 0x04, 0x00, 0x00, 0x74, 0x00, 0x00, // ._...........t..
+	0x00, 0x51, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, 0x00, 0xc5, 0x04, 0x00, 0x00, 0xa7, 0x04, 0x00, // .Q..............
+	0x00, 0x02, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x06, 0x00, 0x13, 0x00, 0x00, 0x00, 0xc6, 0x04, 0x00, // ................
+	0x00, 0xc3, 0x04, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0xc5, 0x04, 0x00, 0x00, 0xa9, 0x00, 0x06, // .....v..........
+	0x00, 0x13, 0x00, 0x00, 0x00, 0xc7, 0x04, 0x00, 0x00, 0xc0, 0x04, 0x00, 0x00, 0x5e, 0x00, 0x00, // .............^..
+	0x00, 0xc6, 0x04, 0x00, 0x00, 0x52, 0x00, 0x06, 0x00, 0x24, 0x00, 0x00, 0x00, 0xcc, 0x05, 0x00, // .....R...$......
+	0x00, 0xc7, 0x04, 0x00, 0x00, 0xc7, 0x05, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, // ................
+	0x00, 0x95, 0x03, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x95, 0x03, 0x00, 0x00, 0xf5, 0x00, 0x07, // ................
+	0x00, 0x06, 0x00, 0x00, 0x00, 0xf5, 0x05, 0x00, 0x00, 0x57, 0x00, 0x00, 0x00, 0x51, 0x03, 0x00, // .........W...Q..
+	0x00, 0xd3, 0x03, 0x00, 0x00, 0x9f, 0x03, 0x00, 0x00, 0xf5, 0x00, 0x07, 0x00, 0x0a, 0x00, 0x00, // ................
+	0x00, 0xf1, 0x05, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x51, 0x03, 0x00, 0x00, 0xd5, 0x03, 0x00, // .....F...Q......
+	0x00, 0x9f, 0x03, 0x00, 0x00, 0xb1, 0x00, 0x05, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x9a, 0x03, 0x00, // ........._......
+	0x00, 0xf1, 0x05, 0x00, 0x00, 0xe7, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x04, 0x00, 0x96, 0x03, 0x00, // ................
+	0x00, 0x9f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x9a, 0x03, 0x00, // ................
+	0x00, 0x9b, 0x03, 0x00, 0x00, 0x96, 0x03, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x9b, 0x03, 0x00, // ................
+	0x00, 0x41, 0x00, 0x05, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x9d, 0x03, 0x00, 0x00, 0xc7, 0x02, 0x00, // .A...*..........
+	0x00, 0xf1, 0x05, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x9d, 0x03, 0x00, 0x00, 0x5e, 0x00, 0x00, // .....>.......^..
+	0x00, 0xf9, 0x00, 0x02, 0x00, 0x9e, 0x03, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x9e, 0x03, 0x00, // ................
+	0x00, 0xf5, 0x00, 0x07, 0x00, 0x06, 0x00, 0x00, 0x00, 0xfb, 0x05, 0x00, 0x00, 0x28, 0x01, 0x00, // .............(..
+	0x00, 0x9b, 0x03, 0x00, 0x00, 0x12, 0x06, 0x00, 0x00, 0xc9, 0x03, 0x00, 0x00, 0xf5, 0x00, 0x07, // ................
+	0x00, 0x13, 0x00, 0x00, 0x00, 0xfa, 0x05, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x9b, 0x03, 0x00, // .........^......
+	0x00, 0xd0, 0x03, 0x00, 0x00, 0xc9, 0x03, 0x00, 0x00, 0xb0, 0x00, 0x05, 0x00, 0x5f, 0x00, 0x00, // ............._..
+	0x00, 0xa3, 0x03, 0x00, 0x00, 0xfa, 0x05, 0x00, 0x00, 0x08, 0x01, 0x00, 0x00, 0xf6, 0x00, 0x04, // ................
+	0x00, 0x9f, 0x03, 0x00, 0x00, 0xc9, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, // ................
+	0x00, 0xa3, 0x03, 0x00, 0x00, 0xa4, 0x03, 0x00, 0x00, 0x9f, 0x03, 0x00, 0x00, 0xf8, 0x00, 0x02, // ................
+	0x00, 0xa4, 0x03, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, 0x00, 0xcc, 0x04, 0x00, // ................
+	0x00, 0xfa, 0x05, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, // .....i..........
+	0x00, 0xcd, 0x04, 0x00, 0x00, 0xcc, 0x04, 0x00, 0x00, 0x99, 0x00, 0x00, 0x00, 0x86, 0x00, 0x05, // ................
+	0x00, 0x13, 0x00, 0x00, 0x00, 0xce, 0x04, 0x00, 0x00, 0xcd, 0x04, 0x00, 0x00, 0x9b, 0x00, 0x00, // ................
+	0x00, 0x82, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, 0x00, 0xa8, 0x03, 0x00, 0x00, 0x69, 0x00, 0x00, // .............i..
+	0x00, 0xce, 0x04, 0x00, 0x00, 0x50, 0x00, 0x06, 0x00, 0x24, 0x00, 0x00, 0x00, 0xaa, 0x03, 0x00, // .....P...$......
+	0x00, 0xa8, 0x03, 0x00, 0x00, 0xa8, 0x03, 0x00, 0x00, 0xa8, 0x03, 0x00, 0x00, 0x84, 0x00, 0x05, // ................
+	0x00, 0x24, 0x00, 0x00, 0x00, 0xab, 0x03, 0x00, 0x00, 0xaa, 0x03, 0x00, 0x00, 0xbd, 0x05, 0x00, // .$..............
+	0x00, 0x50, 0x00, 0x06, 0x00, 0x24, 0x00, 0x00, 0x00, 0xae, 0x03, 0x00, 0x00, 0xce, 0x04, 0x00, // .P...$..........
+	0x00, 0xce, 0x04, 0x00, 0x00, 0xce, 0x04, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x24, 0x00, 0x00, // .............$..
+	0x00, 0xaf, 0x03, 0x00, 0x00, 0xae, 0x03, 0x00, 0x00, 0xcc, 0x05, 0x00, 0x00, 0x80, 0x00, 0x05, // ................
+	0x00, 0x24, 0x00, 0x00, 0x00, 0xb0, 0x03, 0x00, 0x00, 0xab, 0x03, 0x00, 0x00, 0xaf, 0x03, 0x00, // .$..............
+	0x00, 0x80, 0x00, 0x05, 0x00, 0x24, 0x00, 0x00, 0x00, 0xb2, 0x03, 0x00, 0x00, 0xb0, 0x03, 0x00, // .....$..........
+	0x00, 0xcf, 0x05, 0x00, 0x00, 0xc2, 0x00, 0x05, 0x00, 0x24, 0x00, 0x00, 0x00, 0xb4, 0x03, 0x00, // .........$......
+	0x00, 0xb2, 0x03, 0x00, 0x00, 0xd0, 0x05, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x24, 0x00, 0x00, // .............$..
+	0x00, 0xb7, 0x03, 0x00, 0x00, 0xb4, 0x03, 0x00, 0x00, 0xcd, 0x05, 0x00, 0x00, 0xc2, 0x00, 0x05, // ................
+	0x00, 0x24, 0x00, 0x00, 0x00, 0xb9, 0x03, 0x00, 0x00, 0xb7, 0x03, 0x00, 0x00, 0xd0, 0x05, 0x00, // .$..............
+	0x00, 0x70, 0x00, 0x04, 0x00, 0xc0, 0x01, 0x00, 0x00, 0xba, 0x03, 0x00, 0x00, 0xb9, 0x03, 0x00, // .p..............
+	0x00, 0x41, 0x00, 0x05, 0x00, 0x25, 0x00, 0x00, 0x00, 0xbc, 0x03, 0x00, 0x00, 0xb3, 0x02, 0x00, // .A...%..........
+	0x00, 0xf1, 0x05, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x24, 0x00, 0x00, 0x00, 0xbd, 0x03, 0x00, // .....=...$......
+	0x00, 0xbc, 0x03, 0x00, 0x00, 0x70, 0x00, 0x04, 0x00, 0xc0, 0x01, 0x00, 0x00, 0xbe, 0x03, 0x00, // .....p..........
+	0x00, 0xbd, 0x03, 0x00, 0x00, 0x83, 0x00, 0x05, 0x00, 0xc0, 0x01, 0x00, 0x00, 0xbf, 0x03, 0x00, // ................
+	0x00, 0xba, 0x03, 0x00, 0x00, 0xbe, 0x03, 0x00, 0x00, 0x94, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, // ................
+	0x00, 0xc2, 0x03, 0x00, 0x00, 0xbf, 0x03, 0x00, 0x00, 0xbf, 0x03, 0x00, 0x00, 0xb8, 0x00, 0x05, // ................
+	0x00, 0x5f, 0x00, 0x00, 0x00, 0xc4, 0x03, 0x00, 0x00, 0xfb, 0x05, 0x00, 0x00, 0x57, 0x00, 0x00, // ._...........W..
+	0x00, 0xb8, 0x00, 0x05, 0x00, 0x5f, 0x00, 0x00, 0x00, 0xc7, 0x03, 0x00, 0x00, 0xc2, 0x03, 0x00, // ....._..........
+	0x00, 0xfb, 0x05, 0x00, 0x00, 0xa6, 0x00, 0x05, 0x00, 0x5f, 0x00, 0x00, 0x00, 0xc8, 0x03, 0x00, // ........._......
+	0x00, 0xc4, 0x03, 0x00, 0x00, 0xc7, 0x03, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0xc9, 0x03, 0x00, // ................
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0xc8, 0x03, 0x00, 0x00, 0xca, 0x03, 0x00, // ................
+	0x00, 0xc9, 0x03, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xca, 0x03, 0x00, 0x00, 0x41, 0x00, 0x05, // .............A..
+	0x00, 0x2a, 0x00, 0x00, 0x00, 0xce, 0x03, 0x00, 0x00, 0xc7, 0x02, 0x00, 0x00, 0xf1, 0x05, 0x00, // .*..............
+	0x00, 0x3e, 0x00, 0x03, 0x00, 0xce, 0x03, 0x00, 0x00, 0xfa, 0x05, 0x00, 0x00, 0xf9, 0x00, 0x02, // .>..............
+	0x00, 0xc9, 0x03, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xc9, 0x03, 0x00, 0x00, 0xa9, 0x00, 0x06, // ................
+	0x00, 0x06, 0x00, 0x00, 0x00, 0x12, 0x06, 0x00, 0x00, 0xc8, 0x03, 0x00, 0x00, 0xc2, 0x03, 0x00, // ................
+	0x00, 0xfb, 0x05, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, 0x00, 0xd0, 0x03, 0x00, // ................
+	0x00, 0xfa, 0x05, 0x00, 0x00, 0xba, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x9e, 0x03, 0x00, // ................
+	0x00, 0xf8, 0x00, 0x02, 0x00, 0x9f, 0x03, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, // ................
+	0x00, 0xd3, 0x03, 0x00, 0x00, 0xf5, 0x05, 0x00, 0x00, 0xfb, 0x05, 0x00, 0x00, 0x80, 0x00, 0x05, // ................
+	0x00, 0x0a, 0x00, 0x00, 0x00, 0xd5, 0x03, 0x00, 0x00, 0xf1, 0x05, 0x00, 0x00, 0xba, 0x00, 0x00, // ................
+	0x00, 0xf9, 0x00, 0x02, 0x00, 0x95, 0x03, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x96, 0x03, 0x00, // ................
+	0x00, 0xb8, 0x00, 0x05, 0x00, 0x5f, 0x00, 0x00, 0x00, 0xd7, 0x03, 0x00, 0x00, 0xf3, 0x05, 0x00, // ....._..........
+	0x00, 0x57, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x05, 0x00, 0x5f, 0x00, 0x00, 0x00, 0xda, 0x03, 0x00, // .W......._......
+	0x00, 0xf5, 0x05, 0x00, 0x00, 0xf3, 0x05, 0x00, 0x00, 0xa6, 0x00, 0x05, 0x00, 0x5f, 0x00, 0x00, // ............._..
+	0x00, 0xdb, 0x03, 0x00, 0x00, 0xd7, 0x03, 0x00, 0x00, 0xda, 0x03, 0x00, 0x00, 0xf7, 0x00, 0x03, // ................
+	0x00, 0xdc, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0xdb, 0x03, 0x00, // ................
+	0x00, 0xdd, 0x03, 0x00, 0x00, 0xdc, 0x03, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xdd, 0x03, 0x00, // ................
+	0x00, 0x41, 0x00, 0x05, 0x00, 0x25, 0x00, 0x00, 0x00, 0xe1, 0x03, 0x00, 0x00, 0xb8, 0x02, 0x00, // .A...%..........
+	0x00, 0x46, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0xe1, 0x03, 0x00, 0x00, 0x88, 0x03, 0x00, // .F...>..........
+	0x00, 0x41, 0x00, 0x05, 0x00, 0x25, 0x00, 0x00, 0x00, 0xe4, 0x03, 0x00, 0x00, 0xb8, 0x02, 0x00, // .A...%..........
+	0x00, 0xba, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0xe4, 0x03, 0x00, 0x00, 0x8d, 0x03, 0x00, // .....>..........
+	0x00, 0xf9, 0x00, 0x02, 0x00, 0xe5, 0x03, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xe5, 0x03, 0x00, // ................
+	0x00, 0xf5, 0x00, 0x07, 0x00, 0x0a, 0x00, 0x00, 0x00, 0xf6, 0x05, 0x00, 0x00, 0x46, 0x00, 0x00, // .............F..
+	0x00, 0xdd, 0x03, 0x00, 0x00, 0xf2, 0x03, 0x00, 0x00, 0xeb, 0x03, 0x00, 0x00, 0xb1, 0x00, 0x05, // ................
+	0x00, 0x5f, 0x00, 0x00, 0x00, 0xea, 0x03, 0x00, 0x00, 0xf6, 0x05, 0x00, 0x00, 0xe7, 0x00, 0x00, // ._..............
+	0x00, 0xf6, 0x00, 0x04, 0x00, 0xe6, 0x03, 0x00, 0x00, 0xeb, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, // ................
+	0x00, 0xfa, 0x00, 0x04, 0x00, 0xea, 0x03, 0x00, 0x00, 0xeb, 0x03, 0x00, 0x00, 0xe6, 0x03, 0x00, // ................
+	0x00, 0xf8, 0x00, 0x02, 0x00, 0xeb, 0x03, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x2a, 0x00, 0x00, // .........A...*..
+	0x00, 0xee, 0x03, 0x00, 0x00, 0xc7, 0x02, 0x00, 0x00, 0xf6, 0x05, 0x00, 0x00, 0x3d, 0x00, 0x04, // .............=..
+	0x00, 0x13, 0x00, 0x00, 0x00, 0xef, 0x03, 0x00, 0x00, 0xee, 0x03, 0x00, 0x00, 0x41, 0x00, 0x05, // .............A..
+	0x00, 0x2a, 0x00, 0x00, 0x00, 0xf0, 0x03, 0x00, 0x00, 0xba, 0x02, 0x00, 0x00, 0xf6, 0x05, 0x00, // .*..............
+	0x00, 0x3e, 0x00, 0x03, 0x00, 0xf0, 0x03, 0x00, 0x00, 0xef, 0x03, 0x00, 0x00, 0x80, 0x00, 0x05, // .>..............
+	0x00, 0x0a, 0x00, 0x00, 0x00, 0xf2, 0x03, 0x00, 0x00, 0xf6, 0x05, 0x00, 0x00, 0xba, 0x00, 0x00, // ................
+	0x00, 0xf9, 0x00, 0x02, 0x00, 0xe5, 0x03, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xe6, 0x03, 0x00, // ................
+	0x00, 0xf9, 0x00, 0x02, 0x00, 0xdc, 0x03, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xdc, 0x03, 0x00, // ................
+	0x00, 0xa9, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00, 0x13, 0x06, 0x00, 0x00, 0xdb, 0x03, 0x00, // ................
+	0x00, 0xf5, 0x05, 0x00, 0x00, 0xf3, 0x05, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, // ................
+	0x00, 0xf4, 0x03, 0x00, 0x00, 0xd3, 0x05, 0x00, 0x00, 0xba, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, // ................
+	0x00, 0x4b, 0x03, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x4c, 0x03, 0x00, 0x00, 0x41, 0x00, 0x05, // .K.......L...A..
+	0x00, 0x2a, 0x00, 0x00, 0x00, 0xf5, 0x03, 0x00, 0x00, 0xba, 0x02, 0x00, 0x00, 0x46, 0x00, 0x00, // .*...........F..
+	0x00, 0x3d, 0x00, 0x04, 0x00, 0x13, 0x00, 0x00, 0x00, 0xf6, 0x03, 0x00, 0x00, 0xf5, 0x03, 0x00, // .=..............
+	0x00, 0xae, 0x00, 0x05, 0x00, 0x5f, 0x00, 0x00, 0x00, 0xf7, 0x03, 0x00, 0x00, 0xf6, 0x03, 0x00, // ....._..........
+	0x00, 0x07, 0x02, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0xf8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, // ................
+	0x00, 0xfa, 0x00, 0x04, 0x00, 0xf7, 0x03, 0x00, 0x00, 0xf9, 0x03, 0x00, 0x00, 0xf8, 0x03, 0x00, // ................
+	0x00, 0xf8, 0x00, 0x02, 0x00, 0xf9, 0x03, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x25, 0x00, 0x00, // .........A...%..
+	0x00, 0xfa, 0x03, 0x00, 0x00, 0xb8, 0x02, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, // .........F...=..
+	0x00, 0x24, 0x00, 0x00, 0x00, 0xfb, 0x03, 0x00, 0x00, 0xfa, 0x03, 0x00, 0x00, 0x41, 0x00, 0x05, // .$...........A..
+	0x00, 0x25, 0x00, 0x00, 0x00, 0xfc, 0x03, 0x00, 0x00, 0xb8, 0x02, 0x00, 0x00, 0xba, 0x00, 0x00, // .%..............
+	0x00, 0x3d, 0x00, 0x04, 0x00, 0x24, 0x00, 0x00, 0x00, 0xfd, 0x03, 0x00, 0x00, 0xfc, 0x03, 0x00, // .=...$..........
+	0x00, 0x41, 0x00, 0x05, 0x00, 0x25, 0x00, 0x00, 0x00, 0xfe, 0x03, 0x00, 0x00, 0xb8, 0x02, 0x00, // .A...%..........
+	0x00, 0x46, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0xfe, 0x03, 0x00, 0x00, 0xfd, 0x03, 0x00, // .F...>..........
+	0x00, 0x41, 0x00, 0x05, 0x00, 0x25, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0xb8, 0x02, 0x00, // .A...%..........
+	0x00, 0xba, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x00, 0x04, 0x00, 0x00, 0xfb, 0x03, 0x00, // .....>..........
+	0x00, 0xf9, 0x00, 0x02, 0x00, 0x01, 0x04, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x01, 0x04, 0x00, // ................
+	0x00, 0xf5, 0x00, 0x07, 0x00, 0x0a, 0x00, 0x00, 0x00, 0xd4, 0x05, 0x00, 0x00, 0x46, 0x00, 0x00, // .............F..
+	0x00, 0xf9, 0x03, 0x00, 0x00, 0x0f, 0x04, 0x00, 0x00, 0x07, 0x04, 0x00, 0x00, 0xb1, 0x00, 0x05, // ................
+	0x00, 0x5f, 0x00, 0x00, 0x00, 0x06, 0x04, 0x00, 0x00, 0xd4, 0x05, 0x00, 0x00, 0xe7, 0x00, 0x00, // ._..............
+	0x00, 0xf6, 0x00, 0x04, 0x00, 0x02, 0x04, 0x00, 0x00, 0x07, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, // ................
+	0x00, 0xfa, 0x00, 0x04, 0x00, 0x06, 0x04, 0x00, 0x00, 0x07, 0x04, 0x00, 0x00, 0x02, 0x04, 0x00, // ................
+	0x00, 0xf8, 0x00, 0x02, 0x00, 0x07, 0x04, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x2a, 0x00, 0x00, // .........A...*..
+	0x00, 0x0a, 0x04, 0x00, 0x00, 0xba, 0x02, 0x00, 0x00, 0xd4, 0x05, 0x00, 0x00, 0x3d, 0x00, 0x04, // .............=..
+	0x00, 0x13, 0x00, 0x00, 0x00, 0x0b, 0x04, 0x00, 0x00, 0x0a, 0x04, 0x00, 0x00, 0x82, 0x00, 0x05, // ................
+	0x00, 0x13, 0x00, 0x00, 0x00, 0x0c, 0x04, 0x00, 0x00, 0x9b, 0x00, 0x00, 0x00, 0x0b, 0x04, 0x00, // ................
+	0x00, 0x41, 0x00, 0x05, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x0d, 0x04, 0x00, 0x00, 0xba, 0x02, 0x00, // .A...*..........
+	0x00, 0xd4, 0x05, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x0d, 0x04, 0x00, 0x00, 0x0c, 0x04, 0x00, // .....>..........
+	0x00, 0x80, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x0f, 0x04, 0x00, 0x00, 0xd4, 0x05, 0x00, // ................
+	0x00, 0xba, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x01, 0x04, 0x00, 0x00, 0xf8, 0x00, 0x02, // ................
+	0x00, 0x02, 0x04, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0xf8, 0x03, 0x00, 0x00, 0xf8, 0x00, 0x02, // ................
+	0x00, 0xf8, 0x03, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0xd3, 0x02, 0x00, 0x00, 0x24, 0x02, 0x00, // .....>.......$..
+	0x00, 0xf9, 0x00, 0x02, 0x00, 0xd1, 0x04, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xd1, 0x04, 0x00, // ................
+	0x00, 0xf5, 0x00, 0x07, 0x00, 0x13, 0x00, 0x00, 0x00, 0xd5, 0x05, 0x00, 0x00, 0x5e, 0x00, 0x00, // .............^..
+	0x00, 0xf8, 0x03, 0x00, 0x00, 0xea, 0x04, 0x00, 0x00, 0xd8, 0x04, 0x00, 0x00, 0xb0, 0x00, 0x05, // ................
+	0x00, 0x5f, 0x00, 0x00, 0x00, 0xd7, 0x04, 0x00, 0x00, 0xd5, 0x05, 0x00, 0x00, 0x27, 0x02, 0x00, // ._...........'..
+	0x00, 0xf6, 0x00, 0x04, 0x00, 0xd2, 0x04, 0x00, 0x00, 0xd8, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, // ................
+	0x00, 0xfa, 0x00, 0x04, 0x00, 0xd7, 0x04, 0x00, 0x00, 0xd8, 0x04, 0x00, 0x00, 0xd2, 0x04, 0x00, // ................
+	0x00, 0xf8, 0x00, 0x02, 0x00, 0xd8, 0x04, 0x00, 0x00, 0x86, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, // ................
+	0x00, 0xdd, 0x04, 0x00, 0x00, 0xd5, 0x05, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x05, // .........l......
+	0x00, 0x13, 0x00, 0x00, 0x00, 0xe0, 0x04, 0x00, 0x00, 0x26, 0x02, 0x00, 0x00, 0xd5, 0x05, 0x00, // .........&......
+	0x00, 0xc7, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, 0x00, 0xe1, 0x04, 0x00, 0x00, 0xe0, 0x04, 0x00, // ................
+	0x00, 0x7c, 0x00, 0x00, 0x00, 0x89, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, 0x00, 0xe3, 0x04, 0x00, // .|..............
+	0x00, 0xd5, 0x05, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0xc4, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, // .....l..........
+	0x00, 0xe4, 0x04, 0x00, 0x00, 0xe1, 0x04, 0x00, 0x00, 0xe3, 0x04, 0x00, 0x00, 0x41, 0x00, 0x05, // .............A..
+	0x00, 0x2a, 0x00, 0x00, 0x00, 0xe5, 0x04, 0x00, 0x00, 0xd3, 0x02, 0x00, 0x00, 0xdd, 0x04, 0x00, // .*..............
+	0x00, 0x3d, 0x00, 0x04, 0x00, 0x13, 0x00, 0x00, 0x00, 0xe6, 0x04, 0x00, 0x00, 0xe5, 0x04, 0x00, // .=..............
+	0x00, 0xc5, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, 0x00, 0xe7, 0x04, 0x00, 0x00, 0xe6, 0x04, 0x00, // ................
+	0x00, 0xe4, 0x04, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x2a, 0x00, 0x00, 0x00, 0xe8, 0x04, 0x00, // .....A...*......
+	0x00, 0xd3, 0x02, 0x00, 0x00, 0xdd, 0x04, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0xe8, 0x04, 0x00, // .........>......
+	0x00, 0xe7, 0x04, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, 0x00, 0xea, 0x04, 0x00, // ................
+	0x00, 0xd5, 0x05, 0x00, 0x00, 0xba, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0xd1, 0x04, 0x00, // ................
+	0x00, 0xf8, 0x00, 0x02, 0x00, 0xd2, 0x04, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x17, 0x00, 0x00, // .........=......
+	0x00, 0x13, 0x04, 0x00, 0x00, 0xd3, 0x02, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x15, 0x04, 0x00, // ................
+	0x00, 0xf8, 0x00, 0x02, 0x00, 0x15, 0x04, 0x00, 0x00, 0xf5, 0x00, 0x07, 0x00, 0x13, 0x00, 0x00, // ................
+	0x00, 0xd9, 0x05, 0x00, 0x00, 0x27, 0x02, 0x00, 0x00, 0xd2, 0x04, 0x00, 0x00, 0x4a, 0x05, 0x00, // .....'.......J..
+	0x00, 0x2f, 0x05, 0x00, 0x00, 0xf5, 0x00, 0x07, 0x00, 0x17, 0x00, 0x00, 0x00, 0xd8, 0x05, 0x00, // ./..............
+	0x00, 0x13, 0x04, 0x00, 0x00, 0xd2, 0x04, 0x00, 0x00, 0x32, 0x04, 0x00, 0x00, 0x2f, 0x05, 0x00, // .........2.../..
+	0x00, 0xf5, 0x00, 0x07, 0x00, 0x0a, 0x00, 0x00, 0x00, 0xd7, 0x05, 0x00, 0x00, 0x46, 0x00, 0x00, // .............F..
+	0x00, 0xd2, 0x04, 0x00, 0x00, 0x35, 0x04, 0x00, 0x00, 0x2f, 0x05, 0x00, 0x00, 0xb1, 0x00, 0x05, // .....5.../......
+	0x00, 0x5f, 0x00, 0x00, 0x00, 0x1a, 0x04, 0x00, 0x00, 0xd7, 0x05, 0x00, 0x00, 0x38, 0x02, 0x00, // ._...........8..
+	0x00, 0xf6, 0x00, 0x04, 0x00, 0x16, 0x04, 0x00, 0x00, 0x2f, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, // ........./......
+	0x00, 0xfa, 0x00, 0x04, 0x00, 0x1a, 0x04, 0x00, 0x00, 0x1b, 0x04, 0x00, 0x00, 0x16, 0x04, 0x00, // ................
+	0x00, 0xf8, 0x00, 0x02, 0x00, 0x1b, 0x04, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0xd8, 0x02, 0x00, // .........>......
+	0x00, 0xd8, 0x05, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x1f, 0x04, 0x00, // .....A...*......
+	0x00, 0xb8, 0x02, 0x00, 0x00, 0xd7, 0x05, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, // .........^...=..
+	0x00, 0x13, 0x00, 0x00, 0x00, 0x20, 0x04, 0x00, 0x00, 0x1f, 0x04, 0x00, 0x00, 0xf9, 0x00, 0x02, // ..... ..........
+	0x00, 0xf0, 0x04, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xf0, 0x04, 0x00, 0x00, 0xf5, 0x00, 0x07, // ................
+	0x00, 0x13, 0x00, 0x00, 0x00, 0xe2, 0x05, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x1b, 0x04, 0x00, // .........^......
+	0x00, 0x09, 0x05, 0x00, 0x00, 0xf7, 0x04, 0x00, 0x00, 0xb0, 0x00, 0x05, 0x00, 0x5f, 0x00, 0x00, // ............._..
+	0x00, 0xf6, 0x04, 0x00, 0x00, 0xe2, 0x05, 0x00, 0x00, 0x3b, 0x02, 0x00, 0x00, 0xf6, 0x00, 0x04, // .........;......
+	0x00, 0xf1, 0x04, 0x00, 0x00, 0xf7, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, // ................
+	0x00, 0xf6, 0x04, 0x00, 0x00, 0xf7, 0x04, 0x00, 0x00, 0xf1, 0x04, 0x00, 0x00, 0xf8, 0x00, 0x02, // ................
+	0x00, 0xf7, 0x04, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, 0x00, 0xfa, 0x04, 0x00, // ................
+	0x00, 0xd9, 0x05, 0x00, 0x00, 0xe2, 0x05, 0x00, 0x00, 0x86, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, // ................
+	0x00, 0xfc, 0x04, 0x00, 0x00, 0xfa, 0x04, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x05, // .........l......
+	0x00, 0x13, 0x00, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0x20, 0x04, 0x00, 0x00, 0xe2, 0x05, 0x00, // ......... ......
+	0x00, 0xc7, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0xff, 0x04, 0x00, // ................
+	0x00, 0x7c, 0x00, 0x00, 0x00, 0x89, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, 0x00, 0x02, 0x05, 0x00, // .|..............
+	0x00, 0xfa, 0x04, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0xc4, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, // .....l..........
+	0x00, 0x03, 0x05, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x02, 0x05, 0x00, 0x00, 0x41, 0x00, 0x05, // .............A..
+	0x00, 0x2a, 0x00, 0x00, 0x00, 0x04, 0x05, 0x00, 0x00, 0xd8, 0x02, 0x00, 0x00, 0xfc, 0x04, 0x00, // .*..............
+	0x00, 0x3d, 0x00, 0x04, 0x00, 0x13, 0x00, 0x00, 0x00, 0x05, 0x05, 0x00, 0x00, 0x04, 0x05, 0x00, // .=..............
+	0x00, 0xc5, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, 0x00, 0x06, 0x05, 0x00, 0x00, 0x05, 0x05, 0x00, // ................
+	0x00, 0x03, 0x05, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x07, 0x05, 0x00, // .....A...*......
+	0x00, 0xd8, 0x02, 0x00, 0x00, 0xfc, 0x04, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x07, 0x05, 0x00, // .........>......
+	0x00, 0x06, 0x05, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, 0x00, 0x09, 0x05, 0x00, // ................
+	0x00, 0xe2, 0x05, 0x00, 0x00, 0xba, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0xf0, 0x04, 0x00, // ................
+	0x00, 0xf8, 0x00, 0x02, 0x00, 0xf1, 0x04, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, // ................
+	0x00, 0x0c, 0x05, 0x00, 0x00, 0xd9, 0x05, 0x00, 0x00, 0x3b, 0x02, 0x00, 0x00, 0x3d, 0x00, 0x04, // .........;...=..
+	0x00, 0x17, 0x00, 0x00, 0x00, 0x22, 0x04, 0x00, 0x00, 0xd8, 0x02, 0x00, 0x00, 0x3e, 0x00, 0x03, // .....".......>..
+	0x00, 0xdc, 0x02, 0x00, 0x00, 0x22, 0x04, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00, 0x2a, 0x00, 0x00, // ....."...A...*..
+	0x00, 0x27, 0x04, 0x00, 0x00, 0xb8, 0x02, 0x00, 0x00, 0xd7, 0x05, 0x00, 0x00, 0x7c, 0x00, 0x00, // .'...........|..
+	0x00, 0x3d, 0x00, 0x04, 0x00, 0x13, 0x00, 0x00, 0x00, 0x28, 0x04, 0x00, 0x00, 0x27, 0x04, 0x00, // .=.......(...'..
+	0x00, 0xf9, 0x00, 0x02, 0x00, 0x0f, 0x05, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x0f, 0x05, 0x00, // ................
+	0x00, 0xf5, 0x00, 0x07, 0x00, 0x13, 0x00, 0x00, 0x00, 0xe5, 0x05, 0x00, 0x00, 0x5e, 0x00, 0x00, // .............^..
+	0x00, 0xf1, 0x04, 0x00, 0x00, 0x28, 0x05, 0x00, 0x00, 0x16, 0x05, 0x00, 0x00, 0xb0, 0x00, 0x05, // .....(..........
+	0x00, 0x5f, 0x00, 0x00, 0x00, 0x15, 0x05, 0x00, 0x00, 0xe5, 0x05, 0x00, 0x00, 0x3b, 0x02, 0x00, // ._...........;..
+	0x00, 0xf6, 0x00, 0x04, 0x00, 0x10, 0x05, 0x00, 0x00, 0x16, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, // ................
+	0x00, 0xfa, 0x00, 0x04, 0x00, 0x15, 0x05, 0x00, 0x00, 0x16, 0x05, 0x00, 0x00, 0x10, 0x05, 0x00, // ................
+	0x00, 0xf8, 0x00, 0x02, 0x00, 0x16, 0x05, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, // ................
+	0x00, 0x19, 0x05, 0x00, 0x00, 0x0c, 0x05, 0x00, 0x00, 0xe5, 0x05, 0x00, 0x00, 0x86, 0x00, 0x05, // ................
+	0x00, 0x13, 0x00, 0x00, 0x00, 0x1b, 0x05, 0x00, 0x00, 0x19, 0x05, 0x00, 0x00, 0x6c, 0x00, 0x00, // .............l..
+	0x00, 0xc2, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, 0x00, 0x1e, 0x05, 0x00, 0x00, 0x28, 0x04, 0x00, // .............(..
+	0x00, 0xe5, 0x05, 0x00, 0x00, 0xc7, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, 0x00, 0x1f, 0x05, 0x00, // ................
+	0x00, 0x1e, 0x05, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x89, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, // .....|..........
+	0x00, 0x21, 0x05, 0x00, 0x00, 0x19, 0x05, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0xc4, 0x00, 0x05, // .!.......l......
+	0x00, 0x13, 0x00, 0x00, 0x00, 0x22, 0x05, 0x00, 0x00, 0x1f, 0x05, 0x00, 0x00, 0x21, 0x05, 0x00, // .....".......!..
+	0x00, 0x41, 0x00, 0x05, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x23, 0x05, 0x00, 0x00, 0xdc, 0x02, 0x00, // .A...*...#......
+	0x00, 0x1b, 0x05, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x13, 0x00, 0x00, 0x00, 0x24, 0x05, 0x00, // .....=.......$..
+	0x00, 0x23, 0x05, 0x00, 0x00, 0xc5, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, 0x00, 0x25, 0x05, 0x00, // .#...........%..
+	0x00, 0x24, 0x05, 0x00, 0x00, 0x22, 0x05, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x2a, 0x00, 0x00, // .$..."...A...*..
+	0x00, 0x26, 0x05, 0x00, 0x00, 0xdc, 0x02, 0x00, 0x00, 0x1b, 0x05, 0x00, 0x00, 0x3e, 0x00, 0x03, // .&...........>..
+	0x00, 0x26, 0x05, 0x00, 0x00, 0x25, 0x05, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, // .&...%..........
+	0x00, 0x28, 0x05, 0x00, 0x00, 0xe5, 0x05, 0x00, 0x00, 0xba, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, // .(..............
+	0x00, 0x0f, 0x05, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x10, 0x05, 0x00, 0x00, 0x80, 0x00, 0x05, // ................
+	0x00, 0x13, 0x00, 0x00, 0x00, 0x2b, 0x05, 0x00, 0x00, 0xd9, 0x05, 0x00, 0x00, 0x14, 0x06, 0x00, // .....+..........
+	0x00, 0x3d, 0x00, 0x04, 0x00, 0x17, 0x00, 0x00, 0x00, 0x2a, 0x04, 0x00, 0x00, 0xdc, 0x02, 0x00, // .=.......*......
+	0x00, 0x3e, 0x00, 0x03, 0x00, 0xe0, 0x02, 0x00, 0x00, 0x2a, 0x04, 0x00, 0x00, 0x41, 0x00, 0x06, // .>.......*...A..
+	0x00, 0x2a, 0x00, 0x00, 0x00, 0x2f, 0x04, 0x00, 0x00, 0xb8, 0x02, 0x00, 0x00, 0xd7, 0x05, 0x00, // .*.../..........
+	0x00, 0x88, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x13, 0x00, 0x00, 0x00, 0x30, 0x04, 0x00, // .....=.......0..
+	0x00, 0x2f, 0x04, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x2e, 0x05, 0x00, 0x00, 0xf8, 0x00, 0x02, // ./..............
+	0x00, 0x2e, 0x05, 0x00, 0x00, 0xf5, 0x00, 0x07, 0x00, 0x13, 0x00, 0x00, 0x00, 0xe8, 0x05, 0x00, // ................
+	0x00, 0x5e, 0x00, 0x00, 0x00, 0x10, 0x05, 0x00, 0x00, 0x47, 0x05, 0x00, 0x00, 0x35, 0x05, 0x00, // .^.......G...5..
+	0x00, 0xb0, 0x00, 0x05, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x34, 0x05, 0x00, 0x00, 0xe8, 0x05, 0x00, // ....._...4......
+	0x00, 0x3b, 0x02, 0x00, 0x00, 0xf6, 0x00, 0x04, 0x00, 0x2f, 0x05, 0x00, 0x00, 0x35, 0x05, 0x00, // .;......./...5..
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x34, 0x05, 0x00, 0x00, 0x35, 0x05, 0x00, // .........4...5..
+	0x00, 0x2f, 0x05, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x35, 0x05, 0x00, 0x00, 0x80, 0x00, 0x05, // ./.......5......
+	0x00, 0x13, 0x00, 0x00, 0x00, 0x38, 0x05, 0x00, 0x00, 0x2b, 0x05, 0x00, 0x00, 0xe8, 0x05, 0x00, // .....8...+......
+	0x00, 0x86, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, 0x00, 0x3a, 0x05, 0x00, 0x00, 0x38, 0x05, 0x00, // .........:...8..
+	0x00, 0x6c, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, 0x00, 0x3d, 0x05, 0x00, // .l...........=..
+	0x00, 0x30, 0x04, 0x00, 0x00, 0xe8, 0x05, 0x00, 0x00, 0xc7, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, // .0..............
+	0x00, 0x3e, 0x05, 0x00, 0x00, 0x3d, 0x05, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x89, 0x00, 0x05, // .>...=...|......
+	0x00, 0x13, 0x00, 0x00, 0x00, 0x40, 0x05, 0x00, 0x00, 0x38, 0x05, 0x00, 0x00, 0x6c, 0x00, 0x00, // .....@...8...l..
+	0x00, 0xc4, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, 0x00, 0x41, 0x05, 0x00, 0x00, 0x3e, 0x05, 0x00, // .........A...>..
+	0x00, 0x40, 0x05, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x42, 0x05, 0x00, // .@...A...*...B..
+	0x00, 0xe0, 0x02, 0x00, 0x00, 0x3a, 0x05, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x13, 0x00, 0x00, // .....:...=......
+	0x00, 0x43, 0x05, 0x00, 0x00, 0x42, 0x05, 0x00, 0x00, 0xc5, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, // .C...B..........
+	0x00, 0x44, 0x05, 0x00, 0x00, 0x43, 0x05, 0x00, 0x00, 0x41, 0x05, 0x00, 0x00, 0x41, 0x00, 0x05, // .D...C...A...A..
+	0x00, 0x2a, 0x00, 0x00, 0x00, 0x45, 0x05, 0x00, 0x00, 0xe0, 0x02, 0x00, 0x00, 0x3a, 0x05, 0x00, // .*...E.......:..
+	0x00, 0x3e, 0x00, 0x03, 0x00, 0x45, 0x05, 0x00, 0x00, 0x44, 0x05, 0x00, 0x00, 0x80, 0x00, 0x05, // .>...E...D......
+	0x00, 0x13, 0x00, 0x00, 0x00, 0x47, 0x05, 0x00, 0x00, 0xe8, 0x05, 0x00, 0x00, 0xba, 0x00, 0x00, // .....G..........
+	0x00, 0xf9, 0x00, 0x02, 0x00, 0x2e, 0x05, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x2f, 0x05, 0x00, // ............./..
+	0x00, 0x80, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, 0x00, 0x4a, 0x05, 0x00, 0x00, 0xd9, 0x05, 0x00, // .........J......
+	0x00, 0x15, 0x06, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x17, 0x00, 0x00, 0x00, 0x32, 0x04, 0x00, // .....=.......2..
+	0x00, 0xe0, 0x02, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x35, 0x04, 0x00, // .............5..
+	0x00, 0xd7, 0x05, 0x00, 0x00, 0xba, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x15, 0x04, 0x00, // ................
+	0x00, 0xf8, 0x00, 0x02, 0x00, 0x16, 0x04, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0xe4, 0x02, 0x00, // .........>......
+	0x00, 0xd8, 0x05, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x38, 0x04, 0x00, // .....A...*...8..
+	0x00, 0xba, 0x02, 0x00, 0x00, 0x46, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x13, 0x00, 0x00, // .....F...=......
+	0x00, 0x39, 0x04, 0x00, 0x00, 0x38, 0x04, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x4d, 0x05, 0x00, // .9...8.......M..
+	0x00, 0xf8, 0x00, 0x02, 0x00, 0x4d, 0x05, 0x00, 0x00, 0xf5, 0x00, 0x07, 0x00, 0x13, 0x00, 0x00, // .....M..........
+	0x00, 0xda, 0x05, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x16, 0x04, 0x00, 0x00, 0x66, 0x05, 0x00, // .....^.......f..
+	0x00, 0x54, 0x05, 0x00, 0x00, 0xb0, 0x00, 0x05, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x53, 0x05, 0x00, // .T......._...S..
+	0x00, 0xda, 0x05, 0x00, 0x00, 0x26, 0x02, 0x00, 0x00, 0xf6, 0x00, 0x04, 0x00, 0x4e, 0x05, 0x00, // .....&.......N..
+	0x00, 0x54, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x53, 0x05, 0x00, // .T...........S..
+	0x00, 0x54, 0x05, 0x00, 0x00, 0x4e, 0x05, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x54, 0x05, 0x00, // .T...N.......T..
+	0x00, 0x80, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, 0x00, 0x57, 0x05, 0x00, 0x00, 0xd9, 0x05, 0x00, // .........W......
+	0x00, 0xda, 0x05, 0x00, 0x00, 0x86, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, 0x00, 0x59, 0x05, 0x00, // .............Y..
+	0x00, 0x57, 0x05, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, // .W...l..........
+	0x00, 0x5c, 0x05, 0x00, 0x00, 0x39, 0x04, 0x00, 0x00, 0xda, 0x05, 0x00, 0x00, 0xc7, 0x00, 0x05, // .....9..........
+	0x00, 0x13, 0x00, 0x00, 0x00, 0x5d, 0x05, 0x00, 0x00, 0x5c, 0x05, 0x00, 0x00, 0x7c, 0x00, 0x00, // .....].......|..
+	0x00, 0x89, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, 0x00, 0x5f, 0x05, 0x00, 0x00, 0x57, 0x05, 0x00, // ........._...W..
+	0x00, 0x6c, 0x00, 0x00, 0x00, 0xc4, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, 0x00, 0x60, 0x05, 0x00, // .l...........`..
+	0x00, 0x5d, 0x05, 0x00, 0x00, 0x5f, 0x05, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x2a, 0x00, 0x00, // .]..._...A...*..
+	0x00, 0x61, 0x05, 0x00, 0x00, 0xe4, 0x02, 0x00, 0x00, 0x59, 0x05, 0x00, 0x00, 0x3d, 0x00, 0x04, // .a.......Y...=..
+	0x00, 0x13, 0x00, 0x00, 0x00, 0x62, 0x05, 0x00, 0x00, 0x61, 0x05, 0x00, 0x00, 0xc5, 0x00, 0x05, // .....b...a......
+	0x00, 0x13, 0x00, 0x00, 0x00, 0x63, 0x05, 0x00, 0x00, 0x62, 0x05, 0x00, 0x00, 0x60, 0x05, 0x00, // .....c...b...`..
+	0x00, 0x41, 0x00, 0x05, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x64, 0x05, 0x00, 0x00, 0xe4, 0x02, 0x00, // .A...*...d......
+	0x00, 0x59, 0x05, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x64, 0x05, 0x00, 0x00, 0x63, 0x05, 0x00, // .Y...>...d...c..
+	0x00, 0x80, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, 0x00, 0x66, 0x05, 0x00, 0x00, 0xda, 0x05, 0x00, // .........f......
+	0x00, 0xba, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x4d, 0x05, 0x00, 0x00, 0xf8, 0x00, 0x02, // .........M......
+	0x00, 0x4e, 0x05, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, 0x00, 0x69, 0x05, 0x00, // .N...........i..
+	0x00, 0xd9, 0x05, 0x00, 0x00, 0x26, 0x02, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x17, 0x00, 0x00, // .....&...=......
+	0x00, 0x3b, 0x04, 0x00, 0x00, 0xe4, 0x02, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x3d, 0x04, 0x00, // .;...........=..
+	0x00, 0xf8, 0x00, 0x02, 0x00, 0x3d, 0x04, 0x00, 0x00, 0xf5, 0x00, 0x07, 0x00, 0x13, 0x00, 0x00, // .....=..........
+	0x00, 0xde, 0x05, 0x00, 0x00, 0x69, 0x05, 0x00, 0x00, 0x4e, 0x05, 0x00, 0x00, 0x88, 0x05, 0x00, // .....i...N......
+	0x00, 0x6d, 0x05, 0x00, 0x00, 0xf5, 0x00, 0x07, 0x00, 0x17, 0x00, 0x00, 0x00, 0xdd, 0x05, 0x00, // .m..............
+	0x00, 0x3b, 0x04, 0x00, 0x00, 0x4e, 0x05, 0x00, 0x00, 0x4a, 0x04, 0x00, 0x00, 0x6d, 0x05, 0x00, // .;...N...J...m..
+	0x00, 0xf5, 0x00, 0x07, 0x00, 0x0a, 0x00, 0x00, 0x00, 0xdc, 0x05, 0x00, 0x00, 0xba, 0x00, 0x00, // ................
+	0x00, 0x4e, 0x05, 0x00, 0x00, 0x4d, 0x04, 0x00, 0x00, 0x6d, 0x05, 0x00, 0x00, 0xb1, 0x00, 0x05, // .N...M...m......
+	0x00, 0x5f, 0x00, 0x00, 0x00, 0x42, 0x04, 0x00, 0x00, 0xdc, 0x05, 0x00, 0x00, 0xe7, 0x00, 0x00, // ._...B..........
+	0x00, 0xf6, 0x00, 0x04, 0x00, 0x3e, 0x04, 0x00, 0x00, 0x6d, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, // .....>...m......
+	0x00, 0xfa, 0x00, 0x04, 0x00, 0x42, 0x04, 0x00, 0x00, 0x43, 0x04, 0x00, 0x00, 0x3e, 0x04, 0x00, // .....B...C...>..
+	0x00, 0xf8, 0x00, 0x02, 0x00, 0x43, 0x04, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0xe9, 0x02, 0x00, // .....C...>......
+	0x00, 0xdd, 0x05, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x47, 0x04, 0x00, // .....A...*...G..
+	0x00, 0xba, 0x02, 0x00, 0x00, 0xdc, 0x05, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x13, 0x00, 0x00, // .........=......
+	0x00, 0x48, 0x04, 0x00, 0x00, 0x47, 0x04, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x6c, 0x05, 0x00, // .H...G.......l..
+	0x00, 0xf8, 0x00, 0x02, 0x00, 0x6c, 0x05, 0x00, 0x00, 0xf5, 0x00, 0x07, 0x00, 0x13, 0x00, 0x00, // .....l..........
+	0x00, 0xdf, 0x05, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x43, 0x04, 0x00, 0x00, 0x85, 0x05, 0x00, // .....^...C......
+	0x00, 0x73, 0x05, 0x00, 0x00, 0xb0, 0x00, 0x05, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x72, 0x05, 0x00, // .s......._...r..
+	0x00, 0xdf, 0x05, 0x00, 0x00, 0x44, 0x01, 0x00, 0x00, 0xf6, 0x00, 0x04, 0x00, 0x6d, 0x05, 0x00, // .....D.......m..
+	0x00, 0x73, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x72, 0x05, 0x00, // .s...........r..
+	0x00, 0x73, 0x05, 0x00, 0x00, 0x6d, 0x05, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x73, 0x05, 0x00, // .s...m.......s..
+	0x00, 0x80, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, 0x00, 0x76, 0x05, 0x00, 0x00, 0xde, 0x05, 0x00, // .........v......
+	0x00, 0xdf, 0x05, 0x00, 0x00, 0x86, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, 0x00, 0x78, 0x05, 0x00, // .............x..
+	0x00, 0x76, 0x05, 0x00, 0x00, 0x6c, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, // .v...l..........
+	0x00, 0x7b, 0x05, 0x00, 0x00, 0x48, 0x04, 0x00, 0x00, 0xdf, 0x05, 0x00, 0x00, 0xc7, 0x00, 0x05, // .{...H..........
+	0x00, 0x13, 0x00, 0x00, 0x00, 0x7c, 0x05, 0x00, 0x00, 0x7b, 0x05, 0x00, 0x00, 0x7c, 0x00, 0x00, // .....|...{...|..
+	0x00, 0x89, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, 0x00, 0x7e, 0x05, 0x00, 0x00, 0x76, 0x05, 0x00, // .........~...v..
+	0x00, 0x6c, 0x00, 0x00, 0x00, 0xc4, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, 0x00, 0x7f, 0x05, 0x00, // .l..............
+	0x00, 0x7c, 0x05, 0x00, 0x00, 0x7e, 0x05, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x2a, 0x00, 0x00, // .|...~...A...*..
+	0x00, 0x80, 0x05, 0x00, 0x00, 0xe9, 0x02, 0x00, 0x00, 0x78, 0x05, 0x00, 0x00, 0x3d, 0x00, 0x04, // .........x...=..
+	0x00, 0x13, 0x00, 0x00, 0x00, 0x81, 0x05, 0x00, 0x00, 0x80, 0x05, 0x00, 0x00, 0xc5, 0x00, 0x05, // ................
+	0x00, 0x13, 0x00, 0x00, 0x00, 0x82, 0x05, 0x00, 0x00, 0x81, 0x05, 0x00, 0x00, 0x7f, 0x05, 0x00, // ................
+	0x00, 0x41, 0x00, 0x05, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x83, 0x05, 0x00, 0x00, 0xe9, 0x02, 0x00, // .A...*..........
+	0x00, 0x78, 0x05, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0x83, 0x05, 0x00, 0x00, 0x82, 0x05, 0x00, // .x...>..........
+	0x00, 0x80, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, 0x00, 0x85, 0x05, 0x00, 0x00, 0xdf, 0x05, 0x00, // ................
+	0x00, 0xba, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x6c, 0x05, 0x00, 0x00, 0xf8, 0x00, 0x02, // .........l......
+	0x00, 0x6d, 0x05, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x13, 0x00, 0x00, 0x00, 0x88, 0x05, 0x00, // .m..............
+	0x00, 0xde, 0x05, 0x00, 0x00, 0x44, 0x01, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x17, 0x00, 0x00, // .....D...=......
+	0x00, 0x4a, 0x04, 0x00, 0x00, 0xe9, 0x02, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, // .J..............
+	0x00, 0x4d, 0x04, 0x00, 0x00, 0xdc, 0x05, 0x00, 0x00, 0xba, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, // .M..............
+	0x00, 0x3d, 0x04, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x3e, 0x04, 0x00, 0x00, 0x63, 0x00, 0x04, // .=.......>...c..
+	0x00, 0x44, 0x00, 0x00, 0x00, 0x8c, 0x02, 0x00, 0x00, 0xdd, 0x05, 0x00, 0x00, 0xf9, 0x00, 0x02, // .D..............
+	0x00, 0xf1, 0x02, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xf2, 0x02, 0x00, 0x00, 0xf9, 0x00, 0x02, // ................
+	0x00, 0xf0, 0x02, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xf1, 0x02, 0x00, 0x00, 0xfd, 0x00, 0x01, // ................
+	0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00,                                           // .8.......
+};
+
+static const uint8_t bc6h_shader_compute_mtl[7724] =
+{
+	0x43, 0x53, 0x48, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x0a, 0x75, // CSH............u
+	0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x02, 0x01, 0x00, 0x00, 0x01, 0x00, 0x07, // _settings.......
+	0x73, 0x5f, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, // s_input.........
+	0x00, 0x01, 0x00, 0xf1, 0x1d, 0x00, 0x00, 0x23, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x20, // .......#include 
+	0x3c, 0x6d, 0x65, 0x74, 0x61, 0x6c, 0x5f, 0x73, 0x74, 0x64, 0x6c, 0x69, 0x62, 0x3e, 0x0a, 0x23, // <metal_stdlib>.#
+	0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x20, 0x3c, 0x73, 0x69, 0x6d, 0x64, 0x2f, 0x73, 0x69, // include <simd/si
+	0x6d, 0x64, 0x2e, 0x68, 0x3e, 0x0a, 0x0a, 0x75, 0x73, 0x69, 0x6e, 0x67, 0x20, 0x6e, 0x61, 0x6d, // md.h>..using nam
+	0x65, 0x73, 0x70, 0x61, 0x63, 0x65, 0x20, 0x6d, 0x65, 0x74, 0x61, 0x6c, 0x3b, 0x0a, 0x0a, 0x73, // espace metal;..s
+	0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x5f, 0x47, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x0a, 0x7b, 0x0a, // truct _Global.{.
+	0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x20, 0x75, 0x5f, 0x73, 0x65, 0x74, //     float4 u_set
+	0x74, 0x69, 0x6e, 0x67, 0x73, 0x3b, 0x0a, 0x7d, 0x3b, 0x0a, 0x0a, 0x6b, 0x65, 0x72, 0x6e, 0x65, // tings;.};..kerne
+	0x6c, 0x20, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x78, 0x6c, 0x61, 0x74, 0x4d, 0x74, 0x6c, 0x4d, 0x61, // l void xlatMtlMa
+	0x69, 0x6e, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x20, 0x5f, 0x47, 0x6c, 0x6f, // in(constant _Glo
+	0x62, 0x61, 0x6c, 0x26, 0x20, 0x5f, 0x6d, 0x74, 0x6c, 0x5f, 0x75, 0x20, 0x5b, 0x5b, 0x62, 0x75, // bal& _mtl_u [[bu
+	0x66, 0x66, 0x65, 0x72, 0x28, 0x30, 0x29, 0x5d, 0x5d, 0x2c, 0x20, 0x74, 0x65, 0x78, 0x74, 0x75, // ffer(0)]], textu
+	0x72, 0x65, 0x32, 0x64, 0x5f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x3c, 0x66, 0x6c, 0x6f, 0x61, 0x74, // re2d_array<float
+	0x3e, 0x20, 0x73, 0x5f, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x5b, 0x5b, 0x74, 0x65, 0x78, 0x74, // > s_input [[text
+	0x75, 0x72, 0x65, 0x28, 0x30, 0x29, 0x5d, 0x5d, 0x2c, 0x20, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, // ure(0)]], textur
+	0x65, 0x32, 0x64, 0x5f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x3c, 0x75, 0x69, 0x6e, 0x74, 0x2c, 0x20, // e2d_array<uint, 
+	0x61, 0x63, 0x63, 0x65, 0x73, 0x73, 0x3a, 0x3a, 0x77, 0x72, 0x69, 0x74, 0x65, 0x3e, 0x20, 0x73, // access::write> s
+	0x5f, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x54, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x20, 0x5b, // _outputTexture [
+	0x5b, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x28, 0x31, 0x29, 0x5d, 0x5d, 0x2c, 0x20, 0x75, // [texture(1)]], u
+	0x69, 0x6e, 0x74, 0x33, 0x20, 0x67, 0x6c, 0x5f, 0x47, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x49, 0x6e, // int3 gl_GlobalIn
+	0x76, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x49, 0x44, 0x20, 0x5b, 0x5b, 0x74, 0x68, 0x72, // vocationID [[thr
+	0x65, 0x61, 0x64, 0x5f, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x69, 0x6e, 0x5f, // ead_position_in_
+	0x67, 0x72, 0x69, 0x64, 0x5d, 0x5d, 0x29, 0x0a, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, // grid]]).{.    fo
+	0x72, 0x20, 0x28, 0x3b, 0x3b, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, // r (;;).    {.   
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x37, 0x35, 0x39, 0x20, 0x3d, 0x20, //      int _759 = 
+	0x69, 0x6e, 0x74, 0x28, 0x5f, 0x6d, 0x74, 0x6c, 0x5f, 0x75, 0x2e, 0x75, 0x5f, 0x73, 0x65, 0x74, // int(_mtl_u.u_set
+	0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x78, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // tings.x);.      
+	0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x37, 0x36, 0x32, 0x20, 0x3d, 0x20, 0x28, 0x5f, 0x37, //   int _762 = (_7
+	0x35, 0x39, 0x20, 0x2b, 0x20, 0x33, 0x29, 0x20, 0x2f, 0x20, 0x34, 0x3b, 0x0a, 0x20, 0x20, 0x20, // 59 + 3) / 4;.   
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x28, 0x69, 0x6e, 0x74, 0x33, 0x28, 0x67, //      if ((int3(g
+	0x6c, 0x5f, 0x47, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x49, 0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, 0x69, // l_GlobalInvocati
+	0x6f, 0x6e, 0x49, 0x44, 0x29, 0x2e, 0x78, 0x20, 0x3e, 0x3d, 0x20, 0x5f, 0x37, 0x36, 0x32, 0x29, // onID).x >= _762)
+	0x20, 0x7c, 0x7c, 0x20, 0x28, 0x69, 0x6e, 0x74, 0x33, 0x28, 0x67, 0x6c, 0x5f, 0x47, 0x6c, 0x6f, //  || (int3(gl_Glo
+	0x62, 0x61, 0x6c, 0x49, 0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x49, 0x44, 0x29, // balInvocationID)
+	0x2e, 0x79, 0x20, 0x3e, 0x3d, 0x20, 0x5f, 0x37, 0x36, 0x32, 0x29, 0x29, 0x0a, 0x20, 0x20, 0x20, // .y >= _762)).   
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //      {.         
+	0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //    break;.      
+	0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, //   }.        uint
+	0x33, 0x20, 0x5f, 0x31, 0x35, 0x31, 0x37, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 3 _1517;.       
+	0x20, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x20, 0x5f, 0x31, 0x35, 0x32, 0x30, 0x3b, 0x0a, 0x20, 0x20, //  uint3 _1520;.  
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x31, 0x35, 0x32, 0x30, 0x20, 0x3d, 0x20, 0x75, 0x69, //       _1520 = ui
+	0x6e, 0x74, 0x33, 0x28, 0x33, 0x31, 0x37, 0x34, 0x33, 0x75, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, // nt3(31743u);.   
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x31, 0x35, 0x31, 0x37, 0x20, 0x3d, 0x20, 0x75, 0x69, 0x6e, //      _1517 = uin
+	0x74, 0x33, 0x28, 0x30, 0x75, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // t3(0u);.        
+	0x75, 0x69, 0x6e, 0x74, 0x33, 0x20, 0x5f, 0x36, 0x39, 0x31, 0x5b, 0x31, 0x36, 0x5d, 0x3b, 0x0a, // uint3 _691[16];.
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x69, 0x6e, 0x74, //         for (int
+	0x20, 0x5f, 0x31, 0x34, 0x38, 0x39, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x20, 0x5f, 0x31, 0x34, 0x38, //  _1489 = 0; _148
+	0x39, 0x20, 0x3c, 0x20, 0x31, 0x36, 0x3b, 0x20, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 9 < 16; ).      
+	0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //   {.            
+	0x69, 0x6e, 0x74, 0x33, 0x20, 0x5f, 0x38, 0x30, 0x33, 0x20, 0x3d, 0x20, 0x69, 0x6e, 0x74, 0x33, // int3 _803 = int3
+	0x28, 0x6d, 0x69, 0x6e, 0x28, 0x28, 0x28, 0x69, 0x6e, 0x74, 0x33, 0x28, 0x67, 0x6c, 0x5f, 0x47, // (min(((int3(gl_G
+	0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x49, 0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x49, // lobalInvocationI
+	0x44, 0x29, 0x2e, 0x78, 0x20, 0x2a, 0x20, 0x34, 0x29, 0x20, 0x2b, 0x20, 0x28, 0x5f, 0x31, 0x34, // D).x * 4) + (_14
+	0x38, 0x39, 0x20, 0x25, 0x20, 0x34, 0x29, 0x29, 0x2c, 0x20, 0x28, 0x5f, 0x37, 0x35, 0x39, 0x20, // 89 % 4)), (_759 
+	0x2d, 0x20, 0x31, 0x29, 0x29, 0x2c, 0x20, 0x6d, 0x69, 0x6e, 0x28, 0x28, 0x28, 0x69, 0x6e, 0x74, // - 1)), min(((int
+	0x33, 0x28, 0x67, 0x6c, 0x5f, 0x47, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x49, 0x6e, 0x76, 0x6f, 0x63, // 3(gl_GlobalInvoc
+	0x61, 0x74, 0x69, 0x6f, 0x6e, 0x49, 0x44, 0x29, 0x2e, 0x79, 0x20, 0x2a, 0x20, 0x34, 0x29, 0x20, // ationID).y * 4) 
+	0x2b, 0x20, 0x28, 0x5f, 0x31, 0x34, 0x38, 0x39, 0x20, 0x2f, 0x20, 0x34, 0x29, 0x29, 0x2c, 0x20, // + (_1489 / 4)), 
+	0x28, 0x5f, 0x37, 0x35, 0x39, 0x20, 0x2d, 0x20, 0x31, 0x29, 0x29, 0x2c, 0x20, 0x69, 0x6e, 0x74, // (_759 - 1)), int
+	0x33, 0x28, 0x67, 0x6c, 0x5f, 0x47, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x49, 0x6e, 0x76, 0x6f, 0x63, // 3(gl_GlobalInvoc
+	0x61, 0x74, 0x69, 0x6f, 0x6e, 0x49, 0x44, 0x29, 0x2e, 0x7a, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, // ationID).z);.   
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x20, //          float4 
+	0x5f, 0x31, 0x31, 0x31, 0x30, 0x20, 0x3d, 0x20, 0x73, 0x5f, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x2e, // _1110 = s_input.
+	0x72, 0x65, 0x61, 0x64, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x32, 0x28, 0x5f, 0x38, 0x30, 0x33, 0x2e, // read(uint2(_803.
+	0x78, 0x79, 0x29, 0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x28, 0x5f, 0x38, 0x30, 0x33, 0x2e, 0x7a, // xy), uint(_803.z
+	0x29, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // ), 0);.         
+	0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x31, 0x31, 0x31, 0x35, 0x20, 0x3d, 0x20, //    uint _1115 = 
+	0x61, 0x73, 0x5f, 0x74, 0x79, 0x70, 0x65, 0x3c, 0x75, 0x69, 0x6e, 0x74, 0x3e, 0x28, 0x68, 0x61, // as_type<uint>(ha
+	0x6c, 0x66, 0x32, 0x28, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x32, 0x28, 0x5f, 0x31, 0x31, 0x31, 0x30, // lf2(float2(_1110
+	0x2e, 0x78, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x29, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, // .x, 0.0)));.    
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x31, 0x31, //         uint _11
+	0x32, 0x36, 0x20, 0x3d, 0x20, 0x61, 0x73, 0x5f, 0x74, 0x79, 0x70, 0x65, 0x3c, 0x75, 0x69, 0x6e, // 26 = as_type<uin
+	0x74, 0x3e, 0x28, 0x68, 0x61, 0x6c, 0x66, 0x32, 0x28, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x32, 0x28, // t>(half2(float2(
+	0x5f, 0x31, 0x31, 0x31, 0x30, 0x2e, 0x79, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x29, 0x29, 0x29, 0x3b, // _1110.y, 0.0)));
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, // .            uin
+	0x74, 0x20, 0x5f, 0x31, 0x31, 0x33, 0x37, 0x20, 0x3d, 0x20, 0x61, 0x73, 0x5f, 0x74, 0x79, 0x70, // t _1137 = as_typ
+	0x65, 0x3c, 0x75, 0x69, 0x6e, 0x74, 0x3e, 0x28, 0x68, 0x61, 0x6c, 0x66, 0x32, 0x28, 0x66, 0x6c, // e<uint>(half2(fl
+	0x6f, 0x61, 0x74, 0x32, 0x28, 0x5f, 0x31, 0x31, 0x31, 0x30, 0x2e, 0x7a, 0x2c, 0x20, 0x30, 0x2e, // oat2(_1110.z, 0.
+	0x30, 0x29, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 0)));.          
+	0x20, 0x20, 0x5f, 0x36, 0x39, 0x31, 0x5b, 0x5f, 0x31, 0x34, 0x38, 0x39, 0x5d, 0x20, 0x3d, 0x20, //   _691[_1489] = 
+	0x75, 0x69, 0x6e, 0x74, 0x33, 0x28, 0x28, 0x28, 0x5f, 0x31, 0x31, 0x31, 0x35, 0x20, 0x26, 0x20, // uint3(((_1115 & 
+	0x33, 0x32, 0x37, 0x36, 0x38, 0x75, 0x29, 0x20, 0x21, 0x3d, 0x20, 0x30, 0x75, 0x29, 0x20, 0x3f, // 32768u) != 0u) ?
+	0x20, 0x30, 0x75, 0x20, 0x3a, 0x20, 0x6d, 0x69, 0x6e, 0x28, 0x5f, 0x31, 0x31, 0x31, 0x35, 0x2c, //  0u : min(_1115,
+	0x20, 0x33, 0x31, 0x37, 0x34, 0x33, 0x75, 0x29, 0x2c, 0x20, 0x28, 0x28, 0x5f, 0x31, 0x31, 0x32, //  31743u), ((_112
+	0x36, 0x20, 0x26, 0x20, 0x33, 0x32, 0x37, 0x36, 0x38, 0x75, 0x29, 0x20, 0x21, 0x3d, 0x20, 0x30, // 6 & 32768u) != 0
+	0x75, 0x29, 0x20, 0x3f, 0x20, 0x30, 0x75, 0x20, 0x3a, 0x20, 0x6d, 0x69, 0x6e, 0x28, 0x5f, 0x31, // u) ? 0u : min(_1
+	0x31, 0x32, 0x36, 0x2c, 0x20, 0x33, 0x31, 0x37, 0x34, 0x33, 0x75, 0x29, 0x2c, 0x20, 0x28, 0x28, // 126, 31743u), ((
+	0x5f, 0x31, 0x31, 0x33, 0x37, 0x20, 0x26, 0x20, 0x33, 0x32, 0x37, 0x36, 0x38, 0x75, 0x29, 0x20, // _1137 & 32768u) 
+	0x21, 0x3d, 0x20, 0x30, 0x75, 0x29, 0x20, 0x3f, 0x20, 0x30, 0x75, 0x20, 0x3a, 0x20, 0x6d, 0x69, // != 0u) ? 0u : mi
+	0x6e, 0x28, 0x5f, 0x31, 0x31, 0x33, 0x37, 0x2c, 0x20, 0x33, 0x31, 0x37, 0x34, 0x33, 0x75, 0x29, // n(_1137, 31743u)
+	0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, // );.            _
+	0x31, 0x35, 0x32, 0x30, 0x20, 0x3d, 0x20, 0x6d, 0x69, 0x6e, 0x28, 0x5f, 0x31, 0x35, 0x32, 0x30, // 1520 = min(_1520
+	0x2c, 0x20, 0x5f, 0x36, 0x39, 0x31, 0x5b, 0x5f, 0x31, 0x34, 0x38, 0x39, 0x5d, 0x29, 0x3b, 0x0a, // , _691[_1489]);.
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x31, 0x35, 0x31, //             _151
+	0x37, 0x20, 0x3d, 0x20, 0x6d, 0x61, 0x78, 0x28, 0x5f, 0x31, 0x35, 0x31, 0x37, 0x2c, 0x20, 0x5f, // 7 = max(_1517, _
+	0x36, 0x39, 0x31, 0x5b, 0x5f, 0x31, 0x34, 0x38, 0x39, 0x5d, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, // 691[_1489]);.   
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x31, 0x34, 0x38, 0x39, 0x2b, 0x2b, //          _1489++
+	0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, // ;.            co
+	0x6e, 0x74, 0x69, 0x6e, 0x75, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // ntinue;.        
+	0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x20, // }.        uint3 
+	0x5f, 0x36, 0x39, 0x36, 0x5b, 0x32, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // _696[2];.       
+	0x20, 0x5f, 0x36, 0x39, 0x36, 0x5b, 0x30, 0x5d, 0x20, 0x3d, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x33, //  _696[0] = uint3
+	0x28, 0x30, 0x75, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x36, // (0u);.        _6
+	0x39, 0x36, 0x5b, 0x31, 0x5d, 0x20, 0x3d, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x28, 0x30, 0x75, // 96[1] = uint3(0u
+	0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, // );.        uint 
+	0x5f, 0x36, 0x39, 0x38, 0x5b, 0x31, 0x36, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // _698[16];.      
+	0x20, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x31, 0x34, 0x39, 0x30, //   for (int _1490
+	0x20, 0x3d, 0x20, 0x30, 0x3b, 0x20, 0x5f, 0x31, 0x34, 0x39, 0x30, 0x20, 0x3c, 0x20, 0x31, 0x36, //  = 0; _1490 < 16
+	0x3b, 0x20, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, // ; ).        {.  
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x36, 0x39, 0x38, 0x5b, 0x5f, //           _698[_
+	0x31, 0x34, 0x39, 0x30, 0x5d, 0x20, 0x3d, 0x20, 0x30, 0x75, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, // 1490] = 0u;.    
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x31, 0x34, 0x39, 0x30, 0x2b, 0x2b, 0x3b, //         _1490++;
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, // .            con
+	0x74, 0x69, 0x6e, 0x75, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, // tinue;.        }
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x5f, 0x39, // .        bool _9
+	0x38, 0x37, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, // 87;.        floa
+	0x74, 0x20, 0x5f, 0x31, 0x35, 0x32, 0x35, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // t _1525;.       
+	0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x31, 0x34, 0x39, 0x31, 0x20, 0x3d, 0x20, 0x30, 0x75, //  uint _1491 = 0u
+	0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, // ;.        float 
+	0x5f, 0x31, 0x35, 0x32, 0x33, 0x20, 0x3d, 0x20, 0x2d, 0x31, 0x2e, 0x30, 0x3b, 0x0a, 0x20, 0x20, // _1523 = -1.0;.  
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x3b, 0x20, 0x5f, 0x31, 0x34, //       for (; _14
+	0x39, 0x31, 0x20, 0x3c, 0x20, 0x34, 0x75, 0x3b, 0x20, 0x5f, 0x31, 0x35, 0x32, 0x33, 0x20, 0x3d, // 91 < 4u; _1523 =
+	0x20, 0x5f, 0x39, 0x38, 0x37, 0x20, 0x3f, 0x20, 0x5f, 0x31, 0x35, 0x32, 0x35, 0x20, 0x3a, 0x20, //  _987 ? _1525 : 
+	0x5f, 0x31, 0x35, 0x32, 0x33, 0x2c, 0x20, 0x5f, 0x31, 0x34, 0x39, 0x31, 0x2b, 0x2b, 0x29, 0x0a, // _1523, _1491++).
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //         {.      
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x38, 0x35, 0x31, 0x20, //       uint _851 
+	0x3d, 0x20, 0x5f, 0x31, 0x34, 0x39, 0x31, 0x20, 0x26, 0x20, 0x31, 0x75, 0x3b, 0x0a, 0x20, 0x20, // = _1491 & 1u;.  
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x5f, //           bool _
+	0x38, 0x35, 0x32, 0x20, 0x3d, 0x20, 0x5f, 0x38, 0x35, 0x31, 0x20, 0x21, 0x3d, 0x20, 0x30, 0x75, // 852 = _851 != 0u
+	0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, // ;.            ui
+	0x6e, 0x74, 0x20, 0x5f, 0x38, 0x35, 0x34, 0x20, 0x3d, 0x20, 0x5f, 0x31, 0x34, 0x39, 0x31, 0x20, // nt _854 = _1491 
+	0x26, 0x20, 0x32, 0x75, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // & 2u;.          
+	0x20, 0x20, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x5f, 0x38, 0x35, 0x35, 0x20, 0x3d, 0x20, 0x5f, 0x38, //   bool _855 = _8
+	0x35, 0x34, 0x20, 0x21, 0x3d, 0x20, 0x30, 0x75, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 54 != 0u;.      
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x20, 0x5f, 0x39, 0x30, 0x34, //       uint3 _904
+	0x20, 0x3d, 0x20, 0x6d, 0x69, 0x6e, 0x28, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x28, 0x5f, 0x31, //  = min((uint3(_1
+	0x35, 0x32, 0x30, 0x2e, 0x78, 0x2c, 0x20, 0x5f, 0x38, 0x35, 0x32, 0x20, 0x3f, 0x20, 0x5f, 0x31, // 520.x, _852 ? _1
+	0x35, 0x31, 0x37, 0x2e, 0x79, 0x20, 0x3a, 0x20, 0x5f, 0x31, 0x35, 0x32, 0x30, 0x2e, 0x79, 0x2c, // 517.y : _1520.y,
+	0x20, 0x5f, 0x38, 0x35, 0x35, 0x20, 0x3f, 0x20, 0x5f, 0x31, 0x35, 0x31, 0x37, 0x2e, 0x7a, 0x20, //  _855 ? _1517.z 
+	0x3a, 0x20, 0x5f, 0x31, 0x35, 0x32, 0x30, 0x2e, 0x7a, 0x29, 0x20, 0x2f, 0x20, 0x75, 0x69, 0x6e, // : _1520.z) / uin
+	0x74, 0x33, 0x28, 0x33, 0x31, 0x75, 0x29, 0x29, 0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x28, // t3(31u)), uint3(
+	0x31, 0x30, 0x32, 0x33, 0x75, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 1023u));.       
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x20, 0x5f, 0x39, 0x30, 0x39, 0x20, //      uint3 _909 
+	0x3d, 0x20, 0x6d, 0x69, 0x6e, 0x28, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x28, 0x5f, 0x31, 0x35, // = min((uint3(_15
+	0x31, 0x37, 0x2e, 0x78, 0x2c, 0x20, 0x5f, 0x38, 0x35, 0x32, 0x20, 0x3f, 0x20, 0x5f, 0x31, 0x35, // 17.x, _852 ? _15
+	0x32, 0x30, 0x2e, 0x79, 0x20, 0x3a, 0x20, 0x5f, 0x31, 0x35, 0x31, 0x37, 0x2e, 0x79, 0x2c, 0x20, // 20.y : _1517.y, 
+	0x5f, 0x38, 0x35, 0x35, 0x20, 0x3f, 0x20, 0x5f, 0x31, 0x35, 0x32, 0x30, 0x2e, 0x7a, 0x20, 0x3a, // _855 ? _1520.z :
+	0x20, 0x5f, 0x31, 0x35, 0x31, 0x37, 0x2e, 0x7a, 0x29, 0x20, 0x2f, 0x20, 0x75, 0x69, 0x6e, 0x74, //  _1517.z) / uint
+	0x33, 0x28, 0x33, 0x31, 0x75, 0x29, 0x29, 0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x28, 0x31, // 3(31u)), uint3(1
+	0x30, 0x32, 0x33, 0x75, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 023u));.        
+	0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x20, 0x5f, 0x31, 0x31, 0x35, 0x30, 0x20, //     uint3 _1150 
+	0x3d, 0x20, 0x28, 0x5f, 0x39, 0x30, 0x34, 0x20, 0x2a, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x28, // = (_904 * uint3(
+	0x36, 0x34, 0x75, 0x29, 0x29, 0x20, 0x2b, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x28, 0x33, 0x32, // 64u)) + uint3(32
+	0x75, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // u);.            
+	0x75, 0x69, 0x6e, 0x74, 0x33, 0x20, 0x5f, 0x31, 0x34, 0x35, 0x39, 0x20, 0x3d, 0x20, 0x5f, 0x31, // uint3 _1459 = _1
+	0x31, 0x35, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 150;.           
+	0x20, 0x5f, 0x31, 0x34, 0x35, 0x39, 0x2e, 0x78, 0x20, 0x3d, 0x20, 0x28, 0x5f, 0x39, 0x30, 0x34, //  _1459.x = (_904
+	0x2e, 0x78, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x75, 0x29, 0x20, 0x3f, 0x20, 0x30, 0x75, 0x20, 0x3a, // .x == 0u) ? 0u :
+	0x20, 0x28, 0x28, 0x5f, 0x39, 0x30, 0x34, 0x2e, 0x78, 0x20, 0x3d, 0x3d, 0x20, 0x31, 0x30, 0x32, //  ((_904.x == 102
+	0x33, 0x75, 0x29, 0x20, 0x3f, 0x20, 0x36, 0x35, 0x35, 0x33, 0x35, 0x75, 0x20, 0x3a, 0x20, 0x5f, // 3u) ? 65535u : _
+	0x31, 0x31, 0x35, 0x30, 0x2e, 0x78, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 1150.x);.       
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x20, 0x5f, 0x31, 0x34, 0x36, 0x34, //      uint3 _1464
+	0x20, 0x3d, 0x20, 0x5f, 0x31, 0x34, 0x35, 0x39, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //  = _1459;.      
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x31, 0x34, 0x36, 0x34, 0x2e, 0x79, 0x20, 0x3d, 0x20, //       _1464.y = 
+	0x28, 0x5f, 0x39, 0x30, 0x34, 0x2e, 0x79, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x75, 0x29, 0x20, 0x3f, // (_904.y == 0u) ?
+	0x20, 0x30, 0x75, 0x20, 0x3a, 0x20, 0x28, 0x28, 0x5f, 0x39, 0x30, 0x34, 0x2e, 0x79, 0x20, 0x3d, //  0u : ((_904.y =
+	0x3d, 0x20, 0x31, 0x30, 0x32, 0x33, 0x75, 0x29, 0x20, 0x3f, 0x20, 0x36, 0x35, 0x35, 0x33, 0x35, // = 1023u) ? 65535
+	0x75, 0x20, 0x3a, 0x20, 0x5f, 0x31, 0x31, 0x35, 0x30, 0x2e, 0x79, 0x29, 0x3b, 0x0a, 0x20, 0x20, // u : _1150.y);.  
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x20, //           uint3 
+	0x5f, 0x31, 0x34, 0x36, 0x39, 0x20, 0x3d, 0x20, 0x5f, 0x31, 0x34, 0x36, 0x34, 0x3b, 0x0a, 0x20, // _1469 = _1464;. 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x31, 0x34, 0x36, 0x39, //            _1469
+	0x2e, 0x7a, 0x20, 0x3d, 0x20, 0x28, 0x5f, 0x39, 0x30, 0x34, 0x2e, 0x7a, 0x20, 0x3d, 0x3d, 0x20, // .z = (_904.z == 
+	0x30, 0x75, 0x29, 0x20, 0x3f, 0x20, 0x30, 0x75, 0x20, 0x3a, 0x20, 0x28, 0x28, 0x5f, 0x39, 0x30, // 0u) ? 0u : ((_90
+	0x34, 0x2e, 0x7a, 0x20, 0x3d, 0x3d, 0x20, 0x31, 0x30, 0x32, 0x33, 0x75, 0x29, 0x20, 0x3f, 0x20, // 4.z == 1023u) ? 
+	0x36, 0x35, 0x35, 0x33, 0x35, 0x75, 0x20, 0x3a, 0x20, 0x5f, 0x31, 0x31, 0x35, 0x30, 0x2e, 0x7a, // 65535u : _1150.z
+	0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, // );.            u
+	0x69, 0x6e, 0x74, 0x33, 0x20, 0x5f, 0x31, 0x31, 0x39, 0x31, 0x20, 0x3d, 0x20, 0x28, 0x5f, 0x39, // int3 _1191 = (_9
+	0x30, 0x39, 0x20, 0x2a, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x28, 0x36, 0x34, 0x75, 0x29, 0x29, // 09 * uint3(64u))
+	0x20, 0x2b, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x28, 0x33, 0x32, 0x75, 0x29, 0x3b, 0x0a, 0x20, //  + uint3(32u);. 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x33, //            uint3
+	0x20, 0x5f, 0x31, 0x34, 0x37, 0x34, 0x20, 0x3d, 0x20, 0x5f, 0x31, 0x31, 0x39, 0x31, 0x3b, 0x0a, //  _1474 = _1191;.
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x31, 0x34, 0x37, //             _147
+	0x34, 0x2e, 0x78, 0x20, 0x3d, 0x20, 0x28, 0x5f, 0x39, 0x30, 0x39, 0x2e, 0x78, 0x20, 0x3d, 0x3d, // 4.x = (_909.x ==
+	0x20, 0x30, 0x75, 0x29, 0x20, 0x3f, 0x20, 0x30, 0x75, 0x20, 0x3a, 0x20, 0x28, 0x28, 0x5f, 0x39, //  0u) ? 0u : ((_9
+	0x30, 0x39, 0x2e, 0x78, 0x20, 0x3d, 0x3d, 0x20, 0x31, 0x30, 0x32, 0x33, 0x75, 0x29, 0x20, 0x3f, // 09.x == 1023u) ?
+	0x20, 0x36, 0x35, 0x35, 0x33, 0x35, 0x75, 0x20, 0x3a, 0x20, 0x5f, 0x31, 0x31, 0x39, 0x31, 0x2e, //  65535u : _1191.
+	0x78, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // x);.            
+	0x75, 0x69, 0x6e, 0x74, 0x33, 0x20, 0x5f, 0x31, 0x34, 0x37, 0x39, 0x20, 0x3d, 0x20, 0x5f, 0x31, // uint3 _1479 = _1
+	0x34, 0x37, 0x34, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 474;.           
+	0x20, 0x5f, 0x31, 0x34, 0x37, 0x39, 0x2e, 0x79, 0x20, 0x3d, 0x20, 0x28, 0x5f, 0x39, 0x30, 0x39, //  _1479.y = (_909
+	0x2e, 0x79, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x75, 0x29, 0x20, 0x3f, 0x20, 0x30, 0x75, 0x20, 0x3a, // .y == 0u) ? 0u :
+	0x20, 0x28, 0x28, 0x5f, 0x39, 0x30, 0x39, 0x2e, 0x79, 0x20, 0x3d, 0x3d, 0x20, 0x31, 0x30, 0x32, //  ((_909.y == 102
+	0x33, 0x75, 0x29, 0x20, 0x3f, 0x20, 0x36, 0x35, 0x35, 0x33, 0x35, 0x75, 0x20, 0x3a, 0x20, 0x5f, // 3u) ? 65535u : _
+	0x31, 0x31, 0x39, 0x31, 0x2e, 0x79, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 1191.y);.       
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x20, 0x5f, 0x31, 0x34, 0x38, 0x34, //      uint3 _1484
+	0x20, 0x3d, 0x20, 0x5f, 0x31, 0x34, 0x37, 0x39, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //  = _1479;.      
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x31, 0x34, 0x38, 0x34, 0x2e, 0x7a, 0x20, 0x3d, 0x20, //       _1484.z = 
+	0x28, 0x5f, 0x39, 0x30, 0x39, 0x2e, 0x7a, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x75, 0x29, 0x20, 0x3f, // (_909.z == 0u) ?
+	0x20, 0x30, 0x75, 0x20, 0x3a, 0x20, 0x28, 0x28, 0x5f, 0x39, 0x30, 0x39, 0x2e, 0x7a, 0x20, 0x3d, //  0u : ((_909.z =
+	0x3d, 0x20, 0x31, 0x30, 0x32, 0x33, 0x75, 0x29, 0x20, 0x3f, 0x20, 0x36, 0x35, 0x35, 0x33, 0x35, // = 1023u) ? 65535
+	0x75, 0x20, 0x3a, 0x20, 0x5f, 0x31, 0x31, 0x39, 0x31, 0x2e, 0x7a, 0x29, 0x3b, 0x0a, 0x20, 0x20, // u : _1191.z);.  
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x31, 0x35, 0x32, 0x35, 0x20, //           _1525 
+	0x3d, 0x20, 0x30, 0x2e, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // = 0.0;.         
+	0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x37, 0x31, 0x31, 0x5b, 0x31, 0x36, 0x5d, //    uint _711[16]
+	0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, // ;.            fl
+	0x6f, 0x61, 0x74, 0x20, 0x5f, 0x31, 0x35, 0x33, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, // oat _1531;.     
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x69, 0x6e, 0x74, 0x20, //        for (int 
+	0x5f, 0x31, 0x35, 0x32, 0x31, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x20, 0x5f, 0x31, 0x35, 0x32, 0x31, // _1521 = 0; _1521
+	0x20, 0x3c, 0x20, 0x31, 0x36, 0x3b, 0x20, 0x5f, 0x31, 0x35, 0x32, 0x35, 0x20, 0x2b, 0x3d, 0x20, //  < 16; _1525 += 
+	0x5f, 0x31, 0x35, 0x33, 0x31, 0x2c, 0x20, 0x5f, 0x31, 0x35, 0x32, 0x31, 0x2b, 0x2b, 0x29, 0x0a, // _1531, _1521++).
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, //             {.  
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x37, //               _7
+	0x31, 0x31, 0x5b, 0x5f, 0x31, 0x35, 0x32, 0x31, 0x5d, 0x20, 0x3d, 0x20, 0x30, 0x75, 0x3b, 0x0a, // 11[_1521] = 0u;.
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x5f, 0x31, 0x35, 0x33, 0x31, 0x20, 0x3d, 0x20, 0x2d, 0x31, 0x2e, 0x30, 0x3b, 0x0a, 0x20, 0x20, // _1531 = -1.0;.  
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, //               fl
+	0x6f, 0x61, 0x74, 0x20, 0x5f, 0x39, 0x36, 0x32, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // oat _962;.      
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6f, 0x6f, 0x6c, 0x20, 0x5f, //           bool _
+	0x39, 0x36, 0x38, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 968;.           
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, //      for (uint _
+	0x31, 0x35, 0x33, 0x30, 0x20, 0x3d, 0x20, 0x30, 0x75, 0x3b, 0x20, 0x5f, 0x31, 0x35, 0x33, 0x30, // 1530 = 0u; _1530
+	0x20, 0x3c, 0x20, 0x31, 0x36, 0x75, 0x3b, 0x20, 0x5f, 0x31, 0x35, 0x33, 0x31, 0x20, 0x3d, 0x20, //  < 16u; _1531 = 
+	0x5f, 0x39, 0x36, 0x38, 0x20, 0x3f, 0x20, 0x5f, 0x39, 0x36, 0x32, 0x20, 0x3a, 0x20, 0x5f, 0x31, // _968 ? _962 : _1
+	0x35, 0x33, 0x31, 0x2c, 0x20, 0x5f, 0x31, 0x35, 0x33, 0x30, 0x2b, 0x2b, 0x29, 0x0a, 0x20, 0x20, // 531, _1530++).  
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, //               {.
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x31, 0x32, 0x33, 0x30, 0x20, 0x3d, //     uint _1230 =
+	0x20, 0x28, 0x28, 0x5f, 0x31, 0x35, 0x33, 0x30, 0x20, 0x2a, 0x20, 0x36, 0x34, 0x75, 0x29, 0x20, //  ((_1530 * 64u) 
+	0x2b, 0x20, 0x37, 0x75, 0x29, 0x20, 0x2f, 0x20, 0x31, 0x35, 0x75, 0x3b, 0x0a, 0x20, 0x20, 0x20, // + 7u) / 15u;.   
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x20, 0x5f, 0x39, 0x35, 0x39, 0x20, 0x3d, 0x20, 0x66, //  float3 _959 = f
+	0x6c, 0x6f, 0x61, 0x74, 0x33, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x33, // loat3((((((uint3
+	0x28, 0x36, 0x34, 0x75, 0x20, 0x2d, 0x20, 0x5f, 0x31, 0x32, 0x33, 0x30, 0x29, 0x20, 0x2a, 0x20, // (64u - _1230) * 
+	0x5f, 0x31, 0x34, 0x36, 0x39, 0x29, 0x20, 0x2b, 0x20, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x28, // _1469) + (uint3(
+	0x5f, 0x31, 0x32, 0x33, 0x30, 0x29, 0x20, 0x2a, 0x20, 0x5f, 0x31, 0x34, 0x38, 0x34, 0x29, 0x29, // _1230) * _1484))
+	0x20, 0x2b, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x28, 0x33, 0x32, 0x75, 0x29, 0x29, 0x20, 0x3e, //  + uint3(32u)) >
+	0x3e, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x28, 0x36, 0x75, 0x29, 0x29, 0x20, 0x2a, 0x20, 0x75, // > uint3(6u)) * u
+	0x69, 0x6e, 0x74, 0x33, 0x28, 0x33, 0x31, 0x75, 0x29, 0x29, 0x20, 0x3e, 0x3e, 0x20, 0x75, 0x69, // int3(31u)) >> ui
+	0x6e, 0x74, 0x33, 0x28, 0x36, 0x75, 0x29, 0x29, 0x20, 0x2d, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, // nt3(6u)) - float
+	0x33, 0x28, 0x5f, 0x36, 0x39, 0x31, 0x5b, 0x5f, 0x31, 0x35, 0x32, 0x31, 0x5d, 0x29, 0x3b, 0x0a, // 3(_691[_1521]);.
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x20, 0x20, 0x5f, 0x39, 0x36, 0x32, 0x20, 0x3d, 0x20, 0x64, 0x6f, 0x74, 0x28, 0x5f, //     _962 = dot(_
+	0x39, 0x35, 0x39, 0x2c, 0x20, 0x5f, 0x39, 0x35, 0x39, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, // 959, _959);.    
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x5f, 0x39, 0x36, 0x38, 0x20, 0x3d, 0x20, 0x28, 0x5f, 0x31, 0x35, 0x33, 0x31, 0x20, 0x3c, 0x20, // _968 = (_1531 < 
+	0x30, 0x2e, 0x30, 0x29, 0x20, 0x7c, 0x7c, 0x20, 0x28, 0x5f, 0x39, 0x36, 0x32, 0x20, 0x3c, 0x20, // 0.0) || (_962 < 
+	0x5f, 0x31, 0x35, 0x33, 0x31, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // _1531);.        
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, //             if (
+	0x5f, 0x39, 0x36, 0x38, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // _968).          
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, //           {.    
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x20, 0x20, 0x5f, 0x37, 0x31, 0x31, 0x5b, 0x5f, 0x31, 0x35, 0x32, 0x31, 0x5d, 0x20, //     _711[_1521] 
+	0x3d, 0x20, 0x5f, 0x31, 0x35, 0x33, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // = _1530;.       
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x63, 0x6f, 0x6e, 0x74, 0x69, 0x6e, 0x75, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, //  continue;.     
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, //                }
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // .               
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //      else.      
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, //               {.
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x69, 0x6e, 0x75, 0x65, //         continue
+	0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // ;.              
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //       }.        
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x74, //             cont
+	0x69, 0x6e, 0x75, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // inue;.          
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //       }.        
+	0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //     }.          
+	0x20, 0x20, 0x5f, 0x39, 0x38, 0x37, 0x20, 0x3d, 0x20, 0x28, 0x5f, 0x31, 0x35, 0x32, 0x33, 0x20, //   _987 = (_1523 
+	0x3c, 0x20, 0x30, 0x2e, 0x30, 0x29, 0x20, 0x7c, 0x7c, 0x20, 0x28, 0x5f, 0x31, 0x35, 0x32, 0x35, // < 0.0) || (_1525
+	0x20, 0x3c, 0x20, 0x5f, 0x31, 0x35, 0x32, 0x33, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, //  < _1523);.     
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x5f, 0x39, 0x38, 0x37, 0x29, //        if (_987)
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, // .            {. 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, //                _
+	0x36, 0x39, 0x36, 0x5b, 0x30, 0x5d, 0x20, 0x3d, 0x20, 0x5f, 0x39, 0x30, 0x34, 0x3b, 0x0a, 0x20, // 696[0] = _904;. 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, //                _
+	0x36, 0x39, 0x36, 0x5b, 0x31, 0x5d, 0x20, 0x3d, 0x20, 0x5f, 0x39, 0x30, 0x39, 0x3b, 0x0a, 0x20, // 696[1] = _909;. 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, //                f
+	0x6f, 0x72, 0x20, 0x28, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x31, 0x35, 0x32, 0x36, 0x20, 0x3d, 0x20, // or (int _1526 = 
+	0x30, 0x3b, 0x20, 0x5f, 0x31, 0x35, 0x32, 0x36, 0x20, 0x3c, 0x20, 0x31, 0x36, 0x3b, 0x20, 0x29, // 0; _1526 < 16; )
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // .               
+	0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //  {.             
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x36, 0x39, 0x38, 0x5b, 0x5f, 0x31, 0x35, 0x32, //        _698[_152
+	0x36, 0x5d, 0x20, 0x3d, 0x20, 0x5f, 0x37, 0x31, 0x31, 0x5b, 0x5f, 0x31, 0x35, 0x32, 0x36, 0x5d, // 6] = _711[_1526]
+	0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // ;.              
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x31, 0x35, 0x32, 0x36, 0x2b, 0x2b, 0x3b, 0x0a, 0x20, //       _1526++;. 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x69, 0x6e, 0x75, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, //    continue;.   
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, //              }. 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, //                c
+	0x6f, 0x6e, 0x74, 0x69, 0x6e, 0x75, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // ontinue;.       
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //      }.         
+	0x20, 0x20, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //    else.        
+	0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //     {.          
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x69, 0x6e, 0x75, 0x65, 0x3b, 0x0a, //       continue;.
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, //             }.  
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x69, 0x6e, //           contin
+	0x75, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, // ue;.        }.  
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x5f, 0x36, 0x39, 0x38, 0x5b, 0x30, //       if (_698[0
+	0x5d, 0x20, 0x3e, 0x3d, 0x20, 0x38, 0x75, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // ] >= 8u).       
+	0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, //  {.            u
+	0x69, 0x6e, 0x74, 0x33, 0x20, 0x5f, 0x31, 0x30, 0x31, 0x39, 0x20, 0x3d, 0x20, 0x5f, 0x36, 0x39, // int3 _1019 = _69
+	0x36, 0x5b, 0x30, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 6[0];.          
+	0x20, 0x20, 0x5f, 0x36, 0x39, 0x36, 0x5b, 0x30, 0x5d, 0x20, 0x3d, 0x20, 0x5f, 0x36, 0x39, 0x36, //   _696[0] = _696
+	0x5b, 0x31, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // [1];.           
+	0x20, 0x5f, 0x36, 0x39, 0x36, 0x5b, 0x31, 0x5d, 0x20, 0x3d, 0x20, 0x5f, 0x31, 0x30, 0x31, 0x39, //  _696[1] = _1019
+	0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, // ;.            fo
+	0x72, 0x20, 0x28, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x31, 0x34, 0x39, 0x32, 0x20, 0x3d, 0x20, 0x30, // r (int _1492 = 0
+	0x3b, 0x20, 0x5f, 0x31, 0x34, 0x39, 0x32, 0x20, 0x3c, 0x20, 0x31, 0x36, 0x3b, 0x20, 0x29, 0x0a, // ; _1492 < 16; ).
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, //             {.  
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x36, //               _6
+	0x39, 0x38, 0x5b, 0x5f, 0x31, 0x34, 0x39, 0x32, 0x5d, 0x20, 0x3d, 0x20, 0x31, 0x35, 0x75, 0x20, // 98[_1492] = 15u 
+	0x2d, 0x20, 0x5f, 0x36, 0x39, 0x38, 0x5b, 0x5f, 0x31, 0x34, 0x39, 0x32, 0x5d, 0x3b, 0x0a, 0x20, // - _698[_1492];. 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, //                _
+	0x31, 0x34, 0x39, 0x32, 0x2b, 0x2b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 1492++;.        
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x69, 0x6e, 0x75, 0x65, //         continue
+	0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, // ;.            }.
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //         }.      
+	0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x34, 0x20, 0x5f, 0x37, 0x32, 0x33, 0x20, 0x3d, 0x20, 0x75, //   uint4 _723 = u
+	0x69, 0x6e, 0x74, 0x34, 0x28, 0x30, 0x75, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // int4(0u);.      
+	0x20, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x31, 0x34, 0x39, //   for (uint _149
+	0x33, 0x20, 0x3d, 0x20, 0x30, 0x75, 0x3b, 0x20, 0x5f, 0x31, 0x34, 0x39, 0x33, 0x20, 0x3c, 0x20, // 3 = 0u; _1493 < 
+	0x35, 0x75, 0x3b, 0x20, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, // 5u; ).        {.
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, //             uint
+	0x20, 0x5f, 0x31, 0x32, 0x34, 0x35, 0x20, 0x3d, 0x20, 0x5f, 0x31, 0x34, 0x39, 0x33, 0x20, 0x2f, //  _1245 = _1493 /
+	0x20, 0x33, 0x32, 0x75, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //  32u;.          
+	0x20, 0x20, 0x5f, 0x37, 0x32, 0x33, 0x5b, 0x5f, 0x31, 0x32, 0x34, 0x35, 0x5d, 0x20, 0x7c, 0x3d, //   _723[_1245] |=
+	0x20, 0x28, 0x28, 0x28, 0x33, 0x75, 0x20, 0x3e, 0x3e, 0x20, 0x5f, 0x31, 0x34, 0x39, 0x33, 0x29, //  (((3u >> _1493)
+	0x20, 0x26, 0x20, 0x31, 0x75, 0x29, 0x20, 0x3c, 0x3c, 0x20, 0x28, 0x5f, 0x31, 0x34, 0x39, 0x33, //  & 1u) << (_1493
+	0x20, 0x25, 0x20, 0x33, 0x32, 0x75, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //  % 32u));.      
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x31, 0x34, 0x39, 0x33, 0x2b, 0x2b, 0x3b, 0x0a, 0x20, //       _1493++;. 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x69, //            conti
+	0x6e, 0x75, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, // nue;.        }. 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x34, 0x20, 0x5f, 0x31, 0x34, //        uint4 _14
+	0x39, 0x36, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, // 96;.        uint
+	0x20, 0x5f, 0x31, 0x34, 0x39, 0x37, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //  _1497;.        
+	0x5f, 0x31, 0x34, 0x39, 0x37, 0x20, 0x3d, 0x20, 0x35, 0x75, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, // _1497 = 5u;.    
+	0x20, 0x20, 0x20, 0x20, 0x5f, 0x31, 0x34, 0x39, 0x36, 0x20, 0x3d, 0x20, 0x5f, 0x37, 0x32, 0x33, //     _1496 = _723
+	0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x34, 0x20, // ;.        uint4 
+	0x5f, 0x37, 0x33, 0x36, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, // _736;.        fo
+	0x72, 0x20, 0x28, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x31, 0x34, 0x39, 0x35, 0x20, 0x3d, 0x20, 0x30, // r (int _1495 = 0
+	0x3b, 0x20, 0x5f, 0x31, 0x34, 0x39, 0x35, 0x20, 0x3c, 0x20, 0x32, 0x3b, 0x20, 0x5f, 0x31, 0x34, // ; _1495 < 2; _14
+	0x39, 0x37, 0x20, 0x2b, 0x3d, 0x20, 0x33, 0x30, 0x75, 0x2c, 0x20, 0x5f, 0x31, 0x34, 0x39, 0x36, // 97 += 30u, _1496
+	0x20, 0x3d, 0x20, 0x5f, 0x37, 0x33, 0x36, 0x2c, 0x20, 0x5f, 0x31, 0x34, 0x39, 0x35, 0x2b, 0x2b, //  = _736, _1495++
+	0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, // ).        {.    
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x34, 0x20, 0x5f, 0x37, //         uint4 _7
+	0x32, 0x38, 0x20, 0x3d, 0x20, 0x5f, 0x31, 0x34, 0x39, 0x36, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, // 28 = _1496;.    
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x31, 0x30, //         uint _10
+	0x35, 0x36, 0x20, 0x3d, 0x20, 0x5f, 0x36, 0x39, 0x36, 0x5b, 0x5f, 0x31, 0x34, 0x39, 0x35, 0x5d, // 56 = _696[_1495]
+	0x2e, 0x78, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // .x;.            
+	0x66, 0x6f, 0x72, 0x20, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x31, 0x35, 0x30, 0x36, 0x20, // for (uint _1506 
+	0x3d, 0x20, 0x30, 0x75, 0x3b, 0x20, 0x5f, 0x31, 0x35, 0x30, 0x36, 0x20, 0x3c, 0x20, 0x31, 0x30, // = 0u; _1506 < 10
+	0x75, 0x3b, 0x20, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // u; ).           
+	0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //  {.             
+	0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x31, 0x32, 0x37, 0x34, 0x20, 0x3d, 0x20, //    uint _1274 = 
+	0x5f, 0x31, 0x34, 0x39, 0x37, 0x20, 0x2b, 0x20, 0x5f, 0x31, 0x35, 0x30, 0x36, 0x3b, 0x0a, 0x20, // _1497 + _1506;. 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, //                u
+	0x69, 0x6e, 0x74, 0x20, 0x5f, 0x31, 0x32, 0x37, 0x36, 0x20, 0x3d, 0x20, 0x5f, 0x31, 0x32, 0x37, // int _1276 = _127
+	0x34, 0x20, 0x2f, 0x20, 0x33, 0x32, 0x75, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 4 / 32u;.       
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x37, 0x32, 0x38, 0x5b, 0x5f, 0x31, //          _728[_1
+	0x32, 0x37, 0x36, 0x5d, 0x20, 0x7c, 0x3d, 0x20, 0x28, 0x28, 0x28, 0x5f, 0x31, 0x30, 0x35, 0x36, // 276] |= (((_1056
+	0x20, 0x3e, 0x3e, 0x20, 0x5f, 0x31, 0x35, 0x30, 0x36, 0x29, 0x20, 0x26, 0x20, 0x31, 0x75, 0x29, //  >> _1506) & 1u)
+	0x20, 0x3c, 0x3c, 0x20, 0x28, 0x5f, 0x31, 0x32, 0x37, 0x34, 0x20, 0x25, 0x20, 0x33, 0x32, 0x75, //  << (_1274 % 32u
+	0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // ));.            
+	0x20, 0x20, 0x20, 0x20, 0x5f, 0x31, 0x35, 0x30, 0x36, 0x2b, 0x2b, 0x3b, 0x0a, 0x20, 0x20, 0x20, //     _1506++;.   
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, //              con
+	0x74, 0x69, 0x6e, 0x75, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // tinue;.         
+	0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //    }.           
+	0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x31, 0x32, 0x39, 0x32, 0x20, 0x3d, 0x20, 0x5f, 0x31, //  uint _1292 = _1
+	0x34, 0x39, 0x37, 0x20, 0x2b, 0x20, 0x31, 0x30, 0x75, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, // 497 + 10u;.     
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x34, 0x20, 0x5f, 0x37, 0x33, //        uint4 _73
+	0x32, 0x20, 0x3d, 0x20, 0x5f, 0x37, 0x32, 0x38, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 2 = _728;.      
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x31, 0x30, 0x36, 0x34, //       uint _1064
+	0x20, 0x3d, 0x20, 0x5f, 0x36, 0x39, 0x36, 0x5b, 0x5f, 0x31, 0x34, 0x39, 0x35, 0x5d, 0x2e, 0x79, //  = _696[_1495].y
+	0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, // ;.            fo
+	0x72, 0x20, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x31, 0x35, 0x30, 0x39, 0x20, 0x3d, 0x20, // r (uint _1509 = 
+	0x30, 0x75, 0x3b, 0x20, 0x5f, 0x31, 0x35, 0x30, 0x39, 0x20, 0x3c, 0x20, 0x31, 0x30, 0x75, 0x3b, // 0u; _1509 < 10u;
+	0x20, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, //  ).            {
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // .               
+	0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x31, 0x33, 0x30, 0x35, 0x20, 0x3d, 0x20, 0x5f, 0x31, //  uint _1305 = _1
+	0x32, 0x39, 0x32, 0x20, 0x2b, 0x20, 0x5f, 0x31, 0x35, 0x30, 0x39, 0x3b, 0x0a, 0x20, 0x20, 0x20, // 292 + _1509;.   
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, //              uin
+	0x74, 0x20, 0x5f, 0x31, 0x33, 0x30, 0x37, 0x20, 0x3d, 0x20, 0x5f, 0x31, 0x33, 0x30, 0x35, 0x20, // t _1307 = _1305 
+	0x2f, 0x20, 0x33, 0x32, 0x75, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // / 32u;.         
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x37, 0x33, 0x32, 0x5b, 0x5f, 0x31, 0x33, 0x30, //        _732[_130
+	0x37, 0x5d, 0x20, 0x7c, 0x3d, 0x20, 0x28, 0x28, 0x28, 0x5f, 0x31, 0x30, 0x36, 0x34, 0x20, 0x3e, // 7] |= (((_1064 >
+	0x3e, 0x20, 0x5f, 0x31, 0x35, 0x30, 0x39, 0x29, 0x20, 0x26, 0x20, 0x31, 0x75, 0x29, 0x20, 0x3c, // > _1509) & 1u) <
+	0x3c, 0x20, 0x28, 0x5f, 0x31, 0x33, 0x30, 0x35, 0x20, 0x25, 0x20, 0x33, 0x32, 0x75, 0x29, 0x29, // < (_1305 % 32u))
+	0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // ;.              
+	0x20, 0x20, 0x5f, 0x31, 0x35, 0x30, 0x39, 0x2b, 0x2b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, //   _1509++;.     
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x69, //            conti
+	0x6e, 0x75, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // nue;.           
+	0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, //  }.            u
+	0x69, 0x6e, 0x74, 0x20, 0x5f, 0x31, 0x33, 0x32, 0x33, 0x20, 0x3d, 0x20, 0x5f, 0x31, 0x34, 0x39, // int _1323 = _149
+	0x37, 0x20, 0x2b, 0x20, 0x32, 0x30, 0x75, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 7 + 20u;.       
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x37, 0x33, 0x36, 0x20, 0x3d, 0x20, 0x5f, 0x37, 0x33, 0x32, //      _736 = _732
+	0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, // ;.            ui
+	0x6e, 0x74, 0x20, 0x5f, 0x31, 0x30, 0x37, 0x32, 0x20, 0x3d, 0x20, 0x5f, 0x36, 0x39, 0x36, 0x5b, // nt _1072 = _696[
+	0x5f, 0x31, 0x34, 0x39, 0x35, 0x5d, 0x2e, 0x7a, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // _1495].z;.      
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x20, //       for (uint 
+	0x5f, 0x31, 0x35, 0x31, 0x32, 0x20, 0x3d, 0x20, 0x30, 0x75, 0x3b, 0x20, 0x5f, 0x31, 0x35, 0x31, // _1512 = 0u; _151
+	0x32, 0x20, 0x3c, 0x20, 0x31, 0x30, 0x75, 0x3b, 0x20, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, // 2 < 10u; ).     
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //        {.       
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x31, //          uint _1
+	0x33, 0x33, 0x36, 0x20, 0x3d, 0x20, 0x5f, 0x31, 0x33, 0x32, 0x33, 0x20, 0x2b, 0x20, 0x5f, 0x31, // 336 = _1323 + _1
+	0x35, 0x31, 0x32, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 512;.           
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x31, 0x33, 0x33, 0x38, 0x20, //      uint _1338 
+	0x3d, 0x20, 0x5f, 0x31, 0x33, 0x33, 0x36, 0x20, 0x2f, 0x20, 0x33, 0x32, 0x75, 0x3b, 0x0a, 0x20, // = _1336 / 32u;. 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, //                _
+	0x37, 0x33, 0x36, 0x5b, 0x5f, 0x31, 0x33, 0x33, 0x38, 0x5d, 0x20, 0x7c, 0x3d, 0x20, 0x28, 0x28, // 736[_1338] |= ((
+	0x28, 0x5f, 0x31, 0x30, 0x37, 0x32, 0x20, 0x3e, 0x3e, 0x20, 0x5f, 0x31, 0x35, 0x31, 0x32, 0x29, // (_1072 >> _1512)
+	0x20, 0x26, 0x20, 0x31, 0x75, 0x29, 0x20, 0x3c, 0x3c, 0x20, 0x28, 0x5f, 0x31, 0x33, 0x33, 0x36, //  & 1u) << (_1336
+	0x20, 0x25, 0x20, 0x33, 0x32, 0x75, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //  % 32u));.      
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x31, 0x35, 0x31, 0x32, 0x2b, //           _1512+
+	0x2b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // +;.             
+	0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x69, 0x6e, 0x75, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, //    continue;.   
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, //          }.     
+	0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, //    }.        uin
+	0x74, 0x34, 0x20, 0x5f, 0x37, 0x34, 0x30, 0x20, 0x3d, 0x20, 0x5f, 0x31, 0x34, 0x39, 0x36, 0x3b, // t4 _740 = _1496;
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x31, // .        uint _1
+	0x30, 0x38, 0x31, 0x20, 0x3d, 0x20, 0x5f, 0x36, 0x39, 0x38, 0x5b, 0x30, 0x5d, 0x3b, 0x0a, 0x20, // 081 = _698[0];. 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x75, 0x69, 0x6e, 0x74, //        for (uint
+	0x20, 0x5f, 0x31, 0x34, 0x39, 0x38, 0x20, 0x3d, 0x20, 0x30, 0x75, 0x3b, 0x20, 0x5f, 0x31, 0x34, //  _1498 = 0u; _14
+	0x39, 0x38, 0x20, 0x3c, 0x20, 0x33, 0x75, 0x3b, 0x20, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, // 98 < 3u; ).     
+	0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //    {.           
+	0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x31, 0x33, 0x36, 0x37, 0x20, 0x3d, 0x20, 0x5f, 0x31, //  uint _1367 = _1
+	0x34, 0x39, 0x37, 0x20, 0x2b, 0x20, 0x5f, 0x31, 0x34, 0x39, 0x38, 0x3b, 0x0a, 0x20, 0x20, 0x20, // 497 + _1498;.   
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x31, //          uint _1
+	0x33, 0x36, 0x39, 0x20, 0x3d, 0x20, 0x5f, 0x31, 0x33, 0x36, 0x37, 0x20, 0x2f, 0x20, 0x33, 0x32, // 369 = _1367 / 32
+	0x75, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, // u;.            _
+	0x37, 0x34, 0x30, 0x5b, 0x5f, 0x31, 0x33, 0x36, 0x39, 0x5d, 0x20, 0x7c, 0x3d, 0x20, 0x28, 0x28, // 740[_1369] |= ((
+	0x28, 0x5f, 0x31, 0x30, 0x38, 0x31, 0x20, 0x3e, 0x3e, 0x20, 0x5f, 0x31, 0x34, 0x39, 0x38, 0x29, // (_1081 >> _1498)
+	0x20, 0x26, 0x20, 0x31, 0x75, 0x29, 0x20, 0x3c, 0x3c, 0x20, 0x28, 0x5f, 0x31, 0x33, 0x36, 0x37, //  & 1u) << (_1367
+	0x20, 0x25, 0x20, 0x33, 0x32, 0x75, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //  % 32u));.      
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x31, 0x34, 0x39, 0x38, 0x2b, 0x2b, 0x3b, 0x0a, 0x20, //       _1498++;. 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x69, //            conti
+	0x6e, 0x75, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, // nue;.        }. 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x34, 0x20, 0x5f, 0x31, 0x35, //        uint4 _15
+	0x30, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, // 01;.        uint
+	0x20, 0x5f, 0x31, 0x35, 0x30, 0x32, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //  _1502;.        
+	0x5f, 0x31, 0x35, 0x30, 0x32, 0x20, 0x3d, 0x20, 0x5f, 0x31, 0x34, 0x39, 0x37, 0x20, 0x2b, 0x20, // _1502 = _1497 + 
+	0x33, 0x75, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x31, 0x35, 0x30, // 3u;.        _150
+	0x31, 0x20, 0x3d, 0x20, 0x5f, 0x37, 0x34, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 1 = _740;.      
+	0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x34, 0x20, 0x5f, 0x37, 0x34, 0x35, 0x3b, 0x0a, 0x20, 0x20, //   uint4 _745;.  
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x69, 0x6e, 0x74, 0x20, 0x5f, //       for (int _
+	0x31, 0x35, 0x30, 0x30, 0x20, 0x3d, 0x20, 0x31, 0x3b, 0x20, 0x5f, 0x31, 0x35, 0x30, 0x30, 0x20, // 1500 = 1; _1500 
+	0x3c, 0x20, 0x31, 0x36, 0x3b, 0x20, 0x5f, 0x31, 0x35, 0x30, 0x32, 0x20, 0x2b, 0x3d, 0x20, 0x34, // < 16; _1502 += 4
+	0x75, 0x2c, 0x20, 0x5f, 0x31, 0x35, 0x30, 0x31, 0x20, 0x3d, 0x20, 0x5f, 0x37, 0x34, 0x35, 0x2c, // u, _1501 = _745,
+	0x20, 0x5f, 0x31, 0x35, 0x30, 0x30, 0x2b, 0x2b, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //  _1500++).      
+	0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //   {.            
+	0x5f, 0x37, 0x34, 0x35, 0x20, 0x3d, 0x20, 0x5f, 0x31, 0x35, 0x30, 0x31, 0x3b, 0x0a, 0x20, 0x20, // _745 = _1501;.  
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, //           uint _
+	0x31, 0x30, 0x39, 0x36, 0x20, 0x3d, 0x20, 0x5f, 0x36, 0x39, 0x38, 0x5b, 0x5f, 0x31, 0x35, 0x30, // 1096 = _698[_150
+	0x30, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 0];.            
+	0x66, 0x6f, 0x72, 0x20, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x31, 0x35, 0x30, 0x33, 0x20, // for (uint _1503 
+	0x3d, 0x20, 0x30, 0x75, 0x3b, 0x20, 0x5f, 0x31, 0x35, 0x30, 0x33, 0x20, 0x3c, 0x20, 0x34, 0x75, // = 0u; _1503 < 4u
+	0x3b, 0x20, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // ; ).            
+	0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // {.              
+	0x20, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x31, 0x33, 0x39, 0x38, 0x20, 0x3d, 0x20, 0x5f, //   uint _1398 = _
+	0x31, 0x35, 0x30, 0x32, 0x20, 0x2b, 0x20, 0x5f, 0x31, 0x35, 0x30, 0x33, 0x3b, 0x0a, 0x20, 0x20, // 1502 + _1503;.  
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x69, //               ui
+	0x6e, 0x74, 0x20, 0x5f, 0x31, 0x34, 0x30, 0x30, 0x20, 0x3d, 0x20, 0x5f, 0x31, 0x33, 0x39, 0x38, // nt _1400 = _1398
+	0x20, 0x2f, 0x20, 0x33, 0x32, 0x75, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //  / 32u;.        
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x37, 0x34, 0x35, 0x5b, 0x5f, 0x31, 0x34, //         _745[_14
+	0x30, 0x30, 0x5d, 0x20, 0x7c, 0x3d, 0x20, 0x28, 0x28, 0x28, 0x5f, 0x31, 0x30, 0x39, 0x36, 0x20, // 00] |= (((_1096 
+	0x3e, 0x3e, 0x20, 0x5f, 0x31, 0x35, 0x30, 0x33, 0x29, 0x20, 0x26, 0x20, 0x31, 0x75, 0x29, 0x20, // >> _1503) & 1u) 
+	0x3c, 0x3c, 0x20, 0x28, 0x5f, 0x31, 0x33, 0x39, 0x38, 0x20, 0x25, 0x20, 0x33, 0x32, 0x75, 0x29, // << (_1398 % 32u)
+	0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // );.             
+	0x20, 0x20, 0x20, 0x5f, 0x31, 0x35, 0x30, 0x33, 0x2b, 0x2b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, //    _1503++;.    
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x74, //             cont
+	0x69, 0x6e, 0x75, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // inue;.          
+	0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, //   }.        }.  
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x5f, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x54, 0x65, //       s_outputTe
+	0x78, 0x74, 0x75, 0x72, 0x65, 0x2e, 0x77, 0x72, 0x69, 0x74, 0x65, 0x28, 0x5f, 0x31, 0x35, 0x30, // xture.write(_150
+	0x31, 0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x32, 0x28, 0x69, 0x6e, 0x74, 0x33, 0x28, 0x67, 0x6c, // 1, uint2(int3(gl
+	0x5f, 0x47, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x49, 0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, // _GlobalInvocatio
+	0x6e, 0x49, 0x44, 0x29, 0x2e, 0x78, 0x79, 0x29, 0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x28, 0x69, // nID).xy), uint(i
+	0x6e, 0x74, 0x33, 0x28, 0x67, 0x6c, 0x5f, 0x47, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x49, 0x6e, 0x76, // nt3(gl_GlobalInv
+	0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x49, 0x44, 0x29, 0x2e, 0x7a, 0x29, 0x29, 0x3b, 0x0a, // ocationID).z));.
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6b, 0x3b, 0x0a, 0x20, //         break;. 
+	0x20, 0x20, 0x20, 0x7d, 0x0a, 0x7d, 0x0a, 0x0a, 0x00, 0x00, 0x10, 0x00,                         //    }.}......
+};
@@ -0,0 +1,136 @@
+#include <bgfx_compute.sh>
+
+IMAGE2D_ARRAY_RO(s_input, rgba16f, 0);
+UIMAGE2D_ARRAY_WR(s_output, rgba32ui, 1);
+
+uniform vec4 u_settings;
+
+#define u_side_resolution u_settings.x
+
+// Half float bits of the positive part of a value, which is what unsigned BC6H interpolates.
+uint get_unsigned_half(float value) {
+    #if BGFX_SHADER_LANGUAGE_GLSL
+    uint bits = packHalf2x16(vec2(value, 0.0)) & 0xFFFFu;
+    #else
+    uint bits = f32tof16(value);
+    #endif
+    return (bits & 0x8000u) != 0u ? 0u : min(bits, 0x7BFFu);
+}
+
+uvec3 unquantize(uvec3 endpoint) {
+    uvec3 result = endpoint * 64u + 32u;
+    result.x = endpoint.x == 0u ? 0u : (endpoint.x == 1023u ? 0xFFFFu : result.x);
+    result.y = endpoint.y == 0u ? 0u : (endpoint.y == 1023u ? 0xFFFFu : result.y);
+    result.z = endpoint.z == 0u ? 0u : (endpoint.z == 1023u ? 0xFFFFu : result.z);
+    return result;
+}
+
+// Weights of 4-bit indices are round(64 * index / 15).
+uint get_weight(uint index) {
+    return (index * 64u + 7u) / 15u;
+}
+
+void put_bits(inout uvec4 block, inout uint position, uint value, uint bit_count) {
+    for (uint i = 0u; i < bit_count; i++) {
+        uint bit = position + i;
+        block[bit / 32u] |= ((value >> i) & 1u) << (bit % 32u);
+    }
+    position += bit_count;
+}
+
+// Encodes one 4x4 block of a face into mode 11 BC6H, keeps `encode_block` in `bc6h_encoder.cpp` in sync. Face index is
+// the Z component of the invocation.
+NUM_THREADS(8, 8, 1)
+void main() {
+    ivec3 block_texel = ivec3(gl_GlobalInvocationID);
+    int size = int(u_side_resolution);
+    int blocks = (size + 3) / 4;
+    if (block_texel.x >= blocks || block_texel.y >= blocks) {
+        return;
+    }
+
+    uvec3 texels[16];
+    uvec3 low = uvec3(0x7BFFu, 0x7BFFu, 0x7BFFu);
+    uvec3 high = uvec3(0u, 0u, 0u);
+    for (int texel = 0; texel < 16; texel++) {
+        int x = min(block_texel.x * 4 + texel % 4, size - 1);
+        int y = min(block_texel.y * 4 + texel / 4, size - 1);
+        vec4 value = imageLoad(s_input, ivec3(x, y, block_texel.z));
+        texels[texel] = uvec3(get_unsigned_half(value.x), get_unsigned_half(value.y), get_unsigned_half(value.z));
+        low = min(low, texels[texel]);
+        high = max(high, texels[texel]);
+    }
+
+    float best_error = -1.0;
+    uvec3 best_endpoints[2];
+    best_endpoints[0] = uvec3(0u, 0u, 0u);
+    best_endpoints[1] = uvec3(0u, 0u, 0u);
+    uint best_indices[16];
+    for (int texel = 0; texel < 16; texel++) {
+        best_indices[texel] = 0u;
+    }
+
+    // The line through the texels goes along one of the four diagonals of the bounding box.
+    for (uint diagonal = 0u; diagonal < 4u; diagonal++) {
+        bvec3 is_swapped = bvec3(false, (diagonal & 1u) != 0u, (diagonal & 2u) != 0u);
+        uvec3 first = uvec3(is_swapped.x ? high.x : low.x, is_swapped.y ? high.y : low.y, is_swapped.z ? high.z : low.z);
+        uvec3 second = uvec3(is_swapped.x ? low.x : high.x, is_swapped.y ? low.y : high.y, is_swapped.z ? low.z : high.z);
+        uvec3 endpoints[2];
+        endpoints[0] = min(first / 31u, uvec3(1023u, 1023u, 1023u));
+        endpoints[1] = min(second / 31u, uvec3(1023u, 1023u, 1023u));
+        uvec3 unquantized_first = unquantize(endpoints[0]);
+        uvec3 unquantized_second = unquantize(endpoints[1]);
+
+        float error = 0.0;
+        uint indices[16];
+        for (int texel = 0; texel < 16; texel++) {
+            float best_texel_error = -1.0;
+            indices[texel] = 0u;
+            for (uint i = 0u; i < 16u; i++) {
+                uint weight = get_weight(i);
+                uvec3 value = ((64u - weight) * unquantized_first + weight * unquantized_second + 32u) >> 6u;
+                vec3 difference = vec3((value * 31u) >> 6u) - vec3(texels[texel]);
+                float texel_error = dot(difference, difference);
+                if (best_texel_error < 0.0 || texel_error < best_texel_error) {
+                    best_texel_error = texel_error;
+                    indices[texel] = i;
+                }
+            }
+            error += best_texel_error;
+        }
+
+        if (best_error < 0.0 || error < best_error) {
+            best_error = error;
+            best_endpoints[0] = endpoints[0];
+            best_endpoints[1] = endpoints[1];
+            for (int texel = 0; texel < 16; texel++) {
+                best_indices[texel] = indices[texel];
+            }
+        }
+    }
+
+    // The first index is stored without its top bit.
+    if (best_indices[0] >= 8u) {
+        uvec3 endpoint = best_endpoints[0];
+        best_endpoints[0] = best_endpoints[1];
+        best_endpoints[1] = endpoint;
+        for (int texel = 0; texel < 16; texel++) {
+            best_indices[texel] = 15u - best_indices[texel];
+        }
+    }
+
+    uvec4 block = uvec4(0u, 0u, 0u, 0u);
+    uint position = 0u;
+    put_bits(block, position, 3u, 5u);
+    for (int endpoint = 0; endpoint < 2; endpoint++) {
+        put_bits(block, position, best_endpoints[endpoint].x, 10u);
+        put_bits(block, position, best_endpoints[endpoint].y, 10u);
+        put_bits(block, position, best_endpoints[endpoint].z, 10u);
+    }
+    put_bits(block, position, best_indices[0], 3u);
+    for (int texel = 1; texel < 16; texel++) {
+        put_bits(block, position, best_indices[texel], 4u);
+    }
+
+    imageStore(s_output, block_texel, block);
+}
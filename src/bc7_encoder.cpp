@@ -0,0 +1,730 @@
+#include "bc7_encoder.h"
+#include "block_delta.h"
+#include "dds_layout.h"
+#include "thread_pool.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <iomanip>
+#include <limits>
+
+static constexpr uint32_t DXGI_FORMAT_BC7_UNORM = 98;
+
+// Number of block rows encoded by one thread pool task.
+static constexpr size_t BC7_TASK_BLOCK_ROWS = 16;
+
+static const int WEIGHTS_2[4] = { 0, 21, 43, 64 };
+static const int WEIGHTS_4[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+// How endpoints of a subset are stored. Stored values expand to 8 bits by the rules of the mode.
+enum class EndpointEncoding {
+    SEVEN_BITS_WITH_P_BIT, // Mode 6, a p-bit shared by all the channels of an endpoint
+    SEVEN_BITS,            // Mode 5 color
+    EIGHT_BITS             // Mode 5 alpha
+};
+
+struct EndpointFit final {
+    // Stored values and the 8-bit values they expand to, per endpoint and channel.
+    int codes[2][4];
+    int values[2][4];
+    int p_bits[2];
+
+    uint8_t indices[16];
+    uint64_t error;
+};
+
+struct BitWriter final {
+    explicit BitWriter(uint8_t* data) noexcept
+            : data(data) {
+        std::memset(data, 0, 16);
+    }
+
+    void write(uint32_t value, size_t bit_count) noexcept {
+        for (size_t i = 0; i < bit_count; i++) {
+            if ((value >> i) & 1) {
+                data[position / 8] |= static_cast<uint8_t>(1 << (position % 8));
+            }
+            position++;
+        }
+    }
+
+    uint8_t* data;
+    size_t position = 0;
+};
+
+static int interpolate(int a, int b, int weight) noexcept {
+    return ((64 - weight) * a + weight * b + 32) >> 6;
+}
+
+// Expansion of 7-bit mode 5 color codes replicates the top bit.
+static int expand_7_bits(int code) noexcept {
+    return (code << 1) | (code >> 6);
+}
+
+// Quantizes a float endpoint to the closest stored value of every channel.
+static void quantize_endpoint(const float* endpoint, size_t channel_count, EndpointEncoding encoding, int* codes, int* values, int& p_bit) noexcept {
+    p_bit = 0;
+
+    if (encoding == EndpointEncoding::EIGHT_BITS) {
+        for (size_t channel = 0; channel < channel_count; channel++) {
+            codes[channel] = std::clamp(static_cast<int>(std::lround(endpoint[channel])), 0, 255);
+            values[channel] = codes[channel];
+        }
+    } else if (encoding == EndpointEncoding::SEVEN_BITS) {
+        for (size_t channel = 0; channel < channel_count; channel++) {
+            // Expansion replicates the top bit, so rounding to the closest code isn't always the closest value.
+            const int code = std::clamp(static_cast<int>(endpoint[channel] * 127.f / 255.f), 0, 127);
+            int best_code = code;
+            float best_error = std::numeric_limits<float>::max();
+            for (int candidate = code; candidate <= std::min(code + 1, 127); candidate++) {
+                const float error = std::abs(static_cast<float>(expand_7_bits(candidate)) - endpoint[channel]);
+                if (error < best_error) {
+                    best_code = candidate;
+                    best_error = error;
+                }
+            }
+            codes[channel] = best_code;
+            values[channel] = expand_7_bits(best_code);
+        }
+    } else {
+        float best_error = std::numeric_limits<float>::max();
+        for (int p = 0; p < 2; p++) {
+            int candidate_codes[4];
+            float error = 0.f;
+            for (size_t channel = 0; channel < channel_count; channel++) {
+                candidate_codes[channel] = std::clamp(static_cast<int>(std::lround((endpoint[channel] - static_cast<float>(p)) / 2.f)), 0, 127);
+                const float difference = static_cast<float>(candidate_codes[channel] * 2 + p) - endpoint[channel];
+                error += difference * difference;
+            }
+            if (error < best_error) {
+                best_error = error;
+                p_bit = p;
+                for (size_t channel = 0; channel < channel_count; channel++) {
+                    codes[channel] = candidate_codes[channel];
+                    values[channel] = candidate_codes[channel] * 2 + p;
+                }
+            }
+        }
+    }
+}
+
+// Picks the closest palette entry for every pixel and returns the total squared error.
+static uint64_t assign_indices(const int (*pixels)[4], size_t channel_count, const int (*values)[4], const int* weights, size_t weight_count, uint8_t* indices) noexcept {
+    int palette[16][4];
+    for (size_t i = 0; i < weight_count; i++) {
+        for (size_t channel = 0; channel < channel_count; channel++) {
+            palette[i][channel] = interpolate(values[0][channel], values[1][channel], weights[i]);
+        }
+    }
+
+    uint64_t total_error = 0;
+    for (size_t pixel = 0; pixel < 16; pixel++) {
+        int best_error = std::numeric_limits<int>::max();
+        for (size_t i = 0; i < weight_count; i++) {
+            int error = 0;
+            for (size_t channel = 0; channel < channel_count; channel++) {
+                const int difference = palette[i][channel] - pixels[pixel][channel];
+                error += difference * difference;
+            }
+            if (error < best_error) {
+                best_error = error;
+                indices[pixel] = static_cast<uint8_t>(i);
+            }
+        }
+        total_error += static_cast<uint64_t>(best_error);
+    }
+    return total_error;
+}
+
+// Fits two endpoints to the principal axis of the pixels, then refines them with least squares for the chosen
+// indices as many times as the quality allows, keeping the best fit.
+static EndpointFit fit_endpoints(const int (*pixels)[4], size_t channel_count, EndpointEncoding encoding, const int* weights, size_t weight_count, int iterations) noexcept {
+    float mean[4] = {};
+    for (size_t pixel = 0; pixel < 16; pixel++) {
+        for (size_t channel = 0; channel < channel_count; channel++) {
+            mean[channel] += static_cast<float>(pixels[pixel][channel]) / 16.f;
+        }
+    }
+
+    float covariance[4][4] = {};
+    for (size_t pixel = 0; pixel < 16; pixel++) {
+        for (size_t a = 0; a < channel_count; a++) {
+            for (size_t b = 0; b < channel_count; b++) {
+                covariance[a][b] += (static_cast<float>(pixels[pixel][a]) - mean[a]) * (static_cast<float>(pixels[pixel][b]) - mean[b]);
+            }
+        }
+    }
+
+    // Power iteration, starting from the channel with the largest variance.
+    float axis[4] = {};
+    size_t widest_channel = 0;
+    for (size_t channel = 1; channel < channel_count; channel++) {
+        if (covariance[channel][channel] > covariance[widest_channel][widest_channel]) {
+            widest_channel = channel;
+        }
+    }
+    axis[widest_channel] = 1.f;
+
+    for (int iteration = 0; iteration < 8; iteration++) {
+        float next[4] = {};
+        float length = 0.f;
+        for (size_t a = 0; a < channel_count; a++) {
+            for (size_t b = 0; b < channel_count; b++) {
+                next[a] += covariance[a][b] * axis[b];
+            }
+            length += next[a] * next[a];
+        }
+        if (length <= 0.f) {
+            break;
+        }
+        length = std::sqrt(length);
+        for (size_t channel = 0; channel < channel_count; channel++) {
+            axis[channel] = next[channel] / length;
+        }
+    }
+
+    float min_projection = std::numeric_limits<float>::max();
+    float max_projection = std::numeric_limits<float>::lowest();
+    for (size_t pixel = 0; pixel < 16; pixel++) {
+        float projection = 0.f;
+        for (size_t channel = 0; channel < channel_count; channel++) {
+            projection += (static_cast<float>(pixels[pixel][channel]) - mean[channel]) * axis[channel];
+        }
+        min_projection = std::min(min_projection, projection);
+        max_projection = std::max(max_projection, projection);
+    }
+
+    float endpoints[2][4] = {};
+    for (size_t channel = 0; channel < channel_count; channel++) {
+        endpoints[0][channel] = std::clamp(mean[channel] + axis[channel] * min_projection, 0.f, 255.f);
+        endpoints[1][channel] = std::clamp(mean[channel] + axis[channel] * max_projection, 0.f, 255.f);
+    }
+
+    EndpointFit best;
+    best.error = std::numeric_limits<uint64_t>::max();
+
+    for (int iteration = 0; iteration <= iterations; iteration++) {
+        EndpointFit fit;
+        for (size_t endpoint = 0; endpoint < 2; endpoint++) {
+            quantize_endpoint(endpoints[endpoint], channel_count, encoding, fit.codes[endpoint], fit.values[endpoint], fit.p_bits[endpoint]);
+        }
+        fit.error = assign_indices(pixels, channel_count, fit.values, weights, weight_count, fit.indices);
+
+        if (fit.error < best.error) {
+            best = fit;
+        }
+        if (best.error == 0 || iteration == iterations) {
+            break;
+        }
+
+        // Least squares endpoints for the pixel weights of the current indices.
+        float aa = 0.f;
+        float ab = 0.f;
+        float bb = 0.f;
+        float ax[4] = {};
+        float bx[4] = {};
+        for (size_t pixel = 0; pixel < 16; pixel++) {
+            const float t = static_cast<float>(weights[fit.indices[pixel]]) / 64.f;
+            aa += (1.f - t) * (1.f - t);
+            ab += (1.f - t) * t;
+            bb += t * t;
+            for (size_t channel = 0; channel < channel_count; channel++) {
+                ax[channel] += (1.f - t) * static_cast<float>(pixels[pixel][channel]);
+                bx[channel] += t * static_cast<float>(pixels[pixel][channel]);
+            }
+        }
+
+        const float determinant = aa * bb - ab * ab;
+        if (std::abs(determinant) < 1e-6f) {
+            break;
+        }
+
+        for (size_t channel = 0; channel < channel_count; channel++) {
+            endpoints[0][channel] = std::clamp((ax[channel] * bb - bx[channel] * ab) / determinant, 0.f, 255.f);
+            endpoints[1][channel] = std::clamp((bx[channel] * aa - ax[channel] * ab) / determinant, 0.f, 255.f);
+        }
+    }
+
+    return best;
+}
+
+// The first index of a subset is stored without its top bit, so the endpoints are swapped when it's set.
+static void fix_anchor(EndpointFit& fit, size_t channel_count, size_t weight_count) noexcept {
+    if (fit.indices[0] >= weight_count / 2) {
+        for (size_t channel = 0; channel < channel_count; channel++) {
+            std::swap(fit.codes[0][channel], fit.codes[1][channel]);
+            std::swap(fit.values[0][channel], fit.values[1][channel]);
+        }
+        std::swap(fit.p_bits[0], fit.p_bits[1]);
+        for (size_t pixel = 0; pixel < 16; pixel++) {
+            fit.indices[pixel] = static_cast<uint8_t>(weight_count - 1 - fit.indices[pixel]);
+        }
+    }
+}
+
+static void write_indices(BitWriter& writer, const uint8_t* indices, size_t index_bits) noexcept {
+    writer.write(indices[0], index_bits - 1);
+    for (size_t pixel = 1; pixel < 16; pixel++) {
+        writer.write(indices[pixel], index_bits);
+    }
+}
+
+static uint64_t encode_mode_6(const int (*pixels)[4], int iterations, uint8_t* block) noexcept {
+    EndpointFit fit = fit_endpoints(pixels, 4, EndpointEncoding::SEVEN_BITS_WITH_P_BIT, WEIGHTS_4, 16, iterations);
+    fix_anchor(fit, 4, 16);
+
+    BitWriter writer(block);
+    writer.write(1 << 6, 7);
+    for (size_t channel = 0; channel < 4; channel++) {
+        writer.write(static_cast<uint32_t>(fit.codes[0][channel]), 7);
+        writer.write(static_cast<uint32_t>(fit.codes[1][channel]), 7);
+    }
+    writer.write(static_cast<uint32_t>(fit.p_bits[0]), 1);
+    writer.write(static_cast<uint32_t>(fit.p_bits[1]), 1);
+    write_indices(writer, fit.indices, 4);
+
+    return fit.error;
+}
+
+// Rotation swaps alpha with one of the color channels after decoding, so any channel can be interpolated on its own.
+static uint64_t encode_mode_5(const int (*pixels)[4], int rotation, int iterations, uint8_t* block) noexcept {
+    int color[16][4];
+    int alpha[16][4];
+    for (size_t pixel = 0; pixel < 16; pixel++) {
+        int rotated[4] = { pixels[pixel][0], pixels[pixel][1], pixels[pixel][2], pixels[pixel][3] };
+        if (rotation != 0) {
+            std::swap(rotated[rotation - 1], rotated[3]);
+        }
+        for (size_t channel = 0; channel < 3; channel++) {
+            color[pixel][channel] = rotated[channel];
+        }
+        alpha[pixel][0] = rotated[3];
+    }
+
+    EndpointFit color_fit = fit_endpoints(color, 3, EndpointEncoding::SEVEN_BITS, WEIGHTS_2, 4, iterations);
+    EndpointFit alpha_fit = fit_endpoints(alpha, 1, EndpointEncoding::EIGHT_BITS, WEIGHTS_2, 4, iterations);
+    fix_anchor(color_fit, 3, 4);
+    fix_anchor(alpha_fit, 1, 4);
+
+    BitWriter writer(block);
+    writer.write(1 << 5, 6);
+    writer.write(static_cast<uint32_t>(rotation), 2);
+    for (size_t channel = 0; channel < 3; channel++) {
+        writer.write(static_cast<uint32_t>(color_fit.codes[0][channel]), 7);
+        writer.write(static_cast<uint32_t>(color_fit.codes[1][channel]), 7);
+    }
+    writer.write(static_cast<uint32_t>(alpha_fit.codes[0][0]), 8);
+    writer.write(static_cast<uint32_t>(alpha_fit.codes[1][0]), 8);
+    write_indices(writer, color_fit.indices, 2);
+    write_indices(writer, alpha_fit.indices, 2);
+
+    return color_fit.error + alpha_fit.error;
+}
+
+// Mode 5 color endpoints whose index 1 interpolates to an 8-bit value, for every value. Some pair hits every value
+// exactly, all the pairs are tried once.
+struct SingleColorEndpoints final {
+    uint8_t low;
+    uint8_t high;
+};
+
+static const std::array<SingleColorEndpoints, 256>& get_single_color_endpoints() noexcept {
+    static const std::array<SingleColorEndpoints, 256> table = [] {
+        std::array<SingleColorEndpoints, 256> result {};
+        for (int value = 0; value < 256; value++) {
+            int best_error = INT_MAX;
+            for (int low = 0; low < 128 && best_error != 0; low++) {
+                for (int high = 0; high < 128 && best_error != 0; high++) {
+                    const int error = std::abs(interpolate(expand_7_bits(low), expand_7_bits(high), WEIGHTS_2[1]) - value);
+                    if (error < best_error) {
+                        best_error = error;
+                        result[static_cast<size_t>(value)] = { static_cast<uint8_t>(low), static_cast<uint8_t>(high) };
+                    }
+                }
+            }
+        }
+        return result;
+    }();
+    return table;
+}
+
+// Blocks of a single color, common in masks, UI and mostly white ambient occlusion, are written straight from the table
+// rather than searched: mode 5 with every color index 1 and alpha in both endpoints is exact for every color.
+static void encode_single_color_block(const uint8_t* rgba, uint8_t* block) noexcept {
+    const std::array<SingleColorEndpoints, 256>& endpoints = get_single_color_endpoints();
+
+    BitWriter writer(block);
+    writer.write(1 << 5, 6);
+    writer.write(0, 2);
+    for (size_t channel = 0; channel < 3; channel++) {
+        writer.write(endpoints[rgba[channel]].low, 7);
+        writer.write(endpoints[rgba[channel]].high, 7);
+    }
+    writer.write(rgba[3], 8);
+    writer.write(rgba[3], 8);
+
+    uint8_t color_indices[16];
+    uint8_t alpha_indices[16];
+    std::fill_n(color_indices, 16, 1);
+    std::fill_n(alpha_indices, 16, 0);
+    write_indices(writer, color_indices, 2);
+    write_indices(writer, alpha_indices, 2);
+}
+
+// Rotations of mode 5 in the order `Bc7Search` tries them.
+static constexpr int BC7_ROTATION_ORDERS[3][4] = { { 0, 1, 2, 3 }, { 0, 1, 2, 3 }, { 1, 2, 0, 3 } };
+
+uint64_t encode_bc7_block(const uint8_t* rgba, EncoderQuality quality, Bc7Search search, uint8_t* block) noexcept {
+    bool is_single_color = true;
+    for (size_t pixel = 1; pixel < 16 && is_single_color; pixel++) {
+        is_single_color = std::memcmp(rgba + pixel * 4, rgba, 4) == 0;
+    }
+    if (is_single_color) {
+        encode_single_color_block(rgba, block);
+        return 0;
+    }
+
+    int pixels[16][4];
+    bool is_alpha_constant = true;
+    for (size_t pixel = 0; pixel < 16; pixel++) {
+        for (size_t channel = 0; channel < 4; channel++) {
+            pixels[pixel][channel] = rgba[pixel * 4 + channel];
+        }
+        is_alpha_constant = is_alpha_constant && pixels[pixel][3] == pixels[0][3];
+    }
+
+    int iterations = 0;
+    int rotation_count = 0;
+    switch (quality) {
+        case EncoderQuality::FASTEST:
+            break;
+        case EncoderQuality::NORMAL:
+            iterations = 1;
+            rotation_count = 1;
+            break;
+        case EncoderQuality::PRODUCTION:
+            iterations = 2;
+            rotation_count = 4;
+            break;
+        case EncoderQuality::HIGHEST:
+            iterations = 4;
+            rotation_count = 4;
+            break;
+    }
+
+    const bool is_mode_6 = search != Bc7Search::INDEPENDENT_CHANNELS;
+    uint64_t best_error = is_mode_6 ? encode_mode_6(pixels, iterations, block) : UINT64_MAX;
+
+    // Mode 5 keeps alpha exact when it's constant, so it's worth a try even at the fastest quality, and without mode 6
+    // it's the only mode.
+    if ((is_alpha_constant || !is_mode_6) && rotation_count == 0) {
+        rotation_count = 1;
+    }
+    if (search == Bc7Search::SEPARATE_ALPHA) {
+        rotation_count = std::min(rotation_count, 1);
+    }
+
+    const int* rotations = BC7_ROTATION_ORDERS[static_cast<size_t>(search)];
+    for (int i = 0; i < rotation_count && best_error != 0; i++) {
+        uint8_t candidate[16];
+        const uint64_t error = encode_mode_5(pixels, rotations[i], iterations, candidate);
+        if (error < best_error) {
+            best_error = error;
+            std::memcpy(block, candidate, sizeof(candidate));
+        }
+    }
+    return best_error;
+}
+
+// Gathers the RGBA pixels of a block of a B8G8R8A8 level. Pixels past the edges of levels smaller than a block repeat
+// the last row and column.
+static void gather_block(const uint8_t* bgra, size_t width, size_t height, size_t index, uint8_t* rgba) noexcept {
+    const size_t blocks_x = (width + 3) / 4;
+    const size_t block_x = index % blocks_x;
+    const size_t block_y = index / blocks_x;
+
+    for (size_t y = 0; y < 4; y++) {
+        for (size_t x = 0; x < 4; x++) {
+            const size_t pixel_x = std::min(block_x * 4 + x, width - 1);
+            const size_t pixel_y = std::min(block_y * 4 + y, height - 1);
+            const uint8_t* source = bgra + (pixel_y * width + pixel_x) * 4;
+            uint8_t* destination = rgba + (y * 4 + x) * 4;
+            destination[0] = source[2];
+            destination[1] = source[1];
+            destination[2] = source[0];
+            destination[3] = source[3];
+        }
+    }
+}
+
+static uint64_t hash_block(const uint8_t* rgba) noexcept {
+    uint64_t hash = 0;
+    for (size_t word = 0; word < 8; word++) {
+        uint64_t value;
+        std::memcpy(&value, rgba + word * 8, sizeof(value));
+        hash = (hash ^ value) * 0x9E3779B97F4A7C15ULL;
+        hash ^= hash >> 32;
+    }
+    return hash;
+}
+
+static void hash_block_rows(const uint8_t* bgra, size_t width, size_t height, size_t row_begin, size_t row_end, uint64_t* hashes) noexcept {
+    const size_t blocks_x = (width + 3) / 4;
+
+    for (size_t index = row_begin * blocks_x; index < row_end * blocks_x; index++) {
+        uint8_t rgba[16 * 4];
+        gather_block(bgra, width, height, index, rgba);
+        hashes[index] = hash_block(rgba);
+    }
+}
+
+// Points every block of a level at the first block of the level with the same pixels, unique blocks at themselves, so
+// tiled and repeated content is encoded once. Blocks with the same hash are compared pixel by pixel.
+static void find_duplicate_blocks(const uint8_t* bgra, size_t width, size_t height, const uint64_t* hashes, uint32_t* sources) {
+    const size_t block_count = (width + 3) / 4 * ((height + 3) / 4);
+
+    // Open addressing with linear probing, at most half full.
+    size_t table_size = 1;
+    while (table_size < block_count * 2) {
+        table_size *= 2;
+    }
+    std::vector<uint32_t> table(table_size, UINT32_MAX);
+
+    for (size_t index = 0; index < block_count; index++) {
+        sources[index] = static_cast<uint32_t>(index);
+
+        for (size_t slot = hashes[index] & (table_size - 1);; slot = (slot + 1) & (table_size - 1)) {
+            const uint32_t candidate = table[slot];
+            if (candidate == UINT32_MAX) {
+                table[slot] = static_cast<uint32_t>(index);
+                break;
+            }
+
+            if (hashes[candidate] == hashes[index]) {
+                uint8_t rgba[16 * 4];
+                uint8_t candidate_rgba[16 * 4];
+                gather_block(bgra, width, height, index, rgba);
+                gather_block(bgra, width, height, candidate, candidate_rgba);
+                if (std::memcmp(rgba, candidate_rgba, sizeof(rgba)) == 0) {
+                    sources[index] = candidate;
+                    break;
+                }
+            }
+        }
+    }
+}
+
+// Encodes block rows [`row_begin`, `row_end`) of a B8G8R8A8 level. Duplicates of earlier blocks are left to
+// `encode_bc7`, which copies them once their sources are encoded. Blocks are encoded at the fastest quality first when
+// `max_squared_error` isn't zero, and again at `quality` when their squared error exceeds it. Changed blocks whose
+// previous block `warm_start` keeps aren't encoded at all. Returns the number of blocks encoded again.
+static size_t encode_block_rows(const uint8_t* bgra, size_t width, size_t height, size_t row_begin, size_t row_end, EncoderQuality quality, Bc7Search search,
+                                uint64_t max_squared_error, uint8_t* output, const uint32_t* sources, const uint8_t* previous, const uint8_t* is_changed,
+                                const BlockReuse* warm_start) noexcept {
+    const size_t blocks_x = (width + 3) / 4;
+    const bool is_refined = max_squared_error != 0 && quality != EncoderQuality::FASTEST;
+
+    size_t refined_count = 0;
+    for (size_t index = row_begin * blocks_x; index < row_end * blocks_x; index++) {
+        if (sources[index] != index) {
+            continue;
+        }
+
+        if (is_changed != nullptr && is_changed[index] == 0) {
+            std::memcpy(output + index * 16, previous + index * 16, 16);
+            continue;
+        }
+
+        uint8_t rgba[16 * 4];
+        gather_block(bgra, width, height, index, rgba);
+        if (warm_start != nullptr && keep_previous_block(*warm_start, ReusedBlockFormat::BC7, previous + index * 16, rgba)) {
+            std::memcpy(output + index * 16, previous + index * 16, 16);
+            continue;
+        }
+
+        if (!is_refined) {
+            encode_bc7_block(rgba, quality, search, output + index * 16);
+        } else if (encode_bc7_block(rgba, EncoderQuality::FASTEST, search, output + index * 16) > max_squared_error) {
+            encode_bc7_block(rgba, quality, search, output + index * 16);
+            refined_count++;
+        }
+    }
+    return refined_count;
+}
+
+bool encode_bc7(std::vector<char>& dds, const MipQualities& qualities, Bc7Search search, float max_error, ThreadPool& pool, std::ostream& log, const BlockReuse* reuse) {
+    Dds10Header header;
+    if (!read_dds10_header(dds.data(), dds.size(), header) || header.dxgi_format != DXGI_FORMAT_B8G8R8A8_UNORM) {
+        log << "\rTexture compiler error. BC7 encoder requires a B8G8R8A8 DDS texture with the DX10 header." << std::endl;
+        return false;
+    }
+
+    if (header.dimension != DDS10_DIMENSION_TEXTURE_2D || header.misc_flags != 0) {
+        log << "\rTexture compiler error. BC7 encoder supports only 2D textures and texture arrays." << std::endl;
+        return false;
+    }
+
+    const EncodedLayout layout = get_encoded_layout(header, 4, 16);
+    if (layout.input_size != dds.size()) {
+        log << "\rTexture compiler error. DDS texture size doesn't match its mip levels." << std::endl;
+        return false;
+    }
+
+    reuse = match_block_reuse(reuse, layout);
+    const size_t block_count = layout.block_count;
+
+    std::vector<char> bc7(layout.output_size);
+    std::memcpy(bc7.data(), dds.data(), DDS10_HEADER_SIZE);
+    std::memcpy(bc7.data() + 128, &DXGI_FORMAT_BC7_UNORM, sizeof(DXGI_FORMAT_BC7_UNORM));
+
+    // Block indices of `hashes` and `sources` start over at every mip level of every layer.
+    std::vector<uint64_t> hashes(block_count);
+    std::vector<uint32_t> sources(block_count);
+
+    struct Level final {
+        const uint8_t* input;
+        uint8_t* output;
+        size_t width;
+        size_t height;
+        size_t first_block;
+        EncoderQuality quality;
+        const uint8_t* previous;
+        const uint8_t* is_changed;
+    };
+
+    std::vector<Level> levels;
+    levels.reserve(layout.levels.size());
+
+    for (const EncodedLevel& level : layout.levels) {
+        Level& entry = levels.emplace_back();
+        entry.input = reinterpret_cast<const uint8_t*>(dds.data() + level.input.offset);
+        entry.output = reinterpret_cast<uint8_t*>(bc7.data() + level.output.offset);
+        entry.width = level.input.width;
+        entry.height = level.input.height;
+        entry.first_block = level.first_block;
+        entry.quality = get_mip_quality(qualities, level.input.mip_level);
+        entry.previous = reuse != nullptr ? reinterpret_cast<const uint8_t*>(reuse->previous.data() + level.output.offset) : nullptr;
+        entry.is_changed = reuse != nullptr ? reuse->is_changed.data() + level.first_block : nullptr;
+    }
+
+    // Blocks are hashed on the thread pool, then duplicates are found level by level on this thread, a probe per block
+    // is far cheaper than encoding it.
+    TaskGroup hash_group;
+    for (const Level& level : levels) {
+        const size_t blocks_y = (level.height + 3) / 4;
+        for (size_t row = 0; row < blocks_y; row += BC7_TASK_BLOCK_ROWS) {
+            const size_t row_end = std::min(row + BC7_TASK_BLOCK_ROWS, blocks_y);
+            uint64_t* level_hashes = hashes.data() + level.first_block;
+            pool.push(hash_group, [level, row, row_end, level_hashes] {
+                hash_block_rows(level.input, level.width, level.height, row, row_end, level_hashes);
+            });
+        }
+    }
+    pool.wait(hash_group);
+
+    for (const Level& level : levels) {
+        find_duplicate_blocks(level.input, level.width, level.height, hashes.data() + level.first_block, sources.data() + level.first_block);
+    }
+
+    // RMSE over the 16 pixels and 4 channels of a block.
+    const uint64_t max_squared_error = max_error > 0.f ? std::max(static_cast<uint64_t>(static_cast<double>(max_error) * max_error * 64.0), uint64_t { 1 }) : 0;
+    std::atomic<size_t> refined_count { 0 };
+    const BlockReuse* const warm_start = reuse != nullptr && reuse->max_error > 0.f ? reuse : nullptr;
+
+    TaskGroup group;
+    for (const Level& level : levels) {
+        const size_t blocks_y = (level.height + 3) / 4;
+        for (size_t row = 0; row < blocks_y; row += BC7_TASK_BLOCK_ROWS) {
+            const size_t row_end = std::min(row + BC7_TASK_BLOCK_ROWS, blocks_y);
+            const uint32_t* level_sources = sources.data() + level.first_block;
+            pool.push(group, [level, row, row_end, search, max_squared_error, level_sources, warm_start, &refined_count] {
+                refined_count += encode_block_rows(level.input, level.width, level.height, row, row_end, level.quality, search, max_squared_error, level.output,
+                                                   level_sources, level.previous, level.is_changed, warm_start);
+            });
+        }
+    }
+    pool.wait(group);
+
+    if (max_squared_error != 0) {
+        log << "\rRefined " << refined_count.load() << " of " << block_count << " BC7 blocks above --max-error." << std::endl;
+    }
+
+    // Sources always come before their duplicates.
+    for (const Level& level : levels) {
+        const size_t level_block_count = (level.width + 3) / 4 * ((level.height + 3) / 4);
+        for (size_t index = 0; index < level_block_count; index++) {
+            const uint32_t source = sources[level.first_block + index];
+            if (source != index) {
+                std::memcpy(level.output + index * 16, level.output + static_cast<size_t>(source) * 16, 16);
+            }
+        }
+    }
+
+    dds = std::move(bc7);
+    return true;
+}
+
+bool pick_bc7_quality(const std::vector<char>& dds, Bc7Search search, float target_psnr, EncoderQuality& quality, std::ostream& log) {
+    Dds10Header header;
+    if (!read_dds10_header(dds.data(), dds.size(), header) || header.dxgi_format != DXGI_FORMAT_B8G8R8A8_UNORM) {
+        log << "\rTexture compiler error. BC7 encoder requires a B8G8R8A8 DDS texture with the DX10 header." << std::endl;
+        return false;
+    }
+
+    const size_t height = header.height;
+    const size_t width = header.width;
+    if (width == 0 || height == 0 || dds.size() < DDS10_HEADER_SIZE + width * height * 4) {
+        log << "\rTexture compiler error. DDS texture size doesn't match its mip levels." << std::endl;
+        return false;
+    }
+
+    // Blocks are picked by a hash of their sample index, so the same texture always gets the same sample.
+    const uint8_t* bgra = reinterpret_cast<const uint8_t*>(dds.data() + DDS10_HEADER_SIZE);
+    const size_t block_count = (width + 3) / 4 * ((height + 3) / 4);
+    const size_t sample_count = std::min(std::max(block_count / 64, size_t { 256 }), block_count);
+    std::vector<uint8_t> sample(sample_count * 16 * 4);
+    for (size_t i = 0; i < sample_count; i++) {
+        uint64_t hash = (i + 1) * 0x9E3779B97F4A7C15ULL;
+        hash = (hash ^ hash >> 31) * 0xBF58476D1CE4E5B9ULL;
+        hash ^= hash >> 27;
+        const size_t index = sample_count == block_count ? i : static_cast<size_t>(hash % block_count);
+        gather_block(bgra, width, height, index, sample.data() + i * 16 * 4);
+    }
+
+    static const char* const QUALITY_NAMES[] = { "fastest", "normal", "production", "highest" };
+    static constexpr EncoderQuality QUALITIES[] = { EncoderQuality::FASTEST, EncoderQuality::NORMAL, EncoderQuality::PRODUCTION, EncoderQuality::HIGHEST };
+
+    quality = EncoderQuality::HIGHEST;
+    double best_seconds = std::numeric_limits<double>::max();
+    double best_psnr = 0.0;
+    for (const EncoderQuality candidate : QUALITIES) {
+        const auto begin = std::chrono::steady_clock::now();
+        uint64_t squared_error = 0;
+        for (size_t i = 0; i < sample_count; i++) {
+            uint8_t block[16];
+            squared_error += encode_bc7_block(sample.data() + i * 16 * 4, candidate, search, block);
+        }
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+        const double mean_squared_error = static_cast<double>(squared_error) / static_cast<double>(sample_count * 16 * 4);
+        const double psnr = mean_squared_error > 0.0 ? 10.0 * std::log10(255.0 * 255.0 / mean_squared_error) : std::numeric_limits<double>::infinity();
+        if (psnr >= target_psnr && seconds < best_seconds) {
+            quality = candidate;
+            best_seconds = seconds;
+            best_psnr = psnr;
+        } else if (best_seconds == std::numeric_limits<double>::max()) {
+            best_psnr = psnr;
+        }
+    }
+
+    log << "\rAuto quality picked " << QUALITY_NAMES[static_cast<size_t>(quality)] << " at " << std::fixed << std::setprecision(2) << best_psnr << " dB over "
+        << sample_count << " sample blocks" << (best_seconds == std::numeric_limits<double>::max() ? ", below the target." : ".") << std::defaultfloat
+        << std::setprecision(6) << std::endl;
+    return true;
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "encoder_quality.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+struct BlockReuse;
+struct ThreadPool;
+
+// Modes the encoder searches for the blocks of a texture, in the order it tries them. Mode 5 is tried in as many
+// rotations of the order as the quality allows: none at the fastest quality, unless alpha of the block is constant or
+// mode 6 isn't searched, one at the normal quality and all four at the production and highest qualities.
+enum class Bc7Search {
+    // Mode 6, then mode 5 with alpha in its own plane and then with red, green or blue in it instead.
+    ALL,
+
+    // Mode 6 and mode 5 with alpha in its own plane only, for color with an unrelated map in alpha like albedo
+    // roughness. The color channels follow each other, so giving one of them the plane of alpha hardly ever pays off.
+    SEPARATE_ALPHA,
+
+    // Mode 5 only, with red in its own plane, then green, alpha and blue, for normal metalness ambient occlusion,
+    // whose channels are independent. Mode 6 interpolates all of them together and hardly ever wins.
+    INDEPENDENT_CHANNELS
+};
+
+// Encodes a single 4x4 block of RGBA8 pixels, rows from the top, into 16 bytes of BC7. Only the single subset modes 5
+// and 6 are searched, which makes the encoder orders of magnitude faster than nvtt, which searches every mode and
+// partition, at the cost of smooth gradients with several colors in one block. Mode 6 interpolates all the channels
+// together, mode 5 interpolates alpha separately, which suits textures with an unrelated map in the alpha channel.
+// Blocks of a single color skip the search, a table gives their exact mode 5 endpoints. Returns the squared error of
+// the block summed over its pixels and channels.
+uint64_t encode_bc7_block(const uint8_t* rgba, EncoderQuality quality, Bc7Search search, uint8_t* block) noexcept;
+
+// Replaces the B8G8R8A8 mip levels of a 2D DDS texture with the DX10 header with BC7 blocks. Blocks rows are encoded
+// on the thread pool. Blocks with the same pixels as an earlier block of the same mip level are encoded once and copied.
+// `qualities` are the search effort of every mip level, layers of texture arrays share them. With a positive
+// `max_error` every block is encoded at the fastest quality first and encoded again at the quality of its mip level
+// only when its RMSE over the 8-bit channels exceeds `max_error`, and the number of blocks encoded again is printed.
+bool encode_bc7(std::vector<char>& dds, const MipQualities& qualities, Bc7Search search, float max_error, ThreadPool& pool, std::ostream& log,
+                const BlockReuse* reuse = nullptr);
+
+// Encodes a sample of the blocks of the largest mip level of the first layer of a B8G8R8A8 2D DDS texture with the DX10
+// header at every quality and sets `quality` to the one that took the least time to reach `target_psnr` over the
+// sample, or to the highest quality when none does. The sample is a sixty-fourth of the blocks, at least 256 of them,
+// so it costs a few percent of encoding the texture. The pick is printed.
+bool pick_bc7_quality(const std::vector<char>& dds, Bc7Search search, float target_psnr, EncoderQuality& quality, std::ostream& log);
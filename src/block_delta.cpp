@@ -0,0 +1,234 @@
+#include "block_delta.h"
+#include "atomic_file.h"
+#include "dds_layout.h"
+#include "etc2_encoder.h"
+#include "thread_pool.h"
+
+#include <algorithm>
+#include <bimg/bimg.h>
+#include <bx/allocator.h>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+// Rows of tiles hashed by a single task.
+static constexpr size_t DELTA_TASK_TILE_ROWS = 4;
+
+// Start of every fingerprint, so fingerprints of an incompatible format are never mistaken for valid ones.
+static const char BLOCK_FINGERPRINT_MAGIC[] = "texture.compiler blocks 1\n";
+
+static std::string get_block_fingerprint_path(const std::string& output) {
+    return output + ".blocks";
+}
+
+static size_t get_tile_count(size_t size) noexcept {
+    return (size + DELTA_TILE_SIZE - 1) / DELTA_TILE_SIZE;
+}
+
+// Mip levels of every layer of a B8G8R8A8 or R8 texture.
+static bool get_delta_levels(const std::vector<char>& dds, size_t& pixel_size, std::vector<DdsLevel>& levels) {
+    Dds10Header header;
+    if (!read_dds10_header(dds.data(), dds.size(), header) || (header.dxgi_format != DXGI_FORMAT_B8G8R8A8_UNORM && header.dxgi_format != DXGI_FORMAT_R8_UNORM) ||
+        header.dimension != DDS10_DIMENSION_TEXTURE_2D || header.misc_flags != 0) {
+        return false;
+    }
+
+    pixel_size = header.dxgi_format == DXGI_FORMAT_R8_UNORM ? 1 : 4;
+    levels = get_dds_levels(header.width, header.height, header.level_count, header.array_size, static_cast<uint32_t>(pixel_size), false);
+    return get_dds_size(levels) == dds.size();
+}
+
+bool compute_tile_hashes(const std::vector<char>& dds, ThreadPool& pool, std::vector<uint64_t>& tiles, std::ostream& log) {
+    size_t pixel_size;
+    std::vector<DdsLevel> levels;
+    if (!get_delta_levels(dds, pixel_size, levels)) {
+        log << "\rTexture compiler error. Delta encoding requires a B8G8R8A8 or R8 2D DDS texture with the DX10 header." << std::endl;
+        return false;
+    }
+
+    size_t tile_count = 0;
+    for (const DdsLevel& level : levels) {
+        tile_count += get_tile_count(level.width) * get_tile_count(level.height);
+    }
+    tiles.assign(tile_count, 0);
+
+    TaskGroup group;
+
+    size_t first_tile = 0;
+    for (const DdsLevel& level : levels) {
+        const size_t tiles_x = get_tile_count(level.width);
+        const size_t tiles_y = get_tile_count(level.height);
+        const uint8_t* input = reinterpret_cast<const uint8_t*>(dds.data() + level.offset);
+        uint64_t* output = tiles.data() + first_tile;
+
+        for (size_t row = 0; row < tiles_y; row += DELTA_TASK_TILE_ROWS) {
+            const size_t row_end = std::min(row + DELTA_TASK_TILE_ROWS, tiles_y);
+            pool.push(group, [=] {
+                for (size_t tile_y = row; tile_y < row_end; tile_y++) {
+                    for (size_t tile_x = 0; tile_x < tiles_x; tile_x++) {
+                        const size_t x_begin = tile_x * DELTA_TILE_SIZE;
+                        const size_t x_size = std::min(DELTA_TILE_SIZE, level.width - x_begin) * pixel_size;
+                        const size_t y_end = std::min((tile_y + 1) * DELTA_TILE_SIZE, level.height);
+
+                        Hasher hasher;
+                        for (size_t y = tile_y * DELTA_TILE_SIZE; y < y_end; y++) {
+                            hasher.update(input + (y * level.width + x_begin) * pixel_size, x_size);
+                        }
+                        output[tile_y * tiles_x + tile_x] = hasher.finish().low;
+                    }
+                }
+            });
+        }
+
+        first_tile += tiles_x * tiles_y;
+    }
+
+    pool.wait(group);
+    return true;
+}
+
+bool get_changed_blocks(const std::vector<char>& dds, const std::vector<uint64_t>& previous_tiles, const std::vector<uint64_t>& tiles,
+                        std::vector<uint8_t>& is_changed, size_t& changed_count) {
+    size_t pixel_size;
+    std::vector<DdsLevel> levels;
+    if (previous_tiles.size() != tiles.size() || !get_delta_levels(dds, pixel_size, levels)) {
+        return false;
+    }
+
+    is_changed.clear();
+    changed_count = 0;
+
+    size_t first_tile = 0;
+    for (const DdsLevel& level : levels) {
+        const size_t tiles_x = get_tile_count(level.width);
+        const size_t blocks_x = (level.width + 3) / 4;
+        const size_t blocks_y = (level.height + 3) / 4;
+
+        for (size_t block_y = 0; block_y < blocks_y; block_y++) {
+            for (size_t block_x = 0; block_x < blocks_x; block_x++) {
+                const size_t tile = first_tile + block_y * 4 / DELTA_TILE_SIZE * tiles_x + block_x * 4 / DELTA_TILE_SIZE;
+                const bool is_block_changed = previous_tiles[tile] != tiles[tile];
+                is_changed.push_back(is_block_changed ? 1 : 0);
+                changed_count += is_block_changed ? 1 : 0;
+            }
+        }
+
+        first_tile += tiles_x * get_tile_count(level.height);
+    }
+    return true;
+}
+
+bool read_block_fingerprint(const std::string& output, BlockFingerprint& fingerprint) {
+    std::ifstream stream(get_block_fingerprint_path(output), std::ios::binary);
+    if (!stream) {
+        return false;
+    }
+
+    char magic[sizeof(BLOCK_FINGERPRINT_MAGIC) - 1];
+    if (!stream.read(magic, sizeof(magic)) || std::memcmp(magic, BLOCK_FINGERPRINT_MAGIC, sizeof(magic)) != 0) {
+        return false;
+    }
+
+    uint64_t tile_count;
+    if (!stream.read(reinterpret_cast<char*>(&fingerprint.encoding.low), sizeof(uint64_t)) ||
+        !stream.read(reinterpret_cast<char*>(&fingerprint.encoding.high), sizeof(uint64_t)) || !stream.read(reinterpret_cast<char*>(&tile_count), sizeof(tile_count))) {
+        return false;
+    }
+
+    // Sizes come from the file, so they're checked against what's left in it before anything is allocated.
+    const std::streamoff position = stream.tellg();
+    stream.seekg(0, std::ios::end);
+    const std::streamoff remaining = stream.tellg() - position;
+    stream.seekg(position);
+    if (remaining < 0 || tile_count > static_cast<uint64_t>(remaining) / sizeof(uint64_t)) {
+        return false;
+    }
+
+    fingerprint.tiles.resize(static_cast<size_t>(tile_count));
+    fingerprint.blocks.resize(static_cast<size_t>(remaining) - fingerprint.tiles.size() * sizeof(uint64_t));
+    return stream.read(reinterpret_cast<char*>(fingerprint.tiles.data()), static_cast<std::streamsize>(fingerprint.tiles.size() * sizeof(uint64_t))) &&
+           stream.read(fingerprint.blocks.data(), static_cast<std::streamsize>(fingerprint.blocks.size()));
+}
+
+bool write_block_fingerprint(const std::string& output, const BlockFingerprint& fingerprint) {
+    const std::string path = get_block_fingerprint_path(output);
+    const std::string temporary_path = get_temporary_path(path);
+
+    {
+        const uint64_t tile_count = fingerprint.tiles.size();
+
+        std::ofstream stream(temporary_path, std::ios::binary);
+        stream.write(BLOCK_FINGERPRINT_MAGIC, sizeof(BLOCK_FINGERPRINT_MAGIC) - 1);
+        stream.write(reinterpret_cast<const char*>(&fingerprint.encoding.low), sizeof(uint64_t));
+        stream.write(reinterpret_cast<const char*>(&fingerprint.encoding.high), sizeof(uint64_t));
+        stream.write(reinterpret_cast<const char*>(&tile_count), sizeof(tile_count));
+        stream.write(reinterpret_cast<const char*>(fingerprint.tiles.data()), static_cast<std::streamsize>(fingerprint.tiles.size() * sizeof(uint64_t)));
+        stream.write(fingerprint.blocks.data(), static_cast<std::streamsize>(fingerprint.blocks.size()));
+
+        stream.close();
+        if (!stream) {
+            std::remove(temporary_path.c_str());
+            return false;
+        }
+    }
+
+    return replace_file(temporary_path, path);
+}
+
+const BlockReuse* match_block_reuse(const BlockReuse* reuse, const EncodedLayout& layout) noexcept {
+    if (reuse != nullptr && (reuse->previous.size() != layout.output_size || reuse->is_changed.size() != layout.block_count)) {
+        return nullptr;
+    }
+    return reuse;
+}
+
+bool keep_previous_block(const BlockReuse& reuse, ReusedBlockFormat format, const uint8_t* block, const uint8_t* pixels) noexcept {
+    // Single channel formats are decoded to the red channel, like `decode_dds_level` decodes them.
+    uint8_t decoded[16 * 4];
+    bx::DefaultAllocator allocator;
+    switch (format) {
+        case ReusedBlockFormat::BC7:
+            bimg::imageDecodeToRgba8(&allocator, decoded, block, 4, 4, 4 * 4, bimg::TextureFormat::BC7);
+            break;
+        case ReusedBlockFormat::ETC2_RGBA8: {
+            // bimg decodes the color as ETC2 RGB8 but not the EAC alpha in front of it.
+            bimg::imageDecodeToRgba8(&allocator, decoded, block + 8, 4, 4, 4 * 4, bimg::TextureFormat::ETC2);
+            uint8_t alpha[16];
+            decode_eac_block(block, false, alpha);
+            for (size_t pixel = 0; pixel < 16; pixel++) {
+                decoded[pixel * 4 + 3] = alpha[pixel];
+            }
+            break;
+        }
+        case ReusedBlockFormat::EAC_R11: {
+            uint8_t red[16];
+            decode_eac_block(block, true, red);
+            for (size_t pixel = 0; pixel < 16; pixel++) {
+                decoded[pixel * 4] = red[pixel];
+            }
+            break;
+        }
+        case ReusedBlockFormat::ASTC_4X4:
+        case ReusedBlockFormat::ASTC_4X4_LUMINANCE:
+            bimg::imageDecodeToRgba8(&allocator, decoded, block, 4, 4, 4 * 4, bimg::TextureFormat::ASTC4x4);
+            break;
+    }
+
+    const bool is_single_channel = format == ReusedBlockFormat::EAC_R11 || format == ReusedBlockFormat::ASTC_4X4_LUMINANCE;
+    const size_t channel_count = is_single_channel ? 1 : 4;
+
+    uint64_t squared_error = 0;
+    for (size_t pixel = 0; pixel < 16; pixel++) {
+        for (size_t channel = 0; channel < channel_count; channel++) {
+            const int difference = static_cast<int>(decoded[pixel * 4 + channel]) - static_cast<int>(pixels[pixel * channel_count + channel]);
+            squared_error += static_cast<uint64_t>(difference * difference);
+        }
+    }
+
+    const double max_squared_error = static_cast<double>(reuse.max_error) * reuse.max_error * 16.0 * static_cast<double>(channel_count);
+    if (static_cast<double>(squared_error) > max_squared_error) {
+        return false;
+    }
+    reuse.kept_count++;
+    return true;
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "hash.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+struct EncodedLayout;
+struct ThreadPool;
+
+// Blocks encoded by a previous compilation that `encode_bc7`, `encode_etc2` and `encode_astc` copy instead of encoding
+// them again. Every block depends on its own texels only, so copied blocks are exactly what encoding would produce.
+struct BlockReuse final {
+    // Encoded DDS texture with the same size, mip levels, layers and block format as the one being encoded.
+    const std::vector<char>& previous;
+
+    // A flag for every block of every mip level of every layer in the order of the texture, nonzero when the block is
+    // encoded again.
+    const std::vector<uint8_t>& is_changed;
+
+    // RMSE over the 8-bit channels of `--warm-start`. With a positive value the previous block of a changed block is
+    // decoded first and kept instead of encoding the block again when its error is at most this, see
+    // `keep_previous_block`.
+    float max_error = 0.f;
+
+    // Changed blocks kept by `keep_previous_block`, counted by the encoders.
+    mutable std::atomic<size_t> kept_count { 0 };
+};
+
+// `reuse` when its blocks are laid out like the output of `layout`, null otherwise. Blocks of a texture of another layout
+// would end up in the wrong places, every block is encoded instead.
+const BlockReuse* match_block_reuse(const BlockReuse* reuse, const EncodedLayout& layout) noexcept;
+
+// Formats of the blocks `keep_previous_block` decodes.
+enum class ReusedBlockFormat {
+    BC7,
+    ETC2_RGBA8,
+    EAC_R11,
+    ASTC_4X4,
+    ASTC_4X4_LUMINANCE
+};
+
+// Decodes the previous `block` of changed texels and compares it with the `pixels` the encoder is about to encode, 16
+// RGBA8 pixels or 16 R8 values for the single channel formats, rows from the top. Returns true and counts the block
+// when the RMSE is at most `reuse.max_error`. Textures barely change after a small edit or a tweak of the filter, and
+// decoding a block costs a fraction of a search of its modes and endpoints, so most blocks of such a rebuild are never
+// encoded again. Kept blocks are not what encoding the texels would produce, but every one is within the tolerance
+// of the texels it stands for, so errors don't pile up over rebuilds.
+bool keep_previous_block(const BlockReuse& reuse, ReusedBlockFormat format, const uint8_t* block, const uint8_t* pixels) noexcept;
+
+// Side in texels of the square tiles that are fingerprinted together, 8x8 blocks. Per block hashes of an 8K texture
+// would take more space than its blocks.
+static constexpr size_t DELTA_TILE_SIZE = 32;
+
+// What `--delta` keeps in a `<output>.blocks` file next to the output to encode only what changed next time.
+struct BlockFingerprint final {
+    // Hash of everything that affects the blocks of identical texels: the compiler version, the block format, the
+    // encoder and its quality.
+    Hash encoding;
+
+    // Hash of every tile of the uncompressed texture, tiles of every mip level of every layer in the order of the
+    // texture, rows of tiles from the top.
+    std::vector<uint64_t> tiles;
+
+    // Encoded DDS texture before `--rdo` and the container conversion.
+    std::vector<char> blocks;
+};
+
+// Hashes the tiles of the B8G8R8A8 or R8 mip levels of a 2D DDS texture with the DX10 header. Rows of tiles are hashed
+// on the thread pool.
+bool compute_tile_hashes(const std::vector<char>& dds, ThreadPool& pool, std::vector<uint64_t>& tiles, std::ostream& log);
+
+// Flags the blocks of the tiles that differ between `previous_tiles` and `tiles` of the same texture. Returns false
+// when `previous_tiles` were computed for a texture of another size, so nothing can be reused.
+bool get_changed_blocks(const std::vector<char>& dds, const std::vector<uint64_t>& previous_tiles, const std::vector<uint64_t>& tiles,
+                        std::vector<uint8_t>& is_changed, size_t& changed_count);
+
+// Returns false when the fingerprint doesn't exist or is malformed.
+bool read_block_fingerprint(const std::string& output, BlockFingerprint& fingerprint);
+
+// Fingerprints are replaced atomically, so an interrupted write never leaves blocks that don't match the tiles.
+bool write_block_fingerprint(const std::string& output, const BlockFingerprint& fingerprint);
@@ -0,0 +1,54 @@
+#include "build_record.h"
+#include "atomic_file.h"
+
+#include <cstdio>
+#include <fstream>
+
+// First line of every record, so records of an incompatible format are never mistaken for valid ones.
+static const char BUILD_RECORD_MAGIC[] = "texture.compiler build record 1";
+
+static std::string get_build_record_path(const std::string& output) {
+    return output + ".meta";
+}
+
+bool read_build_record(const std::string& output, BuildRecord& record) {
+    std::ifstream stream(get_build_record_path(output));
+    if (!stream) {
+        return false;
+    }
+
+    std::string magic;
+    if (!std::getline(stream, magic) || magic != BUILD_RECORD_MAGIC) {
+        return false;
+    }
+
+    std::string name;
+    return static_cast<bool>(stream >> name >> record.options) && name == "options" &&
+           static_cast<bool>(stream >> name >> record.input) && name == "input" &&
+           static_cast<bool>(stream >> name >> record.input_size) && name == "input_size" &&
+           static_cast<bool>(stream >> name >> record.input_time) && name == "input_time" &&
+           static_cast<bool>(stream >> name >> record.output_size) && name == "output_size";
+}
+
+bool write_build_record(const std::string& output, const BuildRecord& record) {
+    const std::string path = get_build_record_path(output);
+    const std::string temporary_path = get_temporary_path(path);
+
+    {
+        std::ofstream stream(temporary_path);
+        stream << BUILD_RECORD_MAGIC << "\n"
+               << "options " << record.options << "\n"
+               << "input " << record.input << "\n"
+               << "input_size " << record.input_size << "\n"
+               << "input_time " << record.input_time << "\n"
+               << "output_size " << record.output_size << "\n";
+
+        stream.close();
+        if (!stream) {
+            std::remove(temporary_path.c_str());
+            return false;
+        }
+    }
+
+    return replace_file(temporary_path, path);
+}
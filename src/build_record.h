@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+// Record of the job that produced an output, kept by `--incremental` in a `<output>.meta` file next to the output.
+// The next build compares it with the job to tell that the output is up to date without decoding the input.
+struct BuildRecord final {
+    // Hashes of the job options and of the input content in `Hash::to_string` format.
+    std::string options;
+    std::string input;
+
+    uint64_t input_size = 0;
+    int64_t input_time = 0;
+    uint64_t output_size = 0;
+};
+
+// Returns false when the record doesn't exist or is malformed.
+bool read_build_record(const std::string& output, BuildRecord& record);
+
+// Records are replaced atomically, so an interrupted write never leaves a half written record.
+bool write_build_record(const std::string& output, const BuildRecord& record);
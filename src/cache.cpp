@@ -0,0 +1,308 @@
+#include "cache.h"
+#include "atomic_file.h"
+
+#include <cctype>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <system_error>
+
+namespace fs = std::filesystem;
+
+// Remote blob layout: magic, file count and then every file prefixed with its size, all integers are little endian.
+static const char BLOB_MAGIC[4] = { 'T', 'C', 'C', '1' };
+
+static bool read_file(const fs::path& path, std::vector<char>& data) {
+    std::ifstream stream(path, std::ios::binary);
+    if (!stream) {
+        return false;
+    }
+
+    data.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+    return !stream.bad();
+}
+
+static bool write_file(const fs::path& path, const char* data, size_t size) {
+    std::ofstream stream(path, std::ios::binary);
+    return static_cast<bool>(stream.write(data, static_cast<std::streamsize>(size)));
+}
+
+static void write_integer(std::vector<char>& blob, size_t& position, uint64_t value, size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        blob[position++] = static_cast<char>(value >> (i * 8));
+    }
+}
+
+static bool read_integer(const char* blob, size_t blob_size, size_t& position, size_t size, uint64_t& value) {
+    if (position + size > blob_size) {
+        return false;
+    }
+
+    value = 0;
+    for (size_t i = 0; i < size; i++) {
+        value |= static_cast<uint64_t>(static_cast<unsigned char>(blob[position + i])) << (i * 8);
+    }
+    position += size;
+    return true;
+}
+
+static std::vector<char> pack_blob(const std::vector<std::vector<char>>& files) {
+    size_t size = sizeof(BLOB_MAGIC) + 4;
+    for (const std::vector<char>& file : files) {
+        size += 8 + file.size();
+    }
+
+    std::vector<char> blob(size);
+    std::memcpy(blob.data(), BLOB_MAGIC, sizeof(BLOB_MAGIC));
+
+    size_t position = sizeof(BLOB_MAGIC);
+    write_integer(blob, position, files.size(), 4);
+    for (const std::vector<char>& file : files) {
+        write_integer(blob, position, file.size(), 8);
+        if (!file.empty()) {
+            std::memcpy(blob.data() + position, file.data(), file.size());
+            position += file.size();
+        }
+    }
+    return blob;
+}
+
+// Offset and size of a file in a blob.
+struct BlobFile final {
+    size_t offset;
+    size_t size;
+};
+
+// Finds the files in the blob without copying them. Returns false when it's malformed.
+static bool find_blob_files(const char* blob, size_t blob_size, size_t file_count, std::vector<BlobFile>& files) {
+    if (blob_size < sizeof(BLOB_MAGIC) || std::memcmp(blob, BLOB_MAGIC, sizeof(BLOB_MAGIC)) != 0) {
+        return false;
+    }
+
+    size_t position = sizeof(BLOB_MAGIC);
+
+    uint64_t count;
+    if (!read_integer(blob, blob_size, position, 4, count) || count != file_count) {
+        return false;
+    }
+
+    files.resize(file_count);
+    for (BlobFile& file : files) {
+        uint64_t size;
+        if (!read_integer(blob, blob_size, position, 8, size) || size > blob_size - position) {
+            return false;
+        }
+
+        file = BlobFile { position, static_cast<size_t>(size) };
+        position += static_cast<size_t>(size);
+    }
+
+    return position == blob_size;
+}
+
+static bool unpack_blob(const std::vector<char>& blob, size_t file_count, std::vector<std::vector<char>>& files) {
+    std::vector<BlobFile> found;
+    if (!find_blob_files(blob.data(), blob.size(), file_count, found)) {
+        return false;
+    }
+
+    files.resize(file_count);
+    for (size_t i = 0; i < file_count; i++) {
+        files[i].assign(blob.begin() + static_cast<ptrdiff_t>(found[i].offset), blob.begin() + static_cast<ptrdiff_t>(found[i].offset + found[i].size));
+    }
+    return true;
+}
+
+Cache::Cache(std::string directory, std::unique_ptr<RemoteCache> remote, size_t size_limit) noexcept
+        : directory(std::move(directory))
+        , remote(std::move(remote))
+        , size_limit(size_limit)
+        , packs(std::make_unique<CacheStore>((fs::path(this->directory) / CACHE_PACK_DIRECTORY).string()))
+        , input_hashes(std::make_unique<InputHashes>((fs::path(this->directory) / INPUT_HASHES_FILE).string())) {
+}
+
+// Downloads the files of the entry from the remote cache and keeps it locally.
+static bool fetch_remote_entry(CacheStore& store, RemoteCache* remote, const Hash& key, size_t file_count, std::vector<std::vector<char>>& files, std::ostream& log) {
+    std::vector<char> blob;
+    if (remote == nullptr || !remote->get(key, blob, log)) {
+        return false;
+    }
+
+    if (!unpack_blob(blob, file_count, files)) {
+        log << "Texture compiler warning. Remote cache entry " << key.to_string() << " is malformed." << std::endl;
+        return false;
+    }
+
+    // Keep the downloaded entry locally, so the next lookup doesn't go to the remote. A failure only means the next
+    // lookup downloads it again.
+    store.put(key, blob, log);
+    return true;
+}
+
+// Reads the files of the entry from the local packs, downloading it from the remote cache when they don't have it.
+static bool fetch_entry(CacheStore& store, RemoteCache* remote, const Hash& key, size_t file_count, std::vector<std::vector<char>>& files, std::ostream& log) {
+    std::vector<char> blob;
+    if (store.get(key, blob, log)) {
+        if (unpack_blob(blob, file_count, files)) {
+            return true;
+        }
+        log << "Texture compiler warning. Cache entry " << key.to_string() << " is malformed." << std::endl;
+    }
+
+    return fetch_remote_entry(store, remote, key, file_count, files, log);
+}
+
+// Writes a file of a cache entry with `write` to a temporary file and renames it into place like compiled outputs.
+template <typename Write>
+static bool write_output(const std::string& output, const Write& write, std::ostream& log) {
+    const std::string temporary_path = get_temporary_path(output);
+    if (!write(temporary_path)) {
+        log << "Texture compiler error. Failed to copy a cached texture to \"" << output << "\"." << std::endl;
+        std::error_code error;
+        fs::remove(temporary_path, error);
+        return false;
+    }
+
+    if (!replace_file(temporary_path, output)) {
+        log << "Texture compiler error. Failed to copy a cached texture to \"" << output << "\"." << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool Cache::load(const Hash& key, const std::vector<std::string>& outputs, std::ostream& log) const {
+    const bool is_remote_miss = finish_prefetch(key, log);
+
+    // Local entries are copied straight from their pack, see `copy_record`.
+    CacheRecord record;
+    if (packs->get(key, record, log)) {
+        std::vector<BlobFile> files;
+        if (find_blob_files(reinterpret_cast<const char*>(record.data), record.size, outputs.size(), files)) {
+            for (size_t i = 0; i < outputs.size(); i++) {
+                const auto write = [&](const std::string& path) { return copy_record(record, files[i].offset, files[i].size, path); };
+                if (!write_output(outputs[i], write, log)) {
+                    // Error is printed in `write_output`.
+                    return false;
+                }
+            }
+            return true;
+        }
+        log << "Texture compiler warning. Cache entry " << key.to_string() << " is malformed." << std::endl;
+    }
+
+    std::vector<std::vector<char>> files;
+    if (is_remote_miss || !fetch_remote_entry(*packs, remote.get(), key, outputs.size(), files, log)) {
+        return false;
+    }
+    for (size_t i = 0; i < outputs.size(); i++) {
+        const auto write = [&](const std::string& path) { return write_file(path, files[i].data(), files[i].size()); };
+        if (!write_output(outputs[i], write, log)) {
+            // Error is printed in `write_output`.
+            return false;
+        }
+    }
+    return true;
+}
+
+bool Cache::load(const Hash& key, size_t file_count, std::vector<std::vector<char>>& files, std::ostream& log, bool is_shared) const {
+    const bool is_remote_miss = is_shared && finish_prefetch(key, log);
+    return fetch_entry(*packs, is_shared && !is_remote_miss ? remote.get() : nullptr, key, file_count, files, log);
+}
+
+bool Cache::store(const Hash& key, const std::vector<std::string>& outputs, std::ostream& log) const {
+    std::vector<std::vector<char>> files(outputs.size());
+    for (size_t i = 0; i < outputs.size(); i++) {
+        if (!read_file(outputs[i], files[i])) {
+            log << "Texture compiler warning. Failed to read \"" << outputs[i] << "\" to store it in the cache." << std::endl;
+            return false;
+        }
+    }
+
+    return store(key, files, log);
+}
+
+bool Cache::store(const Hash& key, const std::vector<std::vector<char>>& files, std::ostream& log, bool is_shared) const {
+    const std::vector<char> blob = pack_blob(files);
+    if (!packs->put(key, blob, log)) {
+        // Warning is printed in `CacheStore::put`.
+        return false;
+    }
+
+    if (is_shared && remote && !remote->put(key, blob, log)) {
+        // Warning is printed by the remote cache. Local entry is still fine.
+        return false;
+    }
+
+    return true;
+}
+
+void Cache::prefetch(const Hash& key) const {
+    if (!remote) {
+        return;
+    }
+
+    const std::pair<uint64_t, uint64_t> id(key.low, key.high);
+    {
+        std::lock_guard<std::mutex> lock(prefetch_mutex);
+        if (!prefetches.emplace(id, RemotePrefetch {}).second) {
+            return;
+        }
+    }
+
+    // Downloaded entries are checked by the load that unpacks them.
+    std::ostringstream log;
+    bool is_remote_miss = false;
+    try {
+        CacheRecord record;
+        std::vector<char> blob;
+        if (!packs->get(key, record, log)) {
+            if (remote->get(key, blob, log)) {
+                packs->put(key, blob, log);
+            } else {
+                // A remote that failed printed a warning, the load tries it again.
+                is_remote_miss = log.tellp() == 0;
+            }
+        }
+    } catch (const std::exception& exception) {
+        log << "Texture compiler warning. Failed to prefetch a cache entry: " << exception.what() << "." << std::endl;
+    }
+
+    std::lock_guard<std::mutex> lock(prefetch_mutex);
+    RemotePrefetch& prefetch = prefetches[id];
+    prefetch.is_done = true;
+    prefetch.is_remote_miss = is_remote_miss;
+    prefetch.log = log.str();
+    prefetch_condition.notify_all();
+}
+
+bool Cache::finish_prefetch(const Hash& key, std::ostream& log) const {
+    std::unique_lock<std::mutex> lock(prefetch_mutex);
+    const auto it = prefetches.find(std::make_pair(key.low, key.high));
+    if (it == prefetches.end()) {
+        return false;
+    }
+    prefetch_condition.wait(lock, [&] {
+        return it->second.is_done;
+    });
+
+    const bool is_remote_miss = it->second.is_remote_miss;
+    log << it->second.log;
+    prefetches.erase(it);
+    return is_remote_miss;
+}
+
+void Cache::trim(std::ostream& log) const {
+    // Entries of earlier versions of the compiler were directories named after the first two characters of their key,
+    // next to the `tmp` directory they were written to.
+    std::error_code error;
+    for (const fs::directory_entry& entry : fs::directory_iterator(directory, error)) {
+        const std::string name = entry.path().filename().string();
+        if (entry.is_directory(error) && (name == "tmp" || (name.size() == 2 && std::isxdigit(static_cast<unsigned char>(name[0])) && std::isxdigit(static_cast<unsigned char>(name[1]))))) {
+            fs::remove_all(entry.path(), error);
+        }
+    }
+
+    packs->trim(size_limit, log);
+}
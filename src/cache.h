@@ -0,0 +1,92 @@
+#pragma once
+
+#include "cache_store.h"
+#include "hash.h"
+#include "input_hashes.h"
+#include "remote_cache.h"
+
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+// On-disk content addressed cache of compiled textures. An entry is a record of the `CacheStore` in the `packs`
+// subdirectory keyed by the job key, which holds every output of the job, so multi-output jobs are stored and restored
+// as one unit. Cube map jobs store an entry per output instead.
+//
+// When a remote cache is attached, the local directory works as a least recently used cache in front of it. Local
+// misses are looked up remotely and downloaded entries are kept locally, new entries are uploaded.
+
+// Subdirectory of the cache directory with the shader cache of the GPU backend, which is neither an entry nor trimmed.
+static constexpr const char* SHADER_CACHE_DIRECTORY = "shaders";
+
+// Subdirectory of the cache directory with the entries.
+static constexpr const char* CACHE_PACK_DIRECTORY = "packs";
+
+// File of the cache directory with the `InputHashes`, which is local to the machine and never uploaded.
+static constexpr const char* INPUT_HASHES_FILE = "input_hashes.txt";
+
+struct Cache final {
+    // Zero `size_limit` means the local directory is never trimmed.
+    Cache(std::string directory, std::unique_ptr<RemoteCache> remote, size_t size_limit) noexcept;
+
+    Cache(const Cache&) = delete;
+    Cache(Cache&&) = delete;
+    Cache& operator=(const Cache&) = delete;
+    Cache& operator=(Cache&&) = delete;
+
+    // Copies the cached files to `outputs`. Returns false when there's no complete entry for this key.
+    bool load(const Hash& key, const std::vector<std::string>& outputs, std::ostream& log) const;
+
+    // Same as above, but reads the `file_count` cached files into memory instead of copying them anywhere. Entries that
+    // aren't `is_shared` are only looked up locally, see `store`.
+    bool load(const Hash& key, size_t file_count, std::vector<std::vector<char>>& files, std::ostream& log, bool is_shared = true) const;
+
+    // Stores the files at `outputs` under the key. Entries are added to the index once they're written, so concurrent
+    // compiler processes sharing the same cache directory never see a partially written entry.
+    bool store(const Hash& key, const std::vector<std::string>& outputs, std::ostream& log) const;
+
+    // Same as above, but for outputs whose content is still in memory, so they're not read back from the disk. Entries
+    // that aren't `is_shared` are kept in the local directory only and never uploaded, for entries that are much larger
+    // than outputs and quicker to compute again than to download.
+    bool store(const Hash& key, const std::vector<std::vector<char>>& files, std::ostream& log, bool is_shared = true) const;
+
+    // Looks the entry up in the remote cache ahead of its job and downloads it into the local packs, so the job finds it
+    // locally. A later `load` of the key waits for the download rather than starting another one, and skips the remote
+    // when the prefetch found it doesn't have the entry. Warnings are printed by that `load`. Blocks on the network,
+    // meant for the I/O threads. Does nothing without a remote, or when the local packs have the entry.
+    void prefetch(const Hash& key) const;
+
+    // Removes least recently used local entries until the entries fit into the size limit, compacts the packs and
+    // removes the entry directories of earlier versions of the compiler.
+    void trim(std::ostream& log) const;
+
+    std::string directory;
+    std::unique_ptr<RemoteCache> remote;
+    size_t size_limit;
+    std::unique_ptr<CacheStore> packs;
+
+    // Content hashes of the inputs, which the job keys are made of. Loaded and saved by the caller.
+    std::unique_ptr<InputHashes> input_hashes;
+
+private:
+    struct RemotePrefetch final {
+        bool is_done = false;
+
+        // Set when the remote answered that it doesn't have the entry, not when it failed.
+        bool is_remote_miss = false;
+        std::string log;
+    };
+
+    // Waits for the prefetch of the key, if there's one, and prints its warnings. Returns true when the remote doesn't
+    // have the entry.
+    bool finish_prefetch(const Hash& key, std::ostream& log) const;
+
+    mutable std::mutex prefetch_mutex;
+    mutable std::condition_variable prefetch_condition;
+    mutable std::map<std::pair<uint64_t, uint64_t>, RemotePrefetch> prefetches;
+};
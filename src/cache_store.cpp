@@ -0,0 +1,784 @@
+#include "cache_store.h"
+#include "mapped_file.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <system_error>
+
+#if BX_PLATFORM_WINDOWS
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace fs = std::filesystem;
+
+static const char INDEX_MAGIC[8] = { 'T', 'C', 'I', 'N', 'D', 'E', 'X', '1' };
+static const char RECORD_MAGIC[4] = { 'T', 'C', 'R', '1' };
+
+// Magic and key in front of every record of a pack.
+static constexpr size_t RECORD_HEADER_SIZE = sizeof(RECORD_MAGIC) + 16;
+
+static constexpr uint64_t INITIAL_SLOT_COUNT = 4096;
+
+// Counters shared by the processes, little endian like the rest of the compiler's files.
+struct CacheIndexHeader final {
+    char magic[8];
+    uint64_t slot_count;
+    uint64_t entry_count;
+    uint64_t live_bytes;
+    uint64_t next_pack;
+
+    // Generation of the index that replaced this one, zero while it's current.
+    uint64_t successor;
+
+    // Incremented on every use of a record, so least recently used records have the smallest `last_use`. A counter
+    // rather than a time, so machines with different clocks can share a cache on a network share.
+    uint64_t clock;
+    uint64_t reserved;
+};
+
+// Empty slots have a zero `size`, records are never empty.
+struct CacheIndexSlot final {
+    uint64_t key_low;
+    uint64_t key_high;
+    uint64_t offset;
+    uint64_t size;
+    uint64_t last_use;
+    uint32_t pack;
+    uint32_t reserved;
+};
+
+static_assert(sizeof(CacheIndexHeader) == 64, "Index header is 64 bytes.");
+static_assert(sizeof(CacheIndexSlot) == 48, "Index slot is 48 bytes.");
+
+#if BX_PLATFORM_WINDOWS
+static const HANDLE INVALID_FILE = INVALID_HANDLE_VALUE;
+
+static HANDLE open_file(const fs::path& path) noexcept {
+    return CreateFileW(path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL,
+                       nullptr);
+}
+
+static void close_file(HANDLE file) noexcept {
+    CloseHandle(file);
+}
+
+static bool lock_whole_file(HANDLE file, bool is_blocking) noexcept {
+    OVERLAPPED overlapped {};
+    return LockFileEx(file, LOCKFILE_EXCLUSIVE_LOCK | (is_blocking ? 0 : LOCKFILE_FAIL_IMMEDIATELY), 0, MAXDWORD, MAXDWORD, &overlapped) != 0;
+}
+
+static void unlock_whole_file(HANDLE file) noexcept {
+    OVERLAPPED overlapped {};
+    UnlockFileEx(file, 0, MAXDWORD, MAXDWORD, &overlapped);
+}
+
+static bool read_at(HANDLE file, void* data, size_t size, uint64_t offset) noexcept {
+    while (size > 0) {
+        OVERLAPPED overlapped {};
+        overlapped.Offset = static_cast<DWORD>(offset);
+        overlapped.OffsetHigh = static_cast<DWORD>(offset >> 32);
+        DWORD read = 0;
+        if (!ReadFile(file, data, static_cast<DWORD>(std::min<size_t>(size, 1 << 30)), &read, &overlapped) || read == 0) {
+            return false;
+        }
+        data = static_cast<char*>(data) + read;
+        size -= read;
+        offset += read;
+    }
+    return true;
+}
+
+static bool write_at(HANDLE file, const void* data, size_t size, uint64_t offset) noexcept {
+    while (size > 0) {
+        OVERLAPPED overlapped {};
+        overlapped.Offset = static_cast<DWORD>(offset);
+        overlapped.OffsetHigh = static_cast<DWORD>(offset >> 32);
+        DWORD written = 0;
+        if (!WriteFile(file, data, static_cast<DWORD>(std::min<size_t>(size, 1 << 30)), &written, &overlapped) || written == 0) {
+            return false;
+        }
+        data = static_cast<const char*>(data) + written;
+        size -= written;
+        offset += written;
+    }
+    return true;
+}
+
+static bool get_file_size(HANDLE file, uint64_t& size) noexcept {
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(file, &file_size)) {
+        return false;
+    }
+    size = static_cast<uint64_t>(file_size.QuadPart);
+    return true;
+}
+
+static bool set_file_size(HANDLE file, uint64_t size) noexcept {
+    LARGE_INTEGER position;
+    position.QuadPart = static_cast<LONGLONG>(size);
+    return SetFilePointerEx(file, position, nullptr, FILE_BEGIN) && SetEndOfFile(file);
+}
+
+static void* map_file(HANDLE file, size_t size, void*& mapping) noexcept {
+    mapping = CreateFileMappingW(file, nullptr, PAGE_READWRITE, 0, 0, nullptr);
+    if (mapping == nullptr) {
+        return nullptr;
+    }
+    void* const data = MapViewOfFile(mapping, FILE_MAP_WRITE, 0, 0, size);
+    if (data == nullptr) {
+        CloseHandle(mapping);
+        mapping = nullptr;
+    }
+    return data;
+}
+
+static void unmap_file(void* data, size_t /*size*/, void*& mapping) noexcept {
+    UnmapViewOfFile(data);
+    CloseHandle(mapping);
+    mapping = nullptr;
+}
+#else
+static constexpr int INVALID_FILE = -1;
+
+static int open_file(const fs::path& path) noexcept {
+    return open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+}
+
+static void close_file(int file) noexcept {
+    close(file);
+}
+
+static bool lock_whole_file(int file, bool is_blocking) noexcept {
+    while (flock(file, LOCK_EX | (is_blocking ? 0 : LOCK_NB)) != 0) {
+        if (errno != EINTR) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void unlock_whole_file(int file) noexcept {
+    flock(file, LOCK_UN);
+}
+
+static bool read_at(int file, void* data, size_t size, uint64_t offset) noexcept {
+    while (size > 0) {
+        const ssize_t read = pread(file, data, size, static_cast<off_t>(offset));
+        if (read <= 0) {
+            if (read < 0 && errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        data = static_cast<char*>(data) + read;
+        size -= static_cast<size_t>(read);
+        offset += static_cast<uint64_t>(read);
+    }
+    return true;
+}
+
+static bool write_at(int file, const void* data, size_t size, uint64_t offset) noexcept {
+    while (size > 0) {
+        const ssize_t written = pwrite(file, data, size, static_cast<off_t>(offset));
+        if (written <= 0) {
+            if (written < 0 && errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        data = static_cast<const char*>(data) + written;
+        size -= static_cast<size_t>(written);
+        offset += static_cast<uint64_t>(written);
+    }
+    return true;
+}
+
+static bool get_file_size(int file, uint64_t& size) noexcept {
+    struct stat status {};
+    if (fstat(file, &status) != 0) {
+        return false;
+    }
+    size = static_cast<uint64_t>(status.st_size);
+    return true;
+}
+
+static bool set_file_size(int file, uint64_t size) noexcept {
+    return ftruncate(file, static_cast<off_t>(size)) == 0;
+}
+
+static void* map_file(int file, size_t size, void*& /*mapping*/) noexcept {
+    void* const data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, file, 0);
+    return data != MAP_FAILED ? data : nullptr;
+}
+
+static void unmap_file(void* data, size_t size, void*& /*mapping*/) noexcept {
+    munmap(data, size);
+}
+#endif
+
+bool copy_record(const CacheRecord& record, size_t offset, size_t size, const std::string& path) noexcept {
+#if BX_PLATFORM_WINDOWS
+    const HANDLE file = CreateFileA(path.c_str(), GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    const bool is_written = write_at(file, record.data + offset, size, 0);
+    CloseHandle(file);
+    return is_written;
+#else
+    const int file = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0666);
+    if (file < 0) {
+        return false;
+    }
+
+    size_t copied = 0;
+#if BX_PLATFORM_LINUX
+    const int pack = open(record.pack_path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (pack >= 0) {
+        loff_t input_offset = static_cast<loff_t>(record.offset + offset);
+        while (copied < size) {
+            const ssize_t result = copy_file_range(pack, &input_offset, file, nullptr, size - copied, 0);
+            if (result <= 0) {
+                if (result < 0 && errno == EINTR) {
+                    continue;
+                }
+                // Kernels before 5.3 don't copy across file systems and some file systems don't copy at all, the
+                // rest is written from the mapping.
+                break;
+            }
+            copied += static_cast<size_t>(result);
+        }
+        close(pack);
+    }
+#endif
+
+    const bool is_written = write_at(file, record.data + offset + copied, size - copied, copied);
+    return close(file) == 0 && is_written;
+#endif
+}
+
+static uint64_t get_index_size(uint64_t slot_count) noexcept {
+    return sizeof(CacheIndexHeader) + slot_count * sizeof(CacheIndexSlot);
+}
+
+static fs::path get_index_path(const std::string& directory, uint64_t generation) {
+    return fs::path(directory) / ("index." + std::to_string(generation));
+}
+
+static fs::path get_pack_path(const std::string& directory, uint32_t pack) {
+    return fs::path(directory) / (std::to_string(pack) + ".pack");
+}
+
+CacheStore::IndexLock::IndexLock(CacheStore& store, std::ostream& log)
+        : store(store)
+        , lock(store.mutex) {
+    if (store.lock_file == INVALID_FILE) {
+        std::error_code error;
+        fs::create_directories(store.directory, error);
+        store.lock_file = open_file(fs::path(store.directory) / "lock");
+        if (store.lock_file == INVALID_FILE) {
+            log << "Texture compiler warning. Failed to open the lock file of cache \"" << store.directory << "\"." << std::endl;
+            return;
+        }
+    }
+
+    if (!lock_whole_file(store.lock_file, true)) {
+        log << "Texture compiler warning. Failed to lock cache \"" << store.directory << "\"." << std::endl;
+        return;
+    }
+    is_file_locked = true;
+
+    is_locked = (store.header != nullptr && store.header->successor == 0) || store.map_index(log);
+}
+
+CacheStore::IndexLock::~IndexLock() {
+    if (is_file_locked) {
+        unlock_whole_file(store.lock_file);
+    }
+}
+
+CacheStore::CacheStore(std::string directory) noexcept
+        : directory(std::move(directory))
+        , lock_file(INVALID_FILE)
+        , index_file(INVALID_FILE)
+        , pack_file(INVALID_FILE) {
+}
+
+CacheStore::~CacheStore() {
+    close_pack();
+    unmap_index();
+    if (lock_file != INVALID_FILE) {
+        close_file(lock_file);
+    }
+}
+
+bool CacheStore::map_index(std::ostream& log) {
+    unmap_index();
+
+    // An empty lock file is the first generation of an empty cache.
+    uint64_t size = 0;
+    uint64_t new_generation = 0;
+    if (get_file_size(lock_file, size) && size >= sizeof(new_generation) && !read_at(lock_file, &new_generation, sizeof(new_generation), 0)) {
+        log << "Texture compiler warning. Failed to read the lock file of cache \"" << directory << "\"." << std::endl;
+        return false;
+    }
+
+    index_file = open_file(get_index_path(directory, new_generation));
+    if (index_file == INVALID_FILE || !get_file_size(index_file, size)) {
+        log << "Texture compiler warning. Failed to open the index of cache \"" << directory << "\"." << std::endl;
+        unmap_index();
+        return false;
+    }
+
+    // A new index, or one cut short by a crash while it was created, starts empty.
+    CacheIndexHeader file_header {};
+    const bool is_valid = size >= sizeof(CacheIndexHeader) && read_at(index_file, &file_header, sizeof(file_header), 0) &&
+                          std::memcmp(file_header.magic, INDEX_MAGIC, sizeof(INDEX_MAGIC)) == 0 && file_header.slot_count != 0 &&
+                          (file_header.slot_count & (file_header.slot_count - 1)) == 0 && size == get_index_size(file_header.slot_count);
+    if (!is_valid) {
+        if (size != 0) {
+            log << "Texture compiler warning. Index of cache \"" << directory << "\" is malformed, cached entries are compiled again." << std::endl;
+        }
+        std::memcpy(file_header.magic, INDEX_MAGIC, sizeof(INDEX_MAGIC));
+        file_header.slot_count = INITIAL_SLOT_COUNT;
+        size = get_index_size(INITIAL_SLOT_COUNT);
+
+        // Packs of a lost index are garbage, new ones must not reuse their names.
+        file_header.next_pack = 1;
+        std::error_code error;
+        for (const fs::directory_entry& entry : fs::directory_iterator(directory, error)) {
+            if (entry.path().extension() == ".pack") {
+                file_header.next_pack = std::max<uint64_t>(file_header.next_pack, std::strtoull(entry.path().stem().string().c_str(), nullptr, 10) + 1);
+            }
+        }
+
+        if (!set_file_size(index_file, 0) || !set_file_size(index_file, size) || !write_at(index_file, &file_header, sizeof(file_header), 0)) {
+            log << "Texture compiler warning. Failed to create the index of cache \"" << directory << "\"." << std::endl;
+            unmap_index();
+            return false;
+        }
+    }
+
+    void* const data = map_file(index_file, static_cast<size_t>(size), index_mapping);
+    if (data == nullptr) {
+        log << "Texture compiler warning. Failed to map the index of cache \"" << directory << "\"." << std::endl;
+        unmap_index();
+        return false;
+    }
+
+    generation = new_generation;
+    header = static_cast<CacheIndexHeader*>(data);
+    slots = reinterpret_cast<CacheIndexSlot*>(header + 1);
+    mapped_size = static_cast<size_t>(size);
+    return true;
+}
+
+void CacheStore::unmap_index() noexcept {
+    if (header != nullptr) {
+        unmap_file(header, mapped_size, index_mapping);
+        header = nullptr;
+        slots = nullptr;
+        mapped_size = 0;
+    }
+    if (index_file != INVALID_FILE) {
+        close_file(index_file);
+        index_file = INVALID_FILE;
+    }
+}
+
+CacheIndexSlot* CacheStore::find_slot(const Hash& key) const noexcept {
+    const uint64_t mask = header->slot_count - 1;
+    for (uint64_t index = key.low & mask;; index = (index + 1) & mask) {
+        CacheIndexSlot& slot = slots[index];
+        if (slot.size == 0) {
+            return nullptr;
+        }
+        if (slot.key_low == key.low && slot.key_high == key.high) {
+            return &slot;
+        }
+    }
+}
+
+bool CacheStore::insert_slot(const CacheIndexSlot& slot, std::ostream& log) {
+    // Kept at most half full, rehashed into an index twice the size of the next generation otherwise.
+    if ((header->entry_count + 1) * 2 > header->slot_count) {
+        const uint64_t new_generation = generation + 1;
+        const uint64_t slot_count = header->slot_count * 2;
+        const fs::path path = get_index_path(directory, new_generation);
+
+        FileHandle file = open_file(path);
+        void* mapping = nullptr;
+        void* data = nullptr;
+        if (file == INVALID_FILE || !set_file_size(file, 0) || !set_file_size(file, get_index_size(slot_count)) ||
+            (data = map_file(file, static_cast<size_t>(get_index_size(slot_count)), mapping)) == nullptr) {
+            log << "Texture compiler warning. Failed to grow the index of cache \"" << directory << "\"." << std::endl;
+            if (file != INVALID_FILE) {
+                close_file(file);
+            }
+            std::error_code error;
+            fs::remove(path, error);
+            return false;
+        }
+
+        CacheIndexHeader* const new_header = static_cast<CacheIndexHeader*>(data);
+        CacheIndexSlot* const new_slots = reinterpret_cast<CacheIndexSlot*>(new_header + 1);
+        *new_header = *header;
+        new_header->slot_count = slot_count;
+        new_header->successor = 0;
+        for (uint64_t i = 0; i < header->slot_count; i++) {
+            if (slots[i].size != 0) {
+                for (uint64_t index = slots[i].key_low & (slot_count - 1);; index = (index + 1) & (slot_count - 1)) {
+                    if (new_slots[index].size == 0) {
+                        new_slots[index] = slots[i];
+                        break;
+                    }
+                }
+            }
+        }
+
+        // Processes find the new generation in the lock file when they start and in the old index when they have it
+        // mapped. The old index can't be removed on Windows while other processes map it, it's left for `trim` then.
+        if (!write_at(lock_file, &new_generation, sizeof(new_generation), 0)) {
+            log << "Texture compiler warning. Failed to grow the index of cache \"" << directory << "\"." << std::endl;
+            unmap_file(data, static_cast<size_t>(get_index_size(slot_count)), mapping);
+            close_file(file);
+            std::error_code error;
+            fs::remove(path, error);
+            return false;
+        }
+        header->successor = new_generation;
+
+        const fs::path old_path = get_index_path(directory, generation);
+        unmap_index();
+        std::error_code error;
+        fs::remove(old_path, error);
+
+        index_file = file;
+        index_mapping = mapping;
+        generation = new_generation;
+        header = new_header;
+        slots = new_slots;
+        mapped_size = static_cast<size_t>(get_index_size(slot_count));
+    }
+
+    const uint64_t mask = header->slot_count - 1;
+    for (uint64_t index = slot.key_low & mask;; index = (index + 1) & mask) {
+        if (slots[index].size == 0) {
+            slots[index] = slot;
+            break;
+        }
+    }
+    header->entry_count++;
+    header->live_bytes += slot.size;
+    return true;
+}
+
+void CacheStore::remove_slot(CacheIndexSlot* slot) noexcept {
+    header->entry_count--;
+    header->live_bytes -= slot->size;
+
+    // Backward shift deletion, so probes for the slots after it still find them without tombstones.
+    const uint64_t mask = header->slot_count - 1;
+    uint64_t hole = static_cast<uint64_t>(slot - slots);
+    for (uint64_t index = (hole + 1) & mask; slots[index].size != 0; index = (index + 1) & mask) {
+        const uint64_t home = slots[index].key_low & mask;
+        const bool is_movable = hole <= index ? home <= hole || home > index : home <= hole && home > index;
+        if (is_movable) {
+            slots[hole] = slots[index];
+            hole = index;
+        }
+    }
+    slots[hole] = CacheIndexSlot {};
+}
+
+bool CacheStore::open_pack(std::ostream& log) {
+    close_pack();
+
+    // Names are never reused, a pack locked by another process belongs to a writer of a lost index.
+    for (int attempt = 0; attempt < 16; attempt++) {
+        const uint32_t id = static_cast<uint32_t>(header->next_pack++);
+        FileHandle file = open_file(get_pack_path(directory, id));
+        if (file == INVALID_FILE) {
+            break;
+        }
+        if (!lock_whole_file(file, false) || !get_file_size(file, pack_size)) {
+            close_file(file);
+            continue;
+        }
+        pack_file = file;
+        pack_id = id;
+        return true;
+    }
+
+    log << "Texture compiler warning. Failed to create a pack of cache \"" << directory << "\"." << std::endl;
+    return false;
+}
+
+void CacheStore::close_pack() noexcept {
+    if (pack_file != INVALID_FILE) {
+        unlock_whole_file(pack_file);
+        close_file(pack_file);
+        pack_file = INVALID_FILE;
+        pack_id = 0;
+        pack_size = 0;
+    }
+}
+
+bool CacheStore::append_record(const char* data, size_t size, uint64_t& offset, std::ostream& log) {
+    offset = pack_size;
+    if (!write_at(pack_file, data, size, offset)) {
+        log << "Texture compiler warning. Failed to write a pack of cache \"" << directory << "\"." << std::endl;
+        close_pack();
+        return false;
+    }
+    pack_size += size;
+    return true;
+}
+
+std::shared_ptr<MappedFile> CacheStore::get_pack_mapping(uint32_t pack, uint64_t end) {
+    std::lock_guard<std::mutex> lock(mapping_mutex);
+
+    std::shared_ptr<MappedFile>& mapping = pack_mappings[pack];
+    if (!mapping || mapping->size < end) {
+        // Address space is plentiful but not endless, long running servers drop the mappings of old packs.
+        if (pack_mappings.size() > 256) {
+            for (auto it = pack_mappings.begin(); it != pack_mappings.end();) {
+                it = it->first != pack ? pack_mappings.erase(it) : std::next(it);
+            }
+        }
+        mapping = std::make_shared<MappedFile>(get_pack_path(directory, pack).string(), false);
+        if (mapping->data == nullptr || mapping->size < end) {
+            pack_mappings.erase(pack);
+            return nullptr;
+        }
+    }
+    return mapping;
+}
+
+bool CacheStore::get(const Hash& key, std::vector<char>& data, std::ostream& log) {
+    CacheRecord record;
+    if (!get(key, record, log)) {
+        return false;
+    }
+    data.assign(record.data, record.data + record.size);
+    return true;
+}
+
+bool CacheStore::get(const Hash& key, CacheRecord& record, std::ostream& log) {
+    CacheIndexSlot slot;
+    {
+        IndexLock lock(*this, log);
+        if (!lock.is_locked) {
+            // Warning is printed in `IndexLock`.
+            return false;
+        }
+
+        CacheIndexSlot* const found = find_slot(key);
+        if (found == nullptr) {
+            return false;
+        }
+        found->last_use = ++header->clock;
+        slot = *found;
+    }
+
+    // Records never change once they're written, only the packs compacted since the lookup are gone.
+    std::shared_ptr<MappedFile> mapping = get_pack_mapping(slot.pack, slot.offset + slot.size);
+    if (!mapping) {
+        return false;
+    }
+
+    const uint8_t* const data = mapping->data + slot.offset;
+    if (slot.size < RECORD_HEADER_SIZE || std::memcmp(data, RECORD_MAGIC, sizeof(RECORD_MAGIC)) != 0 ||
+        std::memcmp(data + sizeof(RECORD_MAGIC), &key.low, 8) != 0 || std::memcmp(data + sizeof(RECORD_MAGIC) + 8, &key.high, 8) != 0) {
+        log << "Texture compiler warning. Cache entry " << key.to_string() << " is malformed." << std::endl;
+        return false;
+    }
+
+    record.mapping = std::move(mapping);
+    record.data = data + RECORD_HEADER_SIZE;
+    record.size = static_cast<size_t>(slot.size) - RECORD_HEADER_SIZE;
+    record.pack_path = get_pack_path(directory, slot.pack).string();
+    record.offset = slot.offset + RECORD_HEADER_SIZE;
+    return true;
+}
+
+bool CacheStore::contains(const Hash& key, std::ostream& log) {
+    IndexLock lock(*this, log);
+    // Warning is printed in `IndexLock` when the index can't be mapped.
+    return lock.is_locked && find_slot(key) != nullptr;
+}
+
+bool CacheStore::put(const Hash& key, const std::vector<char>& data, std::ostream& log) {
+    std::lock_guard<std::mutex> pack_lock(pack_mutex);
+
+    {
+        IndexLock lock(*this, log);
+        if (!lock.is_locked) {
+            // Warning is printed in `IndexLock`.
+            return false;
+        }
+
+        // Another job or process stored the same content already.
+        if (CacheIndexSlot* const found = find_slot(key)) {
+            found->last_use = ++header->clock;
+            return true;
+        }
+
+        if ((pack_file == INVALID_FILE || pack_size >= CACHE_PACK_SIZE) && !open_pack(log)) {
+            // Warning is printed in `open_pack`.
+            return false;
+        }
+    }
+
+    std::vector<char> record(RECORD_HEADER_SIZE + data.size());
+    std::memcpy(record.data(), RECORD_MAGIC, sizeof(RECORD_MAGIC));
+    std::memcpy(record.data() + sizeof(RECORD_MAGIC), &key.low, 8);
+    std::memcpy(record.data() + sizeof(RECORD_MAGIC) + 8, &key.high, 8);
+    if (!data.empty()) {
+        std::memcpy(record.data() + RECORD_HEADER_SIZE, data.data(), data.size());
+    }
+
+    // Appended without the index locked, other processes write packs of their own.
+    uint64_t offset;
+    if (!append_record(record.data(), record.size(), offset, log)) {
+        // Warning is printed in `append_record`.
+        return false;
+    }
+
+    IndexLock lock(*this, log);
+    if (!lock.is_locked) {
+        // Warning is printed in `IndexLock`.
+        return false;
+    }
+    if (find_slot(key) != nullptr) {
+        return true;
+    }
+
+    CacheIndexSlot slot {};
+    slot.key_low = key.low;
+    slot.key_high = key.high;
+    slot.offset = offset;
+    slot.size = record.size();
+    slot.last_use = ++header->clock;
+    slot.pack = pack_id;
+    return insert_slot(slot, log);
+}
+
+void CacheStore::trim(uint64_t size_limit, std::ostream& log) {
+    std::lock_guard<std::mutex> pack_lock(pack_mutex);
+    IndexLock lock(*this, log);
+    if (!lock.is_locked) {
+        // Warning is printed in `IndexLock`.
+        return;
+    }
+
+    if (size_limit != 0 && header->live_bytes > size_limit) {
+        std::vector<std::pair<uint64_t, Hash>> uses;
+        uses.reserve(static_cast<size_t>(header->entry_count));
+        for (uint64_t i = 0; i < header->slot_count; i++) {
+            if (slots[i].size != 0) {
+                Hash key;
+                key.low = slots[i].key_low;
+                key.high = slots[i].key_high;
+                uses.emplace_back(slots[i].last_use, key);
+            }
+        }
+        std::sort(uses.begin(), uses.end(), [](const auto& lhs, const auto& rhs) {
+            return lhs.first < rhs.first;
+        });
+
+        size_t removed_entries = 0;
+        for (const auto& [last_use, key] : uses) {
+            if (header->live_bytes <= size_limit) {
+                break;
+            }
+            if (CacheIndexSlot* const slot = find_slot(key)) {
+                remove_slot(slot);
+                removed_entries++;
+            }
+        }
+        log << "Removed " << removed_entries << " least recently used cache entries." << std::endl;
+    }
+
+    // Packs that are at least half garbage are compacted, the rest wait until they are. Packs still being written by a
+    // process are locked by it.
+    std::map<uint32_t, uint64_t> live_bytes;
+    for (uint64_t i = 0; i < header->slot_count; i++) {
+        if (slots[i].size != 0) {
+            live_bytes[slots[i].pack] += slots[i].size;
+        }
+    }
+
+    size_t compacted_packs = 0;
+    uint64_t freed_bytes = 0;
+    std::error_code error;
+    for (const fs::directory_entry& entry : fs::directory_iterator(directory, error)) {
+        const fs::path path = entry.path();
+        if (path.filename().string().rfind("index.", 0) == 0) {
+            // Indexes of earlier generations that couldn't be removed while other processes mapped them.
+            if (path.filename() != get_index_path(directory, generation).filename()) {
+                fs::remove(path, error);
+            }
+            continue;
+        }
+        if (path.extension() != ".pack") {
+            continue;
+        }
+
+        const uint32_t pack = static_cast<uint32_t>(std::strtoul(path.stem().string().c_str(), nullptr, 10));
+        if (pack == pack_id) {
+            continue;
+        }
+
+        FileHandle file = open_file(path);
+        uint64_t size = 0;
+        if (file == INVALID_FILE || !lock_whole_file(file, false) || !get_file_size(file, size) || live_bytes[pack] * 2 > size) {
+            if (file != INVALID_FILE) {
+                close_file(file);
+            }
+            continue;
+        }
+
+        bool is_moved = true;
+        std::vector<char> record;
+        for (uint64_t i = 0; i < header->slot_count && is_moved; i++) {
+            CacheIndexSlot& slot = slots[i];
+            if (slot.size == 0 || slot.pack != pack) {
+                continue;
+            }
+
+            uint64_t offset = 0;
+            record.resize(static_cast<size_t>(slot.size));
+            is_moved = read_at(file, record.data(), record.size(), slot.offset) && ((pack_file != INVALID_FILE && pack_size < CACHE_PACK_SIZE) || open_pack(log)) &&
+                       append_record(record.data(), record.size(), offset, log);
+            if (is_moved) {
+                slot.pack = pack_id;
+                slot.offset = offset;
+            }
+        }
+
+        unlock_whole_file(file);
+        close_file(file);
+        if (is_moved) {
+            fs::remove(path, error);
+            compacted_packs++;
+            freed_bytes += size - live_bytes[pack];
+        }
+    }
+
+    if (compacted_packs != 0) {
+        std::lock_guard<std::mutex> mapping_lock(mapping_mutex);
+        pack_mappings.clear();
+
+        log << "Compacted " << compacted_packs << " cache packs, freeing " << (freed_bytes + 1024 * 1024 - 1) / (1024 * 1024) << " MB." << std::endl;
+    }
+}
@@ -0,0 +1,150 @@
+#pragma once
+
+#include "hash.h"
+
+#include <bx/platform.h>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+struct CacheIndexHeader;
+struct CacheIndexSlot;
+struct MappedFile;
+
+// Record read in place from the mapping of its pack, which stays mapped while the record is kept, even when the pack
+// is compacted away in the meantime.
+struct CacheRecord final {
+    std::shared_ptr<MappedFile> mapping;
+    const uint8_t* data = nullptr;
+    size_t size = 0;
+
+    // Where `data` is in the pack, for copies that don't go through the memory of the process.
+    std::string pack_path;
+    uint64_t offset = 0;
+};
+
+// Writes `size` bytes of the record from `offset` to a new file at `path`. On Linux the kernel copies them from the
+// pack with `copy_file_range`, which shares the blocks instead on file systems that can, like Btrfs and XFS, when the
+// range is block aligned, and otherwise copies them without bringing them into the process. Elsewhere, and when the
+// pack is gone or on another file system, they're written from the mapping.
+bool copy_record(const CacheRecord& record, size_t offset, size_t size, const std::string& path) noexcept;
+
+// Local storage of `Cache`, a record of bytes per key in a few large append-only pack files instead of a directory per
+// entry, so caches with millions of entries don't run into the limits of the file system, and a lookup costs no stat
+// or open. Everything lives in the `packs` subdirectory of the cache:
+//
+// - `lock` is locked by every process for the few operations on the index and holds the generation of the index.
+// - `index.<generation>` is an open addressing hash table from keys to records, memory mapped by every process. It has
+//   a header with the number of slots, the live bytes and the counters shared by the processes, followed by the slots.
+//   It's kept at most half full, so a lookup probes a slot or two however large the cache grows. A full index is
+//   rehashed into the next generation, and processes still mapping the old one find its successor in its header.
+// - `<id>.pack` are the pack files. Every process appends its records to a pack of its own, which it keeps locked
+//   while it's open and replaces with a new one once it outgrows `CACHE_PACK_SIZE`, so processes never write to the
+//   same pack. Records start with a magic and their key, which is checked on every load.
+//
+// Records stored again under a key the index has, and records evicted from the index, become garbage in their packs.
+// `trim` evicts the least recently used records from the index until the live bytes fit into the limit and compacts
+// the packs that are mostly garbage, moving their live records into the pack of the process. Lookups racing compaction
+// in another process can miss, which only compiles their job again. The store is synchronized, threads of the process
+// share it.
+struct CacheStore final {
+    explicit CacheStore(std::string directory) noexcept;
+    ~CacheStore();
+
+    CacheStore(const CacheStore&) = delete;
+    CacheStore(CacheStore&&) = delete;
+    CacheStore& operator=(const CacheStore&) = delete;
+    CacheStore& operator=(CacheStore&&) = delete;
+
+    // Reads the record of `key` and marks it as recently used. Returns false when there's no record, warnings are
+    // printed only for records that can't be read.
+    bool get(const Hash& key, std::vector<char>& data, std::ostream& log);
+
+    // Same as above, but without copying the record out of the mapping of its pack.
+    bool get(const Hash& key, CacheRecord& record, std::ostream& log);
+
+    // Looks the key up in the index without reading its record or marking it as recently used.
+    bool contains(const Hash& key, std::ostream& log);
+
+    // Appends the record to the pack of the process and adds it to the index, unless the index has the key already.
+    bool put(const Hash& key, const std::vector<char>& data, std::ostream& log);
+
+    // Evicts the least recently used records until the live records take at most `size_limit` bytes, zero evicts
+    // nothing, and compacts the packs that are at least half garbage.
+    void trim(uint64_t size_limit, std::ostream& log);
+
+private:
+#if BX_PLATFORM_WINDOWS
+    using FileHandle = void*;
+#else
+    using FileHandle = int;
+#endif
+
+    // Locks `mutex` and the lock file and maps the current index until destroyed. `is_locked` is false, with a
+    // warning printed, when the index can't be mapped.
+    struct IndexLock final {
+        IndexLock(CacheStore& store, std::ostream& log);
+        ~IndexLock();
+
+        IndexLock(const IndexLock&) = delete;
+        IndexLock(IndexLock&&) = delete;
+        IndexLock& operator=(const IndexLock&) = delete;
+        IndexLock& operator=(IndexLock&&) = delete;
+
+        CacheStore& store;
+        std::unique_lock<std::mutex> lock;
+        bool is_file_locked = false;
+        bool is_locked = false;
+    };
+
+    // Opens the current index, creating it in an empty cache, or the successor of a rehashed index, and maps it.
+    // Called with the lock file locked.
+    bool map_index(std::ostream& log);
+    void unmap_index() noexcept;
+
+    CacheIndexSlot* find_slot(const Hash& key) const noexcept;
+    bool insert_slot(const CacheIndexSlot& slot, std::ostream& log);
+    void remove_slot(CacheIndexSlot* slot) noexcept;
+
+    // Opens a new pack for the records of the process. Called with `pack_mutex` and the index locked.
+    bool open_pack(std::ostream& log);
+    void close_pack() noexcept;
+
+    // Appends a record to the pack of the process. Called with `pack_mutex` locked.
+    bool append_record(const char* data, size_t size, uint64_t& offset, std::ostream& log);
+
+    // Mapping of the pack with the record at `offset`, mapped again when the pack grew past it since it was mapped.
+    std::shared_ptr<MappedFile> get_pack_mapping(uint32_t pack, uint64_t end);
+
+    std::string directory;
+
+    // Guards the index and the lock file, which locks only other processes out.
+    std::mutex mutex;
+    FileHandle lock_file;
+    FileHandle index_file;
+    uint64_t generation = 0;
+    CacheIndexHeader* header = nullptr;
+    CacheIndexSlot* slots = nullptr;
+    size_t mapped_size = 0;
+
+    // File mapping object on Windows, null elsewhere.
+    void* index_mapping = nullptr;
+
+    // Guards the pack of the process. Locked before the index when both are.
+    std::mutex pack_mutex;
+    FileHandle pack_file;
+    uint32_t pack_id = 0;
+    uint64_t pack_size = 0;
+
+    // Guards the read only mappings of packs, shared with the loads reading them.
+    std::mutex mapping_mutex;
+    std::map<uint32_t, std::shared_ptr<MappedFile>> pack_mappings;
+};
+
+// Size from which the pack of a process is replaced with a new one.
+static constexpr uint64_t CACHE_PACK_SIZE = 256 * 1024 * 1024;
@@ -0,0 +1,322 @@
+#include "checkpoint.h"
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+// First line of the journal, so journals of an incompatible format are never mistaken for valid ones.
+static const char JOURNAL_MAGIC[] = "texture.compiler checkpoint 1";
+
+// First bytes of a partial encode, "TCPE" and the format version.
+static constexpr uint32_t PARTIAL_ENCODE_MAGIC = 0x45504354;
+static constexpr uint32_t PARTIAL_ENCODE_VERSION = 1;
+
+static bool hash_file(const std::string& path, Hash& content, uint64_t& size) {
+    std::ifstream stream(path, std::ios::binary);
+    if (!stream) {
+        return false;
+    }
+
+    Hasher hasher;
+    std::vector<char> buffer(1024 * 1024);
+    size = 0;
+    while (stream) {
+        stream.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        hasher.update(buffer.data(), static_cast<size_t>(stream.gcount()));
+        size += static_cast<uint64_t>(stream.gcount());
+    }
+    if (!stream.eof()) {
+        return false;
+    }
+
+    content = hasher.finish();
+    return true;
+}
+
+Checkpoint::Checkpoint(std::string directory) noexcept
+        : directory(std::move(directory)) {
+}
+
+Checkpoint::~Checkpoint() {
+    if (journal != nullptr) {
+        std::fclose(journal);
+    }
+}
+
+bool Checkpoint::open(std::ostream& log) {
+    std::error_code error;
+    std::filesystem::create_directories(directory, error);
+    if (error) {
+        log << "Texture compiler error. Failed to create checkpoint directory " << directory << "." << std::endl;
+        return false;
+    }
+
+    const std::string path = directory + "/journal";
+
+    std::lock_guard<std::mutex> lock(mutex);
+    entries.clear();
+
+    // Every line after the magic is a job key, an output content hash, the output size and the output path, which is
+    // the rest of the line. Lines are complete once they end with a line feed, the last one may have been cut short.
+    bool is_valid = true;
+    std::streamoff valid_size = 0;
+    {
+        std::ifstream stream(path, std::ios::binary);
+        std::string line;
+        if (stream && std::getline(stream, line)) {
+            is_valid = line == JOURNAL_MAGIC && !stream.eof();
+            valid_size = stream.tellg();
+            while (is_valid && std::getline(stream, line) && !stream.eof()) {
+                std::istringstream fields(line);
+                std::string key;
+                Entry entry;
+                std::string output;
+                if (!(fields >> key >> entry.content >> entry.size) || !std::getline(fields >> std::ws, output) || output.empty()) {
+                    is_valid = false;
+                    break;
+                }
+                entries[{ key, output }] = entry;
+                valid_size = stream.tellg();
+            }
+        } else {
+            valid_size = 0;
+        }
+    }
+
+    if (!is_valid) {
+        entries.clear();
+        valid_size = 0;
+        log << "Texture compiler warning. Checkpoint journal " << path << " is malformed and starts over." << std::endl;
+    }
+
+    // A line cut short by a crash is dropped, so new lines start after the last complete one.
+    if (std::filesystem::exists(path, error)) {
+        std::filesystem::resize_file(path, static_cast<uintmax_t>(valid_size), error);
+        if (error) {
+            log << "Texture compiler error. Failed to open checkpoint journal " << path << "." << std::endl;
+            return false;
+        }
+    }
+
+    journal = std::fopen(path.c_str(), "ab");
+    if (journal == nullptr || (valid_size == 0 && (std::fprintf(journal, "%s\n", JOURNAL_MAGIC) < 0 || std::fflush(journal) != 0))) {
+        log << "Texture compiler error. Failed to open checkpoint journal " << path << "." << std::endl;
+        return false;
+    }
+
+    if (!entries.empty()) {
+        log << "Resuming from checkpoint " << directory << "." << std::endl;
+    }
+    return true;
+}
+
+bool Checkpoint::is_completed(const Hash& key, const std::vector<std::string>& outputs) const {
+    const std::string key_string = key.to_string();
+    for (const std::string& output : outputs) {
+        Entry entry;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            const auto it = entries.find({ key_string, output });
+            if (it == entries.end()) {
+                return false;
+            }
+            entry = it->second;
+        }
+
+        std::error_code error;
+        if (std::filesystem::file_size(output, error) != entry.size || error) {
+            return false;
+        }
+
+        Hash content;
+        uint64_t size;
+        if (!hash_file(output, content, size) || size != entry.size || content.to_string() != entry.content) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool Checkpoint::complete(const Hash& key, const std::vector<std::string>& outputs) {
+    const std::string key_string = key.to_string();
+
+    std::string lines;
+    std::vector<Entry> completed(outputs.size());
+    for (size_t i = 0; i < outputs.size(); i++) {
+        Hash content;
+        if (!hash_file(outputs[i], content, completed[i].size)) {
+            return false;
+        }
+        completed[i].content = content.to_string();
+        lines += key_string + " " + completed[i].content + " " + std::to_string(completed[i].size) + " " + outputs[i] + "\n";
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (journal == nullptr || std::fwrite(lines.data(), 1, lines.size(), journal) != lines.size() || std::fflush(journal) != 0) {
+            return false;
+        }
+        for (size_t i = 0; i < outputs.size(); i++) {
+            entries[{ key_string, outputs[i] }] = completed[i];
+        }
+    }
+
+    // The journal covers the job now, a partial encode left by an earlier run is never read again.
+    std::remove(get_partial_path(key).c_str());
+    return true;
+}
+
+std::string Checkpoint::get_partial_path(const Hash& key) const {
+    return directory + "/" + key.to_string() + ".partial";
+}
+
+void Checkpoint::remove(std::ostream& log) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (journal != nullptr) {
+        std::fclose(journal);
+        journal = nullptr;
+    }
+    entries.clear();
+
+    std::error_code error;
+    std::filesystem::remove_all(directory, error);
+    if (error) {
+        log << "Texture compiler warning. Failed to remove checkpoint directory " << directory << "." << std::endl;
+    }
+}
+
+PartialEncode::PartialEncode(std::string path) noexcept
+        : path(std::move(path)) {
+}
+
+PartialEncode::~PartialEncode() {
+    if (file != nullptr) {
+        std::fclose(file);
+    }
+}
+
+// Every step is the number of outputs, the size of every output's bytes, the bytes themselves and a hash of all of
+// that, so a step cut short or damaged by a crash is told apart from a complete one.
+static bool read_partial_step(std::FILE* file, size_t output_count, std::vector<std::vector<char>>& step) {
+    Hasher hasher;
+
+    uint32_t count;
+    if (std::fread(&count, sizeof(count), 1, file) != 1 || count != output_count) {
+        return false;
+    }
+    hasher.update(&count, sizeof(count));
+
+    std::vector<uint64_t> sizes(count);
+    if (std::fread(sizes.data(), sizeof(uint64_t), count, file) != count) {
+        return false;
+    }
+    hasher.update(sizes.data(), sizes.size() * sizeof(uint64_t));
+
+    step.resize(count);
+    for (uint32_t i = 0; i < count; i++) {
+        // Sizes larger than the rest of the file are a damaged step, not an allocation to attempt.
+        const long position = std::ftell(file);
+        if (std::fseek(file, 0, SEEK_END) != 0) {
+            return false;
+        }
+        const long end = std::ftell(file);
+        if (position < 0 || end < position || sizes[i] > static_cast<uint64_t>(end - position) || std::fseek(file, position, SEEK_SET) != 0) {
+            return false;
+        }
+
+        step[i].resize(static_cast<size_t>(sizes[i]));
+        if (std::fread(step[i].data(), 1, step[i].size(), file) != step[i].size()) {
+            return false;
+        }
+        hasher.update(step[i].data(), step[i].size());
+    }
+
+    uint64_t hash[2];
+    const Hash expected = hasher.finish();
+    return std::fread(hash, sizeof(uint64_t), 2, file) == 2 && hash[0] == expected.low && hash[1] == expected.high;
+}
+
+bool PartialEncode::open(size_t output_count) noexcept {
+    if (is_opened) {
+        return is_open();
+    }
+    is_opened = true;
+
+    try {
+        long valid_size = 0;
+        if (std::FILE* const saved = std::fopen(path.c_str(), "rb")) {
+            uint32_t header[2];
+            if (std::fread(header, sizeof(uint32_t), 2, saved) == 2 && header[0] == PARTIAL_ENCODE_MAGIC && header[1] == PARTIAL_ENCODE_VERSION) {
+                valid_size = std::ftell(saved);
+
+                std::vector<std::vector<char>> step;
+                while (read_partial_step(saved, output_count, step)) {
+                    steps.push_back(std::move(step));
+                    valid_size = std::ftell(saved);
+                }
+            }
+            std::fclose(saved);
+        }
+
+        // New steps follow the last complete one.
+        std::error_code error;
+        if (valid_size != 0) {
+            std::filesystem::resize_file(path, static_cast<uintmax_t>(valid_size), error);
+        }
+        file = std::fopen(path.c_str(), valid_size != 0 && !error ? "ab" : "wb");
+        if (file == nullptr) {
+            steps.clear();
+            return false;
+        }
+        if (valid_size == 0 || error) {
+            steps.clear();
+            const uint32_t header[2] = { PARTIAL_ENCODE_MAGIC, PARTIAL_ENCODE_VERSION };
+            if (std::fwrite(header, sizeof(uint32_t), 2, file) != 2 || std::fflush(file) != 0) {
+                std::fclose(file);
+                file = nullptr;
+                return false;
+            }
+        }
+        return true;
+    } catch (...) {
+        steps.clear();
+        return false;
+    }
+}
+
+bool PartialEncode::is_open() const noexcept {
+    return file != nullptr;
+}
+
+bool PartialEncode::append(const std::vector<std::pair<const char*, size_t>>& outputs) noexcept {
+    if (file == nullptr) {
+        return false;
+    }
+
+    Hasher hasher;
+    const uint32_t count = static_cast<uint32_t>(outputs.size());
+    hasher.update(&count, sizeof(count));
+
+    bool is_written = std::fwrite(&count, sizeof(count), 1, file) == 1;
+    for (const auto& [data, size] : outputs) {
+        const uint64_t size_64 = size;
+        hasher.update(&size_64, sizeof(size_64));
+        is_written = is_written && std::fwrite(&size_64, sizeof(size_64), 1, file) == 1;
+    }
+    for (const auto& [data, size] : outputs) {
+        hasher.update(data, size);
+        is_written = is_written && std::fwrite(data, 1, size, file) == size;
+    }
+
+    const Hash hash = hasher.finish();
+    const uint64_t hash_words[2] = { hash.low, hash.high };
+    is_written = is_written && std::fwrite(hash_words, sizeof(uint64_t), 2, file) == 2 && std::fflush(file) == 0;
+
+    // A step written halfway is dropped by the next `open`, but nothing may follow it.
+    if (!is_written) {
+        std::fclose(file);
+        file = nullptr;
+    }
+    return is_written;
+}
@@ -0,0 +1,96 @@
+#pragma once
+
+#include "hash.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// Progress of a manifest build, kept by `--checkpoint` in a directory, so a build that crashed or was killed resumes
+// where it stopped instead of compiling every job that missed the cache again. A journal records every completed job
+// with the size and content hash of its outputs, and large 2D jobs save their compressed mip levels as they go in a
+// `PartialEncode`. Jobs are told apart by a key of their options, the sizes and modification times of their inputs and
+// their output paths, see `compute_checkpoint_key`. Records are appended and flushed as soon as they're complete, so
+// they survive the process, and a record cut short by a crash is dropped on load. Recording is synchronized, parallel
+// jobs share the checkpoint.
+struct Checkpoint final {
+    explicit Checkpoint(std::string directory) noexcept;
+    ~Checkpoint();
+
+    Checkpoint(const Checkpoint&) = delete;
+    Checkpoint(Checkpoint&&) = delete;
+    Checkpoint& operator=(const Checkpoint&) = delete;
+    Checkpoint& operator=(Checkpoint&&) = delete;
+
+    // Creates the directory and reads the journal of the previous build. A malformed journal starts over. Returns false
+    // when the directory or the journal can't be opened.
+    bool open(std::ostream& log);
+
+    // True when the journal has the job of `key` with every one of `outputs`, and they still have the recorded size and
+    // content.
+    bool is_completed(const Hash& key, const std::vector<std::string>& outputs) const;
+
+    // Appends the job of `key` with the current content of its outputs to the journal and removes its partial encode.
+    // Returns false when an output can't be read or the journal can't be written.
+    bool complete(const Hash& key, const std::vector<std::string>& outputs);
+
+    // Path of the partial encode of the job of `key`.
+    std::string get_partial_path(const Hash& key) const;
+
+    // Removes the journal and every partial encode, once the whole build succeeded.
+    void remove(std::ostream& log);
+
+private:
+    struct Entry final {
+        std::string content;
+        uint64_t size = 0;
+    };
+
+    std::string directory;
+
+    mutable std::mutex mutex;
+    std::FILE* journal = nullptr;
+
+    // Keyed by the job key and the output path.
+    std::map<std::pair<std::string, std::string>, Entry> entries;
+};
+
+// Compressed data of an unfinished job, saved a step at a time, where a step is a mip level, or a band of level 0,
+// compressed into every output of the job. A job that starts again with the same key copies the saved steps into its
+// outputs instead of compressing them, and only compresses the rest.
+struct PartialEncode final {
+    explicit PartialEncode(std::string path) noexcept;
+    ~PartialEncode();
+
+    PartialEncode(const PartialEncode&) = delete;
+    PartialEncode(PartialEncode&&) = delete;
+    PartialEncode& operator=(const PartialEncode&) = delete;
+    PartialEncode& operator=(PartialEncode&&) = delete;
+
+    // Reads the steps an earlier run saved and opens the file for new ones. Steps of a different number of outputs
+    // are discarded. Returns false when the file can't be opened, nothing is saved then.
+    bool open(size_t output_count) noexcept;
+
+    bool is_open() const noexcept;
+
+    // Appends a step with the bytes every output gained in it. The file is closed when the write fails.
+    bool append(const std::vector<std::pair<const char*, size_t>>& outputs) noexcept;
+
+    std::string path;
+
+    // Steps read by `open`, the bytes of every output in every step.
+    std::vector<std::vector<std::vector<char>>> steps;
+
+    // Steps the job has gone through so far, and the size of every output after the last of them.
+    size_t step = 0;
+    std::vector<size_t> output_sizes;
+
+private:
+    std::FILE* file = nullptr;
+    bool is_opened = false;
+};
@@ -0,0 +1,8844 @@
+#include "bc6h_shader/bc6h_shader.compute.h"
+#include "cube_map_shader/cube_map_shader.compute.h"
+#include "cube_map_shader/cube_map_shader.fragment.h"
+#include "cube_map_shader/cube_map_shader.vertex.h"
+#include "downsample_shader/downsample_shader.compute.h"
+#include "irradiance_shader/irradiance_shader.compute.h"
+#include "irradiance_shader/irradiance_shader.fragment.h"
+#include "mip_shader/mip_shader.compute.h"
+#include "prefilter_shader/prefilter_shader.compute.h"
+#include "prefilter_shader/prefilter_shader.fragment.h"
+
+#include "archive.h"
+#include "atomic_file.h"
+#include "astc_encoder.h"
+#include "bc6h_encoder.h"
+#include "bc7_encoder.h"
+#include "block_delta.h"
+#include "etc2_encoder.h"
+#include "exr_decoder.h"
+#include "gdeflate.h"
+#include "gpu_layout.h"
+#include "build_record.h"
+#include "cache.h"
+#include "checkpoint.h"
+#include "compiler.h"
+#include "content_analysis.h"
+#include "cost_model.h"
+#include "cube_map_kernels.h"
+#include "dds_decoder.h"
+#include "dds_layout.h"
+#include "hash.h"
+#include "hdr_decoder.h"
+#include "input_hashes.h"
+#include "io_threads.h"
+#include "ktx2.h"
+#include "mapped_file.h"
+#include "metrics.h"
+#include "mip_filter.h"
+#include "packed_float.h"
+#include "pixel_kernels.h"
+#include "png_decoder.h"
+#include "profiler.h"
+#include "qoi_decoder.h"
+#include "rdo.h"
+#include "roughness_mips.h"
+#include "shader_cache.h"
+#include "spherical_harmonics.h"
+#include "stb_image.h"
+#include "texture_quality.h"
+#include "texture_stats.h"
+#include "thread_pool.h"
+#include "uastc_encoder.h"
+#include "virtual_texture.h"
+
+#include <algorithm>
+#include <bgfx/bgfx.h>
+#include <bgfx/embedded_shader.h>
+#include <bgfx/platform.h>
+#include <cctype>
+#include <chrono>
+#include <climits>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/type_ptr.hpp>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <nvtt/nvtt.h>
+#include <optional>
+#include <sstream>
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_syswm.h>
+#include <thread>
+#include <tuple>
+
+#if BX_PLATFORM_LINUX
+#include <dlfcn.h>
+#endif
+
+struct TextureCompilerErrorHandler final : nvtt::ErrorHandler {
+    explicit TextureCompilerErrorHandler(std::ostream& log) noexcept;
+
+    void error(nvtt::Error e) final;
+
+    std::ostream& log;
+};
+
+TextureCompilerErrorHandler::TextureCompilerErrorHandler(std::ostream& log) noexcept
+        : log(log) {
+}
+
+void TextureCompilerErrorHandler::error(nvtt::Error e) {
+    log << "\rTexture compiler error. " << nvtt::errorString(e) << std::endl;
+}
+
+// Identifies the code that produces outputs. Bump it whenever the output of any texture kind changes, so stale
+// compilation cache entries are never reused.
+static const char TEXTURE_COMPILER_VERSION[] = "9";
+
+// Content of the outputs written by a job by their paths, so the cache stores them without reading them back.
+using WrittenOutputs = std::map<std::string, std::vector<char>>;
+
+// Collects a compiled texture in memory and writes it with a single write to a temporary file next to the output,
+// which is then renamed over the output. Time spent in `write` is reported as the `write` phase of the job.
+struct FileOutputHandler final : nvtt::OutputHandler {
+    // `written_outputs` is null when nobody needs the content once it's written. Outputs of `compile_image` are
+    // `is_in_memory`, they never open a file and are only handed over to `written_outputs` by `hand_over`.
+    FileOutputHandler(const std::string& path, JobMetrics* metrics, WrittenOutputs* written_outputs, bool is_in_memory) noexcept;
+
+    FileOutputHandler(const FileOutputHandler&) = delete;
+    FileOutputHandler(FileOutputHandler&&) = delete;
+    FileOutputHandler& operator=(const FileOutputHandler&) = delete;
+    FileOutputHandler& operator=(FileOutputHandler&&) = delete;
+
+    // Removes the temporary file unless the output was finished.
+    ~FileOutputHandler() override;
+
+    void beginImage(int size, int width, int height, int depth, int face, int mip_level) final;
+    bool writeData(const void* data, int size) final;
+    void endImage() final;
+
+    // Buffer grows on its own, reserving it up front only avoids copying what was written so far.
+    void reserve(size_t size) noexcept;
+
+    // False unless the output is kept in memory or its temporary file is open.
+    bool is_open() const noexcept;
+
+    // Writes the buffer and renames the temporary file over the output. Returns false when either fails. An output
+    // that already has exactly this content is left untouched, see `is_unchanged`. Runs on the I/O threads.
+    bool write() noexcept;
+
+    // Hands the content of a written output over to `written_outputs`, on the thread of the job.
+    void hand_over() noexcept;
+
+    std::string path;
+    std::string temporary_path;
+    FILE* file;
+    JobMetrics* metrics;
+    WrittenOutputs* written_outputs;
+    bool is_in_memory;
+    std::vector<char> data;
+    double wall_seconds = 0.0;
+    double cpu_seconds = 0.0;
+    double write_begin_seconds = 0.0;
+    uint32_t write_thread = 0;
+
+    // Set by `write` when the existing output matched, so its modification time doesn't trigger downstream steps.
+    bool is_unchanged = false;
+};
+
+// Outputs are compared byte by byte rather than by hash, the new content is in memory and the existing file is mapped,
+// so either way every byte of both is read once, and only files of the same size are read at all.
+static bool is_file_content_equal(const std::string& path, const std::vector<char>& data) noexcept {
+    std::error_code error;
+    const uintmax_t size = std::filesystem::file_size(path, error);
+    if (error || size != data.size() || data.empty()) {
+        return false;
+    }
+
+    const MappedFile file(path);
+    return file.data != nullptr && file.size == data.size() && std::memcmp(file.data, data.data(), data.size()) == 0;
+}
+
+// Outputs without a path are only kept in memory and never finished, like the reference of `--report-quality`.
+FileOutputHandler::FileOutputHandler(const std::string& path, JobMetrics* metrics, WrittenOutputs* written_outputs, bool is_in_memory) noexcept
+        : path(path)
+        , temporary_path(get_temporary_path(path))
+        , file(path.empty() || is_in_memory ? nullptr : std::fopen(temporary_path.c_str(), "wb"))
+        , metrics(path.empty() ? nullptr : metrics)
+        , written_outputs(written_outputs)
+        , is_in_memory(is_in_memory) {
+    // The whole texture is written at once, so stdio buffering would only add a copy.
+    if (file != nullptr) {
+        std::setvbuf(file, nullptr, _IONBF, 0);
+    }
+}
+
+FileOutputHandler::~FileOutputHandler() {
+    if (file != nullptr) {
+        std::fclose(file);
+        std::remove(temporary_path.c_str());
+    }
+
+    if (metrics != nullptr) {
+        try {
+            metrics->add_phase(PhaseMetrics { "write", -1, -1, wall_seconds, cpu_seconds, write_begin_seconds, write_thread, HardwareCounters {} });
+        } catch (...) {
+            // Losing a phase is better than losing the job.
+        }
+    }
+}
+
+void FileOutputHandler::beginImage(int /*size*/, int /*width*/, int /*height*/, int /*depth*/, int /*face*/, int /*mip_level*/) {
+}
+
+bool FileOutputHandler::writeData(const void* data, int size) {
+    try {
+        const auto* bytes = static_cast<const char*>(data);
+        this->data.insert(this->data.end(), bytes, bytes + size);
+        return true;
+    } catch (...) {
+        return false;
+    }
+}
+
+void FileOutputHandler::endImage() {
+}
+
+bool FileOutputHandler::is_open() const noexcept {
+    return file != nullptr || is_in_memory;
+}
+
+void FileOutputHandler::reserve(size_t size) noexcept {
+    try {
+        data.reserve(size);
+    } catch (...) {
+        // Buffer is going to grow while it's written instead.
+    }
+}
+
+bool FileOutputHandler::write() noexcept {
+    const auto wall_begin = std::chrono::steady_clock::now();
+    const double cpu_begin = metrics != nullptr ? get_process_cpu_time() : 0.0;
+    if (metrics != nullptr) {
+        write_begin_seconds = get_trace_seconds();
+        write_thread = get_thread_index();
+    }
+
+    bool result = true;
+    if (!is_in_memory && is_file_content_equal(path, data)) {
+        std::fclose(file);
+        file = nullptr;
+        std::remove(temporary_path.c_str());
+        is_unchanged = true;
+    } else if (!is_in_memory) {
+        result = std::fwrite(data.data(), 1, data.size(), file) == data.size();
+        result = std::fclose(file) == 0 && result;
+        file = nullptr;
+
+        if (result) {
+            result = replace_file(temporary_path, path);
+        } else {
+            std::remove(temporary_path.c_str());
+        }
+    }
+
+    if (metrics != nullptr) {
+        wall_seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - wall_begin).count();
+        cpu_seconds += get_process_cpu_time() - cpu_begin;
+    }
+
+    return result;
+}
+
+void FileOutputHandler::hand_over() noexcept {
+    if (written_outputs != nullptr) {
+        try {
+            (*written_outputs)[path] = std::move(data);
+        } catch (...) {
+            // The cache is going to read the output back instead.
+        }
+    }
+}
+
+struct MemoryOutputHandler final : nvtt::OutputHandler {
+    MemoryOutputHandler() noexcept = default;
+
+    MemoryOutputHandler(const MemoryOutputHandler&) = delete;
+    MemoryOutputHandler(MemoryOutputHandler&&) = delete;
+    MemoryOutputHandler& operator=(const MemoryOutputHandler&) = delete;
+    MemoryOutputHandler& operator=(MemoryOutputHandler&&) = delete;
+
+    void beginImage(int /*size*/, int /*width*/, int /*height*/, int /*depth*/, int /*face*/, int /*mip_level*/) final {
+    }
+
+    bool writeData(const void* data, int size) final {
+        const auto* bytes = static_cast<const char*>(data);
+        this->data.insert(this->data.end(), bytes, bytes + size);
+        return true;
+    }
+
+    void endImage() final {
+    }
+
+    std::vector<char> data;
+};
+
+// Compressed 2D textures for mobile targets are compiled uncompressed and encoded to ETC2, ASTC or UASTC in
+// `finish_output`, whatever the compression and the encoder. Parallax is compiled to R8, the rest to B8G8R8A8.
+static bool is_mobile_target(const CompileJob& job) noexcept {
+    return job.target != Target::BC && job.compression != Compression::NO_COMPRESSION && job.kind != TextureKind::CUBE_MAP;
+}
+
+// Production albedo roughness and normal metalness ambient occlusion textures with the fast encoder are compiled
+// uncompressed and encoded to BC7 in `finish_output`.
+static bool is_fast_bc7(const CompileJob& job) noexcept {
+    return job.encoder == Encoder::FAST && job.compression == Compression::GOOD_BUT_SLOW && job.target == Target::BC &&
+           (job.kind == TextureKind::ALBEDO_ROUGHNESS || job.kind == TextureKind::NORMAL_METALNESS_AMBIENT_OCCLUSION);
+}
+
+// Compressed cube maps with the fast encoder are encoded to BC6H by `bc6h_shader` or `encode_bc6h_rows` instead of nvtt.
+// Irradiance and prefilter maps are never compressed.
+static bool is_fast_bc6h(const CompileJob& job) noexcept {
+    return job.encoder == Encoder::FAST && job.compression != Compression::NO_COMPRESSION;
+}
+
+// Encoder of cube map faces read back from the GPU, see `read_back_and_compress_cube`.
+enum class CubeFaceEncoder {
+    NVTT,
+    BC6H,
+    RGBA16F,
+};
+
+// Uncompressed cube maps and prefilter maps are R16G16B16A16 like the read back faces, so they're copied as is.
+static CubeFaceEncoder get_cube_face_encoder(const CompileJob& job) noexcept {
+    if (is_fast_bc6h(job)) {
+        return CubeFaceEncoder::BC6H;
+    }
+    return job.compression == Compression::NO_COMPRESSION ? CubeFaceEncoder::RGBA16F : CubeFaceEncoder::NVTT;
+}
+
+// Mip chains of development albedo roughness textures with the box filter are built from RGBA8 levels by
+// `build_next_rgba8_mip_level` rather than from float surfaces. Levels lose the precision of the float chain, which
+// is fine for block compressed formats with worse precision than that, but not for outputs with better compression.
+// Roughness mip filtering and levels with odd sides are only implemented by the float chain, and every level of a power
+// of two image has even sides. Single channel float chains of parallax height maps are cheaper than RGBA8 levels.
+static bool is_rgba8_mip_chain(const CompileJob& job, int width, int height) noexcept {
+    if (job.compression != Compression::POOR_BUT_FAST || job.mip_filter != MipFilter::BOX || job.is_roughness_mip_filtering || (width & (width - 1)) != 0 ||
+        (height & (height - 1)) != 0) {
+        return false;
+    }
+
+    for (const ExtraOutput& extra_output : job.extra_outputs) {
+        if (extra_output.compression != Compression::POOR_BUT_FAST) {
+            return false;
+        }
+    }
+
+    return job.kind == TextureKind::ALBEDO_ROUGHNESS;
+}
+
+static EncoderQuality get_encoder_quality(nvtt::Quality quality) noexcept {
+    switch (quality) {
+        case nvtt::Quality_Fastest:
+            return EncoderQuality::FASTEST;
+        case nvtt::Quality_Normal:
+            return EncoderQuality::NORMAL;
+        case nvtt::Quality_Production:
+            return EncoderQuality::PRODUCTION;
+        case nvtt::Quality_Highest:
+            return EncoderQuality::HIGHEST;
+    }
+    return EncoderQuality::NORMAL;
+}
+
+static nvtt::Quality get_nvtt_quality(EncoderQuality quality) noexcept {
+    switch (quality) {
+        case EncoderQuality::FASTEST:
+            return nvtt::Quality_Fastest;
+        case EncoderQuality::NORMAL:
+            return nvtt::Quality_Normal;
+        case EncoderQuality::PRODUCTION:
+            return nvtt::Quality_Production;
+        case EncoderQuality::HIGHEST:
+            return nvtt::Quality_Highest;
+    }
+    return nvtt::Quality_Normal;
+}
+
+// Quality of a mip level of an output, counted from the largest level of the output: the last `--mip-quality` tier
+// that starts at or above the level, `--quality` above the first tier.
+static nvtt::Quality get_mip_quality(const CompileJob& job, int output_mip_level) noexcept {
+    nvtt::Quality result = job.quality;
+    for (const MipQuality& mip_quality : job.mip_qualities) {
+        if (static_cast<size_t>(output_mip_level) >= mip_quality.first_level) {
+            result = mip_quality.quality;
+        }
+    }
+    return result;
+}
+
+// Qualities of the built-in encoders for every mip level of an output, up to the first level of the last tier.
+static MipQualities get_encoder_qualities(const CompileJob& job) {
+    const size_t level_count = job.mip_qualities.empty() ? 1 : job.mip_qualities.back().first_level + 1;
+
+    MipQualities result;
+    for (size_t level = 0; level < level_count; level++) {
+        result.push_back(get_encoder_quality(get_mip_quality(job, static_cast<int>(level))));
+    }
+    return result;
+}
+
+// Modes the built-in BC7 encoder searches for the kind of texture, see `Bc7Search`.
+static Bc7Search get_bc7_search(const CompileJob& job) noexcept {
+    switch (job.kind) {
+    case TextureKind::ALBEDO_ROUGHNESS:
+        return Bc7Search::SEPARATE_ALPHA;
+    case TextureKind::NORMAL_METALNESS_AMBIENT_OCCLUSION:
+        return Bc7Search::INDEPENDENT_CHANNELS;
+    default:
+        return Bc7Search::ALL;
+    }
+}
+
+// Per job state. Jobs running in parallel each get their own log, which is printed as a whole when the job is done.
+struct JobContext final {
+    const nvtt::Compressor& compressor;
+    ThreadPool& pool;
+    std::ostream& log;
+
+    // Progress is only printed when a single job at a time writes to the console.
+    bool is_progress_visible;
+
+    // Null unless `--metrics` or `--trace` is specified.
+    JobMetrics* metrics;
+
+    // Null unless `--cache` is specified.
+    WrittenOutputs* written_outputs;
+
+    // Set by `--report-quality`.
+    bool is_quality_report;
+
+    // Set by `--report-blocks`.
+    bool is_block_report;
+
+    // Set by `compile_image`, outputs are only handed over to `written_outputs`.
+    bool is_in_memory;
+
+    // Null unless `compile_cached` stores the uncompressed mip chain of the job, see `is_mip_chain_cacheable`.
+    std::vector<char>* mip_chain;
+
+    // Null unless `--cache-sources` is specified, see `load_decoded_source`.
+    const Cache* source_cache;
+
+    // `CompileJob::control` of the job.
+    JobControl* control;
+
+    // Null unless `--checkpoint` saves the compressed mip levels of the job, see `PartialEncode`.
+    PartialEncode* partial;
+
+    // `CompileJob::progress` of the job.
+    JobProgress* progress;
+
+    // Null unless `--gpu-mips` builds the mip levels of the job on the GPU, see `get_mip_renderer`.
+    Renderer* renderer;
+};
+
+// Prints the progress of the job when it's visible, after `prefix`, which is a carriage return for every update but
+// the first, and stores it in `JobProgress`.
+static void report_progress(const JobContext& context, const char* prefix, int percent) noexcept {
+    if (context.progress != nullptr) {
+        context.progress->percent.store(percent, std::memory_order_relaxed);
+    }
+    if (context.is_progress_visible) {
+        context.log << prefix << "Progress: " << percent << "%" << std::flush;
+    }
+}
+
+// Check point of `JobControl`, waits while the job is paused and returns false once it's canceled.
+static bool check_job_control(const JobContext& context) noexcept {
+    if (context.control == nullptr || context.control->check()) {
+        return true;
+    }
+    context.log << "\rTexture compiler error. The job was canceled." << std::endl;
+    return false;
+}
+
+// Control of the job whose blocks `ThreadPoolTaskDispatcher` dispatches on this thread, set by `compress_outputs`
+// around the compression of the main outputs.
+static thread_local JobControl* dispatched_control = nullptr;
+
+// Reserves the output buffer for all the faces and mip levels of a texture, so it's never reallocated while written.
+static void reserve_output(const JobContext& context, FileOutputHandler& output, int width, int height, int face_count, int mip_levels,
+                           const nvtt::CompressionOptions& compression_options) noexcept {
+    const int face_size = context.compressor.estimateSize(width, height, 1, mip_levels, compression_options);
+    if (face_size > 0) {
+        output.reserve(DDS10_HEADER_SIZE + static_cast<size_t>(face_size) * static_cast<size_t>(face_count));
+    }
+}
+
+// nvtt writes the header of signed BC6H, blocks of the fast encoder are unsigned.
+static void set_fast_bc6h_format(FileOutputHandler& output) noexcept {
+    if (output.data.size() >= DDS10_HEADER_SIZE) {
+        std::memcpy(output.data.data() + 128, &BC6H_DXGI_FORMAT, sizeof(BC6H_DXGI_FORMAT));
+    }
+}
+
+// nvtt writes headers of 2D textures with a single layer only, so the array size of the DX10 extension is written here.
+static void set_array_size(FileOutputHandler& output, int layer_count) noexcept {
+    if (output.data.size() >= DDS10_HEADER_SIZE) {
+        const uint32_t array_size = static_cast<uint32_t>(layer_count);
+        std::memcpy(output.data.data() + 140, &array_size, sizeof(array_size));
+    }
+}
+
+// DDS has no formats for the blocks of mobile targets, their Vulkan format is passed along instead. Zero for the rest.
+static uint32_t get_mobile_vk_format(const CompileJob& job) noexcept {
+    if (!is_mobile_target(job)) {
+        return 0;
+    }
+    if (job.target == Target::ASTC) {
+        return ASTC_4X4_VK_FORMAT;
+    }
+    if (job.target == Target::UASTC) {
+        return job.kind == TextureKind::PARALLAX ? UASTC_RRR_VK_FORMAT : UASTC_RGBA_VK_FORMAT;
+    }
+    return job.kind == TextureKind::PARALLAX ? EAC_R11_VK_FORMAT : ETC2_RGBA8_VK_FORMAT;
+}
+
+// Measures every mip level of a compressed output against the `reference` output compiled without compression, prints
+// the results to the log and adds them to the metrics.
+static int report_output_quality(const JobContext& context, const FileOutputHandler& output, const FileOutputHandler& reference, const CompileJob& job) noexcept {
+    PhaseTimer quality_timer(context.metrics, "quality");
+
+    try {
+        std::vector<MipLevelQuality> levels;
+        if (!measure_texture_quality(output.data, get_mobile_vk_format(job), reference.data, job.kind == TextureKind::NORMAL_METALNESS_AMBIENT_OCCLUSION, levels, context.log)) {
+            // Error is printed in `measure_texture_quality`.
+            return 1;
+        }
+
+        for (const MipLevelQuality& level : levels) {
+            context.log << "\rQuality of " << output.path << " mip level " << level.mip_level << ": PSNR " << std::fixed << std::setprecision(2) << level.psnr
+                        << " dB, SSIM " << std::setprecision(4) << level.ssim;
+            if (level.mean_angular_error >= 0.0) {
+                context.log << ", angular error " << std::setprecision(2) << level.mean_angular_error << " mean and " << level.max_angular_error << " max degrees";
+            }
+            context.log << "." << std::defaultfloat << std::setprecision(6) << std::endl;
+
+            if (context.metrics != nullptr) {
+                context.metrics->quality.push_back(QualityMetrics { output.path, level.mip_level, level.psnr, level.ssim, level.mean_angular_error, level.max_angular_error });
+            }
+        }
+    } catch (const std::exception& exception) {
+        context.log << "\rTexture compiler error. Failed to measure texture quality: " << exception.what() << "." << std::endl;
+        return 1;
+    }
+    return 0;
+}
+
+// Counts the modes and partitions of the blocks of every mip level of a BC7 or BC6H output, and with the `reference` of
+// `--report-quality` their error, prints the share of every mode to the log and adds the counts to the metrics.
+static int report_output_blocks(const JobContext& context, const FileOutputHandler& output, const FileOutputHandler* reference) noexcept {
+    PhaseTimer blocks_timer(context.metrics, "blocks");
+
+    try {
+        const char* format;
+        std::vector<MipLevelBlocks> levels;
+        if (!count_block_modes(output.data, reference != nullptr ? &reference->data : nullptr, format, levels, context.log)) {
+            // Error is printed in `count_block_modes`.
+            return 1;
+        }
+
+        // BC7 modes are counted from 0 and BC6H modes from 1, like their specifications do.
+        const size_t first_mode = format != nullptr && std::strcmp(format, "bc6h") == 0 ? 1 : 0;
+        for (const MipLevelBlocks& level : levels) {
+            std::vector<size_t> modes;
+            uint64_t block_count = level.reserved_blocks;
+            for (size_t mode = 0; mode < level.modes.size(); mode++) {
+                block_count += level.modes[mode];
+                if (level.modes[mode] != 0) {
+                    modes.push_back(mode);
+                }
+            }
+            std::stable_sort(modes.begin(), modes.end(), [&level](size_t a, size_t b) {
+                return level.modes[a] > level.modes[b];
+            });
+
+            context.log << "\rBlocks of " << output.path << " mip level " << level.mip_level << ":" << std::fixed << std::setprecision(1);
+            for (size_t i = 0; i < modes.size(); i++) {
+                const size_t mode = modes[i];
+                context.log << (i == 0 ? " mode " : ", mode ") << mode + first_mode << " " << 100.0 * static_cast<double>(level.modes[mode]) / static_cast<double>(block_count) << "%";
+                if (!level.mode_squared_errors.empty()) {
+                    context.log << " at RMSE " << std::setprecision(2) << std::sqrt(level.mode_squared_errors[mode] / static_cast<double>(level.modes[mode])) << std::setprecision(1);
+                }
+            }
+            if (level.reserved_blocks != 0) {
+                context.log << ", reserved " << 100.0 * static_cast<double>(level.reserved_blocks) / static_cast<double>(block_count) << "%";
+            }
+            context.log << "." << std::defaultfloat << std::setprecision(6) << std::endl;
+
+            if (context.metrics != nullptr) {
+                context.metrics->blocks.push_back(BlockMetrics { output.path, level.mip_level, format, level.modes, level.reserved_blocks, level.partitions, level.mode_squared_errors, level.error_histogram });
+            }
+        }
+    } catch (const std::exception& exception) {
+        context.log << "\rTexture compiler error. Failed to count block modes: " << exception.what() << "." << std::endl;
+        return 1;
+    }
+    return 0;
+}
+
+// Everything but the texels that affects the blocks of the built-in encoders.
+static Hash get_block_encoding_hash(const CompileJob& job) noexcept {
+    Hasher hasher;
+    hasher.update(std::string(TEXTURE_COMPILER_VERSION));
+    hasher.update(static_cast<uint64_t>(job.kind));
+    hasher.update(static_cast<uint64_t>(job.compression));
+    hasher.update(static_cast<uint64_t>(job.encoder));
+    hasher.update(static_cast<uint64_t>(job.quality));
+    hasher.update(static_cast<uint64_t>(job.mip_qualities.size()));
+    for (const MipQuality& mip_quality : job.mip_qualities) {
+        hasher.update(static_cast<uint64_t>(mip_quality.first_level));
+        hasher.update(static_cast<uint64_t>(mip_quality.quality));
+    }
+
+    uint32_t max_error;
+    std::memcpy(&max_error, &job.max_error, sizeof(max_error));
+    hasher.update(static_cast<uint64_t>(max_error));
+
+    uint32_t auto_quality;
+    std::memcpy(&auto_quality, &job.auto_quality, sizeof(auto_quality));
+    hasher.update(static_cast<uint64_t>(auto_quality));
+
+    hasher.update(static_cast<uint64_t>(job.target));
+    return hasher.finish();
+}
+
+// Fingerprints the uncompressed output of a `--delta` job and flags the blocks of the tiles that changed since the
+// previous fingerprint. `is_changed` stays empty when nothing can be reused, a missing or outdated fingerprint only
+// means that every block is encoded.
+static int prepare_block_delta(const JobContext& context, const FileOutputHandler& output, const CompileJob& job, BlockFingerprint& previous,
+                               BlockFingerprint& current, std::vector<uint8_t>& is_changed) noexcept {
+    PhaseTimer delta_timer(context.metrics, "delta");
+
+    try {
+        current.encoding = get_block_encoding_hash(job);
+        if (!compute_tile_hashes(output.data, context.pool, current.tiles, context.log)) {
+            // Error is printed in `compute_tile_hashes`.
+            return 1;
+        }
+
+        // Size, mip levels and layers of the previous blocks must match too, tile counts alone don't tell 64x32 from 32x64.
+        size_t changed_count = 0;
+        if (!read_block_fingerprint(output.path, previous) || previous.encoding != current.encoding || previous.blocks.size() < DDS10_HEADER_SIZE ||
+            std::memcmp(previous.blocks.data() + 12, output.data.data() + 12, 8) != 0 || std::memcmp(previous.blocks.data() + 28, output.data.data() + 28, 4) != 0 ||
+            std::memcmp(previous.blocks.data() + 140, output.data.data() + 140, 4) != 0 ||
+            !get_changed_blocks(output.data, previous.tiles, current.tiles, is_changed, changed_count)) {
+            is_changed.clear();
+            previous.blocks.clear();
+            return 0;
+        }
+
+        context.log << "\rDelta encoding " << changed_count << " of " << is_changed.size() << " blocks of " << output.path << "." << std::endl;
+    } catch (const std::exception& exception) {
+        context.log << "\rTexture compiler warning. Failed to fingerprint the blocks of " << output.path << ": " << exception.what() << "." << std::endl;
+        is_changed.clear();
+        previous.blocks.clear();
+    }
+    return 0;
+}
+
+// Output is always compiled to DDS, optimized for package compression and converted to the requested container or
+// laid out for the GPU with `--layout` at the end. With `--report-quality` the finished blocks are measured against the
+// `reference` before the conversion. With `--delta` the built-in encoders copy the blocks of unchanged tiles from the
+// previous compilation.
+//
+// Outputs are finished in two steps. `begin_output` does everything above on the thread of the job and hands the write
+// over to the I/O threads, `end_output` waits for the write. Jobs with several outputs begin all of them before they
+// end any, so the write of an output overlaps the encoding of the next one.
+struct PendingOutput final {
+    PendingOutput() noexcept = default;
+
+    PendingOutput(const PendingOutput&) = delete;
+    PendingOutput(PendingOutput&&) = delete;
+    PendingOutput& operator=(const PendingOutput&) = delete;
+    PendingOutput& operator=(PendingOutput&&) = delete;
+
+    // Null until the write is handed over to the I/O threads.
+    FileOutputHandler* output = nullptr;
+    TaskGroup write_group;
+    bool is_written = false;
+
+    // Blocks of `--delta` outputs, whose fingerprint is written next to the output once it's written.
+    bool is_delta = false;
+    BlockFingerprint current;
+};
+
+static int begin_output(const JobContext& context, FileOutputHandler& output, const CompileJob& job, const FileOutputHandler* reference, PendingOutput& pending) noexcept {
+    if (!check_job_control(context)) {
+        return 1;
+    }
+
+    const bool is_delta = job.is_delta && !output.path.empty() && !context.is_in_memory && (is_fast_bc7(job) || is_mobile_target(job));
+    pending.is_delta = is_delta;
+
+    if (context.mip_chain != nullptr) {
+        try {
+            *context.mip_chain = output.data;
+        } catch (const std::exception& exception) {
+            context.log << "\rTexture compiler warning. Failed to keep the mip chain: " << exception.what() << "." << std::endl;
+        }
+    }
+
+    // Pages of virtual textures are encoded as the layers of a texture array.
+    std::vector<VirtualTextureMipLevel> virtual_mip_levels;
+    uint32_t virtual_width = 0;
+    uint32_t virtual_height = 0;
+    if (job.tile_size != 0 && output.data.size() >= DDS10_HEADER_SIZE) {
+        PhaseTimer tiles_timer(context.metrics, "tiles");
+
+        virtual_height = read_32(output.data, 12);
+        virtual_width = read_32(output.data, 16);
+
+        try {
+            std::vector<char> pages;
+            if (!split_into_pages(output.data, job.tile_size, job.tile_border, pages, virtual_mip_levels, context.log)) {
+                // Error is printed in `split_into_pages`.
+                return 1;
+            }
+            output.data = std::move(pages);
+        } catch (const std::exception& exception) {
+            context.log << "\rTexture compiler error. Failed to split a texture into pages: " << exception.what() << "." << std::endl;
+            return 1;
+        }
+    }
+
+    BlockFingerprint previous;
+    BlockFingerprint& current = pending.current;
+    std::vector<uint8_t> is_changed;
+    if (is_delta && prepare_block_delta(context, output, job, previous, current, is_changed) != 0) {
+        // Error is printed in `prepare_block_delta`.
+        return 1;
+    }
+
+    const BlockReuse block_reuse { previous.blocks, is_changed, job.warm_start };
+    const BlockReuse* reuse = is_changed.empty() ? nullptr : &block_reuse;
+
+    if (is_fast_bc7(job)) {
+        PhaseTimer bc7_timer(context.metrics, "bc7");
+
+        try {
+            MipQualities qualities = get_encoder_qualities(job);
+            if (job.auto_quality > 0.f && !pick_bc7_quality(output.data, get_bc7_search(job), job.auto_quality, qualities[0], context.log)) {
+                // Error is printed in `pick_bc7_quality`.
+                return 1;
+            }
+            if (!encode_bc7(output.data, qualities, get_bc7_search(job), job.max_error, context.pool, context.log, reuse)) {
+                // Error is printed in `encode_bc7`.
+                return 1;
+            }
+        } catch (const std::exception& exception) {
+            context.log << "\rTexture compiler error. Failed to encode BC7: " << exception.what() << "." << std::endl;
+            return 1;
+        }
+    }
+
+    if (is_mobile_target(job)) {
+        const char* name = job.target == Target::ETC2 ? "ETC2" : job.target == Target::ASTC ? "ASTC" : "UASTC";
+        PhaseTimer mobile_timer(context.metrics, job.target == Target::ETC2 ? "etc2" : job.target == Target::ASTC ? "astc" : "uastc");
+
+        try {
+            const MipQualities qualities = get_encoder_qualities(job);
+            const bool is_encoded = job.target == Target::ETC2 ? encode_etc2(output.data, qualities, context.pool, context.log, reuse)
+                                    : job.target == Target::ASTC ? encode_astc(output.data, qualities, context.pool, context.log, reuse)
+                                                                 : encode_uastc(output.data, qualities, context.pool, context.log, reuse);
+            if (!is_encoded) {
+                // Error is printed in `encode_etc2`, `encode_astc` or `encode_uastc`.
+                return 1;
+            }
+        } catch (const std::exception& exception) {
+            context.log << "\rTexture compiler error. Failed to encode " << name << ": " << exception.what() << "." << std::endl;
+            return 1;
+        }
+    }
+
+    if (reuse != nullptr && job.warm_start > 0.f) {
+        const size_t changed_count = is_changed.size() - static_cast<size_t>(std::count(is_changed.begin(), is_changed.end(), 0));
+        context.log << "\rKept " << block_reuse.kept_count.load() << " of " << changed_count << " changed blocks within --warm-start." << std::endl;
+    }
+
+    // Blocks are kept before `--rdo` replaces them with copies of their neighbors, which depend on other blocks.
+    if (is_delta) {
+        try {
+            current.blocks = output.data;
+        } catch (const std::exception& exception) {
+            context.log << "\rTexture compiler warning. Failed to keep the blocks of " << output.path << ": " << exception.what() << "." << std::endl;
+        }
+    }
+
+    if (job.rdo_lambda > 0.f) {
+        PhaseTimer rdo_timer(context.metrics, "rdo");
+
+        double psnr;
+        if (!optimize_rate_distortion(output.data, job.rdo_lambda, psnr, context.log)) {
+            // Error is printed in `optimize_rate_distortion`.
+            return 1;
+        }
+
+        if (context.metrics != nullptr) {
+            context.metrics->rdo_psnr = psnr;
+        }
+    }
+
+    // Pages of virtual textures are the layers of the texture split above, whose mip levels aren't the ones of the output.
+    if (context.is_block_report && job.compression != Compression::NO_COMPRESSION && job.tile_size != 0) {
+        context.log << "\rTexture compiler warning. Blocks of virtual textures are not reported." << std::endl;
+    } else if (context.is_block_report && job.compression != Compression::NO_COMPRESSION && report_output_blocks(context, output, reference) != 0) {
+        // Error is printed in `report_output_blocks`.
+        return 1;
+    }
+
+    // UASTC is measured after transcoding at runtime, nothing here decodes it. Pages of virtual textures don't match
+    // the reference, neither do the two channels of the normal and the mask of `--mask-output`.
+    if (reference != nullptr && job.compression != Compression::NO_COMPRESSION && job.target == Target::UASTC) {
+        context.log << "\rTexture compiler warning. Quality of UASTC outputs is not measured." << std::endl;
+    } else if (reference != nullptr && job.compression != Compression::NO_COMPRESSION && job.tile_size != 0) {
+        context.log << "\rTexture compiler warning. Quality of virtual textures is not measured." << std::endl;
+    } else if (reference != nullptr && job.compression != Compression::NO_COMPRESSION && !job.mask_output.empty()) {
+        context.log << "\rTexture compiler warning. Quality of BC5 normal and mask outputs is not measured." << std::endl;
+    } else if (reference != nullptr && job.compression != Compression::NO_COMPRESSION && report_output_quality(context, output, *reference, job) != 0) {
+        // Error is printed in `report_output_quality`.
+        return 1;
+    }
+
+    if (job.mip_tail_size != 0) {
+        try {
+            if (!add_dds_mip_tail(output.data, static_cast<uint32_t>(job.mip_tail_size), context.log)) {
+                // Error is printed in `add_dds_mip_tail`.
+                return 1;
+            }
+        } catch (const std::exception& exception) {
+            context.log << "\rTexture compiler error. Failed to add a mip tail: " << exception.what() << "." << std::endl;
+            return 1;
+        }
+    }
+
+    const Container container = job.container;
+    if (container == Container::KTX2 || container == Container::KTX2_RAW) {
+        PhaseTimer convert_timer(context.metrics, "ktx2");
+
+        try {
+            std::vector<char> ktx2;
+            if (!convert_dds_to_ktx2(output.data, ktx2, get_mobile_vk_format(job), container == Container::KTX2, context.log)) {
+                // Error is printed in `convert_dds_to_ktx2`.
+                return 1;
+            }
+            output.data = std::move(ktx2);
+        } catch (const std::exception& exception) {
+            context.log << "\rTexture compiler error. Failed to convert a texture to KTX2: " << exception.what() << "." << std::endl;
+            return 1;
+        }
+    }
+
+    if (job.layout != GpuLayout::PACKED) {
+        PhaseTimer layout_timer(context.metrics, "layout");
+
+        const bool is_d3d12 = job.layout == GpuLayout::D3D12;
+        try {
+            std::vector<char> laid_out;
+            if (!convert_dds_to_gpu_layout(output.data, laid_out, is_d3d12 ? D3D12_ROW_PITCH_ALIGNMENT : VULKAN_ROW_PITCH_ALIGNMENT,
+                                           is_d3d12 ? D3D12_SUBRESOURCE_ALIGNMENT : VULKAN_SUBRESOURCE_ALIGNMENT, context.log)) {
+                // Error is printed in `convert_dds_to_gpu_layout`.
+                return 1;
+            }
+            output.data = std::move(laid_out);
+        } catch (const std::exception& exception) {
+            context.log << "\rTexture compiler error. Failed to lay out a texture for the GPU: " << exception.what() << "." << std::endl;
+            return 1;
+        }
+    }
+
+    if (job.is_checksums) {
+        try {
+            if (!add_dds_checksums(output.data, context.log)) {
+                // Error is printed in `add_dds_checksums`.
+                return 1;
+            }
+        } catch (const std::exception& exception) {
+            context.log << "\rTexture compiler error. Failed to add checksums: " << exception.what() << "." << std::endl;
+            return 1;
+        }
+    }
+
+    if (job.tile_size != 0) {
+        try {
+            std::vector<char> virtual_texture;
+            if (!write_virtual_texture(output.data, virtual_mip_levels, virtual_width, virtual_height, job.tile_size, job.tile_border,
+                                       get_mobile_vk_format(job), virtual_texture, context.log)) {
+                // Error is printed in `write_virtual_texture`.
+                return 1;
+            }
+            output.data = std::move(virtual_texture);
+        } catch (const std::exception& exception) {
+            context.log << "\rTexture compiler error. Failed to write a virtual texture: " << exception.what() << "." << std::endl;
+            return 1;
+        }
+    }
+
+    if (container == Container::DDS_GDEFLATE) {
+        PhaseTimer convert_timer(context.metrics, "gdeflate");
+
+        try {
+            std::vector<char> gdeflate;
+            if (!convert_dds_to_gdeflate(output.data, gdeflate, context.pool, context.log)) {
+                // Error is printed in `convert_dds_to_gdeflate`.
+                return 1;
+            }
+            output.data = std::move(gdeflate);
+        } catch (const std::exception& exception) {
+            context.log << "\rTexture compiler error. Failed to compress a texture with GDeflate: " << exception.what() << "." << std::endl;
+            return 1;
+        }
+    }
+
+    // A job canceled while the built-in encoders ran keeps the previous output.
+    if (!check_job_control(context)) {
+        return 1;
+    }
+
+    // The output is no longer touched by this thread until `end_output`.
+    pending.output = &output;
+    try {
+        get_io_threads().push(pending.write_group, [&pending] {
+            pending.is_written = pending.output->write();
+        });
+    } catch (...) {
+        pending.is_written = output.write();
+    }
+    return 0;
+}
+
+// Waits for the write of an output begun by `begin_output`. Does nothing for outputs that failed to begin, so every
+// pending output of a job can be ended before the outputs themselves are destroyed.
+static int end_output(const JobContext& context, PendingOutput& pending) noexcept {
+    if (pending.output == nullptr) {
+        return 0;
+    }
+
+    get_io_threads().wait(pending.write_group);
+
+    FileOutputHandler& output = *pending.output;
+    pending.output = nullptr;
+
+    if (!pending.is_written) {
+        context.log << "\rTexture compiler error. Failed to write output file." << std::endl;
+        return 1;
+    }
+
+    output.hand_over();
+
+    if (output.is_unchanged) {
+        context.log << "\rOutput " << output.path << " is unchanged." << std::endl;
+    }
+
+    // The output is fine without a fingerprint, the next compilation just encodes every block.
+    if (pending.is_delta && !pending.current.blocks.empty() && !write_block_fingerprint(output.path, pending.current)) {
+        context.log << "\rTexture compiler warning. Failed to write the block fingerprint of " << output.path << "." << std::endl;
+    }
+    return 0;
+}
+
+static int finish_output(const JobContext& context, FileOutputHandler& output, const CompileJob& job, const FileOutputHandler* reference = nullptr) noexcept {
+    PendingOutput pending;
+    const int result = begin_output(context, output, job, reference, pending);
+    return end_output(context, pending) != 0 ? 1 : result;
+}
+
+// Encoded output of a 2D texture. Jobs with `--extra-output` or `--mask-output` have several of them, which share the
+// decoded image and the mip chain: every mip level is compressed into all of them before the next one is built.
+struct TextureOutput final {
+    TextureOutput(const JobContext& context, const CompileJob& job);
+
+    TextureOutput(const TextureOutput&) = delete;
+    TextureOutput(TextureOutput&&) = delete;
+    TextureOutput& operator=(const TextureOutput&) = delete;
+    TextureOutput& operator=(TextureOutput&&) = delete;
+
+    // The job with the path and the compression of this output and no extra outputs.
+    CompileJob job;
+
+    // Uncompressed output without a file that compressed outputs are measured against by `--report-quality`.
+    bool is_reference = false;
+
+    // Metalness and ambient occlusion of `--mask-output`, compressed from the blue and alpha channels of the surface.
+    bool is_mask = false;
+
+    // Mip levels above this one don't fit in `--max-size` and are never compressed into the output.
+    int first_mip_level = 0;
+
+    // Mip levels from `mip_tail_level` on are kept in `mip_tail_bands` of the first output until `last_mip_level` and
+    // compressed together, see `compress_outputs`. No level is in the tail without `--mip-tail`.
+    int mip_tail_level = INT_MAX;
+    int last_mip_level = 0;
+    std::vector<nvtt::Surface> mip_tail_bands;
+
+    // Statistics of `--stats`, gathered on the first output from the levels it's compressed from.
+    TextureStats stats;
+    int height = 0;
+
+    TextureCompilerErrorHandler error_handler;
+    FileOutputHandler output;
+    nvtt::OutputOptions output_options;
+    nvtt::CompressionOptions compression_options;
+};
+
+TextureOutput::TextureOutput(const JobContext& context, const CompileJob& job)
+        : job(job)
+        , error_handler(context.log)
+        , output(job.output, context.metrics, context.written_outputs, context.is_in_memory) {
+    this->job.extra_outputs.clear();
+
+    output_options.setOutputHandler(&output);
+    output_options.setContainer(nvtt::Container_DDS10);
+    output_options.setErrorHandler(&error_handler);
+}
+
+using TextureOutputs = std::vector<std::unique_ptr<TextureOutput>>;
+
+// Sets compression options of an output of the texture kind.
+using SetCompressionOptionsFunction = std::function<void(nvtt::CompressionOptions& compression_options, const CompileJob& job)>;
+
+// First mip level of the image with both sides no larger than `--max-size`.
+static int get_first_output_mip_level(const CompileJob& job, int width, int height) noexcept {
+    int result = 0;
+    while (job.max_size != 0 && static_cast<size_t>(std::max(width, height)) > job.max_size) {
+        width = std::max(width / 2, 1);
+        height = std::max(height / 2, 1);
+        result++;
+    }
+    return result;
+}
+
+// First mip level of the image in the `--mip-tail` of the outputs, the first one with a side smaller than the size of the
+// option, or the first output level when it's smaller already. `INT_MAX` without a mip tail.
+static int get_mip_tail_level(const CompileJob& job, int width, int height, int first_mip_level) noexcept {
+    if (job.mip_tail_size == 0) {
+        return INT_MAX;
+    }
+    int result = 0;
+    while (std::max(width >> result, 1) >= static_cast<int>(job.mip_tail_size) && std::max(height >> result, 1) >= static_cast<int>(job.mip_tail_size)) {
+        result++;
+    }
+    return std::max(result, first_mip_level);
+}
+
+// Opens the main output, the extra outputs and the mask output of a 2D texture job and writes their headers. The size
+// and the mip levels are those of the whole image, outputs start at the first mip level that fits in `--max-size`.
+// `analysis` of `--auto-format` collapses flat images to their single pixel level, which is the same color, and
+// compresses opaque ones to BC1, which decodes alpha to 255 like the image has it.
+static int open_texture_outputs(const JobContext& context, const CompileJob& job, int width, int height, int layer_count, int total_mip_levels,
+                                const SetCompressionOptionsFunction& set_compression_options, TextureOutputs& outputs,
+                                const ContentAnalysis* analysis = nullptr) noexcept {
+    const int first_mip_level = analysis != nullptr && is_flat(*analysis) ? total_mip_levels - 1 : get_first_output_mip_level(job, width, height);
+    const int output_width = std::max(width >> first_mip_level, 1);
+    const int output_height = std::max(height >> first_mip_level, 1);
+
+    try {
+        outputs.push_back(std::make_unique<TextureOutput>(context, job));
+        for (const ExtraOutput& extra_output : job.extra_outputs) {
+            CompileJob extra_job = job;
+            extra_job.output = extra_output.path;
+            extra_job.compression = extra_output.compression;
+            outputs.push_back(std::make_unique<TextureOutput>(context, extra_job));
+        }
+        if (!job.mask_output.empty()) {
+            CompileJob mask_job = job;
+            mask_job.output = job.mask_output;
+            outputs.push_back(std::make_unique<TextureOutput>(context, mask_job));
+            outputs.back()->is_mask = true;
+        }
+
+        const bool is_compressed = std::any_of(outputs.begin(), outputs.end(), [](const std::unique_ptr<TextureOutput>& output) {
+            return output->job.compression != Compression::NO_COMPRESSION;
+        });
+        if (context.is_quality_report && is_compressed) {
+            CompileJob reference_job = job;
+            reference_job.output.clear();
+            reference_job.compression = Compression::NO_COMPRESSION;
+
+            // Quality is measured against R8.
+            reference_job.is_r16 = false;
+            outputs.push_back(std::make_unique<TextureOutput>(context, reference_job));
+            outputs.back()->is_reference = true;
+        }
+    } catch (const std::exception& exception) {
+        context.log << "Texture compiler error. Failed to create outputs: " << exception.what() << "." << std::endl;
+        return 1;
+    }
+
+    for (const std::unique_ptr<TextureOutput>& output : outputs) {
+        if (!output->output.is_open() && !output->is_reference) {
+            context.log << "Texture compiler error. Failed to open output file." << std::endl;
+            return 1;
+        }
+
+        // BC1 is compressed by nvtt, the built-in BC7 encoder must not encode the output again.
+        const bool is_bc1 = analysis != nullptr && analysis->is_opaque && output->job.compression != Compression::NO_COMPRESSION;
+        if (is_bc1) {
+            output->job.encoder = Encoder::NVTT;
+        }
+
+        set_compression_options(output->compression_options, output->job);
+        if (is_bc1) {
+            output->compression_options.setFormat(nvtt::Format_BC1);
+        }
+        output->first_mip_level = first_mip_level;
+        output->mip_tail_level = get_mip_tail_level(job, width, height, first_mip_level);
+        output->last_mip_level = total_mip_levels - 1;
+        output->stats.layer_count = static_cast<uint32_t>(layer_count);
+        output->height = height;
+
+        reserve_output(context, output->output, output_width, output_height, layer_count, total_mip_levels - first_mip_level, output->compression_options);
+        if (!context.compressor.outputHeader(nvtt::TextureType_2D, output_width, output_height, 1, 1, total_mip_levels - first_mip_level, false,
+                                             output->compression_options, output->output_options)) {
+            // Error is printed via `error_handler`.
+            return 1;
+        }
+        set_array_size(output->output, layer_count);
+    }
+
+    return 0;
+}
+
+// All the outputs of a job start at the same mip level, levels above it are only built to filter the levels below.
+static bool is_output_mip_level(const TextureOutputs& outputs, int mip_level) noexcept {
+    return mip_level >= outputs.front()->first_mip_level;
+}
+
+// Copies the next step an earlier run of the job saved into the outputs, see `PartialEncode`. `is_resumed` is false
+// when no saved step is left and the step has to be compressed.
+static bool resume_partial_step(const JobContext& context, const TextureOutputs& outputs, bool& is_resumed) noexcept {
+    PartialEncode& partial = *context.partial;
+    is_resumed = false;
+    if (!partial.open(outputs.size()) && partial.step == 0) {
+        context.log << "\rTexture compiler warning. Failed to open " << partial.path << ", compressed mip levels are not saved." << std::endl;
+    }
+    if (partial.step == 0 && !partial.steps.empty()) {
+        context.log << "\rResuming " << partial.steps.size() << " compressed mip levels and bands from the checkpoint." << std::endl;
+    }
+
+    try {
+        if (partial.output_sizes.empty()) {
+            for (const std::unique_ptr<TextureOutput>& output : outputs) {
+                partial.output_sizes.push_back(output->output.data.size());
+            }
+        }
+        if (partial.step >= partial.steps.size()) {
+            return true;
+        }
+
+        const std::vector<std::vector<char>>& step = partial.steps[partial.step++];
+        for (size_t i = 0; i < outputs.size(); i++) {
+            std::vector<char>& data = outputs[i]->output.data;
+            data.insert(data.end(), step[i].begin(), step[i].end());
+            partial.output_sizes[i] = data.size();
+        }
+        is_resumed = true;
+        return true;
+    } catch (const std::exception& exception) {
+        context.log << "\rTexture compiler error. Failed to resume a compressed mip level: " << exception.what() << "." << std::endl;
+        return false;
+    }
+}
+
+// Saves what the outputs gained in a compressed step. Failing to save doesn't fail the job, the rest of it just isn't
+// saved.
+static void save_partial_step(const JobContext& context, const TextureOutputs& outputs) noexcept {
+    PartialEncode& partial = *context.partial;
+    partial.step++;
+    if (!partial.is_open()) {
+        return;
+    }
+
+    try {
+        std::vector<std::pair<const char*, size_t>> step;
+        for (size_t i = 0; i < outputs.size(); i++) {
+            const std::vector<char>& data = outputs[i]->output.data;
+            step.emplace_back(data.data() + partial.output_sizes[i], data.size() - partial.output_sizes[i]);
+            partial.output_sizes[i] = data.size();
+        }
+        if (!partial.append(step)) {
+            context.log << "\rTexture compiler warning. Failed to write " << partial.path << ", compressed mip levels are no longer saved." << std::endl;
+        }
+    } catch (const std::exception& exception) {
+        context.log << "\rTexture compiler warning. Failed to save a compressed mip level: " << exception.what() << "." << std::endl;
+    }
+}
+
+// nvtt compresses the output to 4x4 blocks, rather than writing pixels that are uncompressed or encoded by the built-in
+// encoders later.
+static bool is_nvtt_block_compressed(const TextureOutput& output) noexcept {
+    return output.job.compression != Compression::NO_COMPRESSION && !is_fast_bc7(output.job) && !is_mobile_target(output.job);
+}
+
+// Lays the bands of a mip tail out for a single `compress` that writes the same data as compressing every band on its
+// own. `blocks` is a strip a block high with every block of every band side by side, in the order of the bands and of
+// their blocks, for block compressed outputs. Blocks at the edges of bands repeat their pixels like nvtt pads them.
+// `pixels` is a single row of every pixel of every band, for the others. Either is left empty when it isn't needed.
+static bool build_mip_tail_strips(const std::vector<nvtt::Surface>& bands, const nvtt::Surface& surface, bool is_block_strip, bool is_pixel_strip, nvtt::Surface& blocks,
+                                  nvtt::Surface& pixels) noexcept {
+    static const int PADDED_PIXELS[4][4] = { { 0, 0, 0, 0 }, { 0, 1, 0, 1 }, { 0, 1, 2, 0 }, { 0, 1, 2, 3 } };
+
+    size_t block_count = 0;
+    size_t pixel_count = 0;
+    for (const nvtt::Surface& band : bands) {
+        block_count += static_cast<size_t>((band.width() + 3) / 4) * static_cast<size_t>((band.height() + 3) / 4);
+        pixel_count += static_cast<size_t>(band.width()) * static_cast<size_t>(band.height());
+    }
+    if (block_count * 4 > INT_MAX || pixel_count > INT_MAX) {
+        return false;
+    }
+
+    if (is_block_strip) {
+        const size_t strip_width = block_count * 4;
+        if (!blocks.setImage(static_cast<int>(strip_width), 4, 1)) {
+            return false;
+        }
+
+        size_t block = 0;
+        for (const nvtt::Surface& band : bands) {
+            const int width = band.width();
+            const int height = band.height();
+            for (int block_y = 0; block_y < height; block_y += 4) {
+                const int rows = std::min(height - block_y, 4);
+                for (int block_x = 0; block_x < width; block_x += 4, block++) {
+                    const int columns = std::min(width - block_x, 4);
+                    for (int channel = 0; channel < 4; channel++) {
+                        const float* source = band.channel(channel);
+                        float* destination = const_cast<float*>(blocks.channel(channel)) + block * 4;
+                        for (int y = 0; y < 4; y++) {
+                            const float* source_row = source + static_cast<size_t>(block_y + PADDED_PIXELS[rows - 1][y]) * static_cast<size_t>(width) + block_x;
+                            for (int x = 0; x < 4; x++) {
+                                destination[static_cast<size_t>(y) * strip_width + x] = source_row[PADDED_PIXELS[columns - 1][x]];
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        blocks.setWrapMode(surface.wrapMode());
+        blocks.setAlphaMode(surface.alphaMode());
+        blocks.setNormalMap(surface.isNormalMap());
+    }
+
+    if (is_pixel_strip) {
+        if (!pixels.setImage(static_cast<int>(pixel_count), 1, 1)) {
+            return false;
+        }
+
+        for (int channel = 0; channel < 4; channel++) {
+            float* destination = const_cast<float*>(pixels.channel(channel));
+            for (const nvtt::Surface& band : bands) {
+                const size_t band_pixels = static_cast<size_t>(band.width()) * static_cast<size_t>(band.height());
+                std::memcpy(destination, band.channel(channel), band_pixels * sizeof(float));
+                destination += band_pixels;
+            }
+        }
+
+        pixels.setWrapMode(surface.wrapMode());
+        pixels.setAlphaMode(surface.alphaMode());
+        pixels.setNormalMap(surface.isNormalMap());
+    }
+
+    return true;
+}
+
+// Compresses a mip level, or a band of level 0, into every output that has the level. The mask of `--mask-output` is
+// moved to its own surface and compressed on the thread pool while the normal is compressed here. Every output is
+// compressed with the quality of `--mip-quality` for the level. Levels of the `--mip-tail` are only kept until the last
+// one, which compresses all of them with a single `compress` per output and the quality of the first one, instead of
+// a call per tiny level.
+static bool compress_outputs(const JobContext& context, const nvtt::Surface& surface, int mip_level, const TextureOutputs& outputs) noexcept {
+    if (!check_job_control(context)) {
+        return false;
+    }
+
+    TextureOutput& front = *outputs.front();
+    if (front.job.is_stats && mip_level >= front.first_mip_level) {
+        const float* const channels[4] = { surface.channel(0), surface.channel(1), surface.channel(2), surface.channel(3) };
+        if (!front.stats.add_band(channels, surface.width(), surface.height(), std::max(front.height >> mip_level, 1))) {
+            context.log << "\rTexture compiler error. Failed to allocate memory." << std::endl;
+            return false;
+        }
+    }
+
+    // Bands are copied, the caller reuses them for the next level.
+    const bool is_mip_tail = mip_level >= front.mip_tail_level;
+    if (is_mip_tail) {
+        try {
+            front.mip_tail_bands.emplace_back();
+        } catch (const std::exception& exception) {
+            context.log << "\rTexture compiler error. Failed to keep a mip level of the tail: " << exception.what() << "." << std::endl;
+            return false;
+        }
+        if (!front.mip_tail_bands.back().setImage(nvtt::InputFormat_RGBA_32F, surface.width(), surface.height(), 1, surface.channel(0), surface.channel(1), surface.channel(2),
+                                                  surface.channel(3))) {
+            context.log << "\rTexture compiler error. Failed to set an image." << std::endl;
+            return false;
+        }
+        if (mip_level < front.last_mip_level) {
+            return true;
+        }
+    }
+
+    // Levels above the first output level compress nothing and aren't steps.
+    PartialEncode* const partial = is_output_mip_level(outputs, mip_level) ? context.partial : nullptr;
+
+    bool is_resumed = false;
+    if (partial != nullptr && !resume_partial_step(context, outputs, is_resumed)) {
+        return false;
+    }
+    if (is_resumed) {
+        front.mip_tail_bands.clear();
+        return true;
+    }
+
+    nvtt::Surface block_strip;
+    nvtt::Surface pixel_strip;
+    uint64_t pixel_count = static_cast<uint64_t>(surface.width()) * static_cast<uint64_t>(surface.height());
+    if (is_mip_tail) {
+        const bool is_block_strip = std::any_of(outputs.begin(), outputs.end(), [](const std::unique_ptr<TextureOutput>& output) {
+            return is_nvtt_block_compressed(*output);
+        });
+        const bool is_pixel_strip = std::any_of(outputs.begin(), outputs.end(), [](const std::unique_ptr<TextureOutput>& output) {
+            return !is_nvtt_block_compressed(*output);
+        });
+        if (!build_mip_tail_strips(front.mip_tail_bands, surface, is_block_strip, is_pixel_strip, block_strip, pixel_strip)) {
+            context.log << "\rTexture compiler error. Failed to set an image." << std::endl;
+            return false;
+        }
+
+        pixel_count = 0;
+        for (const nvtt::Surface& band : front.mip_tail_bands) {
+            pixel_count += static_cast<uint64_t>(band.width()) * static_cast<uint64_t>(band.height());
+        }
+        front.mip_tail_bands.clear();
+    }
+    const auto get_source = [&](const TextureOutput& output) -> const nvtt::Surface& {
+        return !is_mip_tail ? surface : is_nvtt_block_compressed(output) ? block_strip : pixel_strip;
+    };
+    const int quality_level = is_mip_tail ? front.mip_tail_level : mip_level;
+
+    for (const std::unique_ptr<TextureOutput>& output : outputs) {
+        output->compression_options.setQuality(get_mip_quality(output->job, quality_level - output->first_mip_level));
+    }
+
+    nvtt::Surface mask;
+    bool is_mask_compressed = true;
+
+    TaskGroup group;
+    for (const std::unique_ptr<TextureOutput>& output : outputs) {
+        if (!output->is_mask || mip_level < output->first_mip_level) {
+            continue;
+        }
+
+        const nvtt::Surface& source = get_source(*output);
+        if (!mask.setImage(source.width(), source.height(), 1)) {
+            context.log << "\rTexture compiler error. Failed to set an image." << std::endl;
+            return false;
+        }
+        mask.copyChannel(source, 2, 0);
+        mask.copyChannel(source, 3, 1);
+
+        context.pool.push(group, [&context, &mask, &is_mask_compressed, &mask_output = *output, quality_level] {
+            is_mask_compressed = context.compressor.compress(mask, 0, quality_level - mask_output.first_mip_level, mask_output.compression_options, mask_output.output_options);
+        });
+    }
+
+    bool is_compressed = true;
+    uint64_t encoded_pixels = 0;
+    dispatched_control = context.control;
+    for (const std::unique_ptr<TextureOutput>& output : outputs) {
+        if (mip_level < output->first_mip_level) {
+            continue;
+        }
+        if (!output->is_reference) {
+            encoded_pixels += pixel_count;
+        }
+        if (output->is_mask) {
+            continue;
+        }
+
+        if (!context.compressor.compress(get_source(*output), 0, quality_level - output->first_mip_level, output->compression_options, output->output_options)) {
+            is_compressed = false;
+            break;
+        }
+    }
+    dispatched_control = nullptr;
+
+    // Blocks skipped by a cancellation leave the outputs incomplete.
+    if (is_compressed && !check_job_control(context)) {
+        is_compressed = false;
+    }
+
+    // The task references local variables, so it must be finished even if compression failed.
+    context.pool.wait(group);
+
+    if (is_compressed && is_mask_compressed && context.metrics != nullptr) {
+        context.metrics->encoded_pixels.fetch_add(encoded_pixels, std::memory_order_relaxed);
+    }
+
+    if (is_compressed && is_mask_compressed && partial != nullptr) {
+        save_partial_step(context, outputs);
+    }
+
+    return is_compressed && is_mask_compressed;
+}
+
+static int finish_outputs(const JobContext& context, const TextureOutputs& outputs) noexcept {
+    // The reference is always the last output.
+    const FileOutputHandler* reference = outputs.back()->is_reference ? &outputs.back()->output : nullptr;
+
+    // Pending writes reference the outputs, so all of them are ended even when one fails.
+    std::unique_ptr<PendingOutput[]> pending(new (std::nothrow) PendingOutput[outputs.size()]);
+    if (pending == nullptr) {
+        context.log << "\rTexture compiler error. Failed to allocate memory." << std::endl;
+        return 1;
+    }
+
+    int result = 0;
+    for (size_t i = 0; i < outputs.size() && result == 0; i++) {
+        if (!outputs[i]->is_reference && begin_output(context, outputs[i]->output, outputs[i]->job, reference, pending[i]) != 0) {
+            // Error is printed in `begin_output`.
+            result = 1;
+        }
+    }
+
+    // The output is only read by its write until `end_output`, which hands its data over.
+    const TextureOutput& front = *outputs.front();
+    const bool is_stats = result == 0 && front.job.is_stats && !context.is_in_memory && !front.output.path.empty();
+    const Hash content = is_stats ? hash_content(front.output.data.data(), front.output.data.size()) : Hash {};
+
+    for (size_t i = 0; i < outputs.size(); i++) {
+        if (end_output(context, pending[i]) != 0) {
+            // Error is printed in `end_output`.
+            result = 1;
+        }
+    }
+
+    if (result == 0 && is_stats) {
+        try {
+            if (!write_texture_stats(front.output.path, content, front.stats)) {
+                context.log << "\rTexture compiler error. Failed to write the statistics of " << front.output.path << "." << std::endl;
+                result = 1;
+            }
+        } catch (const std::exception& exception) {
+            context.log << "\rTexture compiler error. Failed to write the statistics of " << front.output.path << ": " << exception.what() << "." << std::endl;
+            result = 1;
+        }
+    }
+    return result;
+}
+
+// Copies a channel of interleaved RGBA pixels into a plane of its own.
+template <typename PixelType>
+static std::unique_ptr<PixelType[]> extract_channel(const PixelType* rgba, size_t pixel_count, int channel) noexcept {
+    std::unique_ptr<PixelType[]> result(new (std::nothrow) PixelType[pixel_count]);
+    if (result != nullptr) {
+        for (size_t i = 0; i < pixel_count; i++) {
+            result[i] = rgba[i * 4 + static_cast<size_t>(channel)];
+        }
+    }
+    return result;
+}
+
+// Inputs are decoded from a memory mapping of the file, which is released as soon as decoding is done. Inputs that
+// allow 16 bits keep 16-bit images in `data16` rather than `data`. Inputs of a single channel keep only that channel
+// of the RGBA image, a component per pixel, so the other three are never stored longer than it takes to decode.
+struct RgbaWrapper final {
+    explicit RgbaWrapper(const std::string& path, bool is_16_bit_allowed = false, int channel = -1) noexcept {
+        const MappedFile file(path);
+        if (file.data != nullptr && channel >= 0) {
+            load_channel(file, is_16_bit_allowed, channel);
+        } else if (file.data != nullptr) {
+            load(file.data, file.size, is_16_bit_allowed);
+        }
+    }
+
+    // Decodes a whole image file the caller has in memory, like the standard input of `compile_encoded_image`.
+    RgbaWrapper(const uint8_t* file_data, size_t file_size, bool is_16_bit_allowed) noexcept {
+        load(file_data, file_size, is_16_bit_allowed);
+    }
+
+    // Borrows the image of `compile_image`, which is never modified, because channel inputs are not supported there.
+    // 16-bit images that must keep 8 bits are converted like 16-bit files are by stb_image. A single channel is copied
+    // out of the image instead.
+    RgbaWrapper(const ImageView& image, bool is_16_bit_allowed, int channel = -1) noexcept
+            : width(image.width)
+            , height(image.height)
+            , channels(4) {
+        const size_t pixel_count = static_cast<size_t>(width) * static_cast<size_t>(height);
+        if (channel >= 0) {
+            components = 1;
+            if (image.format == PixelFormat::RGBA8) {
+                pixels = extract_channel(static_cast<const stbi_uc*>(image.pixels), pixel_count, channel);
+                data = pixels.get();
+            } else if (image.format == PixelFormat::RGBA16 && is_16_bit_allowed) {
+                pixels16 = extract_channel(static_cast<const stbi_us*>(image.pixels), pixel_count, channel);
+                data16 = pixels16.get();
+            } else if (image.format == PixelFormat::RGBA16) {
+                pixels.reset(new (std::nothrow) stbi_uc[pixel_count]);
+                if (pixels != nullptr) {
+                    const auto* const source = static_cast<const stbi_us*>(image.pixels);
+                    for (size_t i = 0; i < pixel_count; i++) {
+                        pixels[i] = static_cast<stbi_uc>(source[i * 4 + static_cast<size_t>(channel)] >> 8);
+                    }
+                    data = pixels.get();
+                }
+            }
+        } else if (image.format == PixelFormat::RGBA8) {
+            data = const_cast<stbi_uc*>(static_cast<const stbi_uc*>(image.pixels));
+            is_borrowed = true;
+        } else if (image.format == PixelFormat::RGBA16 && is_16_bit_allowed) {
+            data16 = const_cast<stbi_us*>(static_cast<const stbi_us*>(image.pixels));
+            is_borrowed = true;
+        } else if (image.format == PixelFormat::RGBA16) {
+            const size_t size = pixel_count * 4;
+            pixels.reset(new (std::nothrow) stbi_uc[size]);
+            if (pixels != nullptr) {
+                const auto* const source = static_cast<const stbi_us*>(image.pixels);
+                for (size_t i = 0; i < size; i++) {
+                    pixels[i] = static_cast<stbi_uc>(source[i] >> 8);
+                }
+                data = pixels.get();
+            }
+        }
+    }
+
+    // Empty until `load_decoded_source` fills it.
+    RgbaWrapper() noexcept = default;
+
+    RgbaWrapper(const RgbaWrapper&) = delete;
+    RgbaWrapper(RgbaWrapper&&) = delete;
+    RgbaWrapper& operator=(const RgbaWrapper&) = delete;
+    RgbaWrapper& operator=(RgbaWrapper&&) = delete;
+
+    ~RgbaWrapper() {
+        if (is_borrowed || !source_entry.empty()) {
+            return;
+        }
+        if (data != nullptr && pixels == nullptr) {
+            stbi_image_free(data);
+        }
+        if (data16 != nullptr && pixels16 == nullptr) {
+            stbi_image_free(data16);
+        }
+    }
+
+    void load(const uint8_t* file_data, size_t file_size, bool is_16_bit_allowed) noexcept {
+        if (is_16_bit_allowed && file_size <= INT_MAX && stbi_is_16_bit_from_memory(file_data, static_cast<int>(file_size))) {
+            data16 = stbi_load_16_from_memory(file_data, static_cast<int>(file_size), &width, &height, &channels, 4);
+            return;
+        }
+
+        // PNG images `decode_png_rgba8` doesn't support are left to stb_image, QOI and uncompressed DDS images are only
+        // supported by the built-in decoders.
+        pixels = decode_png_rgba8(file_data, file_size, width, height, channels);
+        if (pixels == nullptr) {
+            pixels = decode_qoi_rgba8(file_data, file_size, width, height, channels);
+        }
+        if (pixels == nullptr) {
+            pixels = decode_dds_rgba8(file_data, file_size, width, height, channels);
+        }
+        if (pixels != nullptr) {
+            data = pixels.get();
+        } else if (file_size <= INT_MAX) {
+            data = stbi_load_from_memory(file_data, static_cast<int>(file_size), &width, &height, &channels, 4);
+        }
+    }
+
+    // Grey images, with or without alpha, are decoded by stb_image to a single component, which is the value of every
+    // color channel. Images with color are decoded to RGBA first, except for PNG images `decode_png_channel8` supports
+    // and QOI and DDS images, which are always decoded to the channel straight away.
+    void load_channel(const MappedFile& file, bool is_16_bit_allowed, int channel) noexcept {
+        components = 1;
+
+        int file_channels = 0;
+        const bool is_stb_image = file.size <= INT_MAX && stbi_info_from_memory(file.data, static_cast<int>(file.size), &width, &height, &file_channels) != 0;
+        const int stb_components = file_channels <= 2 ? 1 : 4;
+        const size_t pixel_count = static_cast<size_t>(width) * static_cast<size_t>(height);
+
+        if (is_16_bit_allowed && is_stb_image && stbi_is_16_bit_from_memory(file.data, static_cast<int>(file.size))) {
+            stbi_us* const image = stbi_load_16_from_memory(file.data, static_cast<int>(file.size), &width, &height, &channels, stb_components);
+            if (image != nullptr && stb_components == 1) {
+                data16 = image;
+            } else if (image != nullptr) {
+                pixels16 = extract_channel(image, pixel_count, channel);
+                data16 = pixels16.get();
+                stbi_image_free(image);
+            }
+            return;
+        }
+
+        pixels = decode_png_channel8(file.data, file.size, channel, width, height, channels);
+        if (pixels == nullptr) {
+            pixels = decode_qoi_channel8(file.data, file.size, channel, width, height, channels);
+        }
+        if (pixels == nullptr) {
+            pixels = decode_dds_channel8(file.data, file.size, channel, width, height, channels);
+        }
+        if (pixels != nullptr) {
+            data = pixels.get();
+            return;
+        }
+
+        if (is_stb_image) {
+            stbi_uc* const image = stbi_load_from_memory(file.data, static_cast<int>(file.size), &width, &height, &channels, stb_components);
+            if (image != nullptr && stb_components == 1) {
+                data = image;
+            } else if (image != nullptr) {
+                pixels = extract_channel(image, pixel_count, channel);
+                data = pixels.get();
+                stbi_image_free(image);
+            }
+        }
+    }
+
+    int width = 0;
+    int height = 0;
+    int channels = 0;
+
+    // Interleaved components per pixel of `data` or `data16`, 4 unless a single channel is kept.
+    int components = 4;
+
+    stbi_uc* data = nullptr;
+    stbi_us* data16 = nullptr;
+
+    // Owns `data` when it's decoded by the built-in PNG, QOI or DDS decoders rather than stb_image, or when it's a
+    // channel copied out of an RGBA image.
+    std::unique_ptr<stbi_uc[]> pixels;
+
+    // Owns `data16` when it's a channel copied out of an RGBA image.
+    std::unique_ptr<stbi_us[]> pixels16;
+
+    // Set when `data` or `data16` is the image of `compile_image`, which is owned by the caller.
+    bool is_borrowed = false;
+
+    // Owns `data` or `data16` when the image is read from the cache by `load_decoded_source`.
+    std::vector<char> source_entry;
+};
+
+// Rows [`row_begin`, `row_begin` + `row_count`) of the image of RGBA or single component pixels, which wrap around its
+// top and bottom edges. Rows inside the image are returned in place, the rest are gathered into the storage.
+template <typename PixelType>
+static const PixelType* get_image_rows(const PixelType* pixels, int width, int height, int row_begin, int row_count, std::vector<PixelType>& storage,
+                                       int components = 4) noexcept {
+    const size_t row_size = static_cast<size_t>(width) * static_cast<size_t>(components);
+    if (row_begin >= 0 && row_begin + row_count <= height) {
+        return pixels + static_cast<size_t>(row_begin) * row_size;
+    }
+
+    storage.resize(static_cast<size_t>(row_count) * row_size);
+    for (int row = 0; row < row_count; row++) {
+        const int source_row = ((row_begin + row) % height + height) % height;
+        std::copy_n(pixels + static_cast<size_t>(source_row) * row_size, row_size, storage.data() + static_cast<size_t>(row) * row_size);
+    }
+    return storage.data();
+}
+
+// Decodes 8-bit RGBA straight into the float planes of the surface. Passing the data as `InputFormat_BGRA_8UB` would
+// need a red and blue swap pass first and then nvtt's own conversion pass.
+static bool set_surface_rgba8(nvtt::Surface& surface, int width, int height, const stbi_uc* data) noexcept {
+    if (!surface.setImage(width, height, 1)) {
+        return false;
+    }
+
+    // Surface has just allocated its own storage, so writing to it doesn't affect any other surface.
+    float* red = const_cast<float*>(surface.channel(0));
+    float* green = const_cast<float*>(surface.channel(1));
+    float* blue = const_cast<float*>(surface.channel(2));
+    float* alpha = const_cast<float*>(surface.channel(3));
+
+    convert_rgba8_to_planes(data, static_cast<size_t>(width) * static_cast<size_t>(height), red, green, blue, alpha);
+    return true;
+}
+
+// Copies rows [`row_begin`, `row_begin` + `row_count`) of the surface into the destination surface.
+static bool copy_surface_rows(const nvtt::Surface& source, int row_begin, int row_count, nvtt::Surface& destination) noexcept {
+    const size_t offset = static_cast<size_t>(row_begin) * static_cast<size_t>(source.width());
+    if (!destination.setImage(nvtt::InputFormat_RGBA_32F, source.width(), row_count, 1, source.channel(0) + offset, source.channel(1) + offset, source.channel(2) + offset,
+                              source.channel(3) + offset)) {
+        return false;
+    }
+
+    destination.setWrapMode(source.wrapMode());
+    destination.setAlphaMode(source.alphaMode());
+    destination.setNormalMap(source.isNormalMap());
+    return true;
+}
+
+static MipWrap get_mip_wrap(nvtt::WrapMode wrap_mode) noexcept {
+    switch (wrap_mode) {
+        case nvtt::WrapMode_Clamp:
+            return MipWrap::CLAMP;
+        case nvtt::WrapMode_Repeat:
+            return MipWrap::REPEAT;
+        case nvtt::WrapMode_Mirror:
+            return MipWrap::MIRROR;
+    }
+    return MipWrap::REPEAT;
+}
+
+// Builds the next mip level of the surface into its own storage, so the surface itself stays intact and can be
+// compressed at the same time. When `halo_rows` is not zero, the surface is a band with that many extra rows above and
+// below it and only the band is downsampled, see `build_next_mip_level`. The next surface may be the surface itself.
+static bool build_next_mip_map(const JobContext& context, const MipFilterOptions& mip_filter, const nvtt::Surface& surface, int halo_rows, nvtt::Surface& next_surface) noexcept {
+    const int width = surface.width();
+    const int height = surface.height();
+
+    nvtt::Surface result;
+    if (!result.setImage(std::max(width / 2, 1), std::max((height - halo_rows * 2) / 2, 1), 1)) {
+        return false;
+    }
+
+    const float* const input[4] = { surface.channel(0), surface.channel(1), surface.channel(2), surface.channel(3) };
+
+    // Result has just allocated its own storage, so writing to it doesn't affect any other surface.
+    float* const output[4] = { const_cast<float*>(result.channel(0)), const_cast<float*>(result.channel(1)), const_cast<float*>(result.channel(2)),
+                               const_cast<float*>(result.channel(3)) };
+
+    MipFilterOptions options = mip_filter;
+    options.wrap = get_mip_wrap(surface.wrapMode());
+    build_next_mip_level(input, static_cast<size_t>(width), static_cast<size_t>(height), static_cast<size_t>(halo_rows), options, context.pool, output);
+
+    result.setWrapMode(surface.wrapMode());
+    result.setAlphaMode(surface.alphaMode());
+    result.setNormalMap(surface.isNormalMap());
+
+    next_surface = result;
+    return true;
+}
+
+// Mip filter of the job. Only albedo is sRGB encoded, roughness in its alpha channel and the other textures are not.
+// Parallax height maps are a single channel.
+static MipFilterOptions get_mip_filter_options(const CompileJob& job) noexcept {
+    MipFilterOptions options;
+    options.filter = job.mip_filter;
+    options.is_srgb = job.is_linear_mip_filtering && job.kind == TextureKind::ALBEDO_ROUGHNESS;
+    options.is_alpha_roughness = job.is_roughness_mip_filtering && job.kind == TextureKind::ALBEDO_ROUGHNESS;
+    options.channel_count = job.kind == TextureKind::PARALLAX ? 1 : 4;
+    return options;
+}
+
+// Level 0 of 2D textures with more pixels than this is compiled in bands of rows even without `--streaming`.
+static constexpr size_t STREAMING_PIXEL_COUNT = 4096 * 4096;
+
+// Maximum size in bytes of the float surface of a single band.
+static constexpr size_t STREAMING_BAND_SIZE = 16 * 1024 * 1024;
+
+// Whether level 0 of a normal map is compiled in bands, albedo roughness and parallax textures always are. Images with
+// an odd number of rows are never streamed, because their bands don't downsample to whole rows of the next mip level.
+static bool is_streaming(const CompileJob& job, int width, int height) noexcept {
+    if (height > 1 && height % 2 != 0) {
+        return false;
+    }
+    return job.is_streaming || static_cast<size_t>(width) * static_cast<size_t>(height) > STREAMING_PIXEL_COUNT;
+}
+
+// Bands consist of whole rows of blocks. The band height is a power of two and the image height is even, so every band
+// but the last one is as tall as the others and every band is downsampled to whole rows of the next mip level.
+static int get_band_rows(int width, int height) noexcept {
+    size_t rows = 4;
+    while (rows * 2 * static_cast<size_t>(width) * 4 * sizeof(float) <= STREAMING_BAND_SIZE) {
+        rows *= 2;
+    }
+    return static_cast<int>(std::min(rows, static_cast<size_t>(height)));
+}
+
+// Same as `nvtt::Surface::countMipmaps` of a surface of the specified size.
+static int count_mip_levels(int width, int height) noexcept {
+    int result = 1;
+    while (width > 1 || height > 1) {
+        width = std::max(width / 2, 1);
+        height = std::max(height / 2, 1);
+        result++;
+    }
+    return result;
+}
+
+// Mip levels of the image that are filtered for a 2D job, up to the last output level. `--mips` and `--min-mip-size`
+// end the chain early, but always keep the first output level.
+static int get_total_mip_levels(const CompileJob& job, int width, int height) noexcept {
+    const int first_mip_level = get_first_output_mip_level(job, width, height);
+    int result = count_mip_levels(width, height);
+    if (job.mip_count != 0) {
+        result = std::min(result, first_mip_level + static_cast<int>(std::min<size_t>(job.mip_count, INT_MAX / 2)));
+    }
+    while (result - 1 > first_mip_level && static_cast<size_t>(std::min(std::max(width >> (result - 1), 1), std::max(height >> (result - 1), 1))) < job.min_mip_size) {
+        result--;
+    }
+    return result;
+}
+
+// Copies all the rows of the downsampled band to the destination surface starting at the specified row.
+static void copy_band(const nvtt::Surface& band, nvtt::Surface& destination, int row) noexcept {
+    const size_t offset = static_cast<size_t>(row) * static_cast<size_t>(destination.width());
+    const size_t pixel_count = static_cast<size_t>(band.width()) * static_cast<size_t>(band.height());
+    for (int channel = 0; channel < 4; channel++) {
+        // Destination has its own storage, because it's allocated with `setImage` and never copied.
+        std::copy_n(band.channel(channel), pixel_count, const_cast<float*>(destination.channel(channel)) + offset);
+    }
+}
+
+// Fills the band with rows [`row_begin`, `row_begin` + `row_count`) of level 0, ready for compression. Rows past the top
+// and the bottom edges wrap around the image.
+using SetBandFunction = std::function<bool(int row_begin, int row_count, nvtt::Surface& band)>;
+
+// Makes the band that is compressed for rows [`row_begin`, `row_begin` + `band.height()`) of a mip level out of the
+// band of the mip chain. The mip chain itself stays intact, so the next level is still built from the unprepared band.
+using PrepareLevelFunction = std::function<bool(const nvtt::Surface& band, int mip_level, int row_begin, nvtt::Surface& prepared)>;
+
+// Mip level of up to four 16-bit unorm planes, half the memory of the float planes of an nvtt surface. Levels below
+// level 0 are kept like this from the time they're built until they're compressed, and only their bands are ever
+// expanded to floats. Steps of 1 / 65535 are far below the precision of every output format, and 16-bit parallax
+// height maps are stored exactly. Levels of mip chains that filter fewer channels have no planes for the others.
+struct Unorm16Level final {
+    bool set_size(int level_width, int level_height, size_t channel_count) noexcept {
+        try {
+            for (size_t channel = 0; channel < 4; channel++) {
+                planes[channel].resize(channel < channel_count ? static_cast<size_t>(level_width) * static_cast<size_t>(level_height) : 0);
+            }
+        } catch (...) {
+            return false;
+        }
+        width = level_width;
+        height = level_height;
+        return true;
+    }
+
+    int width = 0;
+    int height = 0;
+    std::vector<uint16_t> planes[4];
+};
+
+// Fills the channels of the band a mip chain doesn't filter, zero color and opaque alpha, so they're never
+// uninitialized when the band is compressed.
+static void clear_unfiltered_channels(nvtt::Surface& band, size_t channel_count) noexcept {
+    const size_t pixel_count = static_cast<size_t>(band.width()) * static_cast<size_t>(band.height());
+    for (size_t channel = channel_count; channel < 4; channel++) {
+        // Band has its own storage, because it's allocated with `setImage` and never copied.
+        std::fill_n(const_cast<float*>(band.channel(static_cast<int>(channel))), pixel_count, channel < 3 ? 0.f : 1.f);
+    }
+}
+
+// Expands rows [`row_begin`, `row_begin` + `row_count`) of the level into the band. Rows past the top and the bottom
+// edges wrap around the level.
+static bool set_unorm16_band(const Unorm16Level& level, int row_begin, int row_count, nvtt::Surface& band) noexcept {
+    if (!band.setImage(level.width, row_count, 1)) {
+        return false;
+    }
+
+    const size_t width = static_cast<size_t>(level.width);
+    size_t channel_count = 0;
+    for (; channel_count < 4 && !level.planes[channel_count].empty(); channel_count++) {
+        // Band has just allocated its own storage, so writing to it doesn't affect any other surface.
+        float* const plane = const_cast<float*>(band.channel(static_cast<int>(channel_count)));
+        for (int row = 0; row < row_count; row++) {
+            const int source_row = ((row_begin + row) % level.height + level.height) % level.height;
+            convert_unorm16_to_plane(level.planes[channel_count].data() + static_cast<size_t>(source_row) * width, width, plane + static_cast<size_t>(row) * width);
+        }
+    }
+    clear_unfiltered_channels(band, channel_count);
+    return true;
+}
+
+// Quantizes all the rows of the downsampled band into the level starting at the specified row.
+static void copy_band_to_unorm16(const nvtt::Surface& band, Unorm16Level& level, int row) noexcept {
+    const size_t offset = static_cast<size_t>(row) * static_cast<size_t>(level.width);
+    const size_t pixel_count = static_cast<size_t>(band.width()) * static_cast<size_t>(band.height());
+    for (int channel = 0; channel < 4 && !level.planes[channel].empty(); channel++) {
+        convert_plane_to_unorm16(band.channel(channel), pixel_count, level.planes[channel].data() + offset);
+    }
+}
+
+// Mip chain of `build_gpu_mip_chains`. Level 0 is read through `set_band`, and `levels` get the levels below it.
+struct GpuMipChain final {
+    SetBandFunction set_band;
+    MipFilterOptions options;
+    std::vector<nvtt::Surface> levels;
+};
+
+// Largest side of the level 0 of chains built on the GPU. Level 0 is uploaded as RGBA32F, so a 4096 level takes 256
+// megabytes in memory and on the GPU, and larger textures are streaming jobs anyway.
+static constexpr int MAX_GPU_MIP_CHAIN_SIZE = 4096;
+
+// The mip shader only implements the box filter of levels whose sides are even or one, which `build_next_mip_level`
+// builds from whole 2x2 quads. Odd sides and the windowed filters are left to the CPU.
+static bool is_gpu_mip_chain(const JobContext& context, const MipFilterOptions& mip_filter, int width, int height, int total_mip_levels) noexcept {
+    if (context.renderer == nullptr || mip_filter.filter != MipFilter::BOX || total_mip_levels < 2 || width > MAX_GPU_MIP_CHAIN_SIZE || height > MAX_GPU_MIP_CHAIN_SIZE) {
+        return false;
+    }
+    for (int mip_level = 0; mip_level + 1 < total_mip_levels; mip_level++) {
+        if ((width > 1 && width % 2 != 0) || (height > 1 && height % 2 != 0)) {
+            return false;
+        }
+        width = std::max(width / 2, 1);
+        height = std::max(height / 2, 1);
+    }
+    return true;
+}
+
+// Builds levels 1 to `total_mip_levels - 1` of every chain on the GPU. Level 0 of every chain is uploaded once, every
+// level is downsampled from the one above it by the mip shader in a single view, and all the levels of all the chains
+// are read back in one batch, so the job waits for the GPU once. Returns false when anything fails, the caller then
+// builds the levels on the CPU.
+static bool build_gpu_mip_chains(const JobContext& context, int width, int height, int total_mip_levels, std::vector<GpuMipChain>& chains) noexcept;
+
+// Compresses all the mip levels of an image into every output band by band, so no level ever exists as a whole float
+// surface. Level 0 bands are filled by `set_band`, which also sets the wrap mode, the alpha mode and the normal map flag
+// of every level. Every band is downsampled right away into the next level, which is kept as a `Unorm16Level` until
+// its own bands are expanded and compressed in turn. Bands are compressed to the same blocks as whole levels would be,
+// because blocks are compressed independently and never cross a band. Windowed mip filters need rows of the
+// neighboring bands, so such bands are cut out of taller bands with halo rows, which are downsampled to the same rows
+// as the whole level would be. Levels with an odd number of rows don't downsample to whole rows of the next level
+// band by band, so they're a single band. When the thread pool has workers, every band is downsampled while it's being
+// compressed. Every band of the outputs is passed through `prepare_level` first, unless it's empty. Levels of mip
+// filters of fewer than four channels only keep those, the other channels of their bands are cleared. Chains the GPU
+// can build, see `is_gpu_mip_chain`, are built up front instead, and bands of lower levels are copied from them.
+static int compress_mip_maps(const JobContext& context, int width, int height, int total_mip_levels, const SetBandFunction& set_band, const MipFilterOptions& mip_filter,
+                             const PrepareLevelFunction& prepare_level, const TextureOutputs& outputs) noexcept {
+    const bool is_pipelined = context.pool.worker_count() != 0;
+    const int filter_halo_rows = static_cast<int>(get_mip_filter_halo_rows(mip_filter.filter));
+
+    std::vector<GpuMipChain> gpu_chains;
+    if (is_gpu_mip_chain(context, mip_filter, width, height, total_mip_levels)) {
+        gpu_chains.push_back(GpuMipChain { set_band, mip_filter, {} });
+        if (!build_gpu_mip_chains(context, width, height, total_mip_levels, gpu_chains)) {
+            context.log << "\rTexture compiler warning. Failed to build mip levels on the GPU, building them on the CPU." << std::endl;
+            gpu_chains.clear();
+        }
+    }
+    const bool is_gpu_built = !gpu_chains.empty();
+
+    Unorm16Level level;
+    Unorm16Level next_level;
+    nvtt::WrapMode wrap_mode = nvtt::WrapMode_Repeat;
+    nvtt::AlphaMode alpha_mode = nvtt::AlphaMode_None;
+    bool is_normal_map = false;
+
+    // Level 0 bands come from the caller, the bands of lower levels from the level built by the level above them.
+    int mip_level = 0;
+    const auto set_level_band = [&](int row_begin, int row_count, nvtt::Surface& band) {
+        if (mip_level == 0) {
+            return set_band(row_begin, row_count, band);
+        }
+        if (is_gpu_built) {
+            // Levels of the GPU have the modes of level 0 already.
+            if (!copy_surface_rows(gpu_chains.front().levels[static_cast<size_t>(mip_level) - 1], row_begin, row_count, band)) {
+                return false;
+            }
+            clear_unfiltered_channels(band, mip_filter.channel_count);
+            return true;
+        }
+        if (!set_unorm16_band(level, row_begin, row_count, band)) {
+            return false;
+        }
+
+        band.setWrapMode(wrap_mode);
+        band.setAlphaMode(alpha_mode);
+        band.setNormalMap(is_normal_map);
+        return true;
+    };
+
+    nvtt::Surface band;
+    nvtt::Surface halo_band;
+    nvtt::Surface next_band;
+    nvtt::Surface prepared;
+    for (; mip_level < total_mip_levels; mip_level++) {
+        const bool is_last = mip_level + 1 == total_mip_levels;
+        const bool is_output = is_output_mip_level(outputs, mip_level);
+        const int band_rows = height > 1 && height % 2 != 0 ? height : get_band_rows(width, height);
+        const int halo_rows = !is_last && band_rows < height ? filter_halo_rows : 0;
+        const bool is_next_filtered = !is_last && !is_gpu_built;
+
+        if (is_next_filtered && !next_level.set_size(std::max(width / 2, 1), std::max(height / 2, 1), mip_filter.channel_count)) {
+            context.log << "\rTexture compiler error. Failed to set an image." << std::endl;
+            return 1;
+        }
+
+        PhaseTimer encode_timer(context.metrics, "encode", mip_level);
+        for (int row_begin = 0; row_begin < height; row_begin += band_rows) {
+            const int row_count = std::min(band_rows, height - row_begin);
+            const bool is_band_set = halo_rows == 0 ? set_level_band(row_begin, row_count, band)
+                                                    : set_level_band(row_begin - halo_rows, row_count + halo_rows * 2, halo_band) && copy_surface_rows(halo_band, halo_rows, row_count, band);
+            if (!is_band_set) {
+                context.log << "\rTexture compiler error. Failed to set an image." << std::endl;
+                return 1;
+            }
+            if (mip_level == 0) {
+                wrap_mode = band.wrapMode();
+                alpha_mode = band.alphaMode();
+                is_normal_map = band.isNormalMap();
+            }
+
+            // Filter only reads the band, so it's safe to compress it at the same time.
+            bool is_next_built = true;
+            const auto build_next_band = [&context, &mip_filter, &band, &halo_band, &next_band, &is_next_built, halo_rows, mip_level = mip_level] {
+                PhaseTimer filter_timer(context.metrics, "filter", mip_level + 1);
+                is_next_built = build_next_mip_map(context, mip_filter, halo_rows == 0 ? band : halo_band, halo_rows, next_band);
+            };
+            TaskGroup group;
+            if (is_next_filtered && is_pipelined) {
+                context.pool.push(group, build_next_band);
+            } else if (is_next_filtered) {
+                build_next_band();
+            }
+
+            bool is_prepared = true;
+            bool is_compressed = true;
+            if (is_output) {
+                if (prepare_level) {
+                    PhaseTimer prepare_timer(context.metrics, "prepare", mip_level);
+                    is_prepared = prepare_level(band, mip_level, row_begin, prepared);
+                }
+                is_compressed = is_prepared && compress_outputs(context, prepare_level ? prepared : band, mip_level, outputs);
+            }
+
+            // The task references local variables, so it must be finished even if compression failed.
+            context.pool.wait(group);
+
+            if (!is_prepared) {
+                context.log << "\rTexture compiler error. Failed to prepare a mip map." << std::endl;
+                return 1;
+            }
+
+            if (!is_compressed) {
+                // Error is printed via `error_handler`.
+                return 1;
+            }
+
+            if (!is_next_built) {
+                context.log << "\rTexture compiler error. Failed to build a mip map." << std::endl;
+                return 1;
+            }
+
+            if (is_next_filtered) {
+                copy_band_to_unorm16(next_band, next_level, row_begin / 2);
+            }
+        }
+        encode_timer.stop();
+
+        if (is_next_filtered) {
+            std::swap(level, next_level);
+            width = level.width;
+            height = level.height;
+        } else if (!is_last) {
+            width = std::max(width / 2, 1);
+            height = std::max(height / 2, 1);
+        }
+
+        report_progress(context, "\r", static_cast<int>(static_cast<float>(mip_level + 1) * 100.f / total_mip_levels));
+    }
+
+    return 0;
+}
+
+// Fills the band with `row_count` rows of RGBA8 pixels of a mip level, ready for compression.
+using SetRgba8BandFunction = std::function<bool(const stbi_uc* rgba, int width, int row_count, nvtt::Surface& band)>;
+
+// Compresses all the mip levels of the RGBA8 image into every output. Levels below level 0 are built by
+// `build_next_rgba8_mip_level` and every level is converted to float surfaces band by band right before compression,
+// so no level ever exists as a whole float surface. The next level is built while the current one is being compressed.
+static int compress_rgba8_mip_maps(const JobContext& context, const stbi_uc* rgba, int width, int height, int total_mip_levels, bool is_srgb,
+                                   const SetRgba8BandFunction& set_band, const TextureOutputs& outputs) noexcept {
+    std::vector<stbi_uc> level;
+    std::vector<stbi_uc> next_level;
+    const stbi_uc* current = rgba;
+
+    nvtt::Surface band;
+    for (int mip_level = 0; mip_level < total_mip_levels; mip_level++) {
+        const bool is_last = mip_level + 1 == total_mip_levels;
+        const int next_width = std::max(width / 2, 1);
+        const int next_height = std::max(height / 2, 1);
+
+        // Filter only reads the current level, so it's safe to compress it at the same time.
+        TaskGroup group;
+        if (!is_last) {
+            next_level.resize(static_cast<size_t>(next_width) * static_cast<size_t>(next_height) * 4);
+            context.pool.push(group, [&context, &next_level, current, width, height, is_srgb, mip_level] {
+                PhaseTimer filter_timer(context.metrics, "filter", mip_level + 1);
+                build_next_rgba8_mip_level(current, static_cast<size_t>(width), static_cast<size_t>(height), is_srgb, context.pool, next_level.data());
+            });
+        }
+
+        PhaseTimer encode_timer(context.metrics, "encode", mip_level);
+        const int band_rows = get_band_rows(width, height);
+        bool is_compressed = true;
+        for (int row_begin = 0; row_begin < height && is_compressed && is_output_mip_level(outputs, mip_level); row_begin += band_rows) {
+            const int row_count = std::min(band_rows, height - row_begin);
+            if (!set_band(current + static_cast<size_t>(row_begin) * static_cast<size_t>(width) * 4, width, row_count, band)) {
+                // The task references local variables, so it must be finished before returning.
+                context.pool.wait(group);
+                context.log << "\rTexture compiler error. Failed to set an image." << std::endl;
+                return 1;
+            }
+            is_compressed = compress_outputs(context, band, mip_level, outputs);
+        }
+        encode_timer.stop();
+
+        // The task references local variables, so it must be finished even if compression failed.
+        context.pool.wait(group);
+
+        if (!is_compressed) {
+            // Error is printed via `error_handler`.
+            return 1;
+        }
+
+        if (!is_last) {
+            level.swap(next_level);
+            current = level.data();
+            width = next_width;
+            height = next_height;
+        }
+
+        report_progress(context, "\r", static_cast<int>(static_cast<float>(mip_level + 1) * 100.f / total_mip_levels));
+    }
+
+    return 0;
+}
+
+// Albedo roughness and normal metalness ambient occlusion textures are compressed to the same formats.
+static void set_compression_options(nvtt::CompressionOptions& compression_options, const CompileJob& job) noexcept {
+    // Normal and the mask of `--mask-output` keep two channels each.
+    if (!job.mask_output.empty() && job.compression != Compression::NO_COMPRESSION) {
+        compression_options.setFormat(nvtt::Format_BC5);
+        compression_options.setQuality(job.quality);
+        return;
+    }
+
+    switch (job.compression) {
+        case Compression::GOOD_BUT_SLOW:
+            compression_options.setFormat(is_fast_bc7(job) || is_mobile_target(job) ? nvtt::Format_RGBA : nvtt::Format_BC7);
+            break;
+        case Compression::POOR_BUT_FAST:
+            compression_options.setFormat(is_mobile_target(job) ? nvtt::Format_RGBA : nvtt::Format_BC3);
+            break;
+        case Compression::NO_COMPRESSION:
+            compression_options.setFormat(nvtt::Format_RGBA);
+            break;
+    }
+    compression_options.setQuality(job.quality);
+}
+
+// Lengths of the averaged normals of the roughness normal map of the job for every mip level below level 0, empty
+// when the job has no roughness normal map.
+static int load_roughness_normal_lengths(const JobContext& context, const CompileJob& job, int width, int height, std::vector<std::vector<float>>& lengths) noexcept {
+    if (job.roughness_normal_map.empty()) {
+        return 0;
+    }
+
+    PhaseTimer decode_timer(context.metrics, "decode_roughness_normal_map");
+    RgbaWrapper data(job.roughness_normal_map);
+    decode_timer.stop();
+
+    if (data.data == nullptr) {
+        context.log << "\rTexture compiler error. Failed to load a roughness normal map." << std::endl;
+        return 1;
+    }
+
+    if (data.width != width || data.height != height) {
+        context.log << "\rTexture compiler error. Roughness normal map size doesn't match the texture size." << std::endl;
+        return 1;
+    }
+
+    PhaseTimer variance_timer(context.metrics, "normal_variance");
+    lengths = compute_normal_lengths(data.data, static_cast<size_t>(width), static_cast<size_t>(height), context.pool);
+    return 0;
+}
+
+// Rows of the input packed by a single task.
+static constexpr int CHANNEL_PACK_ROWS = 256;
+
+// Writes the red channel of every decoded channel input into its channel of the decoded input. Rows are split between
+// the tasks of the thread pool.
+static int pack_channel_inputs(const JobContext& context, const CompileJob& job, const std::vector<std::unique_ptr<RgbaWrapper>>& images,
+                               const RgbaWrapper& data) noexcept {
+    for (const std::unique_ptr<RgbaWrapper>& image : images) {
+        if (image == nullptr || image->data == nullptr) {
+            context.log << "Texture compiler error. Failed to load a channel input." << std::endl;
+            return 1;
+        }
+
+        if (image->width != data.width || image->height != data.height) {
+            context.log << "Texture compiler error. Channel input size doesn't match the input size." << std::endl;
+            return 1;
+        }
+    }
+
+    PhaseTimer pack_timer(context.metrics, "pack_channels");
+
+    TaskGroup group;
+    for (int row_begin = 0; row_begin < data.height; row_begin += CHANNEL_PACK_ROWS) {
+        const int row_end = std::min(row_begin + CHANNEL_PACK_ROWS, data.height);
+        context.pool.push(group, [&job, &images, &data, row_begin, row_end] {
+            const size_t pixel_begin = static_cast<size_t>(row_begin) * static_cast<size_t>(data.width);
+            const size_t pixel_end = static_cast<size_t>(row_end) * static_cast<size_t>(data.width);
+            for (size_t i = 0; i < images.size(); i++) {
+                const size_t channel = job.channel_inputs[i].channel;
+                const stbi_uc* source = images[i]->data;
+                for (size_t pixel = pixel_begin; pixel < pixel_end; pixel++) {
+                    data.data[pixel * 4 + channel] = source[pixel * 4];
+                }
+            }
+        });
+    }
+    context.pool.wait(group);
+
+    return 0;
+}
+
+// Parallax textures are compiled from the blue channel of their input, which holds the height in every channel of grey
+// height maps.
+static constexpr int PARALLAX_CHANNEL = 2;
+
+// What sets the 2D texture kinds apart. Everything else, decoding the input, its layers and channel inputs, opening and
+// finishing the outputs, is shared by `compile_2d_texture`, so a new kind only describes its input and its mip chain.
+struct TexturePolicy final {
+    // Channel of the input the kind keeps through decode and mip filtering, or -1 for all four.
+    int channel;
+
+    // 16-bit inputs keep their precision, other kinds decode them to 8-bit.
+    bool is_16_bit_allowed;
+
+    void (*set_compression_options)(nvtt::CompressionOptions& compression_options, const CompileJob& job) noexcept;
+
+    // Compresses all the mip levels of a decoded layer into every output.
+    int (*compress_layer)(const JobContext& context, const CompileJob& job, const RgbaWrapper& data, const TextureOutputs& outputs) noexcept;
+};
+
+// Records what `--auto-format` found in the image and the output it picked in the metrics of the job.
+static void record_auto_format(JobMetrics* metrics, const ContentAnalysis& analysis) noexcept {
+    if (metrics == nullptr) {
+        return;
+    }
+
+    try {
+        // Previews of `--progressive` analyze the same image again.
+        metrics->content.clear();
+
+        static const char* const CONSTANT_NAMES[4] = { "constant_red", "constant_green", "constant_blue", "constant_alpha" };
+        for (size_t channel = 0; channel < 4; channel++) {
+            if (analysis.is_constant[channel]) {
+                metrics->content.push_back(CONSTANT_NAMES[channel]);
+            }
+        }
+        if (analysis.is_opaque) {
+            metrics->content.push_back("opaque");
+        } else if (analysis.is_one_bit_alpha) {
+            metrics->content.push_back("one_bit_alpha");
+        }
+        if (analysis.is_grayscale) {
+            metrics->content.push_back("grayscale");
+        }
+
+        metrics->auto_format = analysis.is_opaque ? "bc1" : "unchanged";
+        if (is_flat(analysis)) {
+            metrics->auto_format += "_1x1";
+        }
+    } catch (...) {
+        // Losing the analysis is better than losing the job.
+    }
+}
+
+// Decoded sources are stored as this header followed by the pixels of `data` or `data16` as they are in memory, so a
+// hit is a single read of the file straight into the buffer the layer is compressed from.
+struct DecodedSourceHeader final {
+    uint32_t magic;
+    uint32_t width;
+    uint32_t height;
+    uint32_t channels;
+    uint32_t components;
+    uint32_t component_size;
+
+    // Keeps 16-bit pixels after the header aligned.
+    uint32_t reserved[2];
+};
+
+static constexpr uint32_t DECODED_SOURCE_MAGIC = 0x53444354; // "TCDS"
+
+// Content hash of the input at `path`, or the one `hashes` recorded for it when its stamp hasn't changed since, which
+// saves reading it. Null `hashes` always reads the input. Returns false when it can't be read.
+static bool hash_input_file(const std::string& path, InputHashes* hashes, Hash& hash) noexcept {
+    // Inputs are recorded by absolute path, so builds started from other directories share the hashes.
+    InputStamp stamp;
+    std::string name;
+    if (hashes != nullptr && get_input_stamp(path, stamp)) {
+        try {
+            const std::string file = get_input_file_path(path);
+            name = std::filesystem::absolute(file).lexically_normal().string() + path.substr(file.size());
+            if (hashes->find(name, stamp, hash)) {
+                return true;
+            }
+        } catch (...) {
+            name.clear();
+        }
+    }
+
+    const MappedFile file(path);
+    if (file.data == nullptr) {
+        return false;
+    }
+    hash = hash_content(file.data, file.size);
+
+    if (!name.empty()) {
+        try {
+            hashes->record(name, stamp, hash);
+        } catch (...) {
+            // The input is only hashed again next time.
+        }
+    }
+    return true;
+}
+
+// Adds the content hash of a file, which covers its size, to the hash. Returns false when it can't be read.
+static bool hash_file(const std::string& path, InputHashes* hashes, Hasher& hasher) noexcept {
+    Hash hash;
+    if (!hash_input_file(path, hashes, hash)) {
+        return false;
+    }
+    hasher.update(hash.low);
+    hasher.update(hash.high);
+    return true;
+}
+
+// Key of the decoded image of a layer: the content of the layer file, the content of the channel inputs packed into the
+// first layer and what the kind keeps of them, but none of the filtering and encoding options, which are what changes
+// between jobs that miss the cache with the same input. Returns false when a file can't be read, the layer is then
+// decoded as usual and fails there.
+static bool compute_decoded_source_key(const CompileJob& job, const TexturePolicy& policy, int layer, InputHashes* hashes, Hash& key) noexcept {
+    Hasher hasher;
+    hasher.update(std::string("decoded source"));
+    hasher.update(std::string(TEXTURE_COMPILER_VERSION));
+    hasher.update(static_cast<uint64_t>(policy.channel + 1));
+    hasher.update(static_cast<uint64_t>(policy.is_16_bit_allowed));
+    if (!hash_file(layer == 0 ? job.input : job.layers[static_cast<size_t>(layer) - 1], hashes, hasher)) {
+        return false;
+    }
+    if (layer == 0) {
+        for (const ChannelInput& channel_input : job.channel_inputs) {
+            hasher.update(static_cast<uint64_t>(channel_input.channel));
+            if (!hash_file(channel_input.path, hashes, hasher)) {
+                return false;
+            }
+        }
+    }
+    key = hasher.finish();
+    return true;
+}
+
+// Reads the decoded image of a layer stored by `store_decoded_source`. Returns false on a miss or a broken entry.
+static bool load_decoded_source(const JobContext& context, const Hash& key, RgbaWrapper& data) noexcept {
+    try {
+        std::vector<std::vector<char>> files;
+        if (!context.source_cache->load(key, 1, files, context.log, false)) {
+            return false;
+        }
+
+        std::vector<char>& entry = files.front();
+        DecodedSourceHeader header;
+        if (entry.size() < sizeof(header)) {
+            return false;
+        }
+        std::memcpy(&header, entry.data(), sizeof(header));
+
+        const bool is_16_bit = header.component_size == sizeof(stbi_us);
+        if (header.magic != DECODED_SOURCE_MAGIC || header.width == 0 || header.height == 0 || header.width > 65535 || header.height > 65535 ||
+            (header.components != 1 && header.components != 4) || (header.component_size != sizeof(stbi_uc) && !is_16_bit) ||
+            entry.size() != sizeof(header) + size_t { header.width } * header.height * header.components * header.component_size) {
+            context.log << "Texture compiler warning. Decoded source " << key.to_string() << " is malformed." << std::endl;
+            return false;
+        }
+
+        data.width = static_cast<int>(header.width);
+        data.height = static_cast<int>(header.height);
+        data.channels = static_cast<int>(header.channels);
+        data.components = static_cast<int>(header.components);
+        data.source_entry = std::move(entry);
+        if (is_16_bit) {
+            data.data16 = reinterpret_cast<stbi_us*>(data.source_entry.data() + sizeof(header));
+        } else {
+            data.data = reinterpret_cast<stbi_uc*>(data.source_entry.data() + sizeof(header));
+        }
+        return true;
+    } catch (const std::exception& exception) {
+        context.log << "Texture compiler warning. Failed to look up the decoded source: " << exception.what() << "." << std::endl;
+        return false;
+    }
+}
+
+// Stores the decoded image of a layer, channel inputs packed, in the local cache directory only, because the raw pixels
+// are several times larger than the file they're decoded from. Failure doesn't fail the job.
+static void store_decoded_source(const JobContext& context, const Hash& key, const RgbaWrapper& data) noexcept {
+    PhaseTimer store_timer(context.metrics, "source_store");
+
+    try {
+        DecodedSourceHeader header {};
+        header.magic = DECODED_SOURCE_MAGIC;
+        header.width = static_cast<uint32_t>(data.width);
+        header.height = static_cast<uint32_t>(data.height);
+        header.channels = static_cast<uint32_t>(data.channels);
+        header.components = static_cast<uint32_t>(data.components);
+        header.component_size = data.data16 != nullptr ? sizeof(stbi_us) : sizeof(stbi_uc);
+
+        const size_t size = size_t { header.width } * header.height * header.components * header.component_size;
+        const char* const pixels = data.data16 != nullptr ? reinterpret_cast<const char*>(data.data16) : reinterpret_cast<const char*>(data.data);
+
+        std::vector<std::vector<char>> files(1);
+        files.front().resize(sizeof(header) + size);
+        std::memcpy(files.front().data(), &header, sizeof(header));
+        std::memcpy(files.front().data() + sizeof(header), pixels, size);
+        context.source_cache->store(key, files, context.log, false);
+    } catch (const std::exception& exception) {
+        context.log << "Texture compiler warning. Failed to store the decoded source: " << exception.what() << "." << std::endl;
+    }
+}
+
+// Decodes the input and every `--layer` of a 2D texture job one after another and compresses them into the same outputs,
+// which are texture arrays when the job has layers. Blocks of every layer are compressed by the whole thread pool, so
+// layers don't need outputs of their own to keep every thread busy, and only one layer is decoded at a time.
+static constexpr uint32_t DDS_PITCH_FLAG = 0x8;
+static constexpr uint32_t BC7_DXGI_FORMAT = 98;
+
+// Header of a DDS texture of the levels of `dds` from `first_mip_level` on, `level_count` of them. Fields of `--mip-tail`
+// and `--checksums` are cleared, the output gets its own.
+static void set_derived_header(const std::vector<char>& dds, int first_mip_level, int level_count, size_t first_level_size, std::vector<char>& header) {
+    header.assign(dds.begin(), dds.begin() + DDS10_HEADER_SIZE);
+
+    uint32_t flags;
+    uint32_t height;
+    uint32_t width;
+    std::memcpy(&flags, header.data() + 8, sizeof(flags));
+    std::memcpy(&height, header.data() + 12, sizeof(height));
+    std::memcpy(&width, header.data() + 16, sizeof(width));
+    height = std::max(height >> first_mip_level, 1U);
+    width = std::max(width >> first_mip_level, 1U);
+
+    // Pitch of uncompressed formats, linear size of the first level of block compressed ones, which the built-in
+    // encoders leave zero.
+    uint32_t pitch_or_linear_size;
+    std::memcpy(&pitch_or_linear_size, header.data() + 20, sizeof(pitch_or_linear_size));
+    if (pitch_or_linear_size != 0) {
+        pitch_or_linear_size = static_cast<uint32_t>((flags & DDS_PITCH_FLAG) != 0 ? first_level_size / height : first_level_size);
+    }
+    const uint32_t mip_level_count = static_cast<uint32_t>(level_count);
+    std::memcpy(header.data() + 12, &height, sizeof(height));
+    std::memcpy(header.data() + 16, &width, sizeof(width));
+    std::memcpy(header.data() + 20, &pitch_or_linear_size, sizeof(pitch_or_linear_size));
+    std::memcpy(header.data() + 28, &mip_level_count, sizeof(mip_level_count));
+    if (is_mip_tail(header.data())) {
+        std::fill(header.begin() + 44, header.begin() + 60, '\0');
+    }
+    if (has_dds_checksums(header.data())) {
+        std::fill(header.begin() + 60, header.begin() + 76, '\0');
+    }
+}
+
+// Compiles a lower tier of a texture from the DDS output of an earlier compilation of a higher one in `input`, see
+// `--derive`. Its levels are the mip chain already, so nothing is filtered: levels above `--max-size` are dropped, and
+// when the output has the format of the input, the blocks of the levels it keeps are copied as they are. Otherwise
+// every level is decoded and compressed again on its own.
+static int compile_derived_texture(const JobContext& context, const CompileJob& job, const TexturePolicy& policy) noexcept {
+    PhaseTimer decode_timer(context.metrics, "decode");
+
+    std::vector<char> dds;
+    {
+        const MappedFile file(job.input);
+        if (job.input_image.pixels != nullptr || file.data == nullptr) {
+            context.log << "\rTexture compiler error. Failed to load a texture." << std::endl;
+            return 1;
+        }
+        try {
+            dds.assign(file.data, file.data + file.size);
+        } catch (const std::exception& exception) {
+            context.log << "\rTexture compiler error. Failed to load a texture: " << exception.what() << "." << std::endl;
+            return 1;
+        }
+    }
+
+    // Levels of `--layout` have padded rows, the others are copied as they are.
+    Dds10Header header;
+    if (!read_dds10_header(dds.data(), dds.size(), header) || header.dimension != DDS10_DIMENSION_TEXTURE_2D || header.is_cube_map() || is_gpu_layout(dds.data())) {
+        context.log << "\rTexture compiler error. Input of --derive must be a tightly packed 2D DDS texture with the DX10 header." << std::endl;
+        return 1;
+    }
+
+    std::vector<DdsSubresource> subresources;
+    try {
+        if (!get_dds_subresources(dds, subresources, context.log)) {
+            // Error is printed in `get_dds_subresources`.
+            return 1;
+        }
+    } catch (const std::exception& exception) {
+        context.log << "\rTexture compiler error. Failed to read the mip levels of a texture: " << exception.what() << "." << std::endl;
+        return 1;
+    }
+
+    const int height = static_cast<int>(header.height);
+    const int width = static_cast<int>(header.width);
+    const int level_count = static_cast<int>(header.level_count);
+    const int layer_count = static_cast<int>(subresources.size()) / level_count;
+    const uint32_t dxgi_format = header.dxgi_format;
+    decode_timer.stop();
+
+    // Inputs with a shorter chain than the output keep theirs.
+    const int total_mip_levels = std::min(get_total_mip_levels(job, width, height), level_count);
+    const int first_mip_level = get_first_output_mip_level(job, width, height);
+    if (first_mip_level >= total_mip_levels) {
+        context.log << "\rTexture compiler error. Input of --derive has no mip level that fits in --max-size." << std::endl;
+        return 1;
+    }
+
+    const auto before = std::chrono::steady_clock::now();
+
+    TextureOutputs outputs;
+    if (open_texture_outputs(context, job, width, height, layer_count, total_mip_levels, policy.set_compression_options, outputs) != 0) {
+        // Error is printed in `open_texture_outputs`.
+        return 1;
+    }
+
+    TextureOutput& front = *outputs.front();
+    uint32_t output_format = read_32(front.output.data, 128);
+    if (is_fast_bc7(front.job)) {
+        output_format = BC7_DXGI_FORMAT;
+    }
+
+    if (output_format == dxgi_format && !is_mobile_target(job)) {
+        // Blocks of the input are the ones the built-in BC7 encoder would have encoded.
+        front.job.encoder = Encoder::NVTT;
+
+        if (outputs.back()->is_reference) {
+            context.log << "\rTexture compiler warning. Quality of outputs with the blocks of their input is not measured." << std::endl;
+            outputs.pop_back();
+        }
+
+        try {
+            std::vector<char>& data = front.output.data;
+            set_derived_header(dds, first_mip_level, total_mip_levels - first_mip_level, subresources[static_cast<size_t>(first_mip_level)].size, data);
+            for (int layer = 0; layer < layer_count; layer++) {
+                for (int mip_level = first_mip_level; mip_level < total_mip_levels; mip_level++) {
+                    const DdsSubresource& subresource = subresources[static_cast<size_t>(layer * level_count + mip_level)];
+                    data.insert(data.end(), dds.begin() + static_cast<std::ptrdiff_t>(subresource.offset),
+                                dds.begin() + static_cast<std::ptrdiff_t>(subresource.offset + subresource.size));
+                }
+            }
+        } catch (const std::exception& exception) {
+            context.log << "\rTexture compiler error. Failed to copy the mip levels of a texture: " << exception.what() << "." << std::endl;
+            return 1;
+        }
+
+        context.log << "\rReused the blocks of " << total_mip_levels - first_mip_level << " mip levels of the input." << std::endl;
+    } else {
+        std::vector<uint8_t> rgba;
+        nvtt::Surface surface;
+        const int step_count = layer_count * (total_mip_levels - first_mip_level);
+        for (int layer = 0; layer < layer_count; layer++) {
+            for (int mip_level = first_mip_level; mip_level < total_mip_levels; mip_level++) {
+                const DdsSubresource& subresource = subresources[static_cast<size_t>(layer * level_count + mip_level)];
+                const int level_width = std::max(width >> mip_level, 1);
+                const int level_height = std::max(height >> mip_level, 1);
+
+                PhaseTimer level_timer(context.metrics, "decode", mip_level);
+                bool is_decoded;
+                try {
+                    is_decoded = decode_dds_level(dds.data() + subresource.offset, subresource.size, dxgi_format, static_cast<size_t>(level_width),
+                                                  static_cast<size_t>(level_height), rgba);
+                } catch (const std::exception& exception) {
+                    context.log << "\rTexture compiler error. Failed to decode a mip level: " << exception.what() << "." << std::endl;
+                    return 1;
+                }
+                if (!is_decoded) {
+                    context.log << "\rTexture compiler error. Format of the input of --derive is not supported." << std::endl;
+                    return 1;
+                }
+                if (!set_surface_rgba8(surface, level_width, level_height, rgba.data())) {
+                    context.log << "\rTexture compiler error. Failed to set an image." << std::endl;
+                    return 1;
+                }
+                level_timer.stop();
+
+                // Same modes as the surfaces the kinds compress, parallax keeps only its height.
+                if (job.kind == TextureKind::PARALLAX) {
+                    clear_unfiltered_channels(surface, 1);
+                }
+                surface.setWrapMode(nvtt::WrapMode_Repeat);
+                surface.setAlphaMode(job.kind == TextureKind::NORMAL_METALNESS_AMBIENT_OCCLUSION ? nvtt::AlphaMode_None : nvtt::AlphaMode_Transparency);
+                surface.setNormalMap(false);
+
+                if (!compress_outputs(context, surface, mip_level, outputs)) {
+                    // Error is printed in `compress_outputs`.
+                    return 1;
+                }
+                report_progress(context, "\r", (layer * (total_mip_levels - first_mip_level) + mip_level - first_mip_level + 1) * 100 / step_count);
+            }
+        }
+    }
+
+    if (finish_outputs(context, outputs) != 0) {
+        // Error is printed in `finish_outputs`.
+        return 1;
+    }
+
+    const auto after = std::chrono::steady_clock::now();
+    const auto milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(after - before);
+    context.log << "\rCompression took " << std::setprecision(3) << milliseconds.count() / 1000.f << " seconds." << std::endl;
+
+    return 0;
+}
+
+static int compile_2d_texture(const JobContext& context, const CompileJob& job, const TexturePolicy& policy) noexcept {
+    if (job.is_derived) {
+        return compile_derived_texture(context, job, policy);
+    }
+
+    const int layer_count = static_cast<int>(job.layers.size()) + 1;
+
+    int width = 0;
+    int height = 0;
+    TextureOutputs outputs;
+    auto before = std::chrono::steady_clock::now();
+
+    std::vector<std::unique_ptr<RgbaWrapper>> channel_images(job.channel_inputs.size());
+    TaskGroup channel_group;
+
+    for (int layer = 0; layer < layer_count; layer++) {
+        if (!check_job_control(context)) {
+            return 1;
+        }
+
+        // Decoded sources are looked up before anything is decoded, a hit has its channel inputs packed already.
+        Hash source_key;
+        bool is_source_cached = false;
+        if (context.source_cache != nullptr && (layer != 0 || job.input_image.pixels == nullptr)) {
+            PhaseTimer hash_timer(context.metrics, "source_hash");
+            is_source_cached = compute_decoded_source_key(job, policy, layer, context.source_cache->input_hashes.get(), source_key);
+        }
+
+        PhaseTimer decode_timer(context.metrics, "decode");
+        std::optional<RgbaWrapper> data;
+        bool is_source_hit = false;
+        if (is_source_cached) {
+            data.emplace();
+            is_source_hit = load_decoded_source(context, source_key, *data);
+            if (is_source_hit) {
+                context.log << "Decoded source cache hit " << source_key.to_string() << "." << std::endl;
+                channel_images.clear();
+            } else {
+                data.reset();
+            }
+        }
+
+        // Channel inputs are decoded on the thread pool while the input itself is decoded on this thread.
+        if (layer == 0) {
+            for (size_t i = 0; i < channel_images.size(); i++) {
+                context.pool.push(channel_group, [&job, &channel_images, i] {
+                    channel_images[i] = std::make_unique<RgbaWrapper>(job.channel_inputs[i].path);
+                });
+            }
+        }
+
+        if (!is_source_hit && layer == 0 && job.input_image.pixels != nullptr) {
+            data.emplace(job.input_image, policy.is_16_bit_allowed, policy.channel);
+        } else if (!is_source_hit) {
+            data.emplace(layer == 0 ? job.input : job.layers[static_cast<size_t>(layer) - 1], policy.is_16_bit_allowed, policy.channel);
+        }
+        if (layer == 0) {
+            // Tasks reference local variables, so they must be finished before anything returns.
+            context.pool.wait(channel_group);
+        }
+        decode_timer.stop();
+
+        if (data->data == nullptr && data->data16 == nullptr) {
+            context.log << "\rTexture compiler error. Failed to load a texture." << std::endl;
+            return 1;
+        }
+
+        if (layer == 0) {
+            if (data->width <= 0 || data->height <= 0 || data->width > 65535 || data->height > 65535) {
+                context.log << "Texture compiler error. Image size is not supported." << std::endl;
+                return 1;
+            }
+
+            width = data->width;
+            height = data->height;
+
+            if (pack_channel_inputs(context, job, channel_images, *data) != 0) {
+                // Error is printed in `pack_channel_inputs`.
+                return 1;
+            }
+            channel_images.clear();
+
+            if (is_source_cached && !is_source_hit) {
+                store_decoded_source(context, source_key, *data);
+            }
+
+            // Textures with `--auto-format` are single layer albedo roughness textures, whose images are always 8-bit.
+            std::optional<ContentAnalysis> analysis;
+            if (job.is_auto_format && data->data != nullptr) {
+                PhaseTimer analyze_timer(context.metrics, "analyze");
+                analysis = analyze_content(data->data, static_cast<size_t>(width) * static_cast<size_t>(height));
+                analyze_timer.stop();
+
+                record_auto_format(context.metrics, *analysis);
+            }
+
+            if (open_texture_outputs(context, job, width, height, layer_count, get_total_mip_levels(job, width, height), policy.set_compression_options, outputs,
+                                     analysis.has_value() ? &*analysis : nullptr) != 0) {
+                // Error is printed in `open_texture_outputs`.
+                return 1;
+            }
+
+            before = std::chrono::steady_clock::now();
+        } else if (data->width != width || data->height != height) {
+            context.log << "\rTexture compiler error. Layers of a texture array must have the same size." << std::endl;
+            return 1;
+        } else if (is_source_cached && !is_source_hit) {
+            store_decoded_source(context, source_key, *data);
+        }
+
+        report_progress(context, layer == 0 ? "" : "\r", 0);
+
+        if (policy.compress_layer(context, job, *data, outputs) != 0) {
+            // Error is printed in `compress_layer`.
+            return 1;
+        }
+    }
+
+    if (finish_outputs(context, outputs) != 0) {
+        // Error is printed in `finish_outputs`.
+        return 1;
+    }
+
+    const auto after = std::chrono::steady_clock::now();
+    const auto milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(after - before);
+    context.log << "\rCompression took " << std::setprecision(3) << milliseconds.count() / 1000.f << " seconds." << std::endl;
+
+    return 0;
+}
+
+static int compress_albedo_roughness_layer(const JobContext& context, const CompileJob& job, const RgbaWrapper& data, const TextureOutputs& outputs) noexcept {
+    std::vector<std::vector<float>> normal_lengths;
+    if (load_roughness_normal_lengths(context, job, data.width, data.height, normal_lengths) != 0) {
+        // Error is printed in `load_roughness_normal_lengths`.
+        return 1;
+    }
+
+    // Roughness of the compressed levels is widened by the variance of the normals under their pixels, level 0 has
+    // nothing to widen.
+    PrepareLevelFunction prepare_level;
+    if (!normal_lengths.empty()) {
+        prepare_level = [&normal_lengths](const nvtt::Surface& band, int mip_level, int row_begin, nvtt::Surface& prepared) {
+            if (mip_level == 0) {
+                prepared = band;
+                return true;
+            }
+
+            if (!copy_surface_rows(band, 0, band.height(), prepared)) {
+                return false;
+            }
+
+            // Prepared band has just allocated its own storage, so writing to it doesn't affect the mip chain.
+            const std::vector<float>& lengths = normal_lengths[static_cast<size_t>(mip_level) - 1];
+            const size_t offset = static_cast<size_t>(row_begin) * static_cast<size_t>(band.width());
+            apply_toksvig(lengths.data() + offset, static_cast<size_t>(band.width()) * static_cast<size_t>(band.height()), const_cast<float*>(prepared.channel(3)));
+            return true;
+        };
+    }
+
+    // Neither mip chain ever converts the whole image at once, every band is converted right before compression.
+    const bool is_rgba8_job = is_rgba8_mip_chain(job, data.width, data.height);
+    const int total_mip_levels = get_total_mip_levels(job, data.width, data.height);
+
+    const SetRgba8BandFunction set_rgba8_band = [](const stbi_uc* rgba, int width, int row_count, nvtt::Surface& band) {
+        if (!set_surface_rgba8(band, width, row_count, rgba)) {
+            return false;
+        }
+
+        band.setWrapMode(nvtt::WrapMode_Repeat);
+        band.setAlphaMode(nvtt::AlphaMode_Transparency);
+        band.setNormalMap(false);
+        return true;
+    };
+
+    if (is_rgba8_job) {
+        if (compress_rgba8_mip_maps(context, data.data, data.width, data.height, total_mip_levels, get_mip_filter_options(job).is_srgb, set_rgba8_band, outputs) != 0) {
+            // Error is printed in `compress_rgba8_mip_maps`.
+            return 1;
+        }
+    } else {
+        std::vector<stbi_uc> band_storage;
+        const SetBandFunction set_band = [&data, &band_storage, &set_rgba8_band](int row_begin, int row_count, nvtt::Surface& band) {
+            return set_rgba8_band(get_image_rows(data.data, data.width, data.height, row_begin, row_count, band_storage), data.width, row_count, band);
+        };
+
+        if (compress_mip_maps(context, data.width, data.height, total_mip_levels, set_band, get_mip_filter_options(job), prepare_level, outputs) != 0) {
+            // Error is printed in `compress_mip_maps`.
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+// Converts rows [`row_begin`, `row_begin` + `row_count`) of the image into a normal surface and a surface with the
+// metalness and ambient occlusion in its blue and alpha channels. Rows past the top and the bottom edges wrap around the
+// image. Alpha mode of the freshly converted image is returned via `source_alpha_mode`.
+static bool set_normal_metalness_ambient_occlusion_surfaces(JobMetrics* metrics, const RgbaWrapper& data, int row_begin, int row_count, nvtt::Surface& normal,
+                                                            nvtt::Surface& metalness_ambient_occlusion, nvtt::AlphaMode& source_alpha_mode) noexcept {
+    PhaseTimer convert_timer(metrics, "convert");
+
+    std::vector<stbi_uc> storage;
+    nvtt::Surface surface;
+    if (!set_surface_rgba8(surface, data.width, row_count, get_image_rows(data.data, data.width, data.height, row_begin, row_count, storage))) {
+        return false;
+    }
+
+    convert_timer.stop();
+
+    const size_t pixel_count = static_cast<size_t>(data.width) * static_cast<size_t>(row_count);
+
+    PhaseTimer reconstruct_timer(metrics, "reconstruct");
+
+    // Normal surface is filled in place, so no temporary full size planes are allocated.
+    if (!normal.setImage(data.width, row_count, 1)) {
+        return false;
+    }
+
+    // Surface has just allocated its own storage, so writing to it doesn't affect any other surface.
+    float* red_normal_channel = const_cast<float*>(normal.channel(0));
+    float* green_normal_channel = const_cast<float*>(normal.channel(1));
+    float* blue_normal_channel = const_cast<float*>(normal.channel(2));
+    float* alpha_normal_channel = const_cast<float*>(normal.channel(3));
+
+    std::copy_n(surface.channel(0), pixel_count, red_normal_channel);
+    std::copy_n(surface.channel(1), pixel_count, green_normal_channel);
+
+    // Reconstruct blue normal map channel.
+    reconstruct_normal_z(red_normal_channel, green_normal_channel, blue_normal_channel, pixel_count);
+
+    // Opaque normal map.
+    std::fill_n(alpha_normal_channel, pixel_count, 1.f);
+
+    reconstruct_timer.stop();
+
+    normal.setWrapMode(nvtt::WrapMode_Repeat);
+    normal.setAlphaMode(nvtt::AlphaMode_Transparency);
+    normal.setNormalMap(true);
+
+    PhaseTimer split_timer(metrics, "split");
+
+    if (!metalness_ambient_occlusion.setImage(data.width, row_count, 1)) {
+        return false;
+    }
+
+    metalness_ambient_occlusion.copyChannel(surface, 2);
+    metalness_ambient_occlusion.copyChannel(surface, 3);
+
+    split_timer.stop();
+
+    metalness_ambient_occlusion.setWrapMode(nvtt::WrapMode_Repeat);
+    metalness_ambient_occlusion.setAlphaMode(nvtt::AlphaMode_Transparency);
+    metalness_ambient_occlusion.setNormalMap(false);
+
+    source_alpha_mode = surface.alphaMode();
+    return true;
+}
+
+// Replaces red and green channels of the packed surface with the normal map.
+static void pack_normal(const nvtt::Surface& normal, nvtt::Surface& packed) noexcept {
+    const size_t pixel_count = static_cast<size_t>(packed.width()) * static_cast<size_t>(packed.height());
+    std::copy_n(normal.channel(0), pixel_count, const_cast<float*>(packed.channel(0)));
+    std::copy_n(normal.channel(1), pixel_count, const_cast<float*>(packed.channel(1)));
+}
+
+// Normals are renormalized by the tasks of the mip filter right after they filter their rows, which gives the same
+// result as `expandNormals`, `normalizeNormalMap` and `packNormals` of the whole level without three more passes.
+static bool build_next_normal_mip_map(const JobContext& context, const MipFilterOptions& mip_filter, nvtt::Surface& normal, int halo_rows) noexcept {
+    MipFilterOptions options = mip_filter;
+    options.is_normal_map = true;
+    return build_next_mip_map(context, options, normal, halo_rows, normal);
+}
+
+// Compresses the packed surface, which is the specified mip level, and all the mip levels below it. Normal chain is
+// separate from the compressed surface, so its next mip level is built on the thread pool while the current one is
+// being compressed. Both chains are built on the GPU up front instead when it can, see `is_gpu_mip_chain`.
+static int compress_normal_mip_maps(const JobContext& context, nvtt::Surface& normal, nvtt::Surface& packed, nvtt::AlphaMode packed_alpha_mode, int first_mip_level,
+                                    int total_mip_levels, const MipFilterOptions& mip_filter, const TextureOutputs& outputs) noexcept {
+    std::vector<GpuMipChain> gpu_chains;
+    if (is_gpu_mip_chain(context, mip_filter, normal.width(), normal.height(), total_mip_levels - first_mip_level)) {
+        MipFilterOptions normal_options = mip_filter;
+        normal_options.is_normal_map = true;
+        const auto set_normal_band = [&normal](int row_begin, int row_count, nvtt::Surface& band) {
+            return copy_surface_rows(normal, row_begin, row_count, band);
+        };
+        const auto set_packed_band = [&packed](int row_begin, int row_count, nvtt::Surface& band) {
+            return copy_surface_rows(packed, row_begin, row_count, band);
+        };
+        gpu_chains.push_back(GpuMipChain { set_normal_band, normal_options, {} });
+        gpu_chains.push_back(GpuMipChain { set_packed_band, mip_filter, {} });
+        if (!build_gpu_mip_chains(context, normal.width(), normal.height(), total_mip_levels - first_mip_level, gpu_chains)) {
+            context.log << "\rTexture compiler warning. Failed to build mip levels on the GPU, building them on the CPU." << std::endl;
+            gpu_chains.clear();
+        }
+    }
+    const bool is_gpu_built = !gpu_chains.empty();
+
+    for (int mip_level = first_mip_level; mip_level < total_mip_levels; mip_level++) {
+        PhaseTimer pack_timer(context.metrics, "pack", mip_level);
+        pack_normal(normal, packed);
+        pack_timer.stop();
+
+        bool is_normal_built = true;
+
+        TaskGroup group;
+        if (mip_level + 1 < total_mip_levels && !is_gpu_built) {
+            context.pool.push(group, [&context, &mip_filter, &normal, &is_normal_built, mip_level] {
+                PhaseTimer filter_timer(context.metrics, "filter_normal", mip_level + 1);
+                is_normal_built = build_next_normal_mip_map(context, mip_filter, normal, 0);
+            });
+        }
+
+        packed.setAlphaMode(packed_alpha_mode);
+        PhaseTimer encode_timer(context.metrics, "encode", mip_level);
+        const bool is_compressed = compress_outputs(context, packed, mip_level, outputs);
+        encode_timer.stop();
+        packed.setAlphaMode(nvtt::AlphaMode_Transparency);
+
+        // The task references local variables, so it must be finished even if compression failed.
+        context.pool.wait(group);
+
+        if (!is_compressed) {
+            // Error is printed via `error_handler`.
+            return 1;
+        }
+
+        if (!is_normal_built) {
+            context.log << "\rTexture compiler error. Failed to build a normal mip map." << std::endl;
+            return 1;
+        }
+
+        if (mip_level + 1 < total_mip_levels && is_gpu_built) {
+            const size_t next = static_cast<size_t>(mip_level - first_mip_level);
+            normal = gpu_chains[0].levels[next];
+            packed = gpu_chains[1].levels[next];
+        }
+
+        PhaseTimer filter_timer(context.metrics, "filter_metalness_ambient_occlusion", mip_level + 1);
+        if (mip_level + 1 < total_mip_levels && !is_gpu_built && !build_next_mip_map(context, mip_filter, packed, 0, packed)) {
+            context.log << "\rTexture compiler error. Failed to build a metalness ambient occlusion mip map." << std::endl;
+            return 1;
+        }
+
+        report_progress(context, "\r", static_cast<int>(static_cast<float>(mip_level + 1) * 100.f / total_mip_levels));
+    }
+
+    return 0;
+}
+
+// Same as `compress_streaming_mip_maps`, but every band is split into a normal band and a metalness ambient occlusion
+// band, and both are downsampled into their own level 1 chains.
+static int compress_streaming_normal_mip_maps(const JobContext& context, const RgbaWrapper& data, int total_mip_levels, const MipFilterOptions& mip_filter,
+                                              const TextureOutputs& outputs) noexcept {
+    const int band_rows = get_band_rows(data.width, data.height);
+    const int halo_rows = total_mip_levels > 1 ? static_cast<int>(get_mip_filter_halo_rows(mip_filter.filter)) : 0;
+
+    PhaseTimer stream_timer(context.metrics, "stream", 0);
+
+    nvtt::Surface normal;
+    nvtt::Surface packed;
+    if (total_mip_levels > 1 && (!normal.setImage(std::max(data.width / 2, 1), std::max(data.height / 2, 1), 1) ||
+                                 !packed.setImage(std::max(data.width / 2, 1), std::max(data.height / 2, 1), 1))) {
+        context.log << "\rTexture compiler error. Failed to set an image." << std::endl;
+        return 1;
+    }
+
+    // Bands with halo rows are only downsampled, the rows of the band itself are compressed from a copy.
+    nvtt::Surface normal_band;
+    nvtt::Surface packed_band;
+    nvtt::Surface compressed_band;
+    nvtt::AlphaMode packed_alpha_mode = nvtt::AlphaMode_None;
+    for (int row_begin = 0; row_begin < data.height; row_begin += band_rows) {
+        const int row_count = std::min(band_rows, data.height - row_begin);
+        if (!set_normal_metalness_ambient_occlusion_surfaces(nullptr, data, row_begin - halo_rows, row_count + halo_rows * 2, normal_band, packed_band, packed_alpha_mode)) {
+            context.log << "\rTexture compiler error. Failed to set an image." << std::endl;
+            return 1;
+        }
+
+        pack_normal(normal_band, packed_band);
+
+        if (halo_rows != 0 && !copy_surface_rows(packed_band, halo_rows, row_count, compressed_band)) {
+            context.log << "\rTexture compiler error. Failed to set an image." << std::endl;
+            return 1;
+        }
+
+        nvtt::Surface& band = halo_rows == 0 ? packed_band : compressed_band;
+        band.setAlphaMode(packed_alpha_mode);
+        const bool is_compressed = compress_outputs(context, band, 0, outputs);
+        band.setAlphaMode(nvtt::AlphaMode_Transparency);
+
+        if (!is_compressed) {
+            // Error is printed via `error_handler`.
+            return 1;
+        }
+
+        if (total_mip_levels > 1) {
+            if (!build_next_normal_mip_map(context, mip_filter, normal_band, halo_rows)) {
+                context.log << "\rTexture compiler error. Failed to build a normal mip map." << std::endl;
+                return 1;
+            }
+
+            if (!build_next_mip_map(context, mip_filter, packed_band, halo_rows, packed_band)) {
+                context.log << "\rTexture compiler error. Failed to build a metalness ambient occlusion mip map." << std::endl;
+                return 1;
+            }
+
+            copy_band(normal_band, normal, row_begin / 2);
+            copy_band(packed_band, packed, row_begin / 2);
+        }
+    }
+
+    stream_timer.stop();
+
+    report_progress(context, "\r", static_cast<int>(100.f / total_mip_levels));
+
+    if (total_mip_levels == 1) {
+        return 0;
+    }
+
+    normal.setWrapMode(nvtt::WrapMode_Repeat);
+    normal.setAlphaMode(nvtt::AlphaMode_Transparency);
+    normal.setNormalMap(true);
+
+    packed.setWrapMode(nvtt::WrapMode_Repeat);
+    packed.setAlphaMode(nvtt::AlphaMode_Transparency);
+    packed.setNormalMap(false);
+
+    return compress_normal_mip_maps(context, normal, packed, packed_alpha_mode, 1, total_mip_levels, mip_filter, outputs);
+}
+
+static int compress_normal_metalness_ambient_occlusion_layer(const JobContext& context, const CompileJob& job, const RgbaWrapper& data, const TextureOutputs& outputs) noexcept {
+    const bool is_streaming_job = is_streaming(job, data.width, data.height);
+
+    // Metalness ambient occlusion chain doubles as the surface that is compressed. Its red and green channels are
+    // replaced with the normal map at every mip level, which doesn't affect filtering of the other channels.
+    // Compression used to get a freshly loaded surface, so its alpha mode is kept for compression. Streaming jobs
+    // build both chains band by band instead.
+    nvtt::Surface normal;
+    nvtt::Surface packed;
+    nvtt::AlphaMode packed_alpha_mode = nvtt::AlphaMode_None;
+    if (!is_streaming_job && !set_normal_metalness_ambient_occlusion_surfaces(context.metrics, data, 0, data.height, normal, packed, packed_alpha_mode)) {
+        context.log << "\rTexture compiler error. Failed to set an image." << std::endl;
+        return 1;
+    }
+
+    const int total_mip_levels = get_total_mip_levels(job, data.width, data.height);
+
+    if (is_streaming_job) {
+        if (compress_streaming_normal_mip_maps(context, data, total_mip_levels, get_mip_filter_options(job), outputs) != 0) {
+            // Error is printed in `compress_streaming_normal_mip_maps`.
+            return 1;
+        }
+    } else {
+        if (compress_normal_mip_maps(context, normal, packed, packed_alpha_mode, 0, total_mip_levels, get_mip_filter_options(job), outputs) != 0) {
+            // Error is printed in `compress_normal_mip_maps`.
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+static void set_parallax_compression_options(nvtt::CompressionOptions& compression_options, const CompileJob& job) noexcept {
+    if (job.is_r16 && job.compression == Compression::NO_COMPRESSION) {
+        // Levels of 16-bit height maps are 16-bit unorm from decode to output.
+        compression_options.setFormat(nvtt::Format_RGBA);
+        compression_options.setPixelFormat(16, 0xFFFF, 0x0000, 0x0000, 0x0000);
+    } else if (is_mobile_target(job) || job.compression == Compression::NO_COMPRESSION) {
+        compression_options.setFormat(nvtt::Format_RGBA);
+        compression_options.setPixelFormat(8, 0xFF, 0x00, 0x00, 0x00);
+    } else {
+        // BC4 is fast and good enough for both production and development.
+        compression_options.setFormat(nvtt::Format_BC4);
+    }
+    compression_options.setQuality(job.quality);
+}
+
+static int compress_parallax_layer(const JobContext& context, const CompileJob& job, const RgbaWrapper& data, const TextureOutputs& outputs) noexcept {
+    // Height is the only channel that is filtered and compressed, the other channels of the bands are cleared.
+    std::vector<stbi_uc> band_storage;
+    std::vector<stbi_us> band_storage16;
+    const SetBandFunction set_band = [&data, &band_storage, &band_storage16](int row_begin, int row_count, nvtt::Surface& band) {
+        if (!band.setImage(data.width, row_count, 1)) {
+            return false;
+        }
+
+        // Band has just allocated its own storage, so writing to it doesn't affect any other surface.
+        float* const height = const_cast<float*>(band.channel(0));
+        const size_t pixel_count = static_cast<size_t>(data.width) * static_cast<size_t>(row_count);
+        if (data.data16 != nullptr) {
+            convert_unorm16_to_plane(get_image_rows(data.data16, data.width, data.height, row_begin, row_count, band_storage16, 1), pixel_count, height);
+        } else {
+            convert_unorm8_to_plane(get_image_rows(data.data, data.width, data.height, row_begin, row_count, band_storage, 1), pixel_count, height);
+        }
+        clear_unfiltered_channels(band, 1);
+
+        band.setWrapMode(nvtt::WrapMode_Repeat);
+        band.setAlphaMode(nvtt::AlphaMode_Transparency);
+        band.setNormalMap(false);
+        return true;
+    };
+
+    if (compress_mip_maps(context, data.width, data.height, get_total_mip_levels(job, data.width, data.height), set_band, get_mip_filter_options(job), PrepareLevelFunction(),
+                          outputs) != 0) {
+        // Error is printed in `compress_mip_maps`.
+        return 1;
+    }
+    return 0;
+}
+
+// Albedo roughness and normal metalness ambient occlusion are 8-bit RGBA, parallax keeps the height of 8-bit and
+// 16-bit inputs.
+static constexpr TexturePolicy ALBEDO_ROUGHNESS_POLICY = { -1, false, set_compression_options, compress_albedo_roughness_layer };
+static constexpr TexturePolicy NORMAL_METALNESS_AMBIENT_OCCLUSION_POLICY = { -1, false, set_compression_options, compress_normal_metalness_ambient_occlusion_layer };
+static constexpr TexturePolicy PARALLAX_POLICY = { PARALLAX_CHANNEL, true, set_parallax_compression_options, compress_parallax_layer };
+
+struct SdlWrapper final {
+    SdlWrapper() noexcept
+            : initialized(SDL_Init(SDL_INIT_VIDEO) == 0) {
+    }
+
+    SdlWrapper(const SdlWrapper&) = delete;
+    SdlWrapper(SdlWrapper&&) = delete;
+    SdlWrapper& operator=(const SdlWrapper&) = delete;
+    SdlWrapper& operator=(SdlWrapper&&) = delete;
+
+    ~SdlWrapper() {
+        if (initialized) {
+            SDL_Quit();
+        }
+    }
+
+    bool initialized;
+};
+
+struct WindowWrapper final {
+    WindowWrapper() noexcept
+            : window(SDL_CreateWindow("Texture Compiler", SDL_WINDOWPOS_UNDEFINED, SDL_WINDOWPOS_UNDEFINED, 256, 256, SDL_WINDOW_HIDDEN)) {
+    }
+
+    WindowWrapper(const WindowWrapper&) = delete;
+    WindowWrapper(WindowWrapper&&) = delete;
+    WindowWrapper& operator=(const WindowWrapper&) = delete;
+    WindowWrapper& operator=(WindowWrapper&&) = delete;
+
+    ~WindowWrapper() {
+        if (window != nullptr) {
+            SDL_DestroyWindow(window);
+        }
+    }
+
+    SDL_Window* window;
+};
+
+struct BgfxWrapper final {
+    explicit BgfxWrapper(const bgfx::Init& init) noexcept
+            : initialized(bgfx::init(init)) {
+    }
+
+    BgfxWrapper(const BgfxWrapper&) = delete;
+    BgfxWrapper(BgfxWrapper&&) = delete;
+    BgfxWrapper& operator=(const BgfxWrapper&) = delete;
+    BgfxWrapper& operator=(BgfxWrapper&&) = delete;
+
+    ~BgfxWrapper() {
+        if (initialized) {
+            bgfx::shutdown();
+        }
+    }
+
+    bool initialized;
+};
+
+// Half floats of 16-bit channels, color channels are linearized with the gamma of 2.2 stb_image uses for 8-bit images.
+static const std::vector<uint16_t>& get_unorm16_to_half_table(bool is_alpha) noexcept {
+    static const auto make_table = [](bool is_linear) {
+        std::vector<float> values(65536);
+        for (size_t value = 0; value < values.size(); value++) {
+            const float normalized = static_cast<float>(value) / 65535.f;
+            values[value] = is_linear ? normalized : std::pow(normalized, 2.2f);
+        }
+        std::vector<uint16_t> table(values.size());
+        convert_rgba32f_to_rgba16f(values.data(), values.size(), table.data());
+        return table;
+    };
+    static const std::vector<uint16_t> color_table = make_table(false);
+    static const std::vector<uint16_t> alpha_table = make_table(true);
+    return is_alpha ? alpha_table : color_table;
+}
+
+// The equator of an equirectangular input goes around four faces of the cube map, so inputs much more detailed than the
+// first mip level of the cube map are halved before they're projected, on both backends. The projection samples the
+// input level trilinear filtering would pick rather than skipping most texels of a large input, which aliases and
+// thrashes the caches for small outputs. Inputs keep at least two texels per texel at the centers of the faces, which
+// is about one at their corners.
+static bool is_equirectangular_image_reducible(int width, size_t output_size) noexcept {
+    return static_cast<size_t>(width / 2) >= output_size * 8;
+}
+
+// Number of times `is_equirectangular_image_reducible` halves an equirectangular input of `width`.
+static int count_equirectangular_reductions(int width, size_t output_size) noexcept {
+    int reductions = 0;
+    for (; is_equirectangular_image_reducible(width, output_size); width = std::max(width / 2, 1)) {
+        reductions++;
+    }
+    return reductions;
+}
+
+// Cube map inputs are equirectangular images, six separate faces or a single image of the faces laid out as a cross.
+enum class CubeMapLayout {
+    EQUIRECTANGULAR,
+    FACES,            // `input` and `faces`, one face each
+    HORIZONTAL_CROSS, // 4x3 faces, -X, +Z, +X and -Z in the middle row, +Y above +Z and -Y below it
+    VERTICAL_CROSS,   // 3x4 faces, like the horizontal cross with -Z upside down below -Y
+};
+
+// Crosses are told apart from equirectangular images, which are twice as wide as they are tall, by their aspect ratio.
+static CubeMapLayout get_cube_map_layout(const CompileJob& job, int width, int height) noexcept {
+    if (!job.faces.empty()) {
+        return CubeMapLayout::FACES;
+    }
+    if (width > 0 && width % 4 == 0 && static_cast<int64_t>(width) * 3 == static_cast<int64_t>(height) * 4) {
+        return CubeMapLayout::HORIZONTAL_CROSS;
+    }
+    if (width > 0 && width % 3 == 0 && static_cast<int64_t>(width) * 4 == static_cast<int64_t>(height) * 3) {
+        return CubeMapLayout::VERTICAL_CROSS;
+    }
+    return CubeMapLayout::EQUIRECTANGULAR;
+}
+
+// OpenEXR images and 16-bit PNG images are decoded straight to half floats, run-length encoded Radiance HDR images
+// to floats on the thread pool, everything else goes through `stbi_loadf`, which also expands 8-bit images to floats.
+// Equirectangular Radiance HDR inputs of a cube map that are halved before they're projected are halved while they're
+// decoded instead, see `decode_hdr_rgba32f_reduced`, so a 32K sky takes the memory of the image that is projected.
+struct HdrWrapper final {
+    HdrWrapper(const std::string& path, ThreadPool& pool) noexcept {
+        decode(path, pool);
+    }
+
+    HdrWrapper() noexcept = default;
+
+    HdrWrapper(const HdrWrapper&) = delete;
+    HdrWrapper(HdrWrapper&&) = delete;
+    HdrWrapper& operator=(const HdrWrapper&) = delete;
+    HdrWrapper& operator=(HdrWrapper&&) = delete;
+
+    ~HdrWrapper() {
+        if (data != nullptr && owned_data == nullptr) {
+            stbi_image_free(data);
+        }
+    }
+
+    // Input of a cube map job, a copy of the image of `compile_image` or the decoded `input` file.
+    void load(const CompileJob& job, ThreadPool& pool) noexcept {
+        if (job.input_image.pixels != nullptr) {
+            copy(job.input_image);
+        } else {
+            decode(job.input, pool, &job);
+        }
+    }
+
+    // `job` is the cube map job of an equirectangular `path`, if it may be halved while it's decoded.
+    void decode(const std::string& path, ThreadPool& pool, const CompileJob* job = nullptr) noexcept {
+        const MappedFile file(path);
+        if (file.data == nullptr) {
+            return;
+        }
+
+        if (job != nullptr && decode_reduced_hdr(file, pool, *job)) {
+            return;
+        }
+
+        if (is_exr(file.data, file.size)) {
+            if (!decode_exr_rgba16f(file.data, file.size, width, height, half_data)) {
+                half_data.clear();
+            }
+            channels = 4;
+        } else if (file.size <= INT_MAX) {
+            const int size = static_cast<int>(file.size);
+            if (stbi_is_16_bit_from_memory(file.data, size)) {
+                stbi_us* const pixels = stbi_load_16_from_memory(file.data, size, &width, &height, &channels, 4);
+                if (pixels != nullptr) {
+                    convert_unorm16(pixels);
+                    stbi_image_free(pixels);
+                }
+            } else if (decode_hdr_rgba32f(file.data, file.size, pool, width, height, owned_data)) {
+                data = owned_data.get();
+                channels = 3;
+            } else {
+                data = stbi_loadf_from_memory(file.data, size, &width, &height, &channels, 4);
+            }
+        }
+    }
+
+    // Halves an equirectangular Radiance HDR input as many times as `compile_cube_map_cpu` and
+    // `compile_cube_map_gpu` would once it's decoded, the same way, while it's decoded. Returns false when it isn't
+    // halved or isn't run-length encoded, it's decoded whole then.
+    bool decode_reduced_hdr(const MappedFile& file, ThreadPool& pool, const CompileJob& job) noexcept {
+        int full_width = 0;
+        int full_height = 0;
+        if (!read_hdr_size(file.data, file.size, full_width, full_height) || get_cube_map_layout(job, full_width, full_height) != CubeMapLayout::EQUIRECTANGULAR) {
+            return false;
+        }
+
+        const int reductions = count_equirectangular_reductions(full_width, job.output_size);
+        const int reduced_width = std::max(full_width >> reductions, 1);
+        const int reduced_height = std::max(full_height >> reductions, 1);
+        if (reductions == 0 || get_cube_map_layout(job, reduced_width, reduced_height) != CubeMapLayout::EQUIRECTANGULAR) {
+            return false;
+        }
+
+        if (!decode_hdr_rgba32f_reduced(file.data, file.size, pool, reductions, width, height, owned_data)) {
+            return false;
+        }
+        data = owned_data.get();
+        channels = 3;
+        return true;
+    }
+
+    // The image is copied, because cube map jobs flip it and convert it to half floats in place.
+    void copy(const ImageView& image) noexcept {
+        width = image.width;
+        height = image.height;
+        channels = 4;
+
+        const size_t size = static_cast<size_t>(width) * static_cast<size_t>(height) * 4;
+        if (image.format == PixelFormat::RGBA32F) {
+            owned_data.reset(new (std::nothrow) float[size]);
+            if (owned_data != nullptr) {
+                std::memcpy(owned_data.get(), image.pixels, size * sizeof(float));
+                data = owned_data.get();
+            }
+        } else if (image.format == PixelFormat::RGBA16) {
+            convert_unorm16(static_cast<const stbi_us*>(image.pixels));
+        }
+    }
+
+    // 16-bit images are expanded to half floats like `stbi_loadf` expands 8-bit ones, with the sRGB color channels
+    // linearized.
+    void convert_unorm16(const stbi_us* pixels) noexcept {
+        const std::vector<uint16_t>& color_table = get_unorm16_to_half_table(false);
+        const std::vector<uint16_t>& alpha_table = get_unorm16_to_half_table(true);
+        half_data.resize(static_cast<size_t>(width) * static_cast<size_t>(height) * 4);
+        for (size_t i = 0; i < half_data.size(); i++) {
+            half_data[i] = ((i & 3) == 3 ? alpha_table : color_table)[pixels[i]];
+        }
+    }
+
+    // Frees `data` once the image is converted to `half_data`.
+    void free_data() noexcept {
+        if (owned_data != nullptr) {
+            owned_data.reset();
+        } else if (data != nullptr) {
+            stbi_image_free(data);
+        }
+        data = nullptr;
+    }
+
+    int width = 0;
+    int height = 0;
+    int channels = 0;
+
+    // Either `data` or `half_data` holds the image, both are interleaved RGBA.
+    float* data = nullptr;
+    std::vector<uint16_t> half_data;
+
+    // Owns `data` when it's copied from the image of `compile_image` or decoded by `decode_hdr_rgba32f` rather than
+    // by stb_image.
+    std::unique_ptr<float[]> owned_data;
+};
+
+// Size and samples of an input file, read from its headers by `probe_input`.
+struct InputInfo final {
+    int width = 0;
+    int height = 0;
+
+    // Components of the file, 1 or 2 for grey images.
+    int channels = 0;
+
+    bool is_16_bit = false;
+
+    // Radiance HDR, which is decoded straight to floats.
+    bool is_hdr = false;
+
+    // OpenEXR, which is decoded straight to half floats.
+    bool is_exr = false;
+};
+
+// Reads the size of an input for scheduling a job before it's decoded. Only the start of the file is read, which holds
+// the headers of every supported format, and it's read again with four times as much when the headers of a JPEG or an
+// OpenEXR image are longer, so probing a large manifest neither decodes nor caches the pixels of every input. Returns
+// false when the file can't be read or its format isn't known, the job fails on load then.
+static bool probe_input(const std::string& path, InputInfo& info) noexcept {
+    try {
+        // Deflated archive members are inflated only as far as the header goes.
+        const bool is_member = is_archive_member_path(path);
+        std::ifstream stream;
+        if (!is_member) {
+            stream.open(path, std::ios::binary);
+        }
+
+        std::vector<uint8_t> header;
+        bool is_end = false;
+        for (size_t size = 64 * 1024; !is_end; size *= 4) {
+            if (is_member) {
+                ArchiveMember member;
+                if (!open_archive_member(path, member, size)) {
+                    return false;
+                }
+                header.assign(member.data, member.data + member.size);
+                is_end = member.size < size;
+            } else {
+                const size_t offset = header.size();
+                header.resize(size);
+                stream.read(reinterpret_cast<char*>(header.data() + offset), static_cast<std::streamsize>(size - offset));
+                header.resize(offset + static_cast<size_t>(stream.gcount()));
+                is_end = !stream;
+            }
+
+            const int header_size = static_cast<int>(std::min<size_t>(header.size(), INT_MAX));
+            if (is_exr(header.data(), header.size())) {
+                if (read_exr_size(header.data(), header.size(), info.width, info.height)) {
+                    info.is_exr = true;
+                    return true;
+                }
+            } else if (read_qoi_size(header.data(), header.size(), info.width, info.height, info.channels) ||
+                       read_dds_size(header.data(), header.size(), info.width, info.height, info.channels)) {
+                return true;
+            } else if (stbi_info_from_memory(header.data(), header_size, &info.width, &info.height, &info.channels) != 0) {
+                info.is_16_bit = stbi_is_16_bit_from_memory(header.data(), header_size) != 0;
+                info.is_hdr = stbi_is_hdr_from_memory(header.data(), header_size) != 0;
+                return info.width > 0 && info.height > 0;
+            }
+        }
+        return false;
+    } catch (const std::exception&) {
+        return false;
+    }
+}
+
+template <typename HandleType>
+struct HandleWrapper final {
+    HandleWrapper() noexcept
+            : handle(BGFX_INVALID_HANDLE) {
+    }
+
+    HandleWrapper(HandleWrapper&& original) noexcept
+            : handle(original.handle) {
+        original.handle = BGFX_INVALID_HANDLE;
+    }
+
+    HandleWrapper(HandleType handle) noexcept
+            : handle(handle) {
+    }
+
+    HandleWrapper(const HandleWrapper&) = delete;
+    HandleWrapper& operator=(const HandleWrapper&) = delete;
+
+    HandleWrapper& operator=(HandleWrapper&& original) noexcept {
+        this->~HandleWrapper();
+        handle = original.handle;
+        original.handle = BGFX_INVALID_HANDLE;
+        return *this;
+    }
+
+    HandleWrapper& operator=(HandleType handle_) noexcept {
+        this->~HandleWrapper();
+        handle = handle_;
+        return *this;
+    }
+
+    ~HandleWrapper() {
+        if (bgfx::isValid(handle)) {
+            bgfx::destroy(handle);
+        }
+    }
+
+    operator HandleType() const noexcept {
+        return handle;
+    }
+
+    HandleType handle = BGFX_INVALID_HANDLE;
+};
+
+static float CUBE_VERTICES[] = {
+        // Back face.
+        -1.f, -1.f, -1.f, // Bottom-left.
+         1.f,  1.f, -1.f, // Top-right.
+         1.f, -1.f, -1.f, // Bottom-right.
+         1.f,  1.f, -1.f, // Top-right.
+        -1.f, -1.f, -1.f, // Bottom-left.
+        -1.f,  1.f, -1.f, // Top-left.
+        // Front face.
+        -1.f, -1.f,  1.f, // Bottom-left.
+         1.f, -1.f,  1.f, // Bottom-right.
+         1.f,  1.f,  1.f, // Top-right.
+         1.f,  1.f,  1.f, // Top-right.
+        -1.f,  1.f,  1.f, // Top-left.
+        -1.f, -1.f,  1.f, // Bottom-left.
+        // Left face.
+        -1.f,  1.f,  1.f, // Top-right.
+        -1.f,  1.f, -1.f, // Top-left.
+        -1.f, -1.f, -1.f, // Bottom-left.
+        -1.f, -1.f, -1.f, // Bottom-left.
+        -1.f, -1.f,  1.f, // Bottom-right.
+        -1.f,  1.f,  1.f, // Top-right.
+        // Right face.
+         1.f,  1.f,  1.f, // Top-left.
+         1.f, -1.f, -1.f, // Bottom-right.
+         1.f,  1.f, -1.f, // Top-right.
+         1.f, -1.f, -1.f, // Bottom-right.
+         1.f,  1.f,  1.f, // Top-left.
+         1.f, -1.f,  1.f, // Bottom-left.
+        // Bottom face.
+        -1.f, -1.f, -1.f, // Top-right.
+         1.f, -1.f, -1.f, // Top-left.
+         1.f, -1.f,  1.f, // Bottom-left.
+         1.f, -1.f,  1.f, // Bottom-left.
+        -1.f, -1.f,  1.f, // Bottom-right.
+        -1.f, -1.f, -1.f, // Top-right.
+        // Top face.
+        -1.f,  1.f, -1.f, // Top-left.
+         1.f,  1.f , 1.f, // Bottom-right.
+         1.f,  1.f, -1.f, // Top-right.
+         1.f,  1.f,  1.f, // Bottom-right.
+        -1.f,  1.f, -1.f, // Top-left.
+        -1.f,  1.f,  1.f  // Bottom-left.
+};
+
+static const bgfx::VertexDecl CUBE_VERTEX_DECLARATION = [] {
+    bgfx::VertexDecl result;
+    result.begin().add(bgfx::Attrib::Position, 3, bgfx::AttribType::Float).end();
+    return result;
+}();
+
+static glm::mat4 CUBE_MAP_VIEWS[] = {
+        glm::lookAt(glm::vec3(0.f, 0.f, 0.f), glm::vec3( 1.f,  0.f,  0.f), glm::vec3(0.f, -1.f,  0.f)),
+        glm::lookAt(glm::vec3(0.f, 0.f, 0.f), glm::vec3(-1.f,  0.f,  0.f), glm::vec3(0.f, -1.f,  0.f)),
+        glm::lookAt(glm::vec3(0.f, 0.f, 0.f), glm::vec3( 0.f, -1.f,  0.f), glm::vec3(0.f,  0.f, -1.f)),
+        glm::lookAt(glm::vec3(0.f, 0.f, 0.f), glm::vec3( 0.f,  1.f,  0.f), glm::vec3(0.f,  0.f,  1.f)),
+        glm::lookAt(glm::vec3(0.f, 0.f, 0.f), glm::vec3( 0.f,  0.f,  1.f), glm::vec3(0.f, -1.f,  0.f)),
+        glm::lookAt(glm::vec3(0.f, 0.f, 0.f), glm::vec3( 0.f,  0.f, -1.f), glm::vec3(0.f, -1.f,  0.f))
+};
+
+static glm::mat4 CUBE_MAP_VIEWS_GLSL[] = {
+        glm::lookAt(glm::vec3(0.f, 0.f, 0.f), glm::vec3( 1.f,  0.f,  0.f), glm::vec3(0.f, -1.f,  0.f)),
+        glm::lookAt(glm::vec3(0.f, 0.f, 0.f), glm::vec3(-1.f,  0.f,  0.f), glm::vec3(0.f, -1.f,  0.f)),
+        glm::lookAt(glm::vec3(0.f, 0.f, 0.f), glm::vec3( 0.f,  1.f,  0.f), glm::vec3(0.f,  0.f,  1.f)),
+        glm::lookAt(glm::vec3(0.f, 0.f, 0.f), glm::vec3( 0.f, -1.f,  0.f), glm::vec3(0.f,  0.f, -1.f)),
+        glm::lookAt(glm::vec3(0.f, 0.f, 0.f), glm::vec3( 0.f,  0.f,  1.f), glm::vec3(0.f, -1.f,  0.f)),
+        glm::lookAt(glm::vec3(0.f, 0.f, 0.f), glm::vec3( 0.f,  0.f, -1.f), glm::vec3(0.f, -1.f,  0.f))
+};
+
+static glm::mat4 CUBE_MAP_PROJECTION = glm::perspective(glm::radians(90.0f), 1.0f, 0.1f, 10.0f);
+
+// Roughness of prefilter mip levels grows linearly and reaches 1 at this mip level, unless `prefilter_levels` is set.
+static constexpr uint16_t PREFILTER_MAX_ROUGHNESS_MIP_LEVEL = 4;
+
+static int count_mip_maps(size_t size) noexcept {
+    int result = 1;
+    while (size > 1) {
+        size /= 2;
+        result++;
+    }
+    return result;
+}
+
+// Number of prefilter mip levels rendered and written, `prefilter_levels` truncates the mip chain.
+static uint16_t get_prefilter_mip_levels(const CompileJob& job) noexcept {
+    const auto mip_levels = static_cast<uint16_t>(count_mip_maps(job.output_prefilter_size));
+    if (job.prefilter_levels == 0) {
+        return mip_levels;
+    }
+    return static_cast<uint16_t>(std::min<size_t>(mip_levels, job.prefilter_levels));
+}
+
+// With `prefilter_levels` set, the last written mip level is the roughest one.
+static uint16_t get_prefilter_max_roughness_mip_level(const CompileJob& job) noexcept {
+    if (job.prefilter_levels == 0) {
+        return PREFILTER_MAX_ROUGHNESS_MIP_LEVEL;
+    }
+    return static_cast<uint16_t>(std::max(get_prefilter_mip_levels(job) - 1, 1));
+}
+
+static float get_prefilter_roughness(const CompileJob& job, uint16_t mip_level) noexcept {
+    const uint16_t max_roughness_mip_level = get_prefilter_max_roughness_mip_level(job);
+    return static_cast<float>(std::min(mip_level, max_roughness_mip_level)) / max_roughness_mip_level;
+}
+
+// Mirror reflection of the first mip level is exact with a single sample. Wider lobes of rougher mip levels need more
+// samples, but the shaders make up for fewer samples by fetching coarser environment mip levels according to the pdf.
+static float get_prefilter_sample_count(const CompileJob& job, uint16_t mip_level) noexcept {
+    const float roughness = get_prefilter_roughness(job, mip_level);
+    if (roughness == 0.f) {
+        return 1.f;
+    }
+    return std::max(std::round(roughness * static_cast<float>(job.prefilter_samples)), 1.f);
+}
+
+// Texture stage of the prefilter sample table, stage 1 is taken by the output image of the compute shaders.
+static constexpr uint8_t PREFILTER_SAMPLES_STAGE = 2;
+
+static const bgfx::EmbeddedShader CUBE_MAP_SHADER[] = {
+        BGFX_EMBEDDED_SHADER(cube_map_shader_vertex),
+        BGFX_EMBEDDED_SHADER(cube_map_shader_fragment),
+        BGFX_EMBEDDED_SHADER_END()
+};
+
+static const bgfx::EmbeddedShader CUBE_MAP_COMPUTE_SHADER[] = {
+        BGFX_EMBEDDED_SHADER(cube_map_shader_compute),
+        BGFX_EMBEDDED_SHADER_END()
+};
+
+static const bgfx::EmbeddedShader DOWNSAMPLE_COMPUTE_SHADER[] = {
+        BGFX_EMBEDDED_SHADER(downsample_shader_compute),
+        BGFX_EMBEDDED_SHADER_END()
+};
+
+static const bgfx::EmbeddedShader MIP_COMPUTE_SHADER[] = {
+        BGFX_EMBEDDED_SHADER(mip_shader_compute),
+        BGFX_EMBEDDED_SHADER_END()
+};
+
+static const bgfx::EmbeddedShader BC6H_COMPUTE_SHADER[] = {
+        BGFX_EMBEDDED_SHADER(bc6h_shader_compute),
+        BGFX_EMBEDDED_SHADER_END()
+};
+
+static const bgfx::EmbeddedShader IRRADIANCE_SHADER[] = {
+        BGFX_EMBEDDED_SHADER(cube_map_shader_vertex),
+        BGFX_EMBEDDED_SHADER(irradiance_shader_fragment),
+        BGFX_EMBEDDED_SHADER_END()
+};
+
+static const bgfx::EmbeddedShader IRRADIANCE_COMPUTE_SHADER[] = {
+        BGFX_EMBEDDED_SHADER(irradiance_shader_compute),
+        BGFX_EMBEDDED_SHADER_END()
+};
+
+static const bgfx::EmbeddedShader PREFILTER_SHADER[] = {
+        BGFX_EMBEDDED_SHADER(cube_map_shader_vertex),
+        BGFX_EMBEDDED_SHADER(prefilter_shader_fragment),
+        BGFX_EMBEDDED_SHADER_END()
+};
+
+static const bgfx::EmbeddedShader PREFILTER_COMPUTE_SHADER[] = {
+        BGFX_EMBEDDED_SHADER(prefilter_shader_compute),
+        BGFX_EMBEDDED_SHADER_END()
+};
+
+// Free textures each pool keeps for later stages and jobs. Textures of probes of usual sizes stay pooled, while the
+// ones of a 4096 cube map, where a single mip chain of faces takes a gigabyte, are destroyed once their stage is done,
+// so the stages after it and other processes sharing the GPU don't run out of memory. bgfx defers destruction until
+// the GPU work submitted before is executed, so releasing right after the last use is safe.
+static constexpr uint64_t MAX_FREE_TEXTURE_BYTES = 256 * 1024 * 1024;
+
+static uint64_t get_texture_bytes(bool is_cube, uint16_t size, bool has_mips, uint16_t layers, bgfx::TextureFormat::Enum format) noexcept {
+    bgfx::TextureInfo info;
+    bgfx::calcTextureSize(info, size, size, 1, is_cube, has_mips, layers, format);
+    return info.storageSize;
+}
+
+// Read back textures are only used to fetch render targets to the CPU, so instead of creating and destroying one for
+// every face and mip level, textures are kept alive and reused across faces, mip levels and jobs.
+struct StagingTexturePool final {
+    StagingTexturePool() noexcept = default;
+
+    StagingTexturePool(const StagingTexturePool&) = delete;
+    StagingTexturePool(StagingTexturePool&&) = delete;
+    StagingTexturePool& operator=(const StagingTexturePool&) = delete;
+    StagingTexturePool& operator=(StagingTexturePool&&) = delete;
+
+    // Returns a free texture of the given size and format or creates a new one. Returns invalid handle on failure.
+    bgfx::TextureHandle acquire(uint16_t size, bgfx::TextureFormat::Enum format) noexcept {
+        std::vector<HandleWrapper<bgfx::TextureHandle>>& textures = free_textures[get_key(size, format)];
+        if (!textures.empty()) {
+            bgfx::TextureHandle result = textures.back();
+
+            // Release the ownership without destroying the texture.
+            textures.back().handle = BGFX_INVALID_HANDLE;
+            textures.pop_back();
+            free_bytes -= get_texture_bytes(false, size, false, 1, format);
+
+            return result;
+        }
+
+        // `BGFX_TEXTURE_RT` and `BGFX_TEXTURE_READ_BACK` are not compatible, so render targets are blitted to these textures and read back from them.
+        return bgfx::createTexture2D(size, size, false, 1, format, BGFX_TEXTURE_BLIT_DST | BGFX_TEXTURE_READ_BACK | BGFX_SAMPLER_U_CLAMP | BGFX_SAMPLER_V_CLAMP);
+    }
+
+    // The texture must not be released before its read back is complete. Destroyed instead of kept when the pool
+    // would exceed `MAX_FREE_TEXTURE_BYTES`.
+    void release(uint16_t size, bgfx::TextureFormat::Enum format, bgfx::TextureHandle texture) noexcept {
+        const uint64_t bytes = get_texture_bytes(false, size, false, 1, format);
+        if (free_bytes + bytes > MAX_FREE_TEXTURE_BYTES) {
+            bgfx::destroy(texture);
+            return;
+        }
+        free_textures[get_key(size, format)].emplace_back(texture);
+        free_bytes += bytes;
+    }
+
+    std::map<uint32_t, std::vector<HandleWrapper<bgfx::TextureHandle>>> free_textures;
+    uint64_t free_bytes = 0;
+
+private:
+    static uint32_t get_key(uint16_t size, bgfx::TextureFormat::Enum format) noexcept {
+        return (static_cast<uint32_t>(format) << 16) | size;
+    }
+};
+
+// Returns the staging texture to the pool on destruction.
+struct StagingTexture final {
+    StagingTexture(StagingTexturePool& pool, uint16_t size, bgfx::TextureFormat::Enum format) noexcept
+            : pool(&pool)
+            , size(size)
+            , format(format)
+            , handle(pool.acquire(size, format)) {
+    }
+
+    StagingTexture(StagingTexture&& original) noexcept
+            : pool(original.pool)
+            , size(original.size)
+            , format(original.format)
+            , handle(original.handle) {
+        original.handle = BGFX_INVALID_HANDLE;
+    }
+
+    StagingTexture(const StagingTexture&) = delete;
+    StagingTexture& operator=(const StagingTexture&) = delete;
+    StagingTexture& operator=(StagingTexture&&) = delete;
+
+    ~StagingTexture() {
+        if (bgfx::isValid(handle)) {
+            pool->release(size, format, handle);
+        }
+    }
+
+    StagingTexturePool* pool;
+    uint16_t size;
+    bgfx::TextureFormat::Enum format;
+    bgfx::TextureHandle handle;
+};
+
+// Textures the cube map stages render to. Textures with the same description are interchangeable, because every stage
+// overwrites all of the texels it reads back or samples.
+struct RenderTargetDescription final {
+    bool is_cube = false;
+    uint16_t size = 0;
+    bool has_mips = false;
+    uint16_t layers = 1;
+    bgfx::TextureFormat::Enum format = bgfx::TextureFormat::RGBA16F;
+    uint64_t flags = 0;
+
+    bool operator<(const RenderTargetDescription& other) const noexcept {
+        return std::tie(is_cube, size, has_mips, layers, format, flags) < std::tie(other.is_cube, other.size, other.has_mips, other.layers, other.format, other.flags);
+    }
+};
+
+// Like `StagingTexturePool` for render targets, so a manifest of many probes of a few sizes creates the render targets
+// of every size once instead of for every job.
+struct RenderTargetPool final {
+    RenderTargetPool() noexcept = default;
+
+    RenderTargetPool(const RenderTargetPool&) = delete;
+    RenderTargetPool(RenderTargetPool&&) = delete;
+    RenderTargetPool& operator=(const RenderTargetPool&) = delete;
+    RenderTargetPool& operator=(RenderTargetPool&&) = delete;
+
+    // Returns a free texture of the given description or creates a new one. Returns invalid handle on failure.
+    bgfx::TextureHandle acquire(const RenderTargetDescription& description) noexcept {
+        std::vector<HandleWrapper<bgfx::TextureHandle>>& textures = free_textures[description];
+        if (!textures.empty()) {
+            bgfx::TextureHandle result = textures.back();
+
+            // Release the ownership without destroying the texture.
+            textures.back().handle = BGFX_INVALID_HANDLE;
+            textures.pop_back();
+            free_bytes -= get_bytes(description);
+
+            return result;
+        }
+
+        if (description.is_cube) {
+            return bgfx::createTextureCube(description.size, description.has_mips, description.layers, description.format, description.flags);
+        }
+        return bgfx::createTexture2D(description.size, description.size, description.has_mips, description.layers, description.format, description.flags);
+    }
+
+    // Later views of the job may reuse the texture as soon as it's released, views execute in order. Destroyed
+    // instead of kept when the pool would exceed `MAX_FREE_TEXTURE_BYTES`.
+    void release(const RenderTargetDescription& description, bgfx::TextureHandle texture) noexcept {
+        const uint64_t bytes = get_bytes(description);
+        if (free_bytes + bytes > MAX_FREE_TEXTURE_BYTES) {
+            bgfx::destroy(texture);
+            return;
+        }
+        free_textures[description].emplace_back(texture);
+        free_bytes += bytes;
+    }
+
+    std::map<RenderTargetDescription, std::vector<HandleWrapper<bgfx::TextureHandle>>> free_textures;
+    uint64_t free_bytes = 0;
+
+private:
+    static uint64_t get_bytes(const RenderTargetDescription& description) noexcept {
+        return get_texture_bytes(description.is_cube, description.size, description.has_mips, description.layers, description.format);
+    }
+};
+
+// Render target acquired from a pool for the lifetime of this object. Stages release their targets once the views that
+// use them are submitted, so stages that follow can reuse them, and assign a default constructed target to do so.
+struct RenderTarget final {
+    RenderTarget() noexcept = default;
+
+    RenderTarget(RenderTargetPool& pool, const RenderTargetDescription& description) noexcept
+            : pool(&pool)
+            , description(description)
+            , handle(pool.acquire(description)) {
+    }
+
+    RenderTarget(RenderTarget&& original) noexcept
+            : pool(original.pool)
+            , description(original.description)
+            , handle(original.handle) {
+        original.handle = BGFX_INVALID_HANDLE;
+    }
+
+    RenderTarget& operator=(RenderTarget&& original) noexcept {
+        this->~RenderTarget();
+        pool = original.pool;
+        description = original.description;
+        handle = original.handle;
+        original.handle = BGFX_INVALID_HANDLE;
+        return *this;
+    }
+
+    RenderTarget(const RenderTarget&) = delete;
+    RenderTarget& operator=(const RenderTarget&) = delete;
+
+    ~RenderTarget() {
+        if (bgfx::isValid(handle)) {
+            pool->release(description, handle);
+        }
+    }
+
+    operator bgfx::TextureHandle() const noexcept {
+        return handle;
+    }
+
+    RenderTargetPool* pool = nullptr;
+    RenderTargetDescription description;
+    bgfx::TextureHandle handle = BGFX_INVALID_HANDLE;
+};
+
+struct Renderer final {
+    Renderer() noexcept = default;
+
+    Renderer(const Renderer&) = delete;
+    Renderer(Renderer&&) = delete;
+    Renderer& operator=(const Renderer&) = delete;
+    Renderer& operator=(Renderer&&) = delete;
+
+    // Callback of bgfx when `--shader-cache` or `--cache` is set, declared first so it outlives the renderer.
+    std::optional<ShaderCache> shader_cache;
+
+    // Wrappers are emplaced by `initialize_renderer`, handles below are destroyed before the renderer is shut down.
+    std::optional<SdlWrapper> sdl;
+    std::optional<WindowWrapper> window;
+    std::optional<BgfxWrapper> bgfx;
+
+    bgfx::RendererType::Enum renderer_type = bgfx::RendererType::Noop;
+    glm::mat4* cube_map_view_matrices = CUBE_MAP_VIEWS;
+
+    HandleWrapper<bgfx::VertexBufferHandle> vertex_buffer;
+    HandleWrapper<bgfx::UniformHandle> texture_uniform;
+    HandleWrapper<bgfx::UniformHandle> settings_uniform;
+    HandleWrapper<bgfx::UniformHandle> tile_uniform;
+    HandleWrapper<bgfx::ProgramHandle> cube_map_program;
+    HandleWrapper<bgfx::ProgramHandle> irradiance_program;
+    HandleWrapper<bgfx::ProgramHandle> prefilter_program;
+
+    // Sampler of the prefilter sample table of `create_prefilter_sample_table`.
+    HandleWrapper<bgfx::UniformHandle> samples_uniform;
+
+    // Set by `--backend`, switched from `AUTO` to `CPU` when the renderer fails to initialize.
+    Backend backend = Backend::AUTO;
+
+    // Skips the video subsystem and the window, set by `--headless` or when no display is available.
+    bool is_headless = false;
+
+    // Graphics API of the renderer, set by `--renderer`.
+    RendererApi renderer_api = RendererApi::AUTO;
+
+    // Index of the GPU in the adapters bgfx enumerates, set by `--gpu`. Negative for the one bgfx picks.
+    int gpu_index = -1;
+
+    // Compute shaders write all six faces of a mip level in a single dispatch instead of rendering every face in its
+    // own view. Only used when the renderer supports them and `--no-compute` is not specified. Outputs of the compute
+    // shaders are texture arrays with one layer per cube map side.
+    bool is_compute_allowed = true;
+    bool is_compute_supported = false;
+    glm::mat4 cube_map_inverse_view_projections[6];
+    HandleWrapper<bgfx::UniformHandle> inverse_view_projections_uniform;
+    HandleWrapper<bgfx::ProgramHandle> cube_map_compute_program;
+    HandleWrapper<bgfx::ProgramHandle> irradiance_compute_program;
+    HandleWrapper<bgfx::ProgramHandle> prefilter_compute_program;
+
+    // The fast encoder compresses cube maps to BC6H in compute shaders and reads back blocks, an eighth of the size of
+    // the faces. Block textures are RGBA32U images, which some renderers don't support.
+    bool is_bc6h_compute_supported = false;
+    HandleWrapper<bgfx::ProgramHandle> downsample_compute_program;
+    HandleWrapper<bgfx::ProgramHandle> bc6h_compute_program;
+
+    // Set by `--gpu-mips`, mip levels of 2D jobs compiled on `thread` are built by the mip shader, which writes RGBA32F
+    // images that some renderers don't support. Only the thread that created the context may use the renderer.
+    bool is_gpu_mips = false;
+    bool is_mip_compute_supported = false;
+    std::thread::id thread;
+    HandleWrapper<bgfx::ProgramHandle> mip_compute_program;
+
+    StagingTexturePool staging_textures;
+    RenderTargetPool render_targets;
+
+    // GPU times of views are collected by `wait_for_frame` with the bgfx profiler, which is enabled by `--metrics` and
+    // `--verbose`. Times of the current job are summed by view name and reported by `report_gpu_view_times`.
+    bool is_profiling = false;
+    bool is_verbose = false;
+    std::vector<GpuViewMetrics> gpu_views;
+
+    // Highest texture and render target memory bgfx reported during the current job, with the profiler only.
+    uint64_t peak_gpu_memory_usage = 0;
+
+    // Set by `set_gpu_idle_callback` and taken by `run_gpu_idle_callback`.
+    std::function<void()> gpu_idle_callback;
+
+    // Set by `CompilerSettings::native_device`.
+    void* native_device = nullptr;
+
+    // Set by `compile_image_preview` for the job it compiles, outputs are copied to these textures by
+    // `copy_to_preview_texture` instead of being read back.
+    const std::vector<PreviewTexture>* preview_textures = nullptr;
+
+    // Wall seconds spent in `gpu_idle_callback`, which `compile` doesn't count to the job that ran it.
+    double gpu_idle_seconds = 0.0;
+
+    bool initialized = false;
+};
+
+// `--backend auto` falls back to the CPU backend when the renderer of the platform fails to initialize, so the job
+// doesn't fail and the failure is only a warning.
+static bool is_cpu_fallback_allowed(const Renderer& renderer) noexcept {
+    return renderer.backend == Backend::AUTO && renderer.renderer_api == RendererApi::AUTO;
+}
+
+// Start of the messages of renderer failures.
+static const char* get_renderer_failure(const Renderer& renderer) noexcept {
+    return is_cpu_fallback_allowed(renderer) ? "Texture compiler warning. " : "Texture compiler error. ";
+}
+
+static int create_program(const Renderer& renderer, HandleWrapper<bgfx::ProgramHandle>& program, const bgfx::EmbeddedShader* shader,
+                          const char* vertex_shader_name, const char* fragment_shader_name, const char* description) noexcept {
+    bgfx::ShaderHandle vertex_shader_handle = bgfx::createEmbeddedShader(shader, renderer.renderer_type, "cube_map_shader_vertex");
+    if (!bgfx::isValid(vertex_shader_handle)) {
+        std::cout << get_renderer_failure(renderer) << "Failed to create " << description << " vertex shader." << std::endl;
+        return 1;
+    }
+    bgfx::setName(vertex_shader_handle, vertex_shader_name);
+
+    bgfx::ShaderHandle fragment_shader_handle = bgfx::createEmbeddedShader(shader, renderer.renderer_type, fragment_shader_name);
+    if (!bgfx::isValid(fragment_shader_handle)) {
+        std::cout << get_renderer_failure(renderer) << "Failed to create " << description << " fragment shader." << std::endl;
+        bgfx::destroy(vertex_shader_handle);
+        return 1;
+    }
+    bgfx::setName(fragment_shader_handle, fragment_shader_name);
+
+    program = bgfx::createProgram(vertex_shader_handle, fragment_shader_handle, true);
+    if (!bgfx::isValid(program)) {
+        std::cout << get_renderer_failure(renderer) << "Failed to create " << description << " program." << std::endl;
+        bgfx::destroy(fragment_shader_handle);
+        bgfx::destroy(vertex_shader_handle);
+        return 1;
+    }
+
+    return 0;
+}
+
+static int create_compute_program(const Renderer& renderer, HandleWrapper<bgfx::ProgramHandle>& program, const bgfx::EmbeddedShader* shader,
+                                  const char* compute_shader_name, const char* description) noexcept {
+    bgfx::ShaderHandle compute_shader_handle = bgfx::createEmbeddedShader(shader, renderer.renderer_type, compute_shader_name);
+    if (!bgfx::isValid(compute_shader_handle)) {
+        std::cout << get_renderer_failure(renderer) << "Failed to create " << description << " compute shader." << std::endl;
+        return 1;
+    }
+    bgfx::setName(compute_shader_handle, compute_shader_name);
+
+    program = bgfx::createProgram(compute_shader_handle, true);
+    if (!bgfx::isValid(program)) {
+        std::cout << get_renderer_failure(renderer) << "Failed to create " << description << " compute program." << std::endl;
+        bgfx::destroy(compute_shader_handle);
+        return 1;
+    }
+
+    return 0;
+}
+
+static int create_sample_uniform(Renderer& renderer) noexcept {
+    renderer.samples_uniform = bgfx::createUniform("s_samples", bgfx::UniformType::Sampler);
+    if (!bgfx::isValid(renderer.samples_uniform)) {
+        std::cout << get_renderer_failure(renderer) << "Failed to create prefilter sample uniform." << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
+
+// bgfx selects adapters by PCI vendor and device identifiers only, so the GPU of `--gpu` is looked up in the adapters
+// bgfx enumerated when it was initialized with its own pick, and bgfx is initialized again with the identifiers of the
+// requested one when they differ. Identical GPUs share their identifiers, and bgfx always picks the first of them.
+static int select_gpu(Renderer& renderer, bgfx::Init& init) noexcept {
+    if (renderer.gpu_index < 0) {
+        return 0;
+    }
+
+    const bgfx::Caps* caps = bgfx::getCaps();
+    const size_t index = static_cast<size_t>(renderer.gpu_index);
+    if (index >= caps->numGPUs) {
+        std::cout << get_renderer_failure(renderer) << "Command line argument --gpu is " << index << ", but the renderer found " << static_cast<int>(caps->numGPUs) << " GPUs." << std::endl;
+        return 1;
+    }
+
+    const bgfx::Caps::GPU gpu = caps->gpu[index];
+    for (size_t other = 0; other < index; other++) {
+        if (caps->gpu[other].vendorId == gpu.vendorId && caps->gpu[other].deviceId == gpu.deviceId) {
+            std::cout << "Texture compiler warning. GPU " << index << " has the same PCI identifiers as GPU " << other << ", the renderer can't tell them apart and uses GPU " << other << "." << std::endl;
+            break;
+        }
+    }
+
+    if (gpu.vendorId != caps->vendorId || gpu.deviceId != caps->deviceId) {
+        renderer.bgfx.reset();
+        init.vendorId = gpu.vendorId;
+        init.deviceId = gpu.deviceId;
+        renderer.bgfx.emplace(init);
+        if (!renderer.bgfx->initialized) {
+            std::cout << get_renderer_failure(renderer) << "Failed to initialize a renderer on GPU " << index << "." << std::endl;
+            return 1;
+        }
+    }
+
+    if (renderer.is_verbose) {
+        std::cout << "Renderer uses GPU " << index << ", PCI identifiers " << std::hex << std::setfill('0') << std::setw(4) << bgfx::getCaps()->vendorId << ":" << std::setw(4)
+                  << bgfx::getCaps()->deviceId << std::dec << std::setfill(' ') << "." << std::endl;
+    }
+    return 0;
+}
+
+static bgfx::RendererType::Enum get_renderer_type(RendererApi renderer_api) noexcept {
+    switch (renderer_api) {
+        case RendererApi::VULKAN:
+            return bgfx::RendererType::Vulkan;
+        case RendererApi::D3D11:
+            return bgfx::RendererType::Direct3D11;
+        case RendererApi::D3D12:
+            return bgfx::RendererType::Direct3D12;
+        case RendererApi::METAL:
+            return bgfx::RendererType::Metal;
+        case RendererApi::OPENGL:
+            return bgfx::RendererType::OpenGL;
+        case RendererApi::AUTO:
+            break;
+    }
+    return bgfx::RendererType::Count;
+}
+
+// Renderer types `initialize_renderer` tries in order, the one of `--renderer` or the ones of the platform for `AUTO`,
+// less the ones bgfx is built without. Cube map jobs read back every face of every mip level, and bgfx reads textures
+// back synchronously on every API, so the order is the one of the lowest readback latency: the native API of the
+// platform first, D3D11 before D3D12, which waits for its queue to go idle on every readback, and OpenGL last, which
+// stalls on `glGetTexImage` of float textures. `--renderers` of the benchmark times the readback phases of every API
+// to check the order on new drivers. Headless Linux renderers are Vulkan only, OpenGL needs an X display for its
+// context there. Vulkan is dropped when there is no Vulkan driver, since when it fails to initialize bgfx falls back
+// to OpenGL on its own, which aborts the process without a display.
+static void get_renderer_candidates(const Renderer& renderer, std::vector<bgfx::RendererType::Enum>& candidates) {
+    candidates.clear();
+    if (renderer.renderer_api != RendererApi::AUTO) {
+        candidates.push_back(get_renderer_type(renderer.renderer_api));
+    } else {
+#if BX_PLATFORM_WINDOWS
+        candidates = { bgfx::RendererType::Direct3D11, bgfx::RendererType::Direct3D12, bgfx::RendererType::Vulkan, bgfx::RendererType::OpenGL };
+#elif BX_PLATFORM_OSX
+        candidates = { bgfx::RendererType::Metal, bgfx::RendererType::OpenGL };
+#else
+        candidates = { bgfx::RendererType::Vulkan, bgfx::RendererType::OpenGL };
+#endif
+    }
+
+    bgfx::RendererType::Enum supported[bgfx::RendererType::Count];
+    const uint8_t supported_count = bgfx::getSupportedRenderers(bgfx::RendererType::Count, supported);
+    candidates.erase(std::remove_if(candidates.begin(), candidates.end(), [&](bgfx::RendererType::Enum type) {
+        return std::find(supported, supported + supported_count, type) == supported + supported_count;
+    }), candidates.end());
+
+#if BX_PLATFORM_LINUX
+    if (renderer.is_headless && renderer.native_device == nullptr) {
+        candidates.erase(std::remove(candidates.begin(), candidates.end(), bgfx::RendererType::OpenGL), candidates.end());
+    }
+
+    void* vulkan_library = dlopen("libvulkan.so.1", RTLD_LAZY | RTLD_LOCAL);
+    if (vulkan_library == nullptr) {
+        candidates.erase(std::remove(candidates.begin(), candidates.end(), bgfx::RendererType::Vulkan), candidates.end());
+    } else {
+        dlclose(vulkan_library);
+    }
+#endif
+}
+
+// Initialize video subsystem, window, renderer and all the GPU resources that don't depend on a particular cube map.
+// Renderer is initialized once and then shared by all the cube map jobs of this process.
+static int initialize_renderer(Renderer& renderer) noexcept {
+    if (renderer.initialized) {
+        return 0;
+    }
+
+    bgfx::Init init;
+    bgfx::PlatformData platform_data {};
+
+    if (!renderer.is_headless) {
+        renderer.sdl.emplace();
+        if (renderer.sdl->initialized) {
+            renderer.window.emplace();
+        }
+
+        if (!renderer.sdl->initialized || renderer.window->window == nullptr) {
+            std::cout << "Texture compiler warning. Failed to initialize a window, falling back to a headless renderer." << std::endl;
+            renderer.window.reset();
+            renderer.sdl.reset();
+            renderer.is_headless = true;
+        }
+    }
+
+    if (!renderer.is_headless) {
+        SDL_SysWMinfo native_info;
+        SDL_VERSION(&native_info.version)
+        if (!SDL_GetWindowWMInfo(renderer.window->window, &native_info)) {
+            std::cout << get_renderer_failure(renderer) << "Failed to get system window handle." << std::endl;
+            return 1;
+        }
+
+#if BX_PLATFORM_WINDOWS
+        platform_data.nwh = native_info.info.win.window;
+#elif BX_PLATFORM_OSX
+        platform_data.ndt = nullptr;
+        platform_data.nwh = native_info.info.cocoa.window;
+#elif BX_PLATFORM_LINUX
+        platform_data.ndt = native_info.info.x11.display;
+        platform_data.nwh = reinterpret_cast<void*>(native_info.info.x11.window);
+#endif
+    }
+
+    // Without a native window renderers run without a swap chain.
+    std::vector<bgfx::RendererType::Enum> candidates;
+    get_renderer_candidates(renderer, candidates);
+    if (candidates.empty()) {
+        if (renderer.renderer_api != RendererApi::AUTO) {
+            std::cout << get_renderer_failure(renderer) << "Renderer " << bgfx::getRendererName(get_renderer_type(renderer.renderer_api)) << " is not available"
+                      << (renderer.is_headless ? " without a window" : "") << " on this machine." << std::endl;
+        } else if (renderer.is_headless) {
+            std::cout << get_renderer_failure(renderer) << "Headless renderer requires a Vulkan driver." << std::endl;
+        } else {
+            std::cout << get_renderer_failure(renderer) << "No renderer is available on this machine." << std::endl;
+        }
+        return 1;
+    }
+
+    // A host device is only touched by its native resources on the render thread, so bgfx renders on this thread
+    // during `bgfx::frame` instead of starting a thread of its own.
+    if (renderer.native_device != nullptr) {
+        platform_data.context = renderer.native_device;
+        bgfx::renderFrame();
+    }
+
+    bgfx::setPlatformData(platform_data);
+    init.platformData = platform_data;
+
+    // Nothing is ever presented, the back buffer only has to exist.
+    init.resolution.width = 256;
+    init.resolution.height = 256;
+    init.resolution.reset = BGFX_RESET_NONE;
+
+    if (renderer.shader_cache) {
+        init.callback = &*renderer.shader_cache;
+    }
+
+    // bgfx falls back to other renderer types when the requested one fails, which is fine for `AUTO`, but an explicit
+    // `--renderer` is there to compare or to avoid a renderer, so any other one is an error.
+    init.type = candidates.front();
+    renderer.bgfx.emplace(init);
+    if (!renderer.bgfx->initialized) {
+        std::cout << get_renderer_failure(renderer) << "Failed to initialize a renderer." << std::endl;
+        return 1;
+    }
+    if (renderer.renderer_api != RendererApi::AUTO && bgfx::getRendererType() != init.type) {
+        std::cout << get_renderer_failure(renderer) << "Renderer " << bgfx::getRendererName(init.type) << " failed to initialize." << std::endl;
+        return 1;
+    }
+
+    if (select_gpu(renderer, init) != 0) {
+        // Error is printed in `select_gpu`.
+        return 1;
+    }
+
+    // Programs are created below, once the GPU is final.
+    if (renderer.shader_cache) {
+        renderer.shader_cache->set_renderer(bgfx::getRendererType(), bgfx::getCaps()->vendorId, bgfx::getCaps()->deviceId);
+    }
+
+    if (renderer.is_profiling) {
+        bgfx::setDebug(BGFX_DEBUG_PROFILER);
+    }
+
+    renderer.vertex_buffer = bgfx::createVertexBuffer(bgfx::makeRef(CUBE_VERTICES, sizeof(CUBE_VERTICES)), CUBE_VERTEX_DECLARATION);
+    if (!bgfx::isValid(renderer.vertex_buffer)) {
+        std::cout << get_renderer_failure(renderer) << "Failed to create cube vertex buffer." << std::endl;
+        return 1;
+    }
+    bgfx::setName(renderer.vertex_buffer, "cube_vertices");
+
+    renderer.renderer_type = bgfx::getRendererType();
+    if (renderer.is_verbose) {
+        std::cout << "Renderer uses " << bgfx::getRendererName(renderer.renderer_type) << "." << std::endl;
+    }
+    if (renderer.renderer_type == bgfx::RendererType::OpenGL || renderer.renderer_type == bgfx::RendererType::OpenGLES) {
+        renderer.cube_map_view_matrices = CUBE_MAP_VIEWS_GLSL;
+    } else {
+        renderer.cube_map_view_matrices = CUBE_MAP_VIEWS;
+    }
+
+    renderer.texture_uniform = bgfx::createUniform("s_texture", bgfx::UniformType::Sampler);
+    if (!bgfx::isValid(renderer.texture_uniform)) {
+        std::cout << get_renderer_failure(renderer) << "Failed to create texture uniform." << std::endl;
+        return 1;
+    }
+
+    renderer.settings_uniform = bgfx::createUniform("u_settings", bgfx::UniformType::Vec4);
+    if (!bgfx::isValid(renderer.settings_uniform)) {
+        std::cout << get_renderer_failure(renderer) << "Failed to create a settings uniform." << std::endl;
+        return 1;
+    }
+
+    renderer.tile_uniform = bgfx::createUniform("u_tile", bgfx::UniformType::Vec4);
+    if (!bgfx::isValid(renderer.tile_uniform)) {
+        std::cout << get_renderer_failure(renderer) << "Failed to create a tile uniform." << std::endl;
+        return 1;
+    }
+
+    if (create_program(renderer, renderer.cube_map_program, CUBE_MAP_SHADER, "cube_map_shader_vertex", "cube_map_shader_fragment", "cube map") != 0 ||
+        create_program(renderer, renderer.irradiance_program, IRRADIANCE_SHADER, "irradiance_shader_vertex", "irradiance_shader_fragment", "irradiance map") != 0 ||
+        create_program(renderer, renderer.prefilter_program, PREFILTER_SHADER, "prefilter_map_shader_vertex", "prefilter_shader_fragment", "prefilter") != 0) {
+        // Error is printed in `create_program`.
+        return 1;
+    }
+
+    if (create_sample_uniform(renderer) != 0) {
+        // Error is printed in `create_sample_uniform`.
+        return 1;
+    }
+
+    const bgfx::Caps* caps = bgfx::getCaps();
+    constexpr uint64_t COMPUTE_CAPS = BGFX_CAPS_COMPUTE | BGFX_CAPS_TEXTURE_2D_ARRAY | BGFX_CAPS_TEXTURE_BLIT;
+    if (renderer.is_compute_allowed && (caps->supported & COMPUTE_CAPS) == COMPUTE_CAPS && (caps->formats[bgfx::TextureFormat::RGBA16F] & BGFX_CAPS_FORMAT_TEXTURE_IMAGE) != 0) {
+        renderer.inverse_view_projections_uniform = bgfx::createUniform("u_inverse_view_projections", bgfx::UniformType::Mat4, 6);
+        if (!bgfx::isValid(renderer.inverse_view_projections_uniform)) {
+            std::cout << get_renderer_failure(renderer) << "Failed to create an inverse view projections uniform." << std::endl;
+            return 1;
+        }
+
+        if (create_compute_program(renderer, renderer.cube_map_compute_program, CUBE_MAP_COMPUTE_SHADER, "cube_map_shader_compute", "cube map") != 0 ||
+            create_compute_program(renderer, renderer.irradiance_compute_program, IRRADIANCE_COMPUTE_SHADER, "irradiance_shader_compute", "irradiance map") != 0 ||
+            create_compute_program(renderer, renderer.prefilter_compute_program, PREFILTER_COMPUTE_SHADER, "prefilter_shader_compute", "prefilter") != 0) {
+            // Error is printed in `create_compute_program`.
+            return 1;
+        }
+
+        // Compute shaders reconstruct the directions the rasterizer would interpolate for every side render target.
+        // Image rows go from the top when the origin is at the top left, while NDC Y axis always points up.
+        const glm::mat4 flip = caps->originBottomLeft ? glm::mat4(1.f) : glm::scale(glm::mat4(1.f), glm::vec3(1.f, -1.f, 1.f));
+        for (size_t side = 0; side < 6; side++) {
+            renderer.cube_map_inverse_view_projections[side] = glm::inverse(CUBE_MAP_PROJECTION * renderer.cube_map_view_matrices[side]) * flip;
+        }
+
+        renderer.is_compute_supported = true;
+
+        if ((caps->formats[bgfx::TextureFormat::RGBA32U] & BGFX_CAPS_FORMAT_TEXTURE_IMAGE) != 0) {
+            if (create_compute_program(renderer, renderer.downsample_compute_program, DOWNSAMPLE_COMPUTE_SHADER, "downsample_shader_compute", "downsample") != 0 ||
+                create_compute_program(renderer, renderer.bc6h_compute_program, BC6H_COMPUTE_SHADER, "bc6h_shader_compute", "BC6H") != 0) {
+                // Error is printed in `create_compute_program`.
+                return 1;
+            }
+
+            renderer.is_bc6h_compute_supported = true;
+        }
+
+        if (renderer.is_gpu_mips && (caps->supported & BGFX_CAPS_TEXTURE_READ_BACK) != 0 &&
+            (caps->formats[bgfx::TextureFormat::RGBA32F] & BGFX_CAPS_FORMAT_TEXTURE_IMAGE) != 0) {
+            if (create_compute_program(renderer, renderer.mip_compute_program, MIP_COMPUTE_SHADER, "mip_shader_compute", "mip") != 0) {
+                // Error is printed in `create_compute_program`.
+                return 1;
+            }
+
+            renderer.is_mip_compute_supported = true;
+        }
+    }
+
+    renderer.initialized = true;
+    return 0;
+}
+
+// Texture region to read back, the layer is only used for texture arrays.
+struct BlitSource final {
+    bgfx::TextureHandle texture;
+    uint8_t mip_level;
+    uint16_t layer;
+};
+
+static void set_cube_map_compression_options(nvtt::CompressionOptions& compression_options, Compression compression, nvtt::Quality quality) noexcept {
+    compression_options.setQuality(quality);
+
+    switch (compression) {
+        case Compression::GOOD_BUT_SLOW:
+        case Compression::POOR_BUT_FAST:
+            compression_options.setFormat(nvtt::Format_BC6);
+            compression_options.setPixelType(nvtt::PixelType_Float);
+            break;
+        case Compression::NO_COMPRESSION:
+            // R16G16B16A16.
+            compression_options.setFormat(nvtt::Format_RGB);
+            compression_options.setPixelFormat(16, 16, 16, 16);
+            compression_options.setPixelType(nvtt::PixelType_Float);
+            break;
+    }
+}
+
+// Don't apply compression to tiny irradiance texture. Use R16G16B16A16 instead.
+static void set_irradiance_compression_options(nvtt::CompressionOptions& compression_options) noexcept {
+    compression_options.setFormat(nvtt::Format_RGB);
+    compression_options.setPixelFormat(16, 16, 16, 16);
+    compression_options.setPixelType(nvtt::PixelType_Float);
+}
+
+// nvtt can't write packed float formats to DDS, so irradiance is always compiled to R16G16B16A16 and packed here,
+// together with the DXGI format of the header. Half floats have more mantissa bits than either packed format.
+static void pack_irradiance_output(FileOutputHandler& output, IrradianceFormat format) noexcept {
+    if (format == IrradianceFormat::RGBA16F || output.data.size() < DDS10_HEADER_SIZE) {
+        return;
+    }
+
+    const size_t count = (output.data.size() - DDS10_HEADER_SIZE) / (sizeof(uint16_t) * 4);
+    std::vector<uint16_t> half_texels(count * 4);
+    std::memcpy(half_texels.data(), output.data.data() + DDS10_HEADER_SIZE, half_texels.size() * sizeof(uint16_t));
+
+    std::vector<float> texels(count * 4);
+    convert_rgba16f_to_rgba32f(half_texels.data(), texels.size(), texels.data());
+
+    std::vector<uint32_t> packed(count);
+    if (format == IrradianceFormat::R11G11B10F) {
+        pack_r11g11b10f(texels.data(), count, packed.data());
+    } else {
+        pack_rgb9e5(texels.data(), count, packed.data());
+    }
+
+    output.data.resize(DDS10_HEADER_SIZE + packed.size() * sizeof(uint32_t));
+    std::memcpy(output.data.data() + DDS10_HEADER_SIZE, packed.data(), packed.size() * sizeof(uint32_t));
+
+    const uint32_t dxgi_format = format == IrradianceFormat::R11G11B10F ? R11G11B10_FLOAT_DXGI_FORMAT : R9G9B9E5_SHAREDEXP_DXGI_FORMAT;
+    std::memcpy(output.data.data() + 128, &dxgi_format, sizeof(dxgi_format));
+}
+
+// Prefilter texture is BC6H like the cube map, every mip level down to 1x1 is padded to a 4x4 block. Without
+// compression it's R16G16B16A16.
+static void set_prefilter_compression_options(nvtt::CompressionOptions& compression_options, Compression compression, nvtt::Quality quality) noexcept {
+    switch (compression) {
+        case Compression::GOOD_BUT_SLOW:
+        case Compression::POOR_BUT_FAST:
+            set_cube_map_compression_options(compression_options, compression, quality);
+            break;
+        case Compression::NO_COMPRESSION:
+            compression_options.setFormat(nvtt::Format_RGBA);
+            compression_options.setPixelFormat(16, 16, 16, 16);
+            compression_options.setPixelType(nvtt::PixelType_Float);
+            break;
+    }
+}
+
+// Compression of a single cube map face on the thread pool. Faces are compressed into memory and written in face
+// order, so the output is the same as with sequential compression.
+struct CubeFaceCompression final {
+    CubeFaceCompression() noexcept = default;
+
+    CubeFaceCompression(const CubeFaceCompression&) = delete;
+    CubeFaceCompression(CubeFaceCompression&&) = delete;
+    CubeFaceCompression& operator=(const CubeFaceCompression&) = delete;
+    CubeFaceCompression& operator=(CubeFaceCompression&&) = delete;
+
+    // Tasks don't write to the job log directly, because the main thread keeps printing progress.
+    std::ostringstream log;
+    MemoryOutputHandler output;
+    bool is_compressed = false;
+    TaskGroup group;
+};
+
+// Pushes compression of a cube map face to the thread pool. `get_data` returns images of the first
+// `rendered_mip_levels` mip levels in `input_format`, the remaining mip levels are built from the last rendered one.
+// Images must stay alive until the face is written by `write_cube_faces`.
+static void push_cube_face_compression(const JobContext& context, CubeFaceCompression& face, int side, int size, int rendered_mip_levels, int total_mip_levels,
+                                       nvtt::InputFormat input_format, std::function<const void*(int mip_level)> get_data,
+                                       const nvtt::CompressionOptions& compression_options, const std::string& phase_prefix) noexcept {
+    context.pool.push(face.group, [&context, &face, side, size, rendered_mip_levels, total_mip_levels, input_format, get_data = std::move(get_data), &compression_options, phase_prefix] {
+        const std::string encode_phase = phase_prefix + "encode";
+        const std::string filter_phase = phase_prefix + "filter";
+
+        TextureCompilerErrorHandler error_handler(face.log);
+
+        nvtt::OutputOptions output_options;
+        output_options.setOutputHandler(&face.output);
+        output_options.setContainer(nvtt::Container_DDS10);
+        output_options.setErrorHandler(&error_handler);
+
+        nvtt::Surface surface;
+        for (int mip_level = 0; mip_level < total_mip_levels; mip_level++) {
+            if (mip_level < rendered_mip_levels) {
+                const int mip_size = std::max(size >> mip_level, 1);
+                if (!surface.setImage(input_format, mip_size, mip_size, 1, get_data(mip_level))) {
+                    face.log << "\rTexture compiler error. Failed to set an image." << std::endl;
+                    return;
+                }
+            } else {
+                PhaseTimer filter_timer(context.metrics, filter_phase.c_str(), mip_level, side);
+                if (!surface.buildNextMipmap(nvtt::MipmapFilter_Box)) {
+                    face.log << "\rTexture compiler error. Failed to build a cube map mip map." << std::endl;
+                    return;
+                }
+            }
+
+            PhaseTimer encode_timer(context.metrics, encode_phase.c_str(), mip_level, side);
+            if (!context.compressor.compress(surface, side, mip_level, compression_options, output_options)) {
+                // Error is printed via `error_handler`.
+                return;
+            }
+        }
+
+        face.is_compressed = true;
+    });
+}
+
+// Pushes BC6H encoding of a cube map face to the thread pool, the fast encoder's version of
+// `push_cube_face_compression`. `get_data` returns every mip level in RGBA half floats, which must stay alive until the
+// face is written by `write_cube_faces`.
+static void push_cube_face_bc6h(const JobContext& context, CubeFaceCompression& face, int side, size_t size, int total_mip_levels,
+                                std::function<const uint16_t*(int mip_level)> get_data, const std::string& phase_prefix) noexcept {
+    context.pool.push(face.group, [&context, &face, side, size, total_mip_levels, get_data = std::move(get_data), phase_prefix] {
+        const std::string encode_phase = phase_prefix + "encode";
+
+        try {
+            for (int mip_level = 0; mip_level < total_mip_levels; mip_level++) {
+                const size_t mip_size = std::max<size_t>(size >> mip_level, 1);
+
+                PhaseTimer encode_timer(context.metrics, encode_phase.c_str(), mip_level, side);
+
+                const size_t blocks = (mip_size + 3) / 4;
+                const size_t offset = face.output.data.size();
+                face.output.data.resize(offset + blocks * blocks * 16);
+                encode_bc6h_rows(get_data(mip_level), mip_size, 0, blocks, reinterpret_cast<uint8_t*>(face.output.data.data() + offset));
+            }
+        } catch (const std::exception& exception) {
+            face.log << "\rTexture compiler error. Failed to encode BC6H: " << exception.what() << "." << std::endl;
+            return;
+        }
+
+        face.is_compressed = true;
+    });
+}
+
+// Pushes copying of a cube map face read back in RGBA half floats to the thread pool, the version of
+// `push_cube_face_compression` for uncompressed R16G16B16A16 outputs, which nvtt would only convert to floats and
+// back. `get_data` returns every mip level, which must stay alive until the face is written by `write_cube_faces`.
+static void push_cube_face_rgba16f(const JobContext& context, CubeFaceCompression& face, int side, size_t size, int total_mip_levels,
+                                   std::function<const uint16_t*(int mip_level)> get_data, const std::string& phase_prefix) noexcept {
+    context.pool.push(face.group, [&context, &face, side, size, total_mip_levels, get_data = std::move(get_data), phase_prefix] {
+        const std::string encode_phase = phase_prefix + "encode";
+
+        try {
+            size_t face_size = 0;
+            for (int mip_level = 0; mip_level < total_mip_levels; mip_level++) {
+                const size_t mip_size = std::max<size_t>(size >> mip_level, 1);
+                face_size += mip_size * mip_size * 4 * sizeof(uint16_t);
+            }
+            face.output.data.reserve(face_size);
+
+            for (int mip_level = 0; mip_level < total_mip_levels; mip_level++) {
+                const size_t mip_size = std::max<size_t>(size >> mip_level, 1);
+
+                PhaseTimer encode_timer(context.metrics, encode_phase.c_str(), mip_level, side);
+
+                const auto* bytes = reinterpret_cast<const char*>(get_data(mip_level));
+                face.output.data.insert(face.output.data.end(), bytes, bytes + mip_size * mip_size * 4 * sizeof(uint16_t));
+            }
+        } catch (const std::exception& exception) {
+            face.log << "\rTexture compiler error. Failed to copy a cube map face: " << exception.what() << "." << std::endl;
+            return;
+        }
+
+        face.is_compressed = true;
+    });
+}
+
+// Waits for the faces in face order and writes them to the output. Octahedral maps are written as a single face.
+template <size_t FaceCount>
+static int write_cube_faces(const JobContext& context, CubeFaceCompression (&faces)[FaceCount], nvtt::OutputHandler& output) noexcept {
+    // Tasks reference the faces, so every face must be finished even if one of them failed.
+    bool is_failed = false;
+    for (size_t side = 0; side < FaceCount; side++) {
+        CubeFaceCompression& face = faces[side];
+
+        context.pool.wait(face.group);
+        context.log << face.log.str();
+
+        if (is_failed || !face.is_compressed) {
+            is_failed = true;
+            continue;
+        }
+
+        if (!output.writeData(face.output.data.data(), static_cast<int>(face.output.data.size()))) {
+            context.log << "\rTexture compiler error. Failed to write a cube map face." << std::endl;
+            is_failed = true;
+            continue;
+        }
+
+        report_progress(context, "\r", static_cast<int>((side + 1) * 100.f / FaceCount));
+    }
+
+    return is_failed ? 1 : 0;
+}
+
+// Longest sleep between the frames of `wait_for_frame`.
+static constexpr std::chrono::microseconds MAX_FRAME_WAIT_SLEEP(1000);
+
+// Adds GPU times of the views executed by the last frame to the times of the current job and updates the peak of its
+// texture memory. Renderers without timer queries report zero frequency and no times are added.
+static void collect_gpu_view_times(Renderer& renderer) noexcept {
+    const bgfx::Stats* stats = bgfx::getStats();
+    if (stats == nullptr) {
+        return;
+    }
+
+    const int64_t gpu_memory_usage = std::max<int64_t>(stats->textureMemoryUsed, 0) + std::max<int64_t>(stats->rtMemoryUsed, 0);
+    renderer.peak_gpu_memory_usage = std::max(renderer.peak_gpu_memory_usage, static_cast<uint64_t>(gpu_memory_usage));
+
+    if (stats->gpuTimerFreq <= 0) {
+        return;
+    }
+
+    for (uint16_t i = 0; i < stats->numViews; i++) {
+        const bgfx::ViewStats& view_stats = stats->viewStats[i];
+        if (view_stats.gpuTimeElapsed <= 0) {
+            continue;
+        }
+
+        const double gpu_seconds = static_cast<double>(view_stats.gpuTimeElapsed) / static_cast<double>(stats->gpuTimerFreq);
+        auto it = std::find_if(renderer.gpu_views.begin(), renderer.gpu_views.end(), [&view_stats](const GpuViewMetrics& view) {
+            return view.name == view_stats.name;
+        });
+        if (it != renderer.gpu_views.end()) {
+            it->gpu_seconds += gpu_seconds;
+        } else {
+            renderer.gpu_views.push_back(GpuViewMetrics { view_stats.name, gpu_seconds });
+        }
+    }
+}
+
+// Moves the GPU times of the views of the job that just finished to its metrics and prints them with `--verbose`.
+static void report_gpu_view_times(Renderer& renderer, const JobContext& context) noexcept {
+    if (renderer.is_verbose) {
+        double total_seconds = 0.0;
+        for (const GpuViewMetrics& view : renderer.gpu_views) {
+            context.log << "View " << view.name << " took " << std::setprecision(3) << view.gpu_seconds * 1000.0 << " milliseconds on the GPU." << std::endl;
+            total_seconds += view.gpu_seconds;
+        }
+        if (renderer.gpu_views.empty()) {
+            context.log << "Renderer reported no GPU times." << std::endl;
+        } else {
+            context.log << "Views took " << std::setprecision(3) << total_seconds * 1000.0 << " milliseconds on the GPU in total." << std::endl;
+        }
+        if (renderer.peak_gpu_memory_usage != 0) {
+            context.log << "Textures took at most " << std::setprecision(4) << static_cast<double>(renderer.peak_gpu_memory_usage) / (1024.0 * 1024.0) << " megabytes of GPU memory." << std::endl;
+        }
+    }
+
+    if (context.metrics != nullptr) {
+        context.metrics->gpu_views = std::move(renderer.gpu_views);
+        context.metrics->peak_gpu_memory_usage = renderer.peak_gpu_memory_usage;
+    }
+    renderer.gpu_views.clear();
+    renderer.peak_gpu_memory_usage = 0;
+}
+
+// bgfx has no fences, read backs are complete once `bgfx::frame` returns the frame number of `bgfx::readTexture`.
+// Frames are submitted until then, and between them the thread sleeps for a growing delay, so waiting for a slow GPU
+// doesn't keep a core busy with empty frames while the `--jobs` threads compress. Returns the last frame number.
+static uint32_t wait_for_frame(Renderer& renderer, uint32_t current_frame_id, uint32_t frame_id) noexcept {
+    std::chrono::microseconds sleep(50);
+    while (current_frame_id < frame_id) {
+        current_frame_id = bgfx::frame();
+        if (renderer.is_profiling) {
+            collect_gpu_view_times(renderer);
+        }
+        if (current_frame_id < frame_id) {
+            std::this_thread::sleep_for(sleep);
+            sleep = std::min(sleep * 2, MAX_FRAME_WAIT_SLEEP);
+        }
+    }
+    return current_frame_id;
+}
+
+// Flags of `u_settings.z` of the mip shader.
+static float get_mip_shader_flags(const MipFilterOptions& options) noexcept {
+    return static_cast<float>((options.is_srgb ? 1 : 0) | (options.is_alpha_roughness ? 2 : 0) | (options.is_normal_map ? 4 : 0));
+}
+
+static void release_mip_level_pixels(void*, void* pixels) {
+    delete static_cast<std::vector<float>*>(pixels);
+}
+
+static bool build_gpu_mip_chains(const JobContext& context, int width, int height, int total_mip_levels, std::vector<GpuMipChain>& chains) noexcept {
+    Renderer& renderer = *context.renderer;
+    PhaseTimer gpu_mips_timer(context.metrics, "gpu_mips");
+
+    // Every level is downsampled from the previous one, so dispatches must run in the order they are submitted. Blits
+    // of the next view run after all of them.
+    const bgfx::ViewId compute_view = 0;
+    const bgfx::ViewId read_back_view = 1;
+    bgfx::setViewName(compute_view, "mip_compute_view");
+    bgfx::setViewMode(compute_view, bgfx::ViewMode::Sequential);
+    bgfx::setViewName(read_back_view, "mip_read_back_view");
+
+    const size_t level_count = static_cast<size_t>(total_mip_levels);
+    const int band_rows = get_band_rows(width, height);
+
+    // Textures are destroyed by bgfx once the GPU is done with them, pixels of levels below level 0 are written by
+    // `readTexture` and must outlive the frame of the read back even when a later chain fails.
+    std::vector<HandleWrapper<bgfx::TextureHandle>> textures;
+    std::vector<std::vector<float>> pixels(chains.size() * level_count);
+    uint32_t frame_id = 0;
+    bool is_submitted = true;
+
+    // Levels get the modes of the level 0 of their chain.
+    std::vector<nvtt::Surface> first_bands(chains.size());
+
+    try {
+        nvtt::Surface band;
+        for (size_t chain = 0; chain < chains.size() && is_submitted; chain++) {
+            // Level 0 is interleaved band by band into memory bgfx frees once it's uploaded.
+            auto level_pixels = std::make_unique<std::vector<float>>(static_cast<size_t>(width) * static_cast<size_t>(height) * 4);
+            for (int row_begin = 0; row_begin < height; row_begin += band_rows) {
+                const int row_count = std::min(band_rows, height - row_begin);
+                if (!chains[chain].set_band(row_begin, row_count, band)) {
+                    is_submitted = false;
+                    break;
+                }
+                if (row_begin == 0) {
+                    first_bands[chain] = band;
+                }
+
+                float* destination = level_pixels->data() + static_cast<size_t>(row_begin) * static_cast<size_t>(width) * 4;
+                const size_t pixel_count = static_cast<size_t>(width) * static_cast<size_t>(row_count);
+                for (int channel = 0; channel < 4; channel++) {
+                    const float* source = band.channel(channel);
+                    for (size_t i = 0; i < pixel_count; i++) {
+                        destination[i * 4 + static_cast<size_t>(channel)] = source[i];
+                    }
+                }
+            }
+            if (!is_submitted) {
+                break;
+            }
+
+            const uint32_t size = static_cast<uint32_t>(level_pixels->size() * sizeof(float));
+            const bgfx::Memory* memory = bgfx::makeRef(level_pixels->data(), size, release_mip_level_pixels, level_pixels.get());
+            level_pixels.release();
+
+            const size_t first_texture = textures.size();
+            textures.emplace_back(bgfx::createTexture2D(static_cast<uint16_t>(width), static_cast<uint16_t>(height), false, 1, bgfx::TextureFormat::RGBA32F,
+                                                        BGFX_TEXTURE_COMPUTE_WRITE | BGFX_SAMPLER_U_CLAMP | BGFX_SAMPLER_V_CLAMP, memory));
+            if (!bgfx::isValid(textures.back())) {
+                is_submitted = false;
+                break;
+            }
+            bgfx::setName(textures.back(), "mip_level_texture");
+
+            const float flags = get_mip_shader_flags(chains[chain].options);
+            int level_width = width;
+            int level_height = height;
+            for (size_t mip_level = 1; mip_level < level_count; mip_level++) {
+                const float settings[4] = { static_cast<float>(level_width), static_cast<float>(level_height), flags, 0.f };
+                level_width = std::max(level_width / 2, 1);
+                level_height = std::max(level_height / 2, 1);
+
+                const bgfx::TextureHandle previous = textures.back();
+                textures.emplace_back(bgfx::createTexture2D(static_cast<uint16_t>(level_width), static_cast<uint16_t>(level_height), false, 1, bgfx::TextureFormat::RGBA32F,
+                                                            BGFX_TEXTURE_COMPUTE_WRITE | BGFX_SAMPLER_U_CLAMP | BGFX_SAMPLER_V_CLAMP));
+                if (!bgfx::isValid(textures.back())) {
+                    is_submitted = false;
+                    break;
+                }
+                bgfx::setName(textures.back(), "mip_level_texture");
+
+                bgfx::setUniform(renderer.settings_uniform, settings);
+                bgfx::setImage(0, previous, 0, bgfx::Access::Read, bgfx::TextureFormat::RGBA32F);
+                bgfx::setImage(1, textures.back(), 0, bgfx::Access::Write, bgfx::TextureFormat::RGBA32F);
+                bgfx::dispatch(compute_view, renderer.mip_compute_program, (static_cast<uint32_t>(level_width) + 7U) / 8U, (static_cast<uint32_t>(level_height) + 7U) / 8U, 1);
+            }
+            if (!is_submitted) {
+                break;
+            }
+
+            level_width = width;
+            level_height = height;
+            for (size_t mip_level = 1; mip_level < level_count; mip_level++) {
+                level_width = std::max(level_width / 2, 1);
+                level_height = std::max(level_height / 2, 1);
+
+                // `BGFX_TEXTURE_COMPUTE_WRITE` and `BGFX_TEXTURE_READ_BACK` are not compatible, so levels are blitted to
+                // these textures and read back from them.
+                HandleWrapper<bgfx::TextureHandle>& read_back = textures.emplace_back(bgfx::createTexture2D(
+                        static_cast<uint16_t>(level_width), static_cast<uint16_t>(level_height), false, 1, bgfx::TextureFormat::RGBA32F,
+                        BGFX_TEXTURE_BLIT_DST | BGFX_TEXTURE_READ_BACK | BGFX_SAMPLER_U_CLAMP | BGFX_SAMPLER_V_CLAMP));
+                if (!bgfx::isValid(read_back)) {
+                    is_submitted = false;
+                    break;
+                }
+                bgfx::setName(read_back, "mip_read_back_texture");
+
+                bgfx::blit(read_back_view, read_back, 0, 0, 0, 0, textures[first_texture + mip_level], 0, 0, 0, 0, static_cast<uint16_t>(level_width),
+                           static_cast<uint16_t>(level_height));
+
+                std::vector<float>& level_data = pixels[chain * level_count + mip_level];
+                level_data.resize(static_cast<size_t>(level_width) * static_cast<size_t>(level_height) * 4);
+                frame_id = std::max(frame_id, bgfx::readTexture(read_back, level_data.data()));
+            }
+        }
+    } catch (...) {
+        is_submitted = false;
+    }
+
+    // Read backs write to `pixels` until their frame, so it's waited for even when submission failed.
+    PhaseTimer readback_timer(context.metrics, "gpu_mips_readback");
+    wait_for_frame(renderer, 0, frame_id);
+    readback_timer.stop();
+    textures.clear();
+
+    report_gpu_view_times(renderer, context);
+
+    if (!is_submitted) {
+        return false;
+    }
+
+    for (size_t chain = 0; chain < chains.size(); chain++) {
+        std::vector<nvtt::Surface>& levels = chains[chain].levels;
+        levels.clear();
+        levels.resize(level_count - 1);
+
+        int level_width = width;
+        int level_height = height;
+        for (size_t mip_level = 1; mip_level < level_count; mip_level++) {
+            level_width = std::max(level_width / 2, 1);
+            level_height = std::max(level_height / 2, 1);
+
+            nvtt::Surface& level = levels[mip_level - 1];
+            if (!level.setImage(nvtt::InputFormat_RGBA_32F, level_width, level_height, 1, pixels[chain * level_count + mip_level].data())) {
+                return false;
+            }
+            level.setWrapMode(first_bands[chain].wrapMode());
+            level.setAlphaMode(first_bands[chain].alphaMode());
+            level.setNormalMap(first_bands[chain].isNormalMap());
+
+            // Level is a copy, so its pixels aren't needed any more.
+            pixels[chain * level_count + mip_level] = std::vector<float>();
+        }
+    }
+    return true;
+}
+
+// Samples of the environment a frame of irradiance or prefilter convolution takes at most. Drivers reset the GPU when
+// a single submission runs for too long, two seconds on Windows, and a single dispatch or draw of a large irradiance
+// map or of a prefilter map with many samples can take that long on a slow GPU, which loses the whole process. A
+// frame of this budget takes milliseconds on a desktop GPU and a fraction of a second on an integrated one.
+static constexpr double MAX_FRAME_CONVOLUTION_SAMPLES = 256.0 * 1024.0 * 1024.0;
+
+// Side of the square tiles the convolution of a `size` by `size` face with `sample_count` samples per texel is split
+// into, for `face_count` faces at a time, so a tile fits into `MAX_FRAME_CONVOLUTION_SAMPLES`. Tiles are multiples of
+// the 8x8 groups of the compute shaders, so their dispatches don't overlap, and the whole face when it fits.
+static uint16_t get_convolution_tile_size(uint16_t size, double sample_count, uint16_t face_count) noexcept {
+    uint16_t tile_size = size;
+    while (tile_size > 8 && static_cast<double>(tile_size) * tile_size * face_count * sample_count > MAX_FRAME_CONVOLUTION_SAMPLES) {
+        tile_size = static_cast<uint16_t>(std::max((tile_size / 2 + 7) / 8 * 8, 8));
+    }
+    return tile_size;
+}
+
+// Submits tiles of convolutions in frames of at most `MAX_FRAME_CONVOLUTION_SAMPLES`. Every frame is a submission of
+// its own to the driver, so no single one runs long enough for a reset. Small convolutions fit into the frame of the
+// views around them and cost no extra frames.
+struct ConvolutionFrames final {
+    explicit ConvolutionFrames(Renderer& renderer) noexcept
+            : renderer(renderer) {
+    }
+
+    ConvolutionFrames(const ConvolutionFrames&) = delete;
+    ConvolutionFrames(ConvolutionFrames&&) = delete;
+    ConvolutionFrames& operator=(const ConvolutionFrames&) = delete;
+    ConvolutionFrames& operator=(ConvolutionFrames&&) = delete;
+
+    // Called before a tile of `samples` is submitted, ends the current frame first when the tile doesn't fit into it.
+    // Returns true when a frame was ended.
+    bool add(double samples) noexcept {
+        const bool is_frame_ended = frame_samples > 0.0 && frame_samples + samples > MAX_FRAME_CONVOLUTION_SAMPLES;
+        if (is_frame_ended) {
+            bgfx::frame();
+            if (renderer.is_profiling) {
+                collect_gpu_view_times(renderer);
+            }
+            frame_samples = 0.0;
+        }
+        frame_samples += samples;
+        return is_frame_ended;
+    }
+
+    Renderer& renderer;
+    double frame_samples = 0.0;
+};
+
+// Submits the draw of `submit` to `view` a scissor tile at a time, the draw of a cube face convolution covers the whole
+// view. A view is cleared in every frame it has draws in, so after its first frame its clear is turned off, otherwise
+// the tiles of earlier frames would be lost.
+static void submit_convolution_tiles(ConvolutionFrames& frames, bgfx::ViewId view, uint16_t size, double sample_count, const std::function<void()>& submit) {
+    const uint16_t tile_size = get_convolution_tile_size(size, sample_count, 1);
+    bool is_submitted = false;
+    for (uint16_t tile_y = 0; tile_y < size; tile_y = static_cast<uint16_t>(tile_y + tile_size)) {
+        for (uint16_t tile_x = 0; tile_x < size; tile_x = static_cast<uint16_t>(tile_x + tile_size)) {
+            const uint16_t tile_width = std::min<uint16_t>(tile_size, static_cast<uint16_t>(size - tile_x));
+            const uint16_t tile_height = std::min<uint16_t>(tile_size, static_cast<uint16_t>(size - tile_y));
+            if (frames.add(static_cast<double>(tile_width) * tile_height * sample_count) && is_submitted) {
+                bgfx::setViewClear(view, BGFX_CLEAR_NONE);
+            }
+
+            if (tile_size < size) {
+                bgfx::setScissor(tile_x, tile_y, tile_width, tile_height);
+            }
+            submit();
+            is_submitted = true;
+        }
+    }
+}
+
+// Runs the callback of `set_gpu_idle_callback` once the last faces of a cube map job are read back and their compression
+// is pushed, so the GPU renders the job the callback compiles while the thread pool compresses these faces. The callback
+// is taken before it runs, so a job it compiles doesn't run it again, and the GPU view times of the current job are put
+// aside meanwhile, because the nested job reports its own.
+static void run_gpu_idle_callback(Renderer& renderer) noexcept {
+    if (!renderer.gpu_idle_callback) {
+        return;
+    }
+
+    const std::function<void()> callback = std::move(renderer.gpu_idle_callback);
+    renderer.gpu_idle_callback = nullptr;
+
+    std::vector<GpuViewMetrics> gpu_views = std::move(renderer.gpu_views);
+    const uint64_t peak_gpu_memory_usage = renderer.peak_gpu_memory_usage;
+    renderer.gpu_views.clear();
+    renderer.peak_gpu_memory_usage = 0;
+
+    const auto before = std::chrono::steady_clock::now();
+    callback();
+    renderer.gpu_idle_seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - before).count();
+
+    renderer.gpu_views = std::move(gpu_views);
+    renderer.peak_gpu_memory_usage = peak_gpu_memory_usage;
+}
+
+// Position of a face mip level in the read back atlas of `read_back_and_compress_cube`, which is three times the size of
+// the cube map: the first mip levels of the faces fill three columns of two rows, and the following mip levels of all six
+// faces take a row each below them, half as high as the row before.
+struct CubeAtlasOffset final {
+    uint16_t x;
+    uint16_t y;
+};
+
+static CubeAtlasOffset get_cube_atlas_offset(uint16_t size, int side, int mip_level) noexcept {
+    if (mip_level == 0) {
+        return CubeAtlasOffset { static_cast<uint16_t>(side % 3 * size), static_cast<uint16_t>(side / 3 * size) };
+    }
+
+    uint32_t y = 2U * size;
+    for (int level = 1; level < mip_level; level++) {
+        y += std::max(size >> level, 1);
+    }
+    const uint32_t mip_size = std::max(size >> mip_level, 1);
+    return CubeAtlasOffset { static_cast<uint16_t>(static_cast<uint32_t>(side) * mip_size), static_cast<uint16_t>(y) };
+}
+
+// Reads back all the faces of a cube map from the GPU in a single frame through a single atlas, see
+// `get_cube_atlas_offset`, and compresses every face on the thread pool.
+//
+// `get_texture` returns textures for the first `rendered_mip_levels` mip levels of every face. The remaining
+// mip levels are built on the CPU from the last rendered one. Mip levels after the first one get `fix_cube_map_seams`,
+// which is what `downsample_shader` already did for the levels it built, but not the mip generation of frame buffers.
+// Faces are encoded by `push_cube_face_bc6h` or copied by `push_cube_face_rgba16f` instead of nvtt depending on
+// `encoder`, both must get every mip level.
+//
+// `while_compressing` runs on the calling thread once the faces are read back and their compression is pushed, before
+// it's waited for, so GPU work submitted there overlaps the compression and its own read back waits for the GPU while
+// the `--jobs` threads compress. bgfx runs a single queue and has no fences, so this is how GPU stages stop waiting
+// for the CPU between frames. The time spent waiting for the compression afterwards is the `compress_wait` phase.
+// Stages run in `while_compressing` finish first, so the first stage to get past it has the last faces of the job and
+// runs `run_gpu_idle_callback`.
+static int read_back_and_compress_cube(Renderer& renderer, const JobContext& context, bgfx::ViewId view, uint16_t size, int rendered_mip_levels, int total_mip_levels,
+                                       const std::function<BlitSource(int side, int mip_level)>& get_texture, const nvtt::CompressionOptions& compression_options,
+                                       CubeFaceEncoder encoder, nvtt::OutputHandler& output, const char* phase_prefix, const std::function<int()>& while_compressing = {}) noexcept {
+    const std::string readback_phase = std::string(phase_prefix) + "readback";
+    const std::string compress_wait_phase = std::string(phase_prefix) + "compress_wait";
+
+    struct Face final {
+        std::vector<std::vector<uint16_t>> data;
+    };
+
+    Face faces[6];
+    CubeFaceCompression compressions[6];
+
+    for (int side = 0; side < 6; side++) {
+        faces[side].data.resize(static_cast<size_t>(rendered_mip_levels));
+        for (int mip_level = 0; mip_level < rendered_mip_levels; mip_level++) {
+            const size_t mip_size = std::max<size_t>(size >> mip_level, 1);
+            faces[side].data[mip_level].resize(mip_size * mip_size * 4);
+        }
+    }
+
+    // Every face and mip level is blitted to a single atlas and read back with a single `readTexture`, because every
+    // read back maps a texture on the render thread. Only cube maps too large for an atlas read back level by level.
+    const uint32_t atlas_size = 3U * size;
+    const bool is_atlas = atlas_size <= bgfx::getCaps()->limits.maxTextureSize;
+
+    std::vector<StagingTexture> blit_textures;
+    std::vector<uint16_t> atlas;
+    uint32_t frame_id = 0;
+
+    if (is_atlas) {
+        StagingTexture& staging_texture = blit_textures.emplace_back(renderer.staging_textures, static_cast<uint16_t>(atlas_size), bgfx::TextureFormat::RGBA16F);
+        if (!bgfx::isValid(staging_texture.handle)) {
+            context.log << "\rTexture compiler error. Failed to create a read back texture." << std::endl;
+            return 1;
+        }
+
+        for (int side = 0; side < 6; side++) {
+            for (int mip_level = 0; mip_level < rendered_mip_levels; mip_level++) {
+                const uint16_t mip_size = std::max(static_cast<uint16_t>(size >> mip_level), static_cast<uint16_t>(1));
+                const CubeAtlasOffset offset = get_cube_atlas_offset(size, side, mip_level);
+
+                const BlitSource source = get_texture(side, mip_level);
+                bgfx::blit(view, staging_texture.handle, 0, offset.x, offset.y, 0, source.texture, source.mip_level, 0, 0, source.layer, mip_size, mip_size);
+            }
+        }
+
+        atlas.resize(static_cast<size_t>(atlas_size) * atlas_size * 4);
+        frame_id = bgfx::readTexture(staging_texture.handle, atlas.data());
+    } else {
+        for (int side = 0; side < 6; side++) {
+            for (int mip_level = 0; mip_level < rendered_mip_levels; mip_level++) {
+                const uint16_t mip_size = std::max(static_cast<uint16_t>(size >> mip_level), static_cast<uint16_t>(1));
+
+                StagingTexture& staging_texture = blit_textures.emplace_back(renderer.staging_textures, mip_size, bgfx::TextureFormat::RGBA16F);
+                if (!bgfx::isValid(staging_texture.handle)) {
+                    context.log << "\rTexture compiler error. Failed to create a read back texture." << std::endl;
+                    return 1;
+                }
+
+                const BlitSource source = get_texture(side, mip_level);
+                bgfx::blit(view, staging_texture.handle, 0, 0, 0, 0, source.texture, source.mip_level, 0, 0, source.layer, mip_size, mip_size);
+                frame_id = std::max(frame_id, bgfx::readTexture(staging_texture.handle, faces[side].data[mip_level].data()));
+            }
+        }
+    }
+
+    // Seams of a mip level need all six faces, so compression waits for all of them anyway.
+    PhaseTimer readback_timer(context.metrics, readback_phase.c_str());
+    wait_for_frame(renderer, 0, frame_id);
+    readback_timer.stop();
+
+    // Read back is complete, so the textures can be reused by the following stages and jobs.
+    blit_textures.clear();
+
+    if (is_atlas) {
+        for (int side = 0; side < 6; side++) {
+            for (int mip_level = 0; mip_level < rendered_mip_levels; mip_level++) {
+                const size_t mip_size = std::max<size_t>(size >> mip_level, 1);
+                const CubeAtlasOffset offset = get_cube_atlas_offset(size, side, mip_level);
+
+                for (size_t y = 0; y < mip_size; y++) {
+                    const uint16_t* const row = atlas.data() + ((offset.y + y) * atlas_size + offset.x) * 4;
+                    std::copy_n(row, mip_size * 4, faces[side].data[mip_level].data() + y * mip_size * 4);
+                }
+            }
+        }
+
+        // Faces have their own copies now, which is all the compression needs.
+        std::vector<uint16_t>().swap(atlas);
+    }
+
+    for (int mip_level = 1; mip_level < rendered_mip_levels; mip_level++) {
+        uint16_t* const mip_faces[6] = { faces[0].data[mip_level].data(), faces[1].data[mip_level].data(), faces[2].data[mip_level].data(),
+                                         faces[3].data[mip_level].data(), faces[4].data[mip_level].data(), faces[5].data[mip_level].data() };
+        fix_cube_map_seams_rgba16f(mip_faces, std::max<size_t>(size >> mip_level, 1));
+    }
+
+    for (int side = 0; side < 6; side++) {
+        Face& face = faces[side];
+
+        if (encoder == CubeFaceEncoder::BC6H) {
+            push_cube_face_bc6h(context, compressions[side], side, size, total_mip_levels, [&face](int mip_level) {
+                return face.data[mip_level].data();
+            }, phase_prefix);
+            continue;
+        }
+
+        if (encoder == CubeFaceEncoder::RGBA16F) {
+            push_cube_face_rgba16f(context, compressions[side], side, size, total_mip_levels, [&face](int mip_level) {
+                return face.data[mip_level].data();
+            }, phase_prefix);
+            continue;
+        }
+
+        const auto get_data = [&face](int mip_level) -> const void* {
+            return face.data[mip_level].data();
+        };
+        push_cube_face_compression(context, compressions[side], side, size, rendered_mip_levels, total_mip_levels, nvtt::InputFormat_RGBA_16F, get_data, compression_options, phase_prefix);
+    }
+
+    // Tasks reference the faces, so they're waited for even when `while_compressing` fails.
+    const bool is_overlap_failed = while_compressing && while_compressing() != 0;
+    if (!is_overlap_failed) {
+        run_gpu_idle_callback(renderer);
+    }
+
+    PhaseTimer compress_wait_timer(context.metrics, compress_wait_phase.c_str());
+    const int result = write_cube_faces(context, compressions, output);
+    compress_wait_timer.stop();
+    return is_overlap_failed ? 1 : result;
+}
+
+// Copies the first `mip_levels` mip levels of every face of the cube map rendered for `output` to its texture of
+// `Renderer::preview_textures` instead of reading them back like `read_back_and_compress_cube`, for
+// `compile_image_preview`. Outputs without a texture are skipped. The host's texture is wrapped in a texture of bgfx by
+// `bgfx::overrideInternal`, which only works once bgfx has created a texture of its own for the handle, so a frame is
+// rendered before the copies and another one after them, both on this thread, which is the render thread of a context
+// with a host device. The seams of the mip levels after the first one, which `read_back_and_compress_cube` fixes on the
+// CPU, are fixed by `downsample_shader` in the first frame, so on renderers with compute shaders the preview matches
+// the saved output. `while_compressing` runs once the copies are submitted, like after a read back.
+static int copy_to_preview_texture(Renderer& renderer, const JobContext& context, bgfx::ViewId view, const std::string& output, uint16_t size, int mip_levels,
+                                   const std::function<BlitSource(int side, int mip_level)>& get_texture, const char* phase_prefix,
+                                   const std::function<int()>& while_compressing = {}) noexcept {
+    const auto it = std::find_if(renderer.preview_textures->begin(), renderer.preview_textures->end(), [&output](const PreviewTexture& texture) {
+        return texture.output == output;
+    });
+
+    if (it != renderer.preview_textures->end()) {
+        const std::string copy_phase = std::string(phase_prefix) + "preview_copy";
+        PhaseTimer copy_timer(context.metrics, copy_phase.c_str());
+
+        HandleWrapper<bgfx::TextureHandle> texture = bgfx::createTextureCube(size, mip_levels > 1, 1, bgfx::TextureFormat::RGBA16F, BGFX_TEXTURE_BLIT_DST);
+        if (!bgfx::isValid(texture)) {
+            context.log << "Texture compiler error. Failed to create a preview texture." << std::endl;
+            return 1;
+        }
+        bgfx::setName(texture, "preview_texture");
+
+        // Levels are fixed in a texture array half the size of the output, whose first mip level is the second one of
+        // the output. Levels `downsample_shader` already built stay the same.
+        RenderTarget seam_input;
+        RenderTarget seam_output;
+        const bool is_seam_fixed = mip_levels > 1 && renderer.is_compute_supported && bgfx::isValid(renderer.downsample_compute_program);
+        if (is_seam_fixed) {
+            const uint16_t seam_size = static_cast<uint16_t>(size / 2);
+            seam_input = RenderTarget(renderer.render_targets, RenderTargetDescription { false, seam_size, true, 6, bgfx::TextureFormat::RGBA16F,
+                                                                                         BGFX_TEXTURE_COMPUTE_WRITE | BGFX_TEXTURE_BLIT_DST });
+            seam_output = RenderTarget(renderer.render_targets, RenderTargetDescription { false, seam_size, true, 6, bgfx::TextureFormat::RGBA16F, BGFX_TEXTURE_COMPUTE_WRITE });
+            if (!bgfx::isValid(seam_input) || !bgfx::isValid(seam_output)) {
+                context.log << "Texture compiler error. Failed to create a preview seam texture." << std::endl;
+                return 1;
+            }
+
+            // Blits of a view are executed before its dispatches.
+            bgfx::setViewName(view, "preview_seam_view");
+            for (int side = 0; side < 6; side++) {
+                for (int mip_level = 1; mip_level < mip_levels; mip_level++) {
+                    const uint16_t mip_size = std::max(static_cast<uint16_t>(size >> mip_level), static_cast<uint16_t>(1));
+                    const BlitSource source = get_texture(side, mip_level);
+                    bgfx::blit(view, seam_input, static_cast<uint8_t>(mip_level - 1), 0, 0, static_cast<uint16_t>(side), source.texture, source.mip_level, 0, 0, source.layer, mip_size,
+                               mip_size);
+                }
+            }
+
+            for (int mip_level = 1; mip_level < mip_levels; mip_level++) {
+                const uint16_t mip_size = std::max(static_cast<uint16_t>(size >> mip_level), static_cast<uint16_t>(1));
+                const float settings[4] = { static_cast<float>(mip_size), static_cast<float>(mip_size), 1.f, 0.f };
+                bgfx::setUniform(renderer.settings_uniform, settings);
+
+                bgfx::setImage(0, seam_input, static_cast<uint8_t>(mip_level - 1), bgfx::Access::Read, bgfx::TextureFormat::RGBA16F);
+                bgfx::setImage(1, seam_output, static_cast<uint8_t>(mip_level - 1), bgfx::Access::Write, bgfx::TextureFormat::RGBA16F);
+
+                const uint32_t group_count = (mip_size + 7U) / 8U;
+                bgfx::dispatch(view, renderer.downsample_compute_program, group_count, group_count, 6);
+            }
+        }
+
+        bgfx::frame();
+        if (bgfx::overrideInternal(texture, it->native_texture) == 0) {
+            context.log << "Texture compiler error. Failed to share the preview texture of " << output << " with the renderer." << std::endl;
+            return 1;
+        }
+
+        bgfx::setViewName(view, "preview_copy_view");
+        for (int side = 0; side < 6; side++) {
+            for (int mip_level = 0; mip_level < mip_levels; mip_level++) {
+                const uint16_t mip_size = std::max(static_cast<uint16_t>(size >> mip_level), static_cast<uint16_t>(1));
+                const BlitSource source = is_seam_fixed && mip_level > 0 ? BlitSource { seam_output, static_cast<uint8_t>(mip_level - 1), static_cast<uint16_t>(side) }
+                                                                         : get_texture(side, mip_level);
+                bgfx::blit(view, texture, static_cast<uint8_t>(mip_level), 0, 0, static_cast<uint16_t>(side), source.texture, source.mip_level, 0, 0, source.layer, mip_size, mip_size);
+            }
+        }
+
+        bgfx::frame();
+        if (renderer.is_profiling) {
+            collect_gpu_view_times(renderer);
+        }
+    }
+
+    return while_compressing && while_compressing() != 0 ? 1 : 0;
+}
+
+// Encodes the faces of a cube map to BC6H in `bc6h_shader` and reads back the blocks, the GPU version of
+// `push_cube_face_bc6h`. `faces` is a texture array with one layer per cube map side and all the mip levels, which are
+// already downsampled by `downsample_shader`. Blocks are read back in the view after `view`, because blits of a view
+// are executed before its dispatches.
+static int encode_and_read_back_bc6h(Renderer& renderer, const JobContext& context, bgfx::ViewId view, bgfx::TextureHandle faces, uint16_t size, int total_mip_levels,
+                                     nvtt::OutputHandler& output) noexcept {
+    const bgfx::UniformHandle settings_uniform = renderer.settings_uniform;
+
+    bgfx::setViewName(view, "bc6h_compute_view");
+
+    std::vector<RenderTarget> block_textures;
+
+    for (int mip_level = 0; mip_level < total_mip_levels; mip_level++) {
+        const uint16_t mip_size = std::max(static_cast<uint16_t>(size >> mip_level), static_cast<uint16_t>(1));
+
+        const uint16_t blocks = static_cast<uint16_t>((mip_size + 3) / 4);
+        const RenderTarget& block_texture = block_textures.emplace_back(renderer.render_targets, RenderTargetDescription { false, blocks, false, 6, bgfx::TextureFormat::RGBA32U, BGFX_TEXTURE_COMPUTE_WRITE });
+        if (!bgfx::isValid(block_texture)) {
+            context.log << "\rTexture compiler error. Failed to create a BC6H block texture." << std::endl;
+            return 1;
+        }
+        bgfx::setName(block_texture, "bc6h_block_texture");
+
+        const float settings[4] = { static_cast<float>(mip_size), 0.f, 0.f, 0.f };
+        bgfx::setUniform(settings_uniform, settings);
+
+        bgfx::setImage(0, faces, static_cast<uint8_t>(mip_level), bgfx::Access::Read, bgfx::TextureFormat::RGBA16F);
+        bgfx::setImage(1, block_texture, 0, bgfx::Access::Write, bgfx::TextureFormat::RGBA32U);
+
+        const uint32_t group_count = (blocks + 7U) / 8U;
+        bgfx::dispatch(view, renderer.bc6h_compute_program, group_count, group_count, 6);
+    }
+
+    bgfx::setViewName(view + 1, "bc6h_read_back_view");
+
+    CubeFaceCompression compressions[6];
+    std::vector<StagingTexture> blit_textures;
+    uint32_t frame_id = 0;
+
+    for (int side = 0; side < 6; side++) {
+        std::vector<char>& data = compressions[side].output.data;
+
+        for (int mip_level = 0; mip_level < total_mip_levels; mip_level++) {
+            const uint16_t mip_size = std::max(static_cast<uint16_t>(size >> mip_level), static_cast<uint16_t>(1));
+            const uint16_t blocks = static_cast<uint16_t>((mip_size + 3) / 4);
+
+            StagingTexture& staging_texture = blit_textures.emplace_back(renderer.staging_textures, blocks, bgfx::TextureFormat::RGBA32U);
+            if (!bgfx::isValid(staging_texture.handle)) {
+                context.log << "\rTexture compiler error. Failed to create a read back texture." << std::endl;
+                return 1;
+            }
+
+            bgfx::blit(view + 1, staging_texture.handle, 0, 0, 0, 0, block_textures[mip_level], 0, 0, 0, static_cast<uint16_t>(side), blocks, blocks);
+
+            // Mip levels of a face follow each other, `readTexture` writes straight to the output of the face.
+            const size_t offset = data.size();
+            data.resize(offset + static_cast<size_t>(blocks) * blocks * 16);
+            frame_id = std::max(frame_id, bgfx::readTexture(staging_texture.handle, data.data() + offset));
+        }
+    }
+
+    PhaseTimer readback_timer(context.metrics, "readback");
+    wait_for_frame(renderer, 0, frame_id);
+    readback_timer.stop();
+
+    blit_textures.clear();
+
+    for (CubeFaceCompression& compression : compressions) {
+        compression.is_compressed = true;
+    }
+    return write_cube_faces(context, compressions, output);
+}
+
+// Three bands of harmonics only keep the lowest frequencies, so a small mip level projects to practically the same
+// coefficients as the full cube map.
+static constexpr size_t SPHERICAL_HARMONICS_PROJECTION_SIZE = 64;
+
+// Projects cube map faces onto spherical harmonics and evaluates the irradiance map from them, instead of integrating
+// the hemisphere of every irradiance texel.
+static int encode_irradiance_spherical_harmonics(const JobContext& context, const CompileJob& job, const nvtt::Surface (&faces)[6], size_t size) noexcept {
+    const size_t irradiance_size = job.output_irradiance_size;
+
+    PhaseTimer project_timer(context.metrics, "irradiance_project");
+
+    const float* planes[6][3];
+    for (int side = 0; side < 6; side++) {
+        for (int channel = 0; channel < 3; channel++) {
+            planes[side][channel] = faces[side].channel(channel);
+        }
+    }
+
+    const SphericalHarmonics harmonics = project_cube_map(planes, size);
+
+    project_timer.stop();
+
+    TextureCompilerErrorHandler error_handler(context.log);
+
+    FileOutputHandler irradiance_output(job.output_irradiance, context.metrics, context.written_outputs, context.is_in_memory);
+    if (!irradiance_output.is_open()) {
+        context.log << "Texture compiler error. Failed to open output file." << std::endl;
+        return 1;
+    }
+
+    nvtt::OutputOptions irradiance_output_options;
+    irradiance_output_options.setOutputHandler(&irradiance_output);
+    irradiance_output_options.setContainer(nvtt::Container_DDS10);
+    irradiance_output_options.setErrorHandler(&error_handler);
+
+    nvtt::CompressionOptions irradiance_compression_options;
+    set_irradiance_compression_options(irradiance_compression_options);
+
+    reserve_output(context, irradiance_output, static_cast<int>(irradiance_size), static_cast<int>(irradiance_size), 6, 1, irradiance_compression_options);
+    if (!context.compressor.outputHeader(nvtt::TextureType_Cube, static_cast<int>(irradiance_size), static_cast<int>(irradiance_size), 1, 1, 1, false, irradiance_compression_options, irradiance_output_options)) {
+        // Error is printed via `error_handler`.
+        return 1;
+    }
+
+    // Faces are evaluated and compressed on the thread pool and written in face order, like the other cube map outputs.
+    CubeFaceCompression compressions[6];
+    for (int side = 0; side < 6; side++) {
+        CubeFaceCompression& face = compressions[side];
+        context.pool.push(face.group, [&context, &face, &harmonics, &irradiance_compression_options, side, irradiance_size] {
+            PhaseTimer encode_timer(context.metrics, "irradiance_encode", 0, side);
+
+            TextureCompilerErrorHandler face_error_handler(face.log);
+
+            nvtt::OutputOptions face_output_options;
+            face_output_options.setOutputHandler(&face.output);
+            face_output_options.setContainer(nvtt::Container_DDS10);
+            face_output_options.setErrorHandler(&face_error_handler);
+
+            nvtt::Surface surface;
+            if (!surface.setImage(static_cast<int>(irradiance_size), static_cast<int>(irradiance_size), 1)) {
+                face.log << "\rTexture compiler error. Failed to set an image." << std::endl;
+                return;
+            }
+
+            // Surface has just allocated its own storage, so writing to it doesn't affect any other surface.
+            float* red = const_cast<float*>(surface.channel(0));
+            float* green = const_cast<float*>(surface.channel(1));
+            float* blue = const_cast<float*>(surface.channel(2));
+            float* alpha = const_cast<float*>(surface.channel(3));
+
+            evaluate_irradiance(harmonics, side, irradiance_size, red, green, blue);
+            std::fill(alpha, alpha + irradiance_size * irradiance_size, 1.f);
+
+            if (!context.compressor.compress(surface, side, 0, irradiance_compression_options, face_output_options)) {
+                // Error is printed via `face_error_handler`.
+                return;
+            }
+
+            face.is_compressed = true;
+        });
+    }
+
+    if (write_cube_faces(context, compressions, irradiance_output) != 0) {
+        // Error is printed in `write_cube_faces`.
+        return 1;
+    }
+
+    pack_irradiance_output(irradiance_output, job.irradiance_format);
+
+    if (finish_output(context, irradiance_output, job) != 0) {
+        // Error is printed in `finish_output`.
+        return 1;
+    }
+
+    return 0;
+}
+
+// Reads a small mip level of the cube map back from the GPU and computes the irradiance map from its spherical harmonics.
+static int compile_irradiance_spherical_harmonics(Renderer& renderer, const JobContext& context, const CompileJob& job, bgfx::ViewId view, bgfx::TextureHandle cube_map_texture) noexcept {
+    auto before = std::chrono::steady_clock::now();
+
+    size_t size = job.output_size;
+    uint8_t mip_level = 0;
+    while (size > SPHERICAL_HARMONICS_PROJECTION_SIZE) {
+        size /= 2;
+        mip_level++;
+    }
+
+    PhaseTimer readback_timer(context.metrics, "irradiance_readback");
+
+    bgfx::setViewName(view, "irradiance_read_back_view");
+
+    std::vector<StagingTexture> staging_textures;
+    std::vector<uint16_t> data[6];
+    uint32_t frame_id = 0;
+    for (uint16_t side = 0; side < 6; side++) {
+        StagingTexture& staging_texture = staging_textures.emplace_back(renderer.staging_textures, static_cast<uint16_t>(size), bgfx::TextureFormat::RGBA16F);
+        if (!bgfx::isValid(staging_texture.handle)) {
+            context.log << "Texture compiler error. Failed to create a read back texture." << std::endl;
+            return 1;
+        }
+
+        bgfx::blit(view, staging_texture.handle, 0, 0, 0, 0, cube_map_texture, mip_level, 0, 0, side, static_cast<uint16_t>(size), static_cast<uint16_t>(size));
+
+        data[side].resize(size * size * 4);
+        frame_id = std::max(frame_id, bgfx::readTexture(staging_texture.handle, data[side].data()));
+    }
+
+    wait_for_frame(renderer, 0, frame_id);
+
+    readback_timer.stop();
+
+    nvtt::Surface faces[6];
+    for (int side = 0; side < 6; side++) {
+        if (!faces[side].setImage(nvtt::InputFormat_RGBA_16F, static_cast<int>(size), static_cast<int>(size), 1, data[side].data())) {
+            context.log << "Texture compiler error. Failed to set an image." << std::endl;
+            return 1;
+        }
+    }
+
+    if (encode_irradiance_spherical_harmonics(context, job, faces, size) != 0) {
+        // Error is printed in `encode_irradiance_spherical_harmonics`.
+        return 1;
+    }
+
+    auto after = std::chrono::steady_clock::now();
+    auto milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(after - before);
+    context.log << "Irradiance map compression took " << std::setprecision(3) << milliseconds.count() / 1000.f << " seconds." << std::endl;
+
+    return 0;
+}
+
+template <typename PixelType>
+static void flip_image_rows(PixelType* pixels, int width, int height) noexcept {
+    const size_t row_length = static_cast<size_t>(width) * 4;
+    for (int row = 0; row < height / 2; row++) {
+        PixelType* const top = pixels + static_cast<size_t>(row) * row_length;
+        PixelType* const bottom = pixels + static_cast<size_t>(height - row - 1) * row_length;
+        std::swap_ranges(top, top + row_length, bottom);
+    }
+}
+
+// Checks the decoded equirectangular image and flips it, so its rows go from the bottom like texture coordinates.
+static int prepare_equirectangular_image(const JobContext& context, HdrWrapper& data) noexcept {
+    if (data.data == nullptr && data.half_data.empty()) {
+        context.log << "Texture compiler error. Failed to open texture file." << std::endl;
+        return 1;
+    }
+
+    if (data.width <= 0 || data.height <= 0 || data.width > 65535 || data.height > 65535) {
+        context.log << "Texture compiler error. Texture is too big." << std::endl;
+        return 1;
+    }
+
+    // Flip the image manually, because `stbi_set_flip_vertically_on_load` is a global switch that would also affect textures compiled after this one.
+    if (data.data != nullptr) {
+        flip_image_rows(data.data, data.width, data.height);
+    } else {
+        flip_image_rows(data.half_data.data(), data.width, data.height);
+    }
+
+    return 0;
+}
+
+// Rows of a float input converted to half floats by a single task.
+static constexpr int HALF_CONVERSION_ROWS = 64;
+
+// Rows of a halved equirectangular input written by a single task.
+static constexpr int EQUIRECTANGULAR_REDUCTION_ROWS = 64;
+
+// The GPU samples the input as RGBA16F, which takes half the upload and memory of RGBA32F and keeps the range and the
+// precision the output formats can store. Float inputs are converted on the thread pool. Inputs larger than the
+// largest texture of the renderer are halved until they fit, every texel of the largest cube map still gets a few
+// texels of the input, and so are the ones `is_equirectangular_image_reducible` for the output size.
+static void prepare_gpu_equirectangular_image(const JobContext& context, HdrWrapper& data, size_t output_size) noexcept {
+    if (data.data != nullptr) {
+        const size_t row_length = static_cast<size_t>(data.width) * 4;
+        data.half_data.resize(row_length * static_cast<size_t>(data.height));
+
+        TaskGroup group;
+        for (int row = 0; row < data.height; row += HALF_CONVERSION_ROWS) {
+            const size_t offset = static_cast<size_t>(row) * row_length;
+            const size_t count = static_cast<size_t>(std::min(HALF_CONVERSION_ROWS, data.height - row)) * row_length;
+            context.pool.push(group, [&data, offset, count] {
+                convert_rgba32f_to_rgba16f(data.data + offset, count, data.half_data.data() + offset);
+            });
+        }
+        context.pool.wait(group);
+
+        data.free_data();
+    }
+
+    const int max_size = static_cast<int>(bgfx::getCaps()->limits.maxTextureSize);
+    while (data.width > max_size || data.height > max_size || is_equirectangular_image_reducible(data.width, output_size)) {
+        const int width = std::max(data.width / 2, 1);
+        const int height = std::max(data.height / 2, 1);
+        std::vector<uint16_t> half_data(static_cast<size_t>(width) * static_cast<size_t>(height) * 4);
+
+        // Each task halves a band of input rows, only the last band of an odd input clamps to its last row.
+        TaskGroup group;
+        for (int row = 0; row < height; row += EQUIRECTANGULAR_REDUCTION_ROWS) {
+            const size_t input_offset = static_cast<size_t>(row) * 2 * static_cast<size_t>(data.width) * 4;
+            const size_t output_offset = static_cast<size_t>(row) * static_cast<size_t>(width) * 4;
+            const size_t input_rows = static_cast<size_t>(std::min(EQUIRECTANGULAR_REDUCTION_ROWS * 2, data.height - row * 2));
+            context.pool.push(group, [&data, &half_data, input_offset, output_offset, input_rows] {
+                downsample_image_rgba16f(data.half_data.data() + input_offset, static_cast<size_t>(data.width), input_rows, half_data.data() + output_offset);
+            });
+        }
+        context.pool.wait(group);
+
+        data.half_data = std::move(half_data);
+        data.width = width;
+        data.height = height;
+    }
+}
+
+// CPU version of the reduction of `prepare_gpu_equirectangular_image`, halves the float input in `data` or
+// `float_data` until it's no longer `is_equirectangular_image_reducible` for the output size.
+static void reduce_cpu_equirectangular_image(const JobContext& context, HdrWrapper& data, std::vector<float>& float_data, size_t output_size) noexcept {
+    while (is_equirectangular_image_reducible(data.width, output_size)) {
+        const int width = std::max(data.width / 2, 1);
+        const int height = std::max(data.height / 2, 1);
+        std::vector<float> reduced_data(static_cast<size_t>(width) * static_cast<size_t>(height) * 4);
+
+        const float* const pixels = data.data != nullptr ? data.data : float_data.data();
+        TaskGroup group;
+        for (int row = 0; row < height; row += EQUIRECTANGULAR_REDUCTION_ROWS) {
+            const size_t row_end = static_cast<size_t>(std::min(row + EQUIRECTANGULAR_REDUCTION_ROWS, height));
+            context.pool.push(group, [&data, &reduced_data, pixels, row, row_end] {
+                downsample_image_rows(pixels, static_cast<size_t>(data.width), static_cast<size_t>(data.height), static_cast<size_t>(row), row_end, reduced_data.data());
+            });
+        }
+        context.pool.wait(group);
+
+        data.free_data();
+        float_data = std::move(reduced_data);
+        data.width = width;
+        data.height = height;
+    }
+}
+
+// Copies a `size` x `size` face whose top left texel is at (`left`, `top`) of an image with rows from the top, the
+// same orientation as the faces of the output, optionally rotated by 180 degrees.
+static void copy_cube_map_face(const HdrWrapper& data, int left, int top, size_t size, bool is_rotated, float* output) noexcept {
+    const size_t row_length = static_cast<size_t>(data.width) * 4;
+    for (size_t y = 0; y < size; y++) {
+        const size_t source_y = static_cast<size_t>(top) + (is_rotated ? size - 1 - y : y);
+        const size_t offset = source_y * row_length + static_cast<size_t>(left) * 4;
+        float* const output_row = output + y * size * 4;
+        if (is_rotated) {
+            for (size_t x = 0; x < size; x++) {
+                const size_t source = offset + (size - 1 - x) * 4;
+                if (data.data != nullptr) {
+                    std::copy(data.data + source, data.data + source + 4, output_row + x * 4);
+                } else {
+                    convert_rgba16f_to_rgba32f(data.half_data.data() + source, 4, output_row + x * 4);
+                }
+            }
+        } else if (data.data != nullptr) {
+            std::copy(data.data + offset, data.data + offset + size * 4, output_row);
+        } else {
+            convert_rgba16f_to_rgba32f(data.half_data.data() + offset, size * 4, output_row);
+        }
+    }
+}
+
+// Fills the first mip level of `cube_map` with the faces of a six-face or cross input, `data` is the decoded `input`.
+// Faces are used as they are, so they must be as large as the output.
+static int load_cube_map_faces(const JobContext& context, const CompileJob& job, CubeMapLayout layout, const HdrWrapper& data, CubeMapImage& cube_map) noexcept {
+    if (data.data == nullptr && data.half_data.empty()) {
+        context.log << "Texture compiler error. Failed to open texture file." << std::endl;
+        return 1;
+    }
+
+    const size_t size = cube_map.size;
+
+    if (layout == CubeMapLayout::FACES) {
+        std::unique_ptr<HdrWrapper> faces[5];
+
+        TaskGroup group;
+        for (size_t face = 0; face < 5; face++) {
+            context.pool.push(group, [&context, &job, &faces, face] {
+                faces[face] = std::make_unique<HdrWrapper>(job.faces[face], context.pool);
+            });
+        }
+        context.pool.wait(group);
+
+        for (int face = 0; face < 6; face++) {
+            const HdrWrapper& face_data = face == 0 ? data : *faces[face - 1];
+            if (face_data.data == nullptr && face_data.half_data.empty()) {
+                context.log << "Texture compiler error. Failed to open texture file." << std::endl;
+                return 1;
+            }
+
+            if (static_cast<size_t>(face_data.width) != size || static_cast<size_t>(face_data.height) != size) {
+                context.log << "Texture compiler error. Cube map faces must be square images of --output-size." << std::endl;
+                return 1;
+            }
+
+            copy_cube_map_face(face_data, 0, 0, size, false, cube_map.get_face(face, 0));
+        }
+        return 0;
+    }
+
+    const int face_size = layout == CubeMapLayout::HORIZONTAL_CROSS ? data.width / 4 : data.width / 3;
+    if (static_cast<size_t>(face_size) != size) {
+        context.log << "Texture compiler error. Cube map faces must be square images of --output-size." << std::endl;
+        return 1;
+    }
+
+    // Cells of +X, -X, +Y, -Y, +Z and -Z in the cross.
+    static constexpr int CROSS_CELLS[6][2] = { { 2, 1 }, { 0, 1 }, { 1, 0 }, { 1, 2 }, { 1, 1 }, { 3, 1 } };
+
+    for (int face = 0; face < 6; face++) {
+        const bool is_rotated = layout == CubeMapLayout::VERTICAL_CROSS && face == 5;
+        const int column = is_rotated ? 1 : CROSS_CELLS[face][0];
+        const int row = is_rotated ? 3 : CROSS_CELLS[face][1];
+        copy_cube_map_face(data, column * face_size, row * face_size, size, is_rotated, cube_map.get_face(face, 0));
+    }
+    return 0;
+}
+
+// Rows of a face rendered by a single task of the CPU backend.
+static constexpr size_t CPU_TILE_ROWS = 8;
+
+// Splits all six `size` x `size` faces into tiles of rows and renders them on the thread pool.
+static void render_cube_tiles(const JobContext& context, size_t size, const std::function<void(int face, size_t row_begin, size_t row_end)>& render) noexcept {
+    TaskGroup group;
+    for (int face = 0; face < 6; face++) {
+        for (size_t row = 0; row < size; row += CPU_TILE_ROWS) {
+            const size_t row_end = std::min(row + CPU_TILE_ROWS, size);
+            context.pool.push(group, [&render, face, row, row_end] {
+                render(face, row, row_end);
+            });
+        }
+    }
+    context.pool.wait(group);
+}
+
+// Compresses the first mip levels of a cube map rendered on the CPU, like `read_back_and_compress_cube` does for the GPU.
+static int compress_cube_map_image(const JobContext& context, const CubeMapImage& image, int rendered_mip_levels, int total_mip_levels,
+                                   const nvtt::CompressionOptions& compression_options, nvtt::OutputHandler& output, const char* phase_prefix) noexcept {
+    CubeFaceCompression compressions[6];
+    for (int side = 0; side < 6; side++) {
+        const auto get_data = [&image, side](int mip_level) -> const void* {
+            return image.get_face(side, static_cast<size_t>(mip_level));
+        };
+        push_cube_face_compression(context, compressions[side], side, static_cast<int>(image.size), rendered_mip_levels, total_mip_levels, nvtt::InputFormat_RGBA_32F, get_data, compression_options, phase_prefix);
+    }
+    return write_cube_faces(context, compressions, output);
+}
+
+// Encodes every mip level of a cube map rendered on the CPU to BC6H with the fast encoder.
+static int compress_cube_map_bc6h(const JobContext& context, const CubeMapImage& image, nvtt::OutputHandler& output, const char* phase_prefix) noexcept {
+    std::vector<std::vector<uint16_t>> half_faces[6];
+    CubeFaceCompression compressions[6];
+    for (int side = 0; side < 6; side++) {
+        half_faces[side].resize(image.mip_levels);
+        push_cube_face_bc6h(context, compressions[side], side, image.size, static_cast<int>(image.mip_levels), [&image, &half_faces, side](int mip_level) {
+            const size_t mip_size = image.get_mip_size(static_cast<size_t>(mip_level));
+            std::vector<uint16_t>& half_face = half_faces[side][static_cast<size_t>(mip_level)];
+            half_face.resize(mip_size * mip_size * 4);
+            convert_rgba32f_to_rgba16f(image.get_face(side, static_cast<size_t>(mip_level)), half_face.size(), half_face.data());
+            return half_face.data();
+        }, phase_prefix);
+    }
+    return write_cube_faces(context, compressions, output);
+}
+
+// Faces of a mip level of a cube map built on the CPU.
+static void get_cube_map_faces(CubeMapImage& cube_map, size_t mip_level, float* (&faces)[6]) noexcept {
+    for (int face = 0; face < 6; face++) {
+        faces[face] = cube_map.get_face(face, mip_level);
+    }
+}
+
+// Builds every mip level of a cube map on the CPU after the first one from the previous one with the seam aware
+// `downsample_face_rows`, like the GPU does.
+static void downsample_cube_map_image(const JobContext& context, CubeMapImage& cube_map) noexcept {
+    for (size_t mip_level = 1; mip_level < cube_map.mip_levels; mip_level++) {
+        float* faces[6];
+        get_cube_map_faces(cube_map, mip_level - 1, faces);
+        const float* const input[6] = { faces[0], faces[1], faces[2], faces[3], faces[4], faces[5] };
+
+        const size_t previous_mip_size = cube_map.get_mip_size(mip_level - 1);
+        render_cube_tiles(context, cube_map.get_mip_size(mip_level), [&](int face, size_t row_begin, size_t row_end) {
+            downsample_face_rows(input, previous_mip_size, face, row_begin, row_end, cube_map.get_face(face, mip_level));
+        });
+    }
+}
+
+// Writes a cube map built on the CPU to the cube map output. Every mip level goes to the output, same as on the GPU.
+static int write_cube_map_image(const JobContext& context, const CompileJob& job, const CubeMapImage& cube_map) noexcept {
+    const size_t output_size = job.output_size;
+
+    TextureCompilerErrorHandler error_handler(context.log);
+
+    FileOutputHandler cube_map_output(job.output, context.metrics, context.written_outputs, context.is_in_memory);
+    if (!cube_map_output.is_open()) {
+        context.log << "Texture compiler error. Failed to open output file." << std::endl;
+        return 1;
+    }
+
+    nvtt::OutputOptions cube_map_output_options;
+    cube_map_output_options.setOutputHandler(&cube_map_output);
+    cube_map_output_options.setContainer(nvtt::Container_DDS10);
+    cube_map_output_options.setErrorHandler(&error_handler);
+
+    nvtt::CompressionOptions cube_map_compression_options;
+    set_cube_map_compression_options(cube_map_compression_options, job.compression, job.quality);
+
+    auto before = std::chrono::steady_clock::now();
+
+    report_progress(context, "", 0);
+
+    const int total_mip_levels = static_cast<int>(cube_map.mip_levels);
+    reserve_output(context, cube_map_output, static_cast<int>(output_size), static_cast<int>(output_size), 6, total_mip_levels, cube_map_compression_options);
+    if (!context.compressor.outputHeader(nvtt::TextureType_Cube, static_cast<int>(output_size), static_cast<int>(output_size), 1, 1, total_mip_levels, false, cube_map_compression_options, cube_map_output_options)) {
+        // Error is printed via `error_handler`.
+        return 1;
+    }
+
+    if (is_fast_bc6h(job)) {
+        set_fast_bc6h_format(cube_map_output);
+
+        if (compress_cube_map_bc6h(context, cube_map, cube_map_output, "") != 0) {
+            // Error is printed in `compress_cube_map_bc6h`.
+            return 1;
+        }
+    } else if (compress_cube_map_image(context, cube_map, total_mip_levels, total_mip_levels, cube_map_compression_options, cube_map_output, "") != 0) {
+        // Error is printed in `compress_cube_map_image`.
+        return 1;
+    }
+
+    if (finish_output(context, cube_map_output, job) != 0) {
+        // Error is printed in `finish_output`.
+        return 1;
+    }
+
+    auto after = std::chrono::steady_clock::now();
+    auto milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(after - before);
+    context.log << "\rCube map compression took " << std::setprecision(3) << milliseconds.count() / 1000.f << " seconds." << std::endl;
+
+    return 0;
+}
+
+// Splits a `size` x `size` octahedral map into tiles of rows and renders them on the thread pool.
+static void render_octahedral_tiles(const JobContext& context, size_t size, const std::function<void(size_t row_begin, size_t row_end)>& render) noexcept {
+    TaskGroup group;
+    for (size_t row = 0; row < size; row += CPU_TILE_ROWS) {
+        const size_t row_end = std::min(row + CPU_TILE_ROWS, size);
+        context.pool.push(group, [&render, row, row_end] {
+            render(row, row_end);
+        });
+    }
+    context.pool.wait(group);
+}
+
+// Alpha squared of the GGX lobe of a prefilter mip level.
+static float get_prefilter_a_sqr(const CompileJob& job, uint16_t mip_level) noexcept {
+    const float roughness = get_prefilter_roughness(job, mip_level);
+    return roughness * roughness * roughness * roughness;
+}
+
+// First prefilter mip level `--combined-convolution` renders together with the irradiance: the first level that isn't
+// a mirror and whose importance samples all fetch environment mip levels at least as coarse as the one irradiance is
+// integrated from, so every texel of that level is as much detail as the samples would see. Rougher levels take more
+// samples but fetch coarser levels still.
+static size_t get_combined_prefilter_level(const CompileJob& job) {
+    const auto source_level = static_cast<float>(get_irradiance_mip_level(job.output_size));
+    const uint16_t mip_levels = get_prefilter_mip_levels(job);
+    for (uint16_t mip_level = 0; mip_level < mip_levels; mip_level++) {
+        const float roughness = get_prefilter_roughness(job, mip_level);
+        if (roughness == 0.f) {
+            continue;
+        }
+
+        const PrefilterSamples samples = create_prefilter_samples(roughness, static_cast<size_t>(get_prefilter_sample_count(job, mip_level)), job.output_size);
+        if (!samples.mip_levels.empty() && *std::min_element(samples.mip_levels.begin(), samples.mip_levels.end()) >= source_level) {
+            return mip_level;
+        }
+    }
+    return mip_levels;
+}
+
+// Mip level of an irradiance or prefilter image rendered by `render_combined_convolution`, with the alpha squared of its
+// lobe. Octahedral maps have their single face first.
+struct ConvolutionTarget final {
+    size_t size = 0;
+    float a_sqr = 1.f;
+    float* faces[6] = {};
+};
+
+static ConvolutionTarget get_convolution_target(CubeMapImage& image, size_t mip_level, float a_sqr) noexcept {
+    ConvolutionTarget target;
+    target.size = image.get_mip_size(mip_level);
+    target.a_sqr = a_sqr;
+    for (int face = 0; face < 6; face++) {
+        target.faces[face] = image.get_face(face, mip_level);
+    }
+    return target;
+}
+
+static ConvolutionTarget get_convolution_target(OctahedralImage& image, size_t mip_level, float a_sqr) noexcept {
+    ConvolutionTarget target;
+    target.size = image.get_mip_size(mip_level);
+    target.a_sqr = a_sqr;
+    target.faces[0] = image.get_level(mip_level);
+    return target;
+}
+
+// Renders the irradiance and the rough prefilter mip levels of `--combined-convolution` on the thread pool from a
+// single fetch of every texel of the cube map level irradiance is integrated from, with the irradiance as the GGX lobe
+// of roughness 1. Targets of the same size are rendered by the same tasks, which take the cosine of every source texel
+// once for all their lobes.
+static void render_combined_convolution(const JobContext& context, const CompileJob& job, const CubeMapImage& cube_map, const std::vector<ConvolutionTarget>& targets) noexcept {
+    PhaseTimer convolution_render_timer(context.metrics, "convolution_render");
+
+    const ConvolutionSource source = create_convolution_source(cube_map, get_irradiance_mip_level(job.output_size));
+
+    std::vector<bool> is_rendered(targets.size(), false);
+    for (size_t i = 0; i < targets.size(); i++) {
+        if (is_rendered[i]) {
+            continue;
+        }
+
+        const size_t size = targets[i].size;
+        std::vector<float> a_sqrs;
+        std::vector<float*> outputs[6];
+        for (size_t j = i; j < targets.size(); j++) {
+            if (targets[j].size == size) {
+                is_rendered[j] = true;
+                a_sqrs.push_back(targets[j].a_sqr);
+                for (int face = 0; face < 6; face++) {
+                    outputs[face].push_back(targets[j].faces[face]);
+                }
+            }
+        }
+
+        if (job.is_octahedral) {
+            render_octahedral_tiles(context, size, [&](size_t row_begin, size_t row_end) {
+                render_convolution_rows(source, a_sqrs.data(), a_sqrs.size(), OCTAHEDRAL_FACE, size, row_begin, row_end, outputs[0].data());
+            });
+        } else {
+            render_cube_tiles(context, size, [&](int face, size_t row_begin, size_t row_end) {
+                render_convolution_rows(source, a_sqrs.data(), a_sqrs.size(), face, size, row_begin, row_end, outputs[face].data());
+            });
+        }
+    }
+}
+
+// Irradiance output of a cube map built on the CPU, either spherical harmonics or a convolution of the cube map.
+// `irradiance` is the convolution rendered by `render_combined_convolution` already, null when it's rendered here.
+static int compile_irradiance_cpu(const JobContext& context, const CompileJob& job, const CubeMapImage& cube_map, std::unique_ptr<CubeMapImage> irradiance) noexcept {
+    const size_t output_size = job.output_size;
+    const size_t irradiance_size = job.output_irradiance_size;
+
+    TextureCompilerErrorHandler error_handler(context.log);
+
+    if (job.is_irradiance_spherical_harmonics) {
+        auto before = std::chrono::steady_clock::now();
+
+        size_t mip_level = 0;
+        while (cube_map.get_mip_size(mip_level) > SPHERICAL_HARMONICS_PROJECTION_SIZE) {
+            mip_level++;
+        }
+        const size_t size = cube_map.get_mip_size(mip_level);
+
+        nvtt::Surface faces[6];
+        for (int side = 0; side < 6; side++) {
+            if (!faces[side].setImage(nvtt::InputFormat_RGBA_32F, static_cast<int>(size), static_cast<int>(size), 1, cube_map.get_face(side, mip_level))) {
+                context.log << "Texture compiler error. Failed to set an image." << std::endl;
+                return 1;
+            }
+        }
+
+        if (encode_irradiance_spherical_harmonics(context, job, faces, size) != 0) {
+            // Error is printed in `encode_irradiance_spherical_harmonics`.
+            return 1;
+        }
+
+        auto after = std::chrono::steady_clock::now();
+        auto milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(after - before);
+        context.log << "Irradiance map compression took " << std::setprecision(3) << milliseconds.count() / 1000.f << " seconds." << std::endl;
+    } else {
+        if (!irradiance) {
+            PhaseTimer irradiance_render_timer(context.metrics, "irradiance_render");
+
+            const size_t mip_level = get_irradiance_mip_level(output_size);
+            const IrradianceSamples samples = create_irradiance_samples(cube_map.get_mip_size(mip_level));
+
+            irradiance = std::make_unique<CubeMapImage>(irradiance_size);
+            render_cube_tiles(context, irradiance_size, [&](int face, size_t row_begin, size_t row_end) {
+                render_irradiance_rows(cube_map, samples, mip_level, face, irradiance_size, row_begin, row_end, irradiance->get_face(face, 0));
+            });
+        }
+
+        FileOutputHandler irradiance_output(job.output_irradiance, context.metrics, context.written_outputs, context.is_in_memory);
+        if (!irradiance_output.is_open()) {
+            context.log << "Texture compiler error. Failed to open output file." << std::endl;
+            return 1;
+        }
+
+        nvtt::OutputOptions irradiance_output_options;
+        irradiance_output_options.setOutputHandler(&irradiance_output);
+        irradiance_output_options.setContainer(nvtt::Container_DDS10);
+        irradiance_output_options.setErrorHandler(&error_handler);
+
+        nvtt::CompressionOptions irradiance_compression_options;
+        set_irradiance_compression_options(irradiance_compression_options);
+
+        auto before = std::chrono::steady_clock::now();
+
+        report_progress(context, "", 0);
+
+        reserve_output(context, irradiance_output, static_cast<int>(irradiance_size), static_cast<int>(irradiance_size), 6, 1, irradiance_compression_options);
+        if (!context.compressor.outputHeader(nvtt::TextureType_Cube, static_cast<int>(irradiance_size), static_cast<int>(irradiance_size), 1, 1, 1, false, irradiance_compression_options, irradiance_output_options)) {
+            // Error is printed via `error_handler`.
+            return 1;
+        }
+
+        if (compress_cube_map_image(context, *irradiance, 1, 1, irradiance_compression_options, irradiance_output, "irradiance_") != 0) {
+            // Error is printed in `compress_cube_map_image`.
+            return 1;
+        }
+
+        pack_irradiance_output(irradiance_output, job.irradiance_format);
+
+        if (finish_output(context, irradiance_output, job) != 0) {
+            // Error is printed in `finish_output`.
+            return 1;
+        }
+
+        auto after = std::chrono::steady_clock::now();
+        auto milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(after - before);
+        context.log << "\rIrradiance map compression took " << std::setprecision(3) << milliseconds.count() / 1000.f << " seconds." << std::endl;
+    }
+
+    return 0;
+}
+
+// Prefilter output of a cube map built on the CPU, every mip level is convolved with rougher GGX lobes. `prefilter` has
+// the mip levels from `combined_level` on rendered by `render_combined_convolution` already, null when every level is
+// rendered here.
+static int compile_prefilter_cpu(const JobContext& context, const CompileJob& job, const CubeMapImage& cube_map, std::unique_ptr<CubeMapImage> combined_prefilter, size_t combined_level) noexcept {
+    const size_t output_size = job.output_size;
+    const size_t prefilter_size = job.output_prefilter_size;
+
+    TextureCompilerErrorHandler error_handler(context.log);
+
+    PhaseTimer prefilter_render_timer(context.metrics, "prefilter_render");
+
+    if (!combined_prefilter) {
+        combined_prefilter = std::make_unique<CubeMapImage>(prefilter_size, get_prefilter_mip_levels(job));
+        combined_level = combined_prefilter->mip_levels;
+    }
+    CubeMapImage& prefilter = *combined_prefilter;
+    for (size_t mip_level = 0; mip_level < combined_level; mip_level++) {
+        const size_t mip_size = prefilter.get_mip_size(mip_level);
+
+        const auto prefilter_mip_level = static_cast<uint16_t>(mip_level);
+        const float sample_count = get_prefilter_sample_count(job, prefilter_mip_level);
+        const PrefilterSamples samples = create_prefilter_samples(get_prefilter_roughness(job, prefilter_mip_level), static_cast<size_t>(sample_count), output_size);
+
+        render_cube_tiles(context, mip_size, [&](int face, size_t row_begin, size_t row_end) {
+            render_prefilter_rows(cube_map, samples, face, mip_size, row_begin, row_end, prefilter.get_face(face, mip_level));
+        });
+    }
+
+    // Every prefilter mip level is rendered on its own, so texels on the edges of neighbour faces are slightly off.
+    for (size_t mip_level = 1; mip_level < prefilter.mip_levels; mip_level++) {
+        float* faces[6];
+        get_cube_map_faces(prefilter, mip_level, faces);
+        fix_cube_map_seams(faces, prefilter.get_mip_size(mip_level));
+    }
+
+    prefilter_render_timer.stop();
+
+    FileOutputHandler prefilter_output(job.output_prefilter, context.metrics, context.written_outputs, context.is_in_memory);
+    if (!prefilter_output.is_open()) {
+        context.log << "Texture compiler error. Failed to open output file." << std::endl;
+        return 1;
+    }
+
+    nvtt::OutputOptions prefilter_output_options;
+    prefilter_output_options.setOutputHandler(&prefilter_output);
+    prefilter_output_options.setContainer(nvtt::Container_DDS10);
+    prefilter_output_options.setErrorHandler(&error_handler);
+
+    nvtt::CompressionOptions prefilter_compression_options;
+    set_prefilter_compression_options(prefilter_compression_options, job.compression, job.quality);
+
+    auto before = std::chrono::steady_clock::now();
+
+    report_progress(context, "", 0);
+
+    const int total_mip_levels = static_cast<int>(prefilter.mip_levels);
+    reserve_output(context, prefilter_output, static_cast<int>(prefilter_size), static_cast<int>(prefilter_size), 6, total_mip_levels, prefilter_compression_options);
+    if (!context.compressor.outputHeader(nvtt::TextureType_Cube, static_cast<int>(prefilter_size), static_cast<int>(prefilter_size), 1, 1, total_mip_levels, false, prefilter_compression_options, prefilter_output_options)) {
+        // Error is printed via `error_handler`.
+        return 1;
+    }
+
+    if (is_fast_bc6h(job)) {
+        set_fast_bc6h_format(prefilter_output);
+
+        if (compress_cube_map_bc6h(context, prefilter, prefilter_output, "prefilter_") != 0) {
+            // Error is printed in `compress_cube_map_bc6h`.
+            return 1;
+        }
+    } else if (compress_cube_map_image(context, prefilter, total_mip_levels, total_mip_levels, prefilter_compression_options, prefilter_output, "prefilter_") != 0) {
+        // Error is printed in `compress_cube_map_image`.
+        return 1;
+    }
+
+    if (finish_output(context, prefilter_output, job) != 0) {
+        // Error is printed in `finish_output`.
+        return 1;
+    }
+
+    auto after = std::chrono::steady_clock::now();
+    auto milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(after - before);
+    context.log << "\rPrefilter map compression took " << std::setprecision(3) << milliseconds.count() / 1000.f << " seconds." << std::endl;
+
+    return 0;
+}
+
+// Builds every mip level of an octahedral map after the first one from the previous one.
+static void downsample_octahedral_image(const JobContext& context, OctahedralImage& image) noexcept {
+    for (size_t mip_level = 1; mip_level < image.mip_levels; mip_level++) {
+        const float* const input = image.get_level(mip_level - 1);
+        const size_t previous_mip_size = image.get_mip_size(mip_level - 1);
+        render_octahedral_tiles(context, image.get_mip_size(mip_level), [&](size_t row_begin, size_t row_end) {
+            downsample_octahedral_rows(input, previous_mip_size, row_begin, row_end, image.get_level(mip_level));
+        });
+    }
+}
+
+// Writes every mip level of an octahedral map to a 2D texture at `path`. The map is compressed like a single cube map
+// face, with `compression_options` or with the fast BC6H encoder, and irradiance is packed to `--irradiance-format`.
+static int write_octahedral_image(const JobContext& context, const CompileJob& job, const std::string& path, const OctahedralImage& image,
+                                  const nvtt::CompressionOptions& compression_options, bool is_irradiance, const char* phase_prefix, const char* name) noexcept {
+    TextureCompilerErrorHandler error_handler(context.log);
+
+    FileOutputHandler output(path, context.metrics, context.written_outputs, context.is_in_memory);
+    if (!output.is_open()) {
+        context.log << "Texture compiler error. Failed to open output file." << std::endl;
+        return 1;
+    }
+
+    nvtt::OutputOptions output_options;
+    output_options.setOutputHandler(&output);
+    output_options.setContainer(nvtt::Container_DDS10);
+    output_options.setErrorHandler(&error_handler);
+
+    auto before = std::chrono::steady_clock::now();
+
+    report_progress(context, "", 0);
+
+    const int size = static_cast<int>(image.size);
+    const int total_mip_levels = static_cast<int>(image.mip_levels);
+    reserve_output(context, output, size, size, 1, total_mip_levels, compression_options);
+    if (!context.compressor.outputHeader(nvtt::TextureType_2D, size, size, 1, 1, total_mip_levels, false, compression_options, output_options)) {
+        // Error is printed via `error_handler`.
+        return 1;
+    }
+
+    CubeFaceCompression compressions[1];
+    std::vector<std::vector<uint16_t>> half_levels(image.mip_levels);
+    if (!is_irradiance && is_fast_bc6h(job)) {
+        set_fast_bc6h_format(output);
+
+        push_cube_face_bc6h(context, compressions[0], 0, image.size, total_mip_levels, [&image, &half_levels](int mip_level) {
+            const size_t mip_size = image.get_mip_size(static_cast<size_t>(mip_level));
+            std::vector<uint16_t>& half_level = half_levels[static_cast<size_t>(mip_level)];
+            half_level.resize(mip_size * mip_size * 4);
+            convert_rgba32f_to_rgba16f(image.get_level(static_cast<size_t>(mip_level)), half_level.size(), half_level.data());
+            return half_level.data();
+        }, phase_prefix);
+    } else {
+        const auto get_data = [&image](int mip_level) -> const void* {
+            return image.get_level(static_cast<size_t>(mip_level));
+        };
+        push_cube_face_compression(context, compressions[0], 0, size, total_mip_levels, total_mip_levels, nvtt::InputFormat_RGBA_32F, get_data, compression_options, phase_prefix);
+    }
+
+    if (write_cube_faces(context, compressions, output) != 0) {
+        // Error is printed in `write_cube_faces`.
+        return 1;
+    }
+
+    if (is_irradiance) {
+        pack_irradiance_output(output, job.irradiance_format);
+    }
+
+    if (finish_output(context, output, job) != 0) {
+        // Error is printed in `finish_output`.
+        return 1;
+    }
+
+    auto after = std::chrono::steady_clock::now();
+    auto milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(after - before);
+    context.log << "\r" << name << " compression took " << std::setprecision(3) << milliseconds.count() / 1000.f << " seconds." << std::endl;
+
+    return 0;
+}
+
+// Octahedral texels cover about six times the solid angle of the texels of cube map faces of the same size, so the
+// octahedral map of face inputs is resampled from the cube map level of about the same texel size.
+static const float OCTAHEDRAL_CUBE_MAP_MIP_LEVEL = 0.5f * std::log2(6.f);
+
+// Octahedral outputs of a cube map job rendered on the CPU. The octahedral map is projected straight from the
+// equirectangular `pixels`, or resampled from `cube_map` for face inputs, so it's filtered from the input only once.
+// Irradiance and prefilter are convolved from the mip levels of `cube_map` like their cube map versions.
+static int compile_octahedral_cpu(const JobContext& context, const CompileJob& job, const float* pixels, size_t width, size_t height, const CubeMapImage& cube_map) noexcept {
+    const size_t output_size = job.output_size;
+
+    if (!job.output.empty()) {
+        PhaseTimer render_timer(context.metrics, "octahedral_render");
+
+        OctahedralImage octahedral(output_size, SIZE_MAX);
+        render_octahedral_tiles(context, output_size, [&](size_t row_begin, size_t row_end) {
+            if (pixels != nullptr) {
+                render_equirectangular_rows(pixels, width, height, OCTAHEDRAL_FACE, output_size, row_begin, row_end, octahedral.get_level(0));
+            } else {
+                render_cube_map_rows(cube_map, OCTAHEDRAL_CUBE_MAP_MIP_LEVEL, OCTAHEDRAL_FACE, output_size, row_begin, row_end, octahedral.get_level(0));
+            }
+        });
+        downsample_octahedral_image(context, octahedral);
+
+        render_timer.stop();
+
+        nvtt::CompressionOptions compression_options;
+        set_cube_map_compression_options(compression_options, job.compression, job.quality);
+
+        if (write_octahedral_image(context, job, job.output, octahedral, compression_options, false, "", "Octahedral map") != 0) {
+            // Error is printed in `write_octahedral_image`.
+            return 1;
+        }
+    }
+
+    // With `--combined-convolution` the irradiance and the rough prefilter mip levels are rendered before either is
+    // compressed, like `compile_cube_map_cpu` does.
+    std::unique_ptr<OctahedralImage> combined_irradiance, combined_prefilter;
+    size_t combined_prefilter_level = 0;
+    if (job.is_combined_convolution) {
+        std::vector<ConvolutionTarget> targets;
+        if (!job.output_irradiance.empty() && !job.is_irradiance_spherical_harmonics) {
+            combined_irradiance = std::make_unique<OctahedralImage>(job.output_irradiance_size, 1);
+            targets.push_back(get_convolution_target(*combined_irradiance, 0, 1.f));
+        }
+        if (!job.output_prefilter.empty()) {
+            combined_prefilter = std::make_unique<OctahedralImage>(job.output_prefilter_size, get_prefilter_mip_levels(job));
+            combined_prefilter_level = get_combined_prefilter_level(job);
+            for (size_t mip_level = combined_prefilter_level; mip_level < combined_prefilter->mip_levels; mip_level++) {
+                targets.push_back(get_convolution_target(*combined_prefilter, mip_level, get_prefilter_a_sqr(job, static_cast<uint16_t>(mip_level))));
+            }
+        }
+        render_combined_convolution(context, job, cube_map, targets);
+    }
+
+    if (!job.output_irradiance.empty()) {
+        const size_t irradiance_size = job.output_irradiance_size;
+
+        // The combined convolution was timed on its own.
+        PhaseTimer irradiance_render_timer(combined_irradiance ? nullptr : context.metrics, "irradiance_render");
+
+        if (!combined_irradiance) {
+            combined_irradiance = std::make_unique<OctahedralImage>(irradiance_size, 1);
+        }
+        OctahedralImage& irradiance = *combined_irradiance;
+        if (job.is_irradiance_spherical_harmonics) {
+            size_t mip_level = 0;
+            while (cube_map.get_mip_size(mip_level) > SPHERICAL_HARMONICS_PROJECTION_SIZE) {
+                mip_level++;
+            }
+            const size_t size = cube_map.get_mip_size(mip_level);
+
+            // `project_cube_map` takes planar faces.
+            std::vector<float> planes_data(6 * 3 * size * size);
+            const float* planes[6][3];
+            for (int side = 0; side < 6; side++) {
+                const float* const face = cube_map.get_face(side, mip_level);
+                for (int channel = 0; channel < 3; channel++) {
+                    float* const plane = planes_data.data() + (static_cast<size_t>(side) * 3 + static_cast<size_t>(channel)) * size * size;
+                    for (size_t i = 0; i < size * size; i++) {
+                        plane[i] = face[i * 4 + static_cast<size_t>(channel)];
+                    }
+                    planes[side][channel] = plane;
+                }
+            }
+            const SphericalHarmonics harmonics = project_cube_map(planes, size);
+
+            std::vector<float> red(irradiance_size * irradiance_size), green(red.size()), blue(red.size());
+            evaluate_irradiance(harmonics, OCTAHEDRAL_FACE, irradiance_size, red.data(), green.data(), blue.data());
+
+            float* const texels = irradiance.get_level(0);
+            for (size_t i = 0; i < red.size(); i++) {
+                texels[i * 4 + 0] = red[i];
+                texels[i * 4 + 1] = green[i];
+                texels[i * 4 + 2] = blue[i];
+                texels[i * 4 + 3] = 1.f;
+            }
+        } else if (!job.is_combined_convolution) {
+            const size_t mip_level = get_irradiance_mip_level(output_size);
+            const IrradianceSamples samples = create_irradiance_samples(cube_map.get_mip_size(mip_level));
+            render_octahedral_tiles(context, irradiance_size, [&](size_t row_begin, size_t row_end) {
+                render_irradiance_rows(cube_map, samples, mip_level, OCTAHEDRAL_FACE, irradiance_size, row_begin, row_end, irradiance.get_level(0));
+            });
+        }
+
+        irradiance_render_timer.stop();
+
+        nvtt::CompressionOptions compression_options;
+        set_irradiance_compression_options(compression_options);
+
+        if (write_octahedral_image(context, job, job.output_irradiance, irradiance, compression_options, true, "irradiance_", "Irradiance map") != 0) {
+            // Error is printed in `write_octahedral_image`.
+            return 1;
+        }
+    }
+
+    if (!job.output_prefilter.empty()) {
+        PhaseTimer prefilter_render_timer(context.metrics, "prefilter_render");
+
+        if (!combined_prefilter) {
+            combined_prefilter = std::make_unique<OctahedralImage>(job.output_prefilter_size, get_prefilter_mip_levels(job));
+            combined_prefilter_level = combined_prefilter->mip_levels;
+        }
+        OctahedralImage& prefilter = *combined_prefilter;
+        for (size_t mip_level = 0; mip_level < combined_prefilter_level; mip_level++) {
+            const size_t mip_size = prefilter.get_mip_size(mip_level);
+
+            const auto prefilter_mip_level = static_cast<uint16_t>(mip_level);
+            const float sample_count = get_prefilter_sample_count(job, prefilter_mip_level);
+            const PrefilterSamples samples = create_prefilter_samples(get_prefilter_roughness(job, prefilter_mip_level), static_cast<size_t>(sample_count), output_size);
+
+            render_octahedral_tiles(context, mip_size, [&](size_t row_begin, size_t row_end) {
+                render_prefilter_rows(cube_map, samples, OCTAHEDRAL_FACE, mip_size, row_begin, row_end, prefilter.get_level(mip_level));
+            });
+        }
+
+        prefilter_render_timer.stop();
+
+        nvtt::CompressionOptions compression_options;
+        set_prefilter_compression_options(compression_options, job.compression, job.quality);
+
+        if (write_octahedral_image(context, job, job.output_prefilter, prefilter, compression_options, false, "prefilter_", "Prefilter map") != 0) {
+            // Error is printed in `write_octahedral_image`.
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+// Same outputs as `compile_cube_map_gpu` rendered by the CPU versions of the shaders, tile by tile on the thread pool.
+// Kernels follow the OpenGL shaders.
+static int compile_cube_map_cpu(const JobContext& context, const CompileJob& job, HdrWrapper& data) noexcept {
+    const size_t output_size = job.output_size;
+
+    PhaseTimer decode_timer(context.metrics, "decode");
+
+    const CubeMapLayout layout = get_cube_map_layout(job, data.width, data.height);
+
+    // Octahedral maps of equirectangular inputs are projected from the input, the cube map is built only for the
+    // irradiance and prefilter convolutions then.
+    const bool is_cube_map_needed = !job.is_octahedral || layout != CubeMapLayout::EQUIRECTANGULAR || !job.output_irradiance.empty() || !job.output_prefilter.empty();
+    CubeMapImage cube_map(is_cube_map_needed ? output_size : 0);
+
+    // Kernels sample floats, half float inputs are only expanded for the CPU backend.
+    std::vector<float> float_data;
+    if (layout != CubeMapLayout::EQUIRECTANGULAR) {
+        if (load_cube_map_faces(context, job, layout, data, cube_map) != 0) {
+            // Error is printed in `load_cube_map_faces`.
+            return 1;
+        }
+    } else {
+        if (prepare_equirectangular_image(context, data) != 0) {
+            // Error is printed in `prepare_equirectangular_image`.
+            return 1;
+        }
+
+        if (data.data == nullptr) {
+            float_data.resize(data.half_data.size());
+            convert_rgba16f_to_rgba32f(data.half_data.data(), data.half_data.size(), float_data.data());
+            data.half_data = std::vector<uint16_t>();
+        }
+
+        reduce_cpu_equirectangular_image(context, data, float_data, output_size);
+    }
+    const float* const pixels = data.data != nullptr ? data.data : float_data.data();
+
+    decode_timer.stop();
+
+    PhaseTimer render_timer(context.metrics, "render");
+
+    // Like the GPU cube map texture, only the first mip level is projected from the input or copied from its faces and
+    // every following one is downsampled from the previous one.
+    if (layout == CubeMapLayout::EQUIRECTANGULAR && is_cube_map_needed) {
+        render_cube_tiles(context, output_size, [&](int face, size_t row_begin, size_t row_end) {
+            render_equirectangular_rows(pixels, static_cast<size_t>(data.width), static_cast<size_t>(data.height), face, output_size, row_begin, row_end, cube_map.get_face(face, 0));
+        });
+    }
+    downsample_cube_map_image(context, cube_map);
+
+    render_timer.stop();
+
+    if (job.is_octahedral) {
+        const float* const equirectangular_pixels = layout == CubeMapLayout::EQUIRECTANGULAR ? pixels : nullptr;
+        return compile_octahedral_cpu(context, job, equirectangular_pixels, static_cast<size_t>(data.width), static_cast<size_t>(data.height), cube_map);
+    }
+
+    if (!job.output.empty() && write_cube_map_image(context, job, cube_map) != 0) {
+        // Error is printed in `write_cube_map_image`.
+        return 1;
+    }
+
+    // With `--combined-convolution` the irradiance and the rough prefilter mip levels are rendered before either is
+    // compressed.
+    std::unique_ptr<CubeMapImage> irradiance, prefilter;
+    size_t combined_prefilter_level = 0;
+    if (job.is_combined_convolution) {
+        std::vector<ConvolutionTarget> targets;
+        if (!job.output_irradiance.empty() && !job.is_irradiance_spherical_harmonics) {
+            irradiance = std::make_unique<CubeMapImage>(job.output_irradiance_size);
+            targets.push_back(get_convolution_target(*irradiance, 0, 1.f));
+        }
+        if (!job.output_prefilter.empty()) {
+            prefilter = std::make_unique<CubeMapImage>(job.output_prefilter_size, get_prefilter_mip_levels(job));
+            combined_prefilter_level = get_combined_prefilter_level(job);
+            for (size_t mip_level = combined_prefilter_level; mip_level < prefilter->mip_levels; mip_level++) {
+                targets.push_back(get_convolution_target(*prefilter, mip_level, get_prefilter_a_sqr(job, static_cast<uint16_t>(mip_level))));
+            }
+        }
+        render_combined_convolution(context, job, cube_map, targets);
+    }
+
+    if (!job.output_irradiance.empty() && compile_irradiance_cpu(context, job, cube_map, std::move(irradiance)) != 0) {
+        // Error is printed in `compile_irradiance_cpu`.
+        return 1;
+    }
+
+    if (!job.output_prefilter.empty() && compile_prefilter_cpu(context, job, cube_map, std::move(prefilter), combined_prefilter_level) != 0) {
+        // Error is printed in `compile_prefilter_cpu`.
+        return 1;
+    }
+
+    return 0;
+}
+
+// Irradiance output rendered from the cube map texture with all its mip levels, views from `current_view` on.
+// `while_compressing` is passed to `read_back_and_compress_cube`, spherical harmonics run it once they're written.
+static int compile_irradiance_gpu(Renderer& renderer, const JobContext& context, const CompileJob& job, bgfx::ViewId& current_view, bgfx::TextureHandle cube_map_texture,
+                                  const std::function<int()>& while_compressing = {}) noexcept {
+    const size_t output_size = job.output_size;
+    const size_t irradiance_size = job.output_irradiance_size;
+
+    const bgfx::VertexBufferHandle vertex_buffer = renderer.vertex_buffer;
+    const bgfx::UniformHandle texture_uniform = renderer.texture_uniform;
+    const bgfx::UniformHandle settings_uniform = renderer.settings_uniform;
+    const glm::mat4* const cube_map_view_matrices = renderer.cube_map_view_matrices;
+
+    TextureCompilerErrorHandler error_handler(context.log);
+
+    PhaseTimer irradiance_render_timer(context.metrics, "irradiance_render");
+    ConvolutionFrames frames(renderer);
+
+    // Both shaders take four steps of phi by one of theta per texel of the mip level they sample, see
+    // `get_irradiance_mip_level`.
+    const size_t mip_level = get_irradiance_mip_level(output_size);
+    const size_t step_count = std::max<size_t>(output_size >> mip_level, 1);
+    const double sample_count = 4.0 * static_cast<double>(step_count) * static_cast<double>(step_count);
+
+    if (job.is_irradiance_spherical_harmonics) {
+        irradiance_render_timer.stop();
+
+        if (compile_irradiance_spherical_harmonics(renderer, context, job, current_view++, cube_map_texture) != 0) {
+            // Error is printed in `compile_irradiance_spherical_harmonics`.
+            return 1;
+        }
+
+        if (while_compressing && while_compressing() != 0) {
+            return 1;
+        }
+    } else {
+        RenderTarget irradiance_faces;
+        RenderTarget irradiance_textures[6];
+        std::vector<HandleWrapper<bgfx::FrameBufferHandle>> irradiance_frame_buffers;
+
+        if (renderer.is_compute_supported) {
+            irradiance_faces = RenderTarget(renderer.render_targets, RenderTargetDescription { false, static_cast<uint16_t>(irradiance_size), false, 6, bgfx::TextureFormat::RGBA16F,
+                                                                                               BGFX_TEXTURE_COMPUTE_WRITE | BGFX_SAMPLER_U_CLAMP | BGFX_SAMPLER_V_CLAMP });
+            if (!bgfx::isValid(irradiance_faces)) {
+                context.log << "Texture compiler error. Failed to create irradiance texture." << std::endl;
+                return 1;
+            }
+            bgfx::setName(irradiance_faces, "irradiance_faces");
+
+            bgfx::setViewName(current_view, "irradiance_compute_view");
+
+            const float settings[4] = { static_cast<float>(irradiance_size), static_cast<float>(mip_level), static_cast<float>(step_count), 0.f };
+
+            const uint16_t tile_size = get_convolution_tile_size(static_cast<uint16_t>(irradiance_size), sample_count, 6);
+            for (uint16_t tile_y = 0; tile_y < irradiance_size; tile_y = static_cast<uint16_t>(tile_y + tile_size)) {
+                for (uint16_t tile_x = 0; tile_x < irradiance_size; tile_x = static_cast<uint16_t>(tile_x + tile_size)) {
+                    const uint32_t tile_width = std::min<uint32_t>(tile_size, static_cast<uint32_t>(irradiance_size - tile_x));
+                    const uint32_t tile_height = std::min<uint32_t>(tile_size, static_cast<uint32_t>(irradiance_size - tile_y));
+                    frames.add(static_cast<double>(tile_width) * tile_height * 6.0 * sample_count);
+
+                    const float tile[4] = { static_cast<float>(tile_x), static_cast<float>(tile_y), 0.f, 0.f };
+                    bgfx::setUniform(settings_uniform, settings);
+                    bgfx::setUniform(renderer.tile_uniform, tile);
+                    bgfx::setUniform(renderer.inverse_view_projections_uniform, renderer.cube_map_inverse_view_projections, 6);
+
+                    bgfx::setTexture(0, texture_uniform, cube_map_texture);
+                    bgfx::setImage(1, irradiance_faces, 0, bgfx::Access::Write, bgfx::TextureFormat::RGBA16F);
+
+                    bgfx::dispatch(current_view, renderer.irradiance_compute_program, (tile_width + 7) / 8, (tile_height + 7) / 8, 6);
+                }
+            }
+
+            current_view++;
+        } else {
+            for (size_t side = 0; side < 6; side++) {
+                const std::string irradiance_texture_name = "irradiance_texture_" + std::to_string(side);
+
+                irradiance_textures[side] = RenderTarget(renderer.render_targets, RenderTargetDescription { false, static_cast<uint16_t>(irradiance_size), false, 1, bgfx::TextureFormat::RGBA16F,
+                                                                                                          BGFX_TEXTURE_RT | BGFX_SAMPLER_U_CLAMP | BGFX_SAMPLER_V_CLAMP });
+                if (!bgfx::isValid(irradiance_textures[side])) {
+                    context.log << "Texture compiler error. Failed to create irradiance texture." << std::endl;
+                    return 1;
+                }
+                bgfx::setName(irradiance_textures[side], irradiance_texture_name.c_str());
+            }
+
+            for (size_t side = 0; side < 6; side++, current_view++) {
+                const std::string irradiance_view_name = "irradiance_view_" + std::to_string(side);
+
+                bgfx::setViewClear(current_view, BGFX_CLEAR_COLOR);
+                bgfx::setViewName(current_view, irradiance_view_name.c_str());
+
+                bgfx::FrameBufferHandle frame_buffer = bgfx::createFrameBuffer(1, &irradiance_textures[side].handle, false);
+                if (!bgfx::isValid(frame_buffer)) {
+                    context.log << "Texture compiler error. Failed to create irradiance map frame buffer." << std::endl;
+                    return 1;
+                }
+                irradiance_frame_buffers.emplace_back(frame_buffer);
+
+                bgfx::setViewFrameBuffer(current_view, frame_buffer);
+                bgfx::setViewRect(current_view, 0, 0, static_cast<uint16_t>(irradiance_size), static_cast<uint16_t>(irradiance_size));
+                bgfx::setViewTransform(current_view, glm::value_ptr(cube_map_view_matrices[side]), glm::value_ptr(CUBE_MAP_PROJECTION));
+
+                const float settings[4] = { static_cast<float>(mip_level), static_cast<float>(step_count), 0.f, 0.f };
+                submit_convolution_tiles(frames, current_view, static_cast<uint16_t>(irradiance_size), sample_count, [&] {
+                    bgfx::setVertexBuffer(0, vertex_buffer, 0, static_cast<uint32_t>(std::size(CUBE_VERTICES) / 3));
+                    bgfx::setUniform(settings_uniform, settings);
+                    bgfx::setTexture(0, texture_uniform, cube_map_texture);
+
+                    bgfx::setState(BGFX_STATE_WRITE_RGB | BGFX_STATE_CULL_CCW);
+                    bgfx::submit(current_view, renderer.irradiance_program);
+                });
+            }
+        }
+
+        irradiance_render_timer.stop();
+
+        const auto get_irradiance_texture = [&](int side, int /*mip_level*/) -> BlitSource {
+            if (renderer.is_compute_supported) {
+                return BlitSource { irradiance_faces, 0, static_cast<uint16_t>(side) };
+            }
+            return BlitSource { irradiance_textures[side], 0, 0 };
+        };
+
+        if (renderer.preview_textures != nullptr) {
+            return copy_to_preview_texture(renderer, context, current_view++, job.output_irradiance, static_cast<uint16_t>(irradiance_size), 1, get_irradiance_texture, "irradiance_",
+                                           while_compressing);
+        }
+
+        FileOutputHandler irradiance_output(job.output_irradiance, context.metrics, context.written_outputs, context.is_in_memory);
+        if (!irradiance_output.is_open()) {
+            context.log << "Texture compiler error. Failed to open output file." << std::endl;
+            return 1;
+        }
+
+        nvtt::OutputOptions irradiance_output_options;
+        irradiance_output_options.setOutputHandler(&irradiance_output);
+        irradiance_output_options.setContainer(nvtt::Container_DDS10);
+        irradiance_output_options.setErrorHandler(&error_handler);
+
+        nvtt::CompressionOptions irradiance_compression_options;
+        set_irradiance_compression_options(irradiance_compression_options);
+
+        auto before = std::chrono::steady_clock::now();
+
+        report_progress(context, "", 0);
+
+        reserve_output(context, irradiance_output, static_cast<int>(irradiance_size), static_cast<int>(irradiance_size), 6, 1, irradiance_compression_options);
+        if (!context.compressor.outputHeader(nvtt::TextureType_Cube, static_cast<int>(irradiance_size), static_cast<int>(irradiance_size), 1, 1, 1, false, irradiance_compression_options, irradiance_output_options)) {
+            // Error is printed via `error_handler`.
+            return 1;
+        }
+
+        bgfx::setViewName(current_view, "irradiance_read_back_view");
+
+        if (read_back_and_compress_cube(renderer, context, current_view++, static_cast<uint16_t>(irradiance_size), 1, 1, get_irradiance_texture, irradiance_compression_options, CubeFaceEncoder::RGBA16F, irradiance_output, "irradiance_",
+                                        while_compressing) != 0) {
+            // Error is printed in `read_back_and_compress_cube`.
+            return 1;
+        }
+
+        pack_irradiance_output(irradiance_output, job.irradiance_format);
+
+        if (finish_output(context, irradiance_output, job) != 0) {
+            // Error is printed in `finish_output`.
+            return 1;
+        }
+
+        auto after = std::chrono::steady_clock::now();
+        auto milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(after - before);
+        context.log << "\rIrradiance map compression took " << std::setprecision(3) << milliseconds.count() / 1000.f << " seconds." << std::endl;
+
+        irradiance_frame_buffers.clear();
+    }
+
+    return 0;
+}
+
+// Samples don't depend on the texel, so the shaders don't importance sample GGX for every texel but read the samples of
+// `create_prefilter_samples` from a table with a row of `PREFILTER_MAX_SAMPLE_COUNT` texels per prefilter mip level and
+// only rotate them to the tangent frame of the texel. Samples below the horizon are culled, `sample_counts` gets the
+// number of samples left in every row. The CPU backend convolves with the same samples.
+static bgfx::TextureHandle create_prefilter_sample_table(const CompileJob& job, uint16_t mip_levels, std::vector<float>& sample_counts) noexcept {
+    const bgfx::Memory* memory = bgfx::alloc(static_cast<uint32_t>(PREFILTER_MAX_SAMPLE_COUNT) * mip_levels * 4 * sizeof(float));
+    std::memset(memory->data, 0, memory->size);
+
+    sample_counts.resize(mip_levels);
+    for (uint16_t mip_level = 0; mip_level < mip_levels; mip_level++) {
+        const float sample_count = get_prefilter_sample_count(job, mip_level);
+        const PrefilterSamples samples = create_prefilter_samples(get_prefilter_roughness(job, mip_level), static_cast<size_t>(sample_count), job.output_size);
+
+        float* const row = reinterpret_cast<float*>(memory->data) + static_cast<size_t>(mip_level) * PREFILTER_MAX_SAMPLE_COUNT * 4;
+        for (size_t i = 0; i < samples.z.size(); i++) {
+            row[i * 4 + 0] = samples.x[i];
+            row[i * 4 + 1] = samples.y[i];
+            row[i * 4 + 2] = samples.z[i];
+            row[i * 4 + 3] = samples.mip_levels[i];
+        }
+        sample_counts[mip_level] = static_cast<float>(samples.z.size());
+    }
+
+    return bgfx::createTexture2D(PREFILTER_MAX_SAMPLE_COUNT, mip_levels, false, 1, bgfx::TextureFormat::RGBA32F, BGFX_SAMPLER_POINT | BGFX_SAMPLER_U_CLAMP | BGFX_SAMPLER_V_CLAMP, memory);
+}
+
+// Prefilter output rendered from the cube map texture with all its mip levels, views from `current_view` on.
+static int compile_prefilter_gpu(Renderer& renderer, const JobContext& context, const CompileJob& job, bgfx::ViewId& current_view, bgfx::TextureHandle cube_map_texture) noexcept {
+    const size_t prefilter_size = job.output_prefilter_size;
+
+    const bgfx::VertexBufferHandle vertex_buffer = renderer.vertex_buffer;
+    const bgfx::UniformHandle texture_uniform = renderer.texture_uniform;
+    const bgfx::UniformHandle settings_uniform = renderer.settings_uniform;
+    const glm::mat4* const cube_map_view_matrices = renderer.cube_map_view_matrices;
+
+    TextureCompilerErrorHandler error_handler(context.log);
+
+    PhaseTimer prefilter_render_timer(context.metrics, "prefilter_render");
+    ConvolutionFrames frames(renderer);
+
+    const uint16_t prefilter_mip_levels = get_prefilter_mip_levels(job);
+
+    std::vector<float> sample_counts;
+    HandleWrapper<bgfx::TextureHandle> samples_texture = create_prefilter_sample_table(job, prefilter_mip_levels, sample_counts);
+    if (!bgfx::isValid(samples_texture)) {
+        context.log << "Texture compiler error. Failed to create prefilter sample texture." << std::endl;
+        return 1;
+    }
+    bgfx::setName(samples_texture, "prefilter_samples");
+
+    // Texture coordinate of the row of a mip level in the sample table.
+    const auto get_samples_row = [prefilter_mip_levels](uint16_t mip_level) {
+        return (static_cast<float>(mip_level) + 0.5f) / static_cast<float>(prefilter_mip_levels);
+    };
+
+    // Every face and mip level is rendered to a single texture, a texture array with compute and a cube map without,
+    // so that they're all read back together.
+    RenderTarget prefilter_faces;
+    std::vector<HandleWrapper<bgfx::FrameBufferHandle>> prefilter_frame_buffers;
+
+    if (renderer.is_compute_supported) {
+        prefilter_faces = RenderTarget(renderer.render_targets, RenderTargetDescription { false, static_cast<uint16_t>(prefilter_size), true, 6, bgfx::TextureFormat::RGBA16F,
+                                                                                          BGFX_TEXTURE_COMPUTE_WRITE | BGFX_SAMPLER_U_CLAMP | BGFX_SAMPLER_V_CLAMP });
+        if (!bgfx::isValid(prefilter_faces)) {
+            context.log << "Texture compiler error. Failed to create prefilter texture." << std::endl;
+            return 1;
+        }
+        bgfx::setName(prefilter_faces, "prefilter_faces");
+
+        bgfx::setViewName(current_view, "prefilter_compute_view");
+
+        for (uint16_t mip_size = static_cast<uint16_t>(prefilter_size), mip_level = 0; mip_level < prefilter_mip_levels; mip_size = static_cast<uint16_t>(std::max(mip_size / 2, 1)), mip_level++) {
+            const float sample_count = sample_counts[mip_level];
+            const float settings[4] = { get_samples_row(mip_level), sample_count, static_cast<float>(mip_size), 0.f };
+
+            const uint16_t tile_size = get_convolution_tile_size(mip_size, sample_count, 6);
+            for (uint16_t tile_y = 0; tile_y < mip_size; tile_y = static_cast<uint16_t>(tile_y + tile_size)) {
+                for (uint16_t tile_x = 0; tile_x < mip_size; tile_x = static_cast<uint16_t>(tile_x + tile_size)) {
+                    const uint32_t tile_width = std::min<uint32_t>(tile_size, static_cast<uint32_t>(mip_size - tile_x));
+                    const uint32_t tile_height = std::min<uint32_t>(tile_size, static_cast<uint32_t>(mip_size - tile_y));
+                    frames.add(static_cast<double>(tile_width) * tile_height * 6.0 * sample_count);
+
+                    const float tile[4] = { static_cast<float>(tile_x), static_cast<float>(tile_y), 0.f, 0.f };
+                    bgfx::setUniform(settings_uniform, settings);
+                    bgfx::setUniform(renderer.tile_uniform, tile);
+                    bgfx::setUniform(renderer.inverse_view_projections_uniform, renderer.cube_map_inverse_view_projections, 6);
+
+                    bgfx::setTexture(0, texture_uniform, cube_map_texture);
+                    bgfx::setTexture(PREFILTER_SAMPLES_STAGE, renderer.samples_uniform, samples_texture);
+                    bgfx::setImage(1, prefilter_faces, static_cast<uint8_t>(mip_level), bgfx::Access::Write, bgfx::TextureFormat::RGBA16F);
+
+                    bgfx::dispatch(current_view, renderer.prefilter_compute_program, (tile_width + 7) / 8, (tile_height + 7) / 8, 6);
+                }
+            }
+        }
+
+        current_view++;
+    } else {
+        prefilter_faces = RenderTarget(renderer.render_targets, RenderTargetDescription { true, static_cast<uint16_t>(prefilter_size), true, 1, bgfx::TextureFormat::RGBA16F,
+                                                                                          BGFX_TEXTURE_RT | BGFX_SAMPLER_U_CLAMP | BGFX_SAMPLER_V_CLAMP });
+        if (!bgfx::isValid(prefilter_faces)) {
+            context.log << "Texture compiler error. Failed to create prefilter texture." << std::endl;
+            return 1;
+        }
+        bgfx::setName(prefilter_faces, "prefilter_faces");
+
+        for (size_t side = 0; side < 6; side++) {
+            for (uint16_t mip_size = static_cast<uint16_t>(prefilter_size), mip_level = 0; mip_level < prefilter_mip_levels; mip_size = static_cast<uint16_t>(std::max(mip_size / 2, 1)), mip_level++, current_view++) {
+                const std::string prefilter_view_name = "prefilter_view_" + std::to_string(side) + "_" + std::to_string(mip_level);
+
+                bgfx::setViewClear(current_view, BGFX_CLEAR_COLOR);
+                bgfx::setViewName(current_view, prefilter_view_name.c_str());
+
+                // Every mip level is rendered on its own, generating them would overwrite the ones rendered before.
+                bgfx::Attachment attachment;
+                attachment.init(prefilter_faces, bgfx::Access::Write, static_cast<uint16_t>(side), mip_level, BGFX_RESOLVE_NONE);
+
+                bgfx::FrameBufferHandle frame_buffer = bgfx::createFrameBuffer(1, &attachment, false);
+                if (!bgfx::isValid(frame_buffer)) {
+                    context.log << "Texture compiler error. Failed to create prefilter frame buffer." << std::endl;
+                    return 1;
+                }
+                prefilter_frame_buffers.emplace_back(frame_buffer);
+
+                bgfx::setViewFrameBuffer(current_view, frame_buffer);
+                bgfx::setViewRect(current_view, 0, 0, mip_size, mip_size);
+                bgfx::setViewTransform(current_view, glm::value_ptr(cube_map_view_matrices[side]), glm::value_ptr(CUBE_MAP_PROJECTION));
+
+                const float sample_count = sample_counts[mip_level];
+                submit_convolution_tiles(frames, current_view, mip_size, sample_count, [&] {
+                    bgfx::setVertexBuffer(0, vertex_buffer, 0, static_cast<uint32_t>(std::size(CUBE_VERTICES) / 3));
+                    bgfx::setTexture(0, texture_uniform, cube_map_texture);
+                    bgfx::setTexture(PREFILTER_SAMPLES_STAGE, renderer.samples_uniform, samples_texture);
+
+                    const float settings[4] = { get_samples_row(mip_level), sample_count, 0.f, 0.f };
+                    bgfx::setUniform(settings_uniform, settings);
+
+                    bgfx::setState(BGFX_STATE_WRITE_RGB | BGFX_STATE_CULL_CCW);
+                    bgfx::submit(current_view, renderer.prefilter_program);
+                });
+            }
+        }
+    }
+
+    prefilter_render_timer.stop();
+
+    const auto get_prefilter_texture = [&](int side, int mip_level) -> BlitSource {
+        return BlitSource { prefilter_faces, static_cast<uint8_t>(mip_level), static_cast<uint16_t>(side) };
+    };
+
+    if (renderer.preview_textures != nullptr) {
+        return copy_to_preview_texture(renderer, context, current_view++, job.output_prefilter, static_cast<uint16_t>(prefilter_size), prefilter_mip_levels, get_prefilter_texture, "prefilter_");
+    }
+
+    FileOutputHandler prefilter_output(job.output_prefilter, context.metrics, context.written_outputs, context.is_in_memory);
+    if (!prefilter_output.is_open()) {
+        context.log << "Texture compiler error. Failed to open output file." << std::endl;
+        return 1;
+    }
+
+    nvtt::OutputOptions prefilter_output_options;
+    prefilter_output_options.setOutputHandler(&prefilter_output);
+    prefilter_output_options.setContainer(nvtt::Container_DDS10);
+    prefilter_output_options.setErrorHandler(&error_handler);
+
+    nvtt::CompressionOptions prefilter_compression_options;
+    set_prefilter_compression_options(prefilter_compression_options, job.compression, job.quality);
+
+    auto before = std::chrono::steady_clock::now();
+
+    report_progress(context, "", 0);
+
+    const int total_mip_levels = prefilter_mip_levels;
+    reserve_output(context, prefilter_output, static_cast<int>(prefilter_size), static_cast<int>(prefilter_size), 6, total_mip_levels, prefilter_compression_options);
+    if (!context.compressor.outputHeader(nvtt::TextureType_Cube, static_cast<int>(prefilter_size), static_cast<int>(prefilter_size), 1, 1, total_mip_levels, false, prefilter_compression_options, prefilter_output_options)) {
+        // Error is printed via `error_handler`.
+        return 1;
+    }
+
+    if (is_fast_bc6h(job)) {
+        set_fast_bc6h_format(prefilter_output);
+    }
+
+    bgfx::setViewName(current_view, "prefilter_read_back_view");
+
+    if (read_back_and_compress_cube(renderer, context, current_view++, static_cast<uint16_t>(prefilter_size), total_mip_levels, total_mip_levels, get_prefilter_texture, prefilter_compression_options, get_cube_face_encoder(job), prefilter_output, "prefilter_") != 0) {
+        // Error is printed in `read_back_and_compress_cube`.
+        return 1;
+    }
+
+    if (finish_output(context, prefilter_output, job) != 0) {
+        // Error is printed in `finish_output`.
+        return 1;
+    }
+
+    auto after = std::chrono::steady_clock::now();
+    auto milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(after - before);
+    context.log << "\rPrefilter map compression took " << std::setprecision(3) << milliseconds.count() / 1000.f << " seconds." << std::endl;
+
+    return 0;
+}
+
+// Renders the requested irradiance and prefilter outputs from the cube map texture with all its mip levels, starting at `current_view`.
+static int render_environment_maps_gpu(Renderer& renderer, const JobContext& context, const CompileJob& job, bgfx::ViewId current_view, bgfx::TextureHandle cube_map_texture) noexcept {
+    const auto compile_prefilter = [&]() {
+        if (!job.output_prefilter.empty() && compile_prefilter_gpu(renderer, context, job, current_view, cube_map_texture) != 0) {
+            // Error is printed in `compile_prefilter_gpu`.
+            return 1;
+        }
+        return 0;
+    };
+
+    if (job.output_irradiance.empty()) {
+        return compile_prefilter();
+    }
+
+    // Prefilter is rendered and read back while the irradiance faces are compressed, like the environment maps are
+    // while the cube map faces are, so no stage of the chain waits for the CPU work of the previous one.
+    if (compile_irradiance_gpu(renderer, context, job, current_view, cube_map_texture, compile_prefilter) != 0) {
+        // Error is printed in `compile_irradiance_gpu` or in `compile_prefilter_gpu`.
+        return 1;
+    }
+
+    return 0;
+}
+
+// Reads back every mip level of the cube map rendered on the GPU and compresses it to the cube map output, or encodes
+// it to BC6H on the GPU. Compute shaders render to `cube_map_faces`, fragment shaders straight to `cube_map_texture`.
+// `render_environment_maps` runs while the faces are compressed on the thread pool, see `read_back_and_compress_cube`,
+// so the irradiance and prefilter convolutions run on the GPU at the same time. BC6H blocks encoded on the GPU leave
+// nothing to the CPU, the environment maps follow them then.
+static int read_back_cube_map_gpu(Renderer& renderer, const JobContext& context, const CompileJob& job, bgfx::ViewId& current_view, bgfx::TextureHandle cube_map_faces,
+                                  bgfx::TextureHandle cube_map_texture, const std::function<int()>& render_environment_maps) noexcept {
+    const size_t output_size = job.output_size;
+
+    TextureCompilerErrorHandler error_handler(context.log);
+
+    FileOutputHandler cube_map_output(job.output, context.metrics, context.written_outputs, context.is_in_memory);
+    if (!cube_map_output.is_open()) {
+        context.log << "Texture compiler error. Failed to open output file." << std::endl;
+        return 1;
+    }
+
+    nvtt::OutputOptions cube_map_output_options;
+    cube_map_output_options.setOutputHandler(&cube_map_output);
+    cube_map_output_options.setContainer(nvtt::Container_DDS10);
+    cube_map_output_options.setErrorHandler(&error_handler);
+
+    nvtt::CompressionOptions cube_map_compression_options;
+    set_cube_map_compression_options(cube_map_compression_options, job.compression, job.quality);
+
+    auto before = std::chrono::steady_clock::now();
+
+    report_progress(context, "", 0);
+
+    const int total_mip_levels = static_cast<int>(count_mip_maps(output_size));
+    reserve_output(context, cube_map_output, static_cast<int>(output_size), static_cast<int>(output_size), 6, total_mip_levels, cube_map_compression_options);
+    if (!context.compressor.outputHeader(nvtt::TextureType_Cube, static_cast<int>(output_size), static_cast<int>(output_size), 1, 1, total_mip_levels, false, cube_map_compression_options, cube_map_output_options)) {
+        // Error is printed via `error_handler`.
+        return 1;
+    }
+
+    if (is_fast_bc6h(job)) {
+        set_fast_bc6h_format(cube_map_output);
+    }
+
+    if (is_fast_bc6h(job) && renderer.is_bc6h_compute_supported) {
+        if (encode_and_read_back_bc6h(renderer, context, current_view, cube_map_faces, static_cast<uint16_t>(output_size), total_mip_levels, cube_map_output) != 0) {
+            // Error is printed in `encode_and_read_back_bc6h`.
+            return 1;
+        }
+        current_view += 2;
+
+        if (render_environment_maps() != 0) {
+            // Error is printed in `render_environment_maps`.
+            return 1;
+        }
+    } else {
+        bgfx::setViewName(current_view, "cube_map_read_back_view");
+
+        const auto get_cube_side_texture = [&](int side, int mip_level) -> BlitSource {
+            const bgfx::TextureHandle source = renderer.is_compute_supported ? cube_map_faces : cube_map_texture;
+            return BlitSource { source, static_cast<uint8_t>(mip_level), static_cast<uint16_t>(side) };
+        };
+
+        if (read_back_and_compress_cube(renderer, context, current_view++, static_cast<uint16_t>(output_size), total_mip_levels, total_mip_levels, get_cube_side_texture,
+                                        cube_map_compression_options, get_cube_face_encoder(job), cube_map_output, "", render_environment_maps) != 0) {
+            // Error is printed in `read_back_and_compress_cube` or `render_environment_maps`.
+            return 1;
+        }
+    }
+
+    if (finish_output(context, cube_map_output, job) != 0) {
+        // Error is printed in `finish_output`.
+        return 1;
+    }
+
+    auto after = std::chrono::steady_clock::now();
+    auto milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(after - before);
+    context.log << "\rCube map compression took " << std::setprecision(3) << milliseconds.count() / 1000.f << " seconds." << std::endl;
+
+    return 0;
+}
+
+static int compile_cube_map_gpu(Renderer& renderer, const JobContext& context, const CompileJob& job, HdrWrapper& data) noexcept {
+    const size_t output_size = job.output_size;
+
+    // Views keep their state between frames, don't let the previous cube map job leak its frame buffers and view rectangles into this one.
+    for (bgfx::ViewId view = 0; view < bgfx::getCaps()->limits.maxViews; view++) {
+        bgfx::resetView(view);
+    }
+
+    PhaseTimer decode_timer(context.metrics, "decode");
+
+    // Faces need no projection, the cube map is built and written on the CPU, then uploaded with all its mip levels
+    // for the irradiance and prefilter shaders.
+    const CubeMapLayout layout = get_cube_map_layout(job, data.width, data.height);
+    if (layout != CubeMapLayout::EQUIRECTANGULAR) {
+        CubeMapImage cube_map(output_size);
+        if (load_cube_map_faces(context, job, layout, data, cube_map) != 0) {
+            // Error is printed in `load_cube_map_faces`.
+            return 1;
+        }
+
+        decode_timer.stop();
+
+        PhaseTimer render_timer(context.metrics, "render");
+        downsample_cube_map_image(context, cube_map);
+        render_timer.stop();
+
+        // Previews copy the cube map from the texture the environment maps are rendered from.
+        const bool is_preview_output = renderer.preview_textures != nullptr && !job.output.empty();
+        if (!job.output.empty() && !is_preview_output && write_cube_map_image(context, job, cube_map) != 0) {
+            // Error is printed in `write_cube_map_image`.
+            return 1;
+        }
+
+        if (job.output_irradiance.empty() && job.output_prefilter.empty() && !is_preview_output) {
+            return 0;
+        }
+
+        PhaseTimer convert_timer(context.metrics, "convert");
+
+        // Cube texture memory holds every mip level of the first face, then every mip level of the second one and so on.
+        std::vector<uint16_t> half_data;
+        for (int side = 0; side < 6; side++) {
+            for (size_t mip_level = 0; mip_level < cube_map.mip_levels; mip_level++) {
+                const size_t mip_size = cube_map.get_mip_size(mip_level);
+                const size_t offset = half_data.size();
+                half_data.resize(offset + mip_size * mip_size * 4);
+                convert_rgba32f_to_rgba16f(cube_map.get_face(side, mip_level), mip_size * mip_size * 4, half_data.data() + offset);
+            }
+        }
+
+        convert_timer.stop();
+
+        HandleWrapper<bgfx::TextureHandle> cube_map_texture = bgfx::createTextureCube(static_cast<uint16_t>(output_size), true, 1, bgfx::TextureFormat::RGBA16F, BGFX_SAMPLER_U_CLAMP | BGFX_SAMPLER_V_CLAMP,
+                                                                                      bgfx::makeRef(half_data.data(), static_cast<uint32_t>(half_data.size() * sizeof(uint16_t))));
+        if (!bgfx::isValid(cube_map_texture)) {
+            context.log << "Texture compiler error. Failed to create cube map texture." << std::endl;
+            return 1;
+        }
+        bgfx::setName(cube_map_texture, "cube_map_texture");
+
+        bgfx::ViewId current_view = 0;
+        if (is_preview_output) {
+            const auto get_cube_side_texture = [&](int side, int mip_level) -> BlitSource {
+                return BlitSource { cube_map_texture, static_cast<uint8_t>(mip_level), static_cast<uint16_t>(side) };
+            };
+            if (copy_to_preview_texture(renderer, context, current_view++, job.output, static_cast<uint16_t>(output_size), static_cast<int>(cube_map.mip_levels), get_cube_side_texture, "") != 0) {
+                // Error is printed in `copy_to_preview_texture`.
+                return 1;
+            }
+        }
+
+        return render_environment_maps_gpu(renderer, context, job, current_view, cube_map_texture);
+    }
+
+    if (prepare_equirectangular_image(context, data) != 0) {
+        // Error is printed in `prepare_equirectangular_image`.
+        return 1;
+    }
+
+    decode_timer.stop();
+
+    PhaseTimer convert_timer(context.metrics, "convert");
+    prepare_gpu_equirectangular_image(context, data, output_size);
+    convert_timer.stop();
+
+    HandleWrapper<bgfx::TextureHandle> texture = bgfx::createTexture2D(static_cast<uint16_t>(data.width), static_cast<uint16_t>(data.height), false, 1, bgfx::TextureFormat::RGBA16F,
+                                                                       BGFX_SAMPLER_U_CLAMP | BGFX_SAMPLER_V_CLAMP,
+                                                                       bgfx::makeRef(data.half_data.data(), static_cast<uint32_t>(data.half_data.size() * sizeof(uint16_t))));
+    if (!bgfx::isValid(texture)) {
+        context.log << "Texture compiler error. Failed to create HDR texture." << std::endl;
+        return 1;
+    }
+    bgfx::setName(texture, "original_texture");
+
+    const bgfx::VertexBufferHandle vertex_buffer = renderer.vertex_buffer;
+    const bgfx::UniformHandle texture_uniform = renderer.texture_uniform;
+    const bgfx::UniformHandle settings_uniform = renderer.settings_uniform;
+    const glm::mat4* const cube_map_view_matrices = renderer.cube_map_view_matrices;
+
+    const uint16_t cube_map_mip_levels = static_cast<uint16_t>(count_mip_maps(output_size));
+
+    // With compute shaders all the faces and mip levels are written to a texture array, which is then copied to the cube
+    // map texture sampled by the other shaders, otherwise the faces are rendered straight to the cube map texture. Only
+    // the first mip level is projected from the input, `downsample_shader` or the mip generation of the frame buffers
+    // builds every following one from the previous one, and every mip level is read back for the output.
+    //
+    // Each stage holds its targets only as long as it needs them: with compute shaders the cube map texture is created
+    // once the faces are read back, and only for irradiance and prefilter outputs, and the texture array is released
+    // as soon as it's copied, so at most one full mip chain of faces is alive besides the read back textures.
+    RenderTarget cube_map_faces;
+    std::vector<HandleWrapper<bgfx::FrameBufferHandle>> cube_map_frame_buffers;
+
+    RenderTarget cube_map_texture;
+    const auto create_cube_map_texture = [&](uint64_t flags) -> bool {
+        cube_map_texture = RenderTarget(renderer.render_targets, RenderTargetDescription { true, static_cast<uint16_t>(output_size), true, 1, bgfx::TextureFormat::RGBA16F,
+                                                                                           flags | BGFX_SAMPLER_U_CLAMP | BGFX_SAMPLER_V_CLAMP });
+        if (!bgfx::isValid(cube_map_texture)) {
+            context.log << "Texture compiler error. Failed to create cube map texture." << std::endl;
+            return false;
+        }
+        return true;
+    };
+    if (!renderer.is_compute_supported && !create_cube_map_texture(BGFX_TEXTURE_RT)) {
+        // Error is printed in `create_cube_map_texture`.
+        return 1;
+    }
+
+    // GPU executes submitted views during `bgfx::frame` calls of the read back loops, so GPU time is part of the
+    // `readback` phases and the `render` phases only cover submission.
+    PhaseTimer render_timer(context.metrics, "render");
+
+    bgfx::ViewId current_view = 0;
+
+    if (renderer.is_compute_supported) {
+        cube_map_faces = RenderTarget(renderer.render_targets, RenderTargetDescription { false, static_cast<uint16_t>(output_size), true, 6, bgfx::TextureFormat::RGBA16F,
+                                                                                         BGFX_TEXTURE_COMPUTE_WRITE | BGFX_SAMPLER_U_CLAMP | BGFX_SAMPLER_V_CLAMP });
+        if (!bgfx::isValid(cube_map_faces)) {
+            context.log << "Texture compiler error. Failed to create cube map faces texture." << std::endl;
+            return 1;
+        }
+        bgfx::setName(cube_map_faces, "cube_map_faces");
+
+        // Every mip level is downsampled from the previous one, so dispatches must run in the order they are submitted.
+        bgfx::setViewName(current_view, "cube_map_compute_view");
+        bgfx::setViewMode(current_view, bgfx::ViewMode::Sequential);
+
+        const float settings[4] = { static_cast<float>(output_size), 0.f, 0.f, 0.f };
+        bgfx::setUniform(settings_uniform, settings);
+        bgfx::setUniform(renderer.inverse_view_projections_uniform, renderer.cube_map_inverse_view_projections, 6);
+
+        bgfx::setTexture(0, texture_uniform, texture);
+        bgfx::setImage(1, cube_map_faces, 0, bgfx::Access::Write, bgfx::TextureFormat::RGBA16F);
+
+        const uint32_t group_count = static_cast<uint32_t>((output_size + 7) / 8);
+        bgfx::dispatch(current_view, renderer.cube_map_compute_program, group_count, group_count, 6);
+
+        for (uint16_t mip_level = 1; mip_level < cube_map_mip_levels; mip_level++) {
+            const uint16_t mip_size = std::max(static_cast<uint16_t>(output_size >> mip_level), static_cast<uint16_t>(1));
+            const uint16_t previous_mip_size = std::max(static_cast<uint16_t>(output_size >> (mip_level - 1)), static_cast<uint16_t>(1));
+            const float downsample_settings[4] = { static_cast<float>(mip_size), static_cast<float>(previous_mip_size), 0.f, 0.f };
+            bgfx::setUniform(settings_uniform, downsample_settings);
+
+            bgfx::setImage(0, cube_map_faces, static_cast<uint8_t>(mip_level - 1), bgfx::Access::Read, bgfx::TextureFormat::RGBA16F);
+            bgfx::setImage(1, cube_map_faces, static_cast<uint8_t>(mip_level), bgfx::Access::Write, bgfx::TextureFormat::RGBA16F);
+
+            const uint32_t mip_group_count = (mip_size + 7U) / 8U;
+            bgfx::dispatch(current_view, renderer.downsample_compute_program, mip_group_count, mip_group_count, 6);
+        }
+
+        current_view++;
+    } else {
+        // Mip levels of the whole cube map are generated from the first one every time a face's frame buffer is
+        // resolved, so the last face leaves all of them up to date.
+        for (size_t side = 0; side < 6; side++, current_view++) {
+            const std::string cube_map_view_name = "cube_map_view_" + std::to_string(side);
+
+            bgfx::setViewClear(current_view, BGFX_CLEAR_COLOR);
+            bgfx::setViewName(current_view, cube_map_view_name.c_str());
+
+            bgfx::Attachment attachment;
+            attachment.init(cube_map_texture, bgfx::Access::Write, static_cast<uint16_t>(side), 0, BGFX_RESOLVE_AUTO_GEN_MIPS);
+
+            bgfx::FrameBufferHandle frame_buffer = bgfx::createFrameBuffer(1, &attachment, false);
+            if (!bgfx::isValid(frame_buffer)) {
+                context.log << "Texture compiler error. Failed to create cube map frame buffer." << std::endl;
+                return 1;
+            }
+            cube_map_frame_buffers.emplace_back(frame_buffer);
+
+            bgfx::setViewFrameBuffer(current_view, frame_buffer);
+            bgfx::setViewRect(current_view, 0, 0, static_cast<uint16_t>(output_size), static_cast<uint16_t>(output_size));
+            bgfx::setViewTransform(current_view, glm::value_ptr(cube_map_view_matrices[side]), glm::value_ptr(CUBE_MAP_PROJECTION));
+
+            bgfx::setVertexBuffer(0, vertex_buffer, 0, static_cast<uint32_t>(std::size(CUBE_VERTICES) / 3));
+            bgfx::setTexture(0, texture_uniform, texture);
+
+            bgfx::setState(BGFX_STATE_WRITE_RGB | BGFX_STATE_CULL_CCW);
+            bgfx::submit(current_view, renderer.cube_map_program);
+        }
+    }
+
+    render_timer.stop();
+
+    // Only the views above sample the input.
+    texture = BGFX_INVALID_HANDLE;
+
+    const auto render_environment_maps = [&]() -> int {
+        if (job.output_irradiance.empty() && job.output_prefilter.empty()) {
+            return 0;
+        }
+
+        cube_map_frame_buffers.clear();
+
+        // Cube map to use in other shaders.
+        if (renderer.is_compute_supported) {
+            if (!create_cube_map_texture(BGFX_TEXTURE_BLIT_DST)) {
+                // Error is printed in `create_cube_map_texture`.
+                return 1;
+            }
+
+            bgfx::setViewName(current_view, "cube_map_blit_view");
+
+            for (uint16_t side = 0; side < 6; side++) {
+                for (uint16_t mip_size = static_cast<uint16_t>(output_size), mip_level = 0; mip_level < cube_map_mip_levels; mip_size = static_cast<uint16_t>(std::max(mip_size / 2, 1)), mip_level++) {
+                    const auto mip = static_cast<uint8_t>(mip_level);
+                    bgfx::blit(current_view, cube_map_texture, mip, 0, 0, side, cube_map_faces, mip, 0, 0, side, mip_size, mip_size);
+                }
+            }
+
+            current_view++;
+            cube_map_faces = RenderTarget();
+        }
+
+        return render_environment_maps_gpu(renderer, context, job, current_view, cube_map_texture);
+    };
+
+    if (job.output.empty()) {
+        return render_environment_maps();
+    }
+
+    if (renderer.preview_textures != nullptr) {
+        const auto get_cube_side_texture = [&](int side, int mip_level) -> BlitSource {
+            const bgfx::TextureHandle source = renderer.is_compute_supported ? cube_map_faces : cube_map_texture;
+            return BlitSource { source, static_cast<uint8_t>(mip_level), static_cast<uint16_t>(side) };
+        };
+        return copy_to_preview_texture(renderer, context, current_view++, job.output, static_cast<uint16_t>(output_size), cube_map_mip_levels, get_cube_side_texture, "",
+                                       render_environment_maps);
+    }
+
+    if (read_back_cube_map_gpu(renderer, context, job, current_view, cube_map_faces, cube_map_texture, render_environment_maps) != 0) {
+        // Error is printed in `read_back_cube_map_gpu`.
+        return 1;
+    }
+    return 0;
+}
+
+// Initializes the renderer unless cube maps are rendered on the CPU. `AUTO` falls back to the CPU backend when the
+// renderer fails to initialize, `GPU` and an explicit `--renderer` fail instead.
+static int select_cube_map_backend(Renderer& renderer) noexcept {
+    if (renderer.backend == Backend::CPU || initialize_renderer(renderer) == 0) {
+        return 0;
+    }
+
+    if (!is_cpu_fallback_allowed(renderer)) {
+        // Error is printed in `initialize_renderer`.
+        return 1;
+    }
+
+    // The reason is printed as a warning in `initialize_renderer`.
+    std::cout << "Texture compiler warning. Failed to initialize a renderer, falling back to the CPU backend." << std::endl;
+    renderer.backend = Backend::CPU;
+    return 0;
+}
+
+// Renderer that builds the mip levels of 2D jobs with `--gpu-mips`, initialized like the one of cube maps. Null when
+// the job runs on another thread than the one that created the context, like the 2D jobs the workers of a manifest
+// compile, when cube maps are rendered on the CPU and when the renderer can't run the mip shader, so the levels are
+// built on the CPU.
+static Renderer* get_mip_renderer(Renderer& renderer) noexcept {
+    if (!renderer.is_gpu_mips || std::this_thread::get_id() != renderer.thread || select_cube_map_backend(renderer) != 0 || renderer.backend == Backend::CPU ||
+        !renderer.is_mip_compute_supported) {
+        return nullptr;
+    }
+    return &renderer;
+}
+
+// Checks the size of the input of a cube map job from its header, so an input that can't be read or is too big fails
+// before the renderer is initialized. Faces are checked once they're decoded.
+static int check_cube_map_input(const JobContext& context, const CompileJob& job) noexcept {
+    if (!job.faces.empty()) {
+        return 0;
+    }
+
+    InputInfo info;
+    if (job.input_image.pixels != nullptr) {
+        info.width = job.input_image.width;
+        info.height = job.input_image.height;
+    } else if (!probe_input(job.input, info)) {
+        context.log << "Texture compiler error. Failed to open texture file." << std::endl;
+        return 1;
+    }
+
+    if (info.width <= 0 || info.height <= 0 || info.width > 65535 || info.height > 65535) {
+        context.log << "Texture compiler error. Texture is too big." << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
+
+// Cube map jobs use the GPU unless `--backend cpu` is specified. With `--backend auto` a renderer that fails to
+// initialize switches the process to the CPU backend, so the remaining jobs don't try again. The input is decoded on an
+// I/O thread while the renderer is initialized on this one, which takes SDL, the window and bgfx for the first cube map
+// job of a process, so neither waits for the other.
+static int compile_cube_map(Renderer& renderer, const JobContext& context, const CompileJob& job) noexcept {
+    if (check_cube_map_input(context, job) != 0) {
+        // Error is printed in `check_cube_map_input`.
+        return 1;
+    }
+
+    HdrWrapper data;
+    TaskGroup decode_group;
+    get_io_threads().push(decode_group, [&context, &job, &data] {
+        PhaseTimer decode_timer(context.metrics, "decode");
+        data.load(job, context.pool);
+    });
+
+    // The shaders render cube map faces only, octahedral maps are rendered by the CPU kernels with any backend.
+    const bool is_backend_failed = !job.is_octahedral && select_cube_map_backend(renderer) != 0;
+
+    // The task references the image, so it's waited for even when the renderer failed.
+    get_io_threads().wait(decode_group);
+
+    if (is_backend_failed) {
+        // Error is printed in `select_cube_map_backend`.
+        return 1;
+    }
+
+    if (!job.is_octahedral && renderer.backend != Backend::CPU) {
+        renderer.gpu_views.clear();
+        renderer.peak_gpu_memory_usage = 0;
+        const int result = compile_cube_map_gpu(renderer, context, job, data);
+        report_gpu_view_times(renderer, context);
+        return result;
+    }
+
+    return compile_cube_map_cpu(context, job, data);
+}
+
+static constexpr uint32_t R16G16_FLOAT_DXGI_FORMAT = 34;
+
+// nvtt can't write two channel float formats to DDS, so the uncompressed BRDF LUT is compiled to R16G16B16A16 and the
+// constant blue and alpha channels are dropped here, together with the DXGI format and the pitch of the header.
+static void pack_brdf_lut_output(FileOutputHandler& output, size_t size) noexcept {
+    if (output.data.size() < DDS10_HEADER_SIZE) {
+        return;
+    }
+
+    const size_t count = (output.data.size() - DDS10_HEADER_SIZE) / (sizeof(uint16_t) * 4);
+    char* const texels = output.data.data() + DDS10_HEADER_SIZE;
+    for (size_t i = 0; i < count; i++) {
+        std::memmove(texels + i * sizeof(uint16_t) * 2, texels + i * sizeof(uint16_t) * 4, sizeof(uint16_t) * 2);
+    }
+    output.data.resize(DDS10_HEADER_SIZE + count * sizeof(uint16_t) * 2);
+
+    const uint32_t pitch = static_cast<uint32_t>(size * sizeof(uint16_t) * 2);
+    std::memcpy(output.data.data() + 20, &pitch, sizeof(pitch));
+    std::memcpy(output.data.data() + 128, &R16G16_FLOAT_DXGI_FORMAT, sizeof(R16G16_FLOAT_DXGI_FORMAT));
+}
+
+// Bakes the BRDF LUT on the thread pool, `CPU_TILE_ROWS` rows a task, and writes it as RG16F or, with compression,
+// as BC5 at the quality of the job. Development and production are the same, the LUT is tiny. The LUT doesn't
+// depend on the GPU, so it's baked on the CPU by every backend and by any thread, like a 2D texture.
+static int compile_brdf_lut(const JobContext& context, const CompileJob& job) noexcept {
+    const size_t size = job.output_size;
+
+    TextureCompilerErrorHandler error_handler(context.log);
+
+    PhaseTimer render_timer(context.metrics, "brdf_lut_render");
+
+    std::vector<float> lut(size * size * 4);
+    TaskGroup group;
+    for (size_t row = 0; row < size; row += CPU_TILE_ROWS) {
+        const size_t row_end = std::min(row + CPU_TILE_ROWS, size);
+        context.pool.push(group, [&lut, size, row, row_end] {
+            render_brdf_lut_rows(size, row, row_end, lut.data());
+        });
+    }
+    context.pool.wait(group);
+
+    render_timer.stop();
+
+    FileOutputHandler output(job.output, context.metrics, context.written_outputs, context.is_in_memory);
+    if (!output.is_open()) {
+        context.log << "Texture compiler error. Failed to open output file." << std::endl;
+        return 1;
+    }
+
+    nvtt::OutputOptions output_options;
+    output_options.setOutputHandler(&output);
+    output_options.setContainer(nvtt::Container_DDS10);
+    output_options.setErrorHandler(&error_handler);
+
+    nvtt::CompressionOptions compression_options;
+    if (job.compression == Compression::NO_COMPRESSION) {
+        compression_options.setFormat(nvtt::Format_RGBA);
+        compression_options.setPixelFormat(16, 16, 16, 16);
+        compression_options.setPixelType(nvtt::PixelType_Float);
+    } else {
+        compression_options.setFormat(nvtt::Format_BC5);
+        compression_options.setQuality(job.quality);
+    }
+
+    reserve_output(context, output, static_cast<int>(size), static_cast<int>(size), 1, 1, compression_options);
+    if (!context.compressor.outputHeader(nvtt::TextureType_2D, static_cast<int>(size), static_cast<int>(size), 1, 1, 1, false, compression_options, output_options)) {
+        // Error is printed via `error_handler`.
+        return 1;
+    }
+
+    nvtt::Surface surface;
+    if (!surface.setImage(nvtt::InputFormat_RGBA_32F, static_cast<int>(size), static_cast<int>(size), 1, lut.data())) {
+        context.log << "Texture compiler error. Failed to set an image." << std::endl;
+        return 1;
+    }
+
+    PhaseTimer encode_timer(context.metrics, "encode");
+    if (!context.compressor.compress(surface, 0, 0, compression_options, output_options)) {
+        // Error is printed via `error_handler`.
+        return 1;
+    }
+    encode_timer.stop();
+
+    if (job.compression == Compression::NO_COMPRESSION) {
+        pack_brdf_lut_output(output, size);
+    }
+
+    if (finish_output(context, output, job) != 0) {
+        // Error is printed in `finish_output`.
+        return 1;
+    }
+
+    return 0;
+}
+
+// Runs nvtt block compression on the project thread pool. The pool is shared with the manifest scheduler, so block
+// level and job level parallelism never use more threads than `--jobs` allows.
+struct ThreadPoolTaskDispatcher final : nvtt::TaskDispatcher {
+    explicit ThreadPoolTaskDispatcher(ThreadPool& pool) noexcept
+            : pool(pool) {
+    }
+
+    ThreadPoolTaskDispatcher(const ThreadPoolTaskDispatcher&) = delete;
+    ThreadPoolTaskDispatcher(ThreadPoolTaskDispatcher&&) = delete;
+    ThreadPoolTaskDispatcher& operator=(const ThreadPoolTaskDispatcher&) = delete;
+    ThreadPoolTaskDispatcher& operator=(ThreadPoolTaskDispatcher&&) = delete;
+
+    void dispatch(nvtt::Task* task, void* context, int count) final {
+        if (dispatched_control != nullptr) {
+            dispatch_controlled(*dispatched_control, task, context, count);
+            return;
+        }
+
+        // nvtt dispatches a task per block, which is too fine grained for a pool task. Split blocks into a few batches
+        // per thread, so threads that finish early can still steal work from the slow ones.
+        const int batch_count = std::min(count, static_cast<int>((pool.worker_count() + 1) * 4));
+        if (batch_count <= 1) {
+            for (int id = 0; id < count; id++) {
+                task(context, id);
+            }
+            return;
+        }
+
+        TaskGroup group;
+        for (int batch = 0; batch < batch_count; batch++) {
+            const int begin = static_cast<int>(static_cast<size_t>(count) * batch / batch_count);
+            const int end = static_cast<int>(static_cast<size_t>(count) * (batch + 1) / batch_count);
+            pool.push(group, [task, context, begin, end] {
+                for (int id = begin; id < end; id++) {
+                    task(context, id);
+                }
+            });
+        }
+
+        // The calling thread compresses blocks too while waiting.
+        pool.wait(group);
+    }
+
+    // Blocks of a job with a `JobControl` are compressed in rounds of a batch per thread, and the control is checked
+    // between rounds on the calling thread, so a paused job holds no pool thread and a canceled one skips the rest of its
+    // blocks. A block takes from microseconds to tens of milliseconds depending on the format and the quality, so rounds
+    // start small and are sized after the previous one to take about `CONTROLLED_ROUND_SECONDS`.
+    void dispatch_controlled(JobControl& control, nvtt::Task* task, void* context, int count) {
+        static constexpr double CONTROLLED_ROUND_SECONDS = 0.05;
+
+        const int thread_count = static_cast<int>(pool.worker_count() + 1);
+        int batch_size = 4;
+        for (int round_begin = 0; round_begin < count;) {
+            if (!control.check()) {
+                return;
+            }
+
+            const auto before = std::chrono::steady_clock::now();
+            const int round_size = static_cast<int>(std::min<int64_t>(count - round_begin, static_cast<int64_t>(batch_size) * thread_count));
+            const int batch_count = std::min(round_size, thread_count);
+            TaskGroup group;
+            for (int batch = 0; batch < batch_count; batch++) {
+                const int begin = round_begin + static_cast<int>(static_cast<int64_t>(round_size) * batch / batch_count);
+                const int end = round_begin + static_cast<int>(static_cast<int64_t>(round_size) * (batch + 1) / batch_count);
+                pool.push(group, [task, context, begin, end] {
+                    for (int id = begin; id < end; id++) {
+                        task(context, id);
+                    }
+                });
+            }
+            pool.wait(group);
+            round_begin += round_size;
+
+            const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - before).count();
+            const double scale = std::min(CONTROLLED_ROUND_SECONDS / std::max(seconds, 1e-6), 4.0);
+            batch_size = static_cast<int>(std::clamp(batch_size * scale, 1.0, static_cast<double>(count)));
+        }
+    }
+
+    ThreadPool& pool;
+};
+
+void JobControl::cancel() noexcept {
+    {
+        const std::lock_guard<std::mutex> lock(mutex);
+        is_cancel_requested = true;
+    }
+    condition.notify_all();
+}
+
+void JobControl::pause() noexcept {
+    const std::lock_guard<std::mutex> lock(mutex);
+    is_paused = true;
+}
+
+void JobControl::resume() noexcept {
+    {
+        const std::lock_guard<std::mutex> lock(mutex);
+        is_paused = false;
+    }
+    condition.notify_all();
+}
+
+bool JobControl::is_canceled() const noexcept {
+    return is_cancel_requested;
+}
+
+bool JobControl::check() noexcept {
+    std::unique_lock<std::mutex> lock(mutex);
+    condition.wait(lock, [this] {
+        return !is_paused || is_cancel_requested;
+    });
+    return !is_cancel_requested;
+}
+
+// The calling thread takes part in compilation, so the pool needs one worker less than `thread_count`.
+CompilerContext::CompilerContext(const CompilerSettings& settings)
+        : pool(settings.thread_count > 1 ? settings.thread_count - 1 : 0, settings.is_pinned ? get_cpu_topology() : std::vector<LogicalCpu>())
+        , dispatcher(std::make_unique<ThreadPoolTaskDispatcher>(pool))
+        , renderer(std::make_unique<Renderer>()) {
+    compressor.setTaskDispatcher(dispatcher.get());
+
+    // nvtt enables its CUDA compressors on machines with an NVIDIA GPU when it's built with CUDA, and they don't encode
+    // the same blocks as the CPU ones, so outputs and cache entries would depend on the build node.
+    compressor.enableCudaAcceleration(false);
+
+    renderer->backend = settings.backend;
+    renderer->is_headless = settings.is_headless;
+    renderer->renderer_api = settings.renderer_api;
+    renderer->gpu_index = settings.gpu_index;
+    renderer->is_compute_allowed = settings.is_compute_allowed;
+    renderer->is_verbose = settings.is_verbose;
+    renderer->is_profiling = settings.is_profiling;
+    renderer->is_gpu_mips = settings.is_gpu_mips;
+    renderer->native_device = settings.native_device;
+    renderer->thread = std::this_thread::get_id();
+    if (!settings.shader_cache_directory.empty()) {
+        renderer->shader_cache.emplace(settings.shader_cache_directory);
+    }
+}
+
+// Defined here rather than in the header, which only declares `Renderer` and `ThreadPoolTaskDispatcher`.
+CompilerContext::~CompilerContext() = default;
+
+std::vector<std::string> get_job_outputs(const CompileJob& job) {
+    if (job.kind == TextureKind::CUBE_MAP) {
+        std::vector<std::string> result;
+        for (const std::string* output : { &job.output, &job.output_irradiance, &job.output_prefilter }) {
+            if (!output->empty()) {
+                result.push_back(*output);
+            }
+        }
+        return result;
+    }
+
+    std::vector<std::string> result = { job.output };
+    for (const ExtraOutput& extra_output : job.extra_outputs) {
+        result.push_back(extra_output.path);
+    }
+    if (!job.mask_output.empty()) {
+        result.push_back(job.mask_output);
+    }
+    return result;
+}
+
+// Files a job writes, its outputs and the statistics of `--stats`, which cache entries and checkpoints keep with the
+// outputs, since they can't be gathered without compiling the job again.
+static std::vector<std::string> get_job_files(const CompileJob& job) {
+    std::vector<std::string> result = get_job_outputs(job);
+    if (job.is_stats) {
+        result.push_back(get_texture_stats_path(job.output));
+    }
+    return result;
+}
+
+// Cube map jobs are split into a job per output, so every output is cached and checked by `--incremental` on its own
+// and a job whose prefilter options changed compiles only the prefilter. Other jobs are a single part.
+static std::vector<CompileJob> get_job_parts(const CompileJob& job) {
+    if (job.kind != TextureKind::CUBE_MAP || get_job_outputs(job).size() == 1) {
+        return { job };
+    }
+
+    CompileJob empty_job = job;
+    empty_job.output.clear();
+    empty_job.output_irradiance.clear();
+    empty_job.output_prefilter.clear();
+
+    std::vector<CompileJob> result;
+    if (!job.output.empty()) {
+        result.push_back(empty_job);
+        result.back().output = job.output;
+    }
+    if (!job.output_irradiance.empty()) {
+        result.push_back(empty_job);
+        result.back().output_irradiance = job.output_irradiance;
+    }
+    if (!job.output_prefilter.empty()) {
+        result.push_back(empty_job);
+        result.back().output_prefilter = job.output_prefilter;
+    }
+    return result;
+}
+
+// The job with the outputs of the given parts of it only, the inverse of `get_job_parts`.
+static CompileJob merge_job_parts(const CompileJob& job, const std::vector<const CompileJob*>& parts) {
+    if (job.kind != TextureKind::CUBE_MAP) {
+        return job;
+    }
+
+    CompileJob result = job;
+    result.output.clear();
+    result.output_irradiance.clear();
+    result.output_prefilter.clear();
+    for (const CompileJob* part : parts) {
+        if (!part->output.empty()) {
+            result.output = part->output;
+        }
+        if (!part->output_irradiance.empty()) {
+            result.output_irradiance = part->output_irradiance;
+        }
+        if (!part->output_prefilter.empty()) {
+            result.output_prefilter = part->output_prefilter;
+        }
+    }
+    return result;
+}
+
+std::vector<std::string> get_job_inputs(const CompileJob& job) {
+    if (job.kind == TextureKind::BRDF_LUT) {
+        return {};
+    }
+
+    std::vector<std::string> result = { job.input };
+    result.insert(result.end(), job.layers.begin(), job.layers.end());
+    result.insert(result.end(), job.faces.begin(), job.faces.end());
+    for (const ChannelInput& channel_input : job.channel_inputs) {
+        result.push_back(channel_input.path);
+    }
+    if (!job.roughness_normal_map.empty()) {
+        result.push_back(job.roughness_normal_map);
+    }
+    return result;
+}
+
+// Everything but the input that affects the outputs: texture kind, compression, sizes and the compiler version.
+static void hash_job_options(const CompileJob& job, Hasher& hasher) noexcept {
+    // Cube map outputs are optional, options of the missing ones are hashed as zeros, so a cube map job split into
+    // `get_job_parts` gets a key per output that changes only with the options of that output.
+    const bool is_cube_map = job.kind == TextureKind::CUBE_MAP;
+    const bool is_output = !is_cube_map || !job.output.empty();
+    const bool is_irradiance = !is_cube_map || !job.output_irradiance.empty();
+    const bool is_prefilter = !is_cube_map || !job.output_prefilter.empty();
+
+    hasher.update(std::string(TEXTURE_COMPILER_VERSION));
+    hasher.update(static_cast<uint64_t>(job.kind));
+    hasher.update(is_output || is_prefilter ? static_cast<uint64_t>(job.compression) : 0);
+    hasher.update(static_cast<uint64_t>(job.output_size));
+    hasher.update(is_irradiance ? static_cast<uint64_t>(job.output_irradiance_size) : 0);
+    hasher.update(is_prefilter ? static_cast<uint64_t>(job.output_prefilter_size) : 0);
+    hasher.update(is_prefilter ? static_cast<uint64_t>(job.prefilter_samples) : 0);
+    hasher.update(is_prefilter ? static_cast<uint64_t>(job.prefilter_levels) : 0);
+    hasher.update(is_irradiance ? static_cast<uint64_t>(job.is_irradiance_spherical_harmonics) : 0);
+    hasher.update(is_irradiance ? static_cast<uint64_t>(job.irradiance_format) : 0);
+    hasher.update(is_cube_map ? static_cast<uint64_t>(job.is_octahedral) : 0);
+    hasher.update((is_irradiance && !job.is_irradiance_spherical_harmonics) || is_prefilter ? static_cast<uint64_t>(job.is_combined_convolution) : 0);
+    hasher.update(is_output || is_prefilter ? static_cast<uint64_t>(job.encoder) : 0);
+    hasher.update(is_output || is_prefilter ? static_cast<uint64_t>(job.quality) : 0);
+    hasher.update(static_cast<uint64_t>(job.mip_qualities.size()));
+    for (const MipQuality& mip_quality : job.mip_qualities) {
+        hasher.update(static_cast<uint64_t>(mip_quality.first_level));
+        hasher.update(static_cast<uint64_t>(mip_quality.quality));
+    }
+    hasher.update(static_cast<uint64_t>(job.target));
+    hasher.update(static_cast<uint64_t>(job.container));
+    hasher.update(static_cast<uint64_t>(job.layout));
+    hasher.update(static_cast<uint64_t>(job.mip_tail_size));
+    hasher.update(static_cast<uint64_t>(job.is_checksums));
+    hasher.update(static_cast<uint64_t>(job.tile_size));
+    hasher.update(static_cast<uint64_t>(job.tile_size != 0 ? job.tile_border : 0));
+
+    uint32_t rdo_lambda;
+    std::memcpy(&rdo_lambda, &job.rdo_lambda, sizeof(rdo_lambda));
+    hasher.update(static_cast<uint64_t>(rdo_lambda));
+
+    uint32_t max_error;
+    std::memcpy(&max_error, &job.max_error, sizeof(max_error));
+    hasher.update(static_cast<uint64_t>(max_error));
+
+    uint32_t auto_quality;
+    std::memcpy(&auto_quality, &job.auto_quality, sizeof(auto_quality));
+    hasher.update(static_cast<uint64_t>(auto_quality));
+
+    uint32_t warm_start;
+    std::memcpy(&warm_start, &job.warm_start, sizeof(warm_start));
+    hasher.update(static_cast<uint64_t>(warm_start));
+
+    hasher.update(static_cast<uint64_t>(job.extra_outputs.size()));
+    for (const ExtraOutput& extra_output : job.extra_outputs) {
+        hasher.update(static_cast<uint64_t>(extra_output.compression));
+    }
+
+    hasher.update(static_cast<uint64_t>(!job.mask_output.empty()));
+    hasher.update(static_cast<uint64_t>(job.is_auto_format));
+    hasher.update(static_cast<uint64_t>(job.mip_filter));
+    hasher.update(static_cast<uint64_t>(job.is_linear_mip_filtering));
+    hasher.update(static_cast<uint64_t>(job.is_roughness_mip_filtering));
+    hasher.update(static_cast<uint64_t>(!job.roughness_normal_map.empty()));
+    hasher.update(static_cast<uint64_t>(job.is_r16));
+    hasher.update(static_cast<uint64_t>(job.max_size));
+    hasher.update(static_cast<uint64_t>(job.mip_count));
+    hasher.update(static_cast<uint64_t>(job.min_mip_size));
+    hasher.update(static_cast<uint64_t>(job.is_stats));
+    hasher.update(static_cast<uint64_t>(job.is_derived));
+    hasher.update(static_cast<uint64_t>(job.layers.size()));
+    hasher.update(static_cast<uint64_t>(job.faces.size()));
+
+    hasher.update(static_cast<uint64_t>(job.channel_inputs.size()));
+    for (const ChannelInput& channel_input : job.channel_inputs) {
+        hasher.update(static_cast<uint64_t>(channel_input.channel));
+    }
+}
+
+// Hashes the content of every input of the job, see `hash_input_file`. The hash of every input covers its size, so
+// moving bytes from one input to another changes the hash.
+static int hash_input(const CompileJob& job, InputHashes* hashes, Hasher& hasher, std::ostream& log) noexcept {
+    for (const std::string& input : get_job_inputs(job)) {
+        if (!hash_file(input, hashes, hasher)) {
+            log << "Texture compiler error. Failed to read input file." << std::endl;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+// Cache key covers everything that affects the outputs: the content hash of the inputs and the job options. Input and
+// output paths don't affect the content, so renamed or moved textures still hit. Inputs are hashed once for all the
+// parts of a job.
+static Hash compute_job_key(const CompileJob& job, const Hash& input) noexcept {
+    Hasher hasher;
+    hash_job_options(job, hasher);
+    hasher.update(input.low);
+    hasher.update(input.high);
+    return hasher.finish();
+}
+
+// Key of a job in `--checkpoint`: the options of the job, the size and modification time of every input, like
+// `--incremental` compares them, and the output paths, so parallel jobs of the same input never share a partial encode.
+// Returns false when an input can't be found, the job fails on load then.
+static bool compute_checkpoint_key(const CompilerContext& context, const CompileJob& job, Hash& key) noexcept {
+    try {
+        Hasher hasher;
+        hasher.update(std::string("checkpoint"));
+        hash_job_options(job, hasher);
+        hasher.update(static_cast<uint64_t>(context.is_quality_report));
+
+        std::error_code error;
+        for (const std::string& member_or_input : get_job_inputs(job)) {
+            const std::string input = get_input_file_path(member_or_input);
+            hasher.update(static_cast<uint64_t>(std::filesystem::file_size(input, error)));
+            if (error) {
+                return false;
+            }
+
+            hasher.update(static_cast<uint64_t>(std::filesystem::last_write_time(input, error).time_since_epoch().count()));
+            if (error) {
+                return false;
+            }
+        }
+
+        for (const std::string& output : get_job_outputs(job)) {
+            hasher.update(output);
+        }
+
+        key = hasher.finish();
+        return true;
+    } catch (...) {
+        return false;
+    }
+}
+
+// Jobs that take longer than this save their compressed mip levels for `--checkpoint`.
+static constexpr double PARTIAL_ENCODE_SECONDS = 10.0;
+
+// Only 2D jobs compressed by nvtt save partial encodes. The built-in encoders encode the whole output once its levels
+// are built and are fast anyway, and cube maps are mostly rendering.
+static bool is_partially_encoded(const CompilerContext& context, const CompileJob& job) noexcept {
+    return job.kind != TextureKind::CUBE_MAP && job.kind != TextureKind::BRDF_LUT && job.compression != Compression::NO_COMPRESSION && !is_fast_bc7(job) &&
+           !is_mobile_target(job) && estimate_job_seconds(context, job) >= PARTIAL_ENCODE_SECONDS;
+}
+
+static int compile_job_kind(Renderer& renderer, const JobContext& job_context, const CompileJob& job) noexcept {
+    switch (job.kind) {
+        case TextureKind::ALBEDO_ROUGHNESS:
+            return compile_2d_texture(job_context, job, ALBEDO_ROUGHNESS_POLICY);
+        case TextureKind::NORMAL_METALNESS_AMBIENT_OCCLUSION:
+            return compile_2d_texture(job_context, job, NORMAL_METALNESS_AMBIENT_OCCLUSION_POLICY);
+        case TextureKind::PARALLAX:
+            return compile_2d_texture(job_context, job, PARALLAX_POLICY);
+        case TextureKind::CUBE_MAP:
+            return compile_cube_map(renderer, job_context, job);
+        case TextureKind::BRDF_LUT:
+            return compile_brdf_lut(job_context, job);
+    }
+
+    // Should never happen.
+    return 1;
+}
+
+// Prefilter samples of the roughest mip level of cube map previews, smoother levels take fewer like they do with
+// `--prefilter-samples`, see `get_prefilter_sample_count`. The shaders fetch coarser environment mip levels for fewer
+// samples, so the preview is blurrier rather than noisy.
+static constexpr size_t PREVIEW_PREFILTER_SAMPLES = 32;
+
+bool get_preview_job(const CompileJob& job, CompileJob& preview) {
+    preview = job;
+    preview.is_progressive = false;
+
+    // Preview blocks would replace the fingerprint of the final ones.
+    preview.is_delta = false;
+    preview.warm_start = 0.f;
+
+    // Development BC textures are compressed by nvtt, which can't encode pages, so previews of fast BC7 virtual
+    // textures keep the encoder at its fastest quality instead.
+    bool is_different = false;
+    if (preview.tile_size != 0 && is_fast_bc7(preview)) {
+        is_different = preview.quality != nvtt::Quality_Fastest;
+        preview.quality = nvtt::Quality_Fastest;
+    } else if (preview.compression == Compression::GOOD_BUT_SLOW) {
+        preview.compression = Compression::POOR_BUT_FAST;
+        is_different = true;
+    }
+    for (ExtraOutput& extra_output : preview.extra_outputs) {
+        if (extra_output.compression == Compression::GOOD_BUT_SLOW) {
+            extra_output.compression = Compression::POOR_BUT_FAST;
+            is_different = true;
+        }
+    }
+    if (preview.rdo_lambda > 0.f) {
+        preview.rdo_lambda = 0.f;
+        is_different = true;
+    }
+
+    // Cube map previews are encoded by the built-in BC6H encoder, integrate irradiance from spherical harmonics and
+    // prefilter with a fraction of the samples, which bakes a probe in a fraction of a second.
+    if (preview.kind == TextureKind::CUBE_MAP) {
+        if (preview.compression != Compression::NO_COMPRESSION && preview.encoder != Encoder::FAST) {
+            preview.encoder = Encoder::FAST;
+            is_different = true;
+        }
+        if (!preview.output_irradiance.empty() && !preview.is_irradiance_spherical_harmonics) {
+            preview.is_irradiance_spherical_harmonics = true;
+            is_different = true;
+        }
+        if (!preview.output_prefilter.empty() && preview.prefilter_samples > PREVIEW_PREFILTER_SAMPLES) {
+            preview.prefilter_samples = PREVIEW_PREFILTER_SAMPLES;
+            is_different = true;
+        }
+    }
+    return is_different;
+}
+
+// Progressive jobs write their preview only when they're actually compiled, cache hits and up to date outputs are
+// final already. Previews are not stored in the cache or quality reports, their time is the `preview` phase of the
+// job, and a failed preview doesn't stop the final compression.
+static int compile_uncached(CompilerContext& context, const CompileJob& job, std::ostream& log, bool is_progress_visible, JobMetrics* metrics,
+                            WrittenOutputs* written_outputs, bool is_in_memory, std::vector<char>* mip_chain) noexcept {
+    // The preview decodes the input first, so it stores the decoded source the final outputs then load.
+    const Cache* const source_cache = context.is_source_cached && context.cache ? &*context.cache : nullptr;
+
+    CompileJob preview;
+    if (job.is_progressive && !is_in_memory && get_preview_job(job, preview)) {
+        PhaseTimer preview_timer(metrics, "preview");
+
+        const JobContext preview_context { context.compressor, context.pool, log, false, nullptr, nullptr, false, false, false, nullptr, source_cache, job.control, nullptr, job.progress,
+                                           nullptr };
+        if (compile_job_kind(*context.renderer, preview_context, preview) == 0) {
+            log << "Preview written." << std::endl;
+        } else {
+            log << "Texture compiler warning. Failed to write the preview, waiting for the final outputs." << std::endl;
+        }
+    }
+
+    std::optional<PartialEncode> partial;
+    Hash key;
+    if (context.checkpoint && !is_in_memory && is_partially_encoded(context, job) && compute_checkpoint_key(context, job, key)) {
+        partial.emplace(context.checkpoint->get_partial_path(key));
+    }
+
+    const JobContext job_context { context.compressor, context.pool, log, is_progress_visible, metrics, written_outputs, context.is_quality_report, context.is_block_report, is_in_memory, mip_chain,
+                                   source_cache, job.control, partial ? &*partial : nullptr, job.progress,
+                                   job.kind == TextureKind::CUBE_MAP || job.kind == TextureKind::BRDF_LUT ? nullptr : get_mip_renderer(*context.renderer) };
+    return compile_job_kind(*context.renderer, job_context, job);
+}
+
+// Outputs of the built-in encoders are encoded from the uncompressed B8G8R8A8 or R8 mip chain, which doesn't depend on
+// the block format, the encoder or its quality, so it's cached on its own. Jobs with extra outputs share a chain
+// between outputs of different compression, and outputs of nvtt are compressed from float levels, which the 8-bit
+// chain would change. Outputs of `--auto-format` depend on the decoded image, which a chain hit never decodes, and so
+// do the statistics of `--stats`. Outputs of `--derive` are made of the levels of their input, not of a chain.
+static bool is_mip_chain_cacheable(const CompileJob& job) noexcept {
+    return job.kind != TextureKind::CUBE_MAP && job.kind != TextureKind::BRDF_LUT && job.extra_outputs.empty() && !job.is_auto_format && !job.is_stats && !job.is_derived &&
+           (is_fast_bc7(job) || is_mobile_target(job) || job.compression == Compression::NO_COMPRESSION);
+}
+
+// Key of the mip chain of a job: the options of the job with everything that only affects encoding reset. Development
+// albedo roughness chains with the box filter are built from RGBA8 levels, see `is_rgba8_mip_chain`, so their
+// compression is kept apart from the rest.
+static Hash compute_mip_chain_key(const CompileJob& job, const Hash& input) noexcept {
+    CompileJob chain_job = job;
+    chain_job.compression = job.compression == Compression::POOR_BUT_FAST ? Compression::POOR_BUT_FAST : Compression::NO_COMPRESSION;
+    chain_job.encoder = Encoder::NVTT;
+    chain_job.quality = nvtt::Quality_Normal;
+    chain_job.mip_qualities.clear();
+    chain_job.max_error = 0.f;
+    chain_job.auto_quality = 0.f;
+    chain_job.warm_start = 0.f;
+    chain_job.target = Target::BC;
+    chain_job.container = Container::DDS;
+    chain_job.layout = GpuLayout::PACKED;
+    chain_job.tile_size = 0;
+    chain_job.rdo_lambda = 0.f;
+
+    Hasher hasher;
+    hasher.update(std::string("mip chain"));
+    hash_job_options(chain_job, hasher);
+    hasher.update(input.low);
+    hasher.update(input.high);
+    return hasher.finish();
+}
+
+// Compiles a job that missed the cache. Jobs whose mip chain is cached are only encoded, the chain of the rest is
+// stored for the next job with the same input and filtering.
+static int compile_from_mip_chain(CompilerContext& context, const CompileJob& job, const Hash& input, std::ostream& log, bool is_progress_visible, JobMetrics* metrics,
+                                  WrittenOutputs& written_outputs) noexcept {
+    // Outputs encoded from a cached chain have no reference to measure them against.
+    if (!is_mip_chain_cacheable(job) || context.is_quality_report) {
+        return compile_uncached(context, job, log, is_progress_visible, metrics, &written_outputs, false, nullptr);
+    }
+
+    const Hash key = compute_mip_chain_key(job, input);
+
+    PhaseTimer lookup_timer(metrics, "mip_chain_lookup");
+
+    std::vector<std::vector<char>> files;
+    try {
+        if (context.cache->load(key, 1, files, log)) {
+            log << "Mip chain cache hit " << key.to_string() << "." << std::endl;
+
+            lookup_timer.stop();
+
+            if (metrics != nullptr) {
+                metrics->result = "mip_chain_hit";
+            }
+
+            const JobContext job_context { context.compressor, context.pool, log, is_progress_visible, metrics, &written_outputs, false, context.is_block_report, false, nullptr, nullptr, job.control, nullptr, job.progress,
+                                           nullptr };
+
+            FileOutputHandler output(job.output, metrics, &written_outputs, false);
+            if (!output.is_open()) {
+                log << "Texture compiler error. Failed to open output file." << std::endl;
+                return 1;
+            }
+
+            output.data = std::move(files.front());
+            return finish_output(job_context, output, job);
+        }
+    } catch (const std::exception& exception) {
+        log << "Texture compiler warning. Failed to look up the mip chain cache: " << exception.what() << "." << std::endl;
+    }
+
+    lookup_timer.stop();
+
+    std::vector<char> mip_chain;
+    if (compile_uncached(context, job, log, is_progress_visible, metrics, &written_outputs, false, &mip_chain) != 0) {
+        // Error is printed in `compile_uncached`.
+        return 1;
+    }
+
+    // Failure to store the chain doesn't fail the job either.
+    if (!mip_chain.empty()) {
+        PhaseTimer store_timer(metrics, "mip_chain_store");
+
+        try {
+            context.cache->store(key, std::vector<std::vector<char>> { std::move(mip_chain) }, log);
+        } catch (const std::exception& exception) {
+            log << "Texture compiler warning. Failed to store the mip chain: " << exception.what() << "." << std::endl;
+        }
+    }
+
+    return 0;
+}
+
+bool compute_job_outputs_key(const CompilerContext& context, const CompileJob& job, Hash& key) noexcept {
+    if (job.input == "-") {
+        return false;
+    }
+
+    try {
+        std::ostringstream log;
+        Hasher input_hasher;
+        if (hash_input(job, context.cache ? context.cache->input_hashes.get() : nullptr, input_hasher, log) != 0) {
+            return false;
+        }
+        const Hash input = input_hasher.finish();
+
+        const std::vector<CompileJob> parts = get_job_parts(job);
+        Hasher hasher;
+        hasher.update(static_cast<uint64_t>(parts.size()));
+        for (const CompileJob& part : parts) {
+            const Hash part_key = compute_job_key(part, input);
+            hasher.update(part_key.low);
+            hasher.update(part_key.high);
+        }
+        key = hasher.finish();
+        return true;
+    } catch (...) {
+        return false;
+    }
+}
+
+void prefetch_cache_entries(const CompilerContext& context, const CompileJob& job) noexcept {
+    if (!context.cache || !context.cache->remote || job.input == "-") {
+        return;
+    }
+
+    try {
+        if (context.is_incremental) {
+            const std::vector<std::string> outputs = get_job_outputs(job);
+            std::error_code error;
+            if (std::all_of(outputs.begin(), outputs.end(), [&](const std::string& output) { return std::filesystem::exists(output, error); })) {
+                return;
+            }
+        }
+
+        // The job hashes its inputs again, which costs a lookup in `input_hashes` by then. Errors are printed by the job.
+        std::ostringstream log;
+        Hasher input_hasher;
+        if (hash_input(job, context.cache->input_hashes.get(), input_hasher, log) != 0) {
+            return;
+        }
+        const Hash input = input_hasher.finish();
+
+        for (const CompileJob& part : get_job_parts(job)) {
+            context.cache->prefetch(compute_job_key(part, input));
+        }
+    } catch (...) {
+        // The job looks its entries up itself.
+    }
+}
+
+static int compile_cached(CompilerContext& context, const CompileJob& job, std::ostream& log, bool is_progress_visible, JobMetrics* metrics) noexcept {
+    // Blocks kept by `--warm-start` depend on the previous output as well as on the input and the options, so such
+    // jobs neither restore nor store cache entries.
+    if (!context.cache || job.warm_start > 0.f) {
+        return compile_uncached(context, job, log, is_progress_visible, metrics, nullptr, false, nullptr);
+    }
+
+    PhaseTimer hash_timer(metrics, "hash");
+
+    Hasher input_hasher;
+    if (hash_input(job, context.cache->input_hashes.get(), input_hasher, log) != 0) {
+        // Error is printed in `hash_input`.
+        return 1;
+    }
+    const Hash input = input_hasher.finish();
+
+    // Every part has its own entry, see `get_job_parts`.
+    const std::vector<CompileJob> parts = get_job_parts(job);
+    std::vector<Hash> keys;
+    for (const CompileJob& part : parts) {
+        keys.push_back(compute_job_key(part, input));
+    }
+
+    hash_timer.stop();
+
+    PhaseTimer lookup_timer(metrics, "cache_lookup");
+
+    std::vector<size_t> missed_parts;
+    for (size_t i = 0; i < parts.size(); i++) {
+        try {
+            if (context.cache->load(keys[i], get_job_files(parts[i]), log)) {
+                log << "Cache hit " << keys[i].to_string() << "." << std::endl;
+                continue;
+            }
+        } catch (const std::exception& exception) {
+            log << "Texture compiler warning. Failed to look up the cache: " << exception.what() << "." << std::endl;
+        }
+        missed_parts.push_back(i);
+    }
+
+    if (missed_parts.empty()) {
+        if (metrics != nullptr) {
+            metrics->result = "cache_hit";
+        }
+
+        return 0;
+    }
+
+    lookup_timer.stop();
+
+    std::vector<const CompileJob*> missed_jobs;
+    for (const size_t i : missed_parts) {
+        missed_jobs.push_back(&parts[i]);
+    }
+
+    const CompileJob missed_job = merge_job_parts(job, missed_jobs);
+
+    WrittenOutputs written_outputs;
+    if (compile_from_mip_chain(context, missed_job, input, log, is_progress_visible, metrics, written_outputs) != 0) {
+        // Error is printed in `compile_from_mip_chain`.
+        return 1;
+    }
+
+    PhaseTimer store_timer(metrics, "cache_store");
+
+    // Failure to store an entry doesn't fail the job, the outputs are fine.
+    for (const size_t i : missed_parts) {
+        try {
+            const std::vector<std::string> outputs = get_job_files(parts[i]);
+
+            std::vector<std::vector<char>> files;
+            for (const std::string& output : outputs) {
+                const auto it = written_outputs.find(output);
+                if (it == written_outputs.end()) {
+                    break;
+                }
+                files.push_back(std::move(it->second));
+            }
+
+            if (files.size() == outputs.size()) {
+                context.cache->store(keys[i], files, log);
+            } else {
+                context.cache->store(keys[i], outputs, log);
+            }
+        } catch (const std::exception& exception) {
+            log << "Texture compiler warning. Failed to store a cache entry: " << exception.what() << "." << std::endl;
+        }
+    }
+
+    return 0;
+}
+
+// Fills the record of the job as it would be written now and compares it with the records of the outputs. Input
+// content is hashed only when its modification time doesn't match, so no-op rebuilds don't even read the inputs. Records
+// of touched inputs with the same content get the new modification time, unless `is_read_only`.
+static bool is_up_to_date(const CompileJob& job, InputHashes* hashes, BuildRecord& record, std::ostream& log, bool is_read_only = false) noexcept {
+    try {
+        Hasher options_hasher;
+        hash_job_options(job, options_hasher);
+        record.options = options_hasher.finish().to_string();
+
+        // Jobs with several inputs record the sums of their sizes and modification times, so touching any of them
+        // makes the inputs hashed again. Archive members record their archive, any change of it hashes them again.
+        std::error_code error;
+        for (const std::string& member_or_input : get_job_inputs(job)) {
+            const std::string input = get_input_file_path(member_or_input);
+            record.input_size += std::filesystem::file_size(input, error);
+            if (error) {
+                // The job is going to fail on load anyway.
+                return false;
+            }
+
+            record.input_time += std::filesystem::last_write_time(input, error).time_since_epoch().count();
+            if (error) {
+                return false;
+            }
+        }
+
+        const std::vector<std::string> outputs = get_job_outputs(job);
+
+        // Statistics have no record of their own, they're written with the first output.
+        if (job.is_stats && !std::filesystem::exists(get_texture_stats_path(job.output), error)) {
+            return false;
+        }
+
+        std::vector<BuildRecord> previous_records(outputs.size());
+        bool is_touched = false;
+        for (size_t i = 0; i < outputs.size(); i++) {
+            const BuildRecord& previous = previous_records[i];
+            if (!read_build_record(outputs[i], previous_records[i]) || previous.options != record.options || previous.input_size != record.input_size ||
+                previous.input != previous_records[0].input) {
+                return false;
+            }
+
+            const uintmax_t output_size = std::filesystem::file_size(outputs[i], error);
+            if (error || output_size != previous.output_size) {
+                return false;
+            }
+
+            is_touched = is_touched || previous.input_time != record.input_time;
+        }
+
+        if (!is_touched) {
+            record.input = previous_records[0].input;
+            return true;
+        }
+
+        // Input was touched, for example by a version control checkout, but it could still have the same content.
+        Hasher input_hasher;
+        if (hash_input(job, hashes, input_hasher, log) != 0) {
+            return false;
+        }
+
+        record.input = input_hasher.finish().to_string();
+        if (record.input != previous_records[0].input) {
+            return false;
+        }
+
+        // Records get the new modification time, so the next build doesn't hash the input again.
+        for (size_t i = 0; !is_read_only && i < outputs.size(); i++) {
+            BuildRecord updated = record;
+            updated.output_size = previous_records[i].output_size;
+            write_build_record(outputs[i], updated);
+        }
+
+        return true;
+    } catch (...) {
+        return false;
+    }
+}
+
+JobStatus get_job_status(const CompilerContext& context, const CompileJob& job) noexcept {
+    try {
+        InputHashes* const hashes = context.cache ? context.cache->input_hashes.get() : nullptr;
+        const std::vector<CompileJob> parts = get_job_parts(job);
+        std::ostringstream log;
+
+        if (context.is_incremental) {
+            bool is_up_to_date_job = true;
+            for (const CompileJob& part : parts) {
+                BuildRecord record;
+                if (!is_up_to_date(part, hashes, record, log, true)) {
+                    is_up_to_date_job = false;
+                    break;
+                }
+            }
+            if (is_up_to_date_job) {
+                return JobStatus::UP_TO_DATE;
+            }
+        }
+
+        if (!context.cache || job.input == "-") {
+            return JobStatus::COMPILED;
+        }
+
+        Hasher input_hasher;
+        if (hash_input(job, hashes, input_hasher, log) != 0) {
+            return JobStatus::COMPILED;
+        }
+        const Hash input = input_hasher.finish();
+
+        for (const CompileJob& part : parts) {
+            if (!context.cache->packs->contains(compute_job_key(part, input), log)) {
+                return JobStatus::COMPILED;
+            }
+        }
+        return JobStatus::CACHED;
+    } catch (...) {
+        return JobStatus::COMPILED;
+    }
+}
+
+// Failure to write a record doesn't fail the job, the output is just compiled again next time.
+static void write_build_records(const CompileJob& job, BuildRecord& record, std::ostream& log) noexcept {
+    try {
+        for (const std::string& output : get_job_outputs(job)) {
+            std::error_code error;
+            record.output_size = std::filesystem::file_size(output, error);
+            if (error || !write_build_record(output, record)) {
+                log << "Texture compiler warning. Failed to write a build record of \"" << output << "\"." << std::endl;
+            }
+        }
+    } catch (const std::exception& exception) {
+        log << "Texture compiler warning. Failed to write build records: " << exception.what() << "." << std::endl;
+    }
+}
+
+static int compile_incremental(CompilerContext& context, const CompileJob& job, std::ostream& log, bool is_progress_visible, JobMetrics* metrics) noexcept {
+    if (!context.is_incremental) {
+        return compile_cached(context, job, log, is_progress_visible, metrics);
+    }
+
+    PhaseTimer check_timer(metrics, "incremental_check");
+
+    InputHashes* const hashes = context.cache ? context.cache->input_hashes.get() : nullptr;
+
+    // Every part is checked on its own, see `get_job_parts`.
+    const std::vector<CompileJob> parts = get_job_parts(job);
+    std::vector<BuildRecord> records(parts.size());
+    std::vector<size_t> outdated_parts;
+    for (size_t i = 0; i < parts.size(); i++) {
+        if (!is_up_to_date(parts[i], hashes, records[i], log)) {
+            outdated_parts.push_back(i);
+        }
+    }
+
+    if (outdated_parts.empty()) {
+        log << "Up to date." << std::endl;
+
+        if (metrics != nullptr) {
+            metrics->result = "up_to_date";
+        }
+
+        return 0;
+    }
+
+    // Input is hashed before compilation, so the records describe the input that was compiled even if it changes
+    // while the job is running.
+    std::string input;
+    for (const size_t i : outdated_parts) {
+        if (!records[i].input.empty()) {
+            input = records[i].input;
+        }
+    }
+    if (input.empty()) {
+        Hasher input_hasher;
+        if (hash_input(job, hashes, input_hasher, log) != 0) {
+            // Error is printed in `hash_input`.
+            return 1;
+        }
+        input = input_hasher.finish().to_string();
+    }
+
+    std::vector<const CompileJob*> outdated_jobs;
+    for (const size_t i : outdated_parts) {
+        records[i].input = input;
+        outdated_jobs.push_back(&parts[i]);
+    }
+
+    check_timer.stop();
+
+    if (compile_cached(context, merge_job_parts(job, outdated_jobs), log, is_progress_visible, metrics) != 0) {
+        // Error is printed in `compile_cached`.
+        return 1;
+    }
+
+    for (const size_t i : outdated_parts) {
+        write_build_records(parts[i], records[i], log);
+    }
+    return 0;
+}
+
+// Jobs that an earlier build with the same `--checkpoint` completed are skipped as long as their outputs are intact,
+// compiled jobs are recorded once their outputs are written.
+static int compile_checkpointed(CompilerContext& context, const CompileJob& job, std::ostream& log, bool is_progress_visible, JobMetrics* metrics) noexcept {
+    Hash key;
+    if (!context.checkpoint || !compute_checkpoint_key(context, job, key)) {
+        return compile_incremental(context, job, log, is_progress_visible, metrics);
+    }
+
+    try {
+        const std::vector<std::string> outputs = get_job_files(job);
+        if (context.checkpoint->is_completed(key, outputs)) {
+            log << "Completed by an earlier build." << std::endl;
+
+            if (metrics != nullptr) {
+                metrics->result = "checkpoint";
+            }
+
+            return 0;
+        }
+
+        if (compile_incremental(context, job, log, is_progress_visible, metrics) != 0) {
+            // Error is printed in `compile_incremental`.
+            return 1;
+        }
+
+        // The job is fine without a record, a restarted build just compiles it again.
+        if (!context.checkpoint->complete(key, outputs)) {
+            log << "Texture compiler warning. Failed to record the job in the checkpoint journal." << std::endl;
+        }
+        return 0;
+    } catch (const std::exception& exception) {
+        log << "Texture compiler error. Failed to check the checkpoint: " << exception.what() << "." << std::endl;
+        return 1;
+    }
+}
+
+// Encoding of an output of a 2D job with the given compression, see `CostModel`. Returns false for uncompressed outputs.
+// `--auto-format` may pick BC1 only after decoding, so its outputs are expected to be BC7.
+static bool get_cost_encoding(const CompileJob& job, Compression compression, CostEncoding& encoding) noexcept {
+    if (compression == Compression::NO_COMPRESSION) {
+        return false;
+    }
+
+    if (job.target == Target::ETC2) {
+        encoding = CostEncoding::ETC2;
+    } else if (job.target == Target::ASTC) {
+        encoding = CostEncoding::ASTC;
+    } else if (job.target == Target::UASTC) {
+        encoding = CostEncoding::UASTC;
+    } else if (compression != Compression::GOOD_BUT_SLOW || job.kind == TextureKind::PARALLAX || !job.mask_output.empty()) {
+        encoding = CostEncoding::NVTT_BC;
+    } else {
+        encoding = job.encoder == Encoder::FAST ? CostEncoding::FAST_BC7 : CostEncoding::NVTT_BC7;
+    }
+    return true;
+}
+
+// Terms of the cost of a 2D job of a `width` by `height` input for `--time-budget`: decoding and filtering every mip
+// level, and encoding every level of every output at the quality of `--mip-quality` for it.
+static void get_cost_terms(const CompileJob& job, int width, int height, std::vector<CostTerm>& terms) {
+    std::vector<Compression> compressions { job.compression };
+    for (const ExtraOutput& extra_output : job.extra_outputs) {
+        compressions.push_back(extra_output.compression);
+    }
+    if (!job.mask_output.empty()) {
+        compressions.push_back(job.compression);
+    }
+
+    const double layer_count = static_cast<double>(job.layers.size() + 1);
+    const int total_mip_levels = get_total_mip_levels(job, width, height);
+    const int first_mip_level = get_first_output_mip_level(job, width, height);
+
+    terms.clear();
+    double chain_pixels = 0.0;
+    for (int mip_level = 0; mip_level < total_mip_levels; mip_level++) {
+        const double pixels = static_cast<double>(std::max(width >> mip_level, 1)) * std::max(height >> mip_level, 1) * layer_count;
+        chain_pixels += pixels;
+        if (mip_level < first_mip_level) {
+            continue;
+        }
+
+        const EncoderQuality quality = get_encoder_quality(get_mip_quality(job, mip_level - first_mip_level));
+        for (Compression compression : compressions) {
+            CostEncoding encoding;
+            if (get_cost_encoding(job, compression, encoding)) {
+                terms.push_back(CostTerm { encoding, quality, pixels });
+            }
+        }
+    }
+    terms.push_back(CostTerm { CostEncoding::DECODE, EncoderQuality::NORMAL, chain_pixels });
+}
+
+// Production BC7 of nvtt ignores the quality, the only cheaper BC7 is the one of the fast encoder, which knows neither
+// BC5 nor the BC1 of `--auto-format`.
+static bool is_fast_bc7_fallback(const CompileJob& job) noexcept {
+    return job.encoder == Encoder::NVTT && job.compression == Compression::GOOD_BUT_SLOW && job.target == Target::BC && job.mask_output.empty() &&
+           !job.is_auto_format && (job.kind == TextureKind::ALBEDO_ROUGHNESS || job.kind == TextureKind::NORMAL_METALNESS_AMBIENT_OCCLUSION);
+}
+
+// Lowers the quality of a 2D job for `--time-budget` until the estimate of its cost fits into `budget_seconds`. The largest
+// mip level is lowered a step at a time down to the fastest quality before the next one is touched, since it holds
+// three quarters of the texels, while the small levels cost little and are what distant surfaces show. Pages of
+// virtual textures are encoded as a single level, so all their levels are lowered together. When even the fastest
+// quality doesn't fit, nvtt BC7 falls back to the fast encoder at the qualities of the job. The job ends up with the
+// lowest estimate when nothing fits. Returns the estimate, `terms` are the cost terms of the job for
+// `CostModel::learn`. Returns a negative estimate when the size of the input can't be read, the job fails on load then.
+static double fit_time_budget(const CompilerContext& context, CompileJob& job, double budget_seconds, std::vector<CostTerm>& terms) {
+    InputInfo input;
+    if (!probe_input(job.input, input)) {
+        return -1.0;
+    }
+    const int width = input.width;
+    const int height = input.height;
+
+    const int level_count = get_total_mip_levels(job, width, height) - get_first_output_mip_level(job, width, height);
+
+    std::vector<EncoderQuality> initial_qualities;
+    for (int mip_level = 0; mip_level < level_count; mip_level++) {
+        initial_qualities.push_back(get_encoder_quality(get_mip_quality(job, mip_level)));
+    }
+
+    // Tiers of `--mip-quality` start wherever the quality changes.
+    std::vector<EncoderQuality> qualities = initial_qualities;
+    const auto estimate_qualities = [&] {
+        job.quality = get_nvtt_quality(qualities.front());
+        job.mip_qualities.clear();
+        for (int mip_level = 1; mip_level < level_count; mip_level++) {
+            if (qualities[mip_level] != qualities[mip_level - 1]) {
+                job.mip_qualities.push_back(MipQuality { static_cast<size_t>(mip_level), get_nvtt_quality(qualities[mip_level]) });
+            }
+        }
+        get_cost_terms(job, width, height, terms);
+        return context.cost_model.estimate(terms);
+    };
+
+    double estimate = estimate_qualities();
+    while (true) {
+        for (int mip_level = 0; mip_level < level_count && estimate > budget_seconds; mip_level++) {
+            while (estimate > budget_seconds && qualities[mip_level] != EncoderQuality::FASTEST) {
+                const EncoderQuality lower = static_cast<EncoderQuality>(static_cast<int>(qualities[mip_level]) - 1);
+                if (job.tile_size != 0) {
+                    std::fill(qualities.begin(), qualities.end(), lower);
+                } else {
+                    qualities[mip_level] = lower;
+                }
+                estimate = estimate_qualities();
+            }
+        }
+
+        if (estimate <= budget_seconds || !is_fast_bc7_fallback(job)) {
+            return estimate;
+        }
+
+        job.encoder = Encoder::FAST;
+        qualities = initial_qualities;
+        estimate = estimate_qualities();
+    }
+}
+
+static const char* get_quality_name(nvtt::Quality quality) noexcept {
+    switch (quality) {
+        case nvtt::Quality_Fastest:
+            return "fastest";
+        case nvtt::Quality_Normal:
+            return "normal";
+        case nvtt::Quality_Production:
+            return "production";
+        case nvtt::Quality_Highest:
+            return "highest";
+    }
+
+    // Should never happen.
+    return "unknown";
+}
+
+// Whether `fit_time_budget` lowered the job.
+static bool is_time_budget_changed(const CompileJob& job, const CompileJob& budget_job) noexcept {
+    bool is_changed = budget_job.quality != job.quality || budget_job.encoder != job.encoder || budget_job.mip_qualities.size() != job.mip_qualities.size();
+    for (size_t i = 0; !is_changed && i < job.mip_qualities.size(); i++) {
+        is_changed = budget_job.mip_qualities[i].first_level != job.mip_qualities[i].first_level || budget_job.mip_qualities[i].quality != job.mip_qualities[i].quality;
+    }
+    return is_changed;
+}
+
+// Prints what `fit_time_budget` changed in the job, nothing when the job fits as it is.
+static void print_time_budget(const CompileJob& job, const CompileJob& budget_job, double estimate, std::ostream& log) {
+    if (!is_time_budget_changed(job, budget_job)) {
+        return;
+    }
+
+    log << "\rTime budget compiles " << job.output << " at quality " << get_quality_name(budget_job.quality);
+    for (const MipQuality& mip_quality : budget_job.mip_qualities) {
+        log << ", " << get_quality_name(mip_quality.quality) << " from mip level " << mip_quality.first_level;
+    }
+    if (budget_job.encoder != job.encoder) {
+        log << " with the fast encoder";
+    }
+    log << " in an estimated " << std::setprecision(3) << estimate << " seconds." << std::endl;
+}
+
+const char* get_texture_kind_name(TextureKind kind) noexcept {
+    switch (kind) {
+        case TextureKind::ALBEDO_ROUGHNESS:
+            return "albedo_roughness";
+        case TextureKind::NORMAL_METALNESS_AMBIENT_OCCLUSION:
+            return "normal_metalness_ambient_occlusion";
+        case TextureKind::PARALLAX:
+            return "parallax";
+        case TextureKind::CUBE_MAP:
+            return "cube_map";
+        case TextureKind::BRDF_LUT:
+            return "brdf_lut";
+    }
+
+    // Should never happen.
+    return "unknown";
+}
+
+const char* get_compression_name(Compression compression) noexcept {
+    switch (compression) {
+        case Compression::GOOD_BUT_SLOW:
+            return "production";
+        case Compression::POOR_BUT_FAST:
+            return "development";
+        case Compression::NO_COMPRESSION:
+            return "no-compression";
+    }
+
+    // Should never happen.
+    return "unknown";
+}
+
+int compile(CompilerContext& context, const CompileJob& job, std::ostream& log, bool is_progress_visible) noexcept {
+    // Samples of the profiler are told apart by the main output, cube maps may only have an irradiance or prefilter.
+    ProfileJobScope profile_job(!job.output.empty() ? job.output : !job.output_irradiance.empty() ? job.output_irradiance : job.output_prefilter);
+
+    // Cube maps are compiled as they are, most of their cost is rendering, and BRDF LUTs have no input to estimate.
+    // The time limit of a manifest job lowers it like the budget does.
+    double budget_seconds = context.time_budget_seconds;
+    if (job.time_limit_seconds > 0.0 && (budget_seconds <= 0.0 || job.time_limit_seconds < budget_seconds)) {
+        budget_seconds = job.time_limit_seconds;
+    }
+
+    CompileJob budget_job;
+    std::vector<CostTerm> terms;
+    double estimate = -1.0;
+    if (budget_seconds > 0.0 && job.kind != TextureKind::CUBE_MAP && job.kind != TextureKind::BRDF_LUT) {
+        try {
+            budget_job = job;
+            estimate = fit_time_budget(context, budget_job, budget_seconds, terms);
+            if (estimate >= 0.0) {
+                print_time_budget(job, budget_job, estimate, log);
+            }
+        } catch (const std::exception& exception) {
+            log << "\rTexture compiler warning. Failed to fit the job into the time budget: " << exception.what() << "." << std::endl;
+            estimate = -1.0;
+        }
+    }
+
+    // Jobs of the time budget, the job limits, the cost history and `--metrics-port` are measured even without
+    // `--metrics`.
+    const CompileJob& compiled_job = estimate >= 0.0 ? budget_job : job;
+    const bool is_limited = job.time_limit_seconds > 0.0 || job.memory_limit != 0 || job.is_slow_lane;
+    if (!context.metrics && estimate < 0.0 && !is_limited && !context.cost_history && !context.live_metrics && !context.schedule) {
+        return compile_checkpointed(context, job, log, is_progress_visible, nullptr);
+    }
+
+    auto metrics = std::make_unique<JobMetrics>();
+    metrics->kind = get_texture_kind_name(compiled_job.kind);
+    metrics->compression = get_compression_name(compiled_job.compression);
+    metrics->input = compiled_job.input;
+    metrics->outputs = get_job_outputs(compiled_job);
+    metrics->result = "compiled";
+    metrics->estimated_seconds = estimate;
+    if (job.is_slow_lane) {
+        metrics->limit_action = "slow_lane";
+    } else if (job.time_limit_seconds > 0.0 && estimate >= 0.0 && is_time_budget_changed(job, budget_job)) {
+        metrics->limit_action = "downgraded";
+    }
+
+    const auto wall_begin = std::chrono::steady_clock::now();
+    const double cpu_begin = get_process_cpu_time();
+    const uint64_t page_faults_begin = get_page_fault_count();
+    metrics->begin_seconds = get_trace_seconds();
+    metrics->thread = get_thread_index();
+
+    // Memory of the process tells the memory of a job only when no other job ran at any point of it.
+    const size_t started_jobs = context.started_jobs++;
+    const bool is_first = context.running_jobs++ == 0;
+    if (context.live_metrics) {
+        context.live_metrics->running_jobs++;
+    }
+    const size_t peak_memory_before = get_peak_memory_usage();
+    const size_t memory_before = get_memory_usage();
+
+    // Cube map jobs compiled by the callback of `set_gpu_idle_callback` are measured on their own. Only the thread of
+    // cube map jobs touches the renderer.
+    const bool is_cube_map = compiled_job.kind == TextureKind::CUBE_MAP;
+    const double gpu_idle_seconds_before = is_cube_map ? context.renderer->gpu_idle_seconds : 0.0;
+
+    // Allocations of this thread outside the phases of the job are tagged too, worker threads tag only their phases.
+    if (is_allocation_tracking()) {
+        metrics->allocation_tracker = std::make_unique<AllocationTracker>();
+    }
+    AllocationTag allocation_tag(metrics->allocation_tracker.get(), "other");
+
+    const int result = compile_checkpointed(context, compiled_job, log, is_progress_visible, metrics.get());
+
+    allocation_tag.stop();
+    if (metrics->allocation_tracker) {
+        try {
+            for (const AllocationStage& stage : metrics->allocation_tracker->stages) {
+                const AllocationCounters& counters = stage.counters;
+                metrics->allocations.push_back(AllocationMetrics { stage.name, counters.allocations.load(), counters.allocated_bytes.load(), static_cast<uint64_t>(counters.peak_live_bytes.load()),
+                                                                   static_cast<uint64_t>(std::max<int64_t>(counters.live_bytes.load(), 0)) });
+            }
+        } catch (...) {
+            // Losing the allocations of a job is better than losing the job.
+        }
+        metrics->peak_heap_usage = static_cast<uint64_t>(metrics->allocation_tracker->job.peak_live_bytes.load());
+        metrics->allocation_tracker.reset();
+    }
+
+    const double gpu_idle_seconds = is_cube_map ? context.renderer->gpu_idle_seconds - gpu_idle_seconds_before : 0.0;
+    metrics->wall_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - wall_begin).count() - gpu_idle_seconds;
+    metrics->cpu_seconds = get_process_cpu_time() - cpu_begin;
+    metrics->peak_memory_usage = get_peak_memory_usage();
+    metrics->page_faults = get_page_fault_count() - page_faults_begin;
+
+    const bool is_alone = is_first && context.started_jobs == started_jobs + 1;
+    context.running_jobs--;
+    if (context.live_metrics) {
+        context.live_metrics->running_jobs--;
+    }
+
+    if (result != 0) {
+        metrics->result = "failed";
+    } else {
+        for (const std::string& output : metrics->outputs) {
+            std::error_code error;
+            if (const uintmax_t size = std::filesystem::file_size(output, error); !error) {
+                metrics->bytes_written += size;
+            }
+        }
+    }
+
+    // Cache hits, reused mip chains and up to date outputs say nothing about what compiling costs.
+    if (estimate >= 0.0 && metrics->result == "compiled") {
+        context.cost_model.learn(terms, metrics->wall_seconds);
+    }
+
+    // A job below the peak of earlier jobs only tells that it took no more than that, which admits nothing. The heap
+    // the job held at its peak is known even when other jobs ran alongside, it only misses untagged allocations.
+    const bool is_memory_known = is_alone && metrics->peak_memory_usage > peak_memory_before && memory_before != 0;
+    const size_t memory = std::max(is_memory_known ? metrics->peak_memory_usage - memory_before : 0, static_cast<size_t>(metrics->peak_heap_usage));
+
+    if (is_limited && metrics->result == "compiled") {
+        if (job.time_limit_seconds > 0.0 && metrics->wall_seconds > job.time_limit_seconds) {
+            metrics->exceeded_limits.push_back("time");
+        }
+        if (job.memory_limit != 0 && memory > job.memory_limit) {
+            metrics->exceeded_limits.push_back("memory");
+        }
+    }
+    if (!metrics->limit_action.empty() || !metrics->exceeded_limits.empty()) {
+        try {
+            std::lock_guard<std::mutex> lock(context.limit_mutex);
+            context.limit_reports.push_back(JobLimitReport { metrics->input, metrics->outputs.front(), metrics->limit_action, metrics->exceeded_limits, estimate, metrics->wall_seconds, memory });
+        } catch (...) {
+            // Losing a line of the report is better than losing the job.
+        }
+    }
+
+    if (context.cost_history && metrics->result == "compiled") {
+        try {
+            context.cost_history->record(metrics->outputs.front(), metrics->wall_seconds, memory);
+        } catch (...) {
+            // Losing the cost of a job is better than losing the job.
+        }
+    }
+
+    if (context.live_metrics) {
+        try {
+            context.live_metrics->record_job(*metrics);
+        } catch (...) {
+            // Losing a job of the live metrics is better than losing the job.
+        }
+    }
+
+    if (context.schedule) {
+        try {
+            context.schedule->record_job(*metrics);
+        } catch (...) {
+            // Losing the GPU time of a job is better than losing the job.
+        }
+    }
+
+    if (context.metrics) {
+        context.metrics->add_job(std::move(metrics));
+    }
+
+    return result;
+}
+
+int warm_up_renderer(CompilerContext& context) noexcept {
+    return select_cube_map_backend(*context.renderer);
+}
+
+void set_gpu_idle_callback(CompilerContext& context, std::function<void()> callback) noexcept {
+    context.renderer->gpu_idle_callback = std::move(callback);
+}
+
+int compile_image(CompilerContext& context, const CompileJob& job, const ImageView& image, const OutputSink& sink, std::ostream& log, JobMetrics* metrics) noexcept {
+    if (job.kind == TextureKind::BRDF_LUT) {
+        log << "Texture compiler error. BRDF LUT jobs have no image." << std::endl;
+        return 1;
+    }
+
+    if (job.kind == TextureKind::CUBE_MAP) {
+        if (!job.faces.empty() || (image.format != PixelFormat::RGBA16 && image.format != PixelFormat::RGBA32F)) {
+            log << "Texture compiler error. Cube map images must be RGBA16 or RGBA32F equirectangular images or crosses." << std::endl;
+            return 1;
+        }
+    } else if (!job.layers.empty() || !job.channel_inputs.empty() || !job.roughness_normal_map.empty() ||
+               (image.format != PixelFormat::RGBA8 && image.format != PixelFormat::RGBA16)) {
+        log << "Texture compiler error. 2D texture images must be RGBA8 or RGBA16 and have no layers, channel inputs or roughness normal map." << std::endl;
+        return 1;
+    }
+
+    if (image.pixels == nullptr || image.width <= 0 || image.height <= 0 || image.width > 65535 || image.height > 65535) {
+        log << "Texture compiler error. Image size is not supported." << std::endl;
+        return 1;
+    }
+
+    try {
+        CompileJob image_job = job;
+        image_job.input_image = image;
+
+        WrittenOutputs written_outputs;
+        if (compile_uncached(context, image_job, log, false, metrics, &written_outputs, true, nullptr) != 0) {
+            // Error is printed in `compile_uncached`.
+            return 1;
+        }
+
+        for (const std::string& output : get_job_outputs(image_job)) {
+            const auto it = written_outputs.find(output);
+            if (it == written_outputs.end()) {
+                log << "Texture compiler error. Failed to keep an output in memory." << std::endl;
+                return 1;
+            }
+            sink(output, it->second.data(), it->second.size());
+        }
+    } catch (const std::exception& exception) {
+        log << "Texture compiler error. Failed to compile an image: " << exception.what() << "." << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
+
+int compile_encoded_image(CompilerContext& context, const CompileJob& job, const void* data, size_t size, const OutputSink& sink, std::ostream& log) noexcept {
+    if (job.kind == TextureKind::CUBE_MAP || job.kind == TextureKind::BRDF_LUT) {
+        log << "Texture compiler error. Only 2D textures can be compiled from an image in memory." << std::endl;
+        return 1;
+    }
+
+    // 16-bit images are kept for every kind, `compile_image` converts them to 8 bits the way stb_image does.
+    const RgbaWrapper decoded(static_cast<const uint8_t*>(data), size, true);
+    if (decoded.data == nullptr && decoded.data16 == nullptr) {
+        log << "Texture compiler error. Failed to load a texture." << std::endl;
+        return 1;
+    }
+
+    ImageView image;
+    image.pixels = decoded.data16 != nullptr ? static_cast<const void*>(decoded.data16) : static_cast<const void*>(decoded.data);
+    image.format = decoded.data16 != nullptr ? PixelFormat::RGBA16 : PixelFormat::RGBA8;
+    image.width = decoded.width;
+    image.height = decoded.height;
+    return compile_image(context, job, image, sink, log);
+}
+
+int get_preview_mip_levels(const CompileJob& job, const std::string& output) noexcept {
+    if (job.kind != TextureKind::CUBE_MAP || output.empty()) {
+        return 0;
+    }
+    if (output == job.output) {
+        return count_mip_maps(job.output_size);
+    }
+    if (output == job.output_irradiance) {
+        return 1;
+    }
+    if (output == job.output_prefilter) {
+        return get_prefilter_mip_levels(job);
+    }
+    return 0;
+}
+
+int compile_image_preview(CompilerContext& context, const CompileJob& job, const ImageView& image, const std::vector<PreviewTexture>& textures, std::ostream& log) noexcept {
+    Renderer& renderer = *context.renderer;
+    if (job.kind != TextureKind::CUBE_MAP || job.is_octahedral || job.is_irradiance_spherical_harmonics) {
+        log << "Texture compiler error. Only cube maps without --octahedral and --irradiance-sh can be previewed on the GPU." << std::endl;
+        return 1;
+    }
+    if (renderer.native_device == nullptr || std::this_thread::get_id() != renderer.thread) {
+        log << "Texture compiler error. Previews need a context with a host device and the thread that created it." << std::endl;
+        return 1;
+    }
+    if (!job.faces.empty() || (image.format != PixelFormat::RGBA16 && image.format != PixelFormat::RGBA32F) || image.pixels == nullptr || image.width <= 0 || image.height <= 0 ||
+        image.width > 65535 || image.height > 65535) {
+        log << "Texture compiler error. Cube map images must be RGBA16 or RGBA32F equirectangular images or crosses." << std::endl;
+        return 1;
+    }
+
+    // Every texture must be for an output of the job, outputs without one are left out of the job.
+    CompileJob preview_job = job;
+    preview_job.input_image = image;
+    preview_job.output.clear();
+    preview_job.output_irradiance.clear();
+    preview_job.output_prefilter.clear();
+    for (const PreviewTexture& texture : textures) {
+        if (get_preview_mip_levels(job, texture.output) == 0 || texture.native_texture == 0) {
+            log << "Texture compiler error. Preview texture of " << texture.output << " is not a texture of an output of the job." << std::endl;
+            return 1;
+        }
+        if (texture.output == job.output) {
+            preview_job.output = job.output;
+        } else if (texture.output == job.output_irradiance) {
+            preview_job.output_irradiance = job.output_irradiance;
+        } else {
+            preview_job.output_prefilter = job.output_prefilter;
+        }
+    }
+
+    // The CPU backend has nothing to copy from, so `AUTO` doesn't fall back to it here.
+    if (select_cube_map_backend(renderer) != 0 || renderer.backend == Backend::CPU) {
+        log << "Texture compiler error. Previews need the GPU backend." << std::endl;
+        return 1;
+    }
+
+    renderer.preview_textures = &textures;
+    const int result = compile_uncached(context, preview_job, log, false, nullptr, nullptr, true, nullptr);
+    renderer.preview_textures = nullptr;
+    return result;
+}
+
+// Size of the buffered output of a 2D texture, see `estimate_job_memory`.
+static size_t estimate_output_memory(const CompileJob& job, size_t pixels) noexcept {
+    const bool is_encoded_later = is_fast_bc7(job) || is_mobile_target(job);
+    size_t output = (job.compression == Compression::NO_COMPRESSION || is_encoded_later ? pixels * 4 : pixels) * 4 / 3;
+    if (is_encoded_later) {
+        output += pixels * 4 / 3;
+    }
+    return output;
+}
+
+double estimate_job_seconds(const CompilerContext& context, const CompileJob& job) noexcept {
+    InputInfo input;
+    if (job.kind == TextureKind::CUBE_MAP || !probe_input(job.input, input)) {
+        return 0.0;
+    }
+
+    try {
+        std::vector<CostTerm> terms;
+        get_cost_terms(job, input.width, input.height, terms);
+        return context.cost_model.estimate(terms);
+    } catch (const std::exception&) {
+        // Without an estimate the job is simply started later.
+        return 0.0;
+    }
+}
+
+double estimate_fitted_job_seconds(const CompilerContext& context, const CompileJob& job, double budget_seconds) noexcept {
+    if (job.kind == TextureKind::CUBE_MAP || job.kind == TextureKind::BRDF_LUT) {
+        return 0.0;
+    }
+
+    try {
+        CompileJob fitted_job = job;
+        std::vector<CostTerm> terms;
+        return std::max(fit_time_budget(context, fitted_job, budget_seconds, terms), 0.0);
+    } catch (const std::exception&) {
+        // Without an estimate the job stays in the lane it's in.
+        return 0.0;
+    }
+}
+
+size_t estimate_job_memory(const CompileJob& job) noexcept {
+    // RGBA32F LUT and its nvtt surface.
+    if (job.kind == TextureKind::BRDF_LUT) {
+        return job.output_size * job.output_size * 32;
+    }
+
+    InputInfo input;
+    if (!probe_input(job.input, input)) {
+        // The job is going to fail on load anyway.
+        return 0;
+    }
+
+    const int width = input.width;
+    const int height = input.height;
+    const size_t pixels = static_cast<size_t>(width) * static_cast<size_t>(height);
+
+    // 2D inputs are decoded to RGBA8, but parallax keeps only the height, at 16 bits for 16-bit height maps.
+    const bool is_16_bit_image = input.is_16_bit && job.kind == TextureKind::PARALLAX;
+    const size_t image = pixels * (job.kind == TextureKind::PARALLAX ? (is_16_bit_image ? 2 : 1) : 4);
+
+    // 2D outputs are buffered as a whole until they're written. Block compressed formats take at most a byte per
+    // pixel, uncompressed ones up to four, and the mip chain adds another third. The fast BC7 encoder and the encoders
+    // of mobile targets read an uncompressed output and write the blocks into another buffer. Extra outputs and the
+    // mask of `--mask-output` are buffered at the same time as the main one. Levels dropped by `--max-size` are never
+    // buffered, every layer of a texture array is.
+    const int first_mip_level = job.kind != TextureKind::CUBE_MAP ? get_first_output_mip_level(job, width, height) : 0;
+    const size_t output_pixels = static_cast<size_t>(std::max(width >> first_mip_level, 1)) * static_cast<size_t>(std::max(height >> first_mip_level, 1));
+    size_t output = estimate_output_memory(job, output_pixels);
+    for (const ExtraOutput& extra_output : job.extra_outputs) {
+        CompileJob extra_job = job;
+        extra_job.compression = extra_output.compression;
+        output += estimate_output_memory(extra_job, output_pixels);
+    }
+    if (!job.mask_output.empty()) {
+        output += estimate_output_memory(job, output_pixels);
+    }
+    output *= job.layers.size() + 1;
+
+    // Channel inputs are decoded to RGBA8 at the same time as the input and freed once they're packed into it.
+    for (const ChannelInput& channel_input : job.channel_inputs) {
+        InputInfo channel;
+        output += probe_input(channel_input.path, channel) ? static_cast<size_t>(channel.width) * static_cast<size_t>(channel.height) * 4 : pixels * 4;
+    }
+
+    // Lengths of the averaged normals of the roughness normal map take a float per pixel of the lower mip levels and
+    // are kept as long as the outputs. The normal map itself is freed before the float surfaces are allocated.
+    if (!job.roughness_normal_map.empty()) {
+        output += pixels / 3 * 4;
+    }
+
+    if (is_rgba8_mip_chain(job, width, height)) {
+        // Image, RGBA8 levels of the mip chain below it and a band.
+        return image + pixels / 3 * 4 + STREAMING_BAND_SIZE + output;
+    }
+
+    if (job.kind == TextureKind::NORMAL_METALNESS_AMBIENT_OCCLUSION && is_streaming(job, width, height)) {
+        // Image, four channel float surfaces of level 1 for both chains and a few bands.
+        return image + pixels * 16 * 2 / 4 + STREAMING_BAND_SIZE * 4 + output;
+    }
+
+    // Float bands of the mip chain, a band, a band with halo rows and the downsampled band. Images with an odd height
+    // are a single band and its downsampled band.
+    const size_t bands = height % 2 != 0 ? pixels * 16 * 5 / 4 : std::min(pixels * 16, STREAMING_BAND_SIZE) * 3;
+
+    switch (job.kind) {
+        case TextureKind::ALBEDO_ROUGHNESS:
+            // Image, four 16-bit unorm planes of level 1 and the bands.
+            return image + pixels * 2 + bands + output;
+        case TextureKind::PARALLAX: {
+            // Image, one 16-bit unorm plane of level 1 and the bands. Height maps with color may be decoded to RGBA by
+            // stb_image, which is freed as soon as their height is copied out, before the mip chain is allocated.
+            const size_t decoded = input.channels > 2 ? pixels * (is_16_bit_image ? 8 : 4) : 0;
+            return image + std::max(pixels / 2 + bands, decoded) + output;
+        }
+        case TextureKind::NORMAL_METALNESS_AMBIENT_OCCLUSION:
+            // Image, three four channel float surfaces of nvtt and two temporary float channels.
+            return image + pixels * (16 * 3 + 4 * 2) + output;
+        case TextureKind::CUBE_MAP: {
+            // OpenEXR images are decoded to RGBA16F, Radiance HDR images to RGBA32F. `stbi_loadf` expands 8-bit images
+            // to RGBA32F from RGBA8, 16-bit images are converted to RGBA16F from RGBA16. The read back buffer is RGBA16F.
+            // Equirectangular Radiance HDR images that are halved before they're projected are halved while they're decoded.
+            const size_t bytes = input.is_exr ? 8 : input.is_hdr ? 16 : input.is_16_bit ? 8 + 8 : 4 + 16;
+            const bool is_reduced = input.is_hdr && get_cube_map_layout(job, input.width, input.height) == CubeMapLayout::EQUIRECTANGULAR;
+            const int reductions = is_reduced ? count_equirectangular_reductions(input.width, job.output_size) : 0;
+            return (pixels >> (reductions * 2)) * bytes + job.output_size * job.output_size * 8;
+        }
+        case TextureKind::BRDF_LUT:
+            // Estimated before the input is probed.
+            break;
+    }
+
+    // Should never happen.
+    return 0;
+}
@@ -0,0 +1,458 @@
+#pragma once
+
+#include "cache.h"
+#include "checkpoint.h"
+#include "cost_history.h"
+#include "cost_model.h"
+#include "live_metrics.h"
+#include "metrics.h"
+#include "mip_filter.h"
+#include "thread_pool.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <nvtt/nvtt.h>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// Compiler core, shared by the `texture_compiler` executable and tools that link the `texture_compiler_core` library
+// to compile textures in-process. The executable only parses the command line and the manifest into jobs.
+
+enum class Compression {
+    GOOD_BUT_SLOW,
+    POOR_BUT_FAST,
+    NO_COMPRESSION
+};
+
+enum class Encoder {
+    NVTT,
+    FAST
+};
+
+// Block compression formats of compressed 2D textures: BC for desktop GPUs, ETC2 and ASTC for mobile ones and UASTC
+// of Basis Universal, which is transcoded at runtime to the format of the GPU.
+enum class Target {
+    BC,
+    ETC2,
+    ASTC,
+    UASTC
+};
+
+enum class Container {
+    DDS,
+    KTX2,
+    KTX2_RAW,
+    DDS_GDEFLATE
+};
+
+// Layout of the mip levels in DDS outputs, `PACKED` for tightly packed levels and the others for the copy footprints
+// of `gpu_layout.h`.
+enum class GpuLayout {
+    PACKED,
+    D3D12,
+    VULKAN
+};
+
+// Texel format of the irradiance output, the packed formats drop the alpha channel and halve the size of RGBA16F.
+enum class IrradianceFormat {
+    RGBA16F,
+    R11G11B10F,
+    RGB9E5
+};
+
+enum class TextureKind {
+    ALBEDO_ROUGHNESS,
+    NORMAL_METALNESS_AMBIENT_OCCLUSION,
+    PARALLAX,
+    CUBE_MAP,
+
+    // Split sum BRDF LUT of image based lighting, which has no input and is compiled to the output at `output_size`.
+    BRDF_LUT
+};
+
+// Another compression of the same 2D texture, compiled from the mip chain of the main output.
+struct ExtraOutput final {
+    std::string path;
+    Compression compression = Compression::NO_COMPRESSION;
+};
+
+// Quality of the mip levels of a 2D texture from `first_level` of the output on, in place of `--quality`.
+struct MipQuality final {
+    size_t first_level = 0;
+    nvtt::Quality quality = nvtt::Quality_Normal;
+};
+
+// Separate image of a single channel of a 2D texture, packed into the decoded input right after decode.
+struct ChannelInput final {
+    std::string path;
+
+    // Channel of the input replaced by the red channel of the image.
+    size_t channel = 0;
+};
+
+enum class PixelFormat {
+    RGBA8,   // 2D textures only
+    RGBA16,  // Parallax keeps 16 bits, other 2D textures the high 8 bits and cube maps convert it to half floats
+    RGBA32F  // Cube map only
+};
+
+// Interleaved image decoded by the caller, rows top to bottom without padding.
+struct ImageView final {
+    const void* pixels = nullptr;
+    PixelFormat format = PixelFormat::RGBA8;
+    int width = 0;
+    int height = 0;
+};
+
+// Cancels or pauses a 2D texture job from another thread while `compile` runs it, like `--server` does with stale and
+// preempted jobs. The job checks it before every mip level and band of level 0 it compresses, between the batches of
+// blocks nvtt compresses on the thread pool and before an output is encoded by the built-in encoders and written. A
+// canceled job fails without writing its outputs, a paused one waits at its next check point with everything it has
+// computed so far until it's resumed or canceled. Only the thread running the job waits, the pool keeps working on
+// other jobs.
+struct JobControl final {
+    void cancel() noexcept;
+    void pause() noexcept;
+    void resume() noexcept;
+    bool is_canceled() const noexcept;
+
+    // Waits while the job is paused. Returns false when it's canceled.
+    bool check() noexcept;
+
+    std::mutex mutex;
+    std::condition_variable condition;
+    bool is_paused = false;
+    std::atomic<bool> is_cancel_requested { false };
+};
+
+// Progress of a job for callers that show it while other jobs run, like `--progress` does. The job stores the
+// percentage it would print with `--jobs 1` with a relaxed atomic store, so reporting it never waits for a lock or a
+// stream, and the caller samples it from another thread whenever it likes. Cube map jobs start again from zero for
+// every output they render.
+struct JobProgress final {
+    std::atomic<int> percent { 0 };
+};
+
+// Limit of `prefilter_samples`, must match `MAX_SAMPLE_COUNT` of the prefilter shaders.
+static constexpr uint16_t PREFILTER_MAX_SAMPLE_COUNT = 1024;
+
+struct CompileJob final {
+    TextureKind kind = TextureKind::ALBEDO_ROUGHNESS;
+    Compression compression = Compression::NO_COMPRESSION;
+
+    std::string input;
+    std::string output;
+    size_t output_size = 0;            // Cube map and BRDF LUT only
+    std::string output_irradiance;     // Cube map only
+    size_t output_irradiance_size = 0; // Cube map only
+    std::string output_prefilter;      // Cube map only
+    size_t output_prefilter_size = 0;  // Cube map only
+    size_t prefilter_samples = 0;      // Cube map only
+    size_t prefilter_levels = 0;       // Cube map only, 0 writes the full mip chain with roughness 1 from mip level 4 on
+    bool is_irradiance_spherical_harmonics = false; // Cube map only
+    IrradianceFormat irradiance_format = IrradianceFormat::RGBA16F; // Cube map only
+    bool is_octahedral = false;                     // Cube map only, every output is a 2D octahedral map
+    bool is_combined_convolution = false;           // Cube map only, see `render_combined_convolution`
+    bool is_streaming = false;                      // 2D textures only
+    Encoder encoder = Encoder::NVTT;
+    nvtt::Quality quality = nvtt::Quality_Normal;
+    std::vector<MipQuality> mip_qualities;          // 2D textures only, sorted by `first_level`
+    float max_error = 0.f;                          // 2D textures with the fast BC7 encoder only, RMSE of `encode_bc7`
+    float auto_quality = 0.f;                       // 2D textures with the fast BC7 encoder only, target PSNR of `pick_bc7_quality`
+    Target target = Target::BC;                     // 2D textures only
+    Container container = Container::DDS;
+    GpuLayout layout = GpuLayout::PACKED;           // DDS container only
+    size_t mip_tail_size = 0;                       // 2D textures in DDS without `layout` only, zero for no mip tail
+    bool is_checksums = false;                      // DDS without `tile_size` only, checksums of the subresources
+    float rdo_lambda = 0.f;                         // 2D textures only
+    bool is_delta = false;                          // 2D textures only, blocks of the built-in encoders only
+    float warm_start = 0.f;                         // `is_delta` jobs without UASTC only, RMSE of `BlockReuse::max_error`
+    std::vector<ExtraOutput> extra_outputs;         // 2D textures only
+    std::string mask_output;                        // Normal metalness ambient occlusion only, BC5 metalness ambient occlusion
+    bool is_auto_format = false;                    // Albedo roughness only, single layer BC textures only
+    MipFilter mip_filter = MipFilter::BOX;          // 2D textures only
+    bool is_linear_mip_filtering = false;           // Albedo roughness only
+    bool is_roughness_mip_filtering = false;        // Albedo roughness only
+    std::string roughness_normal_map;               // Albedo roughness only
+    bool is_r16 = false;                            // Parallax only, outputs without compression are R16 instead of R8
+    size_t max_size = 0;                            // 2D textures only, zero for no limit
+    size_t mip_count = 0;                           // 2D textures only, levels of the output, zero for the whole chain
+    size_t min_mip_size = 1;                        // 2D textures only, levels with a smaller side are dropped
+    bool is_stats = false;                          // 2D textures only, statistics of the texels next to `output`
+    bool is_derived = false;                        // 2D textures only, `input` is a DDS output the output is derived from
+    size_t tile_size = 0;                           // 2D textures only, zero for a texture instead of a virtual texture
+    size_t tile_border = 4;                         // 2D textures with `tile_size` only
+    std::vector<std::string> layers;                // 2D textures only, layers of the texture array after `input`
+    std::vector<std::string> faces;                 // Cube map only, faces -X, +Y, -Y, +Z and -Z after `input`
+    std::vector<ChannelInput> channel_inputs;       // Albedo roughness and normal metalness ambient occlusion only
+    bool is_progressive = false;                    // Outputs are written by `get_preview_job` first
+
+    // Image of `compile_image`, which is compiled instead of `input`.
+    ImageView input_image;
+
+    // Set by callers of `compile` that cancel or pause the job from another thread, null otherwise.
+    JobControl* control = nullptr;
+
+    // Set by callers of `compile` that sample the progress of the job from another thread, null otherwise.
+    JobProgress* progress = nullptr;
+
+    // Set by manifest builds with `--job-time-limit` and `--job-memory-limit`, zero for no limit. 2D jobs estimated to
+    // take longer than the time limit are compiled at lower qualities, like `--time-budget` lowers them, and jobs that
+    // went over a limit are reported in `CompilerContext::limit_reports`.
+    double time_limit_seconds = 0.0;
+    size_t memory_limit = 0;
+
+    // Set by manifest builds for jobs expected to go over a limit even when lowered, which are compiled one at a time
+    // once every other job is done.
+    bool is_slow_lane = false;
+};
+
+// Where cube map jobs are rendered, `AUTO` is the GPU when a renderer can be initialized and the CPU otherwise.
+enum class Backend {
+    AUTO,
+    GPU,
+    CPU
+};
+
+// Graphics API of the GPU backend, set by `--renderer`. `AUTO` tries the APIs the platform supports, the ones with the
+// lowest readback latency first.
+enum class RendererApi {
+    AUTO,
+    VULKAN,
+    D3D11,
+    D3D12,
+    METAL,
+    OPENGL
+};
+
+struct Renderer;
+struct ThreadPoolTaskDispatcher;
+
+// Options of a compiler context that can't change between jobs.
+struct CompilerSettings final {
+    // Threads compiling jobs, the calling thread included.
+    size_t thread_count = 1;
+
+    // Set by `--pin-threads`, workers of the pool are pinned to logical CPUs, see `ThreadPool`. The calling thread is not.
+    bool is_pinned = false;
+
+    // Cube map jobs only, set by `--backend`, `--renderer`, `--gpu`, `--headless`, `--no-compute`, `--verbose` and
+    // `--metrics`.
+    Backend backend = Backend::AUTO;
+    RendererApi renderer_api = RendererApi::AUTO;
+    int gpu_index = -1;
+    bool is_headless = false;
+    bool is_compute_allowed = true;
+    bool is_verbose = false;
+    bool is_profiling = false;
+
+    // Set by `--gpu-mips`, 2D jobs compiled on the thread that created the context build their mip levels on the
+    // renderer of cube maps when they can.
+    bool is_gpu_mips = false;
+
+    // Set by `--shader-cache` or to `SHADER_CACHE_DIRECTORY` of `--cache`, empty for no shader cache.
+    std::string shader_cache_directory;
+
+    // Device of a host the renderer creates its resources on instead of a device of its own, so the host can sample
+    // what `compile_image_preview` renders: an `ID3D11Device*`, an `ID3D12Device*`, an `id<MTLDevice>` or an OpenGL
+    // context of `renderer_api`, which must be set to that API. bgfx then renders on the thread that created the
+    // context, without a render thread of its own, since only the render thread may touch native resources.
+    void* native_device = nullptr;
+};
+
+// What a manifest job did about `--job-time-limit` and `--job-memory-limit`.
+struct JobLimitReport final {
+    std::string input;
+    std::string output;
+
+    // `downgraded` or `slow_lane`, empty when the job went over a limit without either.
+    std::string action;
+
+    // The limits the job went over, `time` and `memory`, empty when it stayed within them.
+    std::vector<std::string> exceeded_limits;
+
+    // Negative when the cost model had no estimate, the memory is zero when it can't be told, see `--cost-history`.
+    double estimated_seconds = -1.0;
+    double wall_seconds = 0.0;
+    size_t memory = 0;
+};
+
+// Everything that outlives a single job. In manifest mode the renderer is initialized by the first cube map job and
+// the compressor is reused by every job, so start up cost is paid once per process rather than once per texture.
+// Compressor methods are const and don't keep any per call state, so jobs running in parallel share it too.
+struct CompilerContext final {
+    explicit CompilerContext(const CompilerSettings& settings);
+    ~CompilerContext();
+
+    CompilerContext(const CompilerContext&) = delete;
+    CompilerContext(CompilerContext&&) = delete;
+    CompilerContext& operator=(const CompilerContext&) = delete;
+    CompilerContext& operator=(CompilerContext&&) = delete;
+
+    ThreadPool pool;
+    std::unique_ptr<ThreadPoolTaskDispatcher> dispatcher;
+    nvtt::Compressor compressor;
+    std::unique_ptr<Renderer> renderer;
+
+    // Only set when `--cache` is specified.
+    std::optional<Cache> cache;
+
+    // Set by `--cache-sources`, decoded 2D inputs are kept in `cache` as well.
+    bool is_source_cached = false;
+
+    // Only set when `--metrics` or `--trace` is specified.
+    std::optional<MetricsReport> metrics;
+
+    // Only set when `--metrics-port` is specified, every job is recorded in it.
+    std::optional<LiveMetrics> live_metrics;
+
+    // Only set for manifests with `--schedule-report` or `--metrics`, every job is recorded in it.
+    std::optional<ScheduleRecorder> schedule;
+
+    // Set by `--incremental`.
+    bool is_incremental = false;
+
+    // Set by `--report-quality`.
+    bool is_quality_report = false;
+
+    // Set by `--report-blocks`.
+    bool is_block_report = false;
+
+    // Set by `--time-budget`, zero for no budget. 2D jobs estimated to take longer are compiled at lower qualities.
+    double time_budget_seconds = 0.0;
+
+    // Learns from every job compiled with a time budget.
+    CostModel cost_model;
+
+    // Only set when `--cost-history` is specified, every compiled job is recorded in it.
+    std::optional<CostHistory> cost_history;
+
+    // Set by `--input-locality`, zero keeps manifest jobs in the order of their expected time.
+    size_t input_locality_window = 0;
+
+    // Only set when `--checkpoint` is specified. Jobs it records as completed are skipped, and large 2D jobs save their
+    // compressed mip levels in it, see `Checkpoint`.
+    std::optional<Checkpoint> checkpoint;
+
+    // Manifest jobs that were lowered to fit into `CompileJob::time_limit_seconds`, compiled in the slow lane or went over
+    // a limit, in the order they finished. Guarded by `limit_mutex`.
+    std::mutex limit_mutex;
+    std::vector<JobLimitReport> limit_reports;
+
+    // Jobs inside `compile` right now and since the context was created, which tell whether a job ran alone.
+    std::atomic<size_t> running_jobs { 0 };
+    std::atomic<size_t> started_jobs { 0 };
+};
+
+// Paths of every output of the job, the main output first.
+std::vector<std::string> get_job_outputs(const CompileJob& job);
+
+// Inputs whose content affects the outputs, the texture itself first.
+std::vector<std::string> get_job_inputs(const CompileJob& job);
+
+// Names of texture kinds and compressions in metrics, like `cube_map`, and of the compression command line arguments,
+// like `production`.
+const char* get_texture_kind_name(TextureKind kind) noexcept;
+const char* get_compression_name(Compression compression) noexcept;
+
+// The quick version of a job: outputs compressed with `--production` use `--development` instead, without `--rdo`,
+// and cube maps are encoded by the fast BC6H encoder, integrate irradiance from spherical harmonics and prefilter with
+// few samples. Returns false when the job already is as quick as that.
+bool get_preview_job(const CompileJob& job, CompileJob& preview);
+
+// Wall seconds the cost model of `--time-budget` expects a 2D job to take, based on the input image header only. Zero
+// for cube maps and inputs whose header can't be read.
+double estimate_job_seconds(const CompilerContext& context, const CompileJob& job) noexcept;
+
+// Same as above, once the job is lowered to fit into `budget_seconds` like `--time-budget` lowers it. Zero for jobs
+// `estimate_job_seconds` has no estimate of.
+double estimate_fitted_job_seconds(const CompilerContext& context, const CompileJob& job, double budget_seconds) noexcept;
+
+// Rough estimate of the peak memory a job needs, based on the input image header only.
+size_t estimate_job_memory(const CompileJob& job) noexcept;
+
+// Compiles the input files of the job into its output files, or restores them from the cache. Jobs of 2D textures can
+// be compiled by several threads at once, cube map jobs only by the thread that created the context. Returns zero on
+// success, errors are printed to `log`.
+int compile(CompilerContext& context, const CompileJob& job, std::ostream& log, bool is_progress_visible) noexcept;
+
+// Key of everything a job writes: the content of its inputs and the options of each of its outputs, like the cache keys
+// of its parts, but none of the paths, so jobs with equal keys write the same outputs in the same order. Returns false
+// when an input can't be read.
+bool compute_job_outputs_key(const CompilerContext& context, const CompileJob& job, Hash& key) noexcept;
+
+// Hashes the inputs of the job and prefetches its entries from the remote cache, see `Cache::prefetch`, so a manifest
+// looks up the jobs ahead of the ones being compiled. Does nothing without a remote cache, and in `--incremental`
+// builds for jobs whose outputs exist, which are likely up to date. Blocks on the network, meant for the I/O threads.
+void prefetch_cache_entries(const CompilerContext& context, const CompileJob& job) noexcept;
+
+// What compiling a job would do, found out by `get_job_status` without compiling it.
+enum class JobStatus {
+    COMPILED,
+    UP_TO_DATE,
+    CACHED,
+};
+
+// Finds out whether `--incremental` would find every output of the job up to date, or the local packs of the cache have
+// an entry of every part of it, without compiling or writing anything. The remote cache isn't asked. Jobs whose inputs
+// can't be read are compiled, and fail then.
+JobStatus get_job_status(const CompilerContext& context, const CompileJob& job) noexcept;
+
+// Initializes the renderer and creates its shaders ahead of the first cube map job, which otherwise does it on its
+// own. Must be called by the thread that created the context. Returns zero on success, errors are printed to stdout.
+int warm_up_renderer(CompilerContext& context) noexcept;
+
+// Runs `callback` on the thread that owns the renderer once a cube map job compiled on the GPU has read back its last
+// faces, while the thread pool compresses them, so a caller with more cube map jobs can compile the next one in the
+// callback and the GPU renders it in the meantime. The callback runs at most once, only for a job that gets that far,
+// and cube map jobs compiled in it don't run it, so at most two of them are in flight. An empty callback clears it.
+// Must be called by the thread that created the context.
+void set_gpu_idle_callback(CompilerContext& context, std::function<void()> callback) noexcept;
+
+// Receives the whole content of an output of `compile_image` under the name of the output in the job. `data` is only
+// valid during the call.
+using OutputSink = std::function<void(const std::string& output, const char* data, size_t size)>;
+
+// Compiles the image of a job into the outputs of the job, which are handed over to `sink` instead of being written to
+// files, so the paths of the job only name the outputs and nothing is read from or written to the filesystem. 2D
+// textures take RGBA8 and RGBA16 images, which are compressed straight from the caller's buffer, and can't have layers,
+// channel inputs or a roughness normal map. Cube maps take an equirectangular image or a cross of RGBA16 or RGBA32F,
+// which is copied, because rendering flips and converts it in place. Neither the cache nor `--incremental` apply.
+// Phases of the job and GPU times of cube maps are added to `metrics` unless it's null. Returns zero on success,
+// errors are printed to `log`.
+int compile_image(CompilerContext& context, const CompileJob& job, const ImageView& image, const OutputSink& sink, std::ostream& log, JobMetrics* metrics = nullptr) noexcept;
+
+// Compiles a 2D texture from a whole image file the caller read into memory, like the standard input of `--input -`,
+// otherwise like `compile_image`. The file is decoded the way input files are, so any 2D input format is accepted.
+int compile_encoded_image(CompilerContext& context, const CompileJob& job, const void* data, size_t size, const OutputSink& sink, std::ostream& log) noexcept;
+
+// Texture of the host an output of a cube map job is rendered into by `compile_image_preview`: an RGBA16F cube map of
+// the size of the output with `get_preview_mip_levels` mip levels, created by the host on
+// `CompilerSettings::native_device` as a copy destination.
+struct PreviewTexture final {
+    // Output of the job, as named in the job.
+    std::string output;
+
+    // An `ID3D11Texture2D*`, an `ID3D12Resource*`, an `id<MTLTexture>` or an OpenGL texture name.
+    uintptr_t native_texture = 0;
+};
+
+// Mip levels of the texture of an output of a cube map job: the whole chain of the cube map, one of the irradiance map
+// and the prefilter levels of the prefilter map. Zero for a name that isn't an output of the job.
+int get_preview_mip_levels(const CompileJob& job, const std::string& output) noexcept;
+
+// Renders a cube map job on the GPU and copies its outputs into textures of the host rather than reading them back, for
+// live previews in an editor: nothing is encoded or written, so a change of the source shows up as soon as the GPU has
+// rendered it, and the copies are done when the call returns. Outputs without a texture are rendered only when another
+// output needs them. Saving compiles the job with `compile_image`, which reads back and encodes the outputs like any
+// other job does. Takes the images of `compile_image`, but needs a context created with
+// `CompilerSettings::native_device`, the GPU backend and a cube map job without `--octahedral` and `--irradiance-sh`.
+// Must be called by the thread that created the context. Returns zero on success, errors are printed to `log`.
+int compile_image_preview(CompilerContext& context, const CompileJob& job, const ImageView& image, const std::vector<PreviewTexture>& textures, std::ostream& log) noexcept;
@@ -0,0 +1,35 @@
+#include "content_analysis.h"
+
+ContentAnalysis analyze_content(const uint8_t* rgba, size_t pixel_count) noexcept {
+    ContentAnalysis result;
+    if (pixel_count == 0) {
+        return result;
+    }
+
+    // Differences are accumulated with bitwise or rather than compared, so the loop has no branches.
+    uint8_t constant_differences[4] = {};
+    uint8_t gray_differences = 0;
+    uint8_t alpha_and = 0xFF;
+    bool is_one_bit_alpha = true;
+    for (size_t pixel = 0; pixel < pixel_count; pixel++) {
+        const uint8_t* values = rgba + pixel * 4;
+        for (size_t channel = 0; channel < 4; channel++) {
+            constant_differences[channel] |= values[channel] ^ rgba[channel];
+        }
+        gray_differences |= (values[0] ^ values[1]) | (values[0] ^ values[2]);
+        alpha_and &= values[3];
+        is_one_bit_alpha &= values[3] == 0 || values[3] == 0xFF;
+    }
+
+    for (size_t channel = 0; channel < 4; channel++) {
+        result.is_constant[channel] = constant_differences[channel] == 0;
+    }
+    result.is_opaque = alpha_and == 0xFF;
+    result.is_one_bit_alpha = is_one_bit_alpha;
+    result.is_grayscale = gray_differences == 0;
+    return result;
+}
+
+bool is_flat(const ContentAnalysis& analysis) noexcept {
+    return analysis.is_constant[0] && analysis.is_constant[1] && analysis.is_constant[2] && analysis.is_constant[3];
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// What an image actually uses of its channels, for `--auto-format` to pick a cheaper output than the one of its
+// texture kind.
+struct ContentAnalysis final {
+    // Channels with the same value in every pixel, all four for a flat image.
+    bool is_constant[4] = {};
+
+    // Alpha is 255 in every pixel.
+    bool is_opaque = false;
+
+    // Alpha is either 0 or 255 in every pixel.
+    bool is_one_bit_alpha = false;
+
+    // Red, green and blue are equal in every pixel.
+    bool is_grayscale = false;
+};
+
+// Analyzes interleaved 8-bit RGBA pixels in a single pass.
+ContentAnalysis analyze_content(const uint8_t* rgba, size_t pixel_count) noexcept;
+
+// All four channels are constant, so every mip level is the same single color.
+bool is_flat(const ContentAnalysis& analysis) noexcept;
@@ -0,0 +1,93 @@
+#include "cost_history.h"
+#include "atomic_file.h"
+
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+// First line of the file, so histories of an incompatible format are never mistaken for valid ones.
+static const char COST_HISTORY_MAGIC[] = "texture.compiler cost history 1";
+
+CostHistory::CostHistory(std::string path) noexcept
+        : path(std::move(path)) {
+}
+
+bool CostHistory::load(std::ostream& log) {
+    std::ifstream stream(path);
+    if (!stream) {
+        return true;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    entries.clear();
+
+    // Every line after the magic is the seconds, the memory and the output, which is the rest of the line, so output
+    // paths can have spaces.
+    std::string line;
+    if (!std::getline(stream, line) || line != COST_HISTORY_MAGIC) {
+        log << "Texture compiler warning. Cost history " << path << " is malformed and starts over." << std::endl;
+        return false;
+    }
+
+    while (std::getline(stream, line)) {
+        std::istringstream fields(line);
+        CostHistoryEntry entry;
+        std::string output;
+        if (!(fields >> entry.seconds >> entry.memory) || !std::getline(fields >> std::ws, output) || output.empty()) {
+            entries.clear();
+            log << "Texture compiler warning. Cost history " << path << " is malformed and starts over." << std::endl;
+            return false;
+        }
+        entries[output] = entry;
+    }
+    return true;
+}
+
+bool CostHistory::save(std::ostream& log) const {
+    const std::string temporary_path = get_temporary_path(path);
+
+    {
+        std::ofstream stream(temporary_path);
+        stream << COST_HISTORY_MAGIC << "\n" << std::setprecision(6) << std::fixed;
+
+        std::lock_guard<std::mutex> lock(mutex);
+        for (const auto& [output, entry] : entries) {
+            stream << entry.seconds << " " << entry.memory << " " << output << "\n";
+        }
+
+        stream.close();
+        if (!stream) {
+            std::remove(temporary_path.c_str());
+            log << "Texture compiler warning. Failed to write cost history " << path << "." << std::endl;
+            return false;
+        }
+    }
+
+    if (!replace_file(temporary_path, path)) {
+        log << "Texture compiler warning. Failed to write cost history " << path << "." << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool CostHistory::find(const std::string& output, CostHistoryEntry& entry) const {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    const auto it = entries.find(output);
+    if (it == entries.end()) {
+        return false;
+    }
+    entry = it->second;
+    return true;
+}
+
+void CostHistory::record(const std::string& output, double seconds, size_t memory) {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    CostHistoryEntry& entry = entries[output];
+    entry.seconds = seconds;
+    if (memory != 0) {
+        entry.memory = memory;
+    }
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+
+// Cost of the last compilation of a job, see `CostHistory`.
+struct CostHistoryEntry final {
+    double seconds = 0.0;
+
+    // Growth of the resident set of the process while the job ran with no other job in flight, zero until it did.
+    size_t memory = 0;
+};
+
+// Costs of the jobs compiled by previous runs, kept by `--cost-history` in a text file under the main output of every
+// job, so a build can start its longest jobs first and admit jobs by the memory they took last time. Only compiled jobs
+// are recorded, cache hits and up to date outputs say nothing about what compiling costs. Recording is synchronized,
+// parallel jobs share the history.
+struct CostHistory final {
+    explicit CostHistory(std::string path) noexcept;
+
+    CostHistory(const CostHistory&) = delete;
+    CostHistory(CostHistory&&) = delete;
+    CostHistory& operator=(const CostHistory&) = delete;
+    CostHistory& operator=(CostHistory&&) = delete;
+
+    // A missing file is an empty history. Returns false when the file is malformed, the history is empty then.
+    bool load(std::ostream& log);
+
+    // The file is replaced atomically, so an interrupted write never loses the previous history.
+    bool save(std::ostream& log) const;
+
+    // Returns false when the output was never compiled.
+    bool find(const std::string& output, CostHistoryEntry& entry) const;
+
+    // Zero `memory` keeps the memory recorded before.
+    void record(const std::string& output, double seconds, size_t memory);
+
+private:
+    std::string path;
+
+    mutable std::mutex mutex;
+    std::map<std::string, CostHistoryEntry> entries;
+};
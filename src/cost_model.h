@@ -0,0 +1,53 @@
+#pragma once
+
+#include "encoder_quality.h"
+
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+// How the pixels of a mip level are turned into blocks, the encodings whose cost per pixel tells them apart.
+enum class CostEncoding {
+    // Decoding the input and filtering the mip chain, which every job pays once whatever its outputs are.
+    DECODE,
+    NVTT_BC,
+    NVTT_BC7,
+    FAST_BC7,
+    ETC2,
+    ASTC,
+    UASTC,
+    COUNT
+};
+
+// Pixels of a job encoded the same way at the same quality. Uncompressed outputs cost next to nothing past `DECODE`
+// and have no terms.
+struct CostTerm final {
+    CostEncoding encoding;
+    EncoderQuality quality;
+    double pixels;
+};
+
+// Wall seconds per pixel of every encoding at every quality, for `--time-budget`. Starts from costs measured on a
+// four core machine and learns from every job compiled by the process, so estimates follow this machine and its
+// thread count after the first few jobs. Estimates and updates are synchronized, parallel jobs share the model.
+struct CostModel final {
+    CostModel() noexcept;
+
+    CostModel(const CostModel&) = delete;
+    CostModel(CostModel&&) = delete;
+    CostModel& operator=(const CostModel&) = delete;
+    CostModel& operator=(CostModel&&) = delete;
+
+    // Wall seconds of a job made of `terms`.
+    double estimate(const std::vector<CostTerm>& terms) const noexcept;
+
+    // Moves the costs of `terms` towards the measured `seconds` of the job, every cost by its share of the estimate, so
+    // the costs that made up most of the job learn the most.
+    void learn(const std::vector<CostTerm>& terms, double seconds) noexcept;
+
+private:
+    double estimate_unlocked(const std::vector<CostTerm>& terms) const noexcept;
+
+    mutable std::mutex mutex;
+    double seconds_per_pixel[static_cast<size_t>(CostEncoding::COUNT)][4];
+};
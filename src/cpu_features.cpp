@@ -0,0 +1,118 @@
+#include "cpu_features.h"
+
+#include <atomic>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#include <immintrin.h>
+#endif
+
+// Instruction set of the translation units built without extra flags, which every CPU the executable runs on has.
+static InstructionSet get_baseline_instruction_set() noexcept {
+#if defined(__AVX2__)
+    return InstructionSet::AVX2;
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    return InstructionSet::SSE2;
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    return InstructionSet::NEON;
+#else
+    return InstructionSet::SCALAR;
+#endif
+}
+
+// AVX2 needs the operating system to save the upper halves of YMM registers as well, which the CPU reports via OSXSAVE
+// and XCR0. GCC and Clang check both in `__builtin_cpu_supports`.
+static bool is_avx2_supported() noexcept {
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") != 0;
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    int registers[4];
+    __cpuid(registers, 0);
+    if (registers[0] < 7) {
+        return false;
+    }
+    __cpuid(registers, 1);
+    const bool is_osxsave = (registers[2] & (1 << 27)) != 0;
+    const bool is_avx = (registers[2] & (1 << 28)) != 0;
+    if (!is_osxsave || !is_avx || (_xgetbv(0) & 0x6) != 0x6) {
+        return false;
+    }
+    __cpuidex(registers, 7, 0);
+    return (registers[1] & (1 << 5)) != 0;
+#else
+    return false;
+#endif
+}
+
+// The baseline, or the scalar and AVX2 variants of the kernels when the build has them.
+static bool is_instruction_set_available(InstructionSet instruction_set) noexcept {
+    if (instruction_set == get_baseline_instruction_set()) {
+        return true;
+    }
+#if defined(TEXTURE_COMPILER_SCALAR_KERNELS)
+    if (instruction_set == InstructionSet::SCALAR) {
+        return true;
+    }
+#endif
+#if defined(TEXTURE_COMPILER_AVX2_KERNELS)
+    return instruction_set == InstructionSet::AVX2 && is_avx2_supported();
+#else
+    return false;
+#endif
+}
+
+static InstructionSet detect_instruction_set() noexcept {
+    if (is_instruction_set_available(InstructionSet::AVX2)) {
+        return InstructionSet::AVX2;
+    }
+    return get_baseline_instruction_set();
+}
+
+// Detection is cheap and gives the same result on every thread, so concurrent first calls may both store it.
+static std::atomic<int> current_instruction_set { -1 };
+
+InstructionSet get_instruction_set() noexcept {
+    int instruction_set = current_instruction_set.load(std::memory_order_relaxed);
+    if (instruction_set < 0) {
+        instruction_set = static_cast<int>(detect_instruction_set());
+        current_instruction_set.store(instruction_set, std::memory_order_relaxed);
+    }
+    return static_cast<InstructionSet>(instruction_set);
+}
+
+bool set_instruction_set(InstructionSet instruction_set) noexcept {
+    if (!is_instruction_set_available(instruction_set)) {
+        return false;
+    }
+    current_instruction_set.store(static_cast<int>(instruction_set), std::memory_order_relaxed);
+    return true;
+}
+
+bool parse_instruction_set(const std::string& name, InstructionSet& instruction_set) noexcept {
+    if (name == "scalar") {
+        instruction_set = InstructionSet::SCALAR;
+    } else if (name == "sse2") {
+        instruction_set = InstructionSet::SSE2;
+    } else if (name == "avx2") {
+        instruction_set = InstructionSet::AVX2;
+    } else if (name == "neon") {
+        instruction_set = InstructionSet::NEON;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+const char* get_instruction_set_name(InstructionSet instruction_set) noexcept {
+    switch (instruction_set) {
+        case InstructionSet::SSE2:
+            return "sse2";
+        case InstructionSet::AVX2:
+            return "avx2";
+        case InstructionSet::NEON:
+            return "neon";
+        default:
+            return "scalar";
+    }
+}
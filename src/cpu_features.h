@@ -0,0 +1,25 @@
+#pragma once
+
+#include <string>
+
+// Instruction sets pixel kernels and mip filters are built for, see `pixel_kernels.h`. The baseline is SSE2 on x86-64
+// and NEON on ARM64, AVX2 is an extra variant of the kernels picked at runtime when the CPU supports it. The scalar
+// variant is never picked, it only runs when asked for, to measure what the vector ones bring.
+enum class InstructionSet {
+    SCALAR,
+    SSE2,
+    AVX2,
+    NEON,
+};
+
+// The best instruction set both the build and the CPU support, detected on the first call, unless overridden.
+InstructionSet get_instruction_set() noexcept;
+
+// Makes kernels use the given instruction set rather than the detected one, to compare them. Returns false and keeps
+// the current one when the build or the CPU doesn't support it. Must be called before any texture is compiled.
+bool set_instruction_set(InstructionSet instruction_set) noexcept;
+
+// Parses lowercase names `scalar`, `sse2`, `avx2` and `neon`. Returns false on anything else.
+bool parse_instruction_set(const std::string& name, InstructionSet& instruction_set) noexcept;
+
+const char* get_instruction_set_name(InstructionSet instruction_set) noexcept;
@@ -0,0 +1,133 @@
+#include "cpu_topology.h"
+
+#include <bx/platform.h>
+
+#include <algorithm>
+
+#if BX_PLATFORM_LINUX
+#include <cstdio>
+#include <cstdlib>
+#include <pthread.h>
+#include <sched.h>
+#include <string>
+#endif
+
+#if BX_PLATFORM_LINUX
+// Reads the first line of a sysfs file, false when it doesn't exist.
+static bool read_sysfs_line(const std::string& path, std::string& line) {
+    FILE* file = std::fopen(path.c_str(), "r");
+    if (file == nullptr) {
+        return false;
+    }
+    char buffer[4096] = {};
+    const bool is_read = std::fgets(buffer, sizeof(buffer), file) != nullptr;
+    std::fclose(file);
+
+    line = buffer;
+    while (!line.empty() && (line.back() == '\n' || line.back() == ' ')) {
+        line.pop_back();
+    }
+    return is_read;
+}
+
+// Parses the `0-3,8,10-11` lists of sysfs, ids past `CPU_SETSIZE` are dropped.
+static std::vector<size_t> parse_cpu_list(const std::string& list) {
+    std::vector<size_t> cpus;
+    const char* cursor = list.c_str();
+    while (*cursor != '\0') {
+        char* end = nullptr;
+        const unsigned long first = std::strtoul(cursor, &end, 10);
+        if (end == cursor) {
+            break;
+        }
+        unsigned long last = first;
+        cursor = end;
+        if (*cursor == '-') {
+            last = std::strtoul(cursor + 1, &end, 10);
+            cursor = end;
+        }
+        for (unsigned long cpu = first; cpu <= last && cpu < CPU_SETSIZE; cpu++) {
+            cpus.push_back(cpu);
+        }
+        if (*cursor == ',') {
+            cursor++;
+        }
+    }
+    return cpus;
+}
+#endif
+
+std::vector<LogicalCpu> get_cpu_topology() {
+    std::vector<LogicalCpu> topology;
+
+#if BX_PLATFORM_LINUX
+    cpu_set_t allowed;
+    CPU_ZERO(&allowed);
+    if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0) {
+        return topology;
+    }
+
+    std::vector<size_t> nodes(CPU_SETSIZE, 0);
+    std::string line;
+    if (read_sysfs_line("/sys/devices/system/node/online", line)) {
+        for (const size_t node : parse_cpu_list(line)) {
+            if (read_sysfs_line("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist", line)) {
+                for (const size_t cpu : parse_cpu_list(line)) {
+                    nodes[cpu] = node;
+                }
+            }
+        }
+    }
+
+    // Intel hybrid CPUs list their Atom cores separately, ARM reports a lower capacity for little cores.
+    std::vector<bool> is_efficiency(CPU_SETSIZE, false);
+    if (read_sysfs_line("/sys/devices/cpu_atom/cpus", line)) {
+        for (const size_t cpu : parse_cpu_list(line)) {
+            is_efficiency[cpu] = true;
+        }
+    } else {
+        std::vector<unsigned long> capacities(CPU_SETSIZE, 0);
+        unsigned long max_capacity = 0;
+        for (size_t cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+            if (CPU_ISSET(cpu, &allowed) && read_sysfs_line("/sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/cpu_capacity", line)) {
+                capacities[cpu] = std::strtoul(line.c_str(), nullptr, 10);
+                max_capacity = std::max(max_capacity, capacities[cpu]);
+            }
+        }
+        for (size_t cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+            is_efficiency[cpu] = capacities[cpu] != 0 && capacities[cpu] < max_capacity;
+        }
+    }
+
+    for (size_t cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+        if (CPU_ISSET(cpu, &allowed)) {
+            LogicalCpu logical_cpu;
+            logical_cpu.id = cpu;
+            logical_cpu.node = nodes[cpu];
+            logical_cpu.is_efficiency = is_efficiency[cpu];
+            topology.push_back(logical_cpu);
+        }
+    }
+
+    std::stable_sort(topology.begin(), topology.end(), [](const LogicalCpu& a, const LogicalCpu& b) {
+        return a.node != b.node ? a.node < b.node : !a.is_efficiency && b.is_efficiency;
+    });
+#endif
+
+    return topology;
+}
+
+bool pin_current_thread(size_t cpu) noexcept {
+#if BX_PLATFORM_LINUX
+    if (cpu >= CPU_SETSIZE) {
+        return false;
+    }
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+    (void)cpu;
+    return false;
+#endif
+}
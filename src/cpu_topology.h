@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+// Logical CPU a thread of the pool can be pinned to.
+struct LogicalCpu final {
+    size_t id = 0;
+
+    // NUMA node whose memory is local to the CPU.
+    size_t node = 0;
+
+    // Efficiency core of a hybrid CPU, such as the Atom cores of Intel hybrid CPUs or the little cores of ARM big.LITTLE,
+    // which runs long jobs several times slower than the performance cores.
+    bool is_efficiency = false;
+};
+
+// Logical CPUs the process is allowed to run on, ordered by NUMA node and within a node performance cores first. Empty
+// where the topology is unknown, on platforms other than Linux, in which case threads are never pinned.
+std::vector<LogicalCpu> get_cpu_topology();
+
+// Restricts the calling thread to a single logical CPU. Pages the thread touches first are then allocated on the node
+// of that CPU by the default memory policy of Linux. Returns false when the CPU can't be set.
+bool pin_current_thread(size_t cpu) noexcept;
@@ -0,0 +1,1016 @@
+#include "cube_map_kernels.h"
+#include "bc6h_encoder.h"
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define CUBE_MAP_KERNELS_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#define CUBE_MAP_KERNELS_NEON
+#include <arm_neon.h>
+#endif
+
+static constexpr float PI = 3.14159265359f;
+
+// Directions of a block of samples are projected to cube map faces four at a time, before the cube map fetches, which
+// can't be vectorized without gathers.
+static constexpr size_t SAMPLE_BLOCK_SIZE = 64;
+
+float radical_inverse(uint32_t index) noexcept {
+    index = (index << 16U) | (index >> 16U);
+    index = ((index & 0x55555555U) << 1U) | ((index & 0xAAAAAAAAU) >> 1U);
+    index = ((index & 0x33333333U) << 2U) | ((index & 0xCCCCCCCCU) >> 2U);
+    index = ((index & 0x0F0F0F0FU) << 4U) | ((index & 0xF0F0F0F0U) >> 4U);
+    index = ((index & 0x00FF00FFU) << 8U) | ((index & 0xFF00FF00U) >> 8U);
+    return static_cast<float>(index) * 2.3283064365386963e-10f;
+}
+
+void get_cube_map_direction(int face, float u, float v, float& x, float& y, float& z) noexcept {
+    switch (face) {
+        case 0:  x =  1.f; y = -v;   z = -u;   break;
+        case 1:  x = -1.f; y = -v;   z =  u;   break;
+        case 2:  x =  u;   y =  1.f; z =  v;   break;
+        case 3:  x =  u;   y = -1.f; z = -v;   break;
+        case 4:  x =  u;   y = -v;   z =  1.f; break;
+        case OCTAHEDRAL_FACE:
+            x = u;
+            y = 1.f - std::abs(u) - std::abs(v);
+            z = v;
+            if (y < 0.f) {
+                x = (1.f - std::abs(v)) * (u >= 0.f ? 1.f : -1.f);
+                z = (1.f - std::abs(u)) * (v >= 0.f ? 1.f : -1.f);
+            }
+            break;
+        default: x = -u;   y = -v;   z = -1.f; break;
+    }
+
+    const float inverse_length = 1.f / std::sqrt(x * x + y * y + z * z);
+    x *= inverse_length;
+    y *= inverse_length;
+    z *= inverse_length;
+}
+
+CubeMapImage::CubeMapImage(size_t size, size_t max_mip_levels)
+        : size(size)
+        , mip_levels(0) {
+    for (size_t mip_size = size; mip_size >= 1 && mip_levels < max_mip_levels; mip_size /= 2) {
+        mip_levels++;
+    }
+
+    images.resize(mip_levels * 6);
+    for (size_t mip_level = 0; mip_level < mip_levels; mip_level++) {
+        const size_t mip_size = get_mip_size(mip_level);
+        for (int face = 0; face < 6; face++) {
+            images[mip_level * 6 + face].resize(mip_size * mip_size * 4);
+        }
+    }
+}
+
+size_t CubeMapImage::get_mip_size(size_t mip_level) const noexcept {
+    return std::max(size >> mip_level, static_cast<size_t>(1));
+}
+
+float* CubeMapImage::get_face(int face, size_t mip_level) noexcept {
+    return images[mip_level * 6 + face].data();
+}
+
+const float* CubeMapImage::get_face(int face, size_t mip_level) const noexcept {
+    return images[mip_level * 6 + face].data();
+}
+
+OctahedralImage::OctahedralImage(size_t size, size_t max_mip_levels)
+        : size(size)
+        , mip_levels(0) {
+    for (size_t mip_size = size; mip_size >= 1 && mip_levels < max_mip_levels; mip_size /= 2) {
+        mip_levels++;
+    }
+
+    images.resize(mip_levels);
+    for (size_t mip_level = 0; mip_level < mip_levels; mip_level++) {
+        const size_t mip_size = get_mip_size(mip_level);
+        images[mip_level].resize(mip_size * mip_size * 4);
+    }
+}
+
+size_t OctahedralImage::get_mip_size(size_t mip_level) const noexcept {
+    return std::max(size >> mip_level, static_cast<size_t>(1));
+}
+
+float* OctahedralImage::get_level(size_t mip_level) noexcept {
+    return images[mip_level].data();
+}
+
+const float* OctahedralImage::get_level(size_t mip_level) const noexcept {
+    return images[mip_level].data();
+}
+
+// Bilinear fetch with clamp to edge addressing from a `width` x `height` RGBA float image, `u` and `v` are in [0, 1].
+static void sample_image(const float* image, size_t width, size_t height, float u, float v, float (&color)[3]) noexcept {
+    const float x = u * static_cast<float>(width) - 0.5f;
+    const float y = v * static_cast<float>(height) - 0.5f;
+
+    // Coordinates are never below -1, so truncation of the shifted value is the floor. `std::floor` is a library call
+    // without SSE 4.1, and converting floats to unsigned 64-bit integers is much slower than to signed 32-bit ones.
+    const int32_t floor_x = static_cast<int32_t>(x + 1.f) - 1;
+    const int32_t floor_y = static_cast<int32_t>(y + 1.f) - 1;
+    const float weight_x = x - static_cast<float>(floor_x);
+    const float weight_y = y - static_cast<float>(floor_y);
+
+    const auto clamp = [](int32_t value, size_t length) {
+        return static_cast<size_t>(std::clamp(value, 0, static_cast<int32_t>(length) - 1));
+    };
+    const size_t x0 = clamp(floor_x, width);
+    const size_t x1 = clamp(floor_x + 1, width);
+    const size_t y0 = clamp(floor_y, height);
+    const size_t y1 = clamp(floor_y + 1, height);
+
+    const float* const p00 = image + (y0 * width + x0) * 4;
+    const float* const p01 = image + (y0 * width + x1) * 4;
+    const float* const p10 = image + (y1 * width + x0) * 4;
+    const float* const p11 = image + (y1 * width + x1) * 4;
+
+    // Texels are RGBA, so a vector register holds a whole texel and all the channels are filtered at once.
+#if defined(CUBE_MAP_KERNELS_SSE2)
+    const __m128 x_weights = _mm_set1_ps(weight_x);
+    const __m128 top = _mm_add_ps(_mm_loadu_ps(p00), _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(p01), _mm_loadu_ps(p00)), x_weights));
+    const __m128 bottom = _mm_add_ps(_mm_loadu_ps(p10), _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(p11), _mm_loadu_ps(p10)), x_weights));
+    alignas(16) float result[4];
+    _mm_store_ps(result, _mm_add_ps(top, _mm_mul_ps(_mm_sub_ps(bottom, top), _mm_set1_ps(weight_y))));
+    std::copy(result, result + 3, color);
+#elif defined(CUBE_MAP_KERNELS_NEON)
+    const float32x4_t top = vaddq_f32(vld1q_f32(p00), vmulq_n_f32(vsubq_f32(vld1q_f32(p01), vld1q_f32(p00)), weight_x));
+    const float32x4_t bottom = vaddq_f32(vld1q_f32(p10), vmulq_n_f32(vsubq_f32(vld1q_f32(p11), vld1q_f32(p10)), weight_x));
+    float result[4];
+    vst1q_f32(result, vaddq_f32(top, vmulq_n_f32(vsubq_f32(bottom, top), weight_y)));
+    std::copy(result, result + 3, color);
+#else
+    for (int channel = 0; channel < 3; channel++) {
+        const float top = p00[channel] + (p01[channel] - p00[channel]) * weight_x;
+        const float bottom = p10[channel] + (p11[channel] - p10[channel]) * weight_x;
+        color[channel] = top + (bottom - top) * weight_y;
+    }
+#endif
+}
+
+// Face and face coordinates in [0, 1] of the direction that doesn't have to be normalized.
+static void project_to_face(float x, float y, float z, int32_t& face, float& u, float& v) noexcept {
+    const float abs_x = std::abs(x);
+    const float abs_y = std::abs(y);
+    const float abs_z = std::abs(z);
+
+    const bool is_x_major = abs_x >= abs_y && abs_x >= abs_z;
+    const bool is_y_major = !is_x_major && abs_y >= abs_z;
+
+    const float major = is_x_major ? abs_x : (is_y_major ? abs_y : abs_z);
+    const float s = is_x_major ? (x >= 0.f ? -z : z) : (is_y_major ? x : (z >= 0.f ? x : -x));
+    const float t = is_y_major ? (y >= 0.f ? z : -z) : -y;
+    const float major_sign = is_x_major ? x : (is_y_major ? y : z);
+
+    face = (is_x_major ? 0 : (is_y_major ? 2 : 4)) + (major_sign >= 0.f ? 0 : 1);
+    u = (s / major + 1.f) * 0.5f;
+    v = (t / major + 1.f) * 0.5f;
+}
+
+// Orthogonal basis with an X axis, an Y axis and a Z axis, which is the normal.
+struct Frame final {
+    float x[3];
+    float y[3];
+    float z[3];
+};
+
+// Transforms `count` directions from `frame` space to world space and projects them to cube map faces. Vector paths
+// do the same operations as `project_to_face` in the same order.
+static void project_block(const float* x, const float* y, const float* z, size_t count, const Frame& frame, int32_t* faces, float* u, float* v) noexcept {
+    size_t i = 0;
+
+#if defined(CUBE_MAP_KERNELS_SSE2)
+    const auto select = [](__m128 mask, __m128 a, __m128 b) {
+        return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+    };
+
+    const __m128 sign = _mm_set1_ps(-0.f);
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.f);
+    const __m128 half = _mm_set1_ps(0.5f);
+    for (; i + 4 <= count; i += 4) {
+        const __m128 local_x = _mm_loadu_ps(x + i), local_y = _mm_loadu_ps(y + i), local_z = _mm_loadu_ps(z + i);
+        const auto transform = [&](int axis) {
+            const __m128 a = _mm_mul_ps(local_x, _mm_set1_ps(frame.x[axis]));
+            const __m128 b = _mm_mul_ps(local_y, _mm_set1_ps(frame.y[axis]));
+            const __m128 c = _mm_mul_ps(local_z, _mm_set1_ps(frame.z[axis]));
+            return _mm_add_ps(_mm_add_ps(a, b), c);
+        };
+        const __m128 world_x = transform(0), world_y = transform(1), world_z = transform(2);
+
+        const __m128 abs_x = _mm_andnot_ps(sign, world_x), abs_y = _mm_andnot_ps(sign, world_y), abs_z = _mm_andnot_ps(sign, world_z);
+        const __m128 is_x_major = _mm_and_ps(_mm_cmpge_ps(abs_x, abs_y), _mm_cmpge_ps(abs_x, abs_z));
+        const __m128 is_y_major = _mm_andnot_ps(is_x_major, _mm_cmpge_ps(abs_y, abs_z));
+        const __m128 is_z_major = _mm_andnot_ps(_mm_or_ps(is_x_major, is_y_major), _mm_castsi128_ps(_mm_set1_epi32(-1)));
+
+        const __m128 major = select(is_x_major, abs_x, select(is_y_major, abs_y, abs_z));
+        const __m128 negative_x = _mm_xor_ps(world_x, sign), negative_y = _mm_xor_ps(world_y, sign), negative_z = _mm_xor_ps(world_z, sign);
+        const __m128 s = select(is_x_major, select(_mm_cmpge_ps(world_x, zero), negative_z, world_z),
+                                select(is_y_major, world_x, select(_mm_cmpge_ps(world_z, zero), world_x, negative_x)));
+        const __m128 t = select(is_y_major, select(_mm_cmpge_ps(world_y, zero), world_z, negative_z), negative_y);
+        const __m128 major_sign = select(is_x_major, world_x, select(is_y_major, world_y, world_z));
+
+        __m128i face = _mm_or_si128(_mm_and_si128(_mm_castps_si128(is_y_major), _mm_set1_epi32(2)), _mm_and_si128(_mm_castps_si128(is_z_major), _mm_set1_epi32(4)));
+        face = _mm_add_epi32(face, _mm_and_si128(_mm_castps_si128(_mm_cmplt_ps(major_sign, zero)), _mm_set1_epi32(1)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(faces + i), face);
+
+        _mm_storeu_ps(u + i, _mm_mul_ps(_mm_add_ps(_mm_div_ps(s, major), one), half));
+        _mm_storeu_ps(v + i, _mm_mul_ps(_mm_add_ps(_mm_div_ps(t, major), one), half));
+    }
+#elif defined(CUBE_MAP_KERNELS_NEON)
+    const float32x4_t zero = vdupq_n_f32(0.f);
+    const float32x4_t one = vdupq_n_f32(1.f);
+    const float32x4_t half = vdupq_n_f32(0.5f);
+    for (; i + 4 <= count; i += 4) {
+        const float32x4_t local_x = vld1q_f32(x + i), local_y = vld1q_f32(y + i), local_z = vld1q_f32(z + i);
+        const auto transform = [&](int axis) {
+            const float32x4_t a = vmulq_n_f32(local_x, frame.x[axis]);
+            const float32x4_t b = vmulq_n_f32(local_y, frame.y[axis]);
+            const float32x4_t c = vmulq_n_f32(local_z, frame.z[axis]);
+            return vaddq_f32(vaddq_f32(a, b), c);
+        };
+        const float32x4_t world_x = transform(0), world_y = transform(1), world_z = transform(2);
+
+        const float32x4_t abs_x = vabsq_f32(world_x), abs_y = vabsq_f32(world_y), abs_z = vabsq_f32(world_z);
+        const uint32x4_t is_x_major = vandq_u32(vcgeq_f32(abs_x, abs_y), vcgeq_f32(abs_x, abs_z));
+        const uint32x4_t is_y_major = vbicq_u32(vcgeq_f32(abs_y, abs_z), is_x_major);
+        const uint32x4_t is_z_major = vmvnq_u32(vorrq_u32(is_x_major, is_y_major));
+
+        const float32x4_t major = vbslq_f32(is_x_major, abs_x, vbslq_f32(is_y_major, abs_y, abs_z));
+        const float32x4_t s = vbslq_f32(is_x_major, vbslq_f32(vcgeq_f32(world_x, zero), vnegq_f32(world_z), world_z),
+                                        vbslq_f32(is_y_major, world_x, vbslq_f32(vcgeq_f32(world_z, zero), world_x, vnegq_f32(world_x))));
+        const float32x4_t t = vbslq_f32(is_y_major, vbslq_f32(vcgeq_f32(world_y, zero), world_z, vnegq_f32(world_z)), vnegq_f32(world_y));
+        const float32x4_t major_sign = vbslq_f32(is_x_major, world_x, vbslq_f32(is_y_major, world_y, world_z));
+
+        uint32x4_t face = vorrq_u32(vandq_u32(is_y_major, vdupq_n_u32(2)), vandq_u32(is_z_major, vdupq_n_u32(4)));
+        face = vaddq_u32(face, vandq_u32(vcltq_f32(major_sign, zero), vdupq_n_u32(1)));
+        vst1q_s32(faces + i, vreinterpretq_s32_u32(face));
+
+        vst1q_f32(u + i, vmulq_f32(vaddq_f32(vdivq_f32(s, major), one), half));
+        vst1q_f32(v + i, vmulq_f32(vaddq_f32(vdivq_f32(t, major), one), half));
+    }
+#endif
+
+    for (; i < count; i++) {
+        const float world_x = x[i] * frame.x[0] + y[i] * frame.y[0] + z[i] * frame.z[0];
+        const float world_y = x[i] * frame.x[1] + y[i] * frame.y[1] + z[i] * frame.z[1];
+        const float world_z = x[i] * frame.x[2] + y[i] * frame.y[2] + z[i] * frame.z[2];
+        project_to_face(world_x, world_y, world_z, faces[i], u[i], v[i]);
+    }
+}
+
+// Trilinear fetch from a face of the cube map. Face seams are not filtered across, which only affects the outermost
+// half texel of every face.
+static void sample_cube_map_face(const CubeMapImage& cube_map, int32_t face, float u, float v, float mip_level, float (&color)[3]) noexcept {
+    mip_level = std::clamp(mip_level, 0.f, static_cast<float>(cube_map.mip_levels - 1));
+    const auto level = static_cast<size_t>(static_cast<int32_t>(mip_level));
+    const float weight = mip_level - static_cast<float>(level);
+
+    const size_t size = cube_map.get_mip_size(level);
+    sample_image(cube_map.get_face(face, level), size, size, u, v, color);
+
+    if (weight > 0.f && level + 1 < cube_map.mip_levels) {
+        float next[3];
+        const size_t next_size = cube_map.get_mip_size(level + 1);
+        sample_image(cube_map.get_face(face, level + 1), next_size, next_size, u, v, next);
+
+        for (int channel = 0; channel < 3; channel++) {
+            color[channel] += (next[channel] - color[channel]) * weight;
+        }
+    }
+}
+
+// Normal of the texel center, same as the direction the rasterizer interpolates for a side render target.
+static void get_texel_direction(int face, size_t size, size_t row, size_t column, float& x, float& y, float& z) noexcept {
+    const float u = (static_cast<float>(column) + 0.5f) / static_cast<float>(size) * 2.f - 1.f;
+    const float v = (static_cast<float>(row) + 0.5f) / static_cast<float>(size) * 2.f - 1.f;
+    get_cube_map_direction(face, u, v, x, y, z);
+}
+
+static void store_color(float* output, const float (&color)[3]) noexcept {
+    output[0] = color[0];
+    output[1] = color[1];
+    output[2] = color[2];
+    output[3] = 1.f;
+}
+
+void render_equirectangular_rows(const float* image, size_t width, size_t height, int face, size_t size, size_t row_begin, size_t row_end, float* output) noexcept {
+    for (size_t row = row_begin; row < row_end; row++) {
+        for (size_t column = 0; column < size; column++) {
+            float x, y, z;
+            get_texel_direction(face, size, row, column, x, y, z);
+
+            // Constants are the ones of `sample_spherical_map`.
+            const float u = std::atan2(-z, x) * 0.1591f + 0.5f;
+            const float v = std::asin(std::clamp(y, -1.f, 1.f)) * 0.3183f + 0.5f;
+
+            float color[3];
+            sample_image(image, width, height, u, v, color);
+            store_color(output + (row * size + column) * 4, color);
+        }
+    }
+}
+
+void render_cube_map_rows(const CubeMapImage& cube_map, float mip_level, int face, size_t size, size_t row_begin, size_t row_end, float* output) noexcept {
+    for (size_t row = row_begin; row < row_end; row++) {
+        for (size_t column = 0; column < size; column++) {
+            float x, y, z;
+            get_texel_direction(face, size, row, column, x, y, z);
+
+            int32_t cube_map_face;
+            float u, v;
+            project_to_face(x, y, z, cube_map_face, u, v);
+
+            float color[3];
+            sample_cube_map_face(cube_map, cube_map_face, u, v, mip_level, color);
+            store_color(output + (row * size + column) * 4, color);
+        }
+    }
+}
+
+size_t get_seam_texels(int face, size_t x, size_t y, size_t size, SeamTexel (&texels)[6]) noexcept {
+    if (size == 1) {
+        for (int other = 0; other < 6; other++) {
+            texels[other] = { (face + other) % 6, 0, 0 };
+        }
+        return 6;
+    }
+
+    texels[0] = { face, x, y };
+
+    // Coordinates on the edges of the face are exactly one, texel centers never are.
+    const auto get_coordinate = [size](size_t texel) {
+        if (texel == 0) {
+            return -1.f;
+        }
+        if (texel == size - 1) {
+            return 1.f;
+        }
+        return (static_cast<float>(texel) + 0.5f) / static_cast<float>(size) * 2.f - 1.f;
+    };
+    const float u = get_coordinate(x);
+    const float v = get_coordinate(y);
+    if (std::abs(u) != 1.f && std::abs(v) != 1.f) {
+        return 1;
+    }
+
+    // Point on the surface of the cube, the unnormalized `get_cube_map_direction`.
+    float point[3];
+    switch (face) {
+        case 0:  point[0] =  1.f; point[1] = -v;   point[2] = -u;   break;
+        case 1:  point[0] = -1.f; point[1] = -v;   point[2] =  u;   break;
+        case 2:  point[0] =  u;   point[1] =  1.f; point[2] =  v;   break;
+        case 3:  point[0] =  u;   point[1] = -1.f; point[2] = -v;   break;
+        case 4:  point[0] =  u;   point[1] = -v;   point[2] =  1.f; break;
+        default: point[0] = -u;   point[1] = -v;   point[2] = -1.f; break;
+    }
+
+    size_t count = 1;
+    for (int other = 0; other < 6; other++) {
+        const int axis = other / 2;
+        if (other == face || point[axis] != (other % 2 == 0 ? 1.f : -1.f)) {
+            continue;
+        }
+
+        // Face coordinates of the point on the other face, like `project_to_face`.
+        const float s = axis == 0 ? (point[0] > 0.f ? -point[2] : point[2]) : (axis == 1 ? point[0] : (point[2] > 0.f ? point[0] : -point[0]));
+        const float t = axis == 1 ? (point[1] > 0.f ? point[2] : -point[2]) : -point[1];
+
+        const auto get_texel = [size](float coordinate) {
+            return std::min(static_cast<size_t>((coordinate + 1.f) * 0.5f * static_cast<float>(size)), size - 1);
+        };
+        texels[count++] = { other, get_texel(s), get_texel(t) };
+    }
+    return count;
+}
+
+void downsample_face_rows(const float* const (&input)[6], size_t input_size, int face, size_t row_begin, size_t row_end, float* output) noexcept {
+    const size_t size = std::max<size_t>(input_size / 2, 1);
+    const size_t last = input_size - 1;
+
+    const auto add_quad = [&input, input_size, last](const SeamTexel& texel, float (&sum)[4]) {
+        const float* const top = input[texel.face] + std::min(texel.y * 2, last) * input_size * 4;
+        const float* const bottom = input[texel.face] + std::min(texel.y * 2 + 1, last) * input_size * 4;
+        const size_t left = std::min(texel.x * 2, last) * 4;
+        const size_t right = std::min(texel.x * 2 + 1, last) * 4;
+        for (size_t channel = 0; channel < 4; channel++) {
+            sum[channel] += top[left + channel] + top[right + channel] + bottom[left + channel] + bottom[right + channel];
+        }
+    };
+
+    for (size_t row = row_begin; row < row_end; row++) {
+        for (size_t column = 0; column < size; column++) {
+            SeamTexel texels[6];
+            const size_t count = get_seam_texels(face, column, row, size, texels);
+
+            float sum[4] = {};
+            for (size_t i = 0; i < count; i++) {
+                add_quad(texels[i], sum);
+            }
+
+            const float scale = 1.f / static_cast<float>(count * 4);
+            for (size_t channel = 0; channel < 4; channel++) {
+                output[(row * size + column) * 4 + channel] = sum[channel] * scale;
+            }
+        }
+    }
+}
+
+void downsample_octahedral_rows(const float* input, size_t input_size, size_t row_begin, size_t row_end, float* output) noexcept {
+    const size_t size = std::max<size_t>(input_size / 2, 1);
+    const size_t last = input_size - 1;
+
+    for (size_t row = row_begin; row < row_end; row++) {
+        const float* const top = input + std::min(row * 2, last) * input_size * 4;
+        const float* const bottom = input + std::min(row * 2 + 1, last) * input_size * 4;
+        for (size_t column = 0; column < size; column++) {
+            const size_t left = std::min(column * 2, last) * 4;
+            const size_t right = std::min(column * 2 + 1, last) * 4;
+            for (size_t channel = 0; channel < 4; channel++) {
+                const float sum = top[left + channel] + top[right + channel] + bottom[left + channel] + bottom[right + channel];
+                output[(row * size + column) * 4 + channel] = sum * 0.25f;
+            }
+        }
+    }
+}
+
+void downsample_image_rows(const float* input, size_t width, size_t height, size_t row_begin, size_t row_end, float* output) noexcept {
+    const size_t output_width = std::max<size_t>(width / 2, 1);
+
+    for (size_t row = row_begin; row < row_end; row++) {
+        const float* const top = input + std::min(row * 2, height - 1) * width * 4;
+        const float* const bottom = input + std::min(row * 2 + 1, height - 1) * width * 4;
+        for (size_t column = 0; column < output_width; column++) {
+            const size_t left = std::min(column * 2, width - 1) * 4;
+            const size_t right = std::min(column * 2 + 1, width - 1) * 4;
+            for (size_t channel = 0; channel < 4; channel++) {
+                const float sum = top[left + channel] + top[right + channel] + bottom[left + channel] + bottom[right + channel];
+                output[(row * output_width + column) * 4 + channel] = sum * 0.25f;
+            }
+        }
+    }
+}
+
+// Averages of the texels on the edges of the cube are computed from the original texels before any of them is
+// replaced. `load` and `store` convert a texel of the faces to four floats and back.
+template <typename TexelType, typename Load, typename Store>
+static void fix_seams(TexelType* const (&faces)[6], size_t size, Load load, Store store) noexcept {
+    struct Average final {
+        int face;
+        size_t offset;
+        float color[4];
+    };
+
+    std::vector<Average> averages;
+    for (int face = 0; face < 6; face++) {
+        for (size_t y = 0; y < size; y++) {
+            const bool is_edge_row = y == 0 || y == size - 1;
+            for (size_t x = 0; x < size; x = is_edge_row || x == size - 1 ? x + 1 : size - 1) {
+                SeamTexel texels[6];
+                const size_t count = get_seam_texels(face, x, y, size, texels);
+
+                Average average { face, (y * size + x) * 4, {} };
+                for (size_t i = 0; i < count; i++) {
+                    float color[4];
+                    load(faces[texels[i].face] + (texels[i].y * size + texels[i].x) * 4, color);
+                    for (size_t channel = 0; channel < 4; channel++) {
+                        average.color[channel] += color[channel];
+                    }
+                }
+                for (float& channel : average.color) {
+                    channel /= static_cast<float>(count);
+                }
+                averages.push_back(average);
+            }
+        }
+    }
+
+    for (const Average& average : averages) {
+        store(average.color, faces[average.face] + average.offset);
+    }
+}
+
+void fix_cube_map_seams(float* const (&faces)[6], size_t size) noexcept {
+    fix_seams(faces, size, [](const float* texel, float (&color)[4]) {
+        std::copy(texel, texel + 4, color);
+    }, [](const float (&color)[4], float* texel) {
+        std::copy(color, color + 4, texel);
+    });
+}
+
+void fix_cube_map_seams_rgba16f(uint16_t* const (&faces)[6], size_t size) noexcept {
+    fix_seams(faces, size, [](const uint16_t* texel, float (&color)[4]) {
+        convert_rgba16f_to_rgba32f(texel, 4, color);
+    }, [](const float (&color)[4], uint16_t* texel) {
+        convert_rgba32f_to_rgba16f(color, 4, texel);
+    });
+}
+
+size_t get_irradiance_mip_level(size_t size) noexcept {
+    size_t mip_level = 0;
+    while ((size >> mip_level) > IRRADIANCE_SOURCE_SIZE) {
+        mip_level++;
+    }
+    return mip_level;
+}
+
+IrradianceSamples create_irradiance_samples(size_t step_count) {
+    // Same float operations as the shader, so the sample directions match too.
+    const float step_angle = 0.5f * PI / static_cast<float>(step_count);
+
+    IrradianceSamples samples;
+    for (size_t i = 0; i < 4 * step_count; i++) {
+        const float phi = (static_cast<float>(i) + 0.5f) * step_angle;
+        for (size_t j = 0; j < step_count; j++) {
+            const float theta = (static_cast<float>(j) + 0.5f) * step_angle;
+            samples.x.push_back(std::sin(theta) * std::cos(phi));
+            samples.y.push_back(std::sin(theta) * std::sin(phi));
+            samples.z.push_back(std::cos(theta));
+            samples.weights.push_back(std::cos(theta) * std::sin(theta));
+        }
+    }
+    return samples;
+}
+
+void render_irradiance_rows(const CubeMapImage& cube_map, const IrradianceSamples& samples, size_t mip_level, int face, size_t size, size_t row_begin, size_t row_end, float* output) noexcept {
+    for (size_t row = row_begin; row < row_end; row++) {
+        for (size_t column = 0; column < size; column++) {
+            float normal_x, normal_y, normal_z;
+            get_texel_direction(face, size, row, column, normal_x, normal_y, normal_z);
+
+            // Shader doesn't normalize the tangent frame, so neither does this.
+            const Frame frame {
+                { normal_z, 0.f, -normal_x },
+                { -normal_y * normal_x, normal_z * normal_z + normal_x * normal_x, -normal_y * normal_z },
+                { normal_x, normal_y, normal_z }
+            };
+
+            double irradiance[3] = {};
+            for (size_t block = 0; block < samples.weights.size(); block += SAMPLE_BLOCK_SIZE) {
+                const size_t block_size = std::min(SAMPLE_BLOCK_SIZE, samples.weights.size() - block);
+
+                int32_t faces[SAMPLE_BLOCK_SIZE];
+                float u[SAMPLE_BLOCK_SIZE], v[SAMPLE_BLOCK_SIZE];
+                project_block(samples.x.data() + block, samples.y.data() + block, samples.z.data() + block, block_size, frame, faces, u, v);
+
+                for (size_t i = 0; i < block_size; i++) {
+                    float color[3];
+                    sample_cube_map_face(cube_map, faces[i], u[i], v[i], static_cast<float>(mip_level), color);
+
+                    const float weight = samples.weights[block + i];
+                    for (int channel = 0; channel < 3; channel++) {
+                        irradiance[channel] += color[channel] * weight;
+                    }
+                }
+            }
+
+            float color[3];
+            for (int channel = 0; channel < 3; channel++) {
+                color[channel] = static_cast<float>(PI * irradiance[channel] / static_cast<double>(samples.weights.size()));
+            }
+            store_color(output + (row * size + column) * 4, color);
+        }
+    }
+}
+
+PrefilterSamples create_prefilter_samples(float roughness, size_t sample_count, size_t cube_map_size) {
+    const float a = roughness * roughness;
+    const float a_sqr = a * a;
+    const float count = static_cast<float>(sample_count);
+
+    const float sa_texel = 4.f * PI / (6.f * static_cast<float>(cube_map_size) * static_cast<float>(cube_map_size));
+
+    PrefilterSamples result;
+    for (size_t i = 0; i < sample_count; i++) {
+        const float xi_x = static_cast<float>(i) / count;
+        const float xi_y = radical_inverse(static_cast<uint32_t>(i));
+
+        const float phi = 2.f * PI * xi_x;
+        const float cos_theta = std::sqrt((1.f - xi_y) / (1.f + (a_sqr - 1.f) * xi_y));
+        const float sin_theta = std::sqrt(1.f - cos_theta * cos_theta);
+
+        // Light direction is the view direction, which is the normal, reflected around the half direction.
+        const float half_x = std::cos(phi) * sin_theta;
+        const float half_y = std::sin(phi) * sin_theta;
+        const float half_z = cos_theta;
+
+        const float light_z = 2.f * half_z * half_z - 1.f;
+        if (light_z <= 0.f) {
+            continue;
+        }
+
+        float denominator = half_z * half_z * (a_sqr - 1.f) + 1.f;
+        denominator = PI * denominator * denominator;
+        const float distribution = a_sqr / denominator;
+
+        // Normal dot half and half dot view are the same thing here, so they cancel out.
+        const float pdf = distribution * half_z / (4.f * half_z) + 0.0001f;
+        const float sa_sample = 1.f / (count * pdf + 0.0001f);
+
+        result.x.push_back(2.f * half_z * half_x);
+        result.y.push_back(2.f * half_z * half_y);
+        result.z.push_back(light_z);
+        result.mip_levels.push_back(roughness == 0.f ? 0.f : 0.5f * std::log2(sa_sample / sa_texel));
+    }
+
+    return result;
+}
+
+void render_prefilter_rows(const CubeMapImage& cube_map, const PrefilterSamples& samples, int face, size_t size, size_t row_begin, size_t row_end, float* output) noexcept {
+    for (size_t row = row_begin; row < row_end; row++) {
+        for (size_t column = 0; column < size; column++) {
+            float normal_x, normal_y, normal_z;
+            get_texel_direction(face, size, row, column, normal_x, normal_y, normal_z);
+
+            // Tangent frame of `importance_sample`.
+            const bool is_z_up = std::abs(normal_z) < 0.999f;
+            const float up_x = is_z_up ? 0.f : 1.f;
+            const float up_z = is_z_up ? 1.f : 0.f;
+
+            float tangent_x = -up_z * normal_y;
+            float tangent_y = up_z * normal_x - up_x * normal_z;
+            float tangent_z = up_x * normal_y;
+            const float inverse_length = 1.f / std::sqrt(tangent_x * tangent_x + tangent_y * tangent_y + tangent_z * tangent_z);
+            tangent_x *= inverse_length;
+            tangent_y *= inverse_length;
+            tangent_z *= inverse_length;
+
+            const Frame frame {
+                { tangent_x, tangent_y, tangent_z },
+                { normal_y * tangent_z - normal_z * tangent_y, normal_z * tangent_x - normal_x * tangent_z, normal_x * tangent_y - normal_y * tangent_x },
+                { normal_x, normal_y, normal_z }
+            };
+
+            double prefiltered[3] = {};
+            double total_weight = 0.0;
+            for (size_t block = 0; block < samples.z.size(); block += SAMPLE_BLOCK_SIZE) {
+                const size_t block_size = std::min(SAMPLE_BLOCK_SIZE, samples.z.size() - block);
+
+                int32_t faces[SAMPLE_BLOCK_SIZE];
+                float u[SAMPLE_BLOCK_SIZE], v[SAMPLE_BLOCK_SIZE];
+                project_block(samples.x.data() + block, samples.y.data() + block, samples.z.data() + block, block_size, frame, faces, u, v);
+
+                for (size_t i = 0; i < block_size; i++) {
+                    float color[3];
+                    sample_cube_map_face(cube_map, faces[i], u[i], v[i], samples.mip_levels[block + i], color);
+
+                    // Normal dot light is the Z component of the tangent space light direction.
+                    const float weight = samples.z[block + i];
+                    for (int channel = 0; channel < 3; channel++) {
+                        prefiltered[channel] += color[channel] * weight;
+                    }
+                    total_weight += weight;
+                }
+            }
+
+            float color[3];
+            for (int channel = 0; channel < 3; channel++) {
+                color[channel] = static_cast<float>(prefiltered[channel] / total_weight);
+            }
+            store_color(output + (row * size + column) * 4, color);
+        }
+    }
+}
+
+ConvolutionSource create_convolution_source(const CubeMapImage& cube_map, size_t mip_level) {
+    const size_t size = cube_map.get_mip_size(mip_level);
+    const size_t count = (6 * size * size + 3) / 4 * 4;
+
+    ConvolutionSource source;
+    for (std::vector<float>* values : { &source.x, &source.y, &source.z, &source.red, &source.green, &source.blue, &source.solid_angles }) {
+        values->resize(count, 0.f);
+    }
+
+    // Solid angle of the part of a face from its center to the point `u`, `v` on the face.
+    const auto get_area = [](float u, float v) {
+        return std::atan2(u * v, std::sqrt(u * u + v * v + 1.f));
+    };
+    const auto get_coordinate = [size](size_t texel) {
+        return static_cast<float>(texel) / static_cast<float>(size) * 2.f - 1.f;
+    };
+
+    size_t i = 0;
+    for (int face = 0; face < 6; face++) {
+        const float* const texels = cube_map.get_face(face, mip_level);
+        for (size_t row = 0; row < size; row++) {
+            for (size_t column = 0; column < size; column++, i++) {
+                get_texel_direction(face, size, row, column, source.x[i], source.y[i], source.z[i]);
+
+                const float u0 = get_coordinate(column), u1 = get_coordinate(column + 1);
+                const float v0 = get_coordinate(row), v1 = get_coordinate(row + 1);
+                const float solid_angle = get_area(u0, v0) - get_area(u0, v1) - get_area(u1, v0) + get_area(u1, v1);
+
+                const float* const texel = texels + (row * size + column) * 4;
+                source.red[i] = texel[0] * solid_angle;
+                source.green[i] = texel[1] * solid_angle;
+                source.blue[i] = texel[2] * solid_angle;
+                source.solid_angles[i] = solid_angle;
+            }
+        }
+    }
+    return source;
+}
+
+// Lobes convolved in a single pass over the source, so their sums stay in registers.
+static constexpr size_t CONVOLUTION_LOBE_GROUP_SIZE = 4;
+
+// Sums the red, green, blue and solid angle of the source texels around `normal`, weighted by each of `lobe_count`
+// lobes, at most `CONVOLUTION_LOBE_GROUP_SIZE`. With the distribution term written in the cosine `d` of the texel
+// direction, since the half direction of a view along the normal has a squared cosine of (1 + `d`) / 2, the weight is
+// `d` / (1 + `k` (1 + `d`)) squared for `k` = (alpha squared - 1) / 2, constant factors cancel out.
+static void accumulate_convolution_lobes(const ConvolutionSource& source, const float (&normal)[3], const float* k, size_t lobe_count, double (*sums)[4]) noexcept {
+    const size_t count = source.solid_angles.size();
+
+#if defined(CUBE_MAP_KERNELS_SSE2)
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.f);
+    const __m128 normal_x = _mm_set1_ps(normal[0]), normal_y = _mm_set1_ps(normal[1]), normal_z = _mm_set1_ps(normal[2]);
+
+    __m128 k_vectors[CONVOLUTION_LOBE_GROUP_SIZE];
+    __m128 lobe_sums[CONVOLUTION_LOBE_GROUP_SIZE][4];
+    for (size_t lobe = 0; lobe < lobe_count; lobe++) {
+        k_vectors[lobe] = _mm_set1_ps(k[lobe]);
+        for (__m128& sum : lobe_sums[lobe]) {
+            sum = zero;
+        }
+    }
+
+    for (size_t i = 0; i < count; i += 4) {
+        const __m128 x = _mm_loadu_ps(source.x.data() + i), y = _mm_loadu_ps(source.y.data() + i), z = _mm_loadu_ps(source.z.data() + i);
+        const __m128 d = _mm_max_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(normal_x, x), _mm_mul_ps(normal_y, y)), _mm_mul_ps(normal_z, z)), zero);
+        if (_mm_movemask_ps(_mm_cmpgt_ps(d, zero)) == 0) {
+            continue;
+        }
+
+        const __m128 one_plus_d = _mm_add_ps(one, d);
+        const __m128 red = _mm_loadu_ps(source.red.data() + i), green = _mm_loadu_ps(source.green.data() + i), blue = _mm_loadu_ps(source.blue.data() + i);
+        const __m128 solid_angle = _mm_loadu_ps(source.solid_angles.data() + i);
+        for (size_t lobe = 0; lobe < lobe_count; lobe++) {
+            const __m128 t = _mm_add_ps(one, _mm_mul_ps(k_vectors[lobe], one_plus_d));
+            const __m128 weight = _mm_div_ps(d, _mm_mul_ps(t, t));
+            lobe_sums[lobe][0] = _mm_add_ps(lobe_sums[lobe][0], _mm_mul_ps(weight, red));
+            lobe_sums[lobe][1] = _mm_add_ps(lobe_sums[lobe][1], _mm_mul_ps(weight, green));
+            lobe_sums[lobe][2] = _mm_add_ps(lobe_sums[lobe][2], _mm_mul_ps(weight, blue));
+            lobe_sums[lobe][3] = _mm_add_ps(lobe_sums[lobe][3], _mm_mul_ps(weight, solid_angle));
+        }
+    }
+
+    for (size_t lobe = 0; lobe < lobe_count; lobe++) {
+        for (size_t channel = 0; channel < 4; channel++) {
+            alignas(16) float lanes[4];
+            _mm_store_ps(lanes, lobe_sums[lobe][channel]);
+            sums[lobe][channel] = (static_cast<double>(lanes[0]) + lanes[1]) + (static_cast<double>(lanes[2]) + lanes[3]);
+        }
+    }
+#elif defined(CUBE_MAP_KERNELS_NEON)
+    const float32x4_t zero = vdupq_n_f32(0.f);
+    const float32x4_t one = vdupq_n_f32(1.f);
+
+    float32x4_t lobe_sums[CONVOLUTION_LOBE_GROUP_SIZE][4];
+    for (size_t lobe = 0; lobe < lobe_count; lobe++) {
+        for (float32x4_t& sum : lobe_sums[lobe]) {
+            sum = zero;
+        }
+    }
+
+    for (size_t i = 0; i < count; i += 4) {
+        const float32x4_t x = vld1q_f32(source.x.data() + i), y = vld1q_f32(source.y.data() + i), z = vld1q_f32(source.z.data() + i);
+        const float32x4_t d = vmaxq_f32(vaddq_f32(vaddq_f32(vmulq_n_f32(x, normal[0]), vmulq_n_f32(y, normal[1])), vmulq_n_f32(z, normal[2])), zero);
+        if (vmaxvq_f32(d) == 0.f) {
+            continue;
+        }
+
+        const float32x4_t one_plus_d = vaddq_f32(one, d);
+        const float32x4_t red = vld1q_f32(source.red.data() + i), green = vld1q_f32(source.green.data() + i), blue = vld1q_f32(source.blue.data() + i);
+        const float32x4_t solid_angle = vld1q_f32(source.solid_angles.data() + i);
+        for (size_t lobe = 0; lobe < lobe_count; lobe++) {
+            const float32x4_t t = vaddq_f32(one, vmulq_n_f32(one_plus_d, k[lobe]));
+            const float32x4_t weight = vdivq_f32(d, vmulq_f32(t, t));
+            lobe_sums[lobe][0] = vaddq_f32(lobe_sums[lobe][0], vmulq_f32(weight, red));
+            lobe_sums[lobe][1] = vaddq_f32(lobe_sums[lobe][1], vmulq_f32(weight, green));
+            lobe_sums[lobe][2] = vaddq_f32(lobe_sums[lobe][2], vmulq_f32(weight, blue));
+            lobe_sums[lobe][3] = vaddq_f32(lobe_sums[lobe][3], vmulq_f32(weight, solid_angle));
+        }
+    }
+
+    for (size_t lobe = 0; lobe < lobe_count; lobe++) {
+        for (size_t channel = 0; channel < 4; channel++) {
+            float lanes[4];
+            vst1q_f32(lanes, lobe_sums[lobe][channel]);
+            sums[lobe][channel] = (static_cast<double>(lanes[0]) + lanes[1]) + (static_cast<double>(lanes[2]) + lanes[3]);
+        }
+    }
+#else
+    for (size_t lobe = 0; lobe < lobe_count; lobe++) {
+        std::fill(sums[lobe], sums[lobe] + 4, 0.0);
+    }
+
+    for (size_t i = 0; i < count; i++) {
+        const float d = normal[0] * source.x[i] + normal[1] * source.y[i] + normal[2] * source.z[i];
+        if (d <= 0.f) {
+            continue;
+        }
+
+        for (size_t lobe = 0; lobe < lobe_count; lobe++) {
+            const float t = 1.f + k[lobe] * (1.f + d);
+            const float weight = d / (t * t);
+            sums[lobe][0] += weight * source.red[i];
+            sums[lobe][1] += weight * source.green[i];
+            sums[lobe][2] += weight * source.blue[i];
+            sums[lobe][3] += weight * source.solid_angles[i];
+        }
+    }
+#endif
+}
+
+void render_convolution_rows(const ConvolutionSource& source, const float* a_sqrs, size_t lobe_count, int face, size_t size, size_t row_begin, size_t row_end, float* const* outputs) noexcept {
+    // Lobes with the alpha squared of an earlier lobe are copied from it.
+    std::vector<size_t> lobes;
+    std::vector<float> k;
+    for (size_t lobe = 0; lobe < lobe_count; lobe++) {
+        if (std::find(a_sqrs, a_sqrs + lobe, a_sqrs[lobe]) == a_sqrs + lobe) {
+            lobes.push_back(lobe);
+            k.push_back((a_sqrs[lobe] - 1.f) * 0.5f);
+        }
+    }
+
+    for (size_t row = row_begin; row < row_end; row++) {
+        for (size_t column = 0; column < size; column++) {
+            float normal[3];
+            get_texel_direction(face, size, row, column, normal[0], normal[1], normal[2]);
+
+            const size_t offset = (row * size + column) * 4;
+            for (size_t group = 0; group < lobes.size(); group += CONVOLUTION_LOBE_GROUP_SIZE) {
+                const size_t group_size = std::min(CONVOLUTION_LOBE_GROUP_SIZE, lobes.size() - group);
+
+                double sums[CONVOLUTION_LOBE_GROUP_SIZE][4];
+                accumulate_convolution_lobes(source, normal, k.data() + group, group_size, sums);
+
+                for (size_t i = 0; i < group_size; i++) {
+                    float color[3];
+                    for (int channel = 0; channel < 3; channel++) {
+                        color[channel] = static_cast<float>(sums[i][channel] / sums[i][3]);
+                    }
+                    store_color(outputs[lobes[group + i]] + offset, color);
+                }
+            }
+
+            for (size_t lobe = 0; lobe < lobe_count; lobe++) {
+                const size_t first = static_cast<size_t>(std::find(a_sqrs, a_sqrs + lobe, a_sqrs[lobe]) - a_sqrs);
+                if (first != lobe) {
+                    std::copy(outputs[first] + offset, outputs[first] + offset + 4, outputs[lobe] + offset);
+                }
+            }
+        }
+    }
+}
+
+// Sums the scale and the bias of the GGX samples with half directions `half_x` and `half_z` for the view direction
+// `view_x`, `view_z`. `view_weight` is the Smith geometry term of the view divided by the cosine of the view, which
+// is the same for every sample. Samples whose light direction is below the horizon count as zero. Vector paths take
+// four samples at a time, `count` must be a multiple of four.
+static void accumulate_brdf_samples(const float* half_x, const float* half_z, size_t count, float view_x, float view_z, float k, float view_weight,
+                                    float& scale, float& bias) noexcept {
+    scale = 0.f;
+    bias = 0.f;
+
+#if defined(CUBE_MAP_KERNELS_SSE2)
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.f);
+    const __m128 two = _mm_set1_ps(2.f);
+    const __m128 k_vector = _mm_set1_ps(k);
+    const __m128 one_minus_k = _mm_set1_ps(1.f - k);
+    const __m128 view_x_vector = _mm_set1_ps(view_x);
+    const __m128 view_z_vector = _mm_set1_ps(view_z);
+    const __m128 view_weight_vector = _mm_set1_ps(view_weight);
+
+    __m128 scale_sum = zero;
+    __m128 bias_sum = zero;
+    for (size_t i = 0; i < count; i += 4) {
+        const __m128 x = _mm_loadu_ps(half_x + i), z = _mm_loadu_ps(half_z + i);
+        const __m128 view_dot_half = _mm_add_ps(_mm_mul_ps(view_x_vector, x), _mm_mul_ps(view_z_vector, z));
+        const __m128 light_z = _mm_sub_ps(_mm_mul_ps(_mm_mul_ps(two, view_dot_half), z), view_z_vector);
+        const __m128 clamped_view_dot_half = _mm_max_ps(view_dot_half, zero);
+
+        const __m128 geometry_light = _mm_div_ps(light_z, _mm_add_ps(_mm_mul_ps(light_z, one_minus_k), k_vector));
+        __m128 weight = _mm_div_ps(_mm_mul_ps(_mm_mul_ps(geometry_light, clamped_view_dot_half), view_weight_vector), z);
+        weight = _mm_and_ps(_mm_cmpgt_ps(light_z, zero), weight);
+
+        const __m128 fresnel_base = _mm_sub_ps(one, clamped_view_dot_half);
+        const __m128 fresnel_base_sqr = _mm_mul_ps(fresnel_base, fresnel_base);
+        const __m128 fresnel = _mm_mul_ps(_mm_mul_ps(fresnel_base_sqr, fresnel_base_sqr), fresnel_base);
+        const __m128 fresnel_weight = _mm_mul_ps(fresnel, weight);
+
+        scale_sum = _mm_add_ps(scale_sum, _mm_sub_ps(weight, fresnel_weight));
+        bias_sum = _mm_add_ps(bias_sum, fresnel_weight);
+    }
+
+    alignas(16) float scales[4], biases[4];
+    _mm_store_ps(scales, scale_sum);
+    _mm_store_ps(biases, bias_sum);
+    scale = (scales[0] + scales[1]) + (scales[2] + scales[3]);
+    bias = (biases[0] + biases[1]) + (biases[2] + biases[3]);
+#elif defined(CUBE_MAP_KERNELS_NEON)
+    const float32x4_t zero = vdupq_n_f32(0.f);
+    const float32x4_t one = vdupq_n_f32(1.f);
+    const float32x4_t k_vector = vdupq_n_f32(k);
+
+    float32x4_t scale_sum = zero;
+    float32x4_t bias_sum = zero;
+    for (size_t i = 0; i < count; i += 4) {
+        const float32x4_t x = vld1q_f32(half_x + i), z = vld1q_f32(half_z + i);
+        const float32x4_t view_dot_half = vaddq_f32(vmulq_n_f32(x, view_x), vmulq_n_f32(z, view_z));
+        const float32x4_t light_z = vsubq_f32(vmulq_f32(vmulq_n_f32(view_dot_half, 2.f), z), vdupq_n_f32(view_z));
+        const float32x4_t clamped_view_dot_half = vmaxq_f32(view_dot_half, zero);
+
+        const float32x4_t geometry_light = vdivq_f32(light_z, vaddq_f32(vmulq_n_f32(light_z, 1.f - k), k_vector));
+        float32x4_t weight = vdivq_f32(vmulq_n_f32(vmulq_f32(geometry_light, clamped_view_dot_half), view_weight), z);
+        weight = vreinterpretq_f32_u32(vandq_u32(vcgtq_f32(light_z, zero), vreinterpretq_u32_f32(weight)));
+
+        const float32x4_t fresnel_base = vsubq_f32(one, clamped_view_dot_half);
+        const float32x4_t fresnel_base_sqr = vmulq_f32(fresnel_base, fresnel_base);
+        const float32x4_t fresnel = vmulq_f32(vmulq_f32(fresnel_base_sqr, fresnel_base_sqr), fresnel_base);
+        const float32x4_t fresnel_weight = vmulq_f32(fresnel, weight);
+
+        scale_sum = vaddq_f32(scale_sum, vsubq_f32(weight, fresnel_weight));
+        bias_sum = vaddq_f32(bias_sum, fresnel_weight);
+    }
+
+    float scales[4], biases[4];
+    vst1q_f32(scales, scale_sum);
+    vst1q_f32(biases, bias_sum);
+    scale = (scales[0] + scales[1]) + (scales[2] + scales[3]);
+    bias = (biases[0] + biases[1]) + (biases[2] + biases[3]);
+#else
+    for (size_t i = 0; i < count; i++) {
+        const float view_dot_half = view_x * half_x[i] + view_z * half_z[i];
+        const float light_z = 2.f * view_dot_half * half_z[i] - view_z;
+        if (light_z <= 0.f) {
+            continue;
+        }
+
+        const float clamped_view_dot_half = std::max(view_dot_half, 0.f);
+        const float geometry_light = light_z / (light_z * (1.f - k) + k);
+        const float weight = geometry_light * clamped_view_dot_half * view_weight / half_z[i];
+
+        const float fresnel_base = 1.f - clamped_view_dot_half;
+        const float fresnel_base_sqr = fresnel_base * fresnel_base;
+        const float fresnel_weight = fresnel_base_sqr * fresnel_base_sqr * fresnel_base * weight;
+
+        scale += weight - fresnel_weight;
+        bias += fresnel_weight;
+    }
+#endif
+}
+
+static_assert(BRDF_LUT_SAMPLE_COUNT % 4 == 0, "Vector paths of the BRDF LUT take four samples at a time.");
+
+void render_brdf_lut_rows(size_t size, size_t row_begin, size_t row_end, float* output) noexcept {
+    const float count = static_cast<float>(BRDF_LUT_SAMPLE_COUNT);
+
+    for (size_t row = row_begin; row < row_end; row++) {
+        const float roughness = (static_cast<float>(row) + 0.5f) / static_cast<float>(size);
+        const float a = roughness * roughness;
+        const float a_sqr = a * a;
+
+        // Smith geometry term of image based lighting remaps the roughness to `a` / 2 rather than the (`roughness` + 1)
+        // squared / 8 of analytic lights.
+        const float k = a / 2.f;
+
+        // Half directions don't depend on the view direction, which lies in the XZ plane, so Y doesn't matter.
+        alignas(16) float half_x[BRDF_LUT_SAMPLE_COUNT];
+        alignas(16) float half_z[BRDF_LUT_SAMPLE_COUNT];
+        for (size_t i = 0; i < BRDF_LUT_SAMPLE_COUNT; i++) {
+            const float xi_x = static_cast<float>(i) / count;
+            const float xi_y = radical_inverse(static_cast<uint32_t>(i));
+
+            const float phi = 2.f * PI * xi_x;
+            const float cos_theta = std::sqrt((1.f - xi_y) / (1.f + (a_sqr - 1.f) * xi_y));
+            const float sin_theta = std::sqrt(1.f - cos_theta * cos_theta);
+
+            half_x[i] = std::cos(phi) * sin_theta;
+            half_z[i] = cos_theta;
+        }
+
+        for (size_t column = 0; column < size; column++) {
+            const float normal_dot_view = (static_cast<float>(column) + 0.5f) / static_cast<float>(size);
+            const float view_x = std::sqrt(1.f - normal_dot_view * normal_dot_view);
+            const float geometry_view = normal_dot_view / (normal_dot_view * (1.f - k) + k);
+
+            float scale, bias;
+            accumulate_brdf_samples(half_x, half_z, BRDF_LUT_SAMPLE_COUNT, view_x, normal_dot_view, k, geometry_view / normal_dot_view, scale, bias);
+
+            float* const texel = output + (row * size + column) * 4;
+            texel[0] = scale / count;
+            texel[1] = bias / count;
+            texel[2] = 0.f;
+            texel[3] = 1.f;
+        }
+    }
+}
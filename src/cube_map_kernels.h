@@ -0,0 +1,179 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// CPU versions of the cube map, irradiance and prefilter shaders for machines without a GPU. Kernels follow the
+// OpenGL versions of the shaders operation by operation, so both backends produce the same images up to filtering
+// and half float rounding differences. Every kernel writes a range of rows of a single face, so callers can split a
+// cube map into tiles and render them in parallel. The BRDF LUT of image based lighting has no shader and is only ever
+// baked here, with the importance sampling of the prefilter shader.
+
+// Van der Corput radical inverse in base 2, the second coordinate of the Hammersley sequence.
+float radical_inverse(uint32_t index) noexcept;
+
+// Face index of octahedral maps, which kernels render as a single square face. The center of the map is +Y, the
+// upper hemisphere is the inner diamond with +X to the right and +Z to the bottom, and the lower hemisphere is folded
+// over the edges of the diamond into the corners, so -Y is every corner. A runtime maps a direction `d` to
+// `p = d.xz / (|d.x| + |d.y| + |d.z|)`, replaced by `(1 - |p.y|, 1 - |p.x|) * sign(p)` when `d.y` is negative, and
+// samples the map at `p * 0.5 + 0.5`.
+static constexpr int OCTAHEDRAL_FACE = 6;
+
+// Direction through the specified point of a DDS cube map face or of the octahedral map for `OCTAHEDRAL_FACE`, `u`
+// and `v` are in [-1, 1] from the top left corner.
+void get_cube_map_direction(int face, float u, float v, float& x, float& y, float& z) noexcept;
+
+// Cube map with a full mip chain in host memory. Every mip level of every face is an interleaved RGBA float image,
+// faces follow the DDS order and orientation, same as the faces read back from the GPU.
+struct CubeMapImage final {
+    explicit CubeMapImage(size_t size, size_t max_mip_levels = SIZE_MAX);
+
+    CubeMapImage(const CubeMapImage&) = delete;
+    CubeMapImage(CubeMapImage&&) = delete;
+    CubeMapImage& operator=(const CubeMapImage&) = delete;
+    CubeMapImage& operator=(CubeMapImage&&) = delete;
+
+    size_t get_mip_size(size_t mip_level) const noexcept;
+    float* get_face(int face, size_t mip_level) noexcept;
+    const float* get_face(int face, size_t mip_level) const noexcept;
+
+    size_t size;
+    size_t mip_levels;
+
+    // Face images of the first mip level, followed by face images of the second mip level and so on.
+    std::vector<std::vector<float>> images;
+};
+
+// Octahedral map in host memory with at most `max_mip_levels` mip levels, every mip level is an interleaved RGBA float
+// image.
+struct OctahedralImage final {
+    OctahedralImage(size_t size, size_t max_mip_levels);
+
+    OctahedralImage(const OctahedralImage&) = delete;
+    OctahedralImage(OctahedralImage&&) = delete;
+    OctahedralImage& operator=(const OctahedralImage&) = delete;
+    OctahedralImage& operator=(OctahedralImage&&) = delete;
+
+    size_t get_mip_size(size_t mip_level) const noexcept;
+    float* get_level(size_t mip_level) noexcept;
+    const float* get_level(size_t mip_level) const noexcept;
+
+    size_t size;
+    size_t mip_levels;
+    std::vector<std::vector<float>> images;
+};
+
+// Projects an equirectangular RGBA float image with rows going from the bottom onto cube map face rows
+// [`row_begin`, `row_end`) of a `size` x `size` face, like `cube_map_shader`.
+void render_equirectangular_rows(const float* image, size_t width, size_t height, int face, size_t size, size_t row_begin, size_t row_end, float* output) noexcept;
+
+// Resamples the given mip level of `cube_map` onto rows [`row_begin`, `row_end`) of a `size` x `size` face, meant for
+// octahedral maps of inputs that are cube map faces rather than an equirectangular image.
+void render_cube_map_rows(const CubeMapImage& cube_map, float mip_level, int face, size_t size, size_t row_begin, size_t row_end, float* output) noexcept;
+
+// Texel of a cube map face.
+struct SeamTexel final {
+    int face;
+    size_t x;
+    size_t y;
+};
+
+// Texels of a `size` x `size` cube map level that share the position of the given texel on the edges of the cube, the
+// texel itself first. Interior texels share it with nobody, edge texels with a texel of the neighbour face and corner
+// texels with a texel of each of the two neighbour faces. Single texel faces are corners of every face.
+size_t get_seam_texels(int face, size_t x, size_t y, size_t size, SeamTexel (&texels)[6]) noexcept;
+
+// Rows [`row_begin`, `row_end`) of the next mip level of a face of `input_size` x `input_size` faces, like
+// `downsample_shader`. Every texel is the average of a 2x2 quad of the input clamped to its edges, and texels on the
+// edges of the cube average the quads of all their `get_seam_texels`, so neighbour faces agree on every shared edge
+// and corner and sampling the cube map without seamless filtering shows no seams.
+void downsample_face_rows(const float* const (&input)[6], size_t input_size, int face, size_t row_begin, size_t row_end, float* output) noexcept;
+
+// Rows [`row_begin`, `row_end`) of the next mip level of an `input_size` x `input_size` octahedral map, the average of
+// a 2x2 quad of the input clamped to its edges. Every mip level of an octahedral map covers the sphere the same way, so
+// plain 2D filtering is enough.
+void downsample_octahedral_rows(const float* input, size_t input_size, size_t row_begin, size_t row_end, float* output) noexcept;
+
+// Rows [`row_begin`, `row_end`) of an RGBA float image of half the width and height of the `width` x `height` input,
+// the average of a 2x2 quad of the input clamped to its edges. Equirectangular inputs much larger than the cube map are
+// reduced this way before they're projected.
+void downsample_image_rows(const float* input, size_t width, size_t height, size_t row_begin, size_t row_end, float* output) noexcept;
+
+// Replaces the texels on the edges of the cube of a `size` x `size` level with the averages of their `get_seam_texels`,
+// for levels that are rendered rather than downsampled.
+void fix_cube_map_seams(float* const (&faces)[6], size_t size) noexcept;
+
+// Same as `fix_cube_map_seams` for interleaved RGBA half float faces.
+void fix_cube_map_seams_rgba16f(uint16_t* const (&faces)[6], size_t size) noexcept;
+
+// Irradiance is integrated from the first mip level of the cube map that is at most this many texels wide, the
+// `MAX_STEP_COUNT` of `irradiance_shader`. Irradiance is a very low frequency signal, so a small level loses nothing.
+static constexpr size_t IRRADIANCE_SOURCE_SIZE = 32;
+
+// Mip level of a `size` x `size` cube map irradiance is integrated from, see `IRRADIANCE_SOURCE_SIZE`.
+size_t get_irradiance_mip_level(size_t size) noexcept;
+
+// Tangent space hemisphere samples of the irradiance shader at a mip level `step_count` texels wide: `step_count`
+// steps of theta by four times as many steps of phi at the centers of the steps.
+struct IrradianceSamples final {
+    std::vector<float> x;
+    std::vector<float> y;
+    std::vector<float> z;
+    std::vector<float> weights;
+};
+
+IrradianceSamples create_irradiance_samples(size_t step_count);
+
+// Cosine weighted hemisphere integral of `cube_map` at the given mip level with the given samples, like
+// `irradiance_shader`.
+void render_irradiance_rows(const CubeMapImage& cube_map, const IrradianceSamples& samples, size_t mip_level, int face, size_t size, size_t row_begin, size_t row_end, float* output) noexcept;
+
+// GGX importance samples of a single prefilter mip level. Samples don't depend on the texel, because the view
+// direction is the normal, so their light directions, weights and environment mip levels are computed once.
+struct PrefilterSamples final {
+    // Light directions in the tangent space of the normal.
+    std::vector<float> x;
+    std::vector<float> y;
+    std::vector<float> z;
+
+    std::vector<float> mip_levels;
+};
+
+PrefilterSamples create_prefilter_samples(float roughness, size_t sample_count, size_t cube_map_size);
+
+// Environment prefiltered with the given samples, like `prefilter_shader`.
+void render_prefilter_rows(const CubeMapImage& cube_map, const PrefilterSamples& samples, int face, size_t size, size_t row_begin, size_t row_end, float* output) noexcept;
+
+// Texels of a single mip level of a cube map, fetched once and shared by every lobe of `render_convolution_rows`: the
+// direction through the center of every texel, its solid angle, and its color multiplied by the solid angle. Arrays
+// are padded to a multiple of four with texels of no solid angle.
+struct ConvolutionSource final {
+    std::vector<float> x;
+    std::vector<float> y;
+    std::vector<float> z;
+    std::vector<float> red;
+    std::vector<float> green;
+    std::vector<float> blue;
+    std::vector<float> solid_angles;
+};
+
+ConvolutionSource create_convolution_source(const CubeMapImage& cube_map, size_t mip_level);
+
+// Convolves `source` with several lobes at once, for rows [`row_begin`, `row_end`) of `size` x `size` face images,
+// `outputs[i]` is the face image of lobe `i`. Lobes are GGX lobes with the view direction along the normal, given by
+// their alpha squared, and every source texel is weighted by the distribution of its half direction times the cosine
+// of its direction, so a lobe converges to what `render_prefilter_rows` estimates with importance samples. An alpha
+// squared of 1 is the cosine lobe of `render_irradiance_rows`. The direction of every texel is computed once for all
+// the lobes, and lobes with the same alpha squared once. Alpha squared must be above zero.
+void render_convolution_rows(const ConvolutionSource& source, const float* a_sqrs, size_t lobe_count, int face, size_t size, size_t row_begin, size_t row_end, float* const* outputs) noexcept;
+
+// Samples of every texel of the BRDF LUT, as many as the roughest prefilter mip levels take.
+static constexpr size_t BRDF_LUT_SAMPLE_COUNT = 1024;
+
+// Rows [`row_begin`, `row_end`) of the `size` x `size` split sum BRDF LUT of image based lighting in interleaved RGBA
+// floats. Columns are the cosine between the normal and the view direction and rows are the roughness, both at texel
+// centers from the left and from the top. Red is the scale and green the bias applied to the Fresnel reflectance at
+// normal incidence, integrated over GGX importance samples like `prefilter_shader` with the Smith geometry term of
+// image based lighting. Blue is zero and alpha is one.
+void render_brdf_lut_rows(size_t size, size_t row_begin, size_t row_end, float* output) noexcept;
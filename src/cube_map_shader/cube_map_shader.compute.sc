@@ -0,0 +1,33 @@
+#include <bgfx_compute.sh>
+#include <cube_map_compute.sh>
+
+SAMPLER2D(s_texture, 0);
+IMAGE2D_ARRAY_WR(s_output, rgba16f, 1);
+
+uniform mat4 u_inverse_view_projections[6];
+uniform vec4 u_settings;
+
+#define u_side_resolution u_settings.x
+
+vec2 sample_spherical_map(vec3 v) {
+    vec2 uv1 = vec2(atan2(-v.z, v.x), asin(v.y));
+    uv1 *= vec2(0.1591, 0.3183);
+    uv1 += 0.5;
+    return uv1;
+}
+
+// Writes all six faces of one mip level, face index is the Z component of the invocation.
+NUM_THREADS(8, 8, 1)
+void main() {
+    ivec3 texel = ivec3(gl_GlobalInvocationID);
+    if (float(texel.x) >= u_side_resolution || float(texel.y) >= u_side_resolution) {
+        return;
+    }
+
+    vec3 dir = cube_map_direction(texel, u_side_resolution, u_inverse_view_projections[texel.z]);
+    #if (BGFX_SHADER_LANGUAGE_HLSL || BGFX_SHADER_LANGUAGE_PSSL || BGFX_SHADER_LANGUAGE_METAL)
+    dir.y = -dir.y;
+    #endif
+    vec2 uv = sample_spherical_map(dir);
+    imageStore(s_output, texel, vec4(texture2DLod(s_texture, uv, 0.0).xyz, 1.0));
+}
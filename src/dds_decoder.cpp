@@ -0,0 +1,162 @@
+#include "dds_decoder.h"
+#include "dds_layout.h"
+
+#include "pixel_kernels.h"
+
+#include <cstring>
+#include <new>
+
+static constexpr uint32_t DDS_PIXEL_FORMAT_ALPHA = 0x1;
+static constexpr uint32_t DDS_PIXEL_FORMAT_FOURCC = 0x4;
+static constexpr uint32_t DDS_PIXEL_FORMAT_RGB = 0x40;
+static constexpr uint32_t DDS_CAPS2_CUBEMAP = 0x200;
+static constexpr uint32_t DDS_CAPS2_VOLUME = 0x200000;
+
+static constexpr uint32_t DXGI_FORMAT_R8G8B8A8_UNORM = 28;
+static constexpr uint32_t DXGI_FORMAT_R8G8B8A8_UNORM_SRGB = 29;
+static constexpr uint32_t DXGI_FORMAT_B8G8R8X8_UNORM = 88;
+static constexpr uint32_t DXGI_FORMAT_B8G8R8A8_UNORM_SRGB = 91;
+static constexpr uint32_t DXGI_FORMAT_B8G8R8X8_UNORM_SRGB = 93;
+
+// Same limit as the largest 2D texture of D3D, far beyond anything the compiler accepts.
+static constexpr uint32_t DDS_MAX_SIZE = 1 << 16;
+
+namespace {
+
+// Layout of the pixels of the first mip level.
+struct DdsImage final {
+    uint32_t width = 0;
+    uint32_t height = 0;
+    size_t offset = 0;
+    bool is_bgra = false;
+    bool is_opaque = false;
+};
+
+} // namespace
+
+static uint32_t read_le32(const uint8_t* data, size_t offset) noexcept {
+    return static_cast<uint32_t>(data[offset]) | static_cast<uint32_t>(data[offset + 1]) << 8 | static_cast<uint32_t>(data[offset + 2]) << 16 |
+           static_cast<uint32_t>(data[offset + 3]) << 24;
+}
+
+// Reads the header. The pixels are checked to be there only when `is_complete`, probes read the start of the file.
+static bool read_dds_image(const uint8_t* data, size_t size, bool is_complete, DdsImage& image) noexcept {
+    if (size < DDS_HEADER_SIZE || std::memcmp(data, "DDS ", 4) != 0 || read_le32(data, 4) != 124 || (read_le32(data, 112) & (DDS_CAPS2_CUBEMAP | DDS_CAPS2_VOLUME)) != 0) {
+        return false;
+    }
+
+    image.height = read_le32(data, 12);
+    image.width = read_le32(data, 16);
+    if (image.width == 0 || image.height == 0 || image.width > DDS_MAX_SIZE || image.height > DDS_MAX_SIZE) {
+        return false;
+    }
+
+    const uint32_t flags = read_le32(data, 80);
+    if ((flags & DDS_PIXEL_FORMAT_FOURCC) != 0) {
+        if (std::memcmp(data + 84, "DX10", 4) != 0 || size < DDS10_HEADER_SIZE || read_le32(data, 132) != DDS10_DIMENSION_TEXTURE_2D ||
+            (read_le32(data, 136) & DDS10_MISC_TEXTURECUBE) != 0 || read_le32(data, 140) > 1) {
+            return false;
+        }
+
+        switch (read_le32(data, 128)) {
+            case DXGI_FORMAT_R8G8B8A8_UNORM:
+            case DXGI_FORMAT_R8G8B8A8_UNORM_SRGB:
+                break;
+            case DXGI_FORMAT_B8G8R8A8_UNORM:
+            case DXGI_FORMAT_B8G8R8A8_UNORM_SRGB:
+                image.is_bgra = true;
+                break;
+            case DXGI_FORMAT_B8G8R8X8_UNORM:
+            case DXGI_FORMAT_B8G8R8X8_UNORM_SRGB:
+                image.is_bgra = true;
+                image.is_opaque = true;
+                break;
+            default:
+                return false;
+        }
+        image.offset = DDS10_HEADER_SIZE;
+    } else {
+        // Red, green and blue masks of RGB formats, green is always the second byte.
+        const uint32_t red_mask = read_le32(data, 92);
+        const uint32_t green_mask = read_le32(data, 96);
+        const uint32_t blue_mask = read_le32(data, 100);
+        const uint32_t alpha_mask = read_le32(data, 104);
+        if ((flags & DDS_PIXEL_FORMAT_RGB) == 0 || read_le32(data, 88) != 32 || green_mask != 0x0000FF00) {
+            return false;
+        }
+        if (red_mask == 0x000000FF && blue_mask == 0x00FF0000) {
+            image.is_bgra = false;
+        } else if (red_mask == 0x00FF0000 && blue_mask == 0x000000FF) {
+            image.is_bgra = true;
+        } else {
+            return false;
+        }
+        if ((flags & DDS_PIXEL_FORMAT_ALPHA) == 0) {
+            image.is_opaque = true;
+        } else if (alpha_mask != 0xFF000000) {
+            return false;
+        }
+        image.offset = DDS_HEADER_SIZE;
+    }
+
+    return !is_complete || size - image.offset >= size_t { image.width } * image.height * 4;
+}
+
+bool read_dds_size(const uint8_t* data, size_t size, int& width, int& height, int& channels) noexcept {
+    DdsImage image;
+    if (!read_dds_image(data, size, false, image)) {
+        return false;
+    }
+
+    width = static_cast<int>(image.width);
+    height = static_cast<int>(image.height);
+    channels = image.is_opaque ? 3 : 4;
+    return true;
+}
+
+std::unique_ptr<uint8_t[]> decode_dds_rgba8(const uint8_t* data, size_t size, int& width, int& height, int& channels) noexcept {
+    DdsImage image;
+    if (!read_dds_image(data, size, true, image)) {
+        return nullptr;
+    }
+
+    const size_t pixel_count = size_t { image.width } * image.height;
+    std::unique_ptr<uint8_t[]> output(new (std::nothrow) uint8_t[pixel_count * 4]);
+    if (output == nullptr) {
+        return nullptr;
+    }
+    swizzle_rgba8(data + image.offset, pixel_count, image.is_bgra, image.is_opaque, output.get());
+
+    width = static_cast<int>(image.width);
+    height = static_cast<int>(image.height);
+    channels = image.is_opaque ? 3 : 4;
+    return output;
+}
+
+std::unique_ptr<uint8_t[]> decode_dds_channel8(const uint8_t* data, size_t size, int channel, int& width, int& height, int& channels) noexcept {
+    DdsImage image;
+    if (!read_dds_image(data, size, true, image)) {
+        return nullptr;
+    }
+
+    const size_t pixel_count = size_t { image.width } * image.height;
+    std::unique_ptr<uint8_t[]> output(new (std::nothrow) uint8_t[pixel_count]);
+    if (output == nullptr) {
+        return nullptr;
+    }
+
+    const uint8_t* const pixels = data + image.offset;
+    if (channel == 3 && image.is_opaque) {
+        std::memset(output.get(), 255, pixel_count);
+    } else {
+        const size_t byte = image.is_bgra && channel != 1 && channel != 3 ? static_cast<size_t>(2 - channel) : static_cast<size_t>(channel);
+        for (size_t i = 0; i < pixel_count; i++) {
+            output[i] = pixels[i * 4 + byte];
+        }
+    }
+
+    width = static_cast<int>(image.width);
+    height = static_cast<int>(image.height);
+    channels = image.is_opaque ? 3 : 4;
+    return output;
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+// Reads the size and the channels, 3 or 4, of an uncompressed 32-bit RGBA, BGRA, RGBX or BGRX DDS image from its
+// header. Returns false for everything else, compressed formats, cube maps, volumes and arrays included.
+bool read_dds_size(const uint8_t* data, size_t size, int& width, int& height, int& channels) noexcept;
+
+// Decodes the first mip level of an image `read_dds_size` accepts to RGBA8 pixels, images without alpha are opaque.
+// DDS files of these formats are the pixels as they are, so decoding is a copy with red and blue swapped for BGRA and
+// BGRX, done with SSE2, AVX2 or NEON. Formats are DXGI_FORMAT_R8G8B8A8, B8G8R8A8 and B8G8R8X8 of the DX10 header,
+// sRGB or not, and 32-bit RGB formats of the legacy header with red or blue in the low byte. Returns null for other
+// files or when the data is truncated.
+std::unique_ptr<uint8_t[]> decode_dds_rgba8(const uint8_t* data, size_t size, int& width, int& height, int& channels) noexcept;
+
+// Same as `decode_dds_rgba8`, but keeps only the specified channel of every RGBA8 pixel, a byte per pixel.
+std::unique_ptr<uint8_t[]> decode_dds_channel8(const uint8_t* data, size_t size, int channel, int& width, int& height, int& channels) noexcept;
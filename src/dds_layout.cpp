@@ -0,0 +1,124 @@
+#include "dds_layout.h"
+#include "astc_encoder.h"
+#include "etc2_encoder.h"
+#include "uastc_encoder.h"
+
+#include <algorithm>
+
+static const TextureFormatSize TEXTURE_FORMAT_SIZES[] = {
+    // DXGI_FORMAT_R32G32B32A32_FLOAT.
+    { 2, 109, 16, false },
+    // DXGI_FORMAT_R16G16B16A16_FLOAT.
+    { 10, 97, 8, false },
+    // DXGI_FORMAT_R11G11B10_FLOAT.
+    { 26, 122, 4, false },
+    // DXGI_FORMAT_R8G8B8A8_UNORM.
+    { 28, 37, 4, false },
+    // DXGI_FORMAT_R16G16_FLOAT.
+    { 34, 83, 4, false },
+    // DXGI_FORMAT_R16_UNORM.
+    { 56, 70, 2, false },
+    // DXGI_FORMAT_R8_UNORM.
+    { 61, 9, 1, false },
+    // DXGI_FORMAT_R9G9B9E5_SHAREDEXP.
+    { 67, 123, 4, false },
+    // DXGI_FORMAT_BC1_UNORM, only opaque textures of `--auto-format` are BC1.
+    { 71, 131, 8, true },
+    // DXGI_FORMAT_BC3_UNORM.
+    { 77, 137, 16, true },
+    // DXGI_FORMAT_BC4_UNORM.
+    { 80, 139, 8, true },
+    // DXGI_FORMAT_BC5_UNORM.
+    { 83, 141, 16, true },
+    // DXGI_FORMAT_B8G8R8A8_UNORM.
+    { 87, 44, 4, false },
+    // DXGI_FORMAT_BC6H_UF16.
+    { 95, 143, 16, true },
+    // DXGI_FORMAT_BC6H_SF16.
+    { 96, 144, 16, true },
+    // DXGI_FORMAT_BC7_UNORM.
+    { 98, 145, 16, true },
+    // Blocks of the built-in ETC2, EAC, ASTC and UASTC encoders.
+    { DXGI_FORMAT_UNKNOWN, ETC2_RGBA8_VK_FORMAT, 16, true },
+    { DXGI_FORMAT_UNKNOWN, EAC_R11_VK_FORMAT, 8, true },
+    { DXGI_FORMAT_UNKNOWN, ASTC_4X4_VK_FORMAT, 16, true },
+    { DXGI_FORMAT_UNKNOWN, UASTC_RGBA_VK_FORMAT, 16, true },
+    { DXGI_FORMAT_UNKNOWN, UASTC_RRR_VK_FORMAT, 16, true },
+};
+
+bool Dds10Header::is_cube_map() const noexcept {
+    return (misc_flags & DDS10_MISC_TEXTURECUBE) != 0;
+}
+
+uint32_t Dds10Header::get_layer_count() const noexcept {
+    return array_size * (is_cube_map() ? 6 : 1);
+}
+
+bool read_dds10_header(const char* data, size_t size, Dds10Header& header) noexcept {
+    if (size < DDS10_HEADER_SIZE || std::memcmp(data, "DDS ", 4) != 0 || std::memcmp(data + 84, "DX10", 4) != 0) {
+        return false;
+    }
+
+    header.height = read_32(data, 12);
+    header.width = read_32(data, 16);
+    header.level_count = std::max(read_32(data, 28), 1U);
+    header.dxgi_format = read_32(data, 128);
+    header.dimension = read_32(data, 132);
+    header.misc_flags = read_32(data, 136);
+    header.array_size = std::max(read_32(data, 140), 1U);
+    return true;
+}
+
+const TextureFormatSize* find_texture_format_size(uint32_t dxgi_format, uint32_t vk_format) noexcept {
+    for (const TextureFormatSize& format : TEXTURE_FORMAT_SIZES) {
+        if (format.dxgi_format == dxgi_format && (dxgi_format != DXGI_FORMAT_UNKNOWN || format.vk_format == vk_format)) {
+            return &format;
+        }
+    }
+    return nullptr;
+}
+
+size_t get_image_size(size_t width, size_t height, uint32_t block_size, bool is_block_compressed) noexcept {
+    if (is_block_compressed) {
+        return (width + 3) / 4 * ((height + 3) / 4) * block_size;
+    }
+    return width * height * block_size;
+}
+
+std::vector<DdsLevel> get_dds_levels(uint32_t width, uint32_t height, uint32_t level_count, uint32_t layer_count, uint32_t block_size, bool is_block_compressed) {
+    std::vector<DdsLevel> levels;
+    levels.reserve(static_cast<size_t>(level_count) * layer_count);
+
+    size_t offset = DDS10_HEADER_SIZE;
+    for (uint32_t layer = 0; layer < layer_count; layer++) {
+        for (uint32_t mip_level = 0; mip_level < level_count; mip_level++) {
+            const size_t level_width = std::max(width >> mip_level, 1U);
+            const size_t level_height = std::max(height >> mip_level, 1U);
+            const size_t size = get_image_size(level_width, level_height, block_size, is_block_compressed);
+            levels.push_back(DdsLevel { layer, mip_level, level_width, level_height, offset, size });
+            offset += size;
+        }
+    }
+    return levels;
+}
+
+size_t get_dds_size(const std::vector<DdsLevel>& levels) noexcept {
+    return levels.empty() ? DDS10_HEADER_SIZE : levels.back().offset + levels.back().size;
+}
+
+EncodedLayout get_encoded_layout(const Dds10Header& header, uint32_t pixel_size, uint32_t block_size) {
+    const uint32_t layer_count = header.get_layer_count();
+    const std::vector<DdsLevel> inputs = get_dds_levels(header.width, header.height, header.level_count, layer_count, pixel_size, false);
+    const std::vector<DdsLevel> outputs = get_dds_levels(header.width, header.height, header.level_count, layer_count, block_size, true);
+
+    EncodedLayout layout;
+    layout.levels.reserve(inputs.size());
+    layout.input_size = get_dds_size(inputs);
+    layout.output_size = get_dds_size(outputs);
+    layout.block_count = 0;
+    for (size_t i = 0; i < inputs.size(); i++) {
+        layout.levels.push_back(EncodedLevel { inputs[i], outputs[i], layout.block_count });
+        layout.block_count += get_block_count(outputs[i]);
+    }
+    return layout;
+}
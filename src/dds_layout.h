@@ -0,0 +1,110 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+// Layout of the DDS textures the compiler writes and reads back, shared by the built-in encoders, which replace the
+// levels of an uncompressed texture nvtt wrote with their blocks, the containers and tools that repackage outputs and
+// the reports that read them. Every texture has the DX10 header, followed by the mip levels of the first layer from
+// the largest to the smallest, then the mip levels of the next layer and so on. Cube maps have six layers per element
+// of the array.
+
+// Magic and `DDS_HEADER`, followed by `DDS_HEADER_DXT10` in textures with the DX10 header.
+static constexpr size_t DDS_HEADER_SIZE = 4 + 124;
+static constexpr size_t DDS10_HEADER_SIZE = DDS_HEADER_SIZE + 20;
+
+static constexpr uint32_t DDS10_DIMENSION_TEXTURE_2D = 3;
+static constexpr uint32_t DDS10_MISC_TEXTURECUBE = 4;
+
+// Uncompressed formats nvtt writes for the built-in encoders, and the format of the textures they encode, whose blocks
+// have no DXGI format and are described by a Vulkan format in KTX2.
+static constexpr uint32_t DXGI_FORMAT_UNKNOWN = 0;
+static constexpr uint32_t DXGI_FORMAT_R8_UNORM = 61;
+static constexpr uint32_t DXGI_FORMAT_B8G8R8A8_UNORM = 87;
+
+// Little endian 32-bit field of a header.
+inline uint32_t read_32(const char* data, size_t offset) noexcept {
+    uint32_t result;
+    std::memcpy(&result, data + offset, sizeof(result));
+    return result;
+}
+
+inline uint32_t read_32(const std::vector<char>& data, size_t offset) noexcept {
+    return read_32(data.data(), offset);
+}
+
+// Fields of the DX10 header. Textures without mip levels or layers have one of each.
+struct Dds10Header final {
+    uint32_t width = 0;
+    uint32_t height = 0;
+    uint32_t level_count = 1;
+    uint32_t array_size = 1;
+    uint32_t dxgi_format = DXGI_FORMAT_UNKNOWN;
+    uint32_t dimension = 0;
+    uint32_t misc_flags = 0;
+
+    bool is_cube_map() const noexcept;
+
+    // Layers in the file, six per element of a cube map array.
+    uint32_t get_layer_count() const noexcept;
+};
+
+// Reads the header of the `size` bytes at `data`. Returns false unless they start with a whole DX10 header.
+bool read_dds10_header(const char* data, size_t size, Dds10Header& header) noexcept;
+
+// Size of the texels of a format the compiler writes: bytes per 4x4 block of block compressed formats, bytes per pixel
+// of the other ones. Formats DDS can't describe have `DXGI_FORMAT_UNKNOWN` and are told apart by their Vulkan format.
+struct TextureFormatSize final {
+    uint32_t dxgi_format;
+    uint32_t vk_format;
+    uint32_t block_size;
+    bool is_block_compressed;
+};
+
+// Size of a DXGI format, or of a Vulkan format for `DXGI_FORMAT_UNKNOWN`. Null for formats the compiler doesn't write.
+const TextureFormatSize* find_texture_format_size(uint32_t dxgi_format, uint32_t vk_format = 0) noexcept;
+
+// Bytes of a `width` x `height` image in a format of `block_size` bytes per 4x4 block or per pixel.
+size_t get_image_size(size_t width, size_t height, uint32_t block_size, bool is_block_compressed) noexcept;
+
+// Mip level of a layer and where it is in the file.
+struct DdsLevel final {
+    uint32_t layer;
+    uint32_t mip_level;
+    size_t width;
+    size_t height;
+    size_t offset;
+    size_t size;
+};
+
+// Every mip level of every layer in the order of the file, tightly packed after the DX10 header, in a format of
+// `block_size` bytes per 4x4 block or per pixel. The file is `get_dds_size` bytes.
+std::vector<DdsLevel> get_dds_levels(uint32_t width, uint32_t height, uint32_t level_count, uint32_t layer_count, uint32_t block_size, bool is_block_compressed);
+
+size_t get_dds_size(const std::vector<DdsLevel>& levels) noexcept;
+
+// 4x4 blocks of a mip level, every built-in encoder writes one per block whatever its format.
+inline size_t get_block_count(const DdsLevel& level) noexcept {
+    return (level.width + 3) / 4 * ((level.height + 3) / 4);
+}
+
+// Mip level of an uncompressed texture a built-in encoder replaces with blocks, where it is in the texture and in the
+// encoded one, and the index of its first block among the blocks of every mip level of every layer.
+struct EncodedLevel final {
+    DdsLevel input;
+    DdsLevel output;
+    size_t first_block;
+};
+
+// Levels of a texture of `pixel_size` bytes per pixel encoded to blocks of `block_size` bytes, with the sizes of both
+// textures and the number of blocks of all the levels.
+struct EncodedLayout final {
+    std::vector<EncodedLevel> levels;
+    size_t input_size;
+    size_t output_size;
+    size_t block_count;
+};
+
+EncodedLayout get_encoded_layout(const Dds10Header& header, uint32_t pixel_size, uint32_t block_size);
@@ -0,0 +1,587 @@
+#include "distributed.h"
+
+#include <algorithm>
+#include <bx/platform.h>
+#include <cerrno>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <thread>
+
+#if BX_PLATFORM_WINDOWS
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#else
+#include <netdb.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+static constexpr const char* PROTOCOL_HELLO = "hello texture.compiler 1";
+
+// Sends to a dead peer must fail rather than wait forever or raise `SIGPIPE`.
+static const int SEND_TIMEOUT_MS = 10000;
+
+// Workers started before the coordinator keep trying to connect for this long.
+static constexpr std::chrono::seconds CONNECT_RETRY_TIME(60);
+static constexpr std::chrono::seconds CONNECT_RETRY_INTERVAL(1);
+
+// Jobs that have run for longer than this once the queue is empty are copied to idle workers.
+static constexpr std::chrono::seconds SPECULATIVE_DELAY(10);
+
+// A job fails once it failed on this many workers.
+static constexpr size_t MAX_ATTEMPTS = 2;
+
+static constexpr size_t NO_JOB = SIZE_MAX;
+
+#if BX_PLATFORM_WINDOWS
+using Socket = SOCKET;
+static const Socket INVALID_SOCKET_HANDLE = INVALID_SOCKET;
+
+static void close_socket(Socket socket) noexcept {
+    closesocket(socket);
+}
+
+static int poll_sockets(pollfd* descriptors, size_t count, int milliseconds) noexcept {
+    return WSAPoll(descriptors, static_cast<ULONG>(count), milliseconds);
+}
+
+static const int SEND_FLAGS = 0;
+#else
+using Socket = int;
+static const Socket INVALID_SOCKET_HANDLE = -1;
+
+static void close_socket(Socket socket) noexcept {
+    close(socket);
+}
+
+static int poll_sockets(pollfd* descriptors, size_t count, int milliseconds) noexcept {
+    return poll(descriptors, static_cast<nfds_t>(count), milliseconds);
+}
+
+#if defined(MSG_NOSIGNAL)
+static const int SEND_FLAGS = MSG_NOSIGNAL;
+#else
+static const int SEND_FLAGS = 0;
+#endif
+#endif
+
+namespace {
+
+// Windows sockets must be initialized by every user, the other platforms have nothing to do.
+struct SocketLibrary final {
+    SocketLibrary() noexcept {
+#if BX_PLATFORM_WINDOWS
+        WSADATA data;
+        is_initialized = WSAStartup(MAKEWORD(2, 2), &data) == 0;
+#endif
+    }
+
+    SocketLibrary(const SocketLibrary&) = delete;
+    SocketLibrary(SocketLibrary&&) = delete;
+    SocketLibrary& operator=(const SocketLibrary&) = delete;
+    SocketLibrary& operator=(SocketLibrary&&) = delete;
+
+    ~SocketLibrary() {
+#if BX_PLATFORM_WINDOWS
+        if (is_initialized) {
+            WSACleanup();
+        }
+#endif
+    }
+
+#if BX_PLATFORM_WINDOWS
+    bool is_initialized = false;
+#endif
+};
+
+struct SocketWrapper final {
+    explicit SocketWrapper(Socket socket) noexcept
+            : socket(socket) {
+    }
+
+    SocketWrapper(const SocketWrapper&) = delete;
+    SocketWrapper(SocketWrapper&&) = delete;
+    SocketWrapper& operator=(const SocketWrapper&) = delete;
+    SocketWrapper& operator=(SocketWrapper&&) = delete;
+
+    ~SocketWrapper() {
+        if (socket != INVALID_SOCKET_HANDLE) {
+            close_socket(socket);
+        }
+    }
+
+    Socket socket;
+};
+
+struct AddressWrapper final {
+    AddressWrapper() noexcept = default;
+
+    AddressWrapper(const AddressWrapper&) = delete;
+    AddressWrapper(AddressWrapper&&) = delete;
+    AddressWrapper& operator=(const AddressWrapper&) = delete;
+    AddressWrapper& operator=(AddressWrapper&&) = delete;
+
+    ~AddressWrapper() {
+        if (address != nullptr) {
+            freeaddrinfo(address);
+        }
+    }
+
+    addrinfo* address = nullptr;
+};
+
+// Worker connected to the coordinator.
+struct WorkerConnection final {
+    explicit WorkerConnection(Socket socket) noexcept
+            : socket(socket) {
+    }
+
+    WorkerConnection(const WorkerConnection&) = delete;
+    WorkerConnection(WorkerConnection&&) = delete;
+    WorkerConnection& operator=(const WorkerConnection&) = delete;
+    WorkerConnection& operator=(WorkerConnection&&) = delete;
+
+    SocketWrapper socket;
+
+    // Received bytes after the last complete line.
+    std::string buffer;
+
+    // Empty until the worker says hello.
+    std::string name;
+
+    size_t job = NO_JOB;
+    bool is_closed = false;
+};
+
+struct JobState final {
+    // Workers compiling a copy of the job right now.
+    size_t copies = 0;
+    size_t failures = 0;
+    bool is_done = false;
+
+    // Workers that disconnected while they compiled the job, crashed on it as likely as not.
+    size_t disconnects = 0;
+
+    // Workers that failed the job, which never get it again.
+    std::vector<std::string> failed_workers;
+
+    // Start of the first copy that is still running.
+    std::chrono::steady_clock::time_point start;
+};
+
+} // namespace
+
+static bool set_send_timeout(Socket socket) noexcept {
+#if BX_PLATFORM_WINDOWS
+    const DWORD timeout = static_cast<DWORD>(SEND_TIMEOUT_MS);
+#else
+    const timeval timeout { SEND_TIMEOUT_MS / 1000, (SEND_TIMEOUT_MS % 1000) * 1000 };
+#endif
+    return setsockopt(socket, SOL_SOCKET, SO_SNDTIMEO, reinterpret_cast<const char*>(&timeout), sizeof(timeout)) == 0;
+}
+
+static bool send_line(Socket socket, const std::string& line) noexcept {
+    try {
+        const std::string data = line + "\n";
+        const char* begin = data.data();
+        size_t size = data.size();
+        while (size > 0) {
+            const auto sent = send(socket, begin, static_cast<int>(std::min(size, static_cast<size_t>(1 << 20))), SEND_FLAGS);
+            if (sent <= 0) {
+                return false;
+            }
+            begin += sent;
+            size -= static_cast<size_t>(sent);
+        }
+        return true;
+    } catch (const std::exception&) {
+        return false;
+    }
+}
+
+// Receives whatever is available into `buffer`. Returns false once the peer is gone.
+static bool receive_some(Socket socket, std::string& buffer) {
+    char data[4096];
+    const auto received = recv(socket, data, sizeof(data), 0);
+    if (received <= 0) {
+        return false;
+    }
+    buffer.append(data, static_cast<size_t>(received));
+    return true;
+}
+
+// Takes the first complete line out of `buffer`, without the line break.
+static bool take_line(std::string& buffer, std::string& line) {
+    const size_t end = buffer.find('\n');
+    if (end == std::string::npos) {
+        return false;
+    }
+    line.assign(buffer, 0, end > 0 && buffer[end - 1] == '\r' ? end - 1 : end);
+    buffer.erase(0, end + 1);
+    return true;
+}
+
+// Blocking read of a whole line for the worker, which has nothing else to do while it waits.
+static bool receive_line(Socket socket, std::string& buffer, std::string& line) {
+    while (!take_line(buffer, line)) {
+        if (!receive_some(socket, buffer)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static Socket listen_on(uint16_t port) noexcept {
+    const Socket socket = ::socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    if (socket == INVALID_SOCKET_HANDLE) {
+        return INVALID_SOCKET_HANDLE;
+    }
+
+    // A coordinator restarted right after the previous build must not wait for the old port to time out.
+    const int reuse = 1;
+    setsockopt(socket, SOL_SOCKET, SO_REUSEADDR, reinterpret_cast<const char*>(&reuse), sizeof(reuse));
+
+    sockaddr_in address {};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_ANY);
+    address.sin_port = htons(port);
+    if (bind(socket, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0 || listen(socket, SOMAXCONN) != 0) {
+        close_socket(socket);
+        return INVALID_SOCKET_HANDLE;
+    }
+    return socket;
+}
+
+// Picks the next job for a worker: the first queued job the worker didn't fail, or once the queue is empty, a copy of
+// the job that has run the longest, when it has run for long enough.
+static size_t pick_job(std::deque<size_t>& queue, std::vector<JobState>& states, const std::string& worker) {
+    const auto is_failed_by_worker = [&](size_t job) {
+        const std::vector<std::string>& failed = states[job].failed_workers;
+        return std::find(failed.begin(), failed.end(), worker) != failed.end();
+    };
+
+    for (auto it = queue.begin(); it != queue.end(); ++it) {
+        if (!is_failed_by_worker(*it)) {
+            const size_t job = *it;
+            queue.erase(it);
+            return job;
+        }
+    }
+
+    if (!queue.empty()) {
+        return NO_JOB;
+    }
+
+    const auto now = std::chrono::steady_clock::now();
+    size_t result = NO_JOB;
+    for (size_t job = 0; job < states.size(); job++) {
+        const JobState& state = states[job];
+        if (!state.is_done && state.copies == 1 && now - state.start >= SPECULATIVE_DELAY && !is_failed_by_worker(job) &&
+            (result == NO_JOB || state.start < states[result].start)) {
+            result = job;
+        }
+    }
+    return result;
+}
+
+bool run_coordinator(uint16_t port, const std::vector<CoordinatorJob>& jobs, const std::vector<size_t>& order, std::vector<bool>& is_failed, std::ostream& log,
+                     const std::function<void(uint16_t port)>& on_listening, const std::function<bool()>& is_abandoned) {
+    const SocketLibrary library;
+
+    SocketWrapper listener(listen_on(port));
+    if (listener.socket == INVALID_SOCKET_HANDLE) {
+        log << "Texture compiler error. Failed to listen for workers on port " << port << "." << std::endl;
+        return false;
+    }
+
+    sockaddr_in address {};
+    socklen_t address_size = sizeof(address);
+    if (getsockname(listener.socket, reinterpret_cast<sockaddr*>(&address), &address_size) == 0) {
+        port = ntohs(address.sin_port);
+    }
+
+    log << "Coordinator is waiting for workers on port " << port << "." << std::endl;
+    if (on_listening) {
+        on_listening(port);
+    }
+
+    std::vector<JobState> states(jobs.size());
+    std::deque<size_t> queue(order.begin(), order.end());
+    std::vector<std::unique_ptr<WorkerConnection>> workers;
+    is_failed.assign(jobs.size(), false);
+
+    size_t done_jobs = 0;
+    const auto finish_copy = [&](WorkerConnection& worker) {
+        JobState& state = states[worker.job];
+        state.copies--;
+        worker.job = NO_JOB;
+        return &state;
+    };
+
+    // Returns the job of a worker that is gone to the front of the queue, unless another copy is still running. A job
+    // that every worker compiling it crashes on would otherwise take down the whole pool, one worker at a time.
+    const auto close_worker = [&](WorkerConnection& worker) {
+        if (worker.job != NO_JOB) {
+            const size_t job = worker.job;
+            JobState* state = finish_copy(worker);
+            state->disconnects++;
+            if (state->is_done || state->copies != 0) {
+                // Another copy finished or is still running.
+            } else if (state->disconnects >= MAX_ATTEMPTS) {
+                state->is_done = true;
+                is_failed[job] = true;
+                done_jobs++;
+                log << "\rJob " << job + 1 << "/" << jobs.size() << ": " << jobs[job].description << " failed, " << state->disconnects
+                    << " workers disconnected while they compiled it." << std::endl;
+            } else {
+                log << "\rTexture compiler warning. Worker " << worker.name << " disconnected, job " << job + 1 << " is queued again." << std::endl;
+                queue.push_front(job);
+            }
+        }
+        worker.is_closed = true;
+    };
+
+    const auto handle_line = [&](WorkerConnection& worker, const std::string& line) {
+        if (worker.name.empty()) {
+            if (line.compare(0, std::strlen(PROTOCOL_HELLO), PROTOCOL_HELLO) != 0) {
+                log << "\rTexture compiler warning. Dropped a connection that is not a worker of this version." << std::endl;
+                worker.is_closed = true;
+                return;
+            }
+            worker.name = line.size() > std::strlen(PROTOCOL_HELLO) + 1 ? line.substr(std::strlen(PROTOCOL_HELLO) + 1) : "unnamed";
+            log << "Worker " << worker.name << " connected." << std::endl;
+            return;
+        }
+
+        char* end = nullptr;
+        const size_t job = line.compare(0, 5, "done ") == 0 ? std::strtoull(line.c_str() + 5, &end, 10) : NO_JOB;
+        if (end == nullptr || end == line.c_str() + 5 || job != worker.job) {
+            log << "\rTexture compiler warning. Worker " << worker.name << " sent an unexpected line and is dropped." << std::endl;
+            close_worker(worker);
+            return;
+        }
+
+        const bool is_ok = std::strncmp(end, " ok", 3) == 0;
+        JobState* state = finish_copy(worker);
+        if (state->is_done) {
+            // Another copy finished first.
+            return;
+        }
+
+        if (is_ok) {
+            state->is_done = true;
+            done_jobs++;
+            log << "Job " << job + 1 << "/" << jobs.size() << ": " << jobs[job].description << " on " << worker.name << ":" << end + 3 << " seconds." << std::endl;
+            return;
+        }
+
+        state->failures++;
+        state->failed_workers.push_back(worker.name);
+
+        // Waiting for another worker only makes sense when one is connected.
+        const bool has_other_worker = std::any_of(workers.begin(), workers.end(), [&](const std::unique_ptr<WorkerConnection>& other) {
+            return !other->is_closed && !other->name.empty() &&
+                   std::find(state->failed_workers.begin(), state->failed_workers.end(), other->name) == state->failed_workers.end();
+        });
+        if (state->failures >= MAX_ATTEMPTS || !has_other_worker) {
+            state->is_done = true;
+            is_failed[job] = true;
+            done_jobs++;
+            log << "Job " << job + 1 << "/" << jobs.size() << ": " << jobs[job].description << " failed on " << worker.name << ", see its output." << std::endl;
+        } else if (state->copies == 0) {
+            log << "\rTexture compiler warning. Job " << job + 1 << " failed on " << worker.name << " and is queued for another worker." << std::endl;
+            queue.push_front(job);
+        }
+    };
+
+    while (done_jobs < jobs.size()) {
+        if (is_abandoned && is_abandoned()) {
+            log << "Texture compiler error. Every worker exited before the manifest was compiled." << std::endl;
+            return false;
+        }
+
+        // Idle workers get a job as soon as there's one for them.
+        for (const std::unique_ptr<WorkerConnection>& worker : workers) {
+            if (worker->is_closed || worker->name.empty() || worker->job != NO_JOB) {
+                continue;
+            }
+
+            const size_t job = pick_job(queue, states, worker->name);
+            if (job == NO_JOB) {
+                continue;
+            }
+
+            JobState& state = states[job];
+            if (state.copies == 0) {
+                state.start = std::chrono::steady_clock::now();
+            }
+            state.copies++;
+            worker->job = job;
+            if (!send_line(worker->socket.socket, "job " + std::to_string(job) + " " + jobs[job].line)) {
+                close_worker(*worker);
+            }
+        }
+
+        workers.erase(std::remove_if(workers.begin(), workers.end(),
+                                     [](const std::unique_ptr<WorkerConnection>& worker) {
+                                         return worker->is_closed;
+                                     }),
+                      workers.end());
+
+        std::vector<pollfd> descriptors(workers.size() + 1);
+        descriptors[0].fd = listener.socket;
+        descriptors[0].events = POLLIN;
+        for (size_t i = 0; i < workers.size(); i++) {
+            descriptors[i + 1].fd = workers[i]->socket.socket;
+            descriptors[i + 1].events = POLLIN;
+        }
+
+        // Wakes up now and then for copies of jobs that have run for long.
+        if (poll_sockets(descriptors.data(), descriptors.size(), 1000) < 0) {
+#if !BX_PLATFORM_WINDOWS
+            if (errno == EINTR) {
+                continue;
+            }
+#endif
+            log << "Texture compiler error. Failed to wait for workers." << std::endl;
+            return false;
+        }
+
+        for (size_t i = 0; i < workers.size(); i++) {
+            if ((descriptors[i + 1].revents & (POLLIN | POLLHUP | POLLERR)) == 0) {
+                continue;
+            }
+
+            WorkerConnection& worker = *workers[i];
+            if (!receive_some(worker.socket.socket, worker.buffer)) {
+                close_worker(worker);
+                continue;
+            }
+
+            std::string line;
+            while (!worker.is_closed && take_line(worker.buffer, line)) {
+                handle_line(worker, line);
+            }
+        }
+
+        if ((descriptors[0].revents & POLLIN) != 0) {
+            const Socket socket = accept(listener.socket, nullptr, nullptr);
+            if (socket != INVALID_SOCKET_HANDLE) {
+                set_send_timeout(socket);
+                workers.push_back(std::make_unique<WorkerConnection>(socket));
+            }
+        }
+    }
+
+    // Workers still compiling a losing copy read `quit` after they report it.
+    for (const std::unique_ptr<WorkerConnection>& worker : workers) {
+        send_line(worker->socket.socket, "quit");
+    }
+    return true;
+}
+
+static Socket connect_to(const std::string& host, const std::string& port) noexcept {
+    addrinfo hints {};
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+
+    AddressWrapper addresses;
+    if (getaddrinfo(host.c_str(), port.c_str(), &hints, &addresses.address) != 0) {
+        return INVALID_SOCKET_HANDLE;
+    }
+
+    for (const addrinfo* address = addresses.address; address != nullptr; address = address->ai_next) {
+        const Socket socket = ::socket(address->ai_family, address->ai_socktype, address->ai_protocol);
+        if (socket == INVALID_SOCKET_HANDLE) {
+            continue;
+        }
+        if (connect(socket, address->ai_addr, static_cast<int>(address->ai_addrlen)) == 0) {
+            return socket;
+        }
+        close_socket(socket);
+    }
+    return INVALID_SOCKET_HANDLE;
+}
+
+// Host name and process identifier, so several workers on one node are told apart.
+static std::string get_worker_name() {
+    char host[256] = {};
+    if (gethostname(host, sizeof(host) - 1) != 0 || host[0] == '\0') {
+        std::strcpy(host, "unknown");
+    }
+#if BX_PLATFORM_WINDOWS
+    return std::string(host) + "/" + std::to_string(GetCurrentProcessId());
+#else
+    return std::string(host) + "/" + std::to_string(getpid());
+#endif
+}
+
+bool run_worker(const std::string& address, const std::function<bool(size_t index, const std::string& line)>& compile_line, std::ostream& log) {
+    // IPv6 addresses keep their colons, the port is after the last one.
+    const size_t colon = address.rfind(':');
+    if (colon == std::string::npos || colon == 0 || colon + 1 == address.size()) {
+        log << "Texture compiler error. Command line argument --worker must be host:port." << std::endl;
+        return false;
+    }
+
+    std::string host = address.substr(0, colon);
+    if (host.size() > 2 && host.front() == '[' && host.back() == ']') {
+        host = host.substr(1, host.size() - 2);
+    }
+    const std::string port = address.substr(colon + 1);
+
+    const SocketLibrary library;
+
+    const auto give_up = std::chrono::steady_clock::now() + CONNECT_RETRY_TIME;
+    SocketWrapper socket(connect_to(host, port));
+    while (socket.socket == INVALID_SOCKET_HANDLE && std::chrono::steady_clock::now() < give_up) {
+        std::this_thread::sleep_for(CONNECT_RETRY_INTERVAL);
+        socket.socket = connect_to(host, port);
+    }
+    if (socket.socket == INVALID_SOCKET_HANDLE) {
+        log << "Texture compiler error. Failed to connect to the coordinator at " << address << "." << std::endl;
+        return false;
+    }
+
+    set_send_timeout(socket.socket);
+    if (!send_line(socket.socket, std::string(PROTOCOL_HELLO) + " " + get_worker_name())) {
+        log << "Texture compiler error. Failed to greet the coordinator at " << address << "." << std::endl;
+        return false;
+    }
+
+    log << "Worker is connected to the coordinator at " << address << "." << std::endl;
+
+    std::string buffer;
+    std::string line;
+    while (receive_line(socket.socket, buffer, line)) {
+        if (line == "quit") {
+            return true;
+        }
+
+        char* end = nullptr;
+        const size_t index = line.compare(0, 4, "job ") == 0 ? std::strtoull(line.c_str() + 4, &end, 10) : NO_JOB;
+        if (end == nullptr || *end != ' ') {
+            log << "Texture compiler error. Coordinator sent an unexpected line." << std::endl;
+            return false;
+        }
+
+        const auto before = std::chrono::steady_clock::now();
+        const bool is_compiled = compile_line(index, end + 1);
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - before).count();
+
+        std::string result = "done " + std::to_string(index);
+        result += is_compiled ? " ok " + std::to_string(seconds) : " failed";
+        if (!send_line(socket.socket, result)) {
+            // The coordinator is done already when the last copy loses.
+            return true;
+        }
+    }
+
+    // The coordinator closes the connection when it's done with a worker that's still compiling a losing copy.
+    return true;
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// Manifest jobs of `--coordinator` are compiled by `--worker` processes on other build nodes. Inputs are read and
+// outputs are written by the workers at the paths of the manifest, so they must be on storage every node shares, and
+// compiled blobs reach the coordinator through the shared cache. Workers connect over TCP and talk in lines:
+//
+//   worker       `hello texture.compiler 1 <name>` once connected.
+//   coordinator  `job <index> <manifest line>` or `quit` when every job is done.
+//   worker       `done <index> ok <seconds>` or `done <index> failed` once the job is compiled, which is answered with
+//                the next job.
+//
+// A job of a worker that disconnects goes back to the queue, a job that fails is tried once more on another worker,
+// since a node that misses a share fails every job. A job whose second worker disconnects while compiling it fails
+// too, since it most likely crashes them. Once the queue is empty, idle workers also compile copies of jobs
+// that have run for long on a slow node, and the first copy to finish wins. Outputs are written atomically, so the
+// copy that loses only wastes the time of a node that had nothing else to do.
+struct CoordinatorJob final {
+    // Manifest line of the job, sent to workers as it is.
+    std::string line;
+
+    // Printed with the result of the job.
+    std::string description;
+};
+
+// Hands `jobs` out to workers connecting to `port` in the order of `order` until every job is done. `is_failed` tells
+// which jobs failed on every worker they were tried on. Zero `port` listens on any free port. `on_listening` is called
+// with the port once workers can connect, and `is_abandoned` is polled about every second, the coordinator gives up
+// when it returns true, for example when every worker it started itself has exited. Returns false when the port can't
+// be listened on or the coordinator gave up.
+bool run_coordinator(uint16_t port, const std::vector<CoordinatorJob>& jobs, const std::vector<size_t>& order, std::vector<bool>& is_failed, std::ostream& log,
+                     const std::function<void(uint16_t port)>& on_listening = {}, const std::function<bool()>& is_abandoned = {});
+
+// Connects to the coordinator at `address`, `host:port`, and compiles the manifest lines it sends with `compile_line`,
+// which returns true when the job is compiled, until the coordinator has no more jobs. Connecting is retried for
+// a minute, so workers may start before the coordinator. Returns false when the coordinator is never reached or
+// breaks the protocol.
+bool run_worker(const std::string& address, const std::function<bool(size_t index, const std::string& line)>& compile_line, std::ostream& log);
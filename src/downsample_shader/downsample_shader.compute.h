@@ -0,0 +1,1368 @@
+#include <cstdint>
+
+static const uint8_t downsample_shader_compute_glsl[3710] =
+{
+	0x43, 0x53, 0x48, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6b, 0x0e, // CSH...........k.
+	0x00, 0x00, 0x23, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x34, 0x33, 0x30, 0x0a, 0x76, // ..#version 430.v
+	0x65, 0x63, 0x33, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x4d, 0x75, 0x6c, 0x28, 0x76, 0x65, 0x63, 0x33, // ec3 instMul(vec3
+	0x20, 0x5f, 0x76, 0x65, 0x63, 0x2c, 0x20, 0x6d, 0x61, 0x74, 0x33, 0x20, 0x5f, 0x6d, 0x74, 0x78, //  _vec, mat3 _mtx
+	0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x28, 0x20, 0x28, 0x5f, 0x76, // ) { return ( (_v
+	0x65, 0x63, 0x29, 0x20, 0x2a, 0x20, 0x28, 0x5f, 0x6d, 0x74, 0x78, 0x29, 0x20, 0x29, 0x3b, 0x20, // ec) * (_mtx) ); 
+	0x7d, 0x0a, 0x76, 0x65, 0x63, 0x33, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x4d, 0x75, 0x6c, 0x28, 0x6d, // }.vec3 instMul(m
+	0x61, 0x74, 0x33, 0x20, 0x5f, 0x6d, 0x74, 0x78, 0x2c, 0x20, 0x76, 0x65, 0x63, 0x33, 0x20, 0x5f, // at3 _mtx, vec3 _
+	0x76, 0x65, 0x63, 0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x28, 0x20, // vec) { return ( 
+	0x28, 0x5f, 0x6d, 0x74, 0x78, 0x29, 0x20, 0x2a, 0x20, 0x28, 0x5f, 0x76, 0x65, 0x63, 0x29, 0x20, // (_mtx) * (_vec) 
+	0x29, 0x3b, 0x20, 0x7d, 0x0a, 0x76, 0x65, 0x63, 0x34, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x4d, 0x75, // ); }.vec4 instMu
+	0x6c, 0x28, 0x76, 0x65, 0x63, 0x34, 0x20, 0x5f, 0x76, 0x65, 0x63, 0x2c, 0x20, 0x6d, 0x61, 0x74, // l(vec4 _vec, mat
+	0x34, 0x20, 0x5f, 0x6d, 0x74, 0x78, 0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, // 4 _mtx) { return
+	0x20, 0x28, 0x20, 0x28, 0x5f, 0x76, 0x65, 0x63, 0x29, 0x20, 0x2a, 0x20, 0x28, 0x5f, 0x6d, 0x74, //  ( (_vec) * (_mt
+	0x78, 0x29, 0x20, 0x29, 0x3b, 0x20, 0x7d, 0x0a, 0x76, 0x65, 0x63, 0x34, 0x20, 0x69, 0x6e, 0x73, // x) ); }.vec4 ins
+	0x74, 0x4d, 0x75, 0x6c, 0x28, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x5f, 0x6d, 0x74, 0x78, 0x2c, 0x20, // tMul(mat4 _mtx, 
+	0x76, 0x65, 0x63, 0x34, 0x20, 0x5f, 0x76, 0x65, 0x63, 0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, // vec4 _vec) { ret
+	0x75, 0x72, 0x6e, 0x20, 0x28, 0x20, 0x28, 0x5f, 0x6d, 0x74, 0x78, 0x29, 0x20, 0x2a, 0x20, 0x28, // urn ( (_mtx) * (
+	0x5f, 0x76, 0x65, 0x63, 0x29, 0x20, 0x29, 0x3b, 0x20, 0x7d, 0x0a, 0x66, 0x6c, 0x6f, 0x61, 0x74, // _vec) ); }.float
+	0x20, 0x72, 0x63, 0x70, 0x28, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x5f, 0x61, 0x29, 0x20, 0x7b, //  rcp(float _a) {
+	0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x31, 0x2e, 0x30, 0x2f, 0x5f, 0x61, 0x3b, 0x20, //  return 1.0/_a; 
+	0x7d, 0x0a, 0x76, 0x65, 0x63, 0x32, 0x20, 0x72, 0x63, 0x70, 0x28, 0x76, 0x65, 0x63, 0x32, 0x20, // }.vec2 rcp(vec2 
+	0x5f, 0x61, 0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x76, 0x65, 0x63, // _a) { return vec
+	0x32, 0x28, 0x31, 0x2e, 0x30, 0x29, 0x2f, 0x5f, 0x61, 0x3b, 0x20, 0x7d, 0x0a, 0x76, 0x65, 0x63, // 2(1.0)/_a; }.vec
+	0x33, 0x20, 0x72, 0x63, 0x70, 0x28, 0x76, 0x65, 0x63, 0x33, 0x20, 0x5f, 0x61, 0x29, 0x20, 0x7b, // 3 rcp(vec3 _a) {
+	0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x76, 0x65, 0x63, 0x33, 0x28, 0x31, 0x2e, 0x30, //  return vec3(1.0
+	0x29, 0x2f, 0x5f, 0x61, 0x3b, 0x20, 0x7d, 0x0a, 0x76, 0x65, 0x63, 0x34, 0x20, 0x72, 0x63, 0x70, // )/_a; }.vec4 rcp
+	0x28, 0x76, 0x65, 0x63, 0x34, 0x20, 0x5f, 0x61, 0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, // (vec4 _a) { retu
+	0x72, 0x6e, 0x20, 0x76, 0x65, 0x63, 0x34, 0x28, 0x31, 0x2e, 0x30, 0x29, 0x2f, 0x5f, 0x61, 0x3b, // rn vec4(1.0)/_a;
+	0x20, 0x7d, 0x0a, 0x76, 0x65, 0x63, 0x32, 0x20, 0x76, 0x65, 0x63, 0x32, 0x5f, 0x73, 0x70, 0x6c, //  }.vec2 vec2_spl
+	0x61, 0x74, 0x28, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x5f, 0x78, 0x29, 0x20, 0x7b, 0x20, 0x72, // at(float _x) { r
+	0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x76, 0x65, 0x63, 0x32, 0x28, 0x5f, 0x78, 0x2c, 0x20, 0x5f, // eturn vec2(_x, _
+	0x78, 0x29, 0x3b, 0x20, 0x7d, 0x0a, 0x76, 0x65, 0x63, 0x33, 0x20, 0x76, 0x65, 0x63, 0x33, 0x5f, // x); }.vec3 vec3_
+	0x73, 0x70, 0x6c, 0x61, 0x74, 0x28, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x5f, 0x78, 0x29, 0x20, // splat(float _x) 
+	0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x76, 0x65, 0x63, 0x33, 0x28, 0x5f, 0x78, // { return vec3(_x
+	0x2c, 0x20, 0x5f, 0x78, 0x2c, 0x20, 0x5f, 0x78, 0x29, 0x3b, 0x20, 0x7d, 0x0a, 0x76, 0x65, 0x63, // , _x, _x); }.vec
+	0x34, 0x20, 0x76, 0x65, 0x63, 0x34, 0x5f, 0x73, 0x70, 0x6c, 0x61, 0x74, 0x28, 0x66, 0x6c, 0x6f, // 4 vec4_splat(flo
+	0x61, 0x74, 0x20, 0x5f, 0x78, 0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, // at _x) { return 
+	0x76, 0x65, 0x63, 0x34, 0x28, 0x5f, 0x78, 0x2c, 0x20, 0x5f, 0x78, 0x2c, 0x20, 0x5f, 0x78, 0x2c, // vec4(_x, _x, _x,
+	0x20, 0x5f, 0x78, 0x29, 0x3b, 0x20, 0x7d, 0x0a, 0x75, 0x76, 0x65, 0x63, 0x32, 0x20, 0x75, 0x76, //  _x); }.uvec2 uv
+	0x65, 0x63, 0x32, 0x5f, 0x73, 0x70, 0x6c, 0x61, 0x74, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, // ec2_splat(uint _
+	0x78, 0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x75, 0x76, 0x65, 0x63, // x) { return uvec
+	0x32, 0x28, 0x5f, 0x78, 0x2c, 0x20, 0x5f, 0x78, 0x29, 0x3b, 0x20, 0x7d, 0x0a, 0x75, 0x76, 0x65, // 2(_x, _x); }.uve
+	0x63, 0x33, 0x20, 0x75, 0x76, 0x65, 0x63, 0x33, 0x5f, 0x73, 0x70, 0x6c, 0x61, 0x74, 0x28, 0x75, // c3 uvec3_splat(u
+	0x69, 0x6e, 0x74, 0x20, 0x5f, 0x78, 0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, // int _x) { return
+	0x20, 0x75, 0x76, 0x65, 0x63, 0x33, 0x28, 0x5f, 0x78, 0x2c, 0x20, 0x5f, 0x78, 0x2c, 0x20, 0x5f, //  uvec3(_x, _x, _
+	0x78, 0x29, 0x3b, 0x20, 0x7d, 0x0a, 0x75, 0x76, 0x65, 0x63, 0x34, 0x20, 0x75, 0x76, 0x65, 0x63, // x); }.uvec4 uvec
+	0x34, 0x5f, 0x73, 0x70, 0x6c, 0x61, 0x74, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x78, 0x29, // 4_splat(uint _x)
+	0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x75, 0x76, 0x65, 0x63, 0x34, 0x28, //  { return uvec4(
+	0x5f, 0x78, 0x2c, 0x20, 0x5f, 0x78, 0x2c, 0x20, 0x5f, 0x78, 0x2c, 0x20, 0x5f, 0x78, 0x29, 0x3b, // _x, _x, _x, _x);
+	0x20, 0x7d, 0x0a, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x6d, 0x74, 0x78, 0x46, 0x72, 0x6f, 0x6d, 0x52, //  }.mat4 mtxFromR
+	0x6f, 0x77, 0x73, 0x28, 0x76, 0x65, 0x63, 0x34, 0x20, 0x5f, 0x30, 0x2c, 0x20, 0x76, 0x65, 0x63, // ows(vec4 _0, vec
+	0x34, 0x20, 0x5f, 0x31, 0x2c, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x5f, 0x32, 0x2c, 0x20, 0x76, // 4 _1, vec4 _2, v
+	0x65, 0x63, 0x34, 0x20, 0x5f, 0x33, 0x29, 0x0a, 0x7b, 0x0a, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, // ec4 _3).{.return
+	0x20, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x70, 0x6f, 0x73, 0x65, 0x28, 0x6d, 0x61, 0x74, 0x34, 0x28, //  transpose(mat4(
+	0x5f, 0x30, 0x2c, 0x20, 0x5f, 0x31, 0x2c, 0x20, 0x5f, 0x32, 0x2c, 0x20, 0x5f, 0x33, 0x29, 0x20, // _0, _1, _2, _3) 
+	0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x6d, 0x74, 0x78, 0x46, 0x72, 0x6f, // );.}.mat4 mtxFro
+	0x6d, 0x43, 0x6f, 0x6c, 0x73, 0x28, 0x76, 0x65, 0x63, 0x34, 0x20, 0x5f, 0x30, 0x2c, 0x20, 0x76, // mCols(vec4 _0, v
+	0x65, 0x63, 0x34, 0x20, 0x5f, 0x31, 0x2c, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x5f, 0x32, 0x2c, // ec4 _1, vec4 _2,
+	0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x5f, 0x33, 0x29, 0x0a, 0x7b, 0x0a, 0x72, 0x65, 0x74, 0x75, //  vec4 _3).{.retu
+	0x72, 0x6e, 0x20, 0x6d, 0x61, 0x74, 0x34, 0x28, 0x5f, 0x30, 0x2c, 0x20, 0x5f, 0x31, 0x2c, 0x20, // rn mat4(_0, _1, 
+	0x5f, 0x32, 0x2c, 0x20, 0x5f, 0x33, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, // _2, _3);.}.unifo
+	0x72, 0x6d, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x75, 0x5f, 0x76, 0x69, 0x65, 0x77, 0x52, 0x65, // rm vec4 u_viewRe
+	0x63, 0x74, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x76, 0x65, 0x63, 0x34, // ct;.uniform vec4
+	0x20, 0x75, 0x5f, 0x76, 0x69, 0x65, 0x77, 0x54, 0x65, 0x78, 0x65, 0x6c, 0x3b, 0x0a, 0x75, 0x6e, //  u_viewTexel;.un
+	0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x75, 0x5f, 0x76, 0x69, 0x65, // iform mat4 u_vie
+	0x77, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x6d, 0x61, 0x74, 0x34, 0x20, // w;.uniform mat4 
+	0x75, 0x5f, 0x69, 0x6e, 0x76, 0x56, 0x69, 0x65, 0x77, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, // u_invView;.unifo
+	0x72, 0x6d, 0x20, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x75, 0x5f, 0x70, 0x72, 0x6f, 0x6a, 0x3b, 0x0a, // rm mat4 u_proj;.
+	0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x75, 0x5f, 0x69, // uniform mat4 u_i
+	0x6e, 0x76, 0x50, 0x72, 0x6f, 0x6a, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, // nvProj;.uniform 
+	0x6d, 0x61, 0x74, 0x34, 0x20, 0x75, 0x5f, 0x76, 0x69, 0x65, 0x77, 0x50, 0x72, 0x6f, 0x6a, 0x3b, // mat4 u_viewProj;
+	0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x75, 0x5f, // .uniform mat4 u_
+	0x69, 0x6e, 0x76, 0x56, 0x69, 0x65, 0x77, 0x50, 0x72, 0x6f, 0x6a, 0x3b, 0x0a, 0x75, 0x6e, 0x69, // invViewProj;.uni
+	0x66, 0x6f, 0x72, 0x6d, 0x20, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x75, 0x5f, 0x6d, 0x6f, 0x64, 0x65, // form mat4 u_mode
+	0x6c, 0x5b, 0x33, 0x32, 0x5d, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x6d, // l[32];.uniform m
+	0x61, 0x74, 0x34, 0x20, 0x75, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x56, 0x69, 0x65, 0x77, 0x3b, // at4 u_modelView;
+	0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x75, 0x5f, // .uniform mat4 u_
+	0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x56, 0x69, 0x65, 0x77, 0x50, 0x72, 0x6f, 0x6a, 0x3b, 0x0a, 0x75, // modelViewProj;.u
+	0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x75, 0x5f, 0x61, 0x6c, // niform vec4 u_al
+	0x70, 0x68, 0x61, 0x52, 0x65, 0x66, 0x34, 0x3b, 0x0a, 0x6c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x28, // phaRef4;.layout(
+	0x72, 0x67, 0x62, 0x61, 0x31, 0x36, 0x66, 0x2c, 0x20, 0x62, 0x69, 0x6e, 0x64, 0x69, 0x6e, 0x67, // rgba16f, binding
+	0x3d, 0x30, 0x29, 0x20, 0x72, 0x65, 0x61, 0x64, 0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x75, 0x6e, 0x69, // =0) readonly uni
+	0x66, 0x6f, 0x72, 0x6d, 0x20, 0x69, 0x6d, 0x61, 0x67, 0x65, 0x32, 0x44, 0x41, 0x72, 0x72, 0x61, // form image2DArra
+	0x79, 0x20, 0x73, 0x5f, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x3b, 0x0a, 0x6c, 0x61, 0x79, 0x6f, 0x75, // y s_input;.layou
+	0x74, 0x28, 0x72, 0x67, 0x62, 0x61, 0x31, 0x36, 0x66, 0x2c, 0x20, 0x62, 0x69, 0x6e, 0x64, 0x69, // t(rgba16f, bindi
+	0x6e, 0x67, 0x3d, 0x31, 0x29, 0x20, 0x77, 0x72, 0x69, 0x74, 0x65, 0x6f, 0x6e, 0x6c, 0x79, 0x20, // ng=1) writeonly 
+	0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x69, 0x6d, 0x61, 0x67, 0x65, 0x32, 0x44, 0x41, // uniform image2DA
+	0x72, 0x72, 0x61, 0x79, 0x20, 0x73, 0x5f, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x3b, 0x0a, 0x75, // rray s_output;.u
+	0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x75, 0x5f, 0x73, 0x65, // niform vec4 u_se
+	0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x3b, 0x0a, 0x76, 0x65, 0x63, 0x34, 0x20, 0x6c, 0x6f, 0x61, // ttings;.vec4 loa
+	0x64, 0x5f, 0x71, 0x75, 0x61, 0x64, 0x28, 0x69, 0x76, 0x65, 0x63, 0x32, 0x20, 0x74, 0x65, 0x78, // d_quad(ivec2 tex
+	0x65, 0x6c, 0x2c, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x66, 0x61, 0x63, 0x65, 0x29, 0x20, 0x7b, 0x0a, // el, int face) {.
+	0x69, 0x66, 0x20, 0x28, 0x75, 0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x7a, // if (u_settings.z
+	0x20, 0x21, 0x3d, 0x20, 0x30, 0x2e, 0x30, 0x29, 0x20, 0x7b, 0x0a, 0x72, 0x65, 0x74, 0x75, 0x72, //  != 0.0) {.retur
+	0x6e, 0x20, 0x69, 0x6d, 0x61, 0x67, 0x65, 0x4c, 0x6f, 0x61, 0x64, 0x28, 0x73, 0x5f, 0x69, 0x6e, // n imageLoad(s_in
+	0x70, 0x75, 0x74, 0x2c, 0x20, 0x69, 0x76, 0x65, 0x63, 0x33, 0x28, 0x74, 0x65, 0x78, 0x65, 0x6c, // put, ivec3(texel
+	0x2c, 0x20, 0x66, 0x61, 0x63, 0x65, 0x29, 0x29, 0x20, 0x2a, 0x20, 0x34, 0x2e, 0x30, 0x3b, 0x0a, // , face)) * 4.0;.
+	0x7d, 0x0a, 0x69, 0x6e, 0x74, 0x20, 0x6c, 0x61, 0x73, 0x74, 0x20, 0x3d, 0x20, 0x69, 0x6e, 0x74, // }.int last = int
+	0x28, 0x75, 0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x79, 0x29, 0x20, 0x2d, // (u_settings.y) -
+	0x20, 0x31, 0x3b, 0x0a, 0x69, 0x6e, 0x74, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x6d, 0x69, 0x6e, //  1;.int x0 = min
+	0x28, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x2e, 0x78, 0x20, 0x2a, 0x20, 0x32, 0x2c, 0x20, 0x6c, 0x61, // (texel.x * 2, la
+	0x73, 0x74, 0x29, 0x3b, 0x0a, 0x69, 0x6e, 0x74, 0x20, 0x78, 0x31, 0x20, 0x3d, 0x20, 0x6d, 0x69, // st);.int x1 = mi
+	0x6e, 0x28, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x2e, 0x78, 0x20, 0x2a, 0x20, 0x32, 0x20, 0x2b, 0x20, // n(texel.x * 2 + 
+	0x31, 0x2c, 0x20, 0x6c, 0x61, 0x73, 0x74, 0x29, 0x3b, 0x0a, 0x69, 0x6e, 0x74, 0x20, 0x79, 0x30, // 1, last);.int y0
+	0x20, 0x3d, 0x20, 0x6d, 0x69, 0x6e, 0x28, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x2e, 0x79, 0x20, 0x2a, //  = min(texel.y *
+	0x20, 0x32, 0x2c, 0x20, 0x6c, 0x61, 0x73, 0x74, 0x29, 0x3b, 0x0a, 0x69, 0x6e, 0x74, 0x20, 0x79, //  2, last);.int y
+	0x31, 0x20, 0x3d, 0x20, 0x6d, 0x69, 0x6e, 0x28, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x2e, 0x79, 0x20, // 1 = min(texel.y 
+	0x2a, 0x20, 0x32, 0x20, 0x2b, 0x20, 0x31, 0x2c, 0x20, 0x6c, 0x61, 0x73, 0x74, 0x29, 0x3b, 0x0a, // * 2 + 1, last);.
+	0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x69, 0x6d, 0x61, 0x67, 0x65, 0x4c, 0x6f, 0x61, 0x64, // return imageLoad
+	0x28, 0x73, 0x5f, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x2c, 0x20, 0x69, 0x76, 0x65, 0x63, 0x33, 0x28, // (s_input, ivec3(
+	0x78, 0x30, 0x2c, 0x20, 0x79, 0x30, 0x2c, 0x20, 0x66, 0x61, 0x63, 0x65, 0x29, 0x29, 0x20, 0x2b, // x0, y0, face)) +
+	0x20, 0x69, 0x6d, 0x61, 0x67, 0x65, 0x4c, 0x6f, 0x61, 0x64, 0x28, 0x73, 0x5f, 0x69, 0x6e, 0x70, //  imageLoad(s_inp
+	0x75, 0x74, 0x2c, 0x20, 0x69, 0x76, 0x65, 0x63, 0x33, 0x28, 0x78, 0x31, 0x2c, 0x20, 0x79, 0x30, // ut, ivec3(x1, y0
+	0x2c, 0x20, 0x66, 0x61, 0x63, 0x65, 0x29, 0x29, 0x20, 0x2b, 0x0a, 0x69, 0x6d, 0x61, 0x67, 0x65, // , face)) +.image
+	0x4c, 0x6f, 0x61, 0x64, 0x28, 0x73, 0x5f, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x2c, 0x20, 0x69, 0x76, // Load(s_input, iv
+	0x65, 0x63, 0x33, 0x28, 0x78, 0x30, 0x2c, 0x20, 0x79, 0x31, 0x2c, 0x20, 0x66, 0x61, 0x63, 0x65, // ec3(x0, y1, face
+	0x29, 0x29, 0x20, 0x2b, 0x20, 0x69, 0x6d, 0x61, 0x67, 0x65, 0x4c, 0x6f, 0x61, 0x64, 0x28, 0x73, // )) + imageLoad(s
+	0x5f, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x2c, 0x20, 0x69, 0x76, 0x65, 0x63, 0x33, 0x28, 0x78, 0x31, // _input, ivec3(x1
+	0x2c, 0x20, 0x79, 0x31, 0x2c, 0x20, 0x66, 0x61, 0x63, 0x65, 0x29, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, // , y1, face));.}.
+	0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x67, 0x65, 0x74, 0x5f, 0x63, 0x6f, 0x6f, 0x72, 0x64, 0x69, // float get_coordi
+	0x6e, 0x61, 0x74, 0x65, 0x28, 0x69, 0x6e, 0x74, 0x20, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x2c, 0x20, // nate(int texel, 
+	0x69, 0x6e, 0x74, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x29, 0x20, 0x7b, 0x0a, 0x69, 0x66, 0x20, 0x28, // int size) {.if (
+	0x74, 0x65, 0x78, 0x65, 0x6c, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x29, 0x20, 0x7b, 0x0a, 0x72, 0x65, // texel == 0) {.re
+	0x74, 0x75, 0x72, 0x6e, 0x20, 0x2d, 0x31, 0x2e, 0x30, 0x3b, 0x0a, 0x7d, 0x0a, 0x69, 0x66, 0x20, // turn -1.0;.}.if 
+	0x28, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x20, 0x3d, 0x3d, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x2d, // (texel == size -
+	0x20, 0x31, 0x29, 0x20, 0x7b, 0x0a, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x31, 0x2e, 0x30, //  1) {.return 1.0
+	0x3b, 0x0a, 0x7d, 0x0a, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x28, 0x66, 0x6c, 0x6f, 0x61, // ;.}.return (floa
+	0x74, 0x28, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x29, 0x20, 0x2b, 0x20, 0x30, 0x2e, 0x35, 0x29, 0x20, // t(texel) + 0.5) 
+	0x2f, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x29, 0x20, 0x2a, 0x20, // / float(size) * 
+	0x32, 0x2e, 0x30, 0x20, 0x2d, 0x20, 0x31, 0x2e, 0x30, 0x3b, 0x0a, 0x7d, 0x0a, 0x6c, 0x61, 0x79, // 2.0 - 1.0;.}.lay
+	0x6f, 0x75, 0x74, 0x20, 0x28, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x5f, // out (local_size_
+	0x78, 0x20, 0x3d, 0x20, 0x38, 0x2c, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x73, 0x69, 0x7a, // x = 8, local_siz
+	0x65, 0x5f, 0x79, 0x20, 0x3d, 0x20, 0x38, 0x2c, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x73, // e_y = 8, local_s
+	0x69, 0x7a, 0x65, 0x5f, 0x7a, 0x20, 0x3d, 0x20, 0x31, 0x29, 0x20, 0x69, 0x6e, 0x3b, 0x0a, 0x76, // ize_z = 1) in;.v
+	0x6f, 0x69, 0x64, 0x20, 0x6d, 0x61, 0x69, 0x6e, 0x28, 0x29, 0x20, 0x7b, 0x0a, 0x69, 0x76, 0x65, // oid main() {.ive
+	0x63, 0x33, 0x20, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x20, 0x3d, 0x20, 0x69, 0x76, 0x65, 0x63, 0x33, // c3 texel = ivec3
+	0x28, 0x67, 0x6c, 0x5f, 0x47, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x49, 0x6e, 0x76, 0x6f, 0x63, 0x61, // (gl_GlobalInvoca
+	0x74, 0x69, 0x6f, 0x6e, 0x49, 0x44, 0x29, 0x3b, 0x0a, 0x69, 0x66, 0x20, 0x28, 0x66, 0x6c, 0x6f, // tionID);.if (flo
+	0x61, 0x74, 0x28, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x2e, 0x78, 0x29, 0x20, 0x3e, 0x3d, 0x20, 0x75, // at(texel.x) >= u
+	0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x78, 0x20, 0x7c, 0x7c, 0x20, 0x66, // _settings.x || f
+	0x6c, 0x6f, 0x61, 0x74, 0x28, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x2e, 0x79, 0x29, 0x20, 0x3e, 0x3d, // loat(texel.y) >=
+	0x20, 0x75, 0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x78, 0x29, 0x20, 0x7b, //  u_settings.x) {
+	0x0a, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x3b, 0x0a, 0x7d, 0x0a, 0x69, 0x6e, 0x74, 0x20, 0x73, // .return;.}.int s
+	0x69, 0x7a, 0x65, 0x20, 0x3d, 0x20, 0x69, 0x6e, 0x74, 0x28, 0x75, 0x5f, 0x73, 0x65, 0x74, 0x74, // ize = int(u_sett
+	0x69, 0x6e, 0x67, 0x73, 0x2e, 0x78, 0x29, 0x3b, 0x0a, 0x76, 0x65, 0x63, 0x34, 0x20, 0x73, 0x75, // ings.x);.vec4 su
+	0x6d, 0x20, 0x3d, 0x20, 0x6c, 0x6f, 0x61, 0x64, 0x5f, 0x71, 0x75, 0x61, 0x64, 0x28, 0x74, 0x65, // m = load_quad(te
+	0x78, 0x65, 0x6c, 0x2e, 0x78, 0x79, 0x2c, 0x20, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x2e, 0x7a, 0x29, // xel.xy, texel.z)
+	0x3b, 0x0a, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x20, 0x3d, 0x20, // ;.float count = 
+	0x31, 0x2e, 0x30, 0x3b, 0x0a, 0x69, 0x66, 0x20, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x3d, 0x3d, // 1.0;.if (size ==
+	0x20, 0x31, 0x29, 0x20, 0x7b, 0x0a, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x69, 0x6e, 0x74, 0x20, 0x6f, //  1) {.for (int o
+	0x74, 0x68, 0x65, 0x72, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x20, // ther = 0; other 
+	0x3c, 0x20, 0x36, 0x3b, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x2b, 0x2b, 0x29, 0x20, 0x7b, 0x0a, // < 6; other++) {.
+	0x69, 0x66, 0x20, 0x28, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x21, 0x3d, 0x20, 0x74, 0x65, 0x78, // if (other != tex
+	0x65, 0x6c, 0x2e, 0x7a, 0x29, 0x20, 0x7b, 0x0a, 0x73, 0x75, 0x6d, 0x20, 0x2b, 0x3d, 0x20, 0x6c, // el.z) {.sum += l
+	0x6f, 0x61, 0x64, 0x5f, 0x71, 0x75, 0x61, 0x64, 0x28, 0x69, 0x76, 0x65, 0x63, 0x32, 0x28, 0x30, // oad_quad(ivec2(0
+	0x2c, 0x20, 0x30, 0x29, 0x2c, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, // , 0), other);.}.
+	0x7d, 0x0a, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x20, 0x3d, 0x20, 0x36, 0x2e, 0x30, 0x3b, 0x0a, 0x7d, // }.count = 6.0;.}
+	0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x69, 0x66, 0x20, 0x28, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x2e, //  else if (texel.
+	0x78, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x20, 0x7c, 0x7c, 0x20, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x2e, // x == 0 || texel.
+	0x79, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x20, 0x7c, 0x7c, 0x20, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x2e, // y == 0 || texel.
+	0x78, 0x20, 0x3d, 0x3d, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x2d, 0x20, 0x31, 0x20, 0x7c, 0x7c, // x == size - 1 ||
+	0x20, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x2e, 0x79, 0x20, 0x3d, 0x3d, 0x20, 0x73, 0x69, 0x7a, 0x65, //  texel.y == size
+	0x20, 0x2d, 0x20, 0x31, 0x29, 0x20, 0x7b, 0x0a, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x75, 0x20, //  - 1) {.float u 
+	0x3d, 0x20, 0x67, 0x65, 0x74, 0x5f, 0x63, 0x6f, 0x6f, 0x72, 0x64, 0x69, 0x6e, 0x61, 0x74, 0x65, // = get_coordinate
+	0x28, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x2e, 0x78, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x29, 0x3b, // (texel.x, size);
+	0x0a, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x76, 0x20, 0x3d, 0x20, 0x67, 0x65, 0x74, 0x5f, 0x63, // .float v = get_c
+	0x6f, 0x6f, 0x72, 0x64, 0x69, 0x6e, 0x61, 0x74, 0x65, 0x28, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x2e, // oordinate(texel.
+	0x79, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x29, 0x3b, 0x0a, 0x76, 0x65, 0x63, 0x33, 0x20, 0x70, // y, size);.vec3 p
+	0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x3b, 0x0a, 0x69, 0x66, 0x20, 0x28, 0x74, 0x65, 0x78, // osition;.if (tex
+	0x65, 0x6c, 0x2e, 0x7a, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x29, 0x20, 0x7b, 0x0a, 0x70, 0x6f, 0x73, // el.z == 0) {.pos
+	0x69, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x3d, 0x20, 0x76, 0x65, 0x63, 0x33, 0x28, 0x31, 0x2e, 0x30, // ition = vec3(1.0
+	0x2c, 0x20, 0x2d, 0x76, 0x2c, 0x20, 0x2d, 0x75, 0x29, 0x3b, 0x0a, 0x7d, 0x20, 0x65, 0x6c, 0x73, // , -v, -u);.} els
+	0x65, 0x20, 0x69, 0x66, 0x20, 0x28, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x2e, 0x7a, 0x20, 0x3d, 0x3d, // e if (texel.z ==
+	0x20, 0x31, 0x29, 0x20, 0x7b, 0x0a, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x3d, //  1) {.position =
+	0x20, 0x76, 0x65, 0x63, 0x33, 0x28, 0x2d, 0x31, 0x2e, 0x30, 0x2c, 0x20, 0x2d, 0x76, 0x2c, 0x20, //  vec3(-1.0, -v, 
+	0x75, 0x29, 0x3b, 0x0a, 0x7d, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x69, 0x66, 0x20, 0x28, 0x74, // u);.} else if (t
+	0x65, 0x78, 0x65, 0x6c, 0x2e, 0x7a, 0x20, 0x3d, 0x3d, 0x20, 0x32, 0x29, 0x20, 0x7b, 0x0a, 0x70, // exel.z == 2) {.p
+	0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x3d, 0x20, 0x76, 0x65, 0x63, 0x33, 0x28, 0x75, // osition = vec3(u
+	0x2c, 0x20, 0x31, 0x2e, 0x30, 0x2c, 0x20, 0x76, 0x29, 0x3b, 0x0a, 0x7d, 0x20, 0x65, 0x6c, 0x73, // , 1.0, v);.} els
+	0x65, 0x20, 0x69, 0x66, 0x20, 0x28, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x2e, 0x7a, 0x20, 0x3d, 0x3d, // e if (texel.z ==
+	0x20, 0x33, 0x29, 0x20, 0x7b, 0x0a, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x3d, //  3) {.position =
+	0x20, 0x76, 0x65, 0x63, 0x33, 0x28, 0x75, 0x2c, 0x20, 0x2d, 0x31, 0x2e, 0x30, 0x2c, 0x20, 0x2d, //  vec3(u, -1.0, -
+	0x76, 0x29, 0x3b, 0x0a, 0x7d, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x69, 0x66, 0x20, 0x28, 0x74, // v);.} else if (t
+	0x65, 0x78, 0x65, 0x6c, 0x2e, 0x7a, 0x20, 0x3d, 0x3d, 0x20, 0x34, 0x29, 0x20, 0x7b, 0x0a, 0x70, // exel.z == 4) {.p
+	0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x3d, 0x20, 0x76, 0x65, 0x63, 0x33, 0x28, 0x75, // osition = vec3(u
+	0x2c, 0x20, 0x2d, 0x76, 0x2c, 0x20, 0x31, 0x2e, 0x30, 0x29, 0x3b, 0x0a, 0x7d, 0x20, 0x65, 0x6c, // , -v, 1.0);.} el
+	0x73, 0x65, 0x20, 0x7b, 0x0a, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x3d, 0x20, // se {.position = 
+	0x76, 0x65, 0x63, 0x33, 0x28, 0x2d, 0x75, 0x2c, 0x20, 0x2d, 0x76, 0x2c, 0x20, 0x2d, 0x31, 0x2e, // vec3(-u, -v, -1.
+	0x30, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x69, 0x6e, 0x74, 0x20, 0x6f, // 0);.}.for (int o
+	0x74, 0x68, 0x65, 0x72, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x20, // ther = 0; other 
+	0x3c, 0x20, 0x36, 0x3b, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x2b, 0x2b, 0x29, 0x20, 0x7b, 0x0a, // < 6; other++) {.
+	0x69, 0x6e, 0x74, 0x20, 0x61, 0x78, 0x69, 0x73, 0x20, 0x3d, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, // int axis = other
+	0x20, 0x2f, 0x20, 0x32, 0x3b, 0x0a, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x76, 0x61, 0x6c, 0x75, //  / 2;.float valu
+	0x65, 0x20, 0x3d, 0x20, 0x61, 0x78, 0x69, 0x73, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x20, 0x3f, 0x20, // e = axis == 0 ? 
+	0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x78, 0x20, 0x3a, 0x20, 0x28, 0x61, 0x78, // position.x : (ax
+	0x69, 0x73, 0x20, 0x3d, 0x3d, 0x20, 0x31, 0x20, 0x3f, 0x20, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, // is == 1 ? positi
+	0x6f, 0x6e, 0x2e, 0x79, 0x20, 0x3a, 0x20, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x2e, // on.y : position.
+	0x7a, 0x29, 0x3b, 0x0a, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x73, 0x69, 0x64, 0x65, 0x20, 0x3d, // z);.float side =
+	0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x2d, 0x20, 0x61, 0x78, 0x69, 0x73, 0x20, 0x2a, 0x20, //  other - axis * 
+	0x32, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x20, 0x3f, 0x20, 0x31, 0x2e, 0x30, 0x20, 0x3a, 0x20, 0x2d, // 2 == 0 ? 1.0 : -
+	0x31, 0x2e, 0x30, 0x3b, 0x0a, 0x69, 0x66, 0x20, 0x28, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x20, 0x3d, // 1.0;.if (other =
+	0x3d, 0x20, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x2e, 0x7a, 0x20, 0x7c, 0x7c, 0x20, 0x76, 0x61, 0x6c, // = texel.z || val
+	0x75, 0x65, 0x20, 0x21, 0x3d, 0x20, 0x73, 0x69, 0x64, 0x65, 0x29, 0x20, 0x7b, 0x0a, 0x63, 0x6f, // ue != side) {.co
+	0x6e, 0x74, 0x69, 0x6e, 0x75, 0x65, 0x3b, 0x0a, 0x7d, 0x0a, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, // ntinue;.}.float 
+	0x73, 0x20, 0x3d, 0x20, 0x61, 0x78, 0x69, 0x73, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x20, 0x3f, 0x20, // s = axis == 0 ? 
+	0x28, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x78, 0x20, 0x3e, 0x20, 0x30, 0x2e, // (position.x > 0.
+	0x30, 0x20, 0x3f, 0x20, 0x2d, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x7a, 0x20, // 0 ? -position.z 
+	0x3a, 0x20, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x7a, 0x29, 0x20, 0x3a, 0x20, // : position.z) : 
+	0x28, 0x61, 0x78, 0x69, 0x73, 0x20, 0x3d, 0x3d, 0x20, 0x31, 0x20, 0x3f, 0x20, 0x70, 0x6f, 0x73, // (axis == 1 ? pos
+	0x69, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x78, 0x20, 0x3a, 0x20, 0x28, 0x70, 0x6f, 0x73, 0x69, 0x74, // ition.x : (posit
+	0x69, 0x6f, 0x6e, 0x2e, 0x7a, 0x20, 0x3e, 0x20, 0x30, 0x2e, 0x30, 0x20, 0x3f, 0x20, 0x70, 0x6f, // ion.z > 0.0 ? po
+	0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x78, 0x20, 0x3a, 0x20, 0x2d, 0x70, 0x6f, 0x73, 0x69, // sition.x : -posi
+	0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x78, 0x29, 0x29, 0x3b, 0x0a, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, // tion.x));.float 
+	0x74, 0x20, 0x3d, 0x20, 0x61, 0x78, 0x69, 0x73, 0x20, 0x3d, 0x3d, 0x20, 0x31, 0x20, 0x3f, 0x20, // t = axis == 1 ? 
+	0x28, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x79, 0x20, 0x3e, 0x20, 0x30, 0x2e, // (position.y > 0.
+	0x30, 0x20, 0x3f, 0x20, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x7a, 0x20, 0x3a, // 0 ? position.z :
+	0x20, 0x2d, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x7a, 0x29, 0x20, 0x3a, 0x20, //  -position.z) : 
+	0x2d, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x2e, 0x79, 0x3b, 0x0a, 0x69, 0x76, 0x65, // -position.y;.ive
+	0x63, 0x32, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x5f, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x20, 0x3d, // c2 other_texel =
+	0x20, 0x6d, 0x69, 0x6e, 0x28, 0x69, 0x76, 0x65, 0x63, 0x32, 0x28, 0x28, 0x76, 0x65, 0x63, 0x32, //  min(ivec2((vec2
+	0x28, 0x73, 0x2c, 0x20, 0x74, 0x29, 0x20, 0x2b, 0x20, 0x31, 0x2e, 0x30, 0x29, 0x20, 0x2a, 0x20, // (s, t) + 1.0) * 
+	0x30, 0x2e, 0x35, 0x20, 0x2a, 0x20, 0x75, 0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, // 0.5 * u_settings
+	0x2e, 0x78, 0x29, 0x2c, 0x20, 0x69, 0x76, 0x65, 0x63, 0x32, 0x28, 0x73, 0x69, 0x7a, 0x65, 0x20, // .x), ivec2(size 
+	0x2d, 0x20, 0x31, 0x2c, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x2d, 0x20, 0x31, 0x29, 0x29, 0x3b, // - 1, size - 1));
+	0x0a, 0x73, 0x75, 0x6d, 0x20, 0x2b, 0x3d, 0x20, 0x6c, 0x6f, 0x61, 0x64, 0x5f, 0x71, 0x75, 0x61, // .sum += load_qua
+	0x64, 0x28, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x5f, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x2c, 0x20, 0x6f, // d(other_texel, o
+	0x74, 0x68, 0x65, 0x72, 0x29, 0x3b, 0x0a, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x20, 0x2b, 0x3d, 0x20, // ther);.count += 
+	0x31, 0x2e, 0x30, 0x3b, 0x0a, 0x7d, 0x0a, 0x7d, 0x0a, 0x69, 0x6d, 0x61, 0x67, 0x65, 0x53, 0x74, // 1.0;.}.}.imageSt
+	0x6f, 0x72, 0x65, 0x28, 0x73, 0x5f, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2c, 0x20, 0x74, 0x65, // ore(s_output, te
+	0x78, 0x65, 0x6c, 0x2c, 0x20, 0x73, 0x75, 0x6d, 0x20, 0x2f, 0x20, 0x28, 0x63, 0x6f, 0x75, 0x6e, // xel, sum / (coun
+	0x74, 0x20, 0x2a, 0x20, 0x34, 0x2e, 0x30, 0x29, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x00,             // t * 4.0));.}..
+};
+
+static const uint8_t downsample_shader_compute_spv[8417] =
+{
+	0x43, 0x53, 0x48, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x0a, 0x75, // CSH............u
+	0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x02, 0x01, 0x00, 0x00, 0x01, 0x00, 0x07, // _settings.......
+	0x73, 0x5f, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xac, 0x20, 0x00, // s_input....... .
+	0x00, 0x03, 0x02, 0x23, 0x07, 0x00, 0x00, 0x01, 0x00, 0x07, 0x00, 0x08, 0x00, 0x37, 0x05, 0x00, // ...#.........7..
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x06, // ................
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x47, 0x4c, 0x53, 0x4c, 0x2e, 0x73, 0x74, 0x64, 0x2e, 0x34, 0x35, // .....GLSL.std.45
+	0x30, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, // 0...............
+	0x00, 0x0f, 0x00, 0x06, 0x00, 0x05, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, // .............mai
+	0x6e, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00, 0x10, 0x00, 0x06, 0x00, 0x04, 0x00, 0x00, // n...............
+	0x00, 0x11, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, // ................
+	0x00, 0x03, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x00, 0xf4, 0x01, 0x00, 0x00, 0x05, 0x00, 0x04, // ................
+	0x00, 0x04, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x06, // .....main.......
+	0x00, 0x31, 0x00, 0x00, 0x00, 0x73, 0x5f, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x54, 0x65, 0x78, 0x74, // .1...s_inputText
+	0x75, 0x72, 0x65, 0x00, 0x00, 0x05, 0x00, 0x06, 0x00, 0x37, 0x00, 0x00, 0x00, 0x73, 0x5f, 0x6f, // ure......7...s_o
+	0x75, 0x74, 0x70, 0x75, 0x74, 0x54, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x00, 0x05, 0x00, 0x04, // utputTexture....
+	0x00, 0x49, 0x00, 0x00, 0x00, 0x24, 0x47, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x00, 0x06, 0x00, 0x06, // .I...$Global....
+	0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, // .I.......u_setti
+	0x6e, 0x67, 0x73, 0x00, 0x00, 0x05, 0x00, 0x03, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // ngs......K......
+	0x00, 0x05, 0x00, 0x08, 0x00, 0xe0, 0x01, 0x00, 0x00, 0x67, 0x6c, 0x5f, 0x47, 0x6c, 0x6f, 0x62, // .........gl_Glob
+	0x61, 0x6c, 0x49, 0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x49, 0x44, 0x00, 0x00, // alInvocationID..
+	0x00, 0x47, 0x00, 0x04, 0x00, 0x31, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // .G...1..."......
+	0x00, 0x47, 0x00, 0x04, 0x00, 0x31, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // .G...1...!......
+	0x00, 0x47, 0x00, 0x04, 0x00, 0x37, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // .G...7..."......
+	0x00, 0x47, 0x00, 0x04, 0x00, 0x37, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, // .G...7...!......
+	0x00, 0x48, 0x00, 0x05, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, // .H...I.......#..
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00, 0x49, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, // .....G...I......
+	0x00, 0x47, 0x00, 0x04, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // .G...K..."......
+	0x00, 0x47, 0x00, 0x04, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // .G...K...!......
+	0x00, 0x47, 0x00, 0x04, 0x00, 0xe0, 0x01, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, // .G..............
+	0x00, 0x13, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x21, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, // .........!......
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x16, 0x00, 0x03, 0x00, 0x06, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, // ............. ..
+	0x00, 0x19, 0x00, 0x09, 0x00, 0x07, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, // ................
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, // ................
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, // ............. ..
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, // ................
+	0x00, 0x03, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, // ................
+	0x00, 0x04, 0x00, 0x00, 0x00, 0x19, 0x00, 0x09, 0x00, 0x13, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, // ................
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // ................
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00, 0x1d, 0x00, 0x00, // ................
+	0x00, 0x0a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x30, 0x00, 0x00, // ......... ...0..
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x30, 0x00, 0x00, // .........;...0..
+	0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x36, 0x00, 0x00, // .1....... ...6..
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x36, 0x00, 0x00, // .........;...6..
+	0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, // .7.......+......
+	0x00, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x03, 0x00, 0x49, 0x00, 0x00, // .:...........I..
+	0x00, 0x0d, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, // ..... ...J......
+	0x00, 0x49, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x4b, 0x00, 0x00, // .I...;...J...K..
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x15, 0x00, 0x04, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, // .........L... ..
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x00, // .....+...L...M..
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, // ..... ...N......
+	0x00, 0x06, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x51, 0x00, 0x00, // .....+.......Q..
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x02, 0x00, 0x52, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, // .........R...+..
+	0x00, 0x06, 0x00, 0x00, 0x00, 0x5f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x40, 0x2b, 0x00, 0x04, // ....._......@+..
+	0x00, 0x4c, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, // .L...c.......+..
+	0x00, 0x0a, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, // .....g.......+..
+	0x00, 0x4c, 0x00, 0x00, 0x00, 0x6a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, // .L...j.......+..
+	0x00, 0x0a, 0x00, 0x00, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, // .....m.......+..
+	0x00, 0x06, 0x00, 0x00, 0x00, 0xae, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xbf, 0x2b, 0x00, 0x04, // .............+..
+	0x00, 0x06, 0x00, 0x00, 0x00, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x2b, 0x00, 0x04, // ............?+..
+	0x00, 0x06, 0x00, 0x00, 0x00, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x2b, 0x00, 0x04, // ............?+..
+	0x00, 0x06, 0x00, 0x00, 0x00, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x2b, 0x00, 0x04, // ............@+..
+	0x00, 0x0a, 0x00, 0x00, 0x00, 0xef, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, // .............+..
+	0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x40, 0x17, 0x00, 0x04, // ............@...
+	0x00, 0x2a, 0x01, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, // .*...........+..
+	0x00, 0x0a, 0x00, 0x00, 0x00, 0x48, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, // .....H.......+..
+	0x00, 0x0a, 0x00, 0x00, 0x00, 0x53, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, // .....S..........
+	0x00, 0xb9, 0x01, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, // ............. ..
+	0x00, 0xdf, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, // .............;..
+	0x00, 0xdf, 0x01, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x05, // .............,..
+	0x00, 0xb9, 0x01, 0x00, 0x00, 0xfb, 0x04, 0x00, 0x00, 0xb6, 0x00, 0x00, 0x00, 0xb6, 0x00, 0x00, // ................
+	0x00, 0x36, 0x00, 0x05, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // .6..............
+	0x00, 0x03, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x05, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, // .............=..
+	0x00, 0x07, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, // .....2...1...=..
+	0x00, 0x13, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, // .....8...7...=..
+	0x00, 0x0b, 0x00, 0x00, 0x00, 0xe1, 0x01, 0x00, 0x00, 0xe0, 0x01, 0x00, 0x00, 0xf9, 0x00, 0x02, // ................
+	0x00, 0x2a, 0x02, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x2a, 0x02, 0x00, 0x00, 0xf6, 0x00, 0x04, // .*.......*......
+	0x00, 0x2b, 0x02, 0x00, 0x00, 0x2c, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, // .+...,..........
+	0x00, 0x2d, 0x02, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x2d, 0x02, 0x00, 0x00, 0x51, 0x00, 0x05, // .-.......-...Q..
+	0x00, 0x0a, 0x00, 0x00, 0x00, 0x30, 0x02, 0x00, 0x00, 0xe1, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, // .....0..........
+	0x00, 0x6f, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x31, 0x02, 0x00, 0x00, 0x30, 0x02, 0x00, // .o.......1...0..
+	0x00, 0x41, 0x00, 0x06, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x32, 0x02, 0x00, 0x00, 0x4b, 0x00, 0x00, // .A...N...2...K..
+	0x00, 0x3a, 0x00, 0x00, 0x00, 0x6a, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, // .:...j...=......
+	0x00, 0x33, 0x02, 0x00, 0x00, 0x32, 0x02, 0x00, 0x00, 0xbe, 0x00, 0x05, 0x00, 0x52, 0x00, 0x00, // .3...2.......R..
+	0x00, 0x34, 0x02, 0x00, 0x00, 0x31, 0x02, 0x00, 0x00, 0x33, 0x02, 0x00, 0x00, 0x51, 0x00, 0x05, // .4...1...3...Q..
+	0x00, 0x0a, 0x00, 0x00, 0x00, 0x36, 0x02, 0x00, 0x00, 0xe1, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, // .....6..........
+	0x00, 0x6f, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x37, 0x02, 0x00, 0x00, 0x36, 0x02, 0x00, // .o.......7...6..
+	0x00, 0x41, 0x00, 0x06, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x38, 0x02, 0x00, 0x00, 0x4b, 0x00, 0x00, // .A...N...8...K..
+	0x00, 0x3a, 0x00, 0x00, 0x00, 0x6a, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, // .:...j...=......
+	0x00, 0x39, 0x02, 0x00, 0x00, 0x38, 0x02, 0x00, 0x00, 0xbe, 0x00, 0x05, 0x00, 0x52, 0x00, 0x00, // .9...8.......R..
+	0x00, 0x3a, 0x02, 0x00, 0x00, 0x37, 0x02, 0x00, 0x00, 0x39, 0x02, 0x00, 0x00, 0xa6, 0x00, 0x05, // .:...7...9......
+	0x00, 0x52, 0x00, 0x00, 0x00, 0x3b, 0x02, 0x00, 0x00, 0x34, 0x02, 0x00, 0x00, 0x3a, 0x02, 0x00, // .R...;...4...:..
+	0x00, 0xf7, 0x00, 0x03, 0x00, 0x3c, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, // .....<..........
+	0x00, 0x3b, 0x02, 0x00, 0x00, 0x3d, 0x02, 0x00, 0x00, 0x3c, 0x02, 0x00, 0x00, 0xf8, 0x00, 0x02, // .;...=...<......
+	0x00, 0x3d, 0x02, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x2b, 0x02, 0x00, 0x00, 0xf8, 0x00, 0x02, // .=.......+......
+	0x00, 0x3c, 0x02, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x3e, 0x02, 0x00, // .<...A...N...>..
+	0x00, 0x4b, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x6a, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, // .K...:...j...=..
+	0x00, 0x06, 0x00, 0x00, 0x00, 0x3f, 0x02, 0x00, 0x00, 0x3e, 0x02, 0x00, 0x00, 0x6e, 0x00, 0x04, // .....?...>...n..
+	0x00, 0x0a, 0x00, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x3f, 0x02, 0x00, 0x00, 0x51, 0x00, 0x05, // .....@...?...Q..
+	0x00, 0x0a, 0x00, 0x00, 0x00, 0x44, 0x02, 0x00, 0x00, 0xe1, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, // .....D..........
+	0x00, 0xf9, 0x00, 0x02, 0x00, 0x33, 0x03, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x33, 0x03, 0x00, // .....3.......3..
+	0x00, 0xf6, 0x00, 0x04, 0x00, 0x34, 0x03, 0x00, 0x00, 0x35, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, // .....4...5......
+	0x00, 0xf9, 0x00, 0x02, 0x00, 0x36, 0x03, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x36, 0x03, 0x00, // .....6.......6..
+	0x00, 0x41, 0x00, 0x06, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x37, 0x03, 0x00, 0x00, 0x4b, 0x00, 0x00, // .A...N...7...K..
+	0x00, 0x3a, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, // .:...M...=......
+	0x00, 0x38, 0x03, 0x00, 0x00, 0x37, 0x03, 0x00, 0x00, 0xb6, 0x00, 0x05, 0x00, 0x52, 0x00, 0x00, // .8...7.......R..
+	0x00, 0x39, 0x03, 0x00, 0x00, 0x38, 0x03, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, // .9...8...Q......
+	0x00, 0x3a, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x39, 0x03, 0x00, // .:...........9..
+	0x00, 0x3b, 0x03, 0x00, 0x00, 0x3a, 0x03, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x3b, 0x03, 0x00, // .;...:.......;..
+	0x00, 0x5f, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x7e, 0x03, 0x00, 0x00, 0x32, 0x00, 0x00, // ._.......~...2..
+	0x00, 0xe1, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x05, // .........:......
+	0x00, 0x0d, 0x00, 0x00, 0x00, 0x43, 0x03, 0x00, 0x00, 0x7e, 0x03, 0x00, 0x00, 0x5f, 0x00, 0x00, // .....C...~..._..
+	0x00, 0xf9, 0x00, 0x02, 0x00, 0x34, 0x03, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x3a, 0x03, 0x00, // .....4.......:..
+	0x00, 0x41, 0x00, 0x06, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x44, 0x03, 0x00, 0x00, 0x4b, 0x00, 0x00, // .A...N...D...K..
+	0x00, 0x3a, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, // .:...c...=......
+	0x00, 0x45, 0x03, 0x00, 0x00, 0x44, 0x03, 0x00, 0x00, 0x6e, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, // .E...D...n......
+	0x00, 0x46, 0x03, 0x00, 0x00, 0x45, 0x03, 0x00, 0x00, 0x82, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, // .F...E..........
+	0x00, 0x47, 0x03, 0x00, 0x00, 0x46, 0x03, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, // .G...F...g...Q..
+	0x00, 0x0a, 0x00, 0x00, 0x00, 0x49, 0x03, 0x00, 0x00, 0xe1, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, // .....I..........
+	0x00, 0x84, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x4a, 0x03, 0x00, 0x00, 0x49, 0x03, 0x00, // .........J...I..
+	0x00, 0x6d, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x07, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x4c, 0x03, 0x00, // .m...........L..
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x4a, 0x03, 0x00, 0x00, 0x47, 0x03, 0x00, // .....'...J...G..
+	0x00, 0x51, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x4e, 0x03, 0x00, 0x00, 0xe1, 0x01, 0x00, // .Q.......N......
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x4f, 0x03, 0x00, // .............O..
+	0x00, 0x4e, 0x03, 0x00, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, // .N...m..........
+	0x00, 0x50, 0x03, 0x00, 0x00, 0x4f, 0x03, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x07, // .P...O...g......
+	0x00, 0x0a, 0x00, 0x00, 0x00, 0x52, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, // .....R.......'..
+	0x00, 0x50, 0x03, 0x00, 0x00, 0x47, 0x03, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, // .P...G...Q......
+	0x00, 0x54, 0x03, 0x00, 0x00, 0xe1, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x84, 0x00, 0x05, // .T..............
+	0x00, 0x0a, 0x00, 0x00, 0x00, 0x55, 0x03, 0x00, 0x00, 0x54, 0x03, 0x00, 0x00, 0x6d, 0x00, 0x00, // .....U...T...m..
+	0x00, 0x0c, 0x00, 0x07, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x57, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, // .........W......
+	0x00, 0x27, 0x00, 0x00, 0x00, 0x55, 0x03, 0x00, 0x00, 0x47, 0x03, 0x00, 0x00, 0x51, 0x00, 0x05, // .'...U...G...Q..
+	0x00, 0x0a, 0x00, 0x00, 0x00, 0x59, 0x03, 0x00, 0x00, 0xe1, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, // .....Y..........
+	0x00, 0x84, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x5a, 0x03, 0x00, 0x00, 0x59, 0x03, 0x00, // .........Z...Y..
+	0x00, 0x6d, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x5b, 0x03, 0x00, // .m...........[..
+	0x00, 0x5a, 0x03, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x07, 0x00, 0x0a, 0x00, 0x00, // .Z...g..........
+	0x00, 0x5d, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x5b, 0x03, 0x00, // .].......'...[..
+	0x00, 0x47, 0x03, 0x00, 0x00, 0x50, 0x00, 0x06, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x61, 0x03, 0x00, // .G...P.......a..
+	0x00, 0x4c, 0x03, 0x00, 0x00, 0x57, 0x03, 0x00, 0x00, 0x44, 0x02, 0x00, 0x00, 0x5f, 0x00, 0x07, // .L...W...D..._..
+	0x00, 0x0d, 0x00, 0x00, 0x00, 0x83, 0x03, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x61, 0x03, 0x00, // .........2...a..
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x50, 0x00, 0x06, 0x00, 0x0b, 0x00, 0x00, // .....:...P......
+	0x00, 0x67, 0x03, 0x00, 0x00, 0x52, 0x03, 0x00, 0x00, 0x57, 0x03, 0x00, 0x00, 0x44, 0x02, 0x00, // .g...R...W...D..
+	0x00, 0x5f, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x88, 0x03, 0x00, 0x00, 0x32, 0x00, 0x00, // ._...........2..
+	0x00, 0x67, 0x03, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x81, 0x00, 0x05, // .g.......:......
+	0x00, 0x0d, 0x00, 0x00, 0x00, 0x6a, 0x03, 0x00, 0x00, 0x83, 0x03, 0x00, 0x00, 0x88, 0x03, 0x00, // .....j..........
+	0x00, 0x50, 0x00, 0x06, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x6e, 0x03, 0x00, 0x00, 0x4c, 0x03, 0x00, // .P.......n...L..
+	0x00, 0x5d, 0x03, 0x00, 0x00, 0x44, 0x02, 0x00, 0x00, 0x5f, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x00, // .]...D..._......
+	0x00, 0x8d, 0x03, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x6e, 0x03, 0x00, 0x00, 0x02, 0x00, 0x00, // .....2...n......
+	0x00, 0x3a, 0x00, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x71, 0x03, 0x00, // .:...........q..
+	0x00, 0x6a, 0x03, 0x00, 0x00, 0x8d, 0x03, 0x00, 0x00, 0x50, 0x00, 0x06, 0x00, 0x0b, 0x00, 0x00, // .j.......P......
+	0x00, 0x75, 0x03, 0x00, 0x00, 0x52, 0x03, 0x00, 0x00, 0x5d, 0x03, 0x00, 0x00, 0x44, 0x02, 0x00, // .u...R...]...D..
+	0x00, 0x5f, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x92, 0x03, 0x00, 0x00, 0x32, 0x00, 0x00, // ._...........2..
+	0x00, 0x75, 0x03, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x81, 0x00, 0x05, // .u.......:......
+	0x00, 0x0d, 0x00, 0x00, 0x00, 0x78, 0x03, 0x00, 0x00, 0x71, 0x03, 0x00, 0x00, 0x92, 0x03, 0x00, // .....x...q......
+	0x00, 0xf9, 0x00, 0x02, 0x00, 0x34, 0x03, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x35, 0x03, 0x00, // .....4.......5..
+	0x00, 0xf9, 0x00, 0x02, 0x00, 0x33, 0x03, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x34, 0x03, 0x00, // .....3.......4..
+	0x00, 0xf5, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x00, 0x00, 0xfc, 0x04, 0x00, 0x00, 0x43, 0x03, 0x00, // .............C..
+	0x00, 0x3b, 0x03, 0x00, 0x00, 0x78, 0x03, 0x00, 0x00, 0x3a, 0x03, 0x00, 0x00, 0xaa, 0x00, 0x05, // .;...x...:......
+	0x00, 0x52, 0x00, 0x00, 0x00, 0x47, 0x02, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x67, 0x00, 0x00, // .R...G...@...g..
+	0x00, 0xf7, 0x00, 0x03, 0x00, 0x48, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, // .....H..........
+	0x00, 0x47, 0x02, 0x00, 0x00, 0x49, 0x02, 0x00, 0x00, 0x4a, 0x02, 0x00, 0x00, 0xf8, 0x00, 0x02, // .G...I...J......
+	0x00, 0x4a, 0x02, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x5f, 0x02, 0x00, // .J...Q......._..
+	0x00, 0xe1, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x05, 0x00, 0x52, 0x00, 0x00, // .............R..
+	0x00, 0x60, 0x02, 0x00, 0x00, 0x5f, 0x02, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, // .`..._...:...Q..
+	0x00, 0x0a, 0x00, 0x00, 0x00, 0x62, 0x02, 0x00, 0x00, 0xe1, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, // .....b..........
+	0x00, 0xaa, 0x00, 0x05, 0x00, 0x52, 0x00, 0x00, 0x00, 0x63, 0x02, 0x00, 0x00, 0x62, 0x02, 0x00, // .....R...c...b..
+	0x00, 0x3a, 0x00, 0x00, 0x00, 0xa6, 0x00, 0x05, 0x00, 0x52, 0x00, 0x00, 0x00, 0x64, 0x02, 0x00, // .:.......R...d..
+	0x00, 0x60, 0x02, 0x00, 0x00, 0x63, 0x02, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, // .`...c...Q......
+	0x00, 0x66, 0x02, 0x00, 0x00, 0xe1, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x00, 0x05, // .f..............
+	0x00, 0x0a, 0x00, 0x00, 0x00, 0x68, 0x02, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x67, 0x00, 0x00, // .....h...@...g..
+	0x00, 0xaa, 0x00, 0x05, 0x00, 0x52, 0x00, 0x00, 0x00, 0x69, 0x02, 0x00, 0x00, 0x66, 0x02, 0x00, // .....R...i...f..
+	0x00, 0x68, 0x02, 0x00, 0x00, 0xa6, 0x00, 0x05, 0x00, 0x52, 0x00, 0x00, 0x00, 0x6a, 0x02, 0x00, // .h.......R...j..
+	0x00, 0x64, 0x02, 0x00, 0x00, 0x69, 0x02, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, // .d...i...Q......
+	0x00, 0x6c, 0x02, 0x00, 0x00, 0xe1, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x82, 0x00, 0x05, // .l..............
+	0x00, 0x0a, 0x00, 0x00, 0x00, 0x6e, 0x02, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x67, 0x00, 0x00, // .....n...@...g..
+	0x00, 0xaa, 0x00, 0x05, 0x00, 0x52, 0x00, 0x00, 0x00, 0x6f, 0x02, 0x00, 0x00, 0x6c, 0x02, 0x00, // .....R...o...l..
+	0x00, 0x6e, 0x02, 0x00, 0x00, 0xa6, 0x00, 0x05, 0x00, 0x52, 0x00, 0x00, 0x00, 0x70, 0x02, 0x00, // .n.......R...p..
+	0x00, 0x6a, 0x02, 0x00, 0x00, 0x6f, 0x02, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0x71, 0x02, 0x00, // .j...o.......q..
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x70, 0x02, 0x00, 0x00, 0x72, 0x02, 0x00, // .........p...r..
+	0x00, 0x71, 0x02, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x72, 0x02, 0x00, 0x00, 0x51, 0x00, 0x05, // .q.......r...Q..
+	0x00, 0x0a, 0x00, 0x00, 0x00, 0x74, 0x02, 0x00, 0x00, 0xe1, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, // .....t..........
+	0x00, 0xf9, 0x00, 0x02, 0x00, 0x08, 0x04, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x08, 0x04, 0x00, // ................
+	0x00, 0xf6, 0x00, 0x04, 0x00, 0x09, 0x04, 0x00, 0x00, 0x0a, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, // ................
+	0x00, 0xf9, 0x00, 0x02, 0x00, 0x0b, 0x04, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x0b, 0x04, 0x00, // ................
+	0x00, 0xaa, 0x00, 0x05, 0x00, 0x52, 0x00, 0x00, 0x00, 0x0d, 0x04, 0x00, 0x00, 0x74, 0x02, 0x00, // .....R.......t..
+	0x00, 0x3a, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0x0e, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, // .:..............
+	0x00, 0xfa, 0x00, 0x04, 0x00, 0x0d, 0x04, 0x00, 0x00, 0x0f, 0x04, 0x00, 0x00, 0x0e, 0x04, 0x00, // ................
+	0x00, 0xf8, 0x00, 0x02, 0x00, 0x0f, 0x04, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x09, 0x04, 0x00, // ................
+	0x00, 0xf8, 0x00, 0x02, 0x00, 0x0e, 0x04, 0x00, 0x00, 0x82, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, // ................
+	0x00, 0x12, 0x04, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x05, // .....@...g......
+	0x00, 0x52, 0x00, 0x00, 0x00, 0x13, 0x04, 0x00, 0x00, 0x74, 0x02, 0x00, 0x00, 0x12, 0x04, 0x00, // .R.......t......
+	0x00, 0xf7, 0x00, 0x03, 0x00, 0x14, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, // ................
+	0x00, 0x13, 0x04, 0x00, 0x00, 0x15, 0x04, 0x00, 0x00, 0x14, 0x04, 0x00, 0x00, 0xf8, 0x00, 0x02, // ................
+	0x00, 0x15, 0x04, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x09, 0x04, 0x00, 0x00, 0xf8, 0x00, 0x02, // ................
+	0x00, 0x14, 0x04, 0x00, 0x00, 0x6f, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x17, 0x04, 0x00, // .....o..........
+	0x00, 0x74, 0x02, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x18, 0x04, 0x00, // .t..............
+	0x00, 0x17, 0x04, 0x00, 0x00, 0xba, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, // .........o......
+	0x00, 0x1a, 0x04, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x88, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, // .....@..........
+	0x00, 0x1b, 0x04, 0x00, 0x00, 0x18, 0x04, 0x00, 0x00, 0x1a, 0x04, 0x00, 0x00, 0x85, 0x00, 0x05, // ................
+	0x00, 0x06, 0x00, 0x00, 0x00, 0x1c, 0x04, 0x00, 0x00, 0x1b, 0x04, 0x00, 0x00, 0xbf, 0x00, 0x00, // ................
+	0x00, 0x83, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x1d, 0x04, 0x00, 0x00, 0x1c, 0x04, 0x00, // ................
+	0x00, 0xb6, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x09, 0x04, 0x00, 0x00, 0xf8, 0x00, 0x02, // ................
+	0x00, 0x0a, 0x04, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x08, 0x04, 0x00, 0x00, 0xf8, 0x00, 0x02, // ................
+	0x00, 0x09, 0x04, 0x00, 0x00, 0xf5, 0x00, 0x09, 0x00, 0x06, 0x00, 0x00, 0x00, 0xfd, 0x04, 0x00, // ................
+	0x00, 0xae, 0x00, 0x00, 0x00, 0x0f, 0x04, 0x00, 0x00, 0xb6, 0x00, 0x00, 0x00, 0x15, 0x04, 0x00, // ................
+	0x00, 0x1d, 0x04, 0x00, 0x00, 0x14, 0x04, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, // .........Q......
+	0x00, 0x78, 0x02, 0x00, 0x00, 0xe1, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, // .x..............
+	0x00, 0x22, 0x04, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x22, 0x04, 0x00, 0x00, 0xf6, 0x00, 0x04, // ."......."......
+	0x00, 0x23, 0x04, 0x00, 0x00, 0x24, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, // .#...$..........
+	0x00, 0x25, 0x04, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x25, 0x04, 0x00, 0x00, 0xaa, 0x00, 0x05, // .%.......%......
+	0x00, 0x52, 0x00, 0x00, 0x00, 0x27, 0x04, 0x00, 0x00, 0x78, 0x02, 0x00, 0x00, 0x3a, 0x00, 0x00, // .R...'...x...:..
+	0x00, 0xf7, 0x00, 0x03, 0x00, 0x28, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, // .....(..........
+	0x00, 0x27, 0x04, 0x00, 0x00, 0x29, 0x04, 0x00, 0x00, 0x28, 0x04, 0x00, 0x00, 0xf8, 0x00, 0x02, // .'...)...(......
+	0x00, 0x29, 0x04, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x23, 0x04, 0x00, 0x00, 0xf8, 0x00, 0x02, // .).......#......
+	0x00, 0x28, 0x04, 0x00, 0x00, 0x82, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x2c, 0x04, 0x00, // .(...........,..
+	0x00, 0x40, 0x02, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x05, 0x00, 0x52, 0x00, 0x00, // .@...g.......R..
+	0x00, 0x2d, 0x04, 0x00, 0x00, 0x78, 0x02, 0x00, 0x00, 0x2c, 0x04, 0x00, 0x00, 0xf7, 0x00, 0x03, // .-...x...,......
+	0x00, 0x2e, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x2d, 0x04, 0x00, // .............-..
+	0x00, 0x2f, 0x04, 0x00, 0x00, 0x2e, 0x04, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x2f, 0x04, 0x00, // ./.........../..
+	0x00, 0xf9, 0x00, 0x02, 0x00, 0x23, 0x04, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x2e, 0x04, 0x00, // .....#..........
+	0x00, 0x6f, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x31, 0x04, 0x00, 0x00, 0x78, 0x02, 0x00, // .o.......1...x..
+	0x00, 0x81, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x32, 0x04, 0x00, 0x00, 0x31, 0x04, 0x00, // .........2...1..
+	0x00, 0xba, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x34, 0x04, 0x00, // .....o.......4..
+	0x00, 0x40, 0x02, 0x00, 0x00, 0x88, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x35, 0x04, 0x00, // .@...........5..
+	0x00, 0x32, 0x04, 0x00, 0x00, 0x34, 0x04, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, // .2...4..........
+	0x00, 0x36, 0x04, 0x00, 0x00, 0x35, 0x04, 0x00, 0x00, 0xbf, 0x00, 0x00, 0x00, 0x83, 0x00, 0x05, // .6...5..........
+	0x00, 0x06, 0x00, 0x00, 0x00, 0x37, 0x04, 0x00, 0x00, 0x36, 0x04, 0x00, 0x00, 0xb6, 0x00, 0x00, // .....7...6......
+	0x00, 0xf9, 0x00, 0x02, 0x00, 0x23, 0x04, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x24, 0x04, 0x00, // .....#.......$..
+	0x00, 0xf9, 0x00, 0x02, 0x00, 0x22, 0x04, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x23, 0x04, 0x00, // .....".......#..
+	0x00, 0xf5, 0x00, 0x09, 0x00, 0x06, 0x00, 0x00, 0x00, 0xfe, 0x04, 0x00, 0x00, 0xae, 0x00, 0x00, // ................
+	0x00, 0x29, 0x04, 0x00, 0x00, 0xb6, 0x00, 0x00, 0x00, 0x2f, 0x04, 0x00, 0x00, 0x37, 0x04, 0x00, // .)......./...7..
+	0x00, 0x2e, 0x04, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x7c, 0x02, 0x00, // .....Q.......|..
+	0x00, 0xe1, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x05, 0x00, 0x52, 0x00, 0x00, // .............R..
+	0x00, 0x7d, 0x02, 0x00, 0x00, 0x7c, 0x02, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, // .}...|...:......
+	0x00, 0x7e, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x7d, 0x02, 0x00, // .~...........}..
+	0x00, 0x7f, 0x02, 0x00, 0x00, 0x80, 0x02, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x80, 0x02, 0x00, // ................
+	0x00, 0x51, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x87, 0x02, 0x00, 0x00, 0xe1, 0x01, 0x00, // .Q..............
+	0x00, 0x02, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x05, 0x00, 0x52, 0x00, 0x00, 0x00, 0x88, 0x02, 0x00, // .........R......
+	0x00, 0x87, 0x02, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0x89, 0x02, 0x00, // .....g..........
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x88, 0x02, 0x00, 0x00, 0x8a, 0x02, 0x00, // ................
+	0x00, 0x8b, 0x02, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x8b, 0x02, 0x00, 0x00, 0x51, 0x00, 0x05, // .............Q..
+	0x00, 0x0a, 0x00, 0x00, 0x00, 0x91, 0x02, 0x00, 0x00, 0xe1, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, // ................
+	0x00, 0xaa, 0x00, 0x05, 0x00, 0x52, 0x00, 0x00, 0x00, 0x92, 0x02, 0x00, 0x00, 0x91, 0x02, 0x00, // .....R..........
+	0x00, 0x6d, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0x93, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, // .m..............
+	0x00, 0xfa, 0x00, 0x04, 0x00, 0x92, 0x02, 0x00, 0x00, 0x94, 0x02, 0x00, 0x00, 0x95, 0x02, 0x00, // ................
+	0x00, 0xf8, 0x00, 0x02, 0x00, 0x95, 0x02, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, // .........Q......
+	0x00, 0x9a, 0x02, 0x00, 0x00, 0xe1, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x05, // ................
+	0x00, 0x52, 0x00, 0x00, 0x00, 0x9b, 0x02, 0x00, 0x00, 0x9a, 0x02, 0x00, 0x00, 0x48, 0x01, 0x00, // .R...........H..
+	0x00, 0xf7, 0x00, 0x03, 0x00, 0x9c, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, // ................
+	0x00, 0x9b, 0x02, 0x00, 0x00, 0x9d, 0x02, 0x00, 0x00, 0x9e, 0x02, 0x00, 0x00, 0xf8, 0x00, 0x02, // ................
+	0x00, 0x9e, 0x02, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, 0x00, 0xa4, 0x02, 0x00, // .....Q..........
+	0x00, 0xe1, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x05, 0x00, 0x52, 0x00, 0x00, // .............R..
+	0x00, 0xa5, 0x02, 0x00, 0x00, 0xa4, 0x02, 0x00, 0x00, 0x53, 0x01, 0x00, 0x00, 0xf7, 0x00, 0x03, // .........S......
+	0x00, 0xa6, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0xa5, 0x02, 0x00, // ................
+	0x00, 0xa7, 0x02, 0x00, 0x00, 0xa8, 0x02, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xa8, 0x02, 0x00, // ................
+	0x00, 0x7f, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0xae, 0x02, 0x00, 0x00, 0xfd, 0x04, 0x00, // ................
+	0x00, 0x7f, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0xb0, 0x02, 0x00, 0x00, 0xfe, 0x04, 0x00, // ................
+	0x00, 0x50, 0x00, 0x06, 0x00, 0x2a, 0x01, 0x00, 0x00, 0xb1, 0x02, 0x00, 0x00, 0xae, 0x02, 0x00, // .P...*..........
+	0x00, 0xb0, 0x02, 0x00, 0x00, 0xae, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0xa6, 0x02, 0x00, // ................
+	0x00, 0xf8, 0x00, 0x02, 0x00, 0xa7, 0x02, 0x00, 0x00, 0x7f, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, // ................
+	0x00, 0xab, 0x02, 0x00, 0x00, 0xfe, 0x04, 0x00, 0x00, 0x50, 0x00, 0x06, 0x00, 0x2a, 0x01, 0x00, // .........P...*..
+	0x00, 0xac, 0x02, 0x00, 0x00, 0xfd, 0x04, 0x00, 0x00, 0xab, 0x02, 0x00, 0x00, 0xb6, 0x00, 0x00, // ................
+	0x00, 0xf9, 0x00, 0x02, 0x00, 0xa6, 0x02, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xa6, 0x02, 0x00, // ................
+	0x00, 0xf5, 0x00, 0x07, 0x00, 0x2a, 0x01, 0x00, 0x00, 0x05, 0x05, 0x00, 0x00, 0xac, 0x02, 0x00, // .....*..........
+	0x00, 0xa7, 0x02, 0x00, 0x00, 0xb1, 0x02, 0x00, 0x00, 0xa8, 0x02, 0x00, 0x00, 0xf9, 0x00, 0x02, // ................
+	0x00, 0x9c, 0x02, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x9d, 0x02, 0x00, 0x00, 0x7f, 0x00, 0x04, // ................
+	0x00, 0x06, 0x00, 0x00, 0x00, 0xa1, 0x02, 0x00, 0x00, 0xfe, 0x04, 0x00, 0x00, 0x50, 0x00, 0x06, // .............P..
+	0x00, 0x2a, 0x01, 0x00, 0x00, 0xa2, 0x02, 0x00, 0x00, 0xfd, 0x04, 0x00, 0x00, 0xae, 0x00, 0x00, // .*..............
+	0x00, 0xa1, 0x02, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x9c, 0x02, 0x00, 0x00, 0xf8, 0x00, 0x02, // ................
+	0x00, 0x9c, 0x02, 0x00, 0x00, 0xf5, 0x00, 0x07, 0x00, 0x2a, 0x01, 0x00, 0x00, 0x04, 0x05, 0x00, // .........*......
+	0x00, 0xa2, 0x02, 0x00, 0x00, 0x9d, 0x02, 0x00, 0x00, 0x05, 0x05, 0x00, 0x00, 0xa6, 0x02, 0x00, // ................
+	0x00, 0xf9, 0x00, 0x02, 0x00, 0x93, 0x02, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x94, 0x02, 0x00, // ................
+	0x00, 0x50, 0x00, 0x06, 0x00, 0x2a, 0x01, 0x00, 0x00, 0x98, 0x02, 0x00, 0x00, 0xfd, 0x04, 0x00, // .P...*..........
+	0x00, 0xb6, 0x00, 0x00, 0x00, 0xfe, 0x04, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x93, 0x02, 0x00, // ................
+	0x00, 0xf8, 0x00, 0x02, 0x00, 0x93, 0x02, 0x00, 0x00, 0xf5, 0x00, 0x07, 0x00, 0x2a, 0x01, 0x00, // .............*..
+	0x00, 0x03, 0x05, 0x00, 0x00, 0x98, 0x02, 0x00, 0x00, 0x94, 0x02, 0x00, 0x00, 0x04, 0x05, 0x00, // ................
+	0x00, 0x9c, 0x02, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x89, 0x02, 0x00, 0x00, 0xf8, 0x00, 0x02, // ................
+	0x00, 0x8a, 0x02, 0x00, 0x00, 0x7f, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x8d, 0x02, 0x00, // ................
+	0x00, 0xfe, 0x04, 0x00, 0x00, 0x50, 0x00, 0x06, 0x00, 0x2a, 0x01, 0x00, 0x00, 0x8f, 0x02, 0x00, // .....P...*......
+	0x00, 0xae, 0x00, 0x00, 0x00, 0x8d, 0x02, 0x00, 0x00, 0xfd, 0x04, 0x00, 0x00, 0xf9, 0x00, 0x02, // ................
+	0x00, 0x89, 0x02, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x89, 0x02, 0x00, 0x00, 0xf5, 0x00, 0x07, // ................
+	0x00, 0x2a, 0x01, 0x00, 0x00, 0x02, 0x05, 0x00, 0x00, 0x8f, 0x02, 0x00, 0x00, 0x8a, 0x02, 0x00, // .*..............
+	0x00, 0x03, 0x05, 0x00, 0x00, 0x93, 0x02, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x7e, 0x02, 0x00, // .............~..
+	0x00, 0xf8, 0x00, 0x02, 0x00, 0x7f, 0x02, 0x00, 0x00, 0x7f, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, // ................
+	0x00, 0x82, 0x02, 0x00, 0x00, 0xfe, 0x04, 0x00, 0x00, 0x7f, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, // ................
+	0x00, 0x84, 0x02, 0x00, 0x00, 0xfd, 0x04, 0x00, 0x00, 0x50, 0x00, 0x06, 0x00, 0x2a, 0x01, 0x00, // .........P...*..
+	0x00, 0x85, 0x02, 0x00, 0x00, 0xb6, 0x00, 0x00, 0x00, 0x82, 0x02, 0x00, 0x00, 0x84, 0x02, 0x00, // ................
+	0x00, 0xf9, 0x00, 0x02, 0x00, 0x7e, 0x02, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x7e, 0x02, 0x00, // .....~.......~..
+	0x00, 0xf5, 0x00, 0x07, 0x00, 0x2a, 0x01, 0x00, 0x00, 0x01, 0x05, 0x00, 0x00, 0x85, 0x02, 0x00, // .....*..........
+	0x00, 0x7f, 0x02, 0x00, 0x00, 0x02, 0x05, 0x00, 0x00, 0x89, 0x02, 0x00, 0x00, 0xf9, 0x00, 0x02, // ................
+	0x00, 0xb2, 0x02, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xb2, 0x02, 0x00, 0x00, 0xf5, 0x00, 0x07, // ................
+	0x00, 0x06, 0x00, 0x00, 0x00, 0x15, 0x05, 0x00, 0x00, 0xb6, 0x00, 0x00, 0x00, 0x7e, 0x02, 0x00, // .............~..
+	0x00, 0x34, 0x05, 0x00, 0x00, 0xb4, 0x02, 0x00, 0x00, 0xf5, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x00, // .4..............
+	0x00, 0x09, 0x05, 0x00, 0x00, 0xfc, 0x04, 0x00, 0x00, 0x7e, 0x02, 0x00, 0x00, 0x32, 0x05, 0x00, // .........~...2..
+	0x00, 0xb4, 0x02, 0x00, 0x00, 0xf5, 0x00, 0x07, 0x00, 0x0a, 0x00, 0x00, 0x00, 0xff, 0x04, 0x00, // ................
+	0x00, 0x3a, 0x00, 0x00, 0x00, 0x7e, 0x02, 0x00, 0x00, 0x18, 0x03, 0x00, 0x00, 0xb4, 0x02, 0x00, // .:...~..........
+	0x00, 0xb1, 0x00, 0x05, 0x00, 0x52, 0x00, 0x00, 0x00, 0xb7, 0x02, 0x00, 0x00, 0xff, 0x04, 0x00, // .....R..........
+	0x00, 0xef, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x04, 0x00, 0xb3, 0x02, 0x00, 0x00, 0xb4, 0x02, 0x00, // ................
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0xb7, 0x02, 0x00, 0x00, 0xb8, 0x02, 0x00, // ................
+	0x00, 0xb3, 0x02, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xb8, 0x02, 0x00, 0x00, 0x87, 0x00, 0x05, // ................
+	0x00, 0x0a, 0x00, 0x00, 0x00, 0xba, 0x02, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0x6d, 0x00, 0x00, // .............m..
+	0x00, 0xaa, 0x00, 0x05, 0x00, 0x52, 0x00, 0x00, 0x00, 0xbc, 0x02, 0x00, 0x00, 0xba, 0x02, 0x00, // .....R..........
+	0x00, 0x3a, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0xbe, 0x02, 0x00, // .:...Q..........
+	0x00, 0x01, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x05, 0x00, 0x52, 0x00, 0x00, // .............R..
+	0x00, 0xc0, 0x02, 0x00, 0x00, 0xba, 0x02, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, // .........g...Q..
+	0x00, 0x06, 0x00, 0x00, 0x00, 0xc2, 0x02, 0x00, 0x00, 0x01, 0x05, 0x00, 0x00, 0x01, 0x00, 0x00, // ................
+	0x00, 0x51, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0x01, 0x05, 0x00, // .Q..............
+	0x00, 0x02, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00, 0xc5, 0x02, 0x00, // ................
+	0x00, 0xc0, 0x02, 0x00, 0x00, 0xc2, 0x02, 0x00, 0x00, 0xc4, 0x02, 0x00, 0x00, 0xa9, 0x00, 0x06, // ................
+	0x00, 0x06, 0x00, 0x00, 0x00, 0xc6, 0x02, 0x00, 0x00, 0xbc, 0x02, 0x00, 0x00, 0xbe, 0x02, 0x00, // ................
+	0x00, 0xc5, 0x02, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, 0x00, 0xc9, 0x02, 0x00, // ................
+	0x00, 0xba, 0x02, 0x00, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x82, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, // .....m..........
+	0x00, 0xca, 0x02, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0xc9, 0x02, 0x00, 0x00, 0xaa, 0x00, 0x05, // ................
+	0x00, 0x52, 0x00, 0x00, 0x00, 0xcb, 0x02, 0x00, 0x00, 0xca, 0x02, 0x00, 0x00, 0x3a, 0x00, 0x00, // .R...........:..
+	0x00, 0xa9, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00, 0xcc, 0x02, 0x00, 0x00, 0xcb, 0x02, 0x00, // ................
+	0x00, 0xb6, 0x00, 0x00, 0x00, 0xae, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, // .........Q......
+	0x00, 0xcf, 0x02, 0x00, 0x00, 0xe1, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x05, // ................
+	0x00, 0x52, 0x00, 0x00, 0x00, 0xd0, 0x02, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0xcf, 0x02, 0x00, // .R..............
+	0x00, 0xb6, 0x00, 0x05, 0x00, 0x52, 0x00, 0x00, 0x00, 0xd3, 0x02, 0x00, 0x00, 0xc6, 0x02, 0x00, // .....R..........
+	0x00, 0xcc, 0x02, 0x00, 0x00, 0xa6, 0x00, 0x05, 0x00, 0x52, 0x00, 0x00, 0x00, 0xd4, 0x02, 0x00, // .........R......
+	0x00, 0xd0, 0x02, 0x00, 0x00, 0xd3, 0x02, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0xd5, 0x02, 0x00, // ................
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0xd4, 0x02, 0x00, 0x00, 0xd6, 0x02, 0x00, // ................
+	0x00, 0xd5, 0x02, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xd6, 0x02, 0x00, 0x00, 0xf9, 0x00, 0x02, // ................
+	0x00, 0xb4, 0x02, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xd5, 0x02, 0x00, 0x00, 0xaa, 0x00, 0x05, // ................
+	0x00, 0x52, 0x00, 0x00, 0x00, 0xd8, 0x02, 0x00, 0x00, 0xba, 0x02, 0x00, 0x00, 0x3a, 0x00, 0x00, // .R...........:..
+	0x00, 0x51, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0xda, 0x02, 0x00, 0x00, 0x01, 0x05, 0x00, // .Q..............
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x00, 0x05, 0x00, 0x52, 0x00, 0x00, 0x00, 0xdb, 0x02, 0x00, // .........R......
+	0x00, 0xda, 0x02, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, // .....Q...Q......
+	0x00, 0xdd, 0x02, 0x00, 0x00, 0x01, 0x05, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x04, // ................
+	0x00, 0x06, 0x00, 0x00, 0x00, 0xde, 0x02, 0x00, 0x00, 0xdd, 0x02, 0x00, 0x00, 0x51, 0x00, 0x05, // .............Q..
+	0x00, 0x06, 0x00, 0x00, 0x00, 0xe0, 0x02, 0x00, 0x00, 0x01, 0x05, 0x00, 0x00, 0x02, 0x00, 0x00, // ................
+	0x00, 0xa9, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00, 0xe1, 0x02, 0x00, 0x00, 0xdb, 0x02, 0x00, // ................
+	0x00, 0xde, 0x02, 0x00, 0x00, 0xe0, 0x02, 0x00, 0x00, 0xaa, 0x00, 0x05, 0x00, 0x52, 0x00, 0x00, // .............R..
+	0x00, 0xe3, 0x02, 0x00, 0x00, 0xba, 0x02, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, // .........g...Q..
+	0x00, 0x06, 0x00, 0x00, 0x00, 0xe5, 0x02, 0x00, 0x00, 0x01, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, // ................
+	0x00, 0x51, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0xe7, 0x02, 0x00, 0x00, 0x01, 0x05, 0x00, // .Q..............
+	0x00, 0x02, 0x00, 0x00, 0x00, 0xba, 0x00, 0x05, 0x00, 0x52, 0x00, 0x00, 0x00, 0xe8, 0x02, 0x00, // .........R......
+	0x00, 0xe7, 0x02, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, // .....Q...Q......
+	0x00, 0xea, 0x02, 0x00, 0x00, 0x01, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, // .............Q..
+	0x00, 0x06, 0x00, 0x00, 0x00, 0xec, 0x02, 0x00, 0x00, 0x01, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, // ................
+	0x00, 0x7f, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0xed, 0x02, 0x00, 0x00, 0xec, 0x02, 0x00, // ................
+	0x00, 0xa9, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00, 0xee, 0x02, 0x00, 0x00, 0xe8, 0x02, 0x00, // ................
+	0x00, 0xea, 0x02, 0x00, 0x00, 0xed, 0x02, 0x00, 0x00, 0xa9, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, // ................
+	0x00, 0xef, 0x02, 0x00, 0x00, 0xe3, 0x02, 0x00, 0x00, 0xe5, 0x02, 0x00, 0x00, 0xee, 0x02, 0x00, // ................
+	0x00, 0xa9, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00, 0xf0, 0x02, 0x00, 0x00, 0xd8, 0x02, 0x00, // ................
+	0x00, 0xe1, 0x02, 0x00, 0x00, 0xef, 0x02, 0x00, 0x00, 0xaa, 0x00, 0x05, 0x00, 0x52, 0x00, 0x00, // .............R..
+	0x00, 0xf2, 0x02, 0x00, 0x00, 0xba, 0x02, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, // .........g...Q..
+	0x00, 0x06, 0x00, 0x00, 0x00, 0xf4, 0x02, 0x00, 0x00, 0x01, 0x05, 0x00, 0x00, 0x01, 0x00, 0x00, // ................
+	0x00, 0xba, 0x00, 0x05, 0x00, 0x52, 0x00, 0x00, 0x00, 0xf5, 0x02, 0x00, 0x00, 0xf4, 0x02, 0x00, // .....R..........
+	0x00, 0x51, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0xf7, 0x02, 0x00, // .Q...Q..........
+	0x00, 0x01, 0x05, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, // .........Q......
+	0x00, 0xf9, 0x02, 0x00, 0x00, 0x01, 0x05, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x04, // ................
+	0x00, 0x06, 0x00, 0x00, 0x00, 0xfa, 0x02, 0x00, 0x00, 0xf9, 0x02, 0x00, 0x00, 0xa9, 0x00, 0x06, // ................
+	0x00, 0x06, 0x00, 0x00, 0x00, 0xfb, 0x02, 0x00, 0x00, 0xf5, 0x02, 0x00, 0x00, 0xf7, 0x02, 0x00, // ................
+	0x00, 0xfa, 0x02, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0xfd, 0x02, 0x00, // .....Q..........
+	0x00, 0x01, 0x05, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, // ................
+	0x00, 0xfe, 0x02, 0x00, 0x00, 0xfd, 0x02, 0x00, 0x00, 0xa9, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, // ................
+	0x00, 0xff, 0x02, 0x00, 0x00, 0xf2, 0x02, 0x00, 0x00, 0xfb, 0x02, 0x00, 0x00, 0xfe, 0x02, 0x00, // ................
+	0x00, 0x50, 0x00, 0x05, 0x00, 0xb9, 0x01, 0x00, 0x00, 0x02, 0x03, 0x00, 0x00, 0xf0, 0x02, 0x00, // .P..............
+	0x00, 0xff, 0x02, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00, 0xb9, 0x01, 0x00, 0x00, 0x04, 0x03, 0x00, // ................
+	0x00, 0x02, 0x03, 0x00, 0x00, 0xfb, 0x04, 0x00, 0x00, 0x8e, 0x00, 0x05, 0x00, 0xb9, 0x01, 0x00, // ................
+	0x00, 0x05, 0x03, 0x00, 0x00, 0x04, 0x03, 0x00, 0x00, 0xba, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, // .............A..
+	0x00, 0x4e, 0x00, 0x00, 0x00, 0x06, 0x03, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, // .N.......K...:..
+	0x00, 0x6a, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x07, 0x03, 0x00, // .j...=..........
+	0x00, 0x06, 0x03, 0x00, 0x00, 0x8e, 0x00, 0x05, 0x00, 0xb9, 0x01, 0x00, 0x00, 0x08, 0x03, 0x00, // ................
+	0x00, 0x05, 0x03, 0x00, 0x00, 0x07, 0x03, 0x00, 0x00, 0x6e, 0x00, 0x04, 0x00, 0x1d, 0x00, 0x00, // .........n......
+	0x00, 0x09, 0x03, 0x00, 0x00, 0x08, 0x03, 0x00, 0x00, 0x82, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, // ................
+	0x00, 0x0b, 0x03, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x82, 0x00, 0x05, // .....@...g......
+	0x00, 0x0a, 0x00, 0x00, 0x00, 0x0d, 0x03, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x67, 0x00, 0x00, // .........@...g..
+	0x00, 0x50, 0x00, 0x05, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x0e, 0x03, 0x00, 0x00, 0x0b, 0x03, 0x00, // .P..............
+	0x00, 0x0d, 0x03, 0x00, 0x00, 0x0c, 0x00, 0x07, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x0f, 0x03, 0x00, // ................
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x09, 0x03, 0x00, 0x00, 0x0e, 0x03, 0x00, // .....'..........
+	0x00, 0xf9, 0x00, 0x02, 0x00, 0x4b, 0x04, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x4b, 0x04, 0x00, // .....K.......K..
+	0x00, 0xf6, 0x00, 0x04, 0x00, 0x4c, 0x04, 0x00, 0x00, 0x4d, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, // .....L...M......
+	0x00, 0xf9, 0x00, 0x02, 0x00, 0x4e, 0x04, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x4e, 0x04, 0x00, // .....N.......N..
+	0x00, 0x41, 0x00, 0x06, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x4f, 0x04, 0x00, 0x00, 0x4b, 0x00, 0x00, // .A...N...O...K..
+	0x00, 0x3a, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, // .:...M...=......
+	0x00, 0x50, 0x04, 0x00, 0x00, 0x4f, 0x04, 0x00, 0x00, 0xb6, 0x00, 0x05, 0x00, 0x52, 0x00, 0x00, // .P...O.......R..
+	0x00, 0x51, 0x04, 0x00, 0x00, 0x50, 0x04, 0x00, 0x00, 0x51, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, // .Q...P...Q......
+	0x00, 0x52, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x51, 0x04, 0x00, // .R...........Q..
+	0x00, 0x53, 0x04, 0x00, 0x00, 0x52, 0x04, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x53, 0x04, 0x00, // .S...R.......S..
+	0x00, 0x51, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x56, 0x04, 0x00, 0x00, 0x0f, 0x03, 0x00, // .Q.......V......
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x57, 0x04, 0x00, // .....Q.......W..
+	0x00, 0x0f, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x50, 0x00, 0x06, 0x00, 0x0b, 0x00, 0x00, // .........P......
+	0x00, 0x58, 0x04, 0x00, 0x00, 0x56, 0x04, 0x00, 0x00, 0x57, 0x04, 0x00, 0x00, 0xff, 0x04, 0x00, // .X...V...W......
+	0x00, 0x5f, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x96, 0x04, 0x00, 0x00, 0x32, 0x00, 0x00, // ._...........2..
+	0x00, 0x58, 0x04, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x05, // .X.......:......
+	0x00, 0x0d, 0x00, 0x00, 0x00, 0x5b, 0x04, 0x00, 0x00, 0x96, 0x04, 0x00, 0x00, 0x5f, 0x00, 0x00, // .....[......._..
+	0x00, 0xf9, 0x00, 0x02, 0x00, 0x4c, 0x04, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x52, 0x04, 0x00, // .....L.......R..
+	0x00, 0x41, 0x00, 0x06, 0x00, 0x4e, 0x00, 0x00, 0x00, 0x5c, 0x04, 0x00, 0x00, 0x4b, 0x00, 0x00, // .A...N.......K..
+	0x00, 0x3a, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, // .:...c...=......
+	0x00, 0x5d, 0x04, 0x00, 0x00, 0x5c, 0x04, 0x00, 0x00, 0x6e, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, // .].......n......
+	0x00, 0x5e, 0x04, 0x00, 0x00, 0x5d, 0x04, 0x00, 0x00, 0x82, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, // .^...]..........
+	0x00, 0x5f, 0x04, 0x00, 0x00, 0x5e, 0x04, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, // ._...^...g...Q..
+	0x00, 0x0a, 0x00, 0x00, 0x00, 0x61, 0x04, 0x00, 0x00, 0x0f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, // .....a..........
+	0x00, 0x84, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x62, 0x04, 0x00, 0x00, 0x61, 0x04, 0x00, // .........b...a..
+	0x00, 0x6d, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x07, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x64, 0x04, 0x00, // .m...........d..
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x62, 0x04, 0x00, 0x00, 0x5f, 0x04, 0x00, // .....'...b..._..
+	0x00, 0x51, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x66, 0x04, 0x00, 0x00, 0x0f, 0x03, 0x00, // .Q.......f......
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x67, 0x04, 0x00, // .............g..
+	0x00, 0x66, 0x04, 0x00, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, // .f...m..........
+	0x00, 0x68, 0x04, 0x00, 0x00, 0x67, 0x04, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x07, // .h...g...g......
+	0x00, 0x0a, 0x00, 0x00, 0x00, 0x6a, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, // .....j.......'..
+	0x00, 0x68, 0x04, 0x00, 0x00, 0x5f, 0x04, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, // .h..._...Q......
+	0x00, 0x6c, 0x04, 0x00, 0x00, 0x0f, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x84, 0x00, 0x05, // .l..............
+	0x00, 0x0a, 0x00, 0x00, 0x00, 0x6d, 0x04, 0x00, 0x00, 0x6c, 0x04, 0x00, 0x00, 0x6d, 0x00, 0x00, // .....m...l...m..
+	0x00, 0x0c, 0x00, 0x07, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x6f, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, // .........o......
+	0x00, 0x27, 0x00, 0x00, 0x00, 0x6d, 0x04, 0x00, 0x00, 0x5f, 0x04, 0x00, 0x00, 0x51, 0x00, 0x05, // .'...m..._...Q..
+	0x00, 0x0a, 0x00, 0x00, 0x00, 0x71, 0x04, 0x00, 0x00, 0x0f, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, // .....q..........
+	0x00, 0x84, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x72, 0x04, 0x00, 0x00, 0x71, 0x04, 0x00, // .........r...q..
+	0x00, 0x6d, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x73, 0x04, 0x00, // .m...........s..
+	0x00, 0x72, 0x04, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x07, 0x00, 0x0a, 0x00, 0x00, // .r...g..........
+	0x00, 0x75, 0x04, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x73, 0x04, 0x00, // .u.......'...s..
+	0x00, 0x5f, 0x04, 0x00, 0x00, 0x50, 0x00, 0x06, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x79, 0x04, 0x00, // ._...P.......y..
+	0x00, 0x64, 0x04, 0x00, 0x00, 0x6f, 0x04, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0x5f, 0x00, 0x07, // .d...o......._..
+	0x00, 0x0d, 0x00, 0x00, 0x00, 0x9b, 0x04, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x79, 0x04, 0x00, // .........2...y..
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x50, 0x00, 0x06, 0x00, 0x0b, 0x00, 0x00, // .....:...P......
+	0x00, 0x7f, 0x04, 0x00, 0x00, 0x6a, 0x04, 0x00, 0x00, 0x6f, 0x04, 0x00, 0x00, 0xff, 0x04, 0x00, // .....j...o......
+	0x00, 0x5f, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x00, 0x00, 0xa0, 0x04, 0x00, 0x00, 0x32, 0x00, 0x00, // ._...........2..
+	0x00, 0x7f, 0x04, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x81, 0x00, 0x05, // .........:......
+	0x00, 0x0d, 0x00, 0x00, 0x00, 0x82, 0x04, 0x00, 0x00, 0x9b, 0x04, 0x00, 0x00, 0xa0, 0x04, 0x00, // ................
+	0x00, 0x50, 0x00, 0x06, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x86, 0x04, 0x00, 0x00, 0x64, 0x04, 0x00, // .P...........d..
+	0x00, 0x75, 0x04, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0x5f, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x00, // .u......._......
+	0x00, 0xa5, 0x04, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x86, 0x04, 0x00, 0x00, 0x02, 0x00, 0x00, // .....2..........
+	0x00, 0x3a, 0x00, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x89, 0x04, 0x00, // .:..............
+	0x00, 0x82, 0x04, 0x00, 0x00, 0xa5, 0x04, 0x00, 0x00, 0x50, 0x00, 0x06, 0x00, 0x0b, 0x00, 0x00, // .........P......
+	0x00, 0x8d, 0x04, 0x00, 0x00, 0x6a, 0x04, 0x00, 0x00, 0x75, 0x04, 0x00, 0x00, 0xff, 0x04, 0x00, // .....j...u......
+	0x00, 0x5f, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x00, 0x00, 0xaa, 0x04, 0x00, 0x00, 0x32, 0x00, 0x00, // ._...........2..
+	0x00, 0x8d, 0x04, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x81, 0x00, 0x05, // .........:......
+	0x00, 0x0d, 0x00, 0x00, 0x00, 0x90, 0x04, 0x00, 0x00, 0x89, 0x04, 0x00, 0x00, 0xaa, 0x04, 0x00, // ................
+	0x00, 0xf9, 0x00, 0x02, 0x00, 0x4c, 0x04, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x4d, 0x04, 0x00, // .....L.......M..
+	0x00, 0xf9, 0x00, 0x02, 0x00, 0x4b, 0x04, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x4c, 0x04, 0x00, // .....K.......L..
+	0x00, 0xf5, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x06, 0x05, 0x00, 0x00, 0x5b, 0x04, 0x00, // .............[..
+	0x00, 0x53, 0x04, 0x00, 0x00, 0x90, 0x04, 0x00, 0x00, 0x52, 0x04, 0x00, 0x00, 0x81, 0x00, 0x05, // .S.......R......
+	0x00, 0x0d, 0x00, 0x00, 0x00, 0x14, 0x03, 0x00, 0x00, 0x09, 0x05, 0x00, 0x00, 0x06, 0x05, 0x00, // ................
+	0x00, 0x81, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x16, 0x03, 0x00, 0x00, 0x15, 0x05, 0x00, // ................
+	0x00, 0xb6, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0xb4, 0x02, 0x00, 0x00, 0xf8, 0x00, 0x02, // ................
+	0x00, 0xb4, 0x02, 0x00, 0x00, 0xf5, 0x00, 0x07, 0x00, 0x06, 0x00, 0x00, 0x00, 0x34, 0x05, 0x00, // .............4..
+	0x00, 0x15, 0x05, 0x00, 0x00, 0xd6, 0x02, 0x00, 0x00, 0x16, 0x03, 0x00, 0x00, 0x4c, 0x04, 0x00, // .............L..
+	0x00, 0xf5, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x32, 0x05, 0x00, 0x00, 0x09, 0x05, 0x00, // .........2......
+	0x00, 0xd6, 0x02, 0x00, 0x00, 0x14, 0x03, 0x00, 0x00, 0x4c, 0x04, 0x00, 0x00, 0x80, 0x00, 0x05, // .........L......
+	0x00, 0x0a, 0x00, 0x00, 0x00, 0x18, 0x03, 0x00, 0x00, 0xff, 0x04, 0x00, 0x00, 0x67, 0x00, 0x00, // .............g..
+	0x00, 0xf9, 0x00, 0x02, 0x00, 0xb2, 0x02, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xb3, 0x02, 0x00, // ................
+	0x00, 0xf9, 0x00, 0x02, 0x00, 0x71, 0x02, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x71, 0x02, 0x00, // .....q.......q..
+	0x00, 0xf5, 0x00, 0x07, 0x00, 0x06, 0x00, 0x00, 0x00, 0x27, 0x05, 0x00, 0x00, 0xb6, 0x00, 0x00, // .........'......
+	0x00, 0x4a, 0x02, 0x00, 0x00, 0x15, 0x05, 0x00, 0x00, 0xb3, 0x02, 0x00, 0x00, 0xf5, 0x00, 0x07, // .J..............
+	0x00, 0x0d, 0x00, 0x00, 0x00, 0x25, 0x05, 0x00, 0x00, 0xfc, 0x04, 0x00, 0x00, 0x4a, 0x02, 0x00, // .....%.......J..
+	0x00, 0x09, 0x05, 0x00, 0x00, 0xb3, 0x02, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x48, 0x02, 0x00, // .............H..
+	0x00, 0xf8, 0x00, 0x02, 0x00, 0x49, 0x02, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x4b, 0x02, 0x00, // .....I.......K..
+	0x00, 0xf8, 0x00, 0x02, 0x00, 0x4b, 0x02, 0x00, 0x00, 0xf5, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x00, // .....K..........
+	0x00, 0x24, 0x05, 0x00, 0x00, 0xfc, 0x04, 0x00, 0x00, 0x49, 0x02, 0x00, 0x00, 0x36, 0x05, 0x00, // .$.......I...6..
+	0x00, 0x56, 0x02, 0x00, 0x00, 0xf5, 0x00, 0x07, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x22, 0x05, 0x00, // .V..........."..
+	0x00, 0x3a, 0x00, 0x00, 0x00, 0x49, 0x02, 0x00, 0x00, 0x5d, 0x02, 0x00, 0x00, 0x56, 0x02, 0x00, // .:...I...]...V..
+	0x00, 0xb1, 0x00, 0x05, 0x00, 0x52, 0x00, 0x00, 0x00, 0x50, 0x02, 0x00, 0x00, 0x22, 0x05, 0x00, // .....R...P..."..
+	0x00, 0xef, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x04, 0x00, 0x4c, 0x02, 0x00, 0x00, 0x56, 0x02, 0x00, // .........L...V..
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x50, 0x02, 0x00, 0x00, 0x51, 0x02, 0x00, // .........P...Q..
+	0x00, 0x4c, 0x02, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x51, 0x02, 0x00, 0x00, 0x51, 0x00, 0x05, // .L.......Q...Q..
+	0x00, 0x0a, 0x00, 0x00, 0x00, 0x54, 0x02, 0x00, 0x00, 0xe1, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, // .....T..........
+	0x00, 0xab, 0x00, 0x05, 0x00, 0x52, 0x00, 0x00, 0x00, 0x55, 0x02, 0x00, 0x00, 0x22, 0x05, 0x00, // .....R...U..."..
+	0x00, 0x54, 0x02, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0x56, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, // .T.......V......
+	0x00, 0xfa, 0x00, 0x04, 0x00, 0x55, 0x02, 0x00, 0x00, 0x57, 0x02, 0x00, 0x00, 0x56, 0x02, 0x00, // .....U...W...V..
+	0x00, 0xf8, 0x00, 0x02, 0x00, 0x57, 0x02, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0xa5, 0x03, 0x00, // .....W..........
+	0x00, 0xf8, 0x00, 0x02, 0x00, 0xa5, 0x03, 0x00, 0x00, 0xf6, 0x00, 0x04, 0x00, 0xa6, 0x03, 0x00, // ................
+	0x00, 0xa7, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0xa8, 0x03, 0x00, // ................
+	0x00, 0xf8, 0x00, 0x02, 0x00, 0xa8, 0x03, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00, 0x4e, 0x00, 0x00, // .........A...N..
+	0x00, 0xa9, 0x03, 0x00, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x00, // .....K...:...M..
+	0x00, 0x3d, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0xaa, 0x03, 0x00, 0x00, 0xa9, 0x03, 0x00, // .=..............
+	0x00, 0xb6, 0x00, 0x05, 0x00, 0x52, 0x00, 0x00, 0x00, 0xab, 0x03, 0x00, 0x00, 0xaa, 0x03, 0x00, // .....R..........
+	0x00, 0x51, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0xac, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, // .Q..............
+	0x00, 0xfa, 0x00, 0x04, 0x00, 0xab, 0x03, 0x00, 0x00, 0xad, 0x03, 0x00, 0x00, 0xac, 0x03, 0x00, // ................
+	0x00, 0xf8, 0x00, 0x02, 0x00, 0xad, 0x03, 0x00, 0x00, 0x50, 0x00, 0x06, 0x00, 0x0b, 0x00, 0x00, // .........P......
+	0x00, 0xb2, 0x03, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x22, 0x05, 0x00, // .....:...:..."..
+	0x00, 0x5f, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x00, 0x00, 0xf0, 0x03, 0x00, 0x00, 0x32, 0x00, 0x00, // ._...........2..
+	0x00, 0xb2, 0x03, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x05, // .........:......
+	0x00, 0x0d, 0x00, 0x00, 0x00, 0xb5, 0x03, 0x00, 0x00, 0xf0, 0x03, 0x00, 0x00, 0x5f, 0x00, 0x00, // ............._..
+	0x00, 0xf9, 0x00, 0x02, 0x00, 0xa6, 0x03, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xac, 0x03, 0x00, // ................
+	0x00, 0x41, 0x00, 0x06, 0x00, 0x4e, 0x00, 0x00, 0x00, 0xb6, 0x03, 0x00, 0x00, 0x4b, 0x00, 0x00, // .A...N.......K..
+	0x00, 0x3a, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, // .:...c...=......
+	0x00, 0xb7, 0x03, 0x00, 0x00, 0xb6, 0x03, 0x00, 0x00, 0x6e, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x00, // .........n......
+	0x00, 0xb8, 0x03, 0x00, 0x00, 0xb7, 0x03, 0x00, 0x00, 0x82, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, // ................
+	0x00, 0xb9, 0x03, 0x00, 0x00, 0xb8, 0x03, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x07, // .........g......
+	0x00, 0x0a, 0x00, 0x00, 0x00, 0xbe, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, // .............'..
+	0x00, 0x3a, 0x00, 0x00, 0x00, 0xb9, 0x03, 0x00, 0x00, 0x0c, 0x00, 0x07, 0x00, 0x0a, 0x00, 0x00, // .:..............
+	0x00, 0xc4, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00, // .........'...g..
+	0x00, 0xb9, 0x03, 0x00, 0x00, 0x0c, 0x00, 0x07, 0x00, 0x0a, 0x00, 0x00, 0x00, 0xc9, 0x03, 0x00, // ................
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0xb9, 0x03, 0x00, // .....'...:......
+	0x00, 0x0c, 0x00, 0x07, 0x00, 0x0a, 0x00, 0x00, 0x00, 0xcf, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, // ................
+	0x00, 0x27, 0x00, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0xb9, 0x03, 0x00, 0x00, 0x50, 0x00, 0x06, // .'...g.......P..
+	0x00, 0x0b, 0x00, 0x00, 0x00, 0xd3, 0x03, 0x00, 0x00, 0xbe, 0x03, 0x00, 0x00, 0xc9, 0x03, 0x00, // ................
+	0x00, 0x22, 0x05, 0x00, 0x00, 0x5f, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x00, 0x00, 0xf5, 0x03, 0x00, // ."..._..........
+	0x00, 0x32, 0x00, 0x00, 0x00, 0xd3, 0x03, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, // .2...........:..
+	0x00, 0x50, 0x00, 0x06, 0x00, 0x0b, 0x00, 0x00, 0x00, 0xd9, 0x03, 0x00, 0x00, 0xc4, 0x03, 0x00, // .P..............
+	0x00, 0xc9, 0x03, 0x00, 0x00, 0x22, 0x05, 0x00, 0x00, 0x5f, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x00, // ....."..._......
+	0x00, 0xfa, 0x03, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0xd9, 0x03, 0x00, 0x00, 0x02, 0x00, 0x00, // .....2..........
+	0x00, 0x3a, 0x00, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00, 0x0d, 0x00, 0x00, 0x00, 0xdc, 0x03, 0x00, // .:..............
+	0x00, 0xf5, 0x03, 0x00, 0x00, 0xfa, 0x03, 0x00, 0x00, 0x50, 0x00, 0x06, 0x00, 0x0b, 0x00, 0x00, // .........P......
+	0x00, 0xe0, 0x03, 0x00, 0x00, 0xbe, 0x03, 0x00, 0x00, 0xcf, 0x03, 0x00, 0x00, 0x22, 0x05, 0x00, // ............."..
+	0x00, 0x5f, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x00, 0x00, 0xff, 0x03, 0x00, 0x00, 0x32, 0x00, 0x00, // ._...........2..
+	0x00, 0xe0, 0x03, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x81, 0x00, 0x05, // .........:......
+	0x00, 0x0d, 0x00, 0x00, 0x00, 0xe3, 0x03, 0x00, 0x00, 0xdc, 0x03, 0x00, 0x00, 0xff, 0x03, 0x00, // ................
+	0x00, 0x50, 0x00, 0x06, 0x00, 0x0b, 0x00, 0x00, 0x00, 0xe7, 0x03, 0x00, 0x00, 0xc4, 0x03, 0x00, // .P..............
+	0x00, 0xcf, 0x03, 0x00, 0x00, 0x22, 0x05, 0x00, 0x00, 0x5f, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x00, // ....."..._......
+	0x00, 0x04, 0x04, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0xe7, 0x03, 0x00, 0x00, 0x02, 0x00, 0x00, // .....2..........
+	0x00, 0x3a, 0x00, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00, 0x0d, 0x00, 0x00, 0x00, 0xea, 0x03, 0x00, // .:..............
+	0x00, 0xe3, 0x03, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0xa6, 0x03, 0x00, // ................
+	0x00, 0xf8, 0x00, 0x02, 0x00, 0xa7, 0x03, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0xa5, 0x03, 0x00, // ................
+	0x00, 0xf8, 0x00, 0x02, 0x00, 0xa6, 0x03, 0x00, 0x00, 0xf5, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x00, // ................
+	0x00, 0x28, 0x05, 0x00, 0x00, 0xb5, 0x03, 0x00, 0x00, 0xad, 0x03, 0x00, 0x00, 0xea, 0x03, 0x00, // .(..............
+	0x00, 0xac, 0x03, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x5b, 0x02, 0x00, // .............[..
+	0x00, 0x24, 0x05, 0x00, 0x00, 0x28, 0x05, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x56, 0x02, 0x00, // .$...(.......V..
+	0x00, 0xf8, 0x00, 0x02, 0x00, 0x56, 0x02, 0x00, 0x00, 0xf5, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x00, // .....V..........
+	0x00, 0x36, 0x05, 0x00, 0x00, 0x24, 0x05, 0x00, 0x00, 0x51, 0x02, 0x00, 0x00, 0x5b, 0x02, 0x00, // .6...$...Q...[..
+	0x00, 0xa6, 0x03, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x5d, 0x02, 0x00, // .............]..
+	0x00, 0x22, 0x05, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x4b, 0x02, 0x00, // ."...g.......K..
+	0x00, 0xf8, 0x00, 0x02, 0x00, 0x4c, 0x02, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x48, 0x02, 0x00, // .....L.......H..
+	0x00, 0xf8, 0x00, 0x02, 0x00, 0x48, 0x02, 0x00, 0x00, 0xf5, 0x00, 0x07, 0x00, 0x06, 0x00, 0x00, // .....H..........
+	0x00, 0x26, 0x05, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x4c, 0x02, 0x00, 0x00, 0x27, 0x05, 0x00, // .&.......L...'..
+	0x00, 0x71, 0x02, 0x00, 0x00, 0xf5, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x23, 0x05, 0x00, // .q...........#..
+	0x00, 0x24, 0x05, 0x00, 0x00, 0x4c, 0x02, 0x00, 0x00, 0x25, 0x05, 0x00, 0x00, 0x71, 0x02, 0x00, // .$...L...%...q..
+	0x00, 0x85, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x1b, 0x03, 0x00, 0x00, 0x26, 0x05, 0x00, // .............&..
+	0x00, 0x5f, 0x00, 0x00, 0x00, 0x50, 0x00, 0x07, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x1c, 0x03, 0x00, // ._...P..........
+	0x00, 0x1b, 0x03, 0x00, 0x00, 0x1b, 0x03, 0x00, 0x00, 0x1b, 0x03, 0x00, 0x00, 0x1b, 0x03, 0x00, // ................
+	0x00, 0x88, 0x00, 0x05, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x1d, 0x03, 0x00, 0x00, 0x23, 0x05, 0x00, // .............#..
+	0x00, 0x1c, 0x03, 0x00, 0x00, 0x63, 0x00, 0x04, 0x00, 0x38, 0x00, 0x00, 0x00, 0xe1, 0x01, 0x00, // .....c...8......
+	0x00, 0x1d, 0x03, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x2b, 0x02, 0x00, 0x00, 0xf8, 0x00, 0x02, // .........+......
+	0x00, 0x2c, 0x02, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x2a, 0x02, 0x00, 0x00, 0xf8, 0x00, 0x02, // .,.......*......
+	0x00, 0x2b, 0x02, 0x00, 0x00, 0xfd, 0x00, 0x01, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, // .+.......8......
+	0x00,                                                                                           // .
+};
+
+static const uint8_t downsample_shader_compute_mtl[9531] =
+{
+	0x43, 0x53, 0x48, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x0a, 0x75, // CSH............u
+	0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x02, 0x01, 0x00, 0x00, 0x01, 0x00, 0x07, // _settings.......
+	0x73, 0x5f, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, // s_input.........
+	0x00, 0x01, 0x00, 0x00, 0x25, 0x00, 0x00, 0x23, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x20, // ....%..#include 
+	0x3c, 0x6d, 0x65, 0x74, 0x61, 0x6c, 0x5f, 0x73, 0x74, 0x64, 0x6c, 0x69, 0x62, 0x3e, 0x0a, 0x23, // <metal_stdlib>.#
+	0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x20, 0x3c, 0x73, 0x69, 0x6d, 0x64, 0x2f, 0x73, 0x69, // include <simd/si
+	0x6d, 0x64, 0x2e, 0x68, 0x3e, 0x0a, 0x0a, 0x75, 0x73, 0x69, 0x6e, 0x67, 0x20, 0x6e, 0x61, 0x6d, // md.h>..using nam
+	0x65, 0x73, 0x70, 0x61, 0x63, 0x65, 0x20, 0x6d, 0x65, 0x74, 0x61, 0x6c, 0x3b, 0x0a, 0x0a, 0x73, // espace metal;..s
+	0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x5f, 0x47, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x0a, 0x7b, 0x0a, // truct _Global.{.
+	0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x20, 0x75, 0x5f, 0x73, 0x65, 0x74, //     float4 u_set
+	0x74, 0x69, 0x6e, 0x67, 0x73, 0x3b, 0x0a, 0x7d, 0x3b, 0x0a, 0x0a, 0x6b, 0x65, 0x72, 0x6e, 0x65, // tings;.};..kerne
+	0x6c, 0x20, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x78, 0x6c, 0x61, 0x74, 0x4d, 0x74, 0x6c, 0x4d, 0x61, // l void xlatMtlMa
+	0x69, 0x6e, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x20, 0x5f, 0x47, 0x6c, 0x6f, // in(constant _Glo
+	0x62, 0x61, 0x6c, 0x26, 0x20, 0x5f, 0x6d, 0x74, 0x6c, 0x5f, 0x75, 0x20, 0x5b, 0x5b, 0x62, 0x75, // bal& _mtl_u [[bu
+	0x66, 0x66, 0x65, 0x72, 0x28, 0x30, 0x29, 0x5d, 0x5d, 0x2c, 0x20, 0x74, 0x65, 0x78, 0x74, 0x75, // ffer(0)]], textu
+	0x72, 0x65, 0x32, 0x64, 0x5f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x3c, 0x66, 0x6c, 0x6f, 0x61, 0x74, // re2d_array<float
+	0x3e, 0x20, 0x73, 0x5f, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x20, 0x5b, 0x5b, 0x74, 0x65, 0x78, 0x74, // > s_input [[text
+	0x75, 0x72, 0x65, 0x28, 0x30, 0x29, 0x5d, 0x5d, 0x2c, 0x20, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, // ure(0)]], textur
+	0x65, 0x32, 0x64, 0x5f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x3c, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x2c, // e2d_array<float,
+	0x20, 0x61, 0x63, 0x63, 0x65, 0x73, 0x73, 0x3a, 0x3a, 0x77, 0x72, 0x69, 0x74, 0x65, 0x3e, 0x20, //  access::write> 
+	0x73, 0x5f, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x54, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x20, // s_outputTexture 
+	0x5b, 0x5b, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x28, 0x31, 0x29, 0x5d, 0x5d, 0x2c, 0x20, // [[texture(1)]], 
+	0x75, 0x69, 0x6e, 0x74, 0x33, 0x20, 0x67, 0x6c, 0x5f, 0x47, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x49, // uint3 gl_GlobalI
+	0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x49, 0x44, 0x20, 0x5b, 0x5b, 0x74, 0x68, // nvocationID [[th
+	0x72, 0x65, 0x61, 0x64, 0x5f, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x69, 0x6e, // read_position_in
+	0x5f, 0x67, 0x72, 0x69, 0x64, 0x5d, 0x5d, 0x29, 0x0a, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, // _grid]]).{.    f
+	0x6f, 0x72, 0x20, 0x28, 0x3b, 0x3b, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, // or (;;).    {.  
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x28, 0x66, 0x6c, 0x6f, 0x61, 0x74, //       if ((float
+	0x28, 0x69, 0x6e, 0x74, 0x33, 0x28, 0x67, 0x6c, 0x5f, 0x47, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x49, // (int3(gl_GlobalI
+	0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x49, 0x44, 0x29, 0x2e, 0x78, 0x29, 0x20, // nvocationID).x) 
+	0x3e, 0x3d, 0x20, 0x5f, 0x6d, 0x74, 0x6c, 0x5f, 0x75, 0x2e, 0x75, 0x5f, 0x73, 0x65, 0x74, 0x74, // >= _mtl_u.u_sett
+	0x69, 0x6e, 0x67, 0x73, 0x2e, 0x78, 0x29, 0x20, 0x7c, 0x7c, 0x20, 0x28, 0x66, 0x6c, 0x6f, 0x61, // ings.x) || (floa
+	0x74, 0x28, 0x69, 0x6e, 0x74, 0x33, 0x28, 0x67, 0x6c, 0x5f, 0x47, 0x6c, 0x6f, 0x62, 0x61, 0x6c, // t(int3(gl_Global
+	0x49, 0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x49, 0x44, 0x29, 0x2e, 0x79, 0x29, // InvocationID).y)
+	0x20, 0x3e, 0x3d, 0x20, 0x5f, 0x6d, 0x74, 0x6c, 0x5f, 0x75, 0x2e, 0x75, 0x5f, 0x73, 0x65, 0x74, //  >= _mtl_u.u_set
+	0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x78, 0x29, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // tings.x)).      
+	0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //   {.            
+	0x62, 0x72, 0x65, 0x61, 0x6b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, // break;.        }
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x35, 0x37, // .        int _57
+	0x36, 0x20, 0x3d, 0x20, 0x69, 0x6e, 0x74, 0x28, 0x5f, 0x6d, 0x74, 0x6c, 0x5f, 0x75, 0x2e, 0x75, // 6 = int(_mtl_u.u
+	0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x78, 0x29, 0x3b, 0x0a, 0x20, 0x20, // _settings.x);.  
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x20, 0x5f, 0x31, 0x32, //       float4 _12
+	0x37, 0x36, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x20, // 76;.        for 
+	0x28, 0x3b, 0x3b, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, // (;;).        {. 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x5f, //            if (_
+	0x6d, 0x74, 0x6c, 0x5f, 0x75, 0x2e, 0x75, 0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, // mtl_u.u_settings
+	0x2e, 0x7a, 0x20, 0x21, 0x3d, 0x20, 0x30, 0x2e, 0x30, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, // .z != 0.0).     
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //        {.       
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x31, 0x32, 0x37, 0x36, 0x20, 0x3d, //          _1276 =
+	0x20, 0x73, 0x5f, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x2e, 0x72, 0x65, 0x61, 0x64, 0x28, 0x75, 0x69, //  s_input.read(ui
+	0x6e, 0x74, 0x32, 0x28, 0x69, 0x6e, 0x74, 0x33, 0x28, 0x67, 0x6c, 0x5f, 0x47, 0x6c, 0x6f, 0x62, // nt2(int3(gl_Glob
+	0x61, 0x6c, 0x49, 0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x49, 0x44, 0x29, 0x2e, // alInvocationID).
+	0x78, 0x79, 0x29, 0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x28, 0x69, 0x6e, 0x74, 0x33, 0x28, 0x67, // xy), uint(int3(g
+	0x6c, 0x5f, 0x47, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x49, 0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, 0x69, // l_GlobalInvocati
+	0x6f, 0x6e, 0x49, 0x44, 0x29, 0x2e, 0x7a, 0x29, 0x2c, 0x20, 0x30, 0x29, 0x20, 0x2a, 0x20, 0x34, // onID).z), 0) * 4
+	0x2e, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // .0;.            
+	0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, //     break;.     
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //        }.       
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x38, 0x33, 0x39, 0x20, 0x3d, 0x20, //      int _839 = 
+	0x69, 0x6e, 0x74, 0x28, 0x5f, 0x6d, 0x74, 0x6c, 0x5f, 0x75, 0x2e, 0x75, 0x5f, 0x73, 0x65, 0x74, // int(_mtl_u.u_set
+	0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x79, 0x29, 0x20, 0x2d, 0x20, 0x31, 0x3b, 0x0a, 0x20, 0x20, // tings.y) - 1;.  
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x38, //           int _8
+	0x34, 0x34, 0x20, 0x3d, 0x20, 0x6d, 0x69, 0x6e, 0x28, 0x28, 0x69, 0x6e, 0x74, 0x33, 0x28, 0x67, // 44 = min((int3(g
+	0x6c, 0x5f, 0x47, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x49, 0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, 0x69, // l_GlobalInvocati
+	0x6f, 0x6e, 0x49, 0x44, 0x29, 0x2e, 0x78, 0x20, 0x2a, 0x20, 0x32, 0x29, 0x2c, 0x20, 0x5f, 0x38, // onID).x * 2), _8
+	0x33, 0x39, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 39);.           
+	0x20, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x38, 0x35, 0x30, 0x20, 0x3d, 0x20, 0x6d, 0x69, 0x6e, 0x28, //  int _850 = min(
+	0x28, 0x28, 0x69, 0x6e, 0x74, 0x33, 0x28, 0x67, 0x6c, 0x5f, 0x47, 0x6c, 0x6f, 0x62, 0x61, 0x6c, // ((int3(gl_Global
+	0x49, 0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x49, 0x44, 0x29, 0x2e, 0x78, 0x20, // InvocationID).x 
+	0x2a, 0x20, 0x32, 0x29, 0x20, 0x2b, 0x20, 0x31, 0x29, 0x2c, 0x20, 0x5f, 0x38, 0x33, 0x39, 0x29, // * 2) + 1), _839)
+	0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6e, // ;.            in
+	0x74, 0x20, 0x5f, 0x38, 0x35, 0x35, 0x20, 0x3d, 0x20, 0x6d, 0x69, 0x6e, 0x28, 0x28, 0x69, 0x6e, // t _855 = min((in
+	0x74, 0x33, 0x28, 0x67, 0x6c, 0x5f, 0x47, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x49, 0x6e, 0x76, 0x6f, // t3(gl_GlobalInvo
+	0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x49, 0x44, 0x29, 0x2e, 0x79, 0x20, 0x2a, 0x20, 0x32, 0x29, // cationID).y * 2)
+	0x2c, 0x20, 0x5f, 0x38, 0x33, 0x39, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // , _839);.       
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x38, 0x36, 0x31, 0x20, 0x3d, 0x20, //      int _861 = 
+	0x6d, 0x69, 0x6e, 0x28, 0x28, 0x28, 0x69, 0x6e, 0x74, 0x33, 0x28, 0x67, 0x6c, 0x5f, 0x47, 0x6c, // min(((int3(gl_Gl
+	0x6f, 0x62, 0x61, 0x6c, 0x49, 0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x49, 0x44, // obalInvocationID
+	0x29, 0x2e, 0x79, 0x20, 0x2a, 0x20, 0x32, 0x29, 0x20, 0x2b, 0x20, 0x31, 0x29, 0x2c, 0x20, 0x5f, // ).y * 2) + 1), _
+	0x38, 0x33, 0x39, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 839);.          
+	0x20, 0x20, 0x69, 0x6e, 0x74, 0x33, 0x20, 0x5f, 0x38, 0x36, 0x35, 0x20, 0x3d, 0x20, 0x69, 0x6e, //   int3 _865 = in
+	0x74, 0x33, 0x28, 0x5f, 0x38, 0x34, 0x34, 0x2c, 0x20, 0x5f, 0x38, 0x35, 0x35, 0x2c, 0x20, 0x69, // t3(_844, _855, i
+	0x6e, 0x74, 0x33, 0x28, 0x67, 0x6c, 0x5f, 0x47, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x49, 0x6e, 0x76, // nt3(gl_GlobalInv
+	0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x49, 0x44, 0x29, 0x2e, 0x7a, 0x29, 0x3b, 0x0a, 0x20, // ocationID).z);. 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x33, 0x20, //            int3 
+	0x5f, 0x38, 0x37, 0x31, 0x20, 0x3d, 0x20, 0x69, 0x6e, 0x74, 0x33, 0x28, 0x5f, 0x38, 0x35, 0x30, // _871 = int3(_850
+	0x2c, 0x20, 0x5f, 0x38, 0x35, 0x35, 0x2c, 0x20, 0x69, 0x6e, 0x74, 0x33, 0x28, 0x67, 0x6c, 0x5f, // , _855, int3(gl_
+	0x47, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x49, 0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, // GlobalInvocation
+	0x49, 0x44, 0x29, 0x2e, 0x7a, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // ID).z);.        
+	0x20, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x33, 0x20, 0x5f, 0x38, 0x37, 0x38, 0x20, 0x3d, 0x20, //     int3 _878 = 
+	0x69, 0x6e, 0x74, 0x33, 0x28, 0x5f, 0x38, 0x34, 0x34, 0x2c, 0x20, 0x5f, 0x38, 0x36, 0x31, 0x2c, // int3(_844, _861,
+	0x20, 0x69, 0x6e, 0x74, 0x33, 0x28, 0x67, 0x6c, 0x5f, 0x47, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x49, //  int3(gl_GlobalI
+	0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x49, 0x44, 0x29, 0x2e, 0x7a, 0x29, 0x3b, // nvocationID).z);
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x74, // .            int
+	0x33, 0x20, 0x5f, 0x38, 0x38, 0x35, 0x20, 0x3d, 0x20, 0x69, 0x6e, 0x74, 0x33, 0x28, 0x5f, 0x38, // 3 _885 = int3(_8
+	0x35, 0x30, 0x2c, 0x20, 0x5f, 0x38, 0x36, 0x31, 0x2c, 0x20, 0x69, 0x6e, 0x74, 0x33, 0x28, 0x67, // 50, _861, int3(g
+	0x6c, 0x5f, 0x47, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x49, 0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, 0x69, // l_GlobalInvocati
+	0x6f, 0x6e, 0x49, 0x44, 0x29, 0x2e, 0x7a, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // onID).z);.      
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x31, 0x32, 0x37, 0x36, 0x20, 0x3d, 0x20, 0x28, 0x28, //       _1276 = ((
+	0x73, 0x5f, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x2e, 0x72, 0x65, 0x61, 0x64, 0x28, 0x75, 0x69, 0x6e, // s_input.read(uin
+	0x74, 0x32, 0x28, 0x5f, 0x38, 0x36, 0x35, 0x2e, 0x78, 0x79, 0x29, 0x2c, 0x20, 0x75, 0x69, 0x6e, // t2(_865.xy), uin
+	0x74, 0x28, 0x5f, 0x38, 0x36, 0x35, 0x2e, 0x7a, 0x29, 0x2c, 0x20, 0x30, 0x29, 0x20, 0x2b, 0x20, // t(_865.z), 0) + 
+	0x73, 0x5f, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x2e, 0x72, 0x65, 0x61, 0x64, 0x28, 0x75, 0x69, 0x6e, // s_input.read(uin
+	0x74, 0x32, 0x28, 0x5f, 0x38, 0x37, 0x31, 0x2e, 0x78, 0x79, 0x29, 0x2c, 0x20, 0x75, 0x69, 0x6e, // t2(_871.xy), uin
+	0x74, 0x28, 0x5f, 0x38, 0x37, 0x31, 0x2e, 0x7a, 0x29, 0x2c, 0x20, 0x30, 0x29, 0x29, 0x20, 0x2b, // t(_871.z), 0)) +
+	0x20, 0x73, 0x5f, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x2e, 0x72, 0x65, 0x61, 0x64, 0x28, 0x75, 0x69, //  s_input.read(ui
+	0x6e, 0x74, 0x32, 0x28, 0x5f, 0x38, 0x37, 0x38, 0x2e, 0x78, 0x79, 0x29, 0x2c, 0x20, 0x75, 0x69, // nt2(_878.xy), ui
+	0x6e, 0x74, 0x28, 0x5f, 0x38, 0x37, 0x38, 0x2e, 0x7a, 0x29, 0x2c, 0x20, 0x30, 0x29, 0x29, 0x20, // nt(_878.z), 0)) 
+	0x2b, 0x20, 0x73, 0x5f, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x2e, 0x72, 0x65, 0x61, 0x64, 0x28, 0x75, // + s_input.read(u
+	0x69, 0x6e, 0x74, 0x32, 0x28, 0x5f, 0x38, 0x38, 0x35, 0x2e, 0x78, 0x79, 0x29, 0x2c, 0x20, 0x75, // int2(_885.xy), u
+	0x69, 0x6e, 0x74, 0x28, 0x5f, 0x38, 0x38, 0x35, 0x2e, 0x7a, 0x29, 0x2c, 0x20, 0x30, 0x29, 0x3b, // int(_885.z), 0);
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, // .            bre
+	0x61, 0x6b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, // ak;.        }.  
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x20, 0x5f, 0x31, 0x33, //       float4 _13
+	0x31, 0x35, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, // 15;.        floa
+	0x74, 0x20, 0x5f, 0x31, 0x33, 0x31, 0x38, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // t _1318;.       
+	0x20, 0x69, 0x66, 0x20, 0x28, 0x5f, 0x35, 0x37, 0x36, 0x20, 0x3d, 0x3d, 0x20, 0x31, 0x29, 0x0a, //  if (_576 == 1).
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //         {.      
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x20, 0x5f, 0x31, 0x33, //       float4 _13
+	0x31, 0x36, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 16;.            
+	0x5f, 0x31, 0x33, 0x31, 0x36, 0x20, 0x3d, 0x20, 0x5f, 0x31, 0x32, 0x37, 0x36, 0x3b, 0x0a, 0x20, // _1316 = _1276;. 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, //            float
+	0x34, 0x20, 0x5f, 0x31, 0x33, 0x33, 0x34, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 4 _1334;.       
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x31, //      for (int _1
+	0x33, 0x31, 0x34, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x20, 0x5f, 0x31, 0x33, 0x31, 0x34, 0x20, 0x3c, // 314 = 0; _1314 <
+	0x20, 0x36, 0x3b, 0x20, 0x5f, 0x31, 0x33, 0x31, 0x36, 0x20, 0x3d, 0x20, 0x5f, 0x31, 0x33, 0x33, //  6; _1316 = _133
+	0x34, 0x2c, 0x20, 0x5f, 0x31, 0x33, 0x31, 0x34, 0x2b, 0x2b, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, // 4, _1314++).    
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //         {.      
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x5f, 0x31, //           if (_1
+	0x33, 0x31, 0x34, 0x20, 0x21, 0x3d, 0x20, 0x69, 0x6e, 0x74, 0x33, 0x28, 0x67, 0x6c, 0x5f, 0x47, // 314 != int3(gl_G
+	0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x49, 0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x49, // lobalInvocationI
+	0x44, 0x29, 0x2e, 0x7a, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // D).z).          
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //       {.        
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, //             floa
+	0x74, 0x34, 0x20, 0x5f, 0x31, 0x33, 0x32, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // t4 _1320;.      
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, //               fo
+	0x72, 0x20, 0x28, 0x3b, 0x3b, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // r (;;).         
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, //            {.   
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x5f, 0x6d, 0x74, 0x6c, 0x5f, 0x75, 0x2e, //      if (_mtl_u.
+	0x75, 0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x7a, 0x20, 0x21, 0x3d, 0x20, // u_settings.z != 
+	0x30, 0x2e, 0x30, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 0.0).           
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, //              {. 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x33, 0x20, //            int3 
+	0x5f, 0x39, 0x34, 0x36, 0x20, 0x3d, 0x20, 0x69, 0x6e, 0x74, 0x33, 0x28, 0x30, 0x2c, 0x20, 0x30, // _946 = int3(0, 0
+	0x2c, 0x20, 0x5f, 0x31, 0x33, 0x31, 0x34, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // , _1314);.      
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x31, 0x33, 0x32, 0x30, 0x20, 0x3d, 0x20, 0x73, 0x5f, //       _1320 = s_
+	0x69, 0x6e, 0x70, 0x75, 0x74, 0x2e, 0x72, 0x65, 0x61, 0x64, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x32, // input.read(uint2
+	0x28, 0x5f, 0x39, 0x34, 0x36, 0x2e, 0x78, 0x79, 0x29, 0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x28, // (_946.xy), uint(
+	0x5f, 0x39, 0x34, 0x36, 0x2e, 0x7a, 0x29, 0x2c, 0x20, 0x30, 0x29, 0x20, 0x2a, 0x20, 0x34, 0x2e, // _946.z), 0) * 4.
+	0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 0;.             
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, //                b
+	0x72, 0x65, 0x61, 0x6b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // reak;.          
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, //               }.
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x39, 0x35, 0x33, //         int _953
+	0x20, 0x3d, 0x20, 0x69, 0x6e, 0x74, 0x28, 0x5f, 0x6d, 0x74, 0x6c, 0x5f, 0x75, 0x2e, 0x75, 0x5f, //  = int(_mtl_u.u_
+	0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x79, 0x29, 0x20, 0x2d, 0x20, 0x31, 0x3b, // settings.y) - 1;
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // .               
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x39, 0x35, //          int _95
+	0x38, 0x20, 0x3d, 0x20, 0x6d, 0x69, 0x6e, 0x28, 0x30, 0x2c, 0x20, 0x5f, 0x39, 0x35, 0x33, 0x29, // 8 = min(0, _953)
+	0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // ;.              
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x39, //           int _9
+	0x36, 0x34, 0x20, 0x3d, 0x20, 0x6d, 0x69, 0x6e, 0x28, 0x31, 0x2c, 0x20, 0x5f, 0x39, 0x35, 0x33, // 64 = min(1, _953
+	0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // );.             
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x5f, //            int _
+	0x39, 0x36, 0x39, 0x20, 0x3d, 0x20, 0x6d, 0x69, 0x6e, 0x28, 0x30, 0x2c, 0x20, 0x5f, 0x39, 0x35, // 969 = min(0, _95
+	0x33, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 3);.            
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, //             int 
+	0x5f, 0x39, 0x37, 0x35, 0x20, 0x3d, 0x20, 0x6d, 0x69, 0x6e, 0x28, 0x31, 0x2c, 0x20, 0x5f, 0x39, // _975 = min(1, _9
+	0x35, 0x33, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 53);.           
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x74, //              int
+	0x33, 0x20, 0x5f, 0x39, 0x37, 0x39, 0x20, 0x3d, 0x20, 0x69, 0x6e, 0x74, 0x33, 0x28, 0x5f, 0x39, // 3 _979 = int3(_9
+	0x35, 0x38, 0x2c, 0x20, 0x5f, 0x39, 0x36, 0x39, 0x2c, 0x20, 0x5f, 0x31, 0x33, 0x31, 0x34, 0x29, // 58, _969, _1314)
+	0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // ;.              
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x33, 0x20, 0x5f, //           int3 _
+	0x39, 0x38, 0x35, 0x20, 0x3d, 0x20, 0x69, 0x6e, 0x74, 0x33, 0x28, 0x5f, 0x39, 0x36, 0x34, 0x2c, // 985 = int3(_964,
+	0x20, 0x5f, 0x39, 0x36, 0x39, 0x2c, 0x20, 0x5f, 0x31, 0x33, 0x31, 0x34, 0x29, 0x3b, 0x0a, 0x20, //  _969, _1314);. 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x33, 0x20, 0x5f, 0x39, 0x39, 0x32, //        int3 _992
+	0x20, 0x3d, 0x20, 0x69, 0x6e, 0x74, 0x33, 0x28, 0x5f, 0x39, 0x35, 0x38, 0x2c, 0x20, 0x5f, 0x39, //  = int3(_958, _9
+	0x37, 0x35, 0x2c, 0x20, 0x5f, 0x31, 0x33, 0x31, 0x34, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, // 75, _1314);.    
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x33, 0x20, 0x5f, 0x39, 0x39, 0x39, 0x20, 0x3d, 0x20, //     int3 _999 = 
+	0x69, 0x6e, 0x74, 0x33, 0x28, 0x5f, 0x39, 0x36, 0x34, 0x2c, 0x20, 0x5f, 0x39, 0x37, 0x35, 0x2c, // int3(_964, _975,
+	0x20, 0x5f, 0x31, 0x33, 0x31, 0x34, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //  _1314);.       
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x5f, 0x31, 0x33, 0x32, 0x30, 0x20, 0x3d, 0x20, 0x28, 0x28, 0x73, 0x5f, 0x69, 0x6e, 0x70, //  _1320 = ((s_inp
+	0x75, 0x74, 0x2e, 0x72, 0x65, 0x61, 0x64, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x32, 0x28, 0x5f, 0x39, // ut.read(uint2(_9
+	0x37, 0x39, 0x2e, 0x78, 0x79, 0x29, 0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x28, 0x5f, 0x39, 0x37, // 79.xy), uint(_97
+	0x39, 0x2e, 0x7a, 0x29, 0x2c, 0x20, 0x30, 0x29, 0x20, 0x2b, 0x20, 0x73, 0x5f, 0x69, 0x6e, 0x70, // 9.z), 0) + s_inp
+	0x75, 0x74, 0x2e, 0x72, 0x65, 0x61, 0x64, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x32, 0x28, 0x5f, 0x39, // ut.read(uint2(_9
+	0x38, 0x35, 0x2e, 0x78, 0x79, 0x29, 0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x28, 0x5f, 0x39, 0x38, // 85.xy), uint(_98
+	0x35, 0x2e, 0x7a, 0x29, 0x2c, 0x20, 0x30, 0x29, 0x29, 0x20, 0x2b, 0x20, 0x73, 0x5f, 0x69, 0x6e, // 5.z), 0)) + s_in
+	0x70, 0x75, 0x74, 0x2e, 0x72, 0x65, 0x61, 0x64, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x32, 0x28, 0x5f, // put.read(uint2(_
+	0x39, 0x39, 0x32, 0x2e, 0x78, 0x79, 0x29, 0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x28, 0x5f, 0x39, // 992.xy), uint(_9
+	0x39, 0x32, 0x2e, 0x7a, 0x29, 0x2c, 0x20, 0x30, 0x29, 0x29, 0x20, 0x2b, 0x20, 0x73, 0x5f, 0x69, // 92.z), 0)) + s_i
+	0x6e, 0x70, 0x75, 0x74, 0x2e, 0x72, 0x65, 0x61, 0x64, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x32, 0x28, // nput.read(uint2(
+	0x5f, 0x39, 0x39, 0x39, 0x2e, 0x78, 0x79, 0x29, 0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x28, 0x5f, // _999.xy), uint(_
+	0x39, 0x39, 0x39, 0x2e, 0x7a, 0x29, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, // 999.z), 0);.    
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, //     break;.     
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, //                }
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // .               
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x31, 0x33, 0x33, 0x34, 0x20, 0x3d, 0x20, 0x5f, 0x31, 0x33, //      _1334 = _13
+	0x31, 0x36, 0x20, 0x2b, 0x20, 0x5f, 0x31, 0x33, 0x32, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, // 16 + _1320;.    
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x63, 0x6f, 0x6e, 0x74, 0x69, 0x6e, 0x75, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // continue;.      
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, //           }.    
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6c, 0x73, 0x65, //             else
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // .               
+	0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //  {.             
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x31, 0x33, 0x33, 0x34, 0x20, 0x3d, 0x20, 0x5f, //        _1334 = _
+	0x31, 0x33, 0x31, 0x36, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 1316;.          
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x69, 0x6e, //           contin
+	0x75, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // ue;.            
+	0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //     }.          
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x69, 0x6e, 0x75, 0x65, 0x3b, 0x0a, //       continue;.
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, //             }.  
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x31, 0x33, 0x31, 0x38, 0x20, //           _1318 
+	0x3d, 0x20, 0x36, 0x2e, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // = 6.0;.         
+	0x20, 0x20, 0x20, 0x5f, 0x31, 0x33, 0x31, 0x35, 0x20, 0x3d, 0x20, 0x5f, 0x31, 0x33, 0x31, 0x36, //    _1315 = _1316
+	0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, // ;.        }.    
+	0x20, 0x20, 0x20, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //     else.       
+	0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, //  {.            f
+	0x6c, 0x6f, 0x61, 0x74, 0x34, 0x20, 0x5f, 0x31, 0x33, 0x31, 0x37, 0x3b, 0x0a, 0x20, 0x20, 0x20, // loat4 _1317;.   
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x5f, //          float _
+	0x31, 0x33, 0x31, 0x39, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 1319;.          
+	0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x28, 0x28, 0x28, 0x69, 0x6e, 0x74, 0x33, 0x28, 0x67, 0x6c, //   if ((((int3(gl
+	0x5f, 0x47, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x49, 0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, // _GlobalInvocatio
+	0x6e, 0x49, 0x44, 0x29, 0x2e, 0x78, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x29, 0x20, 0x7c, 0x7c, 0x20, // nID).x == 0) || 
+	0x28, 0x69, 0x6e, 0x74, 0x33, 0x28, 0x67, 0x6c, 0x5f, 0x47, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x49, // (int3(gl_GlobalI
+	0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x49, 0x44, 0x29, 0x2e, 0x79, 0x20, 0x3d, // nvocationID).y =
+	0x3d, 0x20, 0x30, 0x29, 0x29, 0x20, 0x7c, 0x7c, 0x20, 0x28, 0x69, 0x6e, 0x74, 0x33, 0x28, 0x67, // = 0)) || (int3(g
+	0x6c, 0x5f, 0x47, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x49, 0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, 0x69, // l_GlobalInvocati
+	0x6f, 0x6e, 0x49, 0x44, 0x29, 0x2e, 0x78, 0x20, 0x3d, 0x3d, 0x20, 0x28, 0x5f, 0x35, 0x37, 0x36, // onID).x == (_576
+	0x20, 0x2d, 0x20, 0x31, 0x29, 0x29, 0x29, 0x20, 0x7c, 0x7c, 0x20, 0x28, 0x69, 0x6e, 0x74, 0x33, //  - 1))) || (int3
+	0x28, 0x67, 0x6c, 0x5f, 0x47, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x49, 0x6e, 0x76, 0x6f, 0x63, 0x61, // (gl_GlobalInvoca
+	0x74, 0x69, 0x6f, 0x6e, 0x49, 0x44, 0x29, 0x2e, 0x79, 0x20, 0x3d, 0x3d, 0x20, 0x28, 0x5f, 0x35, // tionID).y == (_5
+	0x37, 0x36, 0x20, 0x2d, 0x20, 0x31, 0x29, 0x29, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 76 - 1))).      
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //       {.        
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x5f, 0x31, //         float _1
+	0x32, 0x37, 0x37, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 277;.           
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x3b, 0x3b, 0x29, 0x0a, 0x20, 0x20, //      for (;;).  
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, //               {.
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x69, 0x6e, 0x74, 0x33, 0x28, 0x67, 0x6c, 0x5f, //     if (int3(gl_
+	0x47, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x49, 0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, // GlobalInvocation
+	0x49, 0x44, 0x29, 0x2e, 0x78, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, // ID).x == 0).    
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // {.              
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x31, 0x32, 0x37, 0x37, 0x20, //           _1277 
+	0x3d, 0x20, 0x2d, 0x31, 0x2e, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // = -1.0;.        
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x62, 0x72, 0x65, 0x61, 0x6b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // break;.         
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, //            }.   
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x69, 0x66, 0x20, 0x28, 0x69, 0x6e, 0x74, 0x33, 0x28, 0x67, 0x6c, 0x5f, 0x47, 0x6c, 0x6f, //  if (int3(gl_Glo
+	0x62, 0x61, 0x6c, 0x49, 0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x49, 0x44, 0x29, // balInvocationID)
+	0x2e, 0x78, 0x20, 0x3d, 0x3d, 0x20, 0x28, 0x5f, 0x35, 0x37, 0x36, 0x20, 0x2d, 0x20, 0x31, 0x29, // .x == (_576 - 1)
+	0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // ).              
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //       {.        
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x5f, 0x31, 0x32, 0x37, 0x37, 0x20, 0x3d, 0x20, 0x31, 0x2e, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, // _1277 = 1.0;.   
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, //      break;.    
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // }.              
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x31, 0x32, 0x37, 0x37, 0x20, 0x3d, 0x20, 0x28, 0x28, //       _1277 = ((
+	0x28, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x28, 0x69, 0x6e, 0x74, 0x33, 0x28, 0x67, 0x6c, 0x5f, 0x47, // (float(int3(gl_G
+	0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x49, 0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x49, // lobalInvocationI
+	0x44, 0x29, 0x2e, 0x78, 0x29, 0x20, 0x2b, 0x20, 0x30, 0x2e, 0x35, 0x29, 0x20, 0x2f, 0x20, 0x66, // D).x) + 0.5) / f
+	0x6c, 0x6f, 0x61, 0x74, 0x28, 0x5f, 0x35, 0x37, 0x36, 0x29, 0x29, 0x20, 0x2a, 0x20, 0x32, 0x2e, // loat(_576)) * 2.
+	0x30, 0x29, 0x20, 0x2d, 0x20, 0x31, 0x2e, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 0) - 1.0;.      
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, //               br
+	0x65, 0x61, 0x6b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // eak;.           
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //      }.         
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x5f, 0x31, 0x32, //        float _12
+	0x37, 0x38, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 78;.            
+	0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x3b, 0x3b, 0x29, 0x0a, 0x20, 0x20, 0x20, //     for (;;).   
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, //              {. 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x69, 0x6e, 0x74, 0x33, 0x28, 0x67, 0x6c, 0x5f, 0x47, //    if (int3(gl_G
+	0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x49, 0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x49, // lobalInvocationI
+	0x44, 0x29, 0x2e, 0x79, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, // D).y == 0).     
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, //                {
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // .               
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x31, 0x32, 0x37, 0x38, 0x20, 0x3d, //          _1278 =
+	0x20, 0x2d, 0x31, 0x2e, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //  -1.0;.         
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, //                b
+	0x72, 0x65, 0x61, 0x6b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // reak;.          
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, //           }.    
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x69, 0x66, 0x20, 0x28, 0x69, 0x6e, 0x74, 0x33, 0x28, 0x67, 0x6c, 0x5f, 0x47, 0x6c, 0x6f, 0x62, // if (int3(gl_Glob
+	0x61, 0x6c, 0x49, 0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x49, 0x44, 0x29, 0x2e, // alInvocationID).
+	0x79, 0x20, 0x3d, 0x3d, 0x20, 0x28, 0x5f, 0x35, 0x37, 0x36, 0x20, 0x2d, 0x20, 0x31, 0x29, 0x29, // y == (_576 - 1))
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // .               
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //      {.         
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, //                _
+	0x31, 0x32, 0x37, 0x38, 0x20, 0x3d, 0x20, 0x31, 0x2e, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, // 1278 = 1.0;.    
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, //     break;.     
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, //                }
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // .               
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x31, 0x32, 0x37, 0x38, 0x20, 0x3d, 0x20, 0x28, 0x28, 0x28, //      _1278 = (((
+	0x66, 0x6c, 0x6f, 0x61, 0x74, 0x28, 0x69, 0x6e, 0x74, 0x33, 0x28, 0x67, 0x6c, 0x5f, 0x47, 0x6c, // float(int3(gl_Gl
+	0x6f, 0x62, 0x61, 0x6c, 0x49, 0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x49, 0x44, // obalInvocationID
+	0x29, 0x2e, 0x79, 0x29, 0x20, 0x2b, 0x20, 0x30, 0x2e, 0x35, 0x29, 0x20, 0x2f, 0x20, 0x66, 0x6c, // ).y) + 0.5) / fl
+	0x6f, 0x61, 0x74, 0x28, 0x5f, 0x35, 0x37, 0x36, 0x29, 0x29, 0x20, 0x2a, 0x20, 0x32, 0x2e, 0x30, // oat(_576)) * 2.0
+	0x29, 0x20, 0x2d, 0x20, 0x31, 0x2e, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // ) - 1.0;.       
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, //              bre
+	0x61, 0x6b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // ak;.            
+	0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //     }.          
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x20, 0x5f, 0x31, 0x32, //       float3 _12
+	0x38, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 81;.            
+	0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x69, 0x6e, 0x74, 0x33, 0x28, 0x67, 0x6c, 0x5f, //     if (int3(gl_
+	0x47, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x49, 0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, // GlobalInvocation
+	0x49, 0x44, 0x29, 0x2e, 0x7a, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, // ID).z == 0).    
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, //             {.  
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x5f, 0x31, 0x32, 0x38, 0x31, 0x20, 0x3d, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, //   _1281 = float3
+	0x28, 0x31, 0x2e, 0x30, 0x2c, 0x20, 0x2d, 0x5f, 0x31, 0x32, 0x37, 0x38, 0x2c, 0x20, 0x2d, 0x5f, // (1.0, -_1278, -_
+	0x31, 0x32, 0x37, 0x37, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 1277);.         
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //        }.       
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x0a, 0x20, 0x20, //          else.  
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, //               {.
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x20, 0x5f, 0x31, 0x32, 0x38, 0x32, //     float3 _1282
+	0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // ;.              
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x69, 0x6e, 0x74, 0x33, 0x28, 0x67, //       if (int3(g
+	0x6c, 0x5f, 0x47, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x49, 0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, 0x69, // l_GlobalInvocati
+	0x6f, 0x6e, 0x49, 0x44, 0x29, 0x2e, 0x7a, 0x20, 0x3d, 0x3d, 0x20, 0x31, 0x29, 0x0a, 0x20, 0x20, // onID).z == 1).  
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //   {.            
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x31, 0x32, 0x38, //             _128
+	0x32, 0x20, 0x3d, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x28, 0x2d, 0x31, 0x2e, 0x30, 0x2c, // 2 = float3(-1.0,
+	0x20, 0x2d, 0x5f, 0x31, 0x32, 0x37, 0x38, 0x2c, 0x20, 0x5f, 0x31, 0x32, 0x37, 0x37, 0x29, 0x3b, //  -_1278, _1277);
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // .               
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //      }.         
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x0a, //            else.
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //     {.          
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, //               fl
+	0x6f, 0x61, 0x74, 0x33, 0x20, 0x5f, 0x31, 0x32, 0x38, 0x33, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, // oat3 _1283;.    
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x69, 0x6e, 0x74, 0x33, 0x28, 0x67, 0x6c, 0x5f, //     if (int3(gl_
+	0x47, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x49, 0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, // GlobalInvocation
+	0x49, 0x44, 0x29, 0x2e, 0x7a, 0x20, 0x3d, 0x3d, 0x20, 0x32, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, // ID).z == 2).    
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //     {.          
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x5f, 0x31, 0x32, 0x38, 0x33, 0x20, 0x3d, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, //   _1283 = float3
+	0x28, 0x5f, 0x31, 0x32, 0x37, 0x37, 0x2c, 0x20, 0x31, 0x2e, 0x30, 0x2c, 0x20, 0x5f, 0x31, 0x32, // (_1277, 1.0, _12
+	0x37, 0x38, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 78);.           
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, //              }. 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, //        else.    
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //     {.          
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x20, 0x5f, 0x31, 0x32, 0x38, 0x34, 0x3b, 0x0a, //   float3 _1284;.
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, //             if (
+	0x69, 0x6e, 0x74, 0x33, 0x28, 0x67, 0x6c, 0x5f, 0x47, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x49, 0x6e, // int3(gl_GlobalIn
+	0x76, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x49, 0x44, 0x29, 0x2e, 0x7a, 0x20, 0x3d, 0x3d, // vocationID).z ==
+	0x20, 0x33, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //  3).            
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // {.              
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x5f, 0x31, 0x32, 0x38, 0x34, 0x20, 0x3d, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, //   _1284 = float3
+	0x28, 0x5f, 0x31, 0x32, 0x37, 0x37, 0x2c, 0x20, 0x2d, 0x31, 0x2e, 0x30, 0x2c, 0x20, 0x2d, 0x5f, // (_1277, -1.0, -_
+	0x31, 0x32, 0x37, 0x38, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 1278);.         
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //    }.           
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x65, 0x6c, 0x73, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //  else.          
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //   {.            
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x20, 0x5f, 0x31, 0x32, 0x38, 0x35, //     float3 _1285
+	0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // ;.              
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x69, 0x6e, 0x74, 0x33, 0x28, 0x67, 0x6c, 0x5f, 0x47, 0x6c, //   if (int3(gl_Gl
+	0x6f, 0x62, 0x61, 0x6c, 0x49, 0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x49, 0x44, // obalInvocationID
+	0x29, 0x2e, 0x7a, 0x20, 0x3d, 0x3d, 0x20, 0x34, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // ).z == 4).      
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, //           {.    
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x5f, 0x31, 0x32, 0x38, 0x35, 0x20, 0x3d, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x28, 0x5f, // _1285 = float3(_
+	0x31, 0x32, 0x37, 0x37, 0x2c, 0x20, 0x2d, 0x5f, 0x31, 0x32, 0x37, 0x38, 0x2c, 0x20, 0x31, 0x2e, // 1277, -_1278, 1.
+	0x30, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 0);.            
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //     }.          
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, //       else.     
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, //            {.   
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x5f, 0x31, 0x32, 0x38, 0x35, 0x20, 0x3d, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x28, //  _1285 = float3(
+	0x2d, 0x5f, 0x31, 0x32, 0x37, 0x37, 0x2c, 0x20, 0x2d, 0x5f, 0x31, 0x32, 0x37, 0x38, 0x2c, 0x20, // -_1277, -_1278, 
+	0x2d, 0x31, 0x2e, 0x30, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // -1.0);.         
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //        }.       
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x31, 0x32, 0x38, 0x34, 0x20, 0x3d, //          _1284 =
+	0x20, 0x5f, 0x31, 0x32, 0x38, 0x35, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //  _1285;.        
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //     }.          
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x5f, 0x31, 0x32, 0x38, 0x33, 0x20, 0x3d, 0x20, 0x5f, 0x31, 0x32, 0x38, 0x34, 0x3b, //   _1283 = _1284;
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // .               
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, //          }.     
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x20, 0x5f, 0x31, 0x32, 0x38, 0x32, 0x20, 0x3d, 0x20, 0x5f, 0x31, 0x32, 0x38, 0x33, //    _1282 = _1283
+	0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // ;.              
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //       }.        
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x31, 0x32, 0x38, //             _128
+	0x31, 0x20, 0x3d, 0x20, 0x5f, 0x31, 0x32, 0x38, 0x32, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, // 1 = _1282;.     
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, //            }.   
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, //              flo
+	0x61, 0x74, 0x34, 0x20, 0x5f, 0x31, 0x32, 0x38, 0x39, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, // at4 _1289;.     
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, //            float
+	0x20, 0x5f, 0x31, 0x33, 0x30, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //  _1301;.        
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x31, 0x33, 0x30, 0x31, 0x20, 0x3d, 0x20, //         _1301 = 
+	0x31, 0x2e, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 1.0;.           
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x31, 0x32, 0x38, 0x39, 0x20, 0x3d, 0x20, 0x5f, 0x31, 0x32, //      _1289 = _12
+	0x37, 0x36, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 76;.            
+	0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x20, 0x5f, 0x31, 0x33, 0x33, 0x30, //     float4 _1330
+	0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // ;.              
+	0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x5f, 0x31, 0x33, 0x33, 0x32, 0x3b, 0x0a, 0x20, //   float _1332;. 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, //                f
+	0x6f, 0x72, 0x20, 0x28, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x31, 0x32, 0x37, 0x39, 0x20, 0x3d, 0x20, // or (int _1279 = 
+	0x30, 0x3b, 0x20, 0x5f, 0x31, 0x32, 0x37, 0x39, 0x20, 0x3c, 0x20, 0x36, 0x3b, 0x20, 0x5f, 0x31, // 0; _1279 < 6; _1
+	0x33, 0x30, 0x31, 0x20, 0x3d, 0x20, 0x5f, 0x31, 0x33, 0x33, 0x32, 0x2c, 0x20, 0x5f, 0x31, 0x32, // 301 = _1332, _12
+	0x38, 0x39, 0x20, 0x3d, 0x20, 0x5f, 0x31, 0x33, 0x33, 0x30, 0x2c, 0x20, 0x5f, 0x31, 0x32, 0x37, // 89 = _1330, _127
+	0x39, 0x2b, 0x2b, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 9++).           
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //      {.         
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x5f, //            int _
+	0x36, 0x39, 0x38, 0x20, 0x3d, 0x20, 0x5f, 0x31, 0x32, 0x37, 0x39, 0x20, 0x2f, 0x20, 0x32, 0x3b, // 698 = _1279 / 2;
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // .               
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x28, 0x5f, 0x31, 0x32, 0x37, 0x39, 0x20, //      if ((_1279 
+	0x3d, 0x3d, 0x20, 0x69, 0x6e, 0x74, 0x33, 0x28, 0x67, 0x6c, 0x5f, 0x47, 0x6c, 0x6f, 0x62, 0x61, // == int3(gl_Globa
+	0x6c, 0x49, 0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x49, 0x44, 0x29, 0x2e, 0x7a, // lInvocationID).z
+	0x29, 0x20, 0x7c, 0x7c, 0x20, 0x28, 0x28, 0x28, 0x5f, 0x36, 0x39, 0x38, 0x20, 0x3d, 0x3d, 0x20, // ) || (((_698 == 
+	0x30, 0x29, 0x20, 0x3f, 0x20, 0x5f, 0x31, 0x32, 0x38, 0x31, 0x2e, 0x78, 0x20, 0x3a, 0x20, 0x28, // 0) ? _1281.x : (
+	0x28, 0x5f, 0x36, 0x39, 0x38, 0x20, 0x3d, 0x3d, 0x20, 0x31, 0x29, 0x20, 0x3f, 0x20, 0x5f, 0x31, // (_698 == 1) ? _1
+	0x32, 0x38, 0x31, 0x2e, 0x79, 0x20, 0x3a, 0x20, 0x5f, 0x31, 0x32, 0x38, 0x31, 0x2e, 0x7a, 0x29, // 281.y : _1281.z)
+	0x29, 0x20, 0x21, 0x3d, 0x20, 0x28, 0x28, 0x28, 0x5f, 0x31, 0x32, 0x37, 0x39, 0x20, 0x2d, 0x20, // ) != (((_1279 - 
+	0x28, 0x5f, 0x36, 0x39, 0x38, 0x20, 0x2a, 0x20, 0x32, 0x29, 0x29, 0x20, 0x3d, 0x3d, 0x20, 0x30, // (_698 * 2)) == 0
+	0x29, 0x20, 0x3f, 0x20, 0x31, 0x2e, 0x30, 0x20, 0x3a, 0x20, 0x28, 0x2d, 0x31, 0x2e, 0x30, 0x29, // ) ? 1.0 : (-1.0)
+	0x29, 0x29, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // ))).            
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //         {.      
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x5f, 0x31, 0x33, 0x33, 0x32, 0x20, 0x3d, 0x20, 0x5f, 0x31, 0x33, 0x30, 0x31, 0x3b, //   _1332 = _1301;
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // .               
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x31, 0x33, 0x33, 0x30, 0x20, 0x3d, //          _1330 =
+	0x20, 0x5f, 0x31, 0x32, 0x38, 0x39, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //  _1289;.        
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x63, 0x6f, 0x6e, 0x74, 0x69, 0x6e, 0x75, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // continue;.      
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, //               }.
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x32, 0x20, 0x5f, 0x37, 0x38, 0x33, 0x20, 0x3d, 0x20, //     int2 _783 = 
+	0x6d, 0x69, 0x6e, 0x28, 0x69, 0x6e, 0x74, 0x32, 0x28, 0x28, 0x28, 0x66, 0x6c, 0x6f, 0x61, 0x74, // min(int2(((float
+	0x32, 0x28, 0x28, 0x5f, 0x36, 0x39, 0x38, 0x20, 0x3d, 0x3d, 0x20, 0x30, 0x29, 0x20, 0x3f, 0x20, // 2((_698 == 0) ? 
+	0x28, 0x28, 0x5f, 0x31, 0x32, 0x38, 0x31, 0x2e, 0x78, 0x20, 0x3e, 0x20, 0x30, 0x2e, 0x30, 0x29, // ((_1281.x > 0.0)
+	0x20, 0x3f, 0x20, 0x28, 0x2d, 0x5f, 0x31, 0x32, 0x38, 0x31, 0x2e, 0x7a, 0x29, 0x20, 0x3a, 0x20, //  ? (-_1281.z) : 
+	0x5f, 0x31, 0x32, 0x38, 0x31, 0x2e, 0x7a, 0x29, 0x20, 0x3a, 0x20, 0x28, 0x28, 0x5f, 0x36, 0x39, // _1281.z) : ((_69
+	0x38, 0x20, 0x3d, 0x3d, 0x20, 0x31, 0x29, 0x20, 0x3f, 0x20, 0x5f, 0x31, 0x32, 0x38, 0x31, 0x2e, // 8 == 1) ? _1281.
+	0x78, 0x20, 0x3a, 0x20, 0x28, 0x28, 0x5f, 0x31, 0x32, 0x38, 0x31, 0x2e, 0x7a, 0x20, 0x3e, 0x20, // x : ((_1281.z > 
+	0x30, 0x2e, 0x30, 0x29, 0x20, 0x3f, 0x20, 0x5f, 0x31, 0x32, 0x38, 0x31, 0x2e, 0x78, 0x20, 0x3a, // 0.0) ? _1281.x :
+	0x20, 0x28, 0x2d, 0x5f, 0x31, 0x32, 0x38, 0x31, 0x2e, 0x78, 0x29, 0x29, 0x29, 0x2c, 0x20, 0x28, //  (-_1281.x))), (
+	0x5f, 0x36, 0x39, 0x38, 0x20, 0x3d, 0x3d, 0x20, 0x31, 0x29, 0x20, 0x3f, 0x20, 0x28, 0x28, 0x5f, // _698 == 1) ? ((_
+	0x31, 0x32, 0x38, 0x31, 0x2e, 0x79, 0x20, 0x3e, 0x20, 0x30, 0x2e, 0x30, 0x29, 0x20, 0x3f, 0x20, // 1281.y > 0.0) ? 
+	0x5f, 0x31, 0x32, 0x38, 0x31, 0x2e, 0x7a, 0x20, 0x3a, 0x20, 0x28, 0x2d, 0x5f, 0x31, 0x32, 0x38, // _1281.z : (-_128
+	0x31, 0x2e, 0x7a, 0x29, 0x29, 0x20, 0x3a, 0x20, 0x28, 0x2d, 0x5f, 0x31, 0x32, 0x38, 0x31, 0x2e, // 1.z)) : (-_1281.
+	0x79, 0x29, 0x29, 0x20, 0x2b, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x32, 0x28, 0x31, 0x2e, 0x30, // y)) + float2(1.0
+	0x29, 0x29, 0x20, 0x2a, 0x20, 0x30, 0x2e, 0x35, 0x29, 0x20, 0x2a, 0x20, 0x5f, 0x6d, 0x74, 0x6c, // )) * 0.5) * _mtl
+	0x5f, 0x75, 0x2e, 0x75, 0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x78, 0x29, // _u.u_settings.x)
+	0x2c, 0x20, 0x69, 0x6e, 0x74, 0x32, 0x28, 0x5f, 0x35, 0x37, 0x36, 0x20, 0x2d, 0x20, 0x31, 0x2c, // , int2(_576 - 1,
+	0x20, 0x5f, 0x35, 0x37, 0x36, 0x20, 0x2d, 0x20, 0x31, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, //  _576 - 1));.   
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x20, 0x5f, 0x31, 0x32, 0x38, 0x36, 0x3b, 0x0a, 0x20, //  float4 _1286;. 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x3b, 0x3b, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, //    for (;;).    
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // {.              
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x5f, 0x6d, //           if (_m
+	0x74, 0x6c, 0x5f, 0x75, 0x2e, 0x75, 0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, // tl_u.u_settings.
+	0x7a, 0x20, 0x21, 0x3d, 0x20, 0x30, 0x2e, 0x30, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // z != 0.0).      
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //   {.            
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x69, 0x6e, 0x74, 0x33, 0x20, 0x5f, 0x31, 0x31, 0x31, 0x32, 0x20, 0x3d, 0x20, 0x69, 0x6e, 0x74, // int3 _1112 = int
+	0x33, 0x28, 0x5f, 0x37, 0x38, 0x33, 0x2c, 0x20, 0x5f, 0x31, 0x32, 0x37, 0x39, 0x29, 0x3b, 0x0a, // 3(_783, _1279);.
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x31, 0x32, 0x38, //             _128
+	0x36, 0x20, 0x3d, 0x20, 0x73, 0x5f, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x2e, 0x72, 0x65, 0x61, 0x64, // 6 = s_input.read
+	0x28, 0x75, 0x69, 0x6e, 0x74, 0x32, 0x28, 0x5f, 0x31, 0x31, 0x31, 0x32, 0x2e, 0x78, 0x79, 0x29, // (uint2(_1112.xy)
+	0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x28, 0x5f, 0x31, 0x31, 0x31, 0x32, 0x2e, 0x7a, 0x29, 0x2c, // , uint(_1112.z),
+	0x20, 0x30, 0x29, 0x20, 0x2a, 0x20, 0x34, 0x2e, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, //  0) * 4.0;.     
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6b, 0x3b, 0x0a, 0x20, 0x20, //        break;.  
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //       }.        
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x69, 0x6e, 0x74, 0x20, 0x5f, 0x31, 0x31, 0x31, 0x39, 0x20, 0x3d, 0x20, 0x69, 0x6e, 0x74, 0x28, // int _1119 = int(
+	0x5f, 0x6d, 0x74, 0x6c, 0x5f, 0x75, 0x2e, 0x75, 0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, // _mtl_u.u_setting
+	0x73, 0x2e, 0x79, 0x29, 0x20, 0x2d, 0x20, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // s.y) - 1;.      
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x31, 0x31, 0x32, 0x34, 0x20, 0x3d, 0x20, 0x6d, 0x69, //   int _1124 = mi
+	0x6e, 0x28, 0x28, 0x5f, 0x37, 0x38, 0x33, 0x2e, 0x78, 0x20, 0x2a, 0x20, 0x32, 0x29, 0x2c, 0x20, // n((_783.x * 2), 
+	0x5f, 0x31, 0x31, 0x31, 0x39, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // _1119);.        
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x69, 0x6e, 0x74, 0x20, 0x5f, 0x31, 0x31, 0x33, 0x30, 0x20, 0x3d, 0x20, 0x6d, 0x69, 0x6e, 0x28, // int _1130 = min(
+	0x28, 0x28, 0x5f, 0x37, 0x38, 0x33, 0x2e, 0x78, 0x20, 0x2a, 0x20, 0x32, 0x29, 0x20, 0x2b, 0x20, // ((_783.x * 2) + 
+	0x31, 0x29, 0x2c, 0x20, 0x5f, 0x31, 0x31, 0x31, 0x39, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, // 1), _1119);.    
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x31, 0x31, 0x33, 0x35, 0x20, 0x3d, 0x20, //     int _1135 = 
+	0x6d, 0x69, 0x6e, 0x28, 0x28, 0x5f, 0x37, 0x38, 0x33, 0x2e, 0x79, 0x20, 0x2a, 0x20, 0x32, 0x29, // min((_783.y * 2)
+	0x2c, 0x20, 0x5f, 0x31, 0x31, 0x31, 0x39, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // , _1119);.      
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x31, 0x31, 0x34, 0x31, 0x20, 0x3d, 0x20, 0x6d, 0x69, //   int _1141 = mi
+	0x6e, 0x28, 0x28, 0x28, 0x5f, 0x37, 0x38, 0x33, 0x2e, 0x79, 0x20, 0x2a, 0x20, 0x32, 0x29, 0x20, // n(((_783.y * 2) 
+	0x2b, 0x20, 0x31, 0x29, 0x2c, 0x20, 0x5f, 0x31, 0x31, 0x31, 0x39, 0x29, 0x3b, 0x0a, 0x20, 0x20, // + 1), _1119);.  
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x33, 0x20, 0x5f, 0x31, 0x31, 0x34, 0x35, //       int3 _1145
+	0x20, 0x3d, 0x20, 0x69, 0x6e, 0x74, 0x33, 0x28, 0x5f, 0x31, 0x31, 0x32, 0x34, 0x2c, 0x20, 0x5f, //  = int3(_1124, _
+	0x31, 0x31, 0x33, 0x35, 0x2c, 0x20, 0x5f, 0x31, 0x32, 0x37, 0x39, 0x29, 0x3b, 0x0a, 0x20, 0x20, // 1135, _1279);.  
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x33, 0x20, 0x5f, 0x31, 0x31, 0x35, 0x31, //       int3 _1151
+	0x20, 0x3d, 0x20, 0x69, 0x6e, 0x74, 0x33, 0x28, 0x5f, 0x31, 0x31, 0x33, 0x30, 0x2c, 0x20, 0x5f, //  = int3(_1130, _
+	0x31, 0x31, 0x33, 0x35, 0x2c, 0x20, 0x5f, 0x31, 0x32, 0x37, 0x39, 0x29, 0x3b, 0x0a, 0x20, 0x20, // 1135, _1279);.  
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x33, 0x20, 0x5f, 0x31, 0x31, 0x35, 0x38, //       int3 _1158
+	0x20, 0x3d, 0x20, 0x69, 0x6e, 0x74, 0x33, 0x28, 0x5f, 0x31, 0x31, 0x32, 0x34, 0x2c, 0x20, 0x5f, //  = int3(_1124, _
+	0x31, 0x31, 0x34, 0x31, 0x2c, 0x20, 0x5f, 0x31, 0x32, 0x37, 0x39, 0x29, 0x3b, 0x0a, 0x20, 0x20, // 1141, _1279);.  
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x33, 0x20, 0x5f, 0x31, 0x31, 0x36, 0x35, //       int3 _1165
+	0x20, 0x3d, 0x20, 0x69, 0x6e, 0x74, 0x33, 0x28, 0x5f, 0x31, 0x31, 0x33, 0x30, 0x2c, 0x20, 0x5f, //  = int3(_1130, _
+	0x31, 0x31, 0x34, 0x31, 0x2c, 0x20, 0x5f, 0x31, 0x32, 0x37, 0x39, 0x29, 0x3b, 0x0a, 0x20, 0x20, // 1141, _1279);.  
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x31, 0x32, 0x38, 0x36, 0x20, 0x3d, 0x20, 0x28, 0x28, //       _1286 = ((
+	0x73, 0x5f, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x2e, 0x72, 0x65, 0x61, 0x64, 0x28, 0x75, 0x69, 0x6e, // s_input.read(uin
+	0x74, 0x32, 0x28, 0x5f, 0x31, 0x31, 0x34, 0x35, 0x2e, 0x78, 0x79, 0x29, 0x2c, 0x20, 0x75, 0x69, // t2(_1145.xy), ui
+	0x6e, 0x74, 0x28, 0x5f, 0x31, 0x31, 0x34, 0x35, 0x2e, 0x7a, 0x29, 0x2c, 0x20, 0x30, 0x29, 0x20, // nt(_1145.z), 0) 
+	0x2b, 0x20, 0x73, 0x5f, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x2e, 0x72, 0x65, 0x61, 0x64, 0x28, 0x75, // + s_input.read(u
+	0x69, 0x6e, 0x74, 0x32, 0x28, 0x5f, 0x31, 0x31, 0x35, 0x31, 0x2e, 0x78, 0x79, 0x29, 0x2c, 0x20, // int2(_1151.xy), 
+	0x75, 0x69, 0x6e, 0x74, 0x28, 0x5f, 0x31, 0x31, 0x35, 0x31, 0x2e, 0x7a, 0x29, 0x2c, 0x20, 0x30, // uint(_1151.z), 0
+	0x29, 0x29, 0x20, 0x2b, 0x20, 0x73, 0x5f, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x2e, 0x72, 0x65, 0x61, // )) + s_input.rea
+	0x64, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x32, 0x28, 0x5f, 0x31, 0x31, 0x35, 0x38, 0x2e, 0x78, 0x79, // d(uint2(_1158.xy
+	0x29, 0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x28, 0x5f, 0x31, 0x31, 0x35, 0x38, 0x2e, 0x7a, 0x29, // ), uint(_1158.z)
+	0x2c, 0x20, 0x30, 0x29, 0x29, 0x20, 0x2b, 0x20, 0x73, 0x5f, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x2e, // , 0)) + s_input.
+	0x72, 0x65, 0x61, 0x64, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x32, 0x28, 0x5f, 0x31, 0x31, 0x36, 0x35, // read(uint2(_1165
+	0x2e, 0x78, 0x79, 0x29, 0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x28, 0x5f, 0x31, 0x31, 0x36, 0x35, // .xy), uint(_1165
+	0x2e, 0x7a, 0x29, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // .z), 0);.       
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x62, 0x72, 0x65, 0x61, 0x6b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //  break;.        
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, //             }.  
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x5f, 0x31, 0x33, 0x33, 0x32, 0x20, 0x3d, 0x20, 0x5f, 0x31, 0x33, 0x30, 0x31, 0x20, //   _1332 = _1301 
+	0x2b, 0x20, 0x31, 0x2e, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // + 1.0;.         
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x31, 0x33, 0x33, 0x30, //            _1330
+	0x20, 0x3d, 0x20, 0x5f, 0x31, 0x32, 0x38, 0x39, 0x20, 0x2b, 0x20, 0x5f, 0x31, 0x32, 0x38, 0x36, //  = _1289 + _1286
+	0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // ;.              
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x69, 0x6e, 0x75, 0x65, 0x3b, 0x0a, //       continue;.
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // }.              
+	0x20, 0x20, 0x5f, 0x31, 0x33, 0x31, 0x39, 0x20, 0x3d, 0x20, 0x5f, 0x31, 0x33, 0x30, 0x31, 0x3b, //   _1319 = _1301;
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // .               
+	0x20, 0x5f, 0x31, 0x33, 0x31, 0x37, 0x20, 0x3d, 0x20, 0x5f, 0x31, 0x32, 0x38, 0x39, 0x3b, 0x0a, //  _1317 = _1289;.
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, //             }.  
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x0a, 0x20, //           else. 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, //            {.   
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x31, 0x33, //              _13
+	0x31, 0x39, 0x20, 0x3d, 0x20, 0x31, 0x2e, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 19 = 1.0;.      
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x31, 0x33, 0x31, 0x37, 0x20, //           _1317 
+	0x3d, 0x20, 0x5f, 0x31, 0x32, 0x37, 0x36, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // = _1276;.       
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //      }.         
+	0x20, 0x20, 0x20, 0x5f, 0x31, 0x33, 0x31, 0x38, 0x20, 0x3d, 0x20, 0x5f, 0x31, 0x33, 0x31, 0x39, //    _1318 = _1319
+	0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x31, // ;.            _1
+	0x33, 0x31, 0x35, 0x20, 0x3d, 0x20, 0x5f, 0x31, 0x33, 0x31, 0x37, 0x3b, 0x0a, 0x20, 0x20, 0x20, // 315 = _1317;.   
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, //      }.        s
+	0x5f, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x54, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x2e, 0x77, // _outputTexture.w
+	0x72, 0x69, 0x74, 0x65, 0x28, 0x5f, 0x31, 0x33, 0x31, 0x35, 0x20, 0x2f, 0x20, 0x66, 0x6c, 0x6f, // rite(_1315 / flo
+	0x61, 0x74, 0x34, 0x28, 0x5f, 0x31, 0x33, 0x31, 0x38, 0x20, 0x2a, 0x20, 0x34, 0x2e, 0x30, 0x29, // at4(_1318 * 4.0)
+	0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x32, 0x28, 0x69, 0x6e, 0x74, 0x33, 0x28, 0x67, 0x6c, 0x5f, // , uint2(int3(gl_
+	0x47, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x49, 0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, // GlobalInvocation
+	0x49, 0x44, 0x29, 0x2e, 0x78, 0x79, 0x29, 0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x28, 0x69, 0x6e, // ID).xy), uint(in
+	0x74, 0x33, 0x28, 0x67, 0x6c, 0x5f, 0x47, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x49, 0x6e, 0x76, 0x6f, // t3(gl_GlobalInvo
+	0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x49, 0x44, 0x29, 0x2e, 0x7a, 0x29, 0x29, 0x3b, 0x0a, 0x20, // cationID).z));. 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6b, 0x3b, 0x0a, 0x20, 0x20, //        break;.  
+	0x20, 0x20, 0x7d, 0x0a, 0x7d, 0x0a, 0x0a, 0x00, 0x00, 0x10, 0x00,                               //   }.}......
+};
@@ -0,0 +1,100 @@
+#include <bgfx_compute.sh>
+
+IMAGE2D_ARRAY_RO(s_input, rgba16f, 0);
+IMAGE2D_ARRAY_WR(s_output, rgba16f, 1);
+
+uniform vec4 u_settings;
+
+#define u_side_resolution u_settings.x
+#define u_input_resolution u_settings.y
+#define u_is_seam_fix u_settings.z
+
+// Sum of the 2x2 quad of the previous mip level under a texel of the next one, clamped to the edges. When only seams
+// are fixed, the input is the level itself and its texel stands for the whole quad.
+vec4 load_quad(ivec2 texel, int face) {
+    if (u_is_seam_fix != 0.0) {
+        return imageLoad(s_input, ivec3(texel, face)) * 4.0;
+    }
+
+    int last = int(u_input_resolution) - 1;
+    int x0 = min(texel.x * 2, last);
+    int x1 = min(texel.x * 2 + 1, last);
+    int y0 = min(texel.y * 2, last);
+    int y1 = min(texel.y * 2 + 1, last);
+    return imageLoad(s_input, ivec3(x0, y0, face)) + imageLoad(s_input, ivec3(x1, y0, face)) +
+           imageLoad(s_input, ivec3(x0, y1, face)) + imageLoad(s_input, ivec3(x1, y1, face));
+}
+
+// Coordinate of a texel of the next mip level, exactly one on the edges of the face.
+float get_coordinate(int texel, int size) {
+    if (texel == 0) {
+        return -1.0;
+    }
+    if (texel == size - 1) {
+        return 1.0;
+    }
+    return (float(texel) + 0.5) / float(size) * 2.0 - 1.0;
+}
+
+// Averages 2x2 quads of the previous mip level clamped to its edges, and texels on the edges of the cube average the
+// quads of the texels of the other faces at the same position, same as `downsample_face_rows`. With `u_is_seam_fix`
+// the level is copied with the texels on the edges of the cube averaged instead, same as `fix_cube_map_seams`, for
+// levels that are rendered rather than downsampled. Face index is the Z component of the invocation.
+NUM_THREADS(8, 8, 1)
+void main() {
+    ivec3 texel = ivec3(gl_GlobalInvocationID);
+    if (float(texel.x) >= u_side_resolution || float(texel.y) >= u_side_resolution) {
+        return;
+    }
+
+    int size = int(u_side_resolution);
+    vec4 sum = load_quad(texel.xy, texel.z);
+    float count = 1.0;
+
+    if (size == 1) {
+        for (int other = 0; other < 6; other++) {
+            if (other != texel.z) {
+                sum += load_quad(ivec2(0, 0), other);
+            }
+        }
+        count = 6.0;
+    } else if (texel.x == 0 || texel.y == 0 || texel.x == size - 1 || texel.y == size - 1) {
+        float u = get_coordinate(texel.x, size);
+        float v = get_coordinate(texel.y, size);
+
+        // Point on the surface of the cube, the unnormalized `get_cube_map_direction`.
+        vec3 position;
+        if (texel.z == 0) {
+            position = vec3(1.0, -v, -u);
+        } else if (texel.z == 1) {
+            position = vec3(-1.0, -v, u);
+        } else if (texel.z == 2) {
+            position = vec3(u, 1.0, v);
+        } else if (texel.z == 3) {
+            position = vec3(u, -1.0, -v);
+        } else if (texel.z == 4) {
+            position = vec3(u, -v, 1.0);
+        } else {
+            position = vec3(-u, -v, -1.0);
+        }
+
+        for (int other = 0; other < 6; other++) {
+            int axis = other / 2;
+            float value = axis == 0 ? position.x : (axis == 1 ? position.y : position.z);
+            float side = other - axis * 2 == 0 ? 1.0 : -1.0;
+            if (other == texel.z || value != side) {
+                continue;
+            }
+
+            // Face coordinates of the position on the other face, like `project_to_face`.
+            float s = axis == 0 ? (position.x > 0.0 ? -position.z : position.z) : (axis == 1 ? position.x : (position.z > 0.0 ? position.x : -position.x));
+            float t = axis == 1 ? (position.y > 0.0 ? position.z : -position.z) : -position.y;
+
+            ivec2 other_texel = min(ivec2((vec2(s, t) + 1.0) * 0.5 * u_side_resolution), ivec2(size - 1, size - 1));
+            sum += load_quad(other_texel, other);
+            count += 1.0;
+        }
+    }
+
+    imageStore(s_output, texel, sum / (count * 4.0));
+}
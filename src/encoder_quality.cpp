@@ -0,0 +1,7 @@
+#include "encoder_quality.h"
+
+#include <algorithm>
+
+EncoderQuality get_mip_quality(const MipQualities& qualities, uint32_t level) noexcept {
+    return qualities[std::min<size_t>(level, qualities.size() - 1)];
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+// Search effort of the built-in block encoders, same levels as `nvtt::Quality`.
+enum class EncoderQuality {
+    FASTEST,
+    NORMAL,
+    PRODUCTION,
+    HIGHEST
+};
+
+// Search effort of every mip level of a texture from the largest, the last one stands for the levels past the end, so
+// a single quality stands for all of them. Must not be empty.
+using MipQualities = std::vector<EncoderQuality>;
+
+// Search effort of a mip level of a texture, counted from the largest level.
+EncoderQuality get_mip_quality(const MipQualities& qualities, uint32_t level) noexcept;
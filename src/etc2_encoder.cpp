@@ -0,0 +1,578 @@
+#include "etc2_encoder.h"
+#include "block_delta.h"
+#include "dds_layout.h"
+#include "thread_pool.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+// Number of block rows encoded by one thread pool task.
+static constexpr size_t ETC2_TASK_BLOCK_ROWS = 16;
+
+// Intensity modifiers of ETC1 subblocks, small and large. Pixel indices 0 to 3 select +small, +large, -small and
+// -large.
+static const int ETC1_MODIFIERS[8][2] = { { 2, 8 }, { 5, 17 }, { 9, 29 }, { 13, 42 }, { 18, 60 }, { 24, 80 }, { 33, 106 }, { 47, 183 } };
+
+static const int EAC_MODIFIERS[16][8] = {
+    { -3, -6, -9, -15, 2, 5, 8, 14 },
+    { -3, -7, -10, -13, 2, 6, 9, 12 },
+    { -2, -5, -8, -13, 1, 4, 7, 12 },
+    { -2, -4, -6, -13, 1, 3, 5, 12 },
+    { -3, -6, -8, -12, 2, 5, 7, 11 },
+    { -3, -7, -9, -11, 2, 6, 8, 10 },
+    { -4, -7, -8, -11, 3, 6, 7, 10 },
+    { -3, -5, -8, -11, 2, 4, 7, 10 },
+    { -2, -6, -8, -10, 1, 5, 7, 9 },
+    { -2, -5, -8, -10, 1, 4, 7, 9 },
+    { -2, -4, -8, -10, 1, 3, 7, 9 },
+    { -2, -5, -7, -10, 1, 4, 6, 9 },
+    { -3, -4, -7, -10, 2, 3, 6, 9 },
+    { -1, -2, -3, -10, 0, 1, 2, 9 },
+    { -4, -6, -8, -9, 3, 5, 7, 8 },
+    { -3, -5, -7, -9, 2, 4, 6, 8 }
+};
+
+// Pixels of ETC and EAC blocks are numbered down the columns.
+static size_t get_pixel_index(size_t x, size_t y) noexcept {
+    return x * 4 + y;
+}
+
+static int clamp_255(int value) noexcept {
+    return std::clamp(value, 0, 255);
+}
+
+static int quantize(float value, int max) noexcept {
+    return std::clamp(static_cast<int>(std::lround(value * static_cast<float>(max) / 255.f)), 0, max);
+}
+
+static int expand_4(int value) noexcept {
+    return value * 17;
+}
+
+static int expand_5(int value) noexcept {
+    return (value << 3) | (value >> 2);
+}
+
+static int expand_6(int value) noexcept {
+    return (value << 2) | (value >> 4);
+}
+
+static int expand_7(int value) noexcept {
+    return (value << 1) | (value >> 6);
+}
+
+// How far around the rounded colors and EAC parameters the encoder searches.
+static int get_search_radius(EncoderQuality quality) noexcept {
+    switch (quality) {
+        case EncoderQuality::FASTEST:
+            return 0;
+        case EncoderQuality::NORMAL:
+            return 1;
+        case EncoderQuality::PRODUCTION:
+            return 2;
+        case EncoderQuality::HIGHEST:
+            return 3;
+    }
+    return 1;
+}
+
+static void write_64(uint64_t bits, uint8_t* block) noexcept {
+    // ETC and EAC blocks are big endian.
+    for (size_t i = 0; i < 8; i++) {
+        block[i] = static_cast<uint8_t>(bits >> (56 - i * 8));
+    }
+}
+
+struct Subblock final {
+    int pixels[8][3];
+    size_t pixel_indices[8];
+    float average[3];
+};
+
+struct SubblockFit final {
+    uint32_t error = std::numeric_limits<uint32_t>::max();
+    int color[3] = {};
+    int table = 0;
+    uint8_t indices[8] = {};
+};
+
+// Finds the best table and pixel indices of a subblock for an expanded base color.
+static void fit_subblock(const Subblock& subblock, const int (&color)[3], const int (&base)[3], SubblockFit& fit) noexcept {
+    for (int table = 0; table < 8; table++) {
+        uint32_t error = 0;
+        uint8_t indices[8];
+        for (size_t pixel = 0; pixel < 8 && error < fit.error; pixel++) {
+            uint32_t best_pixel_error = std::numeric_limits<uint32_t>::max();
+            for (uint8_t index = 0; index < 4; index++) {
+                const int modifier = (index & 2) != 0 ? -ETC1_MODIFIERS[table][index & 1] : ETC1_MODIFIERS[table][index & 1];
+
+                uint32_t pixel_error = 0;
+                for (size_t channel = 0; channel < 3; channel++) {
+                    const int difference = clamp_255(base[channel] + modifier) - subblock.pixels[pixel][channel];
+                    pixel_error += static_cast<uint32_t>(difference * difference);
+                }
+
+                if (pixel_error < best_pixel_error) {
+                    best_pixel_error = pixel_error;
+                    indices[pixel] = index;
+                }
+            }
+            error += best_pixel_error;
+        }
+
+        if (error < fit.error) {
+            fit.error = error;
+            std::memcpy(fit.color, color, sizeof(fit.color));
+            fit.table = table;
+            std::memcpy(fit.indices, indices, sizeof(fit.indices));
+        }
+    }
+}
+
+// Searches base colors around `center` within `low` and `high` limits per channel, quantized to `bits` bits.
+static void search_subblock(const Subblock& subblock, const int (&center)[3], const int (&low)[3], const int (&high)[3], int bits, int radius, SubblockFit& fit) noexcept {
+    for (int red = center[0] - radius; red <= center[0] + radius; red++) {
+        for (int green = center[1] - radius; green <= center[1] + radius; green++) {
+            for (int blue = center[2] - radius; blue <= center[2] + radius; blue++) {
+                int color[3] = { red, green, blue };
+
+                bool is_valid = true;
+                for (size_t channel = 0; channel < 3; channel++) {
+                    is_valid = is_valid && color[channel] >= low[channel] && color[channel] <= high[channel];
+                }
+                if (!is_valid) {
+                    continue;
+                }
+
+                int base[3];
+                for (size_t channel = 0; channel < 3; channel++) {
+                    base[channel] = bits == 4 ? expand_4(color[channel]) : expand_5(color[channel]);
+                }
+                fit_subblock(subblock, color, base, fit);
+            }
+        }
+    }
+}
+
+static uint64_t pack_etc1(bool is_differential, bool is_flipped, const SubblockFit (&fits)[2], const Subblock (&subblocks)[2]) noexcept {
+    uint64_t bits = 0;
+    for (size_t channel = 0; channel < 3; channel++) {
+        if (is_differential) {
+            const int difference = fits[1].color[channel] - fits[0].color[channel];
+            bits |= static_cast<uint64_t>(fits[0].color[channel]) << (59 - channel * 8);
+            bits |= static_cast<uint64_t>(difference & 7) << (56 - channel * 8);
+        } else {
+            bits |= static_cast<uint64_t>(fits[0].color[channel]) << (60 - channel * 8);
+            bits |= static_cast<uint64_t>(fits[1].color[channel]) << (56 - channel * 8);
+        }
+    }
+
+    bits |= static_cast<uint64_t>(fits[0].table) << 37;
+    bits |= static_cast<uint64_t>(fits[1].table) << 34;
+    bits |= static_cast<uint64_t>(is_differential ? 1 : 0) << 33;
+    bits |= static_cast<uint64_t>(is_flipped ? 1 : 0) << 32;
+
+    // Most significant bits of all the pixel indices are followed by the least significant ones.
+    for (size_t i = 0; i < 2; i++) {
+        for (size_t pixel = 0; pixel < 8; pixel++) {
+            const size_t pixel_index = subblocks[i].pixel_indices[pixel];
+            const uint8_t index = fits[i].indices[pixel];
+            bits |= static_cast<uint64_t>(index >> 1) << (16 + pixel_index);
+            bits |= static_cast<uint64_t>(index & 1) << pixel_index;
+        }
+    }
+
+    return bits;
+}
+
+// Individual and differential modes of ETC1, the subblocks are either side by side or, when flipped, on top of each
+// other. Differential colors never overflow, so ETC2 decoders never switch to the T, H or planar modes.
+static uint32_t encode_etc1_modes(const uint8_t* rgba, EncoderQuality quality, uint64_t& bits) noexcept {
+    const int radius = get_search_radius(quality);
+
+    uint32_t best_error = std::numeric_limits<uint32_t>::max();
+    for (int flip = 0; flip < 2; flip++) {
+        Subblock subblocks[2];
+        size_t counts[2] = {};
+        for (size_t y = 0; y < 4; y++) {
+            for (size_t x = 0; x < 4; x++) {
+                const size_t i = flip != 0 ? (y >= 2 ? 1 : 0) : (x >= 2 ? 1 : 0);
+                Subblock& subblock = subblocks[i];
+                for (size_t channel = 0; channel < 3; channel++) {
+                    subblock.pixels[counts[i]][channel] = rgba[(y * 4 + x) * 4 + channel];
+                }
+                subblock.pixel_indices[counts[i]] = get_pixel_index(x, y);
+                counts[i]++;
+            }
+        }
+
+        for (Subblock& subblock : subblocks) {
+            for (size_t channel = 0; channel < 3; channel++) {
+                int sum = 0;
+                for (const int(&pixel)[3] : subblock.pixels) {
+                    sum += pixel[channel];
+                }
+                subblock.average[channel] = static_cast<float>(sum) / 8.f;
+            }
+        }
+
+        // Individual mode, 4-bit colors chosen independently.
+        SubblockFit individual[2];
+        for (size_t i = 0; i < 2; i++) {
+            int center[3];
+            for (size_t channel = 0; channel < 3; channel++) {
+                center[channel] = quantize(subblocks[i].average[channel], 15);
+            }
+            search_subblock(subblocks[i], center, { 0, 0, 0 }, { 15, 15, 15 }, 4, radius, individual[i]);
+        }
+
+        const uint32_t individual_error = individual[0].error + individual[1].error;
+        if (individual_error < best_error) {
+            best_error = individual_error;
+            bits = pack_etc1(false, flip != 0, individual, subblocks);
+        }
+
+        // Differential mode, the 5-bit color of the second subblock is within [-4, 3] of the first one.
+        SubblockFit differential[2];
+        int first_center[3];
+        for (size_t channel = 0; channel < 3; channel++) {
+            first_center[channel] = quantize(subblocks[0].average[channel], 31);
+        }
+        search_subblock(subblocks[0], first_center, { 0, 0, 0 }, { 31, 31, 31 }, 5, radius, differential[0]);
+
+        int second_center[3];
+        int low[3];
+        int high[3];
+        for (size_t channel = 0; channel < 3; channel++) {
+            low[channel] = std::max(differential[0].color[channel] - 4, 0);
+            high[channel] = std::min(differential[0].color[channel] + 3, 31);
+            second_center[channel] = std::clamp(quantize(subblocks[1].average[channel], 31), low[channel], high[channel]);
+        }
+        search_subblock(subblocks[1], second_center, low, high, 5, radius, differential[1]);
+
+        const uint32_t differential_error = differential[0].error + differential[1].error;
+        if (differential_error < best_error) {
+            best_error = differential_error;
+            bits = pack_etc1(true, flip != 0, differential, subblocks);
+        }
+    }
+
+    return best_error;
+}
+
+static int decode_planar(int origin, int horizontal, int vertical, int x, int y) noexcept {
+    return clamp_255((x * (horizontal - origin) + y * (vertical - origin) + 4 * origin + 2) >> 2);
+}
+
+// Planar mode of ETC2, the colors of a block are a plane through the origin, horizontal and vertical colors.
+static uint32_t encode_planar(const uint8_t* rgba, EncoderQuality quality, uint64_t& bits) noexcept {
+    const int radius = get_search_radius(quality);
+
+    int codes[3][3];
+    uint32_t total_error = 0;
+    for (size_t channel = 0; channel < 3; channel++) {
+        // Least squares plane over pixel coordinates, centered at the middle of the block.
+        float sum = 0.f;
+        float sum_x = 0.f;
+        float sum_y = 0.f;
+        for (size_t y = 0; y < 4; y++) {
+            for (size_t x = 0; x < 4; x++) {
+                const float value = rgba[(y * 4 + x) * 4 + channel];
+                sum += value;
+                sum_x += (static_cast<float>(x) - 1.5f) * value;
+                sum_y += (static_cast<float>(y) - 1.5f) * value;
+            }
+        }
+        const float gradient_x = sum_x / 20.f;
+        const float gradient_y = sum_y / 20.f;
+        const float origin = sum / 16.f - 1.5f * gradient_x - 1.5f * gradient_y;
+
+        const int max = channel == 1 ? 127 : 63;
+        const float values[3] = { origin, origin + 4.f * gradient_x, origin + 4.f * gradient_y };
+
+        int centers[3];
+        for (size_t i = 0; i < 3; i++) {
+            centers[i] = quantize(values[i], max);
+        }
+
+        uint32_t best_error = std::numeric_limits<uint32_t>::max();
+        for (int o = std::max(centers[0] - radius, 0); o <= std::min(centers[0] + radius, max); o++) {
+            for (int h = std::max(centers[1] - radius, 0); h <= std::min(centers[1] + radius, max); h++) {
+                for (int v = std::max(centers[2] - radius, 0); v <= std::min(centers[2] + radius, max); v++) {
+                    const int origin_value = channel == 1 ? expand_7(o) : expand_6(o);
+                    const int horizontal_value = channel == 1 ? expand_7(h) : expand_6(h);
+                    const int vertical_value = channel == 1 ? expand_7(v) : expand_6(v);
+
+                    uint32_t error = 0;
+                    for (int y = 0; y < 4; y++) {
+                        for (int x = 0; x < 4; x++) {
+                            const int difference = decode_planar(origin_value, horizontal_value, vertical_value, x, y) - rgba[(y * 4 + x) * 4 + channel];
+                            error += static_cast<uint32_t>(difference * difference);
+                        }
+                    }
+
+                    if (error < best_error) {
+                        best_error = error;
+                        codes[channel][0] = o;
+                        codes[channel][1] = h;
+                        codes[channel][2] = v;
+                    }
+                }
+            }
+        }
+        total_error += best_error;
+    }
+
+    const uint64_t red_origin = static_cast<uint64_t>(codes[0][0]);
+    const uint64_t green_origin = static_cast<uint64_t>(codes[1][0]);
+    const uint64_t blue_origin = static_cast<uint64_t>(codes[2][0]);
+    const uint64_t red_horizontal = static_cast<uint64_t>(codes[0][1]);
+
+    bits = (red_origin << 57) | ((green_origin >> 6) << 56) | ((green_origin & 63) << 49) | ((blue_origin >> 5) << 48) | (((blue_origin >> 3) & 3) << 43) |
+           ((blue_origin & 7) << 39) | ((red_horizontal >> 1) << 34) | (1ULL << 33) | ((red_horizontal & 1) << 32) | (static_cast<uint64_t>(codes[1][1]) << 25) |
+           (static_cast<uint64_t>(codes[2][1]) << 19) | (static_cast<uint64_t>(codes[0][2]) << 13) | (static_cast<uint64_t>(codes[1][2]) << 6) |
+           static_cast<uint64_t>(codes[2][2]);
+
+    // The remaining bits are free. The red and green differential colors there must stay within range, while blue
+    // must overflow, which is how decoders tell the planar mode apart.
+    const auto is_overflow = [&bits](int shift) {
+        const int color = static_cast<int>((bits >> (shift + 3)) & 31);
+        const int difference = static_cast<int>((bits >> shift) & 7);
+        const int sum = color + (difference >= 4 ? difference - 8 : difference);
+        return sum < 0 || sum > 31;
+    };
+    if (is_overflow(56)) {
+        bits ^= 1ULL << 63;
+    }
+    if (is_overflow(48)) {
+        bits ^= 1ULL << 55;
+    }
+    if (((blue_origin >> 3) & 3) + ((blue_origin >> 1) & 3) > 3) {
+        bits |= 7ULL << 45;
+    } else {
+        bits |= 1ULL << 42;
+    }
+
+    return total_error;
+}
+
+// EAC block of 16 `targets` in pixel order, either 8-bit alpha or 11-bit red.
+static uint64_t encode_eac(const int (&targets)[16], bool is_r11, EncoderQuality quality) noexcept {
+    const int radius = get_search_radius(quality);
+
+    int low = targets[0];
+    int high = targets[0];
+    for (int target : targets) {
+        low = std::min(low, target);
+        high = std::max(high, target);
+    }
+
+    const auto decode = [is_r11](int base, int multiplier, int modifier) {
+        if (!is_r11) {
+            return clamp_255(base + modifier * multiplier);
+        }
+        return std::clamp(base * 8 + 4 + (multiplier == 0 ? modifier : modifier * multiplier * 8), 0, 2047);
+    };
+
+    uint32_t best_error = std::numeric_limits<uint32_t>::max();
+    uint64_t best_bits = 0;
+    for (int table = 0; table < 16; table++) {
+        const int* modifiers = EAC_MODIFIERS[table];
+        const int modifier_low = modifiers[3];
+        const int modifier_high = modifiers[7];
+
+        // Base and multiplier that map the value range onto the modifier range of the table.
+        const float scale = is_r11 ? 8.f : 1.f;
+        const float multiplier_estimate = static_cast<float>(high - low) / (static_cast<float>(modifier_high - modifier_low) * scale);
+        const int multiplier_center = std::clamp(static_cast<int>(std::lround(multiplier_estimate)), 0, 15);
+
+        for (int multiplier = std::max(multiplier_center - radius, 0); multiplier <= std::min(multiplier_center + radius, 15); multiplier++) {
+            const float step = is_r11 ? (multiplier == 0 ? 1.f : static_cast<float>(multiplier) * 8.f) : static_cast<float>(multiplier);
+            const float center = static_cast<float>(low + high) * 0.5f - static_cast<float>(modifier_low + modifier_high) * 0.5f * step;
+            const float base_estimate = is_r11 ? (center - 4.f) / 8.f : center;
+            const int base_center = std::clamp(static_cast<int>(std::lround(base_estimate)), 0, 255);
+
+            for (int base = std::max(base_center - radius, 0); base <= std::min(base_center + radius, 255); base++) {
+                uint32_t error = 0;
+                uint64_t indices = 0;
+                for (size_t pixel = 0; pixel < 16 && error < best_error; pixel++) {
+                    uint32_t best_pixel_error = std::numeric_limits<uint32_t>::max();
+                    uint64_t best_index = 0;
+                    for (uint64_t index = 0; index < 8; index++) {
+                        const int difference = decode(base, multiplier, modifiers[index]) - targets[pixel];
+                        const uint32_t pixel_error = static_cast<uint32_t>(difference * difference);
+                        if (pixel_error < best_pixel_error) {
+                            best_pixel_error = pixel_error;
+                            best_index = index;
+                        }
+                    }
+                    error += best_pixel_error;
+                    indices |= best_index << (45 - pixel * 3);
+                }
+
+                if (error < best_error) {
+                    best_error = error;
+                    best_bits = (static_cast<uint64_t>(base) << 56) | (static_cast<uint64_t>(multiplier) << 52) | (static_cast<uint64_t>(table) << 48) | indices;
+                }
+            }
+        }
+    }
+
+    return best_bits;
+}
+
+void encode_etc2_rgba8_block(const uint8_t* rgba, EncoderQuality quality, uint8_t* block) noexcept {
+    int alpha[16];
+    for (size_t y = 0; y < 4; y++) {
+        for (size_t x = 0; x < 4; x++) {
+            alpha[get_pixel_index(x, y)] = rgba[(y * 4 + x) * 4 + 3];
+        }
+    }
+    write_64(encode_eac(alpha, false, quality), block);
+
+    uint64_t bits = 0;
+    uint32_t error = encode_etc1_modes(rgba, quality, bits);
+
+    // Planar mode is only worth it for smooth blocks, which ETC1 modes already encode with a small error.
+    if (quality != EncoderQuality::FASTEST && error > 0) {
+        uint64_t planar_bits;
+        if (encode_planar(rgba, quality, planar_bits) < error) {
+            bits = planar_bits;
+        }
+    }
+    write_64(bits, block + 8);
+}
+
+void encode_eac_r11_block(const uint8_t* red, EncoderQuality quality, uint8_t* block) noexcept {
+    int targets[16];
+    for (size_t y = 0; y < 4; y++) {
+        for (size_t x = 0; x < 4; x++) {
+            targets[get_pixel_index(x, y)] = (red[y * 4 + x] * 2047 + 127) / 255;
+        }
+    }
+    write_64(encode_eac(targets, true, quality), block);
+}
+
+void decode_eac_block(const uint8_t* block, bool is_r11, uint8_t* values) noexcept {
+    uint64_t bits = 0;
+    for (size_t i = 0; i < 8; i++) {
+        bits = (bits << 8) | block[i];
+    }
+
+    const int base = static_cast<int>(bits >> 56);
+    const int multiplier = static_cast<int>(bits >> 52) & 0xF;
+    const int* modifiers = EAC_MODIFIERS[(bits >> 48) & 0xF];
+    for (size_t y = 0; y < 4; y++) {
+        for (size_t x = 0; x < 4; x++) {
+            const int modifier = modifiers[(bits >> (45 - get_pixel_index(x, y) * 3)) & 0x7];
+            if (is_r11) {
+                const int value = std::clamp(base * 8 + 4 + (multiplier == 0 ? modifier : modifier * multiplier * 8), 0, 2047);
+                values[y * 4 + x] = static_cast<uint8_t>((value * 255 + 1023) / 2047);
+            } else {
+                values[y * 4 + x] = static_cast<uint8_t>(clamp_255(base + modifier * multiplier));
+            }
+        }
+    }
+}
+
+static void encode_block_rows(const uint8_t* input, bool is_r8, size_t width, size_t height, size_t row_begin, size_t row_end, EncoderQuality quality, uint8_t* output,
+                              const uint8_t* previous, const uint8_t* is_changed, const BlockReuse* warm_start) noexcept {
+    const size_t blocks_x = (width + 3) / 4;
+    const size_t block_size = is_r8 ? 8 : 16;
+
+    for (size_t block_y = row_begin; block_y < row_end; block_y++) {
+        for (size_t block_x = 0; block_x < blocks_x; block_x++) {
+            const size_t index = block_y * blocks_x + block_x;
+            if (is_changed != nullptr && is_changed[index] == 0) {
+                std::memcpy(output + index * block_size, previous + index * block_size, block_size);
+                continue;
+            }
+
+            uint8_t pixels[16 * 4];
+            for (size_t y = 0; y < 4; y++) {
+                for (size_t x = 0; x < 4; x++) {
+                    const size_t pixel_x = std::min(block_x * 4 + x, width - 1);
+                    const size_t pixel_y = std::min(block_y * 4 + y, height - 1);
+                    if (is_r8) {
+                        pixels[y * 4 + x] = input[pixel_y * width + pixel_x];
+                    } else {
+                        const uint8_t* source = input + (pixel_y * width + pixel_x) * 4;
+                        uint8_t* destination = pixels + (y * 4 + x) * 4;
+                        destination[0] = source[2];
+                        destination[1] = source[1];
+                        destination[2] = source[0];
+                        destination[3] = source[3];
+                    }
+                }
+            }
+
+            if (warm_start != nullptr && keep_previous_block(*warm_start, is_r8 ? ReusedBlockFormat::EAC_R11 : ReusedBlockFormat::ETC2_RGBA8, previous + index * block_size, pixels)) {
+                std::memcpy(output + index * block_size, previous + index * block_size, block_size);
+                continue;
+            }
+
+            uint8_t* block = output + (block_y * blocks_x + block_x) * block_size;
+            if (is_r8) {
+                encode_eac_r11_block(pixels, quality, block);
+            } else {
+                encode_etc2_rgba8_block(pixels, quality, block);
+            }
+        }
+    }
+}
+
+bool encode_etc2(std::vector<char>& dds, const MipQualities& qualities, ThreadPool& pool, std::ostream& log, const BlockReuse* reuse) {
+    Dds10Header header;
+    if (!read_dds10_header(dds.data(), dds.size(), header) || (header.dxgi_format != DXGI_FORMAT_B8G8R8A8_UNORM && header.dxgi_format != DXGI_FORMAT_R8_UNORM)) {
+        log << "\rTexture compiler error. ETC2 encoder requires a B8G8R8A8 or R8 DDS texture with the DX10 header." << std::endl;
+        return false;
+    }
+
+    if (header.dimension != DDS10_DIMENSION_TEXTURE_2D || header.misc_flags != 0) {
+        log << "\rTexture compiler error. ETC2 encoder supports only 2D textures and texture arrays." << std::endl;
+        return false;
+    }
+
+    const bool is_r8 = header.dxgi_format == DXGI_FORMAT_R8_UNORM;
+    const TextureFormatSize* format_size = find_texture_format_size(DXGI_FORMAT_UNKNOWN, is_r8 ? EAC_R11_VK_FORMAT : ETC2_RGBA8_VK_FORMAT);
+    const EncodedLayout layout = get_encoded_layout(header, is_r8 ? 1 : 4, format_size->block_size);
+    if (layout.input_size != dds.size()) {
+        log << "\rTexture compiler error. DDS texture size doesn't match its mip levels." << std::endl;
+        return false;
+    }
+
+    reuse = match_block_reuse(reuse, layout);
+
+    std::vector<char> etc2(layout.output_size);
+    std::memcpy(etc2.data(), dds.data(), DDS10_HEADER_SIZE);
+    std::memcpy(etc2.data() + 128, &DXGI_FORMAT_UNKNOWN, sizeof(DXGI_FORMAT_UNKNOWN));
+
+    TaskGroup group;
+
+    for (const EncodedLevel& level : layout.levels) {
+        const size_t level_width = level.input.width;
+        const size_t level_height = level.input.height;
+        const size_t blocks_y = (level_height + 3) / 4;
+
+        const uint8_t* input = reinterpret_cast<const uint8_t*>(dds.data() + level.input.offset);
+        uint8_t* output = reinterpret_cast<uint8_t*>(etc2.data() + level.output.offset);
+        const uint8_t* previous = reuse != nullptr ? reinterpret_cast<const uint8_t*>(reuse->previous.data() + level.output.offset) : nullptr;
+        const uint8_t* is_changed = reuse != nullptr ? reuse->is_changed.data() + level.first_block : nullptr;
+        const BlockReuse* warm_start = reuse != nullptr && reuse->max_error > 0.f ? reuse : nullptr;
+        const EncoderQuality quality = get_mip_quality(qualities, level.input.mip_level);
+
+        for (size_t row = 0; row < blocks_y; row += ETC2_TASK_BLOCK_ROWS) {
+            const size_t row_end = std::min(row + ETC2_TASK_BLOCK_ROWS, blocks_y);
+            pool.push(group, [=] {
+                encode_block_rows(input, is_r8, level_width, level_height, row, row_end, quality, output, previous, is_changed, warm_start);
+            });
+        }
+    }
+
+    pool.wait(group);
+
+    dds = std::move(etc2);
+    return true;
+}
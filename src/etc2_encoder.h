@@ -0,0 +1,33 @@
+#pragma once
+
+#include "encoder_quality.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+struct BlockReuse;
+struct ThreadPool;
+
+// Vulkan formats of the blocks, DDS has no formats for ETC2 and EAC.
+static constexpr uint32_t ETC2_RGBA8_VK_FORMAT = 151;
+static constexpr uint32_t EAC_R11_VK_FORMAT = 153;
+
+// Encodes a single 4x4 block of RGBA8 pixels, rows from the top, into 16 bytes of ETC2 RGBA8: an EAC block of alpha
+// followed by an ETC2 block of color. Color blocks use the individual and differential modes of ETC1 and the planar
+// mode of ETC2, which suits smooth gradients. The T and H modes are never searched.
+void encode_etc2_rgba8_block(const uint8_t* rgba, EncoderQuality quality, uint8_t* block) noexcept;
+
+// Encodes a single 4x4 block of 8-bit values, rows from the top, into 8 bytes of EAC R11.
+void encode_eac_r11_block(const uint8_t* red, EncoderQuality quality, uint8_t* block) noexcept;
+
+// Decodes 8 bytes of EAC, the 8-bit alpha of an ETC2 RGBA8 block or an 11-bit EAC R11 block, into 16 8-bit values,
+// rows from the top. bimg decodes neither of them.
+void decode_eac_block(const uint8_t* block, bool is_r11, uint8_t* values) noexcept;
+
+// Replaces the B8G8R8A8 or R8 mip levels of a 2D DDS texture with the DX10 header with ETC2 RGBA8 or EAC R11 blocks
+// respectively. The DXGI format becomes `DXGI_FORMAT_UNKNOWN`, so the texture must be converted to KTX2 with
+// `ETC2_RGBA8_VK_FORMAT` or `EAC_R11_VK_FORMAT`. Block rows are encoded on the thread pool, `qualities` are the search
+// effort of every mip level.
+bool encode_etc2(std::vector<char>& dds, const MipQualities& qualities, ThreadPool& pool, std::ostream& log, const BlockReuse* reuse = nullptr);
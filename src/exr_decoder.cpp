@@ -0,0 +1,566 @@
+#include "exr_decoder.h"
+
+#include "bc6h_encoder.h"
+
+#include <algorithm>
+#include <cstring>
+#include <exception>
+#include <string>
+
+#if defined(TEXTURE_COMPILER_ZLIB)
+#include <zlib.h>
+#endif
+
+static constexpr uint32_t EXR_MAGIC = 20000630;
+
+static constexpr uint32_t EXR_FLAG_TILED = 0x200;
+static constexpr uint32_t EXR_FLAG_NON_IMAGE = 0x800;
+static constexpr uint32_t EXR_FLAG_MULTI_PART = 0x1000;
+
+static constexpr int32_t EXR_PIXEL_UINT = 0;
+static constexpr int32_t EXR_PIXEL_HALF = 1;
+static constexpr int32_t EXR_PIXEL_FLOAT = 2;
+
+static constexpr uint8_t EXR_COMPRESSION_NONE = 0;
+static constexpr uint8_t EXR_COMPRESSION_RLE = 1;
+static constexpr uint8_t EXR_COMPRESSION_ZIPS = 2;
+static constexpr uint8_t EXR_COMPRESSION_ZIP = 3;
+
+// Images larger than this on any side are rejected before anything is allocated.
+static constexpr int32_t EXR_MAX_SIZE = 1 << 16;
+
+static constexpr uint16_t HALF_ONE = 0x3C00;
+static constexpr uint16_t HALF_MAX = 0x7BFF;
+
+namespace {
+
+// Bounds checked little endian reader of the file.
+struct ExrReader final {
+    const uint8_t* data;
+    size_t size;
+    size_t offset;
+
+    bool read_bytes(void* output, size_t count) noexcept {
+        if (count > size - offset) {
+            return false;
+        }
+        std::memcpy(output, data + offset, count);
+        offset += count;
+        return true;
+    }
+
+    bool read_u32(uint32_t& value) noexcept {
+        uint8_t bytes[4];
+        if (!read_bytes(bytes, sizeof(bytes))) {
+            return false;
+        }
+        value = static_cast<uint32_t>(bytes[0]) | static_cast<uint32_t>(bytes[1]) << 8 | static_cast<uint32_t>(bytes[2]) << 16 | static_cast<uint32_t>(bytes[3]) << 24;
+        return true;
+    }
+
+    bool read_i32(int32_t& value) noexcept {
+        uint32_t bits;
+        if (!read_u32(bits)) {
+            return false;
+        }
+        value = static_cast<int32_t>(bits);
+        return true;
+    }
+
+    bool read_u64(uint64_t& value) noexcept {
+        uint32_t low;
+        uint32_t high;
+        if (!read_u32(low) || !read_u32(high)) {
+            return false;
+        }
+        value = static_cast<uint64_t>(high) << 32 | low;
+        return true;
+    }
+
+    // Null terminated string, empty when the terminator comes first.
+    bool read_string(std::string& value) noexcept {
+        const void* end = std::memchr(data + offset, 0, size - offset);
+        if (end == nullptr) {
+            return false;
+        }
+        const size_t length = static_cast<size_t>(static_cast<const uint8_t*>(end) - (data + offset));
+        value.assign(reinterpret_cast<const char*>(data + offset), length);
+        offset += length + 1;
+        return true;
+    }
+};
+
+struct ExrChannel final {
+    std::string name;
+    int32_t pixel_type = EXR_PIXEL_HALF;
+
+    // RGBA channel the samples go to, or -1 when they are skipped.
+    int target = -1;
+};
+
+struct ExrPart final {
+    std::vector<ExrChannel> channels;
+    uint8_t compression = EXR_COMPRESSION_NONE;
+    int32_t min_x = 0;
+    int32_t min_y = 0;
+    int32_t max_x = -1;
+    int32_t max_y = -1;
+    bool is_tiled = false;
+    uint32_t tile_width = 0;
+    uint32_t tile_height = 0;
+    int32_t chunk_count = -1;
+
+    bool has_data_window = false;
+    bool has_channels = false;
+    bool is_unsupported = false;
+};
+
+} // namespace
+
+static size_t get_sample_size(int32_t pixel_type) noexcept {
+    return pixel_type == EXR_PIXEL_HALF ? 2 : 4;
+}
+
+static int get_lines_per_block(uint8_t compression) noexcept {
+    return compression == EXR_COMPRESSION_ZIP ? 16 : 1;
+}
+
+static bool read_channels(ExrReader& reader, uint32_t size, ExrPart& part) noexcept {
+    const size_t end = reader.offset + size;
+    while (reader.offset < end) {
+        ExrChannel channel;
+        if (!reader.read_string(channel.name)) {
+            return false;
+        }
+        if (channel.name.empty()) {
+            break;
+        }
+
+        uint8_t linear_and_reserved[4];
+        int32_t sampling_x;
+        int32_t sampling_y;
+        if (!reader.read_i32(channel.pixel_type) || !reader.read_bytes(linear_and_reserved, sizeof(linear_and_reserved)) || !reader.read_i32(sampling_x) ||
+            !reader.read_i32(sampling_y)) {
+            return false;
+        }
+
+        if (channel.pixel_type != EXR_PIXEL_UINT && channel.pixel_type != EXR_PIXEL_HALF && channel.pixel_type != EXR_PIXEL_FLOAT) {
+            return false;
+        }
+        if (sampling_x != 1 || sampling_y != 1) {
+            part.is_unsupported = true;
+        }
+
+        if (channel.name == "R") {
+            channel.target = 0;
+        } else if (channel.name == "G") {
+            channel.target = 1;
+        } else if (channel.name == "B") {
+            channel.target = 2;
+        } else if (channel.name == "A") {
+            channel.target = 3;
+        } else if (channel.name == "Y") {
+            channel.target = 4;
+        }
+
+        part.channels.push_back(std::move(channel));
+    }
+
+    reader.offset = end;
+    part.has_channels = true;
+    return true;
+}
+
+// Reads a header up to its terminating null byte. `is_empty` is set for the empty header that ends the headers of a
+// multi-part file.
+static bool read_header(ExrReader& reader, ExrPart& part, bool& is_empty) noexcept {
+    is_empty = true;
+    while (true) {
+        std::string name;
+        if (!reader.read_string(name)) {
+            return false;
+        }
+        if (name.empty()) {
+            return true;
+        }
+        is_empty = false;
+
+        std::string type;
+        uint32_t size;
+        if (!reader.read_string(type) || !reader.read_u32(size) || size > reader.size - reader.offset) {
+            return false;
+        }
+
+        const size_t value_offset = reader.offset;
+        if (name == "channels" && type == "chlist") {
+            if (!read_channels(reader, size, part)) {
+                return false;
+            }
+        } else if (name == "compression" && type == "compression" && size == 1) {
+            part.compression = reader.data[reader.offset];
+        } else if (name == "dataWindow" && type == "box2i" && size == 16) {
+            if (!reader.read_i32(part.min_x) || !reader.read_i32(part.min_y) || !reader.read_i32(part.max_x) || !reader.read_i32(part.max_y)) {
+                return false;
+            }
+            part.has_data_window = true;
+        } else if (name == "tiles" && type == "tiledesc" && size == 9) {
+            if (!reader.read_u32(part.tile_width) || !reader.read_u32(part.tile_height)) {
+                return false;
+            }
+            part.is_tiled = true;
+        } else if (name == "type" && type == "string") {
+            const std::string value(reinterpret_cast<const char*>(reader.data + reader.offset), size);
+            part.is_tiled = value == "tiledimage";
+            if (value != "scanlineimage" && value != "tiledimage") {
+                // Deep images can't be decoded, but they don't stop other parts from being decoded.
+                part.is_unsupported = true;
+            }
+        } else if (name == "chunkCount" && type == "int" && size == 4) {
+            if (!reader.read_i32(part.chunk_count)) {
+                return false;
+            }
+        }
+        reader.offset = value_offset + size;
+    }
+}
+
+static bool is_rgb_part(const ExrPart& part) noexcept {
+    bool has_rgb[5] = {};
+    for (const ExrChannel& channel : part.channels) {
+        if (channel.target >= 0) {
+            has_rgb[channel.target] = true;
+        }
+    }
+    return (has_rgb[0] && has_rgb[1] && has_rgb[2]) || has_rgb[4];
+}
+
+// Undoes the byte predictor and the split into even and odd bytes of RLE and ZIP compression.
+static void reorder_bytes(const uint8_t* input, size_t size, uint8_t* output) noexcept {
+    std::vector<uint8_t> predicted(input, input + size);
+    for (size_t i = 1; i < size; i++) {
+        predicted[i] = static_cast<uint8_t>(predicted[i - 1] + predicted[i] - 128);
+    }
+
+    const size_t half = (size + 1) / 2;
+    for (size_t i = 0; i < size; i++) {
+        output[i] = (i & 1) == 0 ? predicted[i / 2] : predicted[half + i / 2];
+    }
+}
+
+static bool decompress_rle(const uint8_t* input, size_t input_size, std::vector<uint8_t>& output) noexcept {
+    std::vector<uint8_t> decoded;
+    decoded.reserve(output.size());
+
+    size_t offset = 0;
+    while (offset < input_size) {
+        const int count = static_cast<int8_t>(input[offset++]);
+        if (count < 0) {
+            const size_t length = static_cast<size_t>(-count);
+            if (length > input_size - offset || decoded.size() + length > output.size()) {
+                return false;
+            }
+            decoded.insert(decoded.end(), input + offset, input + offset + length);
+            offset += length;
+        } else {
+            const size_t length = static_cast<size_t>(count) + 1;
+            if (offset == input_size || decoded.size() + length > output.size()) {
+                return false;
+            }
+            decoded.insert(decoded.end(), length, input[offset++]);
+        }
+    }
+
+    if (decoded.size() != output.size()) {
+        return false;
+    }
+    reorder_bytes(decoded.data(), decoded.size(), output.data());
+    return true;
+}
+
+static bool decompress_zip(const uint8_t* input, size_t input_size, std::vector<uint8_t>& output) noexcept {
+#if defined(TEXTURE_COMPILER_ZLIB)
+    std::vector<uint8_t> decoded(output.size());
+    uLongf decoded_size = static_cast<uLongf>(decoded.size());
+    if (uncompress(decoded.data(), &decoded_size, input, static_cast<uLong>(input_size)) != Z_OK || decoded_size != decoded.size()) {
+        return false;
+    }
+    reorder_bytes(decoded.data(), decoded.size(), output.data());
+    return true;
+#else
+    (void)input;
+    (void)input_size;
+    (void)output;
+    return false;
+#endif
+}
+
+static uint16_t sanitize_half(uint16_t value) noexcept {
+    if ((value & 0x8000) != 0) {
+        return 0;
+    }
+    if ((value & 0x7C00) == 0x7C00) {
+        return (value & 0x3FF) != 0 ? 0 : HALF_MAX;
+    }
+    return value;
+}
+
+static uint16_t read_sample(const uint8_t* sample, int32_t pixel_type) noexcept {
+    if (pixel_type == EXR_PIXEL_HALF) {
+        return sanitize_half(static_cast<uint16_t>(sample[0] | sample[1] << 8));
+    }
+
+    const uint32_t bits = static_cast<uint32_t>(sample[0]) | static_cast<uint32_t>(sample[1]) << 8 | static_cast<uint32_t>(sample[2]) << 16 | static_cast<uint32_t>(sample[3]) << 24;
+    float value;
+    if (pixel_type == EXR_PIXEL_FLOAT) {
+        std::memcpy(&value, &bits, sizeof(value));
+    } else {
+        value = static_cast<float>(bits);
+    }
+
+    uint16_t result;
+    convert_rgba32f_to_rgba16f(&value, 1, &result);
+    return result;
+}
+
+// Scatters the channels of `line_count` lines of `line_width` pixels, starting at pixel (`x`, `y`) of the image, from
+// a decompressed block into the RGBA pixels.
+static void scatter_block(const ExrPart& part, const uint8_t* block, int x, int y, int line_width, int line_count, int width, uint16_t* pixels) noexcept {
+    for (int line = 0; line < line_count; line++) {
+        uint16_t* row = pixels + (static_cast<size_t>(y + line) * static_cast<size_t>(width) + static_cast<size_t>(x)) * 4;
+        for (const ExrChannel& channel : part.channels) {
+            const size_t sample_size = get_sample_size(channel.pixel_type);
+            if (channel.target >= 0) {
+                for (int i = 0; i < line_width; i++) {
+                    const uint16_t value = read_sample(block + static_cast<size_t>(i) * sample_size, channel.pixel_type);
+                    if (channel.target == 4) {
+                        row[i * 4 + 0] = value;
+                        row[i * 4 + 1] = value;
+                        row[i * 4 + 2] = value;
+                    } else {
+                        row[i * 4 + channel.target] = value;
+                    }
+                }
+            }
+            block += static_cast<size_t>(line_width) * sample_size;
+        }
+    }
+}
+
+static bool decode_chunk(ExrReader& reader, const ExrPart& part, bool is_multi_part, int width, int height, std::vector<uint8_t>& block, uint16_t* pixels) noexcept {
+    if (is_multi_part) {
+        int32_t part_number;
+        if (!reader.read_i32(part_number)) {
+            return false;
+        }
+    }
+
+    int x = 0;
+    int y = 0;
+    int line_width = width;
+    int line_count = 0;
+    if (part.is_tiled) {
+        int32_t tile_x;
+        int32_t tile_y;
+        int32_t level_x;
+        int32_t level_y;
+        if (!reader.read_i32(tile_x) || !reader.read_i32(tile_y) || !reader.read_i32(level_x) || !reader.read_i32(level_y)) {
+            return false;
+        }
+        if (level_x != 0 || level_y != 0 || tile_x < 0 || tile_y < 0) {
+            return false;
+        }
+
+        const int64_t tile_left = static_cast<int64_t>(tile_x) * part.tile_width;
+        const int64_t tile_top = static_cast<int64_t>(tile_y) * part.tile_height;
+        if (tile_left >= width || tile_top >= height) {
+            return false;
+        }
+        x = static_cast<int>(tile_left);
+        y = static_cast<int>(tile_top);
+        line_width = static_cast<int>(std::min<int64_t>(part.tile_width, width - tile_left));
+        line_count = static_cast<int>(std::min<int64_t>(part.tile_height, height - tile_top));
+    } else {
+        int32_t line;
+        if (!reader.read_i32(line)) {
+            return false;
+        }
+        const int64_t first_line = static_cast<int64_t>(line) - part.min_y;
+        if (first_line < 0 || first_line >= height) {
+            return false;
+        }
+        y = static_cast<int>(first_line);
+        line_count = std::min(get_lines_per_block(part.compression), height - y);
+    }
+
+    uint32_t packed_size;
+    if (!reader.read_u32(packed_size) || packed_size > reader.size - reader.offset) {
+        return false;
+    }
+    const uint8_t* packed = reader.data + reader.offset;
+
+    size_t line_size = 0;
+    for (const ExrChannel& channel : part.channels) {
+        line_size += static_cast<size_t>(line_width) * get_sample_size(channel.pixel_type);
+    }
+    const size_t unpacked_size = line_size * static_cast<size_t>(line_count);
+
+    // Blocks that don't get smaller when compressed are stored as is.
+    if (part.compression == EXR_COMPRESSION_NONE || packed_size >= unpacked_size) {
+        if (packed_size != unpacked_size) {
+            return false;
+        }
+        scatter_block(part, packed, x, y, line_width, line_count, width, pixels);
+        return true;
+    }
+
+    block.resize(unpacked_size);
+    const bool is_decompressed = part.compression == EXR_COMPRESSION_RLE ? decompress_rle(packed, packed_size, block) : decompress_zip(packed, packed_size, block);
+    if (!is_decompressed) {
+        return false;
+    }
+    scatter_block(part, block.data(), x, y, line_width, line_count, width, pixels);
+    return true;
+}
+
+bool is_exr(const uint8_t* data, size_t size) noexcept {
+    return size >= 4 && (static_cast<uint32_t>(data[0]) | static_cast<uint32_t>(data[1]) << 8 | static_cast<uint32_t>(data[2]) << 16 |
+                         static_cast<uint32_t>(data[3]) << 24) == EXR_MAGIC;
+}
+
+// Reads the version and the headers of every part, the reader is left at the offset tables.
+static bool read_parts(ExrReader& reader, std::vector<ExrPart>& parts, bool& is_multi_part) {
+    uint32_t magic;
+    uint32_t version;
+    if (!reader.read_u32(magic) || magic != EXR_MAGIC || !reader.read_u32(version) || (version & 0xFF) != 2 || (version & EXR_FLAG_NON_IMAGE) != 0) {
+        return false;
+    }
+
+    is_multi_part = (version & EXR_FLAG_MULTI_PART) != 0;
+    while (true) {
+        ExrPart part;
+        bool is_empty;
+        if (!read_header(reader, part, is_empty)) {
+            return false;
+        }
+        if (is_empty && is_multi_part) {
+            return true;
+        }
+        if (!is_multi_part) {
+            part.is_tiled = (version & EXR_FLAG_TILED) != 0;
+        }
+        if (!part.has_channels || !part.has_data_window || (part.is_tiled && (part.tile_width == 0 || part.tile_height == 0))) {
+            return false;
+        }
+        parts.push_back(std::move(part));
+        if (!is_multi_part) {
+            return true;
+        }
+    }
+}
+
+static bool is_supported_part(const ExrPart& part) noexcept {
+    return is_rgb_part(part) && !part.is_unsupported &&
+           (part.compression == EXR_COMPRESSION_NONE || part.compression == EXR_COMPRESSION_RLE || part.compression == EXR_COMPRESSION_ZIPS ||
+            part.compression == EXR_COMPRESSION_ZIP);
+}
+
+bool read_exr_size(const uint8_t* data, size_t size, int& width, int& height) noexcept {
+    try {
+        ExrReader reader = { data, size, 0 };
+        std::vector<ExrPart> parts;
+        bool is_multi_part;
+        if (!read_parts(reader, parts, is_multi_part)) {
+            return false;
+        }
+
+        for (const ExrPart& part : parts) {
+            const int64_t part_width = static_cast<int64_t>(part.max_x) - part.min_x + 1;
+            const int64_t part_height = static_cast<int64_t>(part.max_y) - part.min_y + 1;
+            if (part_width <= 0 || part_height <= 0 || part_width > EXR_MAX_SIZE || part_height > EXR_MAX_SIZE) {
+                return false;
+            }
+            if (is_supported_part(part)) {
+                width = static_cast<int>(part_width);
+                height = static_cast<int>(part_height);
+                return true;
+            }
+        }
+        return false;
+    } catch (const std::exception&) {
+        return false;
+    }
+}
+
+bool decode_exr_rgba16f(const uint8_t* data, size_t size, int& width, int& height, std::vector<uint16_t>& pixels) noexcept {
+    try {
+        ExrReader reader = { data, size, 0 };
+        std::vector<ExrPart> parts;
+        bool is_multi_part;
+        if (!read_parts(reader, parts, is_multi_part)) {
+            return false;
+        }
+
+        // Offset tables of all the parts follow the headers one after another, so the tables of the parts before the
+        // decoded one are skipped by their chunk counts.
+        for (size_t index = 0; index < parts.size(); index++) {
+            const ExrPart& part = parts[index];
+            const int64_t part_width = static_cast<int64_t>(part.max_x) - part.min_x + 1;
+            const int64_t part_height = static_cast<int64_t>(part.max_y) - part.min_y + 1;
+            if (part_width <= 0 || part_height <= 0 || part_width > EXR_MAX_SIZE || part_height > EXR_MAX_SIZE) {
+                return false;
+            }
+
+            // Tiles of the first level come first in the offset table of a tiled image.
+            int64_t first_level_chunks;
+            if (part.is_tiled) {
+                first_level_chunks = ((part_width + part.tile_width - 1) / part.tile_width) * ((part_height + part.tile_height - 1) / part.tile_height);
+            } else {
+                first_level_chunks = (part_height + get_lines_per_block(part.compression) - 1) / get_lines_per_block(part.compression);
+            }
+
+            if (!is_supported_part(part)) {
+                if (!is_multi_part || part.chunk_count < 0 || static_cast<uint64_t>(part.chunk_count) * 8 > reader.size - reader.offset) {
+                    return false;
+                }
+                reader.offset += static_cast<size_t>(part.chunk_count) * 8;
+                continue;
+            }
+
+            if (static_cast<uint64_t>(first_level_chunks) * 8 > reader.size - reader.offset) {
+                return false;
+            }
+
+            width = static_cast<int>(part_width);
+            height = static_cast<int>(part_height);
+
+            std::vector<uint64_t> offsets(static_cast<size_t>(first_level_chunks));
+            for (uint64_t& offset : offsets) {
+                if (!reader.read_u64(offset)) {
+                    return false;
+                }
+            }
+
+            // Channels that are not in the file stay zero, alpha stays opaque.
+            pixels.assign(static_cast<size_t>(width) * static_cast<size_t>(height) * 4, 0);
+            for (size_t i = 3; i < pixels.size(); i += 4) {
+                pixels[i] = HALF_ONE;
+            }
+
+            std::vector<uint8_t> block;
+            for (const uint64_t offset : offsets) {
+                if (offset >= size) {
+                    return false;
+                }
+                ExrReader chunk_reader = { data, size, static_cast<size_t>(offset) };
+                if (!decode_chunk(chunk_reader, part, is_multi_part, width, height, block, pixels.data())) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        return false;
+    } catch (const std::exception&) {
+        return false;
+    }
+}
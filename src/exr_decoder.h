@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// True when the data starts with the magic number of OpenEXR.
+bool is_exr(const uint8_t* data, size_t size) noexcept;
+
+// Decodes the data window of an OpenEXR image to interleaved RGBA half floats in rows from the top, ready for
+// `bgfx::TextureFormat::RGBA16F`. Scanline and tiled images are supported, tiled ones as their first level, and
+// multi-part files provide their first part with R, G and B or Y channels. Channels are half, float or uint, float and
+// uint channels are rounded to half floats. Images without an alpha channel are opaque, Y channels are copied to red,
+// green and blue. Negative and NaN values become zero, infinities become the largest half float, like the other
+// inputs of cube maps. Compression must be NONE, RLE, ZIPS or ZIP, the last two only when the compiler is built with
+// zlib. Returns false for everything else, including broken files.
+bool decode_exr_rgba16f(const uint8_t* data, size_t size, int& width, int& height, std::vector<uint16_t>& pixels) noexcept;
+
+// Reads the size of the part `decode_exr_rgba16f` would decode from the headers alone, without touching the pixels.
+// Returns false when the headers are broken or no part is supported.
+bool read_exr_size(const uint8_t* data, size_t size, int& width, int& height) noexcept;
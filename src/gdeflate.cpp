@@ -0,0 +1,82 @@
+#include "gdeflate.h"
+#include "dds_layout.h"
+#include "gpu_layout.h"
+#include "thread_pool.h"
+
+#include <cstring>
+
+#if defined(TEXTURE_COMPILER_GDEFLATE)
+#include <GDeflate.h>
+#endif
+
+// Level 9 of 12 compresses BC blocks within a percent of the highest level several times faster.
+static constexpr uint32_t GDEFLATE_LEVEL = 9;
+
+bool convert_dds_to_gdeflate(const std::vector<char>& dds, std::vector<char>& output, ThreadPool& pool, std::ostream& log) {
+    std::vector<DdsSubresource> subresources;
+    if (!get_dds_subresources(dds, subresources, log)) {
+        // Error is printed in `get_dds_subresources`.
+        return false;
+    }
+
+#if defined(TEXTURE_COMPILER_GDEFLATE)
+    // Buffers are allocated up front, tasks of the thread pool must not throw.
+    std::vector<std::vector<uint8_t>> streams(subresources.size());
+    std::vector<size_t> stream_sizes(subresources.size());
+    for (size_t i = 0; i < subresources.size(); i++) {
+        streams[i].resize(GDeflate::CompressBound(subresources[i].size));
+        stream_sizes[i] = streams[i].size();
+    }
+
+    std::vector<uint8_t> is_failed(subresources.size(), 0);
+
+    TaskGroup group;
+    for (size_t i = 0; i < subresources.size(); i++) {
+        pool.push(group, [&, i] {
+            // Mip levels are already compressed in parallel, every one of them on a single thread.
+            const uint8_t* input = reinterpret_cast<const uint8_t*>(dds.data() + subresources[i].offset);
+            if (!GDeflate::Compress(streams[i].data(), &stream_sizes[i], input, subresources[i].size, GDEFLATE_LEVEL, GDeflate::COMPRESS_SINGLE_THREAD)) {
+                is_failed[i] = 1;
+            }
+        });
+    }
+    pool.wait(group);
+
+    for (uint8_t is_subresource_failed : is_failed) {
+        if (is_subresource_failed != 0) {
+            log << "\rTexture compiler error. Failed to compress a mip level with GDeflate." << std::endl;
+            return false;
+        }
+    }
+
+    GDeflateHeader header {};
+    std::memcpy(header.magic, GDEFLATE_MAGIC, sizeof(GDEFLATE_MAGIC));
+    header.version = GDEFLATE_VERSION;
+    header.subresource_count = static_cast<uint32_t>(subresources.size());
+    header.dds_header_size = static_cast<uint32_t>(DDS10_HEADER_SIZE);
+
+    const size_t table_offset = sizeof(GDeflateHeader) + DDS10_HEADER_SIZE;
+    size_t size = table_offset + sizeof(GDeflateSubresource) * subresources.size();
+    for (size_t stream_size : stream_sizes) {
+        size += stream_size;
+    }
+
+    output.assign(size, 0);
+    std::memcpy(output.data(), &header, sizeof(header));
+    std::memcpy(output.data() + sizeof(GDeflateHeader), dds.data(), DDS10_HEADER_SIZE);
+
+    size_t offset = table_offset + sizeof(GDeflateSubresource) * subresources.size();
+    for (size_t i = 0; i < subresources.size(); i++) {
+        const GDeflateSubresource subresource { offset, stream_sizes[i], subresources[i].offset, subresources[i].size };
+        std::memcpy(output.data() + table_offset + sizeof(GDeflateSubresource) * i, &subresource, sizeof(subresource));
+        std::memcpy(output.data() + offset, streams[i].data(), stream_sizes[i]);
+        offset += stream_sizes[i];
+    }
+    return true;
+#else
+    (void)output;
+    (void)pool;
+    log << "\rTexture compiler error. Built without GDeflate, --container dds-gdeflate is not available." << std::endl;
+    return false;
+#endif
+}
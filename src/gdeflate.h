@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+struct ThreadPool;
+
+// Texture of `--container dds-gdeflate`, whose mip levels are GDeflate streams that DirectStorage decompresses on the
+// GPU straight into the upload buffer or the texture. Every mip level of every layer is a stream of its own, so a
+// runtime issues a request per resident mip level and reads nothing it doesn't stream in. Every stream is split into
+// 64 KB tiles with the tile table of the GDeflate stream format in front of them, so the tiles of a mip level are
+// decompressed in parallel. All integers are little endian, all offsets are from the start of the file:
+//
+//   Header        `GDeflateHeader`.
+//   DDS header    The DDS header with the DX10 header of the texture, `dds_header_size` bytes, with the fields of
+//                 `gpu_layout.h` when the texture is compiled with `--layout`.
+//   Subresources  `GDeflateSubresource` per mip level of every layer, layers after each other with all of their levels
+//                 from the largest, like in DDS.
+//   Streams       GDeflate stream of every subresource in the same order.
+//
+// Decompressed subresources are exactly the mip levels of the DDS texture, with the padding of `--layout` if any, so
+// the DDS header and the subresources at their `uncompressed_offset` make up the DDS file.
+static constexpr char GDEFLATE_MAGIC[4] = { 'T', 'C', 'G', 'D' };
+static constexpr uint32_t GDEFLATE_VERSION = 1;
+
+struct GDeflateHeader final {
+    char magic[4];
+    uint32_t version;
+    uint32_t subresource_count;
+    uint32_t dds_header_size;
+};
+
+struct GDeflateSubresource final {
+    uint64_t offset;
+    uint64_t size;
+
+    // Offset and size of the decompressed subresource in the DDS file.
+    uint64_t uncompressed_offset;
+    uint64_t uncompressed_size;
+};
+
+static_assert(sizeof(GDeflateHeader) == 16 && sizeof(GDeflateSubresource) == 32, "GDeflate structures must have no padding.");
+
+// Compresses the mip levels of a DDS texture with the DX10 header, tightly packed or laid out by
+// `convert_dds_to_gpu_layout`, into the GDeflate container. Mip levels are compressed on the thread pool. Fails when
+// the compiler is built without the GDeflate library.
+bool convert_dds_to_gdeflate(const std::vector<char>& dds, std::vector<char>& output, ThreadPool& pool, std::ostream& log);
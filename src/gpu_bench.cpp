@@ -0,0 +1,237 @@
+#include "gpu_bench.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+
+// Times of one compiled job. Passes are bgfx views without the face and mip level in their names, like `prefilter`
+// for every `prefilter_view_<face>_<mip level>`.
+struct GpuBenchRun final {
+    double wall_seconds = 0.0;
+    double encode_seconds = 0.0;
+
+    // Negative when nothing was read back, like on the CPU backend.
+    double readback_seconds = -1.0;
+    std::map<std::string, double> pass_seconds;
+};
+
+static float get_noise(uint32_t x, uint32_t y) noexcept {
+    uint32_t hash = x * 0x9E3779B1u ^ y * 0x85EBCA77u;
+    hash ^= hash >> 15;
+    hash *= 0x2C1B3C6Du;
+    hash ^= hash >> 12;
+    return static_cast<float>(hash & 0xFFFF) / 65535.f;
+}
+
+// Equirectangular sky with a bright sun and a darker ground, so irradiance and prefilter integrate a high dynamic
+// range like real skies have.
+static std::vector<float> create_sky(size_t width, size_t height) {
+    constexpr float PI = 3.14159265358979f;
+    const float sun[3] = { 0.48f, 0.6f, 0.64f };
+
+    std::vector<float> pixels(width * height * 4);
+    for (size_t y = 0; y < height; y++) {
+        const float elevation = PI * (0.5f - (static_cast<float>(y) + 0.5f) / static_cast<float>(height));
+        for (size_t x = 0; x < width; x++) {
+            const float azimuth = 2.f * PI * (static_cast<float>(x) + 0.5f) / static_cast<float>(width);
+            const float direction[3] = { std::cos(elevation) * std::cos(azimuth), std::sin(elevation), std::cos(elevation) * std::sin(azimuth) };
+            const float sun_cosine = direction[0] * sun[0] + direction[1] * sun[1] + direction[2] * sun[2];
+            const float noise = 0.9f + 0.2f * get_noise(static_cast<uint32_t>(x), static_cast<uint32_t>(y));
+
+            float* pixel = &pixels[(y * width + x) * 4];
+            if (sun_cosine > 0.9995f) {
+                pixel[0] = pixel[1] = pixel[2] = 2000.f;
+            } else if (elevation > 0.f) {
+                pixel[0] = (0.3f + 0.5f * (1.f - elevation)) * noise;
+                pixel[1] = (0.5f + 0.3f * (1.f - elevation)) * noise;
+                pixel[2] = 1.f * noise;
+            } else {
+                pixel[0] = 0.2f * noise;
+                pixel[1] = 0.15f * noise;
+                pixel[2] = 0.1f * noise;
+            }
+            pixel[3] = 1.f;
+        }
+    }
+    return pixels;
+}
+
+static bool ends_with(const std::string& text, const char* suffix) noexcept {
+    const size_t length = std::char_traits<char>::length(suffix);
+    return text.size() >= length && text.compare(text.size() - length, length, suffix) == 0;
+}
+
+static double get_median(std::vector<double> values) {
+    std::sort(values.begin(), values.end());
+    return values.size() % 2 != 0 ? values[values.size() / 2] : (values[values.size() / 2 - 1] + values[values.size() / 2]) / 2.0;
+}
+
+// Compiles the job once and adds its times to `runs`, unless it's a warm up run. Messages of the job would break the
+// table, so only the ones of failed jobs and the warnings of warm up runs, like a renderer falling back, are printed.
+// Returns zero on success.
+static int run_job(CompilerContext& context, const CompileJob& job, const ImageView& image, std::ostream& log, std::vector<GpuBenchRun>* runs) noexcept {
+    try {
+        auto metrics = std::make_unique<JobMetrics>();
+        metrics->kind = get_texture_kind_name(job.kind);
+        metrics->compression = get_compression_name(job.compression);
+        metrics->input = "bench-gpu";
+        metrics->outputs = get_job_outputs(job);
+        metrics->result = "compiled";
+        metrics->begin_seconds = get_trace_seconds();
+        metrics->thread = get_thread_index();
+
+        const auto wall_begin = std::chrono::steady_clock::now();
+        const double cpu_begin = get_process_cpu_time();
+        std::ostringstream job_log;
+        const int result = compile_image(context, job, image, [](const std::string&, const char*, size_t) {}, job_log, metrics.get());
+        metrics->wall_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - wall_begin).count();
+        metrics->cpu_seconds = get_process_cpu_time() - cpu_begin;
+        metrics->peak_memory_usage = get_peak_memory_usage();
+        if (result != 0) {
+            // Error is printed in `compile_image`.
+            log << job_log.str();
+            return 1;
+        }
+        if (runs == nullptr) {
+            std::istringstream lines(job_log.str());
+            for (std::string line; std::getline(lines, line);) {
+                if (line.find("Texture compiler warning.") != std::string::npos) {
+                    log << line << std::endl;
+                }
+            }
+            return 0;
+        }
+
+        GpuBenchRun run;
+        run.wall_seconds = metrics->wall_seconds;
+        for (const PhaseMetrics& phase : metrics->phases) {
+            if (ends_with(phase.name, "readback")) {
+                run.readback_seconds = std::max(run.readback_seconds, 0.0) + phase.wall_seconds;
+            } else if (ends_with(phase.name, "encode")) {
+                run.encode_seconds += phase.wall_seconds;
+            }
+        }
+        for (const GpuViewMetrics& view : metrics->gpu_views) {
+            run.pass_seconds[view.name.substr(0, view.name.find("_view"))] += view.gpu_seconds;
+        }
+        runs->push_back(std::move(run));
+
+        if (context.metrics) {
+            context.metrics->add_job(std::move(metrics));
+        }
+    } catch (const std::exception& exception) {
+        log << "Texture compiler error. Failed to benchmark a cube map: " << exception.what() << "." << std::endl;
+        return 1;
+    }
+    return 0;
+}
+
+static void print_runs(const CompileJob& job, const std::vector<GpuBenchRun>& runs, std::ostream& log) {
+    log << std::setw(8) << job.output_size << std::setw(12) << job.output_irradiance_size << std::setw(11) << job.output_prefilter_size << std::setw(9) << job.prefilter_samples;
+    if (runs.empty()) {
+        log << "  failed" << std::endl;
+        return;
+    }
+
+    std::vector<double> wall_seconds;
+    std::vector<double> gpu_seconds;
+    std::vector<double> readback_seconds;
+    std::vector<double> encode_seconds;
+    std::map<std::string, std::vector<double>> pass_seconds;
+    for (const GpuBenchRun& run : runs) {
+        wall_seconds.push_back(run.wall_seconds);
+        readback_seconds.push_back(run.readback_seconds);
+        encode_seconds.push_back(run.encode_seconds);
+        double total_seconds = 0.0;
+        for (const auto& [pass, seconds] : run.pass_seconds) {
+            pass_seconds[pass].push_back(seconds);
+            total_seconds += seconds;
+        }
+        gpu_seconds.push_back(total_seconds);
+    }
+
+    log << std::fixed << std::setprecision(3) << std::setw(10) << get_median(wall_seconds);
+    if (!pass_seconds.empty()) {
+        log << std::setw(10) << std::setprecision(2) << get_median(gpu_seconds) * 1000.0;
+    } else {
+        log << std::setw(10) << "-";
+    }
+    if (const double median_readback_seconds = get_median(readback_seconds); median_readback_seconds >= 0.0) {
+        log << std::setw(13) << std::setprecision(2) << median_readback_seconds * 1000.0;
+    } else {
+        log << std::setw(13) << "-";
+    }
+    log << std::setw(12) << std::setprecision(3) << get_median(encode_seconds) << std::endl;
+
+    // Passes a run lacks, like the BC6H compute pass of a renderer that fell back, count as zero in its median.
+    if (!pass_seconds.empty()) {
+        log << "  GPU ms:";
+        for (auto& [pass, seconds] : pass_seconds) {
+            seconds.resize(runs.size(), 0.0);
+            log << " " << pass << " " << std::setprecision(2) << get_median(seconds) * 1000.0;
+        }
+        log << std::endl;
+    }
+    log << std::defaultfloat << std::setprecision(6);
+}
+
+int run_gpu_bench(CompilerContext& context, const GpuBenchSettings& settings, std::ostream& log) noexcept {
+    try {
+        const size_t height = *std::max_element(settings.output_sizes.begin(), settings.output_sizes.end());
+        const std::vector<float> sky = create_sky(height * 2, height);
+
+        ImageView image;
+        image.pixels = sky.data();
+        image.format = PixelFormat::RGBA32F;
+        image.width = static_cast<int>(height * 2);
+        image.height = static_cast<int>(height);
+
+        log << "Benchmarking cube maps with --" << get_compression_name(settings.compression) << " from a " << image.width << "x" << image.height << " sky, median of "
+            << settings.runs << " runs." << std::endl;
+        log << std::setw(8) << "output" << std::setw(12) << "irradiance" << std::setw(11) << "prefilter" << std::setw(9) << "samples" << std::setw(10) << "wall s" << std::setw(10) << "GPU ms"
+            << std::setw(13) << "readback ms" << std::setw(12) << "encode s" << std::endl;
+
+        bool is_failed = false;
+        for (const size_t output_size : settings.output_sizes) {
+            for (const size_t irradiance_size : settings.irradiance_sizes) {
+                for (const size_t prefilter_size : settings.prefilter_sizes) {
+                    for (const size_t prefilter_samples : settings.prefilter_samples) {
+                        CompileJob job;
+                        job.kind = TextureKind::CUBE_MAP;
+                        job.compression = settings.compression;
+                        job.output = "bench.texture";
+                        job.output_size = output_size;
+                        job.output_irradiance = "bench_irradiance.texture";
+                        job.output_irradiance_size = irradiance_size;
+                        job.output_prefilter = "bench_prefilter.texture";
+                        job.output_prefilter_size = prefilter_size;
+                        job.prefilter_samples = prefilter_samples;
+
+                        // The warm up run isn't timed, the first job of the process also initializes the renderer.
+                        std::vector<GpuBenchRun> runs;
+                        bool is_job_failed = run_job(context, job, image, log, nullptr) != 0;
+                        for (size_t i = 0; i < settings.runs && !is_job_failed; i++) {
+                            is_job_failed = run_job(context, job, image, log, &runs) != 0;
+                        }
+                        if (is_job_failed) {
+                            runs.clear();
+                            is_failed = true;
+                        }
+                        print_runs(job, runs, log);
+                    }
+                }
+            }
+        }
+        return is_failed ? 1 : 0;
+    } catch (const std::exception& exception) {
+        log << "Texture compiler error. Failed to benchmark cube maps: " << exception.what() << "." << std::endl;
+        return 1;
+    }
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "compiler.h"
+
+#include <cstddef>
+#include <ostream>
+#include <vector>
+
+// Grid of cube map jobs of `--bench-gpu`, which times the stages of cube maps in-process to pick probe resolutions for
+// a platform and compare renderers. Every combination of the sizes and sample counts is compiled once to warm up and
+// then `runs` times from a synthetic equirectangular sky in memory, twice as wide as the largest output size, so the
+// input costs the same at every point of the grid, and the outputs are discarded.
+struct GpuBenchSettings final {
+    std::vector<size_t> output_sizes;
+    std::vector<size_t> irradiance_sizes;
+    std::vector<size_t> prefilter_sizes;
+    std::vector<size_t> prefilter_samples;
+    size_t runs = 3;
+    Compression compression = Compression::POOR_BUT_FAST;
+};
+
+// Compiles the grid and prints the median wall time of every point, GPU time of every pass, readback time and CPU
+// time of encoding faces, summed over the faces the thread pool encodes in parallel. The timed jobs are added to the
+// metrics of the context too when it has them. Must be called by the thread that created the context. Returns zero
+// when every job compiled, errors are printed to `log`.
+int run_gpu_bench(CompilerContext& context, const GpuBenchSettings& settings, std::ostream& log) noexcept;
@@ -0,0 +1,228 @@
+#include "gpu_layout.h"
+#include "dds_layout.h"
+#include "hash.h"
+
+#include <algorithm>
+#include <cstring>
+
+// Mip level of a layer with its rows.
+struct LayoutSubresource final {
+    size_t offset;
+    size_t row_size;
+    size_t row_count;
+    size_t row_pitch;
+};
+
+static void write_32(char* data, size_t offset, uint32_t value) noexcept {
+    std::memcpy(data + offset, &value, sizeof(value));
+}
+
+static size_t align_size(size_t size, size_t alignment) noexcept {
+    return (size + alignment - 1) & ~(alignment - 1);
+}
+
+// Describes the mip levels of every layer of a DDS texture with the DX10 header laid out with the given alignments.
+static bool get_layout_subresources(const std::vector<char>& dds, uint32_t row_pitch_alignment, uint32_t subresource_alignment,
+                                    std::vector<LayoutSubresource>& subresources, size_t& size, std::ostream& log) {
+    Dds10Header header;
+    if (!read_dds10_header(dds.data(), dds.size(), header)) {
+        log << "\rTexture compiler error. GPU layout requires a DDS texture with the DX10 header." << std::endl;
+        return false;
+    }
+
+    if (header.dimension != DDS10_DIMENSION_TEXTURE_2D) {
+        log << "\rTexture compiler error. GPU layout supports only 2D textures, texture arrays and cube maps." << std::endl;
+        return false;
+    }
+
+    const TextureFormatSize* format = find_texture_format_size(header.dxgi_format);
+    if (format == nullptr) {
+        log << "\rTexture compiler error. GPU layout doesn't support DXGI format " << header.dxgi_format << "." << std::endl;
+        return false;
+    }
+
+    // Levels of the tightly packed texture, which the alignments move apart.
+    const std::vector<DdsLevel> levels =
+        get_dds_levels(header.width, header.height, header.level_count, header.get_layer_count(), format->block_size, format->is_block_compressed);
+
+    subresources.clear();
+    subresources.reserve(levels.size());
+
+    size = DDS10_HEADER_SIZE;
+    for (const DdsLevel& level : levels) {
+        LayoutSubresource subresource;
+        subresource.offset = align_size(size, subresource_alignment);
+        subresource.row_size = (format->is_block_compressed ? (level.width + 3) / 4 : level.width) * format->block_size;
+        subresource.row_count = format->is_block_compressed ? (level.height + 3) / 4 : level.height;
+        subresource.row_pitch = align_size(subresource.row_size, row_pitch_alignment);
+        subresources.push_back(subresource);
+
+        size = subresource.offset + subresource.row_pitch * subresource.row_count;
+    }
+    return true;
+}
+
+bool convert_dds_to_gpu_layout(const std::vector<char>& dds, std::vector<char>& output, uint32_t row_pitch_alignment, uint32_t subresource_alignment,
+                               std::ostream& log) {
+    std::vector<LayoutSubresource> input_subresources;
+    std::vector<LayoutSubresource> output_subresources;
+    size_t input_size;
+    size_t output_size;
+    if (!get_layout_subresources(dds, 1, 1, input_subresources, input_size, log) ||
+        !get_layout_subresources(dds, row_pitch_alignment, subresource_alignment, output_subresources, output_size, log)) {
+        // Error is printed in `get_layout_subresources`.
+        return false;
+    }
+
+    if (input_size != dds.size()) {
+        log << "\rTexture compiler error. DDS texture size doesn't match its mip levels." << std::endl;
+        return false;
+    }
+
+    output.assign(output_size, 0);
+    std::memcpy(output.data(), dds.data(), DDS10_HEADER_SIZE);
+    std::memcpy(output.data() + 32, GPU_LAYOUT_MAGIC, sizeof(GPU_LAYOUT_MAGIC));
+    write_32(output.data(), 36, row_pitch_alignment);
+    write_32(output.data(), 40, subresource_alignment);
+
+    for (size_t i = 0; i < input_subresources.size(); i++) {
+        const LayoutSubresource& input = input_subresources[i];
+        const LayoutSubresource& subresource = output_subresources[i];
+        for (size_t row = 0; row < subresource.row_count; row++) {
+            std::memcpy(output.data() + subresource.offset + row * subresource.row_pitch, dds.data() + input.offset + row * input.row_size, input.row_size);
+        }
+    }
+    return true;
+}
+
+bool get_dds_subresources(const std::vector<char>& dds, std::vector<DdsSubresource>& subresources, std::ostream& log) {
+    const bool is_laid_out = dds.size() >= DDS10_HEADER_SIZE && is_gpu_layout(dds.data());
+    const uint32_t row_pitch_alignment = is_laid_out ? read_32(dds.data(), 36) : 1;
+    const uint32_t subresource_alignment = is_laid_out ? read_32(dds.data(), 40) : 1;
+
+    std::vector<LayoutSubresource> layout_subresources;
+    size_t size;
+    if (!get_layout_subresources(dds, row_pitch_alignment, subresource_alignment, layout_subresources, size, log)) {
+        // Error is printed in `get_layout_subresources`.
+        return false;
+    }
+
+    // Tables of a mip tail and checksums follow the levels.
+    if (size != get_dds_data_size(dds.data(), dds.size())) {
+        log << "\rTexture compiler error. DDS texture size doesn't match its mip levels." << std::endl;
+        return false;
+    }
+
+    subresources.clear();
+    for (const LayoutSubresource& subresource : layout_subresources) {
+        subresources.push_back(DdsSubresource { subresource.offset, subresource.row_pitch * subresource.row_count });
+    }
+    return true;
+}
+
+bool is_gpu_layout(const char* header) noexcept {
+    return std::memcmp(header + 32, GPU_LAYOUT_MAGIC, sizeof(GPU_LAYOUT_MAGIC)) == 0;
+}
+
+bool add_dds_mip_tail(std::vector<char>& dds, uint32_t size, std::ostream& log) {
+    std::vector<LayoutSubresource> subresources;
+    size_t data_size;
+    if (!get_layout_subresources(dds, 1, 1, subresources, data_size, log)) {
+        // Error is printed in `get_layout_subresources`.
+        return false;
+    }
+
+    if (data_size != dds.size() || is_gpu_layout(dds.data()) || has_dds_checksums(dds.data())) {
+        log << "\rTexture compiler error. Mip tail requires a tightly packed DDS texture without checksums." << std::endl;
+        return false;
+    }
+
+    // The header is checked in `get_layout_subresources`.
+    Dds10Header header;
+    read_dds10_header(dds.data(), dds.size(), header);
+    const uint32_t level_count = header.level_count;
+    const size_t layer_count = header.get_layer_count();
+    uint32_t first_level = 0;
+    while (first_level + 1 < level_count && std::max(header.width >> first_level, 1U) >= size && std::max(header.height >> first_level, 1U) >= size) {
+        first_level++;
+    }
+
+    const auto get_level_end = [&subresources](size_t i) {
+        return subresources[i].offset + subresources[i].row_pitch * subresources[i].row_count;
+    };
+    const size_t tail_offset = subresources[first_level].offset;
+    const size_t tail_size = get_level_end(level_count - 1) - tail_offset;
+    if (data_size > UINT32_MAX || tail_size > UINT32_MAX) {
+        log << "\rTexture compiler error. Mip tail supports only DDS textures smaller than 4 GB." << std::endl;
+        return false;
+    }
+
+    const auto append_32 = [&dds](uint32_t value) {
+        const char* bytes = reinterpret_cast<const char*>(&value);
+        dds.insert(dds.end(), bytes, bytes + sizeof(value));
+    };
+    append_32(level_count - first_level);
+    for (uint32_t level = first_level; level < level_count; level++) {
+        append_32(static_cast<uint32_t>(subresources[level].offset - tail_offset));
+        append_32(static_cast<uint32_t>(get_level_end(level) - subresources[level].offset));
+    }
+    for (size_t layer = 0; layer < layer_count; layer++) {
+        const uint64_t offset = subresources[layer * level_count + first_level].offset;
+        const char* bytes = reinterpret_cast<const char*>(&offset);
+        dds.insert(dds.end(), bytes, bytes + sizeof(offset));
+    }
+
+    std::memcpy(dds.data() + 44, MIP_TAIL_MAGIC, sizeof(MIP_TAIL_MAGIC));
+    write_32(dds.data(), 48, first_level);
+    write_32(dds.data(), 52, static_cast<uint32_t>(tail_size));
+    write_32(dds.data(), 56, static_cast<uint32_t>(data_size));
+    return true;
+}
+
+bool is_mip_tail(const char* header) noexcept {
+    return std::memcmp(header + 44, MIP_TAIL_MAGIC, sizeof(MIP_TAIL_MAGIC)) == 0;
+}
+
+bool add_dds_checksums(std::vector<char>& dds, std::ostream& log) {
+    std::vector<DdsSubresource> subresources;
+    if (!get_dds_subresources(dds, subresources, log)) {
+        // Error is printed in `get_dds_subresources`.
+        return false;
+    }
+
+    if (has_dds_checksums(dds.data())) {
+        log << "\rTexture compiler error. DDS texture has checksums already." << std::endl;
+        return false;
+    }
+
+    const uint64_t table_offset = dds.size();
+    dds.reserve(dds.size() + subresources.size() * 2 * sizeof(uint64_t));
+    for (const DdsSubresource& subresource : subresources) {
+        const Hash hash = hash_content(dds.data() + subresource.offset, subresource.size);
+        for (const uint64_t value : { hash.low, hash.high }) {
+            const char* bytes = reinterpret_cast<const char*>(&value);
+            dds.insert(dds.end(), bytes, bytes + sizeof(value));
+        }
+    }
+
+    std::memcpy(dds.data() + 60, CHECKSUMS_MAGIC, sizeof(CHECKSUMS_MAGIC));
+    std::memcpy(dds.data() + 64, &table_offset, sizeof(table_offset));
+    write_32(dds.data(), 72, static_cast<uint32_t>(subresources.size()));
+    return true;
+}
+
+bool has_dds_checksums(const char* header) noexcept {
+    return std::memcmp(header + 60, CHECKSUMS_MAGIC, sizeof(CHECKSUMS_MAGIC)) == 0;
+}
+
+size_t get_dds_data_size(const char* header, size_t file_size) noexcept {
+    if (is_mip_tail(header)) {
+        return read_32(header, 56);
+    }
+    if (has_dds_checksums(header)) {
+        uint64_t table_offset;
+        std::memcpy(&table_offset, header + 64, sizeof(table_offset));
+        return static_cast<size_t>(table_offset);
+    }
+    return file_size;
+}
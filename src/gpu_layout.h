@@ -0,0 +1,94 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+// DDS files written by `--layout` keep the DX10 header, but every mip level of every layer is laid out in the copy
+// footprint of the graphics API, so a runtime can upload it straight from a memory mapped file or a DirectStorage
+// request without repacking it into a staging buffer. Layers follow each other with all of their levels from the
+// largest, like in DDS. Cube maps have 6 layers per face of the array, +X first. The header tells the layout apart
+// from a tightly packed DDS file in its `dwReserved1` fields, which other DDS readers ignore:
+//
+//   Offset 32   `GPU_LAYOUT_MAGIC`.
+//   Offset 36   Row pitch alignment, rows of blocks of block compressed formats, rows of pixels of the other ones.
+//   Offset 40   Subresource alignment, offsets are from the start of the file.
+//
+// The first subresource begins at the first multiple of the subresource alignment after the header, every subresource
+// is its rows with the pitch aligned to the row pitch alignment and the next one begins at the first multiple of the
+// subresource alignment after it. The padding is zero, so it costs little in package compression.
+static constexpr char GPU_LAYOUT_MAGIC[4] = { 'T', 'C', 'L', 'Y' };
+
+// `D3D12_TEXTURE_DATA_PITCH_ALIGNMENT` and `D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT`, which every subresource of
+// `GetCopyableFootprints` is aligned to.
+static constexpr uint32_t D3D12_ROW_PITCH_ALIGNMENT = 256;
+static constexpr uint32_t D3D12_SUBRESOURCE_ALIGNMENT = 512;
+
+// `vkCmdCopyBufferToImage` takes tight rows with zero `bufferRowLength`, and `bufferOffset` must be a multiple of the
+// texel block size and 4, which 16 is for every format the compiler writes.
+static constexpr uint32_t VULKAN_ROW_PITCH_ALIGNMENT = 1;
+static constexpr uint32_t VULKAN_SUBRESOURCE_ALIGNMENT = 16;
+
+// Lays the mip levels of a 2D texture, a texture array or a cube map written by nvtt with the DDS DX10 header out with
+// the given alignments, which must be powers of two.
+bool convert_dds_to_gpu_layout(const std::vector<char>& dds, std::vector<char>& output, uint32_t row_pitch_alignment, uint32_t subresource_alignment,
+                               std::ostream& log);
+
+// Mip level of a layer of a DDS texture, offsets are from the start of the file.
+struct DdsSubresource final {
+    size_t offset;
+    size_t size;
+};
+
+// Describes the mip levels of every layer of a tightly packed DDS texture with the DX10 header or one written by
+// `convert_dds_to_gpu_layout` in the order of the file, which include the padding of their rows.
+bool get_dds_subresources(const std::vector<char>& dds, std::vector<DdsSubresource>& subresources, std::ostream& log);
+
+// Returns true when the DDS file with the DX10 header in `header` was written by `convert_dds_to_gpu_layout`.
+bool is_gpu_layout(const char* header) noexcept;
+
+// DDS files written by `--mip-tail` keep their mip levels tightly packed, so the mip tail of every layer, its levels
+// from the first one with a side smaller than the size of the option on, is a single region at the end of the layer,
+// which a runtime binds to the mip tail of a sparse texture in one go. A table after the last layer describes the
+// tails, and the header points to it in its `dwReserved1` fields, next to the ones of `--layout`:
+//
+//   Offset 44   `MIP_TAIL_MAGIC`.
+//   Offset 48   First mip level of the tail.
+//   Offset 52   Size of the tail of every layer.
+//   Offset 56   Offset of the table from the start of the file.
+//
+// The table is the 32-bit number of levels in the tail, the 32-bit offset from the start of the tail and size of every
+// one of them, and the 64-bit offset of the tail of every layer from the start of the file.
+static constexpr char MIP_TAIL_MAGIC[4] = { 'T', 'C', 'M', 'T' };
+
+// Largest size of `--mip-tail`, levels below it are still small enough to compress in a single call.
+static constexpr uint32_t MIP_TAIL_MAX_SIZE = 1024;
+
+// Appends the table of the mip tail of the levels with a side smaller than `size` to a tightly packed 2D texture or
+// texture array written by nvtt with the DDS DX10 header, and points the header to it.
+bool add_dds_mip_tail(std::vector<char>& dds, uint32_t size, std::ostream& log);
+
+// Returns true when the DDS file with the DX10 header in `header` has the table of `add_dds_mip_tail`.
+bool is_mip_tail(const char* header) noexcept;
+
+// DDS files written by `--checksums` end with a table of the 128-bit `hash_content` of every subresource of
+// `get_dds_subresources`, low 64 bits first, in the order of the file, so a runtime can verify a mip level it streams
+// in lazily, or only some of them, instead of hashing everything on load. Subresources of `--layout` are hashed with
+// the padding of their rows. The table comes last, after the one of `--mip-tail`, and the header points to it:
+//
+//   Offset 60   `CHECKSUMS_MAGIC`.
+//   Offset 64   64-bit offset of the table from the start of the file.
+//   Offset 72   Number of checksums.
+static constexpr char CHECKSUMS_MAGIC[4] = { 'T', 'C', 'C', 'K' };
+
+// Appends the checksums of the subresources to a DDS texture with the DX10 header, tightly packed or laid out, and
+// points the header to them.
+bool add_dds_checksums(std::vector<char>& dds, std::ostream& log);
+
+// Returns true when the DDS file with the DX10 header in `header` has the table of `add_dds_checksums`.
+bool has_dds_checksums(const char* header) noexcept;
+
+// End of the last subresource of a DDS file with the DX10 header in `header` of `file_size` bytes, where the tables of
+// `--mip-tail` and `--checksums` begin.
+size_t get_dds_data_size(const char* header, size_t file_size) noexcept;
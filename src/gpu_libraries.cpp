@@ -0,0 +1,195 @@
+#include <bx/platform.h>
+
+// On Linux the executable doesn't link SDL, X11 and GLX, which only cube maps rendered on the GPU use, so processes
+// compiling 2D textures don't pay for loading and relocating them and their dependencies on every start. Instead, the
+// few functions the compiler and bgfx call are defined here and forward to the libraries, which are loaded by the first
+// call. A library that fails to load makes its functions fail the way they do without a display, so the compiler falls
+// back to a headless renderer or to the CPU backend as usual. Definitions have C linkage and take opaque pointers, which
+// are passed the same way as the types of the library headers, so neither X11 nor GLX headers are needed to build.
+
+#if BX_PLATFORM_LINUX
+
+#include <cstdint>
+#include <dlfcn.h>
+
+namespace {
+
+struct LazyLibrary final {
+    explicit LazyLibrary(const char* const (&names)[2]) noexcept {
+        for (const char* name : names) {
+            handle = dlopen(name, RTLD_NOW | RTLD_LOCAL);
+            if (handle != nullptr) {
+                break;
+            }
+        }
+    }
+
+    LazyLibrary(const LazyLibrary&) = delete;
+    LazyLibrary(LazyLibrary&&) = delete;
+    LazyLibrary& operator=(const LazyLibrary&) = delete;
+    LazyLibrary& operator=(LazyLibrary&&) = delete;
+
+    // Libraries stay loaded until the process exits, bgfx and SDL may call them from `atexit` handlers.
+
+    void* get(const char* symbol) const noexcept {
+        return handle != nullptr ? dlsym(handle, symbol) : nullptr;
+    }
+
+    void* handle = nullptr;
+};
+
+// SDL is deployed next to the executable, which is on its runpath, the system one is the fallback.
+const LazyLibrary& get_sdl_library() noexcept {
+    static const char* const names[2] = { "libSDL2.so", "libSDL2-2.0.so.0" };
+    static const LazyLibrary library(names);
+    return library;
+}
+
+const LazyLibrary& get_x11_library() noexcept {
+    static const char* const names[2] = { "libX11.so.6", "libX11.so" };
+    static const LazyLibrary library(names);
+    return library;
+}
+
+// GLVND dispatch library first, which is what `find_package(OpenGL)` linked before.
+const LazyLibrary& get_glx_library() noexcept {
+    static const char* const names[2] = { "libGLX.so.0", "libGL.so.1" };
+    static const LazyLibrary library(names);
+    return library;
+}
+
+} // namespace
+
+// Declared like SDL does, so link time optimization sees the same functions in this file and in the ones including
+// the SDL headers.
+struct SDL_Window;
+struct SDL_SysWMinfo;
+
+// Function pointers are looked up once per function, thread safe by the function local statics.
+#define GPU_LIBRARY_FUNCTION(library, name, result, parameters) \
+    static const auto function = reinterpret_cast<result(*) parameters>(library().get(name))
+
+extern "C" {
+
+int SDL_Init(uint32_t flags) {
+    GPU_LIBRARY_FUNCTION(get_sdl_library, "SDL_Init", int, (uint32_t));
+    return function != nullptr ? function(flags) : -1;
+}
+
+void SDL_Quit() {
+    GPU_LIBRARY_FUNCTION(get_sdl_library, "SDL_Quit", void, ());
+    if (function != nullptr) {
+        function();
+    }
+}
+
+SDL_Window* SDL_CreateWindow(const char* title, int x, int y, int width, int height, uint32_t flags) {
+    GPU_LIBRARY_FUNCTION(get_sdl_library, "SDL_CreateWindow", SDL_Window*, (const char*, int, int, int, int, uint32_t));
+    return function != nullptr ? function(title, x, y, width, height, flags) : nullptr;
+}
+
+void SDL_DestroyWindow(SDL_Window* window) {
+    GPU_LIBRARY_FUNCTION(get_sdl_library, "SDL_DestroyWindow", void, (SDL_Window*));
+    if (function != nullptr) {
+        function(window);
+    }
+}
+
+int SDL_GetWindowWMInfo(SDL_Window* window, SDL_SysWMinfo* info) {
+    GPU_LIBRARY_FUNCTION(get_sdl_library, "SDL_GetWindowWMInfo", int, (SDL_Window*, SDL_SysWMinfo*));
+    return function != nullptr ? function(window, info) : 0;
+}
+
+void* XOpenDisplay(const char* name) {
+    GPU_LIBRARY_FUNCTION(get_x11_library, "XOpenDisplay", void*, (const char*));
+    return function != nullptr ? function(name) : nullptr;
+}
+
+int XCloseDisplay(void* display) {
+    GPU_LIBRARY_FUNCTION(get_x11_library, "XCloseDisplay", int, (void*));
+    return function != nullptr ? function(display) : 0;
+}
+
+int XFree(void* data) {
+    GPU_LIBRARY_FUNCTION(get_x11_library, "XFree", int, (void*));
+    return function != nullptr ? function(data) : 0;
+}
+
+void XLockDisplay(void* display) {
+    GPU_LIBRARY_FUNCTION(get_x11_library, "XLockDisplay", void, (void*));
+    if (function != nullptr) {
+        function(display);
+    }
+}
+
+void XUnlockDisplay(void* display) {
+    GPU_LIBRARY_FUNCTION(get_x11_library, "XUnlockDisplay", void, (void*));
+    if (function != nullptr) {
+        function(display);
+    }
+}
+
+void* glXChooseFBConfig(void* display, int screen, const int* attributes, int* count) {
+    GPU_LIBRARY_FUNCTION(get_glx_library, "glXChooseFBConfig", void*, (void*, int, const int*, int*));
+    if (function == nullptr) {
+        *count = 0;
+        return nullptr;
+    }
+    return function(display, screen, attributes, count);
+}
+
+void* glXCreateContext(void* display, void* visual, void* share_list, int is_direct) {
+    GPU_LIBRARY_FUNCTION(get_glx_library, "glXCreateContext", void*, (void*, void*, void*, int));
+    return function != nullptr ? function(display, visual, share_list, is_direct) : nullptr;
+}
+
+void glXDestroyContext(void* display, void* context) {
+    GPU_LIBRARY_FUNCTION(get_glx_library, "glXDestroyContext", void, (void*, void*));
+    if (function != nullptr) {
+        function(display, context);
+    }
+}
+
+// Returns `GLX_BAD_ATTRIBUTE` without the library.
+int glXGetFBConfigAttrib(void* display, void* config, int attribute, int* value) {
+    GPU_LIBRARY_FUNCTION(get_glx_library, "glXGetFBConfigAttrib", int, (void*, void*, int, int*));
+    return function != nullptr ? function(display, config, attribute, value) : 2;
+}
+
+void* glXGetProcAddress(const unsigned char* name) {
+    GPU_LIBRARY_FUNCTION(get_glx_library, "glXGetProcAddress", void*, (const unsigned char*));
+    return function != nullptr ? function(name) : nullptr;
+}
+
+void* glXGetVisualFromFBConfig(void* display, void* config) {
+    GPU_LIBRARY_FUNCTION(get_glx_library, "glXGetVisualFromFBConfig", void*, (void*, void*));
+    return function != nullptr ? function(display, config) : nullptr;
+}
+
+int glXMakeCurrent(void* display, unsigned long drawable, void* context) {
+    GPU_LIBRARY_FUNCTION(get_glx_library, "glXMakeCurrent", int, (void*, unsigned long, void*));
+    return function != nullptr ? function(display, drawable, context) : 0;
+}
+
+const char* glXQueryExtensionsString(void* display, int screen) {
+    GPU_LIBRARY_FUNCTION(get_glx_library, "glXQueryExtensionsString", const char*, (void*, int));
+    return function != nullptr ? function(display, screen) : "";
+}
+
+int glXQueryVersion(void* display, int* major, int* minor) {
+    GPU_LIBRARY_FUNCTION(get_glx_library, "glXQueryVersion", int, (void*, int*, int*));
+    return function != nullptr ? function(display, major, minor) : 0;
+}
+
+void glXSwapBuffers(void* display, unsigned long drawable) {
+    GPU_LIBRARY_FUNCTION(get_glx_library, "glXSwapBuffers", void, (void*, unsigned long));
+    if (function != nullptr) {
+        function(display, drawable);
+    }
+}
+
+} // extern "C"
+
+#undef GPU_LIBRARY_FUNCTION
+
+#endif
@@ -0,0 +1,320 @@
+#include "hash.h"
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define HASH_CONTENT_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#define HASH_CONTENT_NEON
+#include <arm_neon.h>
+#endif
+
+static constexpr uint64_t PRIME_1 = 0x9E3779B185EBCA87ULL;
+static constexpr uint64_t PRIME_2 = 0xC2B2AE3D27D4EB4FULL;
+static constexpr uint64_t PRIME_3 = 0x165667B19E3779F9ULL;
+static constexpr uint64_t PRIME_4 = 0x85EBCA77C2B2AE63ULL;
+static constexpr uint64_t PRIME_5 = 0x27D4EB2F165667C5ULL;
+
+static uint64_t rotate_left(uint64_t value, int bits) noexcept {
+    return (value << bits) | (value >> (64 - bits));
+}
+
+static uint64_t read_64(const uint8_t* data) noexcept {
+    uint64_t result;
+    std::memcpy(&result, data, sizeof(result));
+    return result;
+}
+
+static uint32_t read_32(const uint8_t* data) noexcept {
+    uint32_t result;
+    std::memcpy(&result, data, sizeof(result));
+    return result;
+}
+
+static uint64_t round(uint64_t accumulator, uint64_t input) noexcept {
+    accumulator += input * PRIME_2;
+    accumulator = rotate_left(accumulator, 31);
+    return accumulator * PRIME_1;
+}
+
+static uint64_t merge_round(uint64_t accumulator, uint64_t value) noexcept {
+    accumulator ^= round(0, value);
+    return accumulator * PRIME_1 + PRIME_4;
+}
+
+bool Hash::operator==(const Hash& other) const noexcept {
+    return low == other.low && high == other.high;
+}
+
+bool Hash::operator!=(const Hash& other) const noexcept {
+    return !(*this == other);
+}
+
+std::string Hash::to_string() const {
+    static const char DIGITS[] = "0123456789abcdef";
+
+    std::string result(32, '0');
+    for (size_t i = 0; i < 16; i++) {
+        result[15 - i] = DIGITS[(high >> (i * 4)) & 0xF];
+        result[31 - i] = DIGITS[(low >> (i * 4)) & 0xF];
+    }
+    return result;
+}
+
+Hasher::Hasher() noexcept {
+    // Seeds are arbitrary, they only need to differ.
+    const uint64_t seeds[] = { 0, PRIME_5 };
+    for (size_t i = 0; i < 2; i++) {
+        lanes[i].seed = seeds[i];
+        lanes[i].accumulators[0] = seeds[i] + PRIME_1 + PRIME_2;
+        lanes[i].accumulators[1] = seeds[i] + PRIME_2;
+        lanes[i].accumulators[2] = seeds[i];
+        lanes[i].accumulators[3] = seeds[i] - PRIME_1;
+    }
+}
+
+void Hasher::update(const void* data, size_t size) noexcept {
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    total_size += size;
+
+    if (buffer_size != 0) {
+        const size_t count = std::min(size, STRIPE_SIZE - buffer_size);
+        std::memcpy(buffer + buffer_size, bytes, count);
+        buffer_size += count;
+        bytes += count;
+        size -= count;
+
+        if (buffer_size < STRIPE_SIZE) {
+            return;
+        }
+
+        process_stripe(buffer);
+        buffer_size = 0;
+    }
+
+    while (size >= STRIPE_SIZE) {
+        process_stripe(bytes);
+        bytes += STRIPE_SIZE;
+        size -= STRIPE_SIZE;
+    }
+
+    std::memcpy(buffer, bytes, size);
+    buffer_size = size;
+}
+
+void Hasher::update(const std::string& value) noexcept {
+    update(static_cast<uint64_t>(value.size()));
+    update(value.data(), value.size());
+}
+
+void Hasher::update(uint64_t value) noexcept {
+    // Little endian regardless of the platform, so keys are the same on every machine.
+    uint8_t bytes[sizeof(value)];
+    for (size_t i = 0; i < sizeof(value); i++) {
+        bytes[i] = static_cast<uint8_t>(value >> (i * 8));
+    }
+    update(bytes, sizeof(bytes));
+}
+
+Hash Hasher::finish() const noexcept {
+    return Hash { finish_lane(lanes[0]), finish_lane(lanes[1]) };
+}
+
+void Hasher::process_stripe(const uint8_t* stripe) noexcept {
+    for (Lane& lane : lanes) {
+        for (size_t i = 0; i < 4; i++) {
+            lane.accumulators[i] = round(lane.accumulators[i], read_64(stripe + i * 8));
+        }
+    }
+}
+
+uint64_t Hasher::finish_lane(const Lane& lane) const noexcept {
+    uint64_t result;
+    if (total_size >= STRIPE_SIZE) {
+        const uint64_t* accumulators = lane.accumulators;
+        result = rotate_left(accumulators[0], 1) + rotate_left(accumulators[1], 7) + rotate_left(accumulators[2], 12) + rotate_left(accumulators[3], 18);
+        for (size_t i = 0; i < 4; i++) {
+            result = merge_round(result, accumulators[i]);
+        }
+    } else {
+        result = lane.seed + PRIME_5;
+    }
+
+    result += total_size;
+
+    const uint8_t* data = buffer;
+    size_t size = buffer_size;
+
+    while (size >= 8) {
+        result ^= round(0, read_64(data));
+        result = rotate_left(result, 27) * PRIME_1 + PRIME_4;
+        data += 8;
+        size -= 8;
+    }
+
+    if (size >= 4) {
+        result ^= static_cast<uint64_t>(read_32(data)) * PRIME_1;
+        result = rotate_left(result, 23) * PRIME_2 + PRIME_3;
+        data += 4;
+        size -= 4;
+    }
+
+    while (size > 0) {
+        result ^= static_cast<uint64_t>(*data) * PRIME_5;
+        result = rotate_left(result, 11) * PRIME_1;
+        data++;
+        size--;
+    }
+
+    result ^= result >> 33;
+    result *= PRIME_2;
+    result ^= result >> 29;
+    result *= PRIME_3;
+    result ^= result >> 32;
+    return result;
+}
+
+static constexpr size_t CONTENT_STRIPE_SIZE = 64;
+static constexpr size_t CONTENT_LANE_COUNT = CONTENT_STRIPE_SIZE / 8;
+
+// Stripes of a block use the key at consecutive 8-byte offsets, the lanes are scrambled after every block.
+static constexpr size_t CONTENT_BLOCK_STRIPES = 16;
+static constexpr size_t CONTENT_KEY_SIZE = CONTENT_STRIPE_SIZE + CONTENT_BLOCK_STRIPES * 8;
+
+struct ContentKey final {
+    uint8_t bytes[CONTENT_KEY_SIZE];
+};
+
+// Arbitrary key bytes, only fixed so keys are the same in every process.
+static constexpr ContentKey make_content_key() noexcept {
+    ContentKey key {};
+    uint64_t state = PRIME_5;
+    for (size_t i = 0; i < CONTENT_KEY_SIZE; i += 8) {
+        state += 0x9E3779B97F4A7C15ULL;
+        uint64_t value = state;
+        value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+        value ^= value >> 31;
+        for (size_t j = 0; j < 8; j++) {
+            key.bytes[i + j] = static_cast<uint8_t>(value >> (j * 8));
+        }
+    }
+    return key;
+}
+
+static constexpr ContentKey CONTENT_KEY = make_content_key();
+
+// Every lane adds the product of the low and the high half of its data mixed with the key, and the neighbouring lane
+// adds the data itself, so no input bits are lost to a multiply by zero. Stripe `i` uses the key at `key + i * 8`, the
+// lanes stay in registers for all `count` stripes.
+static void accumulate_stripes(uint64_t (&lanes)[CONTENT_LANE_COUNT], const uint8_t* stripes, size_t count, const uint8_t* key) noexcept {
+#if defined(HASH_CONTENT_SSE2)
+    __m128i vectors[CONTENT_LANE_COUNT / 2];
+    for (size_t i = 0; i < CONTENT_LANE_COUNT / 2; i++) {
+        vectors[i] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(lanes) + i);
+    }
+    for (size_t stripe = 0; stripe < count; stripe++) {
+        for (size_t i = 0; i < CONTENT_LANE_COUNT / 2; i++) {
+            const __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(stripes + stripe * CONTENT_STRIPE_SIZE) + i);
+            const __m128i mixed = _mm_xor_si128(data, _mm_loadu_si128(reinterpret_cast<const __m128i*>(key + stripe * 8) + i));
+            const __m128i product = _mm_mul_epu32(mixed, _mm_shuffle_epi32(mixed, _MM_SHUFFLE(0, 3, 0, 1)));
+            const __m128i swapped = _mm_shuffle_epi32(data, _MM_SHUFFLE(1, 0, 3, 2));
+            vectors[i] = _mm_add_epi64(vectors[i], _mm_add_epi64(product, swapped));
+        }
+    }
+    for (size_t i = 0; i < CONTENT_LANE_COUNT / 2; i++) {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes) + i, vectors[i]);
+    }
+#elif defined(HASH_CONTENT_NEON)
+    uint64x2_t vectors[CONTENT_LANE_COUNT / 2];
+    for (size_t i = 0; i < CONTENT_LANE_COUNT / 2; i++) {
+        vectors[i] = vld1q_u64(lanes + i * 2);
+    }
+    for (size_t stripe = 0; stripe < count; stripe++) {
+        for (size_t i = 0; i < CONTENT_LANE_COUNT / 2; i++) {
+            const uint64x2_t data = vreinterpretq_u64_u8(vld1q_u8(stripes + stripe * CONTENT_STRIPE_SIZE + i * 16));
+            const uint64x2_t mixed = veorq_u64(data, vreinterpretq_u64_u8(vld1q_u8(key + stripe * 8 + i * 16)));
+            const uint64x2_t product = vmull_u32(vmovn_u64(mixed), vshrn_n_u64(mixed, 32));
+            const uint64x2_t swapped = vextq_u64(data, data, 1);
+            vectors[i] = vaddq_u64(vectors[i], vaddq_u64(product, swapped));
+        }
+    }
+    for (size_t i = 0; i < CONTENT_LANE_COUNT / 2; i++) {
+        vst1q_u64(lanes + i * 2, vectors[i]);
+    }
+#else
+    for (size_t stripe = 0; stripe < count; stripe++) {
+        for (size_t i = 0; i < CONTENT_LANE_COUNT; i++) {
+            const uint64_t data = read_64(stripes + stripe * CONTENT_STRIPE_SIZE + i * 8);
+            const uint64_t mixed = data ^ read_64(key + stripe * 8 + i * 8);
+            lanes[i ^ 1] += data;
+            lanes[i] += (mixed & 0xFFFFFFFF) * (mixed >> 32);
+        }
+    }
+#endif
+}
+
+static void scramble_lanes(uint64_t (&lanes)[CONTENT_LANE_COUNT], const uint8_t* key) noexcept {
+    for (size_t i = 0; i < CONTENT_LANE_COUNT; i++) {
+        uint64_t lane = lanes[i];
+        lane ^= lane >> 47;
+        lane ^= read_64(key + i * 8);
+        lanes[i] = lane * (PRIME_1 >> 32);
+    }
+}
+
+// Low and high halves of the 128-bit product folded into 64 bits.
+static uint64_t multiply_fold(uint64_t left, uint64_t right) noexcept {
+    const uint64_t left_low = left & 0xFFFFFFFF;
+    const uint64_t left_high = left >> 32;
+    const uint64_t right_low = right & 0xFFFFFFFF;
+    const uint64_t right_high = right >> 32;
+    const uint64_t low_low = left_low * right_low;
+    const uint64_t high_low = left_high * right_low;
+    const uint64_t low_high = left_low * right_high;
+    const uint64_t high_high = left_high * right_high;
+    const uint64_t cross = (low_low >> 32) + (high_low & 0xFFFFFFFF) + low_high;
+    const uint64_t high = high_high + (high_low >> 32) + (cross >> 32);
+    const uint64_t low = (cross << 32) | (low_low & 0xFFFFFFFF);
+    return high ^ low;
+}
+
+static uint64_t merge_lanes(const uint64_t (&lanes)[CONTENT_LANE_COUNT], const uint8_t* key, uint64_t start) noexcept {
+    uint64_t result = start;
+    for (size_t i = 0; i < CONTENT_LANE_COUNT; i += 2) {
+        result += multiply_fold(lanes[i] ^ read_64(key + i * 8), lanes[i + 1] ^ read_64(key + i * 8 + 8));
+    }
+    result ^= result >> 37;
+    result *= PRIME_3;
+    result ^= result >> 32;
+    return result;
+}
+
+Hash hash_content(const void* data, size_t size) noexcept {
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    const uint8_t* const key = CONTENT_KEY.bytes;
+
+    uint64_t lanes[CONTENT_LANE_COUNT] = { PRIME_3, PRIME_1, PRIME_2, PRIME_4, PRIME_5, PRIME_2 ^ PRIME_3, PRIME_1 ^ PRIME_4, PRIME_5 ^ PRIME_1 };
+
+    const size_t block_size = CONTENT_BLOCK_STRIPES * CONTENT_STRIPE_SIZE;
+    size_t offset = 0;
+    for (; offset + block_size <= size; offset += block_size) {
+        accumulate_stripes(lanes, bytes + offset, CONTENT_BLOCK_STRIPES, key);
+        scramble_lanes(lanes, key + CONTENT_KEY_SIZE - CONTENT_STRIPE_SIZE);
+    }
+
+    const size_t stripe_count = (size - offset) / CONTENT_STRIPE_SIZE;
+    accumulate_stripes(lanes, bytes + offset, stripe_count, key);
+    offset += stripe_count * CONTENT_STRIPE_SIZE;
+
+    // The tail is padded with zeros, the size mixed into the result tells it apart from an input with the zeros.
+    if (offset < size) {
+        uint8_t tail[CONTENT_STRIPE_SIZE] = {};
+        std::memcpy(tail, bytes + offset, size - offset);
+        accumulate_stripes(lanes, tail, 1, key + stripe_count * 8 + 7);
+    }
+
+    return Hash { merge_lanes(lanes, key + 11, size * PRIME_1), merge_lanes(lanes, key + CONTENT_KEY_SIZE - CONTENT_STRIPE_SIZE - 11, ~(size * PRIME_2)) };
+}
@@ -0,0 +1,335 @@
+#include "hdr_decoder.h"
+
+#include "pixel_kernels.h"
+#include "thread_pool.h"
+
+#include <algorithm>
+#include <climits>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <new>
+#include <string>
+#include <vector>
+
+// Lines of the header as long as this are cut by stb_image, such files are left to it.
+static constexpr size_t HDR_MAX_LINE_LENGTH = 1023;
+
+// Images narrower or wider than this are stored flat rather than run-length encoded.
+static constexpr int HDR_MIN_RLE_WIDTH = 8;
+static constexpr int HDR_MAX_RLE_WIDTH = 32767;
+
+// Rows decoded by a single task.
+static constexpr size_t HDR_DECODE_ROWS = 32;
+
+namespace {
+
+// Reads the header a line at a time like `stbi__hdr_gettoken`, lines end at a newline or at the end of the file.
+struct HdrLineReader final {
+    const uint8_t* data;
+    size_t size;
+    size_t offset;
+
+    bool read_line(std::string& line) noexcept {
+        const uint8_t* const begin = data + offset;
+        const uint8_t* const end = static_cast<const uint8_t*>(std::memchr(begin, '\n', size - offset));
+        const size_t length = end != nullptr ? static_cast<size_t>(end - begin) : size - offset;
+        if (length >= HDR_MAX_LINE_LENGTH) {
+            return false;
+        }
+        line.assign(reinterpret_cast<const char*>(begin), length);
+        offset += end != nullptr ? length + 1 : length;
+        return true;
+    }
+};
+
+} // namespace
+
+// Same checks as `stbi__hdr_load`, the size line must be `-Y height +X width`.
+static bool read_hdr_header(HdrLineReader& reader, int& width, int& height) {
+    std::string line;
+    if (!reader.read_line(line) || (line != "#?RADIANCE" && line != "#?RGBE")) {
+        return false;
+    }
+
+    bool is_rgbe = false;
+    while (true) {
+        if (reader.offset == reader.size || !reader.read_line(line)) {
+            return false;
+        }
+        if (line.empty()) {
+            break;
+        }
+        if (line == "FORMAT=32-bit_rle_rgbe") {
+            is_rgbe = true;
+        }
+    }
+
+    if (!is_rgbe || !reader.read_line(line) || line.compare(0, 3, "-Y ") != 0) {
+        return false;
+    }
+
+    char* token = &line[3];
+    const long rows = std::strtol(token, &token, 10);
+    while (*token == ' ') {
+        token++;
+    }
+    if (std::strncmp(token, "+X ", 3) != 0) {
+        return false;
+    }
+    const long columns = std::strtol(token + 3, nullptr, 10);
+
+    // stb_image allocates the whole image with a size that fits in an int.
+    if (rows <= 0 || columns < HDR_MIN_RLE_WIDTH || columns > HDR_MAX_RLE_WIDTH || rows > INT_MAX / 16 / columns) {
+        return false;
+    }
+
+    width = static_cast<int>(columns);
+    height = static_cast<int>(rows);
+    return true;
+}
+
+// Skips the four run-length encoded channels of a scanline and returns the offset of the next one, or zero when the
+// scanline is broken or truncated.
+static size_t skip_hdr_scanline(const uint8_t* data, size_t size, size_t offset, size_t width) noexcept {
+    if (size - offset < 4 || data[offset] != 2 || data[offset + 1] != 2 || (data[offset + 2] & 0x80) != 0) {
+        return 0;
+    }
+    if ((static_cast<size_t>(data[offset + 2]) << 8 | data[offset + 3]) != width) {
+        return 0;
+    }
+    offset += 4;
+
+    for (size_t channel = 0; channel < 4; channel++) {
+        for (size_t x = 0; x < width;) {
+            if (offset == size) {
+                return 0;
+            }
+            size_t count = data[offset++];
+            size_t bytes = count;
+            if (count > 128) {
+                count -= 128;
+                bytes = 1;
+            }
+            if (count > width - x || bytes > size - offset) {
+                return 0;
+            }
+            offset += bytes;
+            x += count;
+        }
+    }
+    return offset;
+}
+
+// Expands the channels of a scanline the scan checked already into interleaved RGBE pixels.
+static void decode_hdr_scanline(const uint8_t* data, size_t offset, size_t width, uint8_t* rgbe) noexcept {
+    offset += 4;
+    for (size_t channel = 0; channel < 4; channel++) {
+        for (size_t x = 0; x < width;) {
+            size_t count = data[offset++];
+            if (count > 128) {
+                count -= 128;
+                const uint8_t value = data[offset++];
+                for (size_t i = 0; i < count; i++) {
+                    rgbe[(x + i) * 4 + channel] = value;
+                }
+            } else {
+                for (size_t i = 0; i < count; i++) {
+                    rgbe[(x + i) * 4 + channel] = data[offset++];
+                }
+            }
+            x += count;
+        }
+    }
+}
+
+// Reads the header and locates every scanline, which is sequential. Returns false for what's left to stb_image.
+static bool scan_hdr(const uint8_t* data, size_t size, int& width, int& height, std::vector<size_t>& offsets) {
+    HdrLineReader reader { data, size, 0 };
+    if (!read_hdr_header(reader, width, height)) {
+        return false;
+    }
+
+    const size_t row_width = static_cast<size_t>(width);
+    offsets.resize(static_cast<size_t>(height));
+    size_t offset = reader.offset;
+    for (size_t& row_offset : offsets) {
+        row_offset = offset;
+        offset = skip_hdr_scanline(data, size, offset, row_width);
+        if (offset == 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool decode_hdr_rgba32f(const uint8_t* data, size_t size, ThreadPool& pool, int& width, int& height, std::unique_ptr<float[]>& pixels) noexcept {
+    try {
+        int columns = 0;
+        int rows = 0;
+        std::vector<size_t> offsets;
+        if (!scan_hdr(data, size, columns, rows, offsets)) {
+            return false;
+        }
+
+        const size_t row_width = static_cast<size_t>(columns);
+        const size_t row_count = static_cast<size_t>(rows);
+        std::unique_ptr<float[]> output(new (std::nothrow) float[row_width * row_count * 4]);
+        if (output == nullptr) {
+            return false;
+        }
+
+        TaskGroup group;
+        for (size_t row_begin = 0; row_begin < row_count; row_begin += HDR_DECODE_ROWS) {
+            const size_t row_end = std::min(row_begin + HDR_DECODE_ROWS, row_count);
+            pool.push(group, [data, &offsets, &output, row_width, row_begin, row_end] {
+                std::vector<uint8_t> rgbe(row_width * 4);
+                for (size_t y = row_begin; y < row_end; y++) {
+                    decode_hdr_scanline(data, offsets[y], row_width, rgbe.data());
+                    convert_rgbe_to_rgba32f(rgbe.data(), row_width, output.get() + y * row_width * 4);
+                }
+            });
+        }
+        pool.wait(group);
+
+        width = columns;
+        height = rows;
+        pixels = std::move(output);
+        return true;
+    } catch (const std::exception&) {
+        return false;
+    }
+}
+
+bool read_hdr_size(const uint8_t* data, size_t size, int& width, int& height) noexcept {
+    try {
+        HdrLineReader reader { data, size, 0 };
+        return read_hdr_header(reader, width, height);
+    } catch (const std::exception&) {
+        return false;
+    }
+}
+
+namespace {
+
+// Rows of one level of the halving chain a task holds, from `first_row` on.
+struct HdrReducedBand final {
+    size_t width = 0;
+    size_t height = 0;
+    size_t first_row = 0;
+    size_t row_count = 0;
+    std::vector<float> rows;
+
+    const float* get_row(size_t row) const noexcept {
+        return rows.data() + (row - first_row) * width * 4;
+    }
+
+    float* get_row(size_t row) noexcept {
+        return rows.data() + (row - first_row) * width * 4;
+    }
+};
+
+} // namespace
+
+// Rows of the level above that output row `row` of a level of `height` averages, in the order of the flipped image,
+// whose pairs start at the bottom and whose top row is clamped when the height is odd.
+static size_t get_hdr_reduced_top_row(size_t height, size_t row) noexcept {
+    const size_t output_height = std::max<size_t>(height / 2, 1);
+    return height - 1 - (output_height - 1 - row) * 2;
+}
+
+static size_t get_hdr_reduced_bottom_row(size_t height, size_t row) noexcept {
+    return std::max<size_t>(get_hdr_reduced_top_row(height, row), 1) - 1;
+}
+
+bool decode_hdr_rgba32f_reduced(const uint8_t* data, size_t size, ThreadPool& pool, int reductions, int& width, int& height, std::unique_ptr<float[]>& pixels) noexcept {
+    if (reductions <= 0) {
+        return decode_hdr_rgba32f(data, size, pool, width, height, pixels);
+    }
+
+    try {
+        int columns = 0;
+        int rows = 0;
+        std::vector<size_t> offsets;
+        if (!scan_hdr(data, size, columns, rows, offsets)) {
+            return false;
+        }
+
+        std::vector<size_t> widths { static_cast<size_t>(columns) };
+        std::vector<size_t> heights { static_cast<size_t>(rows) };
+        for (int level = 0; level < reductions; level++) {
+            widths.push_back(std::max<size_t>(widths.back() / 2, 1));
+            heights.push_back(std::max<size_t>(heights.back() / 2, 1));
+        }
+        const size_t output_width = widths.back();
+        const size_t output_height = heights.back();
+
+        std::unique_ptr<float[]> output(new (std::nothrow) float[output_width * output_height * 4]);
+        if (output == nullptr) {
+            return false;
+        }
+
+        // About as many scanlines a task as `decode_hdr_rgba32f` decodes.
+        const size_t band_rows = std::max<size_t>(HDR_DECODE_ROWS >> std::min(reductions, 5), 1);
+
+        TaskGroup group;
+        for (size_t row_begin = 0; row_begin < output_height; row_begin += band_rows) {
+            const size_t row_end = std::min(row_begin + band_rows, output_height);
+            pool.push(group, [data, &offsets, &widths, &heights, &output, reductions, row_begin, row_end] {
+                // Rows every level needs for the band, found from the output up to the scanlines. The output is the
+                // last level, which is written in place.
+                std::vector<HdrReducedBand> bands(static_cast<size_t>(reductions) + 1);
+                size_t first_row = row_begin;
+                size_t last_row = row_end - 1;
+                for (size_t level = bands.size(); level-- > 0;) {
+                    HdrReducedBand& band = bands[level];
+                    band.width = widths[level];
+                    band.height = heights[level];
+                    band.first_row = first_row;
+                    band.row_count = last_row - first_row + 1;
+                    if (level != bands.size() - 1) {
+                        band.rows.resize(band.row_count * band.width * 4);
+                    }
+                    if (level > 0) {
+                        first_row = get_hdr_reduced_bottom_row(heights[level - 1], first_row);
+                        last_row = get_hdr_reduced_top_row(heights[level - 1], last_row);
+                    }
+                }
+
+                HdrReducedBand& scanlines = bands.front();
+                std::vector<uint8_t> rgbe(scanlines.width * 4);
+                for (size_t y = scanlines.first_row; y < scanlines.first_row + scanlines.row_count; y++) {
+                    decode_hdr_scanline(data, offsets[y], scanlines.width, rgbe.data());
+                    convert_rgbe_to_rgba32f(rgbe.data(), scanlines.width, scanlines.get_row(y));
+                }
+
+                for (size_t level = 1; level < bands.size(); level++) {
+                    const HdrReducedBand& input = bands[level - 1];
+                    HdrReducedBand& band = bands[level];
+                    const bool is_output = level == bands.size() - 1;
+                    for (size_t y = band.first_row; y < band.first_row + band.row_count; y++) {
+                        const float* const top = input.get_row(get_hdr_reduced_top_row(input.height, y));
+                        const float* const bottom = input.get_row(get_hdr_reduced_bottom_row(input.height, y));
+                        float* const row = is_output ? output.get() + y * band.width * 4 : band.get_row(y);
+                        for (size_t column = 0; column < band.width; column++) {
+                            const size_t left = std::min(column * 2, input.width - 1) * 4;
+                            const size_t right = std::min(column * 2 + 1, input.width - 1) * 4;
+                            for (size_t channel = 0; channel < 4; channel++) {
+                                const float sum = top[left + channel] + top[right + channel] + bottom[left + channel] + bottom[right + channel];
+                                row[column * 4 + channel] = sum * 0.25f;
+                            }
+                        }
+                    }
+                }
+            });
+        }
+        pool.wait(group);
+
+        width = static_cast<int>(output_width);
+        height = static_cast<int>(output_height);
+        pixels = std::move(output);
+        return true;
+    } catch (const std::exception&) {
+        return false;
+    }
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+struct ThreadPool;
+
+// Decodes a run-length encoded Radiance HDR image to interleaved RGBA floats in rows from the top, the same floats with
+// alpha one as `stbi_loadf`. The scanlines are located by a quick pass over their run lengths, which is sequential, and
+// then decoded and converted on `pool` in bands of rows. Returns false for everything stb_image handles differently,
+// flat images, scanlines that aren't run-length encoded and broken or truncated files, which are left to `stbi_loadf`.
+bool decode_hdr_rgba32f(const uint8_t* data, size_t size, ThreadPool& pool, int& width, int& height, std::unique_ptr<float[]>& pixels) noexcept;
+
+// Reads the size of a Radiance HDR image from its header. Returns false for the headers `decode_hdr_rgba32f` leaves to
+// stb_image.
+bool read_hdr_size(const uint8_t* data, size_t size, int& width, int& height) noexcept;
+
+// Like `decode_hdr_rgba32f`, but the image is halved `reductions` times while it's decoded, the same way
+// `downsample_image_rows` halves it after its rows are flipped to go from the bottom. Every task decodes only the
+// scanlines of its band of output rows and halves them, so the full size image is never held, only the file and the
+// offsets of its scanlines. `width` and `height` are the size of the halved image.
+bool decode_hdr_rgba32f_reduced(const uint8_t* data, size_t size, ThreadPool& pool, int reductions, int& width, int& height, std::unique_ptr<float[]>& pixels) noexcept;
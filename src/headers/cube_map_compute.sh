@@ -0,0 +1,13 @@
+#ifndef CUBE_MAP_COMPUTE_H_HEADER_GUARD
+#define CUBE_MAP_COMPUTE_H_HEADER_GUARD
+
+// Direction the rasterizer would interpolate for the given texel of a cube map side render target of the given size.
+// Texel Z component is the cube map side, `inverse_view_projection` is the inverse view projection matrix of that side
+// that also flips the Y axis when the renderer origin is at the top left.
+vec3 cube_map_direction(ivec3 texel, float size, mat4 inverse_view_projection) {
+    vec2 ndc = (vec2(texel.xy) + 0.5) / size * 2.0 - 1.0;
+    vec4 position = mul(inverse_view_projection, vec4(ndc, 1.0, 1.0));
+    return normalize(position.xyz / position.w);
+}
+
+#endif // CUBE_MAP_COMPUTE_H_HEADER_GUARD
@@ -0,0 +1,72 @@
+#include "heap.h"
+
+#include <bx/platform.h>
+#include <climits>
+
+// `__GLIBC__` is defined by the C library headers, `climits` includes them.
+#if BX_PLATFORM_LINUX && defined(__GLIBC__)
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <gnu/libc-version.h>
+#include <malloc.h>
+#include <string>
+#include <unistd.h>
+#endif
+
+bool reuse_freed_memory() noexcept {
+#if BX_PLATFORM_LINUX && defined(__GLIBC__)
+    // Large allocations come from the heap rather than from their own mappings, the heap is never trimmed, and worker
+    // threads share the heap of the main thread, which grows without the size limit of the other ones.
+    return mallopt(M_MMAP_MAX, 0) != 0 && mallopt(M_TRIM_THRESHOLD, INT_MAX) != 0 && mallopt(M_ARENA_MAX, 1) != 0;
+#else
+    return false;
+#endif
+}
+
+#if BX_PLATFORM_LINUX && defined(__GLIBC__)
+// With `[never]` selected, `MADV_HUGEPAGE` has no effect. `[always]` and `[madvise]` both honor it.
+static bool is_transparent_huge_page_enabled() noexcept {
+    FILE* file = std::fopen("/sys/kernel/mm/transparent_hugepage/enabled", "r");
+    if (file == nullptr) {
+        return false;
+    }
+    char mode[128] = {};
+    const bool is_read = std::fgets(mode, sizeof(mode), file) != nullptr;
+    std::fclose(file);
+    return is_read && std::strstr(mode, "[never]") == nullptr;
+}
+#endif
+
+bool use_huge_pages(char* argv[]) noexcept {
+#if BX_PLATFORM_LINUX && defined(__GLIBC__)
+    static constexpr const char* TUNABLE = "glibc.malloc.hugetlb=1";
+
+    const char* const tunables = std::getenv("GLIBC_TUNABLES");
+    if (tunables != nullptr && std::strstr(tunables, TUNABLE) != nullptr) {
+        return true;
+    }
+
+    int major = 0;
+    int minor = 0;
+    if (std::sscanf(gnu_get_libc_version(), "%d.%d", &major, &minor) != 2 || major < 2 || (major == 2 && minor < 35) || !is_transparent_huge_page_enabled()) {
+        return false;
+    }
+
+    try {
+        const std::string value = tunables != nullptr && tunables[0] != '\0' ? std::string(tunables) + ":" + TUNABLE : std::string(TUNABLE);
+        if (setenv("GLIBC_TUNABLES", value.c_str(), 1) != 0) {
+            return false;
+        }
+    } catch (...) {
+        return false;
+    }
+
+    // Only returns when it fails.
+    execv("/proc/self/exe", argv);
+    return false;
+#else
+    (void)argv;
+    return false;
+#endif
+}
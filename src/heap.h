@@ -0,0 +1,17 @@
+#pragma once
+
+// Makes the C heap keep memory that jobs free for the jobs after them instead of returning it to the operating system,
+// so a batch of large textures doesn't map and page fault its decoded images, nvtt surfaces and output buffers anew for
+// every job. Every thread allocates from a single heap, because the per thread heaps of glibc map allocations larger
+// than 64 MiB on their own and unmap them when they're freed. The process keeps its peak memory usage until it exits.
+// Must be called before any thread is started. Returns false on platforms other than Linux with glibc, where the heap
+// is left as is.
+bool reuse_freed_memory() noexcept;
+
+// Makes the C heap back large allocations with 2 MiB transparent huge pages, so decoded images and nvtt surfaces take
+// a fault and a TLB entry per 2 MiB rather than per 4 KiB. glibc 2.35 and later read the setting only when the process
+// starts, so this sets `GLIBC_TUNABLES` and executes the process again with the same `argv`, and returns true only when
+// the setting is already in effect. Returns false where huge pages are not available: on platforms other than Linux
+// with glibc, on older glibc versions, when the kernel has transparent huge pages disabled or when the process can't
+// be executed again.
+bool use_huge_pages(char* argv[]) noexcept;
@@ -0,0 +1,150 @@
+#include "input_hashes.h"
+#include "archive.h"
+#include "atomic_file.h"
+
+#include <bx/platform.h>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+#if !BX_PLATFORM_WINDOWS
+#include <sys/stat.h>
+#endif
+
+// First line of the file, so hashes of an incompatible format or hash function are never mistaken for valid ones.
+static const char INPUT_HASHES_MAGIC[] = "texture.compiler input hashes 1";
+
+// Files modified this recently may still be written to without changing their stamp.
+static constexpr std::chrono::seconds INPUT_HASH_SETTLE_TIME(2);
+
+bool InputStamp::operator==(const InputStamp& other) const noexcept {
+    return size == other.size && modified == other.modified && inode == other.inode;
+}
+
+bool get_input_stamp(const std::string& path, InputStamp& stamp) noexcept {
+    try {
+        const std::string file = get_input_file_path(path);
+        std::error_code error;
+        const auto modified = std::filesystem::last_write_time(file, error);
+        if (error) {
+            return false;
+        }
+        const uintmax_t size = std::filesystem::file_size(file, error);
+        if (error) {
+            return false;
+        }
+        stamp.size = static_cast<uint64_t>(size);
+        stamp.modified = static_cast<int64_t>(modified.time_since_epoch().count());
+        stamp.inode = 0;
+#if !BX_PLATFORM_WINDOWS
+        struct stat status {};
+        if (stat(file.c_str(), &status) != 0) {
+            return false;
+        }
+        stamp.inode = static_cast<uint64_t>(status.st_ino);
+#endif
+        return true;
+    } catch (...) {
+        return false;
+    }
+}
+
+InputHashes::InputHashes(std::string path) noexcept
+        : path(std::move(path)) {
+}
+
+bool InputHashes::load(std::ostream& log) {
+    std::ifstream stream(path);
+    if (!stream) {
+        return true;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    entries.clear();
+
+    // Every line after the magic is the hash, the size, the modification time, the inode and the absolute path of the
+    // input, which is the rest of the line, so paths can have spaces.
+    std::string line;
+    if (!std::getline(stream, line) || line != INPUT_HASHES_MAGIC) {
+        log << "Texture compiler warning. Input hashes " << path << " are malformed and start over." << std::endl;
+        return false;
+    }
+
+    while (std::getline(stream, line)) {
+        std::istringstream fields(line);
+        std::string hash;
+        Entry entry;
+        std::string input;
+        if (!(fields >> hash >> entry.stamp.size >> entry.stamp.modified >> entry.stamp.inode) || hash.size() != 32 ||
+            !std::getline(fields >> std::ws, input) || input.empty()) {
+            entries.clear();
+            log << "Texture compiler warning. Input hashes " << path << " are malformed and start over." << std::endl;
+            return false;
+        }
+        try {
+            entry.hash.high = std::stoull(hash.substr(0, 16), nullptr, 16);
+            entry.hash.low = std::stoull(hash.substr(16), nullptr, 16);
+        } catch (const std::exception&) {
+            entries.clear();
+            log << "Texture compiler warning. Input hashes " << path << " are malformed and start over." << std::endl;
+            return false;
+        }
+        entries[input] = entry;
+    }
+    return true;
+}
+
+bool InputHashes::save(std::ostream& log) const {
+    const std::string temporary_path = get_temporary_path(path);
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!is_changed) {
+            return true;
+        }
+
+        std::ofstream stream(temporary_path);
+        stream << INPUT_HASHES_MAGIC << "\n";
+        for (const auto& [input, entry] : entries) {
+            stream << entry.hash.to_string() << " " << entry.stamp.size << " " << entry.stamp.modified << " " << entry.stamp.inode << " " << input << "\n";
+        }
+
+        stream.close();
+        if (!stream) {
+            std::remove(temporary_path.c_str());
+            log << "Texture compiler warning. Failed to write input hashes " << path << "." << std::endl;
+            return false;
+        }
+    }
+
+    if (!replace_file(temporary_path, path)) {
+        log << "Texture compiler warning. Failed to write input hashes " << path << "." << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool InputHashes::find(const std::string& input, const InputStamp& stamp, Hash& hash) const {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    const auto it = entries.find(input);
+    if (it == entries.end() || !(it->second.stamp == stamp)) {
+        return false;
+    }
+    hash = it->second.hash;
+    return true;
+}
+
+void InputHashes::record(const std::string& input, const InputStamp& stamp, const Hash& hash) {
+    const auto now = std::filesystem::file_time_type::clock::now();
+    const auto settled = std::chrono::duration_cast<std::filesystem::file_time_type::duration>(INPUT_HASH_SETTLE_TIME);
+    if (stamp.modified > static_cast<int64_t>((now - settled).time_since_epoch().count())) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    entries[input] = Entry { stamp, hash };
+    is_changed = true;
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "hash.h"
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+
+// What tells a file apart from its earlier versions without reading it: its size, modification time and inode, which
+// changes when a file is replaced by a rename, like editors and version control do. Inodes are zero on Windows.
+struct InputStamp final {
+    uint64_t size = 0;
+    int64_t modified = 0;
+    uint64_t inode = 0;
+
+    bool operator==(const InputStamp& other) const noexcept;
+};
+
+// Stamp of the file that holds the input at `path`, the archive of a member. Returns false when it can't be read.
+bool get_input_stamp(const std::string& path, InputStamp& stamp) noexcept;
+
+// Content hashes of the inputs hashed by previous runs with their stamps, kept by `--cache` in a text file in the cache
+// directory, so the cache keys of unchanged inputs cost a stat instead of reading them. Files modified within the last
+// couple of seconds aren't recorded, another write in the same tick of the modification time could go unnoticed. Last
+// writer wins when processes share the cache, inputs another process recorded are only hashed again. Recording is
+// synchronized, parallel jobs share the hashes.
+struct InputHashes final {
+    explicit InputHashes(std::string path) noexcept;
+
+    InputHashes(const InputHashes&) = delete;
+    InputHashes(InputHashes&&) = delete;
+    InputHashes& operator=(const InputHashes&) = delete;
+    InputHashes& operator=(InputHashes&&) = delete;
+
+    // A missing file has no hashes. Returns false when the file is malformed, there are no hashes then.
+    bool load(std::ostream& log);
+
+    // Only writes the file when something was recorded. It's replaced atomically.
+    bool save(std::ostream& log) const;
+
+    // Returns false when the input wasn't hashed with this stamp.
+    bool find(const std::string& input, const InputStamp& stamp, Hash& hash) const;
+
+    void record(const std::string& input, const InputStamp& stamp, const Hash& hash);
+
+private:
+    struct Entry final {
+        InputStamp stamp;
+        Hash hash;
+    };
+
+    std::string path;
+
+    mutable std::mutex mutex;
+    std::map<std::string, Entry> entries;
+    bool is_changed = false;
+};
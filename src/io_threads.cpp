@@ -0,0 +1,8 @@
+#include "io_threads.h"
+
+static constexpr size_t IO_THREAD_COUNT = 4;
+
+ThreadPool& get_io_threads() {
+    static ThreadPool pool(IO_THREAD_COUNT);
+    return pool;
+}
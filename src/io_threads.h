@@ -0,0 +1,9 @@
+#pragma once
+
+#include "thread_pool.h"
+
+// Threads that run blocking file system calls, writes of outputs and read ahead hints of inputs, so the threads that
+// compile textures keep computing while the kernel waits for the disk or a network file system. Several of them, so
+// the writes of parallel jobs overlap as well, which network file systems serve in parallel. Threads are started by
+// the first call. A thread waiting for its I/O tasks runs the ones that haven't started yet itself.
+ThreadPool& get_io_threads();
@@ -0,0 +1,608 @@
+#include <cstdint>
+
+static const uint8_t irradiance_shader_compute_glsl[2916] =
+{
+	0x43, 0x53, 0x48, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x0b, // CSH...........Q.
+	0x00, 0x00, 0x23, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x34, 0x33, 0x30, 0x0a, 0x76, // ..#version 430.v
+	0x65, 0x63, 0x33, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x4d, 0x75, 0x6c, 0x28, 0x76, 0x65, 0x63, 0x33, // ec3 instMul(vec3
+	0x20, 0x5f, 0x76, 0x65, 0x63, 0x2c, 0x20, 0x6d, 0x61, 0x74, 0x33, 0x20, 0x5f, 0x6d, 0x74, 0x78, //  _vec, mat3 _mtx
+	0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x28, 0x20, 0x28, 0x5f, 0x76, // ) { return ( (_v
+	0x65, 0x63, 0x29, 0x20, 0x2a, 0x20, 0x28, 0x5f, 0x6d, 0x74, 0x78, 0x29, 0x20, 0x29, 0x3b, 0x20, // ec) * (_mtx) ); 
+	0x7d, 0x0a, 0x76, 0x65, 0x63, 0x33, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x4d, 0x75, 0x6c, 0x28, 0x6d, // }.vec3 instMul(m
+	0x61, 0x74, 0x33, 0x20, 0x5f, 0x6d, 0x74, 0x78, 0x2c, 0x20, 0x76, 0x65, 0x63, 0x33, 0x20, 0x5f, // at3 _mtx, vec3 _
+	0x76, 0x65, 0x63, 0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x28, 0x20, // vec) { return ( 
+	0x28, 0x5f, 0x6d, 0x74, 0x78, 0x29, 0x20, 0x2a, 0x20, 0x28, 0x5f, 0x76, 0x65, 0x63, 0x29, 0x20, // (_mtx) * (_vec) 
+	0x29, 0x3b, 0x20, 0x7d, 0x0a, 0x76, 0x65, 0x63, 0x34, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x4d, 0x75, // ); }.vec4 instMu
+	0x6c, 0x28, 0x76, 0x65, 0x63, 0x34, 0x20, 0x5f, 0x76, 0x65, 0x63, 0x2c, 0x20, 0x6d, 0x61, 0x74, // l(vec4 _vec, mat
+	0x34, 0x20, 0x5f, 0x6d, 0x74, 0x78, 0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, // 4 _mtx) { return
+	0x20, 0x28, 0x20, 0x28, 0x5f, 0x76, 0x65, 0x63, 0x29, 0x20, 0x2a, 0x20, 0x28, 0x5f, 0x6d, 0x74, //  ( (_vec) * (_mt
+	0x78, 0x29, 0x20, 0x29, 0x3b, 0x20, 0x7d, 0x0a, 0x76, 0x65, 0x63, 0x34, 0x20, 0x69, 0x6e, 0x73, // x) ); }.vec4 ins
+	0x74, 0x4d, 0x75, 0x6c, 0x28, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x5f, 0x6d, 0x74, 0x78, 0x2c, 0x20, // tMul(mat4 _mtx, 
+	0x76, 0x65, 0x63, 0x34, 0x20, 0x5f, 0x76, 0x65, 0x63, 0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, // vec4 _vec) { ret
+	0x75, 0x72, 0x6e, 0x20, 0x28, 0x20, 0x28, 0x5f, 0x6d, 0x74, 0x78, 0x29, 0x20, 0x2a, 0x20, 0x28, // urn ( (_mtx) * (
+	0x5f, 0x76, 0x65, 0x63, 0x29, 0x20, 0x29, 0x3b, 0x20, 0x7d, 0x0a, 0x66, 0x6c, 0x6f, 0x61, 0x74, // _vec) ); }.float
+	0x20, 0x72, 0x63, 0x70, 0x28, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x5f, 0x61, 0x29, 0x20, 0x7b, //  rcp(float _a) {
+	0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x31, 0x2e, 0x30, 0x2f, 0x5f, 0x61, 0x3b, 0x20, //  return 1.0/_a; 
+	0x7d, 0x0a, 0x76, 0x65, 0x63, 0x32, 0x20, 0x72, 0x63, 0x70, 0x28, 0x76, 0x65, 0x63, 0x32, 0x20, // }.vec2 rcp(vec2 
+	0x5f, 0x61, 0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x76, 0x65, 0x63, // _a) { return vec
+	0x32, 0x28, 0x31, 0x2e, 0x30, 0x29, 0x2f, 0x5f, 0x61, 0x3b, 0x20, 0x7d, 0x0a, 0x76, 0x65, 0x63, // 2(1.0)/_a; }.vec
+	0x33, 0x20, 0x72, 0x63, 0x70, 0x28, 0x76, 0x65, 0x63, 0x33, 0x20, 0x5f, 0x61, 0x29, 0x20, 0x7b, // 3 rcp(vec3 _a) {
+	0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x76, 0x65, 0x63, 0x33, 0x28, 0x31, 0x2e, 0x30, //  return vec3(1.0
+	0x29, 0x2f, 0x5f, 0x61, 0x3b, 0x20, 0x7d, 0x0a, 0x76, 0x65, 0x63, 0x34, 0x20, 0x72, 0x63, 0x70, // )/_a; }.vec4 rcp
+	0x28, 0x76, 0x65, 0x63, 0x34, 0x20, 0x5f, 0x61, 0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, // (vec4 _a) { retu
+	0x72, 0x6e, 0x20, 0x76, 0x65, 0x63, 0x34, 0x28, 0x31, 0x2e, 0x30, 0x29, 0x2f, 0x5f, 0x61, 0x3b, // rn vec4(1.0)/_a;
+	0x20, 0x7d, 0x0a, 0x76, 0x65, 0x63, 0x32, 0x20, 0x76, 0x65, 0x63, 0x32, 0x5f, 0x73, 0x70, 0x6c, //  }.vec2 vec2_spl
+	0x61, 0x74, 0x28, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x5f, 0x78, 0x29, 0x20, 0x7b, 0x20, 0x72, // at(float _x) { r
+	0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x76, 0x65, 0x63, 0x32, 0x28, 0x5f, 0x78, 0x2c, 0x20, 0x5f, // eturn vec2(_x, _
+	0x78, 0x29, 0x3b, 0x20, 0x7d, 0x0a, 0x76, 0x65, 0x63, 0x33, 0x20, 0x76, 0x65, 0x63, 0x33, 0x5f, // x); }.vec3 vec3_
+	0x73, 0x70, 0x6c, 0x61, 0x74, 0x28, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x5f, 0x78, 0x29, 0x20, // splat(float _x) 
+	0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x76, 0x65, 0x63, 0x33, 0x28, 0x5f, 0x78, // { return vec3(_x
+	0x2c, 0x20, 0x5f, 0x78, 0x2c, 0x20, 0x5f, 0x78, 0x29, 0x3b, 0x20, 0x7d, 0x0a, 0x76, 0x65, 0x63, // , _x, _x); }.vec
+	0x34, 0x20, 0x76, 0x65, 0x63, 0x34, 0x5f, 0x73, 0x70, 0x6c, 0x61, 0x74, 0x28, 0x66, 0x6c, 0x6f, // 4 vec4_splat(flo
+	0x61, 0x74, 0x20, 0x5f, 0x78, 0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, // at _x) { return 
+	0x76, 0x65, 0x63, 0x34, 0x28, 0x5f, 0x78, 0x2c, 0x20, 0x5f, 0x78, 0x2c, 0x20, 0x5f, 0x78, 0x2c, // vec4(_x, _x, _x,
+	0x20, 0x5f, 0x78, 0x29, 0x3b, 0x20, 0x7d, 0x0a, 0x75, 0x76, 0x65, 0x63, 0x32, 0x20, 0x75, 0x76, //  _x); }.uvec2 uv
+	0x65, 0x63, 0x32, 0x5f, 0x73, 0x70, 0x6c, 0x61, 0x74, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, // ec2_splat(uint _
+	0x78, 0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x75, 0x76, 0x65, 0x63, // x) { return uvec
+	0x32, 0x28, 0x5f, 0x78, 0x2c, 0x20, 0x5f, 0x78, 0x29, 0x3b, 0x20, 0x7d, 0x0a, 0x75, 0x76, 0x65, // 2(_x, _x); }.uve
+	0x63, 0x33, 0x20, 0x75, 0x76, 0x65, 0x63, 0x33, 0x5f, 0x73, 0x70, 0x6c, 0x61, 0x74, 0x28, 0x75, // c3 uvec3_splat(u
+	0x69, 0x6e, 0x74, 0x20, 0x5f, 0x78, 0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, // int _x) { return
+	0x20, 0x75, 0x76, 0x65, 0x63, 0x33, 0x28, 0x5f, 0x78, 0x2c, 0x20, 0x5f, 0x78, 0x2c, 0x20, 0x5f, //  uvec3(_x, _x, _
+	0x78, 0x29, 0x3b, 0x20, 0x7d, 0x0a, 0x75, 0x76, 0x65, 0x63, 0x34, 0x20, 0x75, 0x76, 0x65, 0x63, // x); }.uvec4 uvec
+	0x34, 0x5f, 0x73, 0x70, 0x6c, 0x61, 0x74, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x78, 0x29, // 4_splat(uint _x)
+	0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x75, 0x76, 0x65, 0x63, 0x34, 0x28, //  { return uvec4(
+	0x5f, 0x78, 0x2c, 0x20, 0x5f, 0x78, 0x2c, 0x20, 0x5f, 0x78, 0x2c, 0x20, 0x5f, 0x78, 0x29, 0x3b, // _x, _x, _x, _x);
+	0x20, 0x7d, 0x0a, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x6d, 0x74, 0x78, 0x46, 0x72, 0x6f, 0x6d, 0x52, //  }.mat4 mtxFromR
+	0x6f, 0x77, 0x73, 0x28, 0x76, 0x65, 0x63, 0x34, 0x20, 0x5f, 0x30, 0x2c, 0x20, 0x76, 0x65, 0x63, // ows(vec4 _0, vec
+	0x34, 0x20, 0x5f, 0x31, 0x2c, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x5f, 0x32, 0x2c, 0x20, 0x76, // 4 _1, vec4 _2, v
+	0x65, 0x63, 0x34, 0x20, 0x5f, 0x33, 0x29, 0x0a, 0x7b, 0x0a, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, // ec4 _3).{.return
+	0x20, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x70, 0x6f, 0x73, 0x65, 0x28, 0x6d, 0x61, 0x74, 0x34, 0x28, //  transpose(mat4(
+	0x5f, 0x30, 0x2c, 0x20, 0x5f, 0x31, 0x2c, 0x20, 0x5f, 0x32, 0x2c, 0x20, 0x5f, 0x33, 0x29, 0x20, // _0, _1, _2, _3) 
+	0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x6d, 0x74, 0x78, 0x46, 0x72, 0x6f, // );.}.mat4 mtxFro
+	0x6d, 0x43, 0x6f, 0x6c, 0x73, 0x28, 0x76, 0x65, 0x63, 0x34, 0x20, 0x5f, 0x30, 0x2c, 0x20, 0x76, // mCols(vec4 _0, v
+	0x65, 0x63, 0x34, 0x20, 0x5f, 0x31, 0x2c, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x5f, 0x32, 0x2c, // ec4 _1, vec4 _2,
+	0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x5f, 0x33, 0x29, 0x0a, 0x7b, 0x0a, 0x72, 0x65, 0x74, 0x75, //  vec4 _3).{.retu
+	0x72, 0x6e, 0x20, 0x6d, 0x61, 0x74, 0x34, 0x28, 0x5f, 0x30, 0x2c, 0x20, 0x5f, 0x31, 0x2c, 0x20, // rn mat4(_0, _1, 
+	0x5f, 0x32, 0x2c, 0x20, 0x5f, 0x33, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, // _2, _3);.}.unifo
+	0x72, 0x6d, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x75, 0x5f, 0x76, 0x69, 0x65, 0x77, 0x52, 0x65, // rm vec4 u_viewRe
+	0x63, 0x74, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x76, 0x65, 0x63, 0x34, // ct;.uniform vec4
+	0x20, 0x75, 0x5f, 0x76, 0x69, 0x65, 0x77, 0x54, 0x65, 0x78, 0x65, 0x6c, 0x3b, 0x0a, 0x75, 0x6e, //  u_viewTexel;.un
+	0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x75, 0x5f, 0x76, 0x69, 0x65, // iform mat4 u_vie
+	0x77, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x6d, 0x61, 0x74, 0x34, 0x20, // w;.uniform mat4 
+	0x75, 0x5f, 0x69, 0x6e, 0x76, 0x56, 0x69, 0x65, 0x77, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, // u_invView;.unifo
+	0x72, 0x6d, 0x20, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x75, 0x5f, 0x70, 0x72, 0x6f, 0x6a, 0x3b, 0x0a, // rm mat4 u_proj;.
+	0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x75, 0x5f, 0x69, // uniform mat4 u_i
+	0x6e, 0x76, 0x50, 0x72, 0x6f, 0x6a, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, // nvProj;.uniform 
+	0x6d, 0x61, 0x74, 0x34, 0x20, 0x75, 0x5f, 0x76, 0x69, 0x65, 0x77, 0x50, 0x72, 0x6f, 0x6a, 0x3b, // mat4 u_viewProj;
+	0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x75, 0x5f, // .uniform mat4 u_
+	0x69, 0x6e, 0x76, 0x56, 0x69, 0x65, 0x77, 0x50, 0x72, 0x6f, 0x6a, 0x3b, 0x0a, 0x75, 0x6e, 0x69, // invViewProj;.uni
+	0x66, 0x6f, 0x72, 0x6d, 0x20, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x75, 0x5f, 0x6d, 0x6f, 0x64, 0x65, // form mat4 u_mode
+	0x6c, 0x5b, 0x33, 0x32, 0x5d, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x6d, // l[32];.uniform m
+	0x61, 0x74, 0x34, 0x20, 0x75, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x56, 0x69, 0x65, 0x77, 0x3b, // at4 u_modelView;
+	0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x75, 0x5f, // .uniform mat4 u_
+	0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x56, 0x69, 0x65, 0x77, 0x50, 0x72, 0x6f, 0x6a, 0x3b, 0x0a, 0x75, // modelViewProj;.u
+	0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x75, 0x5f, 0x61, 0x6c, // niform vec4 u_al
+	0x70, 0x68, 0x61, 0x52, 0x65, 0x66, 0x34, 0x3b, 0x0a, 0x76, 0x65, 0x63, 0x33, 0x20, 0x63, 0x75, // phaRef4;.vec3 cu
+	0x62, 0x65, 0x5f, 0x6d, 0x61, 0x70, 0x5f, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, // be_map_direction
+	0x28, 0x69, 0x76, 0x65, 0x63, 0x33, 0x20, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x2c, 0x20, 0x66, 0x6c, // (ivec3 texel, fl
+	0x6f, 0x61, 0x74, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x2c, 0x20, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x69, // oat size, mat4 i
+	0x6e, 0x76, 0x65, 0x72, 0x73, 0x65, 0x5f, 0x76, 0x69, 0x65, 0x77, 0x5f, 0x70, 0x72, 0x6f, 0x6a, // nverse_view_proj
+	0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x29, 0x20, 0x7b, 0x0a, 0x76, 0x65, 0x63, 0x32, 0x20, 0x6e, // ection) {.vec2 n
+	0x64, 0x63, 0x20, 0x3d, 0x20, 0x28, 0x76, 0x65, 0x63, 0x32, 0x28, 0x74, 0x65, 0x78, 0x65, 0x6c, // dc = (vec2(texel
+	0x2e, 0x78, 0x79, 0x29, 0x20, 0x2b, 0x20, 0x30, 0x2e, 0x35, 0x29, 0x20, 0x2f, 0x20, 0x73, 0x69, // .xy) + 0.5) / si
+	0x7a, 0x65, 0x20, 0x2a, 0x20, 0x32, 0x2e, 0x30, 0x20, 0x2d, 0x20, 0x31, 0x2e, 0x30, 0x3b, 0x0a, // ze * 2.0 - 1.0;.
+	0x76, 0x65, 0x63, 0x34, 0x20, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x3d, 0x20, // vec4 position = 
+	0x28, 0x20, 0x28, 0x69, 0x6e, 0x76, 0x65, 0x72, 0x73, 0x65, 0x5f, 0x76, 0x69, 0x65, 0x77, 0x5f, // ( (inverse_view_
+	0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x29, 0x20, 0x2a, 0x20, 0x28, 0x76, // projection) * (v
+	0x65, 0x63, 0x34, 0x28, 0x6e, 0x64, 0x63, 0x2c, 0x20, 0x31, 0x2e, 0x30, 0x2c, 0x20, 0x31, 0x2e, // ec4(ndc, 1.0, 1.
+	0x30, 0x29, 0x29, 0x20, 0x29, 0x3b, 0x0a, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x6e, 0x6f, // 0)) );.return no
+	0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x28, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, // rmalize(position
+	0x2e, 0x78, 0x79, 0x7a, 0x20, 0x2f, 0x20, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x2e, // .xyz / position.
+	0x77, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x73, 0x61, // w);.}.uniform sa
+	0x6d, 0x70, 0x6c, 0x65, 0x72, 0x43, 0x75, 0x62, 0x65, 0x20, 0x73, 0x5f, 0x74, 0x65, 0x78, 0x74, // mplerCube s_text
+	0x75, 0x72, 0x65, 0x3b, 0x0a, 0x6c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x28, 0x72, 0x67, 0x62, 0x61, // ure;.layout(rgba
+	0x31, 0x36, 0x66, 0x2c, 0x20, 0x62, 0x69, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x3d, 0x31, 0x29, 0x20, // 16f, binding=1) 
+	0x77, 0x72, 0x69, 0x74, 0x65, 0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, // writeonly unifor
+	0x6d, 0x20, 0x69, 0x6d, 0x61, 0x67, 0x65, 0x32, 0x44, 0x41, 0x72, 0x72, 0x61, 0x79, 0x20, 0x73, // m image2DArray s
+	0x5f, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, // _output;.uniform
+	0x20, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x75, 0x5f, 0x69, 0x6e, 0x76, 0x65, 0x72, 0x73, 0x65, 0x5f, //  mat4 u_inverse_
+	0x76, 0x69, 0x65, 0x77, 0x5f, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, // view_projections
+	0x5b, 0x36, 0x5d, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x76, 0x65, 0x63, // [6];.uniform vec
+	0x34, 0x20, 0x75, 0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x3b, 0x0a, 0x75, 0x6e, // 4 u_settings;.un
+	0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x75, 0x5f, 0x74, 0x69, 0x6c, // iform vec4 u_til
+	0x65, 0x3b, 0x0a, 0x6c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x20, 0x28, 0x6c, 0x6f, 0x63, 0x61, 0x6c, // e;.layout (local
+	0x5f, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x78, 0x20, 0x3d, 0x20, 0x38, 0x2c, 0x20, 0x6c, 0x6f, 0x63, // _size_x = 8, loc
+	0x61, 0x6c, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x79, 0x20, 0x3d, 0x20, 0x38, 0x2c, 0x20, 0x6c, // al_size_y = 8, l
+	0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x7a, 0x20, 0x3d, 0x20, 0x31, 0x29, // ocal_size_z = 1)
+	0x20, 0x69, 0x6e, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x6d, 0x61, 0x69, 0x6e, 0x28, 0x29, //  in;.void main()
+	0x20, 0x7b, 0x0a, 0x69, 0x76, 0x65, 0x63, 0x33, 0x20, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x20, 0x3d, //  {.ivec3 texel =
+	0x20, 0x69, 0x76, 0x65, 0x63, 0x33, 0x28, 0x67, 0x6c, 0x5f, 0x47, 0x6c, 0x6f, 0x62, 0x61, 0x6c, //  ivec3(gl_Global
+	0x49, 0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x49, 0x44, 0x29, 0x20, 0x2b, 0x20, // InvocationID) + 
+	0x69, 0x76, 0x65, 0x63, 0x33, 0x28, 0x75, 0x5f, 0x74, 0x69, 0x6c, 0x65, 0x2e, 0x78, 0x79, 0x2c, // ivec3(u_tile.xy,
+	0x20, 0x30, 0x2e, 0x30, 0x29, 0x3b, 0x0a, 0x69, 0x66, 0x20, 0x28, 0x66, 0x6c, 0x6f, 0x61, 0x74, //  0.0);.if (float
+	0x28, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x2e, 0x78, 0x29, 0x20, 0x3e, 0x3d, 0x20, 0x75, 0x5f, 0x73, // (texel.x) >= u_s
+	0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x78, 0x20, 0x7c, 0x7c, 0x20, 0x66, 0x6c, 0x6f, // ettings.x || flo
+	0x61, 0x74, 0x28, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x2e, 0x79, 0x29, 0x20, 0x3e, 0x3d, 0x20, 0x75, // at(texel.y) >= u
+	0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x78, 0x29, 0x20, 0x7b, 0x0a, 0x72, // _settings.x) {.r
+	0x65, 0x74, 0x75, 0x72, 0x6e, 0x3b, 0x0a, 0x7d, 0x0a, 0x76, 0x65, 0x63, 0x33, 0x20, 0x6e, 0x6f, // eturn;.}.vec3 no
+	0x72, 0x6d, 0x61, 0x6c, 0x20, 0x3d, 0x20, 0x63, 0x75, 0x62, 0x65, 0x5f, 0x6d, 0x61, 0x70, 0x5f, // rmal = cube_map_
+	0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x28, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x2c, // direction(texel,
+	0x20, 0x75, 0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x78, 0x2c, 0x20, 0x75, //  u_settings.x, u
+	0x5f, 0x69, 0x6e, 0x76, 0x65, 0x72, 0x73, 0x65, 0x5f, 0x76, 0x69, 0x65, 0x77, 0x5f, 0x70, 0x72, // _inverse_view_pr
+	0x6f, 0x6a, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x5b, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x2e, // ojections[texel.
+	0x7a, 0x5d, 0x29, 0x3b, 0x0a, 0x76, 0x65, 0x63, 0x33, 0x20, 0x69, 0x72, 0x72, 0x61, 0x64, 0x69, // z]);.vec3 irradi
+	0x61, 0x6e, 0x63, 0x65, 0x20, 0x3d, 0x20, 0x76, 0x65, 0x63, 0x33, 0x28, 0x30, 0x2e, 0x30, 0x2c, // ance = vec3(0.0,
+	0x20, 0x30, 0x2e, 0x30, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x29, 0x3b, 0x0a, 0x76, 0x65, 0x63, 0x33, //  0.0, 0.0);.vec3
+	0x20, 0x75, 0x70, 0x20, 0x3d, 0x20, 0x76, 0x65, 0x63, 0x33, 0x28, 0x30, 0x2e, 0x30, 0x2c, 0x20, //  up = vec3(0.0, 
+	0x31, 0x2e, 0x30, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x29, 0x3b, 0x0a, 0x76, 0x65, 0x63, 0x33, 0x20, // 1.0, 0.0);.vec3 
+	0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 0x3d, 0x20, 0x63, 0x72, 0x6f, 0x73, 0x73, 0x28, 0x75, 0x70, // right = cross(up
+	0x2c, 0x20, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x29, 0x3b, 0x0a, 0x75, 0x70, 0x20, 0x3d, 0x20, // , normal);.up = 
+	0x63, 0x72, 0x6f, 0x73, 0x73, 0x28, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x2c, 0x20, 0x72, 0x69, // cross(normal, ri
+	0x67, 0x68, 0x74, 0x29, 0x3b, 0x0a, 0x69, 0x6e, 0x74, 0x20, 0x73, 0x74, 0x65, 0x70, 0x5f, 0x63, // ght);.int step_c
+	0x6f, 0x75, 0x6e, 0x74, 0x20, 0x3d, 0x20, 0x69, 0x6e, 0x74, 0x28, 0x75, 0x5f, 0x73, 0x65, 0x74, // ount = int(u_set
+	0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x7a, 0x29, 0x3b, 0x0a, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, // tings.z);.float 
+	0x73, 0x74, 0x65, 0x70, 0x5f, 0x61, 0x6e, 0x67, 0x6c, 0x65, 0x20, 0x3d, 0x20, 0x30, 0x2e, 0x35, // step_angle = 0.5
+	0x20, 0x2a, 0x20, 0x33, 0x2e, 0x31, 0x34, 0x31, 0x35, 0x39, 0x32, 0x36, 0x35, 0x33, 0x35, 0x39, //  * 3.14159265359
+	0x20, 0x2f, 0x20, 0x75, 0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x7a, 0x3b, //  / u_settings.z;
+	0x0a, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x20, 0x3d, 0x20, 0x30, 0x3b, // .for (int i = 0;
+	0x20, 0x69, 0x20, 0x3c, 0x20, 0x34, 0x20, 0x2a, 0x20, 0x33, 0x32, 0x3b, 0x20, 0x69, 0x2b, 0x2b, //  i < 4 * 32; i++
+	0x29, 0x20, 0x7b, 0x0a, 0x69, 0x66, 0x20, 0x28, 0x69, 0x20, 0x3e, 0x3d, 0x20, 0x34, 0x20, 0x2a, // ) {.if (i >= 4 *
+	0x20, 0x73, 0x74, 0x65, 0x70, 0x5f, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x29, 0x20, 0x7b, 0x0a, 0x62, //  step_count) {.b
+	0x72, 0x65, 0x61, 0x6b, 0x3b, 0x0a, 0x7d, 0x0a, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x70, 0x68, // reak;.}.float ph
+	0x69, 0x20, 0x3d, 0x20, 0x28, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x28, 0x69, 0x29, 0x20, 0x2b, 0x20, // i = (float(i) + 
+	0x30, 0x2e, 0x35, 0x29, 0x20, 0x2a, 0x20, 0x73, 0x74, 0x65, 0x70, 0x5f, 0x61, 0x6e, 0x67, 0x6c, // 0.5) * step_angl
+	0x65, 0x3b, 0x0a, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x69, 0x6e, 0x74, 0x20, 0x6a, 0x20, 0x3d, 0x20, // e;.for (int j = 
+	0x30, 0x3b, 0x20, 0x6a, 0x20, 0x3c, 0x20, 0x33, 0x32, 0x3b, 0x20, 0x6a, 0x2b, 0x2b, 0x29, 0x20, // 0; j < 32; j++) 
+	0x7b, 0x0a, 0x69, 0x66, 0x20, 0x28, 0x6a, 0x20, 0x3e, 0x3d, 0x20, 0x73, 0x74, 0x65, 0x70, 0x5f, // {.if (j >= step_
+	0x63, 0x6f, 0x75, 0x6e, 0x74, 0x29, 0x20, 0x7b, 0x0a, 0x62, 0x72, 0x65, 0x61, 0x6b, 0x3b, 0x0a, // count) {.break;.
+	0x7d, 0x0a, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x74, 0x68, 0x65, 0x74, 0x61, 0x20, 0x3d, 0x20, // }.float theta = 
+	0x28, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x28, 0x6a, 0x29, 0x20, 0x2b, 0x20, 0x30, 0x2e, 0x35, 0x29, // (float(j) + 0.5)
+	0x20, 0x2a, 0x20, 0x73, 0x74, 0x65, 0x70, 0x5f, 0x61, 0x6e, 0x67, 0x6c, 0x65, 0x3b, 0x0a, 0x76, //  * step_angle;.v
+	0x65, 0x63, 0x33, 0x20, 0x74, 0x61, 0x6e, 0x67, 0x65, 0x6e, 0x74, 0x5f, 0x73, 0x61, 0x6d, 0x70, // ec3 tangent_samp
+	0x6c, 0x65, 0x20, 0x3d, 0x20, 0x76, 0x65, 0x63, 0x33, 0x28, 0x73, 0x69, 0x6e, 0x28, 0x74, 0x68, // le = vec3(sin(th
+	0x65, 0x74, 0x61, 0x29, 0x20, 0x2a, 0x20, 0x63, 0x6f, 0x73, 0x28, 0x70, 0x68, 0x69, 0x29, 0x2c, // eta) * cos(phi),
+	0x20, 0x73, 0x69, 0x6e, 0x28, 0x74, 0x68, 0x65, 0x74, 0x61, 0x29, 0x20, 0x2a, 0x20, 0x73, 0x69, //  sin(theta) * si
+	0x6e, 0x28, 0x70, 0x68, 0x69, 0x29, 0x2c, 0x20, 0x63, 0x6f, 0x73, 0x28, 0x74, 0x68, 0x65, 0x74, // n(phi), cos(thet
+	0x61, 0x29, 0x29, 0x3b, 0x0a, 0x76, 0x65, 0x63, 0x33, 0x20, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, // a));.vec3 sample
+	0x5f, 0x64, 0x69, 0x72, 0x20, 0x3d, 0x20, 0x74, 0x61, 0x6e, 0x67, 0x65, 0x6e, 0x74, 0x5f, 0x73, // _dir = tangent_s
+	0x61, 0x6d, 0x70, 0x6c, 0x65, 0x2e, 0x78, 0x20, 0x2a, 0x20, 0x72, 0x69, 0x67, 0x68, 0x74, 0x20, // ample.x * right 
+	0x2b, 0x20, 0x74, 0x61, 0x6e, 0x67, 0x65, 0x6e, 0x74, 0x5f, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, // + tangent_sample
+	0x2e, 0x79, 0x20, 0x2a, 0x20, 0x75, 0x70, 0x20, 0x2b, 0x20, 0x74, 0x61, 0x6e, 0x67, 0x65, 0x6e, // .y * up + tangen
+	0x74, 0x5f, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x2e, 0x7a, 0x20, 0x2a, 0x20, 0x6e, 0x6f, 0x72, // t_sample.z * nor
+	0x6d, 0x61, 0x6c, 0x3b, 0x0a, 0x69, 0x72, 0x72, 0x61, 0x64, 0x69, 0x61, 0x6e, 0x63, 0x65, 0x20, // mal;.irradiance 
+	0x2b, 0x3d, 0x20, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x43, 0x75, 0x62, 0x65, 0x4c, 0x6f, // += textureCubeLo
+	0x64, 0x28, 0x73, 0x5f, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x2c, 0x20, 0x73, 0x61, 0x6d, // d(s_texture, sam
+	0x70, 0x6c, 0x65, 0x5f, 0x64, 0x69, 0x72, 0x2c, 0x20, 0x75, 0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, // ple_dir, u_setti
+	0x6e, 0x67, 0x73, 0x2e, 0x79, 0x29, 0x2e, 0x78, 0x79, 0x7a, 0x20, 0x2a, 0x20, 0x63, 0x6f, 0x73, // ngs.y).xyz * cos
+	0x28, 0x74, 0x68, 0x65, 0x74, 0x61, 0x29, 0x20, 0x2a, 0x20, 0x73, 0x69, 0x6e, 0x28, 0x74, 0x68, // (theta) * sin(th
+	0x65, 0x74, 0x61, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x7d, 0x0a, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, // eta);.}.}.float 
+	0x6e, 0x72, 0x5f, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x73, 0x20, 0x3d, 0x20, 0x34, 0x2e, 0x30, // nr_samples = 4.0
+	0x20, 0x2a, 0x20, 0x75, 0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x7a, 0x20, //  * u_settings.z 
+	0x2a, 0x20, 0x75, 0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x7a, 0x3b, 0x0a, // * u_settings.z;.
+	0x69, 0x6d, 0x61, 0x67, 0x65, 0x53, 0x74, 0x6f, 0x72, 0x65, 0x28, 0x73, 0x5f, 0x6f, 0x75, 0x74, // imageStore(s_out
+	0x70, 0x75, 0x74, 0x2c, 0x20, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x2c, 0x20, 0x76, 0x65, 0x63, 0x34, // put, texel, vec4
+	0x28, 0x33, 0x2e, 0x31, 0x34, 0x31, 0x35, 0x39, 0x32, 0x36, 0x35, 0x33, 0x35, 0x39, 0x20, 0x2a, // (3.14159265359 *
+	0x20, 0x69, 0x72, 0x72, 0x61, 0x64, 0x69, 0x61, 0x6e, 0x63, 0x65, 0x20, 0x2f, 0x20, 0x6e, 0x72, //  irradiance / nr
+	0x5f, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x73, 0x2c, 0x20, 0x31, 0x2e, 0x30, 0x29, 0x29, 0x3b, // _samples, 1.0));
+	0x0a, 0x7d, 0x0a, 0x00,                                                                         // .}..
+};
+
+static const uint8_t irradiance_shader_compute_spv[4217] =
+{
+	0x43, 0x53, 0x48, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x06, 0x75, // CSH............u
+	0x5f, 0x74, 0x69, 0x6c, 0x65, 0x02, 0x01, 0x90, 0x01, 0x01, 0x00, 0x0a, 0x75, 0x5f, 0x73, 0x65, // _tile.......u_se
+	0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x02, 0x01, 0x80, 0x01, 0x01, 0x00, 0x1a, 0x75, 0x5f, 0x69, // ttings.......u_i
+	0x6e, 0x76, 0x65, 0x72, 0x73, 0x65, 0x5f, 0x76, 0x69, 0x65, 0x77, 0x5f, 0x70, 0x72, 0x6f, 0x6a, // nverse_view_proj
+	0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x04, 0x06, 0x00, 0x00, 0x18, 0x00, 0x09, 0x73, 0x5f, // ections.......s_
+	0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x10, 0x00, // texture.........
+	0x00, 0x03, 0x02, 0x23, 0x07, 0x00, 0x00, 0x01, 0x00, 0x07, 0x00, 0x08, 0x00, 0x3d, 0x02, 0x00, // ...#.........=..
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x06, // ................
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x47, 0x4c, 0x53, 0x4c, 0x2e, 0x73, 0x74, 0x64, 0x2e, 0x34, 0x35, // .....GLSL.std.45
+	0x30, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, // 0...............
+	0x00, 0x0f, 0x00, 0x06, 0x00, 0x05, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, // .............mai
+	0x6e, 0x00, 0x00, 0x00, 0x00, 0x38, 0x01, 0x00, 0x00, 0x10, 0x00, 0x06, 0x00, 0x04, 0x00, 0x00, // n....8..........
+	0x00, 0x11, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, // ................
+	0x00, 0x03, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x00, 0xf4, 0x01, 0x00, 0x00, 0x05, 0x00, 0x04, // ................
+	0x00, 0x04, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x07, // .....main.......
+	0x00, 0x31, 0x00, 0x00, 0x00, 0x73, 0x5f, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x53, 0x61, // .1...s_textureSa
+	0x6d, 0x70, 0x6c, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x07, 0x00, 0x34, 0x00, 0x00, // mpler........4..
+	0x00, 0x73, 0x5f, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x54, 0x65, 0x78, 0x74, 0x75, 0x72, // .s_textureTextur
+	0x65, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x06, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x73, 0x5f, 0x6f, // e........:...s_o
+	0x75, 0x74, 0x70, 0x75, 0x74, 0x54, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x00, 0x05, 0x00, 0x04, // utputTexture....
+	0x00, 0x7b, 0x00, 0x00, 0x00, 0x24, 0x47, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x00, 0x06, 0x00, 0x0a, // .{...$Global....
+	0x00, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0x5f, 0x69, 0x6e, 0x76, 0x65, 0x72, // .{.......u_inver
+	0x73, 0x65, 0x5f, 0x76, 0x69, 0x65, 0x77, 0x5f, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x69, // se_view_projecti
+	0x6f, 0x6e, 0x73, 0x00, 0x00, 0x06, 0x00, 0x06, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, // ons......{......
+	0x00, 0x75, 0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x00, 0x00, 0x06, 0x00, 0x05, // .u_settings.....
+	0x00, 0x7b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x75, 0x5f, 0x74, 0x69, 0x6c, 0x65, 0x00, // .{.......u_tile.
+	0x00, 0x05, 0x00, 0x03, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x08, // .....}..........
+	0x00, 0x38, 0x01, 0x00, 0x00, 0x67, 0x6c, 0x5f, 0x47, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x49, 0x6e, // .8...gl_GlobalIn
+	0x76, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x49, 0x44, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, // vocationID...G..
+	0x00, 0x31, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, // .1...".......G..
+	0x00, 0x31, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, // .1...!.......G..
+	0x00, 0x34, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, // .4...".......G..
+	0x00, 0x34, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, // .4...!.......G..
+	0x00, 0x3a, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, // .:...".......G..
+	0x00, 0x3a, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, // .:...!.......G..
+	0x00, 0x7a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x48, 0x00, 0x04, // .z.......@...H..
+	0x00, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, // .{...........H..
+	0x00, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // .{.......#......
+	0x00, 0x48, 0x00, 0x05, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, // .H...{..........
+	0x00, 0x10, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, // .....H...{......
+	0x00, 0x23, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x7b, 0x00, 0x00, // .#.......H...{..
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x90, 0x01, 0x00, 0x00, 0x47, 0x00, 0x03, // .....#.......G..
+	0x00, 0x7b, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x7d, 0x00, 0x00, // .{.......G...}..
+	0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x7d, 0x00, 0x00, // .".......G...}..
+	0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x38, 0x01, 0x00, // .!.......G...8..
+	0x00, 0x0b, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x13, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, // ................
+	0x00, 0x21, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x02, // .!..............
+	0x00, 0x06, 0x00, 0x00, 0x00, 0x16, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, // ............. ..
+	0x00, 0x19, 0x00, 0x09, 0x00, 0x08, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, // ................
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, // ................
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, // ................
+	0x00, 0x03, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, // ................
+	0x00, 0x04, 0x00, 0x00, 0x00, 0x19, 0x00, 0x09, 0x00, 0x15, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, // ................
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // ................
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x15, 0x00, 0x04, 0x00, 0x18, 0x00, 0x00, // ................
+	0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00, 0x19, 0x00, 0x00, // . ..............
+	0x00, 0x18, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x18, 0x00, 0x04, 0x00, 0x22, 0x00, 0x00, // ............."..
+	0x00, 0x0e, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x30, 0x00, 0x00, // ......... ...0..
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x30, 0x00, 0x00, // .........;...0..
+	0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x33, 0x00, 0x00, // .1....... ...3..
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x33, 0x00, 0x00, // .........;...3..
+	0x00, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x39, 0x00, 0x00, // .4....... ...9..
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x39, 0x00, 0x00, // .........;...9..
+	0x00, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x18, 0x00, 0x00, // .:.......+......
+	0x00, 0x3d, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x18, 0x00, 0x00, // .=.......+......
+	0x00, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x03, 0x00, 0x45, 0x00, 0x00, // .A...........E..
+	0x00, 0x08, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00, 0x53, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, // .........S......
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00, 0x56, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, // .........V......
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0x5a, 0x00, 0x00, // .....+.......Z..
+	0x00, 0x00, 0x00, 0x00, 0x3f, 0x2b, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00, // ....?+.......`..
+	0x00, 0x00, 0x00, 0x00, 0x40, 0x2b, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, // ....@+.......b..
+	0x00, 0x00, 0x00, 0x80, 0x3f, 0x15, 0x00, 0x04, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, // ....?....n... ..
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, // .....+...n...y..
+	0x00, 0x06, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x04, 0x00, 0x7a, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, // .........z..."..
+	0x00, 0x79, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x05, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x7a, 0x00, 0x00, // .y.......{...z..
+	0x00, 0x0e, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x7c, 0x00, 0x00, // ......... ...|..
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x7b, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x7c, 0x00, 0x00, // .....{...;...|..
+	0x00, 0x7d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x18, 0x00, 0x00, // .}.......+......
+	0x00, 0x7e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x7f, 0x00, 0x00, // .~....... ......
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x6e, 0x00, 0x00, // .........+...n..
+	0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x8d, 0x00, 0x00, // ......... ......
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x14, 0x00, 0x02, 0x00, 0x90, 0x00, 0x00, // ................
+	0x00, 0x2b, 0x00, 0x04, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, // .+...n..........
+	0x00, 0x2b, 0x00, 0x04, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, // .+...n..........
+	0x00, 0x20, 0x00, 0x04, 0x00, 0xa7, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, // . ..........."..
+	0x00, 0x2b, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // .+..............
+	0x00, 0x2c, 0x00, 0x06, 0x00, 0x0b, 0x00, 0x00, 0x00, 0xad, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, // .,..............
+	0x00, 0xac, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x06, 0x00, 0x0b, 0x00, 0x00, // .........,......
+	0x00, 0xaf, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, // .........b......
+	0x00, 0x2b, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0xbc, 0x00, 0x00, 0x00, 0xdb, 0x0f, 0xc9, // .+..............
+	0x3f, 0x2b, 0x00, 0x04, 0x00, 0x18, 0x00, 0x00, 0x00, 0xc7, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, // ?+..............
+	0x00, 0x2b, 0x00, 0x04, 0x00, 0x18, 0x00, 0x00, 0x00, 0xca, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, // .+..............
+	0x00, 0x2b, 0x00, 0x04, 0x00, 0x18, 0x00, 0x00, 0x00, 0xde, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, // .+........... ..
+	0x00, 0x2b, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0x1f, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, // .+..............
+	0x40, 0x2b, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0x26, 0x01, 0x00, 0x00, 0xdb, 0x0f, 0x49, // @+.......&.....I
+	0x40, 0x20, 0x00, 0x04, 0x00, 0x37, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x19, 0x00, 0x00, // @ ...7..........
+	0x00, 0x3b, 0x00, 0x04, 0x00, 0x37, 0x01, 0x00, 0x00, 0x38, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, // .;...7...8......
+	0x00, 0x2c, 0x00, 0x05, 0x00, 0x53, 0x00, 0x00, 0x00, 0x37, 0x02, 0x00, 0x00, 0x5a, 0x00, 0x00, // .,...S...7...Z..
+	0x00, 0x5a, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x05, 0x00, 0x53, 0x00, 0x00, 0x00, 0x38, 0x02, 0x00, // .Z...,...S...8..
+	0x00, 0x62, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x36, 0x00, 0x05, 0x00, 0x02, 0x00, 0x00, // .b...b...6......
+	0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, // ................
+	0x00, 0x05, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, // .....=.......2..
+	0x00, 0x31, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, // .1...=.......5..
+	0x00, 0x34, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x15, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, // .4...=.......;..
+	0x00, 0x3a, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x19, 0x00, 0x00, 0x00, 0x39, 0x01, 0x00, // .:...=.......9..
+	0x00, 0x38, 0x01, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x6e, 0x01, 0x00, 0x00, 0xf8, 0x00, 0x02, // .8.......n......
+	0x00, 0x6e, 0x01, 0x00, 0x00, 0xf6, 0x00, 0x04, 0x00, 0x6f, 0x01, 0x00, 0x00, 0x70, 0x01, 0x00, // .n.......o...p..
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x71, 0x01, 0x00, 0x00, 0xf8, 0x00, 0x02, // .........q......
+	0x00, 0x71, 0x01, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x73, 0x01, 0x00, // .q...A.......s..
+	0x00, 0x7d, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, // .}...~...=......
+	0x00, 0x74, 0x01, 0x00, 0x00, 0x73, 0x01, 0x00, 0x00, 0x4f, 0x00, 0x07, 0x00, 0x53, 0x00, 0x00, // .t...s...O...S..
+	0x00, 0x75, 0x01, 0x00, 0x00, 0x74, 0x01, 0x00, 0x00, 0x74, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, // .u...t...t......
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x04, 0x00, 0x56, 0x00, 0x00, 0x00, 0x76, 0x01, 0x00, // .....n...V...v..
+	0x00, 0x75, 0x01, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x18, 0x00, 0x00, 0x00, 0x77, 0x01, 0x00, // .u...Q.......w..
+	0x00, 0x76, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x18, 0x00, 0x00, // .v.......Q......
+	0x00, 0x78, 0x01, 0x00, 0x00, 0x76, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x50, 0x00, 0x06, // .x...v.......P..
+	0x00, 0x19, 0x00, 0x00, 0x00, 0x79, 0x01, 0x00, 0x00, 0x77, 0x01, 0x00, 0x00, 0x78, 0x01, 0x00, // .....y...w...x..
+	0x00, 0x41, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x19, 0x00, 0x00, 0x00, 0x7a, 0x01, 0x00, // .A...........z..
+	0x00, 0x39, 0x01, 0x00, 0x00, 0x79, 0x01, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x18, 0x00, 0x00, // .9...y...Q......
+	0x00, 0x7c, 0x01, 0x00, 0x00, 0x7a, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x04, // .|...z.......o..
+	0x00, 0x07, 0x00, 0x00, 0x00, 0x7d, 0x01, 0x00, 0x00, 0x7c, 0x01, 0x00, 0x00, 0x41, 0x00, 0x06, // .....}...|...A..
+	0x00, 0x8d, 0x00, 0x00, 0x00, 0x7e, 0x01, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, // .....~...}...=..
+	0x00, 0x88, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0x7f, 0x01, 0x00, // .....=..........
+	0x00, 0x7e, 0x01, 0x00, 0x00, 0xbe, 0x00, 0x05, 0x00, 0x90, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, // .~..............
+	0x00, 0x7d, 0x01, 0x00, 0x00, 0x7f, 0x01, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x18, 0x00, 0x00, // .}.......Q......
+	0x00, 0x82, 0x01, 0x00, 0x00, 0x7a, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x04, // .....z.......o..
+	0x00, 0x07, 0x00, 0x00, 0x00, 0x83, 0x01, 0x00, 0x00, 0x82, 0x01, 0x00, 0x00, 0x41, 0x00, 0x06, // .............A..
+	0x00, 0x8d, 0x00, 0x00, 0x00, 0x84, 0x01, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, // .........}...=..
+	0x00, 0x88, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0x85, 0x01, 0x00, // .....=..........
+	0x00, 0x84, 0x01, 0x00, 0x00, 0xbe, 0x00, 0x05, 0x00, 0x90, 0x00, 0x00, 0x00, 0x86, 0x01, 0x00, // ................
+	0x00, 0x83, 0x01, 0x00, 0x00, 0x85, 0x01, 0x00, 0x00, 0xa6, 0x00, 0x05, 0x00, 0x90, 0x00, 0x00, // ................
+	0x00, 0x87, 0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x86, 0x01, 0x00, 0x00, 0xf7, 0x00, 0x03, // ................
+	0x00, 0x88, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x87, 0x01, 0x00, // ................
+	0x00, 0x89, 0x01, 0x00, 0x00, 0x88, 0x01, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x89, 0x01, 0x00, // ................
+	0x00, 0xf9, 0x00, 0x02, 0x00, 0x6f, 0x01, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x88, 0x01, 0x00, // .....o..........
+	0x00, 0x51, 0x00, 0x05, 0x00, 0x18, 0x00, 0x00, 0x00, 0x8b, 0x01, 0x00, 0x00, 0x7a, 0x01, 0x00, // .Q...........z..
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00, 0x8d, 0x00, 0x00, 0x00, 0x8d, 0x01, 0x00, // .....A..........
+	0x00, 0x7d, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, // .}...=.......=..
+	0x00, 0x07, 0x00, 0x00, 0x00, 0x8e, 0x01, 0x00, 0x00, 0x8d, 0x01, 0x00, 0x00, 0x41, 0x00, 0x06, // .............A..
+	0x00, 0xa7, 0x00, 0x00, 0x00, 0x8f, 0x01, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, // .........}...A..
+	0x00, 0x8b, 0x01, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x22, 0x00, 0x00, 0x00, 0x90, 0x01, 0x00, // .....=..."......
+	0x00, 0x8f, 0x01, 0x00, 0x00, 0x4f, 0x00, 0x07, 0x00, 0x56, 0x00, 0x00, 0x00, 0x04, 0x02, 0x00, // .....O...V......
+	0x00, 0x7a, 0x01, 0x00, 0x00, 0x7a, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, // .z...z..........
+	0x00, 0x6f, 0x00, 0x04, 0x00, 0x53, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x00, 0x04, 0x02, 0x00, // .o...S..........
+	0x00, 0x81, 0x00, 0x05, 0x00, 0x53, 0x00, 0x00, 0x00, 0x07, 0x02, 0x00, 0x00, 0x05, 0x02, 0x00, // .....S..........
+	0x00, 0x37, 0x02, 0x00, 0x00, 0x50, 0x00, 0x05, 0x00, 0x53, 0x00, 0x00, 0x00, 0x09, 0x02, 0x00, // .7...P...S......
+	0x00, 0x8e, 0x01, 0x00, 0x00, 0x8e, 0x01, 0x00, 0x00, 0x88, 0x00, 0x05, 0x00, 0x53, 0x00, 0x00, // .............S..
+	0x00, 0x0a, 0x02, 0x00, 0x00, 0x07, 0x02, 0x00, 0x00, 0x09, 0x02, 0x00, 0x00, 0x8e, 0x00, 0x05, // ................
+	0x00, 0x53, 0x00, 0x00, 0x00, 0x0b, 0x02, 0x00, 0x00, 0x0a, 0x02, 0x00, 0x00, 0x60, 0x00, 0x00, // .S...........`..
+	0x00, 0x83, 0x00, 0x05, 0x00, 0x53, 0x00, 0x00, 0x00, 0x0d, 0x02, 0x00, 0x00, 0x0b, 0x02, 0x00, // .....S..........
+	0x00, 0x38, 0x02, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0x0f, 0x02, 0x00, // .8...Q..........
+	0x00, 0x0d, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, // .........Q......
+	0x00, 0x10, 0x02, 0x00, 0x00, 0x0d, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x50, 0x00, 0x07, // .............P..
+	0x00, 0x0e, 0x00, 0x00, 0x00, 0x11, 0x02, 0x00, 0x00, 0x0f, 0x02, 0x00, 0x00, 0x10, 0x02, 0x00, // ................
+	0x00, 0x62, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x90, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, // .b...b..........
+	0x00, 0x13, 0x02, 0x00, 0x00, 0x11, 0x02, 0x00, 0x00, 0x90, 0x01, 0x00, 0x00, 0x4f, 0x00, 0x08, // .............O..
+	0x00, 0x0b, 0x00, 0x00, 0x00, 0x15, 0x02, 0x00, 0x00, 0x13, 0x02, 0x00, 0x00, 0x13, 0x02, 0x00, // ................
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, // .............Q..
+	0x00, 0x07, 0x00, 0x00, 0x00, 0x17, 0x02, 0x00, 0x00, 0x13, 0x02, 0x00, 0x00, 0x03, 0x00, 0x00, // ................
+	0x00, 0x50, 0x00, 0x06, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x18, 0x02, 0x00, 0x00, 0x17, 0x02, 0x00, // .P..............
+	0x00, 0x17, 0x02, 0x00, 0x00, 0x17, 0x02, 0x00, 0x00, 0x88, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x00, // ................
+	0x00, 0x19, 0x02, 0x00, 0x00, 0x15, 0x02, 0x00, 0x00, 0x18, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x06, // ................
+	0x00, 0x0b, 0x00, 0x00, 0x00, 0x1a, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, // .............E..
+	0x00, 0x19, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x94, 0x01, 0x00, // ................
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0xaf, 0x00, 0x00, 0x00, 0x1a, 0x02, 0x00, // .....D..........
+	0x00, 0x0c, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x97, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, // ................
+	0x00, 0x44, 0x00, 0x00, 0x00, 0x1a, 0x02, 0x00, 0x00, 0x94, 0x01, 0x00, 0x00, 0x41, 0x00, 0x06, // .D...........A..
+	0x00, 0x8d, 0x00, 0x00, 0x00, 0x98, 0x01, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, // .........}...=..
+	0x00, 0x9e, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0x99, 0x01, 0x00, // .....=..........
+	0x00, 0x98, 0x01, 0x00, 0x00, 0x6e, 0x00, 0x04, 0x00, 0x18, 0x00, 0x00, 0x00, 0x9a, 0x01, 0x00, // .....n..........
+	0x00, 0x99, 0x01, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00, 0x8d, 0x00, 0x00, 0x00, 0x9b, 0x01, 0x00, // .....A..........
+	0x00, 0x7d, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, // .}...=.......=..
+	0x00, 0x07, 0x00, 0x00, 0x00, 0x9c, 0x01, 0x00, 0x00, 0x9b, 0x01, 0x00, 0x00, 0x88, 0x00, 0x05, // ................
+	0x00, 0x07, 0x00, 0x00, 0x00, 0x9d, 0x01, 0x00, 0x00, 0xbc, 0x00, 0x00, 0x00, 0x9c, 0x01, 0x00, // ................
+	0x00, 0xf9, 0x00, 0x02, 0x00, 0x9e, 0x01, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x9e, 0x01, 0x00, // ................
+	0x00, 0xf5, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x3c, 0x02, 0x00, 0x00, 0xad, 0x00, 0x00, // .........<......
+	0x00, 0x88, 0x01, 0x00, 0x00, 0x3b, 0x02, 0x00, 0x00, 0xb1, 0x01, 0x00, 0x00, 0xf5, 0x00, 0x07, // .....;..........
+	0x00, 0x18, 0x00, 0x00, 0x00, 0x39, 0x02, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0x88, 0x01, 0x00, // .....9...A......
+	0x00, 0xed, 0x01, 0x00, 0x00, 0xb1, 0x01, 0x00, 0x00, 0xb1, 0x00, 0x05, 0x00, 0x90, 0x00, 0x00, // ................
+	0x00, 0xa3, 0x01, 0x00, 0x00, 0x39, 0x02, 0x00, 0x00, 0xc7, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x04, // .....9..........
+	0x00, 0x9f, 0x01, 0x00, 0x00, 0xb1, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, // ................
+	0x00, 0xa3, 0x01, 0x00, 0x00, 0xa4, 0x01, 0x00, 0x00, 0x9f, 0x01, 0x00, 0x00, 0xf8, 0x00, 0x02, // ................
+	0x00, 0xa4, 0x01, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x18, 0x00, 0x00, 0x00, 0xa7, 0x01, 0x00, // ................
+	0x00, 0xca, 0x00, 0x00, 0x00, 0x9a, 0x01, 0x00, 0x00, 0xaf, 0x00, 0x05, 0x00, 0x90, 0x00, 0x00, // ................
+	0x00, 0xa8, 0x01, 0x00, 0x00, 0x39, 0x02, 0x00, 0x00, 0xa7, 0x01, 0x00, 0x00, 0xf7, 0x00, 0x03, // .....9..........
+	0x00, 0xa9, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0xa8, 0x01, 0x00, // ................
+	0x00, 0xaa, 0x01, 0x00, 0x00, 0xa9, 0x01, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xaa, 0x01, 0x00, // ................
+	0x00, 0xf9, 0x00, 0x02, 0x00, 0x9f, 0x01, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xa9, 0x01, 0x00, // ................
+	0x00, 0x6f, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0xac, 0x01, 0x00, 0x00, 0x39, 0x02, 0x00, // .o...........9..
+	0x00, 0x81, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0xad, 0x01, 0x00, 0x00, 0xac, 0x01, 0x00, // ................
+	0x00, 0x5a, 0x00, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0xaf, 0x01, 0x00, // .Z..............
+	0x00, 0xad, 0x01, 0x00, 0x00, 0x9d, 0x01, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0xb0, 0x01, 0x00, // ................
+	0x00, 0xf8, 0x00, 0x02, 0x00, 0xb0, 0x01, 0x00, 0x00, 0xf5, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x00, // ................
+	0x00, 0x3b, 0x02, 0x00, 0x00, 0x3c, 0x02, 0x00, 0x00, 0xa9, 0x01, 0x00, 0x00, 0xe9, 0x01, 0x00, // .;...<..........
+	0x00, 0xba, 0x01, 0x00, 0x00, 0xf5, 0x00, 0x07, 0x00, 0x18, 0x00, 0x00, 0x00, 0x3a, 0x02, 0x00, // .............:..
+	0x00, 0x41, 0x00, 0x00, 0x00, 0xa9, 0x01, 0x00, 0x00, 0xeb, 0x01, 0x00, 0x00, 0xba, 0x01, 0x00, // .A..............
+	0x00, 0xb1, 0x00, 0x05, 0x00, 0x90, 0x00, 0x00, 0x00, 0xb5, 0x01, 0x00, 0x00, 0x3a, 0x02, 0x00, // .............:..
+	0x00, 0xde, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x04, 0x00, 0xb1, 0x01, 0x00, 0x00, 0xba, 0x01, 0x00, // ................
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0xb5, 0x01, 0x00, 0x00, 0xb6, 0x01, 0x00, // ................
+	0x00, 0xb1, 0x01, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xb6, 0x01, 0x00, 0x00, 0xaf, 0x00, 0x05, // ................
+	0x00, 0x90, 0x00, 0x00, 0x00, 0xb9, 0x01, 0x00, 0x00, 0x3a, 0x02, 0x00, 0x00, 0x9a, 0x01, 0x00, // .........:......
+	0x00, 0xf7, 0x00, 0x03, 0x00, 0xba, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, // ................
+	0x00, 0xb9, 0x01, 0x00, 0x00, 0xbb, 0x01, 0x00, 0x00, 0xba, 0x01, 0x00, 0x00, 0xf8, 0x00, 0x02, // ................
+	0x00, 0xbb, 0x01, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0xb1, 0x01, 0x00, 0x00, 0xf8, 0x00, 0x02, // ................
+	0x00, 0xba, 0x01, 0x00, 0x00, 0x6f, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0xbd, 0x01, 0x00, // .....o..........
+	0x00, 0x3a, 0x02, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0xbe, 0x01, 0x00, // .:..............
+	0x00, 0xbd, 0x01, 0x00, 0x00, 0x5a, 0x00, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, // .....Z..........
+	0x00, 0xc0, 0x01, 0x00, 0x00, 0xbe, 0x01, 0x00, 0x00, 0x9d, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x06, // ................
+	0x00, 0x07, 0x00, 0x00, 0x00, 0xc2, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, // ................
+	0x00, 0xc0, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x07, 0x00, 0x00, 0x00, 0xc4, 0x01, 0x00, // ................
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xaf, 0x01, 0x00, 0x00, 0x85, 0x00, 0x05, // ................
+	0x00, 0x07, 0x00, 0x00, 0x00, 0xc5, 0x01, 0x00, 0x00, 0xc2, 0x01, 0x00, 0x00, 0xc4, 0x01, 0x00, // ................
+	0x00, 0x0c, 0x00, 0x06, 0x00, 0x07, 0x00, 0x00, 0x00, 0xc7, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, // ................
+	0x00, 0x0d, 0x00, 0x00, 0x00, 0xc0, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x07, 0x00, 0x00, // ................
+	0x00, 0xc9, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0xaf, 0x01, 0x00, // ................
+	0x00, 0x85, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0xca, 0x01, 0x00, 0x00, 0xc7, 0x01, 0x00, // ................
+	0x00, 0xc9, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x07, 0x00, 0x00, 0x00, 0xcc, 0x01, 0x00, // ................
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xc0, 0x01, 0x00, 0x00, 0x8e, 0x00, 0x05, // ................
+	0x00, 0x0b, 0x00, 0x00, 0x00, 0xd1, 0x01, 0x00, 0x00, 0x94, 0x01, 0x00, 0x00, 0xc5, 0x01, 0x00, // ................
+	0x00, 0x8e, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x00, 0xd5, 0x01, 0x00, 0x00, 0x97, 0x01, 0x00, // ................
+	0x00, 0xca, 0x01, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x00, 0xd6, 0x01, 0x00, // ................
+	0x00, 0xd1, 0x01, 0x00, 0x00, 0xd5, 0x01, 0x00, 0x00, 0x8e, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x00, // ................
+	0x00, 0xda, 0x01, 0x00, 0x00, 0x1a, 0x02, 0x00, 0x00, 0xcc, 0x01, 0x00, 0x00, 0x81, 0x00, 0x05, // ................
+	0x00, 0x0b, 0x00, 0x00, 0x00, 0xdb, 0x01, 0x00, 0x00, 0xd6, 0x01, 0x00, 0x00, 0xda, 0x01, 0x00, // ................
+	0x00, 0x41, 0x00, 0x06, 0x00, 0x8d, 0x00, 0x00, 0x00, 0xde, 0x01, 0x00, 0x00, 0x7d, 0x00, 0x00, // .A...........}..
+	0x00, 0x3d, 0x00, 0x00, 0x00, 0x92, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, // .=.......=......
+	0x00, 0xdf, 0x01, 0x00, 0x00, 0xde, 0x01, 0x00, 0x00, 0x56, 0x00, 0x05, 0x00, 0x45, 0x00, 0x00, // .........V...E..
+	0x00, 0x20, 0x02, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x58, 0x00, 0x07, // . ...5...2...X..
+	0x00, 0x0e, 0x00, 0x00, 0x00, 0x23, 0x02, 0x00, 0x00, 0x20, 0x02, 0x00, 0x00, 0xdb, 0x01, 0x00, // .....#... ......
+	0x00, 0x02, 0x00, 0x00, 0x00, 0xdf, 0x01, 0x00, 0x00, 0x4f, 0x00, 0x08, 0x00, 0x0b, 0x00, 0x00, // .........O......
+	0x00, 0xe1, 0x01, 0x00, 0x00, 0x23, 0x02, 0x00, 0x00, 0x23, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, // .....#...#......
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x07, 0x00, 0x00, // ................
+	0x00, 0xe3, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xc0, 0x01, 0x00, // ................
+	0x00, 0x8e, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x00, 0xe4, 0x01, 0x00, 0x00, 0xe1, 0x01, 0x00, // ................
+	0x00, 0xe3, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x07, 0x00, 0x00, 0x00, 0xe6, 0x01, 0x00, // ................
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0xc0, 0x01, 0x00, 0x00, 0x8e, 0x00, 0x05, // ................
+	0x00, 0x0b, 0x00, 0x00, 0x00, 0xe7, 0x01, 0x00, 0x00, 0xe4, 0x01, 0x00, 0x00, 0xe6, 0x01, 0x00, // ................
+	0x00, 0x81, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x00, 0xe9, 0x01, 0x00, 0x00, 0x3b, 0x02, 0x00, // .............;..
+	0x00, 0xe7, 0x01, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x18, 0x00, 0x00, 0x00, 0xeb, 0x01, 0x00, // ................
+	0x00, 0x3a, 0x02, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0xb0, 0x01, 0x00, // .:...=..........
+	0x00, 0xf8, 0x00, 0x02, 0x00, 0xb1, 0x01, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x18, 0x00, 0x00, // ................
+	0x00, 0xed, 0x01, 0x00, 0x00, 0x39, 0x02, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, // .....9...=......
+	0x00, 0x9e, 0x01, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x9f, 0x01, 0x00, 0x00, 0x41, 0x00, 0x06, // .............A..
+	0x00, 0x8d, 0x00, 0x00, 0x00, 0xee, 0x01, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, // .........}...=..
+	0x00, 0x9e, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0xef, 0x01, 0x00, // .....=..........
+	0x00, 0xee, 0x01, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0xf0, 0x01, 0x00, // ................
+	0x00, 0x1f, 0x01, 0x00, 0x00, 0xef, 0x01, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00, 0x8d, 0x00, 0x00, // .........A......
+	0x00, 0xf1, 0x01, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, // .....}...=......
+	0x00, 0x3d, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0xf2, 0x01, 0x00, 0x00, 0xf1, 0x01, 0x00, // .=..............
+	0x00, 0x85, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0xf3, 0x01, 0x00, 0x00, 0xf0, 0x01, 0x00, // ................
+	0x00, 0xf2, 0x01, 0x00, 0x00, 0x8e, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x00, 0xf5, 0x01, 0x00, // ................
+	0x00, 0x3c, 0x02, 0x00, 0x00, 0x26, 0x01, 0x00, 0x00, 0x50, 0x00, 0x06, 0x00, 0x0b, 0x00, 0x00, // .<...&...P......
+	0x00, 0xf7, 0x01, 0x00, 0x00, 0xf3, 0x01, 0x00, 0x00, 0xf3, 0x01, 0x00, 0x00, 0xf3, 0x01, 0x00, // ................
+	0x00, 0x88, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x00, 0xf8, 0x01, 0x00, 0x00, 0xf5, 0x01, 0x00, // ................
+	0x00, 0xf7, 0x01, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0xf9, 0x01, 0x00, // .....Q..........
+	0x00, 0xf8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, // .........Q......
+	0x00, 0xfa, 0x01, 0x00, 0x00, 0xf8, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, // .............Q..
+	0x00, 0x07, 0x00, 0x00, 0x00, 0xfb, 0x01, 0x00, 0x00, 0xf8, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, // ................
+	0x00, 0x50, 0x00, 0x07, 0x00, 0x0e, 0x00, 0x00, 0x00, 0xfc, 0x01, 0x00, 0x00, 0xf9, 0x01, 0x00, // .P..............
+	0x00, 0xfa, 0x01, 0x00, 0x00, 0xfb, 0x01, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x63, 0x00, 0x04, // .........b...c..
+	0x00, 0x3b, 0x00, 0x00, 0x00, 0x7a, 0x01, 0x00, 0x00, 0xfc, 0x01, 0x00, 0x00, 0xf9, 0x00, 0x02, // .;...z..........
+	0x00, 0x6f, 0x01, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x70, 0x01, 0x00, 0x00, 0xf9, 0x00, 0x02, // .o.......p......
+	0x00, 0x6e, 0x01, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x6f, 0x01, 0x00, 0x00, 0xfd, 0x00, 0x01, // .n.......o......
+	0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x00, 0xa0, 0x01,                                           // .8.......
+};
+
+static const uint8_t irradiance_shader_compute_mtl[2362] =
+{
+	0x43, 0x53, 0x48, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x06, 0x75, // CSH............u
+	0x5f, 0x74, 0x69, 0x6c, 0x65, 0x02, 0x01, 0x90, 0x01, 0x01, 0x00, 0x0a, 0x75, 0x5f, 0x73, 0x65, // _tile.......u_se
+	0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x02, 0x01, 0x80, 0x01, 0x01, 0x00, 0x1a, 0x75, 0x5f, 0x69, // ttings.......u_i
+	0x6e, 0x76, 0x65, 0x72, 0x73, 0x65, 0x5f, 0x76, 0x69, 0x65, 0x77, 0x5f, 0x70, 0x72, 0x6f, 0x6a, // nverse_view_proj
+	0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x04, 0x06, 0x00, 0x00, 0x18, 0x00, 0x09, 0x73, 0x5f, // ections.......s_
+	0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, // texture.........
+	0x00, 0x01, 0x00, 0xcf, 0x08, 0x00, 0x00, 0x23, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x20, // .......#include 
+	0x3c, 0x6d, 0x65, 0x74, 0x61, 0x6c, 0x5f, 0x73, 0x74, 0x64, 0x6c, 0x69, 0x62, 0x3e, 0x0a, 0x23, // <metal_stdlib>.#
+	0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x20, 0x3c, 0x73, 0x69, 0x6d, 0x64, 0x2f, 0x73, 0x69, // include <simd/si
+	0x6d, 0x64, 0x2e, 0x68, 0x3e, 0x0a, 0x0a, 0x75, 0x73, 0x69, 0x6e, 0x67, 0x20, 0x6e, 0x61, 0x6d, // md.h>..using nam
+	0x65, 0x73, 0x70, 0x61, 0x63, 0x65, 0x20, 0x6d, 0x65, 0x74, 0x61, 0x6c, 0x3b, 0x0a, 0x0a, 0x73, // espace metal;..s
+	0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x5f, 0x47, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x0a, 0x7b, 0x0a, // truct _Global.{.
+	0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x78, 0x34, 0x20, 0x75, 0x5f, 0x69, //     float4x4 u_i
+	0x6e, 0x76, 0x65, 0x72, 0x73, 0x65, 0x5f, 0x76, 0x69, 0x65, 0x77, 0x5f, 0x70, 0x72, 0x6f, 0x6a, // nverse_view_proj
+	0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x5b, 0x36, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, // ections[6];.    
+	0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x20, 0x75, 0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, // float4 u_setting
+	0x73, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x20, 0x75, 0x5f, // s;.    float4 u_
+	0x74, 0x69, 0x6c, 0x65, 0x3b, 0x0a, 0x7d, 0x3b, 0x0a, 0x0a, 0x6b, 0x65, 0x72, 0x6e, 0x65, 0x6c, // tile;.};..kernel
+	0x20, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x78, 0x6c, 0x61, 0x74, 0x4d, 0x74, 0x6c, 0x4d, 0x61, 0x69, //  void xlatMtlMai
+	0x6e, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x20, 0x5f, 0x47, 0x6c, 0x6f, 0x62, // n(constant _Glob
+	0x61, 0x6c, 0x26, 0x20, 0x5f, 0x6d, 0x74, 0x6c, 0x5f, 0x75, 0x20, 0x5b, 0x5b, 0x62, 0x75, 0x66, // al& _mtl_u [[buf
+	0x66, 0x65, 0x72, 0x28, 0x30, 0x29, 0x5d, 0x5d, 0x2c, 0x20, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, // fer(0)]], textur
+	0x65, 0x63, 0x75, 0x62, 0x65, 0x3c, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x3e, 0x20, 0x73, 0x5f, 0x74, // ecube<float> s_t
+	0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x20, 0x5b, 0x5b, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, // exture [[texture
+	0x28, 0x30, 0x29, 0x5d, 0x5d, 0x2c, 0x20, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x32, 0x64, // (0)]], texture2d
+	0x5f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x3c, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x2c, 0x20, 0x61, 0x63, // _array<float, ac
+	0x63, 0x65, 0x73, 0x73, 0x3a, 0x3a, 0x77, 0x72, 0x69, 0x74, 0x65, 0x3e, 0x20, 0x73, 0x5f, 0x6f, // cess::write> s_o
+	0x75, 0x74, 0x70, 0x75, 0x74, 0x54, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x20, 0x5b, 0x5b, 0x74, // utputTexture [[t
+	0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x28, 0x31, 0x29, 0x5d, 0x5d, 0x2c, 0x20, 0x73, 0x61, 0x6d, // exture(1)]], sam
+	0x70, 0x6c, 0x65, 0x72, 0x20, 0x73, 0x5f, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x53, 0x61, // pler s_textureSa
+	0x6d, 0x70, 0x6c, 0x65, 0x72, 0x20, 0x5b, 0x5b, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x72, 0x28, // mpler [[sampler(
+	0x30, 0x29, 0x5d, 0x5d, 0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x20, 0x67, 0x6c, 0x5f, 0x47, // 0)]], uint3 gl_G
+	0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x49, 0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x49, // lobalInvocationI
+	0x44, 0x20, 0x5b, 0x5b, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x5f, 0x70, 0x6f, 0x73, 0x69, 0x74, // D [[thread_posit
+	0x69, 0x6f, 0x6e, 0x5f, 0x69, 0x6e, 0x5f, 0x67, 0x72, 0x69, 0x64, 0x5d, 0x5d, 0x29, 0x0a, 0x7b, // ion_in_grid]]).{
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x3b, 0x3b, 0x29, 0x0a, 0x20, 0x20, // .    for (;;).  
+	0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x33, //   {.        int3
+	0x20, 0x5f, 0x33, 0x38, 0x32, 0x20, 0x3d, 0x20, 0x69, 0x6e, 0x74, 0x33, 0x28, 0x67, 0x6c, 0x5f, //  _382 = int3(gl_
+	0x47, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x49, 0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, // GlobalInvocation
+	0x49, 0x44, 0x29, 0x20, 0x2b, 0x20, 0x69, 0x6e, 0x74, 0x33, 0x28, 0x69, 0x6e, 0x74, 0x32, 0x28, // ID) + int3(int2(
+	0x5f, 0x6d, 0x74, 0x6c, 0x5f, 0x75, 0x2e, 0x75, 0x5f, 0x74, 0x69, 0x6c, 0x65, 0x2e, 0x78, 0x79, // _mtl_u.u_tile.xy
+	0x29, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, // ), 0);.        i
+	0x66, 0x20, 0x28, 0x28, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x28, 0x5f, 0x33, 0x38, 0x32, 0x2e, 0x78, // f ((float(_382.x
+	0x29, 0x20, 0x3e, 0x3d, 0x20, 0x5f, 0x6d, 0x74, 0x6c, 0x5f, 0x75, 0x2e, 0x75, 0x5f, 0x73, 0x65, // ) >= _mtl_u.u_se
+	0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x78, 0x29, 0x20, 0x7c, 0x7c, 0x20, 0x28, 0x66, 0x6c, // ttings.x) || (fl
+	0x6f, 0x61, 0x74, 0x28, 0x5f, 0x33, 0x38, 0x32, 0x2e, 0x79, 0x29, 0x20, 0x3e, 0x3d, 0x20, 0x5f, // oat(_382.y) >= _
+	0x6d, 0x74, 0x6c, 0x5f, 0x75, 0x2e, 0x75, 0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, // mtl_u.u_settings
+	0x2e, 0x78, 0x29, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, // .x)).        {. 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6b, //            break
+	0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, // ;.        }.    
+	0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x20, 0x5f, 0x35, 0x33, 0x39, 0x20, //     float4 _539 
+	0x3d, 0x20, 0x5f, 0x6d, 0x74, 0x6c, 0x5f, 0x75, 0x2e, 0x75, 0x5f, 0x69, 0x6e, 0x76, 0x65, 0x72, // = _mtl_u.u_inver
+	0x73, 0x65, 0x5f, 0x76, 0x69, 0x65, 0x77, 0x5f, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x69, // se_view_projecti
+	0x6f, 0x6e, 0x73, 0x5b, 0x5f, 0x33, 0x38, 0x32, 0x2e, 0x7a, 0x5d, 0x20, 0x2a, 0x20, 0x66, 0x6c, // ons[_382.z] * fl
+	0x6f, 0x61, 0x74, 0x34, 0x28, 0x28, 0x28, 0x28, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x32, 0x28, 0x5f, // oat4((((float2(_
+	0x33, 0x38, 0x32, 0x2e, 0x78, 0x79, 0x29, 0x20, 0x2b, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x32, // 382.xy) + float2
+	0x28, 0x30, 0x2e, 0x35, 0x29, 0x29, 0x20, 0x2f, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x32, 0x28, // (0.5)) / float2(
+	0x5f, 0x6d, 0x74, 0x6c, 0x5f, 0x75, 0x2e, 0x75, 0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, // _mtl_u.u_setting
+	0x73, 0x2e, 0x78, 0x29, 0x29, 0x20, 0x2a, 0x20, 0x32, 0x2e, 0x30, 0x29, 0x20, 0x2d, 0x20, 0x66, // s.x)) * 2.0) - f
+	0x6c, 0x6f, 0x61, 0x74, 0x32, 0x28, 0x31, 0x2e, 0x30, 0x29, 0x2c, 0x20, 0x31, 0x2e, 0x30, 0x2c, // loat2(1.0), 1.0,
+	0x20, 0x31, 0x2e, 0x30, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, //  1.0);.        f
+	0x6c, 0x6f, 0x61, 0x74, 0x33, 0x20, 0x5f, 0x35, 0x34, 0x36, 0x20, 0x3d, 0x20, 0x6e, 0x6f, 0x72, // loat3 _546 = nor
+	0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x28, 0x5f, 0x35, 0x33, 0x39, 0x2e, 0x78, 0x79, 0x7a, 0x20, // malize(_539.xyz 
+	0x2f, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x28, 0x5f, 0x35, 0x33, 0x39, 0x2e, 0x77, 0x29, // / float3(_539.w)
+	0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, // );.        float
+	0x33, 0x20, 0x5f, 0x34, 0x30, 0x38, 0x20, 0x3d, 0x20, 0x63, 0x72, 0x6f, 0x73, 0x73, 0x28, 0x66, // 3 _408 = cross(f
+	0x6c, 0x6f, 0x61, 0x74, 0x33, 0x28, 0x30, 0x2e, 0x30, 0x2c, 0x20, 0x31, 0x2e, 0x30, 0x2c, 0x20, // loat3(0.0, 1.0, 
+	0x30, 0x2e, 0x30, 0x29, 0x2c, 0x20, 0x5f, 0x35, 0x34, 0x36, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, // 0.0), _546);.   
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x34, 0x31, 0x34, 0x20, 0x3d, 0x20, //      int _414 = 
+	0x69, 0x6e, 0x74, 0x28, 0x5f, 0x6d, 0x74, 0x6c, 0x5f, 0x75, 0x2e, 0x75, 0x5f, 0x73, 0x65, 0x74, // int(_mtl_u.u_set
+	0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x7a, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // tings.z);.      
+	0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x5f, 0x34, 0x31, 0x37, 0x20, 0x3d, 0x20, 0x31, //   float _417 = 1
+	0x2e, 0x35, 0x37, 0x30, 0x37, 0x39, 0x36, 0x33, 0x37, 0x30, 0x35, 0x30, 0x36, 0x32, 0x38, 0x36, // .570796370506286
+	0x36, 0x32, 0x31, 0x30, 0x39, 0x33, 0x37, 0x35, 0x20, 0x2f, 0x20, 0x5f, 0x6d, 0x74, 0x6c, 0x5f, // 62109375 / _mtl_
+	0x75, 0x2e, 0x75, 0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x7a, 0x3b, 0x0a, // u.u_settings.z;.
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x20, 0x5f, //         float3 _
+	0x35, 0x38, 0x33, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x35, 0x38, // 583;.        _58
+	0x33, 0x20, 0x3d, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x28, 0x30, 0x2e, 0x30, 0x29, 0x3b, // 3 = float3(0.0);
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x20, // .        float3 
+	0x5f, 0x35, 0x38, 0x32, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, // _582;.        fo
+	0x72, 0x20, 0x28, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x35, 0x38, 0x30, 0x20, 0x3d, 0x20, 0x30, 0x3b, // r (int _580 = 0;
+	0x20, 0x5f, 0x35, 0x38, 0x30, 0x20, 0x3c, 0x20, 0x31, 0x32, 0x38, 0x3b, 0x20, 0x5f, 0x35, 0x38, //  _580 < 128; _58
+	0x33, 0x20, 0x3d, 0x20, 0x5f, 0x35, 0x38, 0x32, 0x2c, 0x20, 0x5f, 0x35, 0x38, 0x30, 0x2b, 0x2b, // 3 = _582, _580++
+	0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, // ).        {.    
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x5f, 0x35, 0x38, 0x30, //         if (_580
+	0x20, 0x3e, 0x3d, 0x20, 0x28, 0x34, 0x20, 0x2a, 0x20, 0x5f, 0x34, 0x31, 0x34, 0x29, 0x29, 0x0a, //  >= (4 * _414)).
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, //             {.  
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, //               br
+	0x65, 0x61, 0x6b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // eak;.           
+	0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, //  }.            f
+	0x6c, 0x6f, 0x61, 0x74, 0x20, 0x5f, 0x34, 0x33, 0x35, 0x20, 0x3d, 0x20, 0x28, 0x66, 0x6c, 0x6f, // loat _435 = (flo
+	0x61, 0x74, 0x28, 0x5f, 0x35, 0x38, 0x30, 0x29, 0x20, 0x2b, 0x20, 0x30, 0x2e, 0x35, 0x29, 0x20, // at(_580) + 0.5) 
+	0x2a, 0x20, 0x5f, 0x34, 0x31, 0x37, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // * _417;.        
+	0x20, 0x20, 0x20, 0x20, 0x5f, 0x35, 0x38, 0x32, 0x20, 0x3d, 0x20, 0x5f, 0x35, 0x38, 0x33, 0x3b, //     _582 = _583;
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, // .            flo
+	0x61, 0x74, 0x20, 0x5f, 0x34, 0x35, 0x32, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // at _452;.       
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x20, 0x5f, 0x34, 0x37, 0x39, //      float3 _479
+	0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, // ;.            fl
+	0x6f, 0x61, 0x74, 0x33, 0x20, 0x5f, 0x35, 0x37, 0x37, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, // oat3 _577;.     
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x69, 0x6e, 0x74, 0x20, //        for (int 
+	0x5f, 0x35, 0x38, 0x31, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x20, 0x5f, 0x35, 0x38, 0x31, 0x20, 0x3c, // _581 = 0; _581 <
+	0x20, 0x33, 0x32, 0x3b, 0x20, 0x5f, 0x34, 0x35, 0x32, 0x20, 0x3d, 0x20, 0x28, 0x66, 0x6c, 0x6f, //  32; _452 = (flo
+	0x61, 0x74, 0x28, 0x5f, 0x35, 0x38, 0x31, 0x29, 0x20, 0x2b, 0x20, 0x30, 0x2e, 0x35, 0x29, 0x20, // at(_581) + 0.5) 
+	0x2a, 0x20, 0x5f, 0x34, 0x31, 0x37, 0x2c, 0x20, 0x5f, 0x34, 0x37, 0x39, 0x20, 0x3d, 0x20, 0x28, // * _417, _479 = (
+	0x28, 0x5f, 0x34, 0x30, 0x38, 0x20, 0x2a, 0x20, 0x28, 0x73, 0x69, 0x6e, 0x28, 0x5f, 0x34, 0x35, // (_408 * (sin(_45
+	0x32, 0x29, 0x20, 0x2a, 0x20, 0x63, 0x6f, 0x73, 0x28, 0x5f, 0x34, 0x33, 0x35, 0x29, 0x29, 0x29, // 2) * cos(_435)))
+	0x20, 0x2b, 0x20, 0x28, 0x63, 0x72, 0x6f, 0x73, 0x73, 0x28, 0x5f, 0x35, 0x34, 0x36, 0x2c, 0x20, //  + (cross(_546, 
+	0x5f, 0x34, 0x30, 0x38, 0x29, 0x20, 0x2a, 0x20, 0x28, 0x73, 0x69, 0x6e, 0x28, 0x5f, 0x34, 0x35, // _408) * (sin(_45
+	0x32, 0x29, 0x20, 0x2a, 0x20, 0x73, 0x69, 0x6e, 0x28, 0x5f, 0x34, 0x33, 0x35, 0x29, 0x29, 0x29, // 2) * sin(_435)))
+	0x29, 0x20, 0x2b, 0x20, 0x28, 0x5f, 0x35, 0x34, 0x36, 0x20, 0x2a, 0x20, 0x63, 0x6f, 0x73, 0x28, // ) + (_546 * cos(
+	0x5f, 0x34, 0x35, 0x32, 0x29, 0x29, 0x2c, 0x20, 0x5f, 0x35, 0x37, 0x37, 0x20, 0x3d, 0x20, 0x5f, // _452)), _577 = _
+	0x34, 0x37, 0x39, 0x2c, 0x20, 0x5f, 0x35, 0x37, 0x37, 0x2e, 0x79, 0x20, 0x3d, 0x20, 0x2d, 0x5f, // 479, _577.y = -_
+	0x34, 0x37, 0x39, 0x2e, 0x79, 0x2c, 0x20, 0x5f, 0x35, 0x38, 0x32, 0x20, 0x2b, 0x3d, 0x20, 0x28, // 479.y, _582 += (
+	0x28, 0x73, 0x5f, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x2e, 0x73, 0x61, 0x6d, 0x70, 0x6c, // (s_texture.sampl
+	0x65, 0x28, 0x73, 0x5f, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x53, 0x61, 0x6d, 0x70, 0x6c, // e(s_textureSampl
+	0x65, 0x72, 0x2c, 0x20, 0x5f, 0x35, 0x37, 0x37, 0x2c, 0x20, 0x6c, 0x65, 0x76, 0x65, 0x6c, 0x28, // er, _577, level(
+	0x5f, 0x6d, 0x74, 0x6c, 0x5f, 0x75, 0x2e, 0x75, 0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, // _mtl_u.u_setting
+	0x73, 0x2e, 0x79, 0x29, 0x29, 0x2e, 0x78, 0x79, 0x7a, 0x20, 0x2a, 0x20, 0x63, 0x6f, 0x73, 0x28, // s.y)).xyz * cos(
+	0x5f, 0x34, 0x35, 0x32, 0x29, 0x29, 0x20, 0x2a, 0x20, 0x73, 0x69, 0x6e, 0x28, 0x5f, 0x34, 0x35, // _452)) * sin(_45
+	0x32, 0x29, 0x29, 0x2c, 0x20, 0x5f, 0x35, 0x38, 0x31, 0x2b, 0x2b, 0x29, 0x0a, 0x20, 0x20, 0x20, // 2)), _581++).   
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, //          {.     
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x5f, //            if (_
+	0x35, 0x38, 0x31, 0x20, 0x3e, 0x3d, 0x20, 0x5f, 0x34, 0x31, 0x34, 0x29, 0x0a, 0x20, 0x20, 0x20, // 581 >= _414).   
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, //              {. 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //                 
+	0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //    break;.      
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, //           }.    
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6c, 0x73, 0x65, //             else
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // .               
+	0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //  {.             
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x69, 0x6e, 0x75, 0x65, 0x3b, //        continue;
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // .               
+	0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //  }.             
+	0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x69, 0x6e, 0x75, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, //    continue;.   
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, //          }.     
+	0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x5f, 0x6f, //    }.        s_o
+	0x75, 0x74, 0x70, 0x75, 0x74, 0x54, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x2e, 0x77, 0x72, 0x69, // utputTexture.wri
+	0x74, 0x65, 0x28, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x28, 0x28, 0x5f, 0x35, 0x38, 0x33, 0x20, // te(float4((_583 
+	0x2a, 0x20, 0x33, 0x2e, 0x31, 0x34, 0x31, 0x35, 0x39, 0x32, 0x37, 0x34, 0x31, 0x30, 0x31, 0x32, // * 3.141592741012
+	0x35, 0x37, 0x33, 0x32, 0x34, 0x32, 0x31, 0x38, 0x37, 0x35, 0x29, 0x20, 0x2f, 0x20, 0x66, 0x6c, // 5732421875) / fl
+	0x6f, 0x61, 0x74, 0x33, 0x28, 0x28, 0x34, 0x2e, 0x30, 0x20, 0x2a, 0x20, 0x5f, 0x6d, 0x74, 0x6c, // oat3((4.0 * _mtl
+	0x5f, 0x75, 0x2e, 0x75, 0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x7a, 0x29, // _u.u_settings.z)
+	0x20, 0x2a, 0x20, 0x5f, 0x6d, 0x74, 0x6c, 0x5f, 0x75, 0x2e, 0x75, 0x5f, 0x73, 0x65, 0x74, 0x74, //  * _mtl_u.u_sett
+	0x69, 0x6e, 0x67, 0x73, 0x2e, 0x7a, 0x29, 0x2c, 0x20, 0x31, 0x2e, 0x30, 0x29, 0x2c, 0x20, 0x75, // ings.z), 1.0), u
+	0x69, 0x6e, 0x74, 0x32, 0x28, 0x5f, 0x33, 0x38, 0x32, 0x2e, 0x78, 0x79, 0x29, 0x2c, 0x20, 0x75, // int2(_382.xy), u
+	0x69, 0x6e, 0x74, 0x28, 0x5f, 0x33, 0x38, 0x32, 0x2e, 0x7a, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, // int(_382.z));.  
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6b, 0x3b, 0x0a, 0x20, 0x20, 0x20, //       break;.   
+	0x20, 0x7d, 0x0a, 0x7d, 0x0a, 0x0a, 0x00, 0x00, 0xa0, 0x01,                                     //  }.}......
+};
@@ -0,0 +1,61 @@
+#include <bgfx_compute.sh>
+#include <cube_map_compute.sh>
+
+#define PI 3.14159265359
+#define MAX_STEP_COUNT 32
+
+SAMPLERCUBE(s_texture, 0);
+IMAGE2D_ARRAY_WR(s_output, rgba16f, 1);
+
+uniform mat4 u_inverse_view_projections[6];
+uniform vec4 u_settings;
+uniform vec4 u_tile;
+
+#define u_side_resolution u_settings.x
+#define u_mip_level u_settings.y
+#define u_step_count u_settings.z
+
+// Heavy convolutions are dispatched a tile at a time, XY is the first texel of the tile.
+#define u_tile_offset u_tile.xy
+
+// Writes all six faces of the irradiance map, face index is the Z component of the invocation.
+NUM_THREADS(8, 8, 1)
+void main() {
+    ivec3 texel = ivec3(gl_GlobalInvocationID) + ivec3(u_tile_offset, 0.0);
+    if (float(texel.x) >= u_side_resolution || float(texel.y) >= u_side_resolution) {
+        return;
+    }
+
+    vec3 normal = cube_map_direction(texel, u_side_resolution, u_inverse_view_projections[texel.z]);
+    vec3 irradiance = vec3(0.0, 0.0, 0.0);
+
+    vec3 up = vec3(0.0, 1.0, 0.0);
+    vec3 right = cross(up, normal);
+    up = cross(normal, right);
+
+    // Explicit mip level is `u_step_count` texels wide, at most `MAX_STEP_COUNT`. Theta takes a step per texel of it
+    // and phi four times as many, so the hemisphere is sampled about once per texel rather than tens of thousands
+    // of times from a large level, which thrashes the texture cache for a very low frequency signal.
+    int step_count = int(u_step_count);
+    float step_angle = 0.5 * PI / u_step_count;
+    for (int i = 0; i < 4 * MAX_STEP_COUNT; i++) {
+        if (i >= 4 * step_count) {
+            break;
+        }
+        float phi = (float(i) + 0.5) * step_angle;
+        for (int j = 0; j < MAX_STEP_COUNT; j++) {
+            if (j >= step_count) {
+                break;
+            }
+            float theta = (float(j) + 0.5) * step_angle;
+            vec3 tangent_sample = vec3(sin(theta) * cos(phi), sin(theta) * sin(phi), cos(theta));
+            vec3 sample_dir = tangent_sample.x * right + tangent_sample.y * up + tangent_sample.z * normal;
+            #if (BGFX_SHADER_LANGUAGE_HLSL || BGFX_SHADER_LANGUAGE_PSSL || BGFX_SHADER_LANGUAGE_METAL)
+            sample_dir.y = -sample_dir.y;
+            #endif
+            irradiance += textureCubeLod(s_texture, sample_dir, u_mip_level).xyz * cos(theta) * sin(theta);
+        }
+    }
+    float nr_samples = 4.0 * u_step_count * u_step_count;
+    imageStore(s_output, texel, vec4(PI * irradiance / nr_samples, 1.0));
+}
@@ -0,0 +1,412 @@
+#include <cstdint>
+
+static const uint8_t irradiance_shader_fragment_glsl[1849] =
+{
+	0x46, 0x53, 0x48, 0x06, 0x70, 0x94, 0x72, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x09, 0x73, // FSH.p.r........s
+	0x5f, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x0a, 0x75, // _texture.......u
+	0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x02, 0x01, 0x00, 0x00, 0x01, 0x00, 0x05, // _settings.......
+	0x07, 0x00, 0x00, 0x76, 0x61, 0x72, 0x79, 0x69, 0x6e, 0x67, 0x20, 0x68, 0x69, 0x67, 0x68, 0x70, // ...varying highp
+	0x20, 0x76, 0x65, 0x63, 0x33, 0x20, 0x76, 0x5f, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, //  vec3 v_position
+	0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x6c, 0x6f, 0x77, 0x70, 0x20, 0x73, // ;.uniform lowp s
+	0x61, 0x6d, 0x70, 0x6c, 0x65, 0x72, 0x43, 0x75, 0x62, 0x65, 0x20, 0x73, 0x5f, 0x74, 0x65, 0x78, // amplerCube s_tex
+	0x74, 0x75, 0x72, 0x65, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x68, 0x69, // ture;.uniform hi
+	0x67, 0x68, 0x70, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x75, 0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, // ghp vec4 u_setti
+	0x6e, 0x67, 0x73, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x6d, 0x61, 0x69, 0x6e, 0x20, 0x28, // ngs;.void main (
+	0x29, 0x0a, 0x7b, 0x0a, 0x20, 0x20, 0x68, 0x69, 0x67, 0x68, 0x70, 0x20, 0x69, 0x6e, 0x74, 0x20, // ).{.  highp int 
+	0x69, 0x5f, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x68, 0x69, 0x67, 0x68, 0x70, 0x20, 0x66, 0x6c, 0x6f, // i_1;.  highp flo
+	0x61, 0x74, 0x20, 0x73, 0x74, 0x65, 0x70, 0x5f, 0x61, 0x6e, 0x67, 0x6c, 0x65, 0x5f, 0x32, 0x3b, // at step_angle_2;
+	0x0a, 0x20, 0x20, 0x68, 0x69, 0x67, 0x68, 0x70, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x73, 0x74, 0x65, // .  highp int ste
+	0x70, 0x5f, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x5f, 0x33, 0x3b, 0x0a, 0x20, 0x20, 0x68, 0x69, 0x67, // p_count_3;.  hig
+	0x68, 0x70, 0x20, 0x76, 0x65, 0x63, 0x33, 0x20, 0x72, 0x69, 0x67, 0x68, 0x74, 0x5f, 0x34, 0x3b, // hp vec3 right_4;
+	0x0a, 0x20, 0x20, 0x68, 0x69, 0x67, 0x68, 0x70, 0x20, 0x76, 0x65, 0x63, 0x33, 0x20, 0x75, 0x70, // .  highp vec3 up
+	0x5f, 0x35, 0x3b, 0x0a, 0x20, 0x20, 0x6c, 0x6f, 0x77, 0x70, 0x20, 0x76, 0x65, 0x63, 0x33, 0x20, // _5;.  lowp vec3 
+	0x69, 0x72, 0x72, 0x61, 0x64, 0x69, 0x61, 0x6e, 0x63, 0x65, 0x5f, 0x36, 0x3b, 0x0a, 0x20, 0x20, // irradiance_6;.  
+	0x68, 0x69, 0x67, 0x68, 0x70, 0x20, 0x76, 0x65, 0x63, 0x33, 0x20, 0x6e, 0x6f, 0x72, 0x6d, 0x61, // highp vec3 norma
+	0x6c, 0x5f, 0x37, 0x3b, 0x0a, 0x20, 0x20, 0x68, 0x69, 0x67, 0x68, 0x70, 0x20, 0x76, 0x65, 0x63, // l_7;.  highp vec
+	0x33, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x38, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x6d, // 3 tmpvar_8;.  tm
+	0x70, 0x76, 0x61, 0x72, 0x5f, 0x38, 0x20, 0x3d, 0x20, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, // pvar_8 = normali
+	0x7a, 0x65, 0x28, 0x76, 0x5f, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x29, 0x3b, 0x0a, // ze(v_position);.
+	0x20, 0x20, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x5f, 0x37, 0x20, 0x3d, 0x20, 0x74, 0x6d, 0x70, //   normal_7 = tmp
+	0x76, 0x61, 0x72, 0x5f, 0x38, 0x3b, 0x0a, 0x20, 0x20, 0x69, 0x72, 0x72, 0x61, 0x64, 0x69, 0x61, // var_8;.  irradia
+	0x6e, 0x63, 0x65, 0x5f, 0x36, 0x20, 0x3d, 0x20, 0x76, 0x65, 0x63, 0x33, 0x28, 0x30, 0x2e, 0x30, // nce_6 = vec3(0.0
+	0x2c, 0x20, 0x30, 0x2e, 0x30, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x68, // , 0.0, 0.0);.  h
+	0x69, 0x67, 0x68, 0x70, 0x20, 0x76, 0x65, 0x63, 0x33, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, // ighp vec3 tmpvar
+	0x5f, 0x39, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x39, 0x20, 0x3d, // _9;.  tmpvar_9 =
+	0x20, 0x28, 0x28, 0x76, 0x65, 0x63, 0x33, 0x28, 0x31, 0x2e, 0x30, 0x2c, 0x20, 0x30, 0x2e, 0x30, //  ((vec3(1.0, 0.0
+	0x2c, 0x20, 0x30, 0x2e, 0x30, 0x29, 0x20, 0x2a, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, // , 0.0) * tmpvar_
+	0x38, 0x2e, 0x7a, 0x78, 0x79, 0x29, 0x20, 0x2d, 0x20, 0x28, 0x76, 0x65, 0x63, 0x33, 0x28, 0x30, // 8.zxy) - (vec3(0
+	0x2e, 0x30, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x2c, 0x20, 0x31, 0x2e, 0x30, 0x29, 0x20, 0x2a, 0x20, // .0, 0.0, 1.0) * 
+	0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x38, 0x2e, 0x79, 0x7a, 0x78, 0x29, 0x29, 0x3b, 0x0a, // tmpvar_8.yzx));.
+	0x20, 0x20, 0x72, 0x69, 0x67, 0x68, 0x74, 0x5f, 0x34, 0x20, 0x3d, 0x20, 0x74, 0x6d, 0x70, 0x76, //   right_4 = tmpv
+	0x61, 0x72, 0x5f, 0x39, 0x3b, 0x0a, 0x20, 0x20, 0x75, 0x70, 0x5f, 0x35, 0x20, 0x3d, 0x20, 0x28, // ar_9;.  up_5 = (
+	0x28, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x38, 0x2e, 0x79, 0x7a, 0x78, 0x20, 0x2a, 0x20, // (tmpvar_8.yzx * 
+	0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x39, 0x2e, 0x7a, 0x78, 0x79, 0x29, 0x20, 0x2d, 0x20, // tmpvar_9.zxy) - 
+	0x28, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x38, 0x2e, 0x7a, 0x78, 0x79, 0x20, 0x2a, 0x20, // (tmpvar_8.zxy * 
+	0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x39, 0x2e, 0x79, 0x7a, 0x78, 0x29, 0x29, 0x3b, 0x0a, // tmpvar_9.yzx));.
+	0x20, 0x20, 0x73, 0x74, 0x65, 0x70, 0x5f, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x5f, 0x33, 0x20, 0x3d, //   step_count_3 =
+	0x20, 0x69, 0x6e, 0x74, 0x28, 0x75, 0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, //  int(u_settings.
+	0x79, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x73, 0x74, 0x65, 0x70, 0x5f, 0x61, 0x6e, 0x67, 0x6c, 0x65, // y);.  step_angle
+	0x5f, 0x32, 0x20, 0x3d, 0x20, 0x28, 0x31, 0x2e, 0x35, 0x37, 0x30, 0x37, 0x39, 0x36, 0x20, 0x2f, // _2 = (1.570796 /
+	0x20, 0x75, 0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x79, 0x29, 0x3b, 0x0a, //  u_settings.y);.
+	0x20, 0x20, 0x69, 0x5f, 0x31, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x77, 0x68, 0x69, //   i_1 = 0;.  whi
+	0x6c, 0x65, 0x20, 0x28, 0x74, 0x72, 0x75, 0x65, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, // le (true) {.    
+	0x68, 0x69, 0x67, 0x68, 0x70, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x6a, 0x5f, 0x31, 0x30, 0x3b, 0x0a, // highp int j_10;.
+	0x20, 0x20, 0x20, 0x20, 0x68, 0x69, 0x67, 0x68, 0x70, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, //     highp float 
+	0x70, 0x68, 0x69, 0x5f, 0x31, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, // phi_11;.    if (
+	0x28, 0x69, 0x5f, 0x31, 0x20, 0x3e, 0x3d, 0x20, 0x31, 0x32, 0x38, 0x29, 0x29, 0x20, 0x7b, 0x0a, // (i_1 >= 128)) {.
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6b, 0x3b, 0x0a, 0x20, 0x20, 0x20, //       break;.   
+	0x20, 0x7d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x28, 0x69, 0x5f, 0x31, //  };.    if ((i_1
+	0x20, 0x3e, 0x3d, 0x20, 0x28, 0x34, 0x20, 0x2a, 0x20, 0x73, 0x74, 0x65, 0x70, 0x5f, 0x63, 0x6f, //  >= (4 * step_co
+	0x75, 0x6e, 0x74, 0x5f, 0x33, 0x29, 0x29, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, // unt_3))) {.     
+	0x20, 0x62, 0x72, 0x65, 0x61, 0x6b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x3b, 0x0a, 0x20, //  break;.    };. 
+	0x20, 0x20, 0x20, 0x70, 0x68, 0x69, 0x5f, 0x31, 0x31, 0x20, 0x3d, 0x20, 0x28, 0x28, 0x66, 0x6c, //    phi_11 = ((fl
+	0x6f, 0x61, 0x74, 0x28, 0x69, 0x5f, 0x31, 0x29, 0x20, 0x2b, 0x20, 0x30, 0x2e, 0x35, 0x29, 0x20, // oat(i_1) + 0.5) 
+	0x2a, 0x20, 0x73, 0x74, 0x65, 0x70, 0x5f, 0x61, 0x6e, 0x67, 0x6c, 0x65, 0x5f, 0x32, 0x29, 0x3b, // * step_angle_2);
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x6a, 0x5f, 0x31, 0x30, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x0a, 0x20, // .    j_10 = 0;. 
+	0x20, 0x20, 0x20, 0x77, 0x68, 0x69, 0x6c, 0x65, 0x20, 0x28, 0x74, 0x72, 0x75, 0x65, 0x29, 0x20, //    while (true) 
+	0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x28, 0x6a, 0x5f, 0x31, // {.      if ((j_1
+	0x30, 0x20, 0x3e, 0x3d, 0x20, 0x33, 0x32, 0x29, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, // 0 >= 32)) {.    
+	0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, //     break;.     
+	0x20, 0x7d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x28, 0x6a, //  };.      if ((j
+	0x5f, 0x31, 0x30, 0x20, 0x3e, 0x3d, 0x20, 0x73, 0x74, 0x65, 0x70, 0x5f, 0x63, 0x6f, 0x75, 0x6e, // _10 >= step_coun
+	0x74, 0x5f, 0x33, 0x29, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // t_3)) {.        
+	0x62, 0x72, 0x65, 0x61, 0x6b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x3b, 0x0a, // break;.      };.
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x68, 0x69, 0x67, 0x68, 0x70, 0x20, 0x66, 0x6c, 0x6f, 0x61, //       highp floa
+	0x74, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x32, 0x3b, 0x0a, 0x20, 0x20, 0x20, // t tmpvar_12;.   
+	0x20, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x32, 0x20, 0x3d, 0x20, 0x28, //    tmpvar_12 = (
+	0x28, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x28, 0x6a, 0x5f, 0x31, 0x30, 0x29, 0x20, 0x2b, 0x20, 0x30, // (float(j_10) + 0
+	0x2e, 0x35, 0x29, 0x20, 0x2a, 0x20, 0x73, 0x74, 0x65, 0x70, 0x5f, 0x61, 0x6e, 0x67, 0x6c, 0x65, // .5) * step_angle
+	0x5f, 0x32, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x68, 0x69, 0x67, 0x68, 0x70, // _2);.      highp
+	0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x33, //  float tmpvar_13
+	0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, // ;.      tmpvar_1
+	0x33, 0x20, 0x3d, 0x20, 0x63, 0x6f, 0x73, 0x28, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, // 3 = cos(tmpvar_1
+	0x32, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x68, 0x69, 0x67, 0x68, 0x70, 0x20, // 2);.      highp 
+	0x76, 0x65, 0x63, 0x33, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x34, 0x3b, 0x0a, // vec3 tmpvar_14;.
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x34, 0x2e, //       tmpvar_14.
+	0x78, 0x20, 0x3d, 0x20, 0x28, 0x73, 0x69, 0x6e, 0x28, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, // x = (sin(tmpvar_
+	0x31, 0x32, 0x29, 0x20, 0x2a, 0x20, 0x63, 0x6f, 0x73, 0x28, 0x70, 0x68, 0x69, 0x5f, 0x31, 0x31, // 12) * cos(phi_11
+	0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, // ));.      tmpvar
+	0x5f, 0x31, 0x34, 0x2e, 0x79, 0x20, 0x3d, 0x20, 0x28, 0x73, 0x69, 0x6e, 0x28, 0x74, 0x6d, 0x70, // _14.y = (sin(tmp
+	0x76, 0x61, 0x72, 0x5f, 0x31, 0x32, 0x29, 0x20, 0x2a, 0x20, 0x73, 0x69, 0x6e, 0x28, 0x70, 0x68, // var_12) * sin(ph
+	0x69, 0x5f, 0x31, 0x31, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6d, // i_11));.      tm
+	0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x34, 0x2e, 0x7a, 0x20, 0x3d, 0x20, 0x74, 0x6d, 0x70, 0x76, // pvar_14.z = tmpv
+	0x61, 0x72, 0x5f, 0x31, 0x33, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x72, 0x72, // ar_13;.      irr
+	0x61, 0x64, 0x69, 0x61, 0x6e, 0x63, 0x65, 0x5f, 0x36, 0x20, 0x3d, 0x20, 0x28, 0x69, 0x72, 0x72, // adiance_6 = (irr
+	0x61, 0x64, 0x69, 0x61, 0x6e, 0x63, 0x65, 0x5f, 0x36, 0x20, 0x2b, 0x20, 0x28, 0x28, 0x74, 0x65, // adiance_6 + ((te
+	0x78, 0x74, 0x75, 0x72, 0x65, 0x43, 0x75, 0x62, 0x65, 0x4c, 0x6f, 0x64, 0x20, 0x20, 0x20, 0x20, // xtureCubeLod    
+	0x28, 0x73, 0x5f, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x2c, 0x20, 0x0a, 0x20, 0x20, 0x20, // (s_texture, .   
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x28, 0x28, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, //      (((tmpvar_1
+	0x34, 0x2e, 0x78, 0x20, 0x2a, 0x20, 0x72, 0x69, 0x67, 0x68, 0x74, 0x5f, 0x34, 0x29, 0x20, 0x2b, // 4.x * right_4) +
+	0x20, 0x28, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x34, 0x2e, 0x79, 0x20, 0x2a, 0x20, //  (tmpvar_14.y * 
+	0x75, 0x70, 0x5f, 0x35, 0x29, 0x29, 0x20, 0x2b, 0x20, 0x28, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, // up_5)) + (tmpvar
+	0x5f, 0x31, 0x33, 0x20, 0x2a, 0x20, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x5f, 0x37, 0x29, 0x29, // _13 * normal_7))
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2c, 0x20, 0x75, 0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, // .      , u_setti
+	0x6e, 0x67, 0x73, 0x2e, 0x78, 0x29, 0x2e, 0x78, 0x79, 0x7a, 0x20, 0x2a, 0x20, 0x0a, 0x20, 0x20, // ngs.x).xyz * .  
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x73, 0x28, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, //       cos(tmpvar
+	0x5f, 0x31, 0x32, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x29, 0x20, 0x2a, 0x20, 0x73, // _12).      ) * s
+	0x69, 0x6e, 0x28, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x32, 0x29, 0x29, 0x29, 0x3b, // in(tmpvar_12)));
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6a, 0x5f, 0x31, 0x30, 0x2b, 0x2b, 0x3b, 0x0a, 0x20, // .      j_10++;. 
+	0x20, 0x20, 0x20, 0x7d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x5f, 0x31, 0x2b, 0x2b, 0x3b, //    };.    i_1++;
+	0x0a, 0x20, 0x20, 0x7d, 0x3b, 0x0a, 0x20, 0x20, 0x6c, 0x6f, 0x77, 0x70, 0x20, 0x76, 0x65, 0x63, // .  };.  lowp vec
+	0x34, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x35, 0x3b, 0x0a, 0x20, 0x20, 0x74, // 4 tmpvar_15;.  t
+	0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x35, 0x2e, 0x77, 0x20, 0x3d, 0x20, 0x31, 0x2e, 0x30, // mpvar_15.w = 1.0
+	0x3b, 0x0a, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x35, 0x2e, 0x78, 0x79, // ;.  tmpvar_15.xy
+	0x7a, 0x20, 0x3d, 0x20, 0x28, 0x28, 0x33, 0x2e, 0x31, 0x34, 0x31, 0x35, 0x39, 0x33, 0x20, 0x2a, // z = ((3.141593 *
+	0x20, 0x69, 0x72, 0x72, 0x61, 0x64, 0x69, 0x61, 0x6e, 0x63, 0x65, 0x5f, 0x36, 0x29, 0x20, 0x2f, //  irradiance_6) /
+	0x20, 0x28, 0x28, 0x34, 0x2e, 0x30, 0x20, 0x2a, 0x20, 0x75, 0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, //  ((4.0 * u_setti
+	0x6e, 0x67, 0x73, 0x2e, 0x79, 0x29, 0x20, 0x2a, 0x20, 0x75, 0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, // ngs.y) * u_setti
+	0x6e, 0x67, 0x73, 0x2e, 0x79, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x67, 0x6c, 0x5f, 0x46, 0x72, // ngs.y));.  gl_Fr
+	0x61, 0x67, 0x43, 0x6f, 0x6c, 0x6f, 0x72, 0x20, 0x3d, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, // agColor = tmpvar
+	0x5f, 0x31, 0x35, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a, 0x00,                                           // _15;.}...
+};
+
+static const uint8_t irradiance_shader_fragment_spv[2767] =
+{
+	0x46, 0x53, 0x48, 0x06, 0x70, 0x94, 0x72, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x0a, 0x75, // FSH.p.r........u
+	0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x12, 0x01, 0x00, 0x00, 0x01, 0x00, 0x09, // _settings.......
+	0x73, 0x5f, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, // s_texture.......
+	0x0a, 0x00, 0x00, 0x03, 0x02, 0x23, 0x07, 0x00, 0x00, 0x01, 0x00, 0x07, 0x00, 0x08, 0x00, 0x90, // .....#..........
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0b, // ................
+	0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00, 0x47, 0x4c, 0x53, 0x4c, 0x2e, 0x73, 0x74, 0x64, 0x2e, // .......GLSL.std.
+	0x34, 0x35, 0x30, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, // 450.............
+	0x00, 0x00, 0x00, 0x0f, 0x00, 0x07, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x6d, // ...............m
+	0x61, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x00, 0xe1, 0x00, 0x00, 0x00, 0x10, // ain.............
+	0x00, 0x03, 0x00, 0x04, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x05, // ................
+	0x00, 0x00, 0x00, 0xf4, 0x01, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x6d, // ...............m
+	0x61, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x07, 0x00, 0x22, 0x00, 0x00, 0x00, 0x73, // ain........"...s
+	0x5f, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x53, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x72, 0x00, // _textureSampler.
+	0x00, 0x00, 0x00, 0x05, 0x00, 0x07, 0x00, 0x25, 0x00, 0x00, 0x00, 0x73, 0x5f, 0x74, 0x65, 0x78, // .......%...s_tex
+	0x74, 0x75, 0x72, 0x65, 0x54, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x00, 0x00, 0x00, 0x00, 0x05, // tureTexture.....
+	0x00, 0x04, 0x00, 0x54, 0x00, 0x00, 0x00, 0x24, 0x47, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x00, 0x06, // ...T...$Global..
+	0x00, 0x06, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0x5f, 0x73, 0x65, 0x74, // ...T.......u_set
+	0x74, 0x69, 0x6e, 0x67, 0x73, 0x00, 0x00, 0x05, 0x00, 0x03, 0x00, 0x56, 0x00, 0x00, 0x00, 0x00, // tings......V....
+	0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00, 0xd8, 0x00, 0x00, 0x00, 0x76, 0x5f, 0x70, 0x6f, 0x73, // ...........v_pos
+	0x69, 0x74, 0x69, 0x6f, 0x6e, 0x00, 0x00, 0x05, 0x00, 0x06, 0x00, 0xe1, 0x00, 0x00, 0x00, 0x62, // ition..........b
+	0x67, 0x66, 0x78, 0x5f, 0x46, 0x72, 0x61, 0x67, 0x44, 0x61, 0x74, 0x61, 0x30, 0x00, 0x00, 0x47, // gfx_FragData0..G
+	0x00, 0x04, 0x00, 0x22, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, // ..."...".......G
+	0x00, 0x04, 0x00, 0x22, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, // ..."...!.......G
+	0x00, 0x04, 0x00, 0x25, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, // ...%...".......G
+	0x00, 0x04, 0x00, 0x25, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, // ...%...!.......H
+	0x00, 0x05, 0x00, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, // ...T.......#....
+	0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00, 0x54, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x47, // ...G...T.......G
+	0x00, 0x04, 0x00, 0x56, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, // ...V...".......G
+	0x00, 0x04, 0x00, 0x56, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, // ...V...!.......G
+	0x00, 0x04, 0x00, 0xd8, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, // ...............G
+	0x00, 0x04, 0x00, 0xe1, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, // ................
+	0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x21, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, // .......!........
+	0x00, 0x00, 0x00, 0x1a, 0x00, 0x02, 0x00, 0x06, 0x00, 0x00, 0x00, 0x16, 0x00, 0x03, 0x00, 0x07, // ................
+	0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x19, 0x00, 0x09, 0x00, 0x08, 0x00, 0x00, 0x00, 0x07, // ... ............
+	0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // ................
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00, 0x0b, // ................
+	0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00, 0x0e, // ................
+	0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x21, // ........... ...!
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x21, // ...........;...!
+	0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x24, // ..."....... ...$
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x24, // ...........;...$
+	0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x04, 0x00, 0x28, // ...%...........(
+	0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x28, // ... .......+...(
+	0x00, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x28, // ...).......+...(
+	0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x03, 0x00, 0x31, // ...-...........1
+	0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0x40, // .......+.......@
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x06, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x47, // .......,.......G
+	0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x2b, // ...@...@...@...+
+	0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x2c, // .......I......?,
+	0x00, 0x06, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x49, // .......J...@...I
+	0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x03, 0x00, 0x54, 0x00, 0x00, 0x00, 0x0e, // ...@.......T....
+	0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x55, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x54, // ... ...U.......T
+	0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x55, 0x00, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x02, // ...;...U...V....
+	0x00, 0x00, 0x00, 0x15, 0x00, 0x04, 0x00, 0x57, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, // .......W... ....
+	0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x57, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x01, // ...+...W...X....
+	0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x59, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x07, // ... ...Y........
+	0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0xdb, // ...+.......^....
+	0x0f, 0xc9, 0x3f, 0x2b, 0x00, 0x04, 0x00, 0x28, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x80, // ..?+...(...i....
+	0x00, 0x00, 0x00, 0x14, 0x00, 0x02, 0x00, 0x6a, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x28, // .......j...+...(
+	0x00, 0x00, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x07, // ...m.......+....
+	0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x2b, 0x00, 0x04, 0x00, 0x28, // ...w......?+...(
+	0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x57, // ....... ...+...W
+	0x00, 0x00, 0x00, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x07, // ...........+....
+	0x00, 0x00, 0x00, 0xc5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x40, 0x2b, 0x00, 0x04, 0x00, 0x07, // ..........@+....
+	0x00, 0x00, 0x00, 0xcc, 0x00, 0x00, 0x00, 0xdb, 0x0f, 0x49, 0x40, 0x20, 0x00, 0x04, 0x00, 0xd7, // .........I@ ....
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0xd7, // ...........;....
+	0x00, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0xe0, // ........... ....
+	0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0xe0, // ...........;....
+	0x00, 0x00, 0x00, 0xe1, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x36, 0x00, 0x05, 0x00, 0x02, // ...........6....
+	0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf8, // ................
+	0x00, 0x02, 0x00, 0x05, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x23, // .......=.......#
+	0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00, 0x26, // ..."...=.......&
+	0x00, 0x00, 0x00, 0x25, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x0b, 0x00, 0x00, 0x00, 0xd9, // ...%...=........
+	0x00, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x09, // ................
+	0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0xd9, 0x00, 0x00, 0x00, 0x0c, // .......E........
+	0x00, 0x07, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x0c, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x44, // ...............D
+	0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x09, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x07, 0x00, 0x0b, // ...J............
+	0x00, 0x00, 0x00, 0x0f, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x09, // ...........D....
+	0x01, 0x00, 0x00, 0x0c, 0x01, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00, 0x59, 0x00, 0x00, 0x00, 0x10, // .......A...Y....
+	0x01, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x3d, // ...V...-...X...=
+	0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0x11, 0x01, 0x00, 0x00, 0x10, 0x01, 0x00, 0x00, 0x6e, // ...............n
+	0x00, 0x04, 0x00, 0x28, 0x00, 0x00, 0x00, 0x12, 0x01, 0x00, 0x00, 0x11, 0x01, 0x00, 0x00, 0x41, // ...(...........A
+	0x00, 0x06, 0x00, 0x59, 0x00, 0x00, 0x00, 0x13, 0x01, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x2d, // ...Y.......V...-
+	0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0x14, // ...X...=........
+	0x01, 0x00, 0x00, 0x13, 0x01, 0x00, 0x00, 0x88, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0x15, // ................
+	0x01, 0x00, 0x00, 0x5e, 0x00, 0x00, 0x00, 0x14, 0x01, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x16, // ...^............
+	0x01, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x16, 0x01, 0x00, 0x00, 0xf5, 0x00, 0x07, 0x00, 0x0b, // ................
+	0x00, 0x00, 0x00, 0x8f, 0x01, 0x00, 0x00, 0x47, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x8e, // .......G........
+	0x01, 0x00, 0x00, 0x29, 0x01, 0x00, 0x00, 0xf5, 0x00, 0x07, 0x00, 0x28, 0x00, 0x00, 0x00, 0x8c, // ...).......(....
+	0x01, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x65, 0x01, 0x00, 0x00, 0x29, // ...-.......e...)
+	0x01, 0x00, 0x00, 0xb1, 0x00, 0x05, 0x00, 0x6a, 0x00, 0x00, 0x00, 0x1b, 0x01, 0x00, 0x00, 0x8c, // .......j........
+	0x01, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0xf6, 0x00, 0x04, 0x00, 0x17, 0x01, 0x00, 0x00, 0x29, // ...i...........)
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x1b, 0x01, 0x00, 0x00, 0x1c, // ................
+	0x01, 0x00, 0x00, 0x17, 0x01, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x1c, 0x01, 0x00, 0x00, 0x84, // ................
+	0x00, 0x05, 0x00, 0x28, 0x00, 0x00, 0x00, 0x1f, 0x01, 0x00, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x12, // ...(.......m....
+	0x01, 0x00, 0x00, 0xaf, 0x00, 0x05, 0x00, 0x6a, 0x00, 0x00, 0x00, 0x20, 0x01, 0x00, 0x00, 0x8c, // .......j... ....
+	0x01, 0x00, 0x00, 0x1f, 0x01, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0x21, 0x01, 0x00, 0x00, 0x00, // ...........!....
+	0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x20, 0x01, 0x00, 0x00, 0x22, 0x01, 0x00, 0x00, 0x21, // ....... ..."...!
+	0x01, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x22, 0x01, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x17, // ......."........
+	0x01, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x21, 0x01, 0x00, 0x00, 0x6f, 0x00, 0x04, 0x00, 0x07, // .......!...o....
+	0x00, 0x00, 0x00, 0x24, 0x01, 0x00, 0x00, 0x8c, 0x01, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00, 0x07, // ...$............
+	0x00, 0x00, 0x00, 0x25, 0x01, 0x00, 0x00, 0x24, 0x01, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0x85, // ...%...$...w....
+	0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0x27, 0x01, 0x00, 0x00, 0x25, 0x01, 0x00, 0x00, 0x15, // .......'...%....
+	0x01, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x28, 0x01, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x28, // .......(.......(
+	0x01, 0x00, 0x00, 0xf5, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x8e, 0x01, 0x00, 0x00, 0x8f, // ................
+	0x01, 0x00, 0x00, 0x21, 0x01, 0x00, 0x00, 0x61, 0x01, 0x00, 0x00, 0x32, 0x01, 0x00, 0x00, 0xf5, // ...!...a...2....
+	0x00, 0x07, 0x00, 0x28, 0x00, 0x00, 0x00, 0x8d, 0x01, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x21, // ...(.......-...!
+	0x01, 0x00, 0x00, 0x63, 0x01, 0x00, 0x00, 0x32, 0x01, 0x00, 0x00, 0xb1, 0x00, 0x05, 0x00, 0x6a, // ...c...2.......j
+	0x00, 0x00, 0x00, 0x2d, 0x01, 0x00, 0x00, 0x8d, 0x01, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0xf6, // ...-............
+	0x00, 0x04, 0x00, 0x29, 0x01, 0x00, 0x00, 0x32, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, // ...)...2........
+	0x00, 0x04, 0x00, 0x2d, 0x01, 0x00, 0x00, 0x2e, 0x01, 0x00, 0x00, 0x29, 0x01, 0x00, 0x00, 0xf8, // ...-.......)....
+	0x00, 0x02, 0x00, 0x2e, 0x01, 0x00, 0x00, 0xaf, 0x00, 0x05, 0x00, 0x6a, 0x00, 0x00, 0x00, 0x31, // ...........j...1
+	0x01, 0x00, 0x00, 0x8d, 0x01, 0x00, 0x00, 0x12, 0x01, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0x32, // ...............2
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x31, 0x01, 0x00, 0x00, 0x33, // ...........1...3
+	0x01, 0x00, 0x00, 0x32, 0x01, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x33, 0x01, 0x00, 0x00, 0xf9, // ...2.......3....
+	0x00, 0x02, 0x00, 0x29, 0x01, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x32, 0x01, 0x00, 0x00, 0x6f, // ...).......2...o
+	0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0x35, 0x01, 0x00, 0x00, 0x8d, 0x01, 0x00, 0x00, 0x81, // .......5........
+	0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0x36, 0x01, 0x00, 0x00, 0x35, 0x01, 0x00, 0x00, 0x77, // .......6...5...w
+	0x00, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0x38, 0x01, 0x00, 0x00, 0x36, // ...........8...6
+	0x01, 0x00, 0x00, 0x15, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3a, // ...............:
+	0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x38, 0x01, 0x00, 0x00, 0x0c, // ...........8....
+	0x00, 0x06, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3c, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0e, // .......<........
+	0x00, 0x00, 0x00, 0x27, 0x01, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3d, // ...'...........=
+	0x01, 0x00, 0x00, 0x3a, 0x01, 0x00, 0x00, 0x3c, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x07, // ...:...<........
+	0x00, 0x00, 0x00, 0x3f, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x38, // ...?...........8
+	0x01, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x07, 0x00, 0x00, 0x00, 0x41, 0x01, 0x00, 0x00, 0x01, // ...........A....
+	0x00, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x27, 0x01, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x07, // .......'........
+	0x00, 0x00, 0x00, 0x42, 0x01, 0x00, 0x00, 0x3f, 0x01, 0x00, 0x00, 0x41, 0x01, 0x00, 0x00, 0x0c, // ...B...?...A....
+	0x00, 0x06, 0x00, 0x07, 0x00, 0x00, 0x00, 0x44, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0e, // .......D........
+	0x00, 0x00, 0x00, 0x38, 0x01, 0x00, 0x00, 0x8e, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x49, // ...8...........I
+	0x01, 0x00, 0x00, 0x0c, 0x01, 0x00, 0x00, 0x3d, 0x01, 0x00, 0x00, 0x8e, 0x00, 0x05, 0x00, 0x0b, // .......=........
+	0x00, 0x00, 0x00, 0x4d, 0x01, 0x00, 0x00, 0x0f, 0x01, 0x00, 0x00, 0x42, 0x01, 0x00, 0x00, 0x81, // ...M.......B....
+	0x00, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x4e, 0x01, 0x00, 0x00, 0x49, 0x01, 0x00, 0x00, 0x4d, // .......N...I...M
+	0x01, 0x00, 0x00, 0x8e, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x52, 0x01, 0x00, 0x00, 0x09, // ...........R....
+	0x01, 0x00, 0x00, 0x44, 0x01, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x53, // ...D...........S
+	0x01, 0x00, 0x00, 0x4e, 0x01, 0x00, 0x00, 0x52, 0x01, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00, 0x59, // ...N...R...A...Y
+	0x00, 0x00, 0x00, 0x56, 0x01, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x9f, // ...V...V...-....
+	0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0x57, 0x01, 0x00, 0x00, 0x56, // ...=.......W...V
+	0x01, 0x00, 0x00, 0x56, 0x00, 0x05, 0x00, 0x31, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x26, // ...V...1.......&
+	0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x58, 0x00, 0x07, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x83, // ...#...X........
+	0x01, 0x00, 0x00, 0x80, 0x01, 0x00, 0x00, 0x53, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x57, // .......S.......W
+	0x01, 0x00, 0x00, 0x4f, 0x00, 0x08, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x59, 0x01, 0x00, 0x00, 0x83, // ...O.......Y....
+	0x01, 0x00, 0x00, 0x83, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, // ................
+	0x00, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x07, 0x00, 0x00, 0x00, 0x5b, 0x01, 0x00, 0x00, 0x01, // ...........[....
+	0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x38, 0x01, 0x00, 0x00, 0x8e, 0x00, 0x05, 0x00, 0x0b, // .......8........
+	0x00, 0x00, 0x00, 0x5c, 0x01, 0x00, 0x00, 0x59, 0x01, 0x00, 0x00, 0x5b, 0x01, 0x00, 0x00, 0x0c, // .......Y...[....
+	0x00, 0x06, 0x00, 0x07, 0x00, 0x00, 0x00, 0x5e, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0d, // .......^........
+	0x00, 0x00, 0x00, 0x38, 0x01, 0x00, 0x00, 0x8e, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x5f, // ...8..........._
+	0x01, 0x00, 0x00, 0x5c, 0x01, 0x00, 0x00, 0x5e, 0x01, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00, 0x0b, // .......^........
+	0x00, 0x00, 0x00, 0x61, 0x01, 0x00, 0x00, 0x8e, 0x01, 0x00, 0x00, 0x5f, 0x01, 0x00, 0x00, 0x80, // ...a......._....
+	0x00, 0x05, 0x00, 0x28, 0x00, 0x00, 0x00, 0x63, 0x01, 0x00, 0x00, 0x8d, 0x01, 0x00, 0x00, 0x29, // ...(...c.......)
+	0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x28, 0x01, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x29, // .......(.......)
+	0x01, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x28, 0x00, 0x00, 0x00, 0x65, 0x01, 0x00, 0x00, 0x8c, // .......(...e....
+	0x01, 0x00, 0x00, 0x29, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x16, 0x01, 0x00, 0x00, 0xf8, // ...)............
+	0x00, 0x02, 0x00, 0x17, 0x01, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00, 0x59, 0x00, 0x00, 0x00, 0x66, // .......A...Y...f
+	0x01, 0x00, 0x00, 0x56, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x3d, // ...V...-...X...=
+	0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0x67, 0x01, 0x00, 0x00, 0x66, 0x01, 0x00, 0x00, 0x85, // .......g...f....
+	0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0x68, 0x01, 0x00, 0x00, 0xc5, 0x00, 0x00, 0x00, 0x67, // .......h.......g
+	0x01, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00, 0x59, 0x00, 0x00, 0x00, 0x69, 0x01, 0x00, 0x00, 0x56, // ...A...Y...i...V
+	0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x58, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x07, // ...-...X...=....
+	0x00, 0x00, 0x00, 0x6a, 0x01, 0x00, 0x00, 0x69, 0x01, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x07, // ...j...i........
+	0x00, 0x00, 0x00, 0x6b, 0x01, 0x00, 0x00, 0x68, 0x01, 0x00, 0x00, 0x6a, 0x01, 0x00, 0x00, 0x8e, // ...k...h...j....
+	0x00, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x6d, 0x01, 0x00, 0x00, 0x8f, 0x01, 0x00, 0x00, 0xcc, // .......m........
+	0x00, 0x00, 0x00, 0x50, 0x00, 0x06, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x6f, 0x01, 0x00, 0x00, 0x6b, // ...P.......o...k
+	0x01, 0x00, 0x00, 0x6b, 0x01, 0x00, 0x00, 0x6b, 0x01, 0x00, 0x00, 0x88, 0x00, 0x05, 0x00, 0x0b, // ...k...k........
+	0x00, 0x00, 0x00, 0x70, 0x01, 0x00, 0x00, 0x6d, 0x01, 0x00, 0x00, 0x6f, 0x01, 0x00, 0x00, 0x51, // ...p...m...o...Q
+	0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0x71, 0x01, 0x00, 0x00, 0x70, 0x01, 0x00, 0x00, 0x00, // .......q...p....
+	0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0x72, 0x01, 0x00, 0x00, 0x70, // ...Q.......r...p
+	0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0x73, // .......Q.......s
+	0x01, 0x00, 0x00, 0x70, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x50, 0x00, 0x07, 0x00, 0x0e, // ...p.......P....
+	0x00, 0x00, 0x00, 0x74, 0x01, 0x00, 0x00, 0x71, 0x01, 0x00, 0x00, 0x72, 0x01, 0x00, 0x00, 0x73, // ...t...q...r...s
+	0x01, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0xe1, 0x00, 0x00, 0x00, 0x74, // ...I...>.......t
+	0x01, 0x00, 0x00, 0xfd, 0x00, 0x01, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00,       // .......8.......
+};
+
+static const uint8_t irradiance_shader_fragment_mtl[1748] =
+{
+	0x46, 0x53, 0x48, 0x06, 0x70, 0x94, 0x72, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x0a, 0x75, // FSH.p.r........u
+	0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x12, 0x01, 0x00, 0x00, 0x01, 0x00, 0x09, // _settings.......
+	0x73, 0x5f, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, // s_texture.......
+	0x06, 0x00, 0x00, 0x23, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x20, 0x3c, 0x6d, 0x65, 0x74, // ...#include <met
+	0x61, 0x6c, 0x5f, 0x73, 0x74, 0x64, 0x6c, 0x69, 0x62, 0x3e, 0x0a, 0x23, 0x69, 0x6e, 0x63, 0x6c, // al_stdlib>.#incl
+	0x75, 0x64, 0x65, 0x20, 0x3c, 0x73, 0x69, 0x6d, 0x64, 0x2f, 0x73, 0x69, 0x6d, 0x64, 0x2e, 0x68, // ude <simd/simd.h
+	0x3e, 0x0a, 0x0a, 0x75, 0x73, 0x69, 0x6e, 0x67, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x73, 0x70, 0x61, // >..using namespa
+	0x63, 0x65, 0x20, 0x6d, 0x65, 0x74, 0x61, 0x6c, 0x3b, 0x0a, 0x0a, 0x73, 0x74, 0x72, 0x75, 0x63, // ce metal;..struc
+	0x74, 0x20, 0x5f, 0x47, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x0a, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, // t _Global.{.    
+	0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x20, 0x75, 0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, // float4 u_setting
+	0x73, 0x3b, 0x0a, 0x7d, 0x3b, 0x0a, 0x0a, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x78, 0x6c, // s;.};..struct xl
+	0x61, 0x74, 0x4d, 0x74, 0x6c, 0x4d, 0x61, 0x69, 0x6e, 0x5f, 0x6f, 0x75, 0x74, 0x0a, 0x7b, 0x0a, // atMtlMain_out.{.
+	0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x20, 0x62, 0x67, 0x66, 0x78, 0x5f, //     float4 bgfx_
+	0x46, 0x72, 0x61, 0x67, 0x44, 0x61, 0x74, 0x61, 0x30, 0x20, 0x5b, 0x5b, 0x63, 0x6f, 0x6c, 0x6f, // FragData0 [[colo
+	0x72, 0x28, 0x30, 0x29, 0x5d, 0x5d, 0x3b, 0x0a, 0x7d, 0x3b, 0x0a, 0x0a, 0x73, 0x74, 0x72, 0x75, // r(0)]];.};..stru
+	0x63, 0x74, 0x20, 0x78, 0x6c, 0x61, 0x74, 0x4d, 0x74, 0x6c, 0x4d, 0x61, 0x69, 0x6e, 0x5f, 0x69, // ct xlatMtlMain_i
+	0x6e, 0x0a, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x20, 0x76, // n.{.    float3 v
+	0x5f, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x5b, 0x5b, 0x75, 0x73, 0x65, 0x72, // _position [[user
+	0x28, 0x6c, 0x6f, 0x63, 0x6e, 0x30, 0x29, 0x5d, 0x5d, 0x3b, 0x0a, 0x7d, 0x3b, 0x0a, 0x0a, 0x66, // (locn0)]];.};..f
+	0x72, 0x61, 0x67, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x78, 0x6c, 0x61, 0x74, 0x4d, 0x74, 0x6c, 0x4d, // ragment xlatMtlM
+	0x61, 0x69, 0x6e, 0x5f, 0x6f, 0x75, 0x74, 0x20, 0x78, 0x6c, 0x61, 0x74, 0x4d, 0x74, 0x6c, 0x4d, // ain_out xlatMtlM
+	0x61, 0x69, 0x6e, 0x28, 0x78, 0x6c, 0x61, 0x74, 0x4d, 0x74, 0x6c, 0x4d, 0x61, 0x69, 0x6e, 0x5f, // ain(xlatMtlMain_
+	0x69, 0x6e, 0x20, 0x69, 0x6e, 0x20, 0x5b, 0x5b, 0x73, 0x74, 0x61, 0x67, 0x65, 0x5f, 0x69, 0x6e, // in in [[stage_in
+	0x5d, 0x5d, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x20, 0x5f, 0x47, 0x6c, // ]], constant _Gl
+	0x6f, 0x62, 0x61, 0x6c, 0x26, 0x20, 0x5f, 0x6d, 0x74, 0x6c, 0x5f, 0x75, 0x20, 0x5b, 0x5b, 0x62, // obal& _mtl_u [[b
+	0x75, 0x66, 0x66, 0x65, 0x72, 0x28, 0x30, 0x29, 0x5d, 0x5d, 0x2c, 0x20, 0x74, 0x65, 0x78, 0x74, // uffer(0)]], text
+	0x75, 0x72, 0x65, 0x63, 0x75, 0x62, 0x65, 0x3c, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x3e, 0x20, 0x73, // urecube<float> s
+	0x5f, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x20, 0x5b, 0x5b, 0x74, 0x65, 0x78, 0x74, 0x75, // _texture [[textu
+	0x72, 0x65, 0x28, 0x30, 0x29, 0x5d, 0x5d, 0x2c, 0x20, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x72, // re(0)]], sampler
+	0x20, 0x73, 0x5f, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x53, 0x61, 0x6d, 0x70, 0x6c, 0x65, //  s_textureSample
+	0x72, 0x20, 0x5b, 0x5b, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x72, 0x28, 0x30, 0x29, 0x5d, 0x5d, // r [[sampler(0)]]
+	0x29, 0x0a, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x78, 0x6c, 0x61, 0x74, 0x4d, 0x74, 0x6c, 0x4d, // ).{.    xlatMtlM
+	0x61, 0x69, 0x6e, 0x5f, 0x6f, 0x75, 0x74, 0x20, 0x6f, 0x75, 0x74, 0x20, 0x3d, 0x20, 0x7b, 0x7d, // ain_out out = {}
+	0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x20, 0x5f, 0x32, 0x36, // ;.    float3 _26
+	0x39, 0x20, 0x3d, 0x20, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x28, 0x69, 0x6e, // 9 = normalize(in
+	0x2e, 0x76, 0x5f, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x29, 0x3b, 0x0a, 0x20, 0x20, // .v_position);.  
+	0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x20, 0x5f, 0x32, 0x37, 0x32, 0x20, 0x3d, 0x20, //   float3 _272 = 
+	0x63, 0x72, 0x6f, 0x73, 0x73, 0x28, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x28, 0x30, 0x2e, 0x30, // cross(float3(0.0
+	0x2c, 0x20, 0x31, 0x2e, 0x30, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x29, 0x2c, 0x20, 0x5f, 0x32, 0x36, // , 1.0, 0.0), _26
+	0x39, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x32, 0x37, 0x38, // 9);.    int _278
+	0x20, 0x3d, 0x20, 0x69, 0x6e, 0x74, 0x28, 0x5f, 0x6d, 0x74, 0x6c, 0x5f, 0x75, 0x2e, 0x75, 0x5f, //  = int(_mtl_u.u_
+	0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x79, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, // settings.y);.   
+	0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x5f, 0x32, 0x38, 0x31, 0x20, 0x3d, 0x20, 0x31, 0x2e, //  float _281 = 1.
+	0x35, 0x37, 0x30, 0x37, 0x39, 0x36, 0x33, 0x37, 0x30, 0x35, 0x30, 0x36, 0x32, 0x38, 0x36, 0x36, // 5707963705062866
+	0x32, 0x31, 0x30, 0x39, 0x33, 0x37, 0x35, 0x20, 0x2f, 0x20, 0x5f, 0x6d, 0x74, 0x6c, 0x5f, 0x75, // 2109375 / _mtl_u
+	0x2e, 0x75, 0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x79, 0x3b, 0x0a, 0x20, // .u_settings.y;. 
+	0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x20, 0x5f, 0x34, 0x31, 0x30, 0x3b, 0x0a, //    float3 _410;.
+	0x20, 0x20, 0x20, 0x20, 0x5f, 0x34, 0x31, 0x30, 0x20, 0x3d, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, //     _410 = float
+	0x33, 0x28, 0x30, 0x2e, 0x30, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, // 3(0.0);.    floa
+	0x74, 0x33, 0x20, 0x5f, 0x34, 0x30, 0x39, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72, // t3 _409;.    for
+	0x20, 0x28, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x34, 0x30, 0x37, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x20, //  (int _407 = 0; 
+	0x5f, 0x34, 0x30, 0x37, 0x20, 0x3c, 0x20, 0x31, 0x32, 0x38, 0x3b, 0x20, 0x5f, 0x34, 0x31, 0x30, // _407 < 128; _410
+	0x20, 0x3d, 0x20, 0x5f, 0x34, 0x30, 0x39, 0x2c, 0x20, 0x5f, 0x34, 0x30, 0x37, 0x2b, 0x2b, 0x29, //  = _409, _407++)
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, // .    {.        i
+	0x66, 0x20, 0x28, 0x5f, 0x34, 0x30, 0x37, 0x20, 0x3e, 0x3d, 0x20, 0x28, 0x34, 0x20, 0x2a, 0x20, // f (_407 >= (4 * 
+	0x5f, 0x32, 0x37, 0x38, 0x29, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, // _278)).        {
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, // .            bre
+	0x61, 0x6b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, // ak;.        }.  
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x5f, 0x32, 0x39, 0x39, //       float _299
+	0x20, 0x3d, 0x20, 0x28, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x28, 0x5f, 0x34, 0x30, 0x37, 0x29, 0x20, //  = (float(_407) 
+	0x2b, 0x20, 0x30, 0x2e, 0x35, 0x29, 0x20, 0x2a, 0x20, 0x5f, 0x32, 0x38, 0x31, 0x3b, 0x0a, 0x20, // + 0.5) * _281;. 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x34, 0x30, 0x39, 0x20, 0x3d, 0x20, 0x5f, 0x34, //        _409 = _4
+	0x31, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, // 10;.        floa
+	0x74, 0x20, 0x5f, 0x33, 0x31, 0x36, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // t _316;.        
+	0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x20, 0x5f, 0x33, 0x34, 0x33, 0x3b, 0x0a, 0x20, 0x20, 0x20, // float3 _343;.   
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x20, 0x5f, 0x34, 0x30, 0x35, //      float3 _405
+	0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x69, // ;.        for (i
+	0x6e, 0x74, 0x20, 0x5f, 0x34, 0x30, 0x38, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x20, 0x5f, 0x34, 0x30, // nt _408 = 0; _40
+	0x38, 0x20, 0x3c, 0x20, 0x33, 0x32, 0x3b, 0x20, 0x5f, 0x33, 0x31, 0x36, 0x20, 0x3d, 0x20, 0x28, // 8 < 32; _316 = (
+	0x66, 0x6c, 0x6f, 0x61, 0x74, 0x28, 0x5f, 0x34, 0x30, 0x38, 0x29, 0x20, 0x2b, 0x20, 0x30, 0x2e, // float(_408) + 0.
+	0x35, 0x29, 0x20, 0x2a, 0x20, 0x5f, 0x32, 0x38, 0x31, 0x2c, 0x20, 0x5f, 0x33, 0x34, 0x33, 0x20, // 5) * _281, _343 
+	0x3d, 0x20, 0x28, 0x28, 0x5f, 0x32, 0x37, 0x32, 0x20, 0x2a, 0x20, 0x28, 0x73, 0x69, 0x6e, 0x28, // = ((_272 * (sin(
+	0x5f, 0x33, 0x31, 0x36, 0x29, 0x20, 0x2a, 0x20, 0x63, 0x6f, 0x73, 0x28, 0x5f, 0x32, 0x39, 0x39, // _316) * cos(_299
+	0x29, 0x29, 0x29, 0x20, 0x2b, 0x20, 0x28, 0x63, 0x72, 0x6f, 0x73, 0x73, 0x28, 0x5f, 0x32, 0x36, // ))) + (cross(_26
+	0x39, 0x2c, 0x20, 0x5f, 0x32, 0x37, 0x32, 0x29, 0x20, 0x2a, 0x20, 0x28, 0x73, 0x69, 0x6e, 0x28, // 9, _272) * (sin(
+	0x5f, 0x33, 0x31, 0x36, 0x29, 0x20, 0x2a, 0x20, 0x73, 0x69, 0x6e, 0x28, 0x5f, 0x32, 0x39, 0x39, // _316) * sin(_299
+	0x29, 0x29, 0x29, 0x29, 0x20, 0x2b, 0x20, 0x28, 0x5f, 0x32, 0x36, 0x39, 0x20, 0x2a, 0x20, 0x63, // )))) + (_269 * c
+	0x6f, 0x73, 0x28, 0x5f, 0x33, 0x31, 0x36, 0x29, 0x29, 0x2c, 0x20, 0x5f, 0x34, 0x30, 0x35, 0x20, // os(_316)), _405 
+	0x3d, 0x20, 0x5f, 0x33, 0x34, 0x33, 0x2c, 0x20, 0x5f, 0x34, 0x30, 0x35, 0x2e, 0x79, 0x20, 0x3d, // = _343, _405.y =
+	0x20, 0x2d, 0x5f, 0x33, 0x34, 0x33, 0x2e, 0x79, 0x2c, 0x20, 0x5f, 0x34, 0x30, 0x39, 0x20, 0x2b, //  -_343.y, _409 +
+	0x3d, 0x20, 0x28, 0x28, 0x73, 0x5f, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x2e, 0x73, 0x61, // = ((s_texture.sa
+	0x6d, 0x70, 0x6c, 0x65, 0x28, 0x73, 0x5f, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x53, 0x61, // mple(s_textureSa
+	0x6d, 0x70, 0x6c, 0x65, 0x72, 0x2c, 0x20, 0x5f, 0x34, 0x30, 0x35, 0x2c, 0x20, 0x6c, 0x65, 0x76, // mpler, _405, lev
+	0x65, 0x6c, 0x28, 0x5f, 0x6d, 0x74, 0x6c, 0x5f, 0x75, 0x2e, 0x75, 0x5f, 0x73, 0x65, 0x74, 0x74, // el(_mtl_u.u_sett
+	0x69, 0x6e, 0x67, 0x73, 0x2e, 0x78, 0x29, 0x29, 0x2e, 0x78, 0x79, 0x7a, 0x20, 0x2a, 0x20, 0x63, // ings.x)).xyz * c
+	0x6f, 0x73, 0x28, 0x5f, 0x33, 0x31, 0x36, 0x29, 0x29, 0x20, 0x2a, 0x20, 0x73, 0x69, 0x6e, 0x28, // os(_316)) * sin(
+	0x5f, 0x33, 0x31, 0x36, 0x29, 0x29, 0x2c, 0x20, 0x5f, 0x34, 0x30, 0x38, 0x2b, 0x2b, 0x29, 0x0a, // _316)), _408++).
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //         {.      
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x5f, 0x34, 0x30, 0x38, 0x20, 0x3e, //       if (_408 >
+	0x3d, 0x20, 0x5f, 0x32, 0x37, 0x38, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // = _278).        
+	0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //     {.          
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6b, 0x3b, 0x0a, 0x20, 0x20, 0x20, //       break;.   
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, //          }.     
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, //        else.    
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //         {.      
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x69, 0x6e, //           contin
+	0x75, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // ue;.            
+	0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, // }.            co
+	0x6e, 0x74, 0x69, 0x6e, 0x75, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // ntinue;.        
+	0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6f, 0x75, 0x74, 0x2e, // }.    }.    out.
+	0x62, 0x67, 0x66, 0x78, 0x5f, 0x46, 0x72, 0x61, 0x67, 0x44, 0x61, 0x74, 0x61, 0x30, 0x20, 0x3d, // bgfx_FragData0 =
+	0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x28, 0x28, 0x5f, 0x34, 0x31, 0x30, 0x20, 0x2a, 0x20, //  float4((_410 * 
+	0x33, 0x2e, 0x31, 0x34, 0x31, 0x35, 0x39, 0x32, 0x37, 0x34, 0x31, 0x30, 0x31, 0x32, 0x35, 0x37, // 3.14159274101257
+	0x33, 0x32, 0x34, 0x32, 0x31, 0x38, 0x37, 0x35, 0x29, 0x20, 0x2f, 0x20, 0x66, 0x6c, 0x6f, 0x61, // 32421875) / floa
+	0x74, 0x33, 0x28, 0x28, 0x34, 0x2e, 0x30, 0x20, 0x2a, 0x20, 0x5f, 0x6d, 0x74, 0x6c, 0x5f, 0x75, // t3((4.0 * _mtl_u
+	0x2e, 0x75, 0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x79, 0x29, 0x20, 0x2a, // .u_settings.y) *
+	0x20, 0x5f, 0x6d, 0x74, 0x6c, 0x5f, 0x75, 0x2e, 0x75, 0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, //  _mtl_u.u_settin
+	0x67, 0x73, 0x2e, 0x79, 0x29, 0x2c, 0x20, 0x31, 0x2e, 0x30, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, // gs.y), 1.0);.   
+	0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x6f, 0x75, 0x74, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a, //  return out;.}..
+	0x00, 0x00, 0x10, 0x00,                                                                         // ....
+};
@@ -3,9 +3,15 @@ $input v_position
 #include <bgfx_shader.sh>
 
 #define PI 3.14159265359
+#define MAX_STEP_COUNT 32
 
 SAMPLERCUBE(s_texture, 0);
 
+uniform vec4 u_settings;
+
+#define u_mip_level u_settings.x
+#define u_step_count u_settings.y
+
 void main() {
     vec3 normal = normalize(v_position);
     vec3 irradiance = vec3(0.0, 0.0, 0.0);
@@ -14,17 +20,29 @@ void main() {
     vec3 right = cross(up, normal);
     up = cross(normal, right);
 
-    float nr_samples = 0.0;
-    for (float phi = 0.0; phi < 2.0 * PI; phi += 0.025) {
-        for (float theta = 0.0; theta < 0.5 * PI; theta += 0.01) {
+    // Explicit mip level is `u_step_count` texels wide, at most `MAX_STEP_COUNT`. Theta takes a step per texel of it
+    // and phi four times as many, so the hemisphere is sampled about once per texel rather than tens of thousands
+    // of times from a large level, which thrashes the texture cache for a very low frequency signal.
+    int step_count = int(u_step_count);
+    float step_angle = 0.5 * PI / u_step_count;
+    for (int i = 0; i < 4 * MAX_STEP_COUNT; i++) {
+        if (i >= 4 * step_count) {
+            break;
+        }
+        float phi = (float(i) + 0.5) * step_angle;
+        for (int j = 0; j < MAX_STEP_COUNT; j++) {
+            if (j >= step_count) {
+                break;
+            }
+            float theta = (float(j) + 0.5) * step_angle;
             vec3 tangent_sample = vec3(sin(theta) * cos(phi), sin(theta) * sin(phi), cos(theta));
             vec3 sample_dir = tangent_sample.x * right + tangent_sample.y * up + tangent_sample.z * normal;
             #if (BGFX_SHADER_LANGUAGE_HLSL || BGFX_SHADER_LANGUAGE_PSSL || BGFX_SHADER_LANGUAGE_METAL)
             sample_dir.y = -sample_dir.y;
             #endif
-            irradiance += textureCube(s_texture, sample_dir).xyz * cos(theta) * sin(theta);
-            nr_samples++;
+            irradiance += textureCubeLod(s_texture, sample_dir, u_mip_level).xyz * cos(theta) * sin(theta);
         }
     }
+    float nr_samples = 4.0 * u_step_count * u_step_count;
     gl_FragColor = vec4(PI * irradiance / nr_samples, 1.0);
 }
@@ -0,0 +1,270 @@
+#include "ktx2.h"
+#include "dds_layout.h"
+#include "uastc_encoder.h"
+
+#include <cstdint>
+#include <cstring>
+
+#if defined(TEXTURE_COMPILER_ZSTD)
+#include <zstd.h>
+#endif
+
+static const uint8_t KTX2_IDENTIFIER[12] = { 0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n' };
+
+static constexpr uint32_t KTX2_SUPERCOMPRESSION_NONE = 0;
+static constexpr uint32_t KTX2_SUPERCOMPRESSION_ZSTD = 2;
+
+// Zstandard level of every mip level. Higher levels barely shrink block compressed data further, while getting much
+// slower than block compression of the development formats.
+static constexpr int KTX2_ZSTD_LEVEL = 9;
+
+// Identifier, header and index, followed by the level index.
+static constexpr size_t KTX2_HEADER_SIZE = 12 + 9 * 4 + 4 * 4 + 2 * 8;
+static constexpr size_t KTX2_LEVEL_INDEX_ENTRY_SIZE = 3 * 8;
+
+// Khronos data format descriptor constants.
+static constexpr uint8_t KHR_DF_MODEL_RGBSDA = 1;
+static constexpr uint8_t KHR_DF_MODEL_BC1A = 128;
+static constexpr uint8_t KHR_DF_MODEL_BC3 = 130;
+static constexpr uint8_t KHR_DF_MODEL_BC4 = 131;
+static constexpr uint8_t KHR_DF_MODEL_BC5 = 132;
+static constexpr uint8_t KHR_DF_MODEL_BC7 = 134;
+static constexpr uint8_t KHR_DF_MODEL_ETC2 = 161;
+static constexpr uint8_t KHR_DF_MODEL_ASTC = 162;
+static constexpr uint8_t KHR_DF_MODEL_UASTC = 166;
+static constexpr uint8_t KHR_DF_PRIMARIES_BT709 = 1;
+static constexpr uint8_t KHR_DF_TRANSFER_LINEAR = 1;
+static constexpr uint8_t KHR_DF_CHANNEL_RED = 0;
+static constexpr uint8_t KHR_DF_CHANNEL_GREEN = 1;
+static constexpr uint8_t KHR_DF_CHANNEL_BLUE = 2;
+static constexpr uint8_t KHR_DF_CHANNEL_ALPHA = 15;
+static constexpr uint8_t KHR_DF_CHANNEL_ETC2_COLOR = 2;
+static constexpr uint8_t KHR_DF_CHANNEL_UASTC_RGBA = 3;
+static constexpr uint8_t KHR_DF_CHANNEL_UASTC_RRR = 4;
+
+// UASTC is stored with `VK_FORMAT_UNDEFINED`.
+static constexpr uint32_t VK_FORMAT_UNDEFINED = 0;
+
+struct Sample final {
+    uint16_t bit_offset;
+    uint8_t bit_length;
+    uint8_t channel;
+    uint32_t upper;
+};
+
+// Formats nvtt and the built-in encoders write for 2D textures of this compiler. Formats without a DXGI format have
+// `DXGI_FORMAT_UNKNOWN` and are matched by their Vulkan format. Block sizes are those of `find_texture_format_size`.
+struct Ktx2Format final {
+    uint32_t dxgi_format;
+    uint32_t vk_format;
+    uint8_t color_model;
+    Sample samples[4];
+    size_t sample_count;
+};
+
+static const Ktx2Format FORMATS[] = {
+    // DXGI_FORMAT_BC1_UNORM, VK_FORMAT_BC1_RGB_UNORM_BLOCK. Only opaque textures of `--auto-format` are BC1.
+    { 71, 131, KHR_DF_MODEL_BC1A, { { 0, 64, 0, UINT32_MAX } }, 1 },
+    // DXGI_FORMAT_BC3_UNORM, VK_FORMAT_BC3_UNORM_BLOCK.
+    { 77, 137, KHR_DF_MODEL_BC3, { { 0, 64, KHR_DF_CHANNEL_ALPHA, UINT32_MAX }, { 64, 64, 0, UINT32_MAX } }, 2 },
+    // DXGI_FORMAT_BC4_UNORM, VK_FORMAT_BC4_UNORM_BLOCK.
+    { 80, 139, KHR_DF_MODEL_BC4, { { 0, 64, 0, UINT32_MAX } }, 1 },
+    // DXGI_FORMAT_BC5_UNORM, VK_FORMAT_BC5_UNORM_BLOCK.
+    { 83, 141, KHR_DF_MODEL_BC5, { { 0, 64, KHR_DF_CHANNEL_RED, UINT32_MAX }, { 64, 64, KHR_DF_CHANNEL_GREEN, UINT32_MAX } }, 2 },
+    // DXGI_FORMAT_BC7_UNORM, VK_FORMAT_BC7_UNORM_BLOCK.
+    { 98, 145, KHR_DF_MODEL_BC7, { { 0, 128, 0, UINT32_MAX } }, 1 },
+    // DXGI_FORMAT_B8G8R8A8_UNORM, VK_FORMAT_B8G8R8A8_UNORM.
+    { 87, 44, KHR_DF_MODEL_RGBSDA,
+      { { 0, 8, KHR_DF_CHANNEL_BLUE, 255 }, { 8, 8, KHR_DF_CHANNEL_GREEN, 255 }, { 16, 8, KHR_DF_CHANNEL_RED, 255 }, { 24, 8, KHR_DF_CHANNEL_ALPHA, 255 } }, 4 },
+    // DXGI_FORMAT_R8_UNORM, VK_FORMAT_R8_UNORM.
+    { 61, 9, KHR_DF_MODEL_RGBSDA, { { 0, 8, KHR_DF_CHANNEL_RED, 255 } }, 1 },
+    // DXGI_FORMAT_R16_UNORM, VK_FORMAT_R16_UNORM.
+    { 56, 70, KHR_DF_MODEL_RGBSDA, { { 0, 16, KHR_DF_CHANNEL_RED, 65535 } }, 1 },
+    // VK_FORMAT_ETC2_R8G8B8A8_UNORM_BLOCK.
+    { 0, 151, KHR_DF_MODEL_ETC2, { { 0, 64, KHR_DF_CHANNEL_ALPHA, UINT32_MAX }, { 64, 64, KHR_DF_CHANNEL_ETC2_COLOR, UINT32_MAX } }, 2 },
+    // VK_FORMAT_EAC_R11_UNORM_BLOCK.
+    { 0, 153, KHR_DF_MODEL_ETC2, { { 0, 64, KHR_DF_CHANNEL_RED, UINT32_MAX } }, 1 },
+    // VK_FORMAT_ASTC_4x4_UNORM_BLOCK.
+    { 0, 157, KHR_DF_MODEL_ASTC, { { 0, 128, 0, UINT32_MAX } }, 1 },
+    // UASTC of RGBA and gray pixels.
+    { 0, UASTC_RGBA_VK_FORMAT, KHR_DF_MODEL_UASTC, { { 0, 128, KHR_DF_CHANNEL_UASTC_RGBA, UINT32_MAX } }, 1 },
+    { 0, UASTC_RRR_VK_FORMAT, KHR_DF_MODEL_UASTC, { { 0, 128, KHR_DF_CHANNEL_UASTC_RRR, UINT32_MAX } }, 1 },
+};
+
+static void write_32(std::vector<char>& data, size_t offset, uint32_t value) noexcept {
+    for (size_t i = 0; i < 4; i++) {
+        data[offset + i] = static_cast<char>(value >> (i * 8));
+    }
+}
+
+static void write_64(std::vector<char>& data, size_t offset, uint64_t value) noexcept {
+    for (size_t i = 0; i < 8; i++) {
+        data[offset + i] = static_cast<char>(value >> (i * 8));
+    }
+}
+
+static void append_32(std::vector<char>& data, uint32_t value) {
+    data.resize(data.size() + 4);
+    write_32(data, data.size() - 4, value);
+}
+
+static void align(std::vector<char>& data, size_t alignment) {
+    data.resize((data.size() + alignment - 1) / alignment * alignment);
+}
+
+// Basic data format descriptor block, preceded by the total descriptor size.
+static void append_data_format_descriptor(std::vector<char>& data, const Ktx2Format& format, const TextureFormatSize& format_size, bool is_supercompressed) {
+    const uint32_t block_size = 24 + 16 * static_cast<uint32_t>(format.sample_count);
+    append_32(data, 4 + block_size);
+
+    // Vendor Khronos, descriptor type basic, version 1.3.
+    append_32(data, 0);
+    append_32(data, 2 | (block_size << 16));
+    append_32(data, format.color_model | (KHR_DF_PRIMARIES_BT709 << 8) | (KHR_DF_TRANSFER_LINEAR << 16));
+
+    // Texel block dimensions are stored minus one.
+    append_32(data, format_size.is_block_compressed ? 3 | (3 << 8) : 0);
+
+    // Plane size is unknown when the levels are supercompressed.
+    append_32(data, is_supercompressed ? 0 : format_size.block_size);
+    append_32(data, 0);
+
+    for (size_t i = 0; i < format.sample_count; i++) {
+        const Sample& sample = format.samples[i];
+        append_32(data, sample.bit_offset | ((sample.bit_length - 1) << 16) | (static_cast<uint32_t>(sample.channel) << 24));
+        append_32(data, 0);
+        append_32(data, 0);
+        append_32(data, sample.upper);
+    }
+}
+
+static void append_key_value(std::vector<char>& data, const char* key, const char* value) {
+    const size_t key_size = std::strlen(key) + 1;
+    const size_t value_size = std::strlen(value) + 1;
+    append_32(data, static_cast<uint32_t>(key_size + value_size));
+    data.insert(data.end(), key, key + key_size);
+    data.insert(data.end(), value, value + value_size);
+    align(data, 4);
+}
+
+bool convert_dds_to_ktx2(const std::vector<char>& dds, std::vector<char>& ktx2, uint32_t vk_format, bool is_supercompressed, std::ostream& log) {
+    Dds10Header header;
+    if (!read_dds10_header(dds.data(), dds.size(), header)) {
+        log << "\rTexture compiler error. KTX2 container requires a DDS texture with the DX10 header." << std::endl;
+        return false;
+    }
+
+    const uint32_t height = header.height;
+    const uint32_t width = header.width;
+    const uint32_t level_count = header.level_count;
+    const uint32_t dxgi_format = header.dxgi_format;
+    const uint32_t layer_count = header.array_size;
+
+    if (header.dimension != DDS10_DIMENSION_TEXTURE_2D || header.misc_flags != 0) {
+        log << "\rTexture compiler error. KTX2 container is supported only for 2D textures and texture arrays." << std::endl;
+        return false;
+    }
+
+    const Ktx2Format* format = nullptr;
+    for (const Ktx2Format& candidate : FORMATS) {
+        if (candidate.dxgi_format == dxgi_format && (dxgi_format != DXGI_FORMAT_UNKNOWN || candidate.vk_format == vk_format)) {
+            format = &candidate;
+        }
+    }
+
+    const TextureFormatSize* format_size = find_texture_format_size(dxgi_format, vk_format);
+    if (format == nullptr || format_size == nullptr) {
+        if (dxgi_format == DXGI_FORMAT_UNKNOWN) {
+            log << "\rTexture compiler error. KTX2 container doesn't support Vulkan format " << vk_format << "." << std::endl;
+        } else {
+            log << "\rTexture compiler error. KTX2 container doesn't support DXGI format " << dxgi_format << "." << std::endl;
+        }
+        return false;
+    }
+
+    const std::vector<DdsLevel> levels = get_dds_levels(width, height, level_count, layer_count, format_size->block_size, format_size->is_block_compressed);
+    if (get_dds_size(levels) != dds.size()) {
+        log << "\rTexture compiler error. DDS texture size doesn't match its mip levels." << std::endl;
+        return false;
+    }
+
+#if !defined(TEXTURE_COMPILER_ZSTD)
+    if (is_supercompressed) {
+        log << "\rTexture compiler warning. Built without Zstandard, KTX2 mip levels are not supercompressed." << std::endl;
+        is_supercompressed = false;
+    }
+#endif
+
+    ktx2.clear();
+    ktx2.resize(KTX2_HEADER_SIZE + KTX2_LEVEL_INDEX_ENTRY_SIZE * level_count);
+
+    std::memcpy(ktx2.data(), KTX2_IDENTIFIER, sizeof(KTX2_IDENTIFIER));
+    write_32(ktx2, 12, format->color_model == KHR_DF_MODEL_UASTC ? VK_FORMAT_UNDEFINED : format->vk_format);
+    write_32(ktx2, 16, 1);
+    write_32(ktx2, 20, width);
+    write_32(ktx2, 24, height);
+    write_32(ktx2, 28, 0);
+    write_32(ktx2, 32, layer_count > 1 ? layer_count : 0);
+    write_32(ktx2, 36, 1);
+    write_32(ktx2, 40, level_count);
+    write_32(ktx2, 44, is_supercompressed ? KTX2_SUPERCOMPRESSION_ZSTD : KTX2_SUPERCOMPRESSION_NONE);
+
+    const size_t dfd_offset = ktx2.size();
+    append_data_format_descriptor(ktx2, *format, *format_size, is_supercompressed);
+    write_32(ktx2, 48, static_cast<uint32_t>(dfd_offset));
+    write_32(ktx2, 52, static_cast<uint32_t>(ktx2.size() - dfd_offset));
+
+    const size_t kvd_offset = ktx2.size();
+    append_key_value(ktx2, "KTXwriter", "texture.compiler");
+    write_32(ktx2, 56, static_cast<uint32_t>(kvd_offset));
+    write_32(ktx2, 60, static_cast<uint32_t>(ktx2.size() - kvd_offset));
+
+    // No supercompression global data.
+    write_64(ktx2, 64, 0);
+    write_64(ktx2, 72, 0);
+
+    // Uncompressed levels are aligned to both the texel block size and 4 bytes.
+    const size_t level_alignment = is_supercompressed ? 1 : (format_size->block_size % 4 == 0 ? format_size->block_size : 4);
+
+    // KTX2 levels hold the level of every layer one after another.
+    std::vector<char> layers;
+
+    for (uint32_t i = level_count; i-- > 0;) {
+        align(ktx2, level_alignment);
+
+        const size_t level_offset = ktx2.size();
+        const size_t level_size = levels[i].size * layer_count;
+        const char* level_data = dds.data() + levels[i].offset;
+        if (layer_count > 1) {
+            layers.clear();
+            for (uint32_t layer = 0; layer < layer_count; layer++) {
+                const DdsLevel& layer_level = levels[static_cast<size_t>(layer) * level_count + i];
+                layers.insert(layers.end(), dds.data() + layer_level.offset, dds.data() + layer_level.offset + layer_level.size);
+            }
+            level_data = layers.data();
+        }
+
+#if defined(TEXTURE_COMPILER_ZSTD)
+        if (is_supercompressed) {
+            ktx2.resize(level_offset + ZSTD_compressBound(level_size));
+            const size_t compressed_size = ZSTD_compress(ktx2.data() + level_offset, ktx2.size() - level_offset, level_data, level_size, KTX2_ZSTD_LEVEL);
+            if (ZSTD_isError(compressed_size)) {
+                log << "\rTexture compiler error. Failed to supercompress a mip level: " << ZSTD_getErrorName(compressed_size) << "." << std::endl;
+                return false;
+            }
+            ktx2.resize(level_offset + compressed_size);
+        } else {
+            ktx2.insert(ktx2.end(), level_data, level_data + level_size);
+        }
+#else
+        ktx2.insert(ktx2.end(), level_data, level_data + level_size);
+#endif
+
+        const size_t entry = KTX2_HEADER_SIZE + KTX2_LEVEL_INDEX_ENTRY_SIZE * i;
+        write_64(ktx2, entry, level_offset);
+        write_64(ktx2, entry + 8, ktx2.size() - level_offset);
+        write_64(ktx2, entry + 16, level_size);
+    }
+
+    return true;
+}
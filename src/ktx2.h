@@ -0,0 +1,15 @@
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+// Converts a 2D texture or a texture array written by nvtt with the DDS DX10 header into a KTX2 texture. The level index of KTX2 lets
+// a runtime seek to the mip levels it needs, and when `is_supercompressed` is set and the compiler is built with
+// Zstandard every mip level is supercompressed on its own, so those levels are also decompressed independently.
+// Without supercompression the levels are stored as is, so a runtime can memory map the file and page in only the
+// resident levels. Mip levels are stored from the smallest to the largest, as KTX2 requires, so streaming a texture
+// in starts with the levels it needs first and reads the file forward. Textures in formats DDS can't describe, like
+// ETC2, ASTC and UASTC, have `DXGI_FORMAT_UNKNOWN` and pass their Vulkan format in `vk_format`, other textures pass zero. Every
+// mip level of a texture array holds that level of all the layers in order.
+bool convert_dds_to_ktx2(const std::vector<char>& dds, std::vector<char>& ktx2, uint32_t vk_format, bool is_supercompressed, std::ostream& log);
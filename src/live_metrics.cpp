@@ -0,0 +1,329 @@
+#include "live_metrics.h"
+
+#include <algorithm>
+#include <bx/platform.h>
+#include <iomanip>
+#include <sstream>
+
+#if BX_PLATFORM_WINDOWS
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#else
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+// How often the server thread checks whether it's asked to stop, and how long a scraper may take to send its request.
+static const int STOP_CHECK_INTERVAL_MS = 200;
+static const int REQUEST_TIMEOUT_MS = 2000;
+
+// Requests are a request line and a few headers, anything longer is not a scraper.
+static const size_t MAX_REQUEST_SIZE = 8192;
+
+#if BX_PLATFORM_WINDOWS
+using Socket = SOCKET;
+static const Socket INVALID_SOCKET_HANDLE = INVALID_SOCKET;
+
+static void close_socket(Socket socket) noexcept {
+    closesocket(socket);
+}
+
+static int poll_sockets(pollfd* descriptors, size_t count, int milliseconds) noexcept {
+    return WSAPoll(descriptors, static_cast<ULONG>(count), milliseconds);
+}
+
+static const int SEND_FLAGS = 0;
+#else
+using Socket = int;
+static const Socket INVALID_SOCKET_HANDLE = -1;
+
+static void close_socket(Socket socket) noexcept {
+    close(socket);
+}
+
+static int poll_sockets(pollfd* descriptors, size_t count, int milliseconds) noexcept {
+    return poll(descriptors, static_cast<nfds_t>(count), milliseconds);
+}
+
+#if defined(MSG_NOSIGNAL)
+static const int SEND_FLAGS = MSG_NOSIGNAL;
+#else
+static const int SEND_FLAGS = 0;
+#endif
+#endif
+
+namespace {
+
+struct SocketWrapper final {
+    explicit SocketWrapper(Socket socket) noexcept
+            : socket(socket) {
+    }
+
+    SocketWrapper(const SocketWrapper&) = delete;
+    SocketWrapper(SocketWrapper&&) = delete;
+    SocketWrapper& operator=(const SocketWrapper&) = delete;
+    SocketWrapper& operator=(SocketWrapper&&) = delete;
+
+    ~SocketWrapper() {
+        if (socket != INVALID_SOCKET_HANDLE) {
+            close_socket(socket);
+        }
+    }
+
+    Socket socket;
+};
+
+} // namespace
+
+static void set_timeouts(Socket socket) noexcept {
+#if BX_PLATFORM_WINDOWS
+    const DWORD timeout = static_cast<DWORD>(REQUEST_TIMEOUT_MS);
+#else
+    const timeval timeout { REQUEST_TIMEOUT_MS / 1000, (REQUEST_TIMEOUT_MS % 1000) * 1000 };
+#endif
+    setsockopt(socket, SOL_SOCKET, SO_RCVTIMEO, reinterpret_cast<const char*>(&timeout), sizeof(timeout));
+    setsockopt(socket, SOL_SOCKET, SO_SNDTIMEO, reinterpret_cast<const char*>(&timeout), sizeof(timeout));
+}
+
+static bool send_all(Socket socket, const std::string& data) noexcept {
+    const char* begin = data.data();
+    size_t size = data.size();
+    while (size > 0) {
+        const auto sent = send(socket, begin, static_cast<int>(std::min(size, static_cast<size_t>(1 << 20))), SEND_FLAGS);
+        if (sent <= 0) {
+            return false;
+        }
+        begin += sent;
+        size -= static_cast<size_t>(sent);
+    }
+    return true;
+}
+
+// Reads the request line and the headers, the body of a GET request is empty. Returns false when the peer is gone
+// or too slow.
+static bool receive_request(Socket socket, std::string& request) {
+    char data[1024];
+    while (request.find("\r\n\r\n") == std::string::npos && request.find("\n\n") == std::string::npos) {
+        if (request.size() > MAX_REQUEST_SIZE) {
+            return false;
+        }
+        const auto received = recv(socket, data, sizeof(data), 0);
+        if (received <= 0) {
+            return false;
+        }
+        request.append(data, static_cast<size_t>(received));
+    }
+    return true;
+}
+
+static std::string create_response(const char* status, const char* content_type, const std::string& body) {
+    std::ostringstream response;
+    response << "HTTP/1.1 " << status << "\r\nContent-Type: " << content_type << "\r\nContent-Length: " << body.size() << "\r\nConnection: close\r\n\r\n" << body;
+    return response.str();
+}
+
+static void answer_request(const LiveMetrics& metrics, Socket socket) {
+    std::string request;
+    if (!receive_request(socket, request)) {
+        return;
+    }
+
+    // Query strings are ignored, scrapers may add their own parameters.
+    const std::string line = request.substr(0, request.find_first_of("\r\n"));
+    const bool is_get = line.compare(0, 4, "GET ") == 0;
+    const size_t path_end = line.find_first_of(" ?", 4);
+    const std::string path = is_get ? line.substr(4, path_end == std::string::npos ? std::string::npos : path_end - 4) : std::string();
+
+    if (!is_get) {
+        send_all(socket, create_response("405 Method Not Allowed", "text/plain; charset=utf-8", "Only GET is supported.\n"));
+    } else if (path != "/metrics") {
+        send_all(socket, create_response("404 Not Found", "text/plain; charset=utf-8", "Metrics are served at /metrics.\n"));
+    } else {
+        std::ostringstream body;
+        metrics.write(body);
+        send_all(socket, create_response("200 OK", "text/plain; version=0.0.4; charset=utf-8", body.str()));
+    }
+}
+
+LiveMetrics::~LiveMetrics() {
+    close();
+}
+
+bool LiveMetrics::listen(uint16_t port, std::ostream& log) {
+#if BX_PLATFORM_WINDOWS
+    WSADATA data;
+    if (WSAStartup(MAKEWORD(2, 2), &data) != 0) {
+        log << "Texture compiler error. Failed to listen for metrics scrapers on port " << port << "." << std::endl;
+        return false;
+    }
+#endif
+
+    Socket listener = ::socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    if (listener != INVALID_SOCKET_HANDLE) {
+        // A server restarted right after the previous one must not wait for the old port to time out.
+        const int reuse = 1;
+        setsockopt(listener, SOL_SOCKET, SO_REUSEADDR, reinterpret_cast<const char*>(&reuse), sizeof(reuse));
+
+        sockaddr_in address {};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_ANY);
+        address.sin_port = htons(port);
+        if (bind(listener, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0 || ::listen(listener, SOMAXCONN) != 0) {
+            close_socket(listener);
+            listener = INVALID_SOCKET_HANDLE;
+        }
+    }
+    if (listener == INVALID_SOCKET_HANDLE) {
+        log << "Texture compiler error. Failed to listen for metrics scrapers on port " << port << "." << std::endl;
+#if BX_PLATFORM_WINDOWS
+        WSACleanup();
+#endif
+        return false;
+    }
+
+    sockaddr_in address {};
+    socklen_t address_size = sizeof(address);
+    if (getsockname(listener, reinterpret_cast<sockaddr*>(&address), &address_size) == 0) {
+        port = ntohs(address.sin_port);
+    }
+    log << "Metrics are served on port " << port << "." << std::endl;
+
+    // Scrapes are answered one at a time, they take microseconds and come every few seconds at most.
+    server = std::thread([this, listener] {
+        const SocketWrapper wrapper(listener);
+        while (!is_stopping.load(std::memory_order_relaxed)) {
+            pollfd descriptor {};
+            descriptor.fd = wrapper.socket;
+            descriptor.events = POLLIN;
+            if (poll_sockets(&descriptor, 1, STOP_CHECK_INTERVAL_MS) <= 0 || (descriptor.revents & POLLIN) == 0) {
+                continue;
+            }
+
+            const SocketWrapper connection(accept(wrapper.socket, nullptr, nullptr));
+            if (connection.socket == INVALID_SOCKET_HANDLE) {
+                continue;
+            }
+            set_timeouts(connection.socket);
+
+            try {
+                answer_request(*this, connection.socket);
+            } catch (...) {
+                // A scrape that failed is repeated by the scraper, the process keeps compiling.
+            }
+        }
+    });
+    return true;
+}
+
+void LiveMetrics::record_job(const JobMetrics& job) {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    jobs[{ job.kind, job.compression, job.result }]++;
+
+    KindSeries& kind = kinds[job.kind];
+    for (size_t i = 0; i < DURATION_BUCKETS.size(); i++) {
+        if (job.wall_seconds <= DURATION_BUCKETS[i]) {
+            kind.buckets[i]++;
+        }
+    }
+    kind.count++;
+    kind.seconds += job.wall_seconds;
+
+    // Phases are only added by threads of the job, which are done with it.
+    const uint64_t encoded_pixels = job.encoded_pixels.load(std::memory_order_relaxed);
+    for (const PhaseMetrics& phase : job.phases) {
+        PhaseSeries& series = phases[phase.name];
+        series.count++;
+        series.seconds += phase.wall_seconds;
+        if (encoded_pixels != 0 && phase.name == "encode") {
+            kind.encode_seconds += phase.wall_seconds;
+        }
+    }
+    kind.encoded_pixels += encoded_pixels;
+
+    bytes_written += job.bytes_written;
+    if (job.peak_gpu_memory_usage != 0) {
+        gpu_memory_usage = job.peak_gpu_memory_usage;
+    }
+}
+
+void LiveMetrics::close() noexcept {
+    if (!server.joinable()) {
+        return;
+    }
+
+    is_stopping = true;
+    server.join();
+#if BX_PLATFORM_WINDOWS
+    WSACleanup();
+#endif
+}
+
+void LiveMetrics::write(std::ostream& stream) const {
+    stream << std::setprecision(9);
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    stream << "# HELP texture_compiler_jobs_total Jobs done by texture kind, compression and result.\n";
+    stream << "# TYPE texture_compiler_jobs_total counter\n";
+    for (const auto& [labels, count] : jobs) {
+        const auto& [kind, compression, result] = labels;
+        stream << "texture_compiler_jobs_total{kind=\"" << kind << "\",compression=\"" << compression << "\",result=\"" << result << "\"} " << count << "\n";
+    }
+
+    stream << "# HELP texture_compiler_job_duration_seconds Wall time of jobs by texture kind.\n";
+    stream << "# TYPE texture_compiler_job_duration_seconds histogram\n";
+    for (const auto& [name, kind] : kinds) {
+        for (size_t i = 0; i < DURATION_BUCKETS.size(); i++) {
+            stream << "texture_compiler_job_duration_seconds_bucket{kind=\"" << name << "\",le=\"" << DURATION_BUCKETS[i] << "\"} " << kind.buckets[i] << "\n";
+        }
+        stream << "texture_compiler_job_duration_seconds_bucket{kind=\"" << name << "\",le=\"+Inf\"} " << kind.count << "\n";
+        stream << "texture_compiler_job_duration_seconds_sum{kind=\"" << name << "\"} " << kind.seconds << "\n";
+        stream << "texture_compiler_job_duration_seconds_count{kind=\"" << name << "\"} " << kind.count << "\n";
+    }
+
+    stream << "# HELP texture_compiler_phase_duration_seconds Wall time of compilation phases, like decode, encode and readback.\n";
+    stream << "# TYPE texture_compiler_phase_duration_seconds summary\n";
+    for (const auto& [name, phase] : phases) {
+        stream << "texture_compiler_phase_duration_seconds_sum{phase=\"" << name << "\"} " << phase.seconds << "\n";
+        stream << "texture_compiler_phase_duration_seconds_count{phase=\"" << name << "\"} " << phase.count << "\n";
+    }
+
+    stream << "# HELP texture_compiler_encoded_pixels_total Pixels compressed into outputs by texture kind, every output counts.\n";
+    stream << "# TYPE texture_compiler_encoded_pixels_total counter\n";
+    for (const auto& [name, kind] : kinds) {
+        stream << "texture_compiler_encoded_pixels_total{kind=\"" << name << "\"} " << kind.encoded_pixels << "\n";
+    }
+
+    stream << "# HELP texture_compiler_encode_seconds_total Wall time of the encode phases that compressed texture_compiler_encoded_pixels_total.\n";
+    stream << "# TYPE texture_compiler_encode_seconds_total counter\n";
+    for (const auto& [name, kind] : kinds) {
+        stream << "texture_compiler_encode_seconds_total{kind=\"" << name << "\"} " << kind.encode_seconds << "\n";
+    }
+
+    stream << "# HELP texture_compiler_written_bytes_total Bytes of the outputs of jobs.\n";
+    stream << "# TYPE texture_compiler_written_bytes_total counter\n";
+    stream << "texture_compiler_written_bytes_total " << bytes_written << "\n";
+
+    stream << "# HELP texture_compiler_queued_jobs Server requests waiting in the queue or manifest jobs not started yet.\n";
+    stream << "# TYPE texture_compiler_queued_jobs gauge\n";
+    stream << "texture_compiler_queued_jobs " << queued_jobs.load(std::memory_order_relaxed) << "\n";
+
+    stream << "# HELP texture_compiler_running_jobs Jobs being compiled.\n";
+    stream << "# TYPE texture_compiler_running_jobs gauge\n";
+    stream << "texture_compiler_running_jobs " << running_jobs.load(std::memory_order_relaxed) << "\n";
+
+    stream << "# HELP texture_compiler_resident_memory_bytes Resident set size of the process.\n";
+    stream << "# TYPE texture_compiler_resident_memory_bytes gauge\n";
+    stream << "texture_compiler_resident_memory_bytes " << get_memory_usage() << "\n";
+
+    stream << "# HELP texture_compiler_peak_resident_memory_bytes Peak resident set size of the process.\n";
+    stream << "# TYPE texture_compiler_peak_resident_memory_bytes gauge\n";
+    stream << "texture_compiler_peak_resident_memory_bytes " << get_peak_memory_usage() << "\n";
+
+    stream << "# HELP texture_compiler_gpu_memory_bytes Peak texture and render target memory of the last cube map job rendered on the GPU.\n";
+    stream << "# TYPE texture_compiler_gpu_memory_bytes gauge\n";
+    stream << "texture_compiler_gpu_memory_bytes " << gpu_memory_usage << "\n";
+}
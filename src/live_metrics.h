@@ -0,0 +1,79 @@
+#pragma once
+
+#include "metrics.h"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <tuple>
+
+// Counters of the jobs a long running process compiled so far, served over HTTP by `--metrics-port` in the Prometheus
+// text format, so a server or the workers of a build farm can be scraped for dashboards, alerts and autoscaling. Jobs
+// are recorded once they're done, from the `JobMetrics` they measured anyway, so compiling only pays for the phase
+// timers and a lock per job. Gauges of the queue and the running jobs are atomics the callers update, and memory usage
+// is read when the metrics are scraped.
+struct LiveMetrics final {
+    // Upper bounds in seconds of the buckets of the job duration histogram, besides the implicit `+Inf` one.
+    static constexpr std::array<double, 12> DURATION_BUCKETS { 0.05, 0.1, 0.25, 0.5, 1.0, 2.5, 5.0, 10.0, 30.0, 60.0, 120.0, 300.0 };
+
+    LiveMetrics() noexcept = default;
+    ~LiveMetrics();
+
+    LiveMetrics(const LiveMetrics&) = delete;
+    LiveMetrics(LiveMetrics&&) = delete;
+    LiveMetrics& operator=(const LiveMetrics&) = delete;
+    LiveMetrics& operator=(LiveMetrics&&) = delete;
+
+    // Listens on the TCP port, zero for any free one, and answers `GET /metrics` on a thread of its own. Returns false
+    // when the port can't be listened on.
+    bool listen(uint16_t port, std::ostream& log);
+
+    // Adds a job that is done, whatever its result.
+    void record_job(const JobMetrics& job);
+
+    // Stops answering and closes the port.
+    void close() noexcept;
+
+    // Writes every metric in the Prometheus text format.
+    void write(std::ostream& stream) const;
+
+    // Server requests waiting in the queue or manifest jobs not started yet, and jobs inside `compile`.
+    std::atomic<int64_t> queued_jobs { 0 };
+    std::atomic<int64_t> running_jobs { 0 };
+
+private:
+    struct KindSeries final {
+        std::array<uint64_t, DURATION_BUCKETS.size()> buckets {};
+        uint64_t count = 0;
+        double seconds = 0.0;
+
+        // Only jobs whose outputs were compressed by `compress_outputs`, which counts the pixels it encodes.
+        uint64_t encoded_pixels = 0;
+        double encode_seconds = 0.0;
+    };
+
+    struct PhaseSeries final {
+        uint64_t count = 0;
+        double seconds = 0.0;
+    };
+
+    mutable std::mutex mutex;
+
+    // Keyed by kind, compression and result.
+    std::map<std::tuple<std::string, std::string, std::string>, uint64_t> jobs;
+    std::map<std::string, KindSeries> kinds;
+    std::map<std::string, PhaseSeries> phases;
+    uint64_t bytes_written = 0;
+
+    // Peak the renderer reported for the last cube map job rendered on the GPU.
+    uint64_t gpu_memory_usage = 0;
+
+    std::thread server;
+    std::atomic<bool> is_stopping { false };
+};
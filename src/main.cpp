@@ -1,1218 +1,3067 @@
-#include "cube_map_shader/cube_map_shader.fragment.h"
-#include "cube_map_shader/cube_map_shader.vertex.h"
-#include "irradiance_shader/irradiance_shader.fragment.h"
-#include "prefilter_shader/prefilter_shader.fragment.h"
-
-#include "stb_image.h"
-
-#include <bgfx/bgfx.h>
-#include <bgfx/embedded_shader.h>
-#include <bgfx/platform.h>
+#include "allocation_heap.h"
+#include "allocation_tracker.h"
+#include "archive.h"
+#include "atomic_file.h"
+#include "compiler.h"
+#include "cpu_features.h"
+#include "cpu_topology.h"
+#include "distributed.h"
+#include "gpu_bench.h"
+#include "gpu_layout.h"
+#include "heap.h"
+#include "io_threads.h"
+#include "mapped_file.h"
+#include "pack.h"
+#include "probe_array.h"
+#include "profiler.h"
+#include "progress_log.h"
+#include "remote_cache.h"
+#include "virtual_texture.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bx/platform.h>
+#include <cctype>
 #include <chrono>
 #include <clara.hpp>
-#include <glm/gtc/matrix_transform.hpp>
-#include <glm/gtc/type_ptr.hpp>
+#include <climits>
+#include <cmath>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
 #include <iomanip>
 #include <iostream>
-#include <nvtt/nvtt.h>
-#include <SDL2/SDL.h>
-#include <SDL2/SDL_syswm.h>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if BX_PLATFORM_WINDOWS
+#include <fcntl.h>
+#include <io.h>
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+static size_t get_physical_memory_size() noexcept {
+#if BX_PLATFORM_WINDOWS
+    MEMORYSTATUSEX status;
+    status.dwLength = sizeof(status);
+    if (GlobalMemoryStatusEx(&status)) {
+        return static_cast<size_t>(status.ullTotalPhys);
+    }
+    return 0;
+#else
+    const long pages = sysconf(_SC_PHYS_PAGES);
+    const long page_size = sysconf(_SC_PAGE_SIZE);
+    if (pages > 0 && page_size > 0) {
+        return static_cast<size_t>(pages) * static_cast<size_t>(page_size);
+    }
+    return 0;
+#endif
+}
 
-struct TextureCompilerErrorHandler final : nvtt::ErrorHandler {
-    void error(nvtt::Error e) final;
+// Limits the total estimated memory of the jobs in flight, and their number. A job that doesn't fit into the budget on
+// its own is allowed to run once nothing else is in flight.
+struct MemoryBudget final {
+    MemoryBudget(size_t limit, size_t job_limit) noexcept;
+
+    MemoryBudget(const MemoryBudget&) = delete;
+    MemoryBudget(MemoryBudget&&) = delete;
+    MemoryBudget& operator=(const MemoryBudget&) = delete;
+    MemoryBudget& operator=(MemoryBudget&&) = delete;
+
+    void acquire(size_t size);
+    bool try_acquire(size_t size);
+    void release(size_t size);
+
+    std::mutex mutex;
+    std::condition_variable condition;
+    size_t limit;
+    size_t job_limit;
+    size_t used = 0;
+    size_t jobs = 0;
 };
 
-void TextureCompilerErrorHandler::error(nvtt::Error e) {
-    std::cout << "\rTexture compiler error. " << nvtt::errorString(e) << std::endl;
+MemoryBudget::MemoryBudget(size_t limit, size_t job_limit) noexcept
+        : limit(limit)
+        , job_limit(job_limit) {
+}
+
+void MemoryBudget::acquire(size_t size) {
+    std::unique_lock<std::mutex> lock(mutex);
+    condition.wait(lock, [&] {
+        return jobs == 0 || (used + size <= limit && jobs < job_limit);
+    });
+    used += size;
+    jobs++;
+}
+
+// Acquires the budget only when `acquire` wouldn't wait for it.
+bool MemoryBudget::try_acquire(size_t size) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (jobs != 0 && (used + size > limit || jobs >= job_limit)) {
+        return false;
+    }
+    used += size;
+    jobs++;
+    return true;
+}
+
+void MemoryBudget::release(size_t size) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        used -= size;
+        jobs--;
+    }
+    condition.notify_all();
 }
 
-enum class Compression {
-    GOOD_BUT_SLOW,
-    POOR_BUT_FAST,
-    NO_COMPRESSION
+struct CommandLine final {
+    bool is_albedo_roughness = false;                   // PNG
+    bool is_normal_metalness_ambient_occlusion = false; // PNG
+    bool is_parallax = false;                           // PNG
+    bool is_cube_map = false;                           // HDR
+
+    bool is_production = false;
+    bool is_development = false;
+    bool is_no_compression = false;
+    bool is_progressive = false;
+    bool is_delta = false;             // 2D textures only
+    float warm_start = 0.f;            // 2D textures only
+
+    std::string input;
+    std::string output;
+    size_t output_size = 0;            // Cube map only
+    std::string output_irradiance;     // Cube map only
+    size_t output_irradiance_size = 0; // Cube map only
+    std::string output_prefilter;      // Cube map only
+    size_t output_prefilter_size = 0;  // Cube map only
+    size_t prefilter_samples = 0;      // Cube map only
+    size_t prefilter_levels = 0;       // Cube map only
+    bool is_irradiance_sh = false;     // Cube map only
+    std::string irradiance_format;     // Cube map only
+    bool is_octahedral = false;        // Cube map only
+    bool is_combined_convolution = false; // Cube map only
+    std::string output_brdf_lut;       // BRDF LUT only
+    size_t output_brdf_lut_size = 0;   // BRDF LUT only
+    bool is_streaming = false;         // 2D textures only
+    std::string encoder;
+    std::string quality;
+    std::vector<std::string> mip_qualities; // 2D textures only
+    float max_error = 0.f;             // 2D textures only
+    float auto_quality = 0.f;          // 2D textures only
+    std::string target;                // 2D textures only
+    std::string container;             // 2D textures only
+    std::string layout;
+    size_t mip_tail = 0;               // 2D textures only
+    bool is_checksums = false;
+    float rdo_lambda = 0.f;            // 2D textures only
+    std::vector<std::string> extra_outputs; // 2D textures only
+    std::string mask_output;           // Normal metalness ambient occlusion only
+    bool is_auto_format = false;       // Albedo roughness only
+    std::string mip_filter;            // 2D textures only
+    bool is_linear_mips = false;       // Albedo roughness only
+    bool is_roughness_mips = false;    // Albedo roughness only
+    std::string roughness_normal_map;  // Albedo roughness only
+    bool is_r16 = false;               // Parallax only
+    size_t max_size = 0;               // 2D textures only
+    size_t mips = 0;                   // 2D textures only
+    bool is_no_mips = false;           // 2D textures only
+    size_t min_mip_size = 0;           // 2D textures only
+    bool is_stats = false;             // 2D textures only
+    bool is_derive = false;            // 2D textures only
+    size_t tiles = 0;                  // 2D textures only
+    size_t tile_border = SIZE_MAX;     // 2D textures with --tiles only
+    std::vector<std::string> layers;   // 2D textures only
+    std::vector<std::string> faces;    // Cube map only
+    std::string albedo;                // Albedo roughness only
+    std::string roughness;             // Albedo roughness only
+    std::string normal;                // Normal metalness ambient occlusion only
+    std::string metalness;             // Normal metalness ambient occlusion only
+    std::string ambient_occlusion;     // Normal metalness ambient occlusion only
+
+    std::string manifest;
+    size_t jobs = 0;
+    size_t memory_budget = 0; // Manifest only
+    size_t input_locality = 0;   // Manifest only
+    bool is_schedule_report = false; // Manifest only
+    size_t time_budget = 0;
+    size_t job_time_limit = 0;   // Manifest only
+    size_t job_memory_limit = 0; // Manifest only
+    std::string cost_history;
+    std::string checkpoint;   // Manifest only
+    std::string progress;     // Manifest only
+    std::string cache;
+    std::string remote_cache;
+    bool is_remote_filtered = false;
+    size_t cache_size = 0;
+    bool is_source_cached = false;
+    std::string shader_cache;
+    bool is_memory_reused = false;
+    bool is_huge_pages = false;
+    std::string cpu_features;
+    bool is_pinned = false;
+    bool is_incremental = false;
+    std::string metrics;
+    std::string trace;
+    std::string profile;
+    int metrics_port = -1;    // Manifest, server and worker only
+    bool is_hardware_counters = false;
+    bool is_allocation_tracked = false;
+    bool is_no_compute = false;
+    bool is_gpu_mips = false;
+    bool is_headless = false;
+    std::string backend;
+    std::string renderer;
+    int gpu = -1;
+    size_t gpus = 0;          // Manifest only
+    size_t processes = 0;     // Manifest only
+    bool is_verbose = false;
+    bool is_report_quality = false;
+    bool is_report_blocks = false;
+    bool is_server = false;
+    std::string watch;        // Manifest only
+    std::string pack;         // Manifest only
+    std::string probe_array;  // Manifest only
+    bool is_dry_run = false;  // Manifest only
+    size_t coordinator = 0;   // Manifest only
+    std::string worker;
+    bool is_bench_gpu = false;
+    std::string bench_output_sizes;       // GPU benchmark only
+    std::string bench_irradiance_sizes;   // GPU benchmark only
+    std::string bench_prefilter_sizes;    // GPU benchmark only
+    std::string bench_prefilter_samples;  // GPU benchmark only
+    size_t bench_runs = 0;                // GPU benchmark only
+
+    bool is_help = false;
 };
 
-struct RgbaWrapper final {
-    explicit RgbaWrapper(const std::string& path) noexcept
-            : data(stbi_load(path.c_str(), &width, &height, &channels, 4)) {
+static clara::Parser create_command_line_parser(CommandLine& command_line) {
+    return clara::Opt(command_line.is_albedo_roughness)["--albedo-roughness"]("Input contains albedo map and roughness map") |
+            clara::Opt(command_line.is_normal_metalness_ambient_occlusion)["--normal-metalness-ambient-occlusion"]("Input contains normal, metalness and ambient occlusion maps") |
+            clara::Opt(command_line.is_parallax)["--parallax"]("Input contains parallax map") |
+            clara::Opt(command_line.is_cube_map)["--cube-map"]("Input contains cube map") |
+            clara::Opt(command_line.input, "example.png")["--input"]("Input texture path, - reads it from the standard input (2D textures only)") |
+            clara::Opt(command_line.output, "example.texture")["--output"]("Output texture path, - writes it to the standard output (2D textures only, cube maps can skip it when --irradiance or --prefilter is set)") |
+            clara::Opt(command_line.output_size, "1024")["--output-size"]("Output texture size (needed only for cube map, 2D textures are output at the input size limited by --max-size)") |
+            clara::Opt(command_line.output_irradiance, "irradiance.texture")["--irradiance"]("Output irradiance texture path (cube map only, no irradiance is compiled without it)") |
+            clara::Opt(command_line.output_irradiance_size, "32")["--irradiance-size"]("Output irradiance texture size (needed only for cube map with --irradiance)") |
+            clara::Opt(command_line.output_prefilter, "prefilter.texture")["--prefilter"]("Output prefilter texture path (cube map only, no prefilter is compiled without it)") |
+            clara::Opt(command_line.output_prefilter_size, "128")["--prefilter-size"]("Output prefilter texture size (needed only for cube map with --prefilter)") |
+            clara::Opt(command_line.is_irradiance_sh)["--irradiance-sh"]("Compute irradiance from spherical harmonics of the cube map on the CPU instead of integrating it on the GPU (cube map only)") |
+            clara::Opt(command_line.irradiance_format, "rgba16f")["--irradiance-format"]("Texel format of the irradiance output, rgba16f (default), r11g11b10f or rgb9e5, the packed formats are half the size (cube map only)") |
+            clara::Opt(command_line.is_octahedral)["--octahedral"]("Write the cube map, irradiance and prefilter outputs as 2D octahedral maps of their sizes, projected from the input on the CPU (cube map only)") |
+            clara::Opt(command_line.prefilter_samples, "1024")["--prefilter-samples"]("Number of prefilter samples per pixel of the roughest mip levels, smoother mip levels use fewer (cube map only, defaults to 1024)") |
+            clara::Opt(command_line.is_combined_convolution)["--combined-convolution"]("Integrate the irradiance and the rough prefilter mip levels on the CPU backend in a single pass over the texels of a small mip level of the cube map, weighted by the cosine and GGX lobes, instead of sampling the environment for each of them (cube map only)") |
+            clara::Opt(command_line.prefilter_levels, "5")["--prefilter-levels"]("Number of prefilter mip levels to render and write, roughness grows linearly from 0 at the first one to 1 at the last one (cube map only, defaults to the full mip chain with roughness 1 from the fifth mip level on)") |
+            clara::Opt(command_line.output_brdf_lut, "brdf_lut.texture")["--brdf-lut"]("Output path of the split sum GGX BRDF LUT of image based lighting, RG16F with --no-compression and BC5 otherwise, a job of its own without an input") |
+            clara::Opt(command_line.output_brdf_lut_size, "256")["--brdf-lut-size"]("Output BRDF LUT size (needed only with --brdf-lut)") |
+            clara::Opt(command_line.is_streaming)["--streaming"]("Compile the first mip level of normal maps in bands of rows to limit memory usage, always on for normal maps larger than 4096x4096 and for albedo roughness and parallax textures (not for cube map)") |
+            clara::Opt(command_line.encoder, "nvtt")["--encoder"]("Encoder of BC7 --production albedo roughness and normal metalness ambient occlusion textures and BC6H cube maps, nvtt (default) or fast for the built-in encoders of BC7 modes 5 and 6 and BC6H mode 11") |
+            clara::Opt(command_line.quality, "normal")["--quality"]("Compression quality of the encoder, fastest, normal (default), production or highest") |
+            clara::Opt(command_line.mip_qualities, "2=highest")["--mip-quality"]("Compression quality of the mip levels from the level of the output on, counted from 0 for the largest, in place of --quality, can be repeated for several tiers (not for cube map)") |
+            clara::Opt(command_line.max_error, "2.0")["--max-error"]("Encode every block at the fastest quality first and again at --quality only when its RMSE over the 8-bit channels exceeds the value, for --encoder fast with --production (not for cube map)") |
+            clara::Opt(command_line.auto_quality, "42.0")["--auto-quality"]("Pick the quality that reaches the target PSNR in the least time on a sample of the blocks of the largest mip level, in place of --quality, for --encoder fast with --production (not for cube map)") |
+            clara::Opt(command_line.target, "bc")["--target"]("Block compression of compressed textures, bc (default) for BC3, BC4 and BC7, etc2 for ETC2 RGBA8 and EAC R11, astc for ASTC 4x4 or uastc for UASTC of Basis Universal transcoded at runtime, targets but bc default to --container ktx2 (not for cube map)") |
+            clara::Opt(command_line.container, "dds")["--container"]("Output container, dds (default), ktx2 with mip levels supercompressed by Zstandard or ktx2-raw with uncompressed mip levels for memory mapping, or dds-gdeflate with every mip level compressed by GDeflate for DirectStorage GPU decompression (not for cube map)") |
+            clara::Opt(command_line.layout, "d3d12")["--layout"]("Lay the mip levels of DDS outputs out in the copy footprints of d3d12, rows aligned to 256 bytes and every mip level to 512 bytes, or vulkan, tight rows and every mip level aligned to 16 bytes, so they upload from the file without a staging copy") |
+            clara::Opt(command_line.mip_tail, "128")["--mip-tail"]("Pack the mip levels with a side smaller than this size, a power of two, into a single tail per layer, compressed with one call and described by a table at the end of DDS outputs, for sparse textures that map the tail at once (not with --layout and --tiles, not for cube map)") |
+            clara::Opt(command_line.is_checksums)["--checksums"]("Append a table with a hash of every mip level of every layer to DDS outputs, so runtimes verify streamed levels against it instead of hashing them on load (not with --tiles)") |
+            clara::Opt(command_line.rdo_lambda, "4.0")["--rdo"]("Replace blocks with copies of similar recent blocks when the squared error is below lambda per saved bit, so packages compress better (BC1, BC3, BC4 and BC7, not for cube map)") |
+            clara::Opt(command_line.is_delta)["--delta"]("Keep the encoded blocks in a .blocks file next to the output and encode again only the 32x32 tiles of mip levels that changed, for the built-in encoders: --encoder fast with --production, --target etc2 or astc (not for cube map)") |
+            clara::Opt(command_line.warm_start, "2.0")["--warm-start"]("With --delta, keep the previous block of a changed tile instead of encoding it again when the RMSE of its decoded 8-bit channels against the new pixels is at most this value (not for uastc, not for cube map)") |
+            clara::Opt(command_line.extra_outputs, "development=example.development.texture")["--extra-output"]("Another output of the texture with production, development or no-compression compression, compiled from the same decoded image and mip levels, can be repeated (not for cube map)") |
+            clara::Opt(command_line.mask_output, "example_mask.texture")["--mask-output"]("Compress the normal to BC5 and write metalness and ambient occlusion to another BC5 output, compressed in parallel, instead of a single BC7 or BC3 output, for --target bc with compression (normal metalness ambient occlusion only)") |
+            clara::Opt(command_line.is_auto_format)["--auto-format"]("Analyze the decoded image and compress opaque textures to BC1 instead of BC7 or BC3 and flat ones to a single pixel, the picks are written to --metrics, for --target bc with compression (albedo roughness only)") |
+            clara::Opt(command_line.mip_filter, "box")["--mip-filter"]("Mip map filter, box (default) averages every 2x2 pixels, kaiser or lanczos keep lower mip levels sharper (not for cube map)") |
+            clara::Opt(command_line.is_linear_mips)["--linear-mips"]("Filter albedo mip maps in linear space rather than in sRGB, so that downsampled albedo keeps its brightness (albedo roughness only)") |
+            clara::Opt(command_line.is_roughness_mips)["--roughness-mips"]("Filter roughness mip maps as GGX alpha squared, so that lower mip levels keep the average width of the specular highlights (albedo roughness only)") |
+            clara::Opt(command_line.roughness_normal_map, "example_normal.png")["--roughness-normal-map"]("Normal metalness ambient occlusion input of the material, roughness of lower mip levels is widened by the variance of its normals (Toksvig), implies --roughness-mips (albedo roughness only)") |
+            clara::Opt(command_line.is_r16)["--r16"]("Write outputs without compression as R16 instead of R8, so 16-bit height maps and their mip levels keep 16 bits (parallax only)") |
+            clara::Opt(command_line.max_size, "2048")["--max-size"]("Maximum size of both sides of the output, mip levels larger than that are filtered but dropped from the output (not for cube map)") |
+            clara::Opt(command_line.mips, "1")["--mips"]("Number of mip levels of the output, the smaller levels are neither filtered nor encoded (defaults to the whole chain down to 1x1, not for cube map)") |
+            clara::Opt(command_line.is_no_mips)["--no-mips"]("Write only the first mip level, for UI and lookup textures that are never sampled from smaller levels, same as --mips 1 (not for cube map)") |
+            clara::Opt(command_line.min_mip_size, "4")["--min-mip-size"]("End the mip chain at the last level with both sides at least this size, the first level of the output is always written (not for cube map)") |
+            clara::Opt(command_line.is_stats)["--stats"]("Write the average, minimum and maximum of every channel and the alpha coverage of every mip level and a hash of the output to a binary .stats file next to it, so runtimes don't scan the texels at load time (not for cube map)") |
+            clara::Opt(command_line.is_derive)["--derive"]("Input is a DDS output of an earlier compilation of a higher tier to derive this one from, its levels above --max-size are dropped and its blocks are copied as they are when the format is the same, or decoded and compressed level by level without filtering when it isn't (not for cube map)") |
+            clara::Opt(command_line.tiles, "128")["--tiles"]("Write a virtual texture with every mip level split into pages of this size, a power of two, encoded on their own with borders, for the built-in encoders and --no-compression (not for cube map)") |
+            clara::Opt(command_line.tile_border, "4")["--tile-border"]("Texels of the neighbors around every page of --tiles, an even number up to 64 (defaults to 4)") |
+            clara::Opt(command_line.layers, "example_layer.png")["--layer"]("Another layer of the same size as the input, the output is a texture array of the input and all the layers in order, can be repeated (not for cube map)") |
+            clara::Opt(command_line.faces, "example_px.hdr")["--face"]("Cube map face used instead of --input, repeated six times in the order +X, -X, +Y, -Y, +Z, -Z (cube map only)") |
+            clara::Opt(command_line.albedo, "example_albedo.png")["--albedo"]("Albedo input in RGB, used instead of --input (albedo roughness only)") |
+            clara::Opt(command_line.roughness, "example_roughness.png")["--roughness"]("Roughness input in its red channel, packed into alpha of --albedo or --input (albedo roughness only)") |
+            clara::Opt(command_line.normal, "example_normal.png")["--normal"]("Normal input in RG, used instead of --input (normal metalness ambient occlusion only)") |
+            clara::Opt(command_line.metalness, "example_metalness.png")["--metalness"]("Metalness input in its red channel, packed into blue of --normal or --input (normal metalness ambient occlusion only)") |
+            clara::Opt(command_line.ambient_occlusion, "example_ao.png")["--ao"]("Ambient occlusion input in its red channel, packed into alpha of --normal or --input (normal metalness ambient occlusion only)") |
+            clara::Opt(command_line.is_production)["--production"]("Good but slow texture compression") |
+            clara::Opt(command_line.is_development)["--development"]("Poor but quick texture compression") |
+            clara::Opt(command_line.is_no_compression)["--no-compression"]("No texture compression") |
+            clara::Opt(command_line.is_progressive)["--progressive"]("Write the outputs with --development first and overwrite them when the --production compression is done, so tools can show the texture right away, cube maps also bake irradiance and prefilter maps with few samples first (--production or cube map only)") |
+            clara::Opt(command_line.manifest, "manifest.txt")["--manifest"]("Compile all the jobs listed in the manifest file, one job per line in the command line format") |
+            clara::Opt(command_line.is_server)["--server"]("Keep running and compile jobs read from the standard input, one request per line with an identifier, a priority and the job in the command line format") |
+            clara::Opt(command_line.watch, "textures")["--watch"]("Keep running after the manifest is compiled and recompile the jobs whose inputs in the directory change, with --development first and with their own compression once idle") |
+            clara::Opt(command_line.coordinator, "7300")["--coordinator"]("Hand the manifest jobs out to --worker processes on other build nodes connecting to this TCP port, inputs and outputs must be on shared storage") |
+            clara::Opt(command_line.worker, "host:7300")["--worker"]("Keep compiling the manifest jobs of the --coordinator at this address until it has no more") |
+            clara::Opt(command_line.processes, "4")["--processes"]("Compile the manifest in this many worker processes, each with its share of the --jobs threads, so a crash in nvtt or a driver fails only the job that caused it, crashed workers are started again") |
+            clara::Opt(command_line.pack, "textures.pack")["--pack"]("Write every output of the manifest into a single pack file with an index of names, formats, sizes and mip levels and the data aligned for memory mapping and DMA (DDS outputs only)") |
+            clara::Opt(command_line.probe_array, "probes")["--probe-array"]("Write the irradiance and prefilter outputs of every cube map job of the manifest into <probes>.irradiance.dds and <probes>.prefilter.dds texture arrays with a slice per job and <probes>.index listing the slices") |
+            clara::Opt(command_line.is_dry_run)["--dry-run"]("Compile nothing and print the expected wall time of the manifest at --jobs threads, the peak memory of the jobs in flight and the longest jobs, from the --cost-history, the cost model, --incremental and the local --cache") |
+            clara::Opt(command_line.jobs, "8")["--jobs"]("Number of threads compiling jobs and compressing blocks (defaults to the number of hardware threads)") |
+            clara::Opt(command_line.memory_budget, "16384")["--memory-budget"]("Maximum estimated memory in megabytes of manifest jobs compiled at the same time (defaults to the physical memory size)") |
+            clara::Opt(command_line.input_locality, "64")["--input-locality"]("Reorder manifest jobs by the directory and the place on disk of their inputs within windows of this many jobs of the longest first order, and read the inputs of the following jobs ahead in that order, for inputs on hard disks and network shares") |
+            clara::Opt(command_line.is_schedule_report)["--schedule-report"]("Print how busy every thread was, how long manifest jobs waited for memory and threads, which jobs were GPU-bound and the critical path of jobs after the build, also written to --metrics") |
+            clara::Opt(command_line.time_budget, "500")["--time-budget"]("Milliseconds a 2D job should take, jobs estimated to take longer by a cost model learned from the jobs compiled so far use lower qualities, the largest mip levels first (not for cube map)") |
+            clara::Opt(command_line.job_time_limit, "60")["--job-time-limit"]("Seconds a manifest job may take, 2D jobs expected to take longer use lower qualities like with --time-budget, jobs still expected to exceed it are compiled one at a time after the rest, and jobs that took longer are reported") |
+            clara::Opt(command_line.job_memory_limit, "4096")["--job-memory-limit"]("Megabytes of memory a manifest job may take, jobs expected to take more are compiled one at a time after the rest, and jobs that took more are reported") |
+            clara::Opt(command_line.cost_history, "costs.txt")["--cost-history"]("Record the wall time and memory of every compiled job in a file and start the longest manifest jobs first next time, admitting them by the memory they took") |
+            clara::Opt(command_line.progress, "progress.jsonl")["--progress"]("Write the start, the progress at most every 200 ms and the end of every manifest job with its messages to a file as JSON lines, for dashboards and IDEs") |
+            clara::Opt(command_line.checkpoint, "checkpoint")["--checkpoint"]("Record completed manifest jobs and the compressed mip levels of long ones in a directory, so a build that crashed or was killed resumes where it stopped (removed once the build succeeds)") |
+            clara::Opt(command_line.cache, "cache")["--cache"]("Directory of the compilation cache, jobs whose input and options didn't change are copied from it instead of compiled") |
+            clara::Opt(command_line.remote_cache, "http://cache:8080/textures")["--remote-cache"]("Remote compilation cache URL (http:// or file://), used together with --cache as a shared storage behind it") |
+            clara::Opt(command_line.is_remote_filtered)["--remote-filter"]("Keep a Bloom filter of the keys in the --remote-cache and skip the lookups of keys it doesn't have, every process writing to the remote must use it") |
+            clara::Opt(command_line.cache_size, "10240")["--cache-size"]("Maximum size in megabytes of the --cache directory, least recently used entries are removed when it's exceeded") |
+            clara::Opt(command_line.is_source_cached)["--cache-sources"]("Keep decoded 2D inputs in the --cache directory too, so jobs whose options change skip decoding their inputs again") |
+            clara::Opt(command_line.shader_cache, "shaders")["--shader-cache"]("Directory of compiled shader programs and pipeline caches of the GPU backend, reused by later processes instead of compiling the shaders again (defaults to the shaders directory of --cache)") |
+            clara::Opt(command_line.is_memory_reused)["--reuse-memory"]("Keep memory freed by a job for the next jobs of the process instead of returning it to the operating system, which saves page faults in batches of large textures at the cost of holding the peak memory usage (Linux only)") |
+            clara::Opt(command_line.is_huge_pages)["--huge-pages"]("Back decoded images, nvtt surfaces and other large buffers with 2 MiB transparent huge pages, which saves page faults and TLB misses on large textures (Linux with glibc 2.35 or later only)") |
+            clara::Opt(command_line.cpu_features, "avx2")["--cpu-features"]("Instruction set of pixel kernels and mip filters, scalar, sse2, avx2 or neon, to compare them (defaults to the best one the CPU supports)") |
+            clara::Opt(command_line.is_pinned)["--pin-threads"]("Pin worker threads to logical CPUs, keep the tasks of a job on its NUMA node and leave long jobs to performance cores of hybrid CPUs (Linux only)") |
+            clara::Opt(command_line.is_incremental)["--incremental"]("Skip jobs whose outputs were compiled from the same input with the same options, according to the .meta files written next to the outputs") |
+            clara::Opt(command_line.metrics, "metrics.json")["--metrics"]("Write wall and CPU time of every compilation phase, peak memory usage and output sizes of every job to a JSON file") |
+            clara::Opt(command_line.metrics_port, "9464")["--metrics-port"]("Serve counters of jobs, phases, encoded pixels, the queue and memory usage at /metrics on this TCP port in the Prometheus text format while a --server, --worker or --manifest runs") |
+            clara::Opt(command_line.is_hardware_counters)["--hardware-counters"]("Count cycles, instructions, cache misses, data TLB misses and branch misses of the process during every phase of --metrics and --trace with the CPU performance counters (Linux only)") |
+            clara::Opt(command_line.is_allocation_tracked)["--track-allocations"]("Count heap allocations, allocated bytes and the peak of live bytes of every phase of every job in --metrics, and record the peak heap usage of jobs in --cost-history even when they run in parallel (Linux with glibc, builds with TEXTURE_COMPILER_ALLOCATION_TRACKING only)") |
+            clara::Opt(command_line.trace, "trace.json")["--trace"]("Write every job and compilation phase on the thread that ran it to a Chrome trace event file for Perfetto or chrome://tracing") |
+            clara::Opt(command_line.profile, "profile.folded")["--profile"]("Sample the stacks of the process every millisecond of CPU time and write them, tagged with their job and phase, as folded stacks for flame graphs") |
+            clara::Opt(command_line.is_headless)["--headless"]("Render cube maps without a window, for machines without a display") |
+            clara::Opt(command_line.is_no_compute)["--no-compute"]("Render cube maps one face at a time even when the renderer supports compute shaders") |
+            clara::Opt(command_line.is_gpu_mips)["--gpu-mips"]("Build the box filtered mip levels of 2D textures with compute shaders on the renderer of cube maps when it supports them") |
+            clara::Opt(command_line.backend, "auto")["--backend"]("Render cube maps on the GPU (gpu), on the CPU (cpu) or on the GPU when a renderer is available and on the CPU otherwise (auto, default)") |
+            clara::Opt(command_line.renderer, "auto")["--renderer"]("Graphics API of the GPU backend, vulkan, d3d11, d3d12, metal, gl or the one of the platform with the lowest readback latency (auto, default)") |
+            clara::Opt(command_line.gpu, "0")["--gpu"]("Render cube maps on the GPU of this index among the GPUs the renderer finds (defaults to the one the renderer picks)") |
+            clara::Opt(command_line.gpus, "2")["--gpus"]("Compile the manifest in this many worker processes rendering on --gpu 0 to the count minus one, each with its share of the --jobs threads") |
+            clara::Opt(command_line.is_verbose)["--verbose"]("Print the GPU time of every view of cube maps rendered on the GPU, which --metrics also writes") |
+            clara::Opt(command_line.is_report_quality)["--report-quality"]("Print PSNR and SSIM of every mip level of compressed 2D textures against the level without compression, and the angular error of normal maps, which --metrics also writes") |
+            clara::Opt(command_line.is_report_blocks)["--report-blocks"]("Print the share of every BC7 and BC6H mode in the blocks of every mip level of compressed outputs, with the error of the blocks of every mode together with --report-quality, and write the modes, partitions and block errors to --metrics") |
+            clara::Opt(command_line.is_bench_gpu)["--bench-gpu"]("Compile cube maps of a synthetic sky at every combination of the --bench-* sizes and sample counts and print the wall time, the GPU time of every pass, the readback time and the CPU time of encoding of every one") |
+            clara::Opt(command_line.bench_output_sizes, "256,512,1024")["--bench-output-sizes"]("Comma separated cube map sizes of --bench-gpu (defaults to 256,512,1024)") |
+            clara::Opt(command_line.bench_irradiance_sizes, "32,64")["--bench-irradiance-sizes"]("Comma separated irradiance sizes of --bench-gpu (defaults to 32,64)") |
+            clara::Opt(command_line.bench_prefilter_sizes, "128,256")["--bench-prefilter-sizes"]("Comma separated prefilter sizes of --bench-gpu (defaults to 128,256)") |
+            clara::Opt(command_line.bench_prefilter_samples, "256,1024")["--bench-prefilter-samples"]("Comma separated prefilter sample counts of --bench-gpu (defaults to 256,1024)") |
+            clara::Opt(command_line.bench_runs, "3")["--bench-runs"]("Timed runs of every combination of --bench-gpu after an untimed one (defaults to 3)") |
+            clara::Help(command_line.is_help);
+}
+
+// Parses the encoder quality of `--quality` and `--mip-quality`, an empty name is the default.
+static bool parse_quality(const std::string& name, nvtt::Quality& quality) noexcept {
+    if (name.empty() || name == "normal") {
+        quality = nvtt::Quality_Normal;
+    } else if (name == "fastest") {
+        quality = nvtt::Quality_Fastest;
+    } else if (name == "production") {
+        quality = nvtt::Quality_Production;
+    } else if (name == "highest") {
+        quality = nvtt::Quality_Highest;
+    } else {
+        return false;
     }
+    return true;
+}
 
-    RgbaWrapper(const RgbaWrapper&) = delete;
-    RgbaWrapper(RgbaWrapper&&) = delete;
-    RgbaWrapper& operator=(const RgbaWrapper&) = delete;
-    RgbaWrapper& operator=(RgbaWrapper&&) = delete;
+static bool has_job_arguments(const CommandLine& command_line) noexcept;
 
-    ~RgbaWrapper() {
-        if (data != nullptr) {
-            stbi_image_free(data);
-        }
+// BRDF LUT jobs take only a compression and `--quality` besides the output and its size.
+static int create_brdf_lut_job(const CommandLine& command_line, CompileJob& job) noexcept {
+    if (command_line.output_brdf_lut.empty() || command_line.output_brdf_lut_size == 0) {
+        std::cout << "Texture compiler error. Command line arguments --brdf-lut and --brdf-lut-size must be set together." << std::endl;
+        return 1;
     }
 
-    int width;
-    int height;
-    int channels;
-    stbi_uc* data;
-};
+    if (command_line.output_brdf_lut_size > 65535) {
+        std::cout << "Texture compiler error. Invalid output size." << std::endl;
+        return 1;
+    }
 
-static int compile_albedo_roughness(const std::string& input, const std::string& output, Compression compression) noexcept {
-    RgbaWrapper data(input);
-    if (data.data == nullptr) {
-        std::cout << "Texture compiler error. Failed to load a texture." << std::endl;
+    CommandLine other_arguments = command_line;
+    other_arguments.output_brdf_lut.clear();
+    other_arguments.output_brdf_lut_size = 0;
+    other_arguments.is_production = false;
+    other_arguments.is_development = false;
+    other_arguments.is_no_compression = false;
+    other_arguments.quality.clear();
+    if (has_job_arguments(other_arguments)) {
+        std::cout << "Texture compiler error. Command line arguments --brdf-lut and --brdf-lut-size can only be combined with --production, --development, --no-compression and --quality." << std::endl;
         return 1;
     }
 
-    if (data.width <= 0 || data.height <= 0 || data.width > 65535 || data.height > 65535 || (data.width & (data.width - 1)) != 0 || (data.height & (data.height - 1)) != 0) {
-        std::cout << "Texture compiler error. Image size is not power of two." << std::endl;
+    if (static_cast<int32_t>(command_line.is_production) + static_cast<int32_t>(command_line.is_development) + static_cast<int32_t>(command_line.is_no_compression) != 1) {
+        std::cout << "Texture compiler error. Either --development, --production or --no-compression command line argument must be set." << std::endl;
         return 1;
     }
 
-    // Convert RGBA to BGRA.
-    for (int i = 0; i < data.width * data.height; i++) {
-        std::swap(data.data[i * 4], data.data[i * 4 + 2]);
+    if (command_line.is_production) {
+        job.compression = Compression::GOOD_BUT_SLOW;
+    } else if (command_line.is_development) {
+        job.compression = Compression::POOR_BUT_FAST;
+    } else {
+        job.compression = Compression::NO_COMPRESSION;
     }
 
-    nvtt::Surface surface;
-    if (!surface.setImage(nvtt::InputFormat_BGRA_8UB, data.width, data.height, 1, data.data)) {
-        std::cout << "Texture compiler error. Failed to set an image." << std::endl;
+    if (!parse_quality(command_line.quality, job.quality)) {
+        std::cout << "Texture compiler error. Command line argument --quality must be fastest, normal, production or highest." << std::endl;
         return 1;
     }
 
-    surface.setWrapMode(nvtt::WrapMode_Repeat);
-    surface.setAlphaMode(nvtt::AlphaMode_Transparency);
-    surface.setNormalMap(false);
+    job.kind = TextureKind::BRDF_LUT;
+    job.output = command_line.output_brdf_lut;
+    job.output_size = command_line.output_brdf_lut_size;
+    return 0;
+}
+
+static int create_compile_job(const CommandLine& command_line, CompileJob& job) noexcept {
+    if (!command_line.output_brdf_lut.empty() || command_line.output_brdf_lut_size != 0) {
+        return create_brdf_lut_job(command_line, job);
+    }
 
-    TextureCompilerErrorHandler error_handler;
+    if (command_line.input.empty() && command_line.albedo.empty() && command_line.normal.empty() && command_line.faces.empty()) {
+        std::cout << "Texture compiler error. Input file is not specified." << std::endl;
+        return 1;
+    }
 
-    nvtt::OutputOptions output_options;
-    output_options.setFileName(output.c_str());
-    output_options.setContainer(nvtt::Container_DDS10);
-    output_options.setErrorHandler(&error_handler);
+    if (static_cast<int32_t>(!command_line.input.empty()) + static_cast<int32_t>(!command_line.albedo.empty()) + static_cast<int32_t>(!command_line.normal.empty()) + static_cast<int32_t>(!command_line.faces.empty()) != 1) {
+        std::cout << "Texture compiler error. Command line arguments --input, --albedo, --normal and --face can't be combined." << std::endl;
+        return 1;
+    }
 
-    nvtt::CompressionOptions compression_options;
-    switch (compression) {
-        case Compression::GOOD_BUT_SLOW:
-            compression_options.setFormat(nvtt::Format_BC7);
-            break;
-        case Compression::POOR_BUT_FAST:
-            compression_options.setFormat(nvtt::Format_BC3);
-            break;
-        case Compression::NO_COMPRESSION:
-            compression_options.setFormat(nvtt::Format_RGBA);
-            break;
+    if (command_line.output.empty() && (!command_line.is_cube_map || (command_line.output_irradiance.empty() && command_line.output_prefilter.empty()))) {
+        std::cout << "Texture compiler error. Output file is not specified." << std::endl;
+        return 1;
     }
 
-    nvtt::Compressor compressor;
+    if (static_cast<int32_t>(command_line.is_albedo_roughness) + static_cast<int32_t>(command_line.is_normal_metalness_ambient_occlusion) +
+        static_cast<int32_t>(command_line.is_parallax) + static_cast<int32_t>(command_line.is_cube_map) != 1) {
+        std::cout << "Texture compiler error. Invalid number of flags, one is required." << std::endl;
+        return 1;
+    }
+
+    if (static_cast<int32_t>(command_line.is_production) + static_cast<int32_t>(command_line.is_development) + static_cast<int32_t>(command_line.is_no_compression) != 1) {
+        std::cout << "Texture compiler error. Either --development, --production or --no-compression command line argument must be set." << std::endl;
+        return 1;
+    }
 
-    const auto before = std::chrono::system_clock::now();
+    if (command_line.is_production) {
+        job.compression = Compression::GOOD_BUT_SLOW;
+    } else if (command_line.is_development) {
+        job.compression = Compression::POOR_BUT_FAST;
+    } else {
+        job.compression = Compression::NO_COMPRESSION;
+    }
 
-    std::cout << "Progress: 0%" << std::flush;
+    if (command_line.is_progressive && !command_line.is_production && !command_line.is_cube_map) {
+        std::cout << "Texture compiler error. Command line argument --progressive is used only with --production or for cube map textures." << std::endl;
+        return 1;
+    }
+    job.is_progressive = command_line.is_progressive;
 
-    const int total_mip_levels = surface.countMipmaps();
-    if (!compressor.outputHeader(surface, total_mip_levels, compression_options, output_options)) {
-        // Error is printed via `error_handler`.
+    if (!parse_quality(command_line.quality, job.quality)) {
+        std::cout << "Texture compiler error. Command line argument --quality must be fastest, normal, production or highest." << std::endl;
         return 1;
     }
 
-    for (int mip_level = 0; mip_level < total_mip_levels; mip_level++) {
-        if (!compressor.compress(surface, 0, mip_level, compression_options, output_options)) {
-            // Error is printed via `error_handler`.
+    if (command_line.is_cube_map) {
+        if (command_line.output_size == 0 || command_line.output_irradiance.empty() != (command_line.output_irradiance_size == 0) ||
+            command_line.output_prefilter.empty() != (command_line.output_prefilter_size == 0)) {
+            std::cout << "Texture compiler error. Cube map requires --output-size command line argument to be set, --irradiance-size together with --irradiance and --prefilter-size together with --prefilter." << std::endl;
             return 1;
         }
 
-        if (mip_level + 1 < total_mip_levels && !surface.buildNextMipmap(nvtt::MipmapFilter_Box)) {
-            std::cout << "\rTexture compiler error. Failed to build a mip map." << std::endl;
+        if (((command_line.is_irradiance_sh || !command_line.irradiance_format.empty()) && command_line.output_irradiance.empty()) || ((command_line.prefilter_samples != 0 || command_line.prefilter_levels != 0) && command_line.output_prefilter.empty())) {
+            std::cout << "Texture compiler error. Command line arguments --irradiance-sh, --irradiance-format, --prefilter-samples and --prefilter-levels are used only with --irradiance and --prefilter." << std::endl;
             return 1;
         }
 
-        std::cout << "\rProgress: " << static_cast<int>(static_cast<float>(mip_level + 1) * 100.f / total_mip_levels) << "%" << std::flush;
-    }
+        if (command_line.is_combined_convolution && (command_line.output_irradiance.empty() || command_line.is_irradiance_sh) && command_line.output_prefilter.empty()) {
+            std::cout << "Texture compiler error. Command line argument --combined-convolution is used only with --prefilter or with --irradiance without --irradiance-sh." << std::endl;
+            return 1;
+        }
 
-    const auto after = std::chrono::system_clock::now();
-    const auto milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(after - before);
-    std::cout << "\rCompression took " << std::setprecision(3) << milliseconds.count() / 1000.f << " seconds." << std::endl;
+        if (command_line.output_size > 65535 || command_line.output_irradiance_size > 65535 || command_line.output_prefilter_size > 65535) {
+            std::cout << "Texture compiler error. Invalid output size." << std::endl;
+            return 1;
+        }
 
-    return 0;
-}
+        if (command_line.prefilter_samples > PREFILTER_MAX_SAMPLE_COUNT) {
+            std::cout << "Texture compiler error. Number of prefilter samples must not exceed " << PREFILTER_MAX_SAMPLE_COUNT << "." << std::endl;
+            return 1;
+        }
 
-static int compile_normal_metalness_ambient_occlusion(const std::string& input, const std::string& output, Compression compression) noexcept {
-    RgbaWrapper data(input);
-    if (data.data == nullptr) {
-        std::cout << "Texture compiler error. Failed to load a texture." << std::endl;
-        return 1;
+        if (command_line.prefilter_levels != 0) {
+            size_t prefilter_mip_levels = 1;
+            for (size_t mip_size = command_line.output_prefilter_size; mip_size > 1; mip_size /= 2) {
+                prefilter_mip_levels++;
+            }
+            if (command_line.prefilter_levels < 2 || command_line.prefilter_levels > prefilter_mip_levels) {
+                std::cout << "Texture compiler error. Number of prefilter levels must be at least 2 and must not exceed the " << prefilter_mip_levels << " mip levels of the prefilter size." << std::endl;
+                return 1;
+            }
+        }
+
+        if (command_line.is_streaming || !command_line.mip_qualities.empty() || command_line.max_error != 0.f || command_line.auto_quality != 0.f || !command_line.target.empty() || !command_line.container.empty() || command_line.rdo_lambda != 0.f ||
+            command_line.is_delta || command_line.warm_start != 0.f || !command_line.extra_outputs.empty() || !command_line.mask_output.empty() || command_line.is_auto_format || !command_line.mip_filter.empty() ||
+            command_line.max_size != 0 || !command_line.layers.empty() || command_line.tiles != 0 || command_line.tile_border != SIZE_MAX || command_line.mip_tail != 0 || command_line.mips != 0 || command_line.is_no_mips || command_line.min_mip_size != 0 || command_line.is_stats || command_line.is_derive) {
+            std::cout << "Texture compiler error. Command line arguments --streaming, --mip-quality, --max-error, --auto-quality, --target, --container, --rdo, --delta, --warm-start, --extra-output, --mask-output, --auto-format, --mip-filter, --max-size, --mips, --no-mips, --min-mip-size, --stats, --derive, --layer, --tiles, --tile-border and --mip-tail are not used for cube map textures." << std::endl;
+            return 1;
+        }
+    } else {
+        if (command_line.output_size != 0 || !command_line.output_irradiance.empty() || command_line.output_irradiance_size != 0 || !command_line.output_prefilter.empty() || command_line.output_prefilter_size != 0 ||
+            command_line.prefilter_samples != 0 || command_line.prefilter_levels != 0 || command_line.is_irradiance_sh || !command_line.irradiance_format.empty() || command_line.is_octahedral || command_line.is_combined_convolution) {
+            std::cout << "Texture compiler error. Command line arguments --output-size, --irradiance, --irradiance-size, --irradiance-sh, --irradiance-format, --prefilter, --prefilter-size, --prefilter-samples, --prefilter-levels, --octahedral, --combined-convolution are used only for cube map textures." << std::endl;
+            return 1;
+        }
     }
 
-    if (data.width <= 0 || data.height <= 0 || data.width > 65535 || data.height > 65535 || (data.width & (data.width - 1)) != 0 || (data.height & (data.height - 1)) != 0) {
-        std::cout << "Texture compiler error. Image size is not power of two." << std::endl;
-        return 1;
+    if (command_line.is_albedo_roughness) {
+        job.kind = TextureKind::ALBEDO_ROUGHNESS;
+    } else if (command_line.is_normal_metalness_ambient_occlusion) {
+        job.kind = TextureKind::NORMAL_METALNESS_AMBIENT_OCCLUSION;
+    } else if (command_line.is_parallax) {
+        job.kind = TextureKind::PARALLAX;
+    } else {
+        job.kind = TextureKind::CUBE_MAP;
     }
 
-    // Convert RGBA to BGRA.
-    for (int i = 0; i < data.width * data.height; i++) {
-        std::swap(data.data[i * 4], data.data[i * 4 + 2]);
+    if ((!command_line.albedo.empty() || !command_line.roughness.empty()) && job.kind != TextureKind::ALBEDO_ROUGHNESS) {
+        std::cout << "Texture compiler error. Command line arguments --albedo and --roughness are used only for albedo roughness textures." << std::endl;
+        return 1;
     }
 
-    nvtt::Surface surface;
-    if (!surface.setImage(nvtt::InputFormat_BGRA_8UB, data.width, data.height, 1, data.data)) {
-        std::cout << "Texture compiler error. Failed to set an image." << std::endl;
+    if ((!command_line.normal.empty() || !command_line.metalness.empty() || !command_line.ambient_occlusion.empty()) && job.kind != TextureKind::NORMAL_METALNESS_AMBIENT_OCCLUSION) {
+        std::cout << "Texture compiler error. Command line arguments --normal, --metalness and --ao are used only for normal metalness ambient occlusion textures." << std::endl;
         return 1;
     }
 
-    const float* red_normal_channel = surface.channel(0);
-    const float* green_normal_channel = surface.channel(1);
+    if (!command_line.faces.empty()) {
+        if (job.kind != TextureKind::CUBE_MAP) {
+            std::cout << "Texture compiler error. Command line argument --face is used only for cube map textures." << std::endl;
+            return 1;
+        }
 
-    // Reconstruct blue normal map channel.
-    std::vector<float> blue_normal_channel(static_cast<size_t>(data.width) * static_cast<size_t>(data.height));
-    for (size_t i = 0; i < blue_normal_channel.size(); i++) {
-        const float red = red_normal_channel[i] * 2.f - 1.f;
-        const float green = green_normal_channel[i] * 2.f - 1.f;
-        const float dot = red * red + green * green;
-        if (dot < 1.f) {
-            blue_normal_channel[i] = std::sqrt(1.f - dot) * 0.5f + 0.5f;
-        } else {
-            // Broken normal pixel.
-            blue_normal_channel[i] = 0.5f;
+        if (command_line.faces.size() != 6 || std::find(command_line.faces.begin(), command_line.faces.end(), std::string()) != command_line.faces.end()) {
+            std::cout << "Texture compiler error. Command line argument --face must be specified six times." << std::endl;
+            return 1;
         }
     }
 
-    // Opaque normal map.
-    std::vector<float> alpha_normal_channel(static_cast<size_t>(data.width) * static_cast<size_t>(data.height), 1.f);
+    if (!command_line.albedo.empty()) {
+        job.input = command_line.albedo;
+    } else if (!command_line.normal.empty()) {
+        job.input = command_line.normal;
+    } else if (!command_line.faces.empty()) {
+        job.input = command_line.faces[0];
+        job.faces.assign(command_line.faces.begin() + 1, command_line.faces.end());
+    } else {
+        job.input = command_line.input;
+    }
 
-    nvtt::Surface normal;
-    if (!normal.setImage(nvtt::InputFormat_RGBA_32F, data.width, data.height, 1, red_normal_channel, green_normal_channel, blue_normal_channel.data(), alpha_normal_channel.data())) {
-        std::cout << "Texture compiler error. Failed to set an image." << std::endl;
-        return 1;
+    if (!command_line.roughness.empty()) {
+        job.channel_inputs.push_back({ command_line.roughness, 3 });
+    }
+    if (!command_line.metalness.empty()) {
+        job.channel_inputs.push_back({ command_line.metalness, 2 });
+    }
+    if (!command_line.ambient_occlusion.empty()) {
+        job.channel_inputs.push_back({ command_line.ambient_occlusion, 3 });
     }
 
-    normal.setWrapMode(nvtt::WrapMode_Repeat);
-    normal.setAlphaMode(nvtt::AlphaMode_Transparency);
-    normal.setNormalMap(true);
+    job.output = command_line.output;
+    job.output_size = command_line.output_size;
+    job.output_irradiance = command_line.output_irradiance;
+    job.output_irradiance_size = command_line.output_irradiance_size;
+    job.output_prefilter = command_line.output_prefilter;
+    job.output_prefilter_size = command_line.output_prefilter_size;
 
-    nvtt::Surface metalness_ambient_occlusion;
-    if (!metalness_ambient_occlusion.setImage(data.width, data.height, 1)) {
-        std::cout << "Texture compiler error. Failed to set an image." << std::endl;
+    if (command_line.encoder.empty() || command_line.encoder == "nvtt") {
+        job.encoder = Encoder::NVTT;
+    } else if (command_line.encoder == "fast") {
+        job.encoder = Encoder::FAST;
+    } else {
+        std::cout << "Texture compiler error. Command line argument --encoder must be nvtt or fast." << std::endl;
         return 1;
     }
 
-    metalness_ambient_occlusion.copyChannel(surface, 2);
-    metalness_ambient_occlusion.copyChannel(surface, 3);
+    if (job.kind == TextureKind::CUBE_MAP) {
+        job.prefilter_samples = command_line.prefilter_samples != 0 ? command_line.prefilter_samples : PREFILTER_MAX_SAMPLE_COUNT;
+        job.prefilter_levels = command_line.prefilter_levels;
+        job.is_irradiance_spherical_harmonics = command_line.is_irradiance_sh;
+        job.is_octahedral = command_line.is_octahedral;
+        job.is_combined_convolution = command_line.is_combined_convolution;
 
-    metalness_ambient_occlusion.setWrapMode(nvtt::WrapMode_Repeat);
-    metalness_ambient_occlusion.setAlphaMode(nvtt::AlphaMode_Transparency);
-    metalness_ambient_occlusion.setNormalMap(false);
+        if (command_line.irradiance_format.empty() || command_line.irradiance_format == "rgba16f") {
+            job.irradiance_format = IrradianceFormat::RGBA16F;
+        } else if (command_line.irradiance_format == "r11g11b10f") {
+            job.irradiance_format = IrradianceFormat::R11G11B10F;
+        } else if (command_line.irradiance_format == "rgb9e5") {
+            job.irradiance_format = IrradianceFormat::RGB9E5;
+        } else {
+            std::cout << "Texture compiler error. Command line argument --irradiance-format must be rgba16f, r11g11b10f or rgb9e5." << std::endl;
+            return 1;
+        }
+    } else {
+        job.is_streaming = command_line.is_streaming;
 
-    TextureCompilerErrorHandler error_handler;
+        if (!(command_line.rdo_lambda >= 0.f) || !std::isfinite(command_line.rdo_lambda)) {
+            std::cout << "Texture compiler error. Command line argument --rdo must be a non-negative number." << std::endl;
+            return 1;
+        }
+        job.rdo_lambda = command_line.rdo_lambda;
+
+        if (command_line.target.empty() || command_line.target == "bc") {
+            job.target = Target::BC;
+        } else if (command_line.target == "etc2") {
+            job.target = Target::ETC2;
+        } else if (command_line.target == "astc") {
+            job.target = Target::ASTC;
+        } else if (command_line.target == "uastc") {
+            job.target = Target::UASTC;
+        } else {
+            std::cout << "Texture compiler error. Command line argument --target must be bc, etc2, astc or uastc." << std::endl;
+            return 1;
+        }
 
-    nvtt::OutputOptions output_options;
-    output_options.setFileName(output.c_str());
-    output_options.setContainer(nvtt::Container_DDS10);
-    output_options.setErrorHandler(&error_handler);
+        // Virtual textures are a container of their own, their pages are encoded as the layers of a DDS texture array.
+        if (command_line.tiles != 0 && !command_line.container.empty()) {
+            std::cout << "Texture compiler error. Command line argument --tiles can't be combined with --container." << std::endl;
+            return 1;
+        }
 
-    nvtt::CompressionOptions compression_options;
-    switch (compression) {
-        case Compression::GOOD_BUT_SLOW:
-            compression_options.setFormat(nvtt::Format_BC7);
-            break;
-        case Compression::POOR_BUT_FAST:
-            compression_options.setFormat(nvtt::Format_BC3);
-            break;
-        case Compression::NO_COMPRESSION:
-            compression_options.setFormat(nvtt::Format_RGBA);
-            break;
-    }
+        if (command_line.tiles != 0) {
+            job.container = Container::DDS;
+        } else if (command_line.container.empty()) {
+            job.container = job.target == Target::BC ? Container::DDS : Container::KTX2;
+        } else if (command_line.container == "dds") {
+            job.container = Container::DDS;
+        } else if (command_line.container == "ktx2") {
+            job.container = Container::KTX2;
+        } else if (command_line.container == "ktx2-raw") {
+            job.container = Container::KTX2_RAW;
+        } else if (command_line.container == "dds-gdeflate") {
+            job.container = Container::DDS_GDEFLATE;
+        } else {
+            std::cout << "Texture compiler error. Command line argument --container must be dds, ktx2, ktx2-raw or dds-gdeflate." << std::endl;
+            return 1;
+        }
 
-    nvtt::Compressor compressor;
+        if (job.target != Target::BC && command_line.tiles == 0 && (job.container == Container::DDS || job.container == Container::DDS_GDEFLATE)) {
+            std::cout << "Texture compiler error. DDS container doesn't support ETC2, ASTC and UASTC, use --container ktx2 or ktx2-raw." << std::endl;
+            return 1;
+        }
 
-    const auto before = std::chrono::system_clock::now();
+        if (job.target != Target::BC && job.rdo_lambda != 0.f) {
+            std::cout << "Texture compiler error. Command line argument --rdo supports only --target bc." << std::endl;
+            return 1;
+        }
 
-    std::cout << "Progress: 0%" << std::flush;
+        // Blocks of nvtt are compressed straight from the mip chain, only the built-in encoders can skip blocks.
+        const bool is_fast_bc7 = job.encoder == Encoder::FAST && job.compression == Compression::GOOD_BUT_SLOW && job.kind != TextureKind::PARALLAX;
+        const bool is_mobile = job.target != Target::BC && job.compression != Compression::NO_COMPRESSION;
+        if (command_line.is_delta && !(job.target == Target::BC ? is_fast_bc7 : is_mobile)) {
+            std::cout << "Texture compiler error. Command line argument --delta requires --encoder fast with --production, or --target etc2, astc or uastc with compression." << std::endl;
+            return 1;
+        }
+        job.is_delta = command_line.is_delta;
 
-    const int total_mip_levels = surface.countMipmaps();
-    if (!compressor.outputHeader(surface, total_mip_levels, compression_options, output_options)) {
-        // Error is printed via `error_handler`.
-        return 1;
-    }
+        if (!(command_line.warm_start >= 0.f) || !std::isfinite(command_line.warm_start)) {
+            std::cout << "Texture compiler error. Command line argument --warm-start must be a non-negative number." << std::endl;
+            return 1;
+        }
+        if (command_line.warm_start != 0.f && (!command_line.is_delta || job.target == Target::UASTC)) {
+            std::cout << "Texture compiler error. Command line argument --warm-start requires --delta and doesn't support --target uastc, which has no block decoder." << std::endl;
+            return 1;
+        }
+        job.warm_start = command_line.warm_start;
+
+        if (!(command_line.max_error >= 0.f) || !std::isfinite(command_line.max_error)) {
+            std::cout << "Texture compiler error. Command line argument --max-error must be a non-negative number." << std::endl;
+            return 1;
+        }
+        if (command_line.max_error != 0.f && !(job.target == Target::BC && is_fast_bc7)) {
+            std::cout << "Texture compiler error. Command line argument --max-error requires --encoder fast with --production." << std::endl;
+            return 1;
+        }
+        job.max_error = command_line.max_error;
 
-    for (int mip_level = 0; mip_level < total_mip_levels; mip_level++) {
-        surface.setImage(nvtt::InputFormat_RGBA_32F, normal.width(), normal.height(), 1, normal.channel(0), normal.channel(1), metalness_ambient_occlusion.channel(2), metalness_ambient_occlusion.channel(3));
-        if (!compressor.compress(surface, 0, mip_level, compression_options, output_options)) {
-            // Error is printed via `error_handler`.
+        // The sample is taken from the largest mip level, a quality per tier would need a sample per tier.
+        if (!(command_line.auto_quality >= 0.f) || !std::isfinite(command_line.auto_quality)) {
+            std::cout << "Texture compiler error. Command line argument --auto-quality must be a non-negative number." << std::endl;
             return 1;
         }
+        if (command_line.auto_quality != 0.f) {
+            if (!(job.target == Target::BC && is_fast_bc7)) {
+                std::cout << "Texture compiler error. Command line argument --auto-quality requires --encoder fast with --production." << std::endl;
+                return 1;
+            }
+            if (!command_line.quality.empty() || !command_line.mip_qualities.empty() || command_line.tiles != 0) {
+                std::cout << "Texture compiler error. Command line argument --auto-quality can't be combined with --quality, --mip-quality and --tiles." << std::endl;
+                return 1;
+            }
+        }
+        job.auto_quality = command_line.auto_quality;
+
+        if (command_line.tiles != 0) {
+            if (command_line.tiles < VIRTUAL_TEXTURE_MIN_PAGE_SIZE || command_line.tiles > VIRTUAL_TEXTURE_MAX_PAGE_SIZE || (command_line.tiles & (command_line.tiles - 1)) != 0) {
+                std::cout << "Texture compiler error. Command line argument --tiles must be a power of two from " << VIRTUAL_TEXTURE_MIN_PAGE_SIZE << " to " << VIRTUAL_TEXTURE_MAX_PAGE_SIZE << "." << std::endl;
+                return 1;
+            }
 
-        if (mip_level + 1 < total_mip_levels) {
-            if (!normal.buildNextMipmap(nvtt::MipmapFilter_Box)) {
-                std::cout << "\rTexture compiler error. Failed to build a normal mip map." << std::endl;
+            // Pages with their borders are whole 4x4 blocks.
+            const size_t tile_border = command_line.tile_border != SIZE_MAX ? command_line.tile_border : job.tile_border;
+            if (tile_border > VIRTUAL_TEXTURE_MAX_BORDER || tile_border % 2 != 0) {
+                std::cout << "Texture compiler error. Command line argument --tile-border must be an even number up to " << VIRTUAL_TEXTURE_MAX_BORDER << "." << std::endl;
                 return 1;
             }
 
-            normal.expandNormals();
-            normal.normalizeNormalMap();
-            normal.packNormals();
+            if (!(job.target == Target::BC ? is_fast_bc7 : is_mobile) && job.compression != Compression::NO_COMPRESSION) {
+                std::cout << "Texture compiler error. Command line argument --tiles requires --encoder fast with --production, --target etc2, astc or uastc, or --no-compression." << std::endl;
+                return 1;
+            }
 
-            if (!metalness_ambient_occlusion.buildNextMipmap(nvtt::MipmapFilter_Box)) {
-                std::cout << "\rTexture compiler error. Failed to build a metalness ambient occlusion mip map." << std::endl;
+            if (command_line.is_delta || !command_line.extra_outputs.empty() || !command_line.layers.empty() || !command_line.layout.empty()) {
+                std::cout << "Texture compiler error. Command line argument --tiles can't be combined with --delta, --extra-output, --layer and --layout." << std::endl;
                 return 1;
             }
+
+            job.tile_size = command_line.tiles;
+            job.tile_border = tile_border;
+        } else if (command_line.tile_border != SIZE_MAX) {
+            std::cout << "Texture compiler error. Command line argument --tile-border is used only with --tiles." << std::endl;
+            return 1;
         }
 
-        std::cout << "\rProgress: " << static_cast<int>(static_cast<float>(mip_level + 1) * 100.f / total_mip_levels) << "%" << std::flush;
-    }
+        // Outputs of nvtt only, the built-in encoders and RDO know neither BC5 nor a second output.
+        if (!command_line.mask_output.empty()) {
+            if (job.kind != TextureKind::NORMAL_METALNESS_AMBIENT_OCCLUSION) {
+                std::cout << "Texture compiler error. Command line argument --mask-output is used only for normal metalness ambient occlusion textures." << std::endl;
+                return 1;
+            }
 
-    const auto after = std::chrono::system_clock::now();
-    const auto milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(after - before);
-    std::cout << "\rCompression took " << std::setprecision(3) << milliseconds.count() / 1000.f << " seconds." << std::endl;
+            if (job.target != Target::BC || job.compression == Compression::NO_COMPRESSION) {
+                std::cout << "Texture compiler error. Command line argument --mask-output requires --target bc with --production or --development." << std::endl;
+                return 1;
+            }
 
-    return 0;
-}
+            if (job.encoder == Encoder::FAST || job.rdo_lambda != 0.f || command_line.is_delta || !command_line.extra_outputs.empty() || command_line.tiles != 0) {
+                std::cout << "Texture compiler error. Command line argument --mask-output can't be combined with --encoder fast, --rdo, --delta, --extra-output and --tiles." << std::endl;
+                return 1;
+            }
 
-static int compile_parallax(const std::string& input, const std::string& output, Compression compression) noexcept {
-    RgbaWrapper data(input);
-    if (data.data == nullptr) {
-        std::cout << "Texture compiler error. Failed to load a texture." << std::endl;
-        return 1;
-    }
+            if (command_line.mask_output == job.output) {
+                std::cout << "Texture compiler error. Every output of a texture must have its own path." << std::endl;
+                return 1;
+            }
+            job.mask_output = command_line.mask_output;
+        }
 
-    if (data.width == 0 || data.height == 0 || data.width > 65535 || data.height > 65535 || (data.width & (data.width - 1)) != 0 || (data.height & (data.height - 1)) != 0) {
-        std::cout << "Texture compiler error. Image size is not power of two." << std::endl;
-        return 1;
-    }
+        // Content is analyzed on the decoded image of a single layer, the built-in encoders encode neither BC1 nor pages.
+        if (command_line.is_auto_format) {
+            if (job.kind != TextureKind::ALBEDO_ROUGHNESS) {
+                std::cout << "Texture compiler error. Command line argument --auto-format is used only for albedo roughness textures." << std::endl;
+                return 1;
+            }
 
-    nvtt::Surface surface;
-    if (!surface.setImage(nvtt::InputFormat_BGRA_8UB, data.width, data.height, 1, data.data)) {
-        std::cout << "Texture compiler error. Failed to set a texture." << std::endl;
-        return 1;
-    }
+            if (job.target != Target::BC || job.compression == Compression::NO_COMPRESSION) {
+                std::cout << "Texture compiler error. Command line argument --auto-format requires --target bc with --production or --development." << std::endl;
+                return 1;
+            }
 
-    surface.setWrapMode(nvtt::WrapMode_Repeat);
-    surface.setAlphaMode(nvtt::AlphaMode_Transparency);
-    surface.setNormalMap(false);
+            if (command_line.is_delta || command_line.tiles != 0 || !command_line.layers.empty()) {
+                std::cout << "Texture compiler error. Command line argument --auto-format can't be combined with --delta, --tiles and --layer." << std::endl;
+                return 1;
+            }
+            job.is_auto_format = true;
+        }
 
-    TextureCompilerErrorHandler error_handler;
+        // Pages of virtual textures are the layers of a single mip level, their own mip levels are lost to the encoders.
+        if (!command_line.mip_qualities.empty()) {
+            if (job.compression == Compression::NO_COMPRESSION) {
+                std::cout << "Texture compiler error. Command line argument --mip-quality requires --production or --development." << std::endl;
+                return 1;
+            }
 
-    nvtt::OutputOptions output_options;
-    output_options.setFileName(output.c_str());
-    output_options.setContainer(nvtt::Container_DDS10);
-    output_options.setErrorHandler(&error_handler);
+            if (command_line.tiles != 0) {
+                std::cout << "Texture compiler error. Command line argument --mip-quality can't be combined with --tiles." << std::endl;
+                return 1;
+            }
+        }
 
-    nvtt::CompressionOptions compression_options;
-    switch (compression) {
-        case Compression::GOOD_BUT_SLOW:
-        case Compression::POOR_BUT_FAST:
-            // BC4 is fast and good enough for both production and development.
-            compression_options.setFormat(nvtt::Format_BC4);
-            break;
-        case Compression::NO_COMPRESSION:
-            compression_options.setFormat(nvtt::Format_RGBA);
-            compression_options.setPixelFormat(8, 0xFF, 0x00, 0x00, 0x00);
-            break;
-    }
+        for (const std::string& mip_quality : command_line.mip_qualities) {
+            const size_t separator = mip_quality.find('=');
+            const std::string level = mip_quality.substr(0, separator);
+
+            // Two digits cover every mip level of the largest textures, an empty quality would be the default one.
+            MipQuality tier;
+            const bool is_level = !level.empty() && level.size() <= 2 && std::all_of(level.begin(), level.end(), [](char digit) {
+                return std::isdigit(static_cast<unsigned char>(digit)) != 0;
+            });
+            if (!is_level || separator == std::string::npos || separator + 1 == mip_quality.size() || !parse_quality(mip_quality.substr(separator + 1), tier.quality)) {
+                std::cout << "Texture compiler error. Command line argument --mip-quality must be a mip level followed by = and fastest, normal, production or highest." << std::endl;
+                return 1;
+            }
+            tier.first_level = static_cast<size_t>(std::stoi(level));
+
+            const auto position = std::find_if(job.mip_qualities.begin(), job.mip_qualities.end(), [&tier](const MipQuality& other) {
+                return other.first_level >= tier.first_level;
+            });
+            if (position != job.mip_qualities.end() && position->first_level == tier.first_level) {
+                std::cout << "Texture compiler error. Every --mip-quality of a texture must start at its own mip level." << std::endl;
+                return 1;
+            }
+            job.mip_qualities.insert(position, tier);
+        }
 
-    nvtt::Compressor compressor;
+        for (const std::string& extra_output : command_line.extra_outputs) {
+            const size_t separator = extra_output.find('=');
+            const std::string compression = extra_output.substr(0, separator);
+
+            ExtraOutput output;
+            if (compression == "production") {
+                output.compression = Compression::GOOD_BUT_SLOW;
+            } else if (compression == "development") {
+                output.compression = Compression::POOR_BUT_FAST;
+            } else if (compression == "no-compression") {
+                output.compression = Compression::NO_COMPRESSION;
+            } else {
+                std::cout << "Texture compiler error. Command line argument --extra-output must be production, development or no-compression followed by = and the output path." << std::endl;
+                return 1;
+            }
 
-    const auto before = std::chrono::system_clock::now();
+            output.path = separator != std::string::npos ? extra_output.substr(separator + 1) : std::string();
+            if (output.path.empty()) {
+                std::cout << "Texture compiler error. Output file of --extra-output is not specified." << std::endl;
+                return 1;
+            }
 
-    std::cout << "Progress: 0%" << std::flush;
+            const std::vector<std::string> outputs = get_job_outputs(job);
+            if (std::find(outputs.begin(), outputs.end(), output.path) != outputs.end()) {
+                std::cout << "Texture compiler error. Every output of a texture must have its own path." << std::endl;
+                return 1;
+            }
 
-    const int total_mip_levels = surface.countMipmaps();
-    if (!compressor.outputHeader(surface, total_mip_levels, compression_options, output_options)) {
-        // Error is printed via `error_handler`.
-        return 1;
-    }
+            job.extra_outputs.push_back(std::move(output));
+        }
 
-    for (int mip_level = 0; mip_level < total_mip_levels; mip_level++) {
-        if (!compressor.compress(surface, 0, mip_level, compression_options, output_options)) {
-            // Error is printed via `error_handler`.
+        if (command_line.mip_filter.empty() || command_line.mip_filter == "box") {
+            job.mip_filter = MipFilter::BOX;
+        } else if (command_line.mip_filter == "kaiser") {
+            job.mip_filter = MipFilter::KAISER;
+        } else if (command_line.mip_filter == "lanczos") {
+            job.mip_filter = MipFilter::LANCZOS;
+        } else {
+            std::cout << "Texture compiler error. Command line argument --mip-filter must be box, kaiser or lanczos." << std::endl;
             return 1;
         }
 
-        if (mip_level + 1 < total_mip_levels && !surface.buildNextMipmap(nvtt::MipmapFilter_Box)) {
-            std::cout << "\rTexture compiler error. Failed to build a mip map." << std::endl;
+        job.max_size = command_line.max_size;
+
+        if (command_line.is_no_mips && command_line.mips != 0) {
+            std::cout << "Texture compiler error. Command line arguments --mips and --no-mips can't be combined." << std::endl;
+            return 1;
+        }
+        job.mip_count = command_line.is_no_mips ? 1 : command_line.mips;
+        if (command_line.min_mip_size != 0) {
+            job.min_mip_size = command_line.min_mip_size;
         }
+        job.is_stats = command_line.is_stats;
+        job.is_derived = command_line.is_derive;
 
-        std::cout << "\rProgress: " << static_cast<int>(static_cast<float>(mip_level + 1) * 100.f / total_mip_levels) << "%" << std::flush;
+        for (const std::string& layer : command_line.layers) {
+            if (layer.empty()) {
+                std::cout << "Texture compiler error. Input file of --layer is not specified." << std::endl;
+                return 1;
+            }
+        }
+        job.layers = command_line.layers;
     }
 
-    const auto after = std::chrono::system_clock::now();
-    const auto milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(after - before);
-    std::cout << "\rCompression took " << std::setprecision(3) << milliseconds.count() / 1000.f << " seconds." << std::endl;
-
-    return 0;
-}
+    if (command_line.layout.empty()) {
+        job.layout = GpuLayout::PACKED;
+    } else if (command_line.layout == "d3d12") {
+        job.layout = GpuLayout::D3D12;
+    } else if (command_line.layout == "vulkan") {
+        job.layout = GpuLayout::VULKAN;
+    } else {
+        std::cout << "Texture compiler error. Command line argument --layout must be d3d12 or vulkan." << std::endl;
+        return 1;
+    }
 
-struct SdlWrapper final {
-    SdlWrapper() noexcept
-            : initialized(SDL_Init(SDL_INIT_VIDEO) == 0) {
+    // KTX2 levels must be tightly packed.
+    if (job.layout != GpuLayout::PACKED && job.container != Container::DDS && job.container != Container::DDS_GDEFLATE) {
+        std::cout << "Texture compiler error. Command line argument --layout supports only --container dds and dds-gdeflate." << std::endl;
+        return 1;
     }
 
-    SdlWrapper(const SdlWrapper&) = delete;
-    SdlWrapper(SdlWrapper&&) = delete;
-    SdlWrapper& operator=(const SdlWrapper&) = delete;
-    SdlWrapper& operator=(SdlWrapper&&) = delete;
+    if (command_line.mip_tail != 0) {
+        if (command_line.mip_tail < 2 || command_line.mip_tail > MIP_TAIL_MAX_SIZE || (command_line.mip_tail & (command_line.mip_tail - 1)) != 0) {
+            std::cout << "Texture compiler error. Command line argument --mip-tail must be a power of two from 2 to " << MIP_TAIL_MAX_SIZE << "." << std::endl;
+            return 1;
+        }
 
-    ~SdlWrapper() {
-        if (initialized) {
-            SDL_Quit();
+        // The table describes tightly packed levels of a plain DDS file.
+        if (job.container != Container::DDS || job.layout != GpuLayout::PACKED || job.tile_size != 0) {
+            std::cout << "Texture compiler error. Command line argument --mip-tail supports only --container dds and can't be combined with --layout and --tiles." << std::endl;
+            return 1;
         }
+        job.mip_tail_size = command_line.mip_tail;
     }
 
-    bool initialized;
-};
+    if (command_line.is_checksums && (job.container != Container::DDS || job.tile_size != 0)) {
+        std::cout << "Texture compiler error. Command line argument --checksums supports only --container dds and can't be combined with --tiles." << std::endl;
+        return 1;
+    }
+    job.is_checksums = command_line.is_checksums;
 
-struct WindowWrapper final {
-    WindowWrapper() noexcept
-            : window(SDL_CreateWindow("Texture Compiler", SDL_WINDOWPOS_UNDEFINED, SDL_WINDOWPOS_UNDEFINED, 256, 256, SDL_WINDOW_HIDDEN)) {
+    if ((command_line.is_linear_mips || command_line.is_roughness_mips || !command_line.roughness_normal_map.empty()) && job.kind != TextureKind::ALBEDO_ROUGHNESS) {
+        std::cout << "Texture compiler error. Command line arguments --linear-mips, --roughness-mips and --roughness-normal-map are used only for albedo roughness textures." << std::endl;
+        return 1;
     }
+    job.is_linear_mip_filtering = command_line.is_linear_mips;
+    job.is_roughness_mip_filtering = command_line.is_roughness_mips || !command_line.roughness_normal_map.empty();
+    job.roughness_normal_map = command_line.roughness_normal_map;
 
-    WindowWrapper(const WindowWrapper&) = delete;
-    WindowWrapper(WindowWrapper&&) = delete;
-    WindowWrapper& operator=(const WindowWrapper&) = delete;
-    WindowWrapper& operator=(WindowWrapper&&) = delete;
+    if (command_line.is_r16) {
+        if (job.kind != TextureKind::PARALLAX) {
+            std::cout << "Texture compiler error. Command line argument --r16 is used only for parallax textures." << std::endl;
+            return 1;
+        }
+
+        const bool has_uncompressed_output = job.compression == Compression::NO_COMPRESSION ||
+                                             std::any_of(job.extra_outputs.begin(), job.extra_outputs.end(), [](const ExtraOutput& extra_output) {
+                                                 return extra_output.compression == Compression::NO_COMPRESSION;
+                                             });
+        if (!has_uncompressed_output) {
+            std::cout << "Texture compiler error. Command line argument --r16 requires --no-compression or a no-compression --extra-output." << std::endl;
+            return 1;
+        }
 
-    ~WindowWrapper() {
-        if (window != nullptr) {
-            SDL_DestroyWindow(window);
+        // Pages of virtual textures are R8 or B8G8R8A8.
+        if (job.tile_size != 0) {
+            std::cout << "Texture compiler error. Command line argument --r16 can't be combined with --tiles." << std::endl;
+            return 1;
         }
     }
+    job.is_r16 = command_line.is_r16;
 
-    SDL_Window* window;
-};
+    if (!job.roughness_normal_map.empty() && !job.layers.empty()) {
+        std::cout << "Texture compiler error. Command line argument --roughness-normal-map can't be combined with --layer." << std::endl;
+        return 1;
+    }
+
+    if (!job.channel_inputs.empty() && !job.layers.empty()) {
+        std::cout << "Texture compiler error. Command line arguments --roughness, --metalness and --ao can't be combined with --layer." << std::endl;
+        return 1;
+    }
 
-struct BgfxWrapper final {
-    BgfxWrapper() noexcept
-            : initialized(bgfx::init()) {
+    // Derived textures have the layers of their input and a single output made of its levels.
+    if (job.is_derived && (!job.layers.empty() || !job.channel_inputs.empty() || !job.roughness_normal_map.empty() || !job.extra_outputs.empty() || !job.mask_output.empty() ||
+                           job.is_auto_format || job.is_stats || job.tile_size != 0)) {
+        std::cout << "Texture compiler error. Command line argument --derive can't be combined with --layer, --roughness, --metalness, --ao, --roughness-normal-map, --extra-output, --mask-output, --auto-format, --stats and --tiles." << std::endl;
+        return 1;
     }
 
-    BgfxWrapper(const BgfxWrapper&) = delete;
-    BgfxWrapper(BgfxWrapper&&) = delete;
-    BgfxWrapper& operator=(const BgfxWrapper&) = delete;
-    BgfxWrapper& operator=(BgfxWrapper&&) = delete;
+    return 0;
+}
 
-    ~BgfxWrapper() {
-        if (initialized) {
-            bgfx::shutdown();
+// Split a manifest line into arguments. Arguments are separated by whitespace, double quotes group an argument with
+// spaces and `#` outside of quotes starts a comment.
+static std::vector<std::string> split_manifest_line(const std::string& line) {
+    std::vector<std::string> result;
+
+    std::string argument;
+    bool is_argument = false;
+    bool is_quoted = false;
+
+    for (char character : line) {
+        if (is_quoted) {
+            if (character == '"') {
+                is_quoted = false;
+            } else {
+                argument += character;
+            }
+        } else if (character == '"') {
+            is_quoted = true;
+            is_argument = true;
+        } else if (character == '#') {
+            break;
+        } else if (std::isspace(static_cast<unsigned char>(character))) {
+            if (is_argument) {
+                result.push_back(std::move(argument));
+                argument.clear();
+                is_argument = false;
+            }
+        } else {
+            argument += character;
+            is_argument = true;
         }
     }
 
-    bool initialized;
-};
-
-struct HdrWrapper final {
-    explicit HdrWrapper(const std::string& path) noexcept
-            : data(stbi_loadf(path.c_str(), &width, &height, &channels, 4)) {
+    if (is_argument) {
+        result.push_back(std::move(argument));
     }
 
-    HdrWrapper(const HdrWrapper&) = delete;
-    HdrWrapper(HdrWrapper&&) = delete;
-    HdrWrapper& operator=(const HdrWrapper&) = delete;
-    HdrWrapper& operator=(HdrWrapper&&) = delete;
+    return result;
+}
+
+// Options of the whole process that a manifest line or a server request can't change.
+static bool has_global_arguments(const CommandLine& command_line) noexcept {
+    return command_line.is_help || !command_line.manifest.empty() || command_line.is_dry_run || command_line.is_server || !command_line.watch.empty() || !command_line.pack.empty() || !command_line.probe_array.empty() || command_line.coordinator != 0 || !command_line.worker.empty() || command_line.jobs != 0 || command_line.memory_budget != 0 ||
+           command_line.time_budget != 0 || command_line.job_time_limit != 0 || command_line.job_memory_limit != 0 || !command_line.cost_history.empty() || !command_line.checkpoint.empty() || !command_line.progress.empty() || !command_line.cache.empty() || !command_line.remote_cache.empty() || command_line.is_remote_filtered || command_line.cache_size != 0 || command_line.is_source_cached || !command_line.shader_cache.empty() || command_line.is_memory_reused || command_line.is_huge_pages || !command_line.cpu_features.empty() ||
+           command_line.is_pinned || command_line.is_incremental || !command_line.metrics.empty() || command_line.metrics_port >= 0 || command_line.is_hardware_counters || command_line.is_allocation_tracked || !command_line.trace.empty() || !command_line.profile.empty() || command_line.is_no_compute || command_line.is_gpu_mips || command_line.is_headless || !command_line.backend.empty() || !command_line.renderer.empty() || command_line.gpu >= 0 || command_line.gpus != 0 || command_line.processes != 0 || command_line.input_locality != 0 || command_line.is_schedule_report || command_line.is_verbose ||
+           command_line.is_report_quality || command_line.is_report_blocks || command_line.is_bench_gpu || !command_line.bench_output_sizes.empty() || !command_line.bench_irradiance_sizes.empty() || !command_line.bench_prefilter_sizes.empty() ||
+           !command_line.bench_prefilter_samples.empty() || command_line.bench_runs != 0;
+}
+
+// Options of a single job, which `--manifest` and `--server` take from their lines instead.
+static bool has_job_arguments(const CommandLine& command_line) noexcept {
+    return command_line.is_albedo_roughness || command_line.is_normal_metalness_ambient_occlusion || command_line.is_parallax || command_line.is_cube_map ||
+           command_line.is_production || command_line.is_development || command_line.is_no_compression || command_line.is_progressive ||
+           !command_line.input.empty() || !command_line.output.empty() || command_line.output_size != 0 ||
+           !command_line.output_irradiance.empty() || command_line.output_irradiance_size != 0 || !command_line.output_prefilter.empty() || command_line.output_prefilter_size != 0 || command_line.prefilter_samples != 0 || command_line.prefilter_levels != 0 || command_line.is_irradiance_sh ||
+           !command_line.irradiance_format.empty() || command_line.is_octahedral || command_line.is_combined_convolution || !command_line.output_brdf_lut.empty() || command_line.output_brdf_lut_size != 0 || command_line.is_streaming || !command_line.encoder.empty() || !command_line.quality.empty() || !command_line.mip_qualities.empty() || command_line.max_error != 0.f || command_line.auto_quality != 0.f || !command_line.target.empty() || !command_line.container.empty() || !command_line.layout.empty() || command_line.mip_tail != 0 || command_line.is_checksums || command_line.rdo_lambda != 0.f || command_line.is_delta || command_line.warm_start != 0.f ||
+           !command_line.extra_outputs.empty() || !command_line.mask_output.empty() || command_line.is_auto_format || !command_line.mip_filter.empty() || command_line.is_linear_mips ||
+           command_line.is_roughness_mips || !command_line.roughness_normal_map.empty() || command_line.is_r16 || command_line.max_size != 0 || command_line.mips != 0 || command_line.is_no_mips || command_line.min_mip_size != 0 || command_line.is_stats || command_line.is_derive || command_line.tiles != 0 || command_line.tile_border != SIZE_MAX || !command_line.layers.empty() || !command_line.faces.empty() ||
+           !command_line.albedo.empty() || !command_line.roughness.empty() || !command_line.normal.empty() || !command_line.metalness.empty() || !command_line.ambient_occlusion.empty();
+}
 
-    ~HdrWrapper() {
-        if (data != nullptr) {
-            stbi_image_free(data);
+// Parses a comma separated list of sizes or sample counts from 1 to `limit` of `--bench-gpu`, or `defaults` when empty.
+static bool parse_bench_list(const std::string& text, const char* defaults, size_t limit, std::vector<size_t>& values) {
+    std::istringstream stream(text.empty() ? defaults : text);
+    std::string value;
+    while (std::getline(stream, value, ',')) {
+        char* end = nullptr;
+        const unsigned long long number = std::strtoull(value.c_str(), &end, 10);
+        if (value.empty() || *end != '\0' || number == 0 || number > limit) {
+            return false;
         }
+        values.push_back(static_cast<size_t>(number));
     }
+    return !values.empty();
+}
 
-    int width;
-    int height;
-    int channels;
-    float* data;
+// Parses the job of a manifest line or a server request, `source` and `number` tell which one in errors.
+static int parse_job_arguments(const std::vector<std::string>& arguments, const char* source, size_t number, CompileJob& job) {
+    // Clara skips the first argument, which is normally the executable name.
+    std::vector<const char*> argv { "texture_compiler" };
+    for (const std::string& argument : arguments) {
+        argv.push_back(argument.c_str());
+    }
+
+    CommandLine command_line;
+    if (auto result = create_command_line_parser(command_line).parse(clara::Args(static_cast<int>(argv.size()), argv.data())); !result) {
+        std::cout << "Texture compiler error. Failed to parse " << source << " " << number << ": " << result.errorMessage() << std::endl;
+        return 1;
+    }
+
+    if (has_global_arguments(command_line)) {
+        std::cout << "Texture compiler error. Arguments of " << source << " " << number << " must describe a single job." << std::endl;
+        return 1;
+    }
+
+    if (create_compile_job(command_line, job) != 0) {
+        std::cout << "Texture compiler error. Invalid job at " << source << " " << number << "." << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
+
+// `lines` get the line of every job for `--coordinator`, which hands them to workers as they are.
+static int load_manifest(const std::string& path, std::vector<CompileJob>& jobs, std::vector<std::string>* lines = nullptr) {
+    std::ifstream stream(path);
+    if (!stream) {
+        std::cout << "Texture compiler error. Failed to open manifest file." << std::endl;
+        return 1;
+    }
+
+    std::string line;
+    for (size_t line_number = 1; std::getline(stream, line); line_number++) {
+        const std::vector<std::string> arguments = split_manifest_line(line);
+        if (arguments.empty()) {
+            continue;
+        }
+
+        CompileJob job;
+        if (parse_job_arguments(arguments, "manifest line", line_number, job) != 0) {
+            // Error is printed in `parse_job_arguments`.
+            return 1;
+        }
+        jobs.push_back(std::move(job));
+        if (lines != nullptr) {
+            lines->push_back(line);
+        }
+    }
+
+    if (jobs.empty()) {
+        std::cout << "Texture compiler error. Manifest doesn't contain any jobs." << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
+
+// Orders manifest jobs longest expected first, so the few jobs on the critical path of a build never start last. The
+// expected time is the one of the previous compilation in the cost history, or the estimate of the cost model for jobs
+// that were never compiled. Jobs expected to take the same time keep the manifest order.
+static void get_job_order(const CompilerContext& context, const std::vector<CompileJob>& jobs, std::vector<size_t>& order) {
+    std::vector<double> seconds(jobs.size());
+    for (size_t i = 0; i < jobs.size(); i++) {
+        CostHistoryEntry entry;
+        if (context.cost_history && context.cost_history->find(get_job_outputs(jobs[i]).front(), entry)) {
+            seconds[i] = entry.seconds;
+        } else {
+            seconds[i] = estimate_job_seconds(context, jobs[i]);
+        }
+    }
+
+    order.resize(jobs.size());
+    for (size_t i = 0; i < jobs.size(); i++) {
+        order[i] = i;
+    }
+    std::stable_sort(order.begin(), order.end(), [&seconds](size_t a, size_t b) {
+        return seconds[a] > seconds[b];
+    });
+}
+
+// Reorders the jobs of `order` within windows of `window` jobs by the directory of their inputs and then by where the
+// inputs are on their storage, see `get_file_location`, so a hard disk reads them in one sweep and a network share
+// serves a directory at a time. Windows are small next to a manifest, so jobs move a little from the place the longest
+// first order gives them and the critical path keeps starting first. Members of an archive keep their order.
+static void order_by_input_locality(const std::vector<CompileJob>& jobs, size_t window, std::vector<size_t>& order) {
+    // Opening a file may stall on a network share, so the inputs are located by the I/O threads, several at a time.
+    std::vector<std::string> directories(jobs.size());
+    std::vector<FileLocation> locations(jobs.size());
+    TaskGroup group;
+    for (const size_t i : order) {
+        get_io_threads().push(group, [&jobs, &directories, &locations, i] {
+            const std::string path = get_input_file_path(jobs[i].input);
+            const size_t separator = path.find_last_of("/\\");
+            directories[i] = separator != std::string::npos ? path.substr(0, separator) : std::string();
+            locations[i] = get_file_location(path);
+        });
+    }
+    get_io_threads().wait(group);
+
+    for (size_t begin = 0; begin < order.size(); begin += window) {
+        const size_t end = std::min(begin + window, order.size());
+        std::stable_sort(order.begin() + begin, order.begin() + end, [&directories, &locations](size_t a, size_t b) {
+            if (directories[a] != directories[b]) {
+                return directories[a] < directories[b];
+            }
+            // Offsets on the device and inodes don't compare, files with an offset go first.
+            if (locations[a].is_physical != locations[b].is_physical) {
+                return locations[a].is_physical;
+            }
+            return locations[a].position < locations[b].position;
+        });
+    }
+}
+
+// Compiles a job of the manifest into `log`, or to the standard output with its progress when `log` is null, and
+// reports its start, progress and end to `progress_log` when it's set.
+static int compile_manifest_job(CompilerContext& context, const std::vector<CompileJob>& jobs, size_t i, std::ostringstream* log, ProgressLog* progress_log) {
+    std::ostream& stream = log != nullptr ? static_cast<std::ostream&>(*log) : std::cout;
+    if (context.live_metrics) {
+        context.live_metrics->queued_jobs--;
+    }
+    if (progress_log == nullptr) {
+        return compile(context, jobs[i], stream, log == nullptr);
+    }
+
+    CompileJob job = jobs[i];
+    job.progress = progress_log->get_progress(i);
+    progress_log->start(i, job.input, get_job_outputs(job).front());
+
+    const auto before = std::chrono::steady_clock::now();
+    const int result = compile(context, job, stream, log == nullptr);
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - before).count();
+
+    progress_log->finish(i, result == 0, seconds, log != nullptr ? log->str() : std::string());
+    return result;
+}
+
+// Manifest jobs whose remote cache entries are looked up ahead of the jobs being compiled. Enough to hide a round trip
+// behind the hits restored meanwhile, few enough not to download entries long before their jobs run.
+static constexpr size_t REMOTE_LOOKAHEAD_JOBS = 16;
+
+// Manifest jobs whose inputs are read ahead of the jobs being compiled with `--input-locality`, in the order the jobs
+// start, so the storage streams the following inputs one after the other. Without it only the next input is.
+static constexpr size_t LOCALITY_LOOKAHEAD_JOBS = 4;
+
+// Finds the jobs that write the same outputs as an earlier job of the manifest under other paths, the same options of
+// inputs with the same content, like copies of the same texture in several material packs. `primary_jobs[i]` is the
+// first job with the outputs of job `i`, `i` itself for jobs without an earlier twin and jobs whose inputs can't be
+// read, which fail on their own.
+static void find_duplicate_jobs(const CompilerContext& context, const std::vector<CompileJob>& jobs, std::vector<size_t>& primary_jobs) {
+    primary_jobs.resize(jobs.size());
+    std::map<std::pair<uint64_t, uint64_t>, size_t> first_jobs;
+    for (size_t i = 0; i < jobs.size(); i++) {
+        primary_jobs[i] = i;
+        Hash key;
+        if (compute_job_outputs_key(context, jobs[i], key)) {
+            primary_jobs[i] = first_jobs.emplace(std::make_pair(key.low, key.high), i).first->second;
+        }
+    }
+}
+
+// Copies the outputs of the primary job of a duplicate to its own outputs, see `find_duplicate_jobs`. Outputs are
+// written to a temporary file and renamed into place like compiled outputs.
+static bool copy_job_outputs(const CompileJob& primary, const CompileJob& job, std::ostream& log) {
+    const std::vector<std::string> sources = get_job_outputs(primary);
+    const std::vector<std::string> outputs = get_job_outputs(job);
+    for (size_t i = 0; i < outputs.size(); i++) {
+        const std::string temporary_path = get_temporary_path(outputs[i]);
+        std::error_code error;
+        if (!std::filesystem::copy_file(sources[i], temporary_path, std::filesystem::copy_options::overwrite_existing, error) || !replace_file(temporary_path, outputs[i])) {
+            std::filesystem::remove(temporary_path, error);
+            log << "Texture compiler error. Failed to copy \"" << sources[i] << "\" to \"" << outputs[i] << "\"." << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+// Limits of `--job-time-limit` and `--job-memory-limit`, zero for no limit.
+struct JobLimits final {
+    double seconds = 0.0;
+    size_t memory = 0;
 };
 
-template <typename HandleType>
-struct HandleWrapper final {
-    HandleWrapper() noexcept
-            : handle(BGFX_INVALID_HANDLE) {
+// Jobs expected to go over a limit even when lowered are compiled in the slow lane: jobs expected to take more memory
+// than the limit, 2D jobs the cost model expects to take longer than the limit at the lowest qualities `--time-budget`
+// would pick, and cube maps, which aren't lowered, that took longer in the cost history.
+static bool is_slow_lane_job(const CompilerContext& context, const CompileJob& job, const JobLimits& limits) {
+    size_t memory = estimate_job_memory(job);
+    CostHistoryEntry entry;
+    const bool is_known = context.cost_history && context.cost_history->find(get_job_outputs(job).front(), entry);
+    if (is_known) {
+        memory = std::max(memory, entry.memory);
+    }
+    if (limits.memory != 0 && memory > limits.memory) {
+        return true;
+    }
+
+    if (limits.seconds <= 0.0) {
+        return false;
+    }
+    if (job.kind == TextureKind::CUBE_MAP) {
+        return is_known && entry.seconds > limits.seconds;
+    }
+    return estimate_fitted_job_seconds(context, job, limits.seconds) > limits.seconds;
+}
+
+// Prints the jobs of `CompilerContext::limit_reports`, the longest first.
+static void print_limit_report(CompilerContext& context) {
+    std::lock_guard<std::mutex> lock(context.limit_mutex);
+    if (context.limit_reports.empty()) {
+        return;
+    }
+
+    std::vector<JobLimitReport>& reports = context.limit_reports;
+    std::stable_sort(reports.begin(), reports.end(), [](const JobLimitReport& a, const JobLimitReport& b) {
+        return a.wall_seconds > b.wall_seconds;
+    });
+
+    std::cout << "Texture compiler warning. " << reports.size() << " manifest jobs were lowered, compiled in the slow lane or went over --job-time-limit or --job-memory-limit:" << std::endl;
+    std::cout << std::fixed << std::setprecision(1);
+    for (const JobLimitReport& report : reports) {
+        std::string exceeded;
+        for (const std::string& limit : report.exceeded_limits) {
+            exceeded += (exceeded.empty() ? "" : " and ") + limit;
+        }
+        std::cout << "  " << std::setw(10) << (report.action.empty() ? "-" : report.action.c_str()) << " " << std::setw(8) << report.wall_seconds << " s";
+        if (report.estimated_seconds >= 0.0) {
+            std::cout << " (" << report.estimated_seconds << " s expected)";
+        }
+        if (report.memory != 0) {
+            std::cout << " " << report.memory / (1024 * 1024) << " MB";
+        }
+        std::cout << "  " << report.input << " -> " << report.output << (exceeded.empty() ? "" : ", over the " + exceeded + " limit") << std::endl;
+    }
+    std::cout << std::defaultfloat;
+    reports.clear();
+}
+
+static int compile_manifest(CompilerContext& context, const std::vector<CompileJob>& manifest_jobs, size_t memory_budget, ProgressLog* progress_log = nullptr, const JobLimits& limits = {}) {
+    const auto before = std::chrono::steady_clock::now();
+
+    // Jobs carry the limits into `compile`, which lowers them and reports them.
+    std::vector<CompileJob> limited_jobs;
+    const bool is_limited = limits.seconds > 0.0 || limits.memory != 0;
+    if (is_limited) {
+        limited_jobs = manifest_jobs;
+        for (CompileJob& job : limited_jobs) {
+            job.time_limit_seconds = limits.seconds;
+            job.memory_limit = limits.memory;
+        }
+    }
+    const std::vector<CompileJob>& jobs = is_limited ? limited_jobs : manifest_jobs;
+
+    // Duplicate jobs are only copied once the job they duplicate is done.
+    std::vector<size_t> primary_jobs;
+    find_duplicate_jobs(context, jobs, primary_jobs);
+    size_t duplicate_count = 0;
+    for (size_t i = 0; i < jobs.size(); i++) {
+        if (primary_jobs[i] != i) {
+            duplicate_count++;
+        }
+    }
+    std::vector<int> results(jobs.size(), 0);
+
+    // Slow lane jobs are compiled one at a time once every other job is done, so they neither hold the memory budget
+    // nor keep the build waiting for the threads they share with a long job. Duplicates follow their primary job.
+    std::vector<size_t> slow_lane_jobs;
+    for (size_t i = 0; is_limited && i < jobs.size(); i++) {
+        if (primary_jobs[i] == i && is_slow_lane_job(context, jobs[i], limits)) {
+            limited_jobs[i].is_slow_lane = true;
+            slow_lane_jobs.push_back(i);
+        }
+    }
+
+    std::atomic<size_t> failed_jobs { 0 };
+    if (context.live_metrics) {
+        context.live_metrics->queued_jobs = static_cast<int64_t>(jobs.size() - duplicate_count);
+    }
+
+    // Input of the following job is read into the page cache while the current one is compiled, so decoding of
+    // the following job doesn't stall on the disk or the network share. Opening the file may stall on a network
+    // share too, so the hint is given by the I/O threads.
+    TaskGroup prefetch_group;
+    const auto prefetch_job = [&jobs, &prefetch_group](size_t i) {
+        get_io_threads().push(prefetch_group, [&jobs, i] {
+            prefetch_file(jobs[i].input);
+        });
+    };
+    const size_t input_lookahead = context.input_locality_window != 0 ? LOCALITY_LOOKAHEAD_JOBS : 1;
+
+    // With a remote cache, the entries of the jobs `REMOTE_LOOKAHEAD_JOBS` ahead of the one starting are looked up by the
+    // I/O threads, several at a time, and hits are downloaded into the local cache, so jobs find them locally and misses
+    // know the remote doesn't have them without waiting for it.
+    const auto prefetch_entries = [&context, &jobs, &prefetch_group](size_t i) {
+        get_io_threads().push(prefetch_group, [&context, &jobs, i] {
+            prefetch_cache_entries(context, jobs[i]);
+        });
+    };
+    const bool is_remote_prefetched = context.cache && context.cache->remote;
+
+    // Seconds since the build started at which the scheduler got to every job, admitted it, started it and saw it end,
+    // for the schedule report, see `ScheduledJob`.
+    struct JobTimes final {
+        bool is_scheduled = false;
+        double ready = 0.0;
+        double admitted = 0.0;
+        double start = 0.0;
+        double end = 0.0;
+    };
+    std::vector<JobTimes> times(context.schedule ? jobs.size() : 0);
+    const auto get_build_seconds = [&before] {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - before).count();
+    };
+    const double main_cpu_begin = get_calling_thread_cpu_time();
+    const std::vector<double> worker_cpu_begin = context.schedule ? context.pool.get_worker_cpu_times() : std::vector<double>();
+    context.pool.take_task_waits();
+
+    if (context.pool.worker_count() == 0) {
+        // A single thread compiles the jobs in the order of the manifest, the time they take doesn't matter.
+        std::vector<size_t> sequence(jobs.size());
+        for (size_t i = 0; i < jobs.size(); i++) {
+            sequence[i] = i;
+        }
+        if (context.input_locality_window != 0) {
+            order_by_input_locality(jobs, context.input_locality_window, sequence);
+        }
+
+        for (size_t k = 0; is_remote_prefetched && k < std::min(REMOTE_LOOKAHEAD_JOBS, jobs.size()); k++) {
+            prefetch_entries(sequence[k]);
+        }
+        for (size_t k = 1; k < std::min(input_lookahead, jobs.size()); k++) {
+            prefetch_job(sequence[k]);
+        }
+        for (size_t k = 0; k < jobs.size(); k++) {
+            const size_t i = sequence[k];
+            if (k + input_lookahead < jobs.size()) {
+                prefetch_job(sequence[k + input_lookahead]);
+            }
+            if (is_remote_prefetched && k + REMOTE_LOOKAHEAD_JOBS < jobs.size()) {
+                prefetch_entries(sequence[k + REMOTE_LOOKAHEAD_JOBS]);
+            }
+            if (primary_jobs[i] != i || jobs[i].is_slow_lane) {
+                continue;
+            }
+            std::cout << "Job " << i + 1 << "/" << jobs.size() << ": " << jobs[i].input << " -> " << get_job_outputs(jobs[i]).front() << std::endl;
+            if (!times.empty()) {
+                times[i].is_scheduled = true;
+                times[i].ready = times[i].admitted = times[i].start = get_build_seconds();
+            }
+            results[i] = compile_manifest_job(context, jobs, i, nullptr, progress_log);
+            if (!times.empty()) {
+                times[i].end = get_build_seconds();
+            }
+            if (results[i] != 0) {
+                failed_jobs++;
+            }
+        }
+        for (const size_t i : slow_lane_jobs) {
+            std::cout << "Job " << i + 1 << "/" << jobs.size() << " in the slow lane: " << jobs[i].input << " -> " << get_job_outputs(jobs[i]).front() << std::endl;
+            if (!times.empty()) {
+                times[i].is_scheduled = true;
+                times[i].ready = times[i].admitted = times[i].start = get_build_seconds();
+            }
+            results[i] = compile_manifest_job(context, jobs, i, nullptr, progress_log);
+            if (!times.empty()) {
+                times[i].end = get_build_seconds();
+            }
+            if (results[i] != 0) {
+                failed_jobs++;
+            }
+        }
+    } else {
+        // Jobs in flight are limited to the threads that run them, the workers and this thread with its cube maps, so
+        // jobs waiting in the queue don't hold the budget of the ones that could run.
+        ThreadPool& pool = context.pool;
+        MemoryBudget budget(memory_budget, pool.worker_count() + 1);
+        std::mutex log_mutex;
+
+        // Jobs start in the order of `order`, so the input read ahead is the one of the following job in that order.
+        std::vector<size_t> order;
+        std::vector<size_t> next_jobs(jobs.size(), jobs.size());
+        get_job_order(context, jobs, order);
+        order.erase(std::remove_if(order.begin(), order.end(), [&primary_jobs, &jobs](size_t i) {
+            return primary_jobs[i] != i || jobs[i].is_slow_lane;
+        }), order.end());
+        if (context.input_locality_window != 0) {
+            order_by_input_locality(jobs, context.input_locality_window, order);
+        }
+        std::vector<size_t> lookahead_jobs(jobs.size(), jobs.size());
+        for (size_t k = 0; k + input_lookahead < order.size(); k++) {
+            next_jobs[order[k]] = order[k + input_lookahead];
+        }
+        for (size_t k = 1; k < std::min(input_lookahead, order.size()); k++) {
+            prefetch_job(order[k]);
+        }
+        for (size_t k = 0; k + REMOTE_LOOKAHEAD_JOBS < order.size(); k++) {
+            lookahead_jobs[order[k]] = order[k + REMOTE_LOOKAHEAD_JOBS];
+        }
+        for (size_t k = 0; is_remote_prefetched && k < std::min(REMOTE_LOOKAHEAD_JOBS, order.size()); k++) {
+            prefetch_entries(order[k]);
+        }
+
+        // Memory of the previous compilation counts when it's more than the estimate from the header.
+        const auto get_job_memory = [&](size_t i) {
+            size_t memory = estimate_job_memory(jobs[i]);
+            CostHistoryEntry entry;
+            if (context.cost_history && context.cost_history->find(get_job_outputs(jobs[i]).front(), entry)) {
+                memory = std::max(memory, entry.memory);
+            }
+            return memory;
+        };
+
+        // Waits for the budget of a job, and records when the scheduler got to it and when it was admitted.
+        const auto acquire_job_memory = [&](size_t i, size_t memory) {
+            if (!times.empty()) {
+                times[i].is_scheduled = true;
+                times[i].ready = get_build_seconds();
+            }
+            budget.acquire(memory);
+            if (!times.empty()) {
+                times[i].admitted = get_build_seconds();
+            }
+        };
+
+        // The budget is acquired before the job is run and released when it's done.
+        const auto run_job = [&](size_t i, size_t memory) {
+            if (!times.empty()) {
+                times[i].start = get_build_seconds();
+            }
+            if (next_jobs[i] < jobs.size()) {
+                prefetch_job(next_jobs[i]);
+            }
+            if (is_remote_prefetched && lookahead_jobs[i] < jobs.size()) {
+                prefetch_entries(lookahead_jobs[i]);
+            }
+
+            std::ostringstream log;
+            const int result = compile_manifest_job(context, jobs, i, &log, progress_log);
+            results[i] = result;
+            if (!times.empty()) {
+                times[i].end = get_build_seconds();
+            }
+
+            budget.release(memory);
+
+            if (result != 0) {
+                failed_jobs++;
+            }
+
+            std::lock_guard<std::mutex> lock(log_mutex);
+            std::cout << "Job " << i + 1 << "/" << jobs.size() << (jobs[i].is_slow_lane ? " in the slow lane: " : ": ") << jobs[i].input << " -> " << get_job_outputs(jobs[i]).front() << std::endl << log.str() << std::flush;
+        };
+
+        // Jobs share the pool with block compression. 2D jobs are admitted by a thread of their own, which waits for
+        // the budget and only then pushes the job, so workers never sleep on the budget and keep compressing the
+        // blocks of the jobs in flight while the next job waits for memory. A job waiting for its blocks only helps
+        // with these blocks, so it never starts another job while holding its own budget.
+        TaskGroup group;
+        std::thread admission([&] {
+            for (const size_t i : order) {
+                if (jobs[i].kind != TextureKind::CUBE_MAP) {
+                    const size_t memory = get_job_memory(i);
+                    acquire_job_memory(i, memory);
+                    pool.push(group, [&run_job, i, memory] {
+                        run_job(i, memory);
+                    });
+                }
+            }
+        });
+
+        // Cube map jobs are serialized on this thread, which owns the renderer, while workers keep compiling 2D jobs.
+        // Once a cube map job has read back its last faces, the following one is compiled while they're compressed,
+        // if the budget has room for it right away, so the GPU renders a probe while the CPU compresses the previous one.
+        std::vector<size_t> cube_map_jobs;
+        for (const size_t i : order) {
+            if (jobs[i].kind == TextureKind::CUBE_MAP) {
+                cube_map_jobs.push_back(i);
+            }
+        }
+
+        size_t next_cube_map_job = 0;
+        const auto run_next_cube_map_job = [&] {
+            if (next_cube_map_job < cube_map_jobs.size()) {
+                const size_t i = cube_map_jobs[next_cube_map_job];
+                const size_t memory = get_job_memory(i);
+                if (budget.try_acquire(memory)) {
+                    next_cube_map_job++;
+                    if (!times.empty()) {
+                        times[i].is_scheduled = true;
+                        times[i].ready = times[i].admitted = get_build_seconds();
+                    }
+                    run_job(i, memory);
+                }
+            }
+        };
+
+        while (next_cube_map_job < cube_map_jobs.size()) {
+            const size_t i = cube_map_jobs[next_cube_map_job++];
+            const size_t memory = get_job_memory(i);
+            acquire_job_memory(i, memory);
+            set_gpu_idle_callback(context, run_next_cube_map_job);
+            run_job(i, memory);
+        }
+        set_gpu_idle_callback(context, {});
+
+        admission.join();
+        pool.wait(group);
+
+        // Slow lane jobs run on this thread, which owns the renderer for their cube maps, while the workers compress
+        // their blocks.
+        for (const size_t i : slow_lane_jobs) {
+            prefetch_job(i);
+            const size_t memory = get_job_memory(i);
+            acquire_job_memory(i, memory);
+            run_job(i, memory);
+        }
     }
 
-    HandleWrapper(HandleWrapper&& original) noexcept
-            : handle(original.handle) {
-        original.handle = BGFX_INVALID_HANDLE;
+    get_io_threads().wait(prefetch_group);
+
+    // Copies of duplicates aren't scheduled, the report ends with the last compiled job.
+    std::optional<ScheduleReport> schedule;
+    if (context.schedule) {
+        schedule.emplace();
+        schedule->wall_seconds = get_build_seconds();
+        schedule->memory_budget = memory_budget;
+        schedule->threads.push_back(ScheduledThread { "main", get_calling_thread_cpu_time() - main_cpu_begin });
+        const std::vector<double> worker_cpu_end = context.pool.get_worker_cpu_times();
+        for (size_t k = 0; k < worker_cpu_end.size(); k++) {
+            schedule->threads.push_back(ScheduledThread { "worker " + std::to_string(k + 1), worker_cpu_end[k] - worker_cpu_begin[k] });
+        }
+        const ThreadPool::TaskWaits task_waits = context.pool.take_task_waits();
+        schedule->task_count = task_waits.count;
+        schedule->task_wait_seconds = task_waits.seconds;
+        schedule->max_task_wait_seconds = task_waits.max_seconds;
+
+        for (size_t i = 0; i < jobs.size(); i++) {
+            if (!times[i].is_scheduled) {
+                continue;
+            }
+            ScheduledJob job;
+            job.index = i;
+            job.output = get_job_outputs(jobs[i]).front();
+            job.ready_seconds = times[i].ready;
+            job.admitted_seconds = times[i].admitted;
+            job.start_seconds = times[i].start;
+            job.end_seconds = times[i].end;
+            job.gpu_wait_seconds = context.schedule->get_gpu_wait_seconds(job.output);
+            job.is_gpu_bound = job.gpu_wait_seconds * 2.0 >= job.end_seconds - job.start_seconds && job.gpu_wait_seconds > 0.0;
+            schedule->jobs.push_back(std::move(job));
+        }
+        std::stable_sort(schedule->jobs.begin(), schedule->jobs.end(), [](const ScheduledJob& a, const ScheduledJob& b) {
+            return a.start_seconds < b.start_seconds;
+        });
+        schedule->find_critical_path();
+    }
+
+    // Duplicates fail with the job they duplicate, which printed why.
+    for (size_t i = 0; i < jobs.size(); i++) {
+        const size_t primary = primary_jobs[i];
+        if (primary == i) {
+            continue;
+        }
+        std::cout << "Job " << i + 1 << "/" << jobs.size() << ": " << jobs[i].input << " -> " << get_job_outputs(jobs[i]).front() << std::endl;
+        if (progress_log != nullptr) {
+            progress_log->start(i, jobs[i].input, get_job_outputs(jobs[i]).front());
+        }
+        std::ostringstream log;
+        bool is_copied = false;
+        if (results[primary] != 0) {
+            log << "Texture compiler error. Job " << primary + 1 << " with the same inputs and options failed." << std::endl;
+        } else if (copy_job_outputs(jobs[primary], jobs[i], log)) {
+            log << "Copied the outputs of job " << primary + 1 << " with the same inputs and options." << std::endl;
+            is_copied = true;
+        }
+        if (!is_copied) {
+            failed_jobs++;
+        }
+        std::cout << log.str() << std::flush;
+        if (progress_log != nullptr) {
+            progress_log->finish(i, is_copied, 0.0, log.str());
+        }
+    }
+
+    print_limit_report(context);
+
+    const auto after = std::chrono::steady_clock::now();
+    const auto milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(after - before);
+    std::cout << "Manifest compilation took " << std::setprecision(3) << milliseconds.count() / 1000.f << " seconds." << std::endl;
+
+    if (schedule) {
+        if (context.schedule->is_printed) {
+            schedule->print(std::cout);
+        }
+        if (context.metrics) {
+            std::lock_guard<std::mutex> lock(context.metrics->mutex);
+            context.metrics->schedule = std::move(schedule);
+        }
+    }
+
+    if (failed_jobs != 0) {
+        std::cout << "Texture compiler error. " << failed_jobs << " of " << jobs.size() << " manifest jobs failed." << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
+
+// Number of the longest jobs `--dry-run` lists.
+static constexpr size_t DRY_RUN_LISTED_JOBS = 10;
+
+// Reports what compiling the manifest would take without compiling anything. Jobs that are up to date, in the local
+// cache or duplicates of earlier jobs are expected to take no time. The rest take the time and memory of their previous
+// compilation in the cost history, or the estimates of the cost model from their input headers, and are scheduled like
+// `compile_manifest` schedules them: longest first, at most a job per thread in flight within the memory budget, cube
+// maps one at a time. The cost model has no estimates of cube maps, so cube maps missing from the history take no time.
+static int dry_run_manifest(const CompilerContext& context, const std::vector<CompileJob>& jobs, size_t memory_budget) {
+    std::vector<size_t> primary_jobs;
+    find_duplicate_jobs(context, jobs, primary_jobs);
+
+    std::vector<JobStatus> statuses(jobs.size(), JobStatus::COMPILED);
+    std::vector<double> seconds(jobs.size(), 0.0);
+    std::vector<size_t> memory(jobs.size(), 0);
+    std::vector<const char*> sources(jobs.size(), "model");
+    size_t up_to_date_count = 0;
+    size_t cached_count = 0;
+    size_t duplicate_count = 0;
+    size_t unestimated_count = 0;
+    for (size_t i = 0; i < jobs.size(); i++) {
+        if (primary_jobs[i] != i) {
+            duplicate_count++;
+            continue;
+        }
+
+        statuses[i] = get_job_status(context, jobs[i]);
+        if (statuses[i] == JobStatus::UP_TO_DATE) {
+            up_to_date_count++;
+            continue;
+        }
+        if (statuses[i] == JobStatus::CACHED) {
+            cached_count++;
+            continue;
+        }
+
+        memory[i] = estimate_job_memory(jobs[i]);
+        CostHistoryEntry entry;
+        if (context.cost_history && context.cost_history->find(get_job_outputs(jobs[i]).front(), entry)) {
+            seconds[i] = entry.seconds;
+            memory[i] = std::max(memory[i], entry.memory);
+            sources[i] = "history";
+        } else {
+            seconds[i] = estimate_job_seconds(context, jobs[i]);
+            if (seconds[i] <= 0.0) {
+                sources[i] = "none";
+                unestimated_count++;
+            }
+        }
+    }
+
+    std::vector<size_t> order;
+    get_job_order(context, jobs, order);
+    order.erase(std::remove_if(order.begin(), order.end(), [&](size_t i) {
+        return primary_jobs[i] != i || statuses[i] != JobStatus::COMPILED;
+    }), order.end());
+    if (context.input_locality_window != 0) {
+        order_by_input_locality(jobs, context.input_locality_window, order);
+    }
+
+    // Same admission as `MemoryBudget`: a job starts once it fits into the budget and a thread is free, or nothing else is
+    // in flight. 2D jobs are admitted in order, cube maps in order on the thread of the renderer.
+    const size_t job_limit = context.pool.worker_count() + 1;
+    std::vector<size_t> queue;
+    std::vector<size_t> cube_map_queue;
+    for (const size_t i : order) {
+        (jobs[i].kind == TextureKind::CUBE_MAP ? cube_map_queue : queue).push_back(i);
+    }
+
+    struct RunningJob final {
+        double end;
+        size_t job;
+    };
+    std::vector<RunningJob> running;
+    size_t next_job = 0;
+    size_t next_cube_map_job = 0;
+    bool is_cube_map_running = false;
+    size_t used_memory = 0;
+    size_t peak_memory = 0;
+    double time = 0.0;
+    double cube_map_seconds = 0.0;
+    size_t last_job = jobs.size();
+    const auto try_start = [&](size_t i) {
+        if (!running.empty() && (used_memory + memory[i] > memory_budget || running.size() >= job_limit)) {
+            return false;
+        }
+        running.push_back(RunningJob { time + seconds[i], i });
+        used_memory += memory[i];
+        peak_memory = std::max(peak_memory, used_memory);
+        return true;
+    };
+    while (next_job < queue.size() || next_cube_map_job < cube_map_queue.size() || !running.empty()) {
+        if (!is_cube_map_running && next_cube_map_job < cube_map_queue.size() && try_start(cube_map_queue[next_cube_map_job])) {
+            cube_map_seconds += seconds[cube_map_queue[next_cube_map_job]];
+            next_cube_map_job++;
+            is_cube_map_running = true;
+        }
+        while (next_job < queue.size() && try_start(queue[next_job])) {
+            next_job++;
+        }
+
+        const auto first = std::min_element(running.begin(), running.end(), [](const RunningJob& a, const RunningJob& b) {
+            return a.end < b.end;
+        });
+        time = first->end;
+        last_job = first->job;
+        used_memory -= memory[first->job];
+        if (jobs[first->job].kind == TextureKind::CUBE_MAP) {
+            is_cube_map_running = false;
+        }
+        running.erase(first);
+    }
+
+    const size_t compiled_count = order.size();
+    std::cout << "Dry run of " << jobs.size() << " manifest jobs: " << compiled_count << " to compile, " << cached_count << " in the cache, " << up_to_date_count << " up to date and "
+              << duplicate_count << " duplicates of other jobs." << std::endl;
+    std::cout << std::fixed << std::setprecision(1) << "Expected wall time with " << job_limit << " threads is " << time << " seconds, " << cube_map_seconds << " of them of cube maps compiled one at a time."
+              << std::endl;
+    std::cout << "Expected peak memory of the jobs in flight is " << peak_memory / (1024 * 1024) << " MB of the budget of " << memory_budget / (1024 * 1024) << " MB." << std::endl;
+    if (unestimated_count != 0) {
+        std::cout << unestimated_count << " jobs have no estimate, cube maps and inputs whose header can't be read that are missing from the cost history." << std::endl;
+    }
+
+    std::vector<size_t> longest_jobs = order;
+    std::stable_sort(longest_jobs.begin(), longest_jobs.end(), [&seconds](size_t a, size_t b) {
+        return seconds[a] > seconds[b];
+    });
+    longest_jobs.resize(std::min(longest_jobs.size(), DRY_RUN_LISTED_JOBS));
+    if (!longest_jobs.empty()) {
+        std::cout << "Longest jobs, which bound the wall time of the build, with the source of their estimates:" << std::endl;
+    }
+    for (const size_t i : longest_jobs) {
+        std::cout << "  " << std::setw(8) << seconds[i] << " s " << std::setw(7) << memory[i] / (1024 * 1024) << " MB " << std::setw(7) << sources[i] << "  Job " << i + 1 << ": " << jobs[i].input << " -> "
+                  << get_job_outputs(jobs[i]).front() << (i == last_job ? " (finishes last)" : "") << std::endl;
+    }
+    std::cout << std::defaultfloat;
+    return 0;
+}
+
+// Packs the outputs of every manifest job once all of them are compiled, so failed jobs never leave stale outputs in
+// the pack.
+static int pack_manifest(const std::vector<CompileJob>& jobs, const std::string& pack) {
+    const auto before = std::chrono::steady_clock::now();
+
+    try {
+        std::vector<std::string> outputs;
+        for (const CompileJob& job : jobs) {
+            const std::vector<std::string> job_outputs = get_job_outputs(job);
+            outputs.insert(outputs.end(), job_outputs.begin(), job_outputs.end());
+        }
+
+        if (!write_pack(pack, outputs, std::cout)) {
+            // Error is printed in `write_pack`.
+            return 1;
+        }
+
+        const auto milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - before);
+        std::cout << "Packing " << outputs.size() << " textures took " << std::setprecision(3) << milliseconds.count() / 1000.f << " seconds." << std::endl;
+    } catch (const std::exception& exception) {
+        std::cout << "Texture compiler error. Failed to write the pack: " << exception.what() << "." << std::endl;
+        return 1;
+    }
+    return 0;
+}
+
+// Writes the irradiance and prefilter outputs of the cube map jobs into probe arrays once all the jobs are compiled,
+// like `pack_manifest`.
+static int write_manifest_probe_array(const std::vector<CompileJob>& jobs, const std::string& probe_array) {
+    const auto before = std::chrono::steady_clock::now();
+
+    try {
+        std::vector<ProbeArrayProbe> probes;
+        for (const CompileJob& job : jobs) {
+            if (job.kind == TextureKind::CUBE_MAP && (!job.output_irradiance.empty() || !job.output_prefilter.empty())) {
+                probes.push_back(ProbeArrayProbe { job.output_irradiance, job.output_prefilter });
+            }
+        }
+
+        if (!write_probe_array(probe_array, probes, std::cout)) {
+            // Error is printed in `write_probe_array`.
+            return 1;
+        }
+
+        const auto milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - before);
+        std::cout << "Writing " << probes.size() << " probes into arrays took " << std::setprecision(3) << milliseconds.count() / 1000.f << " seconds." << std::endl;
+    } catch (const std::exception& exception) {
+        std::cout << "Texture compiler error. Failed to write the probe array: " << exception.what() << "." << std::endl;
+        return 1;
+    }
+    return 0;
+}
+
+// Inputs of `--watch` are checked this often.
+static constexpr std::chrono::milliseconds WATCH_INTERVAL(100);
+
+// A changed job is compiled once its inputs haven't changed for this long, so a burst of saves or a file that's still
+// being written is compiled once.
+static constexpr std::chrono::milliseconds WATCH_DEBOUNCE(300);
+
+// Jobs compiled with `--development` are compiled with their own compression once no input has changed for this long.
+static constexpr std::chrono::milliseconds WATCH_UPGRADE_DELAY(2000);
+
+// Modification time and size of a watched input, a change of either is a save.
+struct WatchedInput final {
+    std::filesystem::file_time_type time;
+    uintmax_t size = 0;
+
+    // Indices of the manifest jobs that read the input.
+    std::vector<size_t> jobs;
+};
+
+// Archive members are watched by the state of their archive.
+static void get_input_state(const std::string& input, std::filesystem::file_time_type& time, uintmax_t& size) noexcept {
+    std::string path;
+    try {
+        path = get_input_file_path(input);
+    } catch (const std::exception&) {
+        path = input;
+    }
+
+    std::error_code error;
+    time = std::filesystem::last_write_time(path, error);
+    if (error) {
+        // Missing inputs, for example in the middle of a save that replaces the file, count as a change once they're back.
+        time = std::filesystem::file_time_type::min();
+    }
+    size = std::filesystem::file_size(path, error);
+    if (error) {
+        size = 0;
+    }
+}
+
+static bool is_in_directory(const std::filesystem::path& directory, const std::string& path) {
+    const std::filesystem::path absolute_path = std::filesystem::absolute(path).lexically_normal();
+    return std::mismatch(directory.begin(), directory.end(), absolute_path.begin(), absolute_path.end()).first == directory.end();
+}
+
+// Inputs are polled rather than watched with the file system notifications of every platform, which is a few stat
+// calls per job every `WATCH_INTERVAL`, even on network shares where notifications are unreliable. Jobs are compiled
+// one at a time on the main thread with every thread of the pool. Runs until the process is terminated.
+static int watch_manifest(CompilerContext& context, const std::vector<CompileJob>& jobs, const std::string& directory) {
+    std::filesystem::path watched_directory;
+    std::map<std::string, WatchedInput> inputs;
+    try {
+        std::error_code error;
+        if (!std::filesystem::is_directory(directory, error)) {
+            std::cout << "Texture compiler error. Watched directory doesn't exist." << std::endl;
+            return 1;
+        }
+
+        watched_directory = std::filesystem::absolute(directory).lexically_normal();
+        if (watched_directory.filename().empty()) {
+            watched_directory = watched_directory.parent_path();
+        }
+
+        for (size_t i = 0; i < jobs.size(); i++) {
+            for (const std::string& path : get_job_inputs(jobs[i])) {
+                if (!path.empty() && is_in_directory(watched_directory, path)) {
+                    WatchedInput& input = inputs[path];
+                    get_input_state(path, input.time, input.size);
+                    input.jobs.push_back(i);
+                }
+            }
+        }
+    } catch (const std::exception& exception) {
+        std::cout << "Texture compiler error. Failed to list watched inputs: " << exception.what() << "." << std::endl;
+        return 1;
+    }
+
+    std::cout << "Watching " << inputs.size() << " inputs in " << watched_directory.string() << "." << std::endl;
+
+    // Changed jobs by the time of the last change of their inputs, and jobs waiting to be compiled with their own
+    // compression after their preview.
+    std::map<size_t, std::chrono::steady_clock::time_point> changed_jobs;
+    std::set<size_t> preview_jobs;
+    auto last_change = std::chrono::steady_clock::now();
+
+    const auto compile_job = [&](size_t i, const CompileJob& job, const char* description) {
+        std::cout << "Job " << i + 1 << "/" << jobs.size() << ": " << job.input << " -> " << get_job_outputs(job).front() << " (" << description << ")" << std::endl;
+        compile(context, job, std::cout, true);
+    };
+
+    while (true) {
+        std::this_thread::sleep_for(WATCH_INTERVAL);
+
+        const auto now = std::chrono::steady_clock::now();
+        for (auto& [path, input] : inputs) {
+            std::filesystem::file_time_type time;
+            uintmax_t size;
+            get_input_state(path, time, size);
+            if (time != input.time || size != input.size) {
+                input.time = time;
+                input.size = size;
+                for (size_t job : input.jobs) {
+                    changed_jobs[job] = now;
+                }
+                last_change = now;
+            }
+        }
+
+        for (auto it = changed_jobs.begin(); it != changed_jobs.end();) {
+            if (now - it->second < WATCH_DEBOUNCE) {
+                ++it;
+                continue;
+            }
+
+            const size_t i = it->first;
+            it = changed_jobs.erase(it);
+
+            CompileJob preview;
+            if (get_preview_job(jobs[i], preview)) {
+                compile_job(i, preview, "preview");
+                preview_jobs.insert(i);
+            } else {
+                compile_job(i, jobs[i], "final");
+                preview_jobs.erase(i);
+            }
+        }
+
+        // One job at a time, so a save in the meantime is previewed without waiting for every upgrade.
+        if (changed_jobs.empty() && !preview_jobs.empty() && std::chrono::steady_clock::now() - last_change >= WATCH_UPGRADE_DELAY) {
+            const size_t i = *preview_jobs.begin();
+            preview_jobs.erase(preview_jobs.begin());
+            compile_job(i, jobs[i], "final");
+        }
+    }
+}
+
+// Request line of `--server`: an identifier echoed in the responses, a priority and the job in the manifest format.
+struct ServerRequest final {
+    std::string id;
+    int priority = 0;
+
+    // Arrival order, requests of the same priority are compiled first come, first served.
+    size_t number = 0;
+
+    // Empty when the line is not a valid request.
+    std::vector<std::string> arguments;
+
+    // `--output` of the job, a later request for the same output supersedes this one. Empty for jobs without it.
+    std::string output;
+
+    // Set when a later request for the same output arrived before this one started.
+    bool is_canceled = false;
+};
+
+// Job of a request that is being compiled, maybe paused by a request of a higher priority.
+struct ServerJob final {
+    std::string output;
+    JobControl control;
+};
+
+// Requests read from the standard input by the reader thread and not compiled yet, and the jobs being compiled, which
+// the reader thread cancels when a request for the same output arrives.
+struct ServerQueue final {
+    ServerQueue() noexcept = default;
+
+    ServerQueue(const ServerQueue&) = delete;
+    ServerQueue(ServerQueue&&) = delete;
+    ServerQueue& operator=(const ServerQueue&) = delete;
+    ServerQueue& operator=(ServerQueue&&) = delete;
+
+    // Cancels queued requests and running jobs for the same output as the request.
+    void push(ServerRequest&& request);
+
+    // The input is closed and no more requests are coming.
+    void close();
+
+    // Waits for a request and takes a canceled one, which is answered right away, or the one with the highest priority.
+    // Returns false once the input is closed and every request is taken.
+    bool pop(ServerRequest& request);
+
+    // Waits until `is_finished` is set by `finish` or a request preempts a job of `priority`, which is a request of a
+    // higher priority or a canceled one, and takes it. Returns false once the job is finished.
+    bool pop_preempting(int priority, const bool& is_finished, ServerRequest& request);
+
+    void finish(bool& is_finished);
+
+    void add_job(ServerJob& job);
+    void remove_job(const ServerJob& job);
+
+    // Next request to take, canceled ones first. Must be called with `mutex` locked.
+    std::vector<ServerRequest>::iterator find_next();
+
+    // Publishes the number of queued requests to `--metrics-port`. Must be called with `mutex` locked.
+    void update_depth() noexcept;
+
+    // Only set when `--metrics-port` is specified.
+    LiveMetrics* live_metrics = nullptr;
+
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::vector<ServerRequest> requests;
+    std::vector<ServerJob*> jobs;
+    bool is_closed = false;
+};
+
+void ServerQueue::push(ServerRequest&& request) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!request.output.empty()) {
+            for (ServerRequest& queued : requests) {
+                queued.is_canceled = queued.is_canceled || queued.output == request.output;
+            }
+            for (ServerJob* job : jobs) {
+                if (job->output == request.output) {
+                    job->control.cancel();
+                }
+            }
+        }
+        requests.push_back(std::move(request));
+        update_depth();
+    }
+    condition.notify_all();
+}
+
+void ServerQueue::close() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        is_closed = true;
+    }
+    condition.notify_all();
+}
+
+std::vector<ServerRequest>::iterator ServerQueue::find_next() {
+    return std::min_element(requests.begin(), requests.end(), [](const ServerRequest& lhs, const ServerRequest& rhs) {
+        if (lhs.is_canceled != rhs.is_canceled) {
+            return lhs.is_canceled;
+        }
+        return lhs.priority != rhs.priority ? lhs.priority > rhs.priority : lhs.number < rhs.number;
+    });
+}
+
+void ServerQueue::update_depth() noexcept {
+    if (live_metrics != nullptr) {
+        live_metrics->queued_jobs = static_cast<int64_t>(requests.size());
+    }
+}
+
+bool ServerQueue::pop(ServerRequest& request) {
+    std::unique_lock<std::mutex> lock(mutex);
+    condition.wait(lock, [this] {
+        return !requests.empty() || is_closed;
+    });
+
+    if (requests.empty()) {
+        return false;
+    }
+
+    const auto it = find_next();
+    request = std::move(*it);
+    requests.erase(it);
+    update_depth();
+    return true;
+}
+
+bool ServerQueue::pop_preempting(int priority, const bool& is_finished, ServerRequest& request) {
+    std::unique_lock<std::mutex> lock(mutex);
+    auto it = requests.end();
+    condition.wait(lock, [this, priority, &is_finished, &it] {
+        it = find_next();
+        return is_finished || (it != requests.end() && (it->is_canceled || it->priority > priority));
+    });
+
+    if (is_finished) {
+        return false;
+    }
+
+    request = std::move(*it);
+    requests.erase(it);
+    update_depth();
+    return true;
+}
+
+void ServerQueue::finish(bool& is_finished) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        is_finished = true;
+    }
+    condition.notify_all();
+}
+
+void ServerQueue::add_job(ServerJob& job) {
+    std::lock_guard<std::mutex> lock(mutex);
+    jobs.push_back(&job);
+}
+
+void ServerQueue::remove_job(const ServerJob& job) {
+    std::lock_guard<std::mutex> lock(mutex);
+    jobs.erase(std::remove(jobs.begin(), jobs.end(), &job), jobs.end());
+}
+
+// `--output` of a request, written as the next argument or after an equals sign.
+static std::string get_request_output(const std::vector<std::string>& arguments) {
+    for (size_t i = 0; i < arguments.size(); i++) {
+        if (arguments[i] == "--output" && i + 1 < arguments.size()) {
+            return arguments[i + 1];
+        }
+        if (arguments[i].compare(0, 9, "--output=") == 0) {
+            return arguments[i].substr(9);
+        }
+    }
+    return {};
+}
+
+// Splits request lines until the input is closed or `quit` is read. Lines that are not valid requests are still queued,
+// so the client gets a response for each of them.
+static void read_server_requests(ServerQueue& queue) noexcept {
+    try {
+        std::string line;
+        for (size_t number = 1; std::getline(std::cin, line); number++) {
+            std::vector<std::string> arguments = split_manifest_line(line);
+            if (arguments.empty()) {
+                continue;
+            }
+
+            if (arguments.size() == 1 && arguments.front() == "quit") {
+                break;
+            }
+
+            ServerRequest request;
+            request.id = arguments[0];
+            request.number = number;
+
+            char* end = nullptr;
+            const long priority = arguments.size() > 2 ? std::strtol(arguments[1].c_str(), &end, 10) : 0;
+            if (end != nullptr && *end == '\0' && end != arguments[1].c_str() && priority >= INT_MIN && priority <= INT_MAX) {
+                request.priority = static_cast<int>(priority);
+                request.arguments.assign(arguments.begin() + 2, arguments.end());
+                request.output = get_request_output(request.arguments);
+            } else {
+                // Errors are reported before anything else in the queue.
+                request.priority = INT_MAX;
+            }
+
+            queue.push(std::move(request));
+        }
+    } catch (const std::exception&) {
+        // The input is treated as closed, requests already queued are still compiled.
+    }
+
+    queue.close();
+}
+
+// Compiles a request and answers it. 2D jobs are compiled on a thread of their own while this thread waits for requests
+// that preempt them: the job is paused at its next check point, the preempting request is served here, which may
+// preempt it in turn, and the job is resumed where it stopped. The output of every job is printed with its `done`, so
+// outputs of preempted jobs don't mix with those of the requests that preempted them. Cube maps and BRDF LUTs are
+// compiled on this thread, which owns the renderer, and are only canceled, not preempted.
+static void serve_request(CompilerContext& context, ServerQueue& queue, const ServerRequest& request) {
+    std::cout << "start " << request.id << std::endl;
+
+    const auto before = std::chrono::steady_clock::now();
+
+    int result = 1;
+    ServerJob server_job;
+    std::ostringstream log;
+    CompileJob job;
+    if (request.is_canceled) {
+        server_job.control.cancel();
+    } else if (request.arguments.empty()) {
+        std::cout << "Texture compiler error. Server request " << request.number << " must be an identifier, an integer priority and a job." << std::endl;
+    } else if (parse_job_arguments(request.arguments, "server request", request.number, job) == 0) {
+        server_job.output = request.output;
+        job.control = &server_job.control;
+        queue.add_job(server_job);
+
+        if (job.kind == TextureKind::CUBE_MAP || job.kind == TextureKind::BRDF_LUT) {
+            result = compile(context, job, log, false);
+        } else {
+            bool is_finished = false;
+            std::thread thread([&context, &queue, &job, &log, &result, &is_finished] {
+                result = compile(context, job, log, false);
+                queue.finish(is_finished);
+            });
+
+            ServerRequest preempting;
+            while (queue.pop_preempting(request.priority, is_finished, preempting)) {
+                server_job.control.pause();
+                serve_request(context, queue, preempting);
+                server_job.control.resume();
+            }
+            thread.join();
+        }
+
+        queue.remove_job(server_job);
+    }
+
+    std::cout << log.str();
+
+    const auto after = std::chrono::steady_clock::now();
+    const auto milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(after - before);
+    if (result != 0 && server_job.control.is_canceled()) {
+        std::cout << "done " << request.id << " canceled" << std::endl;
+    } else {
+        std::cout << "done " << request.id << (result == 0 ? " ok " : " failed ") << std::setprecision(3) << milliseconds.count() / 1000.f << std::endl;
+    }
+}
+
+// Jobs are compiled one at a time with every thread of the pool compressing the blocks of the current job, which is
+// the fastest way to finish a single small job, unless a request of a higher priority preempts it, see
+// `serve_request`. The renderer, its shaders, the compressor and the pool are created once, before `ready` is printed.
+static int run_server(CompilerContext& context) {
+    if (warm_up_renderer(context) != 0) {
+        // Error is printed in `warm_up_renderer`.
+        return 1;
+    }
+
+    // The reader thread must not flush the output, which the main thread is writing at the same time.
+    std::cin.tie(nullptr);
+
+    ServerQueue queue;
+    queue.live_metrics = context.live_metrics ? &*context.live_metrics : nullptr;
+    std::thread reader(read_server_requests, std::ref(queue));
+
+    std::cout << "ready" << std::endl;
+
+    ServerRequest request;
+    while (queue.pop(request)) {
+        serve_request(context, queue, request);
+    }
+
+    reader.join();
+    return 0;
+}
+
+// Manifest jobs are compiled by workers, the coordinator only hands them out. With `--cache` and `is_restoring` the
+// outputs are restored from the cache afterwards, which the workers share through `--remote-cache`, so the coordinator
+// ends up with every output even when workers write them to storage of their own. See `run_coordinator` for the rest.
+static int coordinate_manifest(CompilerContext& context, const std::vector<CompileJob>& jobs, const std::vector<std::string>& lines, uint16_t port,
+                               size_t memory_budget, bool is_restoring, const std::function<void(uint16_t)>& on_listening = {},
+                               const std::function<bool()>& is_abandoned = {}) {
+    const auto before = std::chrono::steady_clock::now();
+
+    std::vector<CoordinatorJob> coordinator_jobs(jobs.size());
+    for (size_t i = 0; i < jobs.size(); i++) {
+        coordinator_jobs[i].line = lines[i];
+        coordinator_jobs[i].description = jobs[i].input + " -> " + get_job_outputs(jobs[i]).front();
+    }
+
+    // The longest jobs are handed out first, like `compile_manifest` starts them.
+    std::vector<size_t> order;
+    get_job_order(context, jobs, order);
+
+    std::vector<bool> is_failed;
+    if (!run_coordinator(port, coordinator_jobs, order, is_failed, std::cout, on_listening, is_abandoned)) {
+        // Error is printed in `run_coordinator`.
+        return 1;
+    }
+
+    const auto after = std::chrono::steady_clock::now();
+    const auto milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(after - before);
+    std::cout << "Distributed manifest compilation took " << std::setprecision(3) << milliseconds.count() / 1000.f << " seconds." << std::endl;
+
+    const size_t failed_jobs = std::count(is_failed.begin(), is_failed.end(), true);
+    if (failed_jobs != 0) {
+        std::cout << "Texture compiler error. " << failed_jobs << " of " << jobs.size() << " manifest jobs failed." << std::endl;
+        return 1;
+    }
+
+    if (context.cache && is_restoring) {
+        std::cout << "Restoring the outputs from the cache." << std::endl;
+        return compile_manifest(context, jobs, memory_budget);
+    }
+    return 0;
+}
+
+// A worker process that exits this soon after it started, this many times in a row, isn't started again. It most likely
+// fails on its arguments or its renderer rather than on a job.
+static constexpr std::chrono::seconds WORKER_RESTART_MIN_LIFETIME(2);
+static constexpr size_t WORKER_MAX_SHORT_LIVES = 3;
+
+// bgfx is a single context per process, so a manifest is compiled on several GPUs by a local coordinator and a worker
+// process per GPU, which gets the global options of this process that apply to compiling and its share of the threads.
+// Cube map jobs render on the GPU of their worker and encode on its threads, 2D jobs are spread over the same workers.
+// `--processes` runs the same workers without a GPU of their own, for the crash isolation of separate processes: they
+// stay up for the whole manifest, so their renderer, pools and shader cache are set up once, and a worker that crashes
+// is started again while the coordinator queues its job for another one.
+static int compile_manifest_in_processes(CompilerContext& context, const CommandLine& command_line, const std::vector<CompileJob>& jobs, const std::vector<std::string>& lines,
+                                         const std::string& executable) {
+    const auto quote = [](const std::string& value) {
+        return "\"" + value + "\"";
+    };
+
+    const size_t process_count = command_line.gpus != 0 ? command_line.gpus : command_line.processes;
+    const size_t thread_count = context.pool.worker_count() + 1;
+    std::string arguments = " --jobs " + std::to_string(std::max(thread_count / process_count, static_cast<size_t>(1)));
+    if (!command_line.backend.empty()) {
+        arguments += " --backend " + command_line.backend;
+    }
+    if (!command_line.renderer.empty()) {
+        arguments += " --renderer " + command_line.renderer;
+    }
+    if (command_line.is_headless) {
+        arguments += " --headless";
+    }
+    if (command_line.is_no_compute) {
+        arguments += " --no-compute";
+    }
+    if (command_line.is_gpu_mips) {
+        arguments += " --gpu-mips";
+    }
+    if (command_line.is_verbose) {
+        arguments += " --verbose";
+    }
+    if (command_line.is_report_quality) {
+        arguments += " --report-quality";
+    }
+    if (command_line.is_report_blocks) {
+        arguments += " --report-blocks";
+    }
+    if (command_line.is_incremental) {
+        arguments += " --incremental";
+    }
+    if (command_line.time_budget != 0) {
+        arguments += " --time-budget " + std::to_string(command_line.time_budget);
+    }
+    if (!command_line.cache.empty()) {
+        arguments += " --cache " + quote(command_line.cache);
+    }
+    if (!command_line.remote_cache.empty()) {
+        arguments += " --remote-cache " + quote(command_line.remote_cache);
+    }
+    if (command_line.is_remote_filtered) {
+        arguments += " --remote-filter";
+    }
+    if (command_line.cache_size != 0) {
+        arguments += " --cache-size " + std::to_string(command_line.cache_size);
+    }
+    if (command_line.is_source_cached) {
+        arguments += " --cache-sources";
+    }
+    if (!command_line.shader_cache.empty()) {
+        arguments += " --shader-cache " + quote(command_line.shader_cache);
     }
-
-    HandleWrapper(HandleType handle) noexcept
-            : handle(handle) {
+    if (command_line.is_memory_reused) {
+        arguments += " --reuse-memory";
     }
-
-    HandleWrapper(const HandleWrapper&) = delete;
-    HandleWrapper& operator=(const HandleWrapper&) = delete;
-
-    HandleWrapper& operator=(HandleWrapper&& original) noexcept {
-        this->~HandleWrapper();
-        handle = original.handle;
-        original.handle = BGFX_INVALID_HANDLE;
-        return *this;
+    if (command_line.is_huge_pages) {
+        arguments += " --huge-pages";
     }
-
-    HandleWrapper& operator=(HandleType handle_) noexcept {
-        this->~HandleWrapper();
-        handle = handle_;
-        return *this;
+    if (!command_line.cpu_features.empty()) {
+        arguments += " --cpu-features " + command_line.cpu_features;
     }
-
-    ~HandleWrapper() {
-        if (bgfx::isValid(handle)) {
-            bgfx::destroy(handle);
-        }
+    if (command_line.is_pinned) {
+        arguments += " --pin-threads";
     }
 
-    operator HandleType() const noexcept {
-        return handle;
-    }
+    std::vector<std::thread> workers;
+    std::atomic<size_t> running_workers { process_count };
+    std::atomic<bool> is_finished { false };
 
-    HandleType handle = BGFX_INVALID_HANDLE;
-};
+    const auto on_listening = [&](uint16_t port) {
+        for (size_t i = 0; i < process_count; i++) {
+            std::string command = quote(executable) + " --worker 127.0.0.1:" + std::to_string(port) + arguments;
+            if (command_line.gpus != 0) {
+                command += " --gpu " + std::to_string(i);
+            }
+#if BX_PLATFORM_WINDOWS
+            // `cmd /c` strips the first and the last quote of the command.
+            command = "\"" + command + "\"";
+#endif
+            workers.emplace_back([command, &running_workers, &is_finished] {
+                size_t short_lives = 0;
+                for (;;) {
+                    const auto start = std::chrono::steady_clock::now();
+                    if (std::system(command.c_str()) == 0) {
+                        break;
+                    }
+
+                    // Workers only exit with an error when they crash or lose the coordinator, which then hands their
+                    // job to another worker.
+                    short_lives = std::chrono::steady_clock::now() - start < WORKER_RESTART_MIN_LIFETIME ? short_lives + 1 : 0;
+                    if (is_finished || short_lives == WORKER_MAX_SHORT_LIVES) {
+                        std::cout << "Texture compiler warning. A worker process exited with an error." << std::endl;
+                        break;
+                    }
+                    std::cout << "Texture compiler warning. A worker process exited with an error and is started again." << std::endl;
+                }
+                running_workers--;
+            });
+        }
+    };
 
-static float CUBE_VERTICES[] = {
-        // Back face.
-        -1.f, -1.f, -1.f, // Bottom-left.
-         1.f,  1.f, -1.f, // Top-right.
-         1.f, -1.f, -1.f, // Bottom-right.
-         1.f,  1.f, -1.f, // Top-right.
-        -1.f, -1.f, -1.f, // Bottom-left.
-        -1.f,  1.f, -1.f, // Top-left.
-        // Front face.
-        -1.f, -1.f,  1.f, // Bottom-left.
-         1.f, -1.f,  1.f, // Bottom-right.
-         1.f,  1.f,  1.f, // Top-right.
-         1.f,  1.f,  1.f, // Top-right.
-        -1.f,  1.f,  1.f, // Top-left.
-        -1.f, -1.f,  1.f, // Bottom-left.
-        // Left face.
-        -1.f,  1.f,  1.f, // Top-right.
-        -1.f,  1.f, -1.f, // Top-left.
-        -1.f, -1.f, -1.f, // Bottom-left.
-        -1.f, -1.f, -1.f, // Bottom-left.
-        -1.f, -1.f,  1.f, // Bottom-right.
-        -1.f,  1.f,  1.f, // Top-right.
-        // Right face.
-         1.f,  1.f,  1.f, // Top-left.
-         1.f, -1.f, -1.f, // Bottom-right.
-         1.f,  1.f, -1.f, // Top-right.
-         1.f, -1.f, -1.f, // Bottom-right.
-         1.f,  1.f,  1.f, // Top-left.
-         1.f, -1.f,  1.f, // Bottom-left.
-        // Bottom face.
-        -1.f, -1.f, -1.f, // Top-right.
-         1.f, -1.f, -1.f, // Top-left.
-         1.f, -1.f,  1.f, // Bottom-left.
-         1.f, -1.f,  1.f, // Bottom-left.
-        -1.f, -1.f,  1.f, // Bottom-right.
-        -1.f, -1.f, -1.f, // Top-right.
-        // Top face.
-        -1.f,  1.f, -1.f, // Top-left.
-         1.f,  1.f , 1.f, // Bottom-right.
-         1.f,  1.f, -1.f, // Top-right.
-         1.f,  1.f,  1.f, // Bottom-right.
-        -1.f,  1.f, -1.f, // Top-left.
-        -1.f,  1.f,  1.f  // Bottom-left.
-};
+    const auto is_abandoned = [&running_workers] {
+        return running_workers == 0;
+    };
 
-static const bgfx::VertexDecl CUBE_VERTEX_DECLARATION = [] {
-    bgfx::VertexDecl result;
-    result.begin().add(bgfx::Attrib::Position, 3, bgfx::AttribType::Float).end();
+    const int result = coordinate_manifest(context, jobs, lines, 0, 0, false, on_listening, is_abandoned);
+    is_finished = true;
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
     return result;
-}();
-
-static glm::mat4 CUBE_MAP_VIEWS[] = {
-        glm::lookAt(glm::vec3(0.f, 0.f, 0.f), glm::vec3( 1.f,  0.f,  0.f), glm::vec3(0.f, -1.f,  0.f)),
-        glm::lookAt(glm::vec3(0.f, 0.f, 0.f), glm::vec3(-1.f,  0.f,  0.f), glm::vec3(0.f, -1.f,  0.f)),
-        glm::lookAt(glm::vec3(0.f, 0.f, 0.f), glm::vec3( 0.f, -1.f,  0.f), glm::vec3(0.f,  0.f, -1.f)),
-        glm::lookAt(glm::vec3(0.f, 0.f, 0.f), glm::vec3( 0.f,  1.f,  0.f), glm::vec3(0.f,  0.f,  1.f)),
-        glm::lookAt(glm::vec3(0.f, 0.f, 0.f), glm::vec3( 0.f,  0.f,  1.f), glm::vec3(0.f, -1.f,  0.f)),
-        glm::lookAt(glm::vec3(0.f, 0.f, 0.f), glm::vec3( 0.f,  0.f, -1.f), glm::vec3(0.f, -1.f,  0.f))
-};
-
-static glm::mat4 CUBE_MAP_VIEWS_GLSL[] = {
-        glm::lookAt(glm::vec3(0.f, 0.f, 0.f), glm::vec3( 1.f,  0.f,  0.f), glm::vec3(0.f, -1.f,  0.f)),
-        glm::lookAt(glm::vec3(0.f, 0.f, 0.f), glm::vec3(-1.f,  0.f,  0.f), glm::vec3(0.f, -1.f,  0.f)),
-        glm::lookAt(glm::vec3(0.f, 0.f, 0.f), glm::vec3( 0.f,  1.f,  0.f), glm::vec3(0.f,  0.f,  1.f)),
-        glm::lookAt(glm::vec3(0.f, 0.f, 0.f), glm::vec3( 0.f, -1.f,  0.f), glm::vec3(0.f,  0.f, -1.f)),
-        glm::lookAt(glm::vec3(0.f, 0.f, 0.f), glm::vec3( 0.f,  0.f,  1.f), glm::vec3(0.f, -1.f,  0.f)),
-        glm::lookAt(glm::vec3(0.f, 0.f, 0.f), glm::vec3( 0.f,  0.f, -1.f), glm::vec3(0.f, -1.f,  0.f))
-};
+}
 
-static glm::mat4 CUBE_MAP_PROJECTION = glm::perspective(glm::radians(90.0f), 1.0f, 0.1f, 10.0f);
+// Workers compile one job at a time with all the `--jobs` threads, like the server, and their global options like
+// `--cache`, `--remote-cache` and `--incremental` apply to every job.
+static int work_for_coordinator(CompilerContext& context, const std::string& address) {
+    const auto compile_line = [&context](size_t index, const std::string& line) {
+        CompileJob job;
+        if (parse_job_arguments(split_manifest_line(line), "coordinator job", index + 1, job) != 0) {
+            // Error is printed in `parse_job_arguments`.
+            return false;
+        }
 
-static const bgfx::EmbeddedShader CUBE_MAP_SHADER[] = {
-        BGFX_EMBEDDED_SHADER(cube_map_shader_vertex),
-        BGFX_EMBEDDED_SHADER(cube_map_shader_fragment),
-        BGFX_EMBEDDED_SHADER_END()
-};
+        std::cout << "Job " << index + 1 << ": " << job.input << " -> " << get_job_outputs(job).front() << std::endl;
+        return compile(context, job, std::cout, false) == 0;
+    };
 
-static const bgfx::EmbeddedShader IRRADIANCE_SHADER[] = {
-        BGFX_EMBEDDED_SHADER(cube_map_shader_vertex),
-        BGFX_EMBEDDED_SHADER(irradiance_shader_fragment),
-        BGFX_EMBEDDED_SHADER_END()
-};
+    // Error is printed in `run_worker`.
+    return run_worker(address, compile_line, std::cout) ? 0 : 1;
+}
 
-static const bgfx::EmbeddedShader PREFILTER_SHADER[] = {
-        BGFX_EMBEDDED_SHADER(cube_map_shader_vertex),
-        BGFX_EMBEDDED_SHADER(prefilter_shader_fragment),
-        BGFX_EMBEDDED_SHADER_END()
-};
+// Cache trimming is done once per process rather than after every stored entry, because it scans the whole cache directory.
+// Path of `--input` and `--output` that stands for the standard input and output.
+static const std::string STANDARD_STREAM = "-";
 
-static int count_mip_maps(size_t size) noexcept {
-    int result = 1;
-    while (size > 1) {
-        size /= 2;
-        result++;
-    }
-    return result;
+static bool is_streamed(const CompileJob& job) {
+    const std::vector<std::string> outputs = get_job_outputs(job);
+    return job.input == STANDARD_STREAM || std::find(outputs.begin(), outputs.end(), STANDARD_STREAM) != outputs.end();
 }
 
-static int compile_cube_map(const std::string& input, const std::string& output, size_t output_size,
-                            const std::string& output_irradiance, size_t irradiance_size,
-                            const std::string& output_prefilter, size_t prefilter_size,
-                            Compression compression) noexcept {
-    SdlWrapper sdl;
-    if (!sdl.initialized) {
-        std::cout << "Texture compiler error. Failed to initialize a video subsystem." << std::endl;
-        return 1;
+// Reads the standard input until it's closed.
+static bool read_standard_input(std::vector<char>& data) {
+    constexpr size_t CHUNK_SIZE = 1024 * 1024;
+    for (;;) {
+        const size_t size = data.size();
+        data.resize(size + CHUNK_SIZE);
+        const size_t read = std::fread(data.data() + size, 1, CHUNK_SIZE, stdin);
+        data.resize(size + read);
+        if (read < CHUNK_SIZE) {
+            return std::ferror(stdin) == 0;
+        }
     }
+}
 
-    WindowWrapper window;
-    if (window.window == nullptr) {
-        std::cout << "Texture compiler error. Failed to initialize a window." << std::endl;
-        return 1;
+static bool write_output_file(const std::string& path, const char* data, size_t size) {
+    const std::string temporary_path = get_temporary_path(path);
+    FILE* const file = std::fopen(temporary_path.c_str(), "wb");
+    if (file == nullptr) {
+        return false;
     }
 
-    SDL_SysWMinfo native_info;
-    SDL_VERSION(&native_info.version)
-    if (!SDL_GetWindowWMInfo(window.window, &native_info)) {
-        std::cout << "Texture compiler error. Failed to get system window handle." << std::endl;
-        return 1;
+    bool result = std::fwrite(data, 1, size, file) == size;
+    result = std::fclose(file) == 0 && result;
+    if (!result) {
+        std::remove(temporary_path.c_str());
+        return false;
     }
+    return replace_file(temporary_path, path);
+}
 
-    bgfx::PlatformData platform_data {};
+// A job with `--input -` or `--output -` is compiled in memory by `compile_encoded_image`, from the whole standard input
+// or the mapped input file, and the output named `-` is written to the standard output while the others are written to
+// their files. Messages that would go to the standard output go to the standard error instead, so they never mix with
+// the texture.
+static int compile_streamed(CompilerContext& context, const CompileJob& job) {
 #if BX_PLATFORM_WINDOWS
-    platform_data.nwh = native_info.info.win.window;
-#elif BX_PLATFORM_OSX
-    platform_data.ndt = nullptr;
-    platform_data.nwh = native_info.info.cocoa.window;
-#elif BX_PLATFORM_LINUX
-    platform_data.ndt = native_info.info.x11.display;
-    platform_data.nwh = reinterpret_cast<void*>(native_info.info.x11.window);
+    _setmode(_fileno(stdin), _O_BINARY);
+    _setmode(_fileno(stdout), _O_BINARY);
 #endif
-    bgfx::setPlatformData(platform_data);
 
-    BgfxWrapper bgfx;
-    if (!bgfx.initialized) {
-        std::cout << "Texture compiler error. Failed to initialize a renderer." << std::endl;
+    std::cout.rdbuf(std::cerr.rdbuf());
+
+    const std::vector<std::string> outputs = get_job_outputs(job);
+    if (std::count(outputs.begin(), outputs.end(), STANDARD_STREAM) > 1) {
+        std::cout << "Texture compiler error. Only one output can be written to the standard output." << std::endl;
         return 1;
     }
 
-    bgfx::reset(256, 256, BGFX_RESET_NONE);
+    std::vector<char> standard_input;
+    std::optional<MappedFile> file;
+    const void* data = nullptr;
+    size_t size = 0;
+    if (job.input == STANDARD_STREAM) {
+        if (!read_standard_input(standard_input)) {
+            std::cout << "Texture compiler error. Failed to read the standard input." << std::endl;
+            return 1;
+        }
+        data = standard_input.data();
+        size = standard_input.size();
+    } else {
+        file.emplace(job.input);
+        data = file->data;
+        size = file->size;
+    }
 
-    stbi_set_flip_vertically_on_load(1);
+    bool is_written = true;
+    const OutputSink sink = [&is_written](const std::string& output, const char* output_data, size_t output_size) {
+        if (output != STANDARD_STREAM) {
+            is_written = write_output_file(output, output_data, output_size) && is_written;
+        } else {
+            is_written = std::fwrite(output_data, 1, output_size, stdout) == output_size && std::fflush(stdout) == 0 && is_written;
+        }
+    };
 
-    HdrWrapper data(input);
-    if (data.data == nullptr) {
-        std::cout << "Texture compiler error. Failed to open texture file." << std::endl;
+    if (compile_encoded_image(context, job, data, size, sink, std::cout) != 0) {
+        // Error is printed in `compile_encoded_image`.
         return 1;
     }
-
-    if (data.width <= 0 || data.height <= 0 || data.width > 65535 || data.height > 65535) {
-        std::cout << "Texture compiler error. Texture is too big." << std::endl;
+    if (!is_written) {
+        std::cout << "Texture compiler error. Failed to write an output." << std::endl;
         return 1;
     }
+    return 0;
+}
 
-    HandleWrapper<bgfx::TextureHandle> texture = bgfx::createTexture2D(data.width, data.height, false, 1, bgfx::TextureFormat::RGBA32F, BGFX_SAMPLER_U_CLAMP | BGFX_SAMPLER_V_CLAMP, bgfx::makeRef(data.data, data.width * data.height * 4 * 4));
-    if (!bgfx::isValid(texture)) {
-        std::cout << "Texture compiler error. Failed to create HDR texture." << std::endl;
-        return 1;
-    }
-    bgfx::setName(texture, "original_texture");
+static int finish_compilation(CompilerContext& context, const CommandLine& command_line, int result) noexcept {
+    if (context.cache) {
+        try {
+            context.cache->trim(std::cout);
+        } catch (const std::exception& exception) {
+            std::cout << "Texture compiler warning. Failed to trim the cache: " << exception.what() << "." << std::endl;
+        }
 
-    HandleWrapper<bgfx::VertexBufferHandle> vertex_buffer = bgfx::createVertexBuffer(bgfx::makeRef(CUBE_VERTICES, sizeof(CUBE_VERTICES)), CUBE_VERTEX_DECLARATION);
-    if (!bgfx::isValid(vertex_buffer)) {
-        std::cout << "Texture compiler error. Failed to create cube vertex buffer." << std::endl;
-        return 1;
-    }
-    bgfx::setName(vertex_buffer, "cube_vertices");
+        try {
+            // Warning is printed in `save`.
+            context.cache->input_hashes->save(std::cout);
+        } catch (const std::exception& exception) {
+            std::cout << "Texture compiler warning. Failed to write input hashes: " << exception.what() << "." << std::endl;
+        }
 
-    glm::mat4* cube_map_view_matrices;
+        if (context.cache->remote) {
+            try {
+                // Warning is printed in `finish`.
+                context.cache->remote->finish(std::cout);
+            } catch (const std::exception& exception) {
+                std::cout << "Texture compiler warning. Failed to finish the remote cache: " << exception.what() << "." << std::endl;
+            }
+        }
+    }
 
-    bgfx::RendererType::Enum renderer_type = bgfx::getRendererType();
-    if (renderer_type == bgfx::RendererType::OpenGL || renderer_type == bgfx::RendererType::OpenGLES) {
-        cube_map_view_matrices = CUBE_MAP_VIEWS_GLSL;
-    } else {
-        cube_map_view_matrices = CUBE_MAP_VIEWS;
+    // The history only speeds up later builds, failing to write it doesn't fail this one.
+    if (context.cost_history) {
+        try {
+            // Warning is printed in `save`.
+            context.cost_history->save(std::cout);
+        } catch (const std::exception& exception) {
+            std::cout << "Texture compiler warning. Failed to write cost history: " << exception.what() << "." << std::endl;
+        }
     }
 
-    HandleWrapper<bgfx::UniformHandle> texture_uniform = bgfx::createUniform("s_texture", bgfx::UniformType::Sampler);
-    if (!bgfx::isValid(texture_uniform)) {
-        std::cout << "Texture compiler error. Failed to create texture uniform." << std::endl;
-        return 1;
+    if (!command_line.metrics.empty()) {
+        try {
+            if (!context.metrics->write(command_line.metrics, std::cout)) {
+                // Error is printed in `write`.
+                return 1;
+            }
+        } catch (const std::exception& exception) {
+            std::cout << "Texture compiler error. Failed to write metrics file: " << exception.what() << "." << std::endl;
+            return 1;
+        }
     }
 
-    HandleWrapper<bgfx::TextureHandle> cube_side_textures[6];
-    for (size_t side = 0; side < std::size(cube_side_textures); side++) {
-        const std::string cube_map_view_name = "cube_side_texture_" + std::to_string(side);
+    if (!command_line.trace.empty()) {
+        try {
+            if (!context.metrics->write_trace(command_line.trace, std::cout)) {
+                // Error is printed in `write_trace`.
+                return 1;
+            }
+        } catch (const std::exception& exception) {
+            std::cout << "Texture compiler error. Failed to write trace file: " << exception.what() << "." << std::endl;
+            return 1;
+        }
+    }
 
-        cube_side_textures[side] = bgfx::createTexture2D(static_cast<uint16_t>(output_size), static_cast<uint16_t>(output_size), false, 1, bgfx::TextureFormat::RGBA16F, BGFX_TEXTURE_RT | BGFX_SAMPLER_U_CLAMP | BGFX_SAMPLER_V_CLAMP);
-        if (!bgfx::isValid(cube_side_textures[side])) {
-            std::cout << "Texture compiler error. Failed to create cube map side texture." << std::endl;
+    if (!command_line.profile.empty()) {
+        try {
+            if (!stop_profiler(command_line.profile, std::cout)) {
+                // Error is printed in `stop_profiler`.
+                return 1;
+            }
+        } catch (const std::exception& exception) {
+            std::cout << "Texture compiler error. Failed to write profile file: " << exception.what() << "." << std::endl;
             return 1;
         }
-        bgfx::setName(cube_side_textures[side], cube_map_view_name.c_str());
     }
 
-    bgfx::ShaderHandle vertex_shader_handle = bgfx::createEmbeddedShader(CUBE_MAP_SHADER, renderer_type, "cube_map_shader_vertex");
-    if (!bgfx::isValid(vertex_shader_handle)) {
-        std::cout << "Texture compiler error. Failed to create cube map vertex shader." << std::endl;
-        return 1;
+    return result;
+}
+
+int main(int argc, char* argv[]) {
+    CommandLine command_line;
+
+    // Clara takes every argument that starts with a dash for an option, so the `-` of `--input -` and `--output -` is
+    // joined to its option like `--input=-`.
+    std::vector<std::string> arguments;
+    for (int i = 0; i < argc; i++) {
+        if (i > 1 && std::strcmp(argv[i], "-") == 0 && arguments.back().compare(0, 2, "--") == 0 && arguments.back().find('=') == std::string::npos) {
+            arguments.back() += "=-";
+        } else {
+            arguments.emplace_back(argv[i]);
+        }
+    }
+    std::vector<const char*> argument_pointers;
+    for (const std::string& argument : arguments) {
+        argument_pointers.push_back(argument.c_str());
     }
-    bgfx::setName(vertex_shader_handle, "cube_map_shader_vertex");
 
-    bgfx::ShaderHandle fragment_shader_handle = bgfx::createEmbeddedShader(CUBE_MAP_SHADER, renderer_type, "cube_map_shader_fragment");
-    if (!bgfx::isValid(fragment_shader_handle)) {
-        std::cout << "Texture compiler error. Failed to create cube map fragment shader." << std::endl;
-        bgfx::destroy(vertex_shader_handle);
+    auto cli = create_command_line_parser(command_line);
+    if (auto result = cli.parse(clara::Args(static_cast<int>(argument_pointers.size()), argument_pointers.data())); !result) {
+        std::cout << "Texture compiler error. Failed to parse command line arguments: " << result.errorMessage() << std::endl;
         return 1;
     }
-    bgfx::setName(fragment_shader_handle, "cube_map_shader_fragment");
 
-    HandleWrapper<bgfx::ProgramHandle> cube_map_program_handle = bgfx::createProgram(vertex_shader_handle, fragment_shader_handle, true);
-    if (!bgfx::isValid(cube_map_program_handle)) {
-        std::cout << "Texture compiler error. Failed to create cube map program." << std::endl;
-        bgfx::destroy(fragment_shader_handle);
-        bgfx::destroy(vertex_shader_handle);
+    if (command_line.is_help) {
+        std::cout << cli << std::endl;
         return 1;
     }
 
-    bgfx::ViewId current_view = 0;
-    std::vector<HandleWrapper<bgfx::FrameBufferHandle>> cube_map_frame_buffers;
-
-    // Cube map sides to read back from.
-    for (size_t side = 0; side < 6; side++, current_view++) {
-        const std::string cube_side_view_name = "cube_side_view_" + std::to_string(side);
-
-        bgfx::setViewClear(current_view, BGFX_CLEAR_COLOR);
-        bgfx::setViewName(current_view, cube_side_view_name.c_str());
-
-        bgfx::FrameBufferHandle frame_buffer = bgfx::createFrameBuffer(1, &cube_side_textures[side].handle, false);
-        if (!bgfx::isValid(frame_buffer)) {
-            std::cout << "Texture compiler error. Failed to create cube map side frame buffer." << std::endl;
+    // Before the thread pool of the compiler context is started. With huge pages the process may be executed again.
+    if (command_line.is_huge_pages && !use_huge_pages(argv)) {
+        std::cout << "Texture compiler warning. Command line argument --huge-pages is not supported on this platform." << std::endl;
+    }
+    if (command_line.is_memory_reused && !reuse_freed_memory()) {
+        std::cout << "Texture compiler warning. Command line argument --reuse-memory is not supported on this platform." << std::endl;
+    }
+    if (!command_line.cpu_features.empty()) {
+        InstructionSet instruction_set;
+        if (!parse_instruction_set(command_line.cpu_features, instruction_set)) {
+            std::cout << "Texture compiler error. Command line argument --cpu-features must be scalar, sse2, avx2 or neon." << std::endl;
+            return 1;
+        }
+        if (!set_instruction_set(instruction_set)) {
+            std::cout << "Texture compiler error. Command line argument --cpu-features " << command_line.cpu_features << " is not supported by this build or CPU, which use "
+                      << get_instruction_set_name(get_instruction_set()) << "." << std::endl;
             return 1;
         }
-        cube_map_frame_buffers.emplace_back(frame_buffer);
-
-        bgfx::setViewFrameBuffer(current_view, frame_buffer);
-        bgfx::setViewRect(current_view, 0, 0, static_cast<uint16_t>(output_size), static_cast<uint16_t>(output_size));
-        bgfx::setViewTransform(current_view, glm::value_ptr(cube_map_view_matrices[side]), glm::value_ptr(CUBE_MAP_PROJECTION));
-
-        bgfx::setVertexBuffer(0, vertex_buffer, 0, static_cast<uint32_t>(std::size(CUBE_VERTICES) / 3));
-        bgfx::setTexture(0, texture_uniform, texture);
-
-        bgfx::setState(BGFX_STATE_WRITE_RGB | BGFX_STATE_CULL_CCW);
-        bgfx::submit(current_view, cube_map_program_handle);
     }
 
-    TextureCompilerErrorHandler error_handler;
-
-    nvtt::OutputOptions cube_map_output_options;
-    cube_map_output_options.setFileName(output.c_str());
-    cube_map_output_options.setContainer(nvtt::Container_DDS10);
-    cube_map_output_options.setErrorHandler(&error_handler);
-
-    nvtt::CompressionOptions cube_map_compression_options;
-    switch (compression) {
-        case Compression::GOOD_BUT_SLOW:
-        case Compression::POOR_BUT_FAST:
-            cube_map_compression_options.setFormat(nvtt::Format_BC6);
-            cube_map_compression_options.setPixelType(nvtt::PixelType_Float);
-            break;
-        case Compression::NO_COMPRESSION:
-            // R16G16B16A16.
-            cube_map_compression_options.setFormat(nvtt::Format_RGB);
-            cube_map_compression_options.setPixelFormat(16, 16, 16, 16);
-            cube_map_compression_options.setPixelType(nvtt::PixelType_Float);
-            break;
+    size_t thread_count = command_line.jobs;
+    if (thread_count == 0) {
+        thread_count = std::max(std::thread::hardware_concurrency(), 1U);
     }
 
-    nvtt::Compressor cube_map_compressor;
+    CompilerSettings settings;
+    settings.thread_count = thread_count;
+    settings.is_pinned = command_line.is_pinned;
+    if (command_line.is_pinned && get_cpu_topology().empty()) {
+        std::cout << "Texture compiler warning. Command line argument --pin-threads is not supported on this platform." << std::endl;
+    }
+    settings.is_compute_allowed = !command_line.is_no_compute;
+    settings.is_gpu_mips = command_line.is_gpu_mips;
+    settings.is_headless = command_line.is_headless;
+    settings.gpu_index = command_line.gpu;
+    settings.is_verbose = command_line.is_verbose;
+    settings.is_profiling = command_line.is_verbose || !command_line.metrics.empty() || !command_line.trace.empty() || command_line.metrics_port >= 0 || command_line.is_bench_gpu;
 
-    auto before = std::chrono::system_clock::now();
+    if (!command_line.shader_cache.empty()) {
+        settings.shader_cache_directory = command_line.shader_cache;
+    } else if (!command_line.cache.empty()) {
+        settings.shader_cache_directory = (std::filesystem::path(command_line.cache) / SHADER_CACHE_DIRECTORY).string();
+    }
 
-    std::cout << "Progress: 0%" << std::flush;
+    if (command_line.backend.empty() || command_line.backend == "auto") {
+        settings.backend = Backend::AUTO;
+    } else if (command_line.backend == "gpu") {
+        settings.backend = Backend::GPU;
+    } else if (command_line.backend == "cpu") {
+        settings.backend = Backend::CPU;
+    } else {
+        std::cout << "Texture compiler error. Command line argument --backend must be cpu, gpu or auto." << std::endl;
+        return 1;
+    }
 
-    int total_mip_levels = count_mip_maps(output_size);
-    if (!cube_map_compressor.outputHeader(nvtt::TextureType_Cube, static_cast<int>(output_size), static_cast<int>(output_size), 1, 1, total_mip_levels, false, cube_map_compression_options, cube_map_output_options)) {
-        // Error is printed via `error_handler`.
+    if (command_line.renderer.empty() || command_line.renderer == "auto") {
+        settings.renderer_api = RendererApi::AUTO;
+    } else if (command_line.renderer == "vulkan") {
+        settings.renderer_api = RendererApi::VULKAN;
+    } else if (command_line.renderer == "d3d11") {
+        settings.renderer_api = RendererApi::D3D11;
+    } else if (command_line.renderer == "d3d12") {
+        settings.renderer_api = RendererApi::D3D12;
+    } else if (command_line.renderer == "metal") {
+        settings.renderer_api = RendererApi::METAL;
+    } else if (command_line.renderer == "gl") {
+        settings.renderer_api = RendererApi::OPENGL;
+    } else {
+        std::cout << "Texture compiler error. Command line argument --renderer must be vulkan, d3d11, d3d12, metal, gl or auto." << std::endl;
+        return 1;
+    }
+    if (settings.renderer_api != RendererApi::AUTO && settings.backend == Backend::CPU) {
+        std::cout << "Texture compiler error. Command line argument --renderer can't be combined with --backend cpu." << std::endl;
         return 1;
     }
 
-    std::vector<uint16_t> data_to_save(output_size * output_size * 4);
+    CompilerContext context(settings);
+    context.is_incremental = command_line.is_incremental;
+    context.input_locality_window = command_line.input_locality;
+    context.is_quality_report = command_line.is_report_quality;
+    context.is_block_report = command_line.is_report_blocks;
+    context.time_budget_seconds = static_cast<double>(command_line.time_budget) / 1000.0;
+
+    if (!command_line.cost_history.empty()) {
+        context.cost_history.emplace(command_line.cost_history);
+        try {
+            // Warning is printed in `load`, a malformed history only starts over.
+            context.cost_history->load(std::cout);
+        } catch (const std::exception& exception) {
+            std::cout << "Texture compiler warning. Failed to read cost history: " << exception.what() << "." << std::endl;
+        }
+    }
 
-    for (int side = 0; side < 6; side++, current_view++) {
-        const std::string cube_side_read_back_view_name = "cube_side_read_back_view_" + std::to_string(side);
-        bgfx::setViewName(current_view, cube_side_read_back_view_name.c_str());
+    // The trace is written from the same measurements as the metrics.
+    if (!command_line.metrics.empty() || !command_line.trace.empty()) {
+        context.metrics.emplace();
+    }
 
-        // `BGFX_TEXTURE_RT` and `BGFX_TEXTURE_READ_BACK` are not compatible, so blit the render target texture to another texture and read back from it.
-        bgfx::TextureHandle blit_texture = bgfx::createTexture2D(static_cast<uint16_t>(output_size), static_cast<uint16_t>(output_size), false, 1, bgfx::TextureFormat::RGBA16F, BGFX_TEXTURE_BLIT_DST | BGFX_TEXTURE_READ_BACK | BGFX_SAMPLER_U_CLAMP | BGFX_SAMPLER_V_CLAMP);
-        if (!bgfx::isValid(blit_texture)) {
-            std::cout << "\rTexture compiler error. Failed to create a read back texture." << std::endl;
+    // After the context is created, so the counters are opened for the workers of its thread pool as well.
+    if (command_line.is_hardware_counters) {
+        if (command_line.metrics.empty() && command_line.trace.empty()) {
+            std::cout << "Texture compiler error. Command line argument --hardware-counters is used only with --metrics and --trace." << std::endl;
             return 1;
         }
-        bgfx::blit(current_view, blit_texture, 0, 0, cube_side_textures[side], 0, 0, static_cast<uint16_t>(output_size), static_cast<uint16_t>(output_size));
-
-        const uint32_t frame_id = bgfx::readTexture(blit_texture, data_to_save.data());
-
-        // Wait until read back is available.
-        uint32_t current_frame_id;
-        do {
-            current_frame_id = bgfx::frame();
-        } while (current_frame_id < frame_id);
-
-        bgfx::destroy(blit_texture);
+        if (!enable_hardware_counters()) {
+            std::cout << "Texture compiler warning. Hardware counters are not available, they need Linux with perf_event_paranoid of 2 or less and a CPU whose counters are exposed." << std::endl;
+        }
+    }
 
-        nvtt::Surface surface;
-        if (!surface.setImage(nvtt::InputFormat_RGBA_16F, static_cast<int>(output_size), static_cast<int>(output_size), 1, data_to_save.data())) {
-            std::cout << "\rTexture compiler error. Failed to set an image." << std::endl;
+    if (command_line.is_allocation_tracked) {
+        if (command_line.metrics.empty() && command_line.cost_history.empty()) {
+            std::cout << "Texture compiler error. Command line argument --track-allocations is used only with --metrics and --cost-history." << std::endl;
             return 1;
         }
-
-        for (int mip_level = 0; mip_level < total_mip_levels; mip_level++) {
-            if (!cube_map_compressor.compress(surface, side, mip_level, cube_map_compression_options, cube_map_output_options)) {
-                // Error is printed via `error_handler`.
-                return 1;
-            }
-
-            if (mip_level + 1 < total_mip_levels) {
-                if (!surface.buildNextMipmap(nvtt::MipmapFilter_Box)) {
-                    std::cout << "\rTexture compiler error. Failed to build a cube map mip map." << std::endl;
-                    return 1;
-                }
-            }
-
-            std::cout << "\rProgress: " << static_cast<int>(static_cast<float>(side * total_mip_levels + mip_level + 1) * 100.f / total_mip_levels / 6) << "%" << std::flush;
+#if defined(TEXTURE_COMPILER_ALLOCATION_TRACKING)
+        const bool is_allocation_tracking_enabled = is_c_heap_replaced() && enable_allocation_tracking();
+#else
+        const bool is_allocation_tracking_enabled = false;
+#endif
+        if (!is_allocation_tracking_enabled) {
+            std::cout << "Texture compiler warning. Command line argument --track-allocations is not available, it needs Linux with glibc and a build with TEXTURE_COMPILER_ALLOCATION_TRACKING without sanitizers." << std::endl;
         }
     }
 
-    auto after = std::chrono::system_clock::now();
-    auto milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(after - before);
-    std::cout << "\rCube map compression took " << std::setprecision(3) << milliseconds.count() / 1000.f << " seconds." << std::endl;
-
-    cube_map_frame_buffers.clear();
-
-    HandleWrapper<bgfx::TextureHandle> cube_map_texture = bgfx::createTextureCube(static_cast<uint16_t>(output_size), true, 1, bgfx::TextureFormat::RGBA16F, BGFX_TEXTURE_RT | BGFX_SAMPLER_U_CLAMP | BGFX_SAMPLER_V_CLAMP);
-    if (!bgfx::isValid(cube_map_texture)) {
-        std::cout << "Texture compiler error. Failed to create cube map texture." << std::endl;
+    if (!command_line.profile.empty() && !start_profiler(std::cout)) {
+        // Error is printed in `start_profiler`.
         return 1;
     }
 
-    // Cube map to use in other shaders.
-    for (size_t side = 0; side < 6; side++) {
-        for (size_t size = output_size, mip_level = 0; size >= 1; size /= 2, mip_level++, current_view++) {
-            const std::string cube_map_view_name = "cube_map_view_" + std::to_string(side) + "_" + std::to_string(mip_level);
-
-            bgfx::setViewClear(current_view, BGFX_CLEAR_COLOR);
-            bgfx::setViewName(current_view, cube_map_view_name.c_str());
-
-            bgfx::Attachment attachment;
-            attachment.init(cube_map_texture, bgfx::Access::Write, static_cast<uint16_t>(side), static_cast<uint16_t>(mip_level));
+    if (command_line.is_remote_filtered && command_line.remote_cache.empty()) {
+        std::cout << "Texture compiler error. Command line argument --remote-filter is used only with --remote-cache." << std::endl;
+        return 1;
+    }
 
-            bgfx::FrameBufferHandle frame_buffer = bgfx::createFrameBuffer(1, &attachment, false);
-            if (!bgfx::isValid(frame_buffer)) {
-                std::cout << "Texture compiler error. Failed to create cube map frame buffer." << std::endl;
+    if (!command_line.cache.empty()) {
+        std::unique_ptr<RemoteCache> remote;
+        if (!command_line.remote_cache.empty()) {
+            remote = create_remote_cache(command_line.remote_cache, command_line.is_remote_filtered, std::cout);
+            if (!remote) {
+                // Error is printed in `create_remote_cache`.
                 return 1;
             }
-            cube_map_frame_buffers.emplace_back(frame_buffer);
-
-            bgfx::setViewFrameBuffer(current_view, frame_buffer);
-            bgfx::setViewRect(current_view, 0, 0, static_cast<uint16_t>(size), static_cast<uint16_t>(size));
-            bgfx::setViewTransform(current_view, glm::value_ptr(cube_map_view_matrices[side]), glm::value_ptr(CUBE_MAP_PROJECTION));
+        }
 
-            bgfx::setVertexBuffer(0, vertex_buffer, 0, static_cast<uint32_t>(std::size(CUBE_VERTICES) / 3));
-            bgfx::setTexture(0, texture_uniform, texture);
+        context.cache.emplace(command_line.cache, std::move(remote), command_line.cache_size * 1024 * 1024);
+        context.is_source_cached = command_line.is_source_cached;
 
-            bgfx::setState(BGFX_STATE_WRITE_RGB | BGFX_STATE_CULL_CCW);
-            bgfx::submit(current_view, cube_map_program_handle);
+        try {
+            // Warning is printed in `load`, malformed hashes only cost hashing every input again.
+            context.cache->input_hashes->load(std::cout);
+        } catch (const std::exception& exception) {
+            std::cout << "Texture compiler warning. Failed to read input hashes: " << exception.what() << "." << std::endl;
         }
+    } else if (!command_line.remote_cache.empty() || command_line.cache_size != 0 || command_line.is_source_cached) {
+        std::cout << "Texture compiler error. Command line arguments --remote-cache, --cache-size and --cache-sources are used only with --cache." << std::endl;
+        return 1;
     }
 
-    HandleWrapper<bgfx::TextureHandle> irradiance_textures[6];
-    for (size_t side = 0; side < 6; side++) {
-        const std::string irradiance_texture_name = "irradiance_texture_" + std::to_string(side);
+    if (command_line.metrics_port >= 0) {
+        if (command_line.metrics_port > UINT16_MAX || (command_line.manifest.empty() && !command_line.is_server && command_line.worker.empty()) || command_line.gpus != 0 || command_line.processes != 0) {
+            std::cout << "Texture compiler error. Command line argument --metrics-port must be a TCP port and is used only with --manifest, --server and --worker, without --gpus and --processes." << std::endl;
+            return 1;
+        }
 
-        irradiance_textures[side] = bgfx::createTexture2D(static_cast<uint16_t>(irradiance_size), static_cast<uint16_t>(irradiance_size), false, 1, bgfx::TextureFormat::RGBA16F, BGFX_TEXTURE_RT | BGFX_SAMPLER_U_CLAMP | BGFX_SAMPLER_V_CLAMP);
-        if (!bgfx::isValid(irradiance_textures[side])) {
-            std::cout << "Texture compiler error. Failed to create irradiance texture." << std::endl;
+        context.live_metrics.emplace();
+        if (!context.live_metrics->listen(static_cast<uint16_t>(command_line.metrics_port), std::cout)) {
+            // Error is printed in `listen`.
             return 1;
         }
-        bgfx::setName(irradiance_textures[side], irradiance_texture_name.c_str());
     }
 
-    vertex_shader_handle = bgfx::createEmbeddedShader(IRRADIANCE_SHADER, renderer_type, "cube_map_shader_vertex");
-    if (!bgfx::isValid(vertex_shader_handle)) {
-        std::cout << "Texture compiler error. Failed to create irradiance map vertex shader." << std::endl;
-        return 1;
-    }
-    bgfx::setName(vertex_shader_handle, "irradiance_shader_vertex");
+    if (command_line.is_bench_gpu) {
+        if (!command_line.manifest.empty() || command_line.is_server || !command_line.worker.empty() || !command_line.watch.empty() || !command_line.pack.empty() || !command_line.probe_array.empty() || command_line.coordinator != 0 ||
+            command_line.gpus != 0 || command_line.processes != 0 || command_line.memory_budget != 0 || !command_line.checkpoint.empty() || !command_line.progress.empty() || command_line.is_incremental || !command_line.cache.empty()) {
+            std::cout << "Texture compiler error. Command line argument --bench-gpu can't be combined with --manifest, --server, --worker and the options of manifests and of the cache." << std::endl;
+            return 1;
+        }
 
-    fragment_shader_handle = bgfx::createEmbeddedShader(IRRADIANCE_SHADER, renderer_type, "irradiance_shader_fragment");
-    if (!bgfx::isValid(fragment_shader_handle)) {
-        std::cout << "Texture compiler error. Failed to create irradiance map fragment shader." << std::endl;
-        bgfx::destroy(vertex_shader_handle);
-        return 1;
+        // Only the compression of the job arguments applies, the benchmark makes up the rest of its jobs.
+        GpuBenchSettings bench;
+        bench.compression = command_line.is_production ? Compression::GOOD_BUT_SLOW : command_line.is_no_compression ? Compression::NO_COMPRESSION : Compression::POOR_BUT_FAST;
+        command_line.is_production = command_line.is_development = command_line.is_no_compression = false;
+        if (has_job_arguments(command_line)) {
+            std::cout << "Texture compiler error. Command line argument --bench-gpu can't be combined with job arguments other than --production, --development and --no-compression." << std::endl;
+            return 1;
+        }
+
+        if (!parse_bench_list(command_line.bench_output_sizes, "256,512,1024", 16384, bench.output_sizes) || !parse_bench_list(command_line.bench_irradiance_sizes, "32,64", 16384, bench.irradiance_sizes) ||
+            !parse_bench_list(command_line.bench_prefilter_sizes, "128,256", 16384, bench.prefilter_sizes) ||
+            !parse_bench_list(command_line.bench_prefilter_samples, "256,1024", PREFILTER_MAX_SAMPLE_COUNT, bench.prefilter_samples)) {
+            std::cout << "Texture compiler error. Command line arguments --bench-output-sizes, --bench-irradiance-sizes and --bench-prefilter-sizes must be comma separated sizes from 1 to 16384 and --bench-prefilter-samples comma separated counts from 1 to "
+                      << PREFILTER_MAX_SAMPLE_COUNT << "." << std::endl;
+            return 1;
+        }
+        if (command_line.bench_runs != 0) {
+            bench.runs = command_line.bench_runs;
+        }
+
+        return finish_compilation(context, command_line, run_gpu_bench(context, bench, std::cout));
     }
-    bgfx::setName(fragment_shader_handle, "irradiance_shader_fragment");
 
-    HandleWrapper<bgfx::ProgramHandle> irradiance_program_handle = bgfx::createProgram(vertex_shader_handle, fragment_shader_handle, true);
-    if (!bgfx::isValid(irradiance_program_handle)) {
-        std::cout << "Texture compiler error. Failed to create irradiance map program." << std::endl;
-        bgfx::destroy(fragment_shader_handle);
-        bgfx::destroy(vertex_shader_handle);
+    if (!command_line.bench_output_sizes.empty() || !command_line.bench_irradiance_sizes.empty() || !command_line.bench_prefilter_sizes.empty() || !command_line.bench_prefilter_samples.empty() || command_line.bench_runs != 0) {
+        std::cout << "Texture compiler error. Command line arguments --bench-output-sizes, --bench-irradiance-sizes, --bench-prefilter-sizes, --bench-prefilter-samples and --bench-runs are used only with --bench-gpu." << std::endl;
         return 1;
     }
 
-    std::vector<HandleWrapper<bgfx::FrameBufferHandle>> irradiance_frame_buffers;
-
-    for (size_t side = 0; side < 6; side++, current_view++) {
-        const std::string irradiance_view_name = "irradiance_view_" + std::to_string(side);
-
-        bgfx::setViewClear(current_view, BGFX_CLEAR_COLOR);
-        bgfx::setViewName(current_view, irradiance_view_name.c_str());
-
-        bgfx::FrameBufferHandle frame_buffer = bgfx::createFrameBuffer(1, &irradiance_textures[side].handle, false);
-        if (!bgfx::isValid(frame_buffer)) {
-            std::cout << "Texture compiler error. Failed to create irradiance map frame buffer." << std::endl;
+    if (!command_line.worker.empty()) {
+        if (!command_line.manifest.empty() || command_line.memory_budget != 0 || !command_line.checkpoint.empty() || !command_line.progress.empty() || command_line.job_time_limit != 0 || command_line.job_memory_limit != 0 || !command_line.pack.empty() ||
+            !command_line.probe_array.empty() || command_line.coordinator != 0 || command_line.is_server || has_job_arguments(command_line)) {
+            std::cout << "Texture compiler error. Command line argument --worker can't be combined with --manifest, --memory-budget, --checkpoint, --progress, --job-time-limit, --job-memory-limit, --pack, --probe-array, --coordinator, --server and job arguments, the coordinator sends the jobs." << std::endl;
             return 1;
         }
-        irradiance_frame_buffers.emplace_back(frame_buffer);
 
-        bgfx::setViewFrameBuffer(current_view, frame_buffer);
-        bgfx::setViewRect(current_view, 0, 0, static_cast<uint16_t>(irradiance_size), static_cast<uint16_t>(irradiance_size));
-        bgfx::setViewTransform(current_view, glm::value_ptr(cube_map_view_matrices[side]), glm::value_ptr(CUBE_MAP_PROJECTION));
-
-        bgfx::setVertexBuffer(0, vertex_buffer, 0, static_cast<uint32_t>(std::size(CUBE_VERTICES) / 3));
-        bgfx::setTexture(0, texture_uniform, cube_map_texture);
-
-        bgfx::setState(BGFX_STATE_WRITE_RGB | BGFX_STATE_CULL_CCW);
-        bgfx::submit(current_view, irradiance_program_handle);
+        return finish_compilation(context, command_line, work_for_coordinator(context, command_line.worker));
     }
 
-    nvtt::OutputOptions irradiance_output_options;
-    irradiance_output_options.setFileName(output_irradiance.c_str());
-    irradiance_output_options.setContainer(nvtt::Container_DDS10);
-    irradiance_output_options.setErrorHandler(&error_handler);
-
-    // Don't apply compression to tiny irradiance texture. Use R16G16B16A16 instead.
-    nvtt::CompressionOptions irradiance_compression_options;
-    irradiance_compression_options.setFormat(nvtt::Format_RGB);
-    irradiance_compression_options.setPixelFormat(16, 16, 16, 16);
-    irradiance_compression_options.setPixelType(nvtt::PixelType_Float);
-
-    nvtt::Compressor irradiance_compressor;
-
-    before = std::chrono::system_clock::now();
-
-    std::cout << "Progress: 0%" << std::flush;
+    if (command_line.is_server) {
+        if (!command_line.manifest.empty() || command_line.memory_budget != 0 || !command_line.checkpoint.empty() || !command_line.progress.empty() || command_line.job_time_limit != 0 || command_line.job_memory_limit != 0 || !command_line.pack.empty() ||
+            !command_line.probe_array.empty() || has_job_arguments(command_line)) {
+            std::cout << "Texture compiler error. Command line argument --server can't be combined with --manifest, --memory-budget, --checkpoint, --progress, --job-time-limit, --job-memory-limit, --pack, --probe-array and job arguments, specify jobs in the requests instead." << std::endl;
+            return 1;
+        }
 
-    if (!irradiance_compressor.outputHeader(nvtt::TextureType_Cube, static_cast<int>(irradiance_size), static_cast<int>(irradiance_size), 1, 1, 1, false, irradiance_compression_options, irradiance_output_options)) {
-        // Error is printed via `error_handler`.
-        return 1;
+        return finish_compilation(context, command_line, run_server(context));
     }
 
-    data_to_save.resize(irradiance_size * irradiance_size * 4);
+    if (!command_line.manifest.empty()) {
+        if (has_job_arguments(command_line)) {
+            std::cout << "Texture compiler error. Command line argument --manifest can't be combined with job arguments, specify them in the manifest instead." << std::endl;
+            return 1;
+        }
 
-    for (int side = 0; side < 6; side++, current_view++) {
-        const std::string irradiance_read_back_view_name = "irradiance_read_back_view_" + std::to_string(side);
-        bgfx::setViewName(current_view, irradiance_read_back_view_name.c_str());
+        size_t memory_budget = command_line.memory_budget * 1024 * 1024;
+        if (memory_budget == 0) {
+            memory_budget = get_physical_memory_size();
+        }
 
-        // `BGFX_TEXTURE_RT` and `BGFX_TEXTURE_READ_BACK` are not compatible, so blit the render target texture to another texture and read back from it.
-        bgfx::TextureHandle blit_texture = bgfx::createTexture2D(static_cast<uint16_t>(irradiance_size), static_cast<uint16_t>(irradiance_size), false, 1, bgfx::TextureFormat::RGBA16F, BGFX_TEXTURE_BLIT_DST | BGFX_TEXTURE_READ_BACK | BGFX_SAMPLER_U_CLAMP | BGFX_SAMPLER_V_CLAMP);
-        if (!bgfx::isValid(blit_texture)) {
-            std::cout << "\rTexture compiler error. Failed to create an irradiance read back texture." << std::endl;
+        std::vector<CompileJob> jobs;
+        std::vector<std::string> lines;
+        if (load_manifest(command_line.manifest, jobs, &lines) != 0) {
+            // Error is printed in `load_manifest`.
             return 1;
         }
-        bgfx::blit(current_view, blit_texture, 0, 0, irradiance_textures[side], 0, 0, static_cast<uint16_t>(irradiance_size), static_cast<uint16_t>(irradiance_size));
 
-        const uint32_t frame_id = bgfx::readTexture(blit_texture, data_to_save.data());
-
-        // Wait until read back is available.
-        uint32_t current_frame_id;
-        do {
-            current_frame_id = bgfx::frame();
-        } while (current_frame_id < frame_id);
+        if (command_line.is_dry_run) {
+            if (command_line.gpus != 0 || command_line.processes != 0 || command_line.coordinator != 0 || !command_line.watch.empty() || !command_line.checkpoint.empty() || !command_line.progress.empty() || !command_line.pack.empty() ||
+                !command_line.probe_array.empty() || !command_line.metrics.empty() || !command_line.trace.empty() || !command_line.profile.empty() || command_line.is_schedule_report || command_line.job_time_limit != 0 || command_line.job_memory_limit != 0) {
+                std::cout << "Texture compiler error. Command line argument --dry-run can't be combined with --gpus, --processes, --coordinator, --watch, --checkpoint, --progress, --pack, --probe-array, --metrics, --trace, --profile, --schedule-report, --job-time-limit and --job-memory-limit." << std::endl;
+                return 1;
+            }
 
-        bgfx::destroy(blit_texture);
+            // Nothing is compiled, so neither the cost history nor the input hashes are written.
+            return dry_run_manifest(context, jobs, memory_budget);
+        }
 
-        nvtt::Surface surface;
-        if (!surface.setImage(nvtt::InputFormat_RGBA_16F, static_cast<int>(irradiance_size), static_cast<int>(irradiance_size), 1, data_to_save.data())) {
-            std::cout << "\rTexture compiler error. Failed to create an irradiance read back surface." << std::endl;
+        if ((!command_line.checkpoint.empty() || !command_line.progress.empty() || command_line.job_time_limit != 0 || command_line.job_memory_limit != 0) && (command_line.gpus != 0 || command_line.processes != 0 || command_line.coordinator != 0 || !command_line.watch.empty())) {
+            std::cout << "Texture compiler error. Command line arguments --checkpoint, --progress, --job-time-limit and --job-memory-limit can't be combined with --gpus, --processes, --coordinator and --watch." << std::endl;
             return 1;
         }
 
-        if (!irradiance_compressor.compress(surface, side, 0, irradiance_compression_options, irradiance_output_options)) {
-            // Error is printed via `error_handler`.
+        if ((command_line.input_locality != 0 || command_line.is_schedule_report) && (command_line.gpus != 0 || command_line.processes != 0 || command_line.coordinator != 0)) {
+            std::cout << "Texture compiler error. Command line arguments --input-locality and --schedule-report can't be combined with --gpus, --processes and --coordinator, whose workers pick the jobs they compile." << std::endl;
             return 1;
         }
 
-        std::cout << "\rProgress: " << static_cast<int>((side + 1) * 100.f / 6) << "%" << std::flush;
-    }
-
-    after = std::chrono::system_clock::now();
-    milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(after - before);
-    std::cout << "\rIrradiance map compression took " << std::setprecision(3) << milliseconds.count() / 1000.f << " seconds." << std::endl;
-
-    irradiance_frame_buffers.clear();
-
-    std::vector<HandleWrapper<bgfx::TextureHandle>> prefilter_textures[6];
-    for (size_t side = 0; side < 6; side++) {
-        for (uint16_t mip_size = static_cast<uint16_t>(prefilter_size), mip_level = 0; mip_size >= 1; mip_size /= 2, mip_level++) {
-            const std::string prefilter_texture_name = "prefilter_texture_" + std::to_string(side) + "_" + std::to_string(mip_level);
-
-            bgfx::TextureHandle mip_texture = bgfx::createTexture2D(mip_size, mip_size, false, 1, bgfx::TextureFormat::RGBA16F, BGFX_TEXTURE_RT | BGFX_SAMPLER_U_CLAMP | BGFX_SAMPLER_V_CLAMP);
-            if (!bgfx::isValid(mip_texture)) {
-                std::cout << "Texture compiler error. Failed to create prefilter side texture." << std::endl;
+        if (command_line.gpus != 0 || command_line.processes != 0) {
+            if ((command_line.gpus != 0 && command_line.processes != 0) || command_line.coordinator != 0 || !command_line.watch.empty() || command_line.gpu >= 0 ||
+                !command_line.metrics.empty() || !command_line.trace.empty() || !command_line.profile.empty() || !command_line.cost_history.empty()) {
+                std::cout << "Texture compiler error. Command line arguments --gpus and --processes can't be combined with each other, with --coordinator, --watch and --gpu, and with --metrics, --trace, --profile and --cost-history, which their worker processes would write." << std::endl;
                 return 1;
             }
-            bgfx::setName(mip_texture, prefilter_texture_name.c_str());
 
-            prefilter_textures[side].emplace_back(mip_texture);
+            int result = compile_manifest_in_processes(context, command_line, jobs, lines, argv[0]);
+            if (result == 0 && !command_line.pack.empty()) {
+                result = pack_manifest(jobs, command_line.pack);
+            }
+            if (result == 0 && !command_line.probe_array.empty()) {
+                result = write_manifest_probe_array(jobs, command_line.probe_array);
+            }
+            return finish_compilation(context, command_line, result);
         }
-    }
-
-    vertex_shader_handle = bgfx::createEmbeddedShader(PREFILTER_SHADER, renderer_type, "cube_map_shader_vertex");
-    if (!bgfx::isValid(vertex_shader_handle)) {
-        std::cout << "Texture compiler error. Failed to create prefilter vertex shader." << std::endl;
-        return 1;
-    }
-    bgfx::setName(vertex_shader_handle, "prefilter_map_shader_vertex");
-
-    fragment_shader_handle = bgfx::createEmbeddedShader(PREFILTER_SHADER, renderer_type, "prefilter_shader_fragment");
-    if (!bgfx::isValid(fragment_shader_handle)) {
-        std::cout << "Texture compiler error. Failed to create prefilter fragment shader." << std::endl;
-        bgfx::destroy(vertex_shader_handle);
-        return 1;
-    }
-    bgfx::setName(fragment_shader_handle, "prefilter_shader_fragment");
-
-    HandleWrapper<bgfx::ProgramHandle> prefilter_program_handle = bgfx::createProgram(vertex_shader_handle, fragment_shader_handle, true);
-    if (!bgfx::isValid(prefilter_program_handle)) {
-        std::cout << "Texture compiler error. Failed to create prefilter program." << std::endl;
-        bgfx::destroy(fragment_shader_handle);
-        bgfx::destroy(vertex_shader_handle);
-        return 1;
-    }
-
-    HandleWrapper<bgfx::UniformHandle> settings_uniform = bgfx::createUniform("u_settings", bgfx::UniformType::Vec4);
-    if (!bgfx::isValid(settings_uniform)) {
-        std::cout << "Texture compiler error. Failed to create a settings uniform." << std::endl;
-        return 1;
-    }
 
-    std::vector<HandleWrapper<bgfx::FrameBufferHandle>> prefilter_frame_buffers;
-
-    for (size_t side = 0; side < 6; side++) {
-        for (uint16_t mip_size = static_cast<uint16_t>(prefilter_size), mip_level = 0; mip_size >= 1; mip_size /= 2, mip_level++, current_view++) {
-            const std::string prefilter_view_name = "prefilter_view_" + std::to_string(side) + "_" + std::to_string(mip_level);
-
-            bgfx::setViewClear(current_view, BGFX_CLEAR_COLOR);
-            bgfx::setViewName(current_view, prefilter_view_name.c_str());
-
-            bgfx::FrameBufferHandle frame_buffer = bgfx::createFrameBuffer(1, &prefilter_textures[side][mip_level].handle, false);
-            if (!bgfx::isValid(frame_buffer)) {
-                std::cout << "Texture compiler error. Failed to create prefilter frame buffer." << std::endl;
+        if (command_line.coordinator != 0) {
+            if (command_line.coordinator > UINT16_MAX || !command_line.watch.empty()) {
+                std::cout << "Texture compiler error. Command line argument --coordinator must be a TCP port and can't be combined with --watch." << std::endl;
                 return 1;
             }
-            prefilter_frame_buffers.emplace_back(frame_buffer);
-
-            bgfx::setViewFrameBuffer(current_view, frame_buffer);
-            bgfx::setViewRect(current_view, 0, 0, mip_size, mip_size);
-            bgfx::setViewTransform(current_view, glm::value_ptr(cube_map_view_matrices[side]), glm::value_ptr(CUBE_MAP_PROJECTION));
 
-            bgfx::setVertexBuffer(0, vertex_buffer, 0, static_cast<uint32_t>(std::size(CUBE_VERTICES) / 3));
-            bgfx::setTexture(0, texture_uniform, cube_map_texture);
-
-            constexpr uint16_t MAX_MIP_LEVELS = 4;
-            const float settings[4] = { static_cast<float>(std::min(mip_level, MAX_MIP_LEVELS)) / MAX_MIP_LEVELS, static_cast<float>(output_size), 0.f, 0.f };
-            bgfx::setUniform(settings_uniform, settings);
-
-            bgfx::setState(BGFX_STATE_WRITE_RGB | BGFX_STATE_CULL_CCW);
-            bgfx::submit(current_view, prefilter_program_handle);
+            int result = coordinate_manifest(context, jobs, lines, static_cast<uint16_t>(command_line.coordinator), memory_budget, true);
+            if (result == 0 && !command_line.pack.empty()) {
+                result = pack_manifest(jobs, command_line.pack);
+            }
+            if (result == 0 && !command_line.probe_array.empty()) {
+                result = write_manifest_probe_array(jobs, command_line.probe_array);
+            }
+            return finish_compilation(context, command_line, result);
         }
-    }
-
-    nvtt::OutputOptions prefilter_output_options;
-    prefilter_output_options.setFileName(output_prefilter.c_str());
-    prefilter_output_options.setContainer(nvtt::Container_DDS10);
-    prefilter_output_options.setErrorHandler(&error_handler);
-
-    // Don't apply compression to prefilter texture. Use R16G16B16A16 instead.
-    nvtt::CompressionOptions prefilter_compression_options;
-    prefilter_compression_options.setFormat(nvtt::Format_RGBA);
-    prefilter_compression_options.setPixelFormat(16, 16, 16, 16);
-    prefilter_compression_options.setPixelType(nvtt::PixelType_Float);
-
-    nvtt::Compressor prefilter_compressor;
-
-    before = std::chrono::system_clock::now();
-
-    std::cout << "Progress: 0%" << std::flush;
-
-    total_mip_levels = count_mip_maps(prefilter_size);
-    if (!prefilter_compressor.outputHeader(nvtt::TextureType_Cube, static_cast<int>(prefilter_size), static_cast<int>(prefilter_size), 1, 1, total_mip_levels, false, prefilter_compression_options, prefilter_output_options)) {
-        // Error is printed via `error_handler`.
-        return 1;
-    }
-
-    data_to_save.resize(prefilter_size * prefilter_size * 4);
 
-    for (int side = 0; side < 6; side++) {
-        for (uint16_t mip_size = static_cast<uint16_t>(prefilter_size), mip_level = 0; mip_size >= 1; mip_size /= 2, mip_level++, current_view++) {
-            const std::string prefilter_read_back_view_name = "prefilter_read_back_view_" + std::to_string(side);
-            bgfx::setViewName(current_view, prefilter_read_back_view_name.c_str());
+        // Jobs compiled by this process are scheduled by `compile_manifest`, which reports the schedule.
+        if (command_line.is_schedule_report || !command_line.metrics.empty()) {
+            context.schedule.emplace();
+            context.schedule->is_printed = command_line.is_schedule_report;
+        }
 
-            // `BGFX_TEXTURE_RT` and `BGFX_TEXTURE_READ_BACK` are not compatible, so blit the render target texture to another texture and read back from it.
-            bgfx::TextureHandle blit_texture = bgfx::createTexture2D(mip_size, mip_size, false, 1, bgfx::TextureFormat::RGBA16F, BGFX_TEXTURE_BLIT_DST | BGFX_TEXTURE_READ_BACK | BGFX_SAMPLER_U_CLAMP | BGFX_SAMPLER_V_CLAMP);
-            if (!bgfx::isValid(blit_texture)) {
-                std::cout << "\rTexture compiler error. Failed to create a prefilter read back texture." << std::endl;
+        if (!command_line.watch.empty()) {
+            if (!command_line.metrics.empty() || !command_line.trace.empty() || !command_line.profile.empty() || !command_line.cost_history.empty() || !command_line.pack.empty() || !command_line.probe_array.empty()) {
+                std::cout << "Texture compiler error. Command line argument --watch can't be combined with --metrics, --trace, --profile, --cost-history, --pack and --probe-array, which are written on exit." << std::endl;
                 return 1;
             }
-            bgfx::blit(current_view, blit_texture, 0, 0, prefilter_textures[side][mip_level], 0, 0, mip_size, mip_size);
-
-            const uint32_t frame_id = bgfx::readTexture(blit_texture, data_to_save.data());
 
-            // Wait until read back is available.
-            uint32_t current_frame_id;
-            do {
-                current_frame_id = bgfx::frame();
-            } while (current_frame_id < frame_id);
-
-            bgfx::destroy(blit_texture);
+            compile_manifest(context, jobs, memory_budget);
+            return watch_manifest(context, jobs, command_line.watch);
+        }
 
-            nvtt::Surface surface;
-            if (!surface.setImage(nvtt::InputFormat_RGBA_16F, static_cast<int>(mip_size), static_cast<int>(mip_size), 1, data_to_save.data())) {
-                std::cout << "\rTexture compiler error. Failed to create a prefilter read back surface." << std::endl;
+        if (!command_line.checkpoint.empty()) {
+            context.checkpoint.emplace(command_line.checkpoint);
+            if (!context.checkpoint->open(std::cout)) {
+                // Error is printed in `open`.
                 return 1;
             }
+        }
 
-            if (!prefilter_compressor.compress(surface, side, mip_level, prefilter_compression_options, prefilter_output_options)) {
-                // Error is printed via `error_handler`.
+        std::optional<ProgressLog> progress_log;
+        if (!command_line.progress.empty()) {
+            progress_log.emplace(jobs.size());
+            if (!progress_log->open(command_line.progress, std::cout)) {
+                // Error is printed in `open`.
                 return 1;
             }
-
-            std::cout << "\rProgress: " << static_cast<int>((side * total_mip_levels + mip_level + 1) * 100.f / 6 / total_mip_levels) << "%" << std::flush;
         }
-    }
-
-    after = std::chrono::system_clock::now();
-    milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(after - before);
-    std::cout << "\rPrefilter map compression took " << std::setprecision(3) << milliseconds.count() / 1000.f << " seconds." << std::endl;
-
-    return 0;
-}
-
-int main(int argc, char* argv[]) {
-    bool is_albedo_roughness = false;                   // PNG
-    bool is_normal_metalness_ambient_occlusion = false; // PNG
-    bool is_parallax = false;                           // PNG
-    bool is_cube_map = false;                           // HDR
-
-    bool is_production = false;
-    bool is_development = false;
-    bool is_no_compression = false;
-
-    std::string input;
-    std::string output;
-    size_t output_size = 0;            // Cube map only
-    std::string output_irradiance;     // Cube map only
-    size_t output_irradiance_size = 0; // Cube map only
-    std::string output_prefilter;      // Cube map only
-    size_t output_prefilter_size = 0;  // Cube map only
-
-    bool is_help = false;
 
-    auto cli = clara::Opt(is_albedo_roughness)["--albedo-roughness"]("Input contains albedo map and roughness map") |
-            clara::Opt(is_normal_metalness_ambient_occlusion)["--normal-metalness-ambient-occlusion"]("Input contains normal, metalness and ambient occlusion maps") |
-            clara::Opt(is_parallax)["--parallax"]("Input contains parallax map") |
-            clara::Opt(is_cube_map)["--cube-map"]("Input contains cube map") |
-            clara::Opt(input, "example.png")["--input"]("Input texture path") |
-            clara::Opt(output, "example.texture")["--output"]("Output texture path") |
-            clara::Opt(output_size, "1024")["--output-size"]("Output texture size (needed only for cube map, for other textures output texture size is equal to input texture size)") |
-            clara::Opt(output_irradiance, "irradiance.texture")["--irradiance"]("Output irradiance texture path (needed only for cube map)") |
-            clara::Opt(output_irradiance_size, "32")["--irradiance-size"]("Output irradiance texture size (needed only for cube map)") |
-            clara::Opt(output_prefilter, "prefilter.texture")["--prefilter"]("Output prefilter texture path (needed only for cube map)") |
-            clara::Opt(output_prefilter_size, "128")["--prefilter-size"]("Output prefilter texture size (needed only for cube map)") |
-            clara::Opt(is_production)["--production"]("Good but slow texture compression") |
-            clara::Opt(is_development)["--development"]("Poor but quick texture compression") |
-            clara::Opt(is_no_compression)["--no-compression"]("No texture compression") |
-            clara::Help(is_help);
-
-    if (auto result = cli.parse(clara::Args(argc, argv)); !result) {
-        std::cout << "Texture compiler error. Failed to parse command line arguments: " << result.errorMessage() << std::endl;
-        return 1;
-    }
+        JobLimits limits;
+        limits.seconds = static_cast<double>(command_line.job_time_limit);
+        limits.memory = command_line.job_memory_limit * 1024 * 1024;
 
-    if (is_help) {
-        std::cout << cli << std::endl;
-        return 1;
-    }
+        int result = compile_manifest(context, jobs, memory_budget, progress_log ? &*progress_log : nullptr, limits);
+        if (progress_log) {
+            progress_log->close();
+        }
+        if (result == 0 && !command_line.pack.empty()) {
+            result = pack_manifest(jobs, command_line.pack);
+        }
+        if (result == 0 && !command_line.probe_array.empty()) {
+            result = write_manifest_probe_array(jobs, command_line.probe_array);
+        }
 
-    if (input.empty()) {
-        std::cout << "Texture compiler error. Input file is not specified." << std::endl;
-        return 1;
+        // A failed build keeps its checkpoint for the next attempt.
+        if (result == 0 && context.checkpoint) {
+            context.checkpoint->remove(std::cout);
+        }
+        return finish_compilation(context, command_line, result);
     }
 
-    if (output.empty()) {
-        std::cout << "Texture compiler error. Output file is not specified." << std::endl;
+    if (!command_line.watch.empty() || !command_line.pack.empty() || !command_line.probe_array.empty() || command_line.coordinator != 0 || command_line.gpus != 0 || command_line.processes != 0 || command_line.input_locality != 0 || command_line.is_schedule_report || command_line.is_dry_run) {
+        std::cout << "Texture compiler error. Command line arguments --watch, --pack, --probe-array, --coordinator, --gpus, --processes, --input-locality, --schedule-report and --dry-run are used only with --manifest." << std::endl;
         return 1;
     }
 
-    if (static_cast<int32_t>(is_albedo_roughness) + static_cast<int32_t>(is_normal_metalness_ambient_occlusion) + static_cast<int32_t>(is_parallax) + static_cast<int32_t>(is_cube_map) != 1) {
-        std::cout << "Texture compiler error. Invalid number of flags, one is required." << std::endl;
+    if (command_line.memory_budget != 0 || !command_line.checkpoint.empty() || !command_line.progress.empty() || command_line.job_time_limit != 0 || command_line.job_memory_limit != 0) {
+        std::cout << "Texture compiler error. Command line arguments --memory-budget, --checkpoint, --progress, --job-time-limit and --job-memory-limit are used only with --manifest." << std::endl;
         return 1;
     }
 
-    if (static_cast<int32_t>(is_production) + static_cast<int32_t>(is_development) + static_cast<int32_t>(is_no_compression) != 1) {
-        std::cout << "Texture compiler error. Either --development, --production or --no-compression command line argument must be set." << std::endl;
+    CompileJob job;
+    if (create_compile_job(command_line, job) != 0) {
+        // Error is printed in `create_compile_job`.
         return 1;
     }
 
-    Compression compression;
-    if (is_production) {
-        compression = Compression::GOOD_BUT_SLOW;
-    } else if (is_development) {
-        compression = Compression::POOR_BUT_FAST;
-    } else {
-        compression = Compression::NO_COMPRESSION;
-    }
-
-    if (is_cube_map) {
-        if (output_size == 0 || output_irradiance.empty() || output_irradiance_size == 0 || output_prefilter.empty() || output_prefilter_size == 0) {
-            std::cout << "Texture compiler error. Cube map requires --output-size, --irradiance, --irradiance-size, --prefilter, --prefilter-size command line arguments to be set." << std::endl;
-            return 1;
-        }
-
-        if (output_size > 65535 || output_irradiance_size > 65535 || output_prefilter_size > 65535) {
-            std::cout << "Texture compiler error. Invalid output size." << std::endl;
+    if (is_streamed(job)) {
+        // Statistics are a file next to the output.
+        if (job.is_stats) {
+            std::cout << "Texture compiler error. Command line argument --stats can't be used with the standard input and output." << std::endl;
             return 1;
         }
-    } else {
-        if (output_size != 0 || !output_irradiance.empty() || output_irradiance_size != 0 || !output_prefilter.empty() || output_prefilter_size != 0) {
-            std::cout << "Texture compiler error. Command line arguments --output-size, --irradiance, --irradiance-size, --prefilter, --prefilter-size are required only for cube map textures." << std::endl;
+        if (job.is_derived && job.input == STANDARD_STREAM) {
+            std::cout << "Texture compiler error. Command line argument --derive can't be used with the standard input." << std::endl;
             return 1;
         }
+        return finish_compilation(context, command_line, compile_streamed(context, job));
     }
 
-    if (is_albedo_roughness) {
-        return compile_albedo_roughness(input, output, compression);
-    }
-
-    if (is_normal_metalness_ambient_occlusion) {
-        return compile_normal_metalness_ambient_occlusion(input, output, compression);
-    }
-
-    if (is_parallax) {
-        return compile_parallax(input, output, compression);
-    }
-
-    if (is_cube_map) {
-        return compile_cube_map(input, output, output_size, output_irradiance, output_irradiance_size, output_prefilter, output_prefilter_size, compression);
-    }
-
-    // Should never happen.
-    return 1;
+    return finish_compilation(context, command_line, compile(context, job, std::cout, true));
 }
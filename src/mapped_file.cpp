@@ -0,0 +1,180 @@
+#include "mapped_file.h"
+
+#include <climits>
+
+#if BX_PLATFORM_WINDOWS
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#if BX_PLATFORM_LINUX
+#include <linux/fiemap.h>
+#include <linux/fs.h>
+#include <sys/ioctl.h>
+#endif
+#endif
+
+#if BX_PLATFORM_WINDOWS
+
+MappedFile::MappedFile(const std::string& path, bool is_read_ahead) noexcept {
+    if (is_archive_member_path(path)) {
+        if (open_archive_member(path, member)) {
+            data = member.data;
+            size = member.size;
+        }
+        return;
+    }
+
+    HANDLE handle = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                                is_read_ahead ? FILE_FLAG_SEQUENTIAL_SCAN : FILE_FLAG_RANDOM_ACCESS, nullptr);
+    if (handle == INVALID_HANDLE_VALUE) {
+        return;
+    }
+    file = handle;
+
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(handle, &file_size) || file_size.QuadPart <= 0) {
+        return;
+    }
+
+    mapping = CreateFileMappingA(handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping == nullptr) {
+        return;
+    }
+
+    data = static_cast<const uint8_t*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+    if (data != nullptr) {
+        size = static_cast<size_t>(file_size.QuadPart);
+    }
+}
+
+MappedFile::~MappedFile() {
+    if (data != nullptr && member.data == nullptr) {
+        UnmapViewOfFile(data);
+    }
+    if (mapping != nullptr) {
+        CloseHandle(mapping);
+    }
+    if (file != nullptr) {
+        CloseHandle(file);
+    }
+}
+
+void prefetch_file(const std::string& /*path*/) noexcept {
+    // Windows has no read ahead hint for a file that is not mapped yet, `FILE_FLAG_SEQUENTIAL_SCAN` of the mapping
+    // does the read ahead once the job starts.
+}
+
+FileLocation get_file_location(const std::string& path) noexcept {
+    FileLocation location;
+    HANDLE handle = CreateFileA(path.c_str(), FILE_READ_ATTRIBUTES, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, 0, nullptr);
+    if (handle == INVALID_HANDLE_VALUE) {
+        return location;
+    }
+
+    // NTFS allocates file indices in the order files are created, like inodes.
+    BY_HANDLE_FILE_INFORMATION information;
+    if (GetFileInformationByHandle(handle, &information)) {
+        location.position = (static_cast<uint64_t>(information.nFileIndexHigh) << 32) | information.nFileIndexLow;
+    }
+    CloseHandle(handle);
+    return location;
+}
+
+#else
+
+MappedFile::MappedFile(const std::string& path, bool is_read_ahead) noexcept {
+    if (is_archive_member_path(path)) {
+        if (open_archive_member(path, member)) {
+            data = member.data;
+            size = member.size;
+        }
+        return;
+    }
+
+    const int descriptor = open(path.c_str(), O_RDONLY);
+    if (descriptor < 0) {
+        return;
+    }
+
+    struct stat status {};
+    if (fstat(descriptor, &status) == 0 && status.st_size > 0) {
+        void* const address = mmap(nullptr, static_cast<size_t>(status.st_size), PROT_READ, MAP_PRIVATE, descriptor, 0);
+        if (address != MAP_FAILED) {
+            // Decoders read the file from the beginning to the end, let the kernel read ahead aggressively.
+            if (is_read_ahead) {
+                madvise(address, static_cast<size_t>(status.st_size), MADV_SEQUENTIAL);
+                madvise(address, static_cast<size_t>(status.st_size), MADV_WILLNEED);
+            }
+
+            data = static_cast<const uint8_t*>(address);
+            size = static_cast<size_t>(status.st_size);
+        }
+    }
+
+    // Mapping stays valid after the descriptor is closed.
+    close(descriptor);
+}
+
+MappedFile::~MappedFile() {
+    if (data != nullptr && member.data == nullptr) {
+        munmap(const_cast<uint8_t*>(data), size);
+    }
+}
+
+void prefetch_file(const std::string& path) noexcept {
+    if (is_archive_member_path(path)) {
+        return;
+    }
+
+    const int descriptor = open(path.c_str(), O_RDONLY);
+    if (descriptor < 0) {
+        return;
+    }
+
+#if BX_PLATFORM_LINUX
+    posix_fadvise(descriptor, 0, 0, POSIX_FADV_WILLNEED);
+#else
+    // macOS has no `posix_fadvise`, `F_RDADVISE` is its read ahead hint.
+    radvisory advisory {};
+    advisory.ra_offset = 0;
+    advisory.ra_count = INT_MAX;
+    fcntl(descriptor, F_RDADVISE, &advisory);
+#endif
+
+    close(descriptor);
+}
+
+FileLocation get_file_location(const std::string& path) noexcept {
+    FileLocation location;
+    const int descriptor = open(path.c_str(), O_RDONLY);
+    if (descriptor < 0) {
+        return location;
+    }
+
+    struct stat status;
+    if (fstat(descriptor, &status) == 0) {
+        location.position = static_cast<uint64_t>(status.st_ino);
+    }
+
+#if BX_PLATFORM_LINUX
+    // Only the first extent, files of a texture are rarely fragmented enough for the rest to matter. Network file
+    // systems don't support the call and keep the inode, which their servers allocate in directory order as well.
+    alignas(fiemap) uint8_t request[sizeof(fiemap) + sizeof(fiemap_extent)] = {};
+    fiemap* const map = reinterpret_cast<fiemap*>(request);
+    map->fm_length = FIEMAP_MAX_OFFSET;
+    map->fm_extent_count = 1;
+    if (ioctl(descriptor, FS_IOC_FIEMAP, map) == 0 && map->fm_mapped_extents == 1 &&
+        (map->fm_extents[0].fe_flags & (FIEMAP_EXTENT_UNKNOWN | FIEMAP_EXTENT_DATA_INLINE)) == 0) {
+        location.is_physical = true;
+        location.position = map->fm_extents[0].fe_physical;
+    }
+#endif
+
+    close(descriptor);
+    return location;
+}
+
+#endif
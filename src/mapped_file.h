@@ -0,0 +1,52 @@
+#pragma once
+
+#include "archive.h"
+
+#include <bx/platform.h>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// Read only memory mapping of a whole file. Decoders read the mapping directly, so the file is never copied through
+// stdio buffers, and pages are read ahead by the kernel while the decoder works on the previous ones. A member of an
+// archive is opened with `open_archive_member` instead and points into the mapping of the archive or into its inflated
+// content.
+struct MappedFile final {
+    // `data` is null when the file can't be opened or mapped, empty files are never mapped. Without `is_read_ahead` the
+    // kernel only reads the pages that are touched, for archives read a member at a time.
+    explicit MappedFile(const std::string& path, bool is_read_ahead = true) noexcept;
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile(MappedFile&&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile& operator=(MappedFile&&) = delete;
+
+    ~MappedFile();
+
+    const uint8_t* data = nullptr;
+    size_t size = 0;
+
+    // Owns `data` of an archive member.
+    ArchiveMember member;
+
+#if BX_PLATFORM_WINDOWS
+    void* file = nullptr;
+    void* mapping = nullptr;
+#endif
+};
+
+// Hints the operating system to start reading the file into the page cache in the background, so a job that decodes
+// it later doesn't stall on the disk or the network share. Does nothing when the file can't be opened, and for archive
+// members, which are read ahead when they're opened.
+void prefetch_file(const std::string& path) noexcept;
+
+// Where a file is on its storage, to read the inputs of a manifest in the order they're laid out: the byte offset of
+// its first extent on the device when the file system tells it, Linux only, its inode or file index otherwise, which
+// file systems allocate close together for the files of a directory. Zero when the file can't be opened.
+struct FileLocation final {
+    bool is_physical = false;
+    uint64_t position = 0;
+};
+
+// `path` is a file, archive members are located by their archive, see `get_input_file_path`.
+FileLocation get_file_location(const std::string& path) noexcept;
@@ -0,0 +1,720 @@
+#include "metrics.h"
+
+#include <bx/platform.h>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <utility>
+
+#if BX_PLATFORM_WINDOWS
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <pthread.h>
+#include <sys/resource.h>
+#include <time.h>
+#include <unistd.h>
+#if BX_PLATFORM_OSX
+#include <mach/mach.h>
+#endif
+#if BX_PLATFORM_LINUX
+#include <dirent.h>
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#endif
+#endif
+
+// Members of `HardwareCounters` in the order of `HARDWARE_EVENTS`.
+static constexpr double HardwareCounters::* HARDWARE_COUNTER_MEMBERS[] = {
+    &HardwareCounters::cycles,
+    &HardwareCounters::instructions,
+    &HardwareCounters::cache_misses,
+    &HardwareCounters::dtlb_misses,
+    &HardwareCounters::branch_misses
+};
+static constexpr size_t HARDWARE_EVENT_COUNT = std::size(HARDWARE_COUNTER_MEMBERS);
+
+static std::atomic<bool> is_hardware_counting { false };
+
+#if BX_PLATFORM_LINUX
+// Type and config of the perf events.
+static const std::pair<uint32_t, uint64_t> HARDWARE_EVENTS[HARDWARE_EVENT_COUNT] = {
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES },
+    { PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16) },
+    { PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES }
+};
+
+// Perf event descriptors of a thread, negative for the events it can't count. Every event is a counter of its own
+// rather than a group, so a CPU that lacks one still counts the rest.
+struct ThreadCounters final {
+    pid_t thread;
+    std::array<int, HARDWARE_EVENT_COUNT> descriptors;
+};
+
+struct HardwareCounterRegistry final {
+    std::mutex mutex;
+    std::vector<ThreadCounters> threads;
+
+    // Events of threads that exited, and which events any thread counts.
+    std::array<double, HARDWARE_EVENT_COUNT> exited_counts {};
+    std::array<bool, HARDWARE_EVENT_COUNT> is_counted {};
+};
+
+static HardwareCounterRegistry& get_hardware_counter_registry() {
+    static HardwareCounterRegistry registry;
+    return registry;
+}
+
+// Counts of user mode only, which `perf_event_paranoid` 2 allows for threads of the own process.
+static ThreadCounters open_thread_counters(pid_t thread) noexcept {
+    ThreadCounters counters { thread, {} };
+    for (size_t i = 0; i < HARDWARE_EVENT_COUNT; i++) {
+        perf_event_attr attributes {};
+        attributes.size = sizeof(attributes);
+        attributes.type = HARDWARE_EVENTS[i].first;
+        attributes.config = HARDWARE_EVENTS[i].second;
+        attributes.exclude_kernel = 1;
+        attributes.exclude_hv = 1;
+        attributes.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+        counters.descriptors[i] = static_cast<int>(syscall(SYS_perf_event_open, &attributes, thread, -1, -1, PERF_FLAG_FD_CLOEXEC));
+    }
+    return counters;
+}
+
+// Adds the count of the event scaled by the share of time it was scheduled.
+static void read_hardware_event(int descriptor, double& count) noexcept {
+    uint64_t values[3];
+    if (read(descriptor, values, sizeof(values)) == sizeof(values) && values[2] != 0) {
+        count += static_cast<double>(values[0]) * static_cast<double>(values[1]) / static_cast<double>(values[2]);
+    }
+}
+
+// Keeps the counts of a registered thread once it exits and closes its descriptors, so threads started for every job,
+// like the ones of `--server`, don't pile up descriptors.
+struct ThreadCounterRegistration final {
+    ~ThreadCounterRegistration() {
+        if (thread == 0) {
+            return;
+        }
+
+        HardwareCounterRegistry& registry = get_hardware_counter_registry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        const auto it = std::find_if(registry.threads.begin(), registry.threads.end(), [this](const ThreadCounters& counters) {
+            return counters.thread == thread;
+        });
+        if (it == registry.threads.end()) {
+            return;
+        }
+        for (size_t i = 0; i < HARDWARE_EVENT_COUNT; i++) {
+            if (it->descriptors[i] >= 0) {
+                read_hardware_event(it->descriptors[i], registry.exited_counts[i]);
+                close(it->descriptors[i]);
+            }
+        }
+        registry.threads.erase(it);
+    }
+
+    pid_t thread = 0;
+};
+
+// Threads started after `enable_hardware_counters` are counted from their first phase on.
+static void register_calling_thread() noexcept {
+    thread_local ThreadCounterRegistration registration;
+    if (registration.thread != 0) {
+        return;
+    }
+    registration.thread = static_cast<pid_t>(syscall(SYS_gettid));
+
+    HardwareCounterRegistry& registry = get_hardware_counter_registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    const bool is_registered = std::any_of(registry.threads.begin(), registry.threads.end(), [](const ThreadCounters& counters) {
+        return counters.thread == registration.thread;
+    });
+    if (!is_registered) {
+        try {
+            registry.threads.push_back(open_thread_counters(registration.thread));
+        } catch (...) {
+            // The thread is left out of the counts.
+        }
+    }
+}
+#endif
+
+static double get_seconds_since(std::chrono::steady_clock::time_point begin) noexcept {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+}
+
+void write_json_string(std::ostream& stream, const std::string& value) {
+    stream << '"';
+    for (const char character : value) {
+        switch (character) {
+            case '"':
+                stream << "\\\"";
+                break;
+            case '\\':
+                stream << "\\\\";
+                break;
+            case '\n':
+                stream << "\\n";
+                break;
+            case '\r':
+                stream << "\\r";
+                break;
+            case '\t':
+                stream << "\\t";
+                break;
+            default:
+                if (static_cast<unsigned char>(character) < 0x20) {
+                    char escaped[8];
+                    std::snprintf(escaped, sizeof(escaped), "\\u%04x", character);
+                    stream << escaped;
+                } else {
+                    stream << character;
+                }
+                break;
+        }
+    }
+    stream << '"';
+}
+
+void JobMetrics::add_phase(PhaseMetrics phase) {
+    std::lock_guard<std::mutex> lock(mutex);
+    phases.push_back(std::move(phase));
+}
+
+PhaseTimer::PhaseTimer(JobMetrics* metrics, const char* name, int mip_level, int face) noexcept
+        : metrics(metrics)
+        , name(name)
+        , mip_level(mip_level)
+        , face(face)
+        , allocation_tag(metrics != nullptr ? metrics->allocation_tracker.get() : nullptr, name)
+        , profile_stage(name) {
+    if (metrics != nullptr) {
+        wall_begin = std::chrono::steady_clock::now();
+        cpu_begin = get_process_cpu_time();
+        begin_seconds = get_trace_seconds();
+        if (is_hardware_counting.load(std::memory_order_relaxed)) {
+#if BX_PLATFORM_LINUX
+            register_calling_thread();
+#endif
+            counters_begin = read_hardware_counters();
+        }
+    }
+}
+
+PhaseTimer::~PhaseTimer() {
+    stop();
+}
+
+void PhaseTimer::stop() noexcept {
+    allocation_tag.stop();
+    profile_stage.stop();
+    if (metrics != nullptr) {
+        HardwareCounters counters;
+        if (is_hardware_counting.load(std::memory_order_relaxed)) {
+            const HardwareCounters counters_end = read_hardware_counters();
+            for (const auto member : HARDWARE_COUNTER_MEMBERS) {
+                if (counters_begin.*member >= 0.0 && counters_end.*member >= 0.0) {
+                    counters.*member = std::max(counters_end.*member - counters_begin.*member, 0.0);
+                }
+            }
+        }
+
+        try {
+            metrics->add_phase(PhaseMetrics { name, mip_level, face, get_seconds_since(wall_begin), get_process_cpu_time() - cpu_begin, begin_seconds, get_thread_index(), counters });
+        } catch (...) {
+            // Losing a phase is better than losing the job.
+        }
+        metrics = nullptr;
+    }
+}
+
+// Writes the counted events of a phase as JSON members, each after a comma, and the instructions per cycle that tell
+// compute bound phases from the ones waiting for memory.
+static void write_hardware_counters(std::ostream& stream, const HardwareCounters& counters) {
+    static constexpr const char* NAMES[HARDWARE_EVENT_COUNT] = { "cycles", "instructions", "cache_misses", "dtlb_misses", "branch_misses" };
+    for (size_t i = 0; i < HARDWARE_EVENT_COUNT; i++) {
+        if (counters.*HARDWARE_COUNTER_MEMBERS[i] >= 0.0) {
+            stream << ", \"" << NAMES[i] << "\": " << static_cast<uint64_t>(std::llround(counters.*HARDWARE_COUNTER_MEMBERS[i]));
+        }
+    }
+    if (counters.cycles > 0.0 && counters.instructions >= 0.0) {
+        const std::ios_base::fmtflags flags = stream.flags();
+        const std::streamsize precision = stream.precision();
+        stream << ", \"instructions_per_cycle\": " << std::fixed << std::setprecision(3) << counters.instructions / counters.cycles;
+        stream.flags(flags);
+        stream.precision(precision);
+    }
+}
+
+MetricsReport::MetricsReport() noexcept
+        : wall_begin(std::chrono::steady_clock::now())
+        , cpu_begin(get_process_cpu_time())
+        , page_faults_begin(get_page_fault_count()) {
+    // The report is created before any phase is measured, so the main thread is thread zero of the trace.
+    get_trace_seconds();
+    get_thread_index();
+}
+
+void MetricsReport::add_job(std::unique_ptr<JobMetrics> job) {
+    std::lock_guard<std::mutex> lock(mutex);
+    jobs.push_back(std::move(job));
+}
+
+bool MetricsReport::write(const std::string& path, std::ostream& log) const {
+    std::ofstream stream(path);
+    if (!stream) {
+        log << "Texture compiler error. Failed to open metrics file." << std::endl;
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    stream << std::setprecision(6) << std::fixed;
+    stream << "{\n";
+    stream << "  \"wall_seconds\": " << get_seconds_since(wall_begin) << ",\n";
+    stream << "  \"cpu_seconds\": " << get_process_cpu_time() - cpu_begin << ",\n";
+    stream << "  \"peak_memory_usage\": " << get_peak_memory_usage() << ",\n";
+    stream << "  \"page_faults\": " << get_page_fault_count() - page_faults_begin << ",\n";
+    if (schedule) {
+        stream << "  \"schedule\": ";
+        schedule->write_json(stream, "  ");
+        stream << ",\n";
+    }
+    stream << "  \"jobs\": [";
+
+    for (size_t i = 0; i < jobs.size(); i++) {
+        const JobMetrics& job = *jobs[i];
+
+        stream << (i == 0 ? "\n" : ",\n") << "    {\n";
+        stream << "      \"kind\": ";
+        write_json_string(stream, job.kind);
+        stream << ",\n      \"compression\": ";
+        write_json_string(stream, job.compression);
+        stream << ",\n      \"input\": ";
+        write_json_string(stream, job.input);
+        stream << ",\n      \"outputs\": [";
+        for (size_t j = 0; j < job.outputs.size(); j++) {
+            stream << (j == 0 ? "" : ", ");
+            write_json_string(stream, job.outputs[j]);
+        }
+        stream << "],\n      \"result\": ";
+        write_json_string(stream, job.result);
+        stream << ",\n";
+        stream << "      \"wall_seconds\": " << job.wall_seconds << ",\n";
+        stream << "      \"cpu_seconds\": " << job.cpu_seconds << ",\n";
+        stream << "      \"bytes_written\": " << job.bytes_written << ",\n";
+        stream << "      \"peak_memory_usage\": " << job.peak_memory_usage << ",\n";
+        stream << "      \"page_faults\": " << job.page_faults << ",\n";
+        if (job.rdo_psnr >= 0.0) {
+            stream << "      \"rdo_psnr\": " << job.rdo_psnr << ",\n";
+        }
+        if (job.estimated_seconds >= 0.0) {
+            stream << "      \"estimated_seconds\": " << job.estimated_seconds << ",\n";
+        }
+        if (!job.limit_action.empty()) {
+            stream << "      \"limit_action\": ";
+            write_json_string(stream, job.limit_action);
+            stream << ",\n";
+        }
+        if (!job.exceeded_limits.empty()) {
+            stream << "      \"exceeded_limits\": [";
+            for (size_t j = 0; j < job.exceeded_limits.size(); j++) {
+                stream << (j == 0 ? "" : ", ");
+                write_json_string(stream, job.exceeded_limits[j]);
+            }
+            stream << "],\n";
+        }
+        if (!job.auto_format.empty()) {
+            stream << "      \"content\": [";
+            for (size_t j = 0; j < job.content.size(); j++) {
+                stream << (j == 0 ? "" : ", ");
+                write_json_string(stream, job.content[j]);
+            }
+            stream << "],\n      \"auto_format\": ";
+            write_json_string(stream, job.auto_format);
+            stream << ",\n";
+        }
+        stream << "      \"phases\": [";
+
+        for (size_t j = 0; j < job.phases.size(); j++) {
+            const PhaseMetrics& phase = job.phases[j];
+
+            stream << (j == 0 ? "\n" : ",\n") << "        { \"name\": ";
+            write_json_string(stream, phase.name);
+            if (phase.mip_level >= 0) {
+                stream << ", \"mip_level\": " << phase.mip_level;
+            }
+            if (phase.face >= 0) {
+                stream << ", \"face\": " << phase.face;
+            }
+            stream << ", \"wall_seconds\": " << phase.wall_seconds << ", \"cpu_seconds\": " << phase.cpu_seconds;
+            write_hardware_counters(stream, phase.counters);
+            stream << " }";
+        }
+
+        stream << (job.phases.empty() ? "]" : "\n      ]");
+        if (!job.gpu_views.empty()) {
+            stream << ",\n      \"gpu_views\": [";
+            for (size_t j = 0; j < job.gpu_views.size(); j++) {
+                stream << (j == 0 ? "\n" : ",\n") << "        { \"name\": ";
+                write_json_string(stream, job.gpu_views[j].name);
+                stream << ", \"gpu_seconds\": " << job.gpu_views[j].gpu_seconds << " }";
+            }
+            stream << "\n      ]";
+        }
+        if (job.peak_gpu_memory_usage != 0) {
+            stream << ",\n      \"peak_gpu_memory_usage\": " << job.peak_gpu_memory_usage;
+        }
+        if (!job.blocks.empty()) {
+            stream << ",\n      \"blocks\": [";
+            for (size_t j = 0; j < job.blocks.size(); j++) {
+                const BlockMetrics& blocks = job.blocks[j];
+                stream << (j == 0 ? "\n" : ",\n") << "        { \"output\": ";
+                write_json_string(stream, blocks.output);
+                stream << ", \"mip_level\": " << blocks.mip_level << ", \"format\": ";
+                write_json_string(stream, blocks.format);
+                stream << ", \"modes\": [";
+                for (size_t mode = 0; mode < blocks.modes.size(); mode++) {
+                    stream << (mode == 0 ? "" : ", ") << blocks.modes[mode];
+                }
+                stream << "], \"reserved_blocks\": " << blocks.reserved_blocks << ", \"partitions\": [";
+                for (size_t mode = 0; mode < blocks.partitions.size(); mode++) {
+                    stream << (mode == 0 ? "[" : ", [");
+                    for (size_t partition = 0; partition < blocks.partitions[mode].size(); partition++) {
+                        stream << (partition == 0 ? "" : ", ") << blocks.partitions[mode][partition];
+                    }
+                    stream << "]";
+                }
+                stream << "]";
+                if (!blocks.mode_squared_errors.empty()) {
+                    stream << ", \"mode_squared_errors\": [";
+                    for (size_t mode = 0; mode < blocks.mode_squared_errors.size(); mode++) {
+                        stream << (mode == 0 ? "" : ", ") << blocks.mode_squared_errors[mode];
+                    }
+                    stream << "], \"error_histogram\": [";
+                    for (size_t bucket = 0; bucket < blocks.error_histogram.size(); bucket++) {
+                        stream << (bucket == 0 ? "" : ", ") << blocks.error_histogram[bucket];
+                    }
+                    stream << "]";
+                }
+                stream << " }";
+            }
+            stream << "\n      ]";
+        }
+        if (!job.allocations.empty()) {
+            stream << ",\n      \"peak_heap_usage\": " << job.peak_heap_usage;
+            stream << ",\n      \"allocations\": [";
+            for (size_t j = 0; j < job.allocations.size(); j++) {
+                const AllocationMetrics& allocation = job.allocations[j];
+                stream << (j == 0 ? "\n" : ",\n") << "        { \"stage\": ";
+                write_json_string(stream, allocation.stage);
+                stream << ", \"allocations\": " << allocation.allocations << ", \"allocated_bytes\": " << allocation.allocated_bytes << ", \"peak_live_bytes\": " << allocation.peak_live_bytes
+                       << ", \"live_bytes\": " << allocation.live_bytes << " }";
+            }
+            stream << "\n      ]";
+        }
+        if (!job.quality.empty()) {
+            stream << ",\n      \"quality\": [";
+            for (size_t j = 0; j < job.quality.size(); j++) {
+                const QualityMetrics& quality = job.quality[j];
+                stream << (j == 0 ? "\n" : ",\n") << "        { \"output\": ";
+                write_json_string(stream, quality.output);
+                stream << ", \"mip_level\": " << quality.mip_level << ", \"psnr\": " << quality.psnr << ", \"ssim\": " << quality.ssim;
+                if (quality.mean_angular_error >= 0.0) {
+                    stream << ", \"mean_angular_error\": " << quality.mean_angular_error << ", \"max_angular_error\": " << quality.max_angular_error;
+                }
+                stream << " }";
+            }
+            stream << "\n      ]";
+        }
+        stream << "\n    }";
+    }
+
+    stream << (jobs.empty() ? "]\n" : "\n  ]\n") << "}\n";
+
+    if (!stream) {
+        log << "Texture compiler error. Failed to write metrics file." << std::endl;
+        return false;
+    }
+
+    return true;
+}
+
+bool MetricsReport::write_trace(const std::string& path, std::ostream& log) const {
+    std::ofstream stream(path);
+    if (!stream) {
+        log << "Texture compiler error. Failed to open trace file." << std::endl;
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    // Microseconds, which is the time unit of trace events.
+    const auto write_time = [&stream](const char* key, double seconds) {
+        stream << ", \"" << key << "\": " << std::fixed << std::setprecision(3) << seconds * 1e6 << std::defaultfloat << std::setprecision(6);
+    };
+
+    stream << "{\n  \"displayTimeUnit\": \"ms\",\n  \"traceEvents\": [";
+
+    uint32_t thread_count = 1;
+    bool is_first = true;
+    for (const std::unique_ptr<JobMetrics>& job_ptr : jobs) {
+        const JobMetrics& job = *job_ptr;
+
+        stream << (is_first ? "\n" : ",\n") << "    { \"name\": ";
+        write_json_string(stream, job.input);
+        stream << ", \"cat\": \"job\", \"ph\": \"X\", \"pid\": 1, \"tid\": " << job.thread;
+        write_time("ts", job.begin_seconds);
+        write_time("dur", job.wall_seconds);
+        stream << ", \"args\": { \"kind\": ";
+        write_json_string(stream, job.kind);
+        stream << ", \"result\": ";
+        write_json_string(stream, job.result);
+        stream << " } }";
+        is_first = false;
+        thread_count = std::max(thread_count, job.thread + 1);
+
+        for (const PhaseMetrics& phase : job.phases) {
+            stream << ",\n    { \"name\": ";
+            write_json_string(stream, phase.name);
+            stream << ", \"cat\": \"phase\", \"ph\": \"X\", \"pid\": 1, \"tid\": " << phase.thread;
+            write_time("ts", phase.begin_seconds);
+            write_time("dur", phase.wall_seconds);
+            stream << ", \"args\": { \"job\": ";
+            write_json_string(stream, job.input);
+            if (phase.mip_level >= 0) {
+                stream << ", \"mip_level\": " << phase.mip_level;
+            }
+            if (phase.face >= 0) {
+                stream << ", \"face\": " << phase.face;
+            }
+            write_hardware_counters(stream, phase.counters);
+            stream << " } }";
+            thread_count = std::max(thread_count, phase.thread + 1);
+        }
+    }
+
+    // Thread zero is the one that started measuring first, which is the main thread.
+    for (uint32_t thread = 0; thread < thread_count; thread++) {
+        stream << (is_first ? "\n" : ",\n") << "    { \"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": " << thread << ", \"args\": { \"name\": \"";
+        if (thread == 0) {
+            stream << "main";
+        } else {
+            stream << "thread " << thread;
+        }
+        stream << "\" } }";
+        is_first = false;
+    }
+
+    stream << "\n  ]\n}\n";
+
+    if (!stream) {
+        log << "Texture compiler error. Failed to write trace file." << std::endl;
+        return false;
+    }
+    return true;
+}
+
+double get_trace_seconds() noexcept {
+    static const std::chrono::steady_clock::time_point epoch = std::chrono::steady_clock::now();
+    return get_seconds_since(epoch);
+}
+
+uint32_t get_thread_index() noexcept {
+    static std::atomic<uint32_t> next_index { 0 };
+    thread_local const uint32_t index = next_index++;
+    return index;
+}
+
+double get_process_cpu_time() noexcept {
+#if BX_PLATFORM_WINDOWS
+    FILETIME creation_time, exit_time, kernel_time, user_time;
+    if (!GetProcessTimes(GetCurrentProcess(), &creation_time, &exit_time, &kernel_time, &user_time)) {
+        return 0.0;
+    }
+
+    const auto to_seconds = [](const FILETIME& time) {
+        return static_cast<double>((static_cast<uint64_t>(time.dwHighDateTime) << 32) | time.dwLowDateTime) / 1e7;
+    };
+    return to_seconds(kernel_time) + to_seconds(user_time);
+#else
+    timespec time;
+    if (clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &time) != 0) {
+        return 0.0;
+    }
+    return static_cast<double>(time.tv_sec) + static_cast<double>(time.tv_nsec) / 1e9;
+#endif
+}
+
+double get_thread_cpu_time(std::thread::native_handle_type thread) noexcept {
+#if BX_PLATFORM_WINDOWS
+    FILETIME creation_time, exit_time, kernel_time, user_time;
+    if (!GetThreadTimes(thread, &creation_time, &exit_time, &kernel_time, &user_time)) {
+        return 0.0;
+    }
+
+    const auto to_seconds = [](const FILETIME& time) {
+        return static_cast<double>((static_cast<uint64_t>(time.dwHighDateTime) << 32) | time.dwLowDateTime) / 1e7;
+    };
+    return to_seconds(kernel_time) + to_seconds(user_time);
+#elif BX_PLATFORM_OSX
+    thread_basic_info_data_t info;
+    mach_msg_type_number_t count = THREAD_BASIC_INFO_COUNT;
+    if (thread_info(pthread_mach_thread_np(thread), THREAD_BASIC_INFO, reinterpret_cast<thread_info_t>(&info), &count) != KERN_SUCCESS) {
+        return 0.0;
+    }
+    return info.user_time.seconds + info.user_time.microseconds / 1e6 + info.system_time.seconds + info.system_time.microseconds / 1e6;
+#else
+    clockid_t clock;
+    timespec time;
+    if (pthread_getcpuclockid(thread, &clock) != 0 || clock_gettime(clock, &time) != 0) {
+        return 0.0;
+    }
+    return static_cast<double>(time.tv_sec) + static_cast<double>(time.tv_nsec) / 1e9;
+#endif
+}
+
+double get_calling_thread_cpu_time() noexcept {
+#if BX_PLATFORM_WINDOWS
+    return get_thread_cpu_time(GetCurrentThread());
+#else
+    return get_thread_cpu_time(pthread_self());
+#endif
+}
+
+size_t get_peak_memory_usage() noexcept {
+#if BX_PLATFORM_WINDOWS
+    PROCESS_MEMORY_COUNTERS counters;
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return 0;
+    }
+    return counters.PeakWorkingSetSize;
+#else
+    rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return 0;
+    }
+#if BX_PLATFORM_OSX
+    // Bytes on MacOS.
+    return static_cast<size_t>(usage.ru_maxrss);
+#else
+    // Kilobytes on Linux.
+    return static_cast<size_t>(usage.ru_maxrss) * 1024;
+#endif
+#endif
+}
+
+size_t get_memory_usage() noexcept {
+#if BX_PLATFORM_WINDOWS
+    PROCESS_MEMORY_COUNTERS counters;
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return 0;
+    }
+    return counters.WorkingSetSize;
+#elif BX_PLATFORM_OSX
+    mach_task_basic_info info;
+    mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+    if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO, reinterpret_cast<task_info_t>(&info), &count) != KERN_SUCCESS) {
+        return 0;
+    }
+    return static_cast<size_t>(info.resident_size);
+#else
+    // Second field is the resident set in pages.
+    FILE* file = std::fopen("/proc/self/statm", "r");
+    if (file == nullptr) {
+        return 0;
+    }
+    unsigned long size = 0;
+    unsigned long resident = 0;
+    const int count = std::fscanf(file, "%lu %lu", &size, &resident);
+    std::fclose(file);
+    return count == 2 ? static_cast<size_t>(resident) * static_cast<size_t>(sysconf(_SC_PAGESIZE)) : 0;
+#endif
+}
+
+uint64_t get_page_fault_count() noexcept {
+#if BX_PLATFORM_WINDOWS
+    PROCESS_MEMORY_COUNTERS counters;
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return 0;
+    }
+    return counters.PageFaultCount;
+#else
+    rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return 0;
+    }
+    return static_cast<uint64_t>(usage.ru_minflt) + static_cast<uint64_t>(usage.ru_majflt);
+#endif
+}
+
+bool enable_hardware_counters() noexcept {
+#if BX_PLATFORM_LINUX
+    try {
+        HardwareCounterRegistry& registry = get_hardware_counter_registry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+
+        DIR* directory = opendir("/proc/self/task");
+        if (directory == nullptr) {
+            return false;
+        }
+        while (const dirent* entry = readdir(directory)) {
+            if (entry->d_name[0] != '.') {
+                registry.threads.push_back(open_thread_counters(static_cast<pid_t>(std::atoi(entry->d_name))));
+            }
+        }
+        closedir(directory);
+
+        for (const ThreadCounters& counters : registry.threads) {
+            for (size_t i = 0; i < HARDWARE_EVENT_COUNT; i++) {
+                registry.is_counted[i] = registry.is_counted[i] || counters.descriptors[i] >= 0;
+            }
+        }
+        if (std::none_of(registry.is_counted.begin(), registry.is_counted.end(), [](bool is_counted) { return is_counted; })) {
+            registry.threads.clear();
+            return false;
+        }
+
+        is_hardware_counting = true;
+        return true;
+    } catch (...) {
+        return false;
+    }
+#else
+    return false;
+#endif
+}
+
+HardwareCounters read_hardware_counters() noexcept {
+    HardwareCounters counters;
+#if BX_PLATFORM_LINUX
+    if (!is_hardware_counting.load(std::memory_order_relaxed)) {
+        return counters;
+    }
+
+    HardwareCounterRegistry& registry = get_hardware_counter_registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    std::array<double, HARDWARE_EVENT_COUNT> counts = registry.exited_counts;
+    for (const ThreadCounters& thread_counters : registry.threads) {
+        for (size_t i = 0; i < HARDWARE_EVENT_COUNT; i++) {
+            if (thread_counters.descriptors[i] >= 0) {
+                read_hardware_event(thread_counters.descriptors[i], counts[i]);
+            }
+        }
+    }
+    for (size_t i = 0; i < HARDWARE_EVENT_COUNT; i++) {
+        if (registry.is_counted[i]) {
+            counters.*HARDWARE_COUNTER_MEMBERS[i] = counts[i];
+        }
+    }
+#endif
+    return counters;
+}
@@ -0,0 +1,247 @@
+#pragma once
+
+#include "allocation_tracker.h"
+#include "profiler.h"
+#include "schedule_report.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Hardware events of the CPU in user mode, summed over the threads of the process like CPU time is, for
+// `--hardware-counters`. Counts are scaled up by the share of time the kernel had them scheduled when it multiplexed
+// the counters, and are negative when the event can't be counted.
+struct HardwareCounters final {
+    double cycles = -1.0;
+    double instructions = -1.0;
+    double cache_misses = -1.0;
+    double dtlb_misses = -1.0;
+    double branch_misses = -1.0;
+};
+
+// Time spent in one phase of a job. CPU time is process wide, so it includes worker threads helping with this phase,
+// but with parallel manifest jobs it also includes whatever other jobs did at the same time.
+struct PhaseMetrics final {
+    std::string name;
+    int mip_level;
+    int face;
+    double wall_seconds;
+    double cpu_seconds;
+
+    // Start of the phase in `get_trace_seconds` and `get_thread_index` of the thread that measured it, for `--trace`.
+    double begin_seconds;
+    uint32_t thread;
+
+    // Events during the phase, process wide like `cpu_seconds`, all negative without `--hardware-counters`.
+    HardwareCounters counters;
+};
+
+// GPU time of a bgfx view of a cube map job, summed over every frame that executed it.
+struct GpuViewMetrics final {
+    std::string name;
+    double gpu_seconds;
+};
+
+// Quality of a mip level of a compressed output against the same level without compression, for `--report-quality`.
+struct QualityMetrics final {
+    std::string output;
+    int mip_level;
+    double psnr;
+    double ssim;
+
+    // Degrees, negative unless the output is a normal map.
+    double mean_angular_error;
+    double max_angular_error;
+};
+
+// Modes of the blocks of a mip level of a BC7 or BC6H output, for `--report-blocks`, see `MipLevelBlocks`.
+struct BlockMetrics final {
+    std::string output;
+    int mip_level;
+    std::string format;
+    std::vector<uint64_t> modes;
+    uint64_t reserved_blocks;
+    std::vector<std::vector<uint64_t>> partitions;
+
+    // Empty unless the output was measured against a reference by `--report-quality`.
+    std::vector<double> mode_squared_errors;
+    std::vector<uint64_t> error_histogram;
+};
+
+// Heap allocations a stage of a job made, for `--track-allocations`. Stages are the phases, summed over mip levels and
+// faces, and `other` for allocations of the thread of the job outside them.
+struct AllocationMetrics final {
+    std::string stage;
+    uint64_t allocations;
+    uint64_t allocated_bytes;
+    uint64_t peak_live_bytes;
+
+    // Allocated by the stage and not freed when the job finished, like caches and buffers kept by threads.
+    uint64_t live_bytes;
+};
+
+struct JobMetrics final {
+    JobMetrics() noexcept = default;
+
+    JobMetrics(const JobMetrics&) = delete;
+    JobMetrics(JobMetrics&&) = delete;
+    JobMetrics& operator=(const JobMetrics&) = delete;
+    JobMetrics& operator=(JobMetrics&&) = delete;
+
+    // Phases can be measured on thread pool workers, so adding them is synchronized.
+    void add_phase(PhaseMetrics phase);
+
+    std::string kind;
+    std::string compression;
+    std::string input;
+    std::vector<std::string> outputs;
+    std::string result;
+    double wall_seconds = 0.0;
+    double cpu_seconds = 0.0;
+    uint64_t bytes_written = 0;
+    size_t peak_memory_usage = 0;
+
+    // Page faults of the process during the job, process wide like `cpu_seconds`.
+    uint64_t page_faults = 0;
+
+    // Start of the job in `get_trace_seconds` and the thread that compiled it.
+    double begin_seconds = 0.0;
+    uint32_t thread = 0;
+
+    // PSNR in decibels of the `--rdo` output against the blocks nvtt encoded, negative without `--rdo`.
+    double rdo_psnr = -1.0;
+
+    // What `--auto-format` found in the image, like `opaque` or `constant_alpha`, and the output it picked, like `bc1`
+    // or `unchanged_1x1`. Empty without `--auto-format`.
+    std::vector<std::string> content;
+    std::string auto_format;
+
+    // Pixels of the mip levels and bands compressed into outputs, once for every output. Added to by the threads
+    // compressing them, for the encoder throughput of `--metrics-port`.
+    std::atomic<uint64_t> encoded_pixels { 0 };
+
+    // Wall seconds `--time-budget` expected the job to take at the qualities it picked, negative without a budget.
+    double estimated_seconds = -1.0;
+
+    // What a manifest job did about `--job-time-limit` and `--job-memory-limit`, `downgraded` or `slow_lane`, and the
+    // limits it went over, `time` and `memory`. Empty without limits.
+    std::string limit_action;
+    std::vector<std::string> exceeded_limits;
+
+    std::mutex mutex;
+    std::vector<PhaseMetrics> phases;
+
+    // Only filled by cube map jobs rendered on the GPU, by the main thread once the job is done. The peak is the
+    // estimate of texture and render target memory bgfx reports, zero when it reports none.
+    std::vector<GpuViewMetrics> gpu_views;
+    uint64_t peak_gpu_memory_usage = 0;
+
+    // Only filled with `--report-quality`, by the thread that finishes the outputs of the job.
+    std::vector<QualityMetrics> quality;
+
+    // Only filled with `--report-blocks`, by the thread that finishes the outputs of the job.
+    std::vector<BlockMetrics> blocks;
+
+    // Only with `--track-allocations`. Phases tag allocations with the tracker while the job runs, and its counts are
+    // moved into `allocations` and the peak of heap memory the job held when it's done.
+    std::unique_ptr<AllocationTracker> allocation_tracker;
+    std::vector<AllocationMetrics> allocations;
+    uint64_t peak_heap_usage = 0;
+};
+
+// Measures a phase from construction until `stop` or destruction. Null `metrics` means metrics are disabled, then
+// the timer doesn't even read the clock. It tags the samples of the profiler either way.
+struct PhaseTimer final {
+    PhaseTimer(JobMetrics* metrics, const char* name, int mip_level = -1, int face = -1) noexcept;
+
+    PhaseTimer(const PhaseTimer&) = delete;
+    PhaseTimer(PhaseTimer&&) = delete;
+    PhaseTimer& operator=(const PhaseTimer&) = delete;
+    PhaseTimer& operator=(PhaseTimer&&) = delete;
+
+    ~PhaseTimer();
+
+    void stop() noexcept;
+
+private:
+    JobMetrics* metrics;
+    const char* name;
+    int mip_level;
+    int face;
+    std::chrono::steady_clock::time_point wall_begin;
+    double cpu_begin = 0.0;
+    double begin_seconds = 0.0;
+    HardwareCounters counters_begin;
+    AllocationTag allocation_tag;
+    ProfileStageScope profile_stage;
+};
+
+// Metrics of every job compiled by this process, written as JSON by `--metrics`.
+struct MetricsReport final {
+    MetricsReport() noexcept;
+
+    MetricsReport(const MetricsReport&) = delete;
+    MetricsReport(MetricsReport&&) = delete;
+    MetricsReport& operator=(const MetricsReport&) = delete;
+    MetricsReport& operator=(MetricsReport&&) = delete;
+
+    void add_job(std::unique_ptr<JobMetrics> job);
+
+    bool write(const std::string& path, std::ostream& log) const;
+
+    // Writes jobs and their phases as complete events of the Chrome trace event format, which Perfetto and
+    // chrome://tracing load, with one track per thread.
+    bool write_trace(const std::string& path, std::ostream& log) const;
+
+    std::chrono::steady_clock::time_point wall_begin;
+    double cpu_begin;
+    uint64_t page_faults_begin;
+
+    mutable std::mutex mutex;
+    std::vector<std::unique_ptr<JobMetrics>> jobs;
+
+    // Schedule of the manifest, set once its jobs are done.
+    std::optional<ScheduleReport> schedule;
+};
+
+// Seconds since the first call in this process, the time base of trace events.
+double get_trace_seconds() noexcept;
+
+// Sequential number of the calling thread, in the order threads first call it.
+uint32_t get_thread_index() noexcept;
+
+// CPU time of all the threads of this process in seconds.
+double get_process_cpu_time() noexcept;
+
+// CPU time of a thread of this process in seconds, and of the calling thread.
+double get_thread_cpu_time(std::thread::native_handle_type thread) noexcept;
+double get_calling_thread_cpu_time() noexcept;
+
+// Peak resident set size of this process in bytes.
+size_t get_peak_memory_usage() noexcept;
+
+// Current resident set size of this process in bytes.
+size_t get_memory_usage() noexcept;
+
+// Page faults of this process so far, the ones served from memory and the ones that read from the disk.
+uint64_t get_page_fault_count() noexcept;
+
+// Starts counting cycles, instructions, cache misses, data TLB misses and branch misses of every thread of the process,
+// and of later threads once they measure a phase, for `--hardware-counters`. Threads that exit keep adding what they
+// counted. Returns false when the platform doesn't allow it, which is anything but Linux with `perf_event_paranoid`
+// of 2 or less, or a machine without a PMU like most virtual machines.
+bool enable_hardware_counters() noexcept;
+
+// Events counted so far, all negative unless `enable_hardware_counters` succeeded.
+HardwareCounters read_hardware_counters() noexcept;
+
+// Writes `value` as a quoted JSON string, with quotes, backslashes and control characters escaped.
+void write_json_string(std::ostream& stream, const std::string& value);
@@ -0,0 +1,547 @@
+#include "mip_filter.h"
+
+#include "pixel_kernels.h"
+#include "thread_pool.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+// Windowed kernels span three pixels of the next level on both sides of the center, which is twelve input pixels.
+// Pixel `x` of the next level is centered between input pixels `2x` and `2x + 1` and its taps start at `2x - 5`.
+static constexpr size_t TAP_COUNT = MIP_FILTER_TAP_COUNT;
+static constexpr ptrdiff_t FIRST_TAP = -5;
+
+// Pixels of the next level built by a single task.
+static constexpr size_t TASK_PIXEL_COUNT = 64 * 1024;
+
+// sRGB conversions are interpolated between this many steps of [0, 1].
+static constexpr size_t SRGB_TABLE_STEPS = 4096;
+
+size_t get_mip_filter_halo_rows(MipFilter filter) noexcept {
+    return filter == MipFilter::BOX ? 0 : static_cast<size_t>(-FIRST_TAP) + 1;
+}
+
+static double sinc(double x) noexcept {
+    const double PI = 3.14159265358979323846;
+    return std::abs(x) < 1e-9 ? 1.0 : std::sin(PI * x) / (PI * x);
+}
+
+// Zeroth order modified Bessel function of the first kind.
+static double bessel0(double x) noexcept {
+    double sum = 1.0;
+    double term = 1.0;
+    for (int k = 1; term > sum * 1e-12; k++) {
+        term *= (x * 0.5 / k) * (x * 0.5 / k);
+        sum += term;
+    }
+    return sum;
+}
+
+// Kernels are three pixels of the next level wide, Kaiser has the same alpha of 4 as `nvtt::MipmapFilter_Kaiser`.
+static double evaluate_filter(MipFilter filter, double x) noexcept {
+    const double WIDTH = 3.0;
+    if (std::abs(x) >= WIDTH) {
+        return 0.0;
+    }
+
+    if (filter == MipFilter::KAISER) {
+        const double ALPHA = 4.0;
+        const double t = x / WIDTH;
+        return sinc(x) * bessel0(ALPHA * std::sqrt(1.0 - t * t)) / bessel0(ALPHA);
+    }
+    return sinc(x) * sinc(x / WIDTH);
+}
+
+// Like nvtt, every tap integrates the kernel over the whole input pixel rather than sampling it at the pixel center.
+static void compute_weights(MipFilter filter, float (&weights)[TAP_COUNT]) noexcept {
+    const int SAMPLE_COUNT = 32;
+
+    double values[TAP_COUNT];
+    double total = 0.0;
+    for (size_t tap = 0; tap < TAP_COUNT; tap++) {
+        // Input pixel of the tap covers [`left`, `left` + 1) relative to the center of the pixel of the next level.
+        const double left = static_cast<double>(static_cast<ptrdiff_t>(tap) + FIRST_TAP) - 1.0;
+
+        double value = 0.0;
+        for (int sample = 0; sample < SAMPLE_COUNT; sample++) {
+            value += evaluate_filter(filter, (left + (sample + 0.5) / SAMPLE_COUNT) * 0.5);
+        }
+        values[tap] = value;
+        total += value;
+    }
+
+    for (size_t tap = 0; tap < TAP_COUNT; tap++) {
+        weights[tap] = static_cast<float>(values[tap] / total);
+    }
+}
+
+static size_t wrap_index(ptrdiff_t index, size_t size, MipWrap wrap) noexcept {
+    const ptrdiff_t count = static_cast<ptrdiff_t>(size);
+    switch (wrap) {
+        case MipWrap::CLAMP:
+            return static_cast<size_t>(std::min(std::max(index, ptrdiff_t(0)), count - 1));
+        case MipWrap::REPEAT: {
+            const ptrdiff_t remainder = index % count;
+            return static_cast<size_t>(remainder < 0 ? remainder + count : remainder);
+        }
+        case MipWrap::MIRROR:
+            // Edge pixels are not repeated, same as nvtt.
+            if (count == 1) {
+                return 0;
+            }
+            index = std::abs(index);
+            while (index >= count) {
+                index = std::abs(count + count - index - 2);
+            }
+            return static_cast<size_t>(index);
+    }
+    return 0;
+}
+
+namespace {
+
+// Taps of every pixel of the next level along one axis of a level with an odd side, which the fixed taps of
+// `compute_weights` don't fit.
+struct AxisTaps final {
+    size_t tap_count = 0;
+
+    // First input pixel of every pixel of the next level, which may be past the edges.
+    std::vector<ptrdiff_t> first;
+
+    // `tap_count` weights of every pixel of the next level.
+    std::vector<float> weights;
+
+    // `tap_count` input pixels of every pixel of the next level, wrapped around the edges.
+    std::vector<size_t> indices;
+};
+
+} // namespace
+
+// Same kernels as `compute_weights` stretched by the exact ratio of the axis sizes. Pixel `x` of the next level is
+// centered at `(x + 0.5) * scale` of the input, box averages the input pixels it covers weighted by their coverage and
+// windowed kernels span three pixels of the next level on both sides of the center.
+static void compute_axis_taps(MipFilter filter, size_t size, size_t next_size, MipWrap wrap, AxisTaps& taps) {
+    const int SAMPLE_COUNT = 32;
+
+    if (size == 1) {
+        taps.tap_count = 1;
+        taps.first.assign(1, 0);
+        taps.weights.assign(1, 1.f);
+        taps.indices.assign(1, 0);
+        return;
+    }
+
+    const double scale = static_cast<double>(size) / static_cast<double>(next_size);
+    const double radius = filter == MipFilter::BOX ? scale * 0.5 : scale * 3.0;
+
+    taps.tap_count = static_cast<size_t>(std::ceil(radius * 2.0)) + 1;
+    taps.first.resize(next_size);
+    taps.weights.assign(next_size * taps.tap_count, 0.f);
+    taps.indices.resize(next_size * taps.tap_count);
+
+    std::vector<double> values(taps.tap_count);
+    for (size_t pixel = 0; pixel < next_size; pixel++) {
+        const double center = (static_cast<double>(pixel) + 0.5) * scale;
+        const ptrdiff_t first = static_cast<ptrdiff_t>(std::floor(center - radius));
+        const ptrdiff_t last = static_cast<ptrdiff_t>(std::ceil(center + radius)) - 1;
+
+        double total = 0.0;
+        for (size_t tap = 0; tap < taps.tap_count; tap++) {
+            const ptrdiff_t index = first + static_cast<ptrdiff_t>(tap);
+            const double left = static_cast<double>(index);
+
+            double value = 0.0;
+            if (index <= last) {
+                if (filter == MipFilter::BOX) {
+                    value = std::max(std::min(left + 1.0, center + radius) - std::max(left, center - radius), 0.0);
+                } else {
+                    for (int sample = 0; sample < SAMPLE_COUNT; sample++) {
+                        value += evaluate_filter(filter, (left + (sample + 0.5) / SAMPLE_COUNT - center) / scale);
+                    }
+                }
+            }
+            values[tap] = value;
+            total += value;
+        }
+
+        taps.first[pixel] = first;
+        for (size_t tap = 0; tap < taps.tap_count; tap++) {
+            taps.weights[pixel * taps.tap_count + tap] = static_cast<float>(values[tap] / total);
+            taps.indices[pixel * taps.tap_count + tap] = wrap_index(first + static_cast<ptrdiff_t>(tap), size, wrap);
+        }
+    }
+}
+
+// Tables of both sRGB conversions, interpolated linearly.
+struct SrgbTables final {
+    SrgbTables() noexcept {
+        for (size_t i = 0; i <= SRGB_TABLE_STEPS; i++) {
+            const double value = static_cast<double>(i) / SRGB_TABLE_STEPS;
+            to_linear[i] = static_cast<float>(value <= 0.04045 ? value / 12.92 : std::pow((value + 0.055) / 1.055, 2.4));
+            to_srgb[i] = static_cast<float>(value <= 0.0031308 ? value * 12.92 : 1.055 * std::pow(value, 1.0 / 2.4) - 0.055);
+        }
+    }
+
+    float to_linear[SRGB_TABLE_STEPS + 1];
+    float to_srgb[SRGB_TABLE_STEPS + 1];
+};
+
+static const SrgbTables& get_srgb_tables() noexcept {
+    static const SrgbTables tables;
+    return tables;
+}
+
+static void convert_row(const float* table, const float* input, size_t count, float* output) noexcept {
+    for (size_t i = 0; i < count; i++) {
+        const float position = std::min(std::max(input[i], 0.f), 1.f) * static_cast<float>(SRGB_TABLE_STEPS);
+        const size_t index = std::min(static_cast<size_t>(position), SRGB_TABLE_STEPS - 1);
+        const float fraction = position - static_cast<float>(index);
+        output[i] = table[index] + (table[index + 1] - table[index]) * fraction;
+    }
+}
+
+// Perceptual roughness to GGX alpha squared, which is the fourth power of roughness, and back.
+static void convert_roughness_to_alpha_squared(const float* input, size_t count, float* output) noexcept {
+    for (size_t i = 0; i < count; i++) {
+        const float roughness = std::min(std::max(input[i], 0.f), 1.f);
+        output[i] = (roughness * roughness) * (roughness * roughness);
+    }
+}
+
+static void convert_alpha_squared_to_roughness(const float* input, size_t count, float* output) noexcept {
+    for (size_t i = 0; i < count; i++) {
+        output[i] = std::sqrt(std::sqrt(std::min(std::max(input[i], 0.f), 1.f)));
+    }
+}
+
+// Averages pairs of pixels of a single row, which is how nvtt builds mip levels of images one pixel tall.
+static void box_filter_row(const float* row, size_t count, float* output) noexcept {
+    for (size_t i = 0; i < count; i++) {
+        output[i] = 0.5f * (row[i * 2] + row[i * 2 + 1]);
+    }
+}
+
+namespace {
+
+// Everything the tasks of a single level share.
+struct LevelFilter final {
+    const float* const* input;
+    size_t width;
+    size_t height;
+    size_t halo_rows;
+    float* const* output;
+    size_t output_width;
+    size_t output_height;
+    const MipFilterOptions& options;
+    float weights[TAP_COUNT];
+
+    // Both are set for levels with an odd side, which are filtered by `filter_scaled`.
+    const AxisTaps* horizontal_taps;
+    const AxisTaps* vertical_taps;
+
+    // Input row of the specified row of the band or of the whole image, which may be past the edges.
+    size_t get_input_row(ptrdiff_t row) const noexcept {
+        if (halo_rows != 0) {
+            return static_cast<size_t>(static_cast<ptrdiff_t>(halo_rows) + row);
+        }
+        return wrap_index(row, height, options.wrap);
+    }
+
+    bool is_converted(size_t channel) const noexcept {
+        return channel < 3 ? options.is_srgb : options.is_alpha_roughness;
+    }
+
+    // Pointers to `row_count` virtual rows of every channel starting at `first_row`, converted rows are stored in
+    // `converted_rows`.
+    void gather_rows(ptrdiff_t first_row, size_t row_count, std::vector<float>& converted_rows, std::vector<const float*>& rows) const;
+
+    // Converts the finished row of the next level back from the space it was filtered in.
+    void convert_back(size_t channel, float* destination) const noexcept;
+
+    // Renormalizes the finished rows of the next level of a normal map.
+    void renormalize(size_t row_begin, size_t row_end) const noexcept;
+
+    void filter(size_t row_begin, size_t row_end) const;
+    void filter_scaled(size_t row_begin, size_t row_end) const;
+};
+
+} // namespace
+
+void LevelFilter::gather_rows(ptrdiff_t first_row, size_t row_count, std::vector<float>& converted_rows, std::vector<const float*>& rows) const {
+    const SrgbTables* srgb_tables = options.is_srgb ? &get_srgb_tables() : nullptr;
+
+    // Converted copies of the input rows are made once per task, so the halo is the only repeated conversion.
+    converted_rows.resize(row_count * width * ((options.is_srgb ? 3 : 0) + (options.is_alpha_roughness ? 1 : 0)));
+    float* converted_row = converted_rows.data();
+    rows.resize(row_count * 4);
+    for (size_t channel = 0; channel < options.channel_count; channel++) {
+        for (size_t row = 0; row < row_count; row++) {
+            const float* source = input[channel] + get_input_row(first_row + static_cast<ptrdiff_t>(row)) * width;
+            if (is_converted(channel)) {
+                if (channel < 3) {
+                    convert_row(srgb_tables->to_linear, source, width, converted_row);
+                } else {
+                    convert_roughness_to_alpha_squared(source, width, converted_row);
+                }
+                source = converted_row;
+                converted_row += width;
+            }
+            rows[channel * row_count + row] = source;
+        }
+    }
+}
+
+void LevelFilter::convert_back(size_t channel, float* destination) const noexcept {
+    if (is_converted(channel)) {
+        if (channel < 3) {
+            convert_row(get_srgb_tables().to_srgb, destination, output_width, destination);
+        } else {
+            convert_alpha_squared_to_roughness(destination, output_width, destination);
+        }
+    }
+}
+
+void LevelFilter::renormalize(size_t row_begin, size_t row_end) const noexcept {
+    if (options.is_normal_map) {
+        const size_t offset = row_begin * output_width;
+        renormalize_packed_normals(output[0] + offset, output[1] + offset, output[2] + offset, (row_end - row_begin) * output_width);
+    }
+}
+
+void LevelFilter::filter(size_t row_begin, size_t row_end) const {
+    const bool is_box = options.filter == MipFilter::BOX;
+    const bool is_vertical = height > 1;
+    const bool is_horizontal = width > 1;
+
+    // Virtual rows of the band of the input the task needs, wrapped rows past the edges included.
+    const ptrdiff_t first_row = is_vertical ? static_cast<ptrdiff_t>(row_begin * 2) + (is_box ? 0 : FIRST_TAP) : 0;
+    const size_t row_count = is_vertical ? (row_end - row_begin) * 2 + (is_box ? 0 : TAP_COUNT - 2) : 1;
+
+    std::vector<float> converted_rows;
+    std::vector<const float*> rows;
+    gather_rows(first_row, row_count, converted_rows, rows);
+
+    // Padded row holds the column sums from `FIRST_TAP` pixels before the first pixel to past the last tap.
+    const size_t padded_width = output_width * 2 + TAP_COUNT - 2;
+    std::vector<float> columns(is_box ? 0 : width);
+    std::vector<float> padded(is_box ? 0 : padded_width);
+    std::vector<float> even(is_box ? 0 : padded_width / 2);
+    std::vector<float> odd(is_box ? 0 : padded_width / 2);
+
+    for (size_t channel = 0; channel < options.channel_count; channel++) {
+        const float* const* channel_rows = rows.data() + channel * row_count;
+
+        for (size_t row = row_begin; row < row_end; row++) {
+            const size_t local_row = is_vertical ? (row - row_begin) * 2 : 0;
+            float* destination = output[channel] + row * output_width;
+
+            if (is_box) {
+                if (is_vertical && is_horizontal) {
+                    box_filter_rows(channel_rows[local_row], channel_rows[local_row + 1], output_width, destination);
+                } else if (is_vertical) {
+                    destination[0] = 0.5f * (channel_rows[local_row][0] + channel_rows[local_row + 1][0]);
+                } else {
+                    box_filter_row(channel_rows[0], output_width, destination);
+                }
+            } else {
+                const float* column_sums = channel_rows[0];
+                if (is_vertical) {
+                    filter_columns(channel_rows + local_row, weights, width, columns.data());
+                    column_sums = columns.data();
+                }
+
+                if (is_horizontal) {
+                    for (size_t i = 0; i < padded_width; i++) {
+                        padded[i] = column_sums[wrap_index(static_cast<ptrdiff_t>(i) + FIRST_TAP, width, options.wrap)];
+                    }
+                    for (size_t i = 0; i < padded_width / 2; i++) {
+                        even[i] = padded[i * 2];
+                        odd[i] = padded[i * 2 + 1];
+                    }
+                    filter_rows(even.data(), odd.data(), weights, output_width, destination);
+                } else {
+                    destination[0] = column_sums[0];
+                }
+
+                // Windowed kernels have negative lobes, which may overshoot the range of the texture.
+                for (size_t i = 0; i < output_width; i++) {
+                    destination[i] = std::min(std::max(destination[i], 0.f), 1.f);
+                }
+            }
+
+            convert_back(channel, destination);
+        }
+    }
+
+    renormalize(row_begin, row_end);
+}
+
+void LevelFilter::filter_scaled(size_t row_begin, size_t row_end) const {
+    const size_t vertical_tap_count = vertical_taps->tap_count;
+    const size_t horizontal_tap_count = horizontal_taps->tap_count;
+
+    const ptrdiff_t first_row = vertical_taps->first[row_begin];
+    const size_t row_count = static_cast<size_t>(vertical_taps->first[row_end - 1] - first_row) + vertical_tap_count;
+
+    std::vector<float> converted_rows;
+    std::vector<const float*> rows;
+    gather_rows(first_row, row_count, converted_rows, rows);
+
+    std::vector<float> columns(width);
+    for (size_t channel = 0; channel < options.channel_count; channel++) {
+        const float* const* channel_rows = rows.data() + channel * row_count;
+
+        for (size_t row = row_begin; row < row_end; row++) {
+            const float* const* tap_rows = channel_rows + (vertical_taps->first[row] - first_row);
+            const float* vertical_weights = vertical_taps->weights.data() + row * vertical_tap_count;
+            for (size_t i = 0; i < width; i++) {
+                float sum = tap_rows[0][i] * vertical_weights[0];
+                for (size_t tap = 1; tap < vertical_tap_count; tap++) {
+                    sum += tap_rows[tap][i] * vertical_weights[tap];
+                }
+                columns[i] = sum;
+            }
+
+            float* destination = output[channel] + row * output_width;
+            for (size_t i = 0; i < output_width; i++) {
+                const size_t* indices = horizontal_taps->indices.data() + i * horizontal_tap_count;
+                const float* horizontal_weights = horizontal_taps->weights.data() + i * horizontal_tap_count;
+                float sum = columns[indices[0]] * horizontal_weights[0];
+                for (size_t tap = 1; tap < horizontal_tap_count; tap++) {
+                    sum += columns[indices[tap]] * horizontal_weights[tap];
+                }
+
+                // Windowed kernels have negative lobes, which may overshoot the range of the texture.
+                destination[i] = options.filter == MipFilter::BOX ? sum : std::min(std::max(sum, 0.f), 1.f);
+            }
+
+            convert_back(channel, destination);
+        }
+    }
+
+    renormalize(row_begin, row_end);
+}
+
+void build_next_mip_level(const float* const (&input)[4], size_t width, size_t height, size_t halo_rows, const MipFilterOptions& options, ThreadPool& pool,
+                          float* const (&output)[4]) {
+    const size_t band_height = height - halo_rows * 2;
+
+    LevelFilter level { input, width, height, halo_rows, output, std::max<size_t>(width / 2, 1), std::max<size_t>(band_height / 2, 1), options, {}, nullptr, nullptr };
+
+    // Odd sides are shrunk by a ratio a little over two, so every pixel of the next level has its own taps. Bands of
+    // streamed images always have an even number of rows.
+    AxisTaps horizontal_taps;
+    AxisTaps vertical_taps;
+    const bool is_scaled = (width > 1 && width % 2 != 0) || (band_height > 1 && band_height % 2 != 0);
+    if (is_scaled) {
+        compute_axis_taps(options.filter, width, level.output_width, options.wrap, horizontal_taps);
+        compute_axis_taps(options.filter, band_height, level.output_height, options.wrap, vertical_taps);
+        level.horizontal_taps = &horizontal_taps;
+        level.vertical_taps = &vertical_taps;
+    } else if (options.filter != MipFilter::BOX) {
+        compute_weights(options.filter, level.weights);
+    }
+
+    const size_t rows_per_task = std::max<size_t>(TASK_PIXEL_COUNT / level.output_width, 1);
+
+    TaskGroup group;
+    for (size_t row_begin = 0; row_begin < level.output_height; row_begin += rows_per_task) {
+        const size_t row_end = std::min(row_begin + rows_per_task, level.output_height);
+        pool.push(group, [&level, is_scaled, row_begin, row_end] {
+            if (is_scaled) {
+                level.filter_scaled(row_begin, row_end);
+            } else {
+                level.filter(row_begin, row_end);
+            }
+        });
+    }
+    pool.wait(group);
+}
+
+// Exact 8-bit sRGB conversions. Linear values are 16-bit, so the sum of a 2x2 quad fits in 32 bits and rounding to the
+// nearest sRGB value never needs interpolation.
+struct Rgba8SrgbTables final {
+    Rgba8SrgbTables() noexcept {
+        for (size_t i = 0; i < 256; i++) {
+            const double value = static_cast<double>(i) / 255.0;
+            to_linear[i] = static_cast<uint16_t>(std::lround((value <= 0.04045 ? value / 12.92 : std::pow((value + 0.055) / 1.055, 2.4)) * 65535.0));
+        }
+        for (size_t i = 0; i < 65536; i++) {
+            const double value = static_cast<double>(i) / 65535.0;
+            to_srgb[i] = static_cast<uint8_t>(std::lround((value <= 0.0031308 ? value * 12.92 : 1.055 * std::pow(value, 1.0 / 2.4) - 0.055) * 255.0));
+        }
+    }
+
+    uint16_t to_linear[256];
+    uint8_t to_srgb[65536];
+};
+
+static const Rgba8SrgbTables& get_rgba8_srgb_tables() noexcept {
+    static const Rgba8SrgbTables tables;
+    return tables;
+}
+
+// Same as `box_filter_rgba8_rows` for sRGB red, green and blue, which are averaged as linear 16-bit values.
+static void box_filter_srgba8_rows(const Rgba8SrgbTables& tables, const uint8_t* top, const uint8_t* bottom, size_t count, uint8_t* output) noexcept {
+    for (size_t i = 0; i < count; i++) {
+        for (size_t channel = 0; channel < 3; channel++) {
+            const uint32_t sum = static_cast<uint32_t>(tables.to_linear[top[i * 8 + channel]]) + tables.to_linear[top[i * 8 + 4 + channel]] + tables.to_linear[bottom[i * 8 + channel]] +
+                                 tables.to_linear[bottom[i * 8 + 4 + channel]];
+            output[i * 4 + channel] = tables.to_srgb[(sum + 2) / 4];
+        }
+        const unsigned sum = top[i * 8 + 3] + top[i * 8 + 7] + bottom[i * 8 + 3] + bottom[i * 8 + 7];
+        output[i * 4 + 3] = static_cast<uint8_t>((sum + 2) / 4);
+    }
+}
+
+// Averages pairs of RGBA8 pixels, which make up the levels of images one pixel wide or tall.
+static void box_filter_rgba8_pairs(const Rgba8SrgbTables* tables, const uint8_t* input, size_t count, uint8_t* output) noexcept {
+    for (size_t i = 0; i < count; i++) {
+        const uint8_t* a = input + i * 8;
+        const uint8_t* b = a + 4;
+        for (size_t channel = 0; channel < 4; channel++) {
+            if (tables != nullptr && channel < 3) {
+                output[i * 4 + channel] = tables->to_srgb[(static_cast<uint32_t>(tables->to_linear[a[channel]]) + tables->to_linear[b[channel]] + 1) / 2];
+            } else {
+                output[i * 4 + channel] = static_cast<uint8_t>((a[channel] + b[channel] + 1) / 2);
+            }
+        }
+    }
+}
+
+void build_next_rgba8_mip_level(const uint8_t* input, size_t width, size_t height, bool is_srgb, ThreadPool& pool, uint8_t* output) {
+    const Rgba8SrgbTables* tables = is_srgb ? &get_rgba8_srgb_tables() : nullptr;
+    const size_t output_width = std::max<size_t>(width / 2, 1);
+    const size_t output_height = std::max<size_t>(height / 2, 1);
+
+    if (width == 1 || height == 1) {
+        // Single rows and columns are laid out the same way and are small enough to never be worth a task.
+        if (width == 1 && height == 1) {
+            std::copy(input, input + 4, output);
+        } else {
+            box_filter_rgba8_pairs(tables, input, std::max(output_width, output_height), output);
+        }
+        return;
+    }
+
+    const size_t rows_per_task = std::max<size_t>(TASK_PIXEL_COUNT / output_width, 1);
+
+    TaskGroup group;
+    for (size_t row_begin = 0; row_begin < output_height; row_begin += rows_per_task) {
+        const size_t row_end = std::min(row_begin + rows_per_task, output_height);
+        pool.push(group, [=] {
+            for (size_t y = row_begin; y < row_end; y++) {
+                const uint8_t* top = input + y * 2 * width * 4;
+                const uint8_t* bottom = top + width * 4;
+                if (tables != nullptr) {
+                    box_filter_srgba8_rows(*tables, top, bottom, output_width, output + y * output_width * 4);
+                } else {
+                    box_filter_rgba8_rows(top, bottom, output_width, output + y * output_width * 4);
+                }
+            }
+        });
+    }
+    pool.wait(group);
+}
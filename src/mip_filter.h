@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+struct ThreadPool;
+
+// Kernels of the mip filter. Box averages every 2x2 quad and produces exactly the same levels as
+// `nvtt::MipmapFilter_Box` for levels with even sides. Kaiser and Lanczos are windowed sincs three pixels of the next level wide, they keep the
+// lower mip levels sharper at the cost of a little ringing.
+enum class MipFilter {
+    BOX,
+    KAISER,
+    LANCZOS
+};
+
+// How the filter samples pixels past the edges, same as the matching `nvtt::WrapMode`.
+enum class MipWrap {
+    CLAMP,
+    REPEAT,
+    MIRROR
+};
+
+struct MipFilterOptions final {
+    MipFilter filter = MipFilter::BOX;
+    MipWrap wrap = MipWrap::REPEAT;
+
+    // Red, green and blue planes are sRGB encoded, so they are converted to linear space before filtering and back to
+    // sRGB afterwards.
+    bool is_srgb = false;
+
+    // Alpha plane is perceptual roughness, which is filtered as GGX alpha squared, the fourth power of roughness, so
+    // lower mip levels keep the average width of the specular lobes rather than the average roughness.
+    bool is_alpha_roughness = false;
+
+    // Red, green and blue planes are a unit normal packed to [0, 1], which is unpacked, scaled back to unit length and
+    // packed again by `renormalize_packed_normals` as soon as a task has filtered its rows, while they're still in the
+    // cache. Lengths of the filtered normals are lost, so the variance they carry has to be measured beforehand.
+    bool is_normal_map = false;
+
+    // Only the first planes are filtered, the other planes of the next level are left as they are. Height maps keep
+    // their single channel in the first plane.
+    size_t channel_count = 4;
+};
+
+// Number of extra rows above and below a band that filter needs to build the band of the next level exactly like the
+// same rows of the whole image would be built. Box needs none.
+size_t get_mip_filter_halo_rows(MipFilter filter) noexcept;
+
+// Builds the next mip level of four float planes in [0, 1], `max(width / 2, 1)` by `max(height / 2, 1)` pixels, from
+// the level above it. Planes of the next level must not overlap the input. When `halo_rows` is not zero, the input is
+// a band of a taller image with that many rows of the image above and below the band, which already wrap around the
+// image, and only the rows of the band are built, which then must have an even number of rows. Odd sides shrink to
+// `floor(size / 2)` pixels, whose kernels are stretched by the exact ratio of the sizes. Every row of the next level is built in a single cache friendly
+// pass over the input rows it needs, and rows are split between the tasks of the thread pool.
+void build_next_mip_level(const float* const (&input)[4], size_t width, size_t height, size_t halo_rows, const MipFilterOptions& options, ThreadPool& pool,
+                          float* const (&output)[4]);
+
+// Builds the next mip level of RGBA8 pixels with the box filter entirely in integers, four times less memory to read and
+// write than float planes. Every channel of the next level is the rounded average of its 2x2 quad. When `is_srgb` is
+// true, red, green and blue are averaged in linear space through exact 16-bit tables. The result is within one step of
+// the box filter applied to the same level in floats, but the rounding of every level carries over to the next one.
+// Both sides must be even or one.
+void build_next_rgba8_mip_level(const uint8_t* input, size_t width, size_t height, bool is_srgb, ThreadPool& pool, uint8_t* output);
@@ -0,0 +1,969 @@
+#include <cstdint>
+
+static const uint8_t mip_shader_compute_glsl[3031] =
+{
+	0x43, 0x53, 0x48, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0x0b, // CSH.............
+	0x00, 0x00, 0x23, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x34, 0x33, 0x30, 0x0a, 0x76, // ..#version 430.v
+	0x65, 0x63, 0x33, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x4d, 0x75, 0x6c, 0x28, 0x76, 0x65, 0x63, 0x33, // ec3 instMul(vec3
+	0x20, 0x5f, 0x76, 0x65, 0x63, 0x2c, 0x20, 0x6d, 0x61, 0x74, 0x33, 0x20, 0x5f, 0x6d, 0x74, 0x78, //  _vec, mat3 _mtx
+	0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x28, 0x20, 0x28, 0x5f, 0x76, // ) { return ( (_v
+	0x65, 0x63, 0x29, 0x20, 0x2a, 0x20, 0x28, 0x5f, 0x6d, 0x74, 0x78, 0x29, 0x20, 0x29, 0x3b, 0x20, // ec) * (_mtx) ); 
+	0x7d, 0x0a, 0x76, 0x65, 0x63, 0x33, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x4d, 0x75, 0x6c, 0x28, 0x6d, // }.vec3 instMul(m
+	0x61, 0x74, 0x33, 0x20, 0x5f, 0x6d, 0x74, 0x78, 0x2c, 0x20, 0x76, 0x65, 0x63, 0x33, 0x20, 0x5f, // at3 _mtx, vec3 _
+	0x76, 0x65, 0x63, 0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x28, 0x20, // vec) { return ( 
+	0x28, 0x5f, 0x6d, 0x74, 0x78, 0x29, 0x20, 0x2a, 0x20, 0x28, 0x5f, 0x76, 0x65, 0x63, 0x29, 0x20, // (_mtx) * (_vec) 
+	0x29, 0x3b, 0x20, 0x7d, 0x0a, 0x76, 0x65, 0x63, 0x34, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x4d, 0x75, // ); }.vec4 instMu
+	0x6c, 0x28, 0x76, 0x65, 0x63, 0x34, 0x20, 0x5f, 0x76, 0x65, 0x63, 0x2c, 0x20, 0x6d, 0x61, 0x74, // l(vec4 _vec, mat
+	0x34, 0x20, 0x5f, 0x6d, 0x74, 0x78, 0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, // 4 _mtx) { return
+	0x20, 0x28, 0x20, 0x28, 0x5f, 0x76, 0x65, 0x63, 0x29, 0x20, 0x2a, 0x20, 0x28, 0x5f, 0x6d, 0x74, //  ( (_vec) * (_mt
+	0x78, 0x29, 0x20, 0x29, 0x3b, 0x20, 0x7d, 0x0a, 0x76, 0x65, 0x63, 0x34, 0x20, 0x69, 0x6e, 0x73, // x) ); }.vec4 ins
+	0x74, 0x4d, 0x75, 0x6c, 0x28, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x5f, 0x6d, 0x74, 0x78, 0x2c, 0x20, // tMul(mat4 _mtx, 
+	0x76, 0x65, 0x63, 0x34, 0x20, 0x5f, 0x76, 0x65, 0x63, 0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, // vec4 _vec) { ret
+	0x75, 0x72, 0x6e, 0x20, 0x28, 0x20, 0x28, 0x5f, 0x6d, 0x74, 0x78, 0x29, 0x20, 0x2a, 0x20, 0x28, // urn ( (_mtx) * (
+	0x5f, 0x76, 0x65, 0x63, 0x29, 0x20, 0x29, 0x3b, 0x20, 0x7d, 0x0a, 0x66, 0x6c, 0x6f, 0x61, 0x74, // _vec) ); }.float
+	0x20, 0x72, 0x63, 0x70, 0x28, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x5f, 0x61, 0x29, 0x20, 0x7b, //  rcp(float _a) {
+	0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x31, 0x2e, 0x30, 0x2f, 0x5f, 0x61, 0x3b, 0x20, //  return 1.0/_a; 
+	0x7d, 0x0a, 0x76, 0x65, 0x63, 0x32, 0x20, 0x72, 0x63, 0x70, 0x28, 0x76, 0x65, 0x63, 0x32, 0x20, // }.vec2 rcp(vec2 
+	0x5f, 0x61, 0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x76, 0x65, 0x63, // _a) { return vec
+	0x32, 0x28, 0x31, 0x2e, 0x30, 0x29, 0x2f, 0x5f, 0x61, 0x3b, 0x20, 0x7d, 0x0a, 0x76, 0x65, 0x63, // 2(1.0)/_a; }.vec
+	0x33, 0x20, 0x72, 0x63, 0x70, 0x28, 0x76, 0x65, 0x63, 0x33, 0x20, 0x5f, 0x61, 0x29, 0x20, 0x7b, // 3 rcp(vec3 _a) {
+	0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x76, 0x65, 0x63, 0x33, 0x28, 0x31, 0x2e, 0x30, //  return vec3(1.0
+	0x29, 0x2f, 0x5f, 0x61, 0x3b, 0x20, 0x7d, 0x0a, 0x76, 0x65, 0x63, 0x34, 0x20, 0x72, 0x63, 0x70, // )/_a; }.vec4 rcp
+	0x28, 0x76, 0x65, 0x63, 0x34, 0x20, 0x5f, 0x61, 0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, // (vec4 _a) { retu
+	0x72, 0x6e, 0x20, 0x76, 0x65, 0x63, 0x34, 0x28, 0x31, 0x2e, 0x30, 0x29, 0x2f, 0x5f, 0x61, 0x3b, // rn vec4(1.0)/_a;
+	0x20, 0x7d, 0x0a, 0x76, 0x65, 0x63, 0x32, 0x20, 0x76, 0x65, 0x63, 0x32, 0x5f, 0x73, 0x70, 0x6c, //  }.vec2 vec2_spl
+	0x61, 0x74, 0x28, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x5f, 0x78, 0x29, 0x20, 0x7b, 0x20, 0x72, // at(float _x) { r
+	0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x76, 0x65, 0x63, 0x32, 0x28, 0x5f, 0x78, 0x2c, 0x20, 0x5f, // eturn vec2(_x, _
+	0x78, 0x29, 0x3b, 0x20, 0x7d, 0x0a, 0x76, 0x65, 0x63, 0x33, 0x20, 0x76, 0x65, 0x63, 0x33, 0x5f, // x); }.vec3 vec3_
+	0x73, 0x70, 0x6c, 0x61, 0x74, 0x28, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x5f, 0x78, 0x29, 0x20, // splat(float _x) 
+	0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x76, 0x65, 0x63, 0x33, 0x28, 0x5f, 0x78, // { return vec3(_x
+	0x2c, 0x20, 0x5f, 0x78, 0x2c, 0x20, 0x5f, 0x78, 0x29, 0x3b, 0x20, 0x7d, 0x0a, 0x76, 0x65, 0x63, // , _x, _x); }.vec
+	0x34, 0x20, 0x76, 0x65, 0x63, 0x34, 0x5f, 0x73, 0x70, 0x6c, 0x61, 0x74, 0x28, 0x66, 0x6c, 0x6f, // 4 vec4_splat(flo
+	0x61, 0x74, 0x20, 0x5f, 0x78, 0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, // at _x) { return 
+	0x76, 0x65, 0x63, 0x34, 0x28, 0x5f, 0x78, 0x2c, 0x20, 0x5f, 0x78, 0x2c, 0x20, 0x5f, 0x78, 0x2c, // vec4(_x, _x, _x,
+	0x20, 0x5f, 0x78, 0x29, 0x3b, 0x20, 0x7d, 0x0a, 0x75, 0x76, 0x65, 0x63, 0x32, 0x20, 0x75, 0x76, //  _x); }.uvec2 uv
+	0x65, 0x63, 0x32, 0x5f, 0x73, 0x70, 0x6c, 0x61, 0x74, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, // ec2_splat(uint _
+	0x78, 0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x75, 0x76, 0x65, 0x63, // x) { return uvec
+	0x32, 0x28, 0x5f, 0x78, 0x2c, 0x20, 0x5f, 0x78, 0x29, 0x3b, 0x20, 0x7d, 0x0a, 0x75, 0x76, 0x65, // 2(_x, _x); }.uve
+	0x63, 0x33, 0x20, 0x75, 0x76, 0x65, 0x63, 0x33, 0x5f, 0x73, 0x70, 0x6c, 0x61, 0x74, 0x28, 0x75, // c3 uvec3_splat(u
+	0x69, 0x6e, 0x74, 0x20, 0x5f, 0x78, 0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, // int _x) { return
+	0x20, 0x75, 0x76, 0x65, 0x63, 0x33, 0x28, 0x5f, 0x78, 0x2c, 0x20, 0x5f, 0x78, 0x2c, 0x20, 0x5f, //  uvec3(_x, _x, _
+	0x78, 0x29, 0x3b, 0x20, 0x7d, 0x0a, 0x75, 0x76, 0x65, 0x63, 0x34, 0x20, 0x75, 0x76, 0x65, 0x63, // x); }.uvec4 uvec
+	0x34, 0x5f, 0x73, 0x70, 0x6c, 0x61, 0x74, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x78, 0x29, // 4_splat(uint _x)
+	0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x75, 0x76, 0x65, 0x63, 0x34, 0x28, //  { return uvec4(
+	0x5f, 0x78, 0x2c, 0x20, 0x5f, 0x78, 0x2c, 0x20, 0x5f, 0x78, 0x2c, 0x20, 0x5f, 0x78, 0x29, 0x3b, // _x, _x, _x, _x);
+	0x20, 0x7d, 0x0a, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x6d, 0x74, 0x78, 0x46, 0x72, 0x6f, 0x6d, 0x52, //  }.mat4 mtxFromR
+	0x6f, 0x77, 0x73, 0x28, 0x76, 0x65, 0x63, 0x34, 0x20, 0x5f, 0x30, 0x2c, 0x20, 0x76, 0x65, 0x63, // ows(vec4 _0, vec
+	0x34, 0x20, 0x5f, 0x31, 0x2c, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x5f, 0x32, 0x2c, 0x20, 0x76, // 4 _1, vec4 _2, v
+	0x65, 0x63, 0x34, 0x20, 0x5f, 0x33, 0x29, 0x0a, 0x7b, 0x0a, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, // ec4 _3).{.return
+	0x20, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x70, 0x6f, 0x73, 0x65, 0x28, 0x6d, 0x61, 0x74, 0x34, 0x28, //  transpose(mat4(
+	0x5f, 0x30, 0x2c, 0x20, 0x5f, 0x31, 0x2c, 0x20, 0x5f, 0x32, 0x2c, 0x20, 0x5f, 0x33, 0x29, 0x20, // _0, _1, _2, _3) 
+	0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x6d, 0x74, 0x78, 0x46, 0x72, 0x6f, // );.}.mat4 mtxFro
+	0x6d, 0x43, 0x6f, 0x6c, 0x73, 0x28, 0x76, 0x65, 0x63, 0x34, 0x20, 0x5f, 0x30, 0x2c, 0x20, 0x76, // mCols(vec4 _0, v
+	0x65, 0x63, 0x34, 0x20, 0x5f, 0x31, 0x2c, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x5f, 0x32, 0x2c, // ec4 _1, vec4 _2,
+	0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x5f, 0x33, 0x29, 0x0a, 0x7b, 0x0a, 0x72, 0x65, 0x74, 0x75, //  vec4 _3).{.retu
+	0x72, 0x6e, 0x20, 0x6d, 0x61, 0x74, 0x34, 0x28, 0x5f, 0x30, 0x2c, 0x20, 0x5f, 0x31, 0x2c, 0x20, // rn mat4(_0, _1, 
+	0x5f, 0x32, 0x2c, 0x20, 0x5f, 0x33, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, // _2, _3);.}.unifo
+	0x72, 0x6d, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x75, 0x5f, 0x76, 0x69, 0x65, 0x77, 0x52, 0x65, // rm vec4 u_viewRe
+	0x63, 0x74, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x76, 0x65, 0x63, 0x34, // ct;.uniform vec4
+	0x20, 0x75, 0x5f, 0x76, 0x69, 0x65, 0x77, 0x54, 0x65, 0x78, 0x65, 0x6c, 0x3b, 0x0a, 0x75, 0x6e, //  u_viewTexel;.un
+	0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x75, 0x5f, 0x76, 0x69, 0x65, // iform mat4 u_vie
+	0x77, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x6d, 0x61, 0x74, 0x34, 0x20, // w;.uniform mat4 
+	0x75, 0x5f, 0x69, 0x6e, 0x76, 0x56, 0x69, 0x65, 0x77, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, // u_invView;.unifo
+	0x72, 0x6d, 0x20, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x75, 0x5f, 0x70, 0x72, 0x6f, 0x6a, 0x3b, 0x0a, // rm mat4 u_proj;.
+	0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x75, 0x5f, 0x69, // uniform mat4 u_i
+	0x6e, 0x76, 0x50, 0x72, 0x6f, 0x6a, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, // nvProj;.uniform 
+	0x6d, 0x61, 0x74, 0x34, 0x20, 0x75, 0x5f, 0x76, 0x69, 0x65, 0x77, 0x50, 0x72, 0x6f, 0x6a, 0x3b, // mat4 u_viewProj;
+	0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x75, 0x5f, // .uniform mat4 u_
+	0x69, 0x6e, 0x76, 0x56, 0x69, 0x65, 0x77, 0x50, 0x72, 0x6f, 0x6a, 0x3b, 0x0a, 0x75, 0x6e, 0x69, // invViewProj;.uni
+	0x66, 0x6f, 0x72, 0x6d, 0x20, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x75, 0x5f, 0x6d, 0x6f, 0x64, 0x65, // form mat4 u_mode
+	0x6c, 0x5b, 0x33, 0x32, 0x5d, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x6d, // l[32];.uniform m
+	0x61, 0x74, 0x34, 0x20, 0x75, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x56, 0x69, 0x65, 0x77, 0x3b, // at4 u_modelView;
+	0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x75, 0x5f, // .uniform mat4 u_
+	0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x56, 0x69, 0x65, 0x77, 0x50, 0x72, 0x6f, 0x6a, 0x3b, 0x0a, 0x75, // modelViewProj;.u
+	0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x75, 0x5f, 0x61, 0x6c, // niform vec4 u_al
+	0x70, 0x68, 0x61, 0x52, 0x65, 0x66, 0x34, 0x3b, 0x0a, 0x6c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x28, // phaRef4;.layout(
+	0x72, 0x67, 0x62, 0x61, 0x33, 0x32, 0x66, 0x2c, 0x20, 0x62, 0x69, 0x6e, 0x64, 0x69, 0x6e, 0x67, // rgba32f, binding
+	0x3d, 0x30, 0x29, 0x20, 0x72, 0x65, 0x61, 0x64, 0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x75, 0x6e, 0x69, // =0) readonly uni
+	0x66, 0x6f, 0x72, 0x6d, 0x20, 0x69, 0x6d, 0x61, 0x67, 0x65, 0x32, 0x44, 0x20, 0x73, 0x5f, 0x69, // form image2D s_i
+	0x6e, 0x70, 0x75, 0x74, 0x3b, 0x0a, 0x6c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x28, 0x72, 0x67, 0x62, // nput;.layout(rgb
+	0x61, 0x33, 0x32, 0x66, 0x2c, 0x20, 0x62, 0x69, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x3d, 0x31, 0x29, // a32f, binding=1)
+	0x20, 0x77, 0x72, 0x69, 0x74, 0x65, 0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x75, 0x6e, 0x69, 0x66, 0x6f, //  writeonly unifo
+	0x72, 0x6d, 0x20, 0x69, 0x6d, 0x61, 0x67, 0x65, 0x32, 0x44, 0x20, 0x73, 0x5f, 0x6f, 0x75, 0x74, // rm image2D s_out
+	0x70, 0x75, 0x74, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x76, 0x65, 0x63, // put;.uniform vec
+	0x34, 0x20, 0x75, 0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x3b, 0x0a, 0x76, 0x65, // 4 u_settings;.ve
+	0x63, 0x34, 0x20, 0x6c, 0x6f, 0x61, 0x64, 0x5f, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x28, 0x69, 0x6e, // c4 load_texel(in
+	0x74, 0x20, 0x78, 0x2c, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x79, 0x2c, 0x20, 0x69, 0x6e, 0x74, 0x20, // t x, int y, int 
+	0x66, 0x6c, 0x61, 0x67, 0x73, 0x29, 0x20, 0x7b, 0x0a, 0x76, 0x65, 0x63, 0x34, 0x20, 0x74, 0x65, // flags) {.vec4 te
+	0x78, 0x65, 0x6c, 0x20, 0x3d, 0x20, 0x69, 0x6d, 0x61, 0x67, 0x65, 0x4c, 0x6f, 0x61, 0x64, 0x28, // xel = imageLoad(
+	0x73, 0x5f, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x2c, 0x20, 0x69, 0x76, 0x65, 0x63, 0x32, 0x28, 0x78, // s_input, ivec2(x
+	0x2c, 0x20, 0x79, 0x29, 0x29, 0x3b, 0x0a, 0x69, 0x66, 0x20, 0x28, 0x28, 0x66, 0x6c, 0x61, 0x67, // , y));.if ((flag
+	0x73, 0x20, 0x26, 0x20, 0x31, 0x29, 0x20, 0x21, 0x3d, 0x20, 0x30, 0x29, 0x20, 0x7b, 0x0a, 0x76, // s & 1) != 0) {.v
+	0x65, 0x63, 0x33, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x3d, 0x20, 0x63, 0x6c, 0x61, 0x6d, // ec3 value = clam
+	0x70, 0x28, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x2e, 0x72, 0x67, 0x62, 0x2c, 0x20, 0x30, 0x2e, 0x30, // p(texel.rgb, 0.0
+	0x2c, 0x20, 0x31, 0x2e, 0x30, 0x29, 0x3b, 0x0a, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x2e, 0x72, 0x67, // , 1.0);.texel.rg
+	0x62, 0x20, 0x3d, 0x20, 0x6d, 0x69, 0x78, 0x28, 0x70, 0x6f, 0x77, 0x28, 0x28, 0x76, 0x61, 0x6c, // b = mix(pow((val
+	0x75, 0x65, 0x20, 0x2b, 0x20, 0x30, 0x2e, 0x30, 0x35, 0x35, 0x29, 0x20, 0x2f, 0x20, 0x31, 0x2e, // ue + 0.055) / 1.
+	0x30, 0x35, 0x35, 0x2c, 0x20, 0x76, 0x65, 0x63, 0x33, 0x5f, 0x73, 0x70, 0x6c, 0x61, 0x74, 0x28, // 055, vec3_splat(
+	0x32, 0x2e, 0x34, 0x29, 0x29, 0x2c, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2f, 0x20, 0x31, // 2.4)), value / 1
+	0x32, 0x2e, 0x39, 0x32, 0x2c, 0x20, 0x73, 0x74, 0x65, 0x70, 0x28, 0x76, 0x61, 0x6c, 0x75, 0x65, // 2.92, step(value
+	0x2c, 0x20, 0x76, 0x65, 0x63, 0x33, 0x5f, 0x73, 0x70, 0x6c, 0x61, 0x74, 0x28, 0x30, 0x2e, 0x30, // , vec3_splat(0.0
+	0x34, 0x30, 0x34, 0x35, 0x29, 0x29, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x69, 0x66, 0x20, 0x28, 0x28, // 4045)));.}.if ((
+	0x66, 0x6c, 0x61, 0x67, 0x73, 0x20, 0x26, 0x20, 0x32, 0x29, 0x20, 0x21, 0x3d, 0x20, 0x30, 0x29, // flags & 2) != 0)
+	0x20, 0x7b, 0x0a, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x72, 0x6f, 0x75, 0x67, 0x68, 0x6e, 0x65, //  {.float roughne
+	0x73, 0x73, 0x20, 0x3d, 0x20, 0x63, 0x6c, 0x61, 0x6d, 0x70, 0x28, 0x74, 0x65, 0x78, 0x65, 0x6c, // ss = clamp(texel
+	0x2e, 0x61, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x2c, 0x20, 0x31, 0x2e, 0x30, 0x29, 0x3b, 0x0a, 0x74, // .a, 0.0, 1.0);.t
+	0x65, 0x78, 0x65, 0x6c, 0x2e, 0x61, 0x20, 0x3d, 0x20, 0x28, 0x72, 0x6f, 0x75, 0x67, 0x68, 0x6e, // exel.a = (roughn
+	0x65, 0x73, 0x73, 0x20, 0x2a, 0x20, 0x72, 0x6f, 0x75, 0x67, 0x68, 0x6e, 0x65, 0x73, 0x73, 0x29, // ess * roughness)
+	0x20, 0x2a, 0x20, 0x28, 0x72, 0x6f, 0x75, 0x67, 0x68, 0x6e, 0x65, 0x73, 0x73, 0x20, 0x2a, 0x20, //  * (roughness * 
+	0x72, 0x6f, 0x75, 0x67, 0x68, 0x6e, 0x65, 0x73, 0x73, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x72, 0x65, // roughness);.}.re
+	0x74, 0x75, 0x72, 0x6e, 0x20, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x3b, 0x0a, 0x7d, 0x0a, 0x6c, 0x61, // turn texel;.}.la
+	0x79, 0x6f, 0x75, 0x74, 0x20, 0x28, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x73, 0x69, 0x7a, 0x65, // yout (local_size
+	0x5f, 0x78, 0x20, 0x3d, 0x20, 0x38, 0x2c, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x73, 0x69, // _x = 8, local_si
+	0x7a, 0x65, 0x5f, 0x79, 0x20, 0x3d, 0x20, 0x38, 0x2c, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x5f, // ze_y = 8, local_
+	0x73, 0x69, 0x7a, 0x65, 0x5f, 0x7a, 0x20, 0x3d, 0x20, 0x31, 0x29, 0x20, 0x69, 0x6e, 0x3b, 0x0a, // size_z = 1) in;.
+	0x76, 0x6f, 0x69, 0x64, 0x20, 0x6d, 0x61, 0x69, 0x6e, 0x28, 0x29, 0x20, 0x7b, 0x0a, 0x69, 0x6e, // void main() {.in
+	0x74, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x3d, 0x20, // t input_width = 
+	0x69, 0x6e, 0x74, 0x28, 0x75, 0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x78, // int(u_settings.x
+	0x29, 0x3b, 0x0a, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x5f, 0x68, 0x65, 0x69, // );.int input_hei
+	0x67, 0x68, 0x74, 0x20, 0x3d, 0x20, 0x69, 0x6e, 0x74, 0x28, 0x75, 0x5f, 0x73, 0x65, 0x74, 0x74, // ght = int(u_sett
+	0x69, 0x6e, 0x67, 0x73, 0x2e, 0x79, 0x29, 0x3b, 0x0a, 0x69, 0x76, 0x65, 0x63, 0x32, 0x20, 0x74, // ings.y);.ivec2 t
+	0x65, 0x78, 0x65, 0x6c, 0x20, 0x3d, 0x20, 0x69, 0x76, 0x65, 0x63, 0x32, 0x28, 0x67, 0x6c, 0x5f, // exel = ivec2(gl_
+	0x47, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x49, 0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, // GlobalInvocation
+	0x49, 0x44, 0x2e, 0x78, 0x79, 0x29, 0x3b, 0x0a, 0x69, 0x66, 0x20, 0x28, 0x74, 0x65, 0x78, 0x65, // ID.xy);.if (texe
+	0x6c, 0x2e, 0x78, 0x20, 0x3e, 0x3d, 0x20, 0x6d, 0x61, 0x78, 0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, // l.x >= max(input
+	0x5f, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x2f, 0x20, 0x32, 0x2c, 0x20, 0x31, 0x29, 0x20, 0x7c, // _width / 2, 1) |
+	0x7c, 0x20, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x2e, 0x79, 0x20, 0x3e, 0x3d, 0x20, 0x6d, 0x61, 0x78, // | texel.y >= max
+	0x28, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x5f, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x20, 0x2f, 0x20, // (input_height / 
+	0x32, 0x2c, 0x20, 0x31, 0x29, 0x29, 0x20, 0x7b, 0x0a, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x3b, // 2, 1)) {.return;
+	0x0a, 0x7d, 0x0a, 0x69, 0x6e, 0x74, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x20, 0x3d, 0x20, 0x69, // .}.int flags = i
+	0x6e, 0x74, 0x28, 0x75, 0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x7a, 0x29, // nt(u_settings.z)
+	0x3b, 0x0a, 0x69, 0x6e, 0x74, 0x20, 0x78, 0x30, 0x20, 0x3d, 0x20, 0x6d, 0x69, 0x6e, 0x28, 0x74, // ;.int x0 = min(t
+	0x65, 0x78, 0x65, 0x6c, 0x2e, 0x78, 0x20, 0x2a, 0x20, 0x32, 0x2c, 0x20, 0x69, 0x6e, 0x70, 0x75, // exel.x * 2, inpu
+	0x74, 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x2d, 0x20, 0x31, 0x29, 0x3b, 0x0a, 0x69, 0x6e, // t_width - 1);.in
+	0x74, 0x20, 0x78, 0x31, 0x20, 0x3d, 0x20, 0x6d, 0x69, 0x6e, 0x28, 0x74, 0x65, 0x78, 0x65, 0x6c, // t x1 = min(texel
+	0x2e, 0x78, 0x20, 0x2a, 0x20, 0x32, 0x20, 0x2b, 0x20, 0x31, 0x2c, 0x20, 0x69, 0x6e, 0x70, 0x75, // .x * 2 + 1, inpu
+	0x74, 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x2d, 0x20, 0x31, 0x29, 0x3b, 0x0a, 0x69, 0x6e, // t_width - 1);.in
+	0x74, 0x20, 0x79, 0x30, 0x20, 0x3d, 0x20, 0x6d, 0x69, 0x6e, 0x28, 0x74, 0x65, 0x78, 0x65, 0x6c, // t y0 = min(texel
+	0x2e, 0x79, 0x20, 0x2a, 0x20, 0x32, 0x2c, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x5f, 0x68, 0x65, // .y * 2, input_he
+	0x69, 0x67, 0x68, 0x74, 0x20, 0x2d, 0x20, 0x31, 0x29, 0x3b, 0x0a, 0x69, 0x6e, 0x74, 0x20, 0x79, // ight - 1);.int y
+	0x31, 0x20, 0x3d, 0x20, 0x6d, 0x69, 0x6e, 0x28, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x2e, 0x79, 0x20, // 1 = min(texel.y 
+	0x2a, 0x20, 0x32, 0x20, 0x2b, 0x20, 0x31, 0x2c, 0x20, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x5f, 0x68, // * 2 + 1, input_h
+	0x65, 0x69, 0x67, 0x68, 0x74, 0x20, 0x2d, 0x20, 0x31, 0x29, 0x3b, 0x0a, 0x76, 0x65, 0x63, 0x34, // eight - 1);.vec4
+	0x20, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x20, 0x3d, 0x20, 0x28, 0x6c, 0x6f, 0x61, 0x64, 0x5f, //  result = (load_
+	0x74, 0x65, 0x78, 0x65, 0x6c, 0x28, 0x78, 0x30, 0x2c, 0x20, 0x79, 0x30, 0x2c, 0x20, 0x66, 0x6c, // texel(x0, y0, fl
+	0x61, 0x67, 0x73, 0x29, 0x20, 0x2b, 0x20, 0x6c, 0x6f, 0x61, 0x64, 0x5f, 0x74, 0x65, 0x78, 0x65, // ags) + load_texe
+	0x6c, 0x28, 0x78, 0x31, 0x2c, 0x20, 0x79, 0x30, 0x2c, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x29, // l(x1, y0, flags)
+	0x20, 0x2b, 0x20, 0x6c, 0x6f, 0x61, 0x64, 0x5f, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x28, 0x78, 0x30, //  + load_texel(x0
+	0x2c, 0x20, 0x79, 0x31, 0x2c, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x29, 0x20, 0x2b, 0x20, 0x6c, // , y1, flags) + l
+	0x6f, 0x61, 0x64, 0x5f, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x28, 0x78, 0x31, 0x2c, 0x20, 0x79, 0x31, // oad_texel(x1, y1
+	0x2c, 0x20, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x29, 0x29, 0x20, 0x2a, 0x20, 0x30, 0x2e, 0x32, 0x35, // , flags)) * 0.25
+	0x3b, 0x0a, 0x69, 0x66, 0x20, 0x28, 0x28, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x20, 0x26, 0x20, 0x31, // ;.if ((flags & 1
+	0x29, 0x20, 0x21, 0x3d, 0x20, 0x30, 0x29, 0x20, 0x7b, 0x0a, 0x76, 0x65, 0x63, 0x33, 0x20, 0x76, // ) != 0) {.vec3 v
+	0x61, 0x6c, 0x75, 0x65, 0x20, 0x3d, 0x20, 0x63, 0x6c, 0x61, 0x6d, 0x70, 0x28, 0x72, 0x65, 0x73, // alue = clamp(res
+	0x75, 0x6c, 0x74, 0x2e, 0x72, 0x67, 0x62, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x2c, 0x20, 0x31, 0x2e, // ult.rgb, 0.0, 1.
+	0x30, 0x29, 0x3b, 0x0a, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x2e, 0x72, 0x67, 0x62, 0x20, 0x3d, // 0);.result.rgb =
+	0x20, 0x6d, 0x69, 0x78, 0x28, 0x31, 0x2e, 0x30, 0x35, 0x35, 0x20, 0x2a, 0x20, 0x70, 0x6f, 0x77, //  mix(1.055 * pow
+	0x28, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x2c, 0x20, 0x76, 0x65, 0x63, 0x33, 0x5f, 0x73, 0x70, 0x6c, // (value, vec3_spl
+	0x61, 0x74, 0x28, 0x31, 0x2e, 0x30, 0x20, 0x2f, 0x20, 0x32, 0x2e, 0x34, 0x29, 0x29, 0x20, 0x2d, // at(1.0 / 2.4)) -
+	0x20, 0x30, 0x2e, 0x30, 0x35, 0x35, 0x2c, 0x20, 0x76, 0x61, 0x6c, 0x75, 0x65, 0x20, 0x2a, 0x20, //  0.055, value * 
+	0x31, 0x32, 0x2e, 0x39, 0x32, 0x2c, 0x20, 0x73, 0x74, 0x65, 0x70, 0x28, 0x76, 0x61, 0x6c, 0x75, // 12.92, step(valu
+	0x65, 0x2c, 0x20, 0x76, 0x65, 0x63, 0x33, 0x5f, 0x73, 0x70, 0x6c, 0x61, 0x74, 0x28, 0x30, 0x2e, // e, vec3_splat(0.
+	0x30, 0x30, 0x33, 0x31, 0x33, 0x30, 0x38, 0x29, 0x29, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x69, 0x66, // 0031308)));.}.if
+	0x20, 0x28, 0x28, 0x66, 0x6c, 0x61, 0x67, 0x73, 0x20, 0x26, 0x20, 0x32, 0x29, 0x20, 0x21, 0x3d, //  ((flags & 2) !=
+	0x20, 0x30, 0x29, 0x20, 0x7b, 0x0a, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x2e, 0x61, 0x20, 0x3d, //  0) {.result.a =
+	0x20, 0x73, 0x71, 0x72, 0x74, 0x28, 0x73, 0x71, 0x72, 0x74, 0x28, 0x63, 0x6c, 0x61, 0x6d, 0x70, //  sqrt(sqrt(clamp
+	0x28, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x2e, 0x61, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x2c, 0x20, // (result.a, 0.0, 
+	0x31, 0x2e, 0x30, 0x29, 0x29, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x69, 0x66, 0x20, 0x28, 0x28, 0x66, // 1.0)));.}.if ((f
+	0x6c, 0x61, 0x67, 0x73, 0x20, 0x26, 0x20, 0x34, 0x29, 0x20, 0x21, 0x3d, 0x20, 0x30, 0x29, 0x20, // lags & 4) != 0) 
+	0x7b, 0x0a, 0x76, 0x65, 0x63, 0x33, 0x20, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x20, 0x3d, 0x20, // {.vec3 normal = 
+	0x72, 0x65, 0x73, 0x75, 0x6c, 0x74, 0x2e, 0x72, 0x67, 0x62, 0x20, 0x2a, 0x20, 0x32, 0x2e, 0x30, // result.rgb * 2.0
+	0x20, 0x2d, 0x20, 0x31, 0x2e, 0x30, 0x3b, 0x0a, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x6c, 0x65, //  - 1.0;.float le
+	0x6e, 0x67, 0x74, 0x68, 0x5f, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x64, 0x20, 0x3d, 0x20, 0x64, // ngth_squared = d
+	0x6f, 0x74, 0x28, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x2c, 0x20, 0x6e, 0x6f, 0x72, 0x6d, 0x61, // ot(normal, norma
+	0x6c, 0x29, 0x3b, 0x0a, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x20, 0x3d, 0x20, 0x6c, 0x65, 0x6e, // l);.normal = len
+	0x67, 0x74, 0x68, 0x5f, 0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x64, 0x20, 0x3e, 0x20, 0x30, 0x2e, // gth_squared > 0.
+	0x30, 0x20, 0x3f, 0x20, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x20, 0x2a, 0x20, 0x69, 0x6e, 0x76, // 0 ? normal * inv
+	0x65, 0x72, 0x73, 0x65, 0x73, 0x71, 0x72, 0x74, 0x28, 0x6c, 0x65, 0x6e, 0x67, 0x74, 0x68, 0x5f, // ersesqrt(length_
+	0x73, 0x71, 0x75, 0x61, 0x72, 0x65, 0x64, 0x29, 0x20, 0x3a, 0x20, 0x76, 0x65, 0x63, 0x33, 0x5f, // squared) : vec3_
+	0x73, 0x70, 0x6c, 0x61, 0x74, 0x28, 0x30, 0x2e, 0x30, 0x29, 0x3b, 0x0a, 0x72, 0x65, 0x73, 0x75, // splat(0.0);.resu
+	0x6c, 0x74, 0x2e, 0x72, 0x67, 0x62, 0x20, 0x3d, 0x20, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x20, // lt.rgb = normal 
+	0x2a, 0x20, 0x30, 0x2e, 0x35, 0x20, 0x2b, 0x20, 0x30, 0x2e, 0x35, 0x3b, 0x0a, 0x7d, 0x0a, 0x69, // * 0.5 + 0.5;.}.i
+	0x6d, 0x61, 0x67, 0x65, 0x53, 0x74, 0x6f, 0x72, 0x65, 0x28, 0x73, 0x5f, 0x6f, 0x75, 0x74, 0x70, // mageStore(s_outp
+	0x75, 0x74, 0x2c, 0x20, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x2c, 0x20, 0x72, 0x65, 0x73, 0x75, 0x6c, // ut, texel, resul
+	0x74, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x00,                                                       // t);.}..
+};
+
+static const uint8_t mip_shader_compute_spv[6221] =
+{
+	0x43, 0x53, 0x48, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x0a, 0x75, // CSH............u
+	0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x02, 0x01, 0x00, 0x00, 0x01, 0x00, 0x07, // _settings.......
+	0x73, 0x5f, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, // s_input.........
+	0x00, 0x03, 0x02, 0x23, 0x07, 0x00, 0x00, 0x01, 0x00, 0x07, 0x00, 0x08, 0x00, 0xb3, 0x03, 0x00, // ...#............
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x06, // ................
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x47, 0x4c, 0x53, 0x4c, 0x2e, 0x73, 0x74, 0x64, 0x2e, 0x34, 0x35, // .....GLSL.std.45
+	0x30, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, // 0...............
+	0x00, 0x0f, 0x00, 0x06, 0x00, 0x05, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, // .............mai
+	0x6e, 0x00, 0x00, 0x00, 0x00, 0x61, 0x01, 0x00, 0x00, 0x10, 0x00, 0x06, 0x00, 0x04, 0x00, 0x00, // n....a..........
+	0x00, 0x11, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, // ................
+	0x00, 0x03, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x00, 0xf4, 0x01, 0x00, 0x00, 0x05, 0x00, 0x04, // ................
+	0x00, 0x04, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x06, // .....main.......
+	0x00, 0x3a, 0x00, 0x00, 0x00, 0x73, 0x5f, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x54, 0x65, 0x78, 0x74, // .:...s_inputText
+	0x75, 0x72, 0x65, 0x00, 0x00, 0x05, 0x00, 0x06, 0x00, 0x40, 0x00, 0x00, 0x00, 0x73, 0x5f, 0x6f, // ure......@...s_o
+	0x75, 0x74, 0x70, 0x75, 0x74, 0x54, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x00, 0x05, 0x00, 0x04, // utputTexture....
+	0x00, 0xa7, 0x00, 0x00, 0x00, 0x24, 0x47, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x00, 0x06, 0x00, 0x06, // .....$Global....
+	0x00, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x75, 0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, // .........u_setti
+	0x6e, 0x67, 0x73, 0x00, 0x00, 0x05, 0x00, 0x03, 0x00, 0xa9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // ngs.............
+	0x00, 0x05, 0x00, 0x08, 0x00, 0x61, 0x01, 0x00, 0x00, 0x67, 0x6c, 0x5f, 0x47, 0x6c, 0x6f, 0x62, // .....a...gl_Glob
+	0x61, 0x6c, 0x49, 0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x49, 0x44, 0x00, 0x00, // alInvocationID..
+	0x00, 0x47, 0x00, 0x04, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // .G...:..."......
+	0x00, 0x47, 0x00, 0x04, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // .G...:...!......
+	0x00, 0x47, 0x00, 0x04, 0x00, 0x40, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // .G...@..."......
+	0x00, 0x47, 0x00, 0x04, 0x00, 0x40, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, // .G...@...!......
+	0x00, 0x48, 0x00, 0x05, 0x00, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, // .H...........#..
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00, 0xa7, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, // .....G..........
+	0x00, 0x47, 0x00, 0x04, 0x00, 0xa9, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // .G......."......
+	0x00, 0x47, 0x00, 0x04, 0x00, 0xa9, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // .G.......!......
+	0x00, 0x47, 0x00, 0x04, 0x00, 0x61, 0x01, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, // .G...a..........
+	0x00, 0x13, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x21, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, // .........!......
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x16, 0x00, 0x03, 0x00, 0x06, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, // ............. ..
+	0x00, 0x17, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, // ................
+	0x00, 0x19, 0x00, 0x09, 0x00, 0x14, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, // ................
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, // ................
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x00, 0x04, 0x00, 0x17, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, // ............. ..
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00, 0x18, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, // ................
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, // ................
+	0x00, 0x04, 0x00, 0x00, 0x00, 0x19, 0x00, 0x09, 0x00, 0x20, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, // ......... ......
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // ................
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00, 0x31, 0x00, 0x00, // .............1..
+	0x00, 0x17, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x39, 0x00, 0x00, // ......... ...9..
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x39, 0x00, 0x00, // .........;...9..
+	0x00, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x3f, 0x00, 0x00, // .:....... ...?..
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x3f, 0x00, 0x00, // ..... ...;...?..
+	0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x17, 0x00, 0x00, // .@.......+......
+	0x00, 0x4f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x17, 0x00, 0x00, // .O.......+......
+	0x00, 0x67, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x14, 0x00, 0x02, 0x00, 0x69, 0x00, 0x00, // .g...........i..
+	0x00, 0x2b, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // .+.......p......
+	0x00, 0x2c, 0x00, 0x06, 0x00, 0x07, 0x00, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, // .,.......q...p..
+	0x00, 0x70, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, // .p...p...+......
+	0x00, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x2c, 0x00, 0x06, 0x00, 0x07, 0x00, 0x00, // .r......?,......
+	0x00, 0x73, 0x00, 0x00, 0x00, 0x72, 0x00, 0x00, 0x00, 0x72, 0x00, 0x00, 0x00, 0x72, 0x00, 0x00, // .s...r...r...r..
+	0x00, 0x2b, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0xae, 0x47, 0x61, // .+.......v....Ga
+	0x3d, 0x2b, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 0x3d, 0x0a, 0x87, // =+.......y...=..
+	0x3f, 0x2b, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x9a, 0x99, 0x19, // ?+.......|......
+	0x40, 0x2b, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x52, 0xb8, 0x4e, // @+...........R.N
+	0x41, 0x2b, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0xe6, 0xae, 0x25, // A+.............%
+	0x3d, 0x2b, 0x00, 0x04, 0x00, 0x17, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, // =+..............
+	0x00, 0x15, 0x00, 0x04, 0x00, 0x96, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // ......... ......
+	0x00, 0x1e, 0x00, 0x03, 0x00, 0xa7, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, // ............. ..
+	0x00, 0xa8, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, // .............;..
+	0x00, 0xa8, 0x00, 0x00, 0x00, 0xa9, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, // .............+..
+	0x00, 0x96, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, // ............. ..
+	0x00, 0xab, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, // .............+..
+	0x00, 0x96, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, // .............+..
+	0x00, 0x96, 0x00, 0x00, 0x00, 0xc8, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, // .............+..
+	0x00, 0x06, 0x00, 0x00, 0x00, 0x0a, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3e, 0x2b, 0x00, 0x04, // ............>+..
+	0x00, 0x06, 0x00, 0x00, 0x00, 0x16, 0x01, 0x00, 0x00, 0x55, 0x55, 0xd5, 0x3e, 0x2b, 0x00, 0x04, // .........UU.>+..
+	0x00, 0x06, 0x00, 0x00, 0x00, 0x20, 0x01, 0x00, 0x00, 0x1c, 0x2e, 0x4d, 0x3b, 0x2b, 0x00, 0x04, // ..... .....M;+..
+	0x00, 0x17, 0x00, 0x00, 0x00, 0x36, 0x01, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, // .....6.......+..
+	0x00, 0x06, 0x00, 0x00, 0x00, 0x3e, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x17, 0x00, 0x04, // .....>......@...
+	0x00, 0x4e, 0x01, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, // .N...i.......+..
+	0x00, 0x06, 0x00, 0x00, 0x00, 0x52, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x20, 0x00, 0x04, // .....R......? ..
+	0x00, 0x60, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, // .`.......1...;..
+	0x00, 0x60, 0x01, 0x00, 0x00, 0x61, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x06, // .`...a.......,..
+	0x00, 0x07, 0x00, 0x00, 0x00, 0x9c, 0x03, 0x00, 0x00, 0x76, 0x00, 0x00, 0x00, 0x76, 0x00, 0x00, // .........v...v..
+	0x00, 0x76, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x9e, 0x03, 0x00, // .v...+..........
+	0x00, 0x6f, 0xa7, 0x72, 0x3f, 0x2c, 0x00, 0x06, 0x00, 0x07, 0x00, 0x00, 0x00, 0x9f, 0x03, 0x00, // .o.r?,..........
+	0x00, 0x9e, 0x03, 0x00, 0x00, 0x9e, 0x03, 0x00, 0x00, 0x9e, 0x03, 0x00, 0x00, 0x2c, 0x00, 0x06, // .............,..
+	0x00, 0x07, 0x00, 0x00, 0x00, 0xa0, 0x03, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, // .........|...|..
+	0x00, 0x7c, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0xa2, 0x03, 0x00, // .|...+..........
+	0x00, 0x91, 0x83, 0x9e, 0x3d, 0x2c, 0x00, 0x06, 0x00, 0x07, 0x00, 0x00, 0x00, 0xa3, 0x03, 0x00, // ....=,..........
+	0x00, 0xa2, 0x03, 0x00, 0x00, 0xa2, 0x03, 0x00, 0x00, 0xa2, 0x03, 0x00, 0x00, 0x2c, 0x00, 0x06, // .............,..
+	0x00, 0x07, 0x00, 0x00, 0x00, 0xa4, 0x03, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, // ................
+	0x00, 0x85, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x06, 0x00, 0x07, 0x00, 0x00, 0x00, 0xa5, 0x03, 0x00, // .....,..........
+	0x00, 0x16, 0x01, 0x00, 0x00, 0x16, 0x01, 0x00, 0x00, 0x16, 0x01, 0x00, 0x00, 0x2c, 0x00, 0x06, // .............,..
+	0x00, 0x07, 0x00, 0x00, 0x00, 0xa6, 0x03, 0x00, 0x00, 0x20, 0x01, 0x00, 0x00, 0x20, 0x01, 0x00, // ......... ... ..
+	0x00, 0x20, 0x01, 0x00, 0x00, 0x2c, 0x00, 0x06, 0x00, 0x07, 0x00, 0x00, 0x00, 0xa7, 0x03, 0x00, // . ...,..........
+	0x00, 0x52, 0x01, 0x00, 0x00, 0x52, 0x01, 0x00, 0x00, 0x52, 0x01, 0x00, 0x00, 0x36, 0x00, 0x05, // .R...R...R...6..
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, // ................
+	0x00, 0xf8, 0x00, 0x02, 0x00, 0x05, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x14, 0x00, 0x00, // .........=......
+	0x00, 0x3b, 0x00, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x20, 0x00, 0x00, // .;...:...=... ..
+	0x00, 0x41, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x31, 0x00, 0x00, // .A...@...=...1..
+	0x00, 0x62, 0x01, 0x00, 0x00, 0x61, 0x01, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0xa2, 0x01, 0x00, // .b...a..........
+	0x00, 0xf8, 0x00, 0x02, 0x00, 0xa2, 0x01, 0x00, 0x00, 0xf6, 0x00, 0x04, 0x00, 0xa3, 0x01, 0x00, // ................
+	0x00, 0xa4, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0xa5, 0x01, 0x00, // ................
+	0x00, 0xf8, 0x00, 0x02, 0x00, 0xa5, 0x01, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00, 0xab, 0x00, 0x00, // .........A......
+	0x00, 0xa6, 0x01, 0x00, 0x00, 0xa9, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, // .........O......
+	0x00, 0x3d, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0xa7, 0x01, 0x00, 0x00, 0xa6, 0x01, 0x00, // .=..............
+	0x00, 0x6e, 0x00, 0x04, 0x00, 0x17, 0x00, 0x00, 0x00, 0xa8, 0x01, 0x00, 0x00, 0xa7, 0x01, 0x00, // .n..............
+	0x00, 0x41, 0x00, 0x06, 0x00, 0xab, 0x00, 0x00, 0x00, 0xa9, 0x01, 0x00, 0x00, 0xa9, 0x00, 0x00, // .A..............
+	0x00, 0x4f, 0x00, 0x00, 0x00, 0xb0, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, // .O.......=......
+	0x00, 0xaa, 0x01, 0x00, 0x00, 0xa9, 0x01, 0x00, 0x00, 0x6e, 0x00, 0x04, 0x00, 0x17, 0x00, 0x00, // .........n......
+	0x00, 0xab, 0x01, 0x00, 0x00, 0xaa, 0x01, 0x00, 0x00, 0x4f, 0x00, 0x07, 0x00, 0x18, 0x00, 0x00, // .........O......
+	0x00, 0xad, 0x01, 0x00, 0x00, 0x62, 0x01, 0x00, 0x00, 0x62, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, // .....b...b......
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x17, 0x00, 0x00, 0x00, 0xaf, 0x01, 0x00, // .....Q..........
+	0x00, 0x62, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x00, 0x05, 0x00, 0x17, 0x00, 0x00, // .b..............
+	0x00, 0xb1, 0x01, 0x00, 0x00, 0xa8, 0x01, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x07, // ................
+	0x00, 0x17, 0x00, 0x00, 0x00, 0xb2, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, // .............*..
+	0x00, 0xb1, 0x01, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0xaf, 0x00, 0x05, 0x00, 0x69, 0x00, 0x00, // .....g.......i..
+	0x00, 0xb3, 0x01, 0x00, 0x00, 0xaf, 0x01, 0x00, 0x00, 0xb2, 0x01, 0x00, 0x00, 0x51, 0x00, 0x05, // .............Q..
+	0x00, 0x17, 0x00, 0x00, 0x00, 0xb5, 0x01, 0x00, 0x00, 0x62, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, // .........b......
+	0x00, 0x87, 0x00, 0x05, 0x00, 0x17, 0x00, 0x00, 0x00, 0xb7, 0x01, 0x00, 0x00, 0xab, 0x01, 0x00, // ................
+	0x00, 0x90, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x07, 0x00, 0x17, 0x00, 0x00, 0x00, 0xb8, 0x01, 0x00, // ................
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0xb7, 0x01, 0x00, 0x00, 0x67, 0x00, 0x00, // .....*.......g..
+	0x00, 0xaf, 0x00, 0x05, 0x00, 0x69, 0x00, 0x00, 0x00, 0xb9, 0x01, 0x00, 0x00, 0xb5, 0x01, 0x00, // .....i..........
+	0x00, 0xb8, 0x01, 0x00, 0x00, 0xa6, 0x00, 0x05, 0x00, 0x69, 0x00, 0x00, 0x00, 0xba, 0x01, 0x00, // .........i......
+	0x00, 0xb3, 0x01, 0x00, 0x00, 0xb9, 0x01, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0xbb, 0x01, 0x00, // ................
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0xba, 0x01, 0x00, 0x00, 0xbc, 0x01, 0x00, // ................
+	0x00, 0xbb, 0x01, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xbc, 0x01, 0x00, 0x00, 0xf9, 0x00, 0x02, // ................
+	0x00, 0xa3, 0x01, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xbb, 0x01, 0x00, 0x00, 0x41, 0x00, 0x06, // .............A..
+	0x00, 0xab, 0x00, 0x00, 0x00, 0xbd, 0x01, 0x00, 0x00, 0xa9, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x00, // .............O..
+	0x00, 0xc8, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0xbe, 0x01, 0x00, // .....=..........
+	0x00, 0xbd, 0x01, 0x00, 0x00, 0x6e, 0x00, 0x04, 0x00, 0x17, 0x00, 0x00, 0x00, 0xbf, 0x01, 0x00, // .....n..........
+	0x00, 0xbe, 0x01, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x17, 0x00, 0x00, 0x00, 0xc1, 0x01, 0x00, // .....Q..........
+	0x00, 0x62, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x17, 0x00, 0x00, // .b..............
+	0x00, 0xc2, 0x01, 0x00, 0x00, 0xc1, 0x01, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x82, 0x00, 0x05, // ................
+	0x00, 0x17, 0x00, 0x00, 0x00, 0xc4, 0x01, 0x00, 0x00, 0xa8, 0x01, 0x00, 0x00, 0x67, 0x00, 0x00, // .............g..
+	0x00, 0x0c, 0x00, 0x07, 0x00, 0x17, 0x00, 0x00, 0x00, 0xc5, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, // ................
+	0x00, 0x27, 0x00, 0x00, 0x00, 0xc2, 0x01, 0x00, 0x00, 0xc4, 0x01, 0x00, 0x00, 0x51, 0x00, 0x05, // .'...........Q..
+	0x00, 0x17, 0x00, 0x00, 0x00, 0xc7, 0x01, 0x00, 0x00, 0x62, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, // .........b......
+	0x00, 0x84, 0x00, 0x05, 0x00, 0x17, 0x00, 0x00, 0x00, 0xc8, 0x01, 0x00, 0x00, 0xc7, 0x01, 0x00, // ................
+	0x00, 0x90, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x17, 0x00, 0x00, 0x00, 0xc9, 0x01, 0x00, // ................
+	0x00, 0xc8, 0x01, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x82, 0x00, 0x05, 0x00, 0x17, 0x00, 0x00, // .....g..........
+	0x00, 0xcb, 0x01, 0x00, 0x00, 0xa8, 0x01, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x07, // .........g......
+	0x00, 0x17, 0x00, 0x00, 0x00, 0xcc, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, // .............'..
+	0x00, 0xc9, 0x01, 0x00, 0x00, 0xcb, 0x01, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x17, 0x00, 0x00, // .........Q......
+	0x00, 0xce, 0x01, 0x00, 0x00, 0x62, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x84, 0x00, 0x05, // .....b..........
+	0x00, 0x17, 0x00, 0x00, 0x00, 0xcf, 0x01, 0x00, 0x00, 0xce, 0x01, 0x00, 0x00, 0x90, 0x00, 0x00, // ................
+	0x00, 0x82, 0x00, 0x05, 0x00, 0x17, 0x00, 0x00, 0x00, 0xd1, 0x01, 0x00, 0x00, 0xab, 0x01, 0x00, // ................
+	0x00, 0x67, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x07, 0x00, 0x17, 0x00, 0x00, 0x00, 0xd2, 0x01, 0x00, // .g..............
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x27, 0x00, 0x00, 0x00, 0xcf, 0x01, 0x00, 0x00, 0xd1, 0x01, 0x00, // .....'..........
+	0x00, 0x51, 0x00, 0x05, 0x00, 0x17, 0x00, 0x00, 0x00, 0xd4, 0x01, 0x00, 0x00, 0x62, 0x01, 0x00, // .Q...........b..
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x84, 0x00, 0x05, 0x00, 0x17, 0x00, 0x00, 0x00, 0xd5, 0x01, 0x00, // ................
+	0x00, 0xd4, 0x01, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x17, 0x00, 0x00, // ................
+	0x00, 0xd6, 0x01, 0x00, 0x00, 0xd5, 0x01, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0x82, 0x00, 0x05, // .........g......
+	0x00, 0x17, 0x00, 0x00, 0x00, 0xd8, 0x01, 0x00, 0x00, 0xab, 0x01, 0x00, 0x00, 0x67, 0x00, 0x00, // .............g..
+	0x00, 0x0c, 0x00, 0x07, 0x00, 0x17, 0x00, 0x00, 0x00, 0xd9, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, // ................
+	0x00, 0x27, 0x00, 0x00, 0x00, 0xd6, 0x01, 0x00, 0x00, 0xd8, 0x01, 0x00, 0x00, 0x50, 0x00, 0x05, // .'...........P..
+	0x00, 0x18, 0x00, 0x00, 0x00, 0x3c, 0x02, 0x00, 0x00, 0xc5, 0x01, 0x00, 0x00, 0xd2, 0x01, 0x00, // .....<..........
+	0x00, 0x5f, 0x00, 0x07, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x6c, 0x02, 0x00, 0x00, 0x3b, 0x00, 0x00, // ._.......l...;..
+	0x00, 0x3c, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x00, 0xc7, 0x00, 0x05, // .<.......O......
+	0x00, 0x17, 0x00, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0xbf, 0x01, 0x00, 0x00, 0x67, 0x00, 0x00, // .....@.......g..
+	0x00, 0xab, 0x00, 0x05, 0x00, 0x69, 0x00, 0x00, 0x00, 0x41, 0x02, 0x00, 0x00, 0x40, 0x02, 0x00, // .....i...A...@..
+	0x00, 0x4f, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0x42, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, // .O.......B......
+	0x00, 0xfa, 0x00, 0x04, 0x00, 0x41, 0x02, 0x00, 0x00, 0x43, 0x02, 0x00, 0x00, 0x42, 0x02, 0x00, // .....A...C...B..
+	0x00, 0xf8, 0x00, 0x02, 0x00, 0x43, 0x02, 0x00, 0x00, 0x4f, 0x00, 0x08, 0x00, 0x07, 0x00, 0x00, // .....C...O......
+	0x00, 0x45, 0x02, 0x00, 0x00, 0x6c, 0x02, 0x00, 0x00, 0x6c, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, // .E...l...l......
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x07, 0x00, 0x00, // ................
+	0x00, 0x46, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x45, 0x02, 0x00, // .F.......+...E..
+	0x00, 0x71, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, // .q...s..........
+	0x00, 0x49, 0x02, 0x00, 0x00, 0x46, 0x02, 0x00, 0x00, 0x9c, 0x03, 0x00, 0x00, 0x85, 0x00, 0x05, // .I...F..........
+	0x00, 0x07, 0x00, 0x00, 0x00, 0x4b, 0x02, 0x00, 0x00, 0x49, 0x02, 0x00, 0x00, 0x9f, 0x03, 0x00, // .....K...I......
+	0x00, 0x0c, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x4d, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, // .........M......
+	0x00, 0x1a, 0x00, 0x00, 0x00, 0x4b, 0x02, 0x00, 0x00, 0xa0, 0x03, 0x00, 0x00, 0x85, 0x00, 0x05, // .....K..........
+	0x00, 0x07, 0x00, 0x00, 0x00, 0x50, 0x02, 0x00, 0x00, 0x46, 0x02, 0x00, 0x00, 0xa3, 0x03, 0x00, // .....P...F......
+	0x00, 0x0c, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x53, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, // .........S......
+	0x00, 0x30, 0x00, 0x00, 0x00, 0x46, 0x02, 0x00, 0x00, 0xa4, 0x03, 0x00, 0x00, 0x0c, 0x00, 0x08, // .0...F..........
+	0x00, 0x07, 0x00, 0x00, 0x00, 0x7b, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, // .....{..........
+	0x00, 0x4d, 0x02, 0x00, 0x00, 0x50, 0x02, 0x00, 0x00, 0x53, 0x02, 0x00, 0x00, 0x4f, 0x00, 0x09, // .M...P...S...O..
+	0x00, 0x1a, 0x00, 0x00, 0x00, 0x56, 0x02, 0x00, 0x00, 0x6c, 0x02, 0x00, 0x00, 0x7b, 0x02, 0x00, // .....V...l...{..
+	0x00, 0x04, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, // ................
+	0x00, 0xf9, 0x00, 0x02, 0x00, 0x42, 0x02, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x42, 0x02, 0x00, // .....B.......B..
+	0x00, 0xf5, 0x00, 0x07, 0x00, 0x1a, 0x00, 0x00, 0x00, 0xa8, 0x03, 0x00, 0x00, 0x6c, 0x02, 0x00, // .............l..
+	0x00, 0xbb, 0x01, 0x00, 0x00, 0x56, 0x02, 0x00, 0x00, 0x43, 0x02, 0x00, 0x00, 0xc7, 0x00, 0x05, // .....V...C......
+	0x00, 0x17, 0x00, 0x00, 0x00, 0x58, 0x02, 0x00, 0x00, 0xbf, 0x01, 0x00, 0x00, 0x90, 0x00, 0x00, // .....X..........
+	0x00, 0xab, 0x00, 0x05, 0x00, 0x69, 0x00, 0x00, 0x00, 0x59, 0x02, 0x00, 0x00, 0x58, 0x02, 0x00, // .....i...Y...X..
+	0x00, 0x4f, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0x5a, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, // .O.......Z......
+	0x00, 0xfa, 0x00, 0x04, 0x00, 0x59, 0x02, 0x00, 0x00, 0x5b, 0x02, 0x00, 0x00, 0x5a, 0x02, 0x00, // .....Y...[...Z..
+	0x00, 0xf8, 0x00, 0x02, 0x00, 0x5b, 0x02, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, // .....[...Q......
+	0x00, 0x5d, 0x02, 0x00, 0x00, 0xa8, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x08, // .]..............
+	0x00, 0x06, 0x00, 0x00, 0x00, 0x5e, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, // .....^.......+..
+	0x00, 0x5d, 0x02, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x72, 0x00, 0x00, 0x00, 0x85, 0x00, 0x05, // .]...p...r......
+	0x00, 0x06, 0x00, 0x00, 0x00, 0x61, 0x02, 0x00, 0x00, 0x5e, 0x02, 0x00, 0x00, 0x5e, 0x02, 0x00, // .....a...^...^..
+	0x00, 0x85, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x64, 0x02, 0x00, 0x00, 0x5e, 0x02, 0x00, // .........d...^..
+	0x00, 0x5e, 0x02, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x65, 0x02, 0x00, // .^...........e..
+	0x00, 0x61, 0x02, 0x00, 0x00, 0x64, 0x02, 0x00, 0x00, 0x52, 0x00, 0x06, 0x00, 0x1a, 0x00, 0x00, // .a...d...R......
+	0x00, 0x8f, 0x03, 0x00, 0x00, 0x65, 0x02, 0x00, 0x00, 0xa8, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, // .....e..........
+	0x00, 0xf9, 0x00, 0x02, 0x00, 0x5a, 0x02, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x5a, 0x02, 0x00, // .....Z.......Z..
+	0x00, 0xf5, 0x00, 0x07, 0x00, 0x1a, 0x00, 0x00, 0x00, 0xa9, 0x03, 0x00, 0x00, 0xa8, 0x03, 0x00, // ................
+	0x00, 0x42, 0x02, 0x00, 0x00, 0x8f, 0x03, 0x00, 0x00, 0x5b, 0x02, 0x00, 0x00, 0x50, 0x00, 0x05, // .B.......[...P..
+	0x00, 0x18, 0x00, 0x00, 0x00, 0x89, 0x02, 0x00, 0x00, 0xcc, 0x01, 0x00, 0x00, 0xd2, 0x01, 0x00, // ................
+	0x00, 0x5f, 0x00, 0x07, 0x00, 0x1a, 0x00, 0x00, 0x00, 0xb9, 0x02, 0x00, 0x00, 0x3b, 0x00, 0x00, // ._...........;..
+	0x00, 0x89, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x00, 0xc7, 0x00, 0x05, // .........O......
+	0x00, 0x17, 0x00, 0x00, 0x00, 0x8d, 0x02, 0x00, 0x00, 0xbf, 0x01, 0x00, 0x00, 0x67, 0x00, 0x00, // .............g..
+	0x00, 0xab, 0x00, 0x05, 0x00, 0x69, 0x00, 0x00, 0x00, 0x8e, 0x02, 0x00, 0x00, 0x8d, 0x02, 0x00, // .....i..........
+	0x00, 0x4f, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0x8f, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, // .O..............
+	0x00, 0xfa, 0x00, 0x04, 0x00, 0x8e, 0x02, 0x00, 0x00, 0x90, 0x02, 0x00, 0x00, 0x8f, 0x02, 0x00, // ................
+	0x00, 0xf8, 0x00, 0x02, 0x00, 0x90, 0x02, 0x00, 0x00, 0x4f, 0x00, 0x08, 0x00, 0x07, 0x00, 0x00, // .........O......
+	0x00, 0x92, 0x02, 0x00, 0x00, 0xb9, 0x02, 0x00, 0x00, 0xb9, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, // ................
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x07, 0x00, 0x00, // ................
+	0x00, 0x93, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x92, 0x02, 0x00, // .........+......
+	0x00, 0x71, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, // .q...s..........
+	0x00, 0x96, 0x02, 0x00, 0x00, 0x93, 0x02, 0x00, 0x00, 0x9c, 0x03, 0x00, 0x00, 0x85, 0x00, 0x05, // ................
+	0x00, 0x07, 0x00, 0x00, 0x00, 0x98, 0x02, 0x00, 0x00, 0x96, 0x02, 0x00, 0x00, 0x9f, 0x03, 0x00, // ................
+	0x00, 0x0c, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x9a, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, // ................
+	0x00, 0x1a, 0x00, 0x00, 0x00, 0x98, 0x02, 0x00, 0x00, 0xa0, 0x03, 0x00, 0x00, 0x85, 0x00, 0x05, // ................
+	0x00, 0x07, 0x00, 0x00, 0x00, 0x9d, 0x02, 0x00, 0x00, 0x93, 0x02, 0x00, 0x00, 0xa3, 0x03, 0x00, // ................
+	0x00, 0x0c, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0xa0, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, // ................
+	0x00, 0x30, 0x00, 0x00, 0x00, 0x93, 0x02, 0x00, 0x00, 0xa4, 0x03, 0x00, 0x00, 0x0c, 0x00, 0x08, // .0..............
+	0x00, 0x07, 0x00, 0x00, 0x00, 0xc8, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, // ................
+	0x00, 0x9a, 0x02, 0x00, 0x00, 0x9d, 0x02, 0x00, 0x00, 0xa0, 0x02, 0x00, 0x00, 0x4f, 0x00, 0x09, // .............O..
+	0x00, 0x1a, 0x00, 0x00, 0x00, 0xa3, 0x02, 0x00, 0x00, 0xb9, 0x02, 0x00, 0x00, 0xc8, 0x02, 0x00, // ................
+	0x00, 0x04, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, // ................
+	0x00, 0xf9, 0x00, 0x02, 0x00, 0x8f, 0x02, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x8f, 0x02, 0x00, // ................
+	0x00, 0xf5, 0x00, 0x07, 0x00, 0x1a, 0x00, 0x00, 0x00, 0xaa, 0x03, 0x00, 0x00, 0xb9, 0x02, 0x00, // ................
+	0x00, 0x5a, 0x02, 0x00, 0x00, 0xa3, 0x02, 0x00, 0x00, 0x90, 0x02, 0x00, 0x00, 0xc7, 0x00, 0x05, // .Z..............
+	0x00, 0x17, 0x00, 0x00, 0x00, 0xa5, 0x02, 0x00, 0x00, 0xbf, 0x01, 0x00, 0x00, 0x90, 0x00, 0x00, // ................
+	0x00, 0xab, 0x00, 0x05, 0x00, 0x69, 0x00, 0x00, 0x00, 0xa6, 0x02, 0x00, 0x00, 0xa5, 0x02, 0x00, // .....i..........
+	0x00, 0x4f, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0xa7, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, // .O..............
+	0x00, 0xfa, 0x00, 0x04, 0x00, 0xa6, 0x02, 0x00, 0x00, 0xa8, 0x02, 0x00, 0x00, 0xa7, 0x02, 0x00, // ................
+	0x00, 0xf8, 0x00, 0x02, 0x00, 0xa8, 0x02, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, // .........Q......
+	0x00, 0xaa, 0x02, 0x00, 0x00, 0xaa, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x08, // ................
+	0x00, 0x06, 0x00, 0x00, 0x00, 0xab, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, // .............+..
+	0x00, 0xaa, 0x02, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x72, 0x00, 0x00, 0x00, 0x85, 0x00, 0x05, // .....p...r......
+	0x00, 0x06, 0x00, 0x00, 0x00, 0xae, 0x02, 0x00, 0x00, 0xab, 0x02, 0x00, 0x00, 0xab, 0x02, 0x00, // ................
+	0x00, 0x85, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0xb1, 0x02, 0x00, 0x00, 0xab, 0x02, 0x00, // ................
+	0x00, 0xab, 0x02, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0xb2, 0x02, 0x00, // ................
+	0x00, 0xae, 0x02, 0x00, 0x00, 0xb1, 0x02, 0x00, 0x00, 0x52, 0x00, 0x06, 0x00, 0x1a, 0x00, 0x00, // .........R......
+	0x00, 0x92, 0x03, 0x00, 0x00, 0xb2, 0x02, 0x00, 0x00, 0xaa, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, // ................
+	0x00, 0xf9, 0x00, 0x02, 0x00, 0xa7, 0x02, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xa7, 0x02, 0x00, // ................
+	0x00, 0xf5, 0x00, 0x07, 0x00, 0x1a, 0x00, 0x00, 0x00, 0xab, 0x03, 0x00, 0x00, 0xaa, 0x03, 0x00, // ................
+	0x00, 0x8f, 0x02, 0x00, 0x00, 0x92, 0x03, 0x00, 0x00, 0xa8, 0x02, 0x00, 0x00, 0x81, 0x00, 0x05, // ................
+	0x00, 0x1a, 0x00, 0x00, 0x00, 0xe2, 0x01, 0x00, 0x00, 0xa9, 0x03, 0x00, 0x00, 0xab, 0x03, 0x00, // ................
+	0x00, 0x50, 0x00, 0x05, 0x00, 0x18, 0x00, 0x00, 0x00, 0xd6, 0x02, 0x00, 0x00, 0xc5, 0x01, 0x00, // .P..............
+	0x00, 0xd9, 0x01, 0x00, 0x00, 0x5f, 0x00, 0x07, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x06, 0x03, 0x00, // ....._..........
+	0x00, 0x3b, 0x00, 0x00, 0x00, 0xd6, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x00, // .;...........O..
+	0x00, 0xc7, 0x00, 0x05, 0x00, 0x17, 0x00, 0x00, 0x00, 0xda, 0x02, 0x00, 0x00, 0xbf, 0x01, 0x00, // ................
+	0x00, 0x67, 0x00, 0x00, 0x00, 0xab, 0x00, 0x05, 0x00, 0x69, 0x00, 0x00, 0x00, 0xdb, 0x02, 0x00, // .g.......i......
+	0x00, 0xda, 0x02, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0xdc, 0x02, 0x00, // .....O..........
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0xdb, 0x02, 0x00, 0x00, 0xdd, 0x02, 0x00, // ................
+	0x00, 0xdc, 0x02, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xdd, 0x02, 0x00, 0x00, 0x4f, 0x00, 0x08, // .............O..
+	0x00, 0x07, 0x00, 0x00, 0x00, 0xdf, 0x02, 0x00, 0x00, 0x06, 0x03, 0x00, 0x00, 0x06, 0x03, 0x00, // ................
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x08, // ................
+	0x00, 0x07, 0x00, 0x00, 0x00, 0xe0, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, // .............+..
+	0x00, 0xdf, 0x02, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0x81, 0x00, 0x05, // .....q...s......
+	0x00, 0x07, 0x00, 0x00, 0x00, 0xe3, 0x02, 0x00, 0x00, 0xe0, 0x02, 0x00, 0x00, 0x9c, 0x03, 0x00, // ................
+	0x00, 0x85, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0xe5, 0x02, 0x00, 0x00, 0xe3, 0x02, 0x00, // ................
+	0x00, 0x9f, 0x03, 0x00, 0x00, 0x0c, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0xe7, 0x02, 0x00, // ................
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0xe5, 0x02, 0x00, 0x00, 0xa0, 0x03, 0x00, // ................
+	0x00, 0x85, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0xea, 0x02, 0x00, 0x00, 0xe0, 0x02, 0x00, // ................
+	0x00, 0xa3, 0x03, 0x00, 0x00, 0x0c, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0xed, 0x02, 0x00, // ................
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0xe0, 0x02, 0x00, 0x00, 0xa4, 0x03, 0x00, // .....0..........
+	0x00, 0x0c, 0x00, 0x08, 0x00, 0x07, 0x00, 0x00, 0x00, 0x15, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, // ................
+	0x00, 0x2e, 0x00, 0x00, 0x00, 0xe7, 0x02, 0x00, 0x00, 0xea, 0x02, 0x00, 0x00, 0xed, 0x02, 0x00, // ................
+	0x00, 0x4f, 0x00, 0x09, 0x00, 0x1a, 0x00, 0x00, 0x00, 0xf0, 0x02, 0x00, 0x00, 0x06, 0x03, 0x00, // .O..............
+	0x00, 0x15, 0x03, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, // ................
+	0x00, 0x03, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0xdc, 0x02, 0x00, 0x00, 0xf8, 0x00, 0x02, // ................
+	0x00, 0xdc, 0x02, 0x00, 0x00, 0xf5, 0x00, 0x07, 0x00, 0x1a, 0x00, 0x00, 0x00, 0xac, 0x03, 0x00, // ................
+	0x00, 0x06, 0x03, 0x00, 0x00, 0xa7, 0x02, 0x00, 0x00, 0xf0, 0x02, 0x00, 0x00, 0xdd, 0x02, 0x00, // ................
+	0x00, 0xc7, 0x00, 0x05, 0x00, 0x17, 0x00, 0x00, 0x00, 0xf2, 0x02, 0x00, 0x00, 0xbf, 0x01, 0x00, // ................
+	0x00, 0x90, 0x00, 0x00, 0x00, 0xab, 0x00, 0x05, 0x00, 0x69, 0x00, 0x00, 0x00, 0xf3, 0x02, 0x00, // .........i......
+	0x00, 0xf2, 0x02, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0xf4, 0x02, 0x00, // .....O..........
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0xf3, 0x02, 0x00, 0x00, 0xf5, 0x02, 0x00, // ................
+	0x00, 0xf4, 0x02, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xf5, 0x02, 0x00, 0x00, 0x51, 0x00, 0x05, // .............Q..
+	0x00, 0x06, 0x00, 0x00, 0x00, 0xf7, 0x02, 0x00, 0x00, 0xac, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, // ................
+	0x00, 0x0c, 0x00, 0x08, 0x00, 0x06, 0x00, 0x00, 0x00, 0xf8, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, // ................
+	0x00, 0x2b, 0x00, 0x00, 0x00, 0xf7, 0x02, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x72, 0x00, 0x00, // .+.......p...r..
+	0x00, 0x85, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0xfb, 0x02, 0x00, 0x00, 0xf8, 0x02, 0x00, // ................
+	0x00, 0xf8, 0x02, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0xfe, 0x02, 0x00, // ................
+	0x00, 0xf8, 0x02, 0x00, 0x00, 0xf8, 0x02, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, // ................
+	0x00, 0xff, 0x02, 0x00, 0x00, 0xfb, 0x02, 0x00, 0x00, 0xfe, 0x02, 0x00, 0x00, 0x52, 0x00, 0x06, // .............R..
+	0x00, 0x1a, 0x00, 0x00, 0x00, 0x95, 0x03, 0x00, 0x00, 0xff, 0x02, 0x00, 0x00, 0xac, 0x03, 0x00, // ................
+	0x00, 0x03, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0xf4, 0x02, 0x00, 0x00, 0xf8, 0x00, 0x02, // ................
+	0x00, 0xf4, 0x02, 0x00, 0x00, 0xf5, 0x00, 0x07, 0x00, 0x1a, 0x00, 0x00, 0x00, 0xad, 0x03, 0x00, // ................
+	0x00, 0xac, 0x03, 0x00, 0x00, 0xdc, 0x02, 0x00, 0x00, 0x95, 0x03, 0x00, 0x00, 0xf5, 0x02, 0x00, // ................
+	0x00, 0x81, 0x00, 0x05, 0x00, 0x1a, 0x00, 0x00, 0x00, 0xe7, 0x01, 0x00, 0x00, 0xe2, 0x01, 0x00, // ................
+	0x00, 0xad, 0x03, 0x00, 0x00, 0x50, 0x00, 0x05, 0x00, 0x18, 0x00, 0x00, 0x00, 0x23, 0x03, 0x00, // .....P.......#..
+	0x00, 0xcc, 0x01, 0x00, 0x00, 0xd9, 0x01, 0x00, 0x00, 0x5f, 0x00, 0x07, 0x00, 0x1a, 0x00, 0x00, // ........._......
+	0x00, 0x53, 0x03, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x23, 0x03, 0x00, 0x00, 0x02, 0x00, 0x00, // .S...;...#......
+	0x00, 0x4f, 0x00, 0x00, 0x00, 0xc7, 0x00, 0x05, 0x00, 0x17, 0x00, 0x00, 0x00, 0x27, 0x03, 0x00, // .O...........'..
+	0x00, 0xbf, 0x01, 0x00, 0x00, 0x67, 0x00, 0x00, 0x00, 0xab, 0x00, 0x05, 0x00, 0x69, 0x00, 0x00, // .....g.......i..
+	0x00, 0x28, 0x03, 0x00, 0x00, 0x27, 0x03, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, // .(...'...O......
+	0x00, 0x29, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x28, 0x03, 0x00, // .)...........(..
+	0x00, 0x2a, 0x03, 0x00, 0x00, 0x29, 0x03, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x2a, 0x03, 0x00, // .*...).......*..
+	0x00, 0x4f, 0x00, 0x08, 0x00, 0x07, 0x00, 0x00, 0x00, 0x2c, 0x03, 0x00, 0x00, 0x53, 0x03, 0x00, // .O.......,...S..
+	0x00, 0x53, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, // .S..............
+	0x00, 0x0c, 0x00, 0x08, 0x00, 0x07, 0x00, 0x00, 0x00, 0x2d, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, // .........-......
+	0x00, 0x2b, 0x00, 0x00, 0x00, 0x2c, 0x03, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, // .+...,...q...s..
+	0x00, 0x81, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0x30, 0x03, 0x00, 0x00, 0x2d, 0x03, 0x00, // .........0...-..
+	0x00, 0x9c, 0x03, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0x32, 0x03, 0x00, // .............2..
+	0x00, 0x30, 0x03, 0x00, 0x00, 0x9f, 0x03, 0x00, 0x00, 0x0c, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, // .0..............
+	0x00, 0x34, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x32, 0x03, 0x00, // .4...........2..
+	0x00, 0xa0, 0x03, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0x37, 0x03, 0x00, // .............7..
+	0x00, 0x2d, 0x03, 0x00, 0x00, 0xa3, 0x03, 0x00, 0x00, 0x0c, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, // .-..............
+	0x00, 0x3a, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x2d, 0x03, 0x00, // .:.......0...-..
+	0x00, 0xa4, 0x03, 0x00, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x07, 0x00, 0x00, 0x00, 0x62, 0x03, 0x00, // .............b..
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x34, 0x03, 0x00, 0x00, 0x37, 0x03, 0x00, // .........4...7..
+	0x00, 0x3a, 0x03, 0x00, 0x00, 0x4f, 0x00, 0x09, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x3d, 0x03, 0x00, // .:...O.......=..
+	0x00, 0x53, 0x03, 0x00, 0x00, 0x62, 0x03, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, // .S...b..........
+	0x00, 0x06, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x29, 0x03, 0x00, // .............)..
+	0x00, 0xf8, 0x00, 0x02, 0x00, 0x29, 0x03, 0x00, 0x00, 0xf5, 0x00, 0x07, 0x00, 0x1a, 0x00, 0x00, // .....)..........
+	0x00, 0xae, 0x03, 0x00, 0x00, 0x53, 0x03, 0x00, 0x00, 0xf4, 0x02, 0x00, 0x00, 0x3d, 0x03, 0x00, // .....S.......=..
+	0x00, 0x2a, 0x03, 0x00, 0x00, 0xc7, 0x00, 0x05, 0x00, 0x17, 0x00, 0x00, 0x00, 0x3f, 0x03, 0x00, // .*...........?..
+	0x00, 0xbf, 0x01, 0x00, 0x00, 0x90, 0x00, 0x00, 0x00, 0xab, 0x00, 0x05, 0x00, 0x69, 0x00, 0x00, // .............i..
+	0x00, 0x40, 0x03, 0x00, 0x00, 0x3f, 0x03, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, // .@...?...O......
+	0x00, 0x41, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x40, 0x03, 0x00, // .A...........@..
+	0x00, 0x42, 0x03, 0x00, 0x00, 0x41, 0x03, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x42, 0x03, 0x00, // .B...A.......B..
+	0x00, 0x51, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x44, 0x03, 0x00, 0x00, 0xae, 0x03, 0x00, // .Q.......D......
+	0x00, 0x03, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x06, 0x00, 0x00, 0x00, 0x45, 0x03, 0x00, // .............E..
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x44, 0x03, 0x00, 0x00, 0x70, 0x00, 0x00, // .....+...D...p..
+	0x00, 0x72, 0x00, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x48, 0x03, 0x00, // .r...........H..
+	0x00, 0x45, 0x03, 0x00, 0x00, 0x45, 0x03, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, // .E...E..........
+	0x00, 0x4b, 0x03, 0x00, 0x00, 0x45, 0x03, 0x00, 0x00, 0x45, 0x03, 0x00, 0x00, 0x85, 0x00, 0x05, // .K...E...E......
+	0x00, 0x06, 0x00, 0x00, 0x00, 0x4c, 0x03, 0x00, 0x00, 0x48, 0x03, 0x00, 0x00, 0x4b, 0x03, 0x00, // .....L...H...K..
+	0x00, 0x52, 0x00, 0x06, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x98, 0x03, 0x00, 0x00, 0x4c, 0x03, 0x00, // .R...........L..
+	0x00, 0xae, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x41, 0x03, 0x00, // .............A..
+	0x00, 0xf8, 0x00, 0x02, 0x00, 0x41, 0x03, 0x00, 0x00, 0xf5, 0x00, 0x07, 0x00, 0x1a, 0x00, 0x00, // .....A..........
+	0x00, 0xaf, 0x03, 0x00, 0x00, 0xae, 0x03, 0x00, 0x00, 0x29, 0x03, 0x00, 0x00, 0x98, 0x03, 0x00, // .........)......
+	0x00, 0x42, 0x03, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00, 0x1a, 0x00, 0x00, 0x00, 0xec, 0x01, 0x00, // .B..............
+	0x00, 0xe7, 0x01, 0x00, 0x00, 0xaf, 0x03, 0x00, 0x00, 0x8e, 0x00, 0x05, 0x00, 0x1a, 0x00, 0x00, // ................
+	0x00, 0xed, 0x01, 0x00, 0x00, 0xec, 0x01, 0x00, 0x00, 0x0a, 0x01, 0x00, 0x00, 0xc7, 0x00, 0x05, // ................
+	0x00, 0x17, 0x00, 0x00, 0x00, 0xef, 0x01, 0x00, 0x00, 0xbf, 0x01, 0x00, 0x00, 0x67, 0x00, 0x00, // .............g..
+	0x00, 0xab, 0x00, 0x05, 0x00, 0x69, 0x00, 0x00, 0x00, 0xf0, 0x01, 0x00, 0x00, 0xef, 0x01, 0x00, // .....i..........
+	0x00, 0x4f, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0xf1, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, // .O..............
+	0x00, 0xfa, 0x00, 0x04, 0x00, 0xf0, 0x01, 0x00, 0x00, 0xf2, 0x01, 0x00, 0x00, 0xf1, 0x01, 0x00, // ................
+	0x00, 0xf8, 0x00, 0x02, 0x00, 0xf2, 0x01, 0x00, 0x00, 0x4f, 0x00, 0x08, 0x00, 0x07, 0x00, 0x00, // .........O......
+	0x00, 0xf4, 0x01, 0x00, 0x00, 0xed, 0x01, 0x00, 0x00, 0xed, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, // ................
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x08, 0x00, 0x07, 0x00, 0x00, // ................
+	0x00, 0xf5, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0xf4, 0x01, 0x00, // .........+......
+	0x00, 0x71, 0x00, 0x00, 0x00, 0x73, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, // .q...s..........
+	0x00, 0xf8, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x00, 0xf5, 0x01, 0x00, // ................
+	0x00, 0xa5, 0x03, 0x00, 0x00, 0x8e, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0xf9, 0x01, 0x00, // ................
+	0x00, 0xf8, 0x01, 0x00, 0x00, 0x79, 0x00, 0x00, 0x00, 0x83, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, // .....y..........
+	0x00, 0xfb, 0x01, 0x00, 0x00, 0xf9, 0x01, 0x00, 0x00, 0x9c, 0x03, 0x00, 0x00, 0x8e, 0x00, 0x05, // ................
+	0x00, 0x07, 0x00, 0x00, 0x00, 0xfd, 0x01, 0x00, 0x00, 0xf5, 0x01, 0x00, 0x00, 0x81, 0x00, 0x00, // ................
+	0x00, 0x0c, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, // ................
+	0x00, 0x30, 0x00, 0x00, 0x00, 0xf5, 0x01, 0x00, 0x00, 0xa6, 0x03, 0x00, 0x00, 0x0c, 0x00, 0x08, // .0..............
+	0x00, 0x07, 0x00, 0x00, 0x00, 0x71, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, // .....q..........
+	0x00, 0xfb, 0x01, 0x00, 0x00, 0xfd, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x4f, 0x00, 0x09, // .............O..
+	0x00, 0x1a, 0x00, 0x00, 0x00, 0x03, 0x02, 0x00, 0x00, 0xed, 0x01, 0x00, 0x00, 0x71, 0x03, 0x00, // .............q..
+	0x00, 0x04, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, // ................
+	0x00, 0xf9, 0x00, 0x02, 0x00, 0xf1, 0x01, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xf1, 0x01, 0x00, // ................
+	0x00, 0xf5, 0x00, 0x07, 0x00, 0x1a, 0x00, 0x00, 0x00, 0xb0, 0x03, 0x00, 0x00, 0xed, 0x01, 0x00, // ................
+	0x00, 0x41, 0x03, 0x00, 0x00, 0x03, 0x02, 0x00, 0x00, 0xf2, 0x01, 0x00, 0x00, 0xc7, 0x00, 0x05, // .A..............
+	0x00, 0x17, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00, 0x00, 0xbf, 0x01, 0x00, 0x00, 0x90, 0x00, 0x00, // ................
+	0x00, 0xab, 0x00, 0x05, 0x00, 0x69, 0x00, 0x00, 0x00, 0x06, 0x02, 0x00, 0x00, 0x05, 0x02, 0x00, // .....i..........
+	0x00, 0x4f, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0x07, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, // .O..............
+	0x00, 0xfa, 0x00, 0x04, 0x00, 0x06, 0x02, 0x00, 0x00, 0x08, 0x02, 0x00, 0x00, 0x07, 0x02, 0x00, // ................
+	0x00, 0xf8, 0x00, 0x02, 0x00, 0x08, 0x02, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, // .........Q......
+	0x00, 0x0a, 0x02, 0x00, 0x00, 0xb0, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x08, // ................
+	0x00, 0x06, 0x00, 0x00, 0x00, 0x0b, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, // .............+..
+	0x00, 0x0a, 0x02, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x72, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x06, // .....p...r......
+	0x00, 0x06, 0x00, 0x00, 0x00, 0x0c, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, // ................
+	0x00, 0x0b, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x06, 0x00, 0x00, 0x00, 0x0d, 0x02, 0x00, // ................
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x0c, 0x02, 0x00, 0x00, 0x52, 0x00, 0x06, // .............R..
+	0x00, 0x1a, 0x00, 0x00, 0x00, 0x9b, 0x03, 0x00, 0x00, 0x0d, 0x02, 0x00, 0x00, 0xb0, 0x03, 0x00, // ................
+	0x00, 0x03, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x07, 0x02, 0x00, 0x00, 0xf8, 0x00, 0x02, // ................
+	0x00, 0x07, 0x02, 0x00, 0x00, 0xf5, 0x00, 0x07, 0x00, 0x1a, 0x00, 0x00, 0x00, 0xb1, 0x03, 0x00, // ................
+	0x00, 0xb0, 0x03, 0x00, 0x00, 0xf1, 0x01, 0x00, 0x00, 0x9b, 0x03, 0x00, 0x00, 0x08, 0x02, 0x00, // ................
+	0x00, 0xc7, 0x00, 0x05, 0x00, 0x17, 0x00, 0x00, 0x00, 0x10, 0x02, 0x00, 0x00, 0xbf, 0x01, 0x00, // ................
+	0x00, 0x36, 0x01, 0x00, 0x00, 0xab, 0x00, 0x05, 0x00, 0x69, 0x00, 0x00, 0x00, 0x11, 0x02, 0x00, // .6.......i......
+	0x00, 0x10, 0x02, 0x00, 0x00, 0x4f, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0x12, 0x02, 0x00, // .....O..........
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x11, 0x02, 0x00, 0x00, 0x13, 0x02, 0x00, // ................
+	0x00, 0x12, 0x02, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x13, 0x02, 0x00, 0x00, 0x4f, 0x00, 0x08, // .............O..
+	0x00, 0x07, 0x00, 0x00, 0x00, 0x15, 0x02, 0x00, 0x00, 0xb1, 0x03, 0x00, 0x00, 0xb1, 0x03, 0x00, // ................
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x05, // ................
+	0x00, 0x07, 0x00, 0x00, 0x00, 0x16, 0x02, 0x00, 0x00, 0x15, 0x02, 0x00, 0x00, 0x3e, 0x01, 0x00, // .............>..
+	0x00, 0x83, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0x18, 0x02, 0x00, 0x00, 0x16, 0x02, 0x00, // ................
+	0x00, 0x73, 0x00, 0x00, 0x00, 0x94, 0x00, 0x05, 0x00, 0x06, 0x00, 0x00, 0x00, 0x1b, 0x02, 0x00, // .s..............
+	0x00, 0x18, 0x02, 0x00, 0x00, 0x18, 0x02, 0x00, 0x00, 0xba, 0x00, 0x05, 0x00, 0x69, 0x00, 0x00, // .............i..
+	0x00, 0x1d, 0x02, 0x00, 0x00, 0x1b, 0x02, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x06, // .........p......
+	0x00, 0x06, 0x00, 0x00, 0x00, 0x20, 0x02, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, // ..... ....... ..
+	0x00, 0x1b, 0x02, 0x00, 0x00, 0x8e, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0x21, 0x02, 0x00, // .............!..
+	0x00, 0x18, 0x02, 0x00, 0x00, 0x20, 0x02, 0x00, 0x00, 0x50, 0x00, 0x06, 0x00, 0x4e, 0x01, 0x00, // ..... ...P...N..
+	0x00, 0x23, 0x02, 0x00, 0x00, 0x1d, 0x02, 0x00, 0x00, 0x1d, 0x02, 0x00, 0x00, 0x1d, 0x02, 0x00, // .#..............
+	0x00, 0xa9, 0x00, 0x06, 0x00, 0x07, 0x00, 0x00, 0x00, 0x24, 0x02, 0x00, 0x00, 0x23, 0x02, 0x00, // .........$...#..
+	0x00, 0x21, 0x02, 0x00, 0x00, 0x71, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, // .!...q..........
+	0x00, 0x26, 0x02, 0x00, 0x00, 0x24, 0x02, 0x00, 0x00, 0x52, 0x01, 0x00, 0x00, 0x81, 0x00, 0x05, // .&...$...R......
+	0x00, 0x07, 0x00, 0x00, 0x00, 0x28, 0x02, 0x00, 0x00, 0x26, 0x02, 0x00, 0x00, 0xa7, 0x03, 0x00, // .....(...&......
+	0x00, 0x4f, 0x00, 0x09, 0x00, 0x1a, 0x00, 0x00, 0x00, 0x2a, 0x02, 0x00, 0x00, 0xb1, 0x03, 0x00, // .O.......*......
+	0x00, 0x28, 0x02, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, // .(..............
+	0x00, 0x03, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x12, 0x02, 0x00, 0x00, 0xf8, 0x00, 0x02, // ................
+	0x00, 0x12, 0x02, 0x00, 0x00, 0xf5, 0x00, 0x07, 0x00, 0x1a, 0x00, 0x00, 0x00, 0xb2, 0x03, 0x00, // ................
+	0x00, 0xb1, 0x03, 0x00, 0x00, 0x07, 0x02, 0x00, 0x00, 0x2a, 0x02, 0x00, 0x00, 0x13, 0x02, 0x00, // .........*......
+	0x00, 0x63, 0x00, 0x04, 0x00, 0x41, 0x00, 0x00, 0x00, 0xad, 0x01, 0x00, 0x00, 0xb2, 0x03, 0x00, // .c...A..........
+	0x00, 0xf9, 0x00, 0x02, 0x00, 0xa3, 0x01, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xa4, 0x01, 0x00, // ................
+	0x00, 0xf9, 0x00, 0x02, 0x00, 0xa2, 0x01, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xa3, 0x01, 0x00, // ................
+	0x00, 0xfd, 0x00, 0x01, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00,                   // .....8.......
+};
+
+static const uint8_t mip_shader_compute_mtl[6021] =
+{
+	0x43, 0x53, 0x48, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x0a, 0x75, // CSH............u
+	0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x02, 0x01, 0x00, 0x00, 0x01, 0x00, 0x07, // _settings.......
+	0x73, 0x5f, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, // s_input.........
+	0x00, 0x01, 0x00, 0x4a, 0x17, 0x00, 0x00, 0x23, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x20, // ...J...#include 
+	0x3c, 0x6d, 0x65, 0x74, 0x61, 0x6c, 0x5f, 0x73, 0x74, 0x64, 0x6c, 0x69, 0x62, 0x3e, 0x0a, 0x23, // <metal_stdlib>.#
+	0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x20, 0x3c, 0x73, 0x69, 0x6d, 0x64, 0x2f, 0x73, 0x69, // include <simd/si
+	0x6d, 0x64, 0x2e, 0x68, 0x3e, 0x0a, 0x0a, 0x75, 0x73, 0x69, 0x6e, 0x67, 0x20, 0x6e, 0x61, 0x6d, // md.h>..using nam
+	0x65, 0x73, 0x70, 0x61, 0x63, 0x65, 0x20, 0x6d, 0x65, 0x74, 0x61, 0x6c, 0x3b, 0x0a, 0x0a, 0x73, // espace metal;..s
+	0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x5f, 0x47, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x0a, 0x7b, 0x0a, // truct _Global.{.
+	0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x20, 0x75, 0x5f, 0x73, 0x65, 0x74, //     float4 u_set
+	0x74, 0x69, 0x6e, 0x67, 0x73, 0x3b, 0x0a, 0x7d, 0x3b, 0x0a, 0x0a, 0x6b, 0x65, 0x72, 0x6e, 0x65, // tings;.};..kerne
+	0x6c, 0x20, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x78, 0x6c, 0x61, 0x74, 0x4d, 0x74, 0x6c, 0x4d, 0x61, // l void xlatMtlMa
+	0x69, 0x6e, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x20, 0x5f, 0x47, 0x6c, 0x6f, // in(constant _Glo
+	0x62, 0x61, 0x6c, 0x26, 0x20, 0x5f, 0x6d, 0x74, 0x6c, 0x5f, 0x75, 0x20, 0x5b, 0x5b, 0x62, 0x75, // bal& _mtl_u [[bu
+	0x66, 0x66, 0x65, 0x72, 0x28, 0x30, 0x29, 0x5d, 0x5d, 0x2c, 0x20, 0x74, 0x65, 0x78, 0x74, 0x75, // ffer(0)]], textu
+	0x72, 0x65, 0x32, 0x64, 0x3c, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x3e, 0x20, 0x73, 0x5f, 0x69, 0x6e, // re2d<float> s_in
+	0x70, 0x75, 0x74, 0x20, 0x5b, 0x5b, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x28, 0x30, 0x29, // put [[texture(0)
+	0x5d, 0x5d, 0x2c, 0x20, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x32, 0x64, 0x3c, 0x66, 0x6c, // ]], texture2d<fl
+	0x6f, 0x61, 0x74, 0x2c, 0x20, 0x61, 0x63, 0x63, 0x65, 0x73, 0x73, 0x3a, 0x3a, 0x77, 0x72, 0x69, // oat, access::wri
+	0x74, 0x65, 0x3e, 0x20, 0x73, 0x5f, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x54, 0x65, 0x78, 0x74, // te> s_outputText
+	0x75, 0x72, 0x65, 0x20, 0x5b, 0x5b, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x28, 0x31, 0x29, // ure [[texture(1)
+	0x5d, 0x5d, 0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x20, 0x67, 0x6c, 0x5f, 0x47, 0x6c, 0x6f, // ]], uint3 gl_Glo
+	0x62, 0x61, 0x6c, 0x49, 0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x49, 0x44, 0x20, // balInvocationID 
+	0x5b, 0x5b, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x5f, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, // [[thread_positio
+	0x6e, 0x5f, 0x69, 0x6e, 0x5f, 0x67, 0x72, 0x69, 0x64, 0x5d, 0x5d, 0x29, 0x0a, 0x7b, 0x0a, 0x20, // n_in_grid]]).{. 
+	0x20, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x3b, 0x3b, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, //    for (;;).    
+	0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x34, // {.        int _4
+	0x32, 0x34, 0x20, 0x3d, 0x20, 0x69, 0x6e, 0x74, 0x28, 0x5f, 0x6d, 0x74, 0x6c, 0x5f, 0x75, 0x2e, // 24 = int(_mtl_u.
+	0x75, 0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x78, 0x29, 0x3b, 0x0a, 0x20, // u_settings.x);. 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x34, 0x32, 0x37, 0x20, //        int _427 
+	0x3d, 0x20, 0x69, 0x6e, 0x74, 0x28, 0x5f, 0x6d, 0x74, 0x6c, 0x5f, 0x75, 0x2e, 0x75, 0x5f, 0x73, // = int(_mtl_u.u_s
+	0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x79, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, // ettings.y);.    
+	0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x28, 0x69, 0x6e, 0x74, 0x33, 0x28, 0x67, 0x6c, //     if ((int3(gl
+	0x5f, 0x47, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x49, 0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, // _GlobalInvocatio
+	0x6e, 0x49, 0x44, 0x29, 0x2e, 0x78, 0x20, 0x3e, 0x3d, 0x20, 0x6d, 0x61, 0x78, 0x28, 0x28, 0x5f, // nID).x >= max((_
+	0x34, 0x32, 0x34, 0x20, 0x2f, 0x20, 0x32, 0x29, 0x2c, 0x20, 0x31, 0x29, 0x29, 0x20, 0x7c, 0x7c, // 424 / 2), 1)) ||
+	0x20, 0x28, 0x69, 0x6e, 0x74, 0x33, 0x28, 0x67, 0x6c, 0x5f, 0x47, 0x6c, 0x6f, 0x62, 0x61, 0x6c, //  (int3(gl_Global
+	0x49, 0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x49, 0x44, 0x29, 0x2e, 0x79, 0x20, // InvocationID).y 
+	0x3e, 0x3d, 0x20, 0x6d, 0x61, 0x78, 0x28, 0x28, 0x5f, 0x34, 0x32, 0x37, 0x20, 0x2f, 0x20, 0x32, // >= max((_427 / 2
+	0x29, 0x2c, 0x20, 0x31, 0x29, 0x29, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // ), 1))).        
+	0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, // {.            br
+	0x65, 0x61, 0x6b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, // eak;.        }. 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x34, 0x34, 0x37, 0x20, //        int _447 
+	0x3d, 0x20, 0x69, 0x6e, 0x74, 0x28, 0x5f, 0x6d, 0x74, 0x6c, 0x5f, 0x75, 0x2e, 0x75, 0x5f, 0x73, // = int(_mtl_u.u_s
+	0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x7a, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, // ettings.z);.    
+	0x20, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x34, 0x35, 0x33, 0x20, 0x3d, 0x20, 0x6d, //     int _453 = m
+	0x69, 0x6e, 0x28, 0x28, 0x69, 0x6e, 0x74, 0x33, 0x28, 0x67, 0x6c, 0x5f, 0x47, 0x6c, 0x6f, 0x62, // in((int3(gl_Glob
+	0x61, 0x6c, 0x49, 0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x49, 0x44, 0x29, 0x2e, // alInvocationID).
+	0x78, 0x20, 0x2a, 0x20, 0x32, 0x29, 0x2c, 0x20, 0x28, 0x5f, 0x34, 0x32, 0x34, 0x20, 0x2d, 0x20, // x * 2), (_424 - 
+	0x31, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x74, // 1));.        int
+	0x20, 0x5f, 0x34, 0x36, 0x30, 0x20, 0x3d, 0x20, 0x6d, 0x69, 0x6e, 0x28, 0x28, 0x28, 0x69, 0x6e, //  _460 = min(((in
+	0x74, 0x33, 0x28, 0x67, 0x6c, 0x5f, 0x47, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x49, 0x6e, 0x76, 0x6f, // t3(gl_GlobalInvo
+	0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x49, 0x44, 0x29, 0x2e, 0x78, 0x20, 0x2a, 0x20, 0x32, 0x29, // cationID).x * 2)
+	0x20, 0x2b, 0x20, 0x31, 0x29, 0x2c, 0x20, 0x28, 0x5f, 0x34, 0x32, 0x34, 0x20, 0x2d, 0x20, 0x31, //  + 1), (_424 - 1
+	0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, // ));.        int 
+	0x5f, 0x34, 0x36, 0x36, 0x20, 0x3d, 0x20, 0x6d, 0x69, 0x6e, 0x28, 0x28, 0x69, 0x6e, 0x74, 0x33, // _466 = min((int3
+	0x28, 0x67, 0x6c, 0x5f, 0x47, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x49, 0x6e, 0x76, 0x6f, 0x63, 0x61, // (gl_GlobalInvoca
+	0x74, 0x69, 0x6f, 0x6e, 0x49, 0x44, 0x29, 0x2e, 0x79, 0x20, 0x2a, 0x20, 0x32, 0x29, 0x2c, 0x20, // tionID).y * 2), 
+	0x28, 0x5f, 0x34, 0x32, 0x37, 0x20, 0x2d, 0x20, 0x31, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, // (_427 - 1));.   
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x34, 0x37, 0x33, 0x20, 0x3d, 0x20, //      int _473 = 
+	0x6d, 0x69, 0x6e, 0x28, 0x28, 0x28, 0x69, 0x6e, 0x74, 0x33, 0x28, 0x67, 0x6c, 0x5f, 0x47, 0x6c, // min(((int3(gl_Gl
+	0x6f, 0x62, 0x61, 0x6c, 0x49, 0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x49, 0x44, // obalInvocationID
+	0x29, 0x2e, 0x79, 0x20, 0x2a, 0x20, 0x32, 0x29, 0x20, 0x2b, 0x20, 0x31, 0x29, 0x2c, 0x20, 0x28, // ).y * 2) + 1), (
+	0x5f, 0x34, 0x32, 0x37, 0x20, 0x2d, 0x20, 0x31, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, // _427 - 1));.    
+	0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x20, 0x5f, 0x36, 0x32, 0x30, 0x20, //     float4 _620 
+	0x3d, 0x20, 0x73, 0x5f, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x2e, 0x72, 0x65, 0x61, 0x64, 0x28, 0x75, // = s_input.read(u
+	0x69, 0x6e, 0x74, 0x32, 0x28, 0x69, 0x6e, 0x74, 0x32, 0x28, 0x5f, 0x34, 0x35, 0x33, 0x2c, 0x20, // int2(int2(_453, 
+	0x5f, 0x34, 0x36, 0x36, 0x29, 0x29, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, // _466)), 0);.    
+	0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x20, 0x5f, 0x39, 0x33, 0x36, 0x3b, //     float4 _936;
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x28, 0x5f, 0x34, // .        if ((_4
+	0x34, 0x37, 0x20, 0x26, 0x20, 0x31, 0x29, 0x20, 0x21, 0x3d, 0x20, 0x30, 0x29, 0x0a, 0x20, 0x20, // 47 & 1) != 0).  
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //       {.        
+	0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x20, 0x5f, 0x35, 0x38, 0x32, 0x20, //     float3 _582 
+	0x3d, 0x20, 0x66, 0x61, 0x73, 0x74, 0x3a, 0x3a, 0x63, 0x6c, 0x61, 0x6d, 0x70, 0x28, 0x5f, 0x36, // = fast::clamp(_6
+	0x32, 0x30, 0x2e, 0x78, 0x79, 0x7a, 0x2c, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x28, 0x30, // 20.xyz, float3(0
+	0x2e, 0x30, 0x29, 0x2c, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x28, 0x31, 0x2e, 0x30, 0x29, // .0), float3(1.0)
+	0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, // );.            f
+	0x6c, 0x6f, 0x61, 0x74, 0x33, 0x20, 0x5f, 0x36, 0x33, 0x35, 0x20, 0x3d, 0x20, 0x6d, 0x69, 0x78, // loat3 _635 = mix
+	0x28, 0x70, 0x6f, 0x77, 0x28, 0x28, 0x5f, 0x35, 0x38, 0x32, 0x20, 0x2b, 0x20, 0x66, 0x6c, 0x6f, // (pow((_582 + flo
+	0x61, 0x74, 0x33, 0x28, 0x30, 0x2e, 0x30, 0x35, 0x34, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x37, // at3(0.0549999997
+	0x30, 0x31, 0x39, 0x37, 0x36, 0x37, 0x37, 0x36, 0x31, 0x32, 0x33, 0x30, 0x34, 0x36, 0x38, 0x37, // 0197677612304687
+	0x35, 0x29, 0x29, 0x20, 0x2a, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x28, 0x30, 0x2e, 0x39, // 5)) * float3(0.9
+	0x34, 0x37, 0x38, 0x36, 0x37, 0x33, 0x33, 0x33, 0x38, 0x38, 0x39, 0x30, 0x30, 0x37, 0x35, 0x36, // 4786733388900756
+	0x38, 0x33, 0x35, 0x39, 0x33, 0x37, 0x35, 0x29, 0x2c, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, // 8359375), float3
+	0x28, 0x32, 0x2e, 0x34, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x39, 0x35, 0x33, 0x36, 0x37, 0x34, // (2.4000000953674
+	0x33, 0x31, 0x36, 0x34, 0x30, 0x36, 0x32, 0x35, 0x29, 0x29, 0x2c, 0x20, 0x5f, 0x35, 0x38, 0x32, // 31640625)), _582
+	0x20, 0x2a, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x28, 0x30, 0x2e, 0x30, 0x37, 0x37, 0x33, //  * float3(0.0773
+	0x39, 0x39, 0x33, 0x38, 0x30, 0x35, 0x30, 0x35, 0x30, 0x38, 0x34, 0x39, 0x39, 0x31, 0x34, 0x35, // 9938050508499145
+	0x35, 0x30, 0x37, 0x38, 0x31, 0x32, 0x35, 0x29, 0x2c, 0x20, 0x73, 0x74, 0x65, 0x70, 0x28, 0x5f, // 5078125), step(_
+	0x35, 0x38, 0x32, 0x2c, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x28, 0x30, 0x2e, 0x30, 0x34, // 582, float3(0.04
+	0x30, 0x34, 0x34, 0x39, 0x39, 0x39, 0x39, 0x32, 0x37, 0x32, 0x38, 0x32, 0x33, 0x33, 0x33, 0x33, // 0449999272823333
+	0x37, 0x34, 0x30, 0x32, 0x33, 0x34, 0x33, 0x37, 0x35, 0x29, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, // 740234375)));.  
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x39, 0x33, 0x36, 0x20, 0x3d, //           _936 =
+	0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x28, 0x5f, 0x36, 0x33, 0x35, 0x2e, 0x78, 0x2c, 0x20, //  float4(_635.x, 
+	0x5f, 0x36, 0x33, 0x35, 0x2e, 0x79, 0x2c, 0x20, 0x5f, 0x36, 0x33, 0x35, 0x2e, 0x7a, 0x2c, 0x20, // _635.y, _635.z, 
+	0x5f, 0x36, 0x32, 0x30, 0x2e, 0x77, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // _620.w);.       
+	0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x0a, //  }.        else.
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //         {.      
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x39, 0x33, 0x36, 0x20, 0x3d, 0x20, 0x5f, 0x36, 0x32, //       _936 = _62
+	0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, // 0;.        }.   
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x20, 0x5f, 0x39, 0x33, 0x37, //      float4 _937
+	0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x28, 0x5f, // ;.        if ((_
+	0x34, 0x34, 0x37, 0x20, 0x26, 0x20, 0x32, 0x29, 0x20, 0x21, 0x3d, 0x20, 0x30, 0x29, 0x0a, 0x20, // 447 & 2) != 0). 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //        {.       
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x5f, 0x36, 0x30, 0x36, 0x20, //      float _606 
+	0x3d, 0x20, 0x66, 0x61, 0x73, 0x74, 0x3a, 0x3a, 0x63, 0x6c, 0x61, 0x6d, 0x70, 0x28, 0x5f, 0x39, // = fast::clamp(_9
+	0x33, 0x36, 0x2e, 0x77, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x2c, 0x20, 0x31, 0x2e, 0x30, 0x29, 0x3b, // 36.w, 0.0, 1.0);
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, // .            flo
+	0x61, 0x74, 0x34, 0x20, 0x5f, 0x39, 0x31, 0x31, 0x20, 0x3d, 0x20, 0x5f, 0x39, 0x33, 0x36, 0x3b, // at4 _911 = _936;
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x39, 0x31, // .            _91
+	0x31, 0x2e, 0x77, 0x20, 0x3d, 0x20, 0x28, 0x5f, 0x36, 0x30, 0x36, 0x20, 0x2a, 0x20, 0x5f, 0x36, // 1.w = (_606 * _6
+	0x30, 0x36, 0x29, 0x20, 0x2a, 0x20, 0x28, 0x5f, 0x36, 0x30, 0x36, 0x20, 0x2a, 0x20, 0x5f, 0x36, // 06) * (_606 * _6
+	0x30, 0x36, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 06);.           
+	0x20, 0x5f, 0x39, 0x33, 0x37, 0x20, 0x3d, 0x20, 0x5f, 0x39, 0x31, 0x31, 0x3b, 0x0a, 0x20, 0x20, //  _937 = _911;.  
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //       }.        
+	0x65, 0x6c, 0x73, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, // else.        {. 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x39, 0x33, 0x37, 0x20, //            _937 
+	0x3d, 0x20, 0x5f, 0x39, 0x33, 0x36, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // = _936;.        
+	0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, // }.        float4
+	0x20, 0x5f, 0x36, 0x39, 0x37, 0x20, 0x3d, 0x20, 0x73, 0x5f, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x2e, //  _697 = s_input.
+	0x72, 0x65, 0x61, 0x64, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x32, 0x28, 0x69, 0x6e, 0x74, 0x32, 0x28, // read(uint2(int2(
+	0x5f, 0x34, 0x36, 0x30, 0x2c, 0x20, 0x5f, 0x34, 0x36, 0x36, 0x29, 0x29, 0x2c, 0x20, 0x30, 0x29, // _460, _466)), 0)
+	0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, // ;.        float4
+	0x20, 0x5f, 0x39, 0x33, 0x38, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, //  _938;.        i
+	0x66, 0x20, 0x28, 0x28, 0x5f, 0x34, 0x34, 0x37, 0x20, 0x26, 0x20, 0x31, 0x29, 0x20, 0x21, 0x3d, // f ((_447 & 1) !=
+	0x20, 0x30, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, //  0).        {.  
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, //           float3
+	0x20, 0x5f, 0x36, 0x35, 0x39, 0x20, 0x3d, 0x20, 0x66, 0x61, 0x73, 0x74, 0x3a, 0x3a, 0x63, 0x6c, //  _659 = fast::cl
+	0x61, 0x6d, 0x70, 0x28, 0x5f, 0x36, 0x39, 0x37, 0x2e, 0x78, 0x79, 0x7a, 0x2c, 0x20, 0x66, 0x6c, // amp(_697.xyz, fl
+	0x6f, 0x61, 0x74, 0x33, 0x28, 0x30, 0x2e, 0x30, 0x29, 0x2c, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, // oat3(0.0), float
+	0x33, 0x28, 0x31, 0x2e, 0x30, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 3(1.0));.       
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x20, 0x5f, 0x37, 0x31, 0x32, //      float3 _712
+	0x20, 0x3d, 0x20, 0x6d, 0x69, 0x78, 0x28, 0x70, 0x6f, 0x77, 0x28, 0x28, 0x5f, 0x36, 0x35, 0x39, //  = mix(pow((_659
+	0x20, 0x2b, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x28, 0x30, 0x2e, 0x30, 0x35, 0x34, 0x39, //  + float3(0.0549
+	0x39, 0x39, 0x39, 0x39, 0x39, 0x37, 0x30, 0x31, 0x39, 0x37, 0x36, 0x37, 0x37, 0x36, 0x31, 0x32, // 9999970197677612
+	0x33, 0x30, 0x34, 0x36, 0x38, 0x37, 0x35, 0x29, 0x29, 0x20, 0x2a, 0x20, 0x66, 0x6c, 0x6f, 0x61, // 3046875)) * floa
+	0x74, 0x33, 0x28, 0x30, 0x2e, 0x39, 0x34, 0x37, 0x38, 0x36, 0x37, 0x33, 0x33, 0x33, 0x38, 0x38, // t3(0.94786733388
+	0x39, 0x30, 0x30, 0x37, 0x35, 0x36, 0x38, 0x33, 0x35, 0x39, 0x33, 0x37, 0x35, 0x29, 0x2c, 0x20, // 9007568359375), 
+	0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x28, 0x32, 0x2e, 0x34, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, // float3(2.4000000
+	0x39, 0x35, 0x33, 0x36, 0x37, 0x34, 0x33, 0x31, 0x36, 0x34, 0x30, 0x36, 0x32, 0x35, 0x29, 0x29, // 95367431640625))
+	0x2c, 0x20, 0x5f, 0x36, 0x35, 0x39, 0x20, 0x2a, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x28, // , _659 * float3(
+	0x30, 0x2e, 0x30, 0x37, 0x37, 0x33, 0x39, 0x39, 0x33, 0x38, 0x30, 0x35, 0x30, 0x35, 0x30, 0x38, // 0.07739938050508
+	0x34, 0x39, 0x39, 0x31, 0x34, 0x35, 0x35, 0x30, 0x37, 0x38, 0x31, 0x32, 0x35, 0x29, 0x2c, 0x20, // 4991455078125), 
+	0x73, 0x74, 0x65, 0x70, 0x28, 0x5f, 0x36, 0x35, 0x39, 0x2c, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, // step(_659, float
+	0x33, 0x28, 0x30, 0x2e, 0x30, 0x34, 0x30, 0x34, 0x34, 0x39, 0x39, 0x39, 0x39, 0x32, 0x37, 0x32, // 3(0.040449999272
+	0x38, 0x32, 0x33, 0x33, 0x33, 0x33, 0x37, 0x34, 0x30, 0x32, 0x33, 0x34, 0x33, 0x37, 0x35, 0x29, // 823333740234375)
+	0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // ));.            
+	0x5f, 0x39, 0x33, 0x38, 0x20, 0x3d, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x28, 0x5f, 0x37, // _938 = float4(_7
+	0x31, 0x32, 0x2e, 0x78, 0x2c, 0x20, 0x5f, 0x37, 0x31, 0x32, 0x2e, 0x79, 0x2c, 0x20, 0x5f, 0x37, // 12.x, _712.y, _7
+	0x31, 0x32, 0x2e, 0x7a, 0x2c, 0x20, 0x5f, 0x36, 0x39, 0x37, 0x2e, 0x77, 0x29, 0x3b, 0x0a, 0x20, // 12.z, _697.w);. 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //        }.       
+	0x20, 0x65, 0x6c, 0x73, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, //  else.        {.
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x39, 0x33, 0x38, //             _938
+	0x20, 0x3d, 0x20, 0x5f, 0x36, 0x39, 0x37, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //  = _697;.       
+	0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, //  }.        float
+	0x34, 0x20, 0x5f, 0x39, 0x33, 0x39, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 4 _939;.        
+	0x69, 0x66, 0x20, 0x28, 0x28, 0x5f, 0x34, 0x34, 0x37, 0x20, 0x26, 0x20, 0x32, 0x29, 0x20, 0x21, // if ((_447 & 2) !
+	0x3d, 0x20, 0x30, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, // = 0).        {. 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, //            float
+	0x20, 0x5f, 0x36, 0x38, 0x33, 0x20, 0x3d, 0x20, 0x66, 0x61, 0x73, 0x74, 0x3a, 0x3a, 0x63, 0x6c, //  _683 = fast::cl
+	0x61, 0x6d, 0x70, 0x28, 0x5f, 0x39, 0x33, 0x38, 0x2e, 0x77, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x2c, // amp(_938.w, 0.0,
+	0x20, 0x31, 0x2e, 0x30, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //  1.0);.         
+	0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x20, 0x5f, 0x39, 0x31, 0x34, 0x20, 0x3d, //    float4 _914 =
+	0x20, 0x5f, 0x39, 0x33, 0x38, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //  _938;.         
+	0x20, 0x20, 0x20, 0x5f, 0x39, 0x31, 0x34, 0x2e, 0x77, 0x20, 0x3d, 0x20, 0x28, 0x5f, 0x36, 0x38, //    _914.w = (_68
+	0x33, 0x20, 0x2a, 0x20, 0x5f, 0x36, 0x38, 0x33, 0x29, 0x20, 0x2a, 0x20, 0x28, 0x5f, 0x36, 0x38, // 3 * _683) * (_68
+	0x33, 0x20, 0x2a, 0x20, 0x5f, 0x36, 0x38, 0x33, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, // 3 * _683);.     
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x39, 0x33, 0x39, 0x20, 0x3d, 0x20, 0x5f, 0x39, //        _939 = _9
+	0x31, 0x34, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, // 14;.        }.  
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, //       else.     
+	0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //    {.           
+	0x20, 0x5f, 0x39, 0x33, 0x39, 0x20, 0x3d, 0x20, 0x5f, 0x39, 0x33, 0x38, 0x3b, 0x0a, 0x20, 0x20, //  _939 = _938;.  
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //       }.        
+	0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x20, 0x5f, 0x34, 0x38, 0x32, 0x20, 0x3d, 0x20, 0x5f, 0x39, // float4 _482 = _9
+	0x33, 0x37, 0x20, 0x2b, 0x20, 0x5f, 0x39, 0x33, 0x39, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, // 37 + _939;.     
+	0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x20, 0x5f, 0x37, 0x37, 0x34, 0x20, 0x3d, //    float4 _774 =
+	0x20, 0x73, 0x5f, 0x69, 0x6e, 0x70, 0x75, 0x74, 0x2e, 0x72, 0x65, 0x61, 0x64, 0x28, 0x75, 0x69, //  s_input.read(ui
+	0x6e, 0x74, 0x32, 0x28, 0x69, 0x6e, 0x74, 0x32, 0x28, 0x5f, 0x34, 0x35, 0x33, 0x2c, 0x20, 0x5f, // nt2(int2(_453, _
+	0x34, 0x37, 0x33, 0x29, 0x29, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, // 473)), 0);.     
+	0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x20, 0x5f, 0x39, 0x34, 0x30, 0x3b, 0x0a, //    float4 _940;.
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x28, 0x5f, 0x34, 0x34, //         if ((_44
+	0x37, 0x20, 0x26, 0x20, 0x31, 0x29, 0x20, 0x21, 0x3d, 0x20, 0x30, 0x29, 0x0a, 0x20, 0x20, 0x20, // 7 & 1) != 0).   
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //      {.         
+	0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x20, 0x5f, 0x37, 0x33, 0x36, 0x20, 0x3d, //    float3 _736 =
+	0x20, 0x66, 0x61, 0x73, 0x74, 0x3a, 0x3a, 0x63, 0x6c, 0x61, 0x6d, 0x70, 0x28, 0x5f, 0x37, 0x37, //  fast::clamp(_77
+	0x34, 0x2e, 0x78, 0x79, 0x7a, 0x2c, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x28, 0x30, 0x2e, // 4.xyz, float3(0.
+	0x30, 0x29, 0x2c, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x28, 0x31, 0x2e, 0x30, 0x29, 0x29, // 0), float3(1.0))
+	0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, // ;.            fl
+	0x6f, 0x61, 0x74, 0x33, 0x20, 0x5f, 0x37, 0x38, 0x39, 0x20, 0x3d, 0x20, 0x6d, 0x69, 0x78, 0x28, // oat3 _789 = mix(
+	0x70, 0x6f, 0x77, 0x28, 0x28, 0x5f, 0x37, 0x33, 0x36, 0x20, 0x2b, 0x20, 0x66, 0x6c, 0x6f, 0x61, // pow((_736 + floa
+	0x74, 0x33, 0x28, 0x30, 0x2e, 0x30, 0x35, 0x34, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x37, 0x30, // t3(0.05499999970
+	0x31, 0x39, 0x37, 0x36, 0x37, 0x37, 0x36, 0x31, 0x32, 0x33, 0x30, 0x34, 0x36, 0x38, 0x37, 0x35, // 1976776123046875
+	0x29, 0x29, 0x20, 0x2a, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x28, 0x30, 0x2e, 0x39, 0x34, // )) * float3(0.94
+	0x37, 0x38, 0x36, 0x37, 0x33, 0x33, 0x33, 0x38, 0x38, 0x39, 0x30, 0x30, 0x37, 0x35, 0x36, 0x38, // 7867333889007568
+	0x33, 0x35, 0x39, 0x33, 0x37, 0x35, 0x29, 0x2c, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x28, // 359375), float3(
+	0x32, 0x2e, 0x34, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x39, 0x35, 0x33, 0x36, 0x37, 0x34, 0x33, // 2.40000009536743
+	0x31, 0x36, 0x34, 0x30, 0x36, 0x32, 0x35, 0x29, 0x29, 0x2c, 0x20, 0x5f, 0x37, 0x33, 0x36, 0x20, // 1640625)), _736 
+	0x2a, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x28, 0x30, 0x2e, 0x30, 0x37, 0x37, 0x33, 0x39, // * float3(0.07739
+	0x39, 0x33, 0x38, 0x30, 0x35, 0x30, 0x35, 0x30, 0x38, 0x34, 0x39, 0x39, 0x31, 0x34, 0x35, 0x35, // 9380505084991455
+	0x30, 0x37, 0x38, 0x31, 0x32, 0x35, 0x29, 0x2c, 0x20, 0x73, 0x74, 0x65, 0x70, 0x28, 0x5f, 0x37, // 078125), step(_7
+	0x33, 0x36, 0x2c, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x28, 0x30, 0x2e, 0x30, 0x34, 0x30, // 36, float3(0.040
+	0x34, 0x34, 0x39, 0x39, 0x39, 0x39, 0x32, 0x37, 0x32, 0x38, 0x32, 0x33, 0x33, 0x33, 0x33, 0x37, // 4499992728233337
+	0x34, 0x30, 0x32, 0x33, 0x34, 0x33, 0x37, 0x35, 0x29, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, // 40234375)));.   
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x39, 0x34, 0x30, 0x20, 0x3d, 0x20, //          _940 = 
+	0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x28, 0x5f, 0x37, 0x38, 0x39, 0x2e, 0x78, 0x2c, 0x20, 0x5f, // float4(_789.x, _
+	0x37, 0x38, 0x39, 0x2e, 0x79, 0x2c, 0x20, 0x5f, 0x37, 0x38, 0x39, 0x2e, 0x7a, 0x2c, 0x20, 0x5f, // 789.y, _789.z, _
+	0x37, 0x37, 0x34, 0x2e, 0x77, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 774.w);.        
+	0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x0a, 0x20, // }.        else. 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //        {.       
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x39, 0x34, 0x30, 0x20, 0x3d, 0x20, 0x5f, 0x37, 0x37, 0x34, //      _940 = _774
+	0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, // ;.        }.    
+	0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x20, 0x5f, 0x39, 0x34, 0x31, 0x3b, //     float4 _941;
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x28, 0x5f, 0x34, // .        if ((_4
+	0x34, 0x37, 0x20, 0x26, 0x20, 0x32, 0x29, 0x20, 0x21, 0x3d, 0x20, 0x30, 0x29, 0x0a, 0x20, 0x20, // 47 & 2) != 0).  
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //       {.        
+	0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x5f, 0x37, 0x36, 0x30, 0x20, 0x3d, //     float _760 =
+	0x20, 0x66, 0x61, 0x73, 0x74, 0x3a, 0x3a, 0x63, 0x6c, 0x61, 0x6d, 0x70, 0x28, 0x5f, 0x39, 0x34, //  fast::clamp(_94
+	0x30, 0x2e, 0x77, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x2c, 0x20, 0x31, 0x2e, 0x30, 0x29, 0x3b, 0x0a, // 0.w, 0.0, 1.0);.
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, //             floa
+	0x74, 0x34, 0x20, 0x5f, 0x39, 0x31, 0x37, 0x20, 0x3d, 0x20, 0x5f, 0x39, 0x34, 0x30, 0x3b, 0x0a, // t4 _917 = _940;.
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x39, 0x31, 0x37, //             _917
+	0x2e, 0x77, 0x20, 0x3d, 0x20, 0x28, 0x5f, 0x37, 0x36, 0x30, 0x20, 0x2a, 0x20, 0x5f, 0x37, 0x36, // .w = (_760 * _76
+	0x30, 0x29, 0x20, 0x2a, 0x20, 0x28, 0x5f, 0x37, 0x36, 0x30, 0x20, 0x2a, 0x20, 0x5f, 0x37, 0x36, // 0) * (_760 * _76
+	0x30, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 0);.            
+	0x5f, 0x39, 0x34, 0x31, 0x20, 0x3d, 0x20, 0x5f, 0x39, 0x31, 0x37, 0x3b, 0x0a, 0x20, 0x20, 0x20, // _941 = _917;.   
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, //      }.        e
+	0x6c, 0x73, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, // lse.        {.  
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x39, 0x34, 0x31, 0x20, 0x3d, //           _941 =
+	0x20, 0x5f, 0x39, 0x34, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, //  _940;.        }
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x20, // .        float4 
+	0x5f, 0x34, 0x38, 0x37, 0x20, 0x3d, 0x20, 0x5f, 0x34, 0x38, 0x32, 0x20, 0x2b, 0x20, 0x5f, 0x39, // _487 = _482 + _9
+	0x34, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, // 41;.        floa
+	0x74, 0x34, 0x20, 0x5f, 0x38, 0x35, 0x31, 0x20, 0x3d, 0x20, 0x73, 0x5f, 0x69, 0x6e, 0x70, 0x75, // t4 _851 = s_inpu
+	0x74, 0x2e, 0x72, 0x65, 0x61, 0x64, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x32, 0x28, 0x69, 0x6e, 0x74, // t.read(uint2(int
+	0x32, 0x28, 0x5f, 0x34, 0x36, 0x30, 0x2c, 0x20, 0x5f, 0x34, 0x37, 0x33, 0x29, 0x29, 0x2c, 0x20, // 2(_460, _473)), 
+	0x30, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, // 0);.        floa
+	0x74, 0x34, 0x20, 0x5f, 0x39, 0x34, 0x32, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // t4 _942;.       
+	0x20, 0x69, 0x66, 0x20, 0x28, 0x28, 0x5f, 0x34, 0x34, 0x37, 0x20, 0x26, 0x20, 0x31, 0x29, 0x20, //  if ((_447 & 1) 
+	0x21, 0x3d, 0x20, 0x30, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, // != 0).        {.
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, //             floa
+	0x74, 0x33, 0x20, 0x5f, 0x38, 0x31, 0x33, 0x20, 0x3d, 0x20, 0x66, 0x61, 0x73, 0x74, 0x3a, 0x3a, // t3 _813 = fast::
+	0x63, 0x6c, 0x61, 0x6d, 0x70, 0x28, 0x5f, 0x38, 0x35, 0x31, 0x2e, 0x78, 0x79, 0x7a, 0x2c, 0x20, // clamp(_851.xyz, 
+	0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x28, 0x30, 0x2e, 0x30, 0x29, 0x2c, 0x20, 0x66, 0x6c, 0x6f, // float3(0.0), flo
+	0x61, 0x74, 0x33, 0x28, 0x31, 0x2e, 0x30, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, // at3(1.0));.     
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x20, 0x5f, 0x38, //        float3 _8
+	0x36, 0x36, 0x20, 0x3d, 0x20, 0x6d, 0x69, 0x78, 0x28, 0x70, 0x6f, 0x77, 0x28, 0x28, 0x5f, 0x38, // 66 = mix(pow((_8
+	0x31, 0x33, 0x20, 0x2b, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x28, 0x30, 0x2e, 0x30, 0x35, // 13 + float3(0.05
+	0x34, 0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x37, 0x30, 0x31, 0x39, 0x37, 0x36, 0x37, 0x37, 0x36, // 4999999701976776
+	0x31, 0x32, 0x33, 0x30, 0x34, 0x36, 0x38, 0x37, 0x35, 0x29, 0x29, 0x20, 0x2a, 0x20, 0x66, 0x6c, // 123046875)) * fl
+	0x6f, 0x61, 0x74, 0x33, 0x28, 0x30, 0x2e, 0x39, 0x34, 0x37, 0x38, 0x36, 0x37, 0x33, 0x33, 0x33, // oat3(0.947867333
+	0x38, 0x38, 0x39, 0x30, 0x30, 0x37, 0x35, 0x36, 0x38, 0x33, 0x35, 0x39, 0x33, 0x37, 0x35, 0x29, // 889007568359375)
+	0x2c, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x28, 0x32, 0x2e, 0x34, 0x30, 0x30, 0x30, 0x30, // , float3(2.40000
+	0x30, 0x30, 0x39, 0x35, 0x33, 0x36, 0x37, 0x34, 0x33, 0x31, 0x36, 0x34, 0x30, 0x36, 0x32, 0x35, // 0095367431640625
+	0x29, 0x29, 0x2c, 0x20, 0x5f, 0x38, 0x31, 0x33, 0x20, 0x2a, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, // )), _813 * float
+	0x33, 0x28, 0x30, 0x2e, 0x30, 0x37, 0x37, 0x33, 0x39, 0x39, 0x33, 0x38, 0x30, 0x35, 0x30, 0x35, // 3(0.077399380505
+	0x30, 0x38, 0x34, 0x39, 0x39, 0x31, 0x34, 0x35, 0x35, 0x30, 0x37, 0x38, 0x31, 0x32, 0x35, 0x29, // 084991455078125)
+	0x2c, 0x20, 0x73, 0x74, 0x65, 0x70, 0x28, 0x5f, 0x38, 0x31, 0x33, 0x2c, 0x20, 0x66, 0x6c, 0x6f, // , step(_813, flo
+	0x61, 0x74, 0x33, 0x28, 0x30, 0x2e, 0x30, 0x34, 0x30, 0x34, 0x34, 0x39, 0x39, 0x39, 0x39, 0x32, // at3(0.0404499992
+	0x37, 0x32, 0x38, 0x32, 0x33, 0x33, 0x33, 0x33, 0x37, 0x34, 0x30, 0x32, 0x33, 0x34, 0x33, 0x37, // 7282333374023437
+	0x35, 0x29, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 5)));.          
+	0x20, 0x20, 0x5f, 0x39, 0x34, 0x32, 0x20, 0x3d, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x28, //   _942 = float4(
+	0x5f, 0x38, 0x36, 0x36, 0x2e, 0x78, 0x2c, 0x20, 0x5f, 0x38, 0x36, 0x36, 0x2e, 0x79, 0x2c, 0x20, // _866.x, _866.y, 
+	0x5f, 0x38, 0x36, 0x36, 0x2e, 0x7a, 0x2c, 0x20, 0x5f, 0x38, 0x35, 0x31, 0x2e, 0x77, 0x29, 0x3b, // _866.z, _851.w);
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, // .        }.     
+	0x20, 0x20, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //    else.        
+	0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x39, // {.            _9
+	0x34, 0x32, 0x20, 0x3d, 0x20, 0x5f, 0x38, 0x35, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, // 42 = _851;.     
+	0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, //    }.        flo
+	0x61, 0x74, 0x34, 0x20, 0x5f, 0x39, 0x34, 0x33, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // at4 _943;.      
+	0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x28, 0x5f, 0x34, 0x34, 0x37, 0x20, 0x26, 0x20, 0x32, 0x29, //   if ((_447 & 2)
+	0x20, 0x21, 0x3d, 0x20, 0x30, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, //  != 0).        {
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, // .            flo
+	0x61, 0x74, 0x20, 0x5f, 0x38, 0x33, 0x37, 0x20, 0x3d, 0x20, 0x66, 0x61, 0x73, 0x74, 0x3a, 0x3a, // at _837 = fast::
+	0x63, 0x6c, 0x61, 0x6d, 0x70, 0x28, 0x5f, 0x39, 0x34, 0x32, 0x2e, 0x77, 0x2c, 0x20, 0x30, 0x2e, // clamp(_942.w, 0.
+	0x30, 0x2c, 0x20, 0x31, 0x2e, 0x30, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 0, 1.0);.       
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x20, 0x5f, 0x39, 0x32, 0x30, //      float4 _920
+	0x20, 0x3d, 0x20, 0x5f, 0x39, 0x34, 0x32, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //  = _942;.       
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x39, 0x32, 0x30, 0x2e, 0x77, 0x20, 0x3d, 0x20, 0x28, 0x5f, //      _920.w = (_
+	0x38, 0x33, 0x37, 0x20, 0x2a, 0x20, 0x5f, 0x38, 0x33, 0x37, 0x29, 0x20, 0x2a, 0x20, 0x28, 0x5f, // 837 * _837) * (_
+	0x38, 0x33, 0x37, 0x20, 0x2a, 0x20, 0x5f, 0x38, 0x33, 0x37, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, // 837 * _837);.   
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x39, 0x34, 0x33, 0x20, 0x3d, 0x20, //          _943 = 
+	0x5f, 0x39, 0x32, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, // _920;.        }.
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x0a, 0x20, 0x20, 0x20, //         else.   
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //      {.         
+	0x20, 0x20, 0x20, 0x5f, 0x39, 0x34, 0x33, 0x20, 0x3d, 0x20, 0x5f, 0x39, 0x34, 0x32, 0x3b, 0x0a, //    _943 = _942;.
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //         }.      
+	0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x20, 0x5f, 0x34, 0x39, 0x32, 0x20, 0x3d, 0x20, //   float4 _492 = 
+	0x5f, 0x34, 0x38, 0x37, 0x20, 0x2b, 0x20, 0x5f, 0x39, 0x34, 0x33, 0x3b, 0x0a, 0x20, 0x20, 0x20, // _487 + _943;.   
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x20, 0x5f, 0x34, 0x39, 0x33, //      float4 _493
+	0x20, 0x3d, 0x20, 0x5f, 0x34, 0x39, 0x32, 0x20, 0x2a, 0x20, 0x30, 0x2e, 0x32, 0x35, 0x3b, 0x0a, //  = _492 * 0.25;.
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x20, 0x5f, //         float4 _
+	0x39, 0x34, 0x34, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, // 944;.        if 
+	0x28, 0x28, 0x5f, 0x34, 0x34, 0x37, 0x20, 0x26, 0x20, 0x31, 0x29, 0x20, 0x21, 0x3d, 0x20, 0x30, // ((_447 & 1) != 0
+	0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, // ).        {.    
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x20, 0x5f, //         float3 _
+	0x35, 0x30, 0x31, 0x20, 0x3d, 0x20, 0x66, 0x61, 0x73, 0x74, 0x3a, 0x3a, 0x63, 0x6c, 0x61, 0x6d, // 501 = fast::clam
+	0x70, 0x28, 0x5f, 0x34, 0x39, 0x33, 0x2e, 0x78, 0x79, 0x7a, 0x2c, 0x20, 0x66, 0x6c, 0x6f, 0x61, // p(_493.xyz, floa
+	0x74, 0x33, 0x28, 0x30, 0x2e, 0x30, 0x29, 0x2c, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x28, // t3(0.0), float3(
+	0x31, 0x2e, 0x30, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // 1.0));.         
+	0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x20, 0x5f, 0x38, 0x38, 0x31, 0x20, 0x3d, //    float3 _881 =
+	0x20, 0x6d, 0x69, 0x78, 0x28, 0x28, 0x70, 0x6f, 0x77, 0x28, 0x5f, 0x35, 0x30, 0x31, 0x2c, 0x20, //  mix((pow(_501, 
+	0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x28, 0x30, 0x2e, 0x34, 0x31, 0x36, 0x36, 0x36, 0x36, 0x36, // float3(0.4166666
+	0x35, 0x36, 0x37, 0x33, 0x32, 0x35, 0x35, 0x39, 0x32, 0x30, 0x34, 0x31, 0x30, 0x31, 0x35, 0x36, // 5673255920410156
+	0x32, 0x35, 0x29, 0x29, 0x20, 0x2a, 0x20, 0x31, 0x2e, 0x30, 0x35, 0x34, 0x39, 0x39, 0x39, 0x39, // 25)) * 1.0549999
+	0x34, 0x37, 0x35, 0x34, 0x37, 0x39, 0x31, 0x32, 0x35, 0x39, 0x37, 0x36, 0x35, 0x36, 0x32, 0x35, // 4754791259765625
+	0x29, 0x20, 0x2d, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x28, 0x30, 0x2e, 0x30, 0x35, 0x34, // ) - float3(0.054
+	0x39, 0x39, 0x39, 0x39, 0x39, 0x39, 0x37, 0x30, 0x31, 0x39, 0x37, 0x36, 0x37, 0x37, 0x36, 0x31, // 9999997019767761
+	0x32, 0x33, 0x30, 0x34, 0x36, 0x38, 0x37, 0x35, 0x29, 0x2c, 0x20, 0x5f, 0x35, 0x30, 0x31, 0x20, // 23046875), _501 
+	0x2a, 0x20, 0x31, 0x32, 0x2e, 0x39, 0x32, 0x30, 0x30, 0x30, 0x30, 0x30, 0x37, 0x36, 0x32, 0x39, // * 12.92000007629
+	0x33, 0x39, 0x34, 0x35, 0x33, 0x31, 0x32, 0x35, 0x2c, 0x20, 0x73, 0x74, 0x65, 0x70, 0x28, 0x5f, // 39453125, step(_
+	0x35, 0x30, 0x31, 0x2c, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x28, 0x30, 0x2e, 0x30, 0x30, // 501, float3(0.00
+	0x33, 0x31, 0x33, 0x30, 0x38, 0x30, 0x30, 0x30, 0x39, 0x30, 0x37, 0x33, 0x30, 0x31, 0x39, 0x30, // 3130800090730190
+	0x32, 0x37, 0x37, 0x30, 0x39, 0x39, 0x36, 0x30, 0x39, 0x33, 0x37, 0x35, 0x29, 0x29, 0x29, 0x3b, // 277099609375)));
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x39, 0x34, // .            _94
+	0x34, 0x20, 0x3d, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x28, 0x5f, 0x38, 0x38, 0x31, 0x2e, // 4 = float4(_881.
+	0x78, 0x2c, 0x20, 0x5f, 0x38, 0x38, 0x31, 0x2e, 0x79, 0x2c, 0x20, 0x5f, 0x38, 0x38, 0x31, 0x2e, // x, _881.y, _881.
+	0x7a, 0x2c, 0x20, 0x5f, 0x34, 0x39, 0x33, 0x2e, 0x77, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, // z, _493.w);.    
+	0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6c, //     }.        el
+	0x73, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, // se.        {.   
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x39, 0x34, 0x34, 0x20, 0x3d, 0x20, //          _944 = 
+	0x5f, 0x34, 0x39, 0x33, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, // _493;.        }.
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x20, 0x5f, //         float4 _
+	0x39, 0x34, 0x35, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, // 945;.        if 
+	0x28, 0x28, 0x5f, 0x34, 0x34, 0x37, 0x20, 0x26, 0x20, 0x32, 0x29, 0x20, 0x21, 0x3d, 0x20, 0x30, // ((_447 & 2) != 0
+	0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, // ).        {.    
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x20, 0x5f, //         float4 _
+	0x39, 0x32, 0x33, 0x20, 0x3d, 0x20, 0x5f, 0x39, 0x34, 0x34, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, // 923 = _944;.    
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x39, 0x32, 0x33, 0x2e, 0x77, 0x20, 0x3d, //         _923.w =
+	0x20, 0x73, 0x71, 0x72, 0x74, 0x28, 0x73, 0x71, 0x72, 0x74, 0x28, 0x66, 0x61, 0x73, 0x74, 0x3a, //  sqrt(sqrt(fast:
+	0x3a, 0x63, 0x6c, 0x61, 0x6d, 0x70, 0x28, 0x5f, 0x39, 0x34, 0x34, 0x2e, 0x77, 0x2c, 0x20, 0x30, // :clamp(_944.w, 0
+	0x2e, 0x30, 0x2c, 0x20, 0x31, 0x2e, 0x30, 0x29, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, // .0, 1.0)));.    
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x39, 0x34, 0x35, 0x20, 0x3d, 0x20, 0x5f, //         _945 = _
+	0x39, 0x32, 0x33, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, // 923;.        }. 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, //        else.    
+	0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //     {.          
+	0x20, 0x20, 0x5f, 0x39, 0x34, 0x35, 0x20, 0x3d, 0x20, 0x5f, 0x39, 0x34, 0x34, 0x3b, 0x0a, 0x20, //   _945 = _944;. 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //        }.       
+	0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x20, 0x5f, 0x39, 0x34, 0x36, 0x3b, 0x0a, 0x20, 0x20, //  float4 _946;.  
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x28, 0x5f, 0x34, 0x34, 0x37, 0x20, //       if ((_447 
+	0x26, 0x20, 0x34, 0x29, 0x20, 0x21, 0x3d, 0x20, 0x30, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, // & 4) != 0).     
+	0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //    {.           
+	0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x20, 0x5f, 0x35, 0x33, 0x36, 0x20, 0x3d, 0x20, 0x28, //  float3 _536 = (
+	0x5f, 0x39, 0x34, 0x35, 0x2e, 0x78, 0x79, 0x7a, 0x20, 0x2a, 0x20, 0x32, 0x2e, 0x30, 0x29, 0x20, // _945.xyz * 2.0) 
+	0x2d, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x28, 0x31, 0x2e, 0x30, 0x29, 0x3b, 0x0a, 0x20, // - float3(1.0);. 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, //            float
+	0x20, 0x5f, 0x35, 0x33, 0x39, 0x20, 0x3d, 0x20, 0x64, 0x6f, 0x74, 0x28, 0x5f, 0x35, 0x33, 0x36, //  _539 = dot(_536
+	0x2c, 0x20, 0x5f, 0x35, 0x33, 0x36, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // , _536);.       
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x20, 0x5f, 0x35, 0x34, 0x35, //      float3 _545
+	0x20, 0x3d, 0x20, 0x5f, 0x35, 0x33, 0x36, 0x20, 0x2a, 0x20, 0x72, 0x73, 0x71, 0x72, 0x74, 0x28, //  = _536 * rsqrt(
+	0x5f, 0x35, 0x33, 0x39, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // _539);.         
+	0x20, 0x20, 0x20, 0x62, 0x6f, 0x6f, 0x6c, 0x33, 0x20, 0x5f, 0x35, 0x34, 0x37, 0x20, 0x3d, 0x20, //    bool3 _547 = 
+	0x62, 0x6f, 0x6f, 0x6c, 0x33, 0x28, 0x5f, 0x35, 0x33, 0x39, 0x20, 0x3e, 0x20, 0x30, 0x2e, 0x30, // bool3(_539 > 0.0
+	0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, // );.            f
+	0x6c, 0x6f, 0x61, 0x74, 0x33, 0x20, 0x5f, 0x35, 0x35, 0x32, 0x20, 0x3d, 0x20, 0x28, 0x66, 0x6c, // loat3 _552 = (fl
+	0x6f, 0x61, 0x74, 0x33, 0x28, 0x5f, 0x35, 0x34, 0x37, 0x2e, 0x78, 0x20, 0x3f, 0x20, 0x5f, 0x35, // oat3(_547.x ? _5
+	0x34, 0x35, 0x2e, 0x78, 0x20, 0x3a, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x28, 0x30, 0x2e, // 45.x : float3(0.
+	0x30, 0x29, 0x2e, 0x78, 0x2c, 0x20, 0x5f, 0x35, 0x34, 0x37, 0x2e, 0x79, 0x20, 0x3f, 0x20, 0x5f, // 0).x, _547.y ? _
+	0x35, 0x34, 0x35, 0x2e, 0x79, 0x20, 0x3a, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x28, 0x30, // 545.y : float3(0
+	0x2e, 0x30, 0x29, 0x2e, 0x79, 0x2c, 0x20, 0x5f, 0x35, 0x34, 0x37, 0x2e, 0x7a, 0x20, 0x3f, 0x20, // .0).y, _547.z ? 
+	0x5f, 0x35, 0x34, 0x35, 0x2e, 0x7a, 0x20, 0x3a, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x28, // _545.z : float3(
+	0x30, 0x2e, 0x30, 0x29, 0x2e, 0x7a, 0x29, 0x20, 0x2a, 0x20, 0x30, 0x2e, 0x35, 0x29, 0x20, 0x2b, // 0.0).z) * 0.5) +
+	0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x28, 0x30, 0x2e, 0x35, 0x29, 0x3b, 0x0a, 0x20, 0x20, //  float3(0.5);.  
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x39, 0x34, 0x36, 0x20, 0x3d, //           _946 =
+	0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x28, 0x5f, 0x35, 0x35, 0x32, 0x2e, 0x78, 0x2c, 0x20, //  float4(_552.x, 
+	0x5f, 0x35, 0x35, 0x32, 0x2e, 0x79, 0x2c, 0x20, 0x5f, 0x35, 0x35, 0x32, 0x2e, 0x7a, 0x2c, 0x20, // _552.y, _552.z, 
+	0x5f, 0x39, 0x34, 0x35, 0x2e, 0x77, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // _945.w);.       
+	0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x0a, //  }.        else.
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //         {.      
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x39, 0x34, 0x36, 0x20, 0x3d, 0x20, 0x5f, 0x39, 0x34, //       _946 = _94
+	0x35, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, // 5;.        }.   
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x5f, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x54, 0x65, 0x78, //      s_outputTex
+	0x74, 0x75, 0x72, 0x65, 0x2e, 0x77, 0x72, 0x69, 0x74, 0x65, 0x28, 0x5f, 0x39, 0x34, 0x36, 0x2c, // ture.write(_946,
+	0x20, 0x75, 0x69, 0x6e, 0x74, 0x32, 0x28, 0x69, 0x6e, 0x74, 0x33, 0x28, 0x67, 0x6c, 0x5f, 0x47, //  uint2(int3(gl_G
+	0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x49, 0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x49, // lobalInvocationI
+	0x44, 0x29, 0x2e, 0x78, 0x79, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // D).xy));.       
+	0x20, 0x62, 0x72, 0x65, 0x61, 0x6b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x7d, 0x0a, //  break;.    }.}.
+	0x0a, 0x00, 0x00, 0x10, 0x00,                                                                   // .....
+};
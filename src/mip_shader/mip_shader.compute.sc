@@ -0,0 +1,65 @@
+#include <bgfx_compute.sh>
+
+IMAGE2D_RO(s_input, rgba32f, 0);
+IMAGE2D_WR(s_output, rgba32f, 1);
+
+uniform vec4 u_settings;
+
+#define u_input_width u_settings.x
+#define u_input_height u_settings.y
+#define u_flags u_settings.z
+
+// Same as `MipFilterOptions`.
+#define FLAG_SRGB 1
+#define FLAG_ALPHA_ROUGHNESS 2
+#define FLAG_NORMAL_MAP 4
+
+// Texel of the previous mip level in the space it's filtered in, like `LevelFilter::gather_rows`.
+vec4 load_texel(int x, int y, int flags) {
+    vec4 texel = imageLoad(s_input, ivec2(x, y));
+    if ((flags & FLAG_SRGB) != 0) {
+        vec3 value = clamp(texel.rgb, 0.0, 1.0);
+        texel.rgb = mix(pow((value + 0.055) / 1.055, vec3_splat(2.4)), value / 12.92, step(value, vec3_splat(0.04045)));
+    }
+    if ((flags & FLAG_ALPHA_ROUGHNESS) != 0) {
+        float roughness = clamp(texel.a, 0.0, 1.0);
+        texel.a = (roughness * roughness) * (roughness * roughness);
+    }
+    return texel;
+}
+
+// Averages the 2x2 quad of the previous mip level under a texel of the next one, which is what `build_next_mip_level`
+// does with the box filter for sides that are even or one, converts it back and renormalizes normals like
+// `renormalize_packed_normals`.
+NUM_THREADS(8, 8, 1)
+void main() {
+    int input_width = int(u_input_width);
+    int input_height = int(u_input_height);
+    ivec2 texel = ivec2(gl_GlobalInvocationID.xy);
+    if (texel.x >= max(input_width / 2, 1) || texel.y >= max(input_height / 2, 1)) {
+        return;
+    }
+
+    int flags = int(u_flags);
+    int x0 = min(texel.x * 2, input_width - 1);
+    int x1 = min(texel.x * 2 + 1, input_width - 1);
+    int y0 = min(texel.y * 2, input_height - 1);
+    int y1 = min(texel.y * 2 + 1, input_height - 1);
+    vec4 result = (load_texel(x0, y0, flags) + load_texel(x1, y0, flags) + load_texel(x0, y1, flags) + load_texel(x1, y1, flags)) * 0.25;
+
+    if ((flags & FLAG_SRGB) != 0) {
+        vec3 value = clamp(result.rgb, 0.0, 1.0);
+        result.rgb = mix(1.055 * pow(value, vec3_splat(1.0 / 2.4)) - 0.055, value * 12.92, step(value, vec3_splat(0.0031308)));
+    }
+    if ((flags & FLAG_ALPHA_ROUGHNESS) != 0) {
+        result.a = sqrt(sqrt(clamp(result.a, 0.0, 1.0)));
+    }
+    if ((flags & FLAG_NORMAL_MAP) != 0) {
+        vec3 normal = result.rgb * 2.0 - 1.0;
+        float length_squared = dot(normal, normal);
+        normal = length_squared > 0.0 ? normal * inversesqrt(length_squared) : vec3_splat(0.0);
+        result.rgb = normal * 0.5 + 0.5;
+    }
+
+    imageStore(s_output, texel, result);
+}
@@ -0,0 +1,248 @@
+#include "pack.h"
+#include "atomic_file.h"
+#include "dds_layout.h"
+#include "gpu_layout.h"
+#include "hash.h"
+#include "mapped_file.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <tuple>
+
+namespace fs = std::filesystem;
+
+// Files are copied into the pack through a buffer of this size.
+static constexpr size_t PACK_COPY_BUFFER_SIZE = 1024 * 1024;
+
+// Entry of the pack with the file it's copied from.
+struct PackFile final {
+    std::string path;
+    std::string name;
+    PackEntry entry;
+    std::vector<PackMipLevel> mip_levels;
+
+    // The data is the same as the one of an earlier entry, which the entry points to instead of a copy of its own.
+    bool is_shared = false;
+};
+
+static uint64_t align_offset(uint64_t offset) noexcept {
+    return (offset + PACK_ALIGNMENT - 1) / PACK_ALIGNMENT * PACK_ALIGNMENT;
+}
+
+// Name of a file in the pack, relative to the directory of the pack when the file is inside it.
+static std::string get_pack_name(const fs::path& pack_directory, const std::string& path) {
+    const fs::path file = fs::absolute(path).lexically_normal();
+    const fs::path relative = file.lexically_relative(pack_directory);
+    if (relative.empty() || *relative.begin() == "..") {
+        return file.generic_string();
+    }
+    return relative.generic_string();
+}
+
+// Reads the header of a DDS file and describes its mip levels, offsets are relative to the end of the header.
+static bool read_pack_file(PackFile& file, std::ostream& log) {
+    std::ifstream stream(file.path, std::ios::binary);
+    char header[DDS10_HEADER_SIZE];
+    Dds10Header dds_header;
+    if (!stream || !stream.read(header, sizeof(header)) || !read_dds10_header(header, sizeof(header), dds_header)) {
+        log << "Texture compiler error. Pack supports only DDS textures with the DX10 header, \"" << file.path << "\" is not one." << std::endl;
+        return false;
+    }
+
+    // Mip levels in the pack are tightly packed, so their offsets and sizes describe them.
+    if (is_gpu_layout(header)) {
+        log << "Texture compiler error. Pack supports only tightly packed DDS textures, \"" << file.path << "\" is compiled with --layout." << std::endl;
+        return false;
+    }
+
+    if (dds_header.dimension != DDS10_DIMENSION_TEXTURE_2D) {
+        log << "Texture compiler error. Pack supports only 2D textures, texture arrays and cube maps, \"" << file.path << "\" is not one." << std::endl;
+        return false;
+    }
+
+    const TextureFormatSize* format = find_texture_format_size(dds_header.dxgi_format);
+    if (format == nullptr) {
+        log << "Texture compiler error. Pack doesn't support DXGI format " << dds_header.dxgi_format << " of \"" << file.path << "\"." << std::endl;
+        return false;
+    }
+
+    const std::vector<DdsLevel> levels = get_dds_levels(dds_header.width, dds_header.height, dds_header.level_count, dds_header.get_layer_count(), format->block_size, format->is_block_compressed);
+    for (const DdsLevel& level : levels) {
+        file.mip_levels.push_back(PackMipLevel { level.offset - DDS10_HEADER_SIZE, level.size });
+    }
+    const uint64_t data_size = get_dds_size(levels) - DDS10_HEADER_SIZE;
+
+    std::error_code error;
+    const uintmax_t file_size = fs::file_size(file.path, error);
+    const bool is_mip_tail_file = is_mip_tail(header);
+    if (error || file_size < DDS10_HEADER_SIZE + data_size || get_dds_data_size(header, static_cast<size_t>(file_size)) != DDS10_HEADER_SIZE + data_size) {
+        log << "Texture compiler error. DDS texture size of \"" << file.path << "\" doesn't match its mip levels." << std::endl;
+        return false;
+    }
+
+    file.entry = PackEntry {};
+    file.entry.format = dds_header.dxgi_format;
+    file.entry.width = dds_header.width;
+    file.entry.height = dds_header.height;
+    file.entry.mip_level_count = dds_header.level_count;
+    file.entry.layer_count = dds_header.get_layer_count();
+    file.entry.flags = dds_header.is_cube_map() ? PACK_ENTRY_CUBE_MAP : 0;
+    if (is_mip_tail_file) {
+        file.entry.flags |= PACK_ENTRY_MIP_TAIL | read_32(header, 48) << PACK_ENTRY_MIP_TAIL_SHIFT;
+    }
+    file.entry.data_size = data_size;
+    return true;
+}
+
+template <typename T>
+static void write_value(std::ofstream& stream, const T& value) {
+    stream.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+static void write_padding(std::ofstream& stream, uint64_t& position, uint64_t offset) {
+    static const char zeros[PACK_ALIGNMENT] = {};
+    while (position < offset) {
+        const size_t size = static_cast<size_t>(std::min<uint64_t>(offset - position, sizeof(zeros)));
+        stream.write(zeros, static_cast<std::streamsize>(size));
+        position += size;
+    }
+}
+
+bool write_pack(const std::string& path, const std::vector<std::string>& files, std::ostream& log) {
+    const fs::path pack_directory = fs::absolute(path).lexically_normal().parent_path();
+
+    std::vector<PackFile> pack_files(files.size());
+    for (size_t i = 0; i < files.size(); i++) {
+        pack_files[i].path = files[i];
+        pack_files[i].name = get_pack_name(pack_directory, files[i]);
+        if (!read_pack_file(pack_files[i], log)) {
+            // Error is printed in `read_pack_file`.
+            return false;
+        }
+    }
+
+    std::sort(pack_files.begin(), pack_files.end(), [](const PackFile& lhs, const PackFile& rhs) {
+        return lhs.name < rhs.name;
+    });
+
+    for (size_t i = 1; i < pack_files.size(); i++) {
+        if (pack_files[i].name == pack_files[i - 1].name) {
+            log << "Texture compiler error. Pack has two textures named \"" << pack_files[i].name << "\"." << std::endl;
+            return false;
+        }
+    }
+
+    // Offsets of every table and entry are known before anything is written, so the pack is written front to back.
+    PackHeader header {};
+    std::memcpy(header.magic, PACK_MAGIC, sizeof(PACK_MAGIC));
+    header.version = PACK_VERSION;
+    header.entry_count = static_cast<uint32_t>(pack_files.size());
+    header.alignment = PACK_ALIGNMENT;
+    header.mip_level_offset = sizeof(PackHeader) + sizeof(PackEntry) * pack_files.size();
+
+    uint64_t mip_level_count = 0;
+    for (PackFile& file : pack_files) {
+        file.entry.first_mip_level = static_cast<uint32_t>(mip_level_count);
+        mip_level_count += file.mip_levels.size();
+    }
+    header.name_offset = header.mip_level_offset + sizeof(PackMipLevel) * mip_level_count;
+
+    uint64_t offset = header.name_offset;
+    for (PackFile& file : pack_files) {
+        file.entry.name_offset = offset;
+        file.entry.name_size = static_cast<uint32_t>(file.name.size());
+        offset += file.name.size() + 1;
+    }
+
+    // Entries with the same data, like copies of a texture under several names, share a single copy of it.
+    std::map<std::tuple<uint64_t, uint64_t, uint64_t>, const PackFile*> data_files;
+    for (PackFile& file : pack_files) {
+        const PackFile* data_file = &file;
+        const MappedFile mapping(file.path);
+        if (mapping.data != nullptr && mapping.size >= DDS10_HEADER_SIZE + file.entry.data_size) {
+            const Hash hash = hash_content(mapping.data + DDS10_HEADER_SIZE, static_cast<size_t>(file.entry.data_size));
+            data_file = data_files.emplace(std::make_tuple(hash.low, hash.high, file.entry.data_size), &file).first->second;
+        }
+
+        if (data_file != &file) {
+            file.is_shared = true;
+            file.entry.data_offset = data_file->entry.data_offset;
+        } else {
+            offset = align_offset(offset);
+            file.entry.data_offset = offset;
+            offset += file.entry.data_size;
+        }
+        for (PackMipLevel& mip_level : file.mip_levels) {
+            mip_level.offset += file.entry.data_offset;
+        }
+    }
+
+    const std::string temporary_path = get_temporary_path(path);
+    {
+        std::ofstream stream(temporary_path, std::ios::binary);
+
+        write_value(stream, header);
+        for (const PackFile& file : pack_files) {
+            write_value(stream, file.entry);
+        }
+        for (const PackFile& file : pack_files) {
+            for (const PackMipLevel& mip_level : file.mip_levels) {
+                write_value(stream, mip_level);
+            }
+        }
+        for (const PackFile& file : pack_files) {
+            stream.write(file.name.c_str(), static_cast<std::streamsize>(file.name.size() + 1));
+        }
+
+        uint64_t position = header.name_offset;
+        for (const PackFile& file : pack_files) {
+            position += file.name.size() + 1;
+        }
+
+        std::vector<char> buffer(PACK_COPY_BUFFER_SIZE);
+        for (const PackFile& file : pack_files) {
+            if (file.is_shared) {
+                continue;
+            }
+            write_padding(stream, position, file.entry.data_offset);
+
+            std::ifstream input(file.path, std::ios::binary);
+            input.seekg(static_cast<std::streamoff>(DDS10_HEADER_SIZE));
+
+            uint64_t remaining = file.entry.data_size;
+            while (remaining > 0 && input && stream) {
+                const size_t size = static_cast<size_t>(std::min<uint64_t>(remaining, buffer.size()));
+                if (!input.read(buffer.data(), static_cast<std::streamsize>(size))) {
+                    break;
+                }
+                stream.write(buffer.data(), static_cast<std::streamsize>(size));
+                remaining -= size;
+            }
+
+            if (remaining != 0) {
+                log << "Texture compiler error. Failed to read \"" << file.path << "\" into the pack." << std::endl;
+                stream.close();
+                std::remove(temporary_path.c_str());
+                return false;
+            }
+            position += file.entry.data_size;
+        }
+
+        stream.close();
+        if (!stream) {
+            log << "Texture compiler error. Failed to write the pack." << std::endl;
+            std::remove(temporary_path.c_str());
+            return false;
+        }
+    }
+
+    if (!replace_file(temporary_path, path)) {
+        log << "Texture compiler error. Failed to write the pack." << std::endl;
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// Pack of the outputs of a manifest, written by `--pack`. Opening a single file instead of one per texture is what
+// makes loading tens of thousands of small textures fast on consoles and hard drives, and the index is laid out so a
+// runtime can memory map the pack and use it in place. All integers are little endian, all offsets are from the start
+// of the file:
+//
+//   Header       `PackHeader`.
+//   Entries      `PackEntry` per texture, sorted by name so a runtime can binary search them.
+//   Mip levels   `PackMipLevel` per mip level of every layer of every entry, layers after each other with all of their
+//                levels from the largest, like in DDS. Cube maps have 6 layers per face of the array, +X first.
+//   Names        UTF-8 paths of the outputs relative to the pack with forward slashes, each followed by a zero byte.
+//   Data         Mip levels of every entry as they are in its DDS file without the header, every entry starting at a
+//                multiple of `PACK_ALIGNMENT`. Entries with the same data point to a single copy of it.
+
+// Data of every entry starts at a multiple of this, which satisfies DMA transfers and the placement alignment of
+// texture data on every current GPU, and is a multiple of hard drive sectors.
+static constexpr uint32_t PACK_ALIGNMENT = 512;
+
+static constexpr char PACK_MAGIC[4] = { 'T', 'P', 'A', 'K' };
+static constexpr uint32_t PACK_VERSION = 1;
+
+// Set in `PackEntry::flags` for cube maps.
+static constexpr uint32_t PACK_ENTRY_CUBE_MAP = 1;
+
+// Set in `PackEntry::flags` for textures compiled with `--mip-tail`, the first mip level of the tail is in the bits from
+// `PACK_ENTRY_MIP_TAIL_SHIFT`. The levels from it on are contiguous in every layer, their table isn't packed.
+static constexpr uint32_t PACK_ENTRY_MIP_TAIL = 2;
+static constexpr uint32_t PACK_ENTRY_MIP_TAIL_SHIFT = 8;
+
+struct PackHeader final {
+    char magic[4];
+    uint32_t version;
+    uint32_t entry_count;
+    uint32_t alignment;
+    uint64_t mip_level_offset;
+    uint64_t name_offset;
+};
+
+struct PackEntry final {
+    uint64_t name_offset;
+    uint32_t name_size;
+
+    // DXGI format of the DDS output.
+    uint32_t format;
+
+    uint32_t width;
+    uint32_t height;
+    uint32_t mip_level_count;
+
+    // Layers of texture arrays, 6 for cube maps.
+    uint32_t layer_count;
+
+    uint32_t flags;
+
+    // Index of the first `PackMipLevel` of the entry.
+    uint32_t first_mip_level;
+
+    uint64_t data_offset;
+    uint64_t data_size;
+};
+
+struct PackMipLevel final {
+    uint64_t offset;
+    uint64_t size;
+};
+
+static_assert(sizeof(PackHeader) == 32 && sizeof(PackEntry) == 56 && sizeof(PackMipLevel) == 16, "Pack structures must have no padding.");
+
+// Writes the DDS files with the DX10 header at `files` into a pack at `path`, which is replaced atomically. Files are
+// copied into the pack one at a time, so the pack never needs to fit in memory.
+bool write_pack(const std::string& path, const std::vector<std::string>& files, std::ostream& log);
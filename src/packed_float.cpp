@@ -0,0 +1,80 @@
+#include "packed_float.h"
+
+#include <algorithm>
+#include <cmath>
+
+// Unsigned float with a 5-bit exponent and `mantissa_bits` bits of mantissa, what R11G11B10 channels are.
+static uint32_t to_unsigned_float(float value, int mantissa_bits) noexcept {
+    if (!(value > 0.f)) {
+        return 0;
+    }
+
+    // Exponent 31 is reserved for infinities and NaNs.
+    const uint32_t largest = (30u << mantissa_bits) | ((1u << mantissa_bits) - 1);
+
+    int exponent;
+    const float fraction = std::frexp(value, &exponent);
+    const int biased_exponent = exponent - 1 + 15;
+
+    uint32_t bits;
+    if (biased_exponent <= 0) {
+        // Subnormal, counted in units of 2^(-14 - mantissa_bits). Rounding up to the smallest normal carries into the
+        // exponent on its own.
+        bits = static_cast<uint32_t>(std::nearbyint(std::ldexp(value, 14 + mantissa_bits)));
+    } else if (biased_exponent > 30) {
+        return largest;
+    } else {
+        // Mantissa carries into the exponent when it rounds up, which is still the correctly rounded value.
+        const auto mantissa = static_cast<uint32_t>(std::nearbyint(std::ldexp(fraction * 2.f - 1.f, mantissa_bits)));
+        bits = (static_cast<uint32_t>(biased_exponent) << mantissa_bits) + mantissa;
+    }
+    return std::min(bits, largest);
+}
+
+void pack_r11g11b10f(const float* input, size_t count, uint32_t* output) noexcept {
+    for (size_t i = 0; i < count; i++) {
+        const float* const texel = input + i * 4;
+        output[i] = to_unsigned_float(texel[0], 6) | (to_unsigned_float(texel[1], 6) << 11) | (to_unsigned_float(texel[2], 5) << 22);
+    }
+}
+
+void pack_rgb9e5(const float* input, size_t count, uint32_t* output) noexcept {
+    constexpr int MANTISSA_BITS = 9;
+    constexpr int EXPONENT_BIAS = 15;
+    constexpr int MAX_EXPONENT = 31;
+
+    // (2^9 - 1) / 2^9 * 2^16.
+    const float largest = std::ldexp(static_cast<float>((1 << MANTISSA_BITS) - 1), MAX_EXPONENT - EXPONENT_BIAS - MANTISSA_BITS);
+
+    for (size_t i = 0; i < count; i++) {
+        const float* const texel = input + i * 4;
+
+        float channels[3];
+        for (int channel = 0; channel < 3; channel++) {
+            channels[channel] = texel[channel] > 0.f ? std::min(texel[channel], largest) : 0.f;
+        }
+
+        const float max_channel = std::max({ channels[0], channels[1], channels[2] });
+        if (max_channel == 0.f) {
+            output[i] = 0;
+            continue;
+        }
+
+        // Exponent of the largest channel, floor(log2(max_channel)) + 1, biased and clamped to the smallest exponent.
+        int exponent;
+        std::frexp(max_channel, &exponent);
+        int shared_exponent = std::max(exponent, -EXPONENT_BIAS) + EXPONENT_BIAS;
+
+        float scale = std::ldexp(1.f, MANTISSA_BITS + EXPONENT_BIAS - shared_exponent);
+        if (std::floor(max_channel * scale + 0.5f) == static_cast<float>(1 << MANTISSA_BITS)) {
+            shared_exponent++;
+            scale *= 0.5f;
+        }
+
+        uint32_t bits = static_cast<uint32_t>(shared_exponent) << (MANTISSA_BITS * 3);
+        for (int channel = 0; channel < 3; channel++) {
+            bits |= static_cast<uint32_t>(std::floor(channels[channel] * scale + 0.5f)) << (MANTISSA_BITS * channel);
+        }
+        output[i] = bits;
+    }
+}
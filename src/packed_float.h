@@ -0,0 +1,20 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Packed float formats of the irradiance output, which has no use for an alpha channel. Input is interleaved RGBA
+// floats, the alpha channel is ignored. Negative and NaN values become zero and values above the range of the format
+// become its largest value, like half floats of the other cube map outputs.
+
+// DXGI formats of the packed texels, nvtt can't write either of them to DDS.
+static constexpr uint32_t R11G11B10_FLOAT_DXGI_FORMAT = 26;
+static constexpr uint32_t R9G9B9E5_SHAREDEXP_DXGI_FORMAT = 67;
+
+// Packs `count` texels to DXGI_FORMAT_R11G11B10_FLOAT, unsigned floats with 6, 6 and 5 bits of mantissa and 5 bits
+// of exponent, rounded to the nearest even.
+void pack_r11g11b10f(const float* input, size_t count, uint32_t* output) noexcept;
+
+// Packs `count` texels to DXGI_FORMAT_R9G9B9E5_SHAREDEXP, 9 bits of mantissa per channel and an exponent shared by
+// all of them, picked by the largest channel exactly like the Direct3D specification does.
+void pack_rgb9e5(const float* input, size_t count, uint32_t* output) noexcept;
@@ -0,0 +1,782 @@
+#include "pixel_kernels.h"
+#include "cpu_features.h"
+
+// C math functions rather than `std::` ones, which are inline functions of the standard headers. Variants built with
+// other instruction sets must not emit any function the baseline emits too, or the linker may keep either copy.
+#include <math.h>
+
+// The build compiles this file once more for every extra instruction set with `PIXEL_KERNELS_VARIANT` set to the name
+// of the variant. Each copy puts its kernels into a namespace of that name, and the baseline copy, which has the
+// instruction set of the rest of the compiler, also defines the functions that pick a variant at runtime.
+#if !defined(PIXEL_KERNELS_VARIANT)
+#define PIXEL_KERNELS_VARIANT baseline
+#define PIXEL_KERNELS_DISPATCH
+#endif
+
+// The scalar variant is built with `PIXEL_KERNELS_SCALAR` and leaves every kernel to its scalar loop, which the
+// vector loops of the other variants only handle the tails with, to measure what they bring.
+#if defined(PIXEL_KERNELS_SCALAR)
+#elif defined(__AVX2__)
+#define PIXEL_KERNELS_AVX2
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define PIXEL_KERNELS_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#define PIXEL_KERNELS_NEON
+#include <arm_neon.h>
+#endif
+
+// Kernels of a single variant, defined the same way by every copy of the file.
+struct PixelKernels final {
+    void (*convert_rgba8_to_planes)(const uint8_t* rgba, size_t pixel_count, float* red, float* green, float* blue, float* alpha) noexcept;
+    void (*convert_rgba16_to_planes)(const uint16_t* rgba, size_t pixel_count, float* red, float* green, float* blue, float* alpha) noexcept;
+    void (*convert_unorm8_to_plane)(const uint8_t* unorm8, size_t pixel_count, float* plane) noexcept;
+    void (*convert_plane_to_unorm16)(const float* plane, size_t pixel_count, uint16_t* unorm16) noexcept;
+    void (*convert_unorm16_to_plane)(const uint16_t* unorm16, size_t pixel_count, float* plane) noexcept;
+    void (*renormalize_packed_normals)(float* red, float* green, float* blue, size_t pixel_count) noexcept;
+    void (*reconstruct_normal_z)(const float* red, const float* green, float* blue, size_t pixel_count) noexcept;
+    void (*box_filter_rows)(const float* top, const float* bottom, size_t count, float* output) noexcept;
+    void (*filter_columns)(const float* const* rows, const float (&weights)[MIP_FILTER_TAP_COUNT], size_t count, float* output) noexcept;
+    void (*filter_rows)(const float* even, const float* odd, const float (&weights)[MIP_FILTER_TAP_COUNT], size_t count, float* output) noexcept;
+    void (*box_filter_rgba8_rows)(const uint8_t* top, const uint8_t* bottom, size_t count, uint8_t* output) noexcept;
+    void (*convert_rgbe_to_rgba32f)(const uint8_t* rgbe, size_t pixel_count, float* rgba) noexcept;
+    void (*swizzle_rgba8)(const uint8_t* input, size_t pixel_count, bool is_bgra, bool is_opaque, uint8_t* rgba) noexcept;
+};
+
+namespace PIXEL_KERNELS_VARIANT {
+
+static void convert_rgba8_to_planes(const uint8_t* rgba, size_t pixel_count, float* red, float* green, float* blue, float* alpha) noexcept {
+    size_t i = 0;
+
+    // Division rather than multiplication by reciprocal matches nvtt's own 8-bit conversion exactly.
+#if defined(PIXEL_KERNELS_AVX2)
+    const __m256i mask = _mm256_set1_epi32(0xFF);
+    const __m256 scale = _mm256_set1_ps(255.f);
+    for (; i + 8 <= pixel_count; i += 8) {
+        const __m256i pixels = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rgba + i * 4));
+        _mm256_storeu_ps(red + i, _mm256_div_ps(_mm256_cvtepi32_ps(_mm256_and_si256(pixels, mask)), scale));
+        _mm256_storeu_ps(green + i, _mm256_div_ps(_mm256_cvtepi32_ps(_mm256_and_si256(_mm256_srli_epi32(pixels, 8), mask)), scale));
+        _mm256_storeu_ps(blue + i, _mm256_div_ps(_mm256_cvtepi32_ps(_mm256_and_si256(_mm256_srli_epi32(pixels, 16), mask)), scale));
+        _mm256_storeu_ps(alpha + i, _mm256_div_ps(_mm256_cvtepi32_ps(_mm256_srli_epi32(pixels, 24)), scale));
+    }
+#elif defined(PIXEL_KERNELS_SSE2)
+    const __m128i mask = _mm_set1_epi32(0xFF);
+    const __m128 scale = _mm_set1_ps(255.f);
+    for (; i + 4 <= pixel_count; i += 4) {
+        const __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rgba + i * 4));
+        _mm_storeu_ps(red + i, _mm_div_ps(_mm_cvtepi32_ps(_mm_and_si128(pixels, mask)), scale));
+        _mm_storeu_ps(green + i, _mm_div_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(pixels, 8), mask)), scale));
+        _mm_storeu_ps(blue + i, _mm_div_ps(_mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(pixels, 16), mask)), scale));
+        _mm_storeu_ps(alpha + i, _mm_div_ps(_mm_cvtepi32_ps(_mm_srli_epi32(pixels, 24)), scale));
+    }
+#elif defined(PIXEL_KERNELS_NEON)
+    const float32x4_t scale = vdupq_n_f32(255.f);
+    const auto store = [&](float* destination, uint8x8_t channel) {
+        const uint16x8_t wide = vmovl_u8(channel);
+        vst1q_f32(destination, vdivq_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(wide))), scale));
+        vst1q_f32(destination + 4, vdivq_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(wide))), scale));
+    };
+    for (; i + 8 <= pixel_count; i += 8) {
+        const uint8x8x4_t pixels = vld4_u8(rgba + i * 4);
+        store(red + i, pixels.val[0]);
+        store(green + i, pixels.val[1]);
+        store(blue + i, pixels.val[2]);
+        store(alpha + i, pixels.val[3]);
+    }
+#endif
+
+    for (; i < pixel_count; i++) {
+        red[i] = static_cast<float>(rgba[i * 4]) / 255.f;
+        green[i] = static_cast<float>(rgba[i * 4 + 1]) / 255.f;
+        blue[i] = static_cast<float>(rgba[i * 4 + 2]) / 255.f;
+        alpha[i] = static_cast<float>(rgba[i * 4 + 3]) / 255.f;
+    }
+}
+
+static void convert_rgba16_to_planes(const uint16_t* rgba, size_t pixel_count, float* red, float* green, float* blue, float* alpha) noexcept {
+    size_t i = 0;
+
+    // Four pixels are widened to one float vector each and transposed to planes, AVX2 has nothing better for this.
+#if defined(PIXEL_KERNELS_AVX2) || defined(PIXEL_KERNELS_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128 scale = _mm_set1_ps(65535.f);
+    for (; i + 4 <= pixel_count; i += 4) {
+        const __m128i first = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rgba + i * 4));
+        const __m128i second = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rgba + i * 4 + 8));
+        __m128 pixel0 = _mm_div_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(first, zero)), scale);
+        __m128 pixel1 = _mm_div_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(first, zero)), scale);
+        __m128 pixel2 = _mm_div_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(second, zero)), scale);
+        __m128 pixel3 = _mm_div_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(second, zero)), scale);
+        _MM_TRANSPOSE4_PS(pixel0, pixel1, pixel2, pixel3);
+        _mm_storeu_ps(red + i, pixel0);
+        _mm_storeu_ps(green + i, pixel1);
+        _mm_storeu_ps(blue + i, pixel2);
+        _mm_storeu_ps(alpha + i, pixel3);
+    }
+#elif defined(PIXEL_KERNELS_NEON)
+    const float32x4_t scale = vdupq_n_f32(65535.f);
+    const auto store = [&](float* destination, uint16x8_t channel) {
+        vst1q_f32(destination, vdivq_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(channel))), scale));
+        vst1q_f32(destination + 4, vdivq_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(channel))), scale));
+    };
+    for (; i + 8 <= pixel_count; i += 8) {
+        const uint16x8x4_t pixels = vld4q_u16(rgba + i * 4);
+        store(red + i, pixels.val[0]);
+        store(green + i, pixels.val[1]);
+        store(blue + i, pixels.val[2]);
+        store(alpha + i, pixels.val[3]);
+    }
+#endif
+
+    for (; i < pixel_count; i++) {
+        red[i] = static_cast<float>(rgba[i * 4]) / 65535.f;
+        green[i] = static_cast<float>(rgba[i * 4 + 1]) / 65535.f;
+        blue[i] = static_cast<float>(rgba[i * 4 + 2]) / 65535.f;
+        alpha[i] = static_cast<float>(rgba[i * 4 + 3]) / 65535.f;
+    }
+}
+
+static void convert_unorm8_to_plane(const uint8_t* unorm8, size_t pixel_count, float* plane) noexcept {
+    size_t i = 0;
+
+#if defined(PIXEL_KERNELS_AVX2)
+    const __m256 scale = _mm256_set1_ps(255.f);
+    for (; i + 8 <= pixel_count; i += 8) {
+        const __m256i values = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(unorm8 + i)));
+        _mm256_storeu_ps(plane + i, _mm256_div_ps(_mm256_cvtepi32_ps(values), scale));
+    }
+#elif defined(PIXEL_KERNELS_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128 scale = _mm_set1_ps(255.f);
+    for (; i + 8 <= pixel_count; i += 8) {
+        const __m128i values = _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(unorm8 + i)), zero);
+        _mm_storeu_ps(plane + i, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(values, zero)), scale));
+        _mm_storeu_ps(plane + i + 4, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(values, zero)), scale));
+    }
+#elif defined(PIXEL_KERNELS_NEON)
+    const float32x4_t scale = vdupq_n_f32(255.f);
+    for (; i + 8 <= pixel_count; i += 8) {
+        const uint16x8_t values = vmovl_u8(vld1_u8(unorm8 + i));
+        vst1q_f32(plane + i, vdivq_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(values))), scale));
+        vst1q_f32(plane + i + 4, vdivq_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(values))), scale));
+    }
+#endif
+
+    for (; i < pixel_count; i++) {
+        plane[i] = static_cast<float>(unorm8[i]) / 255.f;
+    }
+}
+
+static void convert_plane_to_unorm16(const float* plane, size_t pixel_count, uint16_t* unorm16) noexcept {
+    size_t i = 0;
+
+    // Truncation of the value plus a half is the rounding of the scalar loop. Signed saturation can't pack values
+    // above 32767, so they're packed biased by 32768 and unbiased afterwards.
+#if defined(PIXEL_KERNELS_AVX2) || defined(PIXEL_KERNELS_SSE2)
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.f);
+    const __m128 scale = _mm_set1_ps(65535.f);
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128i bias = _mm_set1_epi32(32768);
+    const __m128i sign = _mm_set1_epi16(static_cast<short>(0x8000));
+    const auto quantize = [&](const float* source) {
+        const __m128 value = _mm_add_ps(_mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(source), zero), one), scale), half);
+        return _mm_sub_epi32(_mm_cvttps_epi32(value), bias);
+    };
+    for (; i + 8 <= pixel_count; i += 8) {
+        const __m128i packed = _mm_packs_epi32(quantize(plane + i), quantize(plane + i + 4));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(unorm16 + i), _mm_xor_si128(packed, sign));
+    }
+#elif defined(PIXEL_KERNELS_NEON)
+    const float32x4_t zero = vdupq_n_f32(0.f);
+    const float32x4_t one = vdupq_n_f32(1.f);
+    const float32x4_t scale = vdupq_n_f32(65535.f);
+    const float32x4_t half = vdupq_n_f32(0.5f);
+    const auto quantize = [&](const float* source) {
+        const float32x4_t value = vaddq_f32(vmulq_f32(vminq_f32(vmaxq_f32(vld1q_f32(source), zero), one), scale), half);
+        return vmovn_u32(vcvtq_u32_f32(value));
+    };
+    for (; i + 8 <= pixel_count; i += 8) {
+        vst1q_u16(unorm16 + i, vcombine_u16(quantize(plane + i), quantize(plane + i + 4)));
+    }
+#endif
+
+    for (; i < pixel_count; i++) {
+        const float value = fminf(fmaxf(plane[i], 0.f), 1.f);
+        unorm16[i] = static_cast<uint16_t>(value * 65535.f + 0.5f);
+    }
+}
+
+static void convert_unorm16_to_plane(const uint16_t* unorm16, size_t pixel_count, float* plane) noexcept {
+    size_t i = 0;
+
+#if defined(PIXEL_KERNELS_AVX2)
+    const __m256 scale = _mm256_set1_ps(65535.f);
+    for (; i + 8 <= pixel_count; i += 8) {
+        const __m256i values = _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(unorm16 + i)));
+        _mm256_storeu_ps(plane + i, _mm256_div_ps(_mm256_cvtepi32_ps(values), scale));
+    }
+#elif defined(PIXEL_KERNELS_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128 scale = _mm_set1_ps(65535.f);
+    for (; i + 8 <= pixel_count; i += 8) {
+        const __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(unorm16 + i));
+        _mm_storeu_ps(plane + i, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(values, zero)), scale));
+        _mm_storeu_ps(plane + i + 4, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(values, zero)), scale));
+    }
+#elif defined(PIXEL_KERNELS_NEON)
+    const float32x4_t scale = vdupq_n_f32(65535.f);
+    for (; i + 8 <= pixel_count; i += 8) {
+        const uint16x8_t values = vld1q_u16(unorm16 + i);
+        vst1q_f32(plane + i, vdivq_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(values))), scale));
+        vst1q_f32(plane + i + 4, vdivq_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(values))), scale));
+    }
+#endif
+
+    for (; i < pixel_count; i++) {
+        plane[i] = static_cast<float>(unorm16[i]) / 65535.f;
+    }
+}
+
+static void renormalize_packed_normals(float* red, float* green, float* blue, size_t pixel_count) noexcept {
+    size_t i = 0;
+
+    // Multiplication by the reciprocal of the length and the sum of squares in this order are what nvtt computes.
+    // Zero length normals get a zero reciprocal, which gives the zero vector nvtt falls back to.
+#if defined(PIXEL_KERNELS_AVX2)
+    const __m256 one = _mm256_set1_ps(1.f);
+    const __m256 two = _mm256_set1_ps(2.f);
+    const __m256 half = _mm256_set1_ps(0.5f);
+    const __m256 zero = _mm256_setzero_ps();
+    for (; i + 8 <= pixel_count; i += 8) {
+        const __m256 x = _mm256_sub_ps(_mm256_mul_ps(_mm256_loadu_ps(red + i), two), one);
+        const __m256 y = _mm256_sub_ps(_mm256_mul_ps(_mm256_loadu_ps(green + i), two), one);
+        const __m256 z = _mm256_sub_ps(_mm256_mul_ps(_mm256_loadu_ps(blue + i), two), one);
+        const __m256 length = _mm256_sqrt_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, x), _mm256_mul_ps(y, y)), _mm256_mul_ps(z, z)));
+        const __m256 scale = _mm256_and_ps(_mm256_cmp_ps(length, zero, _CMP_GT_OQ), _mm256_div_ps(one, length));
+        _mm256_storeu_ps(red + i, _mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(x, scale), half), half));
+        _mm256_storeu_ps(green + i, _mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(y, scale), half), half));
+        _mm256_storeu_ps(blue + i, _mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(z, scale), half), half));
+    }
+#elif defined(PIXEL_KERNELS_SSE2)
+    const __m128 one = _mm_set1_ps(1.f);
+    const __m128 two = _mm_set1_ps(2.f);
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128 zero = _mm_setzero_ps();
+    for (; i + 4 <= pixel_count; i += 4) {
+        const __m128 x = _mm_sub_ps(_mm_mul_ps(_mm_loadu_ps(red + i), two), one);
+        const __m128 y = _mm_sub_ps(_mm_mul_ps(_mm_loadu_ps(green + i), two), one);
+        const __m128 z = _mm_sub_ps(_mm_mul_ps(_mm_loadu_ps(blue + i), two), one);
+        const __m128 length = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z)));
+        const __m128 scale = _mm_and_ps(_mm_cmpgt_ps(length, zero), _mm_div_ps(one, length));
+        _mm_storeu_ps(red + i, _mm_add_ps(_mm_mul_ps(_mm_mul_ps(x, scale), half), half));
+        _mm_storeu_ps(green + i, _mm_add_ps(_mm_mul_ps(_mm_mul_ps(y, scale), half), half));
+        _mm_storeu_ps(blue + i, _mm_add_ps(_mm_mul_ps(_mm_mul_ps(z, scale), half), half));
+    }
+#elif defined(PIXEL_KERNELS_NEON)
+    const float32x4_t one = vdupq_n_f32(1.f);
+    const float32x4_t two = vdupq_n_f32(2.f);
+    const float32x4_t half = vdupq_n_f32(0.5f);
+    const float32x4_t zero = vdupq_n_f32(0.f);
+    for (; i + 4 <= pixel_count; i += 4) {
+        const float32x4_t x = vsubq_f32(vmulq_f32(vld1q_f32(red + i), two), one);
+        const float32x4_t y = vsubq_f32(vmulq_f32(vld1q_f32(green + i), two), one);
+        const float32x4_t z = vsubq_f32(vmulq_f32(vld1q_f32(blue + i), two), one);
+        const float32x4_t length = vsqrtq_f32(vaddq_f32(vaddq_f32(vmulq_f32(x, x), vmulq_f32(y, y)), vmulq_f32(z, z)));
+        const float32x4_t scale = vreinterpretq_f32_u32(vandq_u32(vcgtq_f32(length, zero), vreinterpretq_u32_f32(vdivq_f32(one, length))));
+        vst1q_f32(red + i, vaddq_f32(vmulq_f32(vmulq_f32(x, scale), half), half));
+        vst1q_f32(green + i, vaddq_f32(vmulq_f32(vmulq_f32(y, scale), half), half));
+        vst1q_f32(blue + i, vaddq_f32(vmulq_f32(vmulq_f32(z, scale), half), half));
+    }
+#endif
+
+    for (; i < pixel_count; i++) {
+        const float x = red[i] * 2.f - 1.f;
+        const float y = green[i] * 2.f - 1.f;
+        const float z = blue[i] * 2.f - 1.f;
+        const float length = sqrtf(x * x + y * y + z * z);
+        const float scale = length > 0.f ? 1.f / length : 0.f;
+        red[i] = x * scale * 0.5f + 0.5f;
+        green[i] = y * scale * 0.5f + 0.5f;
+        blue[i] = z * scale * 0.5f + 0.5f;
+    }
+}
+
+static void reconstruct_normal_z(const float* red, const float* green, float* blue, size_t pixel_count) noexcept {
+    size_t i = 0;
+
+    // `sqrt(max(1 - dot, 0))` is exactly zero for broken pixels, which gives the same 0.5 as a branch would.
+#if defined(PIXEL_KERNELS_AVX2)
+    const __m256 one = _mm256_set1_ps(1.f);
+    const __m256 two = _mm256_set1_ps(2.f);
+    const __m256 half = _mm256_set1_ps(0.5f);
+    const __m256 zero = _mm256_setzero_ps();
+    for (; i + 8 <= pixel_count; i += 8) {
+        const __m256 x = _mm256_sub_ps(_mm256_mul_ps(_mm256_loadu_ps(red + i), two), one);
+        const __m256 y = _mm256_sub_ps(_mm256_mul_ps(_mm256_loadu_ps(green + i), two), one);
+        const __m256 dot = _mm256_add_ps(_mm256_mul_ps(x, x), _mm256_mul_ps(y, y));
+        const __m256 z = _mm256_sqrt_ps(_mm256_max_ps(_mm256_sub_ps(one, dot), zero));
+        _mm256_storeu_ps(blue + i, _mm256_add_ps(_mm256_mul_ps(z, half), half));
+    }
+#elif defined(PIXEL_KERNELS_SSE2)
+    const __m128 one = _mm_set1_ps(1.f);
+    const __m128 two = _mm_set1_ps(2.f);
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128 zero = _mm_setzero_ps();
+    for (; i + 4 <= pixel_count; i += 4) {
+        const __m128 x = _mm_sub_ps(_mm_mul_ps(_mm_loadu_ps(red + i), two), one);
+        const __m128 y = _mm_sub_ps(_mm_mul_ps(_mm_loadu_ps(green + i), two), one);
+        const __m128 dot = _mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y));
+        const __m128 z = _mm_sqrt_ps(_mm_max_ps(_mm_sub_ps(one, dot), zero));
+        _mm_storeu_ps(blue + i, _mm_add_ps(_mm_mul_ps(z, half), half));
+    }
+#elif defined(PIXEL_KERNELS_NEON)
+    const float32x4_t one = vdupq_n_f32(1.f);
+    const float32x4_t two = vdupq_n_f32(2.f);
+    const float32x4_t half = vdupq_n_f32(0.5f);
+    const float32x4_t zero = vdupq_n_f32(0.f);
+    for (; i + 4 <= pixel_count; i += 4) {
+        const float32x4_t x = vsubq_f32(vmulq_f32(vld1q_f32(red + i), two), one);
+        const float32x4_t y = vsubq_f32(vmulq_f32(vld1q_f32(green + i), two), one);
+        const float32x4_t dot = vaddq_f32(vmulq_f32(x, x), vmulq_f32(y, y));
+        const float32x4_t z = vsqrtq_f32(vmaxq_f32(vsubq_f32(one, dot), zero));
+        vst1q_f32(blue + i, vaddq_f32(vmulq_f32(z, half), half));
+    }
+#endif
+
+    for (; i < pixel_count; i++) {
+        const float x = red[i] * 2.f - 1.f;
+        const float y = green[i] * 2.f - 1.f;
+        const float dot = x * x + y * y;
+        blue[i] = dot < 1.f ? sqrtf(1.f - dot) * 0.5f + 0.5f : 0.5f;
+    }
+}
+
+// Averages 2x2 quads of two rows, `0.25 * ((a + b) + (c + d))` in this exact order matches nvtt.
+static void box_filter_rows(const float* top, const float* bottom, size_t count, float* output) noexcept {
+    size_t i = 0;
+
+#if defined(PIXEL_KERNELS_AVX2)
+    const __m256 quarter = _mm256_set1_ps(0.25f);
+    for (; i + 8 <= count; i += 8) {
+        const __m256 top_low = _mm256_loadu_ps(top + i * 2);
+        const __m256 top_high = _mm256_loadu_ps(top + i * 2 + 8);
+        const __m256 bottom_low = _mm256_loadu_ps(bottom + i * 2);
+        const __m256 bottom_high = _mm256_loadu_ps(bottom + i * 2 + 8);
+        const __m256 top_sum = _mm256_add_ps(_mm256_shuffle_ps(top_low, top_high, _MM_SHUFFLE(2, 0, 2, 0)), _mm256_shuffle_ps(top_low, top_high, _MM_SHUFFLE(3, 1, 3, 1)));
+        const __m256 bottom_sum = _mm256_add_ps(_mm256_shuffle_ps(bottom_low, bottom_high, _MM_SHUFFLE(2, 0, 2, 0)), _mm256_shuffle_ps(bottom_low, bottom_high, _MM_SHUFFLE(3, 1, 3, 1)));
+        // Shuffles work within 128-bit lanes, so pairs of results come out interleaved between the lanes.
+        const __m256 result = _mm256_mul_ps(_mm256_add_ps(top_sum, bottom_sum), quarter);
+        _mm256_storeu_ps(output + i, _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(result), _MM_SHUFFLE(3, 1, 2, 0))));
+    }
+#elif defined(PIXEL_KERNELS_SSE2)
+    const __m128 quarter = _mm_set1_ps(0.25f);
+    for (; i + 4 <= count; i += 4) {
+        const __m128 top_low = _mm_loadu_ps(top + i * 2);
+        const __m128 top_high = _mm_loadu_ps(top + i * 2 + 4);
+        const __m128 bottom_low = _mm_loadu_ps(bottom + i * 2);
+        const __m128 bottom_high = _mm_loadu_ps(bottom + i * 2 + 4);
+        const __m128 top_sum = _mm_add_ps(_mm_shuffle_ps(top_low, top_high, _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_ps(top_low, top_high, _MM_SHUFFLE(3, 1, 3, 1)));
+        const __m128 bottom_sum = _mm_add_ps(_mm_shuffle_ps(bottom_low, bottom_high, _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_ps(bottom_low, bottom_high, _MM_SHUFFLE(3, 1, 3, 1)));
+        _mm_storeu_ps(output + i, _mm_mul_ps(_mm_add_ps(top_sum, bottom_sum), quarter));
+    }
+#elif defined(PIXEL_KERNELS_NEON)
+    const float32x4_t quarter = vdupq_n_f32(0.25f);
+    for (; i + 4 <= count; i += 4) {
+        const float32x4x2_t top_pairs = vld2q_f32(top + i * 2);
+        const float32x4x2_t bottom_pairs = vld2q_f32(bottom + i * 2);
+        const float32x4_t top_sum = vaddq_f32(top_pairs.val[0], top_pairs.val[1]);
+        const float32x4_t bottom_sum = vaddq_f32(bottom_pairs.val[0], bottom_pairs.val[1]);
+        vst1q_f32(output + i, vmulq_f32(vaddq_f32(top_sum, bottom_sum), quarter));
+    }
+#endif
+
+    for (; i < count; i++) {
+        output[i] = 0.25f * ((top[i * 2] + top[i * 2 + 1]) + (bottom[i * 2] + bottom[i * 2 + 1]));
+    }
+}
+
+// Weighted sum of the same pixels of every tap row, taps are added one after another in the same order on every
+// instruction set.
+static void filter_columns(const float* const* rows, const float (&weights)[MIP_FILTER_TAP_COUNT], size_t count, float* output) noexcept {
+    size_t i = 0;
+
+#if defined(PIXEL_KERNELS_AVX2)
+    for (; i + 8 <= count; i += 8) {
+        __m256 sum = _mm256_mul_ps(_mm256_loadu_ps(rows[0] + i), _mm256_set1_ps(weights[0]));
+        for (size_t tap = 1; tap < MIP_FILTER_TAP_COUNT; tap++) {
+            sum = _mm256_add_ps(sum, _mm256_mul_ps(_mm256_loadu_ps(rows[tap] + i), _mm256_set1_ps(weights[tap])));
+        }
+        _mm256_storeu_ps(output + i, sum);
+    }
+#elif defined(PIXEL_KERNELS_SSE2)
+    for (; i + 4 <= count; i += 4) {
+        __m128 sum = _mm_mul_ps(_mm_loadu_ps(rows[0] + i), _mm_set1_ps(weights[0]));
+        for (size_t tap = 1; tap < MIP_FILTER_TAP_COUNT; tap++) {
+            sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(rows[tap] + i), _mm_set1_ps(weights[tap])));
+        }
+        _mm_storeu_ps(output + i, sum);
+    }
+#elif defined(PIXEL_KERNELS_NEON)
+    for (; i + 4 <= count; i += 4) {
+        float32x4_t sum = vmulq_f32(vld1q_f32(rows[0] + i), vdupq_n_f32(weights[0]));
+        for (size_t tap = 1; tap < MIP_FILTER_TAP_COUNT; tap++) {
+            sum = vaddq_f32(sum, vmulq_f32(vld1q_f32(rows[tap] + i), vdupq_n_f32(weights[tap])));
+        }
+        vst1q_f32(output + i, sum);
+    }
+#endif
+
+    for (; i < count; i++) {
+        float sum = rows[0][i] * weights[0];
+        for (size_t tap = 1; tap < MIP_FILTER_TAP_COUNT; tap++) {
+            sum += rows[tap][i] * weights[tap];
+        }
+        output[i] = sum;
+    }
+}
+
+// Horizontal pass over a row split into even and odd pixels of the padded row, so that tap `2m` of pixel `x` is
+// `even[x + m]` and tap `2m + 1` is `odd[x + m]` and every tap is a contiguous load.
+static void filter_rows(const float* even, const float* odd, const float (&weights)[MIP_FILTER_TAP_COUNT], size_t count, float* output) noexcept {
+    size_t i = 0;
+
+#if defined(PIXEL_KERNELS_AVX2)
+    for (; i + 8 <= count; i += 8) {
+        __m256 sum = _mm256_mul_ps(_mm256_loadu_ps(even + i), _mm256_set1_ps(weights[0]));
+        sum = _mm256_add_ps(sum, _mm256_mul_ps(_mm256_loadu_ps(odd + i), _mm256_set1_ps(weights[1])));
+        for (size_t pair = 1; pair < MIP_FILTER_TAP_COUNT / 2; pair++) {
+            sum = _mm256_add_ps(sum, _mm256_mul_ps(_mm256_loadu_ps(even + i + pair), _mm256_set1_ps(weights[pair * 2])));
+            sum = _mm256_add_ps(sum, _mm256_mul_ps(_mm256_loadu_ps(odd + i + pair), _mm256_set1_ps(weights[pair * 2 + 1])));
+        }
+        _mm256_storeu_ps(output + i, sum);
+    }
+#elif defined(PIXEL_KERNELS_SSE2)
+    for (; i + 4 <= count; i += 4) {
+        __m128 sum = _mm_mul_ps(_mm_loadu_ps(even + i), _mm_set1_ps(weights[0]));
+        sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(odd + i), _mm_set1_ps(weights[1])));
+        for (size_t pair = 1; pair < MIP_FILTER_TAP_COUNT / 2; pair++) {
+            sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(even + i + pair), _mm_set1_ps(weights[pair * 2])));
+            sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(odd + i + pair), _mm_set1_ps(weights[pair * 2 + 1])));
+        }
+        _mm_storeu_ps(output + i, sum);
+    }
+#elif defined(PIXEL_KERNELS_NEON)
+    for (; i + 4 <= count; i += 4) {
+        float32x4_t sum = vmulq_f32(vld1q_f32(even + i), vdupq_n_f32(weights[0]));
+        sum = vaddq_f32(sum, vmulq_f32(vld1q_f32(odd + i), vdupq_n_f32(weights[1])));
+        for (size_t pair = 1; pair < MIP_FILTER_TAP_COUNT / 2; pair++) {
+            sum = vaddq_f32(sum, vmulq_f32(vld1q_f32(even + i + pair), vdupq_n_f32(weights[pair * 2])));
+            sum = vaddq_f32(sum, vmulq_f32(vld1q_f32(odd + i + pair), vdupq_n_f32(weights[pair * 2 + 1])));
+        }
+        vst1q_f32(output + i, sum);
+    }
+#endif
+
+    for (; i < count; i++) {
+        float sum = even[i] * weights[0];
+        sum += odd[i] * weights[1];
+        for (size_t pair = 1; pair < MIP_FILTER_TAP_COUNT / 2; pair++) {
+            sum += even[i + pair] * weights[pair * 2];
+            sum += odd[i + pair] * weights[pair * 2 + 1];
+        }
+        output[i] = sum;
+    }
+}
+
+// Averages 2x2 quads of RGBA8 pixels of two rows, `(a + b + c + d + 2) / 4` for every channel. SSE2 is a part of
+// AVX2, so both share the same loop of 16-bit sums.
+static void box_filter_rgba8_rows(const uint8_t* top, const uint8_t* bottom, size_t count, uint8_t* output) noexcept {
+    size_t i = 0;
+
+#if defined(PIXEL_KERNELS_AVX2) || defined(PIXEL_KERNELS_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i two = _mm_set1_epi16(2);
+    for (; i + 4 <= count; i += 4) {
+        const __m128i top_low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(top + i * 8));
+        const __m128i top_high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(top + i * 8 + 16));
+        const __m128i bottom_low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bottom + i * 8));
+        const __m128i bottom_high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bottom + i * 8 + 16));
+        // Every register of vertical sums holds two neighbouring pixels, which are its 64-bit halves.
+        const __m128i sum0 = _mm_add_epi16(_mm_unpacklo_epi8(top_low, zero), _mm_unpacklo_epi8(bottom_low, zero));
+        const __m128i sum1 = _mm_add_epi16(_mm_unpackhi_epi8(top_low, zero), _mm_unpackhi_epi8(bottom_low, zero));
+        const __m128i sum2 = _mm_add_epi16(_mm_unpacklo_epi8(top_high, zero), _mm_unpacklo_epi8(bottom_high, zero));
+        const __m128i sum3 = _mm_add_epi16(_mm_unpackhi_epi8(top_high, zero), _mm_unpackhi_epi8(bottom_high, zero));
+        const __m128i quad01 = _mm_add_epi16(_mm_unpacklo_epi64(sum0, sum1), _mm_unpackhi_epi64(sum0, sum1));
+        const __m128i quad23 = _mm_add_epi16(_mm_unpacklo_epi64(sum2, sum3), _mm_unpackhi_epi64(sum2, sum3));
+        const __m128i result01 = _mm_srli_epi16(_mm_add_epi16(quad01, two), 2);
+        const __m128i result23 = _mm_srli_epi16(_mm_add_epi16(quad23, two), 2);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i * 4), _mm_packus_epi16(result01, result23));
+    }
+#elif defined(PIXEL_KERNELS_NEON)
+    for (; i + 4 <= count; i += 4) {
+        const uint8x16_t top_low = vld1q_u8(top + i * 8);
+        const uint8x16_t top_high = vld1q_u8(top + i * 8 + 16);
+        const uint8x16_t bottom_low = vld1q_u8(bottom + i * 8);
+        const uint8x16_t bottom_high = vld1q_u8(bottom + i * 8 + 16);
+        const uint16x8_t sum0 = vaddl_u8(vget_low_u8(top_low), vget_low_u8(bottom_low));
+        const uint16x8_t sum1 = vaddl_u8(vget_high_u8(top_low), vget_high_u8(bottom_low));
+        const uint16x8_t sum2 = vaddl_u8(vget_low_u8(top_high), vget_low_u8(bottom_high));
+        const uint16x8_t sum3 = vaddl_u8(vget_high_u8(top_high), vget_high_u8(bottom_high));
+        const uint16x8_t quad01 = vcombine_u16(vadd_u16(vget_low_u16(sum0), vget_high_u16(sum0)), vadd_u16(vget_low_u16(sum1), vget_high_u16(sum1)));
+        const uint16x8_t quad23 = vcombine_u16(vadd_u16(vget_low_u16(sum2), vget_high_u16(sum2)), vadd_u16(vget_low_u16(sum3), vget_high_u16(sum3)));
+        // Rounding shift adds two before shifting, which is the same rounding as the other paths.
+        vst1q_u8(output + i * 4, vcombine_u8(vmovn_u16(vrshrq_n_u16(quad01, 2)), vmovn_u16(vrshrq_n_u16(quad23, 2))));
+    }
+#endif
+
+    for (; i < count; i++) {
+        for (size_t channel = 0; channel < 4; channel++) {
+            const unsigned sum = top[i * 8 + channel] + top[i * 8 + 4 + channel] + bottom[i * 8 + channel] + bottom[i * 8 + 4 + channel];
+            output[i * 4 + channel] = static_cast<uint8_t>((sum + 2) / 4);
+        }
+    }
+}
+
+// Expands RGBE pixels of Radiance HDR images to RGBA floats with alpha one, the same floats as `stbi_loadf`. Every
+// channel is the byte times `2^(e - 136)`, which is exact, so the scale is built from the exponent bits rather than by
+// `ldexp`. Scales below the smallest normal float are split into two normal ones, `2^-126` and `2^(e - 10)`, and the
+// second multiplication by one leaves the other pixels as they are. Pixels with a zero exponent are black.
+static void convert_rgbe_to_rgba32f(const uint8_t* rgbe, size_t pixel_count, float* rgba) noexcept {
+    size_t i = 0;
+
+    // Every vector holds whole pixels, so the exponent is broadcast within each pixel and the output stays interleaved.
+#if defined(PIXEL_KERNELS_AVX2)
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i min_normal_exponent = _mm256_set1_epi32(10);
+    const __m256i normal_bias = _mm256_set1_epi32(9);
+    const __m256i subnormal_bias = _mm256_set1_epi32(117);
+    const __m256 alpha_mask = _mm256_castsi256_ps(_mm256_setr_epi32(0, 0, 0, -1, 0, 0, 0, -1));
+    const __m256 alpha_one = _mm256_setr_ps(0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 1.f);
+    for (; i + 2 <= pixel_count; i += 2) {
+        const __m256i pixels = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(rgbe + i * 4)));
+        const __m256i exponents = _mm256_shuffle_epi32(pixels, 0xFF);
+        const __m256 normal_scale = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_sub_epi32(_mm256_max_epi32(exponents, min_normal_exponent), normal_bias), 23));
+        const __m256 subnormal_scale = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_add_epi32(_mm256_min_epi32(exponents, min_normal_exponent), subnormal_bias), 23));
+        const __m256 values = _mm256_mul_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(pixels), normal_scale), subnormal_scale);
+        const __m256 cleared = _mm256_or_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(exponents, zero)), alpha_mask);
+        _mm256_storeu_ps(rgba + i * 4, _mm256_or_ps(_mm256_andnot_ps(cleared, values), alpha_one));
+    }
+#elif defined(PIXEL_KERNELS_SSE2)
+    // Exponents fit in 16 bits, so the 16-bit minimum and maximum of SSE2 work on the 32-bit lanes.
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i min_normal_exponent = _mm_set1_epi32(10);
+    const __m128i normal_bias = _mm_set1_epi32(9);
+    const __m128i subnormal_bias = _mm_set1_epi32(117);
+    const __m128 alpha_mask = _mm_castsi128_ps(_mm_setr_epi32(0, 0, 0, -1));
+    const __m128 alpha_one = _mm_setr_ps(0.f, 0.f, 0.f, 1.f);
+    const auto convert = [&](__m128i pixel, float* output) {
+        const __m128i exponents = _mm_shuffle_epi32(pixel, 0xFF);
+        const __m128 normal_scale = _mm_castsi128_ps(_mm_slli_epi32(_mm_sub_epi32(_mm_max_epi16(exponents, min_normal_exponent), normal_bias), 23));
+        const __m128 subnormal_scale = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(_mm_min_epi16(exponents, min_normal_exponent), subnormal_bias), 23));
+        const __m128 values = _mm_mul_ps(_mm_mul_ps(_mm_cvtepi32_ps(pixel), normal_scale), subnormal_scale);
+        const __m128 cleared = _mm_or_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(exponents, zero)), alpha_mask);
+        _mm_storeu_ps(output, _mm_or_ps(_mm_andnot_ps(cleared, values), alpha_one));
+    };
+    for (; i + 4 <= pixel_count; i += 4) {
+        const __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rgbe + i * 4));
+        const __m128i low = _mm_unpacklo_epi8(pixels, zero);
+        const __m128i high = _mm_unpackhi_epi8(pixels, zero);
+        convert(_mm_unpacklo_epi16(low, zero), rgba + i * 4);
+        convert(_mm_unpackhi_epi16(low, zero), rgba + i * 4 + 4);
+        convert(_mm_unpacklo_epi16(high, zero), rgba + i * 4 + 8);
+        convert(_mm_unpackhi_epi16(high, zero), rgba + i * 4 + 12);
+    }
+#elif defined(PIXEL_KERNELS_NEON)
+    static const uint32_t alpha_mask_values[4] = { 0, 0, 0, 0xFFFFFFFF };
+    static const float alpha_one_values[4] = { 0.f, 0.f, 0.f, 1.f };
+    const uint32x4_t min_normal_exponent = vdupq_n_u32(10);
+    const uint32x4_t normal_bias = vdupq_n_u32(9);
+    const uint32x4_t subnormal_bias = vdupq_n_u32(117);
+    const uint32x4_t alpha_mask = vld1q_u32(alpha_mask_values);
+    const uint32x4_t alpha_one = vreinterpretq_u32_f32(vld1q_f32(alpha_one_values));
+    const auto convert = [&](uint32x4_t pixel, float* output) {
+        const uint32x4_t exponents = vdupq_laneq_u32(pixel, 3);
+        const float32x4_t normal_scale = vreinterpretq_f32_u32(vshlq_n_u32(vsubq_u32(vmaxq_u32(exponents, min_normal_exponent), normal_bias), 23));
+        const float32x4_t subnormal_scale = vreinterpretq_f32_u32(vshlq_n_u32(vaddq_u32(vminq_u32(exponents, min_normal_exponent), subnormal_bias), 23));
+        const float32x4_t values = vmulq_f32(vmulq_f32(vcvtq_f32_u32(pixel), normal_scale), subnormal_scale);
+        const uint32x4_t cleared = vorrq_u32(vceqzq_u32(exponents), alpha_mask);
+        vst1q_f32(output, vreinterpretq_f32_u32(vorrq_u32(vbicq_u32(vreinterpretq_u32_f32(values), cleared), alpha_one)));
+    };
+    for (; i + 4 <= pixel_count; i += 4) {
+        const uint8x16_t pixels = vld1q_u8(rgbe + i * 4);
+        const uint16x8_t low = vmovl_u8(vget_low_u8(pixels));
+        const uint16x8_t high = vmovl_u8(vget_high_u8(pixels));
+        convert(vmovl_u16(vget_low_u16(low)), rgba + i * 4);
+        convert(vmovl_u16(vget_high_u16(low)), rgba + i * 4 + 4);
+        convert(vmovl_u16(vget_low_u16(high)), rgba + i * 4 + 8);
+        convert(vmovl_u16(vget_high_u16(high)), rgba + i * 4 + 12);
+    }
+#endif
+
+    for (; i < pixel_count; i++) {
+        const uint8_t* const pixel = rgbe + i * 4;
+        float* const output = rgba + i * 4;
+        if (pixel[3] != 0) {
+            const float scale = ldexpf(1.f, static_cast<int>(pixel[3]) - 136);
+            output[0] = static_cast<float>(pixel[0]) * scale;
+            output[1] = static_cast<float>(pixel[1]) * scale;
+            output[2] = static_cast<float>(pixel[2]) * scale;
+        } else {
+            output[0] = 0.f;
+            output[1] = 0.f;
+            output[2] = 0.f;
+        }
+        output[3] = 1.f;
+    }
+}
+
+// Red and blue are the low bytes of the 16-bit halves of every pixel, so they're swapped with 32-bit shifts and masks.
+static void swizzle_rgba8(const uint8_t* input, size_t pixel_count, bool is_bgra, bool is_opaque, uint8_t* rgba) noexcept {
+    size_t i = 0;
+
+#if defined(PIXEL_KERNELS_AVX2)
+    const __m256i green_alpha_mask = _mm256_set1_epi32(static_cast<int>(0xFF00FF00));
+    const __m256i byte_mask = _mm256_set1_epi32(0xFF);
+    const __m256i alpha = _mm256_set1_epi32(is_opaque ? static_cast<int>(0xFF000000) : 0);
+    for (; i + 8 <= pixel_count; i += 8) {
+        __m256i pixels = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i * 4));
+        if (is_bgra) {
+            const __m256i red = _mm256_and_si256(_mm256_srli_epi32(pixels, 16), byte_mask);
+            const __m256i blue = _mm256_slli_epi32(_mm256_and_si256(pixels, byte_mask), 16);
+            pixels = _mm256_or_si256(_mm256_and_si256(pixels, green_alpha_mask), _mm256_or_si256(red, blue));
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(rgba + i * 4), _mm256_or_si256(pixels, alpha));
+    }
+#elif defined(PIXEL_KERNELS_SSE2)
+    const __m128i green_alpha_mask = _mm_set1_epi32(static_cast<int>(0xFF00FF00));
+    const __m128i byte_mask = _mm_set1_epi32(0xFF);
+    const __m128i alpha = _mm_set1_epi32(is_opaque ? static_cast<int>(0xFF000000) : 0);
+    for (; i + 4 <= pixel_count; i += 4) {
+        __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i * 4));
+        if (is_bgra) {
+            const __m128i red = _mm_and_si128(_mm_srli_epi32(pixels, 16), byte_mask);
+            const __m128i blue = _mm_slli_epi32(_mm_and_si128(pixels, byte_mask), 16);
+            pixels = _mm_or_si128(_mm_and_si128(pixels, green_alpha_mask), _mm_or_si128(red, blue));
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(rgba + i * 4), _mm_or_si128(pixels, alpha));
+    }
+#elif defined(PIXEL_KERNELS_NEON)
+    for (; i + 16 <= pixel_count; i += 16) {
+        uint8x16x4_t pixels = vld4q_u8(input + i * 4);
+        if (is_bgra) {
+            const uint8x16_t blue = pixels.val[0];
+            pixels.val[0] = pixels.val[2];
+            pixels.val[2] = blue;
+        }
+        if (is_opaque) {
+            pixels.val[3] = vdupq_n_u8(255);
+        }
+        vst4q_u8(rgba + i * 4, pixels);
+    }
+#endif
+
+    for (; i < pixel_count; i++) {
+        rgba[i * 4] = input[i * 4 + (is_bgra ? 2 : 0)];
+        rgba[i * 4 + 1] = input[i * 4 + 1];
+        rgba[i * 4 + 2] = input[i * 4 + (is_bgra ? 0 : 2)];
+        rgba[i * 4 + 3] = is_opaque ? 255 : input[i * 4 + 3];
+    }
+}
+
+// External, the baseline copy picks the table of a variant at runtime.
+extern const PixelKernels KERNELS = {
+    convert_rgba8_to_planes,
+    convert_rgba16_to_planes,
+    convert_unorm8_to_plane,
+    convert_plane_to_unorm16,
+    convert_unorm16_to_plane,
+    renormalize_packed_normals,
+    reconstruct_normal_z,
+    box_filter_rows,
+    filter_columns,
+    filter_rows,
+    box_filter_rgba8_rows,
+    convert_rgbe_to_rgba32f,
+    swizzle_rgba8,
+};
+
+} // namespace PIXEL_KERNELS_VARIANT
+
+#if defined(PIXEL_KERNELS_DISPATCH)
+
+#if defined(TEXTURE_COMPILER_AVX2_KERNELS)
+namespace avx2 {
+extern const PixelKernels KERNELS;
+} // namespace avx2
+#endif
+
+#if defined(TEXTURE_COMPILER_SCALAR_KERNELS)
+namespace scalar {
+extern const PixelKernels KERNELS;
+} // namespace scalar
+#endif
+
+static const PixelKernels& get_kernels() noexcept {
+#if defined(TEXTURE_COMPILER_AVX2_KERNELS)
+    if (get_instruction_set() == InstructionSet::AVX2) {
+        return avx2::KERNELS;
+    }
+#endif
+#if defined(TEXTURE_COMPILER_SCALAR_KERNELS)
+    if (get_instruction_set() == InstructionSet::SCALAR) {
+        return scalar::KERNELS;
+    }
+#endif
+    return baseline::KERNELS;
+}
+
+void convert_rgba8_to_planes(const uint8_t* rgba, size_t pixel_count, float* red, float* green, float* blue, float* alpha) noexcept {
+    get_kernels().convert_rgba8_to_planes(rgba, pixel_count, red, green, blue, alpha);
+}
+
+void convert_rgba16_to_planes(const uint16_t* rgba, size_t pixel_count, float* red, float* green, float* blue, float* alpha) noexcept {
+    get_kernels().convert_rgba16_to_planes(rgba, pixel_count, red, green, blue, alpha);
+}
+
+void convert_unorm8_to_plane(const uint8_t* unorm8, size_t pixel_count, float* plane) noexcept {
+    get_kernels().convert_unorm8_to_plane(unorm8, pixel_count, plane);
+}
+
+void convert_plane_to_unorm16(const float* plane, size_t pixel_count, uint16_t* unorm16) noexcept {
+    get_kernels().convert_plane_to_unorm16(plane, pixel_count, unorm16);
+}
+
+void convert_unorm16_to_plane(const uint16_t* unorm16, size_t pixel_count, float* plane) noexcept {
+    get_kernels().convert_unorm16_to_plane(unorm16, pixel_count, plane);
+}
+
+void renormalize_packed_normals(float* red, float* green, float* blue, size_t pixel_count) noexcept {
+    get_kernels().renormalize_packed_normals(red, green, blue, pixel_count);
+}
+
+void reconstruct_normal_z(const float* red, const float* green, float* blue, size_t pixel_count) noexcept {
+    get_kernels().reconstruct_normal_z(red, green, blue, pixel_count);
+}
+
+void box_filter_rows(const float* top, const float* bottom, size_t count, float* output) noexcept {
+    get_kernels().box_filter_rows(top, bottom, count, output);
+}
+
+void filter_columns(const float* const* rows, const float (&weights)[MIP_FILTER_TAP_COUNT], size_t count, float* output) noexcept {
+    get_kernels().filter_columns(rows, weights, count, output);
+}
+
+void filter_rows(const float* even, const float* odd, const float (&weights)[MIP_FILTER_TAP_COUNT], size_t count, float* output) noexcept {
+    get_kernels().filter_rows(even, odd, weights, count, output);
+}
+
+void box_filter_rgba8_rows(const uint8_t* top, const uint8_t* bottom, size_t count, uint8_t* output) noexcept {
+    get_kernels().box_filter_rgba8_rows(top, bottom, count, output);
+}
+
+void convert_rgbe_to_rgba32f(const uint8_t* rgbe, size_t pixel_count, float* rgba) noexcept {
+    get_kernels().convert_rgbe_to_rgba32f(rgbe, pixel_count, rgba);
+}
+
+void swizzle_rgba8(const uint8_t* input, size_t pixel_count, bool is_bgra, bool is_opaque, uint8_t* rgba) noexcept {
+    get_kernels().swizzle_rgba8(input, pixel_count, is_bgra, is_opaque, rgba);
+}
+
+#endif
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Vectorized per-pixel kernels. Every kernel has a scalar fallback and produces bit identical results on every
+// instruction set, so outputs don't depend on the machine that compiled them.
+
+// Splits interleaved 8-bit RGBA pixels into four float planes normalized to [0, 1].
+void convert_rgba8_to_planes(const uint8_t* rgba, size_t pixel_count, float* red, float* green, float* blue, float* alpha) noexcept;
+
+// Splits interleaved 16-bit RGBA pixels into four float planes normalized to [0, 1].
+void convert_rgba16_to_planes(const uint16_t* rgba, size_t pixel_count, float* red, float* green, float* blue, float* alpha) noexcept;
+
+// Expands an 8-bit unorm plane to floats in [0, 1], the same values `convert_rgba8_to_planes` gives.
+void convert_unorm8_to_plane(const uint8_t* unorm8, size_t pixel_count, float* plane) noexcept;
+
+// Quantizes a float plane to 16-bit unorm, clamped to [0, 1] and rounded to the nearest step.
+void convert_plane_to_unorm16(const float* plane, size_t pixel_count, uint16_t* unorm16) noexcept;
+
+// Expands a 16-bit unorm plane to floats in [0, 1], the same values `convert_rgba16_to_planes` gives.
+void convert_unorm16_to_plane(const uint16_t* unorm16, size_t pixel_count, float* plane) noexcept;
+
+// Unpacks normals stored in [0, 1] to [-1, 1], scales them back to unit length and packs them again, in place. Same as
+// `expandNormals`, `normalizeNormalMap` and `packNormals` of nvtt one after another, zero length normals included, but
+// in a single pass over the planes.
+void renormalize_packed_normals(float* red, float* green, float* blue, size_t pixel_count) noexcept;
+
+// Reconstructs the blue channel of a normal map packed to [0, 1] from its red and green channels. Broken pixels
+// outside of the unit circle get a flat 0.5.
+void reconstruct_normal_z(const float* red, const float* green, float* blue, size_t pixel_count) noexcept;
+
+// Rows of input pixels the windowed mip filters weight for a single pixel of the next level.
+static constexpr size_t MIP_FILTER_TAP_COUNT = 12;
+
+// Averages 2x2 quads of two rows of a float plane, `0.25 * ((a + b) + (c + d))` in this exact order matches nvtt.
+void box_filter_rows(const float* top, const float* bottom, size_t count, float* output) noexcept;
+
+// Weighted sum of the same pixels of every tap row, taps are added one after another in the same order on every
+// instruction set.
+void filter_columns(const float* const* rows, const float (&weights)[MIP_FILTER_TAP_COUNT], size_t count, float* output) noexcept;
+
+// Horizontal pass over a row split into even and odd pixels of the padded row, so that tap `2m` of pixel `x` is
+// `even[x + m]` and tap `2m + 1` is `odd[x + m]` and every tap is a contiguous load.
+void filter_rows(const float* even, const float* odd, const float (&weights)[MIP_FILTER_TAP_COUNT], size_t count, float* output) noexcept;
+
+// Averages 2x2 quads of RGBA8 pixels of two rows, `(a + b + c + d + 2) / 4` for every channel.
+void box_filter_rgba8_rows(const uint8_t* top, const uint8_t* bottom, size_t count, uint8_t* output) noexcept;
+
+// Expands RGBE pixels of Radiance HDR images to RGBA floats with alpha one, bit identical to `stbi_loadf`.
+void convert_rgbe_to_rgba32f(const uint8_t* rgbe, size_t pixel_count, float* rgba) noexcept;
+
+// Copies 32-bit pixels to RGBA8, swapping red and blue of BGRA pixels and making the alpha of pixels without one opaque.
+void swizzle_rgba8(const uint8_t* input, size_t pixel_count, bool is_bgra, bool is_opaque, uint8_t* rgba) noexcept;
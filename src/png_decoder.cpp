@@ -0,0 +1,480 @@
+#include "png_decoder.h"
+
+#include <climits>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <utility>
+#include <vector>
+
+#if defined(TEXTURE_COMPILER_ZLIB)
+#include <zlib.h>
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define PNG_DECODER_SSE2
+#include <emmintrin.h>
+#endif
+
+#if defined(TEXTURE_COMPILER_ZLIB)
+
+static const uint8_t PNG_SIGNATURE[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+
+static constexpr uint32_t PNG_CHUNK_IHDR = 0x49484452;
+static constexpr uint32_t PNG_CHUNK_PLTE = 0x504C5445;
+static constexpr uint32_t PNG_CHUNK_TRNS = 0x74524E53;
+static constexpr uint32_t PNG_CHUNK_IDAT = 0x49444154;
+static constexpr uint32_t PNG_CHUNK_IEND = 0x49454E44;
+static constexpr uint32_t PNG_CHUNK_CGBI = 0x43674249;
+
+static constexpr uint8_t PNG_COLOR_GREY = 0;
+static constexpr uint8_t PNG_COLOR_RGB = 2;
+static constexpr uint8_t PNG_COLOR_PALETTE = 3;
+static constexpr uint8_t PNG_COLOR_GREY_ALPHA = 4;
+static constexpr uint8_t PNG_COLOR_RGBA = 6;
+
+static constexpr uint8_t PNG_FILTER_NONE = 0;
+static constexpr uint8_t PNG_FILTER_SUB = 1;
+static constexpr uint8_t PNG_FILTER_UP = 2;
+static constexpr uint8_t PNG_FILTER_AVERAGE = 3;
+static constexpr uint8_t PNG_FILTER_PAETH = 4;
+
+// Same limit as stb_image, larger images are left to it to reject.
+static constexpr uint32_t PNG_MAX_SIZE = 1 << 24;
+
+static uint32_t read_be32(const uint8_t* data) noexcept {
+    return static_cast<uint32_t>(data[0]) << 24 | static_cast<uint32_t>(data[1]) << 16 | static_cast<uint32_t>(data[2]) << 8 | static_cast<uint32_t>(data[3]);
+}
+
+static uint8_t paeth_predictor(int a, int b, int c) noexcept {
+    const int pa = std::abs(b - c);
+    const int pb = std::abs(a - c);
+    const int pc = std::abs(a + b - c - c);
+    if (pa <= pb && pa <= pc) {
+        return static_cast<uint8_t>(a);
+    }
+    if (pb <= pc) {
+        return static_cast<uint8_t>(b);
+    }
+    return static_cast<uint8_t>(c);
+}
+
+#if defined(PNG_DECODER_SSE2)
+
+// Pixels of three and four bytes are unfiltered a pixel at a time in the low lanes of a register, every pixel depends on
+// the one to its left. Pixel size is a template argument, so loads and stores compile to plain moves.
+// Three byte pixels are assembled in a general purpose register, a copy through memory would stall on store forwarding.
+template <size_t PIXEL_SIZE>
+static __m128i load_pixel(const uint8_t* pixel) noexcept {
+    uint32_t value;
+    if constexpr (PIXEL_SIZE == 4) {
+        std::memcpy(&value, pixel, 4);
+    } else {
+        uint16_t low;
+        std::memcpy(&low, pixel, 2);
+        value = static_cast<uint32_t>(low) | static_cast<uint32_t>(pixel[2]) << 16;
+    }
+    return _mm_cvtsi32_si128(static_cast<int>(value));
+}
+
+template <size_t PIXEL_SIZE>
+static void store_pixel(uint8_t* pixel, __m128i value) noexcept {
+    const uint32_t result = static_cast<uint32_t>(_mm_cvtsi128_si32(value));
+    if constexpr (PIXEL_SIZE == 4) {
+        std::memcpy(pixel, &result, 4);
+    } else {
+        const uint16_t low = static_cast<uint16_t>(result);
+        std::memcpy(pixel, &low, 2);
+        pixel[2] = static_cast<uint8_t>(result >> 16);
+    }
+}
+
+static __m128i select(__m128i mask, __m128i a, __m128i b) noexcept {
+    return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+
+static __m128i abs_epi16(__m128i value) noexcept {
+    return _mm_max_epi16(value, _mm_sub_epi16(_mm_setzero_si128(), value));
+}
+
+template <size_t PIXEL_SIZE>
+static void unfilter_sub_sse2(uint8_t* row, size_t size) noexcept {
+    __m128i left = _mm_setzero_si128();
+    for (size_t i = 0; i < size; i += PIXEL_SIZE) {
+        left = _mm_add_epi8(load_pixel<PIXEL_SIZE>(row + i), left);
+        store_pixel<PIXEL_SIZE>(row + i, left);
+    }
+}
+
+template <size_t PIXEL_SIZE>
+static void unfilter_average_sse2(uint8_t* row, const uint8_t* previous, size_t size) noexcept {
+    // Rounding average minus the lowest bit of the sum is the average rounded down.
+    const __m128i one = _mm_set1_epi8(1);
+    __m128i left = _mm_setzero_si128();
+    for (size_t i = 0; i < size; i += PIXEL_SIZE) {
+        const __m128i up = load_pixel<PIXEL_SIZE>(previous + i);
+        const __m128i average = _mm_sub_epi8(_mm_avg_epu8(left, up), _mm_and_si128(_mm_xor_si128(left, up), one));
+        left = _mm_add_epi8(load_pixel<PIXEL_SIZE>(row + i), average);
+        store_pixel<PIXEL_SIZE>(row + i, left);
+    }
+}
+
+template <size_t PIXEL_SIZE>
+static void unfilter_paeth_sse2(uint8_t* row, const uint8_t* previous, size_t size) noexcept {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i mask = _mm_set1_epi16(0xFF);
+    __m128i left = zero;
+    __m128i up_left = zero;
+    for (size_t i = 0; i < size; i += PIXEL_SIZE) {
+        const __m128i up = _mm_unpacklo_epi8(load_pixel<PIXEL_SIZE>(previous + i), zero);
+        const __m128i filtered = _mm_unpacklo_epi8(load_pixel<PIXEL_SIZE>(row + i), zero);
+
+        const __m128i pa = abs_epi16(_mm_sub_epi16(up, up_left));
+        const __m128i pb = abs_epi16(_mm_sub_epi16(left, up_left));
+        const __m128i pc = abs_epi16(_mm_sub_epi16(_mm_add_epi16(left, up), _mm_add_epi16(up_left, up_left)));
+        const __m128i smallest = _mm_min_epi16(_mm_min_epi16(pa, pb), pc);
+
+        // Ties prefer left, then up, like the scalar predictor.
+        __m128i predictor = select(_mm_cmpeq_epi16(pb, smallest), up, up_left);
+        predictor = select(_mm_cmpeq_epi16(pa, smallest), left, predictor);
+
+        left = _mm_and_si128(_mm_add_epi16(filtered, predictor), mask);
+        store_pixel<PIXEL_SIZE>(row + i, _mm_packus_epi16(left, left));
+        up_left = up;
+    }
+}
+
+#endif
+
+// Reverses the filter of a row in place. Every filter but up depends on the pixel to the left, so only the bytes of a
+// single pixel are unfiltered in parallel. The previous row is all zeros for the first row.
+static bool unfilter_row(uint8_t filter, uint8_t* row, const uint8_t* previous, size_t size, size_t pixel_size) noexcept {
+    switch (filter) {
+        case PNG_FILTER_NONE:
+            return true;
+        case PNG_FILTER_SUB:
+#if defined(PNG_DECODER_SSE2)
+            if (pixel_size == 3 || pixel_size == 4) {
+                pixel_size == 3 ? unfilter_sub_sse2<3>(row, size) : unfilter_sub_sse2<4>(row, size);
+                return true;
+            }
+#endif
+            for (size_t i = pixel_size; i < size; i++) {
+                row[i] = static_cast<uint8_t>(row[i] + row[i - pixel_size]);
+            }
+            return true;
+        case PNG_FILTER_UP: {
+            size_t i = 0;
+#if defined(PNG_DECODER_SSE2)
+            for (; i + 16 <= size; i += 16) {
+                const __m128i filtered = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row + i));
+                const __m128i up = _mm_loadu_si128(reinterpret_cast<const __m128i*>(previous + i));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(row + i), _mm_add_epi8(filtered, up));
+            }
+#endif
+            for (; i < size; i++) {
+                row[i] = static_cast<uint8_t>(row[i] + previous[i]);
+            }
+            return true;
+        }
+        case PNG_FILTER_AVERAGE:
+#if defined(PNG_DECODER_SSE2)
+            if (pixel_size == 3 || pixel_size == 4) {
+                pixel_size == 3 ? unfilter_average_sse2<3>(row, previous, size) : unfilter_average_sse2<4>(row, previous, size);
+                return true;
+            }
+#endif
+            for (size_t i = 0; i < size; i++) {
+                const int left = i >= pixel_size ? row[i - pixel_size] : 0;
+                row[i] = static_cast<uint8_t>(row[i] + ((left + previous[i]) >> 1));
+            }
+            return true;
+        case PNG_FILTER_PAETH:
+#if defined(PNG_DECODER_SSE2)
+            if (pixel_size == 3 || pixel_size == 4) {
+                pixel_size == 3 ? unfilter_paeth_sse2<3>(row, previous, size) : unfilter_paeth_sse2<4>(row, previous, size);
+                return true;
+            }
+#endif
+            for (size_t i = 0; i < size; i++) {
+                const int left = i >= pixel_size ? row[i - pixel_size] : 0;
+                const int up_left = i >= pixel_size ? previous[i - pixel_size] : 0;
+                row[i] = static_cast<uint8_t>(row[i] + paeth_predictor(left, previous[i], up_left));
+            }
+            return true;
+        default:
+            return false;
+    }
+}
+
+// Expands an unfiltered row to RGBA8. Samples of 16-bit images are big endian, so their high byte comes first.
+static void expand_row(const uint8_t* row, size_t width, uint8_t color_type, size_t sample_size, const uint8_t (&palette)[256][4], uint8_t* output) noexcept {
+    switch (color_type) {
+        case PNG_COLOR_GREY:
+            for (size_t x = 0; x < width; x++) {
+                const uint8_t grey = row[x * sample_size];
+                output[x * 4 + 0] = grey;
+                output[x * 4 + 1] = grey;
+                output[x * 4 + 2] = grey;
+                output[x * 4 + 3] = 255;
+            }
+            break;
+        case PNG_COLOR_RGB:
+            for (size_t x = 0; x < width; x++) {
+                output[x * 4 + 0] = row[(x * 3 + 0) * sample_size];
+                output[x * 4 + 1] = row[(x * 3 + 1) * sample_size];
+                output[x * 4 + 2] = row[(x * 3 + 2) * sample_size];
+                output[x * 4 + 3] = 255;
+            }
+            break;
+        case PNG_COLOR_PALETTE:
+            for (size_t x = 0; x < width; x++) {
+                std::memcpy(output + x * 4, palette[row[x]], 4);
+            }
+            break;
+        case PNG_COLOR_GREY_ALPHA:
+            for (size_t x = 0; x < width; x++) {
+                const uint8_t grey = row[(x * 2 + 0) * sample_size];
+                output[x * 4 + 0] = grey;
+                output[x * 4 + 1] = grey;
+                output[x * 4 + 2] = grey;
+                output[x * 4 + 3] = row[(x * 2 + 1) * sample_size];
+            }
+            break;
+        default:
+            if (sample_size == 1) {
+                std::memcpy(output, row, width * 4);
+            } else {
+                for (size_t i = 0; i < width * 4; i++) {
+                    output[i] = row[i * 2];
+                }
+            }
+            break;
+    }
+}
+
+namespace {
+
+// Inflates the concatenated data of all the IDAT chunks without copying them together.
+struct IdatStream final {
+    IdatStream() noexcept = default;
+
+    IdatStream(const IdatStream&) = delete;
+    IdatStream(IdatStream&&) = delete;
+    IdatStream& operator=(const IdatStream&) = delete;
+    IdatStream& operator=(IdatStream&&) = delete;
+
+    ~IdatStream() {
+        if (is_initialized) {
+            inflateEnd(&stream);
+        }
+    }
+
+    bool initialize() noexcept {
+        std::memset(&stream, 0, sizeof(stream));
+        is_initialized = inflateInit(&stream) == Z_OK;
+        return is_initialized;
+    }
+
+    // Fills exactly `size` bytes, fails when the stream ends or breaks before that.
+    bool read(uint8_t* output, size_t size) noexcept {
+        stream.next_out = output;
+        stream.avail_out = static_cast<uInt>(size);
+        while (stream.avail_out != 0) {
+            if (stream.avail_in == 0) {
+                if (next_chunk == chunks.size()) {
+                    return false;
+                }
+                stream.next_in = const_cast<Bytef*>(chunks[next_chunk].first);
+                stream.avail_in = static_cast<uInt>(chunks[next_chunk].second);
+                next_chunk++;
+                continue;
+            }
+
+            const int result = inflate(&stream, Z_NO_FLUSH);
+            if (result == Z_STREAM_END) {
+                return stream.avail_out == 0;
+            }
+            if (result != Z_OK) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    std::vector<std::pair<const uint8_t*, size_t>> chunks;
+    size_t next_chunk = 0;
+    z_stream stream;
+    bool is_initialized = false;
+};
+
+} // namespace
+
+// Decodes to RGBA8 when `channel` is negative, or to the specified channel of RGBA8 otherwise.
+static std::unique_ptr<uint8_t[]> decode_png(const uint8_t* data, size_t size, int channel, int& width, int& height, int& channels) noexcept {
+    if (size < 8 + 8 + 13 + 4 || std::memcmp(data, PNG_SIGNATURE, sizeof(PNG_SIGNATURE)) != 0) {
+        return nullptr;
+    }
+
+    if (read_be32(data + 8) != 13 || read_be32(data + 12) != PNG_CHUNK_IHDR) {
+        return nullptr;
+    }
+
+    const uint8_t* header = data + 16;
+    const uint32_t image_width = read_be32(header);
+    const uint32_t image_height = read_be32(header + 4);
+    const uint8_t bit_depth = header[8];
+    const uint8_t color_type = header[9];
+    if (image_width == 0 || image_height == 0 || image_width > PNG_MAX_SIZE || image_height > PNG_MAX_SIZE) {
+        return nullptr;
+    }
+
+    // Compression, filter method and interlacing.
+    if (header[10] != 0 || header[11] != 0 || header[12] != 0) {
+        return nullptr;
+    }
+
+    size_t sample_count;
+    switch (color_type) {
+        case PNG_COLOR_GREY:
+        case PNG_COLOR_PALETTE:
+            sample_count = 1;
+            break;
+        case PNG_COLOR_RGB:
+            sample_count = 3;
+            break;
+        case PNG_COLOR_GREY_ALPHA:
+            sample_count = 2;
+            break;
+        case PNG_COLOR_RGBA:
+            sample_count = 4;
+            break;
+        default:
+            return nullptr;
+    }
+
+    if (bit_depth != 8 && (bit_depth != 16 || color_type == PNG_COLOR_PALETTE)) {
+        return nullptr;
+    }
+
+    // Palette entries without an entry in the file are opaque black.
+    uint8_t palette[256][4] = {};
+    for (uint8_t(&entry)[4] : palette) {
+        entry[3] = 255;
+    }
+    size_t palette_size = 0;
+    bool has_alpha = color_type == PNG_COLOR_GREY_ALPHA || color_type == PNG_COLOR_RGBA;
+
+    IdatStream idat;
+    size_t offset = 8 + 8 + 13 + 4;
+    while (true) {
+        if (size - offset < 12) {
+            return nullptr;
+        }
+
+        const uint32_t length = read_be32(data + offset);
+        const uint32_t type = read_be32(data + offset + 4);
+        if (length > size - offset - 12) {
+            return nullptr;
+        }
+
+        const uint8_t* chunk = data + offset + 8;
+        if (type == PNG_CHUNK_IEND) {
+            break;
+        }
+
+        if (type == PNG_CHUNK_IDAT) {
+            if (length != 0) {
+                idat.chunks.emplace_back(chunk, length);
+            }
+        } else if (type == PNG_CHUNK_PLTE) {
+            if (length % 3 != 0 || length / 3 > 256) {
+                return nullptr;
+            }
+            palette_size = length / 3;
+            for (size_t i = 0; i < palette_size; i++) {
+                std::memcpy(palette[i], chunk + i * 3, 3);
+            }
+        } else if (type == PNG_CHUNK_TRNS) {
+            // Color keys of other color types are rare enough to leave them to stb_image.
+            if (color_type != PNG_COLOR_PALETTE || length > palette_size) {
+                return nullptr;
+            }
+            for (uint32_t i = 0; i < length; i++) {
+                palette[i][3] = chunk[i];
+            }
+            has_alpha = true;
+        } else if (type == PNG_CHUNK_CGBI) {
+            return nullptr;
+        }
+
+        offset += 12 + static_cast<size_t>(length);
+    }
+
+    if (idat.chunks.empty() || (color_type == PNG_COLOR_PALETTE && palette_size == 0)) {
+        return nullptr;
+    }
+
+    const size_t sample_size = bit_depth / 8;
+    const size_t pixel_size = sample_count * sample_size;
+    const size_t row_size = static_cast<size_t>(image_width) * pixel_size;
+    const size_t rgba_row_size = static_cast<size_t>(image_width) * 4;
+    const size_t output_row_size = channel < 0 ? rgba_row_size : static_cast<size_t>(image_width);
+    if (row_size + 1 > UINT_MAX || output_row_size > SIZE_MAX / image_height) {
+        return nullptr;
+    }
+
+    std::unique_ptr<uint8_t[]> output(new (std::nothrow) uint8_t[output_row_size * image_height]);
+    std::unique_ptr<uint8_t[]> rows(new (std::nothrow) uint8_t[(row_size + 1) * 2]);
+    std::unique_ptr<uint8_t[]> rgba_row(channel < 0 ? nullptr : new (std::nothrow) uint8_t[rgba_row_size]);
+    if (output == nullptr || rows == nullptr || (channel >= 0 && rgba_row == nullptr) || !idat.initialize()) {
+        return nullptr;
+    }
+
+    // Every row is preceded by its filter byte. The first row is unfiltered against a row of zeros.
+    uint8_t* current = rows.get();
+    uint8_t* previous = rows.get() + row_size + 1;
+    std::memset(previous, 0, row_size + 1);
+
+    for (uint32_t y = 0; y < image_height; y++) {
+        if (!idat.read(current, row_size + 1) || !unfilter_row(current[0], current + 1, previous + 1, row_size, pixel_size)) {
+            return nullptr;
+        }
+
+        uint8_t* const output_row = output.get() + y * output_row_size;
+        if (channel < 0) {
+            expand_row(current + 1, image_width, color_type, sample_size, palette, output_row);
+        } else {
+            expand_row(current + 1, image_width, color_type, sample_size, palette, rgba_row.get());
+            for (size_t x = 0; x < image_width; x++) {
+                output_row[x] = rgba_row[x * 4 + static_cast<size_t>(channel)];
+            }
+        }
+        std::swap(current, previous);
+    }
+
+    width = static_cast<int>(image_width);
+    height = static_cast<int>(image_height);
+    channels = color_type == PNG_COLOR_PALETTE ? (has_alpha ? 4 : 3) : static_cast<int>(sample_count);
+    return output;
+}
+
+std::unique_ptr<uint8_t[]> decode_png_rgba8(const uint8_t* data, size_t size, int& width, int& height, int& channels) noexcept {
+    return decode_png(data, size, -1, width, height, channels);
+}
+
+std::unique_ptr<uint8_t[]> decode_png_channel8(const uint8_t* data, size_t size, int channel, int& width, int& height, int& channels) noexcept {
+    return decode_png(data, size, channel, width, height, channels);
+}
+
+#else
+
+std::unique_ptr<uint8_t[]> decode_png_rgba8(const uint8_t*, size_t, int&, int&, int&) noexcept {
+    return nullptr;
+}
+
+std::unique_ptr<uint8_t[]> decode_png_channel8(const uint8_t*, size_t, int, int&, int&, int&) noexcept {
+    return nullptr;
+}
+
+#endif
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+// Decodes a non-interlaced 8 or 16-bit PNG image of any color type to RGBA8 pixels exactly like `stbi_load` with four
+// components does, 16-bit channels keep their high byte. The zlib stream is inflated by zlib, or zlib-ng built in
+// zlib compatible mode, a row at a time, and every row is unfiltered with SSE2 where available and expanded to RGBA8
+// while it's still in the cache, so the filtered image is never stored as a whole. Returns null for everything else,
+// including images that are not PNG, bit depths below 8, interlaced images and color keys of images without a palette,
+// which are then left to stb_image. Always returns null when the compiler is built without zlib.
+std::unique_ptr<uint8_t[]> decode_png_rgba8(const uint8_t* data, size_t size, int& width, int& height, int& channels) noexcept;
+
+// Same as `decode_png_rgba8`, but keeps only the specified channel of every RGBA8 pixel, a byte per pixel. Rows are
+// expanded to RGBA8 one at a time, so the RGBA8 image is never stored as a whole.
+std::unique_ptr<uint8_t[]> decode_png_channel8(const uint8_t* data, size_t size, int channel, int& width, int& height, int& channels) noexcept;
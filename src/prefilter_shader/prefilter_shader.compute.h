@@ -0,0 +1,596 @@
+#include <cstdint>
+
+static const uint8_t prefilter_shader_compute_glsl[2903] =
+{
+	0x43, 0x53, 0x48, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x0b, // CSH...........D.
+	0x00, 0x00, 0x23, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x34, 0x33, 0x30, 0x0a, 0x76, // ..#version 430.v
+	0x65, 0x63, 0x33, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x4d, 0x75, 0x6c, 0x28, 0x76, 0x65, 0x63, 0x33, // ec3 instMul(vec3
+	0x20, 0x5f, 0x76, 0x65, 0x63, 0x2c, 0x20, 0x6d, 0x61, 0x74, 0x33, 0x20, 0x5f, 0x6d, 0x74, 0x78, //  _vec, mat3 _mtx
+	0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x28, 0x20, 0x28, 0x5f, 0x76, // ) { return ( (_v
+	0x65, 0x63, 0x29, 0x20, 0x2a, 0x20, 0x28, 0x5f, 0x6d, 0x74, 0x78, 0x29, 0x20, 0x29, 0x3b, 0x20, // ec) * (_mtx) ); 
+	0x7d, 0x0a, 0x76, 0x65, 0x63, 0x33, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x4d, 0x75, 0x6c, 0x28, 0x6d, // }.vec3 instMul(m
+	0x61, 0x74, 0x33, 0x20, 0x5f, 0x6d, 0x74, 0x78, 0x2c, 0x20, 0x76, 0x65, 0x63, 0x33, 0x20, 0x5f, // at3 _mtx, vec3 _
+	0x76, 0x65, 0x63, 0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x28, 0x20, // vec) { return ( 
+	0x28, 0x5f, 0x6d, 0x74, 0x78, 0x29, 0x20, 0x2a, 0x20, 0x28, 0x5f, 0x76, 0x65, 0x63, 0x29, 0x20, // (_mtx) * (_vec) 
+	0x29, 0x3b, 0x20, 0x7d, 0x0a, 0x76, 0x65, 0x63, 0x34, 0x20, 0x69, 0x6e, 0x73, 0x74, 0x4d, 0x75, // ); }.vec4 instMu
+	0x6c, 0x28, 0x76, 0x65, 0x63, 0x34, 0x20, 0x5f, 0x76, 0x65, 0x63, 0x2c, 0x20, 0x6d, 0x61, 0x74, // l(vec4 _vec, mat
+	0x34, 0x20, 0x5f, 0x6d, 0x74, 0x78, 0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, // 4 _mtx) { return
+	0x20, 0x28, 0x20, 0x28, 0x5f, 0x76, 0x65, 0x63, 0x29, 0x20, 0x2a, 0x20, 0x28, 0x5f, 0x6d, 0x74, //  ( (_vec) * (_mt
+	0x78, 0x29, 0x20, 0x29, 0x3b, 0x20, 0x7d, 0x0a, 0x76, 0x65, 0x63, 0x34, 0x20, 0x69, 0x6e, 0x73, // x) ); }.vec4 ins
+	0x74, 0x4d, 0x75, 0x6c, 0x28, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x5f, 0x6d, 0x74, 0x78, 0x2c, 0x20, // tMul(mat4 _mtx, 
+	0x76, 0x65, 0x63, 0x34, 0x20, 0x5f, 0x76, 0x65, 0x63, 0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, // vec4 _vec) { ret
+	0x75, 0x72, 0x6e, 0x20, 0x28, 0x20, 0x28, 0x5f, 0x6d, 0x74, 0x78, 0x29, 0x20, 0x2a, 0x20, 0x28, // urn ( (_mtx) * (
+	0x5f, 0x76, 0x65, 0x63, 0x29, 0x20, 0x29, 0x3b, 0x20, 0x7d, 0x0a, 0x66, 0x6c, 0x6f, 0x61, 0x74, // _vec) ); }.float
+	0x20, 0x72, 0x63, 0x70, 0x28, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x5f, 0x61, 0x29, 0x20, 0x7b, //  rcp(float _a) {
+	0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x31, 0x2e, 0x30, 0x2f, 0x5f, 0x61, 0x3b, 0x20, //  return 1.0/_a; 
+	0x7d, 0x0a, 0x76, 0x65, 0x63, 0x32, 0x20, 0x72, 0x63, 0x70, 0x28, 0x76, 0x65, 0x63, 0x32, 0x20, // }.vec2 rcp(vec2 
+	0x5f, 0x61, 0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x76, 0x65, 0x63, // _a) { return vec
+	0x32, 0x28, 0x31, 0x2e, 0x30, 0x29, 0x2f, 0x5f, 0x61, 0x3b, 0x20, 0x7d, 0x0a, 0x76, 0x65, 0x63, // 2(1.0)/_a; }.vec
+	0x33, 0x20, 0x72, 0x63, 0x70, 0x28, 0x76, 0x65, 0x63, 0x33, 0x20, 0x5f, 0x61, 0x29, 0x20, 0x7b, // 3 rcp(vec3 _a) {
+	0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x76, 0x65, 0x63, 0x33, 0x28, 0x31, 0x2e, 0x30, //  return vec3(1.0
+	0x29, 0x2f, 0x5f, 0x61, 0x3b, 0x20, 0x7d, 0x0a, 0x76, 0x65, 0x63, 0x34, 0x20, 0x72, 0x63, 0x70, // )/_a; }.vec4 rcp
+	0x28, 0x76, 0x65, 0x63, 0x34, 0x20, 0x5f, 0x61, 0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, // (vec4 _a) { retu
+	0x72, 0x6e, 0x20, 0x76, 0x65, 0x63, 0x34, 0x28, 0x31, 0x2e, 0x30, 0x29, 0x2f, 0x5f, 0x61, 0x3b, // rn vec4(1.0)/_a;
+	0x20, 0x7d, 0x0a, 0x76, 0x65, 0x63, 0x32, 0x20, 0x76, 0x65, 0x63, 0x32, 0x5f, 0x73, 0x70, 0x6c, //  }.vec2 vec2_spl
+	0x61, 0x74, 0x28, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x5f, 0x78, 0x29, 0x20, 0x7b, 0x20, 0x72, // at(float _x) { r
+	0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x76, 0x65, 0x63, 0x32, 0x28, 0x5f, 0x78, 0x2c, 0x20, 0x5f, // eturn vec2(_x, _
+	0x78, 0x29, 0x3b, 0x20, 0x7d, 0x0a, 0x76, 0x65, 0x63, 0x33, 0x20, 0x76, 0x65, 0x63, 0x33, 0x5f, // x); }.vec3 vec3_
+	0x73, 0x70, 0x6c, 0x61, 0x74, 0x28, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x5f, 0x78, 0x29, 0x20, // splat(float _x) 
+	0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x76, 0x65, 0x63, 0x33, 0x28, 0x5f, 0x78, // { return vec3(_x
+	0x2c, 0x20, 0x5f, 0x78, 0x2c, 0x20, 0x5f, 0x78, 0x29, 0x3b, 0x20, 0x7d, 0x0a, 0x76, 0x65, 0x63, // , _x, _x); }.vec
+	0x34, 0x20, 0x76, 0x65, 0x63, 0x34, 0x5f, 0x73, 0x70, 0x6c, 0x61, 0x74, 0x28, 0x66, 0x6c, 0x6f, // 4 vec4_splat(flo
+	0x61, 0x74, 0x20, 0x5f, 0x78, 0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, // at _x) { return 
+	0x76, 0x65, 0x63, 0x34, 0x28, 0x5f, 0x78, 0x2c, 0x20, 0x5f, 0x78, 0x2c, 0x20, 0x5f, 0x78, 0x2c, // vec4(_x, _x, _x,
+	0x20, 0x5f, 0x78, 0x29, 0x3b, 0x20, 0x7d, 0x0a, 0x75, 0x76, 0x65, 0x63, 0x32, 0x20, 0x75, 0x76, //  _x); }.uvec2 uv
+	0x65, 0x63, 0x32, 0x5f, 0x73, 0x70, 0x6c, 0x61, 0x74, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, // ec2_splat(uint _
+	0x78, 0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x75, 0x76, 0x65, 0x63, // x) { return uvec
+	0x32, 0x28, 0x5f, 0x78, 0x2c, 0x20, 0x5f, 0x78, 0x29, 0x3b, 0x20, 0x7d, 0x0a, 0x75, 0x76, 0x65, // 2(_x, _x); }.uve
+	0x63, 0x33, 0x20, 0x75, 0x76, 0x65, 0x63, 0x33, 0x5f, 0x73, 0x70, 0x6c, 0x61, 0x74, 0x28, 0x75, // c3 uvec3_splat(u
+	0x69, 0x6e, 0x74, 0x20, 0x5f, 0x78, 0x29, 0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, // int _x) { return
+	0x20, 0x75, 0x76, 0x65, 0x63, 0x33, 0x28, 0x5f, 0x78, 0x2c, 0x20, 0x5f, 0x78, 0x2c, 0x20, 0x5f, //  uvec3(_x, _x, _
+	0x78, 0x29, 0x3b, 0x20, 0x7d, 0x0a, 0x75, 0x76, 0x65, 0x63, 0x34, 0x20, 0x75, 0x76, 0x65, 0x63, // x); }.uvec4 uvec
+	0x34, 0x5f, 0x73, 0x70, 0x6c, 0x61, 0x74, 0x28, 0x75, 0x69, 0x6e, 0x74, 0x20, 0x5f, 0x78, 0x29, // 4_splat(uint _x)
+	0x20, 0x7b, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x75, 0x76, 0x65, 0x63, 0x34, 0x28, //  { return uvec4(
+	0x5f, 0x78, 0x2c, 0x20, 0x5f, 0x78, 0x2c, 0x20, 0x5f, 0x78, 0x2c, 0x20, 0x5f, 0x78, 0x29, 0x3b, // _x, _x, _x, _x);
+	0x20, 0x7d, 0x0a, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x6d, 0x74, 0x78, 0x46, 0x72, 0x6f, 0x6d, 0x52, //  }.mat4 mtxFromR
+	0x6f, 0x77, 0x73, 0x28, 0x76, 0x65, 0x63, 0x34, 0x20, 0x5f, 0x30, 0x2c, 0x20, 0x76, 0x65, 0x63, // ows(vec4 _0, vec
+	0x34, 0x20, 0x5f, 0x31, 0x2c, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x5f, 0x32, 0x2c, 0x20, 0x76, // 4 _1, vec4 _2, v
+	0x65, 0x63, 0x34, 0x20, 0x5f, 0x33, 0x29, 0x0a, 0x7b, 0x0a, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, // ec4 _3).{.return
+	0x20, 0x74, 0x72, 0x61, 0x6e, 0x73, 0x70, 0x6f, 0x73, 0x65, 0x28, 0x6d, 0x61, 0x74, 0x34, 0x28, //  transpose(mat4(
+	0x5f, 0x30, 0x2c, 0x20, 0x5f, 0x31, 0x2c, 0x20, 0x5f, 0x32, 0x2c, 0x20, 0x5f, 0x33, 0x29, 0x20, // _0, _1, _2, _3) 
+	0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x6d, 0x74, 0x78, 0x46, 0x72, 0x6f, // );.}.mat4 mtxFro
+	0x6d, 0x43, 0x6f, 0x6c, 0x73, 0x28, 0x76, 0x65, 0x63, 0x34, 0x20, 0x5f, 0x30, 0x2c, 0x20, 0x76, // mCols(vec4 _0, v
+	0x65, 0x63, 0x34, 0x20, 0x5f, 0x31, 0x2c, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x5f, 0x32, 0x2c, // ec4 _1, vec4 _2,
+	0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x5f, 0x33, 0x29, 0x0a, 0x7b, 0x0a, 0x72, 0x65, 0x74, 0x75, //  vec4 _3).{.retu
+	0x72, 0x6e, 0x20, 0x6d, 0x61, 0x74, 0x34, 0x28, 0x5f, 0x30, 0x2c, 0x20, 0x5f, 0x31, 0x2c, 0x20, // rn mat4(_0, _1, 
+	0x5f, 0x32, 0x2c, 0x20, 0x5f, 0x33, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, // _2, _3);.}.unifo
+	0x72, 0x6d, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x75, 0x5f, 0x76, 0x69, 0x65, 0x77, 0x52, 0x65, // rm vec4 u_viewRe
+	0x63, 0x74, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x76, 0x65, 0x63, 0x34, // ct;.uniform vec4
+	0x20, 0x75, 0x5f, 0x76, 0x69, 0x65, 0x77, 0x54, 0x65, 0x78, 0x65, 0x6c, 0x3b, 0x0a, 0x75, 0x6e, //  u_viewTexel;.un
+	0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x75, 0x5f, 0x76, 0x69, 0x65, // iform mat4 u_vie
+	0x77, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x6d, 0x61, 0x74, 0x34, 0x20, // w;.uniform mat4 
+	0x75, 0x5f, 0x69, 0x6e, 0x76, 0x56, 0x69, 0x65, 0x77, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, // u_invView;.unifo
+	0x72, 0x6d, 0x20, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x75, 0x5f, 0x70, 0x72, 0x6f, 0x6a, 0x3b, 0x0a, // rm mat4 u_proj;.
+	0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x75, 0x5f, 0x69, // uniform mat4 u_i
+	0x6e, 0x76, 0x50, 0x72, 0x6f, 0x6a, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, // nvProj;.uniform 
+	0x6d, 0x61, 0x74, 0x34, 0x20, 0x75, 0x5f, 0x76, 0x69, 0x65, 0x77, 0x50, 0x72, 0x6f, 0x6a, 0x3b, // mat4 u_viewProj;
+	0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x75, 0x5f, // .uniform mat4 u_
+	0x69, 0x6e, 0x76, 0x56, 0x69, 0x65, 0x77, 0x50, 0x72, 0x6f, 0x6a, 0x3b, 0x0a, 0x75, 0x6e, 0x69, // invViewProj;.uni
+	0x66, 0x6f, 0x72, 0x6d, 0x20, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x75, 0x5f, 0x6d, 0x6f, 0x64, 0x65, // form mat4 u_mode
+	0x6c, 0x5b, 0x33, 0x32, 0x5d, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x6d, // l[32];.uniform m
+	0x61, 0x74, 0x34, 0x20, 0x75, 0x5f, 0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x56, 0x69, 0x65, 0x77, 0x3b, // at4 u_modelView;
+	0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x75, 0x5f, // .uniform mat4 u_
+	0x6d, 0x6f, 0x64, 0x65, 0x6c, 0x56, 0x69, 0x65, 0x77, 0x50, 0x72, 0x6f, 0x6a, 0x3b, 0x0a, 0x75, // modelViewProj;.u
+	0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x75, 0x5f, 0x61, 0x6c, // niform vec4 u_al
+	0x70, 0x68, 0x61, 0x52, 0x65, 0x66, 0x34, 0x3b, 0x0a, 0x76, 0x65, 0x63, 0x33, 0x20, 0x63, 0x75, // phaRef4;.vec3 cu
+	0x62, 0x65, 0x5f, 0x6d, 0x61, 0x70, 0x5f, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, // be_map_direction
+	0x28, 0x69, 0x76, 0x65, 0x63, 0x33, 0x20, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x2c, 0x20, 0x66, 0x6c, // (ivec3 texel, fl
+	0x6f, 0x61, 0x74, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x2c, 0x20, 0x6d, 0x61, 0x74, 0x34, 0x20, 0x69, // oat size, mat4 i
+	0x6e, 0x76, 0x65, 0x72, 0x73, 0x65, 0x5f, 0x76, 0x69, 0x65, 0x77, 0x5f, 0x70, 0x72, 0x6f, 0x6a, // nverse_view_proj
+	0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x29, 0x20, 0x7b, 0x0a, 0x76, 0x65, 0x63, 0x32, 0x20, 0x6e, // ection) {.vec2 n
+	0x64, 0x63, 0x20, 0x3d, 0x20, 0x28, 0x76, 0x65, 0x63, 0x32, 0x28, 0x74, 0x65, 0x78, 0x65, 0x6c, // dc = (vec2(texel
+	0x2e, 0x78, 0x79, 0x29, 0x20, 0x2b, 0x20, 0x30, 0x2e, 0x35, 0x29, 0x20, 0x2f, 0x20, 0x73, 0x69, // .xy) + 0.5) / si
+	0x7a, 0x65, 0x20, 0x2a, 0x20, 0x32, 0x2e, 0x30, 0x20, 0x2d, 0x20, 0x31, 0x2e, 0x30, 0x3b, 0x0a, // ze * 2.0 - 1.0;.
+	0x76, 0x65, 0x63, 0x34, 0x20, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x3d, 0x20, // vec4 position = 
+	0x28, 0x20, 0x28, 0x69, 0x6e, 0x76, 0x65, 0x72, 0x73, 0x65, 0x5f, 0x76, 0x69, 0x65, 0x77, 0x5f, // ( (inverse_view_
+	0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x29, 0x20, 0x2a, 0x20, 0x28, 0x76, // projection) * (v
+	0x65, 0x63, 0x34, 0x28, 0x6e, 0x64, 0x63, 0x2c, 0x20, 0x31, 0x2e, 0x30, 0x2c, 0x20, 0x31, 0x2e, // ec4(ndc, 1.0, 1.
+	0x30, 0x29, 0x29, 0x20, 0x29, 0x3b, 0x0a, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, 0x6e, 0x6f, // 0)) );.return no
+	0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x28, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, // rmalize(position
+	0x2e, 0x78, 0x79, 0x7a, 0x20, 0x2f, 0x20, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x2e, // .xyz / position.
+	0x77, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x73, 0x61, // w);.}.uniform sa
+	0x6d, 0x70, 0x6c, 0x65, 0x72, 0x43, 0x75, 0x62, 0x65, 0x20, 0x73, 0x5f, 0x74, 0x65, 0x78, 0x74, // mplerCube s_text
+	0x75, 0x72, 0x65, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x73, 0x61, 0x6d, // ure;.uniform sam
+	0x70, 0x6c, 0x65, 0x72, 0x32, 0x44, 0x20, 0x73, 0x5f, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x73, // pler2D s_samples
+	0x3b, 0x0a, 0x6c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x28, 0x72, 0x67, 0x62, 0x61, 0x31, 0x36, 0x66, // ;.layout(rgba16f
+	0x2c, 0x20, 0x62, 0x69, 0x6e, 0x64, 0x69, 0x6e, 0x67, 0x3d, 0x31, 0x29, 0x20, 0x77, 0x72, 0x69, // , binding=1) wri
+	0x74, 0x65, 0x6f, 0x6e, 0x6c, 0x79, 0x20, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x69, // teonly uniform i
+	0x6d, 0x61, 0x67, 0x65, 0x32, 0x44, 0x41, 0x72, 0x72, 0x61, 0x79, 0x20, 0x73, 0x5f, 0x6f, 0x75, // mage2DArray s_ou
+	0x74, 0x70, 0x75, 0x74, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x6d, 0x61, // tput;.uniform ma
+	0x74, 0x34, 0x20, 0x75, 0x5f, 0x69, 0x6e, 0x76, 0x65, 0x72, 0x73, 0x65, 0x5f, 0x76, 0x69, 0x65, // t4 u_inverse_vie
+	0x77, 0x5f, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x5b, 0x36, 0x5d, // w_projections[6]
+	0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x75, // ;.uniform vec4 u
+	0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, // _settings;.unifo
+	0x72, 0x6d, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x75, 0x5f, 0x74, 0x69, 0x6c, 0x65, 0x3b, 0x0a, // rm vec4 u_tile;.
+	0x76, 0x65, 0x63, 0x34, 0x20, 0x70, 0x72, 0x65, 0x66, 0x69, 0x6c, 0x74, 0x65, 0x72, 0x5f, 0x73, // vec4 prefilter_s
+	0x61, 0x6d, 0x70, 0x6c, 0x65, 0x28, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x29, 0x20, 0x7b, 0x0a, 0x66, // ample(int i) {.f
+	0x6c, 0x6f, 0x61, 0x74, 0x20, 0x75, 0x20, 0x3d, 0x20, 0x28, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x28, // loat u = (float(
+	0x69, 0x29, 0x20, 0x2b, 0x20, 0x30, 0x2e, 0x35, 0x29, 0x20, 0x2f, 0x20, 0x66, 0x6c, 0x6f, 0x61, // i) + 0.5) / floa
+	0x74, 0x28, 0x31, 0x30, 0x32, 0x34, 0x29, 0x3b, 0x0a, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x20, // t(1024);.return 
+	0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x32, 0x44, 0x4c, 0x6f, 0x64, 0x28, 0x73, 0x5f, 0x73, // texture2DLod(s_s
+	0x61, 0x6d, 0x70, 0x6c, 0x65, 0x73, 0x2c, 0x20, 0x76, 0x65, 0x63, 0x32, 0x28, 0x75, 0x2c, 0x20, // amples, vec2(u, 
+	0x75, 0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x78, 0x29, 0x2c, 0x20, 0x30, // u_settings.x), 0
+	0x2e, 0x30, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x6c, 0x61, 0x79, 0x6f, 0x75, 0x74, 0x20, 0x28, 0x6c, // .0);.}.layout (l
+	0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x78, 0x20, 0x3d, 0x20, 0x38, 0x2c, // ocal_size_x = 8,
+	0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x79, 0x20, 0x3d, 0x20, //  local_size_y = 
+	0x38, 0x2c, 0x20, 0x6c, 0x6f, 0x63, 0x61, 0x6c, 0x5f, 0x73, 0x69, 0x7a, 0x65, 0x5f, 0x7a, 0x20, // 8, local_size_z 
+	0x3d, 0x20, 0x31, 0x29, 0x20, 0x69, 0x6e, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x6d, 0x61, // = 1) in;.void ma
+	0x69, 0x6e, 0x28, 0x29, 0x20, 0x7b, 0x0a, 0x69, 0x76, 0x65, 0x63, 0x33, 0x20, 0x74, 0x65, 0x78, // in() {.ivec3 tex
+	0x65, 0x6c, 0x20, 0x3d, 0x20, 0x69, 0x76, 0x65, 0x63, 0x33, 0x28, 0x67, 0x6c, 0x5f, 0x47, 0x6c, // el = ivec3(gl_Gl
+	0x6f, 0x62, 0x61, 0x6c, 0x49, 0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x49, 0x44, // obalInvocationID
+	0x29, 0x20, 0x2b, 0x20, 0x69, 0x76, 0x65, 0x63, 0x33, 0x28, 0x75, 0x5f, 0x74, 0x69, 0x6c, 0x65, // ) + ivec3(u_tile
+	0x2e, 0x78, 0x79, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x29, 0x3b, 0x0a, 0x69, 0x66, 0x20, 0x28, 0x66, // .xy, 0.0);.if (f
+	0x6c, 0x6f, 0x61, 0x74, 0x28, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x2e, 0x78, 0x29, 0x20, 0x3e, 0x3d, // loat(texel.x) >=
+	0x20, 0x75, 0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x7a, 0x20, 0x7c, 0x7c, //  u_settings.z ||
+	0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x28, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x2e, 0x79, 0x29, 0x20, //  float(texel.y) 
+	0x3e, 0x3d, 0x20, 0x75, 0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x7a, 0x29, // >= u_settings.z)
+	0x20, 0x7b, 0x0a, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x3b, 0x0a, 0x7d, 0x0a, 0x76, 0x65, 0x63, //  {.return;.}.vec
+	0x33, 0x20, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x20, 0x3d, 0x20, 0x63, 0x75, 0x62, 0x65, 0x5f, // 3 normal = cube_
+	0x6d, 0x61, 0x70, 0x5f, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x28, 0x74, 0x65, // map_direction(te
+	0x78, 0x65, 0x6c, 0x2c, 0x20, 0x75, 0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, // xel, u_settings.
+	0x7a, 0x2c, 0x20, 0x75, 0x5f, 0x69, 0x6e, 0x76, 0x65, 0x72, 0x73, 0x65, 0x5f, 0x76, 0x69, 0x65, // z, u_inverse_vie
+	0x77, 0x5f, 0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x5b, 0x74, 0x65, // w_projections[te
+	0x78, 0x65, 0x6c, 0x2e, 0x7a, 0x5d, 0x29, 0x3b, 0x0a, 0x76, 0x65, 0x63, 0x33, 0x20, 0x75, 0x70, // xel.z]);.vec3 up
+	0x20, 0x3d, 0x20, 0x61, 0x62, 0x73, 0x28, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x2e, 0x7a, 0x29, //  = abs(normal.z)
+	0x20, 0x3c, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x20, 0x3f, 0x20, 0x76, 0x65, 0x63, 0x33, 0x28, //  < 0.999 ? vec3(
+	0x30, 0x2e, 0x30, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x2c, 0x20, 0x31, 0x2e, 0x30, 0x29, 0x20, 0x3a, // 0.0, 0.0, 1.0) :
+	0x20, 0x76, 0x65, 0x63, 0x33, 0x28, 0x31, 0x2e, 0x30, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x2c, 0x20, //  vec3(1.0, 0.0, 
+	0x30, 0x2e, 0x30, 0x29, 0x3b, 0x0a, 0x76, 0x65, 0x63, 0x33, 0x20, 0x74, 0x61, 0x6e, 0x67, 0x65, // 0.0);.vec3 tange
+	0x6e, 0x74, 0x20, 0x3d, 0x20, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x28, 0x63, // nt = normalize(c
+	0x72, 0x6f, 0x73, 0x73, 0x28, 0x75, 0x70, 0x2c, 0x20, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x29, // ross(up, normal)
+	0x29, 0x3b, 0x0a, 0x76, 0x65, 0x63, 0x33, 0x20, 0x62, 0x69, 0x74, 0x61, 0x6e, 0x67, 0x65, 0x6e, // );.vec3 bitangen
+	0x74, 0x20, 0x3d, 0x20, 0x63, 0x72, 0x6f, 0x73, 0x73, 0x28, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, // t = cross(normal
+	0x2c, 0x20, 0x74, 0x61, 0x6e, 0x67, 0x65, 0x6e, 0x74, 0x29, 0x3b, 0x0a, 0x69, 0x6e, 0x74, 0x20, // , tangent);.int 
+	0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x5f, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x20, 0x3d, 0x20, 0x69, // sample_count = i
+	0x6e, 0x74, 0x28, 0x75, 0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x79, 0x29, // nt(u_settings.y)
+	0x3b, 0x0a, 0x76, 0x65, 0x63, 0x33, 0x20, 0x70, 0x72, 0x65, 0x66, 0x69, 0x6c, 0x74, 0x65, 0x72, // ;.vec3 prefilter
+	0x65, 0x64, 0x5f, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x20, 0x3d, 0x20, 0x76, 0x65, 0x63, 0x33, 0x28, // ed_color = vec3(
+	0x30, 0x2e, 0x30, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x29, 0x3b, 0x0a, // 0.0, 0.0, 0.0);.
+	0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x74, 0x6f, 0x74, 0x61, 0x6c, 0x5f, 0x77, 0x65, 0x69, 0x67, // float total_weig
+	0x68, 0x74, 0x20, 0x3d, 0x20, 0x30, 0x2e, 0x30, 0x3b, 0x0a, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x69, // ht = 0.0;.for (i
+	0x6e, 0x74, 0x20, 0x69, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x20, 0x69, 0x20, 0x3c, 0x20, 0x31, 0x30, // nt i = 0; i < 10
+	0x32, 0x34, 0x3b, 0x20, 0x69, 0x2b, 0x2b, 0x29, 0x20, 0x7b, 0x0a, 0x69, 0x66, 0x20, 0x28, 0x69, // 24; i++) {.if (i
+	0x20, 0x3e, 0x3d, 0x20, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x5f, 0x63, 0x6f, 0x75, 0x6e, 0x74, //  >= sample_count
+	0x29, 0x20, 0x7b, 0x0a, 0x62, 0x72, 0x65, 0x61, 0x6b, 0x3b, 0x0a, 0x7d, 0x0a, 0x76, 0x65, 0x63, // ) {.break;.}.vec
+	0x34, 0x20, 0x6c, 0x69, 0x67, 0x68, 0x74, 0x5f, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x20, 0x3d, // 4 light_sample =
+	0x20, 0x70, 0x72, 0x65, 0x66, 0x69, 0x6c, 0x74, 0x65, 0x72, 0x5f, 0x73, 0x61, 0x6d, 0x70, 0x6c, //  prefilter_sampl
+	0x65, 0x28, 0x69, 0x29, 0x3b, 0x0a, 0x76, 0x65, 0x63, 0x33, 0x20, 0x6c, 0x69, 0x67, 0x68, 0x74, // e(i);.vec3 light
+	0x5f, 0x64, 0x69, 0x72, 0x20, 0x3d, 0x20, 0x74, 0x61, 0x6e, 0x67, 0x65, 0x6e, 0x74, 0x20, 0x2a, // _dir = tangent *
+	0x20, 0x6c, 0x69, 0x67, 0x68, 0x74, 0x5f, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x2e, 0x78, 0x20, //  light_sample.x 
+	0x2b, 0x20, 0x62, 0x69, 0x74, 0x61, 0x6e, 0x67, 0x65, 0x6e, 0x74, 0x20, 0x2a, 0x20, 0x6c, 0x69, // + bitangent * li
+	0x67, 0x68, 0x74, 0x5f, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x2e, 0x79, 0x20, 0x2b, 0x20, 0x6e, // ght_sample.y + n
+	0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x20, 0x2a, 0x20, 0x6c, 0x69, 0x67, 0x68, 0x74, 0x5f, 0x73, 0x61, // ormal * light_sa
+	0x6d, 0x70, 0x6c, 0x65, 0x2e, 0x7a, 0x3b, 0x0a, 0x70, 0x72, 0x65, 0x66, 0x69, 0x6c, 0x74, 0x65, // mple.z;.prefilte
+	0x72, 0x65, 0x64, 0x5f, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x20, 0x2b, 0x3d, 0x20, 0x74, 0x65, 0x78, // red_color += tex
+	0x74, 0x75, 0x72, 0x65, 0x43, 0x75, 0x62, 0x65, 0x4c, 0x6f, 0x64, 0x28, 0x73, 0x5f, 0x74, 0x65, // tureCubeLod(s_te
+	0x78, 0x74, 0x75, 0x72, 0x65, 0x2c, 0x20, 0x6c, 0x69, 0x67, 0x68, 0x74, 0x5f, 0x64, 0x69, 0x72, // xture, light_dir
+	0x2c, 0x20, 0x6c, 0x69, 0x67, 0x68, 0x74, 0x5f, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x2e, 0x77, // , light_sample.w
+	0x29, 0x2e, 0x78, 0x79, 0x7a, 0x20, 0x2a, 0x20, 0x6c, 0x69, 0x67, 0x68, 0x74, 0x5f, 0x73, 0x61, // ).xyz * light_sa
+	0x6d, 0x70, 0x6c, 0x65, 0x2e, 0x7a, 0x3b, 0x0a, 0x74, 0x6f, 0x74, 0x61, 0x6c, 0x5f, 0x77, 0x65, // mple.z;.total_we
+	0x69, 0x67, 0x68, 0x74, 0x20, 0x2b, 0x3d, 0x20, 0x6c, 0x69, 0x67, 0x68, 0x74, 0x5f, 0x73, 0x61, // ight += light_sa
+	0x6d, 0x70, 0x6c, 0x65, 0x2e, 0x7a, 0x3b, 0x0a, 0x7d, 0x0a, 0x69, 0x6d, 0x61, 0x67, 0x65, 0x53, // mple.z;.}.imageS
+	0x74, 0x6f, 0x72, 0x65, 0x28, 0x73, 0x5f, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x2c, 0x20, 0x74, // tore(s_output, t
+	0x65, 0x78, 0x65, 0x6c, 0x2c, 0x20, 0x76, 0x65, 0x63, 0x34, 0x28, 0x70, 0x72, 0x65, 0x66, 0x69, // exel, vec4(prefi
+	0x6c, 0x74, 0x65, 0x72, 0x65, 0x64, 0x5f, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x20, 0x2f, 0x20, 0x74, // ltered_color / t
+	0x6f, 0x74, 0x61, 0x6c, 0x5f, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x2c, 0x20, 0x31, 0x2e, 0x30, // otal_weight, 1.0
+	0x29, 0x29, 0x3b, 0x0a, 0x7d, 0x0a, 0x00,                                                       // ));.}..
+};
+
+static const uint8_t prefilter_shader_compute_spv[4101] =
+{
+	0x43, 0x53, 0x48, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x06, 0x75, // CSH............u
+	0x5f, 0x74, 0x69, 0x6c, 0x65, 0x02, 0x01, 0x90, 0x01, 0x01, 0x00, 0x0a, 0x75, 0x5f, 0x73, 0x65, // _tile.......u_se
+	0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x02, 0x01, 0x80, 0x01, 0x01, 0x00, 0x1a, 0x75, 0x5f, 0x69, // ttings.......u_i
+	0x6e, 0x76, 0x65, 0x72, 0x73, 0x65, 0x5f, 0x76, 0x69, 0x65, 0x77, 0x5f, 0x70, 0x72, 0x6f, 0x6a, // nverse_view_proj
+	0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x04, 0x06, 0x00, 0x00, 0x18, 0x00, 0x09, 0x73, 0x5f, // ections.......s_
+	0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x73, 0x5f, // texture.......s_
+	0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x0f, 0x00, // samples.........
+	0x00, 0x03, 0x02, 0x23, 0x07, 0x00, 0x00, 0x01, 0x00, 0x07, 0x00, 0x08, 0x00, 0x3c, 0x02, 0x00, // ...#.........<..
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x06, // ................
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x47, 0x4c, 0x53, 0x4c, 0x2e, 0x73, 0x74, 0x64, 0x2e, 0x34, 0x35, // .....GLSL.std.45
+	0x30, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, // 0...............
+	0x00, 0x0f, 0x00, 0x06, 0x00, 0x05, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, // .............mai
+	0x6e, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x01, 0x00, 0x00, 0x10, 0x00, 0x06, 0x00, 0x04, 0x00, 0x00, // n....?..........
+	0x00, 0x11, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, // ................
+	0x00, 0x03, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x00, 0xf4, 0x01, 0x00, 0x00, 0x05, 0x00, 0x04, // ................
+	0x00, 0x04, 0x00, 0x00, 0x00, 0x6d, 0x61, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x07, // .....main.......
+	0x00, 0x41, 0x00, 0x00, 0x00, 0x73, 0x5f, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x53, 0x61, // .A...s_textureSa
+	0x6d, 0x70, 0x6c, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x07, 0x00, 0x44, 0x00, 0x00, // mpler........D..
+	0x00, 0x73, 0x5f, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x54, 0x65, 0x78, 0x74, 0x75, 0x72, // .s_textureTextur
+	0x65, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x07, 0x00, 0x49, 0x00, 0x00, 0x00, 0x73, 0x5f, 0x73, // e........I...s_s
+	0x61, 0x6d, 0x70, 0x6c, 0x65, 0x73, 0x53, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x72, 0x00, 0x00, 0x00, // amplesSampler...
+	0x00, 0x05, 0x00, 0x07, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x73, 0x5f, 0x73, 0x61, 0x6d, 0x70, 0x6c, // .....L...s_sampl
+	0x65, 0x73, 0x54, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x06, // esTexture.......
+	0x00, 0x52, 0x00, 0x00, 0x00, 0x73, 0x5f, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x54, 0x65, 0x78, // .R...s_outputTex
+	0x74, 0x75, 0x72, 0x65, 0x00, 0x05, 0x00, 0x04, 0x00, 0xa2, 0x00, 0x00, 0x00, 0x24, 0x47, 0x6c, // ture.........$Gl
+	0x6f, 0x62, 0x61, 0x6c, 0x00, 0x06, 0x00, 0x0a, 0x00, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // obal............
+	0x00, 0x75, 0x5f, 0x69, 0x6e, 0x76, 0x65, 0x72, 0x73, 0x65, 0x5f, 0x76, 0x69, 0x65, 0x77, 0x5f, // .u_inverse_view_
+	0x70, 0x72, 0x6f, 0x6a, 0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x00, 0x00, 0x06, 0x00, 0x06, // projections.....
+	0x00, 0xa2, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x75, 0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, // .........u_setti
+	0x6e, 0x67, 0x73, 0x00, 0x00, 0x06, 0x00, 0x05, 0x00, 0xa2, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, // ngs.............
+	0x00, 0x75, 0x5f, 0x74, 0x69, 0x6c, 0x65, 0x00, 0x00, 0x05, 0x00, 0x03, 0x00, 0xa4, 0x00, 0x00, // .u_tile.........
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x08, 0x00, 0x3f, 0x01, 0x00, 0x00, 0x67, 0x6c, 0x5f, // .........?...gl_
+	0x47, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x49, 0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, 0x69, 0x6f, 0x6e, // GlobalInvocation
+	0x49, 0x44, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x41, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, // ID...G...A..."..
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x41, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, // .....G...A...!..
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x44, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, // .....G...D..."..
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x44, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, // .....G...D...!..
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x49, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, // .....G...I..."..
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x49, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, // .....G...I...!..
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, // .....G...L..."..
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x4c, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, // .....G...L...!..
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x52, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, // .....G...R..."..
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x52, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, // .....G...R...!..
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0xa1, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, // .....G..........
+	0x00, 0x40, 0x00, 0x00, 0x00, 0x48, 0x00, 0x04, 0x00, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // .@...H..........
+	0x00, 0x04, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // .....H..........
+	0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0xa2, 0x00, 0x00, // .#.......H......
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, // .............H..
+	0x00, 0xa2, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x80, 0x01, 0x00, // .........#......
+	0x00, 0x48, 0x00, 0x05, 0x00, 0xa2, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, // .H...........#..
+	0x00, 0x90, 0x01, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00, 0xa2, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, // .....G..........
+	0x00, 0x47, 0x00, 0x04, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // .G......."......
+	0x00, 0x47, 0x00, 0x04, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // .G.......!......
+	0x00, 0x47, 0x00, 0x04, 0x00, 0x3f, 0x01, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, // .G...?..........
+	0x00, 0x13, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x21, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, // .........!......
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x02, 0x00, 0x06, 0x00, 0x00, 0x00, 0x16, 0x00, 0x03, // ................
+	0x00, 0x07, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x19, 0x00, 0x09, 0x00, 0x08, 0x00, 0x00, // ..... ..........
+	0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // ................
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, // ................
+	0x00, 0x0b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, // ................
+	0x00, 0x0e, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x19, 0x00, 0x09, // ................
+	0x00, 0x15, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // ................
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // ................
+	0x00, 0x17, 0x00, 0x04, 0x00, 0x18, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, // ................
+	0x00, 0x19, 0x00, 0x09, 0x00, 0x20, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, // ..... ..........
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, // ................
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x15, 0x00, 0x04, 0x00, 0x23, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, // .........#... ..
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00, 0x24, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, // .........$...#..
+	0x00, 0x03, 0x00, 0x00, 0x00, 0x18, 0x00, 0x04, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, // .........-......
+	0x00, 0x04, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // ..... ...@......
+	0x00, 0x06, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x00, // .....;...@...A..
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // ..... ...C......
+	0x00, 0x15, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x43, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, // .....;...C...D..
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x40, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, // .....;...@...I..
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // ..... ...K......
+	0x00, 0x08, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x4b, 0x00, 0x00, 0x00, 0x4c, 0x00, 0x00, // .....;...K...L..
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // ..... ...Q......
+	0x00, 0x20, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x51, 0x00, 0x00, 0x00, 0x52, 0x00, 0x00, // . ...;...Q...R..
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x23, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, // .....+...#...U..
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x23, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, // .....+...#...Y..
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x03, 0x00, 0x5d, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, // .........]......
+	0x00, 0x1b, 0x00, 0x03, 0x00, 0x69, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, // .....i..........
+	0x00, 0x78, 0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, // .x...#.......+..
+	0x00, 0x07, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x2b, 0x00, 0x04, // .....|......?+..
+	0x00, 0x07, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x2b, 0x00, 0x04, // ............@+..
+	0x00, 0x07, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3f, 0x15, 0x00, 0x04, // ............?...
+	0x00, 0x90, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, // ..... .......+..
+	0x00, 0x90, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x04, // ................
+	0x00, 0xa1, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x05, // .....-..........
+	0x00, 0xa2, 0x00, 0x00, 0x00, 0xa1, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, // ................
+	0x00, 0x20, 0x00, 0x04, 0x00, 0xa3, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xa2, 0x00, 0x00, // . ..............
+	0x00, 0x3b, 0x00, 0x04, 0x00, 0xa3, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, // .;..............
+	0x00, 0x2b, 0x00, 0x04, 0x00, 0x90, 0x00, 0x00, 0x00, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // .+..............
+	0x00, 0x20, 0x00, 0x04, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, // . ..............
+	0x00, 0x2b, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // .+..............
+	0x00, 0x2b, 0x00, 0x04, 0x00, 0x23, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, // .+...#..........
+	0x00, 0x20, 0x00, 0x04, 0x00, 0xb5, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, // . ..............
+	0x00, 0x2b, 0x00, 0x04, 0x00, 0x90, 0x00, 0x00, 0x00, 0xc1, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, // .+..............
+	0x00, 0x14, 0x00, 0x02, 0x00, 0xc4, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x90, 0x00, 0x00, // .........+......
+	0x00, 0xc6, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0xda, 0x00, 0x00, // ......... ......
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, // .....-...+......
+	0x00, 0xe2, 0x00, 0x00, 0x00, 0x77, 0xbe, 0x7f, 0x3f, 0x2c, 0x00, 0x06, 0x00, 0x18, 0x00, 0x00, // .....w..?,......
+	0x00, 0xe4, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, // ................
+	0x00, 0x2c, 0x00, 0x06, 0x00, 0x18, 0x00, 0x00, 0x00, 0xe5, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, // .,..............
+	0x00, 0xaa, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00, 0xe6, 0x00, 0x00, // ................
+	0x00, 0xc4, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x06, 0x00, 0x18, 0x00, 0x00, // .........,......
+	0x00, 0xf7, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, // ................
+	0x00, 0x2b, 0x00, 0x04, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, // .+...#..........
+	0x00, 0x20, 0x00, 0x04, 0x00, 0x3e, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, // . ...>.......$..
+	0x00, 0x3b, 0x00, 0x04, 0x00, 0x3e, 0x01, 0x00, 0x00, 0x3f, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, // .;...>...?......
+	0x00, 0x2c, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x36, 0x02, 0x00, 0x00, 0x7c, 0x00, 0x00, // .,.......6...|..
+	0x00, 0x7c, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x37, 0x02, 0x00, // .|...,.......7..
+	0x00, 0x84, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, // .........+......
+	0x00, 0x38, 0x02, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3a, 0x36, 0x00, 0x05, 0x00, 0x02, 0x00, 0x00, // .8......:6......
+	0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x02, // ................
+	0x00, 0x05, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, // .....=.......B..
+	0x00, 0x41, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x15, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, // .A...=.......E..
+	0x00, 0x44, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, // .D...=.......J..
+	0x00, 0x49, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00, 0x4d, 0x00, 0x00, // .I...=.......M..
+	0x00, 0x4c, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x20, 0x00, 0x00, 0x00, 0x53, 0x00, 0x00, // .L...=... ...S..
+	0x00, 0x52, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x24, 0x00, 0x00, 0x00, 0x40, 0x01, 0x00, // .R...=...$...@..
+	0x00, 0x3f, 0x01, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x73, 0x01, 0x00, 0x00, 0xf8, 0x00, 0x02, // .?.......s......
+	0x00, 0x73, 0x01, 0x00, 0x00, 0xf6, 0x00, 0x04, 0x00, 0x74, 0x01, 0x00, 0x00, 0x75, 0x01, 0x00, // .s.......t...u..
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x76, 0x01, 0x00, 0x00, 0xf8, 0x00, 0x02, // .........v......
+	0x00, 0x76, 0x01, 0x00, 0x00, 0x41, 0x00, 0x05, 0x00, 0xb5, 0x00, 0x00, 0x00, 0x78, 0x01, 0x00, // .v...A.......x..
+	0x00, 0xa4, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, // .........=......
+	0x00, 0x79, 0x01, 0x00, 0x00, 0x78, 0x01, 0x00, 0x00, 0x4f, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x00, // .y...x...O......
+	0x00, 0x7a, 0x01, 0x00, 0x00, 0x79, 0x01, 0x00, 0x00, 0x79, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, // .z...y...y......
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x6e, 0x00, 0x04, 0x00, 0x78, 0x00, 0x00, 0x00, 0x7b, 0x01, 0x00, // .....n...x...{..
+	0x00, 0x7a, 0x01, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x23, 0x00, 0x00, 0x00, 0x7c, 0x01, 0x00, // .z...Q...#...|..
+	0x00, 0x7b, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x23, 0x00, 0x00, // .{.......Q...#..
+	0x00, 0x7d, 0x01, 0x00, 0x00, 0x7b, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x50, 0x00, 0x06, // .}...{.......P..
+	0x00, 0x24, 0x00, 0x00, 0x00, 0x7e, 0x01, 0x00, 0x00, 0x7c, 0x01, 0x00, 0x00, 0x7d, 0x01, 0x00, // .$...~...|...}..
+	0x00, 0x59, 0x00, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x24, 0x00, 0x00, 0x00, 0x7f, 0x01, 0x00, // .Y.......$......
+	0x00, 0x40, 0x01, 0x00, 0x00, 0x7e, 0x01, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x23, 0x00, 0x00, // .@...~...Q...#..
+	0x00, 0x81, 0x01, 0x00, 0x00, 0x7f, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x04, // .............o..
+	0x00, 0x07, 0x00, 0x00, 0x00, 0x82, 0x01, 0x00, 0x00, 0x81, 0x01, 0x00, 0x00, 0x41, 0x00, 0x06, // .............A..
+	0x00, 0xa6, 0x00, 0x00, 0x00, 0x83, 0x01, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, // .............U..
+	0x00, 0xc1, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0x84, 0x01, 0x00, // .....=..........
+	0x00, 0x83, 0x01, 0x00, 0x00, 0xbe, 0x00, 0x05, 0x00, 0xc4, 0x00, 0x00, 0x00, 0x85, 0x01, 0x00, // ................
+	0x00, 0x82, 0x01, 0x00, 0x00, 0x84, 0x01, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x23, 0x00, 0x00, // .........Q...#..
+	0x00, 0x87, 0x01, 0x00, 0x00, 0x7f, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x04, // .............o..
+	0x00, 0x07, 0x00, 0x00, 0x00, 0x88, 0x01, 0x00, 0x00, 0x87, 0x01, 0x00, 0x00, 0x41, 0x00, 0x06, // .............A..
+	0x00, 0xa6, 0x00, 0x00, 0x00, 0x89, 0x01, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, // .............U..
+	0x00, 0xc1, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0x8a, 0x01, 0x00, // .....=..........
+	0x00, 0x89, 0x01, 0x00, 0x00, 0xbe, 0x00, 0x05, 0x00, 0xc4, 0x00, 0x00, 0x00, 0x8b, 0x01, 0x00, // ................
+	0x00, 0x88, 0x01, 0x00, 0x00, 0x8a, 0x01, 0x00, 0x00, 0xa6, 0x00, 0x05, 0x00, 0xc4, 0x00, 0x00, // ................
+	0x00, 0x8c, 0x01, 0x00, 0x00, 0x85, 0x01, 0x00, 0x00, 0x8b, 0x01, 0x00, 0x00, 0xf7, 0x00, 0x03, // ................
+	0x00, 0x8d, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x8c, 0x01, 0x00, // ................
+	0x00, 0x8e, 0x01, 0x00, 0x00, 0x8d, 0x01, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x8e, 0x01, 0x00, // ................
+	0x00, 0xf9, 0x00, 0x02, 0x00, 0x74, 0x01, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x8d, 0x01, 0x00, // .....t..........
+	0x00, 0x51, 0x00, 0x05, 0x00, 0x23, 0x00, 0x00, 0x00, 0x90, 0x01, 0x00, 0x00, 0x7f, 0x01, 0x00, // .Q...#..........
+	0x00, 0x02, 0x00, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00, 0xa6, 0x00, 0x00, 0x00, 0x92, 0x01, 0x00, // .....A..........
+	0x00, 0xa4, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0xc1, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, // .....U.......=..
+	0x00, 0x07, 0x00, 0x00, 0x00, 0x93, 0x01, 0x00, 0x00, 0x92, 0x01, 0x00, 0x00, 0x41, 0x00, 0x06, // .............A..
+	0x00, 0xda, 0x00, 0x00, 0x00, 0x94, 0x01, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x59, 0x00, 0x00, // .............Y..
+	0x00, 0x90, 0x01, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x2d, 0x00, 0x00, 0x00, 0x95, 0x01, 0x00, // .....=...-......
+	0x00, 0x94, 0x01, 0x00, 0x00, 0x4f, 0x00, 0x07, 0x00, 0x78, 0x00, 0x00, 0x00, 0xe3, 0x01, 0x00, // .....O...x......
+	0x00, 0x7f, 0x01, 0x00, 0x00, 0x7f, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, // ................
+	0x00, 0x6f, 0x00, 0x04, 0x00, 0x0b, 0x00, 0x00, 0x00, 0xe4, 0x01, 0x00, 0x00, 0xe3, 0x01, 0x00, // .o..............
+	0x00, 0x81, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x00, 0xe6, 0x01, 0x00, 0x00, 0xe4, 0x01, 0x00, // ................
+	0x00, 0x36, 0x02, 0x00, 0x00, 0x50, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x00, 0xe8, 0x01, 0x00, // .6...P..........
+	0x00, 0x93, 0x01, 0x00, 0x00, 0x93, 0x01, 0x00, 0x00, 0x88, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x00, // ................
+	0x00, 0xe9, 0x01, 0x00, 0x00, 0xe6, 0x01, 0x00, 0x00, 0xe8, 0x01, 0x00, 0x00, 0x8e, 0x00, 0x05, // ................
+	0x00, 0x0b, 0x00, 0x00, 0x00, 0xea, 0x01, 0x00, 0x00, 0xe9, 0x01, 0x00, 0x00, 0x82, 0x00, 0x00, // ................
+	0x00, 0x83, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x00, 0xec, 0x01, 0x00, 0x00, 0xea, 0x01, 0x00, // ................
+	0x00, 0x37, 0x02, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0xee, 0x01, 0x00, // .7...Q..........
+	0x00, 0xec, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, // .........Q......
+	0x00, 0xef, 0x01, 0x00, 0x00, 0xec, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x50, 0x00, 0x07, // .............P..
+	0x00, 0x0e, 0x00, 0x00, 0x00, 0xf0, 0x01, 0x00, 0x00, 0xee, 0x01, 0x00, 0x00, 0xef, 0x01, 0x00, // ................
+	0x00, 0x84, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x90, 0x00, 0x05, 0x00, 0x0e, 0x00, 0x00, // ................
+	0x00, 0xf2, 0x01, 0x00, 0x00, 0xf0, 0x01, 0x00, 0x00, 0x95, 0x01, 0x00, 0x00, 0x4f, 0x00, 0x08, // .............O..
+	0x00, 0x18, 0x00, 0x00, 0x00, 0xf4, 0x01, 0x00, 0x00, 0xf2, 0x01, 0x00, 0x00, 0xf2, 0x01, 0x00, // ................
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, // .............Q..
+	0x00, 0x07, 0x00, 0x00, 0x00, 0xf6, 0x01, 0x00, 0x00, 0xf2, 0x01, 0x00, 0x00, 0x03, 0x00, 0x00, // ................
+	0x00, 0x50, 0x00, 0x06, 0x00, 0x18, 0x00, 0x00, 0x00, 0xf7, 0x01, 0x00, 0x00, 0xf6, 0x01, 0x00, // .P..............
+	0x00, 0xf6, 0x01, 0x00, 0x00, 0xf6, 0x01, 0x00, 0x00, 0x88, 0x00, 0x05, 0x00, 0x18, 0x00, 0x00, // ................
+	0x00, 0xf8, 0x01, 0x00, 0x00, 0xf4, 0x01, 0x00, 0x00, 0xf7, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x06, // ................
+	0x00, 0x18, 0x00, 0x00, 0x00, 0xf9, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, // .............E..
+	0x00, 0xf8, 0x01, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0x98, 0x01, 0x00, // .....Q..........
+	0x00, 0xf9, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x07, 0x00, 0x00, // ................
+	0x00, 0x99, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x98, 0x01, 0x00, // ................
+	0x00, 0xb8, 0x00, 0x05, 0x00, 0xc4, 0x00, 0x00, 0x00, 0x9a, 0x01, 0x00, 0x00, 0x99, 0x01, 0x00, // ................
+	0x00, 0xe2, 0x00, 0x00, 0x00, 0x50, 0x00, 0x06, 0x00, 0xe6, 0x00, 0x00, 0x00, 0x9b, 0x01, 0x00, // .....P..........
+	0x00, 0x9a, 0x01, 0x00, 0x00, 0x9a, 0x01, 0x00, 0x00, 0x9a, 0x01, 0x00, 0x00, 0xa9, 0x00, 0x06, // ................
+	0x00, 0x18, 0x00, 0x00, 0x00, 0x9c, 0x01, 0x00, 0x00, 0x9b, 0x01, 0x00, 0x00, 0xe4, 0x00, 0x00, // ................
+	0x00, 0xe5, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x07, 0x00, 0x18, 0x00, 0x00, 0x00, 0x9f, 0x01, 0x00, // ................
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x9c, 0x01, 0x00, 0x00, 0xf9, 0x01, 0x00, // .....D..........
+	0x00, 0x0c, 0x00, 0x06, 0x00, 0x18, 0x00, 0x00, 0x00, 0xa0, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, // ................
+	0x00, 0x45, 0x00, 0x00, 0x00, 0x9f, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x07, 0x00, 0x18, 0x00, 0x00, // .E..............
+	0x00, 0xa3, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0xf9, 0x01, 0x00, // .........D......
+	0x00, 0xa0, 0x01, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00, 0xa6, 0x00, 0x00, 0x00, 0xa4, 0x01, 0x00, // .....A..........
+	0x00, 0xa4, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0xc6, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, // .....U.......=..
+	0x00, 0x07, 0x00, 0x00, 0x00, 0xa5, 0x01, 0x00, 0x00, 0xa4, 0x01, 0x00, 0x00, 0x6e, 0x00, 0x04, // .............n..
+	0x00, 0x23, 0x00, 0x00, 0x00, 0xa6, 0x01, 0x00, 0x00, 0xa5, 0x01, 0x00, 0x00, 0xf9, 0x00, 0x02, // .#..............
+	0x00, 0xa7, 0x01, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xa7, 0x01, 0x00, 0x00, 0xf5, 0x00, 0x07, // ................
+	0x00, 0x07, 0x00, 0x00, 0x00, 0x3b, 0x02, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x8d, 0x01, 0x00, // .....;..........
+	0x00, 0xd1, 0x01, 0x00, 0x00, 0xb1, 0x01, 0x00, 0x00, 0xf5, 0x00, 0x07, 0x00, 0x18, 0x00, 0x00, // ................
+	0x00, 0x3a, 0x02, 0x00, 0x00, 0xf7, 0x00, 0x00, 0x00, 0x8d, 0x01, 0x00, 0x00, 0xcd, 0x01, 0x00, // .:..............
+	0x00, 0xb1, 0x01, 0x00, 0x00, 0xf5, 0x00, 0x07, 0x00, 0x23, 0x00, 0x00, 0x00, 0x39, 0x02, 0x00, // .........#...9..
+	0x00, 0x59, 0x00, 0x00, 0x00, 0x8d, 0x01, 0x00, 0x00, 0xd3, 0x01, 0x00, 0x00, 0xb1, 0x01, 0x00, // .Y..............
+	0x00, 0xb1, 0x00, 0x05, 0x00, 0xc4, 0x00, 0x00, 0x00, 0xac, 0x01, 0x00, 0x00, 0x39, 0x02, 0x00, // .............9..
+	0x00, 0x00, 0x01, 0x00, 0x00, 0xf6, 0x00, 0x04, 0x00, 0xa8, 0x01, 0x00, 0x00, 0xb1, 0x01, 0x00, // ................
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0xac, 0x01, 0x00, 0x00, 0xad, 0x01, 0x00, // ................
+	0x00, 0xa8, 0x01, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0xad, 0x01, 0x00, 0x00, 0xaf, 0x00, 0x05, // ................
+	0x00, 0xc4, 0x00, 0x00, 0x00, 0xb0, 0x01, 0x00, 0x00, 0x39, 0x02, 0x00, 0x00, 0xa6, 0x01, 0x00, // .........9......
+	0x00, 0xf7, 0x00, 0x03, 0x00, 0xb1, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, // ................
+	0x00, 0xb0, 0x01, 0x00, 0x00, 0xb2, 0x01, 0x00, 0x00, 0xb1, 0x01, 0x00, 0x00, 0xf8, 0x00, 0x02, // ................
+	0x00, 0xb2, 0x01, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0xa8, 0x01, 0x00, 0x00, 0xf8, 0x00, 0x02, // ................
+	0x00, 0xb1, 0x01, 0x00, 0x00, 0x6f, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, // .....o..........
+	0x00, 0x39, 0x02, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0x02, 0x00, // .9..............
+	0x00, 0x00, 0x02, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, // .....|..........
+	0x00, 0x02, 0x02, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00, 0x38, 0x02, 0x00, 0x00, 0x41, 0x00, 0x06, // .........8...A..
+	0x00, 0xa6, 0x00, 0x00, 0x00, 0x04, 0x02, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, // .............U..
+	0x00, 0xa5, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0x05, 0x02, 0x00, // .....=..........
+	0x00, 0x04, 0x02, 0x00, 0x00, 0x50, 0x00, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x06, 0x02, 0x00, // .....P..........
+	0x00, 0x02, 0x02, 0x00, 0x00, 0x05, 0x02, 0x00, 0x00, 0x56, 0x00, 0x05, 0x00, 0x5d, 0x00, 0x00, // .........V...]..
+	0x00, 0x0e, 0x02, 0x00, 0x00, 0x4d, 0x00, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x00, 0x58, 0x00, 0x07, // .....M...J...X..
+	0x00, 0x0e, 0x00, 0x00, 0x00, 0x11, 0x02, 0x00, 0x00, 0x0e, 0x02, 0x00, 0x00, 0x06, 0x02, 0x00, // ................
+	0x00, 0x02, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, // .........Q......
+	0x00, 0xb7, 0x01, 0x00, 0x00, 0x11, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x05, // ................
+	0x00, 0x18, 0x00, 0x00, 0x00, 0xb8, 0x01, 0x00, 0x00, 0xa0, 0x01, 0x00, 0x00, 0xb7, 0x01, 0x00, // ................
+	0x00, 0x51, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0xbb, 0x01, 0x00, 0x00, 0x11, 0x02, 0x00, // .Q..............
+	0x00, 0x01, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x05, 0x00, 0x18, 0x00, 0x00, 0x00, 0xbc, 0x01, 0x00, // ................
+	0x00, 0xa3, 0x01, 0x00, 0x00, 0xbb, 0x01, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00, 0x18, 0x00, 0x00, // ................
+	0x00, 0xbd, 0x01, 0x00, 0x00, 0xb8, 0x01, 0x00, 0x00, 0xbc, 0x01, 0x00, 0x00, 0x51, 0x00, 0x05, // .............Q..
+	0x00, 0x07, 0x00, 0x00, 0x00, 0xc0, 0x01, 0x00, 0x00, 0x11, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, // ................
+	0x00, 0x8e, 0x00, 0x05, 0x00, 0x18, 0x00, 0x00, 0x00, 0xc1, 0x01, 0x00, 0x00, 0xf9, 0x01, 0x00, // ................
+	0x00, 0xc0, 0x01, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00, 0x18, 0x00, 0x00, 0x00, 0xc2, 0x01, 0x00, // ................
+	0x00, 0xbd, 0x01, 0x00, 0x00, 0xc1, 0x01, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, // .........Q......
+	0x00, 0xc6, 0x01, 0x00, 0x00, 0x11, 0x02, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x56, 0x00, 0x05, // .............V..
+	0x00, 0x69, 0x00, 0x00, 0x00, 0x17, 0x02, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x42, 0x00, 0x00, // .i.......E...B..
+	0x00, 0x58, 0x00, 0x07, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x1a, 0x02, 0x00, 0x00, 0x17, 0x02, 0x00, // .X..............
+	0x00, 0xc2, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xc6, 0x01, 0x00, 0x00, 0x4f, 0x00, 0x08, // .............O..
+	0x00, 0x18, 0x00, 0x00, 0x00, 0xc8, 0x01, 0x00, 0x00, 0x1a, 0x02, 0x00, 0x00, 0x1a, 0x02, 0x00, // ................
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, // .............Q..
+	0x00, 0x07, 0x00, 0x00, 0x00, 0xca, 0x01, 0x00, 0x00, 0x11, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, // ................
+	0x00, 0x8e, 0x00, 0x05, 0x00, 0x18, 0x00, 0x00, 0x00, 0xcb, 0x01, 0x00, 0x00, 0xc8, 0x01, 0x00, // ................
+	0x00, 0xca, 0x01, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00, 0x18, 0x00, 0x00, 0x00, 0xcd, 0x01, 0x00, // ................
+	0x00, 0x3a, 0x02, 0x00, 0x00, 0xcb, 0x01, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, // .:.......Q......
+	0x00, 0xcf, 0x01, 0x00, 0x00, 0x11, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x81, 0x00, 0x05, // ................
+	0x00, 0x07, 0x00, 0x00, 0x00, 0xd1, 0x01, 0x00, 0x00, 0x3b, 0x02, 0x00, 0x00, 0xcf, 0x01, 0x00, // .........;......
+	0x00, 0x80, 0x00, 0x05, 0x00, 0x23, 0x00, 0x00, 0x00, 0xd3, 0x01, 0x00, 0x00, 0x39, 0x02, 0x00, // .....#.......9..
+	0x00, 0x55, 0x00, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0xa7, 0x01, 0x00, 0x00, 0xf8, 0x00, 0x02, // .U..............
+	0x00, 0xa8, 0x01, 0x00, 0x00, 0x50, 0x00, 0x06, 0x00, 0x18, 0x00, 0x00, 0x00, 0xd6, 0x01, 0x00, // .....P..........
+	0x00, 0x3b, 0x02, 0x00, 0x00, 0x3b, 0x02, 0x00, 0x00, 0x3b, 0x02, 0x00, 0x00, 0x88, 0x00, 0x05, // .;...;...;......
+	0x00, 0x18, 0x00, 0x00, 0x00, 0xd7, 0x01, 0x00, 0x00, 0x3a, 0x02, 0x00, 0x00, 0xd6, 0x01, 0x00, // .........:......
+	0x00, 0x51, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0xd8, 0x01, 0x00, 0x00, 0xd7, 0x01, 0x00, // .Q..............
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0xd9, 0x01, 0x00, // .....Q..........
+	0x00, 0xd7, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, // .........Q......
+	0x00, 0xda, 0x01, 0x00, 0x00, 0xd7, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x50, 0x00, 0x07, // .............P..
+	0x00, 0x0e, 0x00, 0x00, 0x00, 0xdb, 0x01, 0x00, 0x00, 0xd8, 0x01, 0x00, 0x00, 0xd9, 0x01, 0x00, // ................
+	0x00, 0xda, 0x01, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x63, 0x00, 0x04, 0x00, 0x53, 0x00, 0x00, // .........c...S..
+	0x00, 0x7f, 0x01, 0x00, 0x00, 0xdb, 0x01, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x74, 0x01, 0x00, // .............t..
+	0x00, 0xf8, 0x00, 0x02, 0x00, 0x75, 0x01, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x73, 0x01, 0x00, // .....u.......s..
+	0x00, 0xf8, 0x00, 0x02, 0x00, 0x74, 0x01, 0x00, 0x00, 0xfd, 0x00, 0x01, 0x00, 0x38, 0x00, 0x01, // .....t.......8..
+	0x00, 0x00, 0x00, 0xa0, 0x01,                                                                   // .....
+};
+
+static const uint8_t prefilter_shader_compute_mtl[2290] =
+{
+	0x43, 0x53, 0x48, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x06, 0x75, // CSH............u
+	0x5f, 0x74, 0x69, 0x6c, 0x65, 0x02, 0x01, 0x90, 0x01, 0x01, 0x00, 0x0a, 0x75, 0x5f, 0x73, 0x65, // _tile.......u_se
+	0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x02, 0x01, 0x80, 0x01, 0x01, 0x00, 0x1a, 0x75, 0x5f, 0x69, // ttings.......u_i
+	0x6e, 0x76, 0x65, 0x72, 0x73, 0x65, 0x5f, 0x76, 0x69, 0x65, 0x77, 0x5f, 0x70, 0x72, 0x6f, 0x6a, // nverse_view_proj
+	0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x04, 0x06, 0x00, 0x00, 0x18, 0x00, 0x09, 0x73, 0x5f, // ections.......s_
+	0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x73, 0x5f, // texture.......s_
+	0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x73, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, // samples.........
+	0x00, 0x01, 0x00, 0x77, 0x08, 0x00, 0x00, 0x23, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x20, // ...w...#include 
+	0x3c, 0x6d, 0x65, 0x74, 0x61, 0x6c, 0x5f, 0x73, 0x74, 0x64, 0x6c, 0x69, 0x62, 0x3e, 0x0a, 0x23, // <metal_stdlib>.#
+	0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x20, 0x3c, 0x73, 0x69, 0x6d, 0x64, 0x2f, 0x73, 0x69, // include <simd/si
+	0x6d, 0x64, 0x2e, 0x68, 0x3e, 0x0a, 0x0a, 0x75, 0x73, 0x69, 0x6e, 0x67, 0x20, 0x6e, 0x61, 0x6d, // md.h>..using nam
+	0x65, 0x73, 0x70, 0x61, 0x63, 0x65, 0x20, 0x6d, 0x65, 0x74, 0x61, 0x6c, 0x3b, 0x0a, 0x0a, 0x73, // espace metal;..s
+	0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x5f, 0x47, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x0a, 0x7b, 0x0a, // truct _Global.{.
+	0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x78, 0x34, 0x20, 0x75, 0x5f, 0x69, //     float4x4 u_i
+	0x6e, 0x76, 0x65, 0x72, 0x73, 0x65, 0x5f, 0x76, 0x69, 0x65, 0x77, 0x5f, 0x70, 0x72, 0x6f, 0x6a, // nverse_view_proj
+	0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x5b, 0x36, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, // ections[6];.    
+	0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x20, 0x75, 0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, // float4 u_setting
+	0x73, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x20, 0x75, 0x5f, // s;.    float4 u_
+	0x74, 0x69, 0x6c, 0x65, 0x3b, 0x0a, 0x7d, 0x3b, 0x0a, 0x0a, 0x6b, 0x65, 0x72, 0x6e, 0x65, 0x6c, // tile;.};..kernel
+	0x20, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x78, 0x6c, 0x61, 0x74, 0x4d, 0x74, 0x6c, 0x4d, 0x61, 0x69, //  void xlatMtlMai
+	0x6e, 0x28, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x20, 0x5f, 0x47, 0x6c, 0x6f, 0x62, // n(constant _Glob
+	0x61, 0x6c, 0x26, 0x20, 0x5f, 0x6d, 0x74, 0x6c, 0x5f, 0x75, 0x20, 0x5b, 0x5b, 0x62, 0x75, 0x66, // al& _mtl_u [[buf
+	0x66, 0x65, 0x72, 0x28, 0x30, 0x29, 0x5d, 0x5d, 0x2c, 0x20, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, // fer(0)]], textur
+	0x65, 0x63, 0x75, 0x62, 0x65, 0x3c, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x3e, 0x20, 0x73, 0x5f, 0x74, // ecube<float> s_t
+	0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x20, 0x5b, 0x5b, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, // exture [[texture
+	0x28, 0x30, 0x29, 0x5d, 0x5d, 0x2c, 0x20, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x32, 0x64, // (0)]], texture2d
+	0x5f, 0x61, 0x72, 0x72, 0x61, 0x79, 0x3c, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x2c, 0x20, 0x61, 0x63, // _array<float, ac
+	0x63, 0x65, 0x73, 0x73, 0x3a, 0x3a, 0x77, 0x72, 0x69, 0x74, 0x65, 0x3e, 0x20, 0x73, 0x5f, 0x6f, // cess::write> s_o
+	0x75, 0x74, 0x70, 0x75, 0x74, 0x54, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x20, 0x5b, 0x5b, 0x74, // utputTexture [[t
+	0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x28, 0x31, 0x29, 0x5d, 0x5d, 0x2c, 0x20, 0x74, 0x65, 0x78, // exture(1)]], tex
+	0x74, 0x75, 0x72, 0x65, 0x32, 0x64, 0x3c, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x3e, 0x20, 0x73, 0x5f, // ture2d<float> s_
+	0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x73, 0x20, 0x5b, 0x5b, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, // samples [[textur
+	0x65, 0x28, 0x32, 0x29, 0x5d, 0x5d, 0x2c, 0x20, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x72, 0x20, // e(2)]], sampler 
+	0x73, 0x5f, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x53, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x72, // s_textureSampler
+	0x20, 0x5b, 0x5b, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x72, 0x28, 0x30, 0x29, 0x5d, 0x5d, 0x2c, //  [[sampler(0)]],
+	0x20, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x72, 0x20, 0x73, 0x5f, 0x73, 0x61, 0x6d, 0x70, 0x6c, //  sampler s_sampl
+	0x65, 0x73, 0x53, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x72, 0x20, 0x5b, 0x5b, 0x73, 0x61, 0x6d, 0x70, // esSampler [[samp
+	0x6c, 0x65, 0x72, 0x28, 0x32, 0x29, 0x5d, 0x5d, 0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x33, 0x20, // ler(2)]], uint3 
+	0x67, 0x6c, 0x5f, 0x47, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x49, 0x6e, 0x76, 0x6f, 0x63, 0x61, 0x74, // gl_GlobalInvocat
+	0x69, 0x6f, 0x6e, 0x49, 0x44, 0x20, 0x5b, 0x5b, 0x74, 0x68, 0x72, 0x65, 0x61, 0x64, 0x5f, 0x70, // ionID [[thread_p
+	0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x5f, 0x69, 0x6e, 0x5f, 0x67, 0x72, 0x69, 0x64, 0x5d, // osition_in_grid]
+	0x5d, 0x29, 0x0a, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x3b, 0x3b, // ]).{.    for (;;
+	0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // ).    {.        
+	0x69, 0x6e, 0x74, 0x33, 0x20, 0x5f, 0x33, 0x38, 0x37, 0x20, 0x3d, 0x20, 0x69, 0x6e, 0x74, 0x33, // int3 _387 = int3
+	0x28, 0x67, 0x6c, 0x5f, 0x47, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x49, 0x6e, 0x76, 0x6f, 0x63, 0x61, // (gl_GlobalInvoca
+	0x74, 0x69, 0x6f, 0x6e, 0x49, 0x44, 0x29, 0x20, 0x2b, 0x20, 0x69, 0x6e, 0x74, 0x33, 0x28, 0x69, // tionID) + int3(i
+	0x6e, 0x74, 0x32, 0x28, 0x5f, 0x6d, 0x74, 0x6c, 0x5f, 0x75, 0x2e, 0x75, 0x5f, 0x74, 0x69, 0x6c, // nt2(_mtl_u.u_til
+	0x65, 0x2e, 0x78, 0x79, 0x29, 0x2c, 0x20, 0x30, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, // e.xy), 0);.     
+	0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x28, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x28, 0x5f, 0x33, //    if ((float(_3
+	0x38, 0x37, 0x2e, 0x78, 0x29, 0x20, 0x3e, 0x3d, 0x20, 0x5f, 0x6d, 0x74, 0x6c, 0x5f, 0x75, 0x2e, // 87.x) >= _mtl_u.
+	0x75, 0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x7a, 0x29, 0x20, 0x7c, 0x7c, // u_settings.z) ||
+	0x20, 0x28, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x28, 0x5f, 0x33, 0x38, 0x37, 0x2e, 0x79, 0x29, 0x20, //  (float(_387.y) 
+	0x3e, 0x3d, 0x20, 0x5f, 0x6d, 0x74, 0x6c, 0x5f, 0x75, 0x2e, 0x75, 0x5f, 0x73, 0x65, 0x74, 0x74, // >= _mtl_u.u_sett
+	0x69, 0x6e, 0x67, 0x73, 0x2e, 0x7a, 0x29, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // ings.z)).       
+	0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, //  {.            b
+	0x72, 0x65, 0x61, 0x6b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, // reak;.        }.
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x20, 0x5f, //         float4 _
+	0x35, 0x30, 0x36, 0x20, 0x3d, 0x20, 0x5f, 0x6d, 0x74, 0x6c, 0x5f, 0x75, 0x2e, 0x75, 0x5f, 0x69, // 506 = _mtl_u.u_i
+	0x6e, 0x76, 0x65, 0x72, 0x73, 0x65, 0x5f, 0x76, 0x69, 0x65, 0x77, 0x5f, 0x70, 0x72, 0x6f, 0x6a, // nverse_view_proj
+	0x65, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x5b, 0x5f, 0x33, 0x38, 0x37, 0x2e, 0x7a, 0x5d, 0x20, // ections[_387.z] 
+	0x2a, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x28, 0x28, 0x28, 0x28, 0x66, 0x6c, 0x6f, 0x61, // * float4((((floa
+	0x74, 0x32, 0x28, 0x5f, 0x33, 0x38, 0x37, 0x2e, 0x78, 0x79, 0x29, 0x20, 0x2b, 0x20, 0x66, 0x6c, // t2(_387.xy) + fl
+	0x6f, 0x61, 0x74, 0x32, 0x28, 0x30, 0x2e, 0x35, 0x29, 0x29, 0x20, 0x2f, 0x20, 0x66, 0x6c, 0x6f, // oat2(0.5)) / flo
+	0x61, 0x74, 0x32, 0x28, 0x5f, 0x6d, 0x74, 0x6c, 0x5f, 0x75, 0x2e, 0x75, 0x5f, 0x73, 0x65, 0x74, // at2(_mtl_u.u_set
+	0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x7a, 0x29, 0x29, 0x20, 0x2a, 0x20, 0x32, 0x2e, 0x30, 0x29, // tings.z)) * 2.0)
+	0x20, 0x2d, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x32, 0x28, 0x31, 0x2e, 0x30, 0x29, 0x2c, 0x20, //  - float2(1.0), 
+	0x31, 0x2e, 0x30, 0x2c, 0x20, 0x31, 0x2e, 0x30, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, // 1.0, 1.0);.     
+	0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x20, 0x5f, 0x35, 0x31, 0x33, 0x20, 0x3d, //    float3 _513 =
+	0x20, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x28, 0x5f, 0x35, 0x30, 0x36, 0x2e, //  normalize(_506.
+	0x78, 0x79, 0x7a, 0x20, 0x2f, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x28, 0x5f, 0x35, 0x30, // xyz / float3(_50
+	0x36, 0x2e, 0x77, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, // 6.w));.        b
+	0x6f, 0x6f, 0x6c, 0x33, 0x20, 0x5f, 0x34, 0x31, 0x35, 0x20, 0x3d, 0x20, 0x62, 0x6f, 0x6f, 0x6c, // ool3 _415 = bool
+	0x33, 0x28, 0x61, 0x62, 0x73, 0x28, 0x5f, 0x35, 0x31, 0x33, 0x2e, 0x7a, 0x29, 0x20, 0x3c, 0x20, // 3(abs(_513.z) < 
+	0x30, 0x2e, 0x39, 0x39, 0x39, 0x30, 0x30, 0x30, 0x30, 0x31, 0x32, 0x38, 0x37, 0x34, 0x36, 0x30, // 0.99900001287460
+	0x33, 0x32, 0x37, 0x31, 0x34, 0x38, 0x34, 0x33, 0x37, 0x35, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, // 3271484375);.   
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x20, 0x5f, 0x34, 0x32, 0x30, //      float3 _420
+	0x20, 0x3d, 0x20, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x28, 0x63, 0x72, 0x6f, //  = normalize(cro
+	0x73, 0x73, 0x28, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x28, 0x5f, 0x34, 0x31, 0x35, 0x2e, 0x78, // ss(float3(_415.x
+	0x20, 0x3f, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x28, 0x30, 0x2e, 0x30, 0x2c, 0x20, 0x30, //  ? float3(0.0, 0
+	0x2e, 0x30, 0x2c, 0x20, 0x31, 0x2e, 0x30, 0x29, 0x2e, 0x78, 0x20, 0x3a, 0x20, 0x66, 0x6c, 0x6f, // .0, 1.0).x : flo
+	0x61, 0x74, 0x33, 0x28, 0x31, 0x2e, 0x30, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x2c, 0x20, 0x30, 0x2e, // at3(1.0, 0.0, 0.
+	0x30, 0x29, 0x2e, 0x78, 0x2c, 0x20, 0x5f, 0x34, 0x31, 0x35, 0x2e, 0x79, 0x20, 0x3f, 0x20, 0x66, // 0).x, _415.y ? f
+	0x6c, 0x6f, 0x61, 0x74, 0x33, 0x28, 0x30, 0x2e, 0x30, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x2c, 0x20, // loat3(0.0, 0.0, 
+	0x31, 0x2e, 0x30, 0x29, 0x2e, 0x79, 0x20, 0x3a, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x28, // 1.0).y : float3(
+	0x31, 0x2e, 0x30, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x29, 0x2e, 0x79, // 1.0, 0.0, 0.0).y
+	0x2c, 0x20, 0x5f, 0x34, 0x31, 0x35, 0x2e, 0x7a, 0x20, 0x3f, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, // , _415.z ? float
+	0x33, 0x28, 0x30, 0x2e, 0x30, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x2c, 0x20, 0x31, 0x2e, 0x30, 0x29, // 3(0.0, 0.0, 1.0)
+	0x2e, 0x7a, 0x20, 0x3a, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x28, 0x31, 0x2e, 0x30, 0x2c, // .z : float3(1.0,
+	0x20, 0x30, 0x2e, 0x30, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x29, 0x2e, 0x7a, 0x29, 0x2c, 0x20, 0x5f, //  0.0, 0.0).z), _
+	0x35, 0x31, 0x33, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, // 513));.        f
+	0x6c, 0x6f, 0x61, 0x74, 0x33, 0x20, 0x5f, 0x35, 0x38, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, // loat3 _581;.    
+	0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x5f, 0x35, 0x38, 0x32, 0x3b, 0x0a, //     float _582;.
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x35, 0x38, 0x32, 0x20, 0x3d, 0x20, 0x30, //         _582 = 0
+	0x2e, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5f, 0x35, 0x38, 0x31, // .0;.        _581
+	0x20, 0x3d, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x28, 0x30, 0x2e, 0x30, 0x29, 0x3b, 0x0a, //  = float3(0.0);.
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x20, 0x5f, //         float3 _
+	0x34, 0x35, 0x34, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, // 454;.        flo
+	0x61, 0x74, 0x34, 0x20, 0x5f, 0x35, 0x33, 0x37, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // at4 _537;.      
+	0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x20, 0x5f, 0x35, 0x37, 0x33, 0x3b, 0x0a, 0x20, //   float3 _573;. 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x69, 0x6e, 0x74, 0x20, //        for (int 
+	0x5f, 0x35, 0x38, 0x30, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x20, 0x5f, 0x35, 0x38, 0x30, 0x20, 0x3c, // _580 = 0; _580 <
+	0x20, 0x31, 0x30, 0x32, 0x34, 0x3b, 0x20, 0x5f, 0x35, 0x33, 0x37, 0x20, 0x3d, 0x20, 0x73, 0x5f, //  1024; _537 = s_
+	0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x73, 0x2e, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x28, 0x73, // samples.sample(s
+	0x5f, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x73, 0x53, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x72, 0x2c, // _samplesSampler,
+	0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x32, 0x28, 0x28, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x28, 0x5f, //  float2((float(_
+	0x35, 0x38, 0x30, 0x29, 0x20, 0x2b, 0x20, 0x30, 0x2e, 0x35, 0x29, 0x20, 0x2a, 0x20, 0x30, 0x2e, // 580) + 0.5) * 0.
+	0x30, 0x30, 0x30, 0x39, 0x37, 0x36, 0x35, 0x36, 0x32, 0x35, 0x2c, 0x20, 0x5f, 0x6d, 0x74, 0x6c, // 0009765625, _mtl
+	0x5f, 0x75, 0x2e, 0x75, 0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x78, 0x29, // _u.u_settings.x)
+	0x2c, 0x20, 0x6c, 0x65, 0x76, 0x65, 0x6c, 0x28, 0x30, 0x2e, 0x30, 0x29, 0x29, 0x2c, 0x20, 0x5f, // , level(0.0)), _
+	0x34, 0x35, 0x34, 0x20, 0x3d, 0x20, 0x28, 0x28, 0x5f, 0x34, 0x32, 0x30, 0x20, 0x2a, 0x20, 0x5f, // 454 = ((_420 * _
+	0x35, 0x33, 0x37, 0x2e, 0x78, 0x29, 0x20, 0x2b, 0x20, 0x28, 0x63, 0x72, 0x6f, 0x73, 0x73, 0x28, // 537.x) + (cross(
+	0x5f, 0x35, 0x31, 0x33, 0x2c, 0x20, 0x5f, 0x34, 0x32, 0x30, 0x29, 0x20, 0x2a, 0x20, 0x5f, 0x35, // _513, _420) * _5
+	0x33, 0x37, 0x2e, 0x79, 0x29, 0x29, 0x20, 0x2b, 0x20, 0x28, 0x5f, 0x35, 0x31, 0x33, 0x20, 0x2a, // 37.y)) + (_513 *
+	0x20, 0x5f, 0x35, 0x33, 0x37, 0x2e, 0x7a, 0x29, 0x2c, 0x20, 0x5f, 0x35, 0x37, 0x33, 0x20, 0x3d, //  _537.z), _573 =
+	0x20, 0x5f, 0x34, 0x35, 0x34, 0x2c, 0x20, 0x5f, 0x35, 0x37, 0x33, 0x2e, 0x79, 0x20, 0x3d, 0x20, //  _454, _573.y = 
+	0x2d, 0x5f, 0x34, 0x35, 0x34, 0x2e, 0x79, 0x2c, 0x20, 0x5f, 0x35, 0x38, 0x32, 0x20, 0x2b, 0x3d, // -_454.y, _582 +=
+	0x20, 0x5f, 0x35, 0x33, 0x37, 0x2e, 0x7a, 0x2c, 0x20, 0x5f, 0x35, 0x38, 0x31, 0x20, 0x2b, 0x3d, //  _537.z, _581 +=
+	0x20, 0x28, 0x73, 0x5f, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x2e, 0x73, 0x61, 0x6d, 0x70, //  (s_texture.samp
+	0x6c, 0x65, 0x28, 0x73, 0x5f, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x53, 0x61, 0x6d, 0x70, // le(s_textureSamp
+	0x6c, 0x65, 0x72, 0x2c, 0x20, 0x5f, 0x35, 0x37, 0x33, 0x2c, 0x20, 0x6c, 0x65, 0x76, 0x65, 0x6c, // ler, _573, level
+	0x28, 0x5f, 0x35, 0x33, 0x37, 0x2e, 0x77, 0x29, 0x29, 0x2e, 0x78, 0x79, 0x7a, 0x20, 0x2a, 0x20, // (_537.w)).xyz * 
+	0x5f, 0x35, 0x33, 0x37, 0x2e, 0x7a, 0x29, 0x2c, 0x20, 0x5f, 0x35, 0x38, 0x30, 0x2b, 0x2b, 0x29, // _537.z), _580++)
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, // .        {.     
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x5f, 0x35, 0x38, 0x30, 0x20, //        if (_580 
+	0x3e, 0x3d, 0x20, 0x69, 0x6e, 0x74, 0x28, 0x5f, 0x6d, 0x74, 0x6c, 0x5f, 0x75, 0x2e, 0x75, 0x5f, // >= int(_mtl_u.u_
+	0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x79, 0x29, 0x29, 0x0a, 0x20, 0x20, 0x20, // settings.y)).   
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, //          {.     
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6b, //            break
+	0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, // ;.            }.
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6c, 0x73, 0x65, //             else
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, // .            {. 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, //                c
+	0x6f, 0x6e, 0x74, 0x69, 0x6e, 0x75, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // ontinue;.       
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //      }.         
+	0x20, 0x20, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x69, 0x6e, 0x75, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, //    continue;.   
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, //      }.        s
+	0x5f, 0x6f, 0x75, 0x74, 0x70, 0x75, 0x74, 0x54, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x2e, 0x77, // _outputTexture.w
+	0x72, 0x69, 0x74, 0x65, 0x28, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x28, 0x5f, 0x35, 0x38, 0x31, // rite(float4(_581
+	0x20, 0x2f, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x28, 0x5f, 0x35, 0x38, 0x32, 0x29, 0x2c, //  / float3(_582),
+	0x20, 0x31, 0x2e, 0x30, 0x29, 0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x32, 0x28, 0x5f, 0x33, 0x38, //  1.0), uint2(_38
+	0x37, 0x2e, 0x78, 0x79, 0x29, 0x2c, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x28, 0x5f, 0x33, 0x38, 0x37, // 7.xy), uint(_387
+	0x2e, 0x7a, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, // .z));.        br
+	0x65, 0x61, 0x6b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x7d, 0x0a, 0x0a, 0x00, 0x00, // eak;.    }.}....
+	0xa0, 0x01,                                                                                     // ..
+};
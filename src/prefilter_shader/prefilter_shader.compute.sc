@@ -0,0 +1,64 @@
+#include <bgfx_compute.sh>
+#include <cube_map_compute.sh>
+
+#define MAX_SAMPLE_COUNT 1024
+
+SAMPLERCUBE(s_texture, 0);
+SAMPLER2D(s_samples, 2);
+IMAGE2D_ARRAY_WR(s_output, rgba16f, 1);
+
+uniform mat4 u_inverse_view_projections[6];
+uniform vec4 u_settings;
+uniform vec4 u_tile;
+
+// Texture coordinate of the row of the mip level in the sample table.
+#define u_samples_row u_settings.x
+#define u_sample_count u_settings.y
+#define u_output_resolution u_settings.z
+
+// Heavy convolutions are dispatched a tile at a time, XY is the first texel of the tile.
+#define u_tile_offset u_tile.xy
+
+// Samples of every prefilter mip level are precomputed on the CPU by `create_prefilter_samples`, a row of the table per
+// mip level and culled to the ones above the horizon. XYZ is the light direction in the tangent space of the normal,
+// so Z is also the weight of the sample, and W is the environment mip level its pdf picks.
+vec4 prefilter_sample(int i) {
+    float u = (float(i) + 0.5) / float(MAX_SAMPLE_COUNT);
+    return texture2DLod(s_samples, vec2(u, u_samples_row), 0.0);
+}
+
+// Writes all six faces of one prefilter mip level, face index is the Z component of the invocation.
+NUM_THREADS(8, 8, 1)
+void main() {
+    ivec3 texel = ivec3(gl_GlobalInvocationID) + ivec3(u_tile_offset, 0.0);
+    if (float(texel.x) >= u_output_resolution || float(texel.y) >= u_output_resolution) {
+        return;
+    }
+
+    vec3 normal = cube_map_direction(texel, u_output_resolution, u_inverse_view_projections[texel.z]);
+
+    // Tangent frame the samples were generated in.
+    vec3 up = abs(normal.z) < 0.999 ? vec3(0.0, 0.0, 1.0) : vec3(1.0, 0.0, 0.0);
+    vec3 tangent = normalize(cross(up, normal));
+    vec3 bitangent = cross(normal, tangent);
+
+    int sample_count = int(u_sample_count);
+    vec3 prefiltered_color = vec3(0.0, 0.0, 0.0);
+    float total_weight = 0.0;
+
+    // Loop bound must be a constant for older shader models, so the loop breaks at the actual sample count.
+    for (int i = 0; i < MAX_SAMPLE_COUNT; i++) {
+        if (i >= sample_count) {
+            break;
+        }
+
+        vec4 light_sample = prefilter_sample(i);
+        vec3 light_dir = tangent * light_sample.x + bitangent * light_sample.y + normal * light_sample.z;
+        #if (BGFX_SHADER_LANGUAGE_HLSL || BGFX_SHADER_LANGUAGE_PSSL || BGFX_SHADER_LANGUAGE_METAL)
+        light_dir.y = -light_dir.y;
+        #endif
+        prefiltered_color += textureCubeLod(s_texture, light_dir, light_sample.w).xyz * light_sample.z;
+        total_weight += light_sample.z;
+    }
+    imageStore(s_output, texel, vec4(prefiltered_color / total_weight, 1.0));
+}
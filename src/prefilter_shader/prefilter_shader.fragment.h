@@ -0,0 +1,397 @@
+#include <cstdint>
+
+static const uint8_t prefilter_shader_fragment_glsl[1748] =
+{
+	0x46, 0x53, 0x48, 0x06, 0x70, 0x94, 0x72, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x09, 0x73, // FSH.p.r........s
+	0x5f, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x09, 0x73, // _texture.......s
+	0x5f, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x73, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x0a, 0x75, // _samples.......u
+	0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x02, 0x01, 0x00, 0x00, 0x01, 0x00, 0x90, // _settings.......
+	0x06, 0x00, 0x00, 0x76, 0x61, 0x72, 0x79, 0x69, 0x6e, 0x67, 0x20, 0x68, 0x69, 0x67, 0x68, 0x70, // ...varying highp
+	0x20, 0x76, 0x65, 0x63, 0x33, 0x20, 0x76, 0x5f, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, //  vec3 v_position
+	0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x6c, 0x6f, 0x77, 0x70, 0x20, 0x73, // ;.uniform lowp s
+	0x61, 0x6d, 0x70, 0x6c, 0x65, 0x72, 0x43, 0x75, 0x62, 0x65, 0x20, 0x73, 0x5f, 0x74, 0x65, 0x78, // amplerCube s_tex
+	0x74, 0x75, 0x72, 0x65, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x73, 0x61, // ture;.uniform sa
+	0x6d, 0x70, 0x6c, 0x65, 0x72, 0x32, 0x44, 0x20, 0x73, 0x5f, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, // mpler2D s_sample
+	0x73, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x68, 0x69, 0x67, 0x68, 0x70, // s;.uniform highp
+	0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x75, 0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, //  vec4 u_settings
+	0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x6d, 0x61, 0x69, 0x6e, 0x20, 0x28, 0x29, 0x0a, 0x7b, // ;.void main ().{
+	0x0a, 0x20, 0x20, 0x68, 0x69, 0x67, 0x68, 0x70, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x5f, 0x31, // .  highp int i_1
+	0x3b, 0x0a, 0x20, 0x20, 0x6c, 0x6f, 0x77, 0x70, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x74, // ;.  lowp float t
+	0x6f, 0x74, 0x61, 0x6c, 0x5f, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x5f, 0x32, 0x3b, 0x0a, 0x20, // otal_weight_2;. 
+	0x20, 0x6c, 0x6f, 0x77, 0x70, 0x20, 0x76, 0x65, 0x63, 0x33, 0x20, 0x70, 0x72, 0x65, 0x66, 0x69, //  lowp vec3 prefi
+	0x6c, 0x74, 0x65, 0x72, 0x65, 0x64, 0x5f, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x5f, 0x33, 0x3b, 0x0a, // ltered_color_3;.
+	0x20, 0x20, 0x68, 0x69, 0x67, 0x68, 0x70, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x73, 0x61, 0x6d, 0x70, //   highp int samp
+	0x6c, 0x65, 0x5f, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x5f, 0x34, 0x3b, 0x0a, 0x20, 0x20, 0x68, 0x69, // le_count_4;.  hi
+	0x67, 0x68, 0x70, 0x20, 0x76, 0x65, 0x63, 0x33, 0x20, 0x62, 0x69, 0x74, 0x61, 0x6e, 0x67, 0x65, // ghp vec3 bitange
+	0x6e, 0x74, 0x5f, 0x35, 0x3b, 0x0a, 0x20, 0x20, 0x68, 0x69, 0x67, 0x68, 0x70, 0x20, 0x76, 0x65, // nt_5;.  highp ve
+	0x63, 0x33, 0x20, 0x74, 0x61, 0x6e, 0x67, 0x65, 0x6e, 0x74, 0x5f, 0x36, 0x3b, 0x0a, 0x20, 0x20, // c3 tangent_6;.  
+	0x68, 0x69, 0x67, 0x68, 0x70, 0x20, 0x76, 0x65, 0x63, 0x33, 0x20, 0x6e, 0x6f, 0x72, 0x6d, 0x61, // highp vec3 norma
+	0x6c, 0x5f, 0x37, 0x3b, 0x0a, 0x20, 0x20, 0x68, 0x69, 0x67, 0x68, 0x70, 0x20, 0x76, 0x65, 0x63, // l_7;.  highp vec
+	0x33, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x38, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x6d, // 3 tmpvar_8;.  tm
+	0x70, 0x76, 0x61, 0x72, 0x5f, 0x38, 0x20, 0x3d, 0x20, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, // pvar_8 = normali
+	0x7a, 0x65, 0x28, 0x76, 0x5f, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x29, 0x3b, 0x0a, // ze(v_position);.
+	0x20, 0x20, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x5f, 0x37, 0x20, 0x3d, 0x20, 0x74, 0x6d, 0x70, //   normal_7 = tmp
+	0x76, 0x61, 0x72, 0x5f, 0x38, 0x3b, 0x0a, 0x20, 0x20, 0x68, 0x69, 0x67, 0x68, 0x70, 0x20, 0x66, // var_8;.  highp f
+	0x6c, 0x6f, 0x61, 0x74, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x39, 0x3b, 0x0a, 0x20, // loat tmpvar_9;. 
+	0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x39, 0x20, 0x3d, 0x20, 0x61, 0x62, 0x73, 0x28, //  tmpvar_9 = abs(
+	0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x38, 0x2e, 0x7a, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x68, // tmpvar_8.z);.  h
+	0x69, 0x67, 0x68, 0x70, 0x20, 0x76, 0x65, 0x63, 0x33, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, // ighp vec3 tmpvar
+	0x5f, 0x31, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x28, 0x74, 0x6d, 0x70, 0x76, // _10;.  if ((tmpv
+	0x61, 0x72, 0x5f, 0x39, 0x20, 0x3c, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x29, 0x29, 0x20, 0x7b, // ar_9 < 0.999)) {
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x30, 0x20, 0x3d, // .    tmpvar_10 =
+	0x20, 0x76, 0x65, 0x63, 0x33, 0x28, 0x30, 0x2e, 0x30, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x2c, 0x20, //  vec3(0.0, 0.0, 
+	0x31, 0x2e, 0x30, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x7d, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x7b, // 1.0);.  } else {
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x30, 0x20, 0x3d, // .    tmpvar_10 =
+	0x20, 0x76, 0x65, 0x63, 0x33, 0x28, 0x31, 0x2e, 0x30, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x2c, 0x20, //  vec3(1.0, 0.0, 
+	0x30, 0x2e, 0x30, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x7d, 0x3b, 0x0a, 0x20, 0x20, 0x68, 0x69, 0x67, // 0.0);.  };.  hig
+	0x68, 0x70, 0x20, 0x76, 0x65, 0x63, 0x33, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, // hp vec3 tmpvar_1
+	0x31, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x31, 0x20, 0x3d, // 1;.  tmpvar_11 =
+	0x20, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x28, 0x28, 0x28, 0x74, 0x6d, 0x70, //  normalize(((tmp
+	0x76, 0x61, 0x72, 0x5f, 0x31, 0x30, 0x2e, 0x79, 0x7a, 0x78, 0x20, 0x2a, 0x20, 0x74, 0x6d, 0x70, // var_10.yzx * tmp
+	0x76, 0x61, 0x72, 0x5f, 0x38, 0x2e, 0x7a, 0x78, 0x79, 0x29, 0x20, 0x2d, 0x20, 0x28, 0x74, 0x6d, // var_8.zxy) - (tm
+	0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x30, 0x2e, 0x7a, 0x78, 0x79, 0x20, 0x2a, 0x20, 0x74, 0x6d, // pvar_10.zxy * tm
+	0x70, 0x76, 0x61, 0x72, 0x5f, 0x38, 0x2e, 0x79, 0x7a, 0x78, 0x29, 0x29, 0x29, 0x3b, 0x0a, 0x20, // pvar_8.yzx)));. 
+	0x20, 0x74, 0x61, 0x6e, 0x67, 0x65, 0x6e, 0x74, 0x5f, 0x36, 0x20, 0x3d, 0x20, 0x74, 0x6d, 0x70, //  tangent_6 = tmp
+	0x76, 0x61, 0x72, 0x5f, 0x31, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x62, 0x69, 0x74, 0x61, 0x6e, 0x67, // var_11;.  bitang
+	0x65, 0x6e, 0x74, 0x5f, 0x35, 0x20, 0x3d, 0x20, 0x28, 0x28, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, // ent_5 = ((tmpvar
+	0x5f, 0x38, 0x2e, 0x79, 0x7a, 0x78, 0x20, 0x2a, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, // _8.yzx * tmpvar_
+	0x31, 0x31, 0x2e, 0x7a, 0x78, 0x79, 0x29, 0x20, 0x2d, 0x20, 0x28, 0x74, 0x6d, 0x70, 0x76, 0x61, // 11.zxy) - (tmpva
+	0x72, 0x5f, 0x38, 0x2e, 0x7a, 0x78, 0x79, 0x20, 0x2a, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, // r_8.zxy * tmpvar
+	0x5f, 0x31, 0x31, 0x2e, 0x79, 0x7a, 0x78, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x73, 0x61, 0x6d, // _11.yzx));.  sam
+	0x70, 0x6c, 0x65, 0x5f, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x5f, 0x34, 0x20, 0x3d, 0x20, 0x69, 0x6e, // ple_count_4 = in
+	0x74, 0x28, 0x75, 0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x79, 0x29, 0x3b, // t(u_settings.y);
+	0x0a, 0x20, 0x20, 0x70, 0x72, 0x65, 0x66, 0x69, 0x6c, 0x74, 0x65, 0x72, 0x65, 0x64, 0x5f, 0x63, // .  prefiltered_c
+	0x6f, 0x6c, 0x6f, 0x72, 0x5f, 0x33, 0x20, 0x3d, 0x20, 0x76, 0x65, 0x63, 0x33, 0x28, 0x30, 0x2e, // olor_3 = vec3(0.
+	0x30, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x29, 0x3b, 0x0a, 0x20, 0x20, // 0, 0.0, 0.0);.  
+	0x74, 0x6f, 0x74, 0x61, 0x6c, 0x5f, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x5f, 0x32, 0x20, 0x3d, // total_weight_2 =
+	0x20, 0x30, 0x2e, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x69, 0x5f, 0x31, 0x20, 0x3d, 0x20, 0x30, 0x3b, //  0.0;.  i_1 = 0;
+	0x0a, 0x20, 0x20, 0x77, 0x68, 0x69, 0x6c, 0x65, 0x20, 0x28, 0x74, 0x72, 0x75, 0x65, 0x29, 0x20, // .  while (true) 
+	0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x28, 0x69, 0x5f, 0x31, 0x20, 0x3e, // {.    if ((i_1 >
+	0x3d, 0x20, 0x31, 0x30, 0x32, 0x34, 0x29, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, // = 1024)) {.     
+	0x20, 0x62, 0x72, 0x65, 0x61, 0x6b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x3b, 0x0a, 0x20, //  break;.    };. 
+	0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x28, 0x69, 0x5f, 0x31, 0x20, 0x3e, 0x3d, 0x20, 0x73, //    if ((i_1 >= s
+	0x61, 0x6d, 0x70, 0x6c, 0x65, 0x5f, 0x63, 0x6f, 0x75, 0x6e, 0x74, 0x5f, 0x34, 0x29, 0x29, 0x20, // ample_count_4)) 
+	0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6b, 0x3b, 0x0a, 0x20, // {.      break;. 
+	0x20, 0x20, 0x20, 0x7d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x68, 0x69, 0x67, 0x68, 0x70, 0x20, //    };.    highp 
+	0x76, 0x65, 0x63, 0x32, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x32, 0x3b, 0x0a, // vec2 tmpvar_12;.
+	0x20, 0x20, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x32, 0x2e, 0x78, 0x20, //     tmpvar_12.x 
+	0x3d, 0x20, 0x28, 0x28, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x28, 0x69, 0x5f, 0x31, 0x29, 0x20, 0x2b, // = ((float(i_1) +
+	0x20, 0x30, 0x2e, 0x35, 0x29, 0x20, 0x2f, 0x20, 0x31, 0x30, 0x32, 0x34, 0x2e, 0x30, 0x29, 0x3b, //  0.5) / 1024.0);
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x32, 0x2e, 0x79, // .    tmpvar_12.y
+	0x20, 0x3d, 0x20, 0x75, 0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x2e, 0x78, 0x3b, //  = u_settings.x;
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x6f, 0x77, 0x70, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x74, // .    lowp vec4 t
+	0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x33, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6d, // mpvar_13;.    tm
+	0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x33, 0x20, 0x3d, 0x20, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, // pvar_13 = textur
+	0x65, 0x32, 0x44, 0x4c, 0x6f, 0x64, 0x20, 0x20, 0x20, 0x20, 0x28, 0x73, 0x5f, 0x73, 0x61, 0x6d, // e2DLod    (s_sam
+	0x70, 0x6c, 0x65, 0x73, 0x2c, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x32, 0x2c, // ples, tmpvar_12,
+	0x20, 0x30, 0x2e, 0x30, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x65, 0x66, 0x69, //  0.0);.    prefi
+	0x6c, 0x74, 0x65, 0x72, 0x65, 0x64, 0x5f, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x5f, 0x33, 0x20, 0x3d, // ltered_color_3 =
+	0x20, 0x28, 0x70, 0x72, 0x65, 0x66, 0x69, 0x6c, 0x74, 0x65, 0x72, 0x65, 0x64, 0x5f, 0x63, 0x6f, //  (prefiltered_co
+	0x6c, 0x6f, 0x72, 0x5f, 0x33, 0x20, 0x2b, 0x20, 0x28, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, // lor_3 + (texture
+	0x43, 0x75, 0x62, 0x65, 0x4c, 0x6f, 0x64, 0x20, 0x20, 0x20, 0x20, 0x28, 0x73, 0x5f, 0x74, 0x65, // CubeLod    (s_te
+	0x78, 0x74, 0x75, 0x72, 0x65, 0x2c, 0x20, 0x28, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, // xture, (.      (
+	0x28, 0x74, 0x61, 0x6e, 0x67, 0x65, 0x6e, 0x74, 0x5f, 0x36, 0x20, 0x2a, 0x20, 0x74, 0x6d, 0x70, // (tangent_6 * tmp
+	0x76, 0x61, 0x72, 0x5f, 0x31, 0x33, 0x2e, 0x78, 0x29, 0x20, 0x2b, 0x20, 0x28, 0x62, 0x69, 0x74, // var_13.x) + (bit
+	0x61, 0x6e, 0x67, 0x65, 0x6e, 0x74, 0x5f, 0x35, 0x20, 0x2a, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, // angent_5 * tmpva
+	0x72, 0x5f, 0x31, 0x33, 0x2e, 0x79, 0x29, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2b, 0x20, // r_13.y)).     + 
+	0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x28, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x5f, 0x37, // .      (normal_7
+	0x20, 0x2a, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x33, 0x2e, 0x7a, 0x29, 0x0a, //  * tmpvar_13.z).
+	0x20, 0x20, 0x20, 0x20, 0x29, 0x2c, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x33, //     ), tmpvar_13
+	0x2e, 0x77, 0x29, 0x2e, 0x78, 0x79, 0x7a, 0x20, 0x2a, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, // .w).xyz * tmpvar
+	0x5f, 0x31, 0x33, 0x2e, 0x7a, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x74, 0x6f, 0x74, // _13.z));.    tot
+	0x61, 0x6c, 0x5f, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x5f, 0x32, 0x20, 0x3d, 0x20, 0x28, 0x74, // al_weight_2 = (t
+	0x6f, 0x74, 0x61, 0x6c, 0x5f, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x5f, 0x32, 0x20, 0x2b, 0x20, // otal_weight_2 + 
+	0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x33, 0x2e, 0x7a, 0x29, 0x3b, 0x0a, 0x20, 0x20, // tmpvar_13.z);.  
+	0x20, 0x20, 0x69, 0x5f, 0x31, 0x2b, 0x2b, 0x3b, 0x0a, 0x20, 0x20, 0x7d, 0x3b, 0x0a, 0x20, 0x20, //   i_1++;.  };.  
+	0x6c, 0x6f, 0x77, 0x70, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, // lowp vec4 tmpvar
+	0x5f, 0x31, 0x34, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x34, // _14;.  tmpvar_14
+	0x2e, 0x77, 0x20, 0x3d, 0x20, 0x31, 0x2e, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x6d, 0x70, 0x76, // .w = 1.0;.  tmpv
+	0x61, 0x72, 0x5f, 0x31, 0x34, 0x2e, 0x78, 0x79, 0x7a, 0x20, 0x3d, 0x20, 0x28, 0x70, 0x72, 0x65, // ar_14.xyz = (pre
+	0x66, 0x69, 0x6c, 0x74, 0x65, 0x72, 0x65, 0x64, 0x5f, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x5f, 0x33, // filtered_color_3
+	0x20, 0x2f, 0x20, 0x74, 0x6f, 0x74, 0x61, 0x6c, 0x5f, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x5f, //  / total_weight_
+	0x32, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x67, 0x6c, 0x5f, 0x46, 0x72, 0x61, 0x67, 0x43, 0x6f, 0x6c, // 2);.  gl_FragCol
+	0x6f, 0x72, 0x20, 0x3d, 0x20, 0x74, 0x6d, 0x70, 0x76, 0x61, 0x72, 0x5f, 0x31, 0x34, 0x3b, 0x0a, // or = tmpvar_14;.
+	0x7d, 0x0a, 0x0a, 0x00,                                                                         // }...
+};
+
+static const uint8_t prefilter_shader_fragment_spv[2667] =
+{
+	0x46, 0x53, 0x48, 0x06, 0x70, 0x94, 0x72, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0a, 0x75, // FSH.p.r........u
+	0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x12, 0x01, 0x00, 0x00, 0x01, 0x00, 0x09, // _settings.......
+	0x73, 0x5f, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, // s_texture.......
+	0x73, 0x5f, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x73, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, // s_samples......$
+	0x0a, 0x00, 0x00, 0x03, 0x02, 0x23, 0x07, 0x00, 0x00, 0x01, 0x00, 0x07, 0x00, 0x08, 0x00, 0x92, // .....#..........
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x00, 0x0b, // ................
+	0x00, 0x06, 0x00, 0x01, 0x00, 0x00, 0x00, 0x47, 0x4c, 0x53, 0x4c, 0x2e, 0x73, 0x74, 0x64, 0x2e, // .......GLSL.std.
+	0x34, 0x35, 0x30, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, // 450.............
+	0x00, 0x00, 0x00, 0x0f, 0x00, 0x07, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x6d, // ...............m
+	0x61, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00, 0xe2, 0x00, 0x00, 0x00, 0xeb, 0x00, 0x00, 0x00, 0x10, // ain.............
+	0x00, 0x03, 0x00, 0x04, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x05, // ................
+	0x00, 0x00, 0x00, 0xf4, 0x01, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x6d, // ...............m
+	0x61, 0x69, 0x6e, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x07, 0x00, 0x33, 0x00, 0x00, 0x00, 0x73, // ain........3...s
+	0x5f, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x53, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x72, 0x00, // _textureSampler.
+	0x00, 0x00, 0x00, 0x05, 0x00, 0x07, 0x00, 0x36, 0x00, 0x00, 0x00, 0x73, 0x5f, 0x74, 0x65, 0x78, // .......6...s_tex
+	0x74, 0x75, 0x72, 0x65, 0x54, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x00, 0x00, 0x00, 0x00, 0x05, // tureTexture.....
+	0x00, 0x07, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x73, 0x5f, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x73, // ...;...s_samples
+	0x53, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x07, 0x00, 0x3e, // Sampler........>
+	0x00, 0x00, 0x00, 0x73, 0x5f, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x73, 0x54, 0x65, 0x78, 0x74, // ...s_samplesText
+	0x75, 0x72, 0x65, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04, 0x00, 0x6b, 0x00, 0x00, 0x00, 0x24, // ure........k...$
+	0x47, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x00, 0x06, 0x00, 0x06, 0x00, 0x6b, 0x00, 0x00, 0x00, 0x00, // Global.....k....
+	0x00, 0x00, 0x00, 0x75, 0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x00, 0x00, 0x05, // ...u_settings...
+	0x00, 0x03, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x00, 0xe2, // ...m............
+	0x00, 0x00, 0x00, 0x76, 0x5f, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x00, 0x00, 0x05, // ...v_position...
+	0x00, 0x06, 0x00, 0xeb, 0x00, 0x00, 0x00, 0x62, 0x67, 0x66, 0x78, 0x5f, 0x46, 0x72, 0x61, 0x67, // .......bgfx_Frag
+	0x44, 0x61, 0x74, 0x61, 0x30, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x33, 0x00, 0x00, 0x00, 0x22, // Data0..G...3..."
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x33, 0x00, 0x00, 0x00, 0x21, // .......G...3...!
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x36, 0x00, 0x00, 0x00, 0x22, // .......G...6..."
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x36, 0x00, 0x00, 0x00, 0x21, // .......G...6...!
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x22, // .......G...;..."
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x21, // .......G...;...!
+	0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x22, // .......G...>..."
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x21, // .......G...>...!
+	0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x48, 0x00, 0x05, 0x00, 0x6b, 0x00, 0x00, 0x00, 0x00, // .......H...k....
+	0x00, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x03, 0x00, 0x6b, // ...#.......G...k
+	0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x22, // .......G...m..."
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x21, // .......G...m...!
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0xe2, 0x00, 0x00, 0x00, 0x1e, // .......G........
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0x00, 0x04, 0x00, 0xeb, 0x00, 0x00, 0x00, 0x1e, // .......G........
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x21, // ...............!
+	0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x1a, 0x00, 0x02, 0x00, 0x06, // ................
+	0x00, 0x00, 0x00, 0x16, 0x00, 0x03, 0x00, 0x07, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x19, // ........... ....
+	0x00, 0x09, 0x00, 0x08, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, // ................
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, // ................
+	0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x02, // ................
+	0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x04, // ................
+	0x00, 0x00, 0x00, 0x19, 0x00, 0x09, 0x00, 0x15, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x03, // ................
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, // ................
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00, 0x18, 0x00, 0x00, 0x00, 0x07, // ................
+	0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x15, 0x00, 0x04, 0x00, 0x24, 0x00, 0x00, 0x00, 0x20, // ...........$... 
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, // ....... ...2....
+	0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x32, 0x00, 0x00, 0x00, 0x33, // .......;...2...3
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, // ....... ...5....
+	0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x35, 0x00, 0x00, 0x00, 0x36, // .......;...5...6
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x32, 0x00, 0x00, 0x00, 0x3b, // .......;...2...;
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x00, // ....... ...=....
+	0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x3d, 0x00, 0x00, 0x00, 0x3e, // .......;...=...>
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x24, 0x00, 0x00, 0x00, 0x41, // .......+...$...A
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x24, 0x00, 0x00, 0x00, 0x45, // .......+...$...E
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x03, 0x00, 0x49, 0x00, 0x00, 0x00, 0x08, // ...........I....
+	0x00, 0x00, 0x00, 0x1b, 0x00, 0x03, 0x00, 0x55, 0x00, 0x00, 0x00, 0x15, 0x00, 0x00, 0x00, 0x2b, // .......U.......+
+	0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x1e, // .......f......?.
+	0x00, 0x03, 0x00, 0x6b, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x6c, // ...k....... ...l
+	0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x6b, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0x6c, // .......k...;...l
+	0x00, 0x00, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x15, 0x00, 0x04, 0x00, 0x6e, // ...m...........n
+	0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x6e, // ... .......+...n
+	0x00, 0x00, 0x00, 0x6f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0x70, // ...o....... ...p
+	0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x07, // ...........+....
+	0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x07, // ...t.......+....
+	0x00, 0x00, 0x00, 0x87, 0x00, 0x00, 0x00, 0x77, 0xbe, 0x7f, 0x3f, 0x14, 0x00, 0x02, 0x00, 0x88, // .......w..?.....
+	0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x00, // ...+............
+	0x00, 0x80, 0x3f, 0x2c, 0x00, 0x06, 0x00, 0x18, 0x00, 0x00, 0x00, 0x8b, 0x00, 0x00, 0x00, 0x74, // ..?,...........t
+	0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x2c, 0x00, 0x06, 0x00, 0x18, // ...t.......,....
+	0x00, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x74, // ...........t...t
+	0x00, 0x00, 0x00, 0x17, 0x00, 0x04, 0x00, 0x8d, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x03, // ................
+	0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x6e, 0x00, 0x00, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x01, // ...+...n........
+	0x00, 0x00, 0x00, 0x2c, 0x00, 0x06, 0x00, 0x18, 0x00, 0x00, 0x00, 0x9f, 0x00, 0x00, 0x00, 0x74, // ...,...........t
+	0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x24, // ...t...t...+...$
+	0x00, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0xe1, // ........... ....
+	0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0xe1, // ...........;....
+	0x00, 0x00, 0x00, 0xe2, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x00, 0xea, // ........... ....
+	0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x3b, 0x00, 0x04, 0x00, 0xea, // ...........;....
+	0x00, 0x00, 0x00, 0xeb, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x04, 0x00, 0x07, // ...........+....
+	0x00, 0x00, 0x00, 0x8e, 0x01, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3a, 0x36, 0x00, 0x05, 0x00, 0x02, // ..........:6....
+	0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf8, // ................
+	0x00, 0x02, 0x00, 0x05, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x34, // .......=.......4
+	0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x15, 0x00, 0x00, 0x00, 0x37, // ...3...=.......7
+	0x00, 0x00, 0x00, 0x36, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x06, 0x00, 0x00, 0x00, 0x3c, // ...6...=.......<
+	0x00, 0x00, 0x00, 0x3b, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00, 0x3f, // ...;...=.......?
+	0x00, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x18, 0x00, 0x00, 0x00, 0xe3, // ...>...=........
+	0x00, 0x00, 0x00, 0xe2, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x18, 0x00, 0x00, 0x00, 0x11, // ................
+	0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0xe3, 0x00, 0x00, 0x00, 0x51, // .......E.......Q
+	0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0x13, 0x01, 0x00, 0x00, 0x11, 0x01, 0x00, 0x00, 0x02, // ................
+	0x00, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x07, 0x00, 0x00, 0x00, 0x14, 0x01, 0x00, 0x00, 0x01, // ................
+	0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x13, 0x01, 0x00, 0x00, 0xb8, 0x00, 0x05, 0x00, 0x88, // ................
+	0x00, 0x00, 0x00, 0x15, 0x01, 0x00, 0x00, 0x14, 0x01, 0x00, 0x00, 0x87, 0x00, 0x00, 0x00, 0x50, // ...............P
+	0x00, 0x06, 0x00, 0x8d, 0x00, 0x00, 0x00, 0x16, 0x01, 0x00, 0x00, 0x15, 0x01, 0x00, 0x00, 0x15, // ................
+	0x01, 0x00, 0x00, 0x15, 0x01, 0x00, 0x00, 0xa9, 0x00, 0x06, 0x00, 0x18, 0x00, 0x00, 0x00, 0x17, // ................
+	0x01, 0x00, 0x00, 0x16, 0x01, 0x00, 0x00, 0x8b, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x0c, // ................
+	0x00, 0x07, 0x00, 0x18, 0x00, 0x00, 0x00, 0x1a, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x44, // ...............D
+	0x00, 0x00, 0x00, 0x17, 0x01, 0x00, 0x00, 0x11, 0x01, 0x00, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x18, // ................
+	0x00, 0x00, 0x00, 0x1b, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x1a, // ...........E....
+	0x01, 0x00, 0x00, 0x0c, 0x00, 0x07, 0x00, 0x18, 0x00, 0x00, 0x00, 0x1e, 0x01, 0x00, 0x00, 0x01, // ................
+	0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x11, 0x01, 0x00, 0x00, 0x1b, 0x01, 0x00, 0x00, 0x41, // ...D...........A
+	0x00, 0x06, 0x00, 0x70, 0x00, 0x00, 0x00, 0x1f, 0x01, 0x00, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x45, // ...p.......m...E
+	0x00, 0x00, 0x00, 0x9a, 0x00, 0x00, 0x00, 0x3d, 0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0x20, // .......=....... 
+	0x01, 0x00, 0x00, 0x1f, 0x01, 0x00, 0x00, 0x6e, 0x00, 0x04, 0x00, 0x24, 0x00, 0x00, 0x00, 0x21, // .......n...$...!
+	0x01, 0x00, 0x00, 0x20, 0x01, 0x00, 0x00, 0xf9, 0x00, 0x02, 0x00, 0x22, 0x01, 0x00, 0x00, 0xf8, // ... ......."....
+	0x00, 0x02, 0x00, 0x22, 0x01, 0x00, 0x00, 0xf5, 0x00, 0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x91, // ..."............
+	0x01, 0x00, 0x00, 0x74, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x4c, 0x01, 0x00, 0x00, 0x2c, // ...t.......L...,
+	0x01, 0x00, 0x00, 0xf5, 0x00, 0x07, 0x00, 0x18, 0x00, 0x00, 0x00, 0x90, 0x01, 0x00, 0x00, 0x9f, // ................
+	0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x48, 0x01, 0x00, 0x00, 0x2c, 0x01, 0x00, 0x00, 0xf5, // .......H...,....
+	0x00, 0x07, 0x00, 0x24, 0x00, 0x00, 0x00, 0x8f, 0x01, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x05, // ...$.......E....
+	0x00, 0x00, 0x00, 0x4e, 0x01, 0x00, 0x00, 0x2c, 0x01, 0x00, 0x00, 0xb1, 0x00, 0x05, 0x00, 0x88, // ...N...,........
+	0x00, 0x00, 0x00, 0x27, 0x01, 0x00, 0x00, 0x8f, 0x01, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x00, 0xf6, // ...'............
+	0x00, 0x04, 0x00, 0x23, 0x01, 0x00, 0x00, 0x2c, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, // ...#...,........
+	0x00, 0x04, 0x00, 0x27, 0x01, 0x00, 0x00, 0x28, 0x01, 0x00, 0x00, 0x23, 0x01, 0x00, 0x00, 0xf8, // ...'...(...#....
+	0x00, 0x02, 0x00, 0x28, 0x01, 0x00, 0x00, 0xaf, 0x00, 0x05, 0x00, 0x88, 0x00, 0x00, 0x00, 0x2b, // ...(...........+
+	0x01, 0x00, 0x00, 0x8f, 0x01, 0x00, 0x00, 0x21, 0x01, 0x00, 0x00, 0xf7, 0x00, 0x03, 0x00, 0x2c, // .......!.......,
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x04, 0x00, 0x2b, 0x01, 0x00, 0x00, 0x2d, // ...........+...-
+	0x01, 0x00, 0x00, 0x2c, 0x01, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x2d, 0x01, 0x00, 0x00, 0xf9, // ...,.......-....
+	0x00, 0x02, 0x00, 0x23, 0x01, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x2c, 0x01, 0x00, 0x00, 0x6f, // ...#.......,...o
+	0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0x63, 0x01, 0x00, 0x00, 0x8f, 0x01, 0x00, 0x00, 0x81, // .......c........
+	0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0x64, 0x01, 0x00, 0x00, 0x63, 0x01, 0x00, 0x00, 0x66, // .......d...c...f
+	0x00, 0x00, 0x00, 0x85, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0x65, 0x01, 0x00, 0x00, 0x64, // ...........e...d
+	0x01, 0x00, 0x00, 0x8e, 0x01, 0x00, 0x00, 0x41, 0x00, 0x06, 0x00, 0x70, 0x00, 0x00, 0x00, 0x67, // .......A...p...g
+	0x01, 0x00, 0x00, 0x6d, 0x00, 0x00, 0x00, 0x45, 0x00, 0x00, 0x00, 0x6f, 0x00, 0x00, 0x00, 0x3d, // ...m...E...o...=
+	0x00, 0x04, 0x00, 0x07, 0x00, 0x00, 0x00, 0x68, 0x01, 0x00, 0x00, 0x67, 0x01, 0x00, 0x00, 0x50, // .......h...g...P
+	0x00, 0x05, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x69, 0x01, 0x00, 0x00, 0x65, 0x01, 0x00, 0x00, 0x68, // .......i...e...h
+	0x01, 0x00, 0x00, 0x56, 0x00, 0x05, 0x00, 0x49, 0x00, 0x00, 0x00, 0x71, 0x01, 0x00, 0x00, 0x3f, // ...V...I...q...?
+	0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x58, 0x00, 0x07, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x74, // ...<...X.......t
+	0x01, 0x00, 0x00, 0x71, 0x01, 0x00, 0x00, 0x69, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x74, // ...q...i.......t
+	0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0x32, 0x01, 0x00, 0x00, 0x74, // ...Q.......2...t
+	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x05, 0x00, 0x18, 0x00, 0x00, 0x00, 0x33, // ...............3
+	0x01, 0x00, 0x00, 0x1b, 0x01, 0x00, 0x00, 0x32, 0x01, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x07, // .......2...Q....
+	0x00, 0x00, 0x00, 0x36, 0x01, 0x00, 0x00, 0x74, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x8e, // ...6...t........
+	0x00, 0x05, 0x00, 0x18, 0x00, 0x00, 0x00, 0x37, 0x01, 0x00, 0x00, 0x1e, 0x01, 0x00, 0x00, 0x36, // .......7.......6
+	0x01, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00, 0x18, 0x00, 0x00, 0x00, 0x38, 0x01, 0x00, 0x00, 0x33, // ...........8...3
+	0x01, 0x00, 0x00, 0x37, 0x01, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0x3b, // ...7...Q.......;
+	0x01, 0x00, 0x00, 0x74, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x05, 0x00, 0x18, // ...t............
+	0x00, 0x00, 0x00, 0x3c, 0x01, 0x00, 0x00, 0x11, 0x01, 0x00, 0x00, 0x3b, 0x01, 0x00, 0x00, 0x81, // ...<.......;....
+	0x00, 0x05, 0x00, 0x18, 0x00, 0x00, 0x00, 0x3d, 0x01, 0x00, 0x00, 0x38, 0x01, 0x00, 0x00, 0x3c, // .......=...8...<
+	0x01, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0x41, 0x01, 0x00, 0x00, 0x74, // ...Q.......A...t
+	0x01, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x56, 0x00, 0x05, 0x00, 0x55, 0x00, 0x00, 0x00, 0x7a, // .......V...U...z
+	0x01, 0x00, 0x00, 0x37, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x00, 0x58, 0x00, 0x07, 0x00, 0x0e, // ...7...4...X....
+	0x00, 0x00, 0x00, 0x7d, 0x01, 0x00, 0x00, 0x7a, 0x01, 0x00, 0x00, 0x3d, 0x01, 0x00, 0x00, 0x02, // ...}...z...=....
+	0x00, 0x00, 0x00, 0x41, 0x01, 0x00, 0x00, 0x4f, 0x00, 0x08, 0x00, 0x18, 0x00, 0x00, 0x00, 0x43, // ...A...O.......C
+	0x01, 0x00, 0x00, 0x7d, 0x01, 0x00, 0x00, 0x7d, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, // ...}...}........
+	0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0x45, // .......Q.......E
+	0x01, 0x00, 0x00, 0x74, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x05, 0x00, 0x18, // ...t............
+	0x00, 0x00, 0x00, 0x46, 0x01, 0x00, 0x00, 0x43, 0x01, 0x00, 0x00, 0x45, 0x01, 0x00, 0x00, 0x81, // ...F...C...E....
+	0x00, 0x05, 0x00, 0x18, 0x00, 0x00, 0x00, 0x48, 0x01, 0x00, 0x00, 0x90, 0x01, 0x00, 0x00, 0x46, // .......H.......F
+	0x01, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0x4a, 0x01, 0x00, 0x00, 0x74, // ...Q.......J...t
+	0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x81, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0x4c, // ...............L
+	0x01, 0x00, 0x00, 0x91, 0x01, 0x00, 0x00, 0x4a, 0x01, 0x00, 0x00, 0x80, 0x00, 0x05, 0x00, 0x24, // .......J.......$
+	0x00, 0x00, 0x00, 0x4e, 0x01, 0x00, 0x00, 0x8f, 0x01, 0x00, 0x00, 0x41, 0x00, 0x00, 0x00, 0xf9, // ...N.......A....
+	0x00, 0x02, 0x00, 0x22, 0x01, 0x00, 0x00, 0xf8, 0x00, 0x02, 0x00, 0x23, 0x01, 0x00, 0x00, 0x50, // ...".......#...P
+	0x00, 0x06, 0x00, 0x18, 0x00, 0x00, 0x00, 0x51, 0x01, 0x00, 0x00, 0x91, 0x01, 0x00, 0x00, 0x91, // .......Q........
+	0x01, 0x00, 0x00, 0x91, 0x01, 0x00, 0x00, 0x88, 0x00, 0x05, 0x00, 0x18, 0x00, 0x00, 0x00, 0x52, // ...............R
+	0x01, 0x00, 0x00, 0x90, 0x01, 0x00, 0x00, 0x51, 0x01, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x07, // .......Q...Q....
+	0x00, 0x00, 0x00, 0x53, 0x01, 0x00, 0x00, 0x52, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, // ...S...R.......Q
+	0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0x54, 0x01, 0x00, 0x00, 0x52, 0x01, 0x00, 0x00, 0x01, // .......T...R....
+	0x00, 0x00, 0x00, 0x51, 0x00, 0x05, 0x00, 0x07, 0x00, 0x00, 0x00, 0x55, 0x01, 0x00, 0x00, 0x52, // ...Q.......U...R
+	0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x50, 0x00, 0x07, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x56, // .......P.......V
+	0x01, 0x00, 0x00, 0x53, 0x01, 0x00, 0x00, 0x54, 0x01, 0x00, 0x00, 0x55, 0x01, 0x00, 0x00, 0x8a, // ...S...T...U....
+	0x00, 0x00, 0x00, 0x3e, 0x00, 0x03, 0x00, 0xeb, 0x00, 0x00, 0x00, 0x56, 0x01, 0x00, 0x00, 0xfd, // ...>.......V....
+	0x00, 0x01, 0x00, 0x38, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00,                               // ...8.......
+};
+
+static const uint8_t prefilter_shader_fragment_mtl[1712] =
+{
+	0x46, 0x53, 0x48, 0x06, 0x70, 0x94, 0x72, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x0a, 0x75, // FSH.p.r........u
+	0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, 0x12, 0x01, 0x00, 0x00, 0x01, 0x00, 0x09, // _settings.......
+	0x73, 0x5f, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, // s_texture.......
+	0x73, 0x5f, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x73, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, // s_samples......i
+	0x06, 0x00, 0x00, 0x23, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x20, 0x3c, 0x6d, 0x65, 0x74, // ...#include <met
+	0x61, 0x6c, 0x5f, 0x73, 0x74, 0x64, 0x6c, 0x69, 0x62, 0x3e, 0x0a, 0x23, 0x69, 0x6e, 0x63, 0x6c, // al_stdlib>.#incl
+	0x75, 0x64, 0x65, 0x20, 0x3c, 0x73, 0x69, 0x6d, 0x64, 0x2f, 0x73, 0x69, 0x6d, 0x64, 0x2e, 0x68, // ude <simd/simd.h
+	0x3e, 0x0a, 0x0a, 0x75, 0x73, 0x69, 0x6e, 0x67, 0x20, 0x6e, 0x61, 0x6d, 0x65, 0x73, 0x70, 0x61, // >..using namespa
+	0x63, 0x65, 0x20, 0x6d, 0x65, 0x74, 0x61, 0x6c, 0x3b, 0x0a, 0x0a, 0x73, 0x74, 0x72, 0x75, 0x63, // ce metal;..struc
+	0x74, 0x20, 0x5f, 0x47, 0x6c, 0x6f, 0x62, 0x61, 0x6c, 0x0a, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, // t _Global.{.    
+	0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x20, 0x75, 0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, // float4 u_setting
+	0x73, 0x3b, 0x0a, 0x7d, 0x3b, 0x0a, 0x0a, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x20, 0x78, 0x6c, // s;.};..struct xl
+	0x61, 0x74, 0x4d, 0x74, 0x6c, 0x4d, 0x61, 0x69, 0x6e, 0x5f, 0x6f, 0x75, 0x74, 0x0a, 0x7b, 0x0a, // atMtlMain_out.{.
+	0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x20, 0x62, 0x67, 0x66, 0x78, 0x5f, //     float4 bgfx_
+	0x46, 0x72, 0x61, 0x67, 0x44, 0x61, 0x74, 0x61, 0x30, 0x20, 0x5b, 0x5b, 0x63, 0x6f, 0x6c, 0x6f, // FragData0 [[colo
+	0x72, 0x28, 0x30, 0x29, 0x5d, 0x5d, 0x3b, 0x0a, 0x7d, 0x3b, 0x0a, 0x0a, 0x73, 0x74, 0x72, 0x75, // r(0)]];.};..stru
+	0x63, 0x74, 0x20, 0x78, 0x6c, 0x61, 0x74, 0x4d, 0x74, 0x6c, 0x4d, 0x61, 0x69, 0x6e, 0x5f, 0x69, // ct xlatMtlMain_i
+	0x6e, 0x0a, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x20, 0x76, // n.{.    float3 v
+	0x5f, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x5b, 0x5b, 0x75, 0x73, 0x65, 0x72, // _position [[user
+	0x28, 0x6c, 0x6f, 0x63, 0x6e, 0x30, 0x29, 0x5d, 0x5d, 0x3b, 0x0a, 0x7d, 0x3b, 0x0a, 0x0a, 0x66, // (locn0)]];.};..f
+	0x72, 0x61, 0x67, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x78, 0x6c, 0x61, 0x74, 0x4d, 0x74, 0x6c, 0x4d, // ragment xlatMtlM
+	0x61, 0x69, 0x6e, 0x5f, 0x6f, 0x75, 0x74, 0x20, 0x78, 0x6c, 0x61, 0x74, 0x4d, 0x74, 0x6c, 0x4d, // ain_out xlatMtlM
+	0x61, 0x69, 0x6e, 0x28, 0x78, 0x6c, 0x61, 0x74, 0x4d, 0x74, 0x6c, 0x4d, 0x61, 0x69, 0x6e, 0x5f, // ain(xlatMtlMain_
+	0x69, 0x6e, 0x20, 0x69, 0x6e, 0x20, 0x5b, 0x5b, 0x73, 0x74, 0x61, 0x67, 0x65, 0x5f, 0x69, 0x6e, // in in [[stage_in
+	0x5d, 0x5d, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x61, 0x6e, 0x74, 0x20, 0x5f, 0x47, 0x6c, // ]], constant _Gl
+	0x6f, 0x62, 0x61, 0x6c, 0x26, 0x20, 0x5f, 0x6d, 0x74, 0x6c, 0x5f, 0x75, 0x20, 0x5b, 0x5b, 0x62, // obal& _mtl_u [[b
+	0x75, 0x66, 0x66, 0x65, 0x72, 0x28, 0x30, 0x29, 0x5d, 0x5d, 0x2c, 0x20, 0x74, 0x65, 0x78, 0x74, // uffer(0)]], text
+	0x75, 0x72, 0x65, 0x63, 0x75, 0x62, 0x65, 0x3c, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x3e, 0x20, 0x73, // urecube<float> s
+	0x5f, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x20, 0x5b, 0x5b, 0x74, 0x65, 0x78, 0x74, 0x75, // _texture [[textu
+	0x72, 0x65, 0x28, 0x30, 0x29, 0x5d, 0x5d, 0x2c, 0x20, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, // re(0)]], texture
+	0x32, 0x64, 0x3c, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x3e, 0x20, 0x73, 0x5f, 0x73, 0x61, 0x6d, 0x70, // 2d<float> s_samp
+	0x6c, 0x65, 0x73, 0x20, 0x5b, 0x5b, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x28, 0x32, 0x29, // les [[texture(2)
+	0x5d, 0x5d, 0x2c, 0x20, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x72, 0x20, 0x73, 0x5f, 0x74, 0x65, // ]], sampler s_te
+	0x78, 0x74, 0x75, 0x72, 0x65, 0x53, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x72, 0x20, 0x5b, 0x5b, 0x73, // xtureSampler [[s
+	0x61, 0x6d, 0x70, 0x6c, 0x65, 0x72, 0x28, 0x30, 0x29, 0x5d, 0x5d, 0x2c, 0x20, 0x73, 0x61, 0x6d, // ampler(0)]], sam
+	0x70, 0x6c, 0x65, 0x72, 0x20, 0x73, 0x5f, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x73, 0x53, 0x61, // pler s_samplesSa
+	0x6d, 0x70, 0x6c, 0x65, 0x72, 0x20, 0x5b, 0x5b, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x72, 0x28, // mpler [[sampler(
+	0x32, 0x29, 0x5d, 0x5d, 0x29, 0x0a, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x78, 0x6c, 0x61, 0x74, // 2)]]).{.    xlat
+	0x4d, 0x74, 0x6c, 0x4d, 0x61, 0x69, 0x6e, 0x5f, 0x6f, 0x75, 0x74, 0x20, 0x6f, 0x75, 0x74, 0x20, // MtlMain_out out 
+	0x3d, 0x20, 0x7b, 0x7d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, // = {};.    float3
+	0x20, 0x5f, 0x32, 0x37, 0x37, 0x20, 0x3d, 0x20, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, //  _277 = normaliz
+	0x65, 0x28, 0x69, 0x6e, 0x2e, 0x76, 0x5f, 0x70, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x29, // e(in.v_position)
+	0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6f, 0x6f, 0x6c, 0x33, 0x20, 0x5f, 0x32, 0x38, 0x32, // ;.    bool3 _282
+	0x20, 0x3d, 0x20, 0x62, 0x6f, 0x6f, 0x6c, 0x33, 0x28, 0x61, 0x62, 0x73, 0x28, 0x5f, 0x32, 0x37, //  = bool3(abs(_27
+	0x37, 0x2e, 0x7a, 0x29, 0x20, 0x3c, 0x20, 0x30, 0x2e, 0x39, 0x39, 0x39, 0x30, 0x30, 0x30, 0x30, // 7.z) < 0.9990000
+	0x31, 0x32, 0x38, 0x37, 0x34, 0x36, 0x30, 0x33, 0x32, 0x37, 0x31, 0x34, 0x38, 0x34, 0x33, 0x37, // 1287460327148437
+	0x35, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x20, 0x5f, // 5);.    float3 _
+	0x32, 0x38, 0x37, 0x20, 0x3d, 0x20, 0x6e, 0x6f, 0x72, 0x6d, 0x61, 0x6c, 0x69, 0x7a, 0x65, 0x28, // 287 = normalize(
+	0x63, 0x72, 0x6f, 0x73, 0x73, 0x28, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x28, 0x5f, 0x32, 0x38, // cross(float3(_28
+	0x32, 0x2e, 0x78, 0x20, 0x3f, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x28, 0x30, 0x2e, 0x30, // 2.x ? float3(0.0
+	0x2c, 0x20, 0x30, 0x2e, 0x30, 0x2c, 0x20, 0x31, 0x2e, 0x30, 0x29, 0x2e, 0x78, 0x20, 0x3a, 0x20, // , 0.0, 1.0).x : 
+	0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x28, 0x31, 0x2e, 0x30, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x2c, // float3(1.0, 0.0,
+	0x20, 0x30, 0x2e, 0x30, 0x29, 0x2e, 0x78, 0x2c, 0x20, 0x5f, 0x32, 0x38, 0x32, 0x2e, 0x79, 0x20, //  0.0).x, _282.y 
+	0x3f, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x28, 0x30, 0x2e, 0x30, 0x2c, 0x20, 0x30, 0x2e, // ? float3(0.0, 0.
+	0x30, 0x2c, 0x20, 0x31, 0x2e, 0x30, 0x29, 0x2e, 0x79, 0x20, 0x3a, 0x20, 0x66, 0x6c, 0x6f, 0x61, // 0, 1.0).y : floa
+	0x74, 0x33, 0x28, 0x31, 0x2e, 0x30, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x2c, 0x20, 0x30, 0x2e, 0x30, // t3(1.0, 0.0, 0.0
+	0x29, 0x2e, 0x79, 0x2c, 0x20, 0x5f, 0x32, 0x38, 0x32, 0x2e, 0x7a, 0x20, 0x3f, 0x20, 0x66, 0x6c, // ).y, _282.z ? fl
+	0x6f, 0x61, 0x74, 0x33, 0x28, 0x30, 0x2e, 0x30, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x2c, 0x20, 0x31, // oat3(0.0, 0.0, 1
+	0x2e, 0x30, 0x29, 0x2e, 0x7a, 0x20, 0x3a, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x28, 0x31, // .0).z : float3(1
+	0x2e, 0x30, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x29, 0x2e, 0x7a, 0x29, // .0, 0.0, 0.0).z)
+	0x2c, 0x20, 0x5f, 0x32, 0x37, 0x37, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, // , _277));.    fl
+	0x6f, 0x61, 0x74, 0x33, 0x20, 0x5f, 0x34, 0x31, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, // oat3 _411;.    f
+	0x6c, 0x6f, 0x61, 0x74, 0x20, 0x5f, 0x34, 0x31, 0x32, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x5f, // loat _412;.    _
+	0x34, 0x31, 0x32, 0x20, 0x3d, 0x20, 0x30, 0x2e, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x5f, // 412 = 0.0;.    _
+	0x34, 0x31, 0x31, 0x20, 0x3d, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x28, 0x30, 0x2e, 0x30, // 411 = float3(0.0
+	0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x20, 0x5f, 0x33, // );.    float3 _3
+	0x32, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x20, 0x5f, // 21;.    float4 _
+	0x33, 0x38, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x20, // 380;.    float3 
+	0x5f, 0x34, 0x30, 0x34, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x69, // _404;.    for (i
+	0x6e, 0x74, 0x20, 0x5f, 0x34, 0x31, 0x30, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x20, 0x5f, 0x34, 0x31, // nt _410 = 0; _41
+	0x30, 0x20, 0x3c, 0x20, 0x31, 0x30, 0x32, 0x34, 0x3b, 0x20, 0x5f, 0x33, 0x38, 0x30, 0x20, 0x3d, // 0 < 1024; _380 =
+	0x20, 0x73, 0x5f, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x73, 0x2e, 0x73, 0x61, 0x6d, 0x70, 0x6c, //  s_samples.sampl
+	0x65, 0x28, 0x73, 0x5f, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x73, 0x53, 0x61, 0x6d, 0x70, 0x6c, // e(s_samplesSampl
+	0x65, 0x72, 0x2c, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x32, 0x28, 0x28, 0x66, 0x6c, 0x6f, 0x61, // er, float2((floa
+	0x74, 0x28, 0x5f, 0x34, 0x31, 0x30, 0x29, 0x20, 0x2b, 0x20, 0x30, 0x2e, 0x35, 0x29, 0x20, 0x2a, // t(_410) + 0.5) *
+	0x20, 0x30, 0x2e, 0x30, 0x30, 0x30, 0x39, 0x37, 0x36, 0x35, 0x36, 0x32, 0x35, 0x2c, 0x20, 0x5f, //  0.0009765625, _
+	0x6d, 0x74, 0x6c, 0x5f, 0x75, 0x2e, 0x75, 0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6e, 0x67, 0x73, // mtl_u.u_settings
+	0x2e, 0x78, 0x29, 0x2c, 0x20, 0x6c, 0x65, 0x76, 0x65, 0x6c, 0x28, 0x30, 0x2e, 0x30, 0x29, 0x29, // .x), level(0.0))
+	0x2c, 0x20, 0x5f, 0x33, 0x32, 0x31, 0x20, 0x3d, 0x20, 0x28, 0x28, 0x5f, 0x32, 0x38, 0x37, 0x20, // , _321 = ((_287 
+	0x2a, 0x20, 0x5f, 0x33, 0x38, 0x30, 0x2e, 0x78, 0x29, 0x20, 0x2b, 0x20, 0x28, 0x63, 0x72, 0x6f, // * _380.x) + (cro
+	0x73, 0x73, 0x28, 0x5f, 0x32, 0x37, 0x37, 0x2c, 0x20, 0x5f, 0x32, 0x38, 0x37, 0x29, 0x20, 0x2a, // ss(_277, _287) *
+	0x20, 0x5f, 0x33, 0x38, 0x30, 0x2e, 0x79, 0x29, 0x29, 0x20, 0x2b, 0x20, 0x28, 0x5f, 0x32, 0x37, //  _380.y)) + (_27
+	0x37, 0x20, 0x2a, 0x20, 0x5f, 0x33, 0x38, 0x30, 0x2e, 0x7a, 0x29, 0x2c, 0x20, 0x5f, 0x34, 0x30, // 7 * _380.z), _40
+	0x34, 0x20, 0x3d, 0x20, 0x5f, 0x33, 0x32, 0x31, 0x2c, 0x20, 0x5f, 0x34, 0x30, 0x34, 0x2e, 0x79, // 4 = _321, _404.y
+	0x20, 0x3d, 0x20, 0x2d, 0x5f, 0x33, 0x32, 0x31, 0x2e, 0x79, 0x2c, 0x20, 0x5f, 0x34, 0x31, 0x32, //  = -_321.y, _412
+	0x20, 0x2b, 0x3d, 0x20, 0x5f, 0x33, 0x38, 0x30, 0x2e, 0x7a, 0x2c, 0x20, 0x5f, 0x34, 0x31, 0x31, //  += _380.z, _411
+	0x20, 0x2b, 0x3d, 0x20, 0x28, 0x73, 0x5f, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x2e, 0x73, //  += (s_texture.s
+	0x61, 0x6d, 0x70, 0x6c, 0x65, 0x28, 0x73, 0x5f, 0x74, 0x65, 0x78, 0x74, 0x75, 0x72, 0x65, 0x53, // ample(s_textureS
+	0x61, 0x6d, 0x70, 0x6c, 0x65, 0x72, 0x2c, 0x20, 0x5f, 0x34, 0x30, 0x34, 0x2c, 0x20, 0x6c, 0x65, // ampler, _404, le
+	0x76, 0x65, 0x6c, 0x28, 0x5f, 0x33, 0x38, 0x30, 0x2e, 0x77, 0x29, 0x29, 0x2e, 0x78, 0x79, 0x7a, // vel(_380.w)).xyz
+	0x20, 0x2a, 0x20, 0x5f, 0x33, 0x38, 0x30, 0x2e, 0x7a, 0x29, 0x2c, 0x20, 0x5f, 0x34, 0x31, 0x30, //  * _380.z), _410
+	0x2b, 0x2b, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // ++).    {.      
+	0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x5f, 0x34, 0x31, 0x30, 0x20, 0x3e, 0x3d, 0x20, 0x69, 0x6e, //   if (_410 >= in
+	0x74, 0x28, 0x5f, 0x6d, 0x74, 0x6c, 0x5f, 0x75, 0x2e, 0x75, 0x5f, 0x73, 0x65, 0x74, 0x74, 0x69, // t(_mtl_u.u_setti
+	0x6e, 0x67, 0x73, 0x2e, 0x79, 0x29, 0x29, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, // ngs.y)).        
+	0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x72, // {.            br
+	0x65, 0x61, 0x6b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, // eak;.        }. 
+	0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x0a, 0x20, 0x20, 0x20, 0x20, //        else.    
+	0x20, 0x20, 0x20, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, //     {.          
+	0x20, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x69, 0x6e, 0x75, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, //   continue;.    
+	0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6f, //     }.        co
+	0x6e, 0x74, 0x69, 0x6e, 0x75, 0x65, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, // ntinue;.    }.  
+	0x20, 0x20, 0x6f, 0x75, 0x74, 0x2e, 0x62, 0x67, 0x66, 0x78, 0x5f, 0x46, 0x72, 0x61, 0x67, 0x44, //   out.bgfx_FragD
+	0x61, 0x74, 0x61, 0x30, 0x20, 0x3d, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x34, 0x28, 0x5f, 0x34, // ata0 = float4(_4
+	0x31, 0x31, 0x20, 0x2f, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x33, 0x28, 0x5f, 0x34, 0x31, 0x32, // 11 / float3(_412
+	0x29, 0x2c, 0x20, 0x31, 0x2e, 0x30, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, // ), 1.0);.    ret
+	0x75, 0x72, 0x6e, 0x20, 0x6f, 0x75, 0x74, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a, 0x00, 0x00, 0x10, 0x00, // urn out;.}......
+};
@@ -0,0 +1,194 @@
+#include "probe_array.h"
+#include "atomic_file.h"
+#include "dds_layout.h"
+#include "gpu_layout.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+namespace fs = std::filesystem;
+
+// Slices are copied into the array through a buffer of this size.
+static constexpr size_t PROBE_ARRAY_COPY_BUFFER_SIZE = 1024 * 1024;
+
+// Name of an output in the index, relative to the directory of the index when the output is inside it.
+static std::string get_index_name(const fs::path& index_directory, const std::string& path) {
+    const fs::path file = fs::absolute(path).lexically_normal();
+    const fs::path relative = file.lexically_relative(index_directory);
+    if (relative.empty() || *relative.begin() == "..") {
+        return file.generic_string();
+    }
+    return relative.generic_string();
+}
+
+// Reads the header of a slice, which must be a tightly packed DDS texture with the DX10 header and a single layer.
+static bool read_slice_header(const std::string& path, char (&header)[DDS10_HEADER_SIZE], uint64_t& data_size, std::ostream& log) {
+    std::ifstream stream(path, std::ios::binary);
+    if (!stream || !stream.read(header, sizeof(header)) || std::memcmp(header, "DDS ", 4) != 0 || std::memcmp(header + 84, "DX10", 4) != 0) {
+        log << "Texture compiler error. Probe array supports only DDS textures with the DX10 header, \"" << path << "\" is not one." << std::endl;
+        return false;
+    }
+
+    if (is_gpu_layout(header) || std::max(read_32(header, 140), 1U) != 1) {
+        log << "Texture compiler error. Probe array supports only tightly packed DDS textures with a single layer, \"" << path << "\" is not one." << std::endl;
+        return false;
+    }
+
+    std::error_code error;
+    const uintmax_t file_size = fs::file_size(path, error);
+    if (error || file_size < DDS10_HEADER_SIZE) {
+        log << "Texture compiler error. Failed to read \"" << path << "\" into the probe array." << std::endl;
+        return false;
+    }
+    // Checksums of `--checksums` are left out, they describe the layers of the slice rather than the array.
+    data_size = get_dds_data_size(header, static_cast<size_t>(file_size)) - DDS10_HEADER_SIZE;
+    std::memset(header + 60, 0, 16);
+    return true;
+}
+
+// Writes the slices at `files` into a texture array at `path`, with the header of the first slice and its array size.
+static bool write_array(const std::string& path, const std::vector<std::string>& files, std::ostream& log) {
+    char header[DDS10_HEADER_SIZE];
+    uint64_t data_size = 0;
+    if (!read_slice_header(files.front(), header, data_size, log)) {
+        // Error is printed in `read_slice_header`.
+        return false;
+    }
+
+    // Height, width, mip levels, DXGI format, dimension and cube map flag.
+    static const size_t COMPARED_OFFSETS[] = { 12, 16, 28, 128, 132, 136 };
+    for (size_t i = 1; i < files.size(); i++) {
+        char other_header[DDS10_HEADER_SIZE];
+        uint64_t other_data_size = 0;
+        if (!read_slice_header(files[i], other_header, other_data_size, log)) {
+            // Error is printed in `read_slice_header`.
+            return false;
+        }
+
+        const bool is_matching = std::all_of(std::begin(COMPARED_OFFSETS), std::end(COMPARED_OFFSETS), [&](size_t offset) {
+            return read_32(header, offset) == read_32(other_header, offset);
+        });
+        if (!is_matching || other_data_size != data_size) {
+            log << "Texture compiler error. Probe array slices must have the same format, size and mip levels, \"" << files[i] << "\" differs from \"" << files.front() << "\"." << std::endl;
+            return false;
+        }
+    }
+
+    const uint32_t array_size = static_cast<uint32_t>(files.size());
+    std::memcpy(header + 140, &array_size, sizeof(array_size));
+
+    const std::string temporary_path = get_temporary_path(path);
+    {
+        std::ofstream stream(temporary_path, std::ios::binary);
+        stream.write(header, sizeof(header));
+
+        // Slices of DDS arrays follow each other with all their faces and mip levels, like they are in their files.
+        std::vector<char> buffer(PROBE_ARRAY_COPY_BUFFER_SIZE);
+        for (const std::string& file : files) {
+            std::ifstream input(file, std::ios::binary);
+            input.seekg(static_cast<std::streamoff>(DDS10_HEADER_SIZE));
+
+            uint64_t remaining = data_size;
+            while (remaining > 0 && input && stream) {
+                const size_t size = static_cast<size_t>(std::min<uint64_t>(remaining, buffer.size()));
+                if (!input.read(buffer.data(), static_cast<std::streamsize>(size))) {
+                    break;
+                }
+                stream.write(buffer.data(), static_cast<std::streamsize>(size));
+                remaining -= size;
+            }
+
+            if (remaining != 0) {
+                log << "Texture compiler error. Failed to read \"" << file << "\" into the probe array." << std::endl;
+                stream.close();
+                std::remove(temporary_path.c_str());
+                return false;
+            }
+        }
+
+        stream.close();
+        if (!stream) {
+            log << "Texture compiler error. Failed to write the probe array." << std::endl;
+            std::remove(temporary_path.c_str());
+            return false;
+        }
+    }
+
+    if (!replace_file(temporary_path, path)) {
+        log << "Texture compiler error. Failed to write the probe array." << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool write_probe_array(const std::string& path, const std::vector<ProbeArrayProbe>& probes, std::ostream& log) {
+    if (probes.empty()) {
+        log << "Texture compiler error. Probe array has no cube map jobs with --irradiance or --prefilter." << std::endl;
+        return false;
+    }
+
+    const bool is_irradiance = !probes.front().irradiance.empty();
+    const bool is_prefilter = !probes.front().prefilter.empty();
+
+    std::vector<std::string> irradiance_files;
+    std::vector<std::string> prefilter_files;
+    for (const ProbeArrayProbe& probe : probes) {
+        if (probe.irradiance.empty() == is_irradiance || probe.prefilter.empty() == is_prefilter) {
+            log << "Texture compiler error. Probe array needs the same outputs of every cube map job, either --irradiance, --prefilter or both." << std::endl;
+            return false;
+        }
+
+        if (is_irradiance) {
+            irradiance_files.push_back(probe.irradiance);
+        }
+        if (is_prefilter) {
+            prefilter_files.push_back(probe.prefilter);
+        }
+    }
+
+    if (is_irradiance && !write_array(path + ".irradiance.dds", irradiance_files, log)) {
+        // Error is printed in `write_array`.
+        return false;
+    }
+
+    if (is_prefilter && !write_array(path + ".prefilter.dds", prefilter_files, log)) {
+        // Error is printed in `write_array`.
+        return false;
+    }
+
+    // The index is written last, so a runtime that finds it finds the arrays it describes.
+    const std::string index_path = path + ".index";
+    const fs::path index_directory = fs::absolute(index_path).lexically_normal().parent_path();
+
+    const std::string temporary_path = get_temporary_path(index_path);
+    {
+        std::ofstream stream(temporary_path, std::ios::binary);
+        for (size_t slice = 0; slice < probes.size(); slice++) {
+            stream << slice;
+            if (is_irradiance) {
+                stream << ' ' << get_index_name(index_directory, probes[slice].irradiance);
+            }
+            if (is_prefilter) {
+                stream << ' ' << get_index_name(index_directory, probes[slice].prefilter);
+            }
+            stream << '\n';
+        }
+
+        stream.close();
+        if (!stream) {
+            log << "Texture compiler error. Failed to write the probe array index." << std::endl;
+            std::remove(temporary_path.c_str());
+            return false;
+        }
+    }
+
+    if (!replace_file(temporary_path, index_path)) {
+        log << "Texture compiler error. Failed to write the probe array index." << std::endl;
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+// Probe arrays, written by `--probe-array`, put the irradiance and prefilter outputs of every cube map job of a manifest
+// into a single DDS texture array each, so a runtime uploads the probes of a level at once instead of opening hundreds
+// of files. Cube map outputs become cube map arrays and `--octahedral` outputs become 2D texture arrays, with slices in
+// the manifest order. For the prefix `<path>` the arrays are `<path>.irradiance.dds` and `<path>.prefilter.dds`, and
+// `<path>.index` is a text file with a line per probe: the slice followed by the names of the irradiance and prefilter
+// outputs of the probe relative to the index with forward slashes, the ones that are in the arrays only.
+
+// Outputs of a probe, empty when the job has none.
+struct ProbeArrayProbe final {
+    std::string irradiance;
+    std::string prefilter;
+};
+
+// Writes the arrays and the index of the given probes, which must all have the same outputs, and outputs of the same
+// kind the same format, size and mip levels. Files are replaced atomically and copied one at a time, so the arrays
+// never need to fit in memory.
+bool write_probe_array(const std::string& path, const std::vector<ProbeArrayProbe>& probes, std::ostream& log);
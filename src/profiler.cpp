@@ -0,0 +1,758 @@
+#include "profiler.h"
+#include "atomic_file.h"
+
+#include <bx/platform.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#if BX_PLATFORM_WINDOWS
+#include <windows.h>
+#include <dbghelp.h>
+#else
+#include <cxxabi.h>
+#include <dlfcn.h>
+#include <errno.h>
+#include <execinfo.h>
+#include <signal.h>
+#include <sys/time.h>
+#if BX_PLATFORM_LINUX
+#include <elf.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+#endif
+
+// Sampling period, in CPU time on POSIX and in wall time on Windows.
+static constexpr int SAMPLE_PERIOD_MICROSECONDS = 1000;
+
+// Deepest stack that is recorded, deeper stacks lose their outermost frames.
+static constexpr size_t MAX_FRAME_COUNT = 64;
+
+// Phases a thread can be in at the same time. Deeper phases tag samples with the deepest one that fits.
+static constexpr uint32_t MAX_STAGE_DEPTH = 16;
+
+// Tag of a thread, read by the sampler while the thread is interrupted or suspended, so every change of it is written
+// before it's published by the count or the job.
+struct ThreadTag final {
+    volatile uint32_t job = 0;
+    volatile uint32_t stage_count = 0;
+    const char* volatile stages[MAX_STAGE_DEPTH] = {};
+};
+
+static thread_local ThreadTag thread_tag;
+
+static std::atomic<bool> is_profiling { false };
+
+// Names of the jobs by their tags, starting at 1. Tag 0 is no job.
+static std::mutex job_mutex;
+static std::vector<std::string> job_names;
+
+// Names of the phases, which tags point to, since the names phases are created with may be temporary.
+static std::mutex stage_mutex;
+static std::unordered_set<std::string> stage_names;
+
+// A recorded stack, its frames innermost first.
+struct Sample final {
+    uint32_t job = 0;
+    const char* stage = nullptr;
+    uint32_t frame_count = 0;
+    void* frames[MAX_FRAME_COUNT];
+};
+
+struct SampleKey final {
+    uint32_t job;
+    const char* stage;
+    std::vector<void*> frames;
+
+    bool operator<(const SampleKey& other) const noexcept {
+        return std::tie(job, stage, frames) < std::tie(other.job, other.stage, other.frames);
+    }
+};
+
+// Samples by stack, filled by the thread that collects them and read once it's stopped.
+static std::map<SampleKey, uint64_t> sample_counts;
+static uint64_t lost_sample_count = 0;
+
+static std::thread collector;
+static std::atomic<bool> is_collecting { false };
+
+static void add_sample(const Sample& sample, size_t skipped_frame_count) {
+    if (sample.frame_count <= skipped_frame_count) {
+        return;
+    }
+    SampleKey key { sample.job, sample.stage, std::vector<void*>(sample.frames + skipped_frame_count, sample.frames + sample.frame_count) };
+    sample_counts[std::move(key)]++;
+}
+
+static void push_stage(const char* stage) noexcept {
+    const uint32_t count = thread_tag.stage_count;
+    if (count < MAX_STAGE_DEPTH) {
+        thread_tag.stages[count] = stage;
+        std::atomic_signal_fence(std::memory_order_release);
+        thread_tag.stage_count = count + 1;
+    }
+}
+
+// Phases of pool tasks stop in any order, so the latest entry of the phase is removed wherever it is.
+static void pop_stage(const char* stage) noexcept {
+    const uint32_t count = thread_tag.stage_count;
+    for (uint32_t index = count; index-- > 0;) {
+        if (thread_tag.stages[index] == stage) {
+            for (uint32_t next = index + 1; next < count; next++) {
+                thread_tag.stages[next - 1] = thread_tag.stages[next];
+            }
+            std::atomic_signal_fence(std::memory_order_release);
+            thread_tag.stage_count = count - 1;
+            return;
+        }
+    }
+}
+
+static const char* get_top_stage(const ThreadTag& tag) noexcept {
+    const uint32_t count = tag.stage_count;
+    std::atomic_signal_fence(std::memory_order_acquire);
+    return count != 0 ? tag.stages[std::min(count, MAX_STAGE_DEPTH) - 1] : nullptr;
+}
+
+#if BX_PLATFORM_WINDOWS && defined(_M_X64)
+
+// Threads that have been tagged, which are the threads the sampler suspends. Other threads, like the ones of the
+// renderer, are not sampled on Windows.
+struct SampledThread final {
+    HANDLE handle;
+    ThreadTag* tag;
+    ULONG64 cycles;
+};
+
+static std::mutex thread_mutex;
+static std::vector<SampledThread> sampled_threads;
+static thread_local bool is_thread_registered = false;
+
+static void register_thread() noexcept {
+    if (is_thread_registered || !is_profiling.load(std::memory_order_relaxed)) {
+        return;
+    }
+    is_thread_registered = true;
+
+    HANDLE handle = nullptr;
+    if (!DuplicateHandle(GetCurrentProcess(), GetCurrentThread(), GetCurrentProcess(), &handle, THREAD_SUSPEND_RESUME | THREAD_GET_CONTEXT | THREAD_QUERY_INFORMATION | SYNCHRONIZE, FALSE, 0)) {
+        return;
+    }
+    try {
+        std::lock_guard<std::mutex> lock(thread_mutex);
+        sampled_threads.push_back(SampledThread { handle, &thread_tag, 0 });
+    } catch (...) {
+        CloseHandle(handle);
+    }
+}
+
+// Walks the stack of a suspended thread with the unwind data of its modules. Nothing here may allocate or lock, the
+// suspended thread may hold the lock of the heap.
+static uint32_t walk_stack(CONTEXT context, void** frames) noexcept {
+    uint32_t count = 0;
+    while (count < MAX_FRAME_COUNT && context.Rip != 0) {
+        frames[count++] = reinterpret_cast<void*>(context.Rip);
+
+        DWORD64 image_base = 0;
+        PRUNTIME_FUNCTION function = RtlLookupFunctionEntry(context.Rip, &image_base, nullptr);
+        if (function == nullptr) {
+            // A leaf function, whose return address is on the top of the stack.
+            context.Rip = *reinterpret_cast<const DWORD64*>(context.Rsp);
+            context.Rsp += sizeof(DWORD64);
+        } else {
+            void* handler_data = nullptr;
+            DWORD64 establisher_frame = 0;
+            RtlVirtualUnwind(UNW_FLAG_NHANDLER, image_base, context.Rip, function, &context, &handler_data, &establisher_frame, nullptr);
+        }
+    }
+    return count;
+}
+
+static void collect_samples() {
+    const DWORD collector_id = GetCurrentThreadId();
+    Sample sample;
+    while (is_collecting.load(std::memory_order_relaxed)) {
+        Sleep(SAMPLE_PERIOD_MICROSECONDS / 1000);
+
+        std::lock_guard<std::mutex> lock(thread_mutex);
+        for (SampledThread& thread : sampled_threads) {
+            if (GetThreadId(thread.handle) == collector_id || WaitForSingleObject(thread.handle, 0) != WAIT_TIMEOUT) {
+                continue;
+            }
+
+            // Only threads that ran since the last sample are sampled, like the CPU time of `SIGPROF` on POSIX.
+            ULONG64 cycles = 0;
+            if (!QueryThreadCycleTime(thread.handle, &cycles) || cycles == thread.cycles) {
+                continue;
+            }
+            thread.cycles = cycles;
+
+            if (SuspendThread(thread.handle) == static_cast<DWORD>(-1)) {
+                continue;
+            }
+            CONTEXT context = {};
+            context.ContextFlags = CONTEXT_FULL;
+            if (GetThreadContext(thread.handle, &context)) {
+                sample.job = thread.tag->job;
+                sample.stage = get_top_stage(*thread.tag);
+                sample.frame_count = walk_stack(context, sample.frames);
+            } else {
+                sample.frame_count = 0;
+            }
+            ResumeThread(thread.handle);
+
+            try {
+                add_sample(sample, 0);
+            } catch (...) {
+                lost_sample_count++;
+            }
+        }
+    }
+}
+
+static bool start_sampling(std::ostream& log) noexcept {
+    SymSetOptions(SYMOPT_UNDNAME | SYMOPT_DEFERRED_LOADS);
+    if (!SymInitialize(GetCurrentProcess(), nullptr, TRUE)) {
+        log << "Texture compiler error. Failed to load the symbols of the process for the profiler." << std::endl;
+        return false;
+    }
+    register_thread();
+    return true;
+}
+
+static void stop_sampling() noexcept {
+    std::lock_guard<std::mutex> lock(thread_mutex);
+    for (const SampledThread& thread : sampled_threads) {
+        CloseHandle(thread.handle);
+    }
+    sampled_threads.clear();
+}
+
+static std::string get_frame_name(void* address) {
+    alignas(SYMBOL_INFO) char buffer[sizeof(SYMBOL_INFO) + MAX_SYM_NAME];
+    SYMBOL_INFO* symbol = reinterpret_cast<SYMBOL_INFO*>(buffer);
+    symbol->SizeOfStruct = sizeof(SYMBOL_INFO);
+    symbol->MaxNameLen = MAX_SYM_NAME;
+    const DWORD64 value = reinterpret_cast<DWORD64>(address);
+    DWORD64 displacement = 0;
+    if (SymFromAddr(GetCurrentProcess(), value, &displacement, symbol)) {
+        return std::string(symbol->Name, symbol->NameLen);
+    }
+
+    IMAGEHLP_MODULE64 module = {};
+    module.SizeOfStruct = sizeof(module);
+    char name[64];
+    if (SymGetModuleInfo64(GetCurrentProcess(), value, &module)) {
+        std::snprintf(name, sizeof(name), "+0x%" PRIx64, static_cast<uint64_t>(value - module.BaseOfImage));
+        return module.ModuleName + std::string(name);
+    }
+    std::snprintf(name, sizeof(name), "0x%" PRIx64, static_cast<uint64_t>(value));
+    return name;
+}
+
+static void finish_symbols() noexcept {
+    SymCleanup(GetCurrentProcess());
+}
+
+#elif BX_PLATFORM_WINDOWS
+
+static void register_thread() noexcept {
+}
+
+static void collect_samples() {
+}
+
+static bool start_sampling(std::ostream& log) noexcept {
+    log << "Texture compiler error. The profiler only supports x64 on Windows." << std::endl;
+    return false;
+}
+
+static void stop_sampling() noexcept {
+}
+
+static std::string get_frame_name(void* address) {
+    char name[32];
+    std::snprintf(name, sizeof(name), "0x%" PRIxPTR, reinterpret_cast<uintptr_t>(address));
+    return name;
+}
+
+static void finish_symbols() noexcept {
+}
+
+#else
+
+static void register_thread() noexcept {
+}
+
+// Ring of samples the signal handler fills and the collector empties. A sample is dropped when its slot hasn't been
+// collected yet, which takes the whole ring to be filled within one collection period.
+static constexpr size_t SAMPLE_SLOT_COUNT = 4096;
+
+enum SlotState : uint32_t {
+    SLOT_FREE,
+    SLOT_WRITING,
+    SLOT_READY,
+};
+
+struct SampleSlot final {
+    std::atomic<uint32_t> state { SLOT_FREE };
+    Sample sample;
+};
+
+// Allocated once and never freed, since a signal may still be delivered while the profiler stops.
+static SampleSlot* sample_slots = nullptr;
+static std::atomic<size_t> next_slot { 0 };
+static std::atomic<uint64_t> dropped_sample_count { 0 };
+
+// Frames of the signal handler and of the signal trampoline on top of every recorded stack.
+static constexpr size_t HANDLER_FRAME_COUNT = 2;
+
+static void handle_profile_signal(int, siginfo_t*, void*) {
+    const int saved_errno = errno;
+    SampleSlot& slot = sample_slots[next_slot.fetch_add(1, std::memory_order_relaxed) % SAMPLE_SLOT_COUNT];
+    uint32_t expected = SLOT_FREE;
+    if (slot.state.compare_exchange_strong(expected, SLOT_WRITING, std::memory_order_acquire)) {
+        slot.sample.job = thread_tag.job;
+        slot.sample.stage = get_top_stage(thread_tag);
+        slot.sample.frame_count = static_cast<uint32_t>(backtrace(slot.sample.frames, static_cast<int>(MAX_FRAME_COUNT)));
+        slot.state.store(SLOT_READY, std::memory_order_release);
+    } else {
+        dropped_sample_count.fetch_add(1, std::memory_order_relaxed);
+    }
+    errno = saved_errno;
+}
+
+static void collect_ready_samples() {
+    for (size_t index = 0; index < SAMPLE_SLOT_COUNT; index++) {
+        SampleSlot& slot = sample_slots[index];
+        if (slot.state.load(std::memory_order_acquire) == SLOT_READY) {
+            try {
+                add_sample(slot.sample, HANDLER_FRAME_COUNT);
+            } catch (...) {
+                lost_sample_count++;
+            }
+            slot.state.store(SLOT_FREE, std::memory_order_release);
+        }
+    }
+}
+
+static void collect_samples() {
+    while (is_collecting.load(std::memory_order_relaxed)) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        collect_ready_samples();
+    }
+}
+
+static bool start_sampling(std::ostream& log) noexcept {
+    if (sample_slots == nullptr) {
+        sample_slots = new (std::nothrow) SampleSlot[SAMPLE_SLOT_COUNT];
+        if (sample_slots == nullptr) {
+            log << "Texture compiler error. Failed to allocate the samples of the profiler." << std::endl;
+            return false;
+        }
+    }
+
+    // The first `backtrace` loads the unwinder, which must not happen in the signal handler.
+    void* frames[1];
+    backtrace(frames, 1);
+
+    struct sigaction action = {};
+    action.sa_sigaction = handle_profile_signal;
+    action.sa_flags = SA_SIGINFO | SA_RESTART;
+    sigemptyset(&action.sa_mask);
+    if (sigaction(SIGPROF, &action, nullptr) != 0) {
+        log << "Texture compiler error. Failed to install the signal handler of the profiler." << std::endl;
+        return false;
+    }
+
+    itimerval timer = {};
+    timer.it_interval.tv_usec = SAMPLE_PERIOD_MICROSECONDS;
+    timer.it_value.tv_usec = SAMPLE_PERIOD_MICROSECONDS;
+    if (setitimer(ITIMER_PROF, &timer, nullptr) != 0) {
+        log << "Texture compiler error. Failed to start the timer of the profiler." << std::endl;
+        signal(SIGPROF, SIG_IGN);
+        return false;
+    }
+    return true;
+}
+
+static void stop_sampling() noexcept {
+    itimerval timer = {};
+    setitimer(ITIMER_PROF, &timer, nullptr);
+    signal(SIGPROF, SIG_IGN);
+}
+
+#if BX_PLATFORM_LINUX
+
+// Function symbols of a module, from its symbol table, which also has the functions the dynamic symbols don't export.
+struct ModuleSymbols final {
+    struct Symbol final {
+        uint64_t address;
+        uint64_t size;
+        std::string name;
+    };
+
+    bool is_position_independent = true;
+    std::vector<Symbol> symbols;
+};
+
+static ModuleSymbols read_module_symbols(const char* path) {
+    ModuleSymbols result;
+    const int file = open(path, O_RDONLY | O_CLOEXEC);
+    if (file < 0) {
+        return result;
+    }
+    struct stat status;
+    void* mapping = MAP_FAILED;
+    if (fstat(file, &status) == 0 && static_cast<size_t>(status.st_size) >= sizeof(Elf64_Ehdr)) {
+        mapping = mmap(nullptr, static_cast<size_t>(status.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+    }
+    close(file);
+    if (mapping == MAP_FAILED) {
+        return result;
+    }
+
+    const size_t size = static_cast<size_t>(status.st_size);
+    const auto* data = static_cast<const uint8_t*>(mapping);
+    const auto* header = reinterpret_cast<const Elf64_Ehdr*>(data);
+    const bool is_valid = std::equal(ELFMAG, ELFMAG + SELFMAG, header->e_ident) && header->e_ident[EI_CLASS] == ELFCLASS64 && header->e_shentsize == sizeof(Elf64_Shdr)
+                          && header->e_shoff <= size && header->e_shnum <= (size - header->e_shoff) / sizeof(Elf64_Shdr);
+    if (is_valid) {
+        result.is_position_independent = header->e_type == ET_DYN;
+        const auto* sections = reinterpret_cast<const Elf64_Shdr*>(data + header->e_shoff);
+
+        // The full symbol table when the module has one, the dynamic symbols otherwise.
+        const Elf64_Shdr* table = nullptr;
+        for (uint32_t index = 0; index < header->e_shnum; index++) {
+            if (sections[index].sh_type == SHT_SYMTAB || (sections[index].sh_type == SHT_DYNSYM && table == nullptr)) {
+                table = &sections[index];
+            }
+        }
+
+        if (table != nullptr && table->sh_link < header->e_shnum && table->sh_offset <= size && table->sh_size <= size - table->sh_offset) {
+            const Elf64_Shdr& strings = sections[table->sh_link];
+            if (strings.sh_offset <= size && strings.sh_size <= size - strings.sh_offset) {
+                const auto* symbols = reinterpret_cast<const Elf64_Sym*>(data + table->sh_offset);
+                const char* names = reinterpret_cast<const char*>(data + strings.sh_offset);
+                for (size_t index = 0; index < table->sh_size / sizeof(Elf64_Sym); index++) {
+                    const Elf64_Sym& symbol = symbols[index];
+                    if (ELF64_ST_TYPE(symbol.st_info) == STT_FUNC && symbol.st_value != 0 && symbol.st_name < strings.sh_size) {
+                        const char* name = names + symbol.st_name;
+                        result.symbols.push_back(ModuleSymbols::Symbol { symbol.st_value, symbol.st_size, std::string(name, strnlen(name, strings.sh_size - symbol.st_name)) });
+                    }
+                }
+            }
+        }
+    }
+    munmap(mapping, size);
+
+    std::sort(result.symbols.begin(), result.symbols.end(), [](const ModuleSymbols::Symbol& a, const ModuleSymbols::Symbol& b) {
+        return a.address < b.address;
+    });
+    return result;
+}
+
+static std::map<std::string, ModuleSymbols> module_symbols;
+
+static const std::string* find_module_symbol(const Dl_info& info, void* address) {
+    auto module = module_symbols.find(info.dli_fname);
+    if (module == module_symbols.end()) {
+        module = module_symbols.emplace(info.dli_fname, read_module_symbols(info.dli_fname)).first;
+    }
+
+    const ModuleSymbols& symbols = module->second;
+    const uint64_t offset = reinterpret_cast<uintptr_t>(address) - (symbols.is_position_independent ? reinterpret_cast<uintptr_t>(info.dli_fbase) : 0);
+    auto symbol = std::upper_bound(symbols.symbols.begin(), symbols.symbols.end(), offset, [](uint64_t value, const ModuleSymbols::Symbol& symbol) {
+        return value < symbol.address;
+    });
+    if (symbol == symbols.symbols.begin()) {
+        return nullptr;
+    }
+    --symbol;
+    return offset < symbol->address + std::max<uint64_t>(symbol->size, 1) ? &symbol->name : nullptr;
+}
+
+static void finish_symbols() noexcept {
+    module_symbols.clear();
+}
+
+#else
+
+static void finish_symbols() noexcept {
+}
+
+#endif
+
+// Demangled name without parameter lists and clone suffixes, like `compile::{lambda#1}::operator()`, so the overloads and
+// clones of a function are one frame and the lines stay readable.
+static std::string demangle(const char* name) {
+    int status = 0;
+    char* demangled = abi::__cxa_demangle(name, nullptr, nullptr, &status);
+    if (demangled == nullptr) {
+        return name;
+    }
+    const std::string full(demangled);
+    std::free(demangled);
+
+    static constexpr const char* ANONYMOUS_NAMESPACE = "(anonymous namespace)";
+    static constexpr const char* CALL_OPERATOR = "operator";
+    static constexpr const char* CLONE_SUFFIX = " [clone ";
+    std::string result;
+    int template_depth = 0;
+    for (size_t index = 0; index < full.size(); index++) {
+        const char character = full[index];
+        // Angle brackets of operators like `operator<<` and `operator->` don't open or close template arguments.
+        const size_t operator_end = result.find_last_not_of("<>=-");
+        const bool is_operator = operator_end != std::string::npos && operator_end + 1 >= std::strlen(CALL_OPERATOR) && result.compare(operator_end + 1 - std::strlen(CALL_OPERATOR), std::strlen(CALL_OPERATOR), CALL_OPERATOR) == 0;
+        if (character == '<' && !is_operator) {
+            template_depth++;
+        } else if (character == '>' && template_depth > 0 && !is_operator) {
+            template_depth--;
+        } else if (character == '(' && template_depth == 0 && full.compare(index, std::strlen(ANONYMOUS_NAMESPACE), ANONYMOUS_NAMESPACE) != 0) {
+            const bool is_call_operator = result.size() >= std::strlen(CALL_OPERATOR) && result.compare(result.size() - std::strlen(CALL_OPERATOR), std::strlen(CALL_OPERATOR), CALL_OPERATOR) == 0;
+            if (is_call_operator && full.compare(index, 2, "()") == 0) {
+                result += "()";
+                index++;
+                continue;
+            }
+
+            // Skips the parameter list.
+            int depth = 0;
+            for (; index < full.size(); index++) {
+                depth += full[index] == '(' ? 1 : full[index] == ')' ? -1 : 0;
+                if (depth == 0) {
+                    break;
+                }
+            }
+            continue;
+        } else if (template_depth == 0 && full.compare(index, std::strlen(CLONE_SUFFIX), CLONE_SUFFIX) == 0) {
+            break;
+        }
+        result += character;
+    }
+    return result;
+}
+
+static std::string get_frame_name(void* address) {
+    Dl_info info = {};
+    char name[64];
+    if (dladdr(address, &info) == 0 || info.dli_fname == nullptr) {
+        std::snprintf(name, sizeof(name), "0x%" PRIxPTR, reinterpret_cast<uintptr_t>(address));
+        return name;
+    }
+
+#if BX_PLATFORM_LINUX
+    if (const std::string* symbol = find_module_symbol(info, address)) {
+        return demangle(symbol->c_str());
+    }
+#endif
+    if (info.dli_sname != nullptr) {
+        return demangle(info.dli_sname);
+    }
+
+    const char* module = std::strrchr(info.dli_fname, '/');
+    std::snprintf(name, sizeof(name), "+0x%" PRIxPTR, reinterpret_cast<uintptr_t>(address) - reinterpret_cast<uintptr_t>(info.dli_fbase));
+    return std::string(module != nullptr ? module + 1 : info.dli_fname) + name;
+}
+
+#endif
+
+bool start_profiler(std::ostream& log) noexcept {
+    if (is_profiling.load()) {
+        return true;
+    }
+
+    is_profiling = true;
+    if (!start_sampling(log)) {
+        is_profiling = false;
+        return false;
+    }
+
+    try {
+        is_collecting = true;
+        collector = std::thread(collect_samples);
+    } catch (...) {
+        is_collecting = false;
+        stop_sampling();
+        is_profiling = false;
+        log << "Texture compiler error. Failed to start the thread of the profiler." << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool stop_profiler(const std::string& path, std::ostream& log) {
+    if (!is_profiling.load()) {
+        return false;
+    }
+
+    stop_sampling();
+    is_collecting = false;
+    collector.join();
+#if !BX_PLATFORM_WINDOWS
+    collect_ready_samples();
+    lost_sample_count += dropped_sample_count.load();
+#endif
+    is_profiling = false;
+
+    // Frames are named once each, return addresses by the call instruction before them, which may be the last
+    // instruction of a function that doesn't return.
+    std::unordered_map<void*, std::string> frame_names;
+    const auto get_name = [&frame_names](void* address, bool is_return_address) -> const std::string& {
+        void* const lookup = is_return_address ? static_cast<char*>(address) - 1 : address;
+        auto name = frame_names.find(lookup);
+        if (name == frame_names.end()) {
+            std::string frame = get_frame_name(lookup);
+            std::replace(frame.begin(), frame.end(), ';', ':');
+            name = frame_names.emplace(lookup, std::move(frame)).first;
+        }
+        return name->second;
+    };
+
+    // Stacks that have the same names, like the same job compiled twice, become one line.
+    std::map<std::string, uint64_t> lines;
+    uint64_t total_count = 0;
+    {
+        std::lock_guard<std::mutex> lock(job_mutex);
+        std::string line;
+        for (const auto& [key, count] : sample_counts) {
+            line.clear();
+            if (key.job != 0 && key.job <= job_names.size()) {
+                line += "job ";
+                line += job_names[key.job - 1];
+                line += ';';
+            }
+            if (key.stage != nullptr) {
+                line += "phase ";
+                line += key.stage;
+                line += ';';
+            }
+            for (size_t index = key.frames.size(); index-- > 0;) {
+                line += get_name(key.frames[index], index != 0);
+                line += index != 0 ? ';' : ' ';
+            }
+            lines[line] += count;
+            total_count += count;
+        }
+    }
+    sample_counts.clear();
+    finish_symbols();
+
+    const std::string temporary_path = get_temporary_path(path);
+    {
+        std::ofstream file(temporary_path, std::ios::binary);
+        for (const auto& [line, count] : lines) {
+            file << line << count << '\n';
+        }
+        file.close();
+        if (!file) {
+            std::remove(temporary_path.c_str());
+            log << "Texture compiler error. Failed to write profile \"" << path << "\"." << std::endl;
+            return false;
+        }
+    }
+    if (!replace_file(temporary_path, path)) {
+        log << "Texture compiler error. Failed to write profile \"" << path << "\"." << std::endl;
+        return false;
+    }
+
+    log << "Profile of " << total_count << " samples written to \"" << path << "\"";
+    if (lost_sample_count != 0) {
+        log << ", " << lost_sample_count << " samples were dropped";
+    }
+    log << "." << std::endl;
+    return true;
+}
+
+ProfileTag get_profile_tag() noexcept {
+    return ProfileTag { thread_tag.job, get_top_stage(thread_tag) };
+}
+
+ProfileJobScope::ProfileJobScope(const std::string& name) noexcept {
+    if (!is_profiling.load(std::memory_order_relaxed)) {
+        return;
+    }
+    register_thread();
+
+    uint32_t job = 0;
+    try {
+        std::lock_guard<std::mutex> lock(job_mutex);
+        job_names.push_back(name);
+        job = static_cast<uint32_t>(job_names.size());
+    } catch (...) {
+        return;
+    }
+    is_set = true;
+    previous_job = thread_tag.job;
+    thread_tag.job = job;
+}
+
+ProfileJobScope::~ProfileJobScope() {
+    if (is_set) {
+        thread_tag.job = previous_job;
+    }
+}
+
+ProfileStageScope::ProfileStageScope(const char* stage) noexcept {
+    if (stage == nullptr || !is_profiling.load(std::memory_order_relaxed) || thread_tag.stage_count >= MAX_STAGE_DEPTH) {
+        return;
+    }
+    try {
+        std::lock_guard<std::mutex> lock(stage_mutex);
+        this->stage = stage_names.emplace(stage).first->c_str();
+    } catch (...) {
+        return;
+    }
+    push_stage(this->stage);
+}
+
+ProfileStageScope::~ProfileStageScope() {
+    stop();
+}
+
+void ProfileStageScope::stop() noexcept {
+    if (stage != nullptr) {
+        pop_stage(stage);
+        stage = nullptr;
+    }
+}
+
+ProfileTaskScope::ProfileTaskScope(const ProfileTag& tag) noexcept {
+    if ((tag.job == 0 && tag.stage == nullptr) || !is_profiling.load(std::memory_order_relaxed)) {
+        return;
+    }
+    register_thread();
+    is_set = true;
+    previous_job = thread_tag.job;
+    thread_tag.job = tag.job;
+    if (tag.stage != nullptr && thread_tag.stage_count < MAX_STAGE_DEPTH) {
+        stage = tag.stage;
+        push_stage(stage);
+    }
+}
+
+ProfileTaskScope::~ProfileTaskScope() {
+    if (stage != nullptr) {
+        pop_stage(stage);
+    }
+    if (is_set) {
+        thread_tag.job = previous_job;
+    }
+}
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+
+// Sampling profiler of `--profile`, for telling where the time of a whole batch goes, inside nvtt, stb_image and the
+// kernels of the compiler alike, without attaching an external profiler to every process of a build farm. On POSIX a
+// profiling timer interrupts the thread that is running with `SIGPROF` about every millisecond of CPU time of the
+// process, or every tick of the kernel where ticks are longer, and the handler records the stack of the interrupted
+// thread. On Windows a sampling thread suspends the threads that compile jobs once a millisecond and walks their
+// stacks. Samples are tagged with the job and the phase the thread works for, which pool tasks inherit from the thread
+// that pushed them, and written as folded stacks for flame graphs, one line per distinct stack with its count:
+//
+//   job <main output>;phase <name>;<outermost frame>;...;<innermost frame> <samples>
+//
+// Frames are named by the dynamic symbols of their module and, on Linux, by the symbol table of the executable, so the
+// static functions of the compiler and of the libraries linked into it have names too. Frames of stripped modules are
+// written as `<module>+0x<offset>`.
+
+// Job and phase a thread works for. `stage` points to the profiler's own copy of the name of the phase.
+struct ProfileTag final {
+    uint32_t job = 0;
+    const char* stage = nullptr;
+};
+
+// Starts sampling every thread of the process. Returns false when sampling can't be started, which is printed to `log`.
+bool start_profiler(std::ostream& log) noexcept;
+
+// Stops sampling and writes the folded stacks to `path`. Returns false when the file can't be written.
+bool stop_profiler(const std::string& path, std::ostream& log);
+
+// Tag of the calling thread, for handing it to a task that runs on another thread.
+ProfileTag get_profile_tag() noexcept;
+
+// Tags the samples of the calling thread with a job from construction to destruction. Does nothing unless the profiler
+// runs.
+struct ProfileJobScope final {
+    explicit ProfileJobScope(const std::string& name) noexcept;
+
+    ProfileJobScope(const ProfileJobScope&) = delete;
+    ProfileJobScope(ProfileJobScope&&) = delete;
+    ProfileJobScope& operator=(const ProfileJobScope&) = delete;
+    ProfileJobScope& operator=(ProfileJobScope&&) = delete;
+
+    ~ProfileJobScope();
+
+private:
+    bool is_set = false;
+    uint32_t previous_job = 0;
+};
+
+// Tags the samples of the calling thread with a phase from construction until `stop` or destruction. Phases of a thread
+// may overlap, the latest one that hasn't stopped tags the samples. The name is copied, it only has to live as long as
+// the constructor runs.
+struct ProfileStageScope final {
+    explicit ProfileStageScope(const char* stage) noexcept;
+
+    ProfileStageScope(const ProfileStageScope&) = delete;
+    ProfileStageScope(ProfileStageScope&&) = delete;
+    ProfileStageScope& operator=(const ProfileStageScope&) = delete;
+    ProfileStageScope& operator=(ProfileStageScope&&) = delete;
+
+    ~ProfileStageScope();
+
+    void stop() noexcept;
+
+private:
+    const char* stage = nullptr;
+};
+
+// Tags the samples of the calling thread with the tag of the thread that pushed the task it runs, see `ThreadPool`.
+struct ProfileTaskScope final {
+    explicit ProfileTaskScope(const ProfileTag& tag) noexcept;
+
+    ProfileTaskScope(const ProfileTaskScope&) = delete;
+    ProfileTaskScope(ProfileTaskScope&&) = delete;
+    ProfileTaskScope& operator=(const ProfileTaskScope&) = delete;
+    ProfileTaskScope& operator=(ProfileTaskScope&&) = delete;
+
+    ~ProfileTaskScope();
+
+private:
+    bool is_set = false;
+    uint32_t previous_job = 0;
+    const char* stage = nullptr;
+};
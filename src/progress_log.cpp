@@ -0,0 +1,161 @@
+#include "progress_log.h"
+#include "metrics.h"
+
+#include <algorithm>
+#include <iomanip>
+
+ProgressLog::ProgressLog(size_t job_count)
+        : cells(new Cell[RING_SIZE])
+        , progress(new JobProgress[job_count])
+        , written_percents(job_count, 0)
+        , begin(std::chrono::steady_clock::now()) {
+    for (size_t i = 0; i < RING_SIZE; i++) {
+        cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+ProgressLog::~ProgressLog() {
+    close();
+}
+
+bool ProgressLog::open(const std::string& path, std::ostream& log) {
+    stream.open(path, std::ios::binary | std::ios::trunc);
+    if (!stream) {
+        log << "Texture compiler error. Failed to create progress file " << path << "." << std::endl;
+        return false;
+    }
+    stream << std::fixed << std::setprecision(3);
+
+    writer = std::thread([this] {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (!is_stopping) {
+            condition.wait_for(lock, PROGRESS_INTERVAL);
+
+            lock.unlock();
+            write_events();
+            lock.lock();
+        }
+    });
+    return true;
+}
+
+JobProgress* ProgressLog::get_progress(size_t job) noexcept {
+    return &progress[job];
+}
+
+void ProgressLog::start(size_t job, const std::string& input, const std::string& output) {
+    Event event;
+    event.type = EventType::START;
+    event.job = job;
+    event.time = get_time();
+    event.input = input;
+    event.output = output;
+    push(std::move(event));
+}
+
+void ProgressLog::finish(size_t job, bool is_succeeded, double seconds, std::string log) {
+    Event event;
+    event.type = EventType::DONE;
+    event.job = job;
+    event.time = get_time();
+    event.is_succeeded = is_succeeded;
+    event.seconds = seconds;
+    event.log = std::move(log);
+    push(std::move(event));
+}
+
+void ProgressLog::close() noexcept {
+    if (!writer.joinable()) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        is_stopping = true;
+    }
+    condition.notify_one();
+    writer.join();
+
+    // Events pushed while the writer was stopping.
+    try {
+        write_events();
+    } catch (...) {
+        // Losing progress lines is better than losing the build.
+    }
+    stream.close();
+}
+
+void ProgressLog::push(Event event) {
+    size_t position = push_position.load(std::memory_order_relaxed);
+    for (;;) {
+        Cell& cell = cells[position % RING_SIZE];
+        const size_t sequence = cell.sequence.load(std::memory_order_acquire);
+        const auto difference = static_cast<std::ptrdiff_t>(sequence - position);
+        if (difference == 0) {
+            if (push_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                cell.event = std::move(event);
+                cell.sequence.store(position + 1, std::memory_order_release);
+                return;
+            }
+        } else if (difference < 0) {
+            // The ring is full, which takes a thousand jobs starting or ending within one interval of the writer.
+            std::this_thread::yield();
+            position = push_position.load(std::memory_order_relaxed);
+        } else {
+            position = push_position.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+bool ProgressLog::pop(Event& event) noexcept {
+    Cell& cell = cells[pop_position % RING_SIZE];
+    if (cell.sequence.load(std::memory_order_acquire) != pop_position + 1) {
+        return false;
+    }
+
+    event = std::move(cell.event);
+    cell.event = Event();
+    cell.sequence.store(pop_position + RING_SIZE, std::memory_order_release);
+    pop_position++;
+    return true;
+}
+
+// Events come first and the progress of the jobs still running after them, so times only grow and no progress line
+// follows the done line of its job. Messages lose the carriage returns that the console uses to overwrite progress.
+void ProgressLog::write_events() {
+    Event event;
+    while (pop(event)) {
+        stream << "{\"event\":\"" << (event.type == EventType::START ? "start" : "done") << "\",\"job\":" << event.job + 1 << ",\"time\":" << event.time;
+        if (event.type == EventType::START) {
+            stream << ",\"input\":";
+            write_json_string(stream, event.input);
+            stream << ",\"output\":";
+            write_json_string(stream, event.output);
+            running_jobs.push_back(event.job);
+        } else {
+            stream << ",\"result\":\"" << (event.is_succeeded ? "ok" : "failed") << "\",\"seconds\":" << event.seconds;
+            event.log.erase(std::remove(event.log.begin(), event.log.end(), '\r'), event.log.end());
+            if (!event.log.empty()) {
+                stream << ",\"log\":";
+                write_json_string(stream, event.log);
+            }
+            running_jobs.erase(std::remove(running_jobs.begin(), running_jobs.end(), event.job), running_jobs.end());
+        }
+        stream << "}\n";
+    }
+
+    const double time = get_time();
+    for (const size_t job : running_jobs) {
+        const int percent = progress[job].percent.load(std::memory_order_relaxed);
+        if (percent != written_percents[job]) {
+            written_percents[job] = percent;
+            stream << "{\"event\":\"progress\",\"job\":" << job + 1 << ",\"time\":" << time << ",\"percent\":" << percent << "}\n";
+        }
+    }
+
+    stream.flush();
+}
+
+double ProgressLog::get_time() const noexcept {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+}
@@ -0,0 +1,100 @@
+#pragma once
+
+#include "compiler.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Progress of the jobs of a manifest as JSON lines, written by `--progress` for build dashboards and IDEs, which can't
+// parse the console output of parallel jobs. Every line is an object with an `event`, the 1-based `job` number of the
+// manifest line and the `time` in seconds since the build started:
+//
+//     {"event":"start","job":3,"time":0.012,"input":"rock.png","output":"rock.dds"}
+//     {"event":"progress","job":3,"time":0.412,"percent":42}
+//     {"event":"done","job":3,"time":1.530,"result":"ok","seconds":1.518,"log":"Compression took 1.52 seconds.\n"}
+//
+// Jobs never touch the file. Starts and ends of jobs go through a lock-free ring buffer, and progress is a relaxed
+// atomic store into the `JobProgress` of the job. A single writer thread drains the ring and samples the progress of
+// the running jobs every `PROGRESS_INTERVAL`, writing a line only for jobs whose progress changed since the last one,
+// so the rate of lines is bounded by the number of running jobs however fast they report.
+struct ProgressLog final {
+    static constexpr std::chrono::milliseconds PROGRESS_INTERVAL { 200 };
+
+    explicit ProgressLog(size_t job_count);
+    ~ProgressLog();
+
+    ProgressLog(const ProgressLog&) = delete;
+    ProgressLog(ProgressLog&&) = delete;
+    ProgressLog& operator=(const ProgressLog&) = delete;
+    ProgressLog& operator=(ProgressLog&&) = delete;
+
+    // Creates the file and starts the writer thread. Returns false when the file can't be created.
+    bool open(const std::string& path, std::ostream& log);
+
+    // Progress the job of the 0-based `job` index reports into, see `CompileJob::progress`.
+    JobProgress* get_progress(size_t job) noexcept;
+
+    // Called by the thread running the job. Waits only while the ring is full.
+    void start(size_t job, const std::string& input, const std::string& output);
+    void finish(size_t job, bool is_succeeded, double seconds, std::string log);
+
+    // Writes what's left and stops the writer thread.
+    void close() noexcept;
+
+private:
+    enum class EventType {
+        START,
+        DONE
+    };
+
+    struct Event final {
+        EventType type = EventType::START;
+        size_t job = 0;
+        double time = 0.0;
+        std::string input;
+        std::string output;
+        bool is_succeeded = false;
+        double seconds = 0.0;
+        std::string log;
+    };
+
+    // Cell of the bounded multiple producer ring of Dmitry Vyukov. `sequence` tells a producer that the cell is free
+    // for the lap of its position and the consumer that the cell holds the event of its position.
+    struct Cell final {
+        std::atomic<size_t> sequence { 0 };
+        Event event;
+    };
+
+    static constexpr size_t RING_SIZE = 1024;
+
+    void push(Event event);
+    bool pop(Event& event) noexcept;
+    void write_events();
+    double get_time() const noexcept;
+
+    std::unique_ptr<Cell[]> cells;
+    std::atomic<size_t> push_position { 0 };
+    size_t pop_position = 0;
+
+    std::unique_ptr<JobProgress[]> progress;
+
+    // Writer thread only, the last percentage written per job and the jobs started and not done yet.
+    std::vector<int> written_percents;
+    std::vector<size_t> running_jobs;
+
+    std::chrono::steady_clock::time_point begin;
+    std::ofstream stream;
+    std::thread writer;
+    std::mutex mutex;
+    std::condition_variable condition;
+    bool is_stopping = false;
+};
@@ -0,0 +1,145 @@
+#include "qoi_decoder.h"
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+static constexpr size_t QOI_HEADER_SIZE = 14;
+
+// Seven zero bytes and a one end the stream.
+static constexpr size_t QOI_PADDING_SIZE = 8;
+
+// Same limit as the reference decoder.
+static constexpr uint64_t QOI_MAX_PIXELS = 400000000;
+
+static constexpr uint8_t QOI_OP_INDEX = 0x00;
+static constexpr uint8_t QOI_OP_DIFF = 0x40;
+static constexpr uint8_t QOI_OP_LUMA = 0x80;
+static constexpr uint8_t QOI_OP_RUN = 0xC0;
+static constexpr uint8_t QOI_OP_RGB = 0xFE;
+static constexpr uint8_t QOI_OP_RGBA = 0xFF;
+static constexpr uint8_t QOI_MASK = 0xC0;
+
+static uint32_t read_be32(const uint8_t* data) noexcept {
+    return static_cast<uint32_t>(data[0]) << 24 | static_cast<uint32_t>(data[1]) << 16 | static_cast<uint32_t>(data[2]) << 8 | static_cast<uint32_t>(data[3]);
+}
+
+bool read_qoi_size(const uint8_t* data, size_t size, int& width, int& height, int& channels) noexcept {
+    if (size < QOI_HEADER_SIZE + QOI_PADDING_SIZE || std::memcmp(data, "qoif", 4) != 0) {
+        return false;
+    }
+
+    const uint32_t columns = read_be32(data + 4);
+    const uint32_t rows = read_be32(data + 8);
+    const uint8_t components = data[12];
+    const uint8_t color_space = data[13];
+    if (columns == 0 || rows == 0 || columns > INT32_MAX || rows > INT32_MAX || uint64_t { columns } * rows > QOI_MAX_PIXELS || (components != 3 && components != 4) ||
+        color_space > 1) {
+        return false;
+    }
+
+    width = static_cast<int>(columns);
+    height = static_cast<int>(rows);
+    channels = components;
+    return true;
+}
+
+// Pixels are RGBA bytes in a little endian word, so the previous pixel, the index and the RGBA8 output are all plain
+// word copies.
+static uint32_t pack_pixel(uint8_t red, uint8_t green, uint8_t blue, uint8_t alpha) noexcept {
+    return static_cast<uint32_t>(red) | static_cast<uint32_t>(green) << 8 | static_cast<uint32_t>(blue) << 16 | static_cast<uint32_t>(alpha) << 24;
+}
+
+static size_t hash_pixel(uint32_t pixel) noexcept {
+    const uint32_t red = pixel & 0xFF;
+    const uint32_t green = pixel >> 8 & 0xFF;
+    const uint32_t blue = pixel >> 16 & 0xFF;
+    const uint32_t alpha = pixel >> 24;
+    return (red * 3 + green * 5 + blue * 7 + alpha * 11) % 64;
+}
+
+// Decodes all the pixels to RGBA8 when `channel` is negative and to a byte of that channel per pixel otherwise.
+static std::unique_ptr<uint8_t[]> decode_qoi(const uint8_t* data, size_t size, int channel, int& width, int& height, int& channels) noexcept {
+    int columns = 0;
+    int rows = 0;
+    int components = 0;
+    if (!read_qoi_size(data, size, columns, rows, components)) {
+        return nullptr;
+    }
+
+    const size_t pixel_count = static_cast<size_t>(columns) * static_cast<size_t>(rows);
+    const size_t pixel_size = channel < 0 ? 4 : 1;
+    std::unique_ptr<uint8_t[]> output(new (std::nothrow) uint8_t[pixel_count * pixel_size]);
+    if (output == nullptr) {
+        return nullptr;
+    }
+
+    uint32_t index[64] = {};
+    uint32_t pixel = pack_pixel(0, 0, 0, 255);
+    const size_t end = size - QOI_PADDING_SIZE;
+    size_t offset = QOI_HEADER_SIZE;
+    for (size_t i = 0; i < pixel_count;) {
+        if (offset >= end) {
+            return nullptr;
+        }
+
+        const uint8_t op = data[offset++];
+        size_t run = 1;
+        if (op == QOI_OP_RGB) {
+            if (end - offset < 3) {
+                return nullptr;
+            }
+            pixel = pack_pixel(data[offset], data[offset + 1], data[offset + 2], static_cast<uint8_t>(pixel >> 24));
+            offset += 3;
+        } else if (op == QOI_OP_RGBA) {
+            if (end - offset < 4) {
+                return nullptr;
+            }
+            pixel = pack_pixel(data[offset], data[offset + 1], data[offset + 2], data[offset + 3]);
+            offset += 4;
+        } else if ((op & QOI_MASK) == QOI_OP_INDEX) {
+            pixel = index[op];
+        } else if ((op & QOI_MASK) == QOI_OP_DIFF) {
+            const uint8_t red = static_cast<uint8_t>((pixel & 0xFF) + ((op >> 4) & 3) - 2);
+            const uint8_t green = static_cast<uint8_t>((pixel >> 8 & 0xFF) + ((op >> 2) & 3) - 2);
+            const uint8_t blue = static_cast<uint8_t>((pixel >> 16 & 0xFF) + (op & 3) - 2);
+            pixel = pack_pixel(red, green, blue, static_cast<uint8_t>(pixel >> 24));
+        } else if ((op & QOI_MASK) == QOI_OP_LUMA) {
+            if (offset == end) {
+                return nullptr;
+            }
+            const int green_difference = (op & 0x3F) - 32;
+            const uint8_t second = data[offset++];
+            const uint8_t red = static_cast<uint8_t>(static_cast<int>(pixel & 0xFF) + green_difference - 8 + (second >> 4));
+            const uint8_t green = static_cast<uint8_t>(static_cast<int>(pixel >> 8 & 0xFF) + green_difference);
+            const uint8_t blue = static_cast<uint8_t>(static_cast<int>(pixel >> 16 & 0xFF) + green_difference - 8 + (second & 0xF));
+            pixel = pack_pixel(red, green, blue, static_cast<uint8_t>(pixel >> 24));
+        } else {
+            // Runs past the last pixel are cut, like the reference decoder does.
+            run = std::min(static_cast<size_t>(op & 0x3F) + 1, pixel_count - i);
+        }
+        index[hash_pixel(pixel)] = pixel;
+
+        if (channel < 0) {
+            for (size_t j = i; j < i + run; j++) {
+                std::memcpy(output.get() + j * 4, &pixel, 4);
+            }
+        } else {
+            std::fill_n(output.get() + i, run, static_cast<uint8_t>(pixel >> (channel * 8)));
+        }
+        i += run;
+    }
+
+    width = columns;
+    height = rows;
+    channels = components;
+    return output;
+}
+
+std::unique_ptr<uint8_t[]> decode_qoi_rgba8(const uint8_t* data, size_t size, int& width, int& height, int& channels) noexcept {
+    return decode_qoi(data, size, -1, width, height, channels);
+}
+
+std::unique_ptr<uint8_t[]> decode_qoi_channel8(const uint8_t* data, size_t size, int channel, int& width, int& height, int& channels) noexcept {
+    return decode_qoi(data, size, channel, width, height, channels);
+}
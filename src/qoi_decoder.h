@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+// Reads the size and the channels, 3 or 4, of a QOI image from its header. Returns false when the data isn't QOI.
+bool read_qoi_size(const uint8_t* data, size_t size, int& width, int& height, int& channels) noexcept;
+
+// Decodes a QOI image to RGBA8 pixels, images without alpha are opaque, the same as `stbi_load` with four components
+// gives for other formats. QOI is a single stream of operations that each depend on the previous pixel, so it can't be
+// split between threads, but every operation is a few instructions and runs are filled a word per pixel, which makes
+// it several times faster than inflating and unfiltering a PNG image of the same pixels. Returns null when the data
+// isn't QOI or the stream is truncated or broken.
+std::unique_ptr<uint8_t[]> decode_qoi_rgba8(const uint8_t* data, size_t size, int& width, int& height, int& channels) noexcept;
+
+// Same as `decode_qoi_rgba8`, but keeps only the specified channel of every RGBA8 pixel, a byte per pixel.
+std::unique_ptr<uint8_t[]> decode_qoi_channel8(const uint8_t* data, size_t size, int channel, int& width, int& height, int& channels) noexcept;
@@ -0,0 +1,288 @@
+#include "rdo.h"
+#include "dds_layout.h"
+
+#include <algorithm>
+#include <bimg/bimg.h>
+#include <bx/allocator.h>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+// Number of preceding blocks in the same mip level a block can be copied from. The previous row of blocks is always
+// searched too, it's usually the closest match of a block after the left neighbour.
+static constexpr size_t RDO_WINDOW_SIZE = 32;
+
+// Approximate cost in bits of an LZ match that repeats bytes of a recent block, an offset and a length.
+static constexpr float RDO_MATCH_BITS = 24.f;
+
+// PSNR reported for textures that weren't changed at all.
+static constexpr double RDO_MAX_PSNR = 100.0;
+
+// bimg decodes BC4 to the third channel of its RGBA8 output.
+static constexpr uint32_t CHANNEL_BC4 = 1 << 2;
+static constexpr uint32_t CHANNEL_RGB = 0x7;
+static constexpr uint32_t CHANNEL_ALPHA = 1 << 3;
+static constexpr uint32_t CHANNEL_RGBA = 0xF;
+
+// Range of a block decoded independently of the rest of the block, together with the channels it decodes to. Parts
+// with endpoints followed by selectors can also reuse just the selectors of a recent block and keep their endpoints.
+struct BlockPart final {
+    size_t offset;
+    size_t size;
+    size_t selectors_offset; // Zero when selectors can't be reused on their own
+    uint32_t channels;
+};
+
+struct RdoFormat final {
+    uint32_t dxgi_format;
+    bimg::TextureFormat::Enum bimg_format;
+    BlockPart parts[2];
+    size_t part_count;
+};
+
+static const RdoFormat FORMATS[] = {
+    // DXGI_FORMAT_BC1_UNORM, color block only.
+    { 71, bimg::TextureFormat::BC1, { { 0, 8, 4, CHANNEL_RGB } }, 1 },
+    // DXGI_FORMAT_BC3_UNORM, alpha block followed by color block.
+    { 77, bimg::TextureFormat::BC3, { { 0, 8, 2, CHANNEL_ALPHA }, { 8, 8, 4, CHANNEL_RGB } }, 2 },
+    // DXGI_FORMAT_BC4_UNORM.
+    { 80, bimg::TextureFormat::BC4, { { 0, 8, 2, CHANNEL_BC4 } }, 1 },
+    // DXGI_FORMAT_BC7_UNORM, bit layout of the selectors depends on the block mode.
+    { 98, bimg::TextureFormat::BC7, { { 0, 16, 0, CHANNEL_RGBA } }, 1 },
+};
+
+// Decoded RGBA8 pixels of a mip level, padded to whole blocks.
+struct DecodedLevel final {
+    size_t blocks_x;
+    std::vector<uint8_t> pixels;
+
+    uint8_t* get_pixel(size_t block, size_t x, size_t y) noexcept {
+        const size_t pixel_x = block % blocks_x * 4 + x;
+        const size_t pixel_y = block / blocks_x * 4 + y;
+        return pixels.data() + (pixel_y * blocks_x * 4 + pixel_x) * 4;
+    }
+};
+
+// Squared error of the visible pixels of `block` when it's decoded like `candidate`.
+static uint64_t get_block_error(DecodedLevel& candidates, size_t candidate, DecodedLevel& original, size_t block, uint32_t channels, size_t visible_width,
+                                size_t visible_height) noexcept {
+    uint64_t error = 0;
+    for (size_t y = 0; y < visible_height; y++) {
+        for (size_t x = 0; x < visible_width; x++) {
+            const uint8_t* a = candidates.get_pixel(candidate, x, y);
+            const uint8_t* b = original.get_pixel(block, x, y);
+            for (size_t channel = 0; channel < 4; channel++) {
+                if ((channels & (1 << channel)) != 0) {
+                    const int difference = static_cast<int>(a[channel]) - static_cast<int>(b[channel]);
+                    error += static_cast<uint64_t>(difference * difference);
+                }
+            }
+        }
+    }
+    return error;
+}
+
+// Squared error of the visible pixels of `block` when it's decoded to the 4x4 RGBA8 `pixels`.
+static uint64_t get_trial_error(const uint8_t* pixels, DecodedLevel& original, size_t block, uint32_t channels, size_t visible_width, size_t visible_height) noexcept {
+    uint64_t error = 0;
+    for (size_t y = 0; y < visible_height; y++) {
+        for (size_t x = 0; x < visible_width; x++) {
+            const uint8_t* a = pixels + (y * 4 + x) * 4;
+            const uint8_t* b = original.get_pixel(block, x, y);
+            for (size_t channel = 0; channel < 4; channel++) {
+                if ((channels & (1 << channel)) != 0) {
+                    const int difference = static_cast<int>(a[channel]) - static_cast<int>(b[channel]);
+                    error += static_cast<uint64_t>(difference * difference);
+                }
+            }
+        }
+    }
+    return error;
+}
+
+static void copy_block_pixels(DecodedLevel& level, size_t source, size_t destination, uint32_t channels) noexcept {
+    for (size_t y = 0; y < 4; y++) {
+        for (size_t x = 0; x < 4; x++) {
+            const uint8_t* from = level.get_pixel(source, x, y);
+            uint8_t* to = level.get_pixel(destination, x, y);
+            for (size_t channel = 0; channel < 4; channel++) {
+                if ((channels & (1 << channel)) != 0) {
+                    to[channel] = from[channel];
+                }
+            }
+        }
+    }
+}
+
+static void copy_trial_pixels(const uint8_t* pixels, DecodedLevel& level, size_t destination, uint32_t channels) noexcept {
+    for (size_t y = 0; y < 4; y++) {
+        for (size_t x = 0; x < 4; x++) {
+            const uint8_t* from = pixels + (y * 4 + x) * 4;
+            uint8_t* to = level.get_pixel(destination, x, y);
+            for (size_t channel = 0; channel < 4; channel++) {
+                if ((channels & (1 << channel)) != 0) {
+                    to[channel] = from[channel];
+                }
+            }
+        }
+    }
+}
+
+// Blocks are visited in the order they're written, every part picks whichever of keeping its bytes, copying a recent
+// part or copying just its selectors has the lowest cost of `error + lambda * bits`.
+static void optimize_level(char* data, size_t width, size_t height, const RdoFormat& format, size_t block_size, float lambda, uint64_t& total_error,
+                           uint64_t& total_samples) {
+    const size_t blocks_x = (width + 3) / 4;
+    const size_t blocks_y = (height + 3) / 4;
+
+    bx::DefaultAllocator allocator;
+
+    DecodedLevel original{ blocks_x, std::vector<uint8_t>(blocks_x * blocks_y * 16 * 4) };
+    bimg::imageDecodeToRgba8(&allocator, original.pixels.data(), data, static_cast<uint32_t>(blocks_x * 4), static_cast<uint32_t>(blocks_y * 4),
+                             static_cast<uint32_t>(blocks_x * 4 * 4), format.bimg_format);
+
+    // Pixels of the blocks as they're written, which is what later blocks are compared against.
+    DecodedLevel current{ blocks_x, original.pixels };
+
+    uint32_t all_channels = 0;
+    for (size_t i = 0; i < format.part_count; i++) {
+        all_channels |= format.parts[i].channels;
+    }
+
+    size_t channel_count = 0;
+    for (size_t channel = 0; channel < 4; channel++) {
+        channel_count += (all_channels >> channel) & 1;
+    }
+
+    std::vector<size_t> candidates;
+    candidates.reserve(RDO_WINDOW_SIZE + 3);
+
+    char trial[16];
+    uint8_t trial_pixels[16 * 4];
+    uint8_t best_pixels[16 * 4];
+
+    for (size_t block = 0; block < blocks_x * blocks_y; block++) {
+        const size_t block_x = block % blocks_x;
+        const size_t block_y = block / blocks_x;
+        const size_t visible_width = std::min<size_t>(width - block_x * 4, 4);
+        const size_t visible_height = std::min<size_t>(height - block_y * 4, 4);
+
+        candidates.clear();
+        for (size_t distance = 1; distance <= RDO_WINDOW_SIZE && distance <= block; distance++) {
+            candidates.push_back(block - distance);
+        }
+        if (block_y > 0) {
+            for (size_t x = block_x == 0 ? 0 : block_x - 1; x <= block_x + 1 && x < blocks_x; x++) {
+                candidates.push_back(block - blocks_x - block_x + x);
+            }
+        }
+
+        char* block_data = data + block * block_size;
+
+        for (size_t i = 0; i < format.part_count; i++) {
+            const BlockPart& part = format.parts[i];
+            const size_t selectors_size = part.size - part.selectors_offset;
+            char* part_data = block_data + part.offset;
+
+            // Bytes of the part are kept as they are, which costs all of its bits and adds no error.
+            float best_cost = lambda * static_cast<float>(part.size * 8);
+            size_t best_candidate = block;
+            bool is_best_selectors = false;
+
+            for (const size_t candidate : candidates) {
+                const char* candidate_data = data + candidate * block_size + part.offset;
+                if (std::memcmp(candidate_data, part_data, part.size) == 0) {
+                    // Already a match for free.
+                    best_candidate = block;
+                    break;
+                }
+
+                const uint64_t error = get_block_error(current, candidate, original, block, part.channels, visible_width, visible_height);
+                const float cost = static_cast<float>(error) + lambda * RDO_MATCH_BITS;
+                if (cost < best_cost) {
+                    best_cost = cost;
+                    best_candidate = candidate;
+                    is_best_selectors = false;
+                }
+
+                if (part.selectors_offset != 0 && std::memcmp(candidate_data + part.selectors_offset, part_data + part.selectors_offset, selectors_size) != 0) {
+                    std::memcpy(trial, block_data, block_size);
+                    std::memcpy(trial + part.offset + part.selectors_offset, candidate_data + part.selectors_offset, selectors_size);
+                    bimg::imageDecodeToRgba8(&allocator, trial_pixels, trial, 4, 4, 4 * 4, format.bimg_format);
+
+                    const uint64_t selectors_error = get_trial_error(trial_pixels, original, block, part.channels, visible_width, visible_height);
+                    const float selectors_cost = static_cast<float>(selectors_error) + lambda * (static_cast<float>(part.selectors_offset * 8) + RDO_MATCH_BITS);
+                    if (selectors_cost < best_cost) {
+                        best_cost = selectors_cost;
+                        best_candidate = candidate;
+                        is_best_selectors = true;
+                        std::memcpy(best_pixels, trial_pixels, sizeof(best_pixels));
+                    }
+                }
+            }
+
+            if (best_candidate != block) {
+                const char* candidate_data = data + best_candidate * block_size + part.offset;
+                if (is_best_selectors) {
+                    std::memcpy(part_data + part.selectors_offset, candidate_data + part.selectors_offset, selectors_size);
+                    copy_trial_pixels(best_pixels, current, block, part.channels);
+                } else {
+                    std::memcpy(part_data, candidate_data, part.size);
+                    copy_block_pixels(current, best_candidate, block, part.channels);
+                }
+            }
+        }
+
+        total_error += get_block_error(current, block, original, block, all_channels, visible_width, visible_height);
+        total_samples += visible_width * visible_height * channel_count;
+    }
+}
+
+bool optimize_rate_distortion(std::vector<char>& dds, float lambda, double& psnr, std::ostream& log) {
+    psnr = RDO_MAX_PSNR;
+
+    Dds10Header header;
+    if (!read_dds10_header(dds.data(), dds.size(), header)) {
+        log << "\rTexture compiler error. Rate-distortion optimization requires a DDS texture with the DX10 header." << std::endl;
+        return false;
+    }
+
+    if (header.dimension != DDS10_DIMENSION_TEXTURE_2D || header.misc_flags != 0) {
+        log << "\rTexture compiler error. Rate-distortion optimization is supported only for 2D textures and texture arrays." << std::endl;
+        return false;
+    }
+
+    const RdoFormat* format = nullptr;
+    for (const RdoFormat& candidate : FORMATS) {
+        if (candidate.dxgi_format == header.dxgi_format) {
+            format = &candidate;
+        }
+    }
+
+    if (format == nullptr || lambda <= 0.f) {
+        return true;
+    }
+
+    const TextureFormatSize* format_size = find_texture_format_size(format->dxgi_format);
+    const std::vector<DdsLevel> levels =
+        get_dds_levels(header.width, header.height, header.level_count, header.array_size, format_size->block_size, format_size->is_block_compressed);
+    if (get_dds_size(levels) > dds.size()) {
+        log << "\rTexture compiler error. DDS texture size doesn't match its mip levels." << std::endl;
+        return false;
+    }
+
+    uint64_t total_error = 0;
+    uint64_t total_samples = 0;
+
+    for (const DdsLevel& level : levels) {
+        optimize_level(dds.data() + level.offset, level.width, level.height, *format, format_size->block_size, lambda, total_error, total_samples);
+    }
+
+    if (total_error != 0 && total_samples != 0) {
+        const double mean_error = static_cast<double>(total_error) / static_cast<double>(total_samples);
+        psnr = std::min(10.0 * std::log10(255.0 * 255.0 / mean_error), RDO_MAX_PSNR);
+    }
+
+    return true;
+}
@@ -0,0 +1,13 @@
+#pragma once
+
+#include <ostream>
+#include <vector>
+
+// Rate-distortion optimization of the blocks nvtt wrote to a 2D DDS texture with the DX10 header. Every block, or
+// every color and alpha half of a BC3 block, is replaced by a copy of a recently written block when the squared error
+// it adds, in 8-bit units, is smaller than `lambda` times the bits a copy saves to the package compressor. Repeated
+// blocks are cheap LZ matches for Zstandard or Oodle, so the package shrinks at a controlled cost in quality.
+//
+// `psnr` receives the PSNR in decibels of the optimized texture against the blocks nvtt encoded, 100 when nothing
+// changed. Textures that aren't BC1, BC3, BC4 or BC7 are left as is.
+bool optimize_rate_distortion(std::vector<char>& dds, float lambda, double& psnr, std::ostream& log);
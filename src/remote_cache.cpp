@@ -0,0 +1,597 @@
+#include "remote_cache.h"
+
+#include <algorithm>
+#include <atomic>
+#include <bx/platform.h>
+#include <cctype>
+#include <cerrno>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+#include <system_error>
+
+#if BX_PLATFORM_WINDOWS
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#else
+#include <fcntl.h>
+#include <netdb.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+namespace fs = std::filesystem;
+
+// Remote lookups must be cheaper than compiling a texture with development settings, so a slow or dead remote is
+// given up on quickly rather than waited for.
+static const int CONNECT_TIMEOUT_MS = 500;
+static const int TRANSFER_TIMEOUT_MS = 10000;
+
+#if BX_PLATFORM_WINDOWS
+using Socket = SOCKET;
+static const Socket INVALID_SOCKET_HANDLE = INVALID_SOCKET;
+
+static void close_socket(Socket socket) noexcept {
+    closesocket(socket);
+}
+#else
+using Socket = int;
+static const Socket INVALID_SOCKET_HANDLE = -1;
+
+static void close_socket(Socket socket) noexcept {
+    close(socket);
+}
+#endif
+
+struct SocketWrapper final {
+    explicit SocketWrapper(Socket socket) noexcept
+            : socket(socket) {
+    }
+
+    SocketWrapper(const SocketWrapper&) = delete;
+    SocketWrapper(SocketWrapper&&) = delete;
+    SocketWrapper& operator=(const SocketWrapper&) = delete;
+    SocketWrapper& operator=(SocketWrapper&&) = delete;
+
+    ~SocketWrapper() {
+        if (socket != INVALID_SOCKET_HANDLE) {
+            close_socket(socket);
+        }
+    }
+
+    Socket socket;
+};
+
+struct AddressWrapper final {
+    AddressWrapper() noexcept = default;
+
+    AddressWrapper(const AddressWrapper&) = delete;
+    AddressWrapper(AddressWrapper&&) = delete;
+    AddressWrapper& operator=(const AddressWrapper&) = delete;
+    AddressWrapper& operator=(AddressWrapper&&) = delete;
+
+    ~AddressWrapper() {
+        if (address != nullptr) {
+            freeaddrinfo(address);
+        }
+    }
+
+    addrinfo* address = nullptr;
+};
+
+static bool set_blocking(Socket socket, bool is_blocking) noexcept {
+#if BX_PLATFORM_WINDOWS
+    u_long mode = is_blocking ? 0 : 1;
+    return ioctlsocket(socket, FIONBIO, &mode) == 0;
+#else
+    const int flags = fcntl(socket, F_GETFL, 0);
+    return flags != -1 && fcntl(socket, F_SETFL, is_blocking ? flags & ~O_NONBLOCK : flags | O_NONBLOCK) == 0;
+#endif
+}
+
+static bool set_timeouts(Socket socket, int milliseconds) noexcept {
+#if BX_PLATFORM_WINDOWS
+    const DWORD timeout = static_cast<DWORD>(milliseconds);
+#else
+    const timeval timeout { milliseconds / 1000, (milliseconds % 1000) * 1000 };
+#endif
+    return setsockopt(socket, SOL_SOCKET, SO_RCVTIMEO, reinterpret_cast<const char*>(&timeout), sizeof(timeout)) == 0 &&
+           setsockopt(socket, SOL_SOCKET, SO_SNDTIMEO, reinterpret_cast<const char*>(&timeout), sizeof(timeout)) == 0;
+}
+
+static bool connect_with_timeout(Socket socket, const sockaddr* address, size_t address_size) noexcept {
+    if (!set_blocking(socket, false)) {
+        return false;
+    }
+
+    if (connect(socket, address, static_cast<int>(address_size)) != 0) {
+#if BX_PLATFORM_WINDOWS
+        if (WSAGetLastError() != WSAEWOULDBLOCK) {
+            return false;
+        }
+
+        WSAPOLLFD descriptor { socket, POLLOUT, 0 };
+        if (WSAPoll(&descriptor, 1, CONNECT_TIMEOUT_MS) != 1) {
+            return false;
+        }
+#else
+        if (errno != EINPROGRESS) {
+            return false;
+        }
+
+        pollfd descriptor { socket, POLLOUT, 0 };
+        if (poll(&descriptor, 1, CONNECT_TIMEOUT_MS) != 1) {
+            return false;
+        }
+#endif
+
+        int error = 0;
+        socklen_t error_size = sizeof(error);
+        if (getsockopt(socket, SOL_SOCKET, SO_ERROR, reinterpret_cast<char*>(&error), &error_size) != 0 || error != 0) {
+            return false;
+        }
+    }
+
+    return set_blocking(socket, true) && set_timeouts(socket, TRANSFER_TIMEOUT_MS);
+}
+
+static bool send_all(Socket socket, const char* data, size_t size) noexcept {
+    while (size > 0) {
+        const int chunk = static_cast<int>(std::min(size, static_cast<size_t>(1 << 20)));
+        const auto sent = send(socket, data, chunk, 0);
+        if (sent <= 0) {
+            return false;
+        }
+        data += sent;
+        size -= static_cast<size_t>(sent);
+    }
+    return true;
+}
+
+static bool receive_all(Socket socket, std::string& response) {
+    char buffer[64 * 1024];
+    while (true) {
+        const auto received = recv(socket, buffer, sizeof(buffer), 0);
+        if (received < 0) {
+            return false;
+        }
+        if (received == 0) {
+            return true;
+        }
+        response.append(buffer, static_cast<size_t>(received));
+    }
+}
+
+// Decodes `Transfer-Encoding: chunked` body in place.
+static bool decode_chunked(std::string& body) {
+    std::string result;
+    size_t position = 0;
+    while (true) {
+        const size_t line_end = body.find("\r\n", position);
+        if (line_end == std::string::npos) {
+            return false;
+        }
+
+        const size_t chunk_size = std::strtoull(body.c_str() + position, nullptr, 16);
+        position = line_end + 2;
+        if (chunk_size == 0) {
+            break;
+        }
+
+        if (position + chunk_size > body.size()) {
+            return false;
+        }
+
+        result.append(body, position, chunk_size);
+        position += chunk_size + 2;
+    }
+
+    body = std::move(result);
+    return true;
+}
+
+static std::string to_lower(std::string value) {
+    for (char& character : value) {
+        character = static_cast<char>(std::tolower(static_cast<unsigned char>(character)));
+    }
+    return value;
+}
+
+struct HttpRemoteCache final : RemoteCache {
+    HttpRemoteCache(std::string host, std::string port, std::string path) noexcept
+            : host(std::move(host))
+            , port(std::move(port))
+            , path(std::move(path)) {
+#if BX_PLATFORM_WINDOWS
+        WSADATA data;
+        is_initialized = WSAStartup(MAKEWORD(2, 2), &data) == 0;
+#endif
+    }
+
+    HttpRemoteCache(const HttpRemoteCache&) = delete;
+    HttpRemoteCache(HttpRemoteCache&&) = delete;
+    HttpRemoteCache& operator=(const HttpRemoteCache&) = delete;
+    HttpRemoteCache& operator=(HttpRemoteCache&&) = delete;
+
+    ~HttpRemoteCache() override {
+#if BX_PLATFORM_WINDOWS
+        if (is_initialized) {
+            WSACleanup();
+        }
+#endif
+    }
+
+    bool get(const Hash& key, std::vector<char>& blob, std::ostream& log) override {
+        int status;
+        std::string body;
+        if (!request("GET", key, nullptr, 0, status, body, log)) {
+            return false;
+        }
+
+        if (status == 404) {
+            return false;
+        }
+
+        if (status != 200) {
+            log << "Texture compiler warning. Remote cache GET returned HTTP status " << status << "." << std::endl;
+            return false;
+        }
+
+        blob.assign(body.begin(), body.end());
+        return true;
+    }
+
+    bool put(const Hash& key, const std::vector<char>& blob, std::ostream& log) override {
+        int status;
+        std::string body;
+        if (!request("PUT", key, blob.data(), blob.size(), status, body, log)) {
+            return false;
+        }
+
+        if (status < 200 || status >= 300) {
+            log << "Texture compiler warning. Remote cache PUT returned HTTP status " << status << "." << std::endl;
+            return false;
+        }
+
+        return true;
+    }
+
+private:
+    bool request(const char* method, const Hash& key, const char* data, size_t size, int& status, std::string& body, std::ostream& log) {
+        if (is_unavailable) {
+            return false;
+        }
+
+        std::string response;
+        if (!transfer(method, key, data, size, response)) {
+            // Don't pay the timeout for every job of a batch.
+            if (!is_unavailable.exchange(true)) {
+                log << "Texture compiler warning. Remote cache at " << host << ":" << port << " is not reachable, it's disabled for the rest of the build." << std::endl;
+            }
+            return false;
+        }
+
+        const size_t header_end = response.find("\r\n\r\n");
+        if (response.compare(0, 5, "HTTP/") != 0 || header_end == std::string::npos) {
+            log << "Texture compiler warning. Remote cache returned a malformed HTTP response." << std::endl;
+            return false;
+        }
+
+        const size_t status_begin = response.find(' ');
+        status = std::atoi(response.c_str() + status_begin + 1);
+
+        const std::string headers = to_lower(response.substr(0, header_end));
+        body = response.substr(header_end + 4);
+
+        if (headers.find("transfer-encoding: chunked") != std::string::npos) {
+            if (!decode_chunked(body)) {
+                log << "Texture compiler warning. Remote cache returned a malformed chunked HTTP response." << std::endl;
+                return false;
+            }
+        } else if (const size_t length = headers.find("content-length:"); length != std::string::npos) {
+            const size_t content_length = std::strtoull(headers.c_str() + length + 15, nullptr, 10);
+            if (body.size() < content_length) {
+                log << "Texture compiler warning. Remote cache response is truncated." << std::endl;
+                return false;
+            }
+            body.resize(content_length);
+        }
+
+        return true;
+    }
+
+    bool transfer(const char* method, const Hash& key, const char* data, size_t size, std::string& response) {
+        addrinfo hints {};
+        hints.ai_family = AF_UNSPEC;
+        hints.ai_socktype = SOCK_STREAM;
+
+        AddressWrapper addresses;
+        if (getaddrinfo(host.c_str(), port.c_str(), &hints, &addresses.address) != 0) {
+            return false;
+        }
+
+        for (const addrinfo* address = addresses.address; address != nullptr; address = address->ai_next) {
+            SocketWrapper socket(::socket(address->ai_family, address->ai_socktype, address->ai_protocol));
+            if (socket.socket == INVALID_SOCKET_HANDLE || !connect_with_timeout(socket.socket, address->ai_addr, address->ai_addrlen)) {
+                continue;
+            }
+
+            std::string header = std::string(method) + " " + path + "/" + key.to_string() + " HTTP/1.1\r\n" +
+                                 "Host: " + host + "\r\n" +
+                                 "Connection: close\r\n";
+            if (std::strcmp(method, "PUT") == 0) {
+                header += "Content-Type: application/octet-stream\r\nContent-Length: " + std::to_string(size) + "\r\n";
+            }
+            header += "\r\n";
+
+            return send_all(socket.socket, header.data(), header.size()) && send_all(socket.socket, data, size) && receive_all(socket.socket, response);
+        }
+
+        return false;
+    }
+
+    std::string host;
+    std::string port;
+    std::string path;
+    std::atomic<bool> is_unavailable { false };
+
+#if BX_PLATFORM_WINDOWS
+    bool is_initialized = false;
+#endif
+};
+
+struct DirectoryRemoteCache final : RemoteCache {
+    explicit DirectoryRemoteCache(std::string directory) noexcept
+            : directory(std::move(directory)) {
+    }
+
+    DirectoryRemoteCache(const DirectoryRemoteCache&) = delete;
+    DirectoryRemoteCache(DirectoryRemoteCache&&) = delete;
+    DirectoryRemoteCache& operator=(const DirectoryRemoteCache&) = delete;
+    DirectoryRemoteCache& operator=(DirectoryRemoteCache&&) = delete;
+
+    bool get(const Hash& key, std::vector<char>& blob, std::ostream& log) override {
+        std::ifstream stream(fs::path(directory) / key.to_string(), std::ios::binary);
+        if (!stream) {
+            return false;
+        }
+
+        blob.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+        if (stream.bad()) {
+            log << "Texture compiler warning. Failed to read a remote cache entry." << std::endl;
+            return false;
+        }
+
+        return true;
+    }
+
+    bool put(const Hash& key, const std::vector<char>& blob, std::ostream& log) override {
+        static std::atomic<size_t> temporary_counter { 0 };
+
+        // Write and rename, so readers on other machines never see a partially written entry.
+        const fs::path path = fs::path(directory) / key.to_string();
+        fs::path temporary = path;
+        temporary += ".tmp" + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()) + "." + std::to_string(temporary_counter++);
+
+        std::error_code error;
+        fs::create_directories(directory, error);
+
+        {
+            std::ofstream stream(temporary, std::ios::binary);
+            if (!stream.write(blob.data(), static_cast<std::streamsize>(blob.size()))) {
+                log << "Texture compiler warning. Failed to write a remote cache entry." << std::endl;
+                stream.close();
+                fs::remove(temporary, error);
+                return false;
+            }
+        }
+
+        fs::rename(temporary, path, error);
+        if (error) {
+            fs::remove(temporary, error);
+            log << "Texture compiler warning. Failed to publish a remote cache entry." << std::endl;
+            return false;
+        }
+
+        return true;
+    }
+
+    std::string directory;
+};
+
+static const char FILTER_MAGIC[4] = { 'T', 'C', 'B', 'F' };
+
+// 16M bits, 2 MB, keep false positives around 1% up to 1.7 million entries.
+static constexpr uint64_t FILTER_BIT_COUNT = uint64_t(1) << 24;
+static constexpr uint64_t FILTER_HASH_COUNT = 7;
+static constexpr size_t FILTER_SIZE = sizeof(FILTER_MAGIC) + FILTER_BIT_COUNT / 8;
+
+static constexpr std::chrono::seconds FILTER_REFRESH_TIME(60);
+
+// Attempts to merge the keys of the process into the filter of the remote when other processes replace it meanwhile.
+static constexpr int FILTER_MERGE_ATTEMPTS = 3;
+
+// Remote with a Bloom filter of its keys in front of it, see `create_remote_cache`.
+struct FilteredRemoteCache final : RemoteCache {
+    explicit FilteredRemoteCache(std::unique_ptr<RemoteCache> remote) noexcept
+            : remote(std::move(remote)) {
+    }
+
+    FilteredRemoteCache(const FilteredRemoteCache&) = delete;
+    FilteredRemoteCache(FilteredRemoteCache&&) = delete;
+    FilteredRemoteCache& operator=(const FilteredRemoteCache&) = delete;
+    FilteredRemoteCache& operator=(FilteredRemoteCache&&) = delete;
+
+    bool get(const Hash& key, std::vector<char>& blob, std::ostream& log) override {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            const auto now = std::chrono::steady_clock::now();
+            if (!is_fetched || now - fetch_time >= FILTER_REFRESH_TIME) {
+                fetch_filter(log);
+                is_fetched = true;
+                fetch_time = now;
+            }
+            if (!filter.empty() && !contains(filter, key)) {
+                return false;
+            }
+        }
+        return remote->get(key, blob, log);
+    }
+
+    bool put(const Hash& key, const std::vector<char>& blob, std::ostream& log) override {
+        if (!remote->put(key, blob, log)) {
+            return false;
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        added_keys.push_back(key);
+        if (!filter.empty()) {
+            insert(filter, key);
+        }
+        return true;
+    }
+
+    void finish(std::ostream& log) override {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (added_keys.empty()) {
+            return;
+        }
+
+        // Filters only gain bits, so merging is an or. A process that replaced the filter between the download and the
+        // upload loses the keys of this one, which the check after the upload finds.
+        for (int attempt = 0; attempt < FILTER_MERGE_ATTEMPTS; attempt++) {
+            std::vector<char> merged;
+            if (!remote->get(FILTER_KEY, merged, log) || !is_valid(merged)) {
+                merged.assign(FILTER_SIZE, 0);
+                std::memcpy(merged.data(), FILTER_MAGIC, sizeof(FILTER_MAGIC));
+            }
+            for (const Hash& key : added_keys) {
+                insert(merged, key);
+            }
+            if (!remote->put(FILTER_KEY, merged, log)) {
+                // Warning is printed by the remote.
+                return;
+            }
+
+            std::vector<char> published;
+            if (remote->get(FILTER_KEY, published, log) && is_valid(published) &&
+                std::all_of(added_keys.begin(), added_keys.end(), [&](const Hash& key) { return contains(published, key); })) {
+                added_keys.clear();
+                return;
+            }
+        }
+        log << "Texture compiler warning. Failed to add the keys of the build to the filter of the remote cache, other builds miss them." << std::endl;
+    }
+
+private:
+    static const Hash FILTER_KEY;
+
+    static bool is_valid(const std::vector<char>& data) noexcept {
+        return data.size() == FILTER_SIZE && std::memcmp(data.data(), FILTER_MAGIC, sizeof(FILTER_MAGIC)) == 0;
+    }
+
+    // Keys are hashes already, their halves are the two hashes the bits are derived from.
+    template <typename Visit>
+    static bool visit_bits(const Hash& key, const Visit& visit) noexcept {
+        const uint64_t step = key.high | 1;
+        for (uint64_t i = 0; i < FILTER_HASH_COUNT; i++) {
+            const uint64_t bit = (key.low + i * step) & (FILTER_BIT_COUNT - 1);
+            if (!visit(sizeof(FILTER_MAGIC) + bit / 8, static_cast<char>(1 << (bit % 8)))) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static bool contains(const std::vector<char>& data, const Hash& key) noexcept {
+        return visit_bits(key, [&](size_t byte, char mask) { return (data[byte] & mask) != 0; });
+    }
+
+    static void insert(std::vector<char>& data, const Hash& key) noexcept {
+        visit_bits(key, [&](size_t byte, char mask) {
+            data[byte] = static_cast<char>(data[byte] | mask);
+            return true;
+        });
+    }
+
+    // A remote without a filter, or with a malformed one, has every key. Called with `mutex` locked.
+    void fetch_filter(std::ostream& log) {
+        std::vector<char> fetched;
+        if (!remote->get(FILTER_KEY, fetched, log)) {
+            filter.clear();
+            return;
+        }
+        if (!is_valid(fetched)) {
+            log << "Texture compiler warning. Filter of the remote cache is malformed and ignored." << std::endl;
+            filter.clear();
+            return;
+        }
+
+        // Keys uploaded by the process may not have been merged yet.
+        filter = std::move(fetched);
+        for (const Hash& key : added_keys) {
+            insert(filter, key);
+        }
+    }
+
+    std::unique_ptr<RemoteCache> remote;
+
+    std::mutex mutex;
+    std::vector<char> filter;
+    bool is_fetched = false;
+    std::chrono::steady_clock::time_point fetch_time;
+    std::vector<Hash> added_keys;
+};
+
+const Hash FilteredRemoteCache::FILTER_KEY {};
+
+static std::unique_ptr<RemoteCache> create_unfiltered_remote_cache(const std::string& url, std::ostream& log) {
+    if (url.compare(0, 7, "file://") == 0) {
+        return std::make_unique<DirectoryRemoteCache>(url.substr(7));
+    }
+
+    if (url.compare(0, 7, "http://") == 0) {
+        const size_t authority_end = url.find('/', 7);
+        const std::string authority = url.substr(7, authority_end == std::string::npos ? std::string::npos : authority_end - 7);
+
+        std::string path = authority_end == std::string::npos ? std::string() : url.substr(authority_end);
+        while (!path.empty() && path.back() == '/') {
+            path.pop_back();
+        }
+
+        std::string host = authority;
+        std::string port = "80";
+        if (const size_t colon = authority.rfind(':'); colon != std::string::npos && authority.find(']', colon) == std::string::npos) {
+            host = authority.substr(0, colon);
+            port = authority.substr(colon + 1);
+        }
+
+        // IPv6 literals are written in brackets.
+        if (host.size() >= 2 && host.front() == '[' && host.back() == ']') {
+            host = host.substr(1, host.size() - 2);
+        }
+
+        if (host.empty() || port.empty()) {
+            log << "Texture compiler error. Remote cache URL doesn't specify a host." << std::endl;
+            return nullptr;
+        }
+
+        return std::make_unique<HttpRemoteCache>(std::move(host), std::move(port), std::move(path));
+    }
+
+    log << "Texture compiler error. Remote cache URL must start with http:// or file://, HTTPS is not supported." << std::endl;
+    return nullptr;
+}
+
+std::unique_ptr<RemoteCache> create_remote_cache(const std::string& url, bool is_filtered, std::ostream& log) {
+    std::unique_ptr<RemoteCache> remote = create_unfiltered_remote_cache(url, log);
+    if (remote && is_filtered) {
+        return std::make_unique<FilteredRemoteCache>(std::move(remote));
+    }
+    return remote;
+}
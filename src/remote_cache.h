@@ -0,0 +1,34 @@
+#pragma once
+
+#include "hash.h"
+
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// Remote storage of compilation cache entries, shared by build farm agents and workstations. An entry travels as a
+// single blob, so a cube map with all its outputs is one request.
+struct RemoteCache {
+    virtual ~RemoteCache() = default;
+
+    // Returns false on a miss or when the remote is not reachable.
+    virtual bool get(const Hash& key, std::vector<char>& blob, std::ostream& log) = 0;
+    virtual bool put(const Hash& key, const std::vector<char>& blob, std::ostream& log) = 0;
+
+    // Called once the build is done, for remotes that publish something about the whole build.
+    virtual void finish(std::ostream& /*log*/) {
+    }
+};
+
+// Supported URLs are `http://host[:port]/path`, where entries are fetched with GET and uploaded with PUT requests to
+// `<url>/<key>` (works with WebDAV, nginx, bazel-remote style servers and S3 compatible gateways that accept
+// unsigned requests), and `file:///path` for a directory on a network share. Returns nullptr and prints an error
+// for malformed or unsupported URLs.
+//
+// With `is_filtered` the remote keeps a Bloom filter of its keys as the entry of the all-zero key, which no job key is
+// in practice. The filter is downloaded by the first lookup and again once it's a minute old, and lookups of keys it
+// rejects miss without a request. Keys uploaded by the process are added to it, and `finish` merges them into the
+// filter of the remote. Entries uploaded without a filter are rejected once a filter exists, so every process writing to
+// the remote must use one.
+std::unique_ptr<RemoteCache> create_remote_cache(const std::string& url, bool is_filtered, std::ostream& log);
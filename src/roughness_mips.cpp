@@ -0,0 +1,115 @@
+#include "roughness_mips.h"
+
+#include "thread_pool.h"
+
+#include <algorithm>
+#include <cmath>
+
+// Rows of level 1 averaged by a single task.
+static constexpr size_t TASK_ROWS = 64;
+
+// Average normals whose length is this close to one are treated as flat, so rounding doesn't roughen smooth areas.
+static constexpr float FLAT_LENGTH = 0.9999f;
+
+namespace {
+
+struct Normal final {
+    float x;
+    float y;
+    float z;
+};
+
+} // namespace
+
+static Normal decode_normal(const uint8_t* pixel) noexcept {
+    const float x = static_cast<float>(pixel[0]) / 255.f * 2.f - 1.f;
+    const float y = static_cast<float>(pixel[1]) / 255.f * 2.f - 1.f;
+    const float z = std::sqrt(std::max(1.f - x * x - y * y, 0.f));
+
+    // Broken pixels outside of the unit circle are normalized like the normal chain normalizes them.
+    const float length = std::sqrt(x * x + y * y + z * z);
+    if (length == 0.f) {
+        return { 0.f, 0.f, 1.f };
+    }
+    return { x / length, y / length, z / length };
+}
+
+static Normal average(const Normal& a, const Normal& b, const Normal& c, const Normal& d) noexcept {
+    return { 0.25f * ((a.x + b.x) + (c.x + d.x)), 0.25f * ((a.y + b.y) + (c.y + d.y)), 0.25f * ((a.z + b.z) + (c.z + d.z)) };
+}
+
+static float get_length(const Normal& normal) noexcept {
+    return std::sqrt(normal.x * normal.x + normal.y * normal.y + normal.z * normal.z);
+}
+
+std::vector<std::vector<float>> compute_normal_lengths(const uint8_t* rgba, size_t width, size_t height, ThreadPool& pool) {
+    std::vector<std::vector<float>> result;
+    if (width <= 1 && height <= 1) {
+        return result;
+    }
+
+    // Images one pixel wide or tall average pairs, which is the same as averaging every pixel of the pair twice.
+    size_t level_width = std::max<size_t>(width / 2, 1);
+    size_t level_height = std::max<size_t>(height / 2, 1);
+    std::vector<Normal> normals(level_width * level_height);
+
+    TaskGroup group;
+    for (size_t row_begin = 0; row_begin < level_height; row_begin += TASK_ROWS) {
+        const size_t row_end = std::min(row_begin + TASK_ROWS, level_height);
+        pool.push(group, [=, &normals] {
+            for (size_t y = row_begin; y < row_end; y++) {
+                const uint8_t* top = rgba + std::min(y * 2, height - 1) * width * 4;
+                const uint8_t* bottom = rgba + std::min(y * 2 + 1, height - 1) * width * 4;
+                for (size_t x = 0; x < level_width; x++) {
+                    const size_t left = std::min(x * 2, width - 1) * 4;
+                    const size_t right = std::min(x * 2 + 1, width - 1) * 4;
+                    normals[y * level_width + x] = average(decode_normal(top + left), decode_normal(top + right), decode_normal(bottom + left), decode_normal(bottom + right));
+                }
+            }
+        });
+    }
+    pool.wait(group);
+
+    while (true) {
+        std::vector<float>& lengths = result.emplace_back(normals.size());
+        for (size_t i = 0; i < normals.size(); i++) {
+            lengths[i] = get_length(normals[i]);
+        }
+
+        if (level_width == 1 && level_height == 1) {
+            return result;
+        }
+
+        // Normals of the next level are averages of the unnormalized averages, so every level averages the unit
+        // normals of its whole footprint on level 0.
+        const size_t next_width = std::max<size_t>(level_width / 2, 1);
+        const size_t next_height = std::max<size_t>(level_height / 2, 1);
+        std::vector<Normal> next(next_width * next_height);
+        for (size_t y = 0; y < next_height; y++) {
+            const Normal* top = normals.data() + std::min(y * 2, level_height - 1) * level_width;
+            const Normal* bottom = normals.data() + std::min(y * 2 + 1, level_height - 1) * level_width;
+            for (size_t x = 0; x < next_width; x++) {
+                const size_t left = std::min(x * 2, level_width - 1);
+                const size_t right = std::min(x * 2 + 1, level_width - 1);
+                next[y * next_width + x] = average(top[left], top[right], bottom[left], bottom[right]);
+            }
+        }
+
+        normals = std::move(next);
+        level_width = next_width;
+        level_height = next_height;
+    }
+}
+
+void apply_toksvig(const float* normal_lengths, size_t pixel_count, float* roughness) noexcept {
+    for (size_t i = 0; i < pixel_count; i++) {
+        const float length = std::min(normal_lengths[i], 1.f);
+        if (length >= FLAT_LENGTH) {
+            continue;
+        }
+
+        const float value = std::min(std::max(roughness[i], 0.f), 1.f);
+        const float variance = 2.f * (1.f - length) / std::max(length, 1e-4f);
+        roughness[i] = std::sqrt(std::sqrt(std::min((value * value) * (value * value) + variance, 1.f)));
+    }
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+struct ThreadPool;
+
+// Lengths of the average of the unit normals under every pixel of mip levels 1 and below of a normal map, from level 1
+// to the single pixel level. Normals are reconstructed from the red and green channels of RGBA8 pixels like
+// `reconstruct_normal_z` does. The more the normals under a pixel diverge, the shorter their average is. Rows of level
+// 1 are averaged on the thread pool.
+std::vector<std::vector<float>> compute_normal_lengths(const uint8_t* rgba, size_t width, size_t height, ThreadPool& pool);
+
+// Widens perceptual roughness by the variance of the normals that downsampling averaged away. Toksvig's factor
+// `length / (length + power * (1 - length))` of the Blinn-Phong power becomes `alpha^2 + 2 * (1 - length) / length`
+// for GGX alpha squared, which is the fourth power of perceptual roughness.
+void apply_toksvig(const float* normal_lengths, size_t pixel_count, float* roughness) noexcept;
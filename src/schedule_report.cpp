@@ -0,0 +1,174 @@
+#include "schedule_report.h"
+#include "metrics.h"
+
+#include <algorithm>
+#include <iomanip>
+
+// Waits shorter than this are the scheduler's own latency rather than waiting for something.
+static constexpr double MIN_WAIT_SECONDS = 0.001;
+
+// Jobs that waited at a stage, how long in total and at most.
+struct StageWaits final {
+    const char* name;
+    size_t jobs = 0;
+    double seconds = 0.0;
+    double max_seconds = 0.0;
+};
+
+static void add_wait(StageWaits& waits, double seconds) noexcept {
+    if (seconds >= MIN_WAIT_SECONDS) {
+        waits.jobs++;
+        waits.seconds += seconds;
+        waits.max_seconds = std::max(waits.max_seconds, seconds);
+    }
+}
+
+// Waits of the jobs for the memory budget and, once admitted, for a thread.
+static void get_stage_waits(const std::vector<ScheduledJob>& jobs, StageWaits& memory, StageWaits& queue) noexcept {
+    memory = StageWaits { "memory" };
+    queue = StageWaits { "queue" };
+    for (const ScheduledJob& job : jobs) {
+        add_wait(memory, job.admitted_seconds - job.ready_seconds);
+        add_wait(queue, job.start_seconds - job.admitted_seconds);
+    }
+}
+
+void ScheduleReport::find_critical_path() {
+    critical_path.clear();
+    if (jobs.empty()) {
+        return;
+    }
+
+    size_t current = 0;
+    for (size_t i = 1; i < jobs.size(); i++) {
+        if (jobs[i].end_seconds > jobs[current].end_seconds) {
+            current = i;
+        }
+    }
+
+    std::vector<bool> is_on_path(jobs.size(), false);
+    while (true) {
+        critical_path.push_back(current);
+        is_on_path[current] = true;
+        if (jobs[current].start_seconds < MIN_WAIT_SECONDS) {
+            break;
+        }
+
+        size_t previous = jobs.size();
+        for (size_t i = 0; i < jobs.size(); i++) {
+            if (!is_on_path[i] && jobs[i].end_seconds <= jobs[current].start_seconds + MIN_WAIT_SECONDS && (previous == jobs.size() || jobs[i].end_seconds > jobs[previous].end_seconds)) {
+                previous = i;
+            }
+        }
+        if (previous == jobs.size()) {
+            break;
+        }
+        current = previous;
+    }
+    std::reverse(critical_path.begin(), critical_path.end());
+}
+
+void ScheduleReport::print(std::ostream& stream) const {
+    size_t gpu_bound_jobs = 0;
+    for (const ScheduledJob& job : jobs) {
+        gpu_bound_jobs += job.is_gpu_bound ? 1 : 0;
+    }
+    StageWaits memory, queue;
+    get_stage_waits(jobs, memory, queue);
+
+    stream << std::fixed << std::setprecision(2);
+    stream << "Schedule of " << jobs.size() << " jobs on " << threads.size() << " threads over " << wall_seconds << " seconds:" << std::endl;
+    stream << "  Threads busy:";
+    for (const ScheduledThread& thread : threads) {
+        const double share = wall_seconds > 0.0 ? std::min(thread.busy_seconds / wall_seconds, 1.0) : 0.0;
+        stream << " " << thread.name << " " << std::setprecision(0) << share * 100.0 << "%" << std::setprecision(2);
+    }
+    stream << std::endl;
+    for (const StageWaits* waits : { &memory, &queue }) {
+        stream << "  Waits for " << (waits == &memory ? "the memory budget: " : "a thread: ") << waits->jobs << " jobs, " << waits->seconds << " s in total, " << waits->max_seconds << " s at most." << std::endl;
+    }
+    stream << "  Tasks: " << task_count << ", waited " << (task_count != 0 ? task_wait_seconds / static_cast<double>(task_count) * 1000.0 : 0.0) << " ms on average for a thread, " << max_task_wait_seconds * 1000.0 << " ms at most." << std::endl;
+    stream << "  Jobs: " << jobs.size() - gpu_bound_jobs << " CPU-bound, " << gpu_bound_jobs << " GPU-bound." << std::endl;
+
+    if (!critical_path.empty()) {
+        stream << "  Critical path ending at " << jobs[critical_path.back()].end_seconds << " s, start and duration of its jobs:" << std::endl;
+        double previous_end = 0.0;
+        for (const size_t i : critical_path) {
+            const ScheduledJob& job = jobs[i];
+            stream << "    " << std::setw(8) << job.start_seconds << " s " << std::setw(8) << job.end_seconds - job.start_seconds << " s " << (job.is_gpu_bound ? "GPU" : "CPU") << "  job " << job.index + 1 << " " << job.output;
+            if (job.start_seconds - previous_end >= MIN_WAIT_SECONDS) {
+                stream << ", started " << job.start_seconds - previous_end << " s after " << (i == critical_path.front() ? "the build" : "the previous job");
+            }
+            if (job.admitted_seconds - job.ready_seconds >= MIN_WAIT_SECONDS) {
+                stream << ", waited " << job.admitted_seconds - job.ready_seconds << " s for memory";
+            }
+            stream << std::endl;
+            previous_end = job.end_seconds;
+        }
+    }
+    stream << std::defaultfloat;
+}
+
+void ScheduleReport::write_json(std::ostream& stream, const std::string& indent) const {
+    StageWaits memory, queue;
+    get_stage_waits(jobs, memory, queue);
+
+    stream << "{\n";
+    stream << indent << "  \"wall_seconds\": " << wall_seconds << ",\n";
+    stream << indent << "  \"memory_budget\": " << memory_budget << ",\n";
+    stream << indent << "  \"threads\": [";
+    for (size_t i = 0; i < threads.size(); i++) {
+        stream << (i == 0 ? "\n" : ",\n") << indent << "    { \"name\": ";
+        write_json_string(stream, threads[i].name);
+        stream << ", \"busy_seconds\": " << threads[i].busy_seconds << ", \"idle_seconds\": " << std::max(wall_seconds - threads[i].busy_seconds, 0.0) << " }";
+    }
+    stream << (threads.empty() ? "],\n" : "\n" + indent + "  ],\n");
+
+    stream << indent << "  \"waits\": [";
+    for (const StageWaits* waits : { &memory, &queue }) {
+        stream << (waits == &memory ? "\n" : ",\n") << indent << "    { \"stage\": \"" << waits->name << "\", \"jobs\": " << waits->jobs << ", \"seconds\": " << waits->seconds << ", \"max_seconds\": " << waits->max_seconds << " }";
+    }
+    stream << ",\n" << indent << "    { \"stage\": \"tasks\", \"tasks\": " << task_count << ", \"seconds\": " << task_wait_seconds << ", \"max_seconds\": " << max_task_wait_seconds << " }";
+    stream << "\n" << indent << "  ],\n";
+
+    stream << indent << "  \"jobs\": [";
+    for (size_t i = 0; i < jobs.size(); i++) {
+        const ScheduledJob& job = jobs[i];
+        stream << (i == 0 ? "\n" : ",\n") << indent << "    { \"job\": " << job.index + 1 << ", \"output\": ";
+        write_json_string(stream, job.output);
+        stream << ", \"ready_seconds\": " << job.ready_seconds << ", \"admitted_seconds\": " << job.admitted_seconds << ", \"start_seconds\": " << job.start_seconds << ", \"end_seconds\": " << job.end_seconds
+               << ", \"gpu_wait_seconds\": " << job.gpu_wait_seconds << ", \"bound\": \"" << (job.is_gpu_bound ? "gpu" : "cpu") << "\" }";
+    }
+    stream << (jobs.empty() ? "],\n" : "\n" + indent + "  ],\n");
+
+    stream << indent << "  \"critical_path\": [";
+    for (size_t i = 0; i < critical_path.size(); i++) {
+        stream << (i == 0 ? "" : ", ") << jobs[critical_path[i]].index + 1;
+    }
+    stream << "]\n" << indent << "}";
+}
+
+void ScheduleRecorder::record_job(const JobMetrics& job) {
+    if (job.outputs.empty()) {
+        return;
+    }
+
+    // Read backs wait for the GPU to finish the views they read, the rest of a cube map job is the CPU's.
+    double seconds = 0.0;
+    static constexpr const char* READBACK = "readback";
+    for (const PhaseMetrics& phase : job.phases) {
+        const size_t length = std::char_traits<char>::length(READBACK);
+        if (phase.name.size() >= length && phase.name.compare(phase.name.size() - length, length, READBACK) == 0) {
+            seconds += phase.wall_seconds;
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    gpu_wait_seconds[job.outputs.front()] = seconds;
+}
+
+double ScheduleRecorder::get_gpu_wait_seconds(const std::string& output) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    const auto it = gpu_wait_seconds.find(output);
+    return it != gpu_wait_seconds.end() ? it->second : 0.0;
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+struct JobMetrics;
+
+// Why a manifest build took as long as it did, printed by `--schedule-report` and written as the `schedule` of
+// `--metrics`, for tuning `--jobs` and `--memory-budget`: how busy every thread was, how long jobs waited for the
+// memory budget and for a thread, which jobs waited on the GPU, and the chain of jobs that bounded the wall time. Times
+// are in seconds since the build started.
+
+// A job of the schedule. The scheduler gets to it at `ready_seconds`, the memory budget admits it at
+// `admitted_seconds` and a thread starts compiling it at `start_seconds`.
+struct ScheduledJob final {
+    size_t index = 0;
+    std::string output;
+    double ready_seconds = 0.0;
+    double admitted_seconds = 0.0;
+    double start_seconds = 0.0;
+    double end_seconds = 0.0;
+
+    // Time the read back phases of the job waited for the GPU, zero for 2D jobs and cube maps rendered on the CPU. A
+    // job that waited for the GPU for half of its time or more is GPU-bound.
+    double gpu_wait_seconds = 0.0;
+    bool is_gpu_bound = false;
+};
+
+// CPU time a thread spent during the build, the rest of the wall time it was idle or blocked.
+struct ScheduledThread final {
+    std::string name;
+    double busy_seconds = 0.0;
+};
+
+struct ScheduleReport final {
+    // Finds the critical path: the job that finished last, the job whose end let it start, and so on back to a job
+    // that started with the build. A job was let in by the end of another when it waited for the budget or a thread,
+    // or the scheduler only got to it late, and the latest end before its start is the one that freed what it needed.
+    void find_critical_path();
+
+    void print(std::ostream& stream) const;
+
+    // Writes the report as a JSON object, its lines indented by `indent`.
+    void write_json(std::ostream& stream, const std::string& indent) const;
+
+    double wall_seconds = 0.0;
+    size_t memory_budget = 0;
+    std::vector<ScheduledThread> threads;
+    std::vector<ScheduledJob> jobs;
+
+    // Tasks of the pool, jobs and the blocks, mip levels and faces they push, and how long they waited for a thread.
+    uint64_t task_count = 0;
+    double task_wait_seconds = 0.0;
+    double max_task_wait_seconds = 0.0;
+
+    // Indices of `jobs`, from the first job of the critical path to the last.
+    std::vector<size_t> critical_path;
+};
+
+// GPU waits of the jobs compiled while a manifest schedule is recorded, by main output. `compile` records every job.
+struct ScheduleRecorder final {
+    void record_job(const JobMetrics& job);
+
+    double get_gpu_wait_seconds(const std::string& output) const;
+
+    // Set by `--schedule-report`, otherwise the report is only written to `--metrics`.
+    bool is_printed = false;
+
+private:
+    mutable std::mutex mutex;
+    std::unordered_map<std::string, double> gpu_wait_seconds;
+};
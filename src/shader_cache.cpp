@@ -0,0 +1,109 @@
+#include "shader_cache.h"
+#include "atomic_file.h"
+
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <system_error>
+
+namespace fs = std::filesystem;
+
+static std::string to_hex(uint64_t value, int digits) {
+    char buffer[17];
+    std::snprintf(buffer, sizeof(buffer), "%0*llx", digits, static_cast<unsigned long long>(value));
+    return buffer;
+}
+
+ShaderCache::ShaderCache(std::string directory) noexcept
+        : directory(std::move(directory)) {
+}
+
+void ShaderCache::set_renderer(bgfx::RendererType::Enum renderer_type, uint16_t vendor_id, uint16_t device_id) {
+    std::string name = bgfx::getRendererName(renderer_type);
+    for (char& character : name) {
+        if (!std::isalnum(static_cast<unsigned char>(character))) {
+            character = '_';
+        }
+    }
+    prefix = name + "_" + to_hex(vendor_id, 4) + "_" + to_hex(device_id, 4) + "_";
+}
+
+// Same as the default bgfx callback, which aborts on anything but debug checks.
+void ShaderCache::fatal(const char* /*file_path*/, uint16_t /*line*/, bgfx::Fatal::Enum code, const char* message) {
+    if (code != bgfx::Fatal::DebugCheck) {
+        std::cout << "Texture compiler error. Renderer failed: " << message << std::endl;
+        std::abort();
+    }
+}
+
+void ShaderCache::traceVargs(const char* /*file_path*/, uint16_t /*line*/, const char* /*format*/, va_list /*arguments*/) {
+}
+
+void ShaderCache::profilerBegin(const char* /*name*/, uint32_t /*abgr*/, const char* /*file_path*/, uint16_t /*line*/) {
+}
+
+void ShaderCache::profilerBeginLiteral(const char* /*name*/, uint32_t /*abgr*/, const char* /*file_path*/, uint16_t /*line*/) {
+}
+
+void ShaderCache::profilerEnd() {
+}
+
+uint32_t ShaderCache::cacheReadSize(uint64_t id) {
+    if (prefix.empty()) {
+        return 0;
+    }
+
+    std::error_code error;
+    const uintmax_t size = fs::file_size(fs::path(directory) / (prefix + to_hex(id, 16) + ".bin"), error);
+    if (error || size > UINT32_MAX) {
+        return 0;
+    }
+    return static_cast<uint32_t>(size);
+}
+
+bool ShaderCache::cacheRead(uint64_t id, void* data, uint32_t size) {
+    if (prefix.empty()) {
+        return false;
+    }
+
+    std::ifstream stream(fs::path(directory) / (prefix + to_hex(id, 16) + ".bin"), std::ios::binary);
+    return stream && stream.read(static_cast<char*>(data), size) && stream.gcount() == static_cast<std::streamsize>(size);
+}
+
+// Files are replaced atomically, so processes sharing the directory never load a partially written binary.
+void ShaderCache::cacheWrite(uint64_t id, const void* data, uint32_t size) {
+    if (prefix.empty()) {
+        return;
+    }
+
+    std::error_code error;
+    fs::create_directories(directory, error);
+
+    const std::string path = (fs::path(directory) / (prefix + to_hex(id, 16) + ".bin")).string();
+    const std::string temporary_path = get_temporary_path(path);
+    {
+        std::ofstream stream(temporary_path, std::ios::binary);
+        if (!stream || !stream.write(static_cast<const char*>(data), size)) {
+            stream.close();
+            fs::remove(temporary_path, error);
+            return;
+        }
+    }
+    replace_file(temporary_path, path);
+}
+
+void ShaderCache::screenShot(const char* /*file_path*/, uint32_t /*width*/, uint32_t /*height*/, uint32_t /*pitch*/, const void* /*data*/, uint32_t /*size*/, bool /*is_y_flipped*/) {
+}
+
+void ShaderCache::captureBegin(uint32_t /*width*/, uint32_t /*height*/, uint32_t /*pitch*/, bgfx::TextureFormat::Enum /*format*/, bool /*is_y_flipped*/) {
+}
+
+void ShaderCache::captureEnd() {
+}
+
+void ShaderCache::captureFrame(const void* /*data*/, uint32_t /*size*/) {
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <bgfx/bgfx.h>
+#include <string>
+
+// Program binaries and pipeline caches bgfx asks its callback for, kept as files in a directory so the next process
+// doesn't compile the embedded shaders again. OpenGL stores linked program binaries, Vulkan and D3D12 store pipeline
+// caches, other renderers never ask. Files are named by the renderer, the GPU and the id bgfx hashes from the shaders
+// and the pipeline state, so a cache shared by machines or drivers only misses. Drivers validate the binaries they
+// load, and bgfx compiles the shaders as usual when they reject one.
+struct ShaderCache final : bgfx::CallbackI {
+    explicit ShaderCache(std::string directory) noexcept;
+
+    ShaderCache(const ShaderCache&) = delete;
+    ShaderCache(ShaderCache&&) = delete;
+    ShaderCache& operator=(const ShaderCache&) = delete;
+    ShaderCache& operator=(ShaderCache&&) = delete;
+
+    // Names files after the renderer and the GPU, must be called once bgfx is initialized and before any shader is created.
+    void set_renderer(bgfx::RendererType::Enum renderer_type, uint16_t vendor_id, uint16_t device_id);
+
+    void fatal(const char* file_path, uint16_t line, bgfx::Fatal::Enum code, const char* message) override;
+    void traceVargs(const char* file_path, uint16_t line, const char* format, va_list arguments) override;
+    void profilerBegin(const char* name, uint32_t abgr, const char* file_path, uint16_t line) override;
+    void profilerBeginLiteral(const char* name, uint32_t abgr, const char* file_path, uint16_t line) override;
+    void profilerEnd() override;
+    uint32_t cacheReadSize(uint64_t id) override;
+    bool cacheRead(uint64_t id, void* data, uint32_t size) override;
+    void cacheWrite(uint64_t id, const void* data, uint32_t size) override;
+    void screenShot(const char* file_path, uint32_t width, uint32_t height, uint32_t pitch, const void* data, uint32_t size, bool is_y_flipped) override;
+    void captureBegin(uint32_t width, uint32_t height, uint32_t pitch, bgfx::TextureFormat::Enum format, bool is_y_flipped) override;
+    void captureEnd() override;
+    void captureFrame(const void* data, uint32_t size) override;
+
+    std::string directory;
+
+    // Empty until `set_renderer`, nothing is read or written before.
+    std::string prefix;
+};
@@ -0,0 +1,100 @@
+#include "spherical_harmonics.h"
+#include "cube_map_kernels.h"
+
+#include <algorithm>
+#include <cmath>
+
+// Solid angle of the face region from the face center to the specified point.
+static float get_area_element(float u, float v) noexcept {
+    return std::atan2(u * v, std::sqrt(u * u + v * v + 1.f));
+}
+
+static void evaluate_basis(float x, float y, float z, float (&basis)[9]) noexcept {
+    basis[0] = 0.282095f;
+    basis[1] = 0.488603f * y;
+    basis[2] = 0.488603f * z;
+    basis[3] = 0.488603f * x;
+    basis[4] = 1.092548f * x * y;
+    basis[5] = 1.092548f * y * z;
+    basis[6] = 0.315392f * (3.f * z * z - 1.f);
+    basis[7] = 1.092548f * x * z;
+    basis[8] = 0.546274f * (x * x - y * y);
+}
+
+SphericalHarmonics project_cube_map(const float* const faces[6][3], size_t size) noexcept {
+    // Accumulate in double, a 64 x 64 cube map is already 24K texels per coefficient.
+    double sums[9][3] = {};
+    double total_weight = 0.0;
+
+    const float texel_size = 2.f / static_cast<float>(size);
+    for (int face = 0; face < 6; face++) {
+        for (size_t row = 0; row < size; row++) {
+            for (size_t column = 0; column < size; column++) {
+                const float u = (static_cast<float>(column) + 0.5f) * texel_size - 1.f;
+                const float v = (static_cast<float>(row) + 0.5f) * texel_size - 1.f;
+
+                const float u0 = u - texel_size * 0.5f, u1 = u + texel_size * 0.5f;
+                const float v0 = v - texel_size * 0.5f, v1 = v + texel_size * 0.5f;
+                const float weight = get_area_element(u0, v0) - get_area_element(u0, v1) - get_area_element(u1, v0) + get_area_element(u1, v1);
+
+                float x, y, z;
+                get_cube_map_direction(face, u, v, x, y, z);
+
+                float basis[9];
+                evaluate_basis(x, y, z, basis);
+
+                const size_t index = row * size + column;
+                for (int channel = 0; channel < 3; channel++) {
+                    const double radiance = static_cast<double>(faces[face][channel][index]) * weight;
+                    for (int coefficient = 0; coefficient < 9; coefficient++) {
+                        sums[coefficient][channel] += radiance * basis[coefficient];
+                    }
+                }
+                total_weight += weight;
+            }
+        }
+    }
+
+    // Texel solid angles add up to 4 pi up to rounding errors.
+    const double normalization = 4.0 * 3.14159265358979323846 / total_weight;
+
+    SphericalHarmonics result;
+    for (int coefficient = 0; coefficient < 9; coefficient++) {
+        for (int channel = 0; channel < 3; channel++) {
+            result.coefficients[coefficient][channel] = static_cast<float>(sums[coefficient][channel] * normalization);
+        }
+    }
+    return result;
+}
+
+void evaluate_irradiance(const SphericalHarmonics& harmonics, int face, size_t size, float* red, float* green, float* blue) noexcept {
+    // Cosine lobe convolution of every band (pi, 2 pi / 3, pi / 4), divided by pi.
+    static const float BAND_FACTORS[9] = { 1.f, 2.f / 3.f, 2.f / 3.f, 2.f / 3.f, 0.25f, 0.25f, 0.25f, 0.25f, 0.25f };
+
+    float* const planes[3] = { red, green, blue };
+
+    const float texel_size = 2.f / static_cast<float>(size);
+    for (size_t row = 0; row < size; row++) {
+        for (size_t column = 0; column < size; column++) {
+            const float u = (static_cast<float>(column) + 0.5f) * texel_size - 1.f;
+            const float v = (static_cast<float>(row) + 0.5f) * texel_size - 1.f;
+
+            float x, y, z;
+            get_cube_map_direction(face, u, v, x, y, z);
+
+            float basis[9];
+            evaluate_basis(x, y, z, basis);
+
+            const size_t index = row * size + column;
+            for (int channel = 0; channel < 3; channel++) {
+                float irradiance = 0.f;
+                for (int coefficient = 0; coefficient < 9; coefficient++) {
+                    irradiance += BAND_FACTORS[coefficient] * harmonics.coefficients[coefficient][channel] * basis[coefficient];
+                }
+
+                // Ringing of a bright light source can make the truncated series negative on the opposite side.
+                planes[channel][index] = std::max(irradiance, 0.f);
+            }
+        }
+    }
+}
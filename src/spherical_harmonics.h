@@ -0,0 +1,17 @@
+#pragma once
+
+#include <cstddef>
+
+// Radiance projected onto the first three bands of real spherical harmonics, one RGB triple per coefficient.
+struct SphericalHarmonics final {
+    float coefficients[9][3] = {};
+};
+
+// Cube map faces are `size` x `size` float planes, with red, green and blue planes of a face following each other.
+// Faces follow the DDS order and orientation, which is also what both the projection and the evaluation assume, so
+// the result doesn't depend on the convention as long as the same one is used for both.
+SphericalHarmonics project_cube_map(const float* const faces[6][3], size_t size) noexcept;
+
+// Evaluates cosine convolved radiance on a cube map face, divided by pi, so a constant environment of 1 produces 1,
+// same as the irradiance shader.
+void evaluate_irradiance(const SphericalHarmonics& harmonics, int face, size_t size, float* red, float* green, float* blue) noexcept;
@@ -0,0 +1,311 @@
+#include "texture_compiler_c.h"
+#include "compiler.h"
+
+#include <algorithm>
+#include <memory>
+#include <new>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+struct TextureCompilerContext final {
+    explicit TextureCompilerContext(const CompilerSettings& settings)
+            : context(settings) {
+    }
+
+    CompilerContext context;
+
+    // Only this thread may compile cube maps, see `CompilerSettings`.
+    std::thread::id thread = std::this_thread::get_id();
+};
+
+struct TextureCompilerResult final {
+    std::vector<std::pair<std::string, std::string>> outputs;
+    std::string log;
+};
+
+// Names of the outputs, which only tell them apart since nothing is written to files.
+static constexpr const char* TEXTURE_OUTPUT = "texture";
+static constexpr const char* IRRADIANCE_OUTPUT = "irradiance";
+static constexpr const char* PREFILTER_OUTPUT = "prefilter";
+
+// Fields the caller's `TextureCompilerJob` has, the ones it doesn't know keep their defaults.
+static TextureCompilerJob read_job(const TextureCompilerJob& job) noexcept {
+    TextureCompilerJob result;
+    texture_compiler_job_init(&result);
+    std::copy_n(reinterpret_cast<const char*>(&job), std::min<size_t>(job.size, sizeof(TextureCompilerJob)), reinterpret_cast<char*>(&result));
+    result.size = sizeof(TextureCompilerJob);
+    return result;
+}
+
+// Validates the options like the command line does and fills `job` with them. Errors are printed to `log`.
+static bool create_compile_job(const TextureCompilerJob& options, CompileJob& job, std::ostream& log) {
+    switch (options.kind) {
+        case TEXTURE_COMPILER_ALBEDO_ROUGHNESS:
+            job.kind = TextureKind::ALBEDO_ROUGHNESS;
+            break;
+        case TEXTURE_COMPILER_NORMAL_METALNESS_AMBIENT_OCCLUSION:
+            job.kind = TextureKind::NORMAL_METALNESS_AMBIENT_OCCLUSION;
+            break;
+        case TEXTURE_COMPILER_PARALLAX:
+            job.kind = TextureKind::PARALLAX;
+            break;
+        case TEXTURE_COMPILER_CUBE_MAP:
+            job.kind = TextureKind::CUBE_MAP;
+            break;
+        default:
+            log << "Texture compiler error. Job kind " << options.kind << " is not supported." << std::endl;
+            return false;
+    }
+
+    switch (options.compression) {
+        case TEXTURE_COMPILER_PRODUCTION:
+            job.compression = Compression::GOOD_BUT_SLOW;
+            break;
+        case TEXTURE_COMPILER_DEVELOPMENT:
+            job.compression = Compression::POOR_BUT_FAST;
+            break;
+        case TEXTURE_COMPILER_NO_COMPRESSION:
+            job.compression = Compression::NO_COMPRESSION;
+            break;
+        default:
+            log << "Texture compiler error. Job compression " << options.compression << " is not supported." << std::endl;
+            return false;
+    }
+
+    static constexpr nvtt::Quality QUALITIES[] = { nvtt::Quality_Fastest, nvtt::Quality_Normal, nvtt::Quality_Production, nvtt::Quality_Highest };
+    if (options.quality < 0 || options.quality > TEXTURE_COMPILER_QUALITY_HIGHEST || options.encoder < 0 || options.encoder > TEXTURE_COMPILER_ENCODER_FAST) {
+        log << "Texture compiler error. Job quality must be fastest, normal, production or highest and its encoder nvtt or fast." << std::endl;
+        return false;
+    }
+    job.quality = QUALITIES[options.quality];
+    job.encoder = options.encoder == TEXTURE_COMPILER_ENCODER_FAST ? Encoder::FAST : Encoder::NVTT;
+
+    job.output = TEXTURE_OUTPUT;
+    if (job.kind == TextureKind::CUBE_MAP) {
+        if (options.output_size == 0 || options.output_size > 65535 || options.irradiance_size > 65535 || options.prefilter_size > 65535) {
+            log << "Texture compiler error. Cube map output size must be from 1 to 65535, irradiance and prefilter sizes up to 65535." << std::endl;
+            return false;
+        }
+        if (options.prefilter_samples > PREFILTER_MAX_SAMPLE_COUNT) {
+            log << "Texture compiler error. Number of prefilter samples must be at most " << PREFILTER_MAX_SAMPLE_COUNT << "." << std::endl;
+            return false;
+        }
+
+        job.output_size = options.output_size;
+        if (options.irradiance_size != 0) {
+            job.output_irradiance = IRRADIANCE_OUTPUT;
+            job.output_irradiance_size = options.irradiance_size;
+        }
+        if (options.prefilter_size != 0) {
+            job.output_prefilter = PREFILTER_OUTPUT;
+            job.output_prefilter_size = options.prefilter_size;
+        }
+        job.prefilter_samples = options.prefilter_samples != 0 ? options.prefilter_samples : PREFILTER_MAX_SAMPLE_COUNT;
+        return true;
+    }
+
+    switch (options.target) {
+        case TEXTURE_COMPILER_TARGET_BC:
+            job.target = Target::BC;
+            break;
+        case TEXTURE_COMPILER_TARGET_ETC2:
+            job.target = Target::ETC2;
+            break;
+        case TEXTURE_COMPILER_TARGET_ASTC:
+            job.target = Target::ASTC;
+            break;
+        default:
+            log << "Texture compiler error. Job target must be bc, etc2 or astc." << std::endl;
+            return false;
+    }
+
+    if (options.container != TEXTURE_COMPILER_CONTAINER_DDS && options.container != TEXTURE_COMPILER_CONTAINER_KTX2) {
+        log << "Texture compiler error. Job container must be dds or ktx2." << std::endl;
+        return false;
+    }
+    job.container = options.container == TEXTURE_COMPILER_CONTAINER_KTX2 ? Container::KTX2 : Container::DDS;
+    if (job.target != Target::BC && job.container == Container::DDS) {
+        log << "Texture compiler error. DDS container doesn't support ETC2 and ASTC, use ktx2." << std::endl;
+        return false;
+    }
+
+    job.max_size = options.max_size;
+    job.mip_count = options.mip_count;
+    job.is_linear_mip_filtering = options.is_linear_mip_filtering != 0 && job.kind == TextureKind::ALBEDO_ROUGHNESS;
+    return true;
+}
+
+// Compiles the job with `compile`, which gets the job and a sink, into a new result. Returns zero on success.
+template <typename Compile>
+static int compile_job(TextureCompilerContext* context, const TextureCompilerJob* options, TextureCompilerResult** result, Compile&& compile) noexcept {
+    if (result == nullptr) {
+        return 1;
+    }
+    *result = new (std::nothrow) TextureCompilerResult();
+    if (*result == nullptr) {
+        return 1;
+    }
+
+    try {
+        std::ostringstream log;
+        CompileJob job;
+        int status = 1;
+        if (context == nullptr || options == nullptr) {
+            log << "Texture compiler error. Context and job must not be null." << std::endl;
+        } else if (create_compile_job(read_job(*options), job, log)) {
+            if (job.kind == TextureKind::CUBE_MAP && std::this_thread::get_id() != context->thread) {
+                log << "Texture compiler error. Cube maps can only be compiled on the thread that created the context." << std::endl;
+            } else {
+                const OutputSink sink = [&result](const std::string& output, const char* data, size_t size) {
+                    (*result)->outputs.emplace_back(output, std::string(data, size));
+                };
+                status = compile(context->context, job, sink, log);
+            }
+        }
+
+        // Outputs of a failed job are never handed out.
+        if (status != 0) {
+            (*result)->outputs.clear();
+        }
+        (*result)->log = log.str();
+        return status;
+    } catch (...) {
+        (*result)->outputs.clear();
+        return 1;
+    }
+}
+
+void texture_compiler_job_init(TextureCompilerJob* job) {
+    *job = TextureCompilerJob();
+    job->size = sizeof(TextureCompilerJob);
+    job->kind = TEXTURE_COMPILER_ALBEDO_ROUGHNESS;
+    job->compression = TEXTURE_COMPILER_DEVELOPMENT;
+    job->quality = TEXTURE_COMPILER_QUALITY_NORMAL;
+    job->encoder = TEXTURE_COMPILER_ENCODER_NVTT;
+    job->target = TEXTURE_COMPILER_TARGET_BC;
+    job->container = TEXTURE_COMPILER_CONTAINER_DDS;
+}
+
+// Pipelines run without a display as often as not, and the renderer needs no window.
+static CompilerSettings get_compiler_settings(uint32_t thread_count) noexcept {
+    CompilerSettings settings;
+    settings.thread_count = thread_count != 0 ? thread_count : std::max(std::thread::hardware_concurrency(), 1U);
+    settings.is_headless = true;
+    return settings;
+}
+
+TextureCompilerContext* texture_compiler_create(uint32_t thread_count) {
+    try {
+        return new TextureCompilerContext(get_compiler_settings(thread_count));
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+TextureCompilerContext* texture_compiler_create_on_device(uint32_t thread_count, int32_t renderer, void* device) {
+    static constexpr RendererApi RENDERERS[] = { RendererApi::D3D11, RendererApi::D3D12, RendererApi::METAL, RendererApi::OPENGL };
+    if (renderer < TEXTURE_COMPILER_RENDERER_D3D11 || renderer > TEXTURE_COMPILER_RENDERER_OPENGL || device == nullptr) {
+        return nullptr;
+    }
+
+    try {
+        CompilerSettings settings = get_compiler_settings(thread_count);
+        settings.backend = Backend::GPU;
+        settings.renderer_api = RENDERERS[renderer];
+        settings.native_device = device;
+        return new TextureCompilerContext(settings);
+    } catch (...) {
+        return nullptr;
+    }
+}
+
+void texture_compiler_destroy(TextureCompilerContext* context) {
+    delete context;
+}
+
+int texture_compiler_compile(TextureCompilerContext* context, const TextureCompilerJob* job, const void* pixels, int32_t format, int32_t width, int32_t height, TextureCompilerResult** result) {
+    return compile_job(context, job, result, [&](CompilerContext& compiler_context, const CompileJob& image_job, const OutputSink& sink, std::ostream& log) {
+        if (format < TEXTURE_COMPILER_RGBA8 || format > TEXTURE_COMPILER_RGBA32F) {
+            log << "Texture compiler error. Pixel format " << format << " is not supported." << std::endl;
+            return 1;
+        }
+
+        static constexpr PixelFormat FORMATS[] = { PixelFormat::RGBA8, PixelFormat::RGBA16, PixelFormat::RGBA32F };
+        ImageView image;
+        image.pixels = pixels;
+        image.format = FORMATS[format];
+        image.width = width;
+        image.height = height;
+        return compile_image(compiler_context, image_job, image, sink, log);
+    });
+}
+
+int texture_compiler_compile_encoded(TextureCompilerContext* context, const TextureCompilerJob* job, const void* data, size_t size, TextureCompilerResult** result) {
+    return compile_job(context, job, result, [&](CompilerContext& compiler_context, const CompileJob& image_job, const OutputSink& sink, std::ostream& log) {
+        return compile_encoded_image(compiler_context, image_job, data, size, sink, log);
+    });
+}
+
+uint32_t texture_compiler_preview_mip_count(const TextureCompilerJob* job, const char* output) {
+    try {
+        std::ostringstream log;
+        CompileJob image_job;
+        if (job == nullptr || output == nullptr || !create_compile_job(read_job(*job), image_job, log)) {
+            return 0;
+        }
+        return static_cast<uint32_t>(get_preview_mip_levels(image_job, output));
+    } catch (...) {
+        return 0;
+    }
+}
+
+int texture_compiler_preview(TextureCompilerContext* context, const TextureCompilerJob* job, const void* pixels, int32_t format, int32_t width, int32_t height,
+                             const TextureCompilerPreviewTexture* textures, size_t texture_count, TextureCompilerResult** result) {
+    return compile_job(context, job, result, [&](CompilerContext& compiler_context, const CompileJob& image_job, const OutputSink& /*sink*/, std::ostream& log) {
+        if (format != TEXTURE_COMPILER_RGBA16 && format != TEXTURE_COMPILER_RGBA32F) {
+            log << "Texture compiler error. Pixel format " << format << " is not supported." << std::endl;
+            return 1;
+        }
+        if (textures == nullptr && texture_count != 0) {
+            log << "Texture compiler error. Preview textures must not be null." << std::endl;
+            return 1;
+        }
+
+        std::vector<PreviewTexture> preview_textures(texture_count);
+        for (size_t i = 0; i < texture_count; i++) {
+            preview_textures[i].output = textures[i].output != nullptr ? textures[i].output : "";
+            preview_textures[i].native_texture = reinterpret_cast<uintptr_t>(textures[i].texture);
+        }
+
+        ImageView image;
+        image.pixels = pixels;
+        image.format = format == TEXTURE_COMPILER_RGBA16 ? PixelFormat::RGBA16 : PixelFormat::RGBA32F;
+        image.width = width;
+        image.height = height;
+        return compile_image_preview(compiler_context, image_job, image, preview_textures, log);
+    });
+}
+
+size_t texture_compiler_result_output_count(const TextureCompilerResult* result) {
+    return result->outputs.size();
+}
+
+const char* texture_compiler_result_output_name(const TextureCompilerResult* result, size_t index) {
+    return result->outputs[index].first.c_str();
+}
+
+const void* texture_compiler_result_output_data(const TextureCompilerResult* result, size_t index, size_t* size) {
+    *size = result->outputs[index].second.size();
+    return result->outputs[index].second.data();
+}
+
+const char* texture_compiler_result_log(const TextureCompilerResult* result) {
+    return result->log.c_str();
+}
+
+void texture_compiler_result_destroy(TextureCompilerResult* result) {
+    delete result;
+}
@@ -0,0 +1,175 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// C interface of the compiler core, for pipelines that compile textures in-process instead of running the executable
+// for every texture, like the Python module `python/texture_compiler.py`. It's the `texture_compiler_c` shared library
+// built with `TEXTURE_COMPILER_C_LIBRARY`. A context owns the thread pool, the compressor and the renderer like the
+// context of the executable, and every job compiled with it shares them. Jobs are compiled from images in the memory
+// of the caller into outputs in memory, nothing is read from or written to files.
+//
+// 2D jobs can be compiled from any number of threads at the same time, the calling thread helps the pool with the
+// blocks of its job. Cube maps render on the renderer, which only the thread that created the context may use.
+//
+// An editor can also create the context on its own graphics device and preview cube maps in textures of its own, which
+// the renderer copies the outputs into without reading them back or encoding them, see `texture_compiler_preview`.
+//
+// The interface only grows: constants keep their values, and fields are only appended to `TextureCompilerJob`, whose
+// `size` tells the library which of them the caller knows.
+
+#if defined(_WIN32)
+#if defined(TEXTURE_COMPILER_C_EXPORTS)
+#define TEXTURE_COMPILER_C_API __declspec(dllexport)
+#else
+#define TEXTURE_COMPILER_C_API __declspec(dllimport)
+#endif
+#else
+#define TEXTURE_COMPILER_C_API __attribute__((visibility("default")))
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Version of the interface, raised whenever something is added to it.
+#define TEXTURE_COMPILER_C_VERSION 2
+
+// Values of `TextureCompilerJob::kind`.
+#define TEXTURE_COMPILER_ALBEDO_ROUGHNESS 0
+#define TEXTURE_COMPILER_NORMAL_METALNESS_AMBIENT_OCCLUSION 1
+#define TEXTURE_COMPILER_PARALLAX 2
+#define TEXTURE_COMPILER_CUBE_MAP 3
+
+// Values of `TextureCompilerJob::compression`, like `--production`, `--development` and `--no-compression`.
+#define TEXTURE_COMPILER_PRODUCTION 0
+#define TEXTURE_COMPILER_DEVELOPMENT 1
+#define TEXTURE_COMPILER_NO_COMPRESSION 2
+
+// Values of `TextureCompilerJob::quality`, like `--quality`.
+#define TEXTURE_COMPILER_QUALITY_FASTEST 0
+#define TEXTURE_COMPILER_QUALITY_NORMAL 1
+#define TEXTURE_COMPILER_QUALITY_PRODUCTION 2
+#define TEXTURE_COMPILER_QUALITY_HIGHEST 3
+
+// Values of `TextureCompilerJob::encoder`, like `--encoder`.
+#define TEXTURE_COMPILER_ENCODER_NVTT 0
+#define TEXTURE_COMPILER_ENCODER_FAST 1
+
+// Values of `TextureCompilerJob::target`, like `--target`.
+#define TEXTURE_COMPILER_TARGET_BC 0
+#define TEXTURE_COMPILER_TARGET_ETC2 1
+#define TEXTURE_COMPILER_TARGET_ASTC 2
+
+// Values of `TextureCompilerJob::container`, like `--container`. ETC2 and ASTC need KTX2.
+#define TEXTURE_COMPILER_CONTAINER_DDS 0
+#define TEXTURE_COMPILER_CONTAINER_KTX2 1
+
+// Formats of the pixels of `texture_compiler_compile`, interleaved RGBA rows top to bottom without padding. 2D
+// textures take RGBA8 and RGBA16, cube maps equirectangular images or crosses of RGBA16 and RGBA32F.
+#define TEXTURE_COMPILER_RGBA8 0
+#define TEXTURE_COMPILER_RGBA16 1
+#define TEXTURE_COMPILER_RGBA32F 2
+
+// Values of the `renderer` of `texture_compiler_create_on_device`, the graphics APIs whose device the renderer shares.
+#define TEXTURE_COMPILER_RENDERER_D3D11 0
+#define TEXTURE_COMPILER_RENDERER_D3D12 1
+#define TEXTURE_COMPILER_RENDERER_METAL 2
+#define TEXTURE_COMPILER_RENDERER_OPENGL 3
+
+// Options of a job, a subset of the command line options of a single texture. Outputs are named `texture`,
+// `irradiance` and `prefilter`.
+typedef struct TextureCompilerJob {
+    // `sizeof(TextureCompilerJob)` of the caller, set by `texture_compiler_job_init`.
+    uint32_t size;
+
+    int32_t kind;
+    int32_t compression;
+    int32_t quality;
+    int32_t encoder;
+    int32_t target;
+    int32_t container;
+
+    // 2D textures only, like `--max-size` and `--mip-count`, zero for no limit and the whole mip chain.
+    uint32_t max_size;
+    uint32_t mip_count;
+
+    // Albedo roughness only, like `--linear-mip-filtering`.
+    int32_t is_linear_mip_filtering;
+
+    // Cube map only, like `--output-size`, `--irradiance-size`, `--prefilter-size` and `--prefilter-samples`. The
+    // irradiance and prefilter outputs are compiled only when their size isn't zero, and zero samples take the default.
+    uint32_t output_size;
+    uint32_t irradiance_size;
+    uint32_t prefilter_size;
+    uint32_t prefilter_samples;
+} TextureCompilerJob;
+
+typedef struct TextureCompilerContext TextureCompilerContext;
+
+// Outputs and messages of a compiled job, owned by the caller until it's destroyed.
+typedef struct TextureCompilerResult TextureCompilerResult;
+
+// Fills the job with the defaults of the command line: an albedo roughness texture with `--development` at normal
+// quality in DDS.
+TEXTURE_COMPILER_C_API void texture_compiler_job_init(TextureCompilerJob* job);
+
+// Creates a context compiling on `thread_count` threads, the calling thread included, zero for the number of hardware
+// threads. Returns null when it can't be created.
+TEXTURE_COMPILER_C_API TextureCompilerContext* texture_compiler_create(uint32_t thread_count);
+
+// Creates a context whose renderer creates its resources on the graphics device of the host, an `ID3D11Device*`, an
+// `ID3D12Device*`, an `id<MTLDevice>` or an OpenGL context of `renderer`, so cube maps can be previewed in textures of
+// the host. The renderer renders on the calling thread then, which must be the thread the host renders on with the
+// device, or at least not render with it at the same time. Otherwise like `texture_compiler_create`.
+TEXTURE_COMPILER_C_API TextureCompilerContext* texture_compiler_create_on_device(uint32_t thread_count, int32_t renderer, void* device);
+
+// Destroys the context, once no job is being compiled with it.
+TEXTURE_COMPILER_C_API void texture_compiler_destroy(TextureCompilerContext* context);
+
+// Compiles an image in the format of `TEXTURE_COMPILER_RGBA8` and the rest. 2D images are compressed straight from
+// `pixels`, which must stay unchanged until the call returns. Returns zero on success. `result` is set either way,
+// with the messages telling why the job failed, and is null only when even that can't be allocated.
+TEXTURE_COMPILER_C_API int texture_compiler_compile(TextureCompilerContext* context, const TextureCompilerJob* job, const void* pixels, int32_t format, int32_t width, int32_t height,
+                                                    TextureCompilerResult** result);
+
+// Compiles a 2D texture from a whole image file read into memory, in any 2D input format of the compiler, otherwise
+// like `texture_compiler_compile`.
+TEXTURE_COMPILER_C_API int texture_compiler_compile_encoded(TextureCompilerContext* context, const TextureCompilerJob* job, const void* data, size_t size, TextureCompilerResult** result);
+
+// Outputs of a successful job, in the order of `texture`, `irradiance` and `prefilter`. Names and data are valid until
+// the result is destroyed.
+TEXTURE_COMPILER_C_API size_t texture_compiler_result_output_count(const TextureCompilerResult* result);
+TEXTURE_COMPILER_C_API const char* texture_compiler_result_output_name(const TextureCompilerResult* result, size_t index);
+TEXTURE_COMPILER_C_API const void* texture_compiler_result_output_data(const TextureCompilerResult* result, size_t index, size_t* size);
+
+// Messages the job printed, the errors of a failed job included, as a null terminated string.
+TEXTURE_COMPILER_C_API const char* texture_compiler_result_log(const TextureCompilerResult* result);
+
+TEXTURE_COMPILER_C_API void texture_compiler_result_destroy(TextureCompilerResult* result);
+
+// Texture of the host a cube map output is previewed in: an RGBA16F cube map of the size of the output with
+// `texture_compiler_preview_mip_count` mip levels, created on the device of the context as a copy destination.
+typedef struct TextureCompilerPreviewTexture {
+    // `texture`, `irradiance` or `prefilter`.
+    const char* output;
+
+    // An `ID3D11Texture2D*`, an `ID3D12Resource*`, an `id<MTLTexture>` or an OpenGL texture name cast to a pointer.
+    void* texture;
+} TextureCompilerPreviewTexture;
+
+// Mip levels of the preview texture of an output of a cube map job, zero when the job has no such output.
+TEXTURE_COMPILER_C_API uint32_t texture_compiler_preview_mip_count(const TextureCompilerJob* job, const char* output);
+
+// Renders a cube map job on the GPU of a context created with `texture_compiler_create_on_device` and copies the
+// outputs that have a texture into the textures, which the host can sample once the call returns. Nothing is read back
+// or encoded, so an editor can re-render the probe on every change of the source at the speed of the GPU, and compile
+// the job with `texture_compiler_compile` once it's saved, which reads back and encodes the outputs like any job. The
+// compression of the job doesn't matter here. Takes the images of `texture_compiler_compile` on the thread that
+// created the context. Returns zero on success, `result` has no outputs, only the messages.
+TEXTURE_COMPILER_C_API int texture_compiler_preview(TextureCompilerContext* context, const TextureCompilerJob* job, const void* pixels, int32_t format, int32_t width, int32_t height,
+                                                    const TextureCompilerPreviewTexture* textures, size_t texture_count, TextureCompilerResult** result);
+
+#ifdef __cplusplus
+}
+#endif
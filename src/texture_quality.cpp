@@ -0,0 +1,492 @@
+#include "texture_quality.h"
+
+#include "astc_encoder.h"
+#include "dds_layout.h"
+#include "etc2_encoder.h"
+
+#include <algorithm>
+#include <bimg/bimg.h>
+#include <bx/allocator.h>
+#include <cmath>
+#include <cstring>
+#include <iterator>
+
+// PSNR reported for levels that are exact.
+static constexpr double QUALITY_MAX_PSNR = 100.0;
+
+// Side of SSIM windows and the step between them.
+static constexpr size_t SSIM_WINDOW_SIZE = 8;
+static constexpr size_t SSIM_WINDOW_STEP = 4;
+
+// Stabilizing constants of SSIM for 8-bit values.
+static constexpr double SSIM_C1 = (0.01 * 255.0) * (0.01 * 255.0);
+static constexpr double SSIM_C2 = (0.03 * 255.0) * (0.03 * 255.0);
+
+// bimg decodes neither EAC R11 nor the alpha of ETC2 RGBA8, those blocks are decoded with `decode_eac_block` and the
+// color of ETC2 RGBA8 by bimg as ETC2 RGB8.
+static constexpr bimg::TextureFormat::Enum FORMAT_EAC_R11 = bimg::TextureFormat::Unknown;
+static constexpr bimg::TextureFormat::Enum FORMAT_ETC2_RGBA8 = bimg::TextureFormat::ETC2A;
+
+struct BlockFormat final {
+    uint32_t dxgi_format;
+    uint32_t vk_format;
+    bimg::TextureFormat::Enum bimg_format;
+    size_t channel_count;
+};
+
+static const BlockFormat FORMATS[] = {
+    // DXGI_FORMAT_BC1_UNORM.
+    { 71, 0, bimg::TextureFormat::BC1, 4 },
+    // DXGI_FORMAT_BC3_UNORM.
+    { 77, 0, bimg::TextureFormat::BC3, 4 },
+    // DXGI_FORMAT_BC4_UNORM.
+    { 80, 0, bimg::TextureFormat::BC4, 1 },
+    // DXGI_FORMAT_BC7_UNORM.
+    { 98, 0, bimg::TextureFormat::BC7, 4 },
+    { DXGI_FORMAT_UNKNOWN, ETC2_RGBA8_VK_FORMAT, FORMAT_ETC2_RGBA8, 4 },
+    { DXGI_FORMAT_UNKNOWN, EAC_R11_VK_FORMAT, FORMAT_EAC_R11, 1 },
+    { DXGI_FORMAT_UNKNOWN, ASTC_4X4_VK_FORMAT, bimg::TextureFormat::ASTC4x4, 4 },
+};
+
+// Sum of a mip level over all the layers.
+struct LevelTotals final {
+    double squared_error = 0.0;
+    size_t samples = 0;
+    double ssim = 0.0;
+    size_t ssim_windows = 0;
+    double angular_error = 0.0;
+    double max_angular_error = 0.0;
+    size_t normals = 0;
+};
+
+// Decodes the blocks of a level to `width` x `height` RGBA8 pixels, single channel formats to the red channel.
+static void decode_level(const uint8_t* data, size_t width, size_t height, const BlockFormat& format, std::vector<uint8_t>& rgba) {
+    const size_t blocks_x = (width + 3) / 4;
+    const size_t blocks_y = (height + 3) / 4;
+    const size_t block_size = find_texture_format_size(format.dxgi_format, format.vk_format)->block_size;
+    std::vector<uint8_t> blocks(blocks_x * 4 * blocks_y * 4 * 4);
+
+    const auto copy_block = [&blocks, blocks_x](size_t block, const uint8_t* values, size_t channel) {
+        for (size_t y = 0; y < 4; y++) {
+            for (size_t x = 0; x < 4; x++) {
+                blocks[((block / blocks_x * 4 + y) * blocks_x * 4 + block % blocks_x * 4 + x) * 4 + channel] = values[y * 4 + x];
+            }
+        }
+    };
+
+    if (format.bimg_format == FORMAT_EAC_R11) {
+        for (size_t block = 0; block < blocks_x * blocks_y; block++) {
+            uint8_t red[16];
+            decode_eac_block(data + block * block_size, true, red);
+            copy_block(block, red, 0);
+        }
+    } else if (format.bimg_format == FORMAT_ETC2_RGBA8) {
+        bx::DefaultAllocator allocator;
+        for (size_t block = 0; block < blocks_x * blocks_y; block++) {
+            uint8_t rgba[16 * 4];
+            bimg::imageDecodeToRgba8(&allocator, rgba, data + block * block_size + 8, 4, 4, 4 * 4, bimg::TextureFormat::ETC2);
+            for (size_t channel = 0; channel < 3; channel++) {
+                uint8_t values[16];
+                for (size_t pixel = 0; pixel < 16; pixel++) {
+                    values[pixel] = rgba[pixel * 4 + channel];
+                }
+                copy_block(block, values, channel);
+            }
+
+            uint8_t alpha[16];
+            decode_eac_block(data + block * block_size, false, alpha);
+            copy_block(block, alpha, 3);
+        }
+    } else {
+        bx::DefaultAllocator allocator;
+        bimg::imageDecodeToRgba8(&allocator, blocks.data(), data, static_cast<uint32_t>(blocks_x * 4), static_cast<uint32_t>(blocks_y * 4),
+                                 static_cast<uint32_t>(blocks_x * 4 * 4), format.bimg_format);
+
+        // bimg decodes BC4 to the third channel of its RGBA8 output.
+        if (format.bimg_format == bimg::TextureFormat::BC4) {
+            for (size_t pixel = 0; pixel < blocks.size() / 4; pixel++) {
+                blocks[pixel * 4] = blocks[pixel * 4 + 2];
+            }
+        }
+    }
+
+    rgba.resize(width * height * 4);
+    for (size_t y = 0; y < height; y++) {
+        std::memcpy(rgba.data() + y * width * 4, blocks.data() + y * blocks_x * 4 * 4, width * 4);
+    }
+}
+
+// Converts B8G8R8A8 or R8 pixels of the reference to RGBA8, R8 to the red channel.
+static void convert_reference_level(const uint8_t* data, size_t pixel_count, bool is_r8, std::vector<uint8_t>& rgba) {
+    rgba.assign(pixel_count * 4, 0);
+    for (size_t pixel = 0; pixel < pixel_count; pixel++) {
+        if (is_r8) {
+            rgba[pixel * 4] = data[pixel];
+        } else {
+            rgba[pixel * 4 + 0] = data[pixel * 4 + 2];
+            rgba[pixel * 4 + 1] = data[pixel * 4 + 1];
+            rgba[pixel * 4 + 2] = data[pixel * 4 + 0];
+            rgba[pixel * 4 + 3] = data[pixel * 4 + 3];
+        }
+    }
+}
+
+// SSIM of a single channel in a window of both images.
+static double get_window_ssim(const uint8_t* a, const uint8_t* b, size_t width, size_t x0, size_t y0, size_t window_width, size_t window_height,
+                              size_t channel) noexcept {
+    double sum_a = 0.0;
+    double sum_b = 0.0;
+    double sum_aa = 0.0;
+    double sum_bb = 0.0;
+    double sum_ab = 0.0;
+    for (size_t y = y0; y < y0 + window_height; y++) {
+        for (size_t x = x0; x < x0 + window_width; x++) {
+            const double value_a = a[(y * width + x) * 4 + channel];
+            const double value_b = b[(y * width + x) * 4 + channel];
+            sum_a += value_a;
+            sum_b += value_b;
+            sum_aa += value_a * value_a;
+            sum_bb += value_b * value_b;
+            sum_ab += value_a * value_b;
+        }
+    }
+
+    const double count = static_cast<double>(window_width * window_height);
+    const double mean_a = sum_a / count;
+    const double mean_b = sum_b / count;
+    const double variance_a = sum_aa / count - mean_a * mean_a;
+    const double variance_b = sum_bb / count - mean_b * mean_b;
+    const double covariance = sum_ab / count - mean_a * mean_b;
+    return (2.0 * mean_a * mean_b + SSIM_C1) * (2.0 * covariance + SSIM_C2) /
+           ((mean_a * mean_a + mean_b * mean_b + SSIM_C1) * (variance_a + variance_b + SSIM_C2));
+}
+
+// Unit normal of the RG channels of a pixel, Z is reconstructed like the shaders do.
+static void get_normal(const uint8_t* pixel, double (&normal)[3]) noexcept {
+    normal[0] = pixel[0] / 255.0 * 2.0 - 1.0;
+    normal[1] = pixel[1] / 255.0 * 2.0 - 1.0;
+    normal[2] = std::sqrt(std::max(1.0 - normal[0] * normal[0] - normal[1] * normal[1], 0.0));
+
+    const double length = std::sqrt(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+    for (double& component : normal) {
+        component /= length;
+    }
+}
+
+static void compare_level(const std::vector<uint8_t>& decoded, const std::vector<uint8_t>& reference, size_t width, size_t height, size_t channel_count,
+                          bool is_normal_map, LevelTotals& totals) noexcept {
+    for (size_t pixel = 0; pixel < width * height; pixel++) {
+        for (size_t channel = 0; channel < channel_count; channel++) {
+            const double difference = static_cast<double>(decoded[pixel * 4 + channel]) - static_cast<double>(reference[pixel * 4 + channel]);
+            totals.squared_error += difference * difference;
+        }
+
+        if (is_normal_map) {
+            double normal[3];
+            double reference_normal[3];
+            get_normal(decoded.data() + pixel * 4, normal);
+            get_normal(reference.data() + pixel * 4, reference_normal);
+
+            const double cosine = normal[0] * reference_normal[0] + normal[1] * reference_normal[1] + normal[2] * reference_normal[2];
+            const double angle = std::acos(std::clamp(cosine, -1.0, 1.0)) * 180.0 / 3.14159265358979323846;
+            totals.angular_error += angle;
+            totals.max_angular_error = std::max(totals.max_angular_error, angle);
+            totals.normals++;
+        }
+    }
+    totals.samples += width * height * channel_count;
+
+    const size_t window_width = std::min(width, SSIM_WINDOW_SIZE);
+    const size_t window_height = std::min(height, SSIM_WINDOW_SIZE);
+    for (size_t y = 0; y + window_height <= height; y += SSIM_WINDOW_STEP) {
+        for (size_t x = 0; x + window_width <= width; x += SSIM_WINDOW_STEP) {
+            double ssim = 0.0;
+            for (size_t channel = 0; channel < channel_count; channel++) {
+                ssim += get_window_ssim(decoded.data(), reference.data(), width, x, y, window_width, window_height, channel);
+            }
+            totals.ssim += ssim / static_cast<double>(channel_count);
+            totals.ssim_windows++;
+        }
+    }
+}
+
+bool measure_texture_quality(const std::vector<char>& dds, uint32_t vk_format, const std::vector<char>& reference, bool is_normal_map,
+                             std::vector<MipLevelQuality>& levels, std::ostream& log) {
+    levels.clear();
+
+    Dds10Header header;
+    Dds10Header reference_header;
+    if (!read_dds10_header(dds.data(), dds.size(), header) || !read_dds10_header(reference.data(), reference.size(), reference_header) ||
+        header.dimension != DDS10_DIMENSION_TEXTURE_2D || reference_header.dimension != DDS10_DIMENSION_TEXTURE_2D) {
+        log << "\rTexture compiler error. Quality report requires 2D DDS textures with the DX10 header." << std::endl;
+        return false;
+    }
+
+    const uint32_t level_count = header.level_count;
+    const uint32_t dxgi_format = header.dxgi_format;
+
+    const BlockFormat* format = nullptr;
+    for (const BlockFormat& candidate : FORMATS) {
+        if (candidate.dxgi_format == dxgi_format && (dxgi_format != DXGI_FORMAT_UNKNOWN || candidate.vk_format == vk_format)) {
+            format = &candidate;
+        }
+    }
+
+    if (format == nullptr) {
+        return true;
+    }
+
+    const uint32_t reference_format = reference_header.dxgi_format;
+    const bool is_r8 = reference_format == DXGI_FORMAT_R8_UNORM;
+    if (reference_header.height != header.height || reference_header.width != header.width || reference_header.level_count != level_count ||
+        reference_header.array_size != header.array_size || (reference_format != DXGI_FORMAT_B8G8R8A8_UNORM && !is_r8) || is_r8 != (format->channel_count == 1)) {
+        log << "\rTexture compiler error. Quality report reference doesn't match the texture." << std::endl;
+        return false;
+    }
+
+    // The texture holds the blocks the reference is encoded to.
+    const EncodedLayout layout = get_encoded_layout(header, is_r8 ? 1 : 4, find_texture_format_size(format->dxgi_format, format->vk_format)->block_size);
+    if (layout.output_size != dds.size() || layout.input_size != reference.size()) {
+        log << "\rTexture compiler error. DDS texture size doesn't match its mip levels." << std::endl;
+        return false;
+    }
+
+    std::vector<LevelTotals> totals(level_count);
+    std::vector<uint8_t> decoded;
+    std::vector<uint8_t> converted;
+
+    for (const EncodedLevel& level : layout.levels) {
+        const size_t level_width = level.input.width;
+        const size_t level_height = level.input.height;
+
+        decode_level(reinterpret_cast<const uint8_t*>(dds.data() + level.output.offset), level_width, level_height, *format, decoded);
+        convert_reference_level(reinterpret_cast<const uint8_t*>(reference.data() + level.input.offset), level_width * level_height, is_r8, converted);
+        compare_level(decoded, converted, level_width, level_height, format->channel_count, is_normal_map && !is_r8, totals[level.input.mip_level]);
+    }
+
+    for (uint32_t level = 0; level < level_count; level++) {
+        const LevelTotals& level_totals = totals[level];
+
+        MipLevelQuality quality;
+        quality.mip_level = static_cast<int>(level);
+        quality.psnr = QUALITY_MAX_PSNR;
+        if (level_totals.squared_error > 0.0) {
+            const double mean_error = level_totals.squared_error / static_cast<double>(level_totals.samples);
+            quality.psnr = std::min(10.0 * std::log10(255.0 * 255.0 / mean_error), QUALITY_MAX_PSNR);
+        }
+        quality.ssim = level_totals.ssim / static_cast<double>(std::max<size_t>(level_totals.ssim_windows, 1));
+        quality.mean_angular_error = level_totals.normals != 0 ? level_totals.angular_error / static_cast<double>(level_totals.normals) : -1.0;
+        quality.max_angular_error = level_totals.normals != 0 ? level_totals.max_angular_error : -1.0;
+        levels.push_back(quality);
+    }
+
+    return true;
+}
+
+bool decode_dds_level(const char* data, size_t size, uint32_t dxgi_format, size_t width, size_t height, std::vector<uint8_t>& rgba) {
+    const size_t pixel_count = width * height;
+    if (dxgi_format == DXGI_FORMAT_B8G8R8A8_UNORM || dxgi_format == DXGI_FORMAT_R8_UNORM) {
+        const bool is_r8 = dxgi_format == DXGI_FORMAT_R8_UNORM;
+        if (size != pixel_count * (is_r8 ? 1 : 4)) {
+            return false;
+        }
+        convert_reference_level(reinterpret_cast<const uint8_t*>(data), pixel_count, is_r8, rgba);
+        return true;
+    }
+
+    for (const BlockFormat& format : FORMATS) {
+        if (format.dxgi_format == dxgi_format && dxgi_format != DXGI_FORMAT_UNKNOWN) {
+            if (size != get_image_size(width, height, find_texture_format_size(dxgi_format)->block_size, true)) {
+                return false;
+            }
+            decode_level(reinterpret_cast<const uint8_t*>(data), width, height, format, rgba);
+            return true;
+        }
+    }
+    return false;
+}
+
+static constexpr uint32_t DXGI_FORMAT_BC6H_UF16 = 95;
+static constexpr uint32_t DXGI_FORMAT_BC6H_SF16 = 96;
+static constexpr uint32_t DXGI_FORMAT_BC7_UNORM = 98;
+static constexpr uint32_t DXGI_FORMAT_BC7_UNORM_SRGB = 99;
+
+static constexpr size_t BC7_MODE_COUNT = 8;
+static constexpr size_t BC6H_MODE_COUNT = 14;
+
+// Partition bits of every BC7 mode, which follow the mode bits.
+static constexpr size_t BC7_PARTITION_BITS[BC7_MODE_COUNT] = { 4, 6, 6, 6, 0, 0, 0, 6 };
+
+// The two subset modes of BC6H, 1 to 10, keep their partition in 5 bits after the endpoints.
+static constexpr size_t BC6H_PARTITIONED_MODE_COUNT = 10;
+static constexpr size_t BC6H_PARTITION_OFFSET = 77;
+static constexpr size_t BC6H_PARTITION_BITS = 5;
+
+// Bits of a block from the least significant bit of its first byte on.
+static uint32_t read_block_bits(const uint8_t* block, size_t offset, size_t count) noexcept {
+    uint32_t result = 0;
+    for (size_t i = 0; i < count; i++) {
+        result |= static_cast<uint32_t>(block[(offset + i) / 8] >> ((offset + i) % 8) & 1) << i;
+    }
+    return result;
+}
+
+// Mode of a BC7 block from 0, the position of its lowest set bit, negative for the reserved mode without one.
+static int get_bc7_mode(const uint8_t* block) noexcept {
+    for (int mode = 0; mode < static_cast<int>(BC7_MODE_COUNT); mode++) {
+        if ((block[0] >> mode & 1) != 0) {
+            return mode;
+        }
+    }
+    return -1;
+}
+
+// Mode of a BC6H block from 0 for mode 1, negative for the reserved modes. Modes 1 and 2 have 2 mode bits, the rest 5.
+static int get_bc6h_mode(const uint8_t* block) noexcept {
+    const uint32_t bits = block[0] & 0x1F;
+    if ((bits & 0x3) < 2) {
+        return static_cast<int>(bits & 0x3);
+    }
+    switch (bits) {
+        case 0x02: return 2;
+        case 0x06: return 3;
+        case 0x0A: return 4;
+        case 0x0E: return 5;
+        case 0x12: return 6;
+        case 0x16: return 7;
+        case 0x1A: return 8;
+        case 0x1E: return 9;
+        case 0x03: return 10;
+        case 0x07: return 11;
+        case 0x0B: return 12;
+        case 0x0F: return 13;
+        default: return -1;
+    }
+}
+
+// Squared error per sample of the 4x4 block at `x`, `y` of both RGBA8 levels, over the pixels inside the level.
+static double get_block_squared_error(const std::vector<uint8_t>& decoded, const std::vector<uint8_t>& reference, size_t width, size_t height, size_t x, size_t y) noexcept {
+    double squared_error = 0.0;
+    size_t samples = 0;
+    for (size_t pixel_y = y; pixel_y < std::min(y + 4, height); pixel_y++) {
+        for (size_t pixel_x = x; pixel_x < std::min(x + 4, width); pixel_x++) {
+            for (size_t channel = 0; channel < 4; channel++) {
+                const double difference = static_cast<double>(decoded[(pixel_y * width + pixel_x) * 4 + channel]) - static_cast<double>(reference[(pixel_y * width + pixel_x) * 4 + channel]);
+                squared_error += difference * difference;
+                samples++;
+            }
+        }
+    }
+    return squared_error / static_cast<double>(samples);
+}
+
+bool count_block_modes(const std::vector<char>& dds, const std::vector<char>* reference, const char*& format, std::vector<MipLevelBlocks>& levels, std::ostream& log) {
+    format = nullptr;
+    levels.clear();
+
+    Dds10Header header;
+    if (!read_dds10_header(dds.data(), dds.size(), header) || header.dimension != DDS10_DIMENSION_TEXTURE_2D) {
+        log << "\rTexture compiler error. Block report requires 2D DDS textures with the DX10 header." << std::endl;
+        return false;
+    }
+
+    const uint32_t dxgi_format = header.dxgi_format;
+    const bool is_bc7 = dxgi_format == DXGI_FORMAT_BC7_UNORM || dxgi_format == DXGI_FORMAT_BC7_UNORM_SRGB;
+    const bool is_bc6h = dxgi_format == DXGI_FORMAT_BC6H_UF16 || dxgi_format == DXGI_FORMAT_BC6H_SF16;
+    if (!is_bc7 && !is_bc6h) {
+        return true;
+    }
+
+    const uint32_t level_count = header.level_count;
+    const uint32_t layer_count = header.get_layer_count();
+
+    // BC7 blocks are measured against the B8G8R8A8 reference they're encoded from.
+    const EncodedLayout layout = get_encoded_layout(header, 4, 16);
+    if (layout.output_size != dds.size()) {
+        log << "\rTexture compiler error. DDS texture size doesn't match its mip levels." << std::endl;
+        return false;
+    }
+
+    // Only BC7 has a reference, cube maps are never compiled without compression next to BC6H.
+    const bool is_measured = reference != nullptr && is_bc7;
+    Dds10Header reference_header;
+    if (is_measured &&
+        (reference->size() != layout.input_size || !read_dds10_header(reference->data(), reference->size(), reference_header) || reference_header.height != header.height ||
+         reference_header.width != header.width || reference_header.level_count != level_count || reference_header.array_size != layer_count ||
+         reference_header.dxgi_format != DXGI_FORMAT_B8G8R8A8_UNORM)) {
+        log << "\rTexture compiler error. Block report reference doesn't match the texture." << std::endl;
+        return false;
+    }
+
+    const size_t mode_count = is_bc7 ? BC7_MODE_COUNT : BC6H_MODE_COUNT;
+    levels.resize(level_count);
+    for (uint32_t level = 0; level < level_count; level++) {
+        MipLevelBlocks& blocks = levels[level];
+        blocks.mip_level = static_cast<int>(level);
+        blocks.modes.assign(mode_count, 0);
+        blocks.reserved_blocks = 0;
+        blocks.partitions.resize(mode_count);
+        for (size_t mode = 0; mode < mode_count; mode++) {
+            const size_t partition_bits = is_bc7 ? BC7_PARTITION_BITS[mode] : mode < BC6H_PARTITIONED_MODE_COUNT ? BC6H_PARTITION_BITS : 0;
+            blocks.partitions[mode].assign(partition_bits != 0 ? size_t(1) << partition_bits : 0, 0);
+        }
+        if (is_measured) {
+            blocks.mode_squared_errors.assign(mode_count, 0.0);
+            blocks.error_histogram.assign(std::size(BLOCK_ERROR_BOUNDS) + 1, 0);
+        }
+    }
+
+    const BlockFormat* bc7_format = nullptr;
+    for (const BlockFormat& candidate : FORMATS) {
+        if (candidate.dxgi_format == DXGI_FORMAT_BC7_UNORM) {
+            bc7_format = &candidate;
+        }
+    }
+
+    std::vector<uint8_t> decoded;
+    std::vector<uint8_t> converted;
+
+    for (const EncodedLevel& level : layout.levels) {
+        const size_t level_width = level.input.width;
+        const size_t level_height = level.input.height;
+        const size_t blocks_x = (level_width + 3) / 4;
+        const size_t blocks_y = (level_height + 3) / 4;
+        const uint8_t* data = reinterpret_cast<const uint8_t*>(dds.data() + level.output.offset);
+
+        if (is_measured) {
+            decode_level(data, level_width, level_height, *bc7_format, decoded);
+            convert_reference_level(reinterpret_cast<const uint8_t*>(reference->data() + level.input.offset), level_width * level_height, false, converted);
+        }
+
+        MipLevelBlocks& blocks = levels[level.input.mip_level];
+        for (size_t block = 0; block < blocks_x * blocks_y; block++) {
+            const uint8_t* block_data = data + block * 16;
+            const int mode = is_bc7 ? get_bc7_mode(block_data) : get_bc6h_mode(block_data);
+            if (mode < 0) {
+                blocks.reserved_blocks++;
+                continue;
+            }
+
+            blocks.modes[mode]++;
+            std::vector<uint64_t>& partitions = blocks.partitions[mode];
+            if (!partitions.empty()) {
+                const size_t partition_bits = is_bc7 ? BC7_PARTITION_BITS[mode] : BC6H_PARTITION_BITS;
+                partitions[read_block_bits(block_data, is_bc7 ? static_cast<size_t>(mode) + 1 : BC6H_PARTITION_OFFSET, partition_bits)]++;
+            }
+
+            if (is_measured) {
+                const double squared_error = get_block_squared_error(decoded, converted, level_width, level_height, block % blocks_x * 4, block / blocks_x * 4);
+                blocks.mode_squared_errors[mode] += squared_error;
+                const double rmse = std::sqrt(squared_error);
+                size_t bucket = 0;
+                while (bucket < std::size(BLOCK_ERROR_BOUNDS) && rmse >= BLOCK_ERROR_BOUNDS[bucket]) {
+                    bucket++;
+                }
+                blocks.error_histogram[bucket]++;
+            }
+        }
+    }
+
+    format = is_bc7 ? "bc7" : "bc6h";
+    return true;
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+// Quality of a mip level of a compressed texture against the same level compiled without compression. Levels of
+// texture arrays are measured over all the layers.
+struct MipLevelQuality final {
+    // Mip level of the output, zero is the first level in the file.
+    int mip_level;
+
+    // PSNR in decibels over the channels of the format, 100 when the level is exact.
+    double psnr;
+
+    // Mean SSIM of 8x8 windows every 4 pixels, averaged over the channels. Levels smaller than a window are a single
+    // window.
+    double ssim;
+
+    // Angle in degrees between the normals of RG normal maps, with Z reconstructed from X and Y. Negative for other
+    // textures.
+    double mean_angular_error;
+    double max_angular_error;
+};
+
+// Decodes every mip level of a block compressed 2D DDS texture with the DX10 header and compares it with the
+// B8G8R8A8 or R8 `reference` of the same size. BC1, BC3, BC4 and BC7 are recognized by their DXGI format, textures
+// with `DXGI_FORMAT_UNKNOWN` pass the Vulkan format of their ETC2 RGBA8, EAC R11 or ASTC 4x4 blocks in `vk_format`.
+// Other formats leave `levels` empty.
+bool measure_texture_quality(const std::vector<char>& dds, uint32_t vk_format, const std::vector<char>& reference, bool is_normal_map,
+                             std::vector<MipLevelQuality>& levels, std::ostream& log);
+
+// Decodes a mip level of `width` x `height` pixels of a DDS texture in `dxgi_format` to RGBA8 pixels, single channel
+// formats to the red channel. `size` must be the size of the level. BC1, BC3, BC4 and BC7 blocks and B8G8R8A8 and R8
+// pixels are decoded, returns false for other formats and sizes.
+bool decode_dds_level(const char* data, size_t size, uint32_t dxgi_format, size_t width, size_t height, std::vector<uint8_t>& rgba);
+
+// Upper bounds of the RMSE of blocks in 8-bit steps that `MipLevelBlocks::error_histogram` counts blocks below, the
+// last bucket of the histogram counts the rest.
+constexpr double BLOCK_ERROR_BOUNDS[] = { 1.0, 2.0, 4.0, 8.0, 16.0, 32.0 };
+
+// Modes and partitions the encoder picked for the blocks of a mip level of a BC7 or BC6H texture, counted over all the
+// layers and faces.
+struct MipLevelBlocks final {
+    // Mip level of the output, zero is the first level in the file.
+    int mip_level;
+
+    // Blocks of every mode, the 8 BC7 modes from mode 0 or the 14 BC6H modes from mode 1, and blocks of reserved modes,
+    // which decode to zero.
+    std::vector<uint64_t> modes;
+    uint64_t reserved_blocks;
+
+    // Blocks of every partition of the modes with two or three subsets, empty for the other modes.
+    std::vector<std::vector<uint64_t>> partitions;
+
+    // Only with a reference, empty otherwise: squared error per sample summed over the blocks of every mode, and the
+    // blocks by their RMSE, in the buckets of `BLOCK_ERROR_BOUNDS`.
+    std::vector<double> mode_squared_errors;
+    std::vector<uint64_t> error_histogram;
+};
+
+// Counts the modes and partitions of every mip level of a BC7 or BC6H DDS texture with the DX10 header, and with a
+// non-null B8G8R8A8 `reference` of the same size, which BC7 outputs of `--report-quality` have, the error of every
+// block. `format` is set to `bc7` or `bc6h`, other formats set it to null and leave `levels` empty.
+bool count_block_modes(const std::vector<char>& dds, const std::vector<char>* reference, const char*& format, std::vector<MipLevelBlocks>& levels, std::ostream& log);
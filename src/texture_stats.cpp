@@ -0,0 +1,102 @@
+#include "texture_stats.h"
+#include "atomic_file.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+
+bool TextureStats::add_band(const float* const channels[4], int width, int row_count, int level_height) noexcept {
+    if (gathered_rows == 0) {
+        current = TextureLevelStats {};
+        current.width = static_cast<uint32_t>(width);
+        current.height = static_cast<uint32_t>(level_height);
+        for (int channel = 0; channel < 4; channel++) {
+            current.minimum[channel] = channels[channel][0];
+            current.maximum[channel] = channels[channel][0];
+            sums[channel] = 0.0;
+        }
+        covered_count = 0;
+    }
+
+    // Channels are summed in rows, so the float sums stay short and exact enough before they're added up in double.
+    const size_t pixel_count = static_cast<size_t>(width) * static_cast<size_t>(row_count);
+    for (int channel = 0; channel < 4; channel++) {
+        const float* const values = channels[channel];
+        float minimum = current.minimum[channel];
+        float maximum = current.maximum[channel];
+        double sum = 0.0;
+        for (size_t row = 0; row < pixel_count; row += static_cast<size_t>(width)) {
+            float row_sum = 0.f;
+            for (size_t i = row; i < row + static_cast<size_t>(width); i++) {
+                minimum = std::min(minimum, values[i]);
+                maximum = std::max(maximum, values[i]);
+                row_sum += values[i];
+            }
+            sum += row_sum;
+        }
+        current.minimum[channel] = minimum;
+        current.maximum[channel] = maximum;
+        sums[channel] += sum;
+    }
+
+    const float* const alpha = channels[3];
+    for (size_t i = 0; i < pixel_count; i++) {
+        covered_count += alpha[i] >= TEXTURE_STATS_ALPHA_THRESHOLD ? 1 : 0;
+    }
+
+    gathered_rows += row_count;
+    if (gathered_rows < level_height) {
+        return true;
+    }
+
+    const double level_pixels = static_cast<double>(current.width) * static_cast<double>(current.height);
+    for (int channel = 0; channel < 4; channel++) {
+        current.average[channel] = static_cast<float>(sums[channel] / level_pixels);
+    }
+    current.alpha_coverage = static_cast<float>(static_cast<double>(covered_count) / level_pixels);
+    gathered_rows = 0;
+
+    try {
+        levels.push_back(current);
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
+std::string get_texture_stats_path(const std::string& output) {
+    return output + ".stats";
+}
+
+bool write_texture_stats(const std::string& output, const Hash& content, const TextureStats& stats) {
+    const std::string path = get_texture_stats_path(output);
+    const std::string temporary_path = get_temporary_path(path);
+
+    {
+        const uint32_t level_count = static_cast<uint32_t>(stats.levels.size() / std::max(stats.layer_count, 1U));
+
+        std::ofstream stream(temporary_path, std::ios::binary);
+        stream.write(TEXTURE_STATS_MAGIC, sizeof(TEXTURE_STATS_MAGIC));
+        stream.write(reinterpret_cast<const char*>(&TEXTURE_STATS_VERSION), sizeof(TEXTURE_STATS_VERSION));
+        stream.write(reinterpret_cast<const char*>(&stats.layer_count), sizeof(stats.layer_count));
+        stream.write(reinterpret_cast<const char*>(&level_count), sizeof(level_count));
+        stream.write(reinterpret_cast<const char*>(&content.low), sizeof(content.low));
+        stream.write(reinterpret_cast<const char*>(&content.high), sizeof(content.high));
+        for (const TextureLevelStats& level : stats.levels) {
+            stream.write(reinterpret_cast<const char*>(&level.width), sizeof(level.width));
+            stream.write(reinterpret_cast<const char*>(&level.height), sizeof(level.height));
+            stream.write(reinterpret_cast<const char*>(level.average), sizeof(level.average));
+            stream.write(reinterpret_cast<const char*>(level.minimum), sizeof(level.minimum));
+            stream.write(reinterpret_cast<const char*>(level.maximum), sizeof(level.maximum));
+            stream.write(reinterpret_cast<const char*>(&level.alpha_coverage), sizeof(level.alpha_coverage));
+        }
+
+        stream.close();
+        if (!stream) {
+            std::remove(temporary_path.c_str());
+            return false;
+        }
+    }
+
+    return replace_file(temporary_path, path);
+}
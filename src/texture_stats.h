@@ -0,0 +1,65 @@
+#pragma once
+
+#include "hash.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Statistics of the texels of 2D textures that runtimes otherwise compute by reading the pixels at load time, for
+// streaming and LOD decisions, written by `--stats` to a `<output>.stats` file next to the output. They're gathered
+// from the filtered mip levels right before they're compressed, so they cost a pass over texels the compiler has in
+// hand, and describe the channels of the output in [0, 1] before block compression rounds them. The file is:
+//
+//   Offset 0    `TEXTURE_STATS_MAGIC`.
+//   Offset 4    32-bit `TEXTURE_STATS_VERSION`.
+//   Offset 8    32-bit number of layers.
+//   Offset 12   32-bit number of mip levels of every layer.
+//   Offset 16   128-bit `hash_content` of the output file, low 64 bits first, to tell a stale file from a current one.
+//   Offset 32   `TextureLevelStats` of every mip level of every layer, levels of a layer together, largest first.
+//
+// Every value is little endian.
+static constexpr char TEXTURE_STATS_MAGIC[4] = { 'T', 'C', 'S', 'T' };
+static constexpr uint32_t TEXTURE_STATS_VERSION = 1;
+
+// Texels whose fourth channel is at least this are covered, the usual alpha test threshold.
+static constexpr float TEXTURE_STATS_ALPHA_THRESHOLD = 0.5f;
+
+// 60 bytes in the file, in the order of the fields.
+struct TextureLevelStats final {
+    uint32_t width = 0;
+    uint32_t height = 0;
+    float average[4] = {};
+    float minimum[4] = {};
+    float maximum[4] = {};
+
+    // Share of the texels that are covered, see `TEXTURE_STATS_ALPHA_THRESHOLD`.
+    float alpha_coverage = 0.f;
+};
+
+// Accumulates the statistics of the mip levels of every layer of a texture band by band, in the order they're
+// compressed.
+struct TextureStats final {
+    // Adds a band of `width` by `row_count` texels in four planar channels to the level being gathered, or starts the
+    // next level when the last one is complete. `level_height` is the height of the whole level of the band. Returns
+    // false when the memory for the level runs out.
+    bool add_band(const float* const channels[4], int width, int row_count, int level_height) noexcept;
+
+    uint32_t layer_count = 1;
+
+    // Levels whose last band is in, the level being gathered has no entry until then.
+    std::vector<TextureLevelStats> levels;
+
+private:
+    TextureLevelStats current;
+    double sums[4] = {};
+    uint64_t covered_count = 0;
+    int gathered_rows = 0;
+};
+
+// Path of the statistics of `output`.
+std::string get_texture_stats_path(const std::string& output);
+
+// Statistics are replaced atomically, so an interrupted write never leaves a file that doesn't match the output.
+bool write_texture_stats(const std::string& output, const Hash& content, const TextureStats& stats);
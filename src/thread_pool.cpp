@@ -0,0 +1,209 @@
+#include "thread_pool.h"
+#include "metrics.h"
+
+#include <algorithm>
+
+// Pool and queue index of the current thread. Threads that don't belong to any pool use the shared queue.
+static thread_local const ThreadPool* current_pool = nullptr;
+static thread_local size_t current_queue = 0;
+
+ThreadPool::ThreadPool(size_t worker_count, const std::vector<LogicalCpu>& cpus)
+        : queues(std::make_unique<Queue[]>(worker_count + 1))
+        , queue_count(worker_count + 1)
+        , steal_orders(worker_count + 1)
+        , is_efficiency(worker_count + 1, false) {
+    const size_t shared_queue = worker_count;
+    const auto get_cpu = [&cpus](size_t index) -> const LogicalCpu* {
+        return cpus.empty() ? nullptr : &cpus[index % cpus.size()];
+    };
+
+    for (size_t index = 0; index < queue_count; index++) {
+        // Other queues one after another, as every unpinned worker steals, the shared queue among them.
+        std::vector<size_t>& order = steal_orders[index];
+        for (size_t offset = 1; offset < queue_count; offset++) {
+            order.push_back((index + offset) % queue_count);
+        }
+
+        const LogicalCpu* cpu = index != shared_queue ? get_cpu(index) : nullptr;
+        if (cpu != nullptr) {
+            const auto rank = [&](size_t victim) {
+                if (victim == shared_queue) {
+                    return 1;
+                }
+                return get_cpu(victim)->node == cpu->node ? 0 : 2;
+            };
+            std::stable_sort(order.begin(), order.end(), [&rank](size_t a, size_t b) {
+                return rank(a) < rank(b);
+            });
+            is_efficiency[index] = cpu->is_efficiency;
+        }
+    }
+
+    threads.reserve(worker_count);
+    for (size_t index = 0; index < worker_count; index++) {
+        const LogicalCpu* cpu = get_cpu(index);
+        threads.emplace_back(&ThreadPool::worker_thread, this, index, cpu != nullptr ? static_cast<int>(cpu->id) : -1);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(sleep_mutex);
+        is_stopping = true;
+    }
+    sleep_condition.notify_all();
+
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+}
+
+size_t ThreadPool::worker_count() const noexcept {
+    return threads.size();
+}
+
+std::vector<double> ThreadPool::get_worker_cpu_times() {
+    std::vector<double> result;
+    result.reserve(threads.size());
+    for (std::thread& thread : threads) {
+        result.push_back(get_thread_cpu_time(thread.native_handle()));
+    }
+    return result;
+}
+
+ThreadPool::TaskWaits ThreadPool::take_task_waits() noexcept {
+    TaskWaits result;
+    result.count = executed_tasks.exchange(0);
+    result.seconds = static_cast<double>(task_wait_nanoseconds.exchange(0)) / 1e9;
+    result.max_seconds = static_cast<double>(max_task_wait_nanoseconds.exchange(0)) / 1e9;
+    return result;
+}
+
+void ThreadPool::push(TaskGroup& group, std::function<void()> task) {
+    group.remaining++;
+    group.queued++;
+
+    const size_t index = current_pool == this ? current_queue : queue_count - 1;
+    {
+        std::lock_guard<std::mutex> lock(queues[index].mutex);
+        queues[index].tasks.push_back(Task { &group, std::move(task), get_profile_tag(), std::chrono::steady_clock::now() });
+    }
+
+    pending_tasks++;
+
+    // Lock the mutex so a thread that has just checked the counters doesn't miss the notification.
+    {
+        std::lock_guard<std::mutex> lock(sleep_mutex);
+    }
+    sleep_condition.notify_all();
+}
+
+void ThreadPool::wait(TaskGroup& group) {
+    const size_t index = current_pool == this ? current_queue : queue_count - 1;
+    while (group.remaining != 0) {
+        if (!run_task(index, &group)) {
+            std::unique_lock<std::mutex> lock(sleep_mutex);
+            sleep_condition.wait(lock, [&] {
+                return group.remaining == 0 || group.queued != 0;
+            });
+        }
+    }
+}
+
+void ThreadPool::worker_thread(size_t index, int cpu) {
+    current_pool = this;
+    current_queue = index;
+
+    // Before the first task, so everything the worker allocates is placed on its node. A CPU that can't be set leaves
+    // the worker to the scheduler.
+    if (cpu >= 0) {
+        pin_current_thread(static_cast<size_t>(cpu));
+    }
+
+    while (true) {
+        if (!run_task(index, nullptr)) {
+            std::unique_lock<std::mutex> lock(sleep_mutex);
+            sleep_condition.wait(lock, [&] {
+                return is_stopping || pending_tasks != 0;
+            });
+
+            if (is_stopping) {
+                return;
+            }
+        }
+    }
+}
+
+bool ThreadPool::run_task(size_t index, const TaskGroup* group) {
+    const auto is_suitable = [group](const Task& task) {
+        return group == nullptr || task.group == group;
+    };
+
+    // Newest task from the own queue is likely the one whose data is still in cache.
+    {
+        std::unique_lock<std::mutex> lock(queues[index].mutex);
+
+        std::deque<Task>& tasks = queues[index].tasks;
+        if (auto it = std::find_if(tasks.rbegin(), tasks.rend(), is_suitable); it != tasks.rend()) {
+            Task task = std::move(*it);
+            tasks.erase(std::next(it).base());
+            lock.unlock();
+
+            execute(task);
+            return true;
+        }
+    }
+
+    // Steal the oldest task from other queues, it is likely the biggest one. Efficiency cores take the newest of the
+    // shared queue instead.
+    for (const size_t victim : steal_orders[index]) {
+        Queue& queue = queues[victim];
+
+        std::unique_lock<std::mutex> lock(queue.mutex);
+
+        std::deque<Task>& tasks = queue.tasks;
+        if (is_efficiency[index] && victim == queue_count - 1) {
+            if (auto it = std::find_if(tasks.rbegin(), tasks.rend(), is_suitable); it != tasks.rend()) {
+                Task task = std::move(*it);
+                tasks.erase(std::next(it).base());
+                lock.unlock();
+
+                execute(task);
+                return true;
+            }
+        } else if (auto it = std::find_if(tasks.begin(), tasks.end(), is_suitable); it != tasks.end()) {
+            Task task = std::move(*it);
+            tasks.erase(it);
+            lock.unlock();
+
+            execute(task);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void ThreadPool::execute(Task& task) {
+    pending_tasks--;
+    task.group->queued--;
+
+    const uint64_t wait = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - task.push_time).count());
+    executed_tasks.fetch_add(1, std::memory_order_relaxed);
+    task_wait_nanoseconds.fetch_add(wait, std::memory_order_relaxed);
+    for (uint64_t max = max_task_wait_nanoseconds.load(std::memory_order_relaxed); wait > max && !max_task_wait_nanoseconds.compare_exchange_weak(max, wait, std::memory_order_relaxed);) {
+    }
+
+    {
+        ProfileTaskScope profile_task(task.tag);
+        task.function();
+    }
+
+    if (--task.group->remaining == 0) {
+        // Wake up the threads waiting for this group.
+        {
+            std::lock_guard<std::mutex> lock(sleep_mutex);
+        }
+        sleep_condition.notify_all();
+    }
+}
@@ -0,0 +1,112 @@
+#pragma once
+
+#include "cpu_topology.h"
+#include "profiler.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Set of tasks that can be waited for as a whole.
+struct TaskGroup final {
+    TaskGroup() noexcept = default;
+
+    TaskGroup(const TaskGroup&) = delete;
+    TaskGroup(TaskGroup&&) = delete;
+    TaskGroup& operator=(const TaskGroup&) = delete;
+    TaskGroup& operator=(TaskGroup&&) = delete;
+
+    // Tasks that are not finished yet.
+    std::atomic<size_t> remaining { 0 };
+
+    // Tasks that are not started yet.
+    std::atomic<size_t> queued { 0 };
+};
+
+// Work stealing thread pool. Every worker owns a task queue, takes tasks from its back and steals from the front of
+// other queues when its own runs dry. Threads that wait for a task group help to execute tasks of that group instead
+// of sleeping, so tasks are allowed to push more tasks and wait for them. Only tasks of the awaited group are picked
+// up, otherwise a waiting task could end up nested inside an unrelated long running task.
+//
+// Workers can be pinned to logical CPUs, one after another in the order of `cpus`, wrapping around when there are more
+// workers than CPUs. Pinned workers steal from the workers of their own NUMA node first, then take tasks pushed by
+// threads outside of the pool, which are whole manifest jobs, and only then steal from other nodes, so a job's
+// decode, filter and encode tasks stay on the node whose memory holds its buffers. Workers on efficiency cores take the
+// newest tasks pushed from outside of the pool, which are the shortest manifest jobs, and leave the long ones to the
+// performance cores.
+struct ThreadPool final {
+    // With zero workers all the tasks are executed by the threads that wait for them. Workers aren't pinned when `cpus`
+    // is empty.
+    explicit ThreadPool(size_t worker_count, const std::vector<LogicalCpu>& cpus = {});
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool(ThreadPool&&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+    ThreadPool& operator=(ThreadPool&&) = delete;
+
+    ~ThreadPool();
+
+    size_t worker_count() const noexcept;
+
+    // CPU time of every worker in seconds, for telling how busy the workers were.
+    std::vector<double> get_worker_cpu_times();
+
+    // Tasks executed since the last call and how long they waited in the queues from their push until a thread took
+    // them, for the schedule report of manifests.
+    struct TaskWaits final {
+        uint64_t count = 0;
+        double seconds = 0.0;
+        double max_seconds = 0.0;
+    };
+    TaskWaits take_task_waits() noexcept;
+
+    void push(TaskGroup& group, std::function<void()> task);
+    void wait(TaskGroup& group);
+
+private:
+    struct Task final {
+        TaskGroup* group;
+        std::function<void()> function;
+
+        // Job and phase of the thread that pushed the task, which tag the samples of the profiler while it runs.
+        ProfileTag tag;
+
+        std::chrono::steady_clock::time_point push_time;
+    };
+
+    struct Queue final {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    void worker_thread(size_t index, int cpu);
+    bool run_task(size_t index, const TaskGroup* group);
+    void execute(Task& task);
+
+    // The last queue is shared by threads that don't belong to the pool.
+    std::unique_ptr<Queue[]> queues;
+    size_t queue_count;
+
+    // Queues every queue's owner steals from, in order, and whether the owner takes the newest task of the shared queue.
+    std::vector<std::vector<size_t>> steal_orders;
+    std::vector<bool> is_efficiency;
+
+    std::vector<std::thread> threads;
+
+    std::mutex sleep_mutex;
+    std::condition_variable sleep_condition;
+    std::atomic<size_t> pending_tasks { 0 };
+    bool is_stopping = false;
+
+    // Totals of `take_task_waits` in nanoseconds.
+    std::atomic<uint64_t> executed_tasks { 0 };
+    std::atomic<uint64_t> task_wait_nanoseconds { 0 };
+    std::atomic<uint64_t> max_task_wait_nanoseconds { 0 };
+};
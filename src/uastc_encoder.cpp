@@ -0,0 +1,144 @@
+#include "uastc_encoder.h"
+#include "block_delta.h"
+#include "dds_layout.h"
+#include "thread_pool.h"
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(TEXTURE_COMPILER_BASISU)
+#include <encoder/basisu_enc.h>
+#include <encoder/basisu_uastc_enc.h>
+#endif
+
+// Number of block rows encoded by one thread pool task. UASTC blocks take longer than ASTC ones.
+static constexpr size_t UASTC_TASK_BLOCK_ROWS = 4;
+
+#if defined(TEXTURE_COMPILER_BASISU)
+// Levels of the UASTC packer from the fastest to the slowest.
+static uint32_t get_uastc_level(EncoderQuality quality) noexcept {
+    switch (quality) {
+        case EncoderQuality::FASTEST:
+            return basisu::cPackUASTCLevelFastest;
+        case EncoderQuality::NORMAL:
+            return basisu::cPackUASTCLevelFaster;
+        case EncoderQuality::PRODUCTION:
+            return basisu::cPackUASTCLevelDefault;
+        default:
+            return basisu::cPackUASTCLevelSlower;
+    }
+}
+
+// Basis Universal builds its tables once, before the tasks race for them.
+static void initialize_basisu() {
+    static const bool is_initialized = [] {
+        basisu::basisu_encoder_init();
+        return true;
+    }();
+    (void)is_initialized;
+}
+
+static void encode_block_rows(const uint8_t* input, bool is_r8, size_t width, size_t height, size_t row_begin, size_t row_end, uint32_t level, uint8_t* output,
+                              const uint8_t* previous, const uint8_t* is_changed) noexcept {
+    const size_t blocks_x = (width + 3) / 4;
+
+    for (size_t block_y = row_begin; block_y < row_end; block_y++) {
+        for (size_t block_x = 0; block_x < blocks_x; block_x++) {
+            const size_t index = block_y * blocks_x + block_x;
+            if (is_changed != nullptr && is_changed[index] == 0) {
+                std::memcpy(output + index * 16, previous + index * 16, 16);
+                continue;
+            }
+
+            uint8_t pixels[16 * 4];
+            for (size_t y = 0; y < 4; y++) {
+                for (size_t x = 0; x < 4; x++) {
+                    const size_t pixel_x = std::min(block_x * 4 + x, width - 1);
+                    const size_t pixel_y = std::min(block_y * 4 + y, height - 1);
+                    uint8_t* destination = pixels + (y * 4 + x) * 4;
+                    if (is_r8) {
+                        const uint8_t value = input[pixel_y * width + pixel_x];
+                        destination[0] = value;
+                        destination[1] = value;
+                        destination[2] = value;
+                        destination[3] = 255;
+                    } else {
+                        const uint8_t* source = input + (pixel_y * width + pixel_x) * 4;
+                        destination[0] = source[2];
+                        destination[1] = source[1];
+                        destination[2] = source[0];
+                        destination[3] = source[3];
+                    }
+                }
+            }
+
+            basist::uastc_block block;
+            basisu::encode_uastc(pixels, block, level);
+            std::memcpy(output + index * 16, &block, 16);
+        }
+    }
+}
+#endif
+
+bool encode_uastc(std::vector<char>& dds, const MipQualities& qualities, ThreadPool& pool, std::ostream& log, const BlockReuse* reuse) {
+    Dds10Header header;
+    if (!read_dds10_header(dds.data(), dds.size(), header) || (header.dxgi_format != DXGI_FORMAT_B8G8R8A8_UNORM && header.dxgi_format != DXGI_FORMAT_R8_UNORM)) {
+        log << "\rTexture compiler error. UASTC encoder requires a B8G8R8A8 or R8 DDS texture with the DX10 header." << std::endl;
+        return false;
+    }
+
+    if (header.dimension != DDS10_DIMENSION_TEXTURE_2D || header.misc_flags != 0) {
+        log << "\rTexture compiler error. UASTC encoder supports only 2D textures and texture arrays." << std::endl;
+        return false;
+    }
+
+    const bool is_r8 = header.dxgi_format == DXGI_FORMAT_R8_UNORM;
+    const TextureFormatSize* format_size = find_texture_format_size(DXGI_FORMAT_UNKNOWN, is_r8 ? UASTC_RRR_VK_FORMAT : UASTC_RGBA_VK_FORMAT);
+    const EncodedLayout layout = get_encoded_layout(header, is_r8 ? 1 : 4, format_size->block_size);
+    if (layout.input_size != dds.size()) {
+        log << "\rTexture compiler error. DDS texture size doesn't match its mip levels." << std::endl;
+        return false;
+    }
+
+#if defined(TEXTURE_COMPILER_BASISU)
+    reuse = match_block_reuse(reuse, layout);
+
+    initialize_basisu();
+
+    std::vector<char> uastc(layout.output_size);
+    std::memcpy(uastc.data(), dds.data(), DDS10_HEADER_SIZE);
+    std::memcpy(uastc.data() + 128, &DXGI_FORMAT_UNKNOWN, sizeof(DXGI_FORMAT_UNKNOWN));
+
+    TaskGroup group;
+
+    for (const EncodedLevel& level : layout.levels) {
+        const size_t level_width = level.input.width;
+        const size_t level_height = level.input.height;
+        const size_t blocks_y = (level_height + 3) / 4;
+
+        const uint8_t* input = reinterpret_cast<const uint8_t*>(dds.data() + level.input.offset);
+        uint8_t* output = reinterpret_cast<uint8_t*>(uastc.data() + level.output.offset);
+        const uint8_t* previous = reuse != nullptr ? reinterpret_cast<const uint8_t*>(reuse->previous.data() + level.output.offset) : nullptr;
+        const uint8_t* is_changed = reuse != nullptr ? reuse->is_changed.data() + level.first_block : nullptr;
+        const uint32_t uastc_level = get_uastc_level(get_mip_quality(qualities, level.input.mip_level));
+
+        for (size_t row = 0; row < blocks_y; row += UASTC_TASK_BLOCK_ROWS) {
+            const size_t row_end = std::min(row + UASTC_TASK_BLOCK_ROWS, blocks_y);
+            pool.push(group, [=] {
+                encode_block_rows(input, is_r8, level_width, level_height, row, row_end, uastc_level, output, previous, is_changed);
+            });
+        }
+    }
+
+    pool.wait(group);
+
+    dds = std::move(uastc);
+    return true;
+#else
+    (void)qualities;
+    (void)pool;
+    (void)reuse;
+    log << "\rTexture compiler error. Built without Basis Universal, --target uastc is not available." << std::endl;
+    return false;
+#endif
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "encoder_quality.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+struct BlockReuse;
+struct ThreadPool;
+
+// KTX2 stores UASTC with `VK_FORMAT_UNDEFINED` and tells it apart by its data format descriptor. These stand for the
+// blocks where the compiler passes Vulkan formats along, past the range of Vulkan formats, and only virtual textures
+// write them. Parallax textures are UASTC of gray pixels, which transcoders turn into single channel formats.
+static constexpr uint32_t UASTC_RGBA_VK_FORMAT = 0xFFFF0001;
+static constexpr uint32_t UASTC_RRR_VK_FORMAT = 0xFFFF0002;
+
+// Replaces the B8G8R8A8 or R8 mip levels of a 2D DDS texture with the DX10 header with 16-byte UASTC 4x4 blocks of
+// Basis Universal, which a runtime transcodes to BC7, ASTC 4x4, ETC2 or whatever the GPU supports. R8 levels are
+// encoded as gray. The DXGI format becomes `DXGI_FORMAT_UNKNOWN`, so the texture must be converted to KTX2 with
+// `UASTC_RGBA_VK_FORMAT` or `UASTC_RRR_VK_FORMAT`. Block rows are encoded on the thread pool, `qualities` are the
+// search effort of every mip level. Fails when the compiler is built without Basis Universal.
+bool encode_uastc(std::vector<char>& dds, const MipQualities& qualities, ThreadPool& pool, std::ostream& log, const BlockReuse* reuse = nullptr);
@@ -0,0 +1,128 @@
+#include "virtual_texture.h"
+#include "dds_layout.h"
+
+#include <algorithm>
+#include <cstring>
+
+static void write_32(std::vector<char>& data, size_t offset, uint32_t value) noexcept {
+    std::memcpy(data.data() + offset, &value, sizeof(value));
+}
+
+static size_t align_offset(size_t offset) noexcept {
+    return (offset + VIRTUAL_TEXTURE_ALIGNMENT - 1) / VIRTUAL_TEXTURE_ALIGNMENT * VIRTUAL_TEXTURE_ALIGNMENT;
+}
+
+bool split_into_pages(const std::vector<char>& dds, size_t page_size, size_t border, std::vector<char>& pages, std::vector<VirtualTextureMipLevel>& mip_levels,
+                      std::ostream& log) {
+    Dds10Header header;
+    if (!read_dds10_header(dds.data(), dds.size(), header) || (header.dxgi_format != DXGI_FORMAT_B8G8R8A8_UNORM && header.dxgi_format != DXGI_FORMAT_R8_UNORM)) {
+        log << "\rTexture compiler error. Virtual texture requires a B8G8R8A8 or R8 DDS texture with the DX10 header." << std::endl;
+        return false;
+    }
+
+    const uint32_t height = header.height;
+    const uint32_t width = header.width;
+    const uint32_t level_count = header.level_count;
+    const size_t pixel_size = header.dxgi_format == DXGI_FORMAT_R8_UNORM ? 1 : 4;
+
+    if (header.dimension != DDS10_DIMENSION_TEXTURE_2D || header.misc_flags != 0 || header.array_size > 1) {
+        log << "\rTexture compiler error. Virtual texture supports only 2D textures." << std::endl;
+        return false;
+    }
+
+    const std::vector<DdsLevel> levels = get_dds_levels(width, height, level_count, 1, static_cast<uint32_t>(pixel_size), false);
+    if (get_dds_size(levels) != dds.size()) {
+        log << "\rTexture compiler error. DDS texture size doesn't match its mip levels." << std::endl;
+        return false;
+    }
+
+    mip_levels.clear();
+
+    size_t page_count = 0;
+    for (uint32_t level = 0; level < level_count; level++) {
+        VirtualTextureMipLevel mip_level;
+        mip_level.width = std::max(width >> level, 1U);
+        mip_level.height = std::max(height >> level, 1U);
+        mip_level.page_count_x = static_cast<uint32_t>((mip_level.width + page_size - 1) / page_size);
+        mip_level.page_count_y = static_cast<uint32_t>((mip_level.height + page_size - 1) / page_size);
+        mip_level.first_page = page_count;
+        mip_levels.push_back(mip_level);
+
+        page_count += static_cast<size_t>(mip_level.page_count_x) * mip_level.page_count_y;
+        if (mip_level.page_count_x == 1 && mip_level.page_count_y == 1) {
+            break;
+        }
+    }
+
+    const size_t page_texels = page_size + border * 2;
+    const size_t page_bytes = page_texels * page_texels * pixel_size;
+
+    pages.assign(DDS10_HEADER_SIZE + page_bytes * page_count, 0);
+    std::memcpy(pages.data(), dds.data(), DDS10_HEADER_SIZE);
+    write_32(pages, 12, static_cast<uint32_t>(page_texels));
+    write_32(pages, 16, static_cast<uint32_t>(page_texels));
+    write_32(pages, 28, 1);
+    write_32(pages, 140, static_cast<uint32_t>(page_count));
+
+    for (size_t level = 0; level < mip_levels.size(); level++) {
+        const VirtualTextureMipLevel& mip_level = mip_levels[level];
+        const char* input = dds.data() + levels[level].offset;
+
+        for (size_t page_y = 0; page_y < mip_level.page_count_y; page_y++) {
+            for (size_t page_x = 0; page_x < mip_level.page_count_x; page_x++) {
+                char* output = pages.data() + DDS10_HEADER_SIZE + (mip_level.first_page + page_y * mip_level.page_count_x + page_x) * page_bytes;
+
+                // Texels past the edges of the mip level repeat the edge, `ptrdiff_t` keeps the left and top borders signed.
+                for (size_t y = 0; y < page_texels; y++) {
+                    const ptrdiff_t row = static_cast<ptrdiff_t>(page_y * page_size + y) - static_cast<ptrdiff_t>(border);
+                    const size_t source_y = static_cast<size_t>(std::min<ptrdiff_t>(std::max<ptrdiff_t>(row, 0), mip_level.height - 1));
+                    for (size_t x = 0; x < page_texels; x++) {
+                        const ptrdiff_t column = static_cast<ptrdiff_t>(page_x * page_size + x) - static_cast<ptrdiff_t>(border);
+                        const size_t source_x = static_cast<size_t>(std::min<ptrdiff_t>(std::max<ptrdiff_t>(column, 0), mip_level.width - 1));
+                        std::memcpy(output + (y * page_texels + x) * pixel_size, input + (source_y * mip_level.width + source_x) * pixel_size, pixel_size);
+                    }
+                }
+            }
+        }
+    }
+    return true;
+}
+
+bool write_virtual_texture(const std::vector<char>& pages, const std::vector<VirtualTextureMipLevel>& mip_levels, uint32_t width, uint32_t height,
+                           size_t page_size, size_t border, uint32_t vk_format, std::vector<char>& output, std::ostream& log) {
+    const size_t page_count = pages.size() >= DDS10_HEADER_SIZE ? read_32(pages, 140) : 0;
+    if (page_count == 0 || (pages.size() - DDS10_HEADER_SIZE) % page_count != 0) {
+        log << "\rTexture compiler error. Virtual texture pages don't match their mip levels." << std::endl;
+        return false;
+    }
+
+    const size_t page_bytes = (pages.size() - DDS10_HEADER_SIZE) / page_count;
+
+    VirtualTextureHeader header {};
+    std::memcpy(header.magic, VIRTUAL_TEXTURE_MAGIC, sizeof(VIRTUAL_TEXTURE_MAGIC));
+    header.version = VIRTUAL_TEXTURE_VERSION;
+    header.dxgi_format = read_32(pages, 128);
+    header.vk_format = header.dxgi_format == 0 ? vk_format : 0;
+    header.width = width;
+    header.height = height;
+    header.mip_level_count = static_cast<uint32_t>(mip_levels.size());
+    header.page_size = static_cast<uint32_t>(page_size);
+    header.border = static_cast<uint32_t>(border);
+    header.page_count = static_cast<uint32_t>(page_count);
+    header.mip_level_offset = sizeof(VirtualTextureHeader);
+    header.page_offset = header.mip_level_offset + sizeof(VirtualTextureMipLevel) * mip_levels.size();
+
+    const size_t data_offset = align_offset(header.page_offset + sizeof(VirtualTexturePage) * page_count);
+    const size_t aligned_page_bytes = align_offset(page_bytes);
+
+    output.assign(data_offset + aligned_page_bytes * (page_count - 1) + page_bytes, 0);
+    std::memcpy(output.data(), &header, sizeof(header));
+    std::memcpy(output.data() + header.mip_level_offset, mip_levels.data(), sizeof(VirtualTextureMipLevel) * mip_levels.size());
+
+    for (size_t page = 0; page < page_count; page++) {
+        const VirtualTexturePage entry { data_offset + aligned_page_bytes * page, page_bytes };
+        std::memcpy(output.data() + header.page_offset + sizeof(VirtualTexturePage) * page, &entry, sizeof(entry));
+        std::memcpy(output.data() + entry.offset, pages.data() + DDS10_HEADER_SIZE + page_bytes * page, page_bytes);
+    }
+    return true;
+}
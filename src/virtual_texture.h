@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+// Virtual texture of `--tiles`, every mip level split into square pages with borders of texels of their neighbors, so
+// a runtime can place any page anywhere in a physical page cache and filter across page edges. Pages are encoded on
+// their own, the border texels included, so every page is complete without its neighbors. All integers are little
+// endian, all offsets are from the start of the file:
+//
+//   Header       `VirtualTextureHeader`.
+//   Mip levels   `VirtualTextureMipLevel` per mip level from the largest.
+//   Pages        `VirtualTexturePage` per page of every mip level from the largest, rows of pages from the top.
+//   Data         Blocks of every page, rows of blocks from the top, every page starting at a multiple of
+//                `VIRTUAL_TEXTURE_ALIGNMENT`.
+//
+// Page `x`, `y` of a mip level holds the texels from `x * page_size - border` to `(x + 1) * page_size + border` and the
+// same rows, texels past the edges of the mip level repeat the edge. Mip levels smaller than a page are left out, the
+// last one fits in a single page, which a runtime keeps resident as the fallback of every other page.
+static constexpr char VIRTUAL_TEXTURE_MAGIC[4] = { 'T', 'C', 'V', 'T' };
+static constexpr uint32_t VIRTUAL_TEXTURE_VERSION = 1;
+
+// Data of every page starts at a multiple of this, so pages are read straight into GPU memory.
+static constexpr uint32_t VIRTUAL_TEXTURE_ALIGNMENT = 512;
+
+// Page sizes are powers of two in this range, so mip levels split into whole pages until they fit in one.
+static constexpr size_t VIRTUAL_TEXTURE_MIN_PAGE_SIZE = 16;
+static constexpr size_t VIRTUAL_TEXTURE_MAX_PAGE_SIZE = 4096;
+static constexpr size_t VIRTUAL_TEXTURE_MAX_BORDER = 64;
+
+struct VirtualTextureHeader final {
+    char magic[4];
+    uint32_t version;
+
+    // DXGI format of the pages, `DXGI_FORMAT_UNKNOWN` for ETC2, ASTC and UASTC, whose `vk_format` is the one passed to
+    // `convert_dds_to_ktx2`. Zero `vk_format` for the rest.
+    uint32_t dxgi_format;
+    uint32_t vk_format;
+
+    uint32_t width;
+    uint32_t height;
+    uint32_t mip_level_count;
+    uint32_t page_size;
+    uint32_t border;
+    uint32_t page_count;
+    uint64_t mip_level_offset;
+    uint64_t page_offset;
+};
+
+struct VirtualTextureMipLevel final {
+    uint32_t width;
+    uint32_t height;
+    uint32_t page_count_x;
+    uint32_t page_count_y;
+
+    // Index of the first `VirtualTexturePage` of the mip level.
+    uint64_t first_page;
+};
+
+struct VirtualTexturePage final {
+    uint64_t offset;
+    uint64_t size;
+};
+
+static_assert(sizeof(VirtualTextureHeader) == 56 && sizeof(VirtualTextureMipLevel) == 24 && sizeof(VirtualTexturePage) == 16,
+              "Virtual texture structures must have no padding.");
+
+// Splits the B8G8R8A8 or R8 mip levels of a 2D DDS texture with the DX10 header into the pages of a virtual texture,
+// which are written to `pages` as a DDS texture array of a single mip level with a layer per page, so the built-in
+// encoders encode all of them at once. `mip_levels` describe where the pages of every mip level are.
+bool split_into_pages(const std::vector<char>& dds, size_t page_size, size_t border, std::vector<char>& pages, std::vector<VirtualTextureMipLevel>& mip_levels,
+                      std::ostream& log);
+
+// Writes the virtual texture of the `pages` texture array of `split_into_pages` once it's encoded. `vk_format` tells
+// formats without a DXGI format apart like in `convert_dds_to_ktx2`.
+bool write_virtual_texture(const std::vector<char>& pages, const std::vector<VirtualTextureMipLevel>& mip_levels, uint32_t width, uint32_t height,
+                           size_t page_size, size_t border, uint32_t vk_format, std::vector<char>& output, std::ostream& log);